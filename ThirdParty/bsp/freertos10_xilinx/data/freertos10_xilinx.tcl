@@ -223,6 +223,9 @@ proc generate {os_handle} {
 	file copy -force [file join src Source timers.c] ./src
 	file copy -force [file join src Source event_groups.c] ./src
 	file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	if { [common::get_property CONFIG.use_heap_slab $os_handle] == "true" } {
+		file copy -force [file join src Source portable MemMang heap_slab.c] ./src
+	}
 
 	if { $proctype == "psu_cortexr5" } {
 		file copy -force [file join src Source portable GCC ARM_CR5 port.c] ./src
@@ -496,6 +499,18 @@ proc generate {os_handle} {
 	set total_heap_size [common::get_property CONFIG.total_heap_size $os_handle]
 	xput_define $config_file "configTOTAL_HEAP_SIZE"  "( ( size_t ) ( $total_heap_size ) )"
 
+	set val [common::get_property CONFIG.use_heap_slab $os_handle]
+	if {$val == "true"} {
+		set heap_slab_size [common::get_property CONFIG.heap_slab_size $os_handle]
+		if { [expr $heap_slab_size % 2048] != 0 || $heap_slab_size < 2048 } {
+			error "ERROR: heap_slab_size must be a non-zero multiple of 2048"
+		}
+		xput_define $config_file "configUSE_HEAP_SLAB"	"1"
+		xput_define $config_file "configHEAP_SLAB_SIZE"	"$heap_slab_size"
+	} else {
+		xput_define $config_file "configUSE_HEAP_SLAB"	"0"
+	}
+
 	set max_task_name_len [common::get_property CONFIG.max_task_name_len $os_handle]
 	xput_define $config_file "configMAX_TASK_NAME_LEN"  $max_task_name_len
 
@@ -594,7 +609,12 @@ proc generate {os_handle} {
 		xput_define $config_file "configNUM_THREAD_LOCAL_STORAGE_POINTERS"  $val
 	}
 
-	puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	set val [common::get_property CONFIG.use_tickless_idle $os_handle]
+	if {$val == "true" && ($proctype == "psu_cortexr5" || $proctype == "psu_cortexa53")} {
+		xput_define $config_file "configUSE_TICKLESS_IDLE"	"1"
+	} else {
+		xput_define $config_file "configUSE_TICKLESS_IDLE"	"0"
+	}
 	puts $config_file "#define configTASK_RETURN_ADDRESS    NULL"
 	puts $config_file "#define INCLUDE_vTaskPrioritySet             1"
 	puts $config_file "#define INCLUDE_uxTaskPriorityGet            1"
@@ -803,6 +803,10 @@ extern "C" {
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
 
+#ifndef configUSE_HEAP_SLAB
+	#define configUSE_HEAP_SLAB 0
+#endif
+
 #ifndef configUSE_TASK_NOTIFICATIONS
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
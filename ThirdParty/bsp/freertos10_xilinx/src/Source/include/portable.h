@@ -133,6 +133,17 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_HEAP_SLAB == 1 )
+	/*
+	 * Provided by heap_slab.c.  Allocate and free blocks of the slab size
+	 * classes from an interrupt.  pvPortMallocFromISR() returns NULL instead
+	 * of falling back to the general heap.
+	 */
+	void *pvPortMallocFromISR( size_t xSize ) PRIVILEGED_FUNCTION;
+	void vPortFreeFromISR( void *pv ) PRIVILEGED_FUNCTION;
+	size_t xPortGetFreeSlabPages( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
@@ -825,6 +825,157 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
  */
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                 void **ppvTxData,
+                                 size_t xMaxLengthBytes );
+</pre>
+ *
+ * Lends the writer a contiguous region of free space inside the stream buffer
+ * so data can be produced in place, for example by a DMA engine, instead of
+ * being copied in by xStreamBufferSend().  The region ends at the end of the
+ * buffer storage, so a second reserve may be needed after a wrap.  Nothing is
+ * visible to the reader until the bytes are passed to
+ * xStreamBufferSendCommit() or xStreamBufferSendCommitFromISR().
+ *
+ * Zero copy access is only available for stream buffers, not message buffers.
+ * This function never blocks and can be called from an interrupt service
+ * routine.  The single writer rules of xStreamBufferSend() apply.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param ppvTxData Set to the start of the reserved region.
+ *
+ * @param xMaxLengthBytes The maximum number of bytes to reserve.
+ *
+ * @return The number of contiguous bytes that can be written at *ppvTxData,
+ * which is 0 if the stream buffer is full.
+ *
+ * \defgroup xStreamBufferSendReserve xStreamBufferSendReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+								 void **ppvTxData,
+								 size_t xMaxLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes );
+
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                       size_t xDataLengthBytes,
+                                       BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Publishes the first xDataLengthBytes of the region returned by
+ * xStreamBufferSendReserve() to the reader, unblocking a task waiting for data
+ * once the trigger level is reached.  Use the FromISR version from an
+ * interrupt service routine, such as a DMA completion handler.
+ *
+ * @param xStreamBuffer The handle of the stream buffer written to.
+ *
+ * @param xDataLengthBytes The number of bytes written, which must not exceed
+ * the number returned by xStreamBufferSendReserve().
+ *
+ * @param pxHigherPriorityTaskWoken As for xStreamBufferSendFromISR().
+ *
+ * @return The number of bytes committed.
+ *
+ * \defgroup xStreamBufferSendCommit xStreamBufferSendCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+								size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									   size_t xDataLengthBytes,
+									   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+                                    void **ppvRxData,
+                                    size_t xMaxLengthBytes,
+                                    TickType_t xTicksToWait );
+
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           void **ppvRxData,
+                                           size_t xMaxLengthBytes );
+</pre>
+ *
+ * Lends the reader the contiguous data at the front of the stream buffer so it
+ * can be consumed in place instead of being copied out by
+ * xStreamBufferReceive().  The data stays in the buffer until it is passed to
+ * xStreamBufferReceiveRelease() or xStreamBufferReceiveReleaseFromISR().  The
+ * task version can block for up to xTicksToWait ticks waiting for data; the
+ * FromISR version never blocks.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param ppvRxData Set to the start of the data.
+ *
+ * @param xMaxLengthBytes The maximum number of bytes to acquire.
+ *
+ * @param xTicksToWait As for xStreamBufferReceive().
+ *
+ * @return The number of contiguous bytes that can be read at *ppvRxData,
+ * which is 0 if the stream buffer is empty.
+ *
+ * \defgroup xStreamBufferReceiveAcquire xStreamBufferReceiveAcquire
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+									void **ppvRxData,
+									size_t xMaxLengthBytes,
+									TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										   void **ppvRxData,
+										   size_t xMaxLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xDataLengthBytes );
+
+size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xDataLengthBytes,
+                                           BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Returns the first xDataLengthBytes of the region obtained from
+ * xStreamBufferReceiveAcquire() to the writer, unblocking a task waiting for
+ * space.
+ *
+ * @param xStreamBuffer The handle of the stream buffer read from.
+ *
+ * @param xDataLengthBytes The number of bytes consumed, which must not exceed
+ * the number returned by xStreamBufferReceiveAcquire().
+ *
+ * @param pxHigherPriorityTaskWoken As for xStreamBufferReceiveFromISR().
+ *
+ * @return The number of bytes released.
+ *
+ * \defgroup xStreamBufferReceiveRelease xStreamBufferReceiveRelease
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+									size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+										   size_t xDataLengthBytes,
+										   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
 												 size_t xTriggerLevelBytes,
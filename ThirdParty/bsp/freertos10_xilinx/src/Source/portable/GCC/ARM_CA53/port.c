@@ -121,6 +121,9 @@ point is zero. */
 /* The I bit in the DAIF bits. */
 #define portDAIF_I						( 0x80 )
 
+/* Owner of a recursive lock that is not held. */
+#define portLOCK_NO_OWNER				( 0xFFFFFFFFUL )
+
 /* Macro to unmask all interrupt priorities. */
 #define portCLEAR_INTERRUPT_MASK()									\
 {																	\
@@ -170,6 +173,13 @@ uint64_t ullPortYieldRequired = pdFALSE;
 if the nesting depth is 0. */
 uint64_t ullPortInterruptNesting = 0;
 
+#if( configNUMBER_OF_CORES > 1 )
+	/* Spinlock words and the owner/nesting state of the recursive locks. */
+	static volatile uint32_t ulPortSpinLocks[ 2 ] = { 0 };
+	static volatile uint32_t ulPortLockOwner[ 2 ] = { portLOCK_NO_OWNER, portLOCK_NO_OWNER };
+	static uint32_t ulPortLockCount[ 2 ] = { 0 };
+#endif
+
 /* Used in the ASM code. */
 __attribute__(( used )) const uint64_t ullICCEOIR = portICCEOIR_END_OF_INTERRUPT_REGISTER_ADDRESS;
 __attribute__(( used )) const uint64_t ullICCIAR = portICCIAR_INTERRUPT_ACKNOWLEDGE_REGISTER_ADDRESS;
@@ -559,6 +569,68 @@ void FreeRTOS_Tick_Handler( void )
 }
 /*-----------------------------------------------------------*/
 
+#if( configNUMBER_OF_CORES > 1 )
+
+static void prvSpinLockTake( volatile uint32_t *pulLock )
+{
+	/* Wait in WFE until the lock word reads 0, then claim it exclusively.  The
+	store-release in prvSpinLockGive() clears the exclusive monitor of any
+	waiting core, which generates the wake-up event. */
+	__asm volatile (	"	SEVL				\n"
+						"1:	WFE					\n"
+						"	LDAXR	W1, [%0]	\n"
+						"	CBNZ	W1, 1b		\n"
+						"	MOV		W2, #1		\n"
+						"	STXR	W1, W2, [%0]	\n"
+						"	CBNZ	W1, 1b		\n"
+						: : "r"( pulLock ) : "x1", "x2", "memory" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSpinLockGive( volatile uint32_t *pulLock )
+{
+	__asm volatile ( "STLR WZR, [%0]" : : "r"( pulLock ) : "memory" );
+}
+/*-----------------------------------------------------------*/
+
+void vPortRecursiveLock( uint32_t ulLockNum, BaseType_t xAcquire )
+{
+uint32_t ulCoreID = ( uint32_t ) portGET_CORE_ID();
+
+	configASSERT( ulLockNum < 2UL );
+
+	if( xAcquire != pdFALSE )
+	{
+		/* Only the owning core can see its own ID in the owner field, as it
+		is reset before the lock is released. */
+		if( ulPortLockOwner[ ulLockNum ] == ulCoreID )
+		{
+			ulPortLockCount[ ulLockNum ]++;
+		}
+		else
+		{
+			prvSpinLockTake( &( ulPortSpinLocks[ ulLockNum ] ) );
+			ulPortLockOwner[ ulLockNum ] = ulCoreID;
+			ulPortLockCount[ ulLockNum ] = 1UL;
+		}
+	}
+	else
+	{
+		configASSERT( ulPortLockOwner[ ulLockNum ] == ulCoreID );
+		configASSERT( ulPortLockCount[ ulLockNum ] != 0UL );
+
+		ulPortLockCount[ ulLockNum ]--;
+		if( ulPortLockCount[ ulLockNum ] == 0UL )
+		{
+			ulPortLockOwner[ ulLockNum ] = portLOCK_NO_OWNER;
+			prvSpinLockGive( &( ulPortSpinLocks[ ulLockNum ] ) );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configNUMBER_OF_CORES */
+
 void vPortTaskUsesFPU( void )
 {
 	/* A task is registering the fact that it needs an FPU context.  Set the
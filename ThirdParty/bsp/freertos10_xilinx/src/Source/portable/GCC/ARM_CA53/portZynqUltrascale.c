@@ -33,10 +33,66 @@
 /* Xilinx includes. */
 #include "xttcps.h"
 #include "xscugic.h"
+#include "sleep.h"
 
 /* Timer used to generate the tick interrupt. */
 static XTtcPs xTimerInstance;
 XScuGic xInterruptController;
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+/* Tickless idle masks IRQs in the CPU rather than through the GIC priority mask
+so that a pending interrupt still wakes the core from WFI. */
+#define portTICKLESS_IRQ_DISABLE()		portDISABLE_INTERRUPTS()
+#define portTICKLESS_IRQ_ENABLE()		portENABLE_INTERRUPTS()
+
+#define portTICKLESS_WFI()											\
+	__asm volatile ( "DSB SY" ::: "memory" );						\
+	__asm volatile ( "WFI" );										\
+	__asm volatile ( "ISB SY" );
+
+/* Interval register value for a single tick, and the number of ticks the
+counter can cover before it would overflow. */
+static XInterval xTickInterval;
+static TickType_t xMaximumPossibleSuppressedTicks;
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+/* Nesting counts maintained by port.c. */
+extern volatile uint64_t ullCriticalNesting;
+extern uint64_t ullPortInterruptNesting;
+
+/*
+ * Sleep hook installed in the BSP so usleep() and sleep() block the calling task
+ * rather than spin.  Whole tick periods are waited with vTaskDelay(), which may
+ * return up to one period early, so the part of the delay below one period is
+ * left for the BSP to busy-wait.  Interrupts, critical sections and code
+ * running before the scheduler starts cannot block and just busy-wait.
+ */
+static unsigned long prvSleepHook( void *pvCallBackRef, unsigned long ulMicroSeconds )
+{
+const uint64_t ullMicroSecondsPerTick = 1000000ULL / ( uint64_t ) configTICK_RATE_HZ;
+TickType_t xTicks;
+unsigned long ulRemaining = ulMicroSeconds;
+
+	( void ) pvCallBackRef;
+
+	if( ( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING ) &&
+		( ullPortInterruptNesting == 0 ) && ( ullCriticalNesting == 0 ) )
+	{
+		xTicks = ( TickType_t ) ( ( uint64_t ) ulMicroSeconds / ullMicroSecondsPerTick );
+		if( xTicks > ( TickType_t ) 0 )
+		{
+			vTaskDelay( xTicks + ( TickType_t ) 1 );
+			ulRemaining = ( unsigned long ) ( ( uint64_t ) ulMicroSeconds -
+						( ( uint64_t ) xTicks * ullMicroSecondsPerTick ) );
+		}
+	}
+
+	return ulRemaining;
+}
+
 /*-----------------------------------------------------------*/
 
 void FreeRTOS_SetupTickInterrupt( void )
@@ -87,6 +143,13 @@ XScuGic_Config *pxInterruptControllerConfig;
 	XTtcPs_SetInterval( &xTimerInstance, usInterval );
 	XTtcPs_SetPrescaler( &xTimerInstance, ucPrescale );
 
+	#if( configUSE_TICKLESS_IDLE == 1 )
+	{
+		xTickInterval = usInterval;
+		xMaximumPossibleSuppressedTicks = XTTCPS_MAX_INTERVAL_COUNT / ( ( uint32_t ) usInterval + 1UL );
+	}
+	#endif
+
 	/* The priority must be the lowest possible. */
 	XScuGic_SetPriorityTriggerType( &xInterruptController, configTIMER_INTERRUPT_ID, portLOWEST_USABLE_INTERRUPT_PRIORITY << portPRIORITY_SHIFT, ucLevelSensitive );
 
@@ -104,6 +167,16 @@ XScuGic_Config *pxInterruptControllerConfig;
 
 	/* Start the timer. */
 	XTtcPs_Start( &xTimerInstance );
+
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		/* The core that owns the tick also takes cross-core yields. */
+		vPortSetupYieldCoreInterrupt();
+	}
+	#endif
+
+	/* Let the BSP sleep routines block the calling task. */
+	Xil_SetSleepHook( prvSleepHook, NULL );
 }
 /*-----------------------------------------------------------*/
 
@@ -114,11 +187,144 @@ volatile uint32_t ulInterruptStatus;
 	/* Read the interrupt status, then write it back to clear the interrupt. */
 	ulInterruptStatus = XTtcPs_GetInterruptStatus( &xTimerInstance );
 	XTtcPs_ClearInterruptStatus( &xTimerInstance, ulInterruptStatus );
+
+	#if( configUSE_TICKLESS_IDLE == 1 )
+	{
+		/* The period may have been stretched by vPortSuppressTicksAndSleep(),
+		the counter has restarted from zero so go back to single ticks. */
+		XTtcPs_SetInterval( &xTimerInstance, xTickInterval );
+	}
+	#endif
 	__asm volatile( "DSB SY" );
 	__asm volatile( "ISB SY" );
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+static BaseType_t prvTickInterruptPending( void )
+{
+uint32_t ulPending;
+
+	ulPending = XScuGic_DistReadReg( &xInterruptController, XSCUGIC_PENDING_SET_OFFSET + ( ( configTIMER_INTERRUPT_ID / 32U ) * 4U ) );
+
+	return ( ( ulPending & ( 1UL << ( configTIMER_INTERRUPT_ID % 32U ) ) ) != 0UL ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint32_t ulTimerCountsForOneTick = ( uint32_t ) xTickInterval + 1UL;
+uint32_t ulCounter, ulCompleteTickPeriods;
+TickType_t xModifiableIdleTime;
+
+	/* Make sure the stretched interval still fits in the counter. */
+	if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+	{
+		xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+	}
+
+	/* Stop the tick timer while it is reprogrammed.  Time spent stopped is
+	lost, so keep this section short. */
+	portTICKLESS_IRQ_DISABLE();
+	XTtcPs_Stop( &xTimerInstance );
+
+	/* Abort if a task was made ready, or if a tick is already waiting to be
+	processed, since that would end the sleep straight away. */
+	if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) || ( prvTickInterruptPending() != pdFALSE ) )
+	{
+		XTtcPs_Start( &xTimerInstance );
+		portTICKLESS_IRQ_ENABLE();
+		return;
+	}
+
+	/* The counter keeps its position within the current tick and only the
+	interval is stretched, so the next interrupt lands on a tick boundary
+	xExpectedIdleTime ticks after the last one. */
+	XTtcPs_SetInterval( &xTimerInstance, ( XInterval ) ( ulTimerCountsForOneTick * ( uint32_t ) xExpectedIdleTime - 1UL ) );
+	XTtcPs_Start( &xTimerInstance );
+
+	/* Allow the application to define some pre-sleep processing.  It can
+	set xModifiableIdleTime to 0 to indicate it put the core to sleep itself. */
+	xModifiableIdleTime = xExpectedIdleTime;
+	configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+	if( xModifiableIdleTime > 0 )
+	{
+		portTICKLESS_WFI();
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	XTtcPs_Stop( &xTimerInstance );
+	ulCounter = XTtcPs_GetCounterValue( &xTimerInstance );
+
+	if( prvTickInterruptPending() != pdFALSE )
+	{
+		/* The timer expired and the counter restarted from zero.  The tick
+		handler runs as soon as interrupts are enabled and accounts for the
+		last period, and also restores the single tick interval. */
+		ulCompleteTickPeriods = ( uint32_t ) xExpectedIdleTime - 1UL;
+
+		if( ulCounter >= ulTimerCountsForOneTick )
+		{
+			XTtcPs_ResetCounterValue( &xTimerInstance );
+		}
+	}
+	else
+	{
+		/* Something other than the tick woke the core.  Step the ticks that
+		fully elapsed and leave the period stretched up to the next tick
+		boundary, the tick handler puts the interval back. */
+		ulCompleteTickPeriods = ulCounter / ulTimerCountsForOneTick;
+		XTtcPs_SetInterval( &xTimerInstance, ( XInterval ) ( ( ulCompleteTickPeriods + 1UL ) * ulTimerCountsForOneTick - 1UL ) );
+	}
+
+	XTtcPs_Start( &xTimerInstance );
+	vTaskStepTick( ( TickType_t ) ulCompleteTickPeriods );
+	portTICKLESS_IRQ_ENABLE();
+}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+static void prvYieldCoreHandler( void *pvUnused )
+{
+extern uint64_t ullPortYieldRequired;
+
+	( void ) pvUnused;
+
+	/* Another core changed the ready lists, select a task again on the way
+	out of the interrupt. */
+	ullPortYieldRequired = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetupYieldCoreInterrupt( void )
+{
+	XScuGic_Connect( &xInterruptController, configYIELD_CORE_SGI_ID, ( Xil_InterruptHandler ) prvYieldCoreHandler, NULL );
+	XScuGic_Enable( &xInterruptController, configYIELD_CORE_SGI_ID );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldCore( BaseType_t xCoreID )
+{
+	configASSERT( xCoreID < configNUMBER_OF_CORES );
+
+	if( xCoreID == portGET_CORE_ID() )
+	{
+		portYIELD();
+	}
+	else
+	{
+		/* The SGI target list is a bit mask of CPU interfaces. */
+		XScuGic_SoftwareIntr( &xInterruptController, configYIELD_CORE_SGI_ID, ( u32 ) 1U << ( u32 ) xCoreID );
+	}
+}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
 void vApplicationIRQHandler( uint32_t ulICCIAR )
 {
 extern const XScuGic_Config XScuGic_ConfigTable[];
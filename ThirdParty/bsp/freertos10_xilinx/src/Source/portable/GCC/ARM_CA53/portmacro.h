@@ -135,6 +135,12 @@ macros is used. */
 handler for whichever peripheral is used to generate the RTOS tick. */
 void FreeRTOS_Tick_Handler( void );
 
+/* Tickless idle/low power functionality. */
+#ifndef portSUPPRESS_TICKS_AND_SLEEP
+	extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
 /*
  * Installs pxHandler as the interrupt handler for the peripheral specified by
  * the ucInterruptID parameter.
@@ -216,6 +222,53 @@ void vPortTaskUsesFPU( void );
 	#define portASSERT_IF_INTERRUPT_PRIORITY_INVALID() 	vPortValidateInterruptPriority()
 #endif /* configASSERT */
 
+/*-----------------------------------------------------------
+ * Multi-core support
+ *----------------------------------------------------------*/
+
+#ifndef configNUMBER_OF_CORES
+	#define configNUMBER_OF_CORES 1
+#endif
+
+#define portMAX_CORE_COUNT 4
+
+#if( configNUMBER_OF_CORES > portMAX_CORE_COUNT )
+	#error configNUMBER_OF_CORES must not exceed the four APU cores
+#endif
+
+/* SGI used to ask another core to re-evaluate which task it is running. */
+#ifndef configYIELD_CORE_SGI_ID
+	#define configYIELD_CORE_SGI_ID 0
+#endif
+
+/* The core ID is affinity level 0 of MPIDR_EL1. */
+static inline BaseType_t xPortGetCoreID( void )
+{
+uint64_t ullMPIDR;
+
+	__asm volatile ( "MRS %0, MPIDR_EL1" : "=r"( ullMPIDR ) );
+	return ( BaseType_t ) ( ullMPIDR & 0xFFULL );
+}
+#define portGET_CORE_ID() xPortGetCoreID()
+
+#if( configNUMBER_OF_CORES > 1 )
+	/* Sends the yield SGI to the given core. */
+	void vPortYieldCore( BaseType_t xCoreID );
+	#define portYIELD_CORE( xCoreID ) vPortYieldCore( xCoreID )
+
+	/* Connects and enables the yield SGI on the calling core.  SGIs are banked
+	per core, so every core that runs tasks must call this once. */
+	void vPortSetupYieldCoreInterrupt( void );
+
+	/* Recursive spinlocks protecting the kernel data structures: lock 0 is
+	the task lock, lock 1 the ISR lock. */
+	void vPortRecursiveLock( uint32_t ulLockNum, BaseType_t xAcquire );
+	#define portGET_TASK_LOCK()			vPortRecursiveLock( 0, pdTRUE )
+	#define portRELEASE_TASK_LOCK()		vPortRecursiveLock( 0, pdFALSE )
+	#define portGET_ISR_LOCK()			vPortRecursiveLock( 1, pdTRUE )
+	#define portRELEASE_ISR_LOCK()		vPortRecursiveLock( 1, pdFALSE )
+#endif /* configNUMBER_OF_CORES */
+
 #define portNOP() __asm volatile( "NOP" )
 #define portINLINE __inline
 
@@ -33,6 +33,7 @@
 /* Xilinx includes. */
 #include "xscutimer.h"
 #include "xscugic.h"
+#include "sleep.h"
 
 #define XSCUTIMER_CLOCK_HZ ( XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / 2UL )
 
@@ -57,6 +58,42 @@ static XScuTimer xTimer;
 XScuGic xInterruptController; 	/* Interrupt controller instance */
 /*-----------------------------------------------------------*/
 
+/* Nesting counts maintained by port.c. */
+extern volatile uint32_t ulCriticalNesting;
+extern volatile uint32_t ulPortInterruptNesting;
+
+/*
+ * Sleep hook installed in the BSP so usleep() and sleep() block the calling task
+ * rather than spin.  Whole tick periods are waited with vTaskDelay(), which may
+ * return up to one period early, so the part of the delay below one period is
+ * left for the BSP to busy-wait.  Interrupts, critical sections and code
+ * running before the scheduler starts cannot block and just busy-wait.
+ */
+static unsigned long prvSleepHook( void *pvCallBackRef, unsigned long ulMicroSeconds )
+{
+const uint64_t ullMicroSecondsPerTick = 1000000ULL / ( uint64_t ) configTICK_RATE_HZ;
+TickType_t xTicks;
+unsigned long ulRemaining = ulMicroSeconds;
+
+	( void ) pvCallBackRef;
+
+	if( ( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING ) &&
+		( ulPortInterruptNesting == 0 ) && ( ulCriticalNesting == 0 ) )
+	{
+		xTicks = ( TickType_t ) ( ( uint64_t ) ulMicroSeconds / ullMicroSecondsPerTick );
+		if( xTicks > ( TickType_t ) 0 )
+		{
+			vTaskDelay( xTicks + ( TickType_t ) 1 );
+			ulRemaining = ( unsigned long ) ( ( uint64_t ) ulMicroSeconds -
+						( ( uint64_t ) xTicks * ullMicroSecondsPerTick ) );
+		}
+	}
+
+	return ulRemaining;
+}
+
+/*-----------------------------------------------------------*/
+
 void FreeRTOS_SetupTickInterrupt( void )
 {
 BaseType_t xStatus;
@@ -109,6 +146,9 @@ const uint8_t ucRisingEdge = 3;
 	/* Enable the interrupt in the xTimer itself. */
 	FreeRTOS_ClearTickInterrupt();
 	XScuTimer_EnableInterrupt( &xTimer );
+
+	/* Let the BSP sleep routines block the calling task. */
+	Xil_SetSleepHook( prvSleepHook, NULL );
 }
 /*-----------------------------------------------------------*/
 
@@ -50,6 +50,15 @@ task.h is included from an application file. */
 	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+#if( configUSE_HEAP_SLAB == 1 )
+	/* heap_slab.c provides pvPortMalloc() and vPortFree(), and passes the
+	requests its size classes cannot serve on to this heap. */
+	#define pvPortMalloc	pvHeap4Malloc
+	#define vPortFree		vHeap4Free
+	void *pvPortMalloc( size_t xWantedSize );
+	void vPortFree( void *pv );
+#endif
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( xHeapStructSize << 1 ) )
 
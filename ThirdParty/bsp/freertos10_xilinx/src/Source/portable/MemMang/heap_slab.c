@@ -0,0 +1,347 @@
+/*
+ * FreeRTOS Kernel V10.0.0
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software. If you wish to use our Amazon
+ * FreeRTOS name, please do so in a fair use way that does not cause confusion.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * A size class (slab) allocator layered in front of heap_4.c.
+ *
+ * Requests of up to heapslabMAX_BLOCK_SIZE bytes are served from a separate
+ * region of configHEAP_SLAB_SIZE bytes.  The region is split into pages of
+ * configHEAP_SLAB_PAGE_SIZE bytes, and a page is handed to a size class the
+ * first time that class needs more blocks.  Each size class keeps a list of
+ * free blocks, so allocating and freeing a block takes constant time and
+ * blocks of one class never fragment the memory of another.  Requests that
+ * are larger, or that find their size class exhausted, are passed on to the
+ * first fit allocator of heap_4.c.
+ *
+ * The free lists are guarded by a critical section rather than by suspending
+ * the scheduler, which makes pvPortMallocFromISR() and vPortFreeFromISR()
+ * possible.  These only ever use the slab region and return NULL rather than
+ * falling back to heap_4.c.
+ *
+ * heap_4.c must be built with configUSE_HEAP_SLAB set to 1 as well.
+ * xPortGetFreeHeapSize() and xPortGetMinimumEverFreeHeapSize() report the
+ * heap_4.c heap only; see xPortGetFreeSlabPages() for the slab region.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configUSE_HEAP_SLAB != 1 )
+	#error heap_slab.c must not be used if configUSE_HEAP_SLAB is not 1
+#endif
+
+#ifndef configHEAP_SLAB_SIZE
+	#define configHEAP_SLAB_SIZE		32768
+#endif
+
+#ifndef configHEAP_SLAB_PAGE_SIZE
+	#define configHEAP_SLAB_PAGE_SIZE	2048
+#endif
+
+/* Each size class holds blocks of twice the size of the previous one, which
+gives classes of 16 to 512 bytes. */
+#define heapslabMIN_BLOCK_SIZE		16U
+#define heapslabNUM_CLASSES			( 6 )
+#define heapslabMAX_BLOCK_SIZE		( heapslabMIN_BLOCK_SIZE << ( heapslabNUM_CLASSES - 1 ) )
+
+#define heapslabNUM_PAGES			( configHEAP_SLAB_SIZE / configHEAP_SLAB_PAGE_SIZE )
+#define heapslabNO_CLASS			( ( UBaseType_t ) heapslabNUM_CLASSES )
+
+#if( ( heapslabMIN_BLOCK_SIZE % portBYTE_ALIGNMENT ) != 0 )
+	#error heapslabMIN_BLOCK_SIZE must be a multiple of portBYTE_ALIGNMENT
+#endif
+
+#if( configHEAP_SLAB_PAGE_SIZE < heapslabMAX_BLOCK_SIZE )
+	#error configHEAP_SLAB_PAGE_SIZE must hold at least one block of the largest size class
+#endif
+
+#if( heapslabNUM_PAGES < 1 )
+	#error configHEAP_SLAB_SIZE must hold at least one page
+#endif
+
+/* The slab region, aligned at runtime in prvSlabInit(). */
+static uint8_t ucSlabHeap[ configHEAP_SLAB_SIZE + portBYTE_ALIGNMENT ];
+
+/* A free block links to the next free block of its size class. */
+typedef struct A_SLAB_FREE_BLOCK
+{
+	struct A_SLAB_FREE_BLOCK *pxNextFreeBlock;
+} SlabFreeBlock_t;
+
+/* Per size class state.  pucNextUnused/pucPageEnd carve blocks off the page
+most recently given to the class before the free list is used. */
+typedef struct A_SLAB_CLASS
+{
+	SlabFreeBlock_t *pxFreeList;
+	uint8_t *pucNextUnused;
+	uint8_t *pucPageEnd;
+} SlabClass_t;
+
+/*-----------------------------------------------------------*/
+
+/* The first fit allocator of heap_4.c, built with configUSE_HEAP_SLAB set. */
+void *pvHeap4Malloc( size_t xWantedSize );
+void vHeap4Free( void *pv );
+
+/*
+ * Sets up the slab region the first time a block is allocated.  Called with
+ * interrupts masked.
+ */
+static void prvSlabInit( void );
+
+/*
+ * Returns the size class for a request of xWantedSize bytes, or
+ * heapslabNO_CLASS if the request has to be served by heap_4.c.
+ */
+static UBaseType_t prvSlabClass( size_t xWantedSize );
+
+/*
+ * Takes a block of the given size class, or returns NULL if the class is
+ * empty and no unused page is left.  Called with interrupts masked.
+ */
+static void *prvSlabAlloc( UBaseType_t uxClass );
+
+/*
+ * Returns a block to the free list of its size class.  Called with
+ * interrupts masked.
+ */
+static void prvSlabFree( void *pv );
+
+/*-----------------------------------------------------------*/
+
+static SlabClass_t xSlabClasses[ heapslabNUM_CLASSES ];
+
+/* The size class that owns each page of the slab region. */
+static uint8_t ucPageClass[ heapslabNUM_PAGES ];
+
+static uint8_t *pucSlabStart = NULL;
+static size_t xNextUnusedPage = 0U;
+
+/*-----------------------------------------------------------*/
+
+static void prvSlabInit( void )
+{
+size_t uxAddress;
+
+	uxAddress = ( size_t ) ucSlabHeap;
+	uxAddress += ( portBYTE_ALIGNMENT - 1 );
+	uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	pucSlabStart = ( uint8_t * ) uxAddress;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvSlabClass( size_t xWantedSize )
+{
+UBaseType_t uxClass;
+size_t xBlockSize = heapslabMIN_BLOCK_SIZE;
+
+	if( ( xWantedSize == 0U ) || ( xWantedSize > heapslabMAX_BLOCK_SIZE ) )
+	{
+		return heapslabNO_CLASS;
+	}
+
+	for( uxClass = 0; xBlockSize < xWantedSize; uxClass++ )
+	{
+		xBlockSize <<= 1;
+	}
+
+	return uxClass;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvSlabAlloc( UBaseType_t uxClass )
+{
+SlabClass_t *pxClass = &( xSlabClasses[ uxClass ] );
+SlabFreeBlock_t *pxBlock;
+void *pvReturn = NULL;
+
+	if( pucSlabStart == NULL )
+	{
+		prvSlabInit();
+	}
+
+	pxBlock = pxClass->pxFreeList;
+	if( pxBlock != NULL )
+	{
+		pxClass->pxFreeList = pxBlock->pxNextFreeBlock;
+		pvReturn = ( void * ) pxBlock;
+	}
+	else
+	{
+		/* Carve the block off the current page of the class, taking a new
+		page once that is used up. */
+		if( ( pxClass->pucNextUnused == pxClass->pucPageEnd ) &&
+			( xNextUnusedPage < heapslabNUM_PAGES ) )
+		{
+			ucPageClass[ xNextUnusedPage ] = ( uint8_t ) uxClass;
+			pxClass->pucNextUnused = pucSlabStart + ( xNextUnusedPage * configHEAP_SLAB_PAGE_SIZE );
+			pxClass->pucPageEnd = pxClass->pucNextUnused + configHEAP_SLAB_PAGE_SIZE -
+				( configHEAP_SLAB_PAGE_SIZE % ( heapslabMIN_BLOCK_SIZE << uxClass ) );
+			xNextUnusedPage++;
+		}
+
+		if( pxClass->pucNextUnused != pxClass->pucPageEnd )
+		{
+			pvReturn = ( void * ) pxClass->pucNextUnused;
+			pxClass->pucNextUnused += ( heapslabMIN_BLOCK_SIZE << uxClass );
+		}
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSlabFree( void *pv )
+{
+SlabFreeBlock_t *pxBlock = ( SlabFreeBlock_t * ) pv;
+SlabClass_t *pxClass;
+size_t xPage;
+
+	xPage = ( size_t ) ( ( uint8_t * ) pv - pucSlabStart ) / configHEAP_SLAB_PAGE_SIZE;
+	configASSERT( xPage < xNextUnusedPage );
+	pxClass = &( xSlabClasses[ ucPageClass[ xPage ] ] );
+
+	pxBlock->pxNextFreeBlock = pxClass->pxFreeList;
+	pxClass->pxFreeList = pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsSlabBlock( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+
+	return ( ( pucSlabStart != NULL ) && ( puc >= pucSlabStart ) &&
+		( puc < ( pucSlabStart + ( heapslabNUM_PAGES * configHEAP_SLAB_PAGE_SIZE ) ) ) ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+UBaseType_t uxClass;
+void *pvReturn = NULL;
+
+	uxClass = prvSlabClass( xWantedSize );
+	if( uxClass != heapslabNO_CLASS )
+	{
+		taskENTER_CRITICAL();
+		{
+			pvReturn = prvSlabAlloc( uxClass );
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	if( pvReturn == NULL )
+	{
+		/* heap_4.c traces the allocation and calls the malloc failed hook. */
+		pvReturn = pvHeap4Malloc( xWantedSize );
+	}
+	else
+	{
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+	if( pv == NULL )
+	{
+		return;
+	}
+
+	if( prvIsSlabBlock( pv ) != pdFALSE )
+	{
+		taskENTER_CRITICAL();
+		{
+			prvSlabFree( pv );
+		}
+		taskEXIT_CRITICAL();
+		traceFREE( pv, 0 );
+	}
+	else
+	{
+		vHeap4Free( pv );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMallocFromISR( size_t xWantedSize )
+{
+UBaseType_t uxClass;
+UBaseType_t uxSavedInterruptStatus;
+void *pvReturn = NULL;
+
+	uxClass = prvSlabClass( xWantedSize );
+	if( uxClass != heapslabNO_CLASS )
+	{
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		{
+			pvReturn = prvSlabAlloc( uxClass );
+		}
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFreeFromISR( void *pv )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	if( pv == NULL )
+	{
+		return;
+	}
+
+	/* Blocks of heap_4.c cannot be freed from an interrupt. */
+	configASSERT( prvIsSlabBlock( pv ) != pdFALSE );
+
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	{
+		prvSlabFree( pv );
+	}
+	taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeSlabPages( void )
+{
+	return heapslabNUM_PAGES - xNextUnusedPage;
+}
+/*-----------------------------------------------------------*/
@@ -896,6 +896,279 @@ size_t xOriginalTail, xReceivedLength, xNextMessageLength;
 }
 /*-----------------------------------------------------------*/
 
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+								 void **ppvTxData,
+								 size_t xMaxLengthBytes )
+{
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xHead, xSpace;
+
+	configASSERT( ppvTxData );
+	configASSERT( pxStreamBuffer );
+
+	/* Message buffers prefix each message with its length, so only stream
+	buffers can lend out their storage. */
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	/* Only the writer moves the head, so the region stays valid until it is
+	committed.  The reader can only make more space available meanwhile. */
+	xHead = pxStreamBuffer->xHead;
+	xSpace = xStreamBufferSpacesAvailable( xStreamBuffer );
+	xSpace = configMIN( xSpace, pxStreamBuffer->xLength - xHead );
+	xSpace = configMIN( xSpace, xMaxLengthBytes );
+
+	*ppvTxData = ( void * ) &( pxStreamBuffer->pucBuffer[ xHead ] );
+
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommitBytes( StreamBuffer_t * const pxStreamBuffer, size_t xDataLengthBytes )
+{
+size_t xNextHead;
+
+	/* The bytes must lie within a region returned by xStreamBufferSendReserve(). */
+	configASSERT( xDataLengthBytes <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+	configASSERT( ( pxStreamBuffer->xHead + xDataLengthBytes ) <= pxStreamBuffer->xLength );
+
+	xNextHead = pxStreamBuffer->xHead + xDataLengthBytes;
+	if( xNextHead >= pxStreamBuffer->xLength )
+	{
+		xNextHead -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxStreamBuffer->xHead = xNextHead;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+								size_t xDataLengthBytes )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		prvCommitBytes( pxStreamBuffer, xDataLengthBytes );
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xDataLengthBytes );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									   size_t xDataLengthBytes,
+									   BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		prvCommitBytes( pxStreamBuffer, xDataLengthBytes );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xDataLengthBytes );
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvContiguousBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer, void **ppvRxData, size_t xMaxLengthBytes )
+{
+size_t xTail, xCount;
+
+	/* Only the reader moves the tail, so the region stays valid until it is
+	released.  The writer can only add more data meanwhile. */
+	xTail = pxStreamBuffer->xTail;
+	xCount = prvBytesInBuffer( pxStreamBuffer );
+	xCount = configMIN( xCount, pxStreamBuffer->xLength - xTail );
+	xCount = configMIN( xCount, xMaxLengthBytes );
+
+	*ppvRxData = ( void * ) &( pxStreamBuffer->pucBuffer[ xTail ] );
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+									void **ppvRxData,
+									size_t xMaxLengthBytes,
+									TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xBytesAvailable;
+
+	configASSERT( ppvRxData );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* Checking if there is data and clearing the notification state must be
+		performed atomically. */
+		taskENTER_CRITICAL();
+		{
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+			if( xBytesAvailable == ( size_t ) 0 )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				/* Should only be one reader. */
+				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBytesAvailable == ( size_t ) 0 )
+		{
+			/* Wait for data to be available. */
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return prvContiguousBytesInBuffer( pxStreamBuffer, ppvRxData, xMaxLengthBytes );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										   void **ppvRxData,
+										   size_t xMaxLengthBytes )
+{
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( ppvRxData );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	return prvContiguousBytesInBuffer( pxStreamBuffer, ppvRxData, xMaxLengthBytes );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReleaseBytes( StreamBuffer_t * const pxStreamBuffer, size_t xDataLengthBytes )
+{
+size_t xNextTail;
+
+	/* The bytes must lie within a region returned by xStreamBufferReceiveAcquire(). */
+	configASSERT( xDataLengthBytes <= prvBytesInBuffer( pxStreamBuffer ) );
+	configASSERT( ( pxStreamBuffer->xTail + xDataLengthBytes ) <= pxStreamBuffer->xLength );
+
+	xNextTail = pxStreamBuffer->xTail + xDataLengthBytes;
+	if( xNextTail >= pxStreamBuffer->xLength )
+	{
+		xNextTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxStreamBuffer->xTail = xNextTail;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+									size_t xDataLengthBytes )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		prvReleaseBytes( pxStreamBuffer, xDataLengthBytes );
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xDataLengthBytes );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+										   size_t xDataLengthBytes,
+										   BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxStreamBuffer );
+
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		prvReleaseBytes( pxStreamBuffer, xDataLengthBytes );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xDataLengthBytes );
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
 {
 const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
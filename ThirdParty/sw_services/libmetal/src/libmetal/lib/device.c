@@ -151,6 +151,50 @@ static int metal_generic_dev_open(struct metal_bus *bus, const char *dev_name,
 	return -ENODEV;
 }
 
+/*
+ * Maintain the cache for a scatter/gather list: contiguous entries are
+ * handled as one range, entries in DMA coherent regions are skipped.
+ */
+static void metal_generic_dma_sync(struct metal_sg *sg, int nents, int flush)
+{
+	char *start = NULL;
+	unsigned int len = 0;
+	int i;
+#if METAL_DMA_CACHE_ALL_SIZE
+	unsigned long total = 0;
+
+	for (i = 0; i < nents; i++)
+		if (!sg[i].io || !sg[i].io->dma_coherent)
+			total += sg[i].len;
+	if (total >= METAL_DMA_CACHE_ALL_SIZE) {
+		/* Flushing the whole cache also invalidates it */
+		metal_cache_flush(NULL, 0);
+		return;
+	}
+#endif
+
+	for (i = 0; i <= nents; i++) {
+		if (i < nents) {
+			if ((sg[i].io && sg[i].io->dma_coherent) ||
+			    sg[i].len <= 0)
+				continue;
+			if (len && (char *)sg[i].virt == start + len) {
+				len += sg[i].len;
+				continue;
+			}
+		}
+		if (len) {
+			if (flush)
+				metal_cache_flush(start, len);
+			metal_cache_invalidate(start, len);
+		}
+		if (i < nents) {
+			start = sg[i].virt;
+			len = sg[i].len;
+		}
+	}
+}
+
 static int metal_generic_dev_dma_map(struct metal_bus *bus,
 			     struct metal_device *device,
 			     uint32_t dir,
@@ -160,16 +204,10 @@ static int metal_generic_dev_dma_map(struct metal_bus *bus,
 {
 	(void)bus;
 	(void)device;
-	int i;
 
 	if (sg_out != sg_in)
 		memcpy(sg_out, sg_in, nents_in*(sizeof(struct metal_sg)));
-	for (i = 0; i < nents_in; i++) {
-		if (dir == METAL_DMA_DEV_W) {
-			metal_cache_flush(sg_out[i].virt, sg_out[i].len);
-		}
-		metal_cache_invalidate(sg_out[i].virt, sg_out[i].len);
-	}
+	metal_generic_dma_sync(sg_out, nents_in, dir == METAL_DMA_DEV_W);
 
 	return nents_in;
 }
@@ -183,11 +221,8 @@ void metal_generic_dev_dma_unmap(struct metal_bus *bus,
 	(void)bus;
 	(void)device;
 	(void)dir;
-	int i;
 
-	for (i = 0; i < nents; i++) {
-		metal_cache_invalidate(sg[i].virt, sg[i].len);
-	}
+	metal_generic_dma_sync(sg, nents, 0);
 }
 
 struct metal_bus metal_generic_bus = {
@@ -50,6 +50,14 @@ extern "C" {
 #define METAL_DMA_DEV_W  2 /**< DMA direction, device write */
 #define METAL_DMA_DEV_WR 3 /**< DMA direction, device read/write */
 
+/**
+ * Size from which the generic bus maintains the whole data cache rather
+ * than each buffer of a scatter/gather list. 0 never does.
+ */
+#ifndef METAL_DMA_CACHE_ALL_SIZE
+#define METAL_DMA_CACHE_ALL_SIZE 0
+#endif
+
 /**
  * @brief scatter/gather list element structure
  */
@@ -66,6 +74,10 @@ struct metal_device;
  *             After the memory is DMA mapped, the memory should be
  *             accessed by the DMA device but not the CPU.
  *
+ *             Cache maintenance is done once per run of contiguous
+ *             entries and skipped for entries whose I/O region is
+ *             dma_coherent, e.g. buffers mapped non-cacheable once.
+ *
  * @param[in]  dev       DMA device
  * @param[in]  dir       DMA direction
  * @param[in]  sg_in     sg list of memory to map
@@ -33,6 +33,10 @@
 #include <metal/io.h>
 #include <metal/sys.h>
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 void metal_io_init(struct metal_io_region *io, void *virt,
 	      const metal_phys_addr_t *physmap, size_t size,
 	      unsigned page_shift, unsigned int mem_flags,
@@ -51,9 +55,71 @@ void metal_io_init(struct metal_io_region *io, void *virt,
 		io->page_mask = (1UL << page_shift) - 1UL;
 	io->mem_flags = mem_flags;
 	io->ops = ops ? *ops : nops;
+	io->dma_coherent = 0;
 	metal_sys_io_mem_map(io);
 }
 
+/*
+ * Copy between a region and local memory without ops. Accesses are always
+ * naturally aligned, using the widest width both pointers can be aligned
+ * to, so this is also safe on device memory that takes word accesses.
+ * Regions that need narrower accesses must provide block ops.
+ */
+static void metal_io_copy(void *restrict dst, const void *restrict src,
+			  int len)
+{
+	uintptr_t skew = (uintptr_t)dst ^ (uintptr_t)src;
+	unsigned int width;
+
+	if (!(skew % sizeof(uint64_t)))
+		width = sizeof(uint64_t);
+	else if (!(skew % sizeof(int)))
+		width = sizeof(int);
+	else
+		width = 1;
+
+	for (; len && ((uintptr_t)dst % width); dst++, src++, len--)
+		*(unsigned char *)dst = *(const unsigned char *)src;
+
+	if (width == sizeof(uint64_t)) {
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+		for (; len >= 32; dst += 32, src += 32, len -= 32) {
+			uint64x2_t lo = vld1q_u64((const uint64_t *)src);
+			uint64x2_t hi = vld1q_u64((const uint64_t *)src + 2);
+
+			vst1q_u64((uint64_t *)dst, lo);
+			vst1q_u64((uint64_t *)dst + 2, hi);
+		}
+#else
+		for (; len >= 32; dst += 32, src += 32, len -= 32) {
+			uint64_t w0 = ((const uint64_t *)src)[0];
+			uint64_t w1 = ((const uint64_t *)src)[1];
+			uint64_t w2 = ((const uint64_t *)src)[2];
+			uint64_t w3 = ((const uint64_t *)src)[3];
+
+			((uint64_t *)dst)[0] = w0;
+			((uint64_t *)dst)[1] = w1;
+			((uint64_t *)dst)[2] = w2;
+			((uint64_t *)dst)[3] = w3;
+		}
+#endif
+		for (; len >= (int)sizeof(uint64_t); dst += sizeof(uint64_t),
+					src += sizeof(uint64_t),
+					len -= sizeof(uint64_t))
+			*(uint64_t *)dst = *(const uint64_t *)src;
+	}
+
+	if (width >= sizeof(int)) {
+		for (; len >= (int)sizeof(int); dst += sizeof(int),
+					src += sizeof(int),
+					len -= sizeof(int))
+			*(unsigned int *)dst = *(const unsigned int *)src;
+	}
+
+	for (; len != 0; dst++, src++, len--)
+		*(unsigned char *)dst = *(const unsigned char *)src;
+}
+
 int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 	       void *restrict dst, int len)
 {
@@ -70,22 +136,7 @@ int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 			io, offset, dst, memory_order_seq_cst, len);
 	} else {
 		atomic_thread_fence(memory_order_seq_cst);
-		while ( len && (
-			((uintptr_t)dst % sizeof(int)) ||
-			((uintptr_t)ptr % sizeof(int)))) {
-			*(unsigned char *)dst =
-				*(const unsigned char *)ptr;
-			dst++;
-			ptr++;
-			len--;
-		}
-		for (; len >= (int)sizeof(int); dst += sizeof(int),
-					ptr += sizeof(int),
-					len -= sizeof(int))
-			*(unsigned int *)dst = *(const unsigned int *)ptr;
-		for (; len != 0; dst++, ptr++, len--)
-			*(unsigned char *)dst =
-				*(const unsigned char *)ptr;
+		metal_io_copy(dst, ptr, len);
 	}
 	return retlen;
 }
@@ -105,22 +156,7 @@ int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
 		retlen = (*io->ops.block_write)(
 			io, offset, src, memory_order_seq_cst, len);
 	} else {
-		while ( len && (
-			((uintptr_t)ptr % sizeof(int)) ||
-			((uintptr_t)src % sizeof(int)))) {
-			*(unsigned char *)ptr =
-				*(const unsigned char *)src;
-			ptr++;
-			src++;
-			len--;
-		}
-		for (; len >= (int)sizeof(int); ptr += sizeof(int),
-					src += sizeof(int),
-					len -= sizeof(int))
-			*(unsigned int *)ptr = *(const unsigned int *)src;
-		for (; len != 0; ptr++, src++, len--)
-			*(unsigned char *)ptr =
-				*(const unsigned char *)src;
+		metal_io_copy(ptr, src, len);
 		atomic_thread_fence(memory_order_seq_cst);
 	}
 	return retlen;
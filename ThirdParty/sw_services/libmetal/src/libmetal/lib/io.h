@@ -99,6 +99,8 @@ struct metal_io_region {
 	unsigned int		mem_flags;  /**< memory attribute of the
 						 I/O region */
 	struct metal_io_ops	ops;        /**< I/O region operations */
+	int			dma_coherent; /**< DMA to the region needs
+						 no cache maintenance */
 };
 
 /**
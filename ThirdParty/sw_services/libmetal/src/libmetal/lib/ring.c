@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2017, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Xilinx nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * @file	ring.c
+ * @brief	Shared memory single producer/single consumer ring.
+ *
+ * Layout of the ring in shared memory:
+ *
+ *   [0, line)		head, num_slots, slot_size	- written by the producer
+ *   [line, 2 * line)	tail, wake			- written by the consumer
+ *   [2 * line, ...)	num_slots * slot_size bytes of slots
+ *
+ * head and tail are free-running slot counters. wake is the read index the
+ * consumer waits beyond, the producer rings the doorbell when it publishes
+ * the slot at that index.
+ */
+
+#include <errno.h>
+#include <metal/atomic.h>
+#include <metal/cache.h>
+#include <metal/ring.h>
+#include <metal/utilities.h>
+
+#define METAL_RING_HEAD		0
+#define METAL_RING_NUM_SLOTS	4
+#define METAL_RING_SLOT_SIZE	8
+#define METAL_RING_TAIL		METAL_RING_CACHE_LINE
+#define METAL_RING_WAKE		(METAL_RING_CACHE_LINE + 4)
+#define METAL_RING_SLOTS	(2 * METAL_RING_CACHE_LINE)
+
+static void metal_ring_flush(struct metal_ring *ring, unsigned long ofs,
+			     unsigned int len)
+{
+	if (ring->flush)
+		ring->flush(metal_io_virt(ring->io, ring->offset + ofs), len);
+}
+
+static void metal_ring_invalidate(struct metal_ring *ring, unsigned long ofs,
+				  unsigned int len)
+{
+	if (ring->invalidate)
+		ring->invalidate(metal_io_virt(ring->io, ring->offset + ofs),
+				 len);
+}
+
+static unsigned long metal_ring_slot(struct metal_ring *ring, uint32_t idx)
+{
+	return METAL_RING_SLOTS +
+	       (unsigned long)(idx & (ring->num_slots - 1)) * ring->slot_size;
+}
+
+int metal_ring_init(struct metal_ring *ring,
+		    struct metal_io_region *io, unsigned long offset,
+		    unsigned int num_slots, unsigned int slot_size,
+		    unsigned int flags)
+{
+	if (!ring || !io || !num_slots || !slot_size ||
+	    (num_slots & (num_slots - 1)))
+		return -EINVAL;
+	if (offset > metal_io_region_size(io) ||
+	    metal_ring_size(num_slots, slot_size) >
+	    metal_io_region_size(io) - offset)
+		return -ERANGE;
+
+	ring->io = io;
+	ring->offset = offset;
+	ring->num_slots = num_slots;
+	ring->slot_size = slot_size;
+	ring->flags = flags;
+	ring->flush = NULL;
+	ring->invalidate = NULL;
+	ring->notify = NULL;
+	ring->notify_arg = NULL;
+
+	if (flags & METAL_RING_F_NONCOHERENT) {
+		/* Each side must own whole cache lines */
+		if (((uintptr_t)metal_io_virt(io, offset) %
+		     METAL_RING_CACHE_LINE) ||
+		    (slot_size % METAL_RING_CACHE_LINE))
+			return -EINVAL;
+		ring->flush = metal_cache_flush;
+		ring->invalidate = metal_cache_invalidate;
+	}
+
+	/* Pick up the current indices in case the ring is already in use */
+	metal_ring_invalidate(ring, 0, METAL_RING_SLOTS);
+	ring->head = metal_io_read32(io, offset + METAL_RING_HEAD);
+	ring->tail = metal_io_read32(io, offset + METAL_RING_TAIL);
+
+	return 0;
+}
+
+void metal_ring_reset(struct metal_ring *ring)
+{
+	struct metal_io_region *io = ring->io;
+	unsigned long offset = ring->offset;
+
+	ring->head = 0;
+	ring->tail = 0;
+	metal_io_write32(io, offset + METAL_RING_HEAD, 0);
+	metal_io_write32(io, offset + METAL_RING_NUM_SLOTS, ring->num_slots);
+	metal_io_write32(io, offset + METAL_RING_SLOT_SIZE, ring->slot_size);
+	metal_io_write32(io, offset + METAL_RING_TAIL, 0);
+	/* No doorbell until the consumer asks for one */
+	metal_io_write32(io, offset + METAL_RING_WAKE, (uint32_t)-1);
+	metal_ring_flush(ring, 0, METAL_RING_SLOTS);
+}
+
+unsigned int metal_ring_space(struct metal_ring *ring)
+{
+	metal_ring_invalidate(ring, METAL_RING_TAIL, METAL_RING_CACHE_LINE);
+	ring->tail = metal_io_read32_explicit(ring->io,
+					      ring->offset + METAL_RING_TAIL,
+					      memory_order_acquire);
+
+	return ring->num_slots - (ring->head - ring->tail);
+}
+
+unsigned int metal_ring_available(struct metal_ring *ring)
+{
+	metal_ring_invalidate(ring, METAL_RING_HEAD, METAL_RING_CACHE_LINE);
+	ring->head = metal_io_read32_explicit(ring->io,
+					      ring->offset + METAL_RING_HEAD,
+					      memory_order_acquire);
+
+	return ring->head - ring->tail;
+}
+
+int metal_ring_write(struct metal_ring *ring, const void *src, int count)
+{
+	uint32_t head = ring->head;
+	unsigned long ofs;
+	unsigned int n, first, len;
+	uint32_t wake;
+
+	if (!src || count < 0)
+		return -EINVAL;
+
+	/* Only look at the consumer index when running short of slots */
+	n = ring->num_slots - (head - ring->tail);
+	if (n < (unsigned int)count)
+		n = metal_ring_space(ring);
+	n = metal_min(n, (unsigned int)count);
+	if (!n)
+		return 0;
+
+	ofs = metal_ring_slot(ring, head);
+	first = metal_min(n, ring->num_slots - (head & (ring->num_slots - 1)));
+	len = first * ring->slot_size;
+	metal_io_block_write(ring->io, ring->offset + ofs, src, len);
+	metal_ring_flush(ring, ofs, len);
+	if (n > first) {
+		len = (n - first) * ring->slot_size;
+		metal_io_block_write(ring->io, ring->offset + METAL_RING_SLOTS,
+				     (const char *)src +
+				     first * ring->slot_size, len);
+		metal_ring_flush(ring, METAL_RING_SLOTS, len);
+	}
+
+	/* Publish all the slots at once */
+	ring->head = head + n;
+	metal_io_write32_explicit(ring->io, ring->offset + METAL_RING_HEAD,
+				  ring->head, memory_order_release);
+	metal_ring_flush(ring, METAL_RING_HEAD, METAL_RING_CACHE_LINE);
+
+	if (ring->notify) {
+		/* Order the head update before looking at the wake index */
+		atomic_thread_fence(memory_order_seq_cst);
+		metal_ring_invalidate(ring, METAL_RING_TAIL,
+				      METAL_RING_CACHE_LINE);
+		wake = metal_io_read32(ring->io,
+				       ring->offset + METAL_RING_WAKE);
+		/* Only ring when crossing the wake index, once per request */
+		if ((uint32_t)(ring->head - wake - 1) <
+		    (uint32_t)(ring->head - head))
+			ring->notify(ring, ring->notify_arg);
+	}
+
+	return n;
+}
+
+int metal_ring_read(struct metal_ring *ring, void *dst, int count)
+{
+	uint32_t tail = ring->tail;
+	unsigned long ofs;
+	unsigned int n, first, len;
+
+	if (!dst || count < 0)
+		return -EINVAL;
+
+	/* Only look at the producer index when running short of slots */
+	n = ring->head - tail;
+	if (n < (unsigned int)count)
+		n = metal_ring_available(ring);
+	n = metal_min(n, (unsigned int)count);
+	if (!n)
+		return 0;
+
+	ofs = metal_ring_slot(ring, tail);
+	first = metal_min(n, ring->num_slots - (tail & (ring->num_slots - 1)));
+	len = first * ring->slot_size;
+	metal_ring_invalidate(ring, ofs, len);
+	metal_io_block_read(ring->io, ring->offset + ofs, dst, len);
+	if (n > first) {
+		len = (n - first) * ring->slot_size;
+		metal_ring_invalidate(ring, METAL_RING_SLOTS, len);
+		metal_io_block_read(ring->io, ring->offset + METAL_RING_SLOTS,
+				    (char *)dst + first * ring->slot_size,
+				    len);
+	}
+
+	/* Release all the slots at once */
+	ring->tail = tail + n;
+	metal_io_write32_explicit(ring->io, ring->offset + METAL_RING_TAIL,
+				  ring->tail, memory_order_release);
+	metal_ring_flush(ring, METAL_RING_TAIL, METAL_RING_CACHE_LINE);
+
+	return n;
+}
+
+int metal_ring_enable_notify(struct metal_ring *ring)
+{
+	metal_io_write32(ring->io, ring->offset + METAL_RING_WAKE, ring->tail);
+	metal_ring_flush(ring, METAL_RING_TAIL, METAL_RING_CACHE_LINE);
+
+	/* Order the wake index update before looking at the head */
+	atomic_thread_fence(memory_order_seq_cst);
+
+	return metal_ring_available(ring) != 0;
+}
+
+void metal_ring_disable_notify(struct metal_ring *ring)
+{
+	metal_io_write32(ring->io, ring->offset + METAL_RING_WAKE,
+			 ring->tail - 1);
+	metal_ring_flush(ring, METAL_RING_TAIL, METAL_RING_CACHE_LINE);
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2017, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Xilinx nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * @file	ring.h
+ * @brief	Shared memory single producer/single consumer ring for libmetal.
+ */
+
+#ifndef __METAL_RING__H__
+#define __METAL_RING__H__
+
+#include <stdint.h>
+#include <metal/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \defgroup ring Shared Memory Ring Interfaces
+ *  @{ */
+
+/**
+ * Granule used to lay out the ring control block. The producer and the
+ * consumer indices live in separate granules so that neither side writes a
+ * cache line owned by the other. Must be a multiple of the largest cache
+ * line size of the masters sharing the ring.
+ */
+#ifndef METAL_RING_CACHE_LINE
+#define METAL_RING_CACHE_LINE	64
+#endif
+
+/** Perform explicit cache maintenance, for masters that are not coherent. */
+#define METAL_RING_F_NONCOHERENT	(1 << 0)
+
+struct metal_ring;
+
+/** Cache maintenance hook, see metal_ring_set_cache_ops(). */
+typedef void (*metal_ring_cache_op)(void *addr, unsigned int len);
+
+/** Doorbell hook, see metal_ring_set_notify(). */
+typedef void (*metal_ring_notify)(struct metal_ring *ring, void *arg);
+
+/**
+ * Ring handle. Each side of the ring uses its own handle on the same
+ * shared memory; one side only writes, the other only reads.
+ */
+struct metal_ring {
+	struct metal_io_region	*io;        /**< shared memory I/O region */
+	unsigned long		offset;     /**< control block offset in io */
+	unsigned int		num_slots;  /**< slot count, a power of two */
+	unsigned int		slot_size;  /**< slot size in bytes */
+	unsigned int		flags;      /**< METAL_RING_F_* flags */
+	metal_ring_cache_op	flush;      /**< flush hook, or NULL */
+	metal_ring_cache_op	invalidate; /**< invalidate hook, or NULL */
+	metal_ring_notify	notify;     /**< doorbell hook, or NULL */
+	void			*notify_arg; /**< doorbell hook argument */
+	uint32_t		head;       /**< last known write index */
+	uint32_t		tail;       /**< last known read index */
+};
+
+/**
+ * @brief	Get the shared memory footprint of a ring.
+ *
+ * @param[in]	num_slots	Number of slots.
+ * @param[in]	slot_size	Size of a slot in bytes.
+ * @return	Number of bytes used in the shared memory.
+ */
+static inline size_t metal_ring_size(unsigned int num_slots,
+				     unsigned int slot_size)
+{
+	return 2 * METAL_RING_CACHE_LINE + (size_t)num_slots * slot_size;
+}
+
+/**
+ * @brief	Initialize a ring handle.
+ *
+ * Attach a handle to a ring located at offset in the I/O region. The shared
+ * memory is not modified; one of the two sides must call metal_ring_reset()
+ * before the ring is used.
+ *
+ * With METAL_RING_F_NONCOHERENT, the control block must be aligned to
+ * METAL_RING_CACHE_LINE and slot_size be a multiple of it; the cache hooks
+ * default to metal_cache_flush() and metal_cache_invalidate().
+ *
+ * @param[out]	ring		Ring handle.
+ * @param[in]	io		Shared memory I/O region.
+ * @param[in]	offset		Offset of the ring in the I/O region.
+ * @param[in]	num_slots	Number of slots, must be a power of two.
+ * @param[in]	slot_size	Size of a slot in bytes.
+ * @param[in]	flags		METAL_RING_F_* flags.
+ * @return	0 on success, or -errno on failure.
+ */
+extern int metal_ring_init(struct metal_ring *ring,
+			   struct metal_io_region *io, unsigned long offset,
+			   unsigned int num_slots, unsigned int slot_size,
+			   unsigned int flags);
+
+/**
+ * @brief	Reset the shared state of a ring.
+ *
+ * Empty the ring and publish its geometry. Must be called by one side while
+ * the other side is not using the ring.
+ *
+ * @param[in]	ring	Ring handle.
+ */
+extern void metal_ring_reset(struct metal_ring *ring);
+
+/**
+ * @brief	Override the cache maintenance hooks of a ring.
+ *
+ * Useful where metal_cache_flush() and metal_cache_invalidate() are not
+ * effective, e.g. from Linux userspace.
+ *
+ * @param[in]	ring		Ring handle.
+ * @param[in]	flush		Called after writing shared memory, or NULL.
+ * @param[in]	invalidate	Called before reading shared memory, or NULL.
+ */
+static inline void metal_ring_set_cache_ops(struct metal_ring *ring,
+					    metal_ring_cache_op flush,
+					    metal_ring_cache_op invalidate)
+{
+	ring->flush = flush;
+	ring->invalidate = invalidate;
+}
+
+/**
+ * @brief	Set the doorbell of a ring.
+ *
+ * On the producer side, the hook is called after new slots are published
+ * if the consumer has asked to be woken up, see metal_ring_enable_notify().
+ * It is typically used to raise an IPI.
+ *
+ * @param[in]	ring	Ring handle.
+ * @param[in]	notify	Doorbell hook, or NULL.
+ * @param[in]	arg	Argument passed to the hook.
+ */
+static inline void metal_ring_set_notify(struct metal_ring *ring,
+					 metal_ring_notify notify, void *arg)
+{
+	ring->notify = notify;
+	ring->notify_arg = arg;
+}
+
+/**
+ * @brief	Enqueue slots in a ring.
+ *
+ * Copy up to count slots from src and publish them with a single index
+ * update, then ring the doorbell at most once.
+ *
+ * @param[in]	ring	Ring handle, producer side.
+ * @param[in]	src	Source of count * slot_size bytes.
+ * @param[in]	count	Number of slots to enqueue.
+ * @return	Number of slots enqueued, or -errno on failure.
+ */
+extern int metal_ring_write(struct metal_ring *ring, const void *src,
+			    int count);
+
+/**
+ * @brief	Dequeue slots from a ring.
+ *
+ * Copy up to count slots to dst and release them with a single index
+ * update.
+ *
+ * @param[in]	ring	Ring handle, consumer side.
+ * @param[out]	dst	Destination of count * slot_size bytes.
+ * @param[in]	count	Number of slots to dequeue.
+ * @return	Number of slots dequeued, or -errno on failure.
+ */
+extern int metal_ring_read(struct metal_ring *ring, void *dst, int count);
+
+/**
+ * @brief	Get the number of slots ready to be dequeued.
+ *
+ * @param[in]	ring	Ring handle, consumer side.
+ * @return	Number of filled slots.
+ */
+extern unsigned int metal_ring_available(struct metal_ring *ring);
+
+/**
+ * @brief	Get the number of slots that can be enqueued.
+ *
+ * @param[in]	ring	Ring handle, producer side.
+ * @return	Number of free slots.
+ */
+extern unsigned int metal_ring_space(struct metal_ring *ring);
+
+/**
+ * @brief	Ask the producer to ring the doorbell.
+ *
+ * The producer rings the doorbell once, when it publishes the first slot
+ * past the current read index. The consumer calls this before waiting for
+ * the doorbell and must drain the ring first if this returns non-zero,
+ * since slots published concurrently do not ring it.
+ *
+ * @param[in]	ring	Ring handle, consumer side.
+ * @return	Non-zero if the ring is not empty.
+ */
+extern int metal_ring_enable_notify(struct metal_ring *ring);
+
+/**
+ * @brief	Stop the producer from ringing the doorbell.
+ *
+ * Used by a consumer that polls the ring while it is busy.
+ *
+ * @param[in]	ring	Ring handle, consumer side.
+ */
+extern void metal_ring_disable_notify(struct metal_ring *ring);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __METAL_RING__H__ */
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2017, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Xilinx nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#include "metal-test.h"
+#include <metal/atomic.h>
+#include <metal/io.h>
+#include <metal/log.h>
+#include <metal/ring.h>
+#include <metal/sys.h>
+#include <metal/utilities.h>
+
+static const unsigned int ring_slots = 16;
+static const uint32_t ring_test_count = 100000;
+
+static atomic_int doorbells = ATOMIC_VAR_INIT(0);
+
+static void ring_doorbell(struct metal_ring *ring, void *arg)
+{
+	(void)ring;
+	(void)arg;
+	atomic_fetch_add(&doorbells, 1);
+}
+
+static void *ring_producer(void *arg)
+{
+	struct metal_ring *ring = arg;
+	uint32_t batch[7];
+	uint32_t seq = 0;
+	unsigned int i, n;
+	int ret;
+
+	while (seq < ring_test_count) {
+		n = metal_min((seq % metal_dim(batch)) + 1,
+			      ring_test_count - seq);
+		for (i = 0; i < n; i++)
+			batch[i] = seq + i;
+		ret = metal_ring_write(ring, batch, n);
+		if (ret < 0)
+			return NULL;
+		if (!ret)
+			sched_yield();
+		seq += ret;
+	}
+
+	return NULL;
+}
+
+static int ring_check_doorbell(struct metal_ring *prod,
+			       struct metal_ring *cons)
+{
+	uint32_t val = 0;
+
+	atomic_store(&doorbells, 0);
+
+	/* Nothing pending, so the consumer may wait for the doorbell */
+	if (metal_ring_enable_notify(cons))
+		return -EINVAL;
+
+	/* Only the first of several writes rings it */
+	metal_ring_write(prod, &val, 1);
+	metal_ring_write(prod, &val, 1);
+	if (atomic_load(&doorbells) != 1)
+		return -EINVAL;
+
+	/* Armed with slots pending, the consumer has to drain first */
+	if (!metal_ring_enable_notify(cons))
+		return -EINVAL;
+	while (metal_ring_read(cons, &val, 1) == 1)
+		;
+
+	metal_ring_disable_notify(cons);
+	metal_ring_write(prod, &val, 1);
+	metal_ring_read(cons, &val, 1);
+	if (atomic_load(&doorbells) != 1)
+		return -EINVAL;
+
+	return 0;
+}
+
+static int ring(void)
+{
+	struct metal_io_region io;
+	struct metal_ring prod, cons;
+	size_t size = metal_ring_size(ring_slots, sizeof(uint32_t));
+	uint32_t batch[5];
+	uint32_t seq = 0;
+	pthread_t tid;
+	void *mem;
+	int i, ret, error;
+
+	mem = calloc(1, size);
+	if (!mem)
+		return -ENOMEM;
+	metal_io_init(&io, mem, NULL, size, -1, 0, NULL);
+
+	/* Both ends of the ring share the same memory */
+	error = metal_ring_init(&prod, &io, 0, ring_slots, sizeof(uint32_t), 0);
+	if (!error)
+		error = metal_ring_init(&cons, &io, 0, ring_slots,
+					sizeof(uint32_t), 0);
+	if (error) {
+		metal_log(METAL_LOG_ERROR, "failed to init ring: %d\n", error);
+		goto out;
+	}
+	metal_ring_reset(&prod);
+	metal_ring_set_notify(&prod, ring_doorbell, NULL);
+
+	error = ring_check_doorbell(&prod, &cons);
+	if (error) {
+		metal_log(METAL_LOG_ERROR, "doorbell not coalesced\n");
+		goto out;
+	}
+
+	/* The ring is empty again, stream through it from another thread */
+	error = metal_run_noblock(1, ring_producer, &prod, &tid, &ret);
+	if (error)
+		goto out;
+
+	while (seq < ring_test_count) {
+		ret = metal_ring_read(&cons, batch, metal_dim(batch));
+		for (i = 0; i < ret; i++, seq++) {
+			if (batch[i] != seq) {
+				metal_log(METAL_LOG_ERROR,
+					  "slot mismatch %u != %u\n",
+					  batch[i], seq);
+				error = -EINVAL;
+				break;
+			}
+		}
+		if (error || ret < 0)
+			break;
+		if (!ret)
+			sched_yield();
+	}
+	metal_finish_threads(1, &tid);
+
+out:
+	metal_io_finish(&io);
+	free(mem);
+	return error;
+}
+METAL_ADD_TEST(ring);
@@ -209,6 +209,29 @@ proc lwip_axi_ethernet_hw_drc {libhandle emac} {
 
 }
 
+#---
+# perform basic sanity checks for xxv_ethernet:
+#	- the MAC streams are connected to an AXI MCDMA
+#	- checksum offload is not requested (the MAC has none)
+#---
+proc lwip_xxv_ethernet_hw_drc {libhandle emac} {
+	set emacname [common::get_property NAME [hsi::get_cells -hier $emac]]
+
+	set mcdma [xxv_target_mcdma $emac]
+	if {$mcdma == ""} {
+		error "ERROR: xxv_ethernet core $emacname is not connected to an AXI MCDMA. \
+			lwIP supports the xxv_ethernet only with an AXI MCDMA\n" "" "MDT_ERROR"
+	}
+
+	set tx_csum [common::get_property CONFIG.tcp_tx_checksum_offload $libhandle]
+	set rx_csum [common::get_property CONFIG.tcp_rx_checksum_offload $libhandle]
+	set tx_full_csum [common::get_property CONFIG.tcp_ip_tx_checksum_offload $libhandle]
+	set rx_full_csum [common::get_property CONFIG.tcp_ip_rx_checksum_offload $libhandle]
+	if {$tx_csum || $rx_csum || $tx_full_csum || $rx_full_csum} {
+		error "ERROR: xxv_ethernet core $emacname does not support checksum offload" "" "MDT_ERROR"
+	}
+}
+
 #---
 # perform basic sanity checks:
 #	- interrupts are connected
@@ -223,6 +246,8 @@ proc lwip_hw_drc {libhandle emacs_list} {
 			lwip_temac_hw_drc $libhandle $ip
 		} elseif {$iptype == "axi_ethernet" || $iptype == "axi_ethernet_buffer"} {
 			lwip_axi_ethernet_hw_drc $libhandle $ip
+		} elseif {$iptype == "xxv_ethernet"} {
+			lwip_xxv_ethernet_hw_drc $libhandle $ip
 		}
 	}
 }
@@ -258,7 +283,8 @@ proc get_emac_periphs {processor} {
 			|| $periphname == "axi_ethernet_buffer"
 			|| $periphname == "axi_ethernetlite"
 			|| $periphname == "ps7_ethernet"
-			|| $periphname == "psu_ethernet"} {
+			|| $periphname == "psu_ethernet"
+			|| $periphname == "xxv_ethernet"} {
 			lappend emac_periphs_list $periph
 		} elseif {$periphname == "xps_ll_temac"} {
 			set emac0_enabled "0"
@@ -394,11 +420,15 @@ proc generate_lwip_opts {libhandle} {
 	set emac_periphs_list [get_emac_periphs $processor]
 
 	set have_emaclite 0
+	set have_xxv_ethernet 0
 	foreach emac $emac_periphs_list {
 		set iptype [common::get_property IP_NAME $emac]
 		if {$iptype == "xps_ethernetlite" || $iptype == "opb_ethernetlite" || $iptype == "axi_ethernetlite"} {
 			set have_emaclite 1
 		}
+		if {$iptype == "xxv_ethernet"} {
+			set have_xxv_ethernet 1
+		}
 		if {$iptype == "axi_ethernet"} {
 			set checksum_txoption [common::get_property CONFIG.TXCSUM $emac]
 			set checksum_txoption [get_checksum $checksum_txoption]
@@ -540,6 +570,15 @@ proc generate_lwip_opts {libhandle} {
 	set memp_num_api_msg 	[common::get_property CONFIG.memp_num_api_msg $libhandle]
 	set memp_num_tcpip_msg 	[common::get_property CONFIG.memp_num_tcpip_msg $libhandle]
 
+	# every segment of TCP_SND_QUEUELEN (16 * TCP_SND_BUF/TCP_MSS) needs a
+	# MEMP_NUM_TCP_SEG entry, size the pool for large send buffers
+	set tcp_snd_queuelen [expr 16 * [common::get_property CONFIG.tcp_snd_buf $libhandle] / \
+		[common::get_property CONFIG.tcp_mss $libhandle]]
+	if {$memp_n_tcp_seg < $tcp_snd_queuelen} {
+		puts "WARNING: memp_n_tcp_seg raised from $memp_n_tcp_seg to $tcp_snd_queuelen for tcp_snd_buf"
+		set memp_n_tcp_seg $tcp_snd_queuelen
+	}
+
 	puts $lwipopts_fd "\#define MEM_ALIGNMENT 64"
 	puts $lwipopts_fd "\#define MEM_SIZE $mem_size"
 	puts $lwipopts_fd "\#define MEMP_NUM_PBUF $memp_n_pbuf"
@@ -570,9 +609,33 @@ proc generate_lwip_opts {libhandle} {
 	set pbuf_pool_bufsize	[common::get_property CONFIG.pbuf_pool_bufsize $libhandle]
 	set pbuf_link_hlen	[common::get_property CONFIG.pbuf_link_hlen $libhandle]
 
+	# the pbuf pool must be able to hold a full receive window
+	if {[common::get_property CONFIG.ipv6_enable $libhandle] == true} {
+		set pbuf_hdr_len [expr $pbuf_link_hlen + 40 + 20]
+	} else {
+		set pbuf_hdr_len [expr $pbuf_link_hlen + 20 + 20]
+	}
+	set pbuf_payload [expr $pbuf_pool_bufsize - $pbuf_hdr_len]
+	set tcp_wnd_pbufs [expr ([common::get_property CONFIG.tcp_wnd $libhandle] + \
+		$pbuf_payload - 1) / $pbuf_payload]
+	if {$pbuf_pool_size < $tcp_wnd_pbufs} {
+		puts "WARNING: pbuf_pool_size raised from $pbuf_pool_size to $tcp_wnd_pbufs for tcp_wnd"
+		set pbuf_pool_size $tcp_wnd_pbufs
+	}
+
 	puts $lwipopts_fd "\#define PBUF_POOL_SIZE $pbuf_pool_size"
 	puts $lwipopts_fd "\#define PBUF_POOL_BUFSIZE $pbuf_pool_bufsize"
 	puts $lwipopts_fd "\#define PBUF_LINK_HLEN $pbuf_link_hlen"
+
+	set pbuf_cache_size	[common::get_property CONFIG.pbuf_cache_size $libhandle]
+	if {$pbuf_cache_size > 0} {
+		if {$proctype == "microblaze"} {
+			puts "WARNING: pbuf_cache_size is not supported on MicroBlaze, pbuf caches disabled"
+		} else {
+			puts $lwipopts_fd "\#define XLWIP_PBUF_CACHE 1"
+			puts $lwipopts_fd "\#define XLWIP_PBUF_CACHE_SIZE $pbuf_cache_size"
+		}
+	}
 	puts $lwipopts_fd ""
 
 	# ARP options
@@ -636,6 +699,12 @@ proc generate_lwip_opts {libhandle} {
 	set tcp_maxrtx          [common::get_property CONFIG.tcp_maxrtx $libhandle]
 	set tcp_synmaxrtx       [common::get_property CONFIG.tcp_synmaxrtx $libhandle]
 	set tcp_queue_ooseq     [common::get_property CONFIG.tcp_queue_ooseq $libhandle]
+	set tcp_ooseq_max_pbufs [common::get_property CONFIG.tcp_ooseq_max_pbufs $libhandle]
+	set lwip_wnd_scale	[expr [common::get_property CONFIG.lwip_wnd_scale $libhandle] == true]
+
+	if {!$lwip_wnd_scale && ($tcp_wnd > 65535 || $tcp_snd_buf > 65535)} {
+		error "ERROR: tcp_wnd and tcp_snd_buf larger than 65535 bytes require lwip_wnd_scale" "" "MDT_ERROR"
+	}
 
 	puts $lwipopts_fd "\#define LWIP_TCP $lwip_tcp"
 	puts $lwipopts_fd "\#define TCP_MSS $tcp_mss"
@@ -645,8 +714,26 @@ proc generate_lwip_opts {libhandle} {
 	puts $lwipopts_fd "\#define TCP_MAXRTX $tcp_maxrtx"
 	puts $lwipopts_fd "\#define TCP_SYNMAXRTX $tcp_synmaxrtx"
 	puts $lwipopts_fd "\#define TCP_QUEUE_OOSEQ $tcp_queue_ooseq"
+	if {$tcp_queue_ooseq && $tcp_ooseq_max_pbufs > 0} {
+		puts $lwipopts_fd "\#define TCP_OOSEQ_MAX_PBUFS $tcp_ooseq_max_pbufs"
+	}
 	puts $lwipopts_fd "\#define TCP_SND_QUEUELEN   16 * TCP_SND_BUF/TCP_MSS"
 
+	# window scaling, smallest shift that makes tcp_wnd fit the 16-bit
+	# window field
+	if {$lwip_wnd_scale} {
+		set tcp_rcv_scale 0
+		while {($tcp_wnd >> $tcp_rcv_scale) > 65535 && $tcp_rcv_scale < 14} {
+			incr tcp_rcv_scale
+		}
+		puts $lwipopts_fd "\#define LWIP_WND_SCALE 1"
+		puts $lwipopts_fd "\#define TCP_RCV_SCALE $tcp_rcv_scale"
+		if {$tcp_snd_buf > 65535} {
+			# TCP_SNDLOWAT has to stay 4 * MSS below u16_t overflow
+			puts $lwipopts_fd "\#define TCP_SNDLOWAT [expr 65535 - 4 * $tcp_mss - 1]"
+		}
+	}
+
 	set have_ethonzynq 0
 	foreach emac $emac_periphs_list {
 		set iptype [common::get_property IP_NAME $emac]
@@ -731,13 +818,17 @@ proc generate_lwip_opts {libhandle} {
 		}
 
 	} else {
-		if {$have_emaclite == 1} {
+		if {$have_emaclite == 1 || $have_xxv_ethernet == 1} {
 			puts $lwipopts_fd "\#define CHECKSUM_GEN_TCP 	1"
 			puts $lwipopts_fd "\#define CHECKSUM_GEN_UDP 	1"
 			puts $lwipopts_fd "\#define CHECKSUM_GEN_IP  	1"
 			puts $lwipopts_fd "\#define CHECKSUM_CHECK_TCP  1"
 			puts $lwipopts_fd "\#define CHECKSUM_CHECK_UDP  1"
 			puts $lwipopts_fd "\#define CHECKSUM_CHECK_IP 	1"
+			# Software checksums are needed for the EmacLite and the XXV
+			# Ethernet only. GEM interfaces turn them off per netif and
+			# use the hardware.
+			puts $lwipopts_fd "\#define LWIP_CHECKSUM_CTRL_PER_NETIF 1"
 		} else {
 			puts $lwipopts_fd "\#define CHECKSUM_GEN_TCP 	0"
 			puts $lwipopts_fd "\#define CHECKSUM_GEN_UDP 	0"
@@ -795,6 +886,31 @@ proc generate_lwip_opts {libhandle} {
 		puts $lwipopts_fd ""
 	}
 
+	# lwIP memory pool profiling
+	set lwip_memprof	[common::get_property CONFIG.lwip_memprof $libhandle]
+	if {$lwip_memprof} {
+		if {!$lwip_stats} {
+			puts $lwipopts_fd "\#define LWIP_STATS 1"
+		}
+		puts $lwipopts_fd "\#define MEMP_STATS 1"
+		puts $lwipopts_fd "\#define MEM_STATS 1"
+		puts $lwipopts_fd "\#define XLWIP_MEMPROF 1"
+		puts $lwipopts_fd ""
+	}
+
+	# GEM TSU timestamps in pbufs
+	set emacps_ptp_timestamp [common::get_property CONFIG.emacps_ptp_timestamp $libhandle]
+	if {$emacps_ptp_timestamp} {
+		set extra_flags [common::get_property CONFIG.extra_compiler_flags $sw_processor]
+		if {$processor_type == "ps7_cortexa9"} {
+			error "ERROR: emacps_ptp_timestamp requires the extended buffer descriptors of the ZynqMP GEM" "" "MDT_ERROR"
+		} elseif {[string first "-DXEMACPS_BD_TIMESTAMP" $extra_flags] == -1} {
+			error "ERROR: emacps_ptp_timestamp requires -DXEMACPS_BD_TIMESTAMP in the extra_compiler_flags of the processor" "" "MDT_ERROR"
+		}
+		puts $lwipopts_fd "\#define XLWIP_PTP_TIMESTAMP 1"
+		puts $lwipopts_fd ""
+	}
+
 	# lwIP debug
 	set lwip_debug		[expr [common::get_property CONFIG.lwip_debug $libhandle] == true]
 	set ip_debug		[expr [common::get_property CONFIG.ip_debug $libhandle] == true]
@@ -1025,6 +1141,41 @@ proc update_axi_ethernet_topology {emac processor topologyvar} {
 	}
 }
 
+proc update_xxv_ethernet_topology {emac processor topologyvar} {
+	upvar $topologyvar topology
+	set sw_processor [hsi::get_sw_processor]
+	set proc_type [common::get_property IP_NAME [get_cells $sw_processor]]
+	set topology(emac_baseaddr) [common::get_property CONFIG.C_BASEADDR $emac]
+	set topology(emac_type) "xemac_type_xxv_ethernet"
+	set topology(emac_intr_id) "0x0"
+	set topology(intc_baseaddr) "0x0"
+	set topology(scugic_baseaddr) "0x0"
+	set topology(scugic_emac_intr) "0x0"
+
+	# The interrupts come from the MCDMA channels; the port registers
+	# them itself from the generated XLWIP_CONFIG_XXV_*_INTR_IDS lists.
+	if {$proc_type == "psu_cortexa53"} {
+		set topology(scugic_baseaddr) "0xF9020000"
+	} elseif {$proc_type == "psu_cortexr5"} {
+		set topology(scugic_baseaddr) "0xF9001000"
+	} elseif {$proc_type == "ps7_cortexa9"} {
+		set topology(scugic_baseaddr) "0xF8F00100"
+	} else {
+		set mcdma [xxv_target_mcdma $emac]
+		set intr_port [hsi::get_pins -of_objects $mcdma s2mm_ch1_introut]
+		if {[llength $intr_port] == 0} {
+			set intr_port [hsi::get_pins -of_objects $mcdma s2mm_introut]
+		}
+		set intc_handle [::hsi::utils::get_connected_intr_cntrl $mcdma $intr_port]
+		if { $intc_handle == "" } {
+			puts "Info: Target Periph Interrupt is not connected to interrupt controller"
+			return
+		}
+		set topology(intc_baseaddr) [common::get_property CONFIG.C_BASEADDR [lindex $intc_handle 0]]
+		set topology(intc_baseaddr) [::hsm::utils::format_addr_string $topology(intc_baseaddr) "C_BASEADDR"]
+	}
+}
+
 proc update_ps_ethernet_topology {emac processor topologyvar} {
 	upvar $topologyvar topology
 	set topology(emac_baseaddr) [common::get_property CONFIG.C_S_AXI_BASEADDR $emac]
@@ -1114,6 +1265,10 @@ proc generate_topology {libhandle} {
 			update_axi_ethernet_topology $emac $processor topology
 			generate_topology_per_emac $tfd topology
 			incr topology_size 1
+		} elseif {$iptype == "xxv_ethernet"} {
+			update_xxv_ethernet_topology $emac $processor topology
+			generate_topology_per_emac $tfd topology
+			incr topology_size 1
 		} elseif {$iptype == "ps7_ethernet"} {
 			update_ps_ethernet_topology $emac $processor topology
 			generate_topology_per_emac $tfd topology
@@ -1148,6 +1303,7 @@ proc generate_adapterconfig_makefile {libhandle} {
 	set have_axi_ethernet_fifo 0
 	set have_axi_ethernet_dma 0
 	set have_ps_ethernet 0
+	set have_xxv_ethernet 0
 	set force_axieth_on_zynq 0
 	set force_emaclite_on_zynq 0
 
@@ -1184,6 +1340,8 @@ proc generate_adapterconfig_makefile {libhandle} {
 			} else {
 				set have_axi_ethernet_dma 1
 			}
+		} elseif {$iptype == "xxv_ethernet"} {
+			set have_xxv_ethernet 1
 		} elseif {$iptype == "ps7_ethernet" || $iptype == "psu_ethernet" } {
 			set have_ps_ethernet 1
 		}
@@ -1246,6 +1404,10 @@ proc generate_adapterconfig_makefile {libhandle} {
 		puts $fd "CONFIG_XLLTEMAC=y"
 	}
 
+	if {$have_xxv_ethernet == 1} {
+		puts $fd "CONFIG_XXV_ETHERNET=y"
+	}
+
 	if {$force_axieth_on_zynq == 1 || $have_ps_ethernet == 0 } {
 		if {$have_axi_ethernet == 1} {
 			puts $fd "CONFIG_AXI_ETHERNET=y"
@@ -1282,6 +1444,7 @@ proc generate_adapterconfig_include {libhandle} {
 	set have_axi_ethernet_fifo 0
 	set have_axi_ethernet_dma 0
 	set have_ps_ethernet 0
+	set have_xxv_ethernet 0
 	set force_axieth_on_zynq 0
 	set force_emaclite_on_zynq 0
 
@@ -1319,6 +1482,9 @@ proc generate_adapterconfig_include {libhandle} {
 				set have_axi_ethernet_dma 1
 			}
 			set have_axi_ethernet 1
+		} elseif {$iptype == "xxv_ethernet"} {
+			set have_xxv_ethernet 1
+			set xxv_emac $emac
 		} elseif {$iptype == "ps7_ethernet" || $iptype == "psu_ethernet"} {
 			set have_ps_ethernet 1
 		}
@@ -1387,6 +1553,67 @@ proc generate_adapterconfig_include {libhandle} {
 		set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_RX_DESC $ndesc"
 		puts $fd ""
+
+		set rx_poll_budget [common::get_property CONFIG.emacps_rx_poll_budget $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET $rx_poll_budget"
+		puts $fd ""
+		set ndesc [common::get_property CONFIG.emacps_rx_q1_descriptors $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_N_RX_DESC_Q1 $ndesc"
+		puts $fd ""
+		set rx_pbuf_pool [common::get_property CONFIG.emacps_rx_pbuf_pool $libhandle]
+		if {$rx_pbuf_pool} {
+			puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_PBUF_POOL 1"
+			puts $fd ""
+		}
+	}
+
+	if {$have_xxv_ethernet == 1} {
+		puts $fd "\#define XLWIP_CONFIG_INCLUDE_XXV_ETHERNET 1"
+		if {$have_axi_ethernet == 0 && $have_ps_ethernet == 0} {
+			set ndesc [common::get_property CONFIG.n_tx_descriptors $libhandle]
+			puts $fd "\#define XLWIP_CONFIG_N_TX_DESC $ndesc"
+			set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
+			puts $fd "\#define XLWIP_CONFIG_N_RX_DESC $ndesc"
+			puts $fd ""
+		}
+		if {$have_axi_ethernet == 0} {
+			set ncoalesce [common::get_property CONFIG.n_tx_coalesce $libhandle]
+			puts $fd "\#define XLWIP_CONFIG_N_TX_COALESCE $ncoalesce"
+			set ncoalesce [common::get_property CONFIG.n_rx_coalesce $libhandle]
+			puts $fd "\#define XLWIP_CONFIG_N_RX_COALESCE $ncoalesce"
+			puts $fd ""
+		}
+
+		set mcdma [xxv_target_mcdma $xxv_emac]
+		set mcdma_name [string toupper [common::get_property NAME $mcdma]]
+		set n_tx [common::get_property CONFIG.c_num_mm2s_channels $mcdma]
+		set n_rx [common::get_property CONFIG.c_num_s2mm_channels $mcdma]
+		set nchans [expr {$n_tx < $n_rx ? $n_tx : $n_rx}]
+		puts $fd "\#define XLWIP_CONFIG_XXV_N_CHANNELS $nchans"
+
+		set single_intr [common::get_property CONFIG.c_enable_single_intr $mcdma]
+		set rx_ids {}
+		set tx_ids {}
+		for {set ch 1} {$ch <= $nchans} {incr ch} {
+			if {$single_intr == "1"} {
+				set rx_pin "s2mm_introut"
+				set tx_pin "mm2s_introut"
+			} else {
+				set rx_pin "s2mm_ch${ch}_introut"
+				set tx_pin "mm2s_ch${ch}_introut"
+			}
+			if {$processor_type == "psu_cortexa53" || $processor_type == "psu_cortexr5" \
+				|| $processor_type == "ps7_cortexa9"} {
+				lappend rx_ids "XPAR_FABRIC_${mcdma_name}_[string toupper $rx_pin]_INTR"
+				lappend tx_ids "XPAR_FABRIC_${mcdma_name}_[string toupper $tx_pin]_INTR"
+			} else {
+				lappend rx_ids [::hsi::utils::get_port_intr_id $mcdma $rx_pin]
+				lappend tx_ids [::hsi::utils::get_port_intr_id $mcdma $tx_pin]
+			}
+		}
+		puts $fd "\#define XLWIP_CONFIG_XXV_RX_INTR_IDS { [join $rx_ids ", "] }"
+		puts $fd "\#define XLWIP_CONFIG_XXV_TX_INTR_IDS { [join $tx_ids ", "] }"
+		puts $fd ""
 	}
 
 	puts $fd "\#endif"
@@ -1417,6 +1644,23 @@ proc axieth_target_periph {emac} {
 	return $target_periph_type
 }
 
+proc xxv_target_mcdma {emac} {
+	set p2p_busifs_i [get_intf_pins -of_objects [get_cells -hier $emac] -filter "TYPE==INITIATOR"]
+	foreach p2p_busif $p2p_busifs_i {
+		set busif_name [string toupper [get_property NAME  $p2p_busif]]
+		set conn_busif_handle [::hsi::utils::get_connected_intf $emac $busif_name]
+		if { [string compare -nocase $conn_busif_handle ""] == 0} {
+			continue
+		}
+		set target_periph [get_cells -of_objects $conn_busif_handle]
+		if { [string compare -nocase [get_property IP_NAME $target_periph] "axi_mcdma"] == 0 } {
+			return $target_periph
+		}
+	}
+
+	return ""
+}
+
 proc get_checksum {value} {
 	if {[string compare -nocase $value "None"] == 0} {
 		set value 0
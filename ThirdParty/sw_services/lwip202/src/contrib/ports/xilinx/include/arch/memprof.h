@@ -0,0 +1,77 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#ifndef __ARCH_MEMPROF_H__
+#define __ARCH_MEMPROF_H__
+
+#include "lwip/opt.h"
+
+#if XLWIP_MEMPROF
+
+#include "lwip/memp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Memory pool profiling. memp_malloc() records for every pool the number of
+ * allocations, the failed allocations and the allocation latency in clock
+ * ticks. Together with the lwIP MEMP_STATS/MEM_STATS high-water marks this is
+ * used by xlwip_memprof_report() to recommend pool sizes for lwipopts.h.
+ */
+struct xlwip_memprof_stats {
+	u32_t allocs;		/* allocations */
+	u32_t fails;		/* allocations that returned NULL */
+	u32_t lat_max;		/* worst allocation latency, clock ticks */
+	unsigned long long lat_total;	/* sum of allocation latencies */
+};
+
+/* clock used to measure the allocation latency, returns ticks */
+typedef u32_t (*xlwip_memprof_clock_fn)(void);
+
+void xlwip_memprof_set_clock(xlwip_memprof_clock_fn clock);
+void xlwip_memprof_reset(void);
+const struct xlwip_memprof_stats *xlwip_memprof_get(memp_t type);
+void xlwip_memprof_report(void);
+
+/* called by memp_malloc() */
+u32_t xlwip_memprof_start(void);
+void xlwip_memprof_record(memp_t type, u32_t start, void *mem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XLWIP_MEMPROF */
+
+#endif /* __ARCH_MEMPROF_H__ */
@@ -0,0 +1,84 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#ifndef __ARCH_PBUF_CACHE_H__
+#define __ARCH_PBUF_CACHE_H__
+
+#include "lwip/opt.h"
+
+#if XLWIP_PBUF_CACHE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Per-core PBUF_POOL caches. pbuf_alloc()/pbuf_free() take PBUF_POOL
+ * buffers from a free list owned by the calling core and only go to the
+ * memp pool, under SYS_ARCH_PROTECT, to refill or drain
+ * XLWIP_PBUF_CACHE_BATCH buffers at a time. A cache is claimed with an
+ * atomic exchange instead of masking interrupts; a caller that finds it
+ * claimed (an ISR that preempted a task using it, or another core) falls
+ * back to the memp pool.
+ *
+ * Buffers held in a cache are counted as used by MEMP_STATS.
+ */
+#ifndef XLWIP_PBUF_CACHE_SIZE
+#define XLWIP_PBUF_CACHE_SIZE	32
+#endif
+
+#ifndef XLWIP_PBUF_CACHE_BATCH
+#define XLWIP_PBUF_CACHE_BATCH	(XLWIP_PBUF_CACHE_SIZE / 2)
+#endif
+
+#ifdef __aarch64__
+#define XLWIP_PBUF_CACHE_CORES	4
+#else
+#define XLWIP_PBUF_CACHE_CORES	2
+#endif
+
+#if (XLWIP_PBUF_CACHE_BATCH < 1) || \
+	(XLWIP_PBUF_CACHE_BATCH > XLWIP_PBUF_CACHE_SIZE)
+#error "XLWIP_PBUF_CACHE_BATCH must be between 1 and XLWIP_PBUF_CACHE_SIZE"
+#endif
+
+void *xlwip_pbuf_cache_alloc(void);
+void xlwip_pbuf_cache_free(void *p);
+void xlwip_pbuf_cache_drain(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XLWIP_PBUF_CACHE */
+
+#endif /* __ARCH_PBUF_CACHE_H__ */
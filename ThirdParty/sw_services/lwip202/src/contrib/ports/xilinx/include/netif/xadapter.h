@@ -72,6 +72,16 @@ struct netif *	xemac_add(struct netif *netif,
 	unsigned mac_baseaddr);
 #if defined (__arm__) || defined (__aarch64__)
 void xemacpsif_resetrx_on_no_rxdata(struct netif *netif);
+void xemacpsif_tx_batch_begin(struct netif *netif);
+void xemacpsif_tx_batch_end(struct netif *netif);
+s32_t xemacpsif_set_rx_priority_ethtype(struct netif *netif, u16_t ethtype);
+s32_t xemacpsif_set_rx_priority_udp_port(struct netif *netif, u16_t port);
+#if XLWIP_PTP_TIMESTAMP
+/* called from the TX complete interrupt with a timestamped frame */
+typedef void (*xemacpsif_tx_ts_handler_t)(struct netif *netif, struct pbuf *p);
+void xemacpsif_set_tx_timestamp_handler(struct netif *netif,
+		xemacpsif_tx_ts_handler_t handler);
+#endif
 #endif
 
 /* global lwip debug variable used for debugging */
@@ -87,6 +87,16 @@ extern "C" {
 
 #define MAX_FRAME_SIZE_JUMBO (XEMACPS_MTU_JUMBO + XEMACPS_HDR_SIZE + XEMACPS_TRL_SIZE)
 
+/* Number of frames drained per RX poll; 0 selects interrupt-per-frame mode */
+#ifndef XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET
+#define XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET 0
+#endif
+
+/* Number of RxBDs on receive priority queue 1; 0 leaves queue 1 parked */
+#ifndef XLWIP_CONFIG_N_RX_DESC_Q1
+#define XLWIP_CONFIG_N_RX_DESC_Q1 0
+#endif
+
 void 	xemacpsif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacpsif_getmac(u32_t index);
 err_t 	xemacpsif_init(struct netif *netif);
@@ -103,6 +113,8 @@ typedef struct {
 
 	/* queue to store overflow packets */
 	pq_queue_t *recv_q;
+	/* frames received on priority queue 1, served ahead of recv_q */
+	pq_queue_t *recv_q1;
 	pq_queue_t *send_q;
 
 	/* pointers to memory holding buffer descriptors (used only with SDMA) */
@@ -111,6 +123,30 @@ typedef struct {
 
 	unsigned int last_rx_frms_cntr;
 
+	/* RX complete interrupt masked, frames pending in the RxBD ring */
+	volatile u32_t rx_poll_scheduled;
+
+	/* TX batching: BDs filled but not yet handed over to the hardware */
+	u32_t tx_batch_active;
+	u32_t tx_batch_bdcnt;
+	XEmacPs_Bd *tx_batch_bdset;
+
+	/* RX priority queue 1 ring in use, screeners allocated to it */
+	u32_t rx_q1_active;
+	u32_t rx_q1_n_udp;
+	u32_t rx_q1_n_ethtype;
+
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	/* preallocated RX pbuf pool used to refill the RxBD ring */
+	void *rx_pool;
+#endif
+
+#if XLWIP_PTP_TIMESTAMP
+	/* receives transmitted frames carrying a TSU timestamp */
+	struct netif *netif;
+	xemacpsif_tx_ts_handler_t tx_ts_handler;
+#endif
+
 } xemacpsif_s;
 
 extern xemacpsif_s xemacpsif;
@@ -124,7 +160,12 @@ u32_t phy_setup (XEmacPs *xemacpsp, u32_t phy_addr);
 void detect_phy(XEmacPs *xemacpsp);
 void emacps_send_handler(void *arg);
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p);
+XStatus emacps_sgsend_flush(xemacpsif_s *xemacpsif);
 void emacps_recv_handler(void *arg);
+void emacps_recv_q1_handler(void *arg);
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET > 0
+s32_t emacps_rx_poll(xemacpsif_s *xemacpsif, struct pbuf **pbufs, s32_t budget);
+#endif
 void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord);
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring);
 void HandleTxErrors(struct xemac_s *xemac);
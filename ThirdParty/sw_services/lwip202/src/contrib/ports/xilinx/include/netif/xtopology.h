@@ -37,7 +37,7 @@
 extern "C" {
 #endif
 
-enum xemac_types { xemac_type_unknown = -1, xemac_type_xps_emaclite, xemac_type_xps_ll_temac, xemac_type_axi_ethernet, xemac_type_emacps };
+enum xemac_types { xemac_type_unknown = -1, xemac_type_xps_emaclite, xemac_type_xps_ll_temac, xemac_type_axi_ethernet, xemac_type_emacps, xemac_type_xxv_ethernet };
 
 struct xtopology_t {
 	unsigned emac_baseaddr;
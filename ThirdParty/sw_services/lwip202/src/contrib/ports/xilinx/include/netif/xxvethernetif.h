@@ -0,0 +1,116 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#ifndef __NETIF_XXVETHERNETIF_H__
+#define __NETIF_XXVETHERNETIF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xlwipconfig.h"
+#include "lwip/netif.h"
+#include "netif/etharp.h"
+#include "netif/xadapter.h"
+
+#include "xparameters.h"
+#include "xstatus.h"
+
+#include "xxxvethernet.h"
+#include "xmcdma.h"
+
+#include "netif/xpqueue.h"
+
+/*
+ * Number of MCDMA channel pairs used by the port. The generated
+ * xlwipconfig.h sets this to the number of channels whose interrupts are
+ * connected; the port further limits it to what the MCDMA has on both the
+ * MM2S and the S2MM side.
+ */
+#ifndef XLWIP_CONFIG_XXV_N_CHANNELS
+#define XLWIP_CONFIG_XXV_N_CHANNELS	1
+#endif
+
+#ifdef USE_JUMBO_FRAMES
+#define XXV_RX_BUF_SIZE		XXE_MAX_JUMBO_FRAME_SIZE
+#else
+#define XXV_RX_BUF_SIZE		XXE_MAX_FRAME_SIZE
+#endif
+
+err_t 	xxvethernetif_init(struct netif *netif);
+int 	xxvethernetif_input(struct netif *netif);
+
+/* structure within each netif, encapsulating all information required for
+ * using a particular xxv ethernet instance
+ */
+typedef struct {
+	XMcdma       mcdma;
+	XXxvEthernet xxv_ethernet;
+
+	/* queue to store overflow packets */
+	pq_queue_t *recv_q;
+	pq_queue_t *send_q;
+
+	/* pointers to memory holding buffer descriptors, all channels */
+	void *rx_bdspace;
+	void *tx_bdspace;
+
+	/* MCDMA channel pairs in use, channel ids 1 .. n_chans */
+	u32_t n_chans;
+
+	/* pbufs attached to the BDs, indexed by channel and BD */
+	struct pbuf *rx_pbufs[XLWIP_CONFIG_XXV_N_CHANNELS][XLWIP_CONFIG_N_RX_DESC];
+	struct pbuf *tx_pbufs[XLWIP_CONFIG_XXV_N_CHANNELS][XLWIP_CONFIG_N_TX_DESC];
+
+	/* frames received per S2MM channel, shows the RX hash spread */
+	u32_t rx_frames[XLWIP_CONFIG_XXV_N_CHANNELS];
+
+	/* recycled zero copy RX buffers */
+	void *rx_pool;
+} xxvethernetif_s;
+
+/* xxvethernetif.c */
+XXxvEthernet_Config *xxvethernet_lookup_config(unsigned mac_base);
+
+/* xxvethernetif_mcdma.c */
+XStatus init_xxv_mcdma(struct xemac_s *xemac, UINTPTR mcdma_baseaddr);
+void	xxv_mcdma_start(xxvethernetif_s *xxvethernetif);
+u32_t	xxv_tx_space_available(xxvethernetif_s *xxvethernetif, u32_t chan_id);
+void	xxv_process_sent_bds(xxvethernetif_s *xxvethernetif);
+XStatus xxv_mcdma_sgsend(xxvethernetif_s *xxvethernetif, struct pbuf *p,
+							u32_t chan_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NETIF_XXVETHERNETIF_H__ */
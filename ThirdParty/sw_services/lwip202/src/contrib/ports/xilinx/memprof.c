@@ -0,0 +1,255 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#include "lwip/opt.h"
+
+#if XLWIP_MEMPROF
+
+#include <string.h>
+
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+#include "lwip/sys.h"
+#include "arch/memprof.h"
+#include "xil_printf.h"
+
+#if !MEMP_STATS || !MEM_STATS
+#error "XLWIP_MEMPROF requires LWIP_STATS with MEMP_STATS and MEM_STATS"
+#endif
+
+/* lwipopts.h option that sizes each pool */
+static const char *const memprof_opt[MEMP_MAX] = {
+#define LWIP_MEMPOOL(name, num, size, desc) #num,
+#define LWIP_PBUF_MEMPOOL(name, num, payload, desc) #num,
+#define LWIP_MALLOC_MEMPOOL(num, size) "",
+#define LWIP_MALLOC_MEMPOOL_START
+#define LWIP_MALLOC_MEMPOOL_END
+#include "lwip/priv/memp_std.h"
+};
+
+/* pool description */
+static const char *const memprof_desc[MEMP_MAX] = {
+#define LWIP_MEMPOOL(name, num, size, desc) desc,
+#define LWIP_MALLOC_MEMPOOL(num, size) "MALLOC_"#size,
+#define LWIP_MALLOC_MEMPOOL_START
+#define LWIP_MALLOC_MEMPOOL_END
+#include "lwip/priv/memp_std.h"
+};
+
+/* lwipopts.h option and the BSP parameter that generates it */
+static const struct {
+	const char *opt;
+	const char *param;
+} memprof_param[] = {
+	{ "MEM_SIZE", "mem_size" },
+	{ "MEMP_NUM_PBUF", "memp_n_pbuf" },
+	{ "MEMP_NUM_UDP_PCB", "memp_n_udp_pcb" },
+	{ "MEMP_NUM_TCP_PCB", "memp_n_tcp_pcb" },
+	{ "MEMP_NUM_TCP_PCB_LISTEN", "memp_n_tcp_pcb_listen" },
+	{ "MEMP_NUM_TCP_SEG", "memp_n_tcp_seg" },
+	{ "MEMP_NUM_SYS_TIMEOUT", "memp_n_sys_timeout" },
+	{ "PBUF_POOL_SIZE", "pbuf_pool_size" },
+};
+
+/* headroom added on top of the observed peak, 1/4 of the peak */
+#define MEMPROF_HEADROOM_SHIFT	2
+
+static struct xlwip_memprof_stats memprof[MEMP_MAX];
+static xlwip_memprof_clock_fn memprof_clock = NULL;
+
+void xlwip_memprof_set_clock(xlwip_memprof_clock_fn clock)
+{
+	memprof_clock = clock;
+}
+
+u32_t xlwip_memprof_start(void)
+{
+	xlwip_memprof_clock_fn clock = memprof_clock;
+
+	return (clock != NULL) ? clock() : 0;
+}
+
+void xlwip_memprof_record(memp_t type, u32_t start, void *mem)
+{
+	xlwip_memprof_clock_fn clock = memprof_clock;
+	struct xlwip_memprof_stats *s = &memprof[type];
+	u32_t lat = 0;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if (clock != NULL) {
+		lat = clock() - start;
+	}
+
+	SYS_ARCH_PROTECT(lev);
+	s->allocs++;
+	if (mem == NULL) {
+		s->fails++;
+	}
+	s->lat_total += lat;
+	if (lat > s->lat_max) {
+		s->lat_max = lat;
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * Start a new profiling window: the high-water marks restart from the
+ * current usage and the failure and latency counters are cleared.
+ */
+void xlwip_memprof_reset(void)
+{
+	int i;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	for (i = 0; i < MEMP_MAX; i++) {
+		memprof[i].allocs = 0;
+		memprof[i].fails = 0;
+		memprof[i].lat_max = 0;
+		memprof[i].lat_total = 0;
+		lwip_stats.memp[i]->max = lwip_stats.memp[i]->used;
+		lwip_stats.memp[i]->err = 0;
+	}
+	lwip_stats.mem.max = lwip_stats.mem.used;
+	lwip_stats.mem.err = 0;
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+const struct xlwip_memprof_stats *xlwip_memprof_get(memp_t type)
+{
+	if (type >= MEMP_MAX) {
+		return NULL;
+	}
+	return &memprof[type];
+}
+
+static const char *memprof_bsp_param(const char *opt)
+{
+	unsigned int i;
+
+	for (i = 0; i < sizeof(memprof_param) / sizeof(memprof_param[0]); i++) {
+		if (strcmp(memprof_param[i].opt, opt) == 0) {
+			return memprof_param[i].param;
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Size recommended for a pool. A pool that failed allocations was too small
+ * for the traffic and its real demand is unknown, so its size is doubled.
+ * Otherwise the peak usage plus headroom is recommended.
+ */
+static u32_t memprof_recommend(u32_t avail, u32_t max, u32_t err)
+{
+	if (err != 0) {
+		return (avail != 0) ? avail * 2 : 1;
+	}
+	return max + (max >> MEMPROF_HEADROOM_SHIFT) + 1;
+}
+
+static void memprof_print_opt(const char *opt, u32_t value)
+{
+	const char *param = memprof_bsp_param(opt);
+
+	if (param != NULL) {
+		xil_printf("#define %s %d\t/* BSP parameter %s */\r\n",
+			   opt, (int)value, param);
+	} else {
+		xil_printf("#define %s %d\r\n", opt, (int)value);
+	}
+}
+
+/*
+ * Print the pool statistics of the current profiling window followed by the
+ * recommended lwipopts.h sizes.
+ */
+void xlwip_memprof_report(void)
+{
+	int i;
+	int j;
+	struct stats_mem *m;
+	struct xlwip_memprof_stats *s;
+	u32_t avg;
+	u32_t size;
+
+	xil_printf("\r\nlwIP memory pool profile\r\n");
+	xil_printf("%-16s %6s %6s %6s %10s %8s %8s %8s\r\n", "pool", "avail",
+		   "max", "err", "allocs", "fails", "lat_avg", "lat_max");
+	for (i = 0; i < MEMP_MAX; i++) {
+		m = lwip_stats.memp[i];
+		s = &memprof[i];
+		avg = (s->allocs != 0) ?
+			(u32_t)(s->lat_total / s->allocs) : 0;
+		xil_printf("%-16s %6d %6d %6d %10d %8d %8d %8d\r\n",
+			   memprof_desc[i], (int)m->avail, (int)m->max,
+			   (int)m->err, (int)s->allocs, (int)s->fails,
+			   (int)avg, (int)s->lat_max);
+	}
+	xil_printf("%-16s %6d %6d %6d\r\n", "MEM HEAP",
+		   (int)lwip_stats.mem.avail, (int)lwip_stats.mem.max,
+		   (int)lwip_stats.mem.err);
+
+	xil_printf("\r\nRecommended lwipopts.h configuration:\r\n");
+	for (i = 0; i < MEMP_MAX; i++) {
+		if (memprof_opt[i][0] < 'A' || memprof_opt[i][0] > 'Z') {
+			/* pool not sized by an option */
+			continue;
+		}
+		for (j = 0; j < i; j++) {
+			if (strcmp(memprof_opt[j], memprof_opt[i]) == 0) {
+				break;
+			}
+		}
+		if (j < i) {
+			/* option already printed */
+			continue;
+		}
+		/* pools sharing an option need the largest size */
+		size = 0;
+		for (j = i; j < MEMP_MAX; j++) {
+			m = lwip_stats.memp[j];
+			if (strcmp(memprof_opt[j], memprof_opt[i]) == 0 &&
+			    memprof_recommend(m->avail, m->max, m->err) > size) {
+				size = memprof_recommend(m->avail, m->max,
+							 m->err);
+			}
+		}
+		memprof_print_opt(memprof_opt[i], size);
+	}
+	memprof_print_opt("MEM_SIZE",
+			  LWIP_MEM_ALIGN_SIZE(memprof_recommend(
+				lwip_stats.mem.avail, lwip_stats.mem.max,
+				lwip_stats.mem.err)));
+}
+
+#endif /* XLWIP_MEMPROF */
@@ -63,6 +63,10 @@
 #include "netif/xemacpsif.h"
 #endif
 
+#ifdef XLWIP_CONFIG_INCLUDE_XXV_ETHERNET
+#include "netif/xxvethernetif.h"
+#endif
+
 #if !NO_SYS
 #include "lwip/tcpip.h"
 #endif
@@ -159,6 +163,20 @@ xemac_add(struct netif *netif,
 					);
 #else
 				return NULL;
+#endif
+			case xemac_type_xxv_ethernet:
+#ifdef XLWIP_CONFIG_INCLUDE_XXV_ETHERNET
+				return netif_add(netif, ipaddr, netmask, gw,
+					(void*)(UINTPTR)mac_baseaddr,
+					xxvethernetif_init,
+#if NO_SYS
+					ethernet_input
+#else
+					tcpip_input
+#endif
+					);
+#else
+				return NULL;
 #endif
 #if defined (__arm__) || defined (__aarch64__)
 			case xemac_type_emacps:
@@ -230,6 +248,15 @@ xemacif_input(struct netif *netif)
 			print("incorrect configuration: axi_ethernet drivers not present?");
 			while(1);
 			return 0;
+#endif
+		case xemac_type_xxv_ethernet:
+#ifdef XLWIP_CONFIG_INCLUDE_XXV_ETHERNET
+			n_packets = xxvethernetif_input(netif);
+			break;
+#else
+			print("incorrect configuration: xxv_ethernet drivers not present?");
+			while(1);
+			return 0;
 #endif
 #if defined (__arm__) || defined (__aarch64__)
 		case xemac_type_emacps:
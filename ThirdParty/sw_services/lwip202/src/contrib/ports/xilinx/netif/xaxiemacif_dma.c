@@ -47,6 +47,7 @@
 
 #include "lwip/stats.h"
 #include "lwip/inet_chksum.h"
+#include "lwip/prot/udp.h"
 
 #include "netif/xadapter.h"
 #include "netif/xaxiemacif.h"
@@ -69,6 +70,7 @@
 #if defined __aarch64__
 #include "xil_mmu.h"
 #endif
+#include "xil_arena.h"
 
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 #define AXIDMA_TX_INTR_PRIORITY_SET_IN_GIC	0xA0
@@ -90,9 +92,48 @@
 
 #endif
 
+#if defined(__MICROBLAZE__)
+/*
+ * The xenv cache macros walk the L1 data cache line by line and skip the
+ * system cache. The BSP DMA helpers also maintain the system cache, switch
+ * to whole cache operations for large buffers and leave a write-through L1
+ * cache alone when a TX buffer is handed to the DMA.
+ */
+#include "xil_cache.h"
+#undef XCACHE_FLUSH_DCACHE_RANGE
+#undef XCACHE_INVALIDATE_DCACHE_RANGE
+#define XCACHE_FLUSH_DCACHE_RANGE(data, length)	\
+		Xil_DCacheDmaToDevice((UINTPTR)(data), (u32)(length))
+#define XCACHE_INVALIDATE_DCACHE_RANGE(data, length)	\
+		Xil_DCacheDmaFromDevice((UINTPTR)(data), (u32)(length))
+#endif
+
 /* Byte alignment of BDs */
 #define BD_ALIGNMENT (XAXIDMA_BD_MINIMUM_ALIGNMENT*2)
 
+#ifdef USE_JUMBO_FRAMES
+#define AXIETH_MAX_RX_FRAME_SIZE	XAE_MAX_JUMBO_FRAME_SIZE
+#else
+#define AXIETH_MAX_RX_FRAME_SIZE	XAE_MAX_FRAME_SIZE
+#endif
+
+/*
+ * Every RxBD gets a single PBUF_POOL pbuf. Frames larger than a pool
+ * buffer (jumbo frames) are scattered by the DMA over several BDs and
+ * handed to lwIP as a pbuf chain, without copying.
+ */
+#define AXIETH_RX_SEG_SIZE	((PBUF_POOL_BUFSIZE < AXIETH_MAX_RX_FRAME_SIZE) ? \
+				 PBUF_POOL_BUFSIZE : AXIETH_MAX_RX_FRAME_SIZE)
+
+/* RX full checksum offload status, app word 2 bits [5:3] */
+#define AXIETH_RX_CSUM_STATUS(bd)	\
+	((XAxiDma_BdRead((bd), XAXIDMA_BD_USR2_OFFSET) >> 3) & 0x7)
+#define AXIETH_RX_CSUM_NONE		0x0
+#define AXIETH_RX_CSUM_IP_OK		0x1
+#define AXIETH_RX_CSUM_IP_TCP_OK	0x2
+#define AXIETH_RX_CSUM_IP_UDP_OK	0x3
+#define AXIETH_RX_CSUM_IP_BAD		0x5
+
 #if XPAR_INTC_0_HAS_FAST == 1
 /*********** Function Prototypes *********************************************/
 /*
@@ -113,7 +154,11 @@ xaxiemacif_s *xaxiemacif_fast;
 u32 xInsideISR = 0;
 #endif
 
-#if defined (__aarch64__) || defined (ARMR5)
+/*
+ * With a non-cacheable dma arena in the standalone BSP, the BD rings are
+ * taken from the arena instead of from bd_space.
+ */
+#if (defined (__aarch64__) || defined (ARMR5)) && XIL_ARENA_DMA_SIZE == 0U
 u8_t bd_space[0x200000] __attribute__ ((aligned (0x200000)));
 #endif
 
@@ -192,6 +237,7 @@ s32_t is_checksum_valid(XAxiDma_Bd *rxbd, struct pbuf *p) {
 		u32_t computed_csum;
 		u16_t padding_len, tcp_payload_len, packet_len;
 		u16_t csum;
+		ip4_addr_t src, dest;
 
 		/* determine length of IP header */
 		iphdr_len = (IPH_HL(&ehdr->ip) * 4);
@@ -201,9 +247,10 @@ s32_t is_checksum_valid(XAxiDma_Bd *rxbd, struct pbuf *p) {
 		padding_len = packet_len - tcp_payload_offset - tcp_payload_len;
 
 		csum_in_rxbd = extract_csum(rxbd);
-		pseudo_csum = htons(inet_chksum_pseudo(NULL,
-					(ip_addr_t *)&ehdr->ip.src, (ip_addr_t *)&ehdr->ip.dest,
-					proto, tcp_payload_len));
+		ip4_addr_copy(src, ehdr->ip.src);
+		ip4_addr_copy(dest, ehdr->ip.dest);
+		pseudo_csum = htons(inet_chksum_pseudo(NULL, proto, tcp_payload_len,
+					&src, &dest));
 
 		/* xps_ll_temac computes the checksum of the packet starting at byte 14
 		 * we need to subtract the values of the ethernet & IP headers
@@ -244,6 +291,81 @@ s32_t is_checksum_valid(XAxiDma_Bd *rxbd, struct pbuf *p) {
 	}
 }
 
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+/*
+ * With RX full checksum offload enabled lwIP does not check the checksums
+ * of received frames. The core reports in the last RxBD of a frame which
+ * checksums it has verified; frames with a bad checksum are dropped and
+ * IPv4 frames the core could not verify are checked here.
+ * Returns 0 if the frame has to be dropped.
+ */
+static s32_t axieth_rx_csum_ok(struct pbuf *p, XAxiDma_Bd *eofbd)
+{
+	struct eth_hdr *ethhdr;
+	struct ip_hdr *iphdr;
+	ip4_addr_t src, dest;
+	u16_t iphdr_hlen, iphdr_len;
+	u16_t chksum;
+	u8_t proto;
+	u32_t csum = AXIETH_RX_CSUM_STATUS(eofbd);
+	const u16_t hwhdr_len = SIZEOF_ETH_HDR - ETH_PAD_SIZE;
+
+	if ((csum == AXIETH_RX_CSUM_IP_TCP_OK) ||
+			(csum == AXIETH_RX_CSUM_IP_UDP_OK)) {
+		return 1;
+	}
+	if (csum >= AXIETH_RX_CSUM_IP_BAD) {
+		return 0;
+	}
+	if (p->len < (hwhdr_len + IP_HLEN)) {
+		return 1;
+	}
+	ethhdr = (struct eth_hdr *)p->payload;
+	if (ethhdr->type != PP_HTONS(ETHTYPE_IP)) {
+		return 1;
+	}
+	iphdr = (struct ip_hdr *)((u8_t *)p->payload + hwhdr_len);
+	iphdr_hlen = IPH_HL(iphdr) * 4;
+	iphdr_len = lwip_ntohs(IPH_LEN(iphdr));
+	if ((iphdr_hlen < IP_HLEN) || (p->len < (hwhdr_len + iphdr_hlen)) ||
+			(p->tot_len < (hwhdr_len + iphdr_len)) ||
+			(iphdr_len < iphdr_hlen)) {
+		/* malformed, left to ip4_input to discard */
+		return 1;
+	}
+	if ((csum != AXIETH_RX_CSUM_IP_OK) &&
+			(inet_chksum(iphdr, iphdr_hlen) != 0)) {
+		return 0;
+	}
+
+	/* TCP/UDP checksums of fragments can only be checked after reassembly */
+	proto = IPH_PROTO(iphdr);
+	if (((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0) ||
+			((proto != IP_PROTO_TCP) && (proto != IP_PROTO_UDP))) {
+		return 1;
+	}
+
+	/* strip Ethernet padding, ip4_input would do the same */
+	pbuf_realloc(p, hwhdr_len + iphdr_len);
+	ip4_addr_copy(src, iphdr->src);
+	ip4_addr_copy(dest, iphdr->dest);
+	pbuf_header(p, -(s16_t)(hwhdr_len + iphdr_hlen));
+	if ((proto == IP_PROTO_UDP) && (p->len >= 8) &&
+			(((struct udp_hdr *)p->payload)->chksum == 0)) {
+		/* UDP checksum not used by the sender */
+		chksum = 0;
+	} else {
+		chksum = inet_chksum_pseudo(p, proto, iphdr_len - iphdr_hlen,
+						&src, &dest);
+	}
+	pbuf_header(p, (s16_t)(hwhdr_len + iphdr_hlen));
+
+	return (chksum == 0);
+}
+#else
+#define axieth_rx_csum_ok(p, eofbd)	1
+#endif
+
 static inline void *alloc_bdspace(int n_desc)
 {
 	int space = XAxiDma_BdRingMemCalc(BD_ALIGNMENT, n_desc);
@@ -306,35 +428,37 @@ static void axidma_send_handler(void *arg)
 #endif
 }
 
+/*
+ * Attach a pbuf to every free RxBD and hand them to the hardware with a
+ * single tail pointer update.
+ */
 static void setup_rx_bds(XAxiDma_BdRing *rxring)
 {
-	XAxiDma_Bd *rxbd;
-	s32_t n_bds;
+	XAxiDma_Bd *rxbd, *rxbdset;
+	s32_t n_bds, i;
 	XStatus status;
 	struct pbuf *p;
 	u32 bdsts;
 
 	n_bds = XAxiDma_BdRingGetFreeCnt(rxring);
-	while (n_bds > 0) {
-		n_bds--;
-#ifdef USE_JUMBO_FRAMES
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_JUMBO_FRAME_SIZE, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+	if (n_bds == 0) {
+		return;
+	}
+	status = XAxiDma_BdRingAlloc(rxring, n_bds, &rxbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("setup_rx_bds: Error allocating RxBD\r\n"));
+		return;
+	}
+
+	for (i = 0, rxbd = rxbdset; i < n_bds; i++) {
+		p = pbuf_alloc(PBUF_RAW, AXIETH_RX_SEG_SIZE, PBUF_POOL);
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
 #endif
 			printf("unable to alloc pbuf in recv_handler\r\n");
-			return;
-		}
-		status = XAxiDma_BdRingAlloc(rxring, 1, &rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("setup_rx_bds: Error allocating RxBD\r\n"));
-			pbuf_free(p);
-			return;
+			break;
 		}
 		 /* Setup the BD. */
 		XAxiDma_BdSetBufAddr(rxbd, (UINTPTR)p->payload);
@@ -347,36 +471,45 @@ static void setup_rx_bds(XAxiDma_BdRing *rxring)
 		XAxiDma_BdSetLength(rxbd, p->len, rxring->MaxTransferLen);
 		XAxiDma_BdSetCtrl(rxbd, 0);
 		XAxiDma_BdSetId(rxbd, p);
-#if !defined (__MICROBLAZE__)
-		dsb();
-#endif
 #if defined(__aarch64__)
-		XCACHE_INVALIDATE_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAE_MAX_FRAME_SIZE);
+		XCACHE_INVALIDATE_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)p->len);
 #else
 		XCACHE_FLUSH_DCACHE_RANGE(p, sizeof *p);
-		XCACHE_FLUSH_DCACHE_RANGE(rxbd, sizeof *rxbd);
+#endif
+		rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
+	}
+	if (i < n_bds) {
+		XAxiDma_BdRingUnAlloc(rxring, n_bds - i, rxbd);
+	}
+	if (i == 0) {
+		return;
+	}
+#if !defined (__MICROBLAZE__)
+	dsb();
 #endif
 
-		/* Enqueue to HW */
-		status = XAxiDma_BdRingToHw(rxring, 1, rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("Error committing RxBD to hardware: "));
-			if (status == XST_DMA_SG_LIST_ERROR) {
-				LWIP_DEBUGF(NETIF_DEBUG, ("XST_DMA_SG_LIST_ERROR: this function was called out of sequence with XAxiDma_BdRingAlloc()\r\n"));
-			}
-			else {
-				LWIP_DEBUGF(NETIF_DEBUG, ("set of BDs was rejected because the first BD did not have its start-of-packet bit set, or the last BD did not have its end-of-packet bit set, or any one of the BD set has 0 as length value\r\n"));
-			}
-			pbuf_free(p);
-			XAxiDma_BdRingUnAlloc(rxring, 1, rxbd);
-			return;
+	/* Enqueue to HW */
+	status = XAxiDma_BdRingToHw(rxring, i, rxbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error committing RxBD to hardware: "));
+		if (status == XST_DMA_SG_LIST_ERROR) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("XST_DMA_SG_LIST_ERROR: this function was called out of sequence with XAxiDma_BdRingAlloc()\r\n"));
+		}
+		else {
+			LWIP_DEBUGF(NETIF_DEBUG, ("set of BDs was rejected because the first BD did not have its start-of-packet bit set, or the last BD did not have its end-of-packet bit set, or any one of the BD set has 0 as length value\r\n"));
 		}
+		n_bds = i;
+		for (i = 0, rxbd = rxbdset; i < n_bds; i++) {
+			pbuf_free((struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd));
+			rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
+		}
+		XAxiDma_BdRingUnAlloc(rxring, n_bds, rxbdset);
 	}
 }
 
 static void axidma_recv_handler(void *arg)
 {
-	struct pbuf *p;
+	struct pbuf *p, *q;
 	u32 irq_status, i, timeOut;
 	XAxiDma_Bd *rxbd, *rxbdset;
 	struct xemac_s *xemac;
@@ -427,45 +560,80 @@ static void axidma_recv_handler(void *arg)
 	 */
 	if (irq_status & (XAXIDMA_IRQ_DELAY_MASK | XAXIDMA_IRQ_IOC_MASK)) {
 		u32 bd_processed;
-		u32 rx_bytes;
+		u32 rx_bytes, seg_len, bdsts;
 
+		/* FromHw only returns complete frames, so every frame in the
+		 * set starts with an RXSOF and ends with an RXEOF BD.
+		 */
 		bd_processed = XAxiDma_BdRingFromHw(rxring, XAXIDMA_ALL_BDS, &rxbdset);
 
+		p = NULL;
 		for (i = 0, rxbd = rxbdset; i < bd_processed; i++) {
-			p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd);
-			/* Adjust the buffer size to the actual number of bytes received.*/
-			rx_bytes = extract_packet_len(rxbd);
-			pbuf_realloc(p, rx_bytes);
-
-#ifdef USE_JUMBO_FRAMES
+			q = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd);
+			bdsts = XAxiDma_BdGetSts(rxbd);
+			seg_len = XAxiDma_BdGetActualLength(rxbd,
+						rxring->MaxTransferLen);
+			/* Only the bytes written by the DMA are read back */
 #ifndef __aarch64__
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload,
-							XAE_MAX_JUMBO_FRAME_SIZE);
-#endif
-#else
-#ifndef __aarch64__
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload, XAE_MAX_FRAME_SIZE);
-#endif
+			XCACHE_INVALIDATE_DCACHE_RANGE(q->payload, seg_len);
 #endif
+			pbuf_realloc(q, seg_len);
+
+			if (bdsts & XAXIDMA_BD_STS_RXSOF_MASK) {
+				if (p != NULL) {
+					pbuf_free(p);
+				}
+				p = q;
+			} else if (p != NULL) {
+				pbuf_cat(p, q);
+			} else {
+				pbuf_free(q);
+			}
 
+			if ((bdsts & XAXIDMA_BD_STS_RXEOF_MASK) && (p != NULL)) {
+				/* Adjust the frame size to the actual number of
+				 * bytes received.
+				 */
+				rx_bytes = extract_packet_len(rxbd);
+				if (rx_bytes < p->tot_len) {
+					pbuf_realloc(p, rx_bytes);
+				}
+
+				if ((bdsts & XAXIDMA_BD_STS_ALL_ERR_MASK) ||
+						!axieth_rx_csum_ok(p, rxbd)) {
+					LWIP_DEBUGF(NETIF_DEBUG, ("Dropping frame with bad csum\r\n"));
+#if LINK_STATS
+					lwip_stats.link.chkerr++;
+					lwip_stats.link.drop++;
+#endif
+					pbuf_free(p);
+					p = NULL;
+					rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
+					continue;
+				}
 #if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
-			/* Verify for partial checksum offload case */
-			if (!is_checksum_valid(rxbd, p)) {
-				LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
-			}
+				/* Verify for partial checksum offload case */
+				if ((p->next == NULL) && !is_checksum_valid(rxbd, p)) {
+					LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
+				}
 #endif
-			/* store it in the receive queue,
-			 * where it'll be processed by a different handler
-			 */
-			if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
+				/* store it in the receive queue,
+				 * where it'll be processed by a different handler
+				 */
+				if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
 #if LINK_STATS
-				lwip_stats.link.memerr++;
-				lwip_stats.link.drop++;
+					lwip_stats.link.memerr++;
+					lwip_stats.link.drop++;
 #endif
-				pbuf_free(p);
+					pbuf_free(p);
+				}
+				p = NULL;
 			}
 			rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
 		}
+		if (p != NULL) {
+			pbuf_free(p);
+		}
 		/* free up the BD's */
 		XAxiDma_BdRingFree(rxring, bd_processed, rxbdset);
 		/* return all the processed bd's back to the stack */
@@ -623,10 +791,7 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 	XAxiDma_Config *dmaconfig;
 	XAxiDma_Bd bdtemplate;
 	XAxiDma_BdRing *rxringptr, *txringptr;
-	XAxiDma_Bd *rxbd;
-	struct pbuf *p;
 	XStatus status;
-	u32_t i;
 	UINTPTR baseaddr;
 
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
@@ -660,7 +825,18 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 #endif
 
 	/* FIXME: On ZyqnMP Multiple Axi Ethernet are not supported */
-#if defined (__aarch64__) || defined (ARMR5)
+#if (defined (__aarch64__) || defined (ARMR5)) && XIL_ARENA_DMA_SIZE > 0U
+	xaxiemacif->rx_bdspace = NULL;
+	xaxiemacif->tx_bdspace = NULL;
+	if (Xil_ArenaDma() != NULL) {
+		xaxiemacif->rx_bdspace = Xil_ArenaAlloc(Xil_ArenaDma(),
+			XAxiDma_BdRingMemCalc(BD_ALIGNMENT, XLWIP_CONFIG_N_RX_DESC),
+			BD_ALIGNMENT);
+		xaxiemacif->tx_bdspace = Xil_ArenaAlloc(Xil_ArenaDma(),
+			XAxiDma_BdRingMemCalc(BD_ALIGNMENT, XLWIP_CONFIG_N_TX_DESC),
+			BD_ALIGNMENT);
+	}
+#elif defined (__aarch64__) || defined (ARMR5)
 	xaxiemacif->rx_bdspace = (void *)(UINTPTR)&(bd_space[0]);;
 	xaxiemacif->tx_bdspace = (void *)(UINTPTR)&(bd_space[0x10000]);
 #endif
@@ -671,7 +847,7 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 #endif
 
 	/* For A53 case Mark the BD Region as uncaheable */
-#if defined(__aarch64__)
+#if defined(__aarch64__) && XIL_ARENA_DMA_SIZE == 0U
 	Xil_SetTlbAttributes((UINTPTR)xaxiemacif->tx_bdspace, NORM_NONCACHE | INNER_SHAREABLE);
 	Xil_SetTlbAttributes((UINTPTR)xaxiemacif->rx_bdspace, NORM_NONCACHE | INNER_SHAREABLE);
 #endif
@@ -729,48 +905,11 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 	if (status != XST_SUCCESS) {
 		return ERR_IF;
 	}
-	/* Allocate RX descriptors, 1 RxBD at a time.*/
-	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
-		status = XAxiDma_BdRingAlloc(rxringptr, 1, &rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("init_axi_dma: Error allocating RxBD\r\n"));
-			return ERR_IF;
-		}
-#ifdef USE_JUMBO_FRAMES
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_JUMBO_FRAME_SIZE, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XAE_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
-		if (!p) {
-#if LINK_STATS
-			lwip_stats.link.memerr++;
-			lwip_stats.link.drop++;
-#endif
-			LWIP_DEBUGF(NETIF_DEBUG, ("unable to alloc pbuf in recv_handler\r\n"));
-			return ERR_IF;
-		}
-		/* Setup the BD. The BD template used in the call to
-		 * XAxiEthernet_SgSetSpace() set the "last" field of all RxBDs.
-		 * Therefore we are not required to issue a XAxiDma_Bd_SetLast(rxbd)
-		 * here.
-		 */
-		XAxiDma_BdSetBufAddr(rxbd, (UINTPTR)p->payload);
-		XAxiDma_BdSetLength(rxbd, p->len, rxringptr->MaxTransferLen);
-		XAxiDma_BdSetCtrl(rxbd, 0);
-		XAxiDma_BdSetId(rxbd, p);
-#if defined(__aarch64__)
-		XCACHE_INVALIDATE_DCACHE_RANGE((UINTPTR)p->payload, (UINTPTR)XAE_MAX_FRAME_SIZE);
-#else
-		XCACHE_FLUSH_DCACHE_RANGE(p, sizeof *p);
-		XCACHE_FLUSH_DCACHE_RANGE(rxbd, sizeof *rxbd);
-#endif
-
-		/* Enqueue to HW */
-		status = XAxiDma_BdRingToHw(rxringptr, 1, rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("Error: committing RxBD to HW\r\n"));
-			return ERR_IF;
-		}
+	/* Allocate RX descriptors and hand them all to the hardware */
+	setup_rx_bds(rxringptr);
+	if (XAxiDma_BdRingGetFreeCnt(rxringptr) != 0) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("init_axi_dma: Error setting up RxBDs\r\n"));
+		return ERR_IF;
 	}
 
 	status = XAxiDma_BdRingSetCoalesce(txringptr, XLWIP_CONFIG_N_TX_COALESCE,
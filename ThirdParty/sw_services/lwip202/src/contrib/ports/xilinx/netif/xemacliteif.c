@@ -150,8 +150,9 @@ static err_t xemacliteif_output(struct netif *netif, struct pbuf *p,
 unsigned get_IEEE_phy_speed_emaclite(XEmacLite *xemaclitep);
 unsigned configure_IEEE_phy_speed_emaclite(XEmacLite *xemaclitep, unsigned speed);
 
-/* The payload from multiple pbufs is assembled into a single contiguous
- * area for transmission. Currently this is a global variable (it should really
+/* Frames are gathered from the pbufs directly into the EmacLite transmit
+ * buffer. This area is only used to drain a received frame that cannot be
+ * stored in a pbuf. Currently this is a global variable (it should really
  * belong in the per netif structure), but that is ok since this can be used
  * only in a protected context
  */
@@ -187,6 +188,7 @@ xemacif_recv_handler(void *arg) {
 	XEmacLite *instance = xemacliteif->instance;
 	struct pbuf *p;
 	int len = 0;
+	int n_frames = 0;
 	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
 
 #ifdef OS_IS_FREERTOS
@@ -197,53 +199,54 @@ xemacif_recv_handler(void *arg) {
 #else
 	XIntc_AckIntr(xtopologyp->intc_baseaddr, 1 << xtopologyp->intc_emac_intr);
 #endif
-	p = pbuf_alloc(PBUF_RAW, XEL_MAX_FRAME_SIZE, PBUF_POOL);
-	if (!p) {
+	/* With RX ping-pong buffers both buffers may hold a frame, and the
+	 * EmacLite raises one interrupt for them; drain everything so the
+	 * receiver is not left blocked on a full buffer.
+	 */
+	while (1) {
+		p = pbuf_alloc(PBUF_RAW, XEL_MAX_FRAME_SIZE, PBUF_POOL);
+		if (!p) {
+			/* receive and just ignore the frame.
+			 * we need to receive the frame because otherwise
+			 * emaclite will not generate any other interrupts
+			 * since it cannot receive, and we do not actively
+			 * poll the emaclite
+			 */
+			if (XEmacLite_Recv(instance, xemac_tx_frame) == 0) {
+				break;
+			}
 #if LINK_STATS
-		lwip_stats.link.memerr++;
-		lwip_stats.link.drop++;
-#endif
-		/* receive and just ignore the frame.
-		 * we need to receive the frame because otherwise emaclite will
-		 * not generate any other interrupts since it cannot receive,
-		 * and we do not actively poll the emaclite
-		 */
-		XEmacLite_Recv(instance, xemac_tx_frame);
-#ifdef OS_IS_FREERTOS
-		xInsideISR--;
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
 #endif
-		return;
-	}
-
-	/* receive the packet */
-	len = XEmacLite_Recv(instance, p->payload);
+			continue;
+		}
 
-	if (len == 0) {
-#if LINK_STATS
-		lwip_stats.link.drop++;
-#endif
-		pbuf_free(p);
-#ifdef OS_IS_FREERTOS
-		xInsideISR--;
-#endif
-		return;
-	}
+		/* receive the packet */
+		len = XEmacLite_Recv(instance, p->payload);
+		if (len == 0) {
+			pbuf_free(p);
+			break;
+		}
 
-	/* store it in the receive queue, where it'll be processed by xemacif input thread */
-	if (pq_enqueue(xemacliteif->recv_q, (void*)p) < 0) {
+		/* store it in the receive queue, where it'll be processed by
+		 * xemacif input thread
+		 */
+		if (pq_enqueue(xemacliteif->recv_q, (void*)p) < 0) {
 #if LINK_STATS
-		lwip_stats.link.memerr++;
-		lwip_stats.link.drop++;
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
 #endif
-		pbuf_free(p);
-#ifdef OS_IS_FREERTOS
-		xInsideISR--;
-#endif
-		return;
+			pbuf_free(p);
+			continue;
+		}
+		n_frames++;
 	}
 
 #if !NO_SYS
-	sys_sem_signal(&xemac->sem_rx_data_available);
+	if (n_frames > 0) {
+		sys_sem_signal(&xemac->sem_rx_data_available);
+	}
 #endif
 #ifdef OS_IS_FREERTOS
 	xInsideISR--;
@@ -267,30 +270,42 @@ int transmit_packet(XEmacLite *instancep, void *packet, unsigned len)
 /*
  * this function is always called with interrupts off
  * this function also assumes that there is space to send in the Emaclite buffer
+ *
+ * The pbufs are written straight into a free ping or pong transmit buffer,
+ * so with TX ping-pong buffers one frame is gathered while the other one
+ * is on the wire.
  */
 static err_t
 _unbuffered_low_level_output(XEmacLite *instancep, struct pbuf *p)
 {
 	struct pbuf *q;
-	int total_len = 0;
+	unsigned total_len = 0;
+	UINTPTR txbuf;
 
 #if ETH_PAD_SIZE
 	pbuf_header(p, -ETH_PAD_SIZE);			/* drop the padding word */
 #endif
 
-	for(q = p, total_len = 0; q != NULL; q = q->next) {
+	txbuf = XEmacLite_TxBufferGet(instancep);
+	if (txbuf == 0 || p->tot_len > XEL_MAX_TX_FRAME_SIZE) {
+#if LINK_STATS
+		lwip_stats.link.drop++;
+#endif
+#if ETH_PAD_SIZE
+		pbuf_header(p, ETH_PAD_SIZE);		/* reclaim the padding word */
+#endif
+		return ERR_IF;
+	}
+
+	for(q = p; q != NULL; q = q->next) {
 		/* Send the data from the pbuf to the interface, one pbuf at a
 		   time. The size of the data in each pbuf is kept in the ->len
 		   variable. */
-		memcpy(xemac_tx_frame + total_len, q->payload, q->len);
+		XEmacLite_TxBufferWrite(txbuf, total_len, q->payload, q->len);
 		total_len += q->len;
 	}
 
-	if (transmit_packet(instancep, xemac_tx_frame, total_len) < 0) {
-#if LINK_STATS
-		lwip_stats.link.drop++;
-#endif
-	}
+	XEmacLite_TxBufferSend(instancep, txbuf, total_len);
 
 #if ETH_PAD_SIZE
 	pbuf_header(p, ETH_PAD_SIZE);			/* reclaim the padding word */
@@ -303,6 +318,25 @@ _unbuffered_low_level_output(XEmacLite *instancep, struct pbuf *p)
 	return ERR_OK;
 }
 
+/*
+ * Move queued frames into the transmit buffers for as long as one is free.
+ * With TX ping-pong buffers this refills both, so the transmitter is never
+ * idle while frames are waiting.
+ */
+static void
+xemacliteif_send_backlog(xemacliteif_s *xemacliteif)
+{
+	XEmacLite *instance = xemacliteif->instance;
+	struct pbuf *p;
+
+	while (pq_qlength(xemacliteif->send_q) &&
+			(XEmacLite_TxBufferAvailable(instance) == TRUE)) {
+		p = (struct pbuf *)pq_dequeue(xemacliteif->send_q);
+		_unbuffered_low_level_output(instance, p);
+		pbuf_free(p);
+	}
+}
+
 /*
  * low_level_output():
  *
@@ -322,15 +356,15 @@ low_level_output(struct netif *netif, struct pbuf *p)
 
 	SYS_ARCH_PROTECT(lev);
 
-	/* check if space is available to send */
-        if (XEmacLite_TxBufferAvailable(instance) == TRUE) {
-		if (pq_qlength(xemacliteif->send_q)) {  	/* send backlog */
-			_unbuffered_low_level_output(instance, (struct pbuf *)pq_dequeue(xemacliteif->send_q));
-		} else { 				/* send current */
-			_unbuffered_low_level_output(instance, p);
-			SYS_ARCH_UNPROTECT(lev);
-			return ERR_OK;
-		}
+	/* send the backlog first to keep the frames in order */
+	xemacliteif_send_backlog(xemacliteif);
+
+	/* check if space is available to send current */
+	if (pq_qlength(xemacliteif->send_q) == 0 &&
+			XEmacLite_TxBufferAvailable(instance) == TRUE) {
+		_unbuffered_low_level_output(instance, p);
+		SYS_ARCH_UNPROTECT(lev);
+		return ERR_OK;
 	}
 
 	/* if we cannot send the packet immediately, then make a copy of the whole packet
@@ -367,7 +401,6 @@ static void
 xemacif_send_handler(void *arg) {
 	struct xemac_s *xemac = (struct xemac_s *)(arg);
 	xemacliteif_s *xemacliteif = (xemacliteif_s *)(xemac->state);
-	XEmacLite *instance = xemacliteif->instance;
 	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
 
 #ifdef OS_IS_FREERTOS
@@ -378,11 +411,7 @@ xemacif_send_handler(void *arg) {
 	XIntc_AckIntr(xtopologyp->intc_baseaddr, 1 << xtopologyp->intc_emac_intr);
 #endif
 
-	if (pq_qlength(xemacliteif->send_q) && (XEmacLite_TxBufferAvailable(instance) == TRUE)) {
-		struct pbuf *p = pq_dequeue(xemacliteif->send_q);
-		_unbuffered_low_level_output(instance, p);
-		pbuf_free(p);
-	}
+	xemacliteif_send_backlog(xemacliteif);
 #ifdef OS_IS_FREERTOS
 	xInsideISR--;
 #endif
@@ -157,6 +157,8 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 	/* check if space is available to send */
     freecnt = is_tx_space_available(xemacpsif);
     if (freecnt <= 5) {
+		/* BDs of an open TX batch can only complete once committed */
+		emacps_sgsend_flush(xemacpsif);
 	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
 		process_sent_bds(xemacpsif, txring);
 	}
@@ -176,6 +178,7 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 	return err;
 }
 
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET == 0
 /*
  * low_level_input():
  *
@@ -189,6 +192,10 @@ static struct pbuf * low_level_input(struct netif *netif)
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	struct pbuf *p;
 
+	/* frames from the RX priority queue are served first */
+	if ((xemacpsif->recv_q1 != NULL) && (pq_qlength(xemacpsif->recv_q1) != 0))
+		return (struct pbuf *)pq_dequeue(xemacpsif->recv_q1);
+
 	/* see if there is data to process */
 	if (pq_qlength(xemacpsif->recv_q) == 0)
 		return NULL;
@@ -197,6 +204,7 @@ static struct pbuf * low_level_input(struct netif *netif)
 	p = (struct pbuf *)pq_dequeue(xemacpsif->recv_q);
 	return p;
 }
+#endif
 
 /*
  * xemacpsif_output():
@@ -214,6 +222,51 @@ static err_t xemacpsif_output(struct netif *netif, struct pbuf *p,
 	return etharp_output(netif, p, ipaddr);
 }
 
+/*
+ * xemacpsif_deliver():
+ *
+ * Hands one received frame over to the TCP/IP stack, or drops it if the
+ * frame type is not handled.
+ *
+ */
+
+static void xemacpsif_deliver(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *ethhdr;
+
+	/* points to packet payload, which starts with an Ethernet header */
+	ethhdr = p->payload;
+
+#if LINK_STATS
+	lwip_stats.link.recv++;
+#endif /* LINK_STATS */
+
+	switch (htons(ethhdr->type)) {
+		/* IP or ARP packet? */
+		case ETHTYPE_IP:
+		case ETHTYPE_ARP:
+#if LWIP_IPV6
+		/*IPv6 Packet?*/
+		case ETHTYPE_IPV6:
+#endif
+#if PPPOE_SUPPORT
+			/* PPPoE packet? */
+		case ETHTYPE_PPPOEDISC:
+		case ETHTYPE_PPPOE:
+#endif /* PPPOE_SUPPORT */
+			/* full packet send to tcpip_thread to process */
+			if (netif->input(p, netif) != ERR_OK) {
+				LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_input: IP input error\r\n"));
+				pbuf_free(p);
+			}
+			break;
+
+		default:
+			pbuf_free(p);
+			break;
+	}
+}
+
 /*
  * xemacpsif_input():
  *
@@ -225,11 +278,59 @@ static err_t xemacpsif_output(struct netif *netif, struct pbuf *p,
  * Returns the number of packets read (max 1 packet on success,
  * 0 if there are no packets)
  *
+ * When XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET is non-zero, frames are taken
+ * directly from the RxBD ring, up to the budget at a time, and the number
+ * of frames processed is returned.
+ *
  */
 
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET > 0
+s32_t xemacpsif_input(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	struct pbuf *pbufs[XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET];
+	struct pbuf *p;
+	s32_t n_total = 0;
+	s32_t n, i;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+#ifdef OS_IS_FREERTOS
+	while (1)
+#endif
+	{
+		/* frames from the RX priority queue are served first */
+		if (xemacpsif->recv_q1 != NULL) {
+			while (1) {
+				SYS_ARCH_PROTECT(lev);
+				p = (struct pbuf *)pq_dequeue(xemacpsif->recv_q1);
+				SYS_ARCH_UNPROTECT(lev);
+				if (p == NULL) {
+					break;
+				}
+				xemacpsif_deliver(netif, p);
+				n_total++;
+			}
+		}
+
+		n = emacps_rx_poll(xemacpsif, pbufs,
+					XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET);
+		for (i = 0; i < n; i++) {
+			xemacpsif_deliver(netif, pbufs[i]);
+		}
+		n_total += n;
+#ifdef OS_IS_FREERTOS
+		if (n < XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET) {
+			break;
+		}
+#endif
+	}
+
+	return n_total;
+}
+#else
 s32_t xemacpsif_input(struct netif *netif)
 {
-	struct eth_hdr *ethhdr;
 	struct pbuf *p;
 	SYS_ARCH_DECL_PROTECT(lev);
 
@@ -247,43 +348,12 @@ s32_t xemacpsif_input(struct netif *netif)
 			return 0;
 		}
 
-		/* points to packet payload, which starts with an Ethernet header */
-		ethhdr = p->payload;
-
-	#if LINK_STATS
-		lwip_stats.link.recv++;
-	#endif /* LINK_STATS */
-
-		switch (htons(ethhdr->type)) {
-			/* IP or ARP packet? */
-			case ETHTYPE_IP:
-			case ETHTYPE_ARP:
-	#if LWIP_IPV6
-			/*IPv6 Packet?*/
-			case ETHTYPE_IPV6:
-	#endif
-	#if PPPOE_SUPPORT
-				/* PPPoE packet? */
-			case ETHTYPE_PPPOEDISC:
-			case ETHTYPE_PPPOE:
-	#endif /* PPPOE_SUPPORT */
-				/* full packet send to tcpip_thread to process */
-				if (netif->input(p, netif) != ERR_OK) {
-					LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_input: IP input error\r\n"));
-					pbuf_free(p);
-					p = NULL;
-				}
-				break;
-
-			default:
-				pbuf_free(p);
-				p = NULL;
-				break;
-		}
+		xemacpsif_deliver(netif, p);
 	}
 
 	return 1;
 }
+#endif
 
 
 #if defined(OS_IS_FREERTOS) && defined(__arm__) && !defined(ARMR5)
@@ -329,9 +399,32 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_emacps;
 
 	xemacpsif->send_q = NULL;
+	xemacpsif->rx_bdspace = NULL;
+	xemacpsif->tx_bdspace = NULL;
+	xemacpsif->rx_poll_scheduled = 0;
+	xemacpsif->tx_batch_active = 0;
+	xemacpsif->tx_batch_bdcnt = 0;
+	xemacpsif->tx_batch_bdset = NULL;
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	xemacpsif->rx_pool = NULL;
+#endif
+	xemacpsif->rx_q1_active = 0;
+	xemacpsif->rx_q1_n_udp = 0;
+	xemacpsif->rx_q1_n_ethtype = 0;
+#if XLWIP_PTP_TIMESTAMP
+	xemacpsif->netif = netif;
+	xemacpsif->tx_ts_handler = NULL;
+#endif
 	xemacpsif->recv_q = pq_create_queue();
 	if (!xemacpsif->recv_q)
 		return ERR_MEM;
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	xemacpsif->recv_q1 = pq_create_queue();
+	if (!xemacpsif->recv_q1)
+		return ERR_MEM;
+#else
+	xemacpsif->recv_q1 = NULL;
+#endif
 
 	/* maximum transfer unit */
 #ifdef ZYNQMP_USE_JUMBO
@@ -359,6 +452,14 @@ static err_t low_level_init(struct netif *netif)
 	netif->flags |= NETIF_FLAG_IGMP;
 #endif
 
+#if LWIP_CHECKSUM_CTRL_PER_NETIF
+	/* IP/TCP/UDP checksums are generated and checked by the GEM */
+	NETIF_SET_CHECKSUM_CTRL(netif, NETIF_CHECKSUM_ENABLE_ALL &
+			~(NETIF_CHECKSUM_GEN_IP | NETIF_CHECKSUM_GEN_UDP |
+			NETIF_CHECKSUM_GEN_TCP | NETIF_CHECKSUM_CHECK_IP |
+			NETIF_CHECKSUM_CHECK_UDP | NETIF_CHECKSUM_CHECK_TCP));
+#endif
+
 #if !NO_SYS
 	sys_sem_new(&xemac->sem_rx_data_available, 0);
 #endif
@@ -753,3 +854,124 @@ void xemacpsif_resetrx_on_no_rxdata(struct netif *netif)
 
 	resetrx_on_no_rxdata(xemacpsif);
 }
+
+/*
+ * xemacpsif_tx_batch_begin():
+ *
+ * Opens a TX batch on the interface. Frames passed to the link output by
+ * lwIP are placed on TxBDs but are not handed over to the controller until
+ * xemacpsif_tx_batch_end() is called. This allows an application that sends
+ * a burst of packets (for example a UDP stream) to pay for the BD ring
+ * commit, the barrier and the transmit start only once per burst.
+ *
+ */
+
+void xemacpsif_tx_batch_begin(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	xemacpsif->tx_batch_active = 1;
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * xemacpsif_tx_batch_end():
+ *
+ * Closes the TX batch opened by xemacpsif_tx_batch_begin() and transmits
+ * all frames queued since then with a single transmit start.
+ *
+ */
+
+void xemacpsif_tx_batch_end(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	xemacpsif->tx_batch_active = 0;
+	if (emacps_sgsend_flush(xemacpsif) != XST_SUCCESS) {
+#if LINK_STATS
+		lwip_stats.link.drop++;
+#endif
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * xemacpsif_set_rx_priority_ethtype():
+ *
+ * Steers received frames of the given ethertype to RX priority queue 1.
+ * These frames are handed to the stack ahead of all other received frames.
+ * Returns 0 on success, or -1 if the priority queue is not in use or all
+ * ethertype screeners are taken.
+ *
+ */
+
+s32_t xemacpsif_set_rx_priority_ethtype(struct netif *netif, u16_t ethtype)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	u8 index;
+
+	if ((xemacpsif->rx_q1_active == 0) ||
+		(xemacpsif->rx_q1_n_ethtype >= XEMACPS_MAX_SCREEN_ETHTYPE)) {
+		return -1;
+	}
+	index = (u8)xemacpsif->rx_q1_n_ethtype++;
+
+	XEmacPs_SetScreenerEthType(&xemacpsif->emacps, index, ethtype);
+	XEmacPs_SetType2Screener(&xemacpsif->emacps, index, 1,
+			XEMACPS_SCREEN_T2_ETH_EN_MASK, 0, index);
+	return 0;
+}
+
+/*
+ * xemacpsif_set_rx_priority_udp_port():
+ *
+ * Steers received UDP datagrams for the given destination port to RX
+ * priority queue 1. Returns 0 on success, or -1 if the priority queue is
+ * not in use or all UDP port screeners are taken.
+ *
+ */
+
+s32_t xemacpsif_set_rx_priority_udp_port(struct netif *netif, u16_t port)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	u8 index;
+
+	if ((xemacpsif->rx_q1_active == 0) ||
+		(xemacpsif->rx_q1_n_udp >= XEMACPS_MAX_SCREEN_T1)) {
+		return -1;
+	}
+	index = (u8)xemacpsif->rx_q1_n_udp++;
+
+	XEmacPs_SetType1Screener(&xemacpsif->emacps, index, 1,
+			XEMACPS_SCREEN_T1_UDP_EN_MASK, 0, port);
+	return 0;
+}
+
+#if XLWIP_PTP_TIMESTAMP
+/*
+ * xemacpsif_set_tx_timestamp_handler():
+ *
+ * Registers the function that is handed each transmitted frame for which
+ * the GEM reported a TSU timestamp (PBUF_FLAG_TIMESTAMP set, ts_sec and
+ * ts_nsec valid). The handler runs in the TX complete interrupt and must
+ * pbuf_ref() the frame if it keeps it. Pass NULL to unregister.
+ *
+ */
+
+void xemacpsif_set_tx_timestamp_handler(struct netif *netif,
+		xemacpsif_tx_ts_handler_t handler)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+
+	xemacpsif->tx_ts_handler = handler;
+}
+#endif
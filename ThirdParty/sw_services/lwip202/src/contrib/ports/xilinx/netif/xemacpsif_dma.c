@@ -34,6 +34,9 @@
 #include "lwip/stats.h"
 #include "lwip/sys.h"
 #include "lwip/inet_chksum.h"
+#include "lwip/prot/ip.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/udp.h"
 
 #include "netif/xadapter.h"
 #include "netif/xemacpsif.h"
@@ -44,6 +47,7 @@
 #include "xparameters_ps.h"
 #include "xil_exception.h"
 #include "xil_mmu.h"
+#include "xil_arena.h"
 #if defined (ARMR5)
 #include "xreg_cortexr5.h"
 #endif
@@ -66,6 +70,9 @@
 /* A max of 4 different ethernet interfaces are supported */
 static UINTPTR tx_pbufs_storage[4*XLWIP_CONFIG_N_TX_DESC];
 static UINTPTR rx_pbufs_storage[4*XLWIP_CONFIG_N_RX_DESC];
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+static UINTPTR rx_q1_pbufs_storage[4*XLWIP_CONFIG_N_RX_DESC_Q1];
+#endif
 
 static s32_t emac_intr_num;
 
@@ -108,8 +115,27 @@ static s32_t emac_intr_num;
  * BDs for each BD chain which is more than enough for any application.
  * Assuming that both emac0 and emac1 are present, 256 KB of memory is allocated
  * for BDs. The rest 768 KB of memory is just unused.
+ *
+ * When the standalone BSP provides a non-cacheable dma arena (dma_arena_size
+ * parameter), the BD rings are instead taken from that arena and sized for the
+ * configured number of BDs, and bd_space is not reserved.
  *********************************************************************************/
 
+#if XIL_ARENA_DMA_SIZE > 0U
+#define EMACPS_RING_BYTES(n) \
+	((XEmacPs_BdRingMemCalc(BD_ALIGNMENT, (n)) + BD_ALIGNMENT - 1) & \
+	~(BD_ALIGNMENT - 1))
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+#define EMACPS_N_RX_TERMINATE_DESC XLWIP_CONFIG_N_RX_DESC_Q1
+#else
+#define EMACPS_N_RX_TERMINATE_DESC 1
+#endif
+/* RX ring, TX ring, RX terminate (or queue 1) ring and TX terminate BD */
+#define EMACPS_BD_SPACE_BYTES \
+	(EMACPS_RING_BYTES(XLWIP_CONFIG_N_RX_DESC) + \
+	EMACPS_RING_BYTES(XLWIP_CONFIG_N_TX_DESC) + \
+	EMACPS_RING_BYTES(EMACPS_N_RX_TERMINATE_DESC) + EMACPS_RING_BYTES(1))
+#else
 #if defined __aarch64__
 u8_t bd_space[0x200000] __attribute__ ((aligned (0x200000)));
 #else
@@ -117,6 +143,7 @@ u8_t bd_space[0x100000] __attribute__ ((aligned (0x100000)));
 #endif
 static volatile u32_t bd_space_index = 0;
 static volatile u32_t bd_space_attr_set = 0;
+#endif
 
 #ifdef OS_IS_FREERTOS
 long xInsideISR = 0;
@@ -125,6 +152,242 @@ long xInsideISR = 0;
 #define XEMACPS_BD_TO_INDEX(ringptr, bdptr)				\
 	(((UINTPTR)bdptr - (UINTPTR)(ringptr)->BaseBdAddr) / (ringptr)->Separation)
 
+#ifdef ZYNQMP_USE_JUMBO
+#define XEMACPS_RX_BUF_SIZE	MAX_FRAME_SIZE_JUMBO
+#else
+#define XEMACPS_RX_BUF_SIZE	XEMACPS_MAX_FRAME_SIZE
+#endif
+
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "The GEM RX pbuf pool requires LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+/******************************************************************************
+ * RX pbuf pool
+ *
+ * When XLWIP_CONFIG_EMACPS_RX_PBUF_POOL is set, RX BDs are not refilled from
+ * the lwIP PBUF_POOL. Instead every GEM instance owns a preallocated set of
+ * custom pbufs (PBUF_REF) whose payload buffers are cache line aligned and a
+ * multiple of the cache line size long. When lwIP drops the last reference to
+ * such a pbuf, the custom free function puts it back on the pool free list
+ * and immediately hands it back to the RxBD ring. The heap/pool allocator is
+ * thus taken off the per-packet path.
+ *
+ * As the buffers never share a cache line with anything else, only the part
+ * of the buffer that was actually handed over to the stack (the received
+ * frame length) has to be invalidated when a buffer is recycled.
+ *********************************************************************************/
+
+#define RX_POOL_BUF_ALIGN	64
+#define RX_POOL_BUF_STRIDE	((XEMACPS_RX_BUF_SIZE + RX_POOL_BUF_ALIGN - 1) & \
+					~(RX_POOL_BUF_ALIGN - 1))
+
+/* Number of pool buffers per GEM, must be larger than the number of RxBDs */
+#ifndef XLWIP_CONFIG_EMACPS_RX_POOL_NBUFS
+#define XLWIP_CONFIG_EMACPS_RX_POOL_NBUFS	(2 * (XLWIP_CONFIG_N_RX_DESC + \
+						XLWIP_CONFIG_N_RX_DESC_Q1))
+#endif
+
+typedef struct rx_pool_pbuf {
+	struct pbuf_custom pc;		/* must be the first member */
+	struct rx_pool_pbuf *next;
+	struct rx_pool *pool;
+	u8_t *buf;
+	u32_t dirty_len;		/* bytes to invalidate on recycle */
+} rx_pool_pbuf_t;
+
+typedef struct rx_pool {
+	rx_pool_pbuf_t pbufs[XLWIP_CONFIG_EMACPS_RX_POOL_NBUFS];
+	rx_pool_pbuf_t *free_list;
+	xemacpsif_s *xemacpsif;
+	u8_t armed;			/* recycle straight into the RxBD ring */
+	u8_t refilling;
+} rx_pool_t;
+
+static rx_pool_t rx_pools[XPAR_XEMACPS_NUM_INSTANCES];
+static u8_t rx_pool_space[XPAR_XEMACPS_NUM_INSTANCES]
+			[XLWIP_CONFIG_EMACPS_RX_POOL_NBUFS][RX_POOL_BUF_STRIDE]
+			__attribute__ ((aligned (RX_POOL_BUF_ALIGN)));
+static u32_t rx_pools_used = 0;
+
+static void rx_pool_pbuf_free(struct pbuf *p)
+{
+	rx_pool_pbuf_t *entry = (rx_pool_pbuf_t *)p;
+	rx_pool_t *pool = entry->pool;
+	xemacpsif_s *xemacpsif = pool->xemacpsif;
+	u32_t lev;
+
+	lev = mfcpsr();
+	mtcpsr(lev | 0x000000C0);
+
+	entry->next = pool->free_list;
+	pool->free_list = entry;
+
+	/* Recycle the buffer straight into the RxBD ring */
+	if ((pool->armed != 0) && (pool->refilling == 0)) {
+		setup_rx_bds(xemacpsif, &XEmacPs_GetRxRing(&xemacpsif->emacps));
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+		if (xemacpsif->rx_q1_active != 0) {
+			setup_rx_bds(xemacpsif,
+				&XEmacPs_GetRxQ1Ring(&xemacpsif->emacps));
+		}
+#endif
+	}
+
+	mtcpsr(lev);
+}
+
+static rx_pool_t *rx_pool_init(xemacpsif_s *xemacpsif)
+{
+	rx_pool_t *pool;
+	rx_pool_pbuf_t *entry;
+	u32_t slot;
+	s32_t i;
+
+	if (xemacpsif->rx_pool != NULL) {
+		return (rx_pool_t *)xemacpsif->rx_pool;
+	}
+	if (rx_pools_used >= XPAR_XEMACPS_NUM_INSTANCES) {
+		return NULL;
+	}
+	slot = rx_pools_used++;
+	pool = &rx_pools[slot];
+	pool->xemacpsif = xemacpsif;
+	pool->free_list = NULL;
+	pool->armed = 0;
+	pool->refilling = 0;
+
+	for (i = XLWIP_CONFIG_EMACPS_RX_POOL_NBUFS - 1; i >= 0; i--) {
+		entry = &pool->pbufs[i];
+		entry->pc.custom_free_function = rx_pool_pbuf_free;
+		entry->pool = pool;
+		entry->buf = rx_pool_space[slot][i];
+		entry->dirty_len = RX_POOL_BUF_STRIDE;
+		entry->next = pool->free_list;
+		pool->free_list = entry;
+	}
+	xemacpsif->rx_pool = (void *)pool;
+
+	return pool;
+}
+
+static struct pbuf *rx_pool_alloc(xemacpsif_s *xemacpsif)
+{
+	rx_pool_t *pool = (rx_pool_t *)xemacpsif->rx_pool;
+	rx_pool_pbuf_t *entry;
+
+	entry = pool->free_list;
+	if (entry == NULL) {
+		return NULL;
+	}
+	pool->free_list = entry->next;
+	entry->next = NULL;
+
+	return pbuf_alloced_custom(PBUF_RAW, XEMACPS_RX_BUF_SIZE, PBUF_REF,
+			&entry->pc, entry->buf, RX_POOL_BUF_STRIDE);
+}
+#endif
+
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1 || LWIP_CHECKSUM_CTRL_PER_NETIF
+/*
+ * With RX checksum offload enabled the GEM discards frames with a bad IP,
+ * TCP or UDP checksum and reports in the RxBD which checksums it has
+ * verified. lwIP does not check the checksums of frames received on this
+ * interface, so IPv4 frames that the GEM could not fully verify (for
+ * example because it did not recognize the encapsulation) are checked here.
+ * Returns 0 if the frame has to be dropped.
+ */
+static s32_t emacps_rx_csum_ok(struct pbuf *p, u32_t bdstatus)
+{
+	struct eth_hdr *ethhdr;
+	struct ip_hdr *iphdr;
+	ip4_addr_t src, dest;
+	u16_t iphdr_hlen, iphdr_len;
+	u16_t chksum;
+	u8_t proto;
+	u32_t csum = bdstatus & XEMACPS_RXBUF_CSUM_MASK;
+	const u16_t hwhdr_len = SIZEOF_ETH_HDR - ETH_PAD_SIZE;
+
+	if ((csum == XEMACPS_RXBUF_CSUM_IP_TCP) ||
+			(csum == XEMACPS_RXBUF_CSUM_IP_UDP)) {
+		return 1;
+	}
+	if (p->len < (hwhdr_len + IP_HLEN)) {
+		return 1;
+	}
+	ethhdr = (struct eth_hdr *)p->payload;
+	if (ethhdr->type != PP_HTONS(ETHTYPE_IP)) {
+		return 1;
+	}
+	iphdr = (struct ip_hdr *)((u8_t *)p->payload + hwhdr_len);
+	iphdr_hlen = IPH_HL(iphdr) * 4;
+	iphdr_len = lwip_ntohs(IPH_LEN(iphdr));
+	if ((iphdr_hlen < IP_HLEN) || (p->len < (hwhdr_len + iphdr_hlen)) ||
+			(p->tot_len < (hwhdr_len + iphdr_len)) ||
+			(iphdr_len < iphdr_hlen)) {
+		/* malformed, left to ip4_input to discard */
+		return 1;
+	}
+	if ((csum == XEMACPS_RXBUF_CSUM_NONE) &&
+			(inet_chksum(iphdr, iphdr_hlen) != 0)) {
+		return 0;
+	}
+
+	/* TCP/UDP checksums of fragments can only be checked after reassembly */
+	proto = IPH_PROTO(iphdr);
+	if (((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0) ||
+			((proto != IP_PROTO_TCP) && (proto != IP_PROTO_UDP))) {
+		return 1;
+	}
+
+	/* strip Ethernet padding, ip4_input would do the same */
+	pbuf_realloc(p, hwhdr_len + iphdr_len);
+	ip4_addr_copy(src, iphdr->src);
+	ip4_addr_copy(dest, iphdr->dest);
+	pbuf_header(p, -(s16_t)(hwhdr_len + iphdr_hlen));
+	if ((proto == IP_PROTO_UDP) && (p->len >= 8) &&
+			(((struct udp_hdr *)p->payload)->chksum == 0)) {
+		/* UDP checksum not used by the sender */
+		chksum = 0;
+	} else {
+		chksum = inet_chksum_pseudo(p, proto, iphdr_len - iphdr_hlen,
+						&src, &dest);
+	}
+	pbuf_header(p, (s16_t)(hwhdr_len + iphdr_hlen));
+
+	return (chksum == 0);
+}
+#else
+#define emacps_rx_csum_ok(p, bdstatus)	1
+#endif
+
+/*
+ * Get a pbuf to be attached to an RxBD and make its payload visible to the
+ * DMA engine.
+ */
+static struct pbuf *alloc_rx_pbuf(xemacpsif_s *xemacpsif)
+{
+	struct pbuf *p;
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	rx_pool_pbuf_t *entry;
+
+	p = rx_pool_alloc(xemacpsif);
+	if ((p != NULL) && (xemacpsif->emacps.Config.IsCacheCoherent == 0)) {
+		entry = (rx_pool_pbuf_t *)p;
+		Xil_DCacheInvalidateRange((UINTPTR)entry->buf,
+					(UINTPTR)entry->dirty_len);
+	}
+#else
+	p = pbuf_alloc(PBUF_RAW, XEMACPS_RX_BUF_SIZE, PBUF_POOL);
+	if ((p != NULL) && (xemacpsif->emacps.Config.IsCacheCoherent == 0)) {
+		Xil_DCacheInvalidateRange((UINTPTR)p->payload,
+					(UINTPTR)XEMACPS_RX_BUF_SIZE);
+	}
+#endif
+	return p;
+}
+
 
 s32_t is_tx_space_available(xemacpsif_s *emac)
 {
@@ -193,6 +456,43 @@ u32_t get_base_index_rxpbufsstorage (xemacpsif_s *xemacpsif)
 	return index;
 }
 
+/*
+ * Returns the pbuf storage backing the given RxBD ring, indexed by BD.
+ */
+static inline
+UINTPTR *get_rx_ring_storage(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
+{
+	u32_t index;
+
+	index = get_base_index_rxpbufsstorage (xemacpsif);
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	if (rxring == &XEmacPs_GetRxQ1Ring(&xemacpsif->emacps)) {
+		index = (index / XLWIP_CONFIG_N_RX_DESC) * XLWIP_CONFIG_N_RX_DESC_Q1;
+		return &rx_q1_pbufs_storage[index];
+	}
+#else
+	(void)rxring;
+#endif
+	return &rx_pbufs_storage[index];
+}
+
+#if XLWIP_PTP_TIMESTAMP
+/*
+ * Copies the TSU timestamp the GEM wrote back into the given BD to the
+ * pbuf, if the BD carries one.
+ */
+static void emacps_bd_to_pbuf_ts(xemacpsif_s *xemacpsif, XEmacPs_Bd *bd,
+				struct pbuf *p)
+{
+	XEmacPs_TsuTime ts;
+
+	XEmacPs_BdGetTimestamp(&xemacpsif->emacps, bd, &ts);
+	p->ts_sec = (u32_t)ts.Seconds;
+	p->ts_nsec = ts.NanoSeconds;
+	p->flags |= PBUF_FLAG_TIMESTAMP;
+}
+#endif
+
 void process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 {
 	XEmacPs_Bd *txbdset;
@@ -204,6 +504,10 @@ void process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 	struct pbuf *p;
 	u32 *temp;
 	u32_t index;
+#if XLWIP_PTP_TIMESTAMP
+	struct pbuf *head = NULL;
+	u32_t ctrl;
+#endif
 
 	index = get_base_index_txpbufsstorage (xemacpsif);
 
@@ -219,6 +523,9 @@ void process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 		curbdpntr = txbdset;
 		while (n_pbufs_freed > 0) {
 			bdindex = XEMACPS_BD_TO_INDEX(txring, curbdpntr);
+#if XLWIP_PTP_TIMESTAMP
+			ctrl = XEmacPs_BdRead(curbdpntr, XEMACPS_BD_STAT_OFFSET);
+#endif
 			temp = (u32 *)curbdpntr;
 			*temp = 0;
 			temp++;
@@ -229,6 +536,33 @@ void process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 			}
 			dsb();
 			p = (struct pbuf *)tx_pbufs_storage[index + bdindex];
+#if XLWIP_PTP_TIMESTAMP
+			/*
+			 * The GEM writes the TX timestamp into the last BD of a
+			 * frame. Hold on to the first pbuf of the frame until then,
+			 * so that the timestamp can be attached to it.
+			 */
+			if ((head == NULL) && (p != NULL)) {
+				head = p;
+				p = NULL;
+			}
+			if ((ctrl & XEMACPS_TXBUF_LAST_MASK) != 0U) {
+				if (p != NULL) {
+					pbuf_free(p);
+					p = NULL;
+				}
+				if (head != NULL) {
+					if ((ctrl & XEMACPS_TXBUF_TS_MASK) != 0U) {
+						emacps_bd_to_pbuf_ts(xemacpsif, curbdpntr, head);
+						if (xemacpsif->tx_ts_handler != NULL) {
+							xemacpsif->tx_ts_handler(xemacpsif->netif, head);
+						}
+					}
+					p = head;
+					head = NULL;
+				}
+			}
+#endif
 			if (p != NULL) {
 				pbuf_free(p);
 			}
@@ -268,22 +602,25 @@ void emacps_send_handler(void *arg)
 #endif
 }
 
-XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
+/*
+ * Fill TxBDs for one pbuf chain without handing them over to the hardware
+ * bookkeeping and without ringing the transmit doorbell. The BDs are
+ * appended to the set of pending BDs of the current TX batch, which is
+ * committed by emacps_sgkick().
+ *
+ * This function must be called with interrupts off.
+ */
+static XStatus emacps_sgqueue(xemacpsif_s *xemacpsif, struct pbuf *p)
 {
 	struct pbuf *q;
 	s32_t n_pbufs;
 	XEmacPs_Bd *txbdset, *txbd, *last_txbd = NULL;
-	XEmacPs_Bd *temp_txbd;
-	XStatus status;
 	XEmacPs_BdRing *txring;
+	XStatus status;
 	u32_t bdindex;
-	u32_t lev;
 	u32_t index;
 	u32_t max_fr_size;
 
-	lev = mfcpsr();
-	mtcpsr(lev | 0x000000C0);
-
 	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
 
 	index = get_base_index_txpbufsstorage (xemacpsif);
@@ -295,7 +632,6 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	/* obtain as many BD's */
 	status = XEmacPs_BdRingAlloc(txring, n_pbufs, &txbdset);
 	if (status != XST_SUCCESS) {
-		mtcpsr(lev);
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating TxBD\r\n"));
 		return XST_FAILURE;
 	}
@@ -303,10 +639,15 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	for(q = p, txbd = txbdset; q != NULL; q = q->next) {
 		bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
 		if (tx_pbufs_storage[index + bdindex] != 0) {
-			mtcpsr(lev);
+			XEmacPs_BdRingUnAlloc(txring, n_pbufs, txbdset);
 			LWIP_DEBUGF(NETIF_DEBUG, ("PBUFS not available\r\n"));
 			return XST_FAILURE;
 		}
+		txbd = XEmacPs_BdRingNext(txring, txbd);
+	}
+
+	for(q = p, txbd = txbdset; q != NULL; q = q->next) {
+		bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
 
 		/* Send the data from the pbuf to the interface, one pbuf at a
 		   time. The size of the data in each pbuf is kept in the ->len
@@ -335,38 +676,96 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		txbd = XEmacPs_BdRingNext(txring, txbd);
 	}
 	XEmacPs_BdSetLast(last_txbd);
-	/* For fragmented packets, remember the 1st BD allocated for the 1st
-	   packet fragment. The used bit for this BD should be cleared at the end
-	   after clearing out used bits for other fragments. For packets without
-	   just remember the allocated BD. */
-	temp_txbd = txbdset;
-	txbd = txbdset;
-	txbd = XEmacPs_BdRingNext(txring, txbd);
-	q = p->next;
-	for(; q != NULL; q = q->next) {
+	/* For fragmented packets, the used bit of the 1st BD allocated for the
+	   1st packet fragment is cleared at the end, after clearing out used
+	   bits for the other fragments. A single barrier orders the fragment
+	   BDs before the 1st BD is released to the controller. */
+	txbd = XEmacPs_BdRingNext(txring, txbdset);
+	for(q = p->next; q != NULL; q = q->next) {
 		XEmacPs_BdClearTxUsed(txbd);
-		dsb();
 		txbd = XEmacPs_BdRingNext(txring, txbd);
 	}
-	XEmacPs_BdClearTxUsed(temp_txbd);
-	dsb();
+	dmb();
+	XEmacPs_BdClearTxUsed(txbdset);
+
+	if (xemacpsif->tx_batch_bdcnt == 0) {
+		xemacpsif->tx_batch_bdset = txbdset;
+	}
+	xemacpsif->tx_batch_bdcnt += n_pbufs;
+
+	return XST_SUCCESS;
+}
 
-	status = XEmacPs_BdRingToHw(txring, n_pbufs, txbdset);
+/*
+ * Commit all BDs queued by emacps_sgqueue() to the hardware with a single
+ * XEmacPs_BdRingToHw(), a single barrier and a single start of the
+ * transmitter.
+ *
+ * This function must be called with interrupts off.
+ */
+static XStatus emacps_sgkick(xemacpsif_s *xemacpsif)
+{
+	XEmacPs_BdRing *txring;
+	XStatus status;
+
+	if (xemacpsif->tx_batch_bdcnt == 0) {
+		return XST_SUCCESS;
+	}
+
+	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
+	status = XEmacPs_BdRingToHw(txring, xemacpsif->tx_batch_bdcnt,
+					xemacpsif->tx_batch_bdset);
+	xemacpsif->tx_batch_bdcnt = 0;
+	xemacpsif->tx_batch_bdset = NULL;
 	if (status != XST_SUCCESS) {
-		mtcpsr(lev);
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
 		return XST_FAILURE;
 	}
+	dsb();
+
 	/* Start transmit */
 	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
 	XEMACPS_NWCTRL_OFFSET,
 	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
 	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
 
+	return status;
+}
+
+XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
+{
+	XStatus status;
+	u32_t lev;
+
+	lev = mfcpsr();
+	mtcpsr(lev | 0x000000C0);
+
+	status = emacps_sgqueue(xemacpsif, p);
+	if ((status == XST_SUCCESS) && (xemacpsif->tx_batch_active == 0)) {
+		status = emacps_sgkick(xemacpsif);
+	}
+
 	mtcpsr(lev);
 	return status;
 }
 
+/*
+ * Hand over all TxBDs that were queued since the TX batch was opened and
+ * start the transmitter once. Returns XST_SUCCESS if nothing was pending.
+ */
+XStatus emacps_sgsend_flush(xemacpsif_s *xemacpsif)
+{
+	XStatus status;
+	u32_t lev;
+
+	lev = mfcpsr();
+	mtcpsr(lev | 0x000000C0);
+	status = emacps_sgkick(xemacpsif);
+	mtcpsr(lev);
+
+	return status;
+}
+
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 {
 	XEmacPs_Bd *rxbd;
@@ -375,19 +774,29 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 	u32_t freebds;
 	u32_t bdindex;
 	u32 *temp;
-	u32_t index;
+	UINTPTR *storage;
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	rx_pool_t *pool = (rx_pool_t *)xemacpsif->rx_pool;
 
-	index = get_base_index_rxpbufsstorage (xemacpsif);
+	/* Buffers released while refilling must not recurse into the ring */
+	pool->refilling = 1;
+#endif
+
+	storage = get_rx_ring_storage(xemacpsif, rxring);
 
 	freebds = XEmacPs_BdRingGetFreeCnt (rxring);
 	while (freebds > 0) {
 		freebds--;
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = alloc_rx_pbuf(xemacpsif);
 		if (!p) {
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+			/*
+			 * All pool buffers are in use by the stack. The ring
+			 * is refilled as soon as one of them is freed.
+			 */
+			pool->refilling = 0;
+			return;
+#endif
 #if LINK_STATS
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
@@ -399,6 +808,9 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 		if (status != XST_SUCCESS) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("setup_rx_bds: Error allocating RxBD\r\n"));
 			pbuf_free(p);
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+			pool->refilling = 0;
+#endif
 			return;
 		}
 		status = XEmacPs_BdRingToHw(rxring, 1, rxbd);
@@ -413,20 +825,14 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 
 			pbuf_free(p);
 			XEmacPs_BdRingUnAlloc(rxring, 1, rxbd);
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+			pool->refilling = 0;
+#endif
 			return;
 		}
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
-#else
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
-		}
-#endif
 		bdindex = XEMACPS_BD_TO_INDEX(rxring, rxbd);
 		temp = (u32 *)rxbd;
-		if (bdindex == (XLWIP_CONFIG_N_RX_DESC - 1)) {
+		if (bdindex == (rxring->AllCnt - 1)) {
 			*temp = 0x00000002;
 		} else {
 			*temp = 0;
@@ -436,47 +842,36 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 		dsb();
 
 		XEmacPs_BdSetAddressRx(rxbd, (UINTPTR)p->payload);
-		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
+		storage[bdindex] = (UINTPTR)p;
 	}
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	pool->refilling = 0;
+#endif
 }
 
-void emacps_recv_handler(void *arg)
+/*
+ * emacps_rx_drain():
+ *
+ * Takes all received frames off the given RxBD ring, stores them in the
+ * given receive queue and refills the ring.
+ *
+ */
+static void emacps_rx_drain(struct xemac_s *xemac, XEmacPs_BdRing *rxring,
+				pq_queue_t *q)
 {
 	struct pbuf *p;
 	XEmacPs_Bd *rxbdset, *curbdptr;
-	struct xemac_s *xemac;
-	xemacpsif_s *xemacpsif;
-	XEmacPs_BdRing *rxring;
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	volatile s32_t bd_processed;
 	s32_t rx_bytes, k;
 	u32_t bdindex;
-	u32_t regval;
-	u32_t index;
-	u32_t gigeversion;
+	UINTPTR *storage;
 
-	xemac = (struct xemac_s *)(arg);
-	xemacpsif = (xemacpsif_s *)(xemac->state);
-	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
-
-#ifdef OS_IS_FREERTOS
-	xInsideISR++;
-#endif
-
-	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
-	index = get_base_index_rxpbufsstorage (xemacpsif);
-	/*
-	 * If Reception done interrupt is asserted, call RX call back function
-	 * to handle the processed BDs and then raise the according flag.
-	 */
-	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
-	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
-	if (gigeversion <= 2) {
-			resetrx_on_no_rxdata(xemacpsif);
-	}
+	storage = get_rx_ring_storage(xemacpsif, rxring);
 
 	while(1) {
 
-		bd_processed = XEmacPs_BdRingFromHwRx(rxring, XLWIP_CONFIG_N_RX_DESC, &rxbdset);
+		bd_processed = XEmacPs_BdRingFromHwRx(rxring, rxring->AllCnt, &rxbdset);
 		if (bd_processed <= 0) {
 			break;
 		}
@@ -484,7 +879,7 @@ void emacps_recv_handler(void *arg)
 		for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
 
 			bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
-			p = (struct pbuf *)rx_pbufs_storage[index + bdindex];
+			p = (struct pbuf *)storage[bdindex];
 
 			/*
 			 * Adjust the buffer size to the actual number of bytes received.
@@ -495,11 +890,26 @@ void emacps_recv_handler(void *arg)
 			rx_bytes = XEmacPs_BdGetLength(curbdptr);
 #endif
 			pbuf_realloc(p, rx_bytes);
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+			((rx_pool_pbuf_t *)p)->dirty_len = rx_bytes;
+#endif
+#if XLWIP_PTP_TIMESTAMP
+			if (XEmacPs_BdIsRxTimestamp(curbdptr)) {
+				emacps_bd_to_pbuf_ts(xemacpsif, curbdptr, p);
+			}
+#endif
 
+			if (!emacps_rx_csum_ok(p, XEmacPs_BdRead(curbdptr,
+						XEMACPS_BD_STAT_OFFSET))) {
+#if LINK_STATS
+				lwip_stats.link.chkerr++;
+				lwip_stats.link.drop++;
+#endif
+				pbuf_free(p);
 			/* store it in the receive queue,
 			 * where it'll be processed by a different handler
 			 */
-			if (pq_enqueue(xemacpsif->recv_q, (void*)p) < 0) {
+			} else if (pq_enqueue(q, (void*)p) < 0) {
 #if LINK_STATS
 				lwip_stats.link.memerr++;
 				lwip_stats.link.drop++;
@@ -515,6 +925,53 @@ void emacps_recv_handler(void *arg)
 		sys_sem_signal(&xemac->sem_rx_data_available);
 #endif
 	}
+}
+
+void emacps_recv_handler(void *arg)
+{
+	struct xemac_s *xemac;
+	xemacpsif_s *xemacpsif;
+	XEmacPs_BdRing *rxring;
+	u32_t regval;
+	u32_t gigeversion;
+
+	xemac = (struct xemac_s *)(arg);
+	xemacpsif = (xemacpsif_s *)(xemac->state);
+	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
+
+#ifdef OS_IS_FREERTOS
+	xInsideISR++;
+#endif
+
+	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
+	/*
+	 * If Reception done interrupt is asserted, call RX call back function
+	 * to handle the processed BDs and then raise the according flag.
+	 */
+	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
+	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
+	if (gigeversion <= 2) {
+			resetrx_on_no_rxdata(xemacpsif);
+	}
+
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET > 0
+	/*
+	 * Interrupt/poll hybrid: mask further RX complete interrupts and let
+	 * xemacpsif_input drain the RxBD ring through emacps_rx_poll. The
+	 * interrupt is unmasked again once the ring has been found empty.
+	 */
+	XEmacPs_IntDisable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+	xemacpsif->rx_poll_scheduled = 1;
+#if !NO_SYS
+	sys_sem_signal(&xemac->sem_rx_data_available);
+#endif
+#ifdef OS_IS_FREERTOS
+	xInsideISR--;
+#endif
+	return;
+#endif
+
+	emacps_rx_drain(xemac, rxring, xemacpsif->recv_q);
 
 #ifdef OS_IS_FREERTOS
 	xInsideISR--;
@@ -522,6 +979,122 @@ void emacps_recv_handler(void *arg)
 	return;
 }
 
+/*
+ * emacps_recv_q1_handler():
+ *
+ * RX complete handler of receive priority queue 1. Frames steered to queue
+ * 1 by the screeners are stored in recv_q1, which xemacpsif_input serves
+ * ahead of recv_q.
+ *
+ */
+void emacps_recv_q1_handler(void *arg)
+{
+	struct xemac_s *xemac;
+	xemacpsif_s *xemacpsif;
+
+	xemac = (struct xemac_s *)(arg);
+	xemacpsif = (xemacpsif_s *)(xemac->state);
+
+#ifdef OS_IS_FREERTOS
+	xInsideISR++;
+#endif
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	if (xemacpsif->rx_q1_active != 0) {
+		emacps_rx_drain(xemac, &XEmacPs_GetRxQ1Ring(&xemacpsif->emacps),
+				xemacpsif->recv_q1);
+	}
+#else
+	(void)xemacpsif;
+#endif
+#ifdef OS_IS_FREERTOS
+	xInsideISR--;
+#endif
+}
+
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET > 0
+/*
+ * emacps_rx_poll():
+ *
+ * Takes up to budget received frames directly from the RxBD ring, stores
+ * them in pbufs[] and refills the ring. If fewer than budget frames were
+ * found, the ring is empty and the RX complete interrupt is unmasked again.
+ * Returns the number of frames stored in pbufs[].
+ *
+ */
+s32_t emacps_rx_poll(xemacpsif_s *xemacpsif, struct pbuf **pbufs, s32_t budget)
+{
+	struct pbuf *p;
+	XEmacPs_Bd *rxbdset, *curbdptr;
+	XEmacPs_BdRing *rxring;
+	s32_t bd_processed;
+	s32_t n_frames = 0;
+	s32_t rx_bytes, k;
+	u32_t bdindex;
+	UINTPTR *storage;
+	u32_t lev;
+
+	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
+	storage = get_rx_ring_storage(xemacpsif, rxring);
+
+	lev = mfcpsr();
+	mtcpsr(lev | 0x000000C0);
+
+	while (n_frames < budget) {
+		bd_processed = XEmacPs_BdRingFromHwRx(rxring, budget - n_frames,
+							&rxbdset);
+		if (bd_processed <= 0) {
+			break;
+		}
+
+		for (k = 0, curbdptr = rxbdset; k < bd_processed; k++) {
+			bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
+			p = (struct pbuf *)storage[bdindex];
+			storage[bdindex] = 0;
+
+#ifdef ZYNQMP_USE_JUMBO
+			rx_bytes = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr);
+#else
+			rx_bytes = XEmacPs_BdGetLength(curbdptr);
+#endif
+			pbuf_realloc(p, rx_bytes);
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+			((rx_pool_pbuf_t *)p)->dirty_len = rx_bytes;
+#endif
+#if XLWIP_PTP_TIMESTAMP
+			if (XEmacPs_BdIsRxTimestamp(curbdptr)) {
+				emacps_bd_to_pbuf_ts(xemacpsif, curbdptr, p);
+			}
+#endif
+			if (emacps_rx_csum_ok(p, XEmacPs_BdRead(curbdptr,
+						XEMACPS_BD_STAT_OFFSET))) {
+				pbufs[n_frames++] = p;
+			} else {
+#if LINK_STATS
+				lwip_stats.link.chkerr++;
+				lwip_stats.link.drop++;
+#endif
+				pbuf_free(p);
+			}
+			curbdptr = XEmacPs_BdRingNext(rxring, curbdptr);
+		}
+		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
+	}
+	setup_rx_bds(xemacpsif, rxring);
+
+	if (n_frames < budget) {
+		/*
+		 * Ring drained. A frame that completes after the last check
+		 * leaves its status pending, so the unmasked interrupt fires.
+		 */
+		xemacpsif->rx_poll_scheduled = 0;
+		XEmacPs_IntEnable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+	}
+
+	mtcpsr(lev);
+	return n_frames;
+}
+#endif
+
 void clean_dma_txdescs(struct xemac_s *xemac)
 {
 	XEmacPs_Bd bdtemplate;
@@ -530,6 +1103,10 @@ void clean_dma_txdescs(struct xemac_s *xemac)
 
 	txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
 
+	/* BDs of an open TX batch are dropped along with the ring */
+	xemacpsif->tx_batch_bdcnt = 0;
+	xemacpsif->tx_batch_bdset = NULL;
+
 	XEmacPs_BdClear(&bdtemplate);
 	XEmacPs_BdSetStatus(&bdtemplate, XEMACPS_TXBUF_USED_MASK);
 
@@ -557,6 +1134,9 @@ XStatus init_dma(struct xemac_s *xemac)
 	XEmacPs_Bd *bdtxterminate;
 	XEmacPs_Bd *bdrxterminate;
 	u32 *temp;
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	XEmacPs_BdRing *rxq1ringptr;
+#endif
 
 	/*
 	 * Disable L1 prefetch if the processor type is Cortex A53. It is
@@ -581,6 +1161,43 @@ XStatus init_dma(struct xemac_s *xemac)
 
 	index = get_base_index_rxpbufsstorage (xemacpsif);
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
+
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	if (rx_pool_init(xemacpsif) == NULL) {
+		xil_printf("%s@%d: Error: Unable to set up RX pbuf pool\r\n",
+				__FILE__, __LINE__);
+		return ERR_IF;
+	}
+#endif
+	rxringptr = &XEmacPs_GetRxRing(&xemacpsif->emacps);
+	txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
+	LWIP_DEBUGF(NETIF_DEBUG, ("rxringptr: 0x%08x\r\n", rxringptr));
+	LWIP_DEBUGF(NETIF_DEBUG, ("txringptr: 0x%08x\r\n", txringptr));
+
+#if XIL_ARENA_DMA_SIZE > 0U
+	/*
+	 * The BD rings are taken from the non-cacheable dma arena once and
+	 * reused when the MAC is initialized again after an error.
+	 */
+	if (xemacpsif->rx_bdspace == NULL) {
+		if (Xil_ArenaDma() != NULL) {
+			xemacpsif->rx_bdspace = Xil_ArenaAlloc(Xil_ArenaDma(),
+					EMACPS_BD_SPACE_BYTES, BD_ALIGNMENT);
+		}
+		if (xemacpsif->rx_bdspace == NULL) {
+			xil_printf("%s@%d: Error: dma arena too small for TX/RX buffer descriptors\r\n",
+					__FILE__, __LINE__);
+			return ERR_IF;
+		}
+	}
+	tempaddress = (UINTPTR)xemacpsif->rx_bdspace +
+			EMACPS_RING_BYTES(XLWIP_CONFIG_N_RX_DESC);
+	xemacpsif->tx_bdspace = (void *)tempaddress;
+	tempaddress += EMACPS_RING_BYTES(XLWIP_CONFIG_N_TX_DESC);
+	bdrxterminate = (XEmacPs_Bd *)tempaddress;
+	tempaddress += EMACPS_RING_BYTES(EMACPS_N_RX_TERMINATE_DESC);
+	bdtxterminate = (XEmacPs_Bd *)tempaddress;
+#else
 	/*
 	 * The BDs need to be allocated in uncached memory. Hence the 1 MB
 	 * address range allocated for Bd_Space is made uncached
@@ -601,11 +1218,6 @@ XStatus init_dma(struct xemac_s *xemac)
 		bd_space_attr_set = 1;
 	}
 
-	rxringptr = &XEmacPs_GetRxRing(&xemacpsif->emacps);
-	txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
-	LWIP_DEBUGF(NETIF_DEBUG, ("rxringptr: 0x%08x\r\n", rxringptr));
-	LWIP_DEBUGF(NETIF_DEBUG, ("txringptr: 0x%08x\r\n", txringptr));
-
 	/* Allocate 64k for Rx and Tx bds each to take care of extreme cases */
 	tempaddress = (UINTPTR)&(bd_space[bd_space_index]);
 	xemacpsif->rx_bdspace = (void *)tempaddress;
@@ -621,6 +1233,7 @@ XStatus init_dma(struct xemac_s *xemac)
 		bdtxterminate = (XEmacPs_Bd *)tempaddress;
 		bd_space_index += 0x10000;
 	}
+#endif
 
 	LWIP_DEBUGF(NETIF_DEBUG, ("rx_bdspace: %p \r\n", xemacpsif->rx_bdspace));
 	LWIP_DEBUGF(NETIF_DEBUG, ("tx_bdspace: %p \r\n", xemacpsif->tx_bdspace));
@@ -658,6 +1271,9 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
+	xemacpsif->tx_batch_bdcnt = 0;
+	xemacpsif->tx_batch_bdset = NULL;
+
 	XEmacPs_BdClear(&bdtemplate);
 	XEmacPs_BdSetStatus(&bdtemplate, XEMACPS_TXBUF_USED_MASK);
 	/*
@@ -681,11 +1297,7 @@ XStatus init_dma(struct xemac_s *xemac)
 	 * Allocate RX descriptors, 1 RxBD at a time.
 	 */
 	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = alloc_rx_pbuf(xemacpsif);
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
@@ -718,19 +1330,13 @@ XStatus init_dma(struct xemac_s *xemac)
 		temp++;
 		*temp = 0;
 		dsb();
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
-#else
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
-		}
-#endif
 		XEmacPs_BdSetAddressRx(rxbd, (UINTPTR)p->payload);
 
 		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
 	}
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	((rx_pool_t *)xemacpsif->rx_pool)->armed = 1;
+#endif
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
 	if (gigeversion > 2) {
 		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, 1, XEMACPS_SEND);
@@ -747,11 +1353,39 @@ XStatus init_dma(struct xemac_s *xemac)
 		 * the controller to malfunction by fetching the descriptors
 		 * from these queues.
 		 */
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+		/*
+		 * RX priority queue 1 gets a ring of its own in the space
+		 * otherwise used for the terminate BD.
+		 */
+		rxq1ringptr = &XEmacPs_GetRxQ1Ring(&xemacpsif->emacps);
+		XEmacPs_BdClear(&bdtemplate);
+		status = XEmacPs_BdRingCreate(rxq1ringptr, (UINTPTR)bdrxterminate,
+					(UINTPTR)bdrxterminate, BD_ALIGNMENT,
+					XLWIP_CONFIG_N_RX_DESC_Q1);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD Q1 space\r\n"));
+			return ERR_IF;
+		}
+		status = XEmacPs_BdRingClone(rxq1ringptr, &bdtemplate, XEMACPS_RECV);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error initializing RxBD Q1 space\r\n"));
+			return ERR_IF;
+		}
+		setup_rx_bds(xemacpsif, rxq1ringptr);
+		if (XEmacPs_BdRingGetFreeCnt(rxq1ringptr) != 0) {
+			printf("unable to alloc pbufs for RX Q1 in init_dma\r\n");
+			return ERR_IF;
+		}
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), rxq1ringptr->BaseBdAddr, 1, XEMACPS_RECV);
+		xemacpsif->rx_q1_active = 1;
+#else
 		XEmacPs_BdClear(bdrxterminate);
 		XEmacPs_BdSetAddressRx(bdrxterminate, (XEMACPS_RXBUF_NEW_MASK |
 						XEMACPS_RXBUF_WRAP_MASK));
 		XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_RXQ1BASE_OFFSET),
 				   (UINTPTR)bdrxterminate);
+#endif
 		XEmacPs_BdClear(bdtxterminate);
 		XEmacPs_BdSetStatus(bdtxterminate, (XEMACPS_TXBUF_USED_MASK |
 						XEMACPS_TXBUF_WRAP_MASK));
@@ -818,6 +1452,9 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 	s32_t index;
 	s32_t index1;
 	struct pbuf *p;
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	UINTPTR *storage;
+#endif
 
 	index1 = get_base_index_txpbufsstorage (xemacpsif);
 
@@ -829,11 +1466,47 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 		}
 	}
 
+#ifdef XLWIP_CONFIG_EMACPS_RX_PBUF_POOL
+	/* Pool buffers only go back to the free list until init_dma re-arms */
+	((rx_pool_t *)xemacpsif->rx_pool)->armed = 0;
+	index1 = get_base_index_rxpbufsstorage (xemacpsif);
+	for (index = index1; index < (index1 + XLWIP_CONFIG_N_RX_DESC); index++) {
+		p = (struct pbuf *)rx_pbufs_storage[index];
+		if (p != NULL) {
+			pbuf_free(p);
+			rx_pbufs_storage[index] = 0;
+		}
+	}
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	if (xemacpsif->rx_q1_active != 0) {
+		storage = get_rx_ring_storage(xemacpsif,
+				&XEmacPs_GetRxQ1Ring(&xemacpsif->emacps));
+		for (index = 0; index < XLWIP_CONFIG_N_RX_DESC_Q1; index++) {
+			p = (struct pbuf *)storage[index];
+			if (p != NULL) {
+				pbuf_free(p);
+				storage[index] = 0;
+			}
+		}
+	}
+#endif
+#else
 	for (index = index1; index < (index1 + XLWIP_CONFIG_N_TX_DESC); index++) {
 		p = (struct pbuf *)rx_pbufs_storage[index];
 		pbuf_free(p);
 
 	}
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	if (xemacpsif->rx_q1_active != 0) {
+		storage = get_rx_ring_storage(xemacpsif,
+				&XEmacPs_GetRxQ1Ring(&xemacpsif->emacps));
+		for (index = 0; index < XLWIP_CONFIG_N_RX_DESC_Q1; index++) {
+			p = (struct pbuf *)storage[index];
+			pbuf_free(p);
+		}
+	}
+#endif
+#endif
 }
 
 void free_onlytx_pbufs(xemacpsif_s *xemacpsif)
@@ -873,6 +1546,13 @@ void reset_dma(struct xemac_s *xemac)
 
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, txqueuenum, XEMACPS_SEND);
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	if (xemacpsif->rx_q1_active != 0) {
+		XEmacPs_BdRingPtrReset(&XEmacPs_GetRxQ1Ring(&xemacpsif->emacps),
+				(void *)xemacpsif->emacps.RxQ1BdRing.BaseBdAddr);
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxQ1BdRing.BaseBdAddr, 1, XEMACPS_RECV);
+	}
+#endif
 }
 
 void emac_disable_intr(void)
@@ -64,6 +64,28 @@ XEmacPs_Config *xemacps_lookup_config(unsigned mac_base)
 	return (cfgptr);
 }
 
+#if XLWIP_PTP_TIMESTAMP
+/*
+ * Returns the TSU clock frequency of the given GEM instance.
+ */
+static u32_t emacps_tsu_clk_freq(XEmacPs *xemacpsp)
+{
+#ifdef XPAR_XEMACPS_1_ENET_TSU_CLK_FREQ_HZ
+	if (xemacpsp->Config.BaseAddress == XPAR_XEMACPS_1_BASEADDR)
+		return XPAR_XEMACPS_1_ENET_TSU_CLK_FREQ_HZ;
+#endif
+#ifdef XPAR_XEMACPS_2_ENET_TSU_CLK_FREQ_HZ
+	if (xemacpsp->Config.BaseAddress == XPAR_XEMACPS_2_BASEADDR)
+		return XPAR_XEMACPS_2_ENET_TSU_CLK_FREQ_HZ;
+#endif
+#ifdef XPAR_XEMACPS_3_ENET_TSU_CLK_FREQ_HZ
+	if (xemacpsp->Config.BaseAddress == XPAR_XEMACPS_3_BASEADDR)
+		return XPAR_XEMACPS_3_ENET_TSU_CLK_FREQ_HZ;
+#endif
+	return XPAR_XEMACPS_0_ENET_TSU_CLK_FREQ_HZ;
+}
+#endif
+
 void init_emacps(xemacpsif_s *xemacps, struct netif *netif)
 {
 	XEmacPs *xemacpsp;
@@ -82,6 +104,19 @@ void init_emacps(xemacpsif_s *xemacps, struct netif *netif)
 	XEmacPs_SetOptions(xemacpsp, XEMACPS_MULTICAST_OPTION);
 #endif
 
+	/*
+	 * The GEM generates IP/TCP/UDP checksums on transmit and verifies them
+	 * on receive. lwIP leaves them to the hardware when full checksum
+	 * offload is configured, or per interface (see low_level_init) when
+	 * other MACs in the system require software checksums.
+	 */
+#if LWIP_FULL_CSUM_OFFLOAD_TX==1 || LWIP_CHECKSUM_CTRL_PER_NETIF
+	XEmacPs_SetOptions(xemacpsp, XEMACPS_TX_CHKSUM_ENABLE_OPTION);
+#endif
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1 || LWIP_CHECKSUM_CTRL_PER_NETIF
+	XEmacPs_SetOptions(xemacpsp, XEMACPS_RX_CHKSUM_ENABLE_OPTION);
+#endif
+
 	/* set mac address */
 	status = XEmacPs_SetMacAddress(xemacpsp, (void*)(netif->hwaddr), 1);
 	if (status != XST_SUCCESS) {
@@ -141,6 +176,18 @@ void init_emacps(xemacpsif_s *xemacps, struct netif *netif)
 		volatile s32_t wait;
 		for (wait=0; wait < 20000; wait++);
 	}
+
+#if XLWIP_PTP_TIMESTAMP
+	/* Start the TSU and timestamp PTP event frames in both directions */
+	status = XEmacPs_TsuInit(xemacpsp, emacps_tsu_clk_freq(xemacpsp));
+	if (status == XST_SUCCESS) {
+		status = XEmacPs_SetBdTsMode(xemacpsp, XEMACPS_TS_MODE_PTP_EVENT,
+				XEMACPS_TS_MODE_PTP_EVENT);
+	}
+	if (status != XST_SUCCESS) {
+		xil_printf("In %s:TSU timestamping setup failed...\r\n",__func__);
+	}
+#endif
 }
 
 void init_emacps_on_error (xemacpsif_s *xemacps, struct netif *netif)
@@ -181,6 +228,12 @@ void setup_isr (struct xemac_s *xemac)
 				    (void *) emacps_recv_handler,
 				    (void *) xemac);
 
+#if XLWIP_CONFIG_N_RX_DESC_Q1 > 0
+	XEmacPs_SetHandler(&xemacpsif->emacps, XEMACPS_HANDLER_DMARECVQ1,
+				    (void *) emacps_recv_q1_handler,
+				    (void *) xemac);
+#endif
+
 	XEmacPs_SetHandler(&xemacpsif->emacps, XEMACPS_HANDLER_ERROR,
 				    (void *) emacps_error_handler,
 				    (void *) xemac);
@@ -184,6 +184,10 @@
 #define PHY_TI_CRVAL	0x5048
 #define PHY_TI_CFG4RESVDBIT7	0x80
 
+/* Autonegotiation status is polled every 10 ms, for up to 30 seconds */
+#define PHY_AUTONEG_POLL_US			10000
+#define PHY_AUTONEG_TIMEOUT_POLLS	(30 * (1000000 / PHY_AUTONEG_POLL_US))
+
 /* Frequency setting */
 #define SLCR_LOCK_ADDR			(XPS_SYS_CTRL_BASEADDR + 0x4)
 #define SLCR_UNLOCK_ADDR		(XPS_SYS_CTRL_BASEADDR + 0x8)
@@ -275,7 +279,7 @@ static u32_t get_IEEE_phy_speed(XEmacPs *xemacpsp, u32_t phy_addr)
 
 	XEmacPs_PhyRead(xemacpsp, phy_addr, IEEE_STATUS_REG_OFFSET, &status);
 	while ( !(status & IEEE_STAT_AUTONEGOTIATE_COMPLETE) ) {
-		sleep(1);
+		usleep(PHY_AUTONEG_POLL_US);
 		XEmacPs_PhyRead(xemacpsp, phy_addr, IEEE_STATUS_REG_OFFSET,
 																&status);
 	}
@@ -533,10 +537,10 @@ static u32_t get_TI_phy_speed(XEmacPs *xemacpsp, u32_t phy_addr)
 	xil_printf("Waiting for PHY to complete autonegotiation.\r\n");
 
 	while ( !(status & IEEE_STAT_AUTONEGOTIATE_COMPLETE) ) {
-		sleep(1);
+		usleep(PHY_AUTONEG_POLL_US);
 		timeout_counter++;
 
-		if (timeout_counter == 30) {
+		if (timeout_counter == PHY_AUTONEG_TIMEOUT_POLLS) {
 			xil_printf("Auto negotiation error \r\n");
 			return XST_FAILURE;
 		}
@@ -616,12 +620,12 @@ static u32_t get_Marvell_phy_speed(XEmacPs *xemacpsp, u32_t phy_addr)
 	xil_printf("Waiting for PHY to complete autonegotiation.\r\n");
 
 	while ( !(status & IEEE_STAT_AUTONEGOTIATE_COMPLETE) ) {
-		sleep(1);
+		usleep(PHY_AUTONEG_POLL_US);
 		XEmacPs_PhyRead(xemacpsp, phy_addr,
 						IEEE_COPPER_SPECIFIC_STATUS_REG_2,  &temp);
 		timeout_counter++;
 
-		if (timeout_counter == 30) {
+		if (timeout_counter == PHY_AUTONEG_TIMEOUT_POLLS) {
 			xil_printf("Auto negotiation error \r\n");
 			return XST_FAILURE;
 		}
@@ -690,10 +694,10 @@ static u32_t get_Realtek_phy_speed(XEmacPs *xemacpsp, u32_t phy_addr)
 	xil_printf("Waiting for PHY to complete autonegotiation.\r\n");
 
 	while ( !(status & IEEE_STAT_AUTONEGOTIATE_COMPLETE) ) {
-		sleep(1);
+		usleep(PHY_AUTONEG_POLL_US);
 		timeout_counter++;
 
-		if (timeout_counter == 30) {
+		if (timeout_counter == PHY_AUTONEG_TIMEOUT_POLLS) {
 			xil_printf("Auto negotiation error \r\n");
 			return XST_FAILURE;
 		}
@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) 2001-2004 Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ * Author: Adam Dunkels <adam@sics.se>
+ *
+ */
+
+/*
+ * Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Xilinx, Inc.
+ * XILINX IS PROVIDING THIS DESIGN, CODE, OR INFORMATION "AS IS" AS A
+ * COURTESY TO YOU.  BY PROVIDING THIS DESIGN, CODE, OR INFORMATION AS
+ * ONE POSSIBLE   IMPLEMENTATION OF THIS FEATURE, APPLICATION OR
+ * STANDARD, XILINX IS MAKING NO REPRESENTATION THAT THIS IMPLEMENTATION
+ * IS FREE FROM ANY CLAIMS OF INFRINGEMENT, AND YOU ARE RESPONSIBLE
+ * FOR OBTAINING ANY RIGHTS YOU MAY REQUIRE FOR YOUR IMPLEMENTATION.
+ * XILINX EXPRESSLY DISCLAIMS ANY WARRANTY WHATSOEVER WITH RESPECT TO
+ * THE ADEQUACY OF THE IMPLEMENTATION, INCLUDING BUT NOT LIMITED TO
+ * ANY WARRANTIES OR REPRESENTATIONS THAT THIS IMPLEMENTATION IS FREE
+ * FROM CLAIMS OF INFRINGEMENT, IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <xparameters.h>
+
+#include "xlwipconfig.h"
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/mem.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "lwip/stats.h"
+#include "lwip/prot/ip4.h"
+
+#include "netif/etharp.h"
+#include "netif/xxvethernetif.h"
+#include "netif/xadapter.h"
+#include "netif/xpqueue.h"
+
+#if LWIP_IPV6
+#include "lwip/ethip6.h"
+#endif
+
+/* Define those to better describe your network interface. */
+#define IFNAME0 'x'
+#define IFNAME1 'e'
+
+/* Number of frames handed to the stack per xxvethernetif_input() call */
+#ifndef XLWIP_CONFIG_XXV_RX_INPUT_BUDGET
+#define XLWIP_CONFIG_XXV_RX_INPUT_BUDGET	32
+#endif
+
+XXxvEthernet_Config *xxvethernet_lookup_config(unsigned mac_base)
+{
+	extern XXxvEthernet_Config XXxvEthernet_ConfigTable[];
+	XXxvEthernet_Config *CfgPtr = NULL;
+	int i;
+
+	for (i = 0; i < XPAR_XXXVETHERNET_NUM_INSTANCES; i++) {
+		if (XXxvEthernet_ConfigTable[i].BaseAddress == mac_base) {
+			CfgPtr = &XXxvEthernet_ConfigTable[i];
+			break;
+		}
+	}
+
+	return (CfgPtr);
+}
+
+/*
+ * Pick the MM2S channel for a frame. All frames of one IPv4 TCP/UDP flow
+ * hash to the same channel so that they leave the MAC in order, while
+ * different flows are spread over all the channels in use. Everything
+ * else (ARP, IPv6, fragments) goes out on channel 1.
+ */
+static u32_t xxv_tx_flow_chan(xxvethernetif_s *xxvethernetif, struct pbuf *p)
+{
+	const u16_t hwhdr_len = SIZEOF_ETH_HDR - ETH_PAD_SIZE;
+	struct eth_hdr *ethhdr;
+	struct ip_hdr *iphdr;
+	u16_t iphdr_hlen;
+	u16_t ports[2];
+	u32_t hash;
+
+	if (xxvethernetif->n_chans == 1)
+		return 1;
+
+	if (p->len < (hwhdr_len + IP_HLEN))
+		return 1;
+
+	/* the padding word has already been dropped by the caller */
+	ethhdr = (struct eth_hdr *)((u8_t *)p->payload - ETH_PAD_SIZE);
+	if (ethhdr->type != PP_HTONS(ETHTYPE_IP))
+		return 1;
+
+	iphdr = (struct ip_hdr *)((u8_t *)p->payload + hwhdr_len);
+	hash = ip4_addr_get_u32(&iphdr->src) ^ ip4_addr_get_u32(&iphdr->dest);
+
+	iphdr_hlen = IPH_HL(iphdr) * 4;
+	if (((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) == 0) &&
+		((IPH_PROTO(iphdr) == IP_PROTO_TCP) ||
+		 (IPH_PROTO(iphdr) == IP_PROTO_UDP)) &&
+		(p->len >= (hwhdr_len + iphdr_hlen + sizeof ports))) {
+		memcpy(ports, (u8_t *)iphdr + iphdr_hlen, sizeof ports);
+		hash ^= ((u32_t)ports[0] << 16) | ports[1];
+	}
+
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return (hash % xxvethernetif->n_chans) + 1;
+}
+
+/*
+ * low_level_output():
+ *
+ * Should do the actual transmission of the packet. The packet is
+ * contained in the pbuf that is passed to the function. This pbuf
+ * might be chained.
+ *
+ */
+
+static err_t low_level_output(struct netif *netif, struct pbuf *p)
+{
+	SYS_ARCH_DECL_PROTECT(lev);
+	err_t err = ERR_MEM;
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xxvethernetif_s *xxvethernetif = (xxvethernetif_s *)(xemac->state);
+	u32_t chan_id;
+	u32_t n_bds;
+	int count = 100;
+
+	SYS_ARCH_PROTECT(lev);
+
+#if ETH_PAD_SIZE
+	pbuf_header(p, -ETH_PAD_SIZE);			/* drop the padding word */
+#endif
+
+	chan_id = xxv_tx_flow_chan(xxvethernetif, p);
+	n_bds = pbuf_clen(p);
+
+	while (count) {
+		/* check if space is available to send */
+		if (xxv_tx_space_available(xxvethernetif, chan_id) >= n_bds) {
+			if (xxv_mcdma_sgsend(xxvethernetif, p, chan_id) ==
+								XST_SUCCESS) {
+				err = ERR_OK;
+#if LINK_STATS
+				lwip_stats.link.xmit++;
+#endif
+			} else {
+#if LINK_STATS
+				lwip_stats.link.drop++;
+#endif
+			}
+			break;
+		}
+		/* reclaim the BDs the MCDMA is done with and try again */
+		xxv_process_sent_bds(xxvethernetif);
+		count--;
+	}
+
+	if (count == 0) {
+#if LINK_STATS
+		lwip_stats.link.drop++;
+#endif
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxvethernetif: pack dropped, no space\r\n"));
+	}
+
+#if ETH_PAD_SIZE
+	pbuf_header(p, ETH_PAD_SIZE);	/* reclaim the padding word */
+#endif
+
+	SYS_ARCH_UNPROTECT(lev);
+	return err;
+}
+
+/*
+ * low_level_input():
+ *
+ * Should allocate a pbuf and transfer the bytes of the incoming
+ * packet from the interface into the pbuf.
+ *
+ */
+static struct pbuf *low_level_input(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xxvethernetif_s *xxvethernetif = (xxvethernetif_s *)(xemac->state);
+
+	/* see if there is data to process */
+	if (pq_qlength(xxvethernetif->recv_q) == 0)
+		return NULL;
+
+	/* return one packet from receive q */
+	return (struct pbuf *)pq_dequeue(xxvethernetif->recv_q);
+}
+
+/*
+ * xxvethernetif_output():
+ *
+ * This function is called by the TCP/IP stack when an IP packet
+ * should be sent. It calls the function called low_level_output() to
+ * do the actual transmission of the packet.
+ *
+ */
+
+static err_t xxvethernetif_output(struct netif *netif, struct pbuf *p,
+		const ip4_addr_t *ipaddr)
+{
+	/* resolve hardware address, then send (or queue) packet */
+	return etharp_output(netif, p, ipaddr);
+}
+
+/*
+ * xxvethernetif_input():
+ *
+ * This function should be called when a packet is ready to be read
+ * from the interface. It uses the function low_level_input() that
+ * should handle the actual reception of bytes from the network
+ * interface.
+ *
+ * The receive queue is fed by all the S2MM channels. Up to
+ * XLWIP_CONFIG_XXV_RX_INPUT_BUDGET frames are handed to the stack per
+ * call so that a busy 10G link does not starve the application loop.
+ *
+ * Returns the number of packets read (0 if there are no packets)
+ *
+ */
+
+int xxvethernetif_input(struct netif *netif)
+{
+	struct eth_hdr *ethhdr;
+	struct pbuf *p;
+	int n_packets = 0;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+#if !NO_SYS
+	while (1)
+#else
+	while (n_packets < XLWIP_CONFIG_XXV_RX_INPUT_BUDGET)
+#endif
+	{
+		/* move received packet into a new pbuf */
+		SYS_ARCH_PROTECT(lev);
+		p = low_level_input(netif);
+		SYS_ARCH_UNPROTECT(lev);
+
+		/* no packet could be read, silently ignore this */
+		if (p == NULL)
+			break;
+
+		n_packets++;
+
+		/* points to packet payload, which starts with an Ethernet header */
+		ethhdr = p->payload;
+
+#if LINK_STATS
+		lwip_stats.link.recv++;
+#endif /* LINK_STATS */
+
+		switch (htons(ethhdr->type)) {
+			/* IP or ARP packet? */
+			case ETHTYPE_IP:
+			case ETHTYPE_ARP:
+#if LWIP_IPV6
+			/*IPv6 Packet?*/
+			case ETHTYPE_IPV6:
+#endif
+#if PPPOE_SUPPORT
+				/* PPPoE packet? */
+			case ETHTYPE_PPPOEDISC:
+			case ETHTYPE_PPPOE:
+#endif /* PPPOE_SUPPORT */
+				/* full packet send to tcpip_thread to process */
+				if (netif->input(p, netif) != ERR_OK) {
+					LWIP_DEBUGF(NETIF_DEBUG, ("xxvethernetif_input: IP input error\r\n"));
+					pbuf_free(p);
+					p = NULL;
+				}
+				break;
+
+			default:
+				pbuf_free(p);
+				p = NULL;
+				break;
+		}
+	}
+	return n_packets;
+}
+
+static err_t low_level_init(struct netif *netif)
+{
+	unsigned mac_address = (unsigned)(UINTPTR)(netif->state);
+	struct xemac_s *xemac;
+	xxvethernetif_s *xxvethernetif;
+	XXxvEthernet_Config *mac_config;
+
+	/* obtain config of this emac */
+	mac_config = xxvethernet_lookup_config(mac_address);
+	if (mac_config == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxvethernetif_init: no config for mac\r\n"));
+		return ERR_IF;
+	}
+
+	xxvethernetif = mem_malloc(sizeof *xxvethernetif);
+	if (xxvethernetif == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxvethernetif_init: out of memory\r\n"));
+		return ERR_MEM;
+	}
+	memset(xxvethernetif, 0, sizeof *xxvethernetif);
+
+	xemac = mem_malloc(sizeof *xemac);
+	if (xemac == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxvethernetif_init: out of memory\r\n"));
+		return ERR_MEM;
+	}
+
+	xemac->state = (void *)xxvethernetif;
+	xemac->topology_index = xtopology_find_index(mac_address);
+	xemac->type = xemac_type_xxv_ethernet;
+
+	xxvethernetif->send_q = NULL;
+	xxvethernetif->recv_q = pq_create_queue();
+	if (!xxvethernetif->recv_q)
+		return ERR_MEM;
+
+	/* maximum transfer unit */
+#ifdef USE_JUMBO_FRAMES
+	netif->mtu = XXE_JUMBO_MTU - XXE_HDR_SIZE;
+#else
+	netif->mtu = XXE_MTU - XXE_HDR_SIZE;
+#endif
+
+	/* the XXV MAC has no address filter, all frames are received */
+	netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP |
+				   NETIF_FLAG_LINK_UP;
+
+#if LWIP_IGMP
+	netif->flags |= NETIF_FLAG_IGMP;
+#endif
+
+#if LWIP_IPV6 && LWIP_IPV6_MLD
+	netif->flags |= NETIF_FLAG_MLD6;
+#endif
+
+#if !NO_SYS
+	sys_sem_new(&xemac->sem_rx_data_available, 0);
+#endif
+
+	/*
+	 * The MCDMA reset line is connected to the XXV Ethernet, so the
+	 * MCDMA is initialized (and thereby reset) ahead of the MAC.
+	 */
+	if (init_xxv_mcdma(xemac, mac_config->XxvDevBaseAddress) !=
+							XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxvethernetif_init: MCDMA init failed\r\n"));
+		return ERR_IF;
+	}
+
+	/* initialize the mac, FCS insert/strip and TX/RX are on by default */
+	XXxvEthernet_CfgInitialize(&xxvethernetif->xxv_ethernet,
+		mac_config, mac_config->BaseAddress);
+
+	/* hand the RX buffers to the MCDMA and enable its interrupts */
+	xxv_mcdma_start(xxvethernetif);
+
+	if (XXxvEthernet_Start(&xxvethernetif->xxv_ethernet) != XST_SUCCESS) {
+		xil_printf("xxvethernetif: no RX block lock, check the link\r\n");
+		return ERR_IF;
+	}
+
+	/* replace the state in netif (currently the emac baseaddress)
+	 * with the mac instance pointer.
+	 */
+	netif->state = (void *)xemac;
+
+	return ERR_OK;
+}
+
+/*
+ * xxvethernetif_init():
+ *
+ * Should be called at the beginning of the program to set up the
+ * network interface. It calls the function low_level_init() to do the
+ * actual setup of the hardware.
+ *
+ */
+
+err_t
+xxvethernetif_init(struct netif *netif)
+{
+	netif->name[0] = IFNAME0;
+	netif->name[1] = IFNAME1;
+	netif->output = xxvethernetif_output;
+	netif->linkoutput = low_level_output;
+#if LWIP_IPV6
+	netif->output_ip6 = ethip6_output;
+#endif
+
+	return low_level_init(netif);
+}
@@ -0,0 +1,782 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#include "lwipopts.h"
+
+#if !NO_SYS
+#ifdef OS_IS_FREERTOS
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "timers.h"
+#endif
+#endif
+
+#include "lwip/sys.h"
+#include "lwip/pbuf.h"
+#include "lwip/stats.h"
+
+#include "netif/xadapter.h"
+#include "netif/xxvethernetif.h"
+
+#if defined (__arm__) || defined (__aarch64__)
+#include "xscugic.h"
+#else
+#include "xintc_l.h"
+#endif
+
+#include "xstatus.h"
+#include "xil_cache.h"
+
+#include "xlwipconfig.h"
+#include "xparameters.h"
+
+#if defined __aarch64__
+#include "xil_mmu.h"
+#endif
+
+#ifdef OS_IS_FREERTOS
+#if defined (XLWIP_CONFIG_INCLUDE_GEM)
+extern long xInsideISR;
+#elif defined (XLWIP_CONFIG_INCLUDE_AXI_ETHERNET) || \
+	defined (XLWIP_CONFIG_INCLUDE_EMACLITE)
+extern u32 xInsideISR;
+#else
+u32 xInsideISR = 0;
+#endif
+#endif
+
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "The XXV Ethernet RX buffer pool requires LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+#if !defined (XLWIP_CONFIG_XXV_RX_INTR_IDS) || \
+	!defined (XLWIP_CONFIG_XXV_TX_INTR_IDS)
+#error "xlwipconfig.h does not list the MCDMA interrupts of the XXV Ethernet"
+#endif
+
+#if defined (__arm__) || defined (__aarch64__)
+#define MCDMA_INTR_PRIORITY_SET_IN_GIC		0xA0
+#define TRIG_TYPE_RISING_EDGE_SENSITIVE		0x3
+
+#define INTC_DIST_BASE_ADDR	XPAR_SCUGIC_0_DIST_BASEADDR
+#endif
+
+/*
+ * MCDMA interrupt ids of the channels in use, generated into xlwipconfig.h.
+ * With the MCDMA configured for a single interrupt per direction the lists
+ * hold just that one id. The lists are generated for one XXV Ethernet, so
+ * only a single instance is supported by this port.
+ */
+static const u32_t xxv_rx_intr_ids[] = XLWIP_CONFIG_XXV_RX_INTR_IDS;
+static const u32_t xxv_tx_intr_ids[] = XLWIP_CONFIG_XXV_TX_INTR_IDS;
+#define XXV_N_RX_INTR	(sizeof xxv_rx_intr_ids / sizeof xxv_rx_intr_ids[0])
+#define XXV_N_TX_INTR	(sizeof xxv_tx_intr_ids / sizeof xxv_tx_intr_ids[0])
+
+/*
+ * BD space for all channels. The MCDMA driver does not do any cache
+ * maintenance on the BDs on A53, the BDs are therefore placed in their own
+ * 2MB block(s) that are marked non cacheable.
+ */
+#define XXV_RX_BD_BYTES	(XLWIP_CONFIG_XXV_N_CHANNELS * XLWIP_CONFIG_N_RX_DESC * \
+						sizeof(XMcdma_Bd))
+#define XXV_TX_BD_BYTES	(XLWIP_CONFIG_XXV_N_CHANNELS * XLWIP_CONFIG_N_TX_DESC * \
+						sizeof(XMcdma_Bd))
+#if defined (__aarch64__)
+#define XXV_BD_SPACE_ALIGN	0x200000
+#else
+#define XXV_BD_SPACE_ALIGN	XMCDMA_BD_MINIMUM_ALIGNMENT
+#endif
+#define XXV_BD_SPACE_SIZE	((XXV_RX_BD_BYTES + XXV_TX_BD_BYTES + \
+				XXV_BD_SPACE_ALIGN - 1) & ~(XXV_BD_SPACE_ALIGN - 1))
+
+static u8_t xxv_bd_space[XXV_BD_SPACE_SIZE]
+			__attribute__ ((aligned (XXV_BD_SPACE_ALIGN)));
+
+#define XXV_BD_TO_INDEX(chan, bd)	\
+	((u32_t)(((UINTPTR)(bd) - (chan)->FirstBdAddr) / (chan)->Separation))
+
+/******************************************************************************
+ * RX pbuf pool
+ *
+ * The S2MM BDs of all channels are refilled from a preallocated set of
+ * custom pbufs (PBUF_REF) whose payload buffers are cache line aligned and a
+ * multiple of the cache line size long. Received frames are handed to the
+ * stack in the very buffer the MCDMA wrote them to. When lwIP drops the last
+ * reference to such a pbuf, the custom free function puts it back on the
+ * pool free list and immediately hands it back to the S2MM channels, so
+ * neither a copy nor the lwIP pool allocator is on the per-frame path.
+ *
+ * As the buffers never share a cache line with anything else, only the part
+ * of the buffer that was actually handed over to the stack (the received
+ * frame length) has to be invalidated when a buffer is recycled.
+ *****************************************************************************/
+
+#define RX_POOL_BUF_ALIGN	64
+#define RX_POOL_BUF_STRIDE	((XXV_RX_BUF_SIZE + RX_POOL_BUF_ALIGN - 1) & \
+					~(RX_POOL_BUF_ALIGN - 1))
+
+/* Number of pool buffers, must be larger than the number of S2MM BDs */
+#ifndef XLWIP_CONFIG_XXV_RX_POOL_NBUFS
+#define XLWIP_CONFIG_XXV_RX_POOL_NBUFS	(2 * XLWIP_CONFIG_XXV_N_CHANNELS * \
+						XLWIP_CONFIG_N_RX_DESC)
+#endif
+
+typedef struct rx_pool_pbuf {
+	struct pbuf_custom pc;		/* must be the first member */
+	struct rx_pool_pbuf *next;
+	struct rx_pool *pool;
+	u8_t *buf;
+	u32_t dirty_len;		/* bytes to invalidate on recycle */
+} rx_pool_pbuf_t;
+
+typedef struct rx_pool {
+	rx_pool_pbuf_t pbufs[XLWIP_CONFIG_XXV_RX_POOL_NBUFS];
+	rx_pool_pbuf_t *free_list;
+	xxvethernetif_s *xxvethernetif;
+	u8_t armed;			/* recycle straight into the S2MM BDs */
+	u8_t refilling;
+} rx_pool_t;
+
+static rx_pool_t rx_pool;
+static u8_t rx_pool_space[XLWIP_CONFIG_XXV_RX_POOL_NBUFS][RX_POOL_BUF_STRIDE]
+			__attribute__ ((aligned (RX_POOL_BUF_ALIGN)));
+
+static void xxv_setup_rx_bds(xxvethernetif_s *xxvethernetif, u32_t chan_id);
+
+static void rx_pool_pbuf_free(struct pbuf *p)
+{
+	rx_pool_pbuf_t *entry = (rx_pool_pbuf_t *)p;
+	rx_pool_t *pool = entry->pool;
+	xxvethernetif_s *xxvethernetif = pool->xxvethernetif;
+	u32_t chan_id;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+
+	entry->next = pool->free_list;
+	pool->free_list = entry;
+
+	/* Recycle the buffer straight into the S2MM BDs */
+	if ((pool->armed != 0) && (pool->refilling == 0)) {
+		for (chan_id = 1; chan_id <= xxvethernetif->n_chans; chan_id++) {
+			xxv_setup_rx_bds(xxvethernetif, chan_id);
+		}
+	}
+
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+static rx_pool_t *rx_pool_init(xxvethernetif_s *xxvethernetif)
+{
+	rx_pool_t *pool = &rx_pool;
+	rx_pool_pbuf_t *entry;
+	s32_t i;
+
+	if (pool->xxvethernetif != NULL) {
+		return NULL;
+	}
+	pool->xxvethernetif = xxvethernetif;
+	pool->free_list = NULL;
+	pool->armed = 0;
+	pool->refilling = 0;
+
+	for (i = XLWIP_CONFIG_XXV_RX_POOL_NBUFS - 1; i >= 0; i--) {
+		entry = &pool->pbufs[i];
+		entry->pc.custom_free_function = rx_pool_pbuf_free;
+		entry->pool = pool;
+		entry->buf = rx_pool_space[i];
+		entry->dirty_len = RX_POOL_BUF_STRIDE;
+		entry->next = pool->free_list;
+		pool->free_list = entry;
+	}
+	xxvethernetif->rx_pool = (void *)pool;
+
+	return pool;
+}
+
+/*
+ * Get a pool pbuf to be attached to an S2MM BD and make its payload visible
+ * to the MCDMA.
+ */
+static struct pbuf *alloc_rx_pbuf(xxvethernetif_s *xxvethernetif)
+{
+	rx_pool_t *pool = (rx_pool_t *)xxvethernetif->rx_pool;
+	rx_pool_pbuf_t *entry;
+
+	entry = pool->free_list;
+	if (entry == NULL) {
+		return NULL;
+	}
+	pool->free_list = entry->next;
+	entry->next = NULL;
+
+	if (xxvethernetif->mcdma.Config.IsRxCacheCoherent == 0) {
+		Xil_DCacheInvalidateRange((UINTPTR)entry->buf,
+					(UINTPTR)entry->dirty_len);
+	}
+
+	return pbuf_alloced_custom(PBUF_RAW, XXV_RX_BUF_SIZE, PBUF_REF,
+			&entry->pc, entry->buf, RX_POOL_BUF_STRIDE);
+}
+
+/*
+ * Hand pool buffers to all the free BDs of an S2MM channel and move the
+ * channel tail descriptor past them.
+ */
+static void xxv_setup_rx_bds(xxvethernetif_s *xxvethernetif, u32_t chan_id)
+{
+	rx_pool_t *pool = (rx_pool_t *)xxvethernetif->rx_pool;
+	XMcdma_ChanCtrl *rx_chan;
+	XMcdma_Bd *rxbd;
+	struct pbuf *p;
+	u32_t bdindex;
+	u32_t n_submitted = 0;
+
+	rx_chan = XMcdma_GetMcdmaRxChan(&xxvethernetif->mcdma, chan_id);
+	if (rx_chan->BdCnt == 0) {
+		return;
+	}
+
+	/* Buffers released while refilling must not recurse into the ring */
+	pool->refilling = 1;
+
+	while (rx_chan->BdCnt > 0) {
+		/*
+		 * If all pool buffers are in use by the stack, the channel is
+		 * refilled as soon as one of them is freed.
+		 */
+		p = alloc_rx_pbuf(xxvethernetif);
+		if (p == NULL) {
+			break;
+		}
+		rxbd = XMcdma_GetChanCurBd(rx_chan);
+		bdindex = XXV_BD_TO_INDEX(rx_chan, rxbd);
+		if (XMcDma_ChanSubmit(rx_chan, (UINTPTR)p->payload,
+						p->len) != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("xxv_setup_rx_bds: Error submitting RxBD\r\n"));
+			pbuf_free(p);
+			break;
+		}
+		xxvethernetif->rx_pbufs[chan_id - 1][bdindex] = p;
+		n_submitted++;
+	}
+
+	if (n_submitted > 0) {
+		if (rx_chan->ChanState != XMCDMA_CHAN_BUSY) {
+			XMcDma_ChanToHw(rx_chan);
+		} else {
+			XMcdma_UpdateChanTDesc(rx_chan);
+		}
+	}
+
+	pool->refilling = 0;
+}
+
+/*
+ * Called by XMcdma_BdChainFromHWAll() for every S2MM channel with completed
+ * BDs. The frames are queued in receive order per channel; all frames of a
+ * flow land on the same channel, so no flow is reordered.
+ */
+static void xxv_rx_harvest(void *arg, u32 chan_id, int bd_count,
+							XMcdma_Bd *bdset)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(arg);
+	xxvethernetif_s *xxvethernetif = (xxvethernetif_s *)(xemac->state);
+	XMcdma_ChanCtrl *rx_chan;
+	XMcdma_Bd *rxbd = bdset;
+	struct pbuf *p;
+	u32_t bdindex;
+	u32_t bdstatus;
+	u32_t rx_bytes;
+	int k;
+
+	rx_chan = XMcdma_GetMcdmaRxChan(&xxvethernetif->mcdma, chan_id);
+
+	for (k = 0; k < bd_count; k++) {
+		bdindex = XXV_BD_TO_INDEX(rx_chan, rxbd);
+		p = xxvethernetif->rx_pbufs[chan_id - 1][bdindex];
+		xxvethernetif->rx_pbufs[chan_id - 1][bdindex] = NULL;
+		bdstatus = XMcDma_BdGetSts(rxbd);
+		rx_bytes = bdstatus & XMCDMA_BD_LEN_MASK;
+		rxbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(rx_chan, rxbd);
+
+		if (p == NULL) {
+			continue;
+		}
+
+		/* the buffers hold a full frame, anything else is an error */
+		if ((bdstatus & XMCDMA_BD_STS_ALL_ERR_MASK) ||
+			((bdstatus & (XMCDMA_BD_STS_RXSOF_MASK |
+				XMCDMA_BD_STS_RXEOF_MASK)) !=
+			(XMCDMA_BD_STS_RXSOF_MASK | XMCDMA_BD_STS_RXEOF_MASK)) ||
+			(rx_bytes > XXV_RX_BUF_SIZE)) {
+#if LINK_STATS
+			lwip_stats.link.err++;
+			lwip_stats.link.drop++;
+#endif
+			pbuf_free(p);
+			continue;
+		}
+
+		/*
+		 * Adjust the buffer size to the actual number of bytes received.
+		 */
+		pbuf_realloc(p, rx_bytes);
+		((rx_pool_pbuf_t *)p)->dirty_len = rx_bytes;
+		xxvethernetif->rx_frames[chan_id - 1]++;
+
+		/* store it in the receive queue,
+		 * where it'll be processed by a different handler
+		 */
+		if (pq_enqueue(xxvethernetif->recv_q, (void*)p) < 0) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			pbuf_free(p);
+		}
+	}
+}
+
+/*
+ * Interrupt handler of the S2MM channels. The same handler serves the per
+ * channel interrupts and the single MCDMA interrupt: all channels that have
+ * an interrupt pending are acknowledged, harvested in one pass and refilled.
+ * Which channel a frame arrives on is decided by the TDEST the fabric puts
+ * on the stream ahead of the MCDMA, typically from a hash of the flow.
+ */
+static void xxv_mcdma_recv_handler(void *arg)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(arg);
+	xxvethernetif_s *xxvethernetif = (xxvethernetif_s *)(xemac->state);
+	rx_pool_t *pool = (rx_pool_t *)xxvethernetif->rx_pool;
+	XMcdma_ChanCtrl *rx_chan;
+	u32_t chan_mask;
+	u32_t chan_id;
+	u32_t irq_status;
+
+#ifdef OS_IS_FREERTOS
+	xInsideISR++;
+#endif
+
+	chan_mask = XMcdma_GetIntrServicedMask(&xxvethernetif->mcdma,
+							XMCDMA_DEV_TO_MEM);
+
+	for (chan_id = 1; chan_id <= xxvethernetif->n_chans; chan_id++) {
+		if (!(chan_mask & (1 << (chan_id - 1)))) {
+			continue;
+		}
+		rx_chan = XMcdma_GetMcdmaRxChan(&xxvethernetif->mcdma, chan_id);
+		irq_status = XMcdma_ChanGetIrq(rx_chan);
+		XMcdma_ChanAckIrq(rx_chan, irq_status);
+		if (irq_status & XMCDMA_IRQ_ERROR_MASK) {
+#if LINK_STATS
+			lwip_stats.link.err++;
+#endif
+			xil_printf("xxv_mcdma_recv_handler: S2MM channel %d error\r\n",
+								chan_id);
+		}
+	}
+
+	/* The BDs are cleared after the harvest and refilled below */
+	pool->refilling = 1;
+	XMcdma_BdChainFromHWAll(&xxvethernetif->mcdma, XMCDMA_DEV_TO_MEM,
+				chan_mask, XLWIP_CONFIG_N_RX_DESC,
+				xxv_rx_harvest, xemac);
+	pool->refilling = 0;
+
+	for (chan_id = 1; chan_id <= xxvethernetif->n_chans; chan_id++) {
+		if (chan_mask & (1 << (chan_id - 1))) {
+			xxv_setup_rx_bds(xxvethernetif, chan_id);
+		}
+	}
+
+#if !NO_SYS
+	sys_sem_signal(&xemac->sem_rx_data_available);
+#endif
+
+#ifdef OS_IS_FREERTOS
+	xInsideISR--;
+#endif
+}
+
+u32_t xxv_tx_space_available(xxvethernetif_s *xxvethernetif, u32_t chan_id)
+{
+	XMcdma_ChanCtrl *tx_chan;
+
+	tx_chan = XMcdma_GetMcdmaTxChan(&xxvethernetif->mcdma, chan_id);
+
+	return tx_chan->BdCnt;
+}
+
+/*
+ * Called by XMcdma_BdChainFromHWAll() for every MM2S channel with completed
+ * BDs. Drops the references taken on the transmitted pbufs.
+ */
+static void xxv_tx_harvest(void *arg, u32 chan_id, int bd_count,
+							XMcdma_Bd *bdset)
+{
+	xxvethernetif_s *xxvethernetif = (xxvethernetif_s *)(arg);
+	XMcdma_ChanCtrl *tx_chan;
+	XMcdma_Bd *txbd = bdset;
+	struct pbuf *p;
+	u32_t bdindex;
+	int k;
+
+	tx_chan = XMcdma_GetMcdmaTxChan(&xxvethernetif->mcdma, chan_id);
+
+	for (k = 0; k < bd_count; k++) {
+		bdindex = XXV_BD_TO_INDEX(tx_chan, txbd);
+		p = xxvethernetif->tx_pbufs[chan_id - 1][bdindex];
+		xxvethernetif->tx_pbufs[chan_id - 1][bdindex] = NULL;
+		if (p != NULL) {
+			pbuf_free(p);
+		}
+		txbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(tx_chan, txbd);
+	}
+}
+
+void xxv_process_sent_bds(xxvethernetif_s *xxvethernetif)
+{
+	XMcdma_BdChainFromHWAll(&xxvethernetif->mcdma, XMCDMA_MEM_TO_DEV,
+				(1 << xxvethernetif->n_chans) - 1,
+				XLWIP_CONFIG_N_TX_DESC, xxv_tx_harvest,
+				xxvethernetif);
+}
+
+static void xxv_mcdma_send_handler(void *arg)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(arg);
+	xxvethernetif_s *xxvethernetif = (xxvethernetif_s *)(xemac->state);
+	XMcdma_ChanCtrl *tx_chan;
+	u32_t chan_mask;
+	u32_t chan_id;
+	u32_t irq_status;
+
+#ifdef OS_IS_FREERTOS
+	xInsideISR++;
+#endif
+
+	chan_mask = XMcdma_GetIntrServicedMask(&xxvethernetif->mcdma,
+							XMCDMA_MEM_TO_DEV);
+
+	for (chan_id = 1; chan_id <= xxvethernetif->n_chans; chan_id++) {
+		if (!(chan_mask & (1 << (chan_id - 1)))) {
+			continue;
+		}
+		tx_chan = XMcdma_GetMcdmaTxChan(&xxvethernetif->mcdma, chan_id);
+		irq_status = XMcdma_ChanGetIrq(tx_chan);
+		XMcdma_ChanAckIrq(tx_chan, irq_status);
+		if (irq_status & XMCDMA_IRQ_ERROR_MASK) {
+#if LINK_STATS
+			lwip_stats.link.err++;
+#endif
+			xil_printf("xxv_mcdma_send_handler: MM2S channel %d error\r\n",
+								chan_id);
+		}
+	}
+
+	XMcdma_BdChainFromHWAll(&xxvethernetif->mcdma, XMCDMA_MEM_TO_DEV,
+				chan_mask, XLWIP_CONFIG_N_TX_DESC,
+				xxv_tx_harvest, xxvethernetif);
+
+#ifdef OS_IS_FREERTOS
+	xInsideISR--;
+#endif
+}
+
+/*
+ * The MM2S channels can only fetch from buffers aligned to the stream width
+ * unless the MCDMA has the DRE. Frames with a misaligned payload are copied
+ * into a single, MEM_ALIGNMENT aligned pbuf.
+ */
+static s32_t xxv_tx_needs_copy(XMcdma_ChanCtrl *tx_chan, struct pbuf *p)
+{
+	struct pbuf *q;
+
+	if (tx_chan->Has_Txdre || (tx_chan->TxDataWidth <= 1)) {
+		return 0;
+	}
+	for (q = p; q != NULL; q = q->next) {
+		if ((UINTPTR)q->payload & (tx_chan->TxDataWidth - 1)) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+XStatus xxv_mcdma_sgsend(xxvethernetif_s *xxvethernetif, struct pbuf *p,
+							u32_t chan_id)
+{
+	XMcdma_ChanCtrl *tx_chan;
+	XMcdma_Bd *txbd;
+	XMcdma_Bd *first_txbd = NULL;
+	XMcdma_Bd *last_txbd = NULL;
+	struct pbuf *q;
+	struct pbuf *copy = NULL;
+	u32_t bdindex;
+	XStatus status;
+
+	tx_chan = XMcdma_GetMcdmaTxChan(&xxvethernetif->mcdma, chan_id);
+
+	if (xxv_tx_needs_copy(tx_chan, p)) {
+		copy = pbuf_alloc(PBUF_RAW, p->tot_len, PBUF_RAM);
+		if (copy == NULL) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+#endif
+			return XST_FAILURE;
+		}
+		pbuf_copy(copy, p);
+		p = copy;
+	}
+
+	for (q = p; q != NULL; q = q->next) {
+		if (q->len > tx_chan->MaxTransferLen) {
+			if (copy != NULL) {
+				pbuf_free(copy);
+			}
+			return XST_FAILURE;
+		}
+	}
+
+	for (q = p; q != NULL; q = q->next) {
+		/* Send the data from the pbuf to the interface, one pbuf at a
+		 * time. The size of the data in each pbuf is kept in the ->len
+		 * variable.
+		 */
+		if (xxvethernetif->mcdma.Config.IsTxCacheCoherent == 0) {
+			Xil_DCacheFlushRange((UINTPTR)q->payload, q->len);
+		}
+		txbd = XMcdma_GetChanCurBd(tx_chan);
+		bdindex = XXV_BD_TO_INDEX(tx_chan, txbd);
+		status = XMcDma_ChanSubmit(tx_chan, (UINTPTR)q->payload, q->len);
+		if (status != XST_SUCCESS) {
+			/* the caller checked for space, should not occur */
+			break;
+		}
+		if (copy == NULL) {
+			pbuf_ref(q);
+		}
+		xxvethernetif->tx_pbufs[chan_id - 1][bdindex] = q;
+		if (first_txbd == NULL) {
+			first_txbd = txbd;
+		}
+		last_txbd = txbd;
+	}
+
+	if (first_txbd == NULL) {
+		return XST_FAILURE;
+	}
+
+	if (first_txbd == last_txbd) {
+		XMcDma_BdSetCtrl(first_txbd, XMCDMA_BD_CTRL_SOF_MASK |
+					XMCDMA_BD_CTRL_EOF_MASK);
+	} else {
+		/* in the first packet, set the SOP */
+		XMcDma_BdSetCtrl(first_txbd, XMCDMA_BD_CTRL_SOF_MASK);
+		/* in the last packet, set the EOP */
+		XMcDma_BdSetCtrl(last_txbd, XMCDMA_BD_CTRL_EOF_MASK);
+		XMCDMA_CACHE_FLUSH((UINTPTR)first_txbd);
+	}
+	XMCDMA_CACHE_FLUSH((UINTPTR)last_txbd);
+
+	/* enq to h/w */
+	if (tx_chan->ChanState != XMCDMA_CHAN_BUSY) {
+		return XMcDma_ChanToHw(tx_chan);
+	}
+
+	return XMcdma_UpdateChanTDesc(tx_chan);
+}
+
+static void xxv_register_intr(struct xemac_s *xemac, u32_t intr_id,
+						void (*handler)(void *))
+{
+	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
+
+#if defined (__arm__) || defined (__aarch64__)
+	XScuGic_RegisterHandler(xtopologyp->scugic_baseaddr, intr_id,
+			(Xil_ExceptionHandler)handler, xemac);
+	XScuGic_SetPriTrigTypeByDistAddr(INTC_DIST_BASE_ADDR, intr_id,
+			MCDMA_INTR_PRIORITY_SET_IN_GIC,
+			TRIG_TYPE_RISING_EDGE_SENSITIVE);
+	XScuGic_EnableIntr(INTC_DIST_BASE_ADDR, intr_id);
+#else
+	/* connect & enable the MCDMA interrupt */
+	XIntc_RegisterHandler(xtopologyp->intc_baseaddr, intr_id,
+			(XInterruptHandler)handler, xemac);
+	XIntc_EnableIntr(xtopologyp->intc_baseaddr,
+			XIntc_In32(xtopologyp->intc_baseaddr + XIN_IER_OFFSET) |
+			(1 << intr_id));
+#endif
+}
+
+static XMcdma_Config *xxv_mcdma_lookup_config(UINTPTR baseaddr)
+{
+	extern XMcdma_Config XMcdma_ConfigTable[];
+	XMcdma_Config *CfgPtr = NULL;
+	int i;
+
+	for (i = 0; i < XPAR_XMCDMA_NUM_INSTANCES; i++) {
+		if (XMcdma_ConfigTable[i].BaseAddress == baseaddr) {
+			CfgPtr = &XMcdma_ConfigTable[i];
+			break;
+		}
+	}
+
+	return (CfgPtr);
+}
+
+XStatus init_xxv_mcdma(struct xemac_s *xemac, UINTPTR mcdma_baseaddr)
+{
+	xxvethernetif_s *xxvethernetif = (xxvethernetif_s *)(xemac->state);
+	XMcdma_Config *dmaconfig;
+	XMcdma_ChanCtrl *chan;
+	XStatus status;
+	u32_t chan_id;
+	u32_t i;
+	UINTPTR rx_bdspace, tx_bdspace;
+#if defined (__aarch64__)
+	UINTPTR offset;
+#endif
+
+	/*
+	 * Disable L1 prefetch if the processor type is Cortex A53, a
+	 * prefetched line of an RX buffer would shadow the frame the MCDMA
+	 * writes to it. See xaxiemacif_dma.c for the details.
+	 */
+#if defined __aarch64__
+	Xil_ConfigureL1Prefetch(0);
+#endif
+
+	dmaconfig = xxv_mcdma_lookup_config(mcdma_baseaddr);
+	if (dmaconfig == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("init_xxv_mcdma: no MCDMA config\r\n"));
+		return XST_FAILURE;
+	}
+	status = XMcDma_CfgInitialize(&xxvethernetif->mcdma, dmaconfig);
+	if (status != XST_SUCCESS) {
+		return status;
+	}
+
+	xxvethernetif->n_chans = XLWIP_CONFIG_XXV_N_CHANNELS;
+	if (xxvethernetif->n_chans > (u32_t)dmaconfig->TxNumChannels) {
+		xxvethernetif->n_chans = dmaconfig->TxNumChannels;
+	}
+	if (xxvethernetif->n_chans > (u32_t)dmaconfig->RxNumChannels) {
+		xxvethernetif->n_chans = dmaconfig->RxNumChannels;
+	}
+	if (xxvethernetif->n_chans == 0) {
+		return XST_FAILURE;
+	}
+
+	if (rx_pool_init(xxvethernetif) == NULL) {
+		xil_printf("%s@%d: Error: only one XXV Ethernet is supported\r\n",
+				__FILE__, __LINE__);
+		return XST_FAILURE;
+	}
+
+#if defined (__aarch64__)
+	for (offset = 0; offset < XXV_BD_SPACE_SIZE; offset += 0x200000) {
+		Xil_SetTlbAttributes((UINTPTR)xxv_bd_space + offset,
+					NORM_NONCACHE | INNER_SHAREABLE);
+	}
+#endif
+	xxvethernetif->rx_bdspace = (void *)xxv_bd_space;
+	xxvethernetif->tx_bdspace = (void *)(xxv_bd_space + XXV_RX_BD_BYTES);
+
+	LWIP_DEBUGF(NETIF_DEBUG, ("rx_bdspace: 0x%08x\r\n",
+					xxvethernetif->rx_bdspace));
+	LWIP_DEBUGF(NETIF_DEBUG, ("tx_bdspace: 0x%08x\r\n",
+					xxvethernetif->tx_bdspace));
+
+	rx_bdspace = (UINTPTR)xxvethernetif->rx_bdspace;
+	tx_bdspace = (UINTPTR)xxvethernetif->tx_bdspace;
+
+	for (chan_id = 1; chan_id <= xxvethernetif->n_chans; chan_id++) {
+		chan = XMcdma_GetMcdmaRxChan(&xxvethernetif->mcdma, chan_id);
+		XMcdma_IntrDisable(chan, XMCDMA_IRQ_ALL_MASK);
+		status = XMcDma_ChanBdCreate(chan, rx_bdspace,
+						XLWIP_CONFIG_N_RX_DESC);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space\r\n"));
+			return status;
+		}
+		XMcdma_SetChanCoalesceDelay(chan, XLWIP_CONFIG_N_RX_COALESCE, 1);
+		rx_bdspace += XLWIP_CONFIG_N_RX_DESC * sizeof(XMcdma_Bd);
+
+		chan = XMcdma_GetMcdmaTxChan(&xxvethernetif->mcdma, chan_id);
+		XMcdma_IntrDisable(chan, XMCDMA_IRQ_ALL_MASK);
+		status = XMcDma_ChanBdCreate(chan, tx_bdspace,
+						XLWIP_CONFIG_N_TX_DESC);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up TxBD space\r\n"));
+			return status;
+		}
+		XMcdma_SetChanCoalesceDelay(chan, XLWIP_CONFIG_N_TX_COALESCE, 1);
+		tx_bdspace += XLWIP_CONFIG_N_TX_DESC * sizeof(XMcdma_Bd);
+	}
+
+	/* connect the MCDMA interrupts, the channels enable them on start */
+	for (i = 0; i < XXV_N_RX_INTR; i++) {
+		xxv_register_intr(xemac, xxv_rx_intr_ids[i],
+					xxv_mcdma_recv_handler);
+	}
+	for (i = 0; i < XXV_N_TX_INTR; i++) {
+		xxv_register_intr(xemac, xxv_tx_intr_ids[i],
+					xxv_mcdma_send_handler);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*
+ * Fill the S2MM BDs, start the channels and enable their interrupts. Called
+ * once the MAC has been initialized, ahead of enabling its receiver.
+ */
+void xxv_mcdma_start(xxvethernetif_s *xxvethernetif)
+{
+	rx_pool_t *pool = (rx_pool_t *)xxvethernetif->rx_pool;
+	XMcdma_ChanCtrl *chan;
+	u32_t chan_id;
+
+	for (chan_id = 1; chan_id <= xxvethernetif->n_chans; chan_id++) {
+		xxv_setup_rx_bds(xxvethernetif, chan_id);
+
+		chan = XMcdma_GetMcdmaRxChan(&xxvethernetif->mcdma, chan_id);
+		XMcdma_IntrEnable(chan, XMCDMA_IRQ_ALL_MASK);
+		chan = XMcdma_GetMcdmaTxChan(&xxvethernetif->mcdma, chan_id);
+		XMcdma_IntrEnable(chan, XMCDMA_IRQ_ALL_MASK);
+	}
+	pool->armed = 1;
+}
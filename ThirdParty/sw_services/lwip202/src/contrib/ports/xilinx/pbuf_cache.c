@@ -0,0 +1,142 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#include "lwip/opt.h"
+
+#if XLWIP_PBUF_CACHE
+
+#include "lwip/memp.h"
+#include "arch/pbuf_cache.h"
+#include "xpseudo_asm.h"
+
+#if !defined (__arm__) && !defined (__aarch64__)
+#error "XLWIP_PBUF_CACHE is supported only on ARM processors"
+#endif
+
+struct xlwip_pbuf_cache {
+	volatile u32_t busy;	/* claimed by a caller */
+	u32_t count;		/* buffers in buf[] */
+	void *buf[XLWIP_PBUF_CACHE_SIZE];
+} __attribute__ ((aligned(64)));
+
+static struct xlwip_pbuf_cache pbuf_cache[XLWIP_PBUF_CACHE_CORES];
+
+static struct xlwip_pbuf_cache *pbuf_cache_claim(void)
+{
+	struct xlwip_pbuf_cache *c;
+	u32_t core;
+
+#ifdef __aarch64__
+	core = (u32_t)mfcp(MPIDR_EL1) & 0xFFU;
+#else
+	core = mfcp(XREG_CP15_MULTI_PROC_AFFINITY) & 0xFFU;
+#endif
+	c = &pbuf_cache[core % XLWIP_PBUF_CACHE_CORES];
+
+	if (__atomic_exchange_n(&c->busy, 1U, __ATOMIC_ACQUIRE) != 0U) {
+		return NULL;
+	}
+	return c;
+}
+
+static void pbuf_cache_release(struct xlwip_pbuf_cache *c)
+{
+	__atomic_store_n(&c->busy, 0U, __ATOMIC_RELEASE);
+}
+
+/*
+ * Get a PBUF_POOL buffer, refilling the cache of this core from the pool
+ * when it is empty.
+ */
+void *xlwip_pbuf_cache_alloc(void)
+{
+	struct xlwip_pbuf_cache *c = pbuf_cache_claim();
+	void *p = NULL;
+
+	if (c == NULL) {
+		return memp_malloc(MEMP_PBUF_POOL);
+	}
+
+	if (c->count == 0U) {
+		c->count = memp_malloc_bulk(MEMP_PBUF_POOL, c->buf,
+					XLWIP_PBUF_CACHE_BATCH);
+	}
+	if (c->count != 0U) {
+		p = c->buf[--c->count];
+	}
+
+	pbuf_cache_release(c);
+	return p;
+}
+
+/*
+ * Return a PBUF_POOL buffer, draining a batch from the cache of this core
+ * to the pool when it is full.
+ */
+void xlwip_pbuf_cache_free(void *p)
+{
+	struct xlwip_pbuf_cache *c = pbuf_cache_claim();
+
+	if (c == NULL) {
+		memp_free(MEMP_PBUF_POOL, p);
+		return;
+	}
+
+	if (c->count == XLWIP_PBUF_CACHE_SIZE) {
+		c->count -= XLWIP_PBUF_CACHE_BATCH;
+		memp_free_bulk(MEMP_PBUF_POOL, &c->buf[c->count],
+				XLWIP_PBUF_CACHE_BATCH);
+	}
+	c->buf[c->count++] = p;
+
+	pbuf_cache_release(c);
+}
+
+/*
+ * Give every buffer cached by this core back to the pool, e.g. before
+ * checking the pool usage or when another core runs short of buffers.
+ */
+void xlwip_pbuf_cache_drain(void)
+{
+	struct xlwip_pbuf_cache *c = pbuf_cache_claim();
+
+	if (c == NULL) {
+		return;
+	}
+
+	memp_free_bulk(MEMP_PBUF_POOL, c->buf, (u16_t)c->count);
+	c->count = 0U;
+
+	pbuf_cache_release(c);
+}
+
+#endif /* XLWIP_PBUF_CACHE */
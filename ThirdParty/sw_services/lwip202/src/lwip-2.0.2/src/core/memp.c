@@ -48,6 +48,9 @@
 #include "lwip/memp.h"
 #include "lwip/sys.h"
 #include "lwip/stats.h"
+#if XLWIP_MEMPROF
+#include "arch/memprof.h"
+#endif
 
 #include <string.h>
 
@@ -388,17 +391,26 @@ memp_malloc_fn(memp_t type, const char* file, const int line)
 #endif
 {
   void *memp;
+#if XLWIP_MEMPROF
+  u32_t memprof_start;
+#endif
   LWIP_ERROR("memp_malloc: type < MEMP_MAX", (type < MEMP_MAX), return NULL;);
 
 #if MEMP_OVERFLOW_CHECK >= 2
   memp_overflow_check_all();
 #endif /* MEMP_OVERFLOW_CHECK >= 2 */
 
+#if XLWIP_MEMPROF
+  memprof_start = xlwip_memprof_start();
+#endif
 #if !MEMP_OVERFLOW_CHECK
   memp = do_memp_malloc_pool(memp_pools[type]);
 #else
   memp = do_memp_malloc_pool_fn(memp_pools[type], file, line);
 #endif
+#if XLWIP_MEMPROF
+  xlwip_memprof_record(type, memprof_start, memp);
+#endif
 
   return memp;
 }
@@ -494,3 +506,94 @@ memp_free(memp_t type, void *mem)
   }
 #endif
 }
+
+#if XLWIP_PBUF_CACHE
+/**
+ * Get up to num elements from a pool with a single critical section.
+ *
+ * @param type the pool to get the elements from
+ * @param mem array receiving the elements
+ * @param num number of elements wanted
+ *
+ * @return the number of elements stored in mem
+ */
+u16_t
+memp_malloc_bulk(memp_t type, void **mem, u16_t num)
+{
+  u16_t i = 0;
+#if MEMP_MEM_MALLOC || MEMP_OVERFLOW_CHECK || XLWIP_MEMPROF
+  LWIP_ERROR("memp_malloc_bulk: type < MEMP_MAX", (type < MEMP_MAX), return 0;);
+
+  while (i < num) {
+    mem[i] = memp_malloc(type);
+    if (mem[i] == NULL) {
+      break;
+    }
+    i++;
+  }
+#else /* MEMP_MEM_MALLOC || MEMP_OVERFLOW_CHECK || XLWIP_MEMPROF */
+  const struct memp_desc *desc;
+  struct memp *memp;
+  SYS_ARCH_DECL_PROTECT(old_level);
+
+  LWIP_ERROR("memp_malloc_bulk: type < MEMP_MAX", (type < MEMP_MAX), return 0;);
+  desc = memp_pools[type];
+
+  SYS_ARCH_PROTECT(old_level);
+  while ((i < num) && ((memp = *desc->tab) != NULL)) {
+    *desc->tab = memp->next;
+    /* cast through u8_t* to get rid of alignment warnings */
+    mem[i++] = (u8_t*)memp + MEMP_SIZE;
+  }
+#if MEMP_STATS
+  if (i == 0) {
+    desc->stats->err++;
+  }
+  desc->stats->used += i;
+  if (desc->stats->used > desc->stats->max) {
+    desc->stats->max = desc->stats->used;
+  }
+#endif
+  SYS_ARCH_UNPROTECT(old_level);
+#endif /* MEMP_MEM_MALLOC || MEMP_OVERFLOW_CHECK || XLWIP_MEMPROF */
+
+  return i;
+}
+
+/**
+ * Put num elements back into a pool with a single critical section.
+ *
+ * @param type the pool where to put the elements
+ * @param mem array of the elements to free
+ * @param num number of elements in mem
+ */
+void
+memp_free_bulk(memp_t type, void **mem, u16_t num)
+{
+  u16_t i;
+#if MEMP_MEM_MALLOC || MEMP_OVERFLOW_CHECK || MEMP_SANITY_CHECK || defined(LWIP_HOOK_MEMP_AVAILABLE)
+  for (i = 0; i < num; i++) {
+    memp_free(type, mem[i]);
+  }
+#else
+  const struct memp_desc *desc;
+  struct memp *memp;
+  SYS_ARCH_DECL_PROTECT(old_level);
+
+  LWIP_ERROR("memp_free_bulk: type < MEMP_MAX", (type < MEMP_MAX), return;);
+  desc = memp_pools[type];
+
+  SYS_ARCH_PROTECT(old_level);
+  for (i = 0; i < num; i++) {
+    /* cast through void* to get rid of alignment warnings */
+    memp = (struct memp *)(void *)((u8_t*)mem[i] - MEMP_SIZE);
+    memp->next = *desc->tab;
+    *desc->tab = memp;
+  }
+#if MEMP_STATS
+  desc->stats->used -= num;
+#endif
+  SYS_ARCH_UNPROTECT(old_level);
+#endif
+}
+#endif /* XLWIP_PBUF_CACHE */
@@ -123,6 +123,9 @@ void eth_rx_irq()
 #if LWIP_CHECKSUM_ON_COPY
 #include "lwip/inet_chksum.h"
 #endif
+#if XLWIP_PBUF_CACHE
+#include "arch/pbuf_cache.h"
+#endif
 
 #include <string.h>
 
@@ -131,6 +134,16 @@ void eth_rx_irq()
    aligned there. Therefore, PBUF_POOL_BUFSIZE_ALIGNED can be used here. */
 #define PBUF_POOL_BUFSIZE_ALIGNED LWIP_MEM_ALIGN_SIZE(PBUF_POOL_BUFSIZE)
 
+#if XLWIP_PBUF_CACHE
+/* PBUF_POOL buffers come from the per-core caches, reference counts are
+   updated atomically instead of under SYS_ARCH_PROTECT */
+#define PBUF_POOL_ALLOC()         xlwip_pbuf_cache_alloc()
+#define PBUF_POOL_FREE(p)         xlwip_pbuf_cache_free(p)
+#else /* XLWIP_PBUF_CACHE */
+#define PBUF_POOL_ALLOC()         memp_malloc(MEMP_PBUF_POOL)
+#define PBUF_POOL_FREE(p)         memp_free(MEMP_PBUF_POOL, p)
+#endif /* XLWIP_PBUF_CACHE */
+
 #if !LWIP_TCP || !TCP_QUEUE_OOSEQ || !PBUF_POOL_FREE_OOSEQ
 #define PBUF_POOL_IS_EMPTY()
 #else /* !LWIP_TCP || !TCP_QUEUE_OOSEQ || !PBUF_POOL_FREE_OOSEQ */
@@ -282,7 +295,7 @@ pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type)
   switch (type) {
   case PBUF_POOL:
     /* allocate head of pbuf chain into p */
-    p = (struct pbuf *)memp_malloc(MEMP_PBUF_POOL);
+    p = (struct pbuf *)PBUF_POOL_ALLOC();
     LWIP_DEBUGF(PBUF_DEBUG | LWIP_DBG_TRACE, ("pbuf_alloc: allocated pbuf %p\n", (void *)p));
     if (p == NULL) {
       PBUF_POOL_IS_EMPTY();
@@ -315,7 +328,7 @@ pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type)
     rem_len = length - p->len;
     /* any remaining pbufs to be allocated? */
     while (rem_len > 0) {
-      q = (struct pbuf *)memp_malloc(MEMP_PBUF_POOL);
+      q = (struct pbuf *)PBUF_POOL_ALLOC();
       if (q == NULL) {
         PBUF_POOL_IS_EMPTY();
         /* free chain so far allocated */
@@ -738,6 +751,12 @@ pbuf_free(struct pbuf *p)
    * obtain a zero reference count after decrementing*/
   while (p != NULL) {
     u16_t ref;
+#if XLWIP_PBUF_CACHE
+    /* all pbufs in a chain are referenced at least once */
+    LWIP_ASSERT("pbuf_free: p->ref > 0", p->ref > 0);
+    /* decrease reference count (number of pointers to pbuf) */
+    ref = __atomic_sub_fetch(&p->ref, 1, __ATOMIC_ACQ_REL);
+#else /* XLWIP_PBUF_CACHE */
     SYS_ARCH_DECL_PROTECT(old_level);
     /* Since decrementing ref cannot be guaranteed to be a single machine operation
      * we must protect it. We put the new ref into a local variable to prevent
@@ -748,6 +767,7 @@ pbuf_free(struct pbuf *p)
     /* decrease reference count (number of pointers to pbuf) */
     ref = --(p->ref);
     SYS_ARCH_UNPROTECT(old_level);
+#endif /* XLWIP_PBUF_CACHE */
     /* this pbuf is no longer referenced to? */
     if (ref == 0) {
       /* remember next pbuf in chain for next iteration */
@@ -765,7 +785,7 @@ pbuf_free(struct pbuf *p)
       {
         /* is this a pbuf from the pool? */
         if (type == PBUF_POOL) {
-          memp_free(MEMP_PBUF_POOL, p);
+          PBUF_POOL_FREE(p);
         /* is this a ROM or RAM referencing pbuf? */
         } else if (type == PBUF_ROM || type == PBUF_REF) {
           memp_free(MEMP_PBUF, p);
@@ -821,7 +841,11 @@ pbuf_ref(struct pbuf *p)
 {
   /* pbuf given? */
   if (p != NULL) {
+#if XLWIP_PBUF_CACHE
+    __atomic_add_fetch(&p->ref, 1, __ATOMIC_RELAXED);
+#else /* XLWIP_PBUF_CACHE */
     SYS_ARCH_INC(p->ref, 1);
+#endif /* XLWIP_PBUF_CACHE */
     LWIP_ASSERT("pbuf ref overflow", p->ref > 0);
   }
 }
@@ -145,6 +145,10 @@ void *memp_malloc_fn(memp_t type, const char* file, const int line);
 void *memp_malloc(memp_t type);
 #endif
 void  memp_free(memp_t type, void *mem);
+#if XLWIP_PBUF_CACHE
+u16_t memp_malloc_bulk(memp_t type, void **mem, u16_t num);
+void  memp_free_bulk(memp_t type, void **mem, u16_t num);
+#endif /* XLWIP_PBUF_CACHE */
 
 #ifdef __cplusplus
 }
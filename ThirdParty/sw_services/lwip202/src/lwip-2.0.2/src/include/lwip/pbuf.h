@@ -137,6 +137,8 @@ typedef enum {
 #define PBUF_FLAG_LLMCAST   0x10U
 /** indicates this pbuf includes a TCP FIN flag */
 #define PBUF_FLAG_TCP_FIN   0x20U
+/** indicates ts_sec/ts_nsec hold the MAC timestamp of this packet */
+#define PBUF_FLAG_TIMESTAMP 0x40U
 
 /** Main packet buffer struct */
 struct pbuf {
@@ -170,6 +172,12 @@ struct pbuf {
    * the stack itself, or pbuf->next pointers from a chain.
    */
   u16_t ref;
+
+#if XLWIP_PTP_TIMESTAMP
+  /** MAC receive/transmit timestamp, valid if PBUF_FLAG_TIMESTAMP is set */
+  u32_t ts_sec;
+  u32_t ts_nsec;
+#endif
 };
 
 
@@ -57,6 +57,29 @@ enum loader_type {
 	ELF_LOADER = 0, FIT_LOADER = 1, LAST_LOADER = 2,
 };
 
+/* Loader flags. */
+/* Compare each section with the target memory and skip the copy if the
+ * contents already match, e.g. when the same firmware is restarted. */
+#define RPROC_LOADER_SKIP_UNCHANGED             0x1
+
+/**
+ * struct remoteproc_loader_copy_ops - segment copy engine
+ *
+ * Lets the platform offload segment copies to a DMA engine, such as the
+ * ZynqMP ZDMA. The loader keeps parsing the following sections while a
+ * transfer is in flight and waits for all of them before it relocates
+ * or returns.
+ *
+ * @start: queue a copy of len bytes from src to dst; return 0 if the
+ *         transfer was queued, non-0 to have the loader copy it with
+ *         the CPU instead.
+ * @wait:  wait for all queued transfers; return 0 if they all completed.
+ */
+struct remoteproc_loader_copy_ops {
+	int (*start) (void *arg, void *dst, const void *src, size_t len);
+	int (*wait) (void *arg);
+};
+
 /* Loader structure definition. */
 
 struct remoteproc_loader {
@@ -64,6 +87,11 @@ struct remoteproc_loader {
 	void *remote_firmware;
 	/* Pointer to firmware decoded info control block */
 	void *fw_decode_info;
+	/* RPROC_LOADER_* flags */
+	unsigned int flags;
+	/* Optional segment copy engine and its private data */
+	const struct remoteproc_loader_copy_ops *copy_ops;
+	void *copy_arg;
 
 	/* Loader callbacks. */
 	void *(*retrieve_entry) (struct remoteproc_loader * loader);
@@ -87,6 +115,9 @@ void *remoteproc_loader_retrieve_resource_section(struct remoteproc_loader
 						  *loader, unsigned int *size);
 int remoteproc_loader_load_remote_firmware(struct remoteproc_loader *loader);
 void *remoteproc_get_load_address(struct remoteproc_loader *loader);
+int remoteproc_loader_set_copy_ops(struct remoteproc_loader *loader,
+				   const struct remoteproc_loader_copy_ops *ops,
+				   void *arg);
 
 /* Supported loaders */
 extern int elf_loader_init(struct remoteproc_loader *loader);
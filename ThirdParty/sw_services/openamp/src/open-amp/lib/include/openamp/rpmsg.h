@@ -40,6 +40,7 @@
 
 /* The feature bitmap for virtio rpmsg */
 #define VIRTIO_RPMSG_F_NS	0	/* RP supports name service notifications */
+#define VIRTIO_RPMSG_F_BUFSZ	2	/* RP supports buffer size negotiation */
 #define RPMSG_NAME_SIZE     32
 #define RPMSG_BUF_HELD      (1U << 31) /* Flag to suggest to hold the buffer */
 
@@ -78,6 +79,23 @@ struct rpmsg_hdr_reserved
 	uint16_t idx;
 };
 
+/**
+ * struct rpmsg_vdev_config - config space of the rpmsg virtio device
+ * @buf_size: size of each vring buffer, rpmsg header included
+ * @reserved: reserved (must be zero)
+ *
+ * The vdev config space in the resource table holds this structure when the
+ * vdev advertises VIRTIO_RPMSG_F_BUFSZ. The side that provides the buffers
+ * (RPMSG Master) allocates them with @buf_size, clamped to
+ * RPMSG_MAX_BUFFER_SIZE, and writes back the size it actually used. The
+ * number of buffers per direction is the number of descriptors of the vring.
+ */
+OPENAMP_PACKED_BEGIN
+struct rpmsg_vdev_config {
+	uint32_t buf_size;
+	uint32_t reserved;
+} OPENAMP_PACKED_END;
+
 /**
  * struct rpmsg_ns_msg - dynamic name service announcement message
  * @name: name of remote service that is published
@@ -388,7 +406,21 @@ void *rpmsg_get_tx_payload_buffer(struct rpmsg_channel *rpdev, uint32_t *size,
 			    int wait);
 
 /**
- * @brief Sends a message in tx buffer allocated by rpmsg_alloc_tx_buffer()
+ * @brief Releases a tx buffer which will not be sent.
+ *
+ * This API gives back a tx buffer obtained by rpmsg_get_tx_payload_buffer()
+ * when the application decides not to send it. The buffer is reused by the
+ * next tx buffer request on the same remote device.
+ *
+ * @param[in] rpdev The rpmsg channel
+ * @param[in] txbuf TX buffer returned by rpmsg_get_tx_payload_buffer()
+ *
+ * @see rpmsg_get_tx_payload_buffer
+ */
+void rpmsg_release_tx_buffer(struct rpmsg_channel *rpdev, void *txbuf);
+
+/**
+ * @brief Sends a message in tx buffer allocated by rpmsg_get_tx_payload_buffer()
  * using explicit src/dst addresses.
  *
  * This function sends txbuf of length len to the remote dst address,
@@ -396,7 +428,7 @@ void *rpmsg_get_tx_payload_buffer(struct rpmsg_channel *rpdev, uint32_t *size,
  * The message will be sent to the remote processor which the rpdev
  * channel belongs to.
  * The application has to take the responsibility for:
- *  1. tx buffer allocation (rpmsg_alloc_tx_buffer() )
+ *  1. tx buffer allocation (rpmsg_get_tx_payload_buffer() )
  *  2. filling the data to be sent into the pre-allocated tx buffer
  *  3. not exceeding the buffer size when filling the data
  *  4. data cache coherency
@@ -407,7 +439,7 @@ void *rpmsg_get_tx_payload_buffer(struct rpmsg_channel *rpdev, uint32_t *size,
  * case the application should try to re-issue the
  * rpmsg_send_offchannel_nocopy() again and if it is still not possible to send
  * the message and the application wants to give it up from whatever reasons
- * the rpmsg_release_rx_buffer function could be called, passing the pointer to
+ * the rpmsg_release_tx_buffer function could be called, passing the pointer to
  * the tx buffer to be released as a parameter.
  *
  * @param[in] rpdev The rpmsg channel
@@ -418,7 +450,7 @@ void *rpmsg_get_tx_payload_buffer(struct rpmsg_channel *rpdev, uint32_t *size,
  *
  * @return number of bytes it has sent or negative error value on failure.
  *
- * @see rpmsg_alloc_tx_buffer
+ * @see rpmsg_get_tx_payload_buffer
  * @see rpmsg_sendto_nocopy
  * @see rpmsg_send_nocopy
  */
@@ -426,14 +458,14 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_channel *rpdev, uint32_t src,
 				 uint32_t dst, void *txbuf, int len);
 
 /**
- * @brief Sends a message in tx buffer allocated by rpmsg_alloc_tx_buffer()
+ * @brief Sends a message in tx buffer allocated by rpmsg_get_tx_payload_buffer()
  * across to the remote processor, specify dst.
  *
  * This function sends txbuf of length len to the remote dst address.
  * The message will be sent to the remote processor which the rpdev
  * channel belongs to, using rpdev's source address.
  * The application has to take the responsibility for:
- *  1. tx buffer allocation (rpmsg_alloc_tx_buffer() )
+ *  1. tx buffer allocation (rpmsg_get_tx_payload_buffer() )
  *  2. filling the data to be sent into the pre-allocated tx buffer
  *  3. not exceeding the buffer size when filling the data
  *  4. data cache coherency
@@ -443,7 +475,7 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_channel *rpdev, uint32_t src,
  * rpmsg_sendto_nocopy() function fails and returns an error. In that case the
  * application should try to re-issue the rpmsg_sendto_nocopy() again and if
  * it is still not possible to send the message and the application wants to
- * give it up from whatever reasons the rpmsg_release_rx_buffer function
+ * give it up from whatever reasons the rpmsg_release_tx_buffer function
  * could be called,
  * passing the pointer to the tx buffer to be released as a parameter.
  *
@@ -454,7 +486,7 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_channel *rpdev, uint32_t src,
  *
  * @return number of bytes it has sent or negative error value on failure.
  *
- * @see rpmsg_alloc_tx_buffer
+ * @see rpmsg_get_tx_payload_buffer
  * @see rpmsg_send_offchannel_nocopy
  * @see rpmsg_send_nocopy
  */
@@ -471,13 +503,13 @@ int rpmsg_sendto_nocopy(struct rpmsg_channel *rpdev, void *txbuf, int len,
 
 /**
  * @brief Sends a message in tx buffer allocated by
- * rpmsg_alloc_tx_buffer() across to the remote processor.
+ * rpmsg_get_tx_payload_buffer() across to the remote processor.
  *
  * This function sends txbuf of length len on the rpdev channel.
  * The message will be sent to the remote processor which the rpdev
  * channel belongs to, using rpdev's source and destination addresses.
  * The application has to take the responsibility for:
- *  1. tx buffer allocation (rpmsg_alloc_tx_buffer() )
+ *  1. tx buffer allocation (rpmsg_get_tx_payload_buffer() )
  *  2. filling the data to be sent into the pre-allocated tx buffer
  *  3. not exceeding the buffer size when filling the data
  *  4. data cache coherency
@@ -487,7 +519,7 @@ int rpmsg_sendto_nocopy(struct rpmsg_channel *rpdev, void *txbuf, int len,
  * rpmsg_send_nocopy() function fails and returns an error. In that case the
  * application should try to re-issue the rpmsg_send_nocopy() again and if
  * it is still not possible to send the message and the application wants to
- * give it up from whatever reasons the rpmsg_release_rx_buffer function
+ * give it up from whatever reasons the rpmsg_release_tx_buffer function
  * could be called, passing the pointer to the tx buffer to be released as a
  * parameter.
  *
@@ -497,7 +529,7 @@ int rpmsg_sendto_nocopy(struct rpmsg_channel *rpdev, void *txbuf, int len,
  *
  * @return 0 on success and an appropriate error value on failure
  *
- * @see rpmsg_alloc_tx_buffer
+ * @see rpmsg_get_tx_payload_buffer
  * @see rpmsg_send_offchannel_nocopy
  * @see rpmsg_sendto_nocopy
  */
@@ -40,7 +40,11 @@
 #include "metal/list.h"
 
 /* Configurable parameters */
+#ifndef RPMSG_BUFFER_SIZE
 #define RPMSG_BUFFER_SIZE                       512
+#endif
+/* Largest buffer: 16-bit payload length plus the 16 byte rpmsg header */
+#define RPMSG_MAX_BUFFER_SIZE                   (0xFFFF + 16)
 #define RPMSG_MAX_VQ_PER_RDEV                   2
 #define RPMSG_NS_EPT_ADDR                       0x35
 #define RPMSG_ADDR_BMP_SIZE                     4
@@ -83,6 +87,23 @@
 #define RPMSG_HDR_FROM_BUF(buf)             (struct rpmsg_hdr *)((char*)buf - \
                                             sizeof(struct rpmsg_hdr))
 
+/**
+ * rpmsg_tx_reclaim
+ *
+ * Bookkeeping kept at the start of a tx buffer that was reserved for a
+ * zero-copy send and then released unsent, so that the next tx buffer
+ * request can reuse it instead of taking a new one from the vring.
+ *
+ * @len  - total length of the buffer
+ * @idx  - vring descriptor index of the buffer
+ * @node - node in the remote device reclaim list
+ */
+struct rpmsg_tx_reclaim {
+	unsigned long len;
+	unsigned short idx;
+	struct metal_list node;
+};
+
 #if (RPMSG_DEBUG == true)
 #define RPMSG_ASSERT(_exp, _msg) do{ \
     if (!(_exp)){ openamp_print("%s - "_msg, __func__); while(1);} \
@@ -106,7 +127,9 @@ typedef void (*rpmsg_chnl_cb_t) (struct rpmsg_channel * rp_chl);
  * @proc                - reference to remote processor
  * @rp_channels         - rpmsg channels list for the device
  * @rp_endpoints        - rpmsg endpoints list for the device
+ * @tx_reclaim          - tx buffers released unsent, reused before the vring
  * @mem_pool            - shared memory pool
+ * @buff_size           - size of the buffers we provide (as RPMSG Master)
  * @bitmap              - bitmap for channels addresses
  * @channel_created     - create channel callback
  * @channel_destroyed   - delete channel callback
@@ -124,7 +147,9 @@ struct remote_device {
 	struct hil_proc *proc;
 	struct metal_list rp_channels;
 	struct metal_list rp_endpoints;
+	struct metal_list tx_reclaim;
 	struct sh_mem_pool *mem_pool;
+	unsigned long buff_size;
 	unsigned long bitmap[RPMSG_ADDR_BMP_SIZE];
 	rpmsg_chnl_cb_t channel_created;
 	rpmsg_chnl_cb_t channel_destroyed;
@@ -158,6 +183,8 @@ void rpmsg_return_buffer(struct remote_device *rdev, void *buffer,
 			 unsigned long len, unsigned short idx);
 void *rpmsg_get_tx_buffer(struct remote_device *rdev, unsigned long *len,
 			  unsigned short *idx);
+void rpmsg_reclaim_tx_buffer(struct remote_device *rdev, void *buffer,
+			     unsigned long len, unsigned short idx);
 void rpmsg_free_buffer(struct remote_device *rdev, void *buffer);
 void rpmsg_free_channel(struct rpmsg_channel *rp_chnl);
 void *rpmsg_get_rx_buffer(struct remote_device *rdev, unsigned long *len,
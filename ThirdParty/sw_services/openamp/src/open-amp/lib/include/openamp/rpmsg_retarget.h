@@ -18,6 +18,11 @@
 /* Proxy device endpoint ID */
 #define PROXY_ENDPOINT      127
 
+/* Write modes, see rpmsg_retarget_set_write_mode() */
+#define RPC_WRITE_BUFFERED  0x1	/* coalesce writes into one rpc */
+#define RPC_WRITE_LINE      0x2	/* with RPC_WRITE_BUFFERED, flush on '\n' */
+#define RPC_WRITE_ASYNC     0x4	/* do not wait for the proxy reply */
+
 typedef void (*rpc_shutdown_cb) (struct rpmsg_channel *);
 
 struct _rpc_data {
@@ -28,6 +33,16 @@ struct _rpc_data {
 	struct _sys_rpc *rpc;
 	struct _sys_rpc *rpc_response;
 	rpc_shutdown_cb shutdown_cb;
+	/* Coalesced write data, all for wbuf_fd */
+	struct _sys_rpc *wbuf;
+	int wbuf_fd;
+	unsigned int wbuf_len;
+	unsigned int wbuf_cap;
+	unsigned int write_mode;
+	unsigned int write_threshold;
+	/* Asynchronous writes not acknowledged yet, and first error */
+	atomic_int write_pending;
+	int write_error;
 };
 
 struct _sys_call_args {
@@ -47,3 +62,5 @@ struct _sys_rpc {
 int rpmsg_retarget_init(struct rpmsg_channel *rp_chnl, rpc_shutdown_cb cb);
 int rpmsg_retarget_deinit(struct rpmsg_channel *rp_chnl);
 int rpmsg_retarget_send(void *data, int len);
+int rpmsg_retarget_set_write_mode(unsigned int mode, unsigned int threshold);
+int rpmsg_retarget_flush(void);
@@ -71,6 +71,14 @@
 #define VIRTIO_TRANSPORT_F_START      28
 #define VIRTIO_TRANSPORT_F_END        32
 
+/*
+ * Role of the virtio device on its vrings. The master is the virtio
+ * driver: it adds buffers to the available ring and consumes the used
+ * ring. The slave is the virtio device and does the opposite.
+ */
+#define VIRTIO_DEV_MASTER	0UL
+#define VIRTIO_DEV_SLAVE	1UL
+
 typedef struct _virtio_dispatch_ virtio_dispatch;
 
 struct virtio_feature_desc {
@@ -102,6 +110,9 @@ struct virtio_device {
 	/* Virtio device specific features */
 	uint32_t features;
 
+	/* VIRTIO_DEV_MASTER or VIRTIO_DEV_SLAVE */
+	unsigned int role;
+
 	/* Virtio dispatch table */
 	virtio_dispatch *func;
 
@@ -67,6 +67,7 @@ typedef uint8_t boolean;
 #define VQ_RING_DESC_CHAIN_END                         32768
 #define VIRTQUEUE_FLAG_INDIRECT                        0x0001
 #define VIRTQUEUE_FLAG_EVENT_IDX                       0x0002
+#define VIRTQUEUE_FLAG_CB_DISABLED                     0x0004
 #define VIRTQUEUE_MAX_NAME_SZ                          32
 
 /* Support for indirect buffer descriptors. */
@@ -17,9 +17,24 @@ int send_rpc(void *data, int len);
 void rpc_cb(struct rpmsg_channel *rtl_rp_chnl, void *data, int len, void *priv,
 	    unsigned long src)
 {
+	struct _sys_rpc *response = data;
+
 	(void)priv;
 	(void)src;
 
+	/* The proxy answers in order, so while asynchronous writes are
+	 * outstanding the write replies are theirs: account them and do not
+	 * wake up the synchronous caller. */
+	if (response->id == WRITE_SYSCALL_ID &&
+	    atomic_load(&rpc_data->write_pending) > 0) {
+		if (response->sys_call_args.int_field1 < 0 &&
+		    !rpc_data->write_error)
+			rpc_data->write_error =
+				response->sys_call_args.int_field1;
+		atomic_fetch_sub(&rpc_data->write_pending, 1);
+		return;
+	}
+
 	memcpy(rpc_data->rpc_response, data, len);
 
 	atomic_flag_clear(&rpc_data->sync);
@@ -58,6 +73,20 @@ int rpmsg_retarget_init(struct rpmsg_channel *rp_chnl, rpc_shutdown_cb cb)
 	rpc_data->rpc_response = metal_allocate_memory(RPC_BUFF_SIZE);
 	rpc_data->shutdown_cb = cb;
 
+	/* Writes are synchronous and unbuffered until the mode is changed */
+	rpc_data->wbuf = metal_allocate_memory(RPC_BUFF_SIZE);
+	rpc_data->wbuf_fd = -1;
+	rpc_data->wbuf_len = 0;
+	rpc_data->wbuf_cap = RPC_BUFF_SIZE;
+	if ((int)rpc_data->wbuf_cap > rpmsg_get_buffer_size(rp_chnl))
+		rpc_data->wbuf_cap = rpmsg_get_buffer_size(rp_chnl);
+	/* Room for the rpc header and the stdout terminator */
+	rpc_data->wbuf_cap -= sizeof(struct _sys_rpc) + 1;
+	rpc_data->write_mode = 0;
+	rpc_data->write_threshold = rpc_data->wbuf_cap;
+	atomic_store(&rpc_data->write_pending, 0);
+	rpc_data->write_error = 0;
+
 	return 0;
 }
 
@@ -65,6 +94,8 @@ int rpmsg_retarget_deinit(struct rpmsg_channel *rp_chnl)
 {
 	(void)rp_chnl;
 
+	(void)rpmsg_retarget_flush();
+	metal_free_memory(rpc_data->wbuf);
 	metal_free_memory(rpc_data->rpc);
 	metal_free_memory(rpc_data->rpc_response);
 	metal_mutex_deinit(&rpc_data->rpc_lock);
@@ -88,6 +119,149 @@ static inline void rpmsg_retarget_wait(struct _rpc_data *rpc)
 	}
 }
 
+/*************************************************************************
+ *
+ *   FUNCTION
+ *
+ *       rpmsg_retarget_write_rpc
+ *
+ *   DESCRIPTION
+ *
+ *       Send a write rpc whose data is already in place and, unless
+ *       writes are asynchronous, wait for the proxy reply.
+ *
+ *************************************************************************/
+static int rpmsg_retarget_write_rpc(struct _sys_rpc *rpc, int fd, int len)
+{
+	int null_term = (fd == 1) ? 1 : 0;
+	int retval = -1;
+
+	rpc->id = WRITE_SYSCALL_ID;
+	rpc->sys_call_args.int_field1 = fd;
+	rpc->sys_call_args.int_field2 = len;
+	rpc->sys_call_args.data_len = len + null_term;
+	if (null_term)
+		rpc->sys_call_args.data[len] = 0;
+
+	if (rpc_data->write_mode & RPC_WRITE_ASYNC) {
+		atomic_fetch_add(&rpc_data->write_pending, 1);
+		if (send_rpc((void *)rpc, sizeof(struct _sys_rpc) + len +
+			     null_term) < 0) {
+			atomic_fetch_sub(&rpc_data->write_pending, 1);
+			return -1;
+		}
+		return len;
+	}
+
+	send_rpc((void *)rpc, sizeof(struct _sys_rpc) + len + null_term);
+
+	/* Wait for response from proxy on master */
+	rpmsg_retarget_wait(rpc_data);
+
+	if (rpc_data->rpc_response->id == WRITE_SYSCALL_ID) {
+		retval = rpc_data->rpc_response->sys_call_args.int_field1;
+	}
+
+	return retval;
+}
+
+/*************************************************************************
+ *
+ *   FUNCTION
+ *
+ *       rpmsg_retarget_write_flush
+ *
+ *   DESCRIPTION
+ *
+ *       Send the coalesced write data, if any. Called with rpc_lock held.
+ *
+ *************************************************************************/
+static int rpmsg_retarget_write_flush(void)
+{
+	int len = (int)rpc_data->wbuf_len;
+
+	if (!len)
+		return 0;
+
+	rpc_data->wbuf_len = 0;
+	return rpmsg_retarget_write_rpc(rpc_data->wbuf, rpc_data->wbuf_fd,
+					len) < 0 ? -1 : 0;
+}
+
+/*************************************************************************
+ *
+ *   FUNCTION
+ *
+ *       rpmsg_retarget_set_write_mode
+ *
+ *   DESCRIPTION
+ *
+ *       Select how _write talks to the proxy. With RPC_WRITE_BUFFERED,
+ *       writes to the same file are coalesced and sent once threshold
+ *       bytes are buffered, the buffer is full, another file is written
+ *       or read, a '\n' is written with RPC_WRITE_LINE, or on
+ *       rpmsg_retarget_flush(). With RPC_WRITE_ASYNC, write rpcs do not
+ *       wait for the proxy reply; errors are returned by
+ *       rpmsg_retarget_flush(). A threshold of 0 means the buffer size.
+ *
+ *************************************************************************/
+int rpmsg_retarget_set_write_mode(unsigned int mode, unsigned int threshold)
+{
+	int retval;
+
+	if (!rpc_data)
+		return -1;
+
+	retval = rpmsg_retarget_flush();
+
+	metal_mutex_acquire(&rpc_data->rpc_lock);
+	rpc_data->write_mode = mode;
+	if (!threshold || threshold > rpc_data->wbuf_cap)
+		threshold = rpc_data->wbuf_cap;
+	rpc_data->write_threshold = threshold;
+	metal_mutex_release(&rpc_data->rpc_lock);
+
+	return retval;
+}
+
+/*************************************************************************
+ *
+ *   FUNCTION
+ *
+ *       rpmsg_retarget_flush
+ *
+ *   DESCRIPTION
+ *
+ *       Send the coalesced write data and wait for the replies of all the
+ *       asynchronous writes. Returns the first write error since the
+ *       previous flush, or 0.
+ *
+ *************************************************************************/
+int rpmsg_retarget_flush(void)
+{
+	struct hil_proc *proc;
+	int retval;
+
+	if (!rpc_data)
+		return -1;
+
+	metal_mutex_acquire(&rpc_data->rpc_lock);
+	retval = rpmsg_retarget_write_flush();
+	metal_mutex_release(&rpc_data->rpc_lock);
+
+	proc = rpc_data->rpmsg_chnl->rdev->proc;
+	while (atomic_load(&rpc_data->write_pending) > 0) {
+		hil_poll(proc, 0);
+	}
+
+	if (rpc_data->write_error) {
+		retval = rpc_data->write_error;
+		rpc_data->write_error = 0;
+	}
+
+	return retval;
+}
+
 /*************************************************************************
  *
  *   FUNCTION
@@ -121,6 +295,7 @@ int _open(const char *filename, int flags, int mode)
 
 	/* Transmit rpc request */
 	metal_mutex_acquire(&rpc_data->rpc_lock);
+	rpmsg_retarget_write_flush();
 	send_rpc((void *)rpc_data->rpc, payload_size);
 	metal_mutex_release(&rpc_data->rpc_lock);
 
@@ -164,6 +339,7 @@ int _read(int fd, char *buffer, int buflen)
 
 	/* Transmit rpc request */
 	metal_mutex_acquire(&rpc_data->rpc_lock);
+	rpmsg_retarget_write_flush();
 	send_rpc((void *)rpc_data->rpc, payload_size);
 	metal_mutex_release(&rpc_data->rpc_lock);
 
@@ -198,38 +374,47 @@ int _read(int fd, char *buffer, int buflen)
 int _write(int fd, const char *ptr, int len)
 {
 	int retval = -1;
-	int payload_size = sizeof(struct _sys_rpc) + len;
-	int null_term = 0;
+	unsigned int mode;
 
-	if (fd == 1) {
-		null_term = 1;
-	}
-	if (!rpc_data)
+	if (!rpc_data || len < 0)
 		return retval;
 
-	rpc_data->rpc->id = WRITE_SYSCALL_ID;
-	rpc_data->rpc->sys_call_args.int_field1 = fd;
-	rpc_data->rpc->sys_call_args.int_field2 = len;
-	rpc_data->rpc->sys_call_args.data_len = len + null_term;
-	memcpy(rpc_data->rpc->sys_call_args.data, ptr, len);
-	if (null_term) {
-		*(char *)(rpc_data->rpc->sys_call_args.data + len + null_term) =
-		    0;
+	metal_mutex_acquire(&rpc_data->rpc_lock);
+	mode = rpc_data->write_mode;
+
+	if (!(mode & RPC_WRITE_BUFFERED) ||
+	    (unsigned int)len >= rpc_data->write_threshold) {
+		/* Keep the file order: buffered data goes first */
+		if (rpmsg_retarget_write_flush() == 0) {
+			memcpy(rpc_data->rpc->sys_call_args.data, ptr, len);
+			retval = rpmsg_retarget_write_rpc(rpc_data->rpc, fd,
+							  len);
+		}
+		metal_mutex_release(&rpc_data->rpc_lock);
+		return retval;
 	}
 
-	metal_mutex_acquire(&rpc_data->rpc_lock);
-	send_rpc((void *)rpc_data->rpc, payload_size);
-	metal_mutex_release(&rpc_data->rpc_lock);
+	if ((rpc_data->wbuf_len && rpc_data->wbuf_fd != fd) ||
+	    rpc_data->wbuf_len + len > rpc_data->wbuf_cap) {
+		if (rpmsg_retarget_write_flush() < 0)
+			goto out;
+	}
 
-	/* Wait for response from proxy on master */
-	rpmsg_retarget_wait(rpc_data);
+	rpc_data->wbuf_fd = fd;
+	memcpy(rpc_data->wbuf->sys_call_args.data + rpc_data->wbuf_len, ptr,
+	       len);
+	rpc_data->wbuf_len += len;
+	retval = len;
 
-	if (rpc_data->rpc_response->id == WRITE_SYSCALL_ID) {
-		retval = rpc_data->rpc_response->sys_call_args.int_field1;
+	if (rpc_data->wbuf_len >= rpc_data->write_threshold ||
+	    ((mode & RPC_WRITE_LINE) && memchr(ptr, '\n', len))) {
+		if (rpmsg_retarget_write_flush() < 0)
+			retval = -1;
 	}
 
+out:
+	metal_mutex_release(&rpc_data->rpc_lock);
 	return retval;
-
 }
 
 /*************************************************************************
@@ -256,6 +441,7 @@ int _close(int fd)
 	rpc_data->rpc->sys_call_args.data_len = 0;	/*not used */
 
 	metal_mutex_acquire(&rpc_data->rpc_lock);
+	rpmsg_retarget_write_flush();
 	send_rpc((void *)rpc_data->rpc, payload_size);
 	metal_mutex_release(&rpc_data->rpc_lock);
 
@@ -43,7 +43,10 @@ static int elf_loader_seek_and_read(void *firmware, void *destination,
 				    Elf32_Off offset, Elf32_Word size);
 static int elf_loader_read_headers(void *firmware,
 				   struct elf_decode_info *elf_info);
-static int elf_loader_load_sections(void *firmware,
+static int elf_loader_copy_section(struct remoteproc_loader *loader,
+				   void *firmware, Elf32_Shdr * section,
+				   int *queued);
+static int elf_loader_load_sections(struct remoteproc_loader *loader,
 				    struct elf_decode_info *elf_info);
 static int elf_loader_get_decode_info(void *firmware,
 				      struct elf_decode_info *elf_info);
@@ -207,7 +210,7 @@ int elf_loader_load_remote_firmware(struct remoteproc_loader *loader)
 	int status;
 
 	/* Load ELF sections. */
-	status = elf_loader_load_sections(elf_info->firmware, elf_info);
+	status = elf_loader_load_sections(loader, elf_info);
 
 	if (!status) {
 
@@ -538,20 +541,60 @@ static int elf_loader_read_headers(void *firmware,
 }
 
 /**
- * elf_loader_file_read_sections
+ * elf_loader_copy_section
  *
- * Reads the ELF section contents from the specified file containing
- * the ELF object.
+ * Copies the contents of a section to its load address, either with
+ * the CPU or by queueing a transfer on the loader copy engine.
  *
+ * @param loader   - pointer to remoteproc loader
  * @param firmware - firmware to read from.
+ * @param section  - header of the section to copy.
+ * @param queued   - set to 1 if a transfer was queued.
+ *
+ * @return  - 0 if success, error otherwise
+ */
+static int elf_loader_copy_section(struct remoteproc_loader *loader,
+				   void *firmware, Elf32_Shdr * section,
+				   int *queued)
+{
+	char *destination = (char *)(section->sh_addr);
+	char *src = (char *)firmware + section->sh_offset;
+
+	/* Leave the section alone if the target already holds it. */
+	if ((loader->flags & RPROC_LOADER_SKIP_UNCHANGED) &&
+	    !memcmp(destination, src, section->sh_size)) {
+		return 0;
+	}
+
+	if (loader->copy_ops &&
+	    !loader->copy_ops->start(loader->copy_arg, destination, src,
+				     section->sh_size)) {
+		*queued = 1;
+		return 0;
+	}
+
+	return elf_loader_seek_and_read(firmware, destination,
+					section->sh_offset, section->sh_size);
+}
+
+/**
+ * elf_loader_load_sections
+ *
+ * Reads the ELF section contents from the specified file containing
+ * the ELF object. Sections without file contents (BSS, heap, stack) are
+ * not touched; the remote startup code clears them.
+ *
+ * @param loader   - pointer to remoteproc loader
  * @param elf_info - ELF object decode info container.
  *
  * @return  - 0 if success, error otherwise
  */
-static int elf_loader_load_sections(void *firmware,
+static int elf_loader_load_sections(struct remoteproc_loader *loader,
 				    struct elf_decode_info *elf_info)
 {
+	void *firmware = elf_info->firmware;
 	int status = 0;
+	int queued = 0;
 	Elf32_Shdr *current = (Elf32_Shdr *) (elf_info->section_headers_start);
 
 	/* Traverse all sections except the reserved null section. */
@@ -563,19 +606,13 @@ static int elf_loader_load_sections(void *firmware,
 
 		/* Make sure the section can be allocated and is not empty. */
 		if ((current->sh_flags & SHF_ALLOC) && (current->sh_size)) {
-			char *destination = NULL;
-
 			/* Check if the section is part of runtime and is not section with
 			 * no-load attributes such as BSS or heap. */
 			if ((current->sh_type & SHT_NOBITS) == 0) {
-				/* Compute the destination address where the section should
-				 * be copied. */
-				destination = (char *)(current->sh_addr);
-				status =
-				    elf_loader_seek_and_read(firmware,
-							     destination,
-							     current->sh_offset,
-							     current->sh_size);
+				status = elf_loader_copy_section(loader,
+								 firmware,
+								 current,
+								 &queued);
 			}
 		}
 
@@ -583,6 +620,11 @@ static int elf_loader_load_sections(void *firmware,
 		section_count--;
 	}
 
+	/* Relocation reads the loaded sections, so wait for the copies. */
+	if (queued && loader->copy_ops->wait(loader->copy_arg) && !status) {
+		status = RPROC_ERR_LOADER;
+	}
+
 	/* Return status to caller. */
 	return (status);
 }
@@ -249,3 +249,34 @@ void *remoteproc_get_load_address(struct remoteproc_loader *loader)
 		return RPROC_ERR_PTR;
 	}
 }
+
+/**
+ * remoteproc_loader_set_copy_ops
+ *
+ * Installs the engine used to copy firmware segments. Passing NULL
+ * ops reverts to CPU copies.
+ *
+ * @param loader - pointer to remoteproc loader
+ * @param ops    - segment copy operations
+ * @param arg    - private data passed to the operations
+ *
+ * @return  - 0 if success, error otherwise
+ */
+int remoteproc_loader_set_copy_ops(struct remoteproc_loader *loader,
+				   const struct remoteproc_loader_copy_ops *ops,
+				   void *arg)
+{
+
+	if (!loader) {
+		return RPROC_ERR_PARAM;
+	}
+
+	if (ops && (!ops->start || !ops->wait)) {
+		return RPROC_ERR_PARAM;
+	}
+
+	loader->copy_ops = ops;
+	loader->copy_arg = arg;
+
+	return RPROC_SUCCESS;
+}
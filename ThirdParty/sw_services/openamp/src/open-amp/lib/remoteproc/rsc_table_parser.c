@@ -212,6 +212,12 @@ int handle_vdev_rsc(struct remote_proc *rproc, void *rsc)
 		return RPROC_ERR_RSC_TAB_RSVD;
 	}
 
+	/* Buffer size negotiation needs the rpmsg config space */
+	if ((vdev_rsc->dfeatures & (1 << VIRTIO_RPMSG_F_BUFSZ)) &&
+	    vdev_rsc->config_len < sizeof(struct rpmsg_vdev_config)) {
+		return RPROC_ERR_RSC_TAB_TRUNC;
+	}
+
 	/* Get the Virtio device from HIL proc */
 	vdev = hil_get_vdev_info(rproc->proc);
 
@@ -62,6 +62,11 @@
 
 /* Local functions */
 static int rpmsg_rdev_init_channels(struct remote_device *rdev);
+static unsigned long rpmsg_rdev_negotiate_buffer_size(
+					struct remote_device *rdev);
+static void *rpmsg_rdev_get_config(struct virtio_device *dev,
+				   uint32_t offset, int *length);
+static void rpmsg_rdev_negotiate_event_idx(struct remote_device *rdev);
 
 /* Ops table for virtio device */
 virtio_dispatch rpmsg_rdev_config_ops = {
@@ -128,10 +133,16 @@ int rpmsg_rdev_init(struct hil_proc *proc,
 	/* Restrict the ept address - zero address can't be assigned */
 	rdev_loc->bitmap[0] = 1;
 
+	/* Initialize list of tx buffers released unsent */
+	metal_list_init(&rdev_loc->tx_reclaim);
+
 	/* Initialize the virtio device */
 	virt_dev = &rdev_loc->virt_dev;
 	virt_dev->device = proc;
 	virt_dev->func = &rpmsg_rdev_config_ops;
+	/* We drive the vrings when the other side is the RPMSG Remote */
+	virt_dev->role = (role == RPMSG_REMOTE) ? VIRTIO_DEV_MASTER :
+						  VIRTIO_DEV_SLAVE;
 	if (virt_dev->func->set_features != RPMSG_NULL) {
 		virt_dev->func->set_features(virt_dev, proc->vdev.dfeatures);
 	}
@@ -141,10 +152,11 @@ int rpmsg_rdev_init(struct hil_proc *proc,
 		 * Since device is RPMSG Remote so we need to manage the
 		 * shared buffers. Create shared memory pool to handle buffers.
 		 */
+		rdev_loc->buff_size = rpmsg_rdev_negotiate_buffer_size(rdev_loc);
 		shm = hil_get_shm_info(proc);
 		rdev_loc->mem_pool =
 		    sh_mem_create_pool(shm->start_addr, shm->size,
-				       RPMSG_BUFFER_SIZE);
+				       rdev_loc->buff_size);
 
 		if (!rdev_loc->mem_pool) {
 			return RPMSG_ERR_NO_MEM;
@@ -352,6 +364,69 @@ int rpmsg_rdev_init_channels(struct remote_device *rdev)
 	return RPMSG_SUCCESS;
 }
 
+/**
+ * rpmsg_rdev_negotiate_buffer_size
+ *
+ * This function returns the size of the buffers we provide as RPMSG Master.
+ * If the vdev advertises VIRTIO_RPMSG_F_BUFSZ the size requested in the
+ * vdev config space is used, clamped to what an rpmsg header can describe,
+ * and the size actually used is written back for the remote.
+ *
+ * @param rdev - pointer to remote device
+ *
+ * @return - buffer size including the rpmsg header
+ *
+ */
+static unsigned long rpmsg_rdev_negotiate_buffer_size(
+					struct remote_device *rdev)
+{
+	struct virtio_device *virt_dev = &rdev->virt_dev;
+	struct rpmsg_vdev_config config;
+
+	if (!(virt_dev->features & (1 << VIRTIO_RPMSG_F_BUFSZ)))
+		return RPMSG_BUFFER_SIZE;
+
+	rpmsg_rdev_read_config(virt_dev, 0, &config, sizeof(config));
+
+	if (config.buf_size <= sizeof(struct rpmsg_hdr))
+		config.buf_size = RPMSG_BUFFER_SIZE;
+	else if (config.buf_size > RPMSG_MAX_BUFFER_SIZE)
+		config.buf_size = RPMSG_MAX_BUFFER_SIZE;
+
+	rpmsg_rdev_write_config(virt_dev, 0, &config, sizeof(config));
+
+	return config.buf_size;
+}
+
+/**
+ * rpmsg_rdev_negotiate_event_idx
+ *
+ * This function settles VIRTIO_RING_F_EVENT_IDX before the virtqueues are
+ * created. As RPMSG Master we accept it whenever the vdev offers it; as
+ * RPMSG Remote we only use it if the master has accepted it in gfeatures,
+ * since both sides have to publish their event indices.
+ *
+ * @param rdev - pointer to remote device
+ *
+ */
+static void rpmsg_rdev_negotiate_event_idx(struct remote_device *rdev)
+{
+	struct virtio_device *virt_dev = &rdev->virt_dev;
+	struct fw_rsc_vdev *vdev_rsc = rdev->proc->vdev.vdev_info;
+
+	if (!(virt_dev->features & VIRTIO_RING_F_EVENT_IDX))
+		return;
+
+	if (!vdev_rsc) {
+		virt_dev->features &= ~VIRTIO_RING_F_EVENT_IDX;
+	} else if (rdev->role == RPMSG_REMOTE) {
+		vdev_rsc->gfeatures |= VIRTIO_RING_F_EVENT_IDX;
+		atomic_thread_fence(memory_order_seq_cst);
+	} else if (!(vdev_rsc->gfeatures & VIRTIO_RING_F_EVENT_IDX)) {
+		virt_dev->features &= ~VIRTIO_RING_F_EVENT_IDX;
+	}
+}
+
 /**
  * check if the remote is ready to start RPMsg communication
  */
@@ -408,6 +483,8 @@ int rpmsg_rdev_create_virtqueues(struct virtio_device *dev, int flags, int nvqs,
 		return RPMSG_ERR_MAX_VQ;
 	}
 
+	rpmsg_rdev_negotiate_event_idx(rdev);
+
 	/* Create virtqueue for each vring. */
 	for (idx = 0; idx < num_vrings; idx++) {
 
@@ -444,7 +521,7 @@ int rpmsg_rdev_create_virtqueues(struct virtio_device *dev, int flags, int nvqs,
 
 	if (rdev->role == RPMSG_REMOTE) {
 		sg.io = rdev->proc->sh_buff.io;
-		sg.len = RPMSG_BUFFER_SIZE;
+		sg.len = rdev->buff_size;
 		for (idx = 0; ((idx < rdev->rvq->vq_nentries)
 			       && (idx < rdev->mem_pool->total_buffs / 2));
 		     idx++) {
@@ -461,7 +538,7 @@ int rpmsg_rdev_create_virtqueues(struct virtio_device *dev, int flags, int nvqs,
 			metal_io_block_set(sg.io,
 				metal_io_virt_to_offset(sg.io, buffer),
 				0x00,
-				RPMSG_BUFFER_SIZE);
+				rdev->buff_size);
 			status =
 			    virtqueue_add_buffer(rdev->rvq, &sg, 0, 1,
 						 buffer);
@@ -526,26 +603,49 @@ uint32_t rpmsg_rdev_negotiate_feature(struct virtio_device *dev,
  * configuration region. This region is encoded in the same endian as
  * the guest.
  */
+static void *rpmsg_rdev_get_config(struct virtio_device *dev,
+				   uint32_t offset, int *length)
+{
+	struct hil_proc *proc = dev->device;
+	struct fw_rsc_vdev *vdev_rsc = proc->vdev.vdev_info;
+
+	if (!vdev_rsc || offset >= vdev_rsc->config_len || *length < 0)
+		return RPMSG_NULL;
+
+	/* Do not access past the end of the config space */
+	if ((uint32_t)*length > vdev_rsc->config_len - offset)
+		*length = (int)(vdev_rsc->config_len - offset);
+
+	/* The config space lies right after the vrings of the vdev */
+	return (char *)&vdev_rsc->vring[vdev_rsc->num_of_vrings] + offset;
+}
+
 void rpmsg_rdev_read_config(struct virtio_device *dev, uint32_t offset,
 			    void *dst, int length)
 {
-	(void)dev;
-	(void)offset;
-	(void)dst;
-	(void)length;
+	void *config;
 
-	return;
+	memset(dst, 0x00, (size_t)length);
+
+	config = rpmsg_rdev_get_config(dev, offset, &length);
+	if (!config)
+		return;
+
+	atomic_thread_fence(memory_order_seq_cst);
+	memcpy(dst, config, (size_t)length);
 }
 
 void rpmsg_rdev_write_config(struct virtio_device *dev, uint32_t offset,
 			     void *src, int length)
 {
-	(void)dev;
-	(void)offset;
-	(void)src;
-	(void)length;
+	void *config;
 
-	return;
+	config = rpmsg_rdev_get_config(dev, offset, &length);
+	if (!config)
+		return;
+
+	memcpy(config, src, (size_t)length);
+	atomic_thread_fence(memory_order_seq_cst);
 }
 
 void rpmsg_rdev_reset(struct virtio_device *dev)
@@ -60,6 +60,29 @@
 #include "metal/cache.h"
 #include "metal/sleep.h"
 
+/**
+ * rpmsg_get_tx_buffer_length
+ *
+ * Returns the total length of a tx buffer reserved for a zero-copy send.
+ * Buffers provided by us (RPMSG Master) all have the negotiated size and
+ * may not have a descriptor yet, buffers provided by the other side are
+ * looked up from their descriptor.
+ *
+ * @param rdev - pointer to remote device
+ * @param idx  - buffer index
+ *
+ * @return - buffer length including the rpmsg header
+ *
+ */
+static unsigned long rpmsg_get_tx_buffer_length(struct remote_device *rdev,
+						unsigned short idx)
+{
+	if (rdev->role == RPMSG_REMOTE)
+		return rdev->buff_size;
+
+	return (unsigned long)virtqueue_get_buffer_length(rdev->tvq, idx);
+}
+
 /**
  * rpmsg_init
  *
@@ -241,9 +264,9 @@ int rpmsg_get_buffer_size(struct rpmsg_channel *rp_chnl)
 	if (rdev->role == RPMSG_REMOTE) {
 		/*
 		 * If device role is Remote then buffers are provided by us
-		 * (RPMSG Master), so just provide the macro.
+		 * (RPMSG Master), so just provide the negotiated size.
 		 */
-		length = RPMSG_BUFFER_SIZE - sizeof(struct rpmsg_hdr);
+		length = (int)rdev->buff_size - sizeof(struct rpmsg_hdr);
 	} else {
 		/*
 		 * If other core is Master then buffers are provided by it,
@@ -355,14 +378,29 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_channel *rpdev, uint32_t src,
 	struct rpmsg_hdr *hdr;
 	struct remote_device *rdev;
 	struct rpmsg_hdr_reserved * reserved = NULL;
+	unsigned long buff_len;
 	int status;
 
-	if (!rpdev || !txbuf)
+	if (!rpdev || !txbuf || len < 0)
 	    return RPMSG_ERR_PARAM;
 
 	rdev = rpdev->rdev;
 	hdr = RPMSG_HDR_FROM_BUF(txbuf);
 
+	/* Validate device state */
+	if (rpdev->state != RPMSG_CHNL_STATE_ACTIVE
+	    || rdev->state != RPMSG_DEV_STATE_ACTIVE) {
+		return RPMSG_ERR_DEV_STATE;
+	}
+
+	/* Get the pointer to the reserved field that contains the index */
+	reserved = (struct rpmsg_hdr_reserved*)&hdr->reserved;
+	buff_len = rpmsg_get_tx_buffer_length(rdev, reserved->idx);
+
+	if ((unsigned long)len > buff_len - sizeof(struct rpmsg_hdr)) {
+		return RPMSG_ERR_BUFF_SIZE;
+	}
+
 	/* Initialize RPMSG header. */
 	hdr->dst = dst;
 	hdr->src = src;
@@ -370,16 +408,9 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_channel *rpdev, uint32_t src,
 	hdr->flags = 0;
 	hdr->reserved &= (~RPMSG_BUF_HELD);
 
-	/* Get the pointer to the reserved field that contains buffer size and
-	 * the index */
-	reserved = (struct rpmsg_hdr_reserved*)&hdr->reserved;
-
 	metal_mutex_acquire(&rdev->lock);
 
-	status = rpmsg_enqueue_buffer(rdev, hdr,
-			(unsigned long)virtqueue_get_buffer_length(
-			rdev->tvq, reserved->idx),
-			reserved->idx);
+	status = rpmsg_enqueue_buffer(rdev, hdr, buff_len, reserved->idx);
 	if (status == RPMSG_SUCCESS) {
 		/* Let the other side know that there is a job to process. */
 		virtqueue_kick(rdev->tvq);
@@ -392,6 +423,28 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_channel *rpdev, uint32_t src,
 	return status;
 }
 
+void rpmsg_release_tx_buffer(struct rpmsg_channel *rpdev, void *txbuf)
+{
+	struct rpmsg_hdr *hdr;
+	struct remote_device *rdev;
+	struct rpmsg_hdr_reserved *reserved;
+
+	if (!rpdev || !txbuf)
+		return;
+
+	rdev = rpdev->rdev;
+	hdr = RPMSG_HDR_FROM_BUF(txbuf);
+	reserved = (struct rpmsg_hdr_reserved*)&hdr->reserved;
+
+	metal_mutex_acquire(&rdev->lock);
+
+	rpmsg_reclaim_tx_buffer(rdev, hdr,
+				rpmsg_get_tx_buffer_length(rdev, reserved->idx),
+				reserved->idx);
+
+	metal_mutex_release(&rdev->lock);
+}
+
 /**
  * rpmsg_create_ept
  *
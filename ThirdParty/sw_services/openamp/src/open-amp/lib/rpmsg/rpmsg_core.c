@@ -57,6 +57,9 @@
 /* Internal functions */
 static void rpmsg_rx_callback(struct virtqueue *vq);
 static void rpmsg_tx_callback(struct virtqueue *vq);
+static void *rpmsg_get_next_rx_buffer(struct remote_device *rdev,
+				      unsigned long *len,
+				      unsigned short *idx);
 
 /**
  * rpmsg_memb_match
@@ -177,6 +180,9 @@ int rpmsg_start_ipc(struct remote_device *rdev)
 		}
 	}
 
+	/* Ask the other side to notify us of received messages */
+	virtqueue_enable_cb(rdev->rvq);
+
 	/* Initialize notifications for vring. */
 	if (rdev->role == RPMSG_MASTER) {
 		vqs[0] = rdev->tvq;
@@ -478,12 +484,25 @@ void *rpmsg_get_tx_buffer(struct remote_device *rdev, unsigned long *len,
 			  unsigned short *idx)
 {
 	void *data;
+	struct metal_list *node;
+	struct rpmsg_tx_reclaim *reclaim;
+
+	/* Reuse tx buffers released unsent before taking new ones */
+	node = metal_list_first(&rdev->tx_reclaim);
+	if (node) {
+		reclaim = metal_container_of(node, struct rpmsg_tx_reclaim,
+					     node);
+		metal_list_del(node);
+		*len = reclaim->len;
+		*idx = reclaim->idx;
+		return reclaim;
+	}
 
 	if (rdev->role == RPMSG_REMOTE) {
 		data = virtqueue_get_buffer(rdev->tvq, (uint32_t *) len, idx);
 		if (data == RPMSG_NULL) {
 			data = sh_mem_get_buffer(rdev->mem_pool);
-			*len = RPMSG_BUFFER_SIZE;
+			*len = rdev->buff_size;
 		}
 	} else {
 		data =
@@ -493,6 +512,31 @@ void *rpmsg_get_tx_buffer(struct remote_device *rdev, unsigned long *len,
 	return data;
 }
 
+/**
+ * rpmsg_reclaim_tx_buffer
+ *
+ * Gives back a tx buffer obtained by rpmsg_get_tx_buffer which will not be
+ * sent. The buffer is kept on the remote device and returned by the next
+ * rpmsg_get_tx_buffer call, since a buffer taken from the vring cannot be
+ * put back to it without sending it to the other side.
+ *
+ * @param rdev   - pointer to remote core
+ * @param buffer - buffer to reclaim
+ * @param len    - buffer length
+ * @param idx    - buffer index
+ *
+ */
+void rpmsg_reclaim_tx_buffer(struct remote_device *rdev, void *buffer,
+			     unsigned long len, unsigned short idx)
+{
+	struct rpmsg_tx_reclaim *reclaim;
+
+	reclaim = (struct rpmsg_tx_reclaim *)buffer;
+	reclaim->len = len;
+	reclaim->idx = idx;
+	metal_list_add_tail(&rdev->tx_reclaim, &reclaim->node);
+}
+
 /**
  * rpmsg_get_rx_buffer
  *
@@ -598,10 +642,43 @@ static void rpmsg_tx_callback(struct virtqueue *vq)
 	}
 }
 
+/**
+ * rpmsg_get_next_rx_buffer
+ *
+ * Returns the next received buffer while the rx virtqueue is being drained.
+ * Notifications are suppressed as long as there is something to process and
+ * are re-enabled once the ring is empty. Must be called with the remote
+ * device lock held.
+ *
+ * @param rdev - pointer to remote device
+ * @param len  - pointer to hold the buffer length
+ * @param idx  - pointer to hold the buffer index
+ *
+ * @return - pointer to received buffer, or NULL once the ring is drained
+ *
+ */
+static void *rpmsg_get_next_rx_buffer(struct remote_device *rdev,
+				      unsigned long *len,
+				      unsigned short *idx)
+{
+	void *buffer;
+
+	while (!(buffer = rpmsg_get_rx_buffer(rdev, len, idx))) {
+		/* Buffers added while re-enabling are picked up here */
+		if (!virtqueue_enable_cb(rdev->rvq))
+			break;
+		virtqueue_disable_cb(rdev->rvq);
+	}
+
+	return buffer;
+}
+
 /**
  * rpmsg_rx_callback
  *
- * Rx callback function.
+ * Rx callback function. The sender is asked not to notify us again until
+ * all pending messages have been processed, so a burst of messages costs a
+ * single interrupt.
  *
  * @param vq - pointer to virtqueue on which messages is received
  *
@@ -623,7 +700,9 @@ void rpmsg_rx_callback(struct virtqueue *vq)
 	metal_mutex_acquire(&rdev->lock);
 
 	/* Process the received data from remote node */
-	rp_hdr = (struct rpmsg_hdr *)rpmsg_get_rx_buffer(rdev, &len, &idx);
+	virtqueue_disable_cb(rdev->rvq);
+	rp_hdr = (struct rpmsg_hdr *)rpmsg_get_next_rx_buffer(rdev, &len,
+							      &idx);
 
 	metal_mutex_release(&rdev->lock);
 
@@ -635,6 +714,9 @@ void rpmsg_rx_callback(struct virtqueue *vq)
 
 		if (!rp_ept) {
 			/* Fatal error no endpoint for the given dst addr. */
+			metal_mutex_acquire(&rdev->lock);
+			virtqueue_enable_cb(rdev->rvq);
+			metal_mutex_release(&rdev->lock);
 			return;
 		}
 
@@ -676,8 +758,9 @@ void rpmsg_rx_callback(struct virtqueue *vq)
 			rpmsg_return_buffer(rdev, rp_hdr, len, idx);
 		}
 
-		rp_hdr =
-		    (struct rpmsg_hdr *)rpmsg_get_rx_buffer(rdev, &len, &idx);
+		rp_hdr = (struct rpmsg_hdr *)rpmsg_get_next_rx_buffer(rdev,
+								      &len,
+								      &idx);
 		metal_mutex_release(&rdev->lock);
 	}
 }
@@ -26,6 +26,7 @@
 
 #include <string.h>
 #include "openamp/virtqueue.h"
+#include "openamp/virtio.h"
 #include "metal/atomic.h"
 #include "metal/dma.h"
 #include "metal/io.h"
@@ -41,6 +42,11 @@ static void vq_ring_free_chain(struct virtqueue *, uint16_t);
 static int vq_ring_must_notify_host(struct virtqueue *vq);
 static void vq_ring_notify_host(struct virtqueue *vq);
 static int virtqueue_nused(struct virtqueue *vq);
+static int virtqueue_navail(struct virtqueue *vq);
+static void vq_ring_set_avail_event(struct virtqueue *vq, uint16_t idx);
+
+/* The slave side consumes the available ring and fills the used ring. */
+#define VQ_IS_SLAVE(vq)	((vq)->vq_dev->role == VIRTIO_DEV_SLAVE)
 
 /**
  * virtqueue_create - Creates new VirtIO queue
@@ -99,6 +105,9 @@ int virtqueue_create(struct virtio_device *virt_dev, unsigned short id,
 		vq->notify = notify;
 		vq->shm_io = shm_io;
 
+		if (virt_dev->features & VIRTIO_RING_F_EVENT_IDX)
+			vq->vq_flags |= VIRTQUEUE_FLAG_EVENT_IDX;
+
 		//TODO : Whether we want to support indirect addition or not.
 		vq->vq_ring_size = vring_size(ring->num_descs, ring->align);
 		vq->vq_ring_mem = (void *)ring->vaddr;
@@ -107,9 +116,11 @@ int virtqueue_create(struct virtio_device *virt_dev, unsigned short id,
 		vq_ring_init(vq);
 
 		/* Disable callbacks - will be enabled by the application
-		 * once initialization is completed.
+		 * once initialization is completed. The slave leaves the
+		 * available ring alone, it is owned by the master.
 		 */
-		virtqueue_disable_cb(vq);
+		if (!VQ_IS_SLAVE(vq))
+			virtqueue_disable_cb(vq);
 
 		*v_queue = vq;
 
@@ -295,6 +306,12 @@ void *virtqueue_get_buffer(struct virtqueue *vq, uint32_t * len, uint16_t * idx)
 	cookie = vq->vq_descx[desc_idx].cookie;
 	vq->vq_descx[desc_idx].cookie = VQ_NULL;
 
+	/* Ask to be notified of the next used buffer only. */
+	if ((vq->vq_flags & (VIRTQUEUE_FLAG_EVENT_IDX |
+			     VIRTQUEUE_FLAG_CB_DISABLED)) ==
+	    VIRTQUEUE_FLAG_EVENT_IDX)
+		vring_used_event(&vq->vq_ring) = vq->vq_used_cons_idx;
+
 	if (idx != VQ_NULL)
 		*idx = used_idx;
 	VQUEUE_IDLE(vq);
@@ -364,6 +381,12 @@ void *virtqueue_get_available_buffer(struct virtqueue *vq, uint16_t * avail_idx,
 	buffer = metal_io_phys_to_virt(vq->shm_io, vq->vq_ring.desc[*avail_idx].addr);
 	*len = vq->vq_ring.desc[*avail_idx].len;
 
+	/* Ask to be notified of the next available buffer only. */
+	if ((vq->vq_flags & (VIRTQUEUE_FLAG_EVENT_IDX |
+			     VIRTQUEUE_FLAG_CB_DISABLED)) ==
+	    VIRTQUEUE_FLAG_EVENT_IDX)
+		vq_ring_set_avail_event(vq, vq->vq_available_idx);
+
 	VQUEUE_IDLE(vq);
 
 	return (buffer);
@@ -400,6 +423,9 @@ int virtqueue_add_consumed_buffer(struct virtqueue *vq, uint16_t head_idx,
 
 	vq->vq_ring.used->idx++;
 
+	/* Keep pending count until virtqueue_kick(). */
+	vq->vq_queued_cnt++;
+
 	VQUEUE_IDLE(vq);
 
 	return (VQUEUE_SUCCESS);
@@ -419,7 +445,11 @@ int virtqueue_enable_cb(struct virtqueue *vq)
 }
 
 /**
- * virtqueue_enable_cb - Disables callback generation
+ * virtqueue_disable_cb - Disables callback generation
+ *
+ * The other side stops notifying us of new buffers on this virtqueue
+ * until virtqueue_enable_cb() is called, so a busy consumer can poll
+ * the ring instead of taking an interrupt per buffer.
  *
  * @param vq           - Pointer to VirtIO queue control block
  *
@@ -429,19 +459,33 @@ void virtqueue_disable_cb(struct virtqueue *vq)
 
 	VQUEUE_BUSY(vq);
 
-	if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
+	if (VQ_IS_SLAVE(vq)) {
+		if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
+			vq_ring_set_avail_event(vq, vq->vq_available_idx -
+						vq->vq_nentries - 1);
+		} else {
+			vq->vq_ring.used->flags |= VRING_USED_F_NO_NOTIFY;
+		}
+	} else if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
 		vring_used_event(&vq->vq_ring) =
 		    vq->vq_used_cons_idx - vq->vq_nentries - 1;
 	} else {
 		vq->vq_ring.avail->flags |= VRING_AVAIL_F_NO_INTERRUPT;
 	}
 
+	vq->vq_flags |= VIRTQUEUE_FLAG_CB_DISABLED;
+
 	VQUEUE_IDLE(vq);
 }
 
 /**
  * virtqueue_kick - Notifies other side that there is buffer available for it.
  *
+ * Buffers added since the last kick are notified together, so a burst
+ * of virtqueue_add_buffer()/virtqueue_add_consumed_buffer() calls can be
+ * followed by a single kick. The notification itself is skipped when the
+ * other side has suppressed it.
+ *
  * @param vq      - Pointer to VirtIO queue control block
  */
 void virtqueue_kick(struct virtqueue *vq)
@@ -449,7 +493,7 @@ void virtqueue_kick(struct virtqueue *vq)
 
 	VQUEUE_BUSY(vq);
 
-	/* Ensure updated avail->idx is visible to host. */
+	/* Ensure updated avail->idx or used->idx is visible to the other side. */
 	atomic_thread_fence(memory_order_seq_cst);
 
 	if (vq_ring_must_notify_host(vq))
@@ -650,12 +694,22 @@ static void vq_ring_update_avail(struct virtqueue *vq, uint16_t desc_idx)
  */
 static int vq_ring_enable_interrupt(struct virtqueue *vq, uint16_t ndesc)
 {
+	int pending;
+
+	vq->vq_flags &= ~VIRTQUEUE_FLAG_CB_DISABLED;
 
 	/*
 	 * Enable interrupts, making sure we get the latest index of
 	 * what's already been consumed.
 	 */
-	if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
+	if (VQ_IS_SLAVE(vq)) {
+		if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
+			vq_ring_set_avail_event(vq,
+						vq->vq_available_idx + ndesc);
+		} else {
+			vq->vq_ring.used->flags &= ~VRING_USED_F_NO_NOTIFY;
+		}
+	} else if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
 		vring_used_event(&vq->vq_ring) = vq->vq_used_cons_idx + ndesc;
 	} else {
 		vq->vq_ring.avail->flags &= ~VRING_AVAIL_F_NO_INTERRUPT;
@@ -668,7 +722,12 @@ static int vq_ring_enable_interrupt(struct virtqueue *vq, uint16_t ndesc)
 	 * since we last checked. Let our caller know so it processes the new
 	 * entries.
 	 */
-	if (virtqueue_nused(vq) > ndesc) {
+	if (VQ_IS_SLAVE(vq))
+		pending = virtqueue_navail(vq);
+	else
+		pending = virtqueue_nused(vq);
+
+	if (pending > ndesc) {
 		return (1);
 	}
 
@@ -697,6 +756,20 @@ static int vq_ring_must_notify_host(struct virtqueue *vq)
 {
 	uint16_t new_idx, prev_idx, event_idx;
 
+	if (VQ_IS_SLAVE(vq)) {
+		if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
+			new_idx = vq->vq_ring.used->idx;
+			prev_idx = new_idx - vq->vq_queued_cnt;
+			event_idx = vring_used_event(&vq->vq_ring);
+
+			return (vring_need_event(event_idx, new_idx,
+						 prev_idx) != 0);
+		}
+
+		return ((vq->vq_ring.avail->flags &
+			 VRING_AVAIL_F_NO_INTERRUPT) == 0);
+	}
+
 	if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) {
 		new_idx = vq->vq_ring.avail->idx;
 		prev_idx = new_idx - vq->vq_queued_cnt;
@@ -736,3 +809,29 @@ static int virtqueue_nused(struct virtqueue *vq)
 
 	return (nused);
 }
+
+/**
+ *
+ * virtqueue_navail
+ *
+ */
+static int virtqueue_navail(struct virtqueue *vq)
+{
+	uint16_t navail;
+
+	navail = (uint16_t) (vq->vq_ring.avail->idx - vq->vq_available_idx);
+	VQASSERT(vq, navail <= vq->vq_nentries, "more available than queued");
+
+	return (navail);
+}
+
+/**
+ *
+ * vq_ring_set_avail_event
+ *
+ */
+static void vq_ring_set_avail_event(struct virtqueue *vq, uint16_t idx)
+{
+	/* The avail event is a 16-bit field right after the used ring. */
+	*(volatile uint16_t *)&vq->vq_ring.used->ring[vq->vq_nentries] = idx;
+}
@@ -137,6 +137,16 @@
  * The down side of using the SG DMA transfer is that you have to manage the
  * memory for the buffer descriptors (BD), and setup BDs for the transfers.
  *
+ * <b>Copy Service</b>
+ *
+ * The copy service in xaxicdma_memcpy.c queues asynchronous copy requests of
+ * any size on top of the BD ring. Requests that are contiguous in both source
+ * and destination with the previous request are merged into the same BDs,
+ * requests longer than the maximum transfer length are split over several
+ * BDs, and each request completes through its own callback. The service
+ * needs the interrupt handler to be connected, and exclusive use of the BD
+ * ring.
+ *
  * <b>Interrupts</b>
  *
  * The driver handles the interrupts.
@@ -342,6 +352,8 @@
  *       ms   04/05/17 Modified Comment lines in functions of axicdma
  *                     examples to recognize it as documentation block
  *                     for doxygen generation of examples.
+ * 4.4   ag   10/14/26 Added the asynchronous copy service with request
+ *                     merging and splitting.
  * </pre>
  *****************************************************************************/
 
@@ -384,6 +396,12 @@ extern "C" {
 #define XAXICDMA_KEYHOLE_READ	0
 #define XAXICDMA_KEYHOLE_WRITE	1
 
+/* Cache maintenance flags for copy service requests
+ */
+#define XAXICDMA_COPY_FLUSH_SRC		0x1 /**< Flush source before copy */
+#define XAXICDMA_COPY_INVALIDATE_DST	0x2 /**< Invalidate destination */
+#define XAXICDMA_COPY_CACHE_ALL		0x3 /**< All cache maintenance */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -488,6 +506,58 @@ typedef struct {
 }XAxiCdma;
 /* @} */
 
+/**
+ * @name Copy done function
+ *
+ * Called by the copy service when a copy request completes.
+ *
+ * @param CallBackRef is the reference pointer passed with the request.
+ * @param Status is XST_SUCCESS, or the error that terminated the request.
+ */
+typedef void (*XAxiCdma_CopyDoneFn)(void *CallBackRef, int Status);
+
+/**
+ * @name XAxiCdma_CopyReq
+ *
+ * A copy request. The application allocates one for every outstanding copy
+ * and must not touch it until its done function has been called.
+ *
+ * @{
+ */
+typedef struct XAxiCdma_CopyReq {
+	UINTPTR SrcAddr;              /**< Source address */
+	UINTPTR DstAddr;              /**< Destination address */
+	u32 Length;                   /**< Length in bytes */
+	u32 Flags;                    /**< Cache maintenance flags */
+	XAxiCdma_CopyDoneFn DoneFn;   /**< Done function */
+	void *DoneRef;                /**< Done function reference pointer */
+	struct XAxiCdma_CopyReq *Next; /**< Next request in the queue */
+}XAxiCdma_CopyReq;
+/* @} */
+
+/**
+ * @name XAxiCdma_CopyService
+ *
+ * The copy service instance. Requests are kept in submission order, the
+ * ones before SubmitReq are on the hardware.
+ *
+ * @{
+ */
+typedef struct {
+	XAxiCdma *CdmaPtr;            /**< DMA engine used for the copies */
+	XAxiCdma_CopyReq *Head;       /**< Oldest outstanding request */
+	XAxiCdma_CopyReq *Tail;       /**< Newest outstanding request */
+	XAxiCdma_CopyReq *SubmitReq;  /**< First request not fully on hw */
+	u32 SubmitOffset;             /**< Bytes of SubmitReq on hw */
+	u32 HeadDone;                 /**< Bytes of Head completed */
+	u32 MaxBdLen;                 /**< Maximum length of a BD */
+	int BatchBdCnt;               /**< BDs of the batch on hw */
+	int InCallBack;               /**< Called from the interrupt handler */
+	int Status;                   /**< XST_SUCCESS or the fatal error */
+	u32 MergeCnt;                 /**< Requests merged into a prior BD */
+}XAxiCdma_CopyService;
+/* @} */
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -573,6 +643,15 @@ u32 XAxiCdma_BdRingFree(XAxiCdma *InstancePtr, int NumBd,
 void XAxiCdma_BdSetCurBdPtr(XAxiCdma *InstancePtr, UINTPTR CurBdPtr);
 void XAxiCdma_BdSetTailBdPtr(XAxiCdma *InstancePtr, UINTPTR TailBdPtr);
 
+/* Copy service functions
+ */
+int XAxiCdma_CopyServiceInit(XAxiCdma_CopyService *SvcPtr,
+	XAxiCdma *CdmaPtr);
+int XAxiCdma_CopySubmit(XAxiCdma_CopyService *SvcPtr,
+	XAxiCdma_CopyReq *ReqPtr, UINTPTR SrcAddr, UINTPTR DstAddr,
+	u32 Length, u32 Flags, XAxiCdma_CopyDoneFn DoneFn, void *DoneRef);
+int XAxiCdma_CopyIsIdle(XAxiCdma_CopyService *SvcPtr);
+
 /* Debug utility function
  */
 void XAxiCdma_DumpRegisters(XAxiCdma *InstancePtr);
@@ -0,0 +1,574 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *  @file xaxicdma_memcpy.c
+* @addtogroup axicdma_v4_3
+* @{
+ *
+ * The implementation of the asynchronous copy service on top of the BD ring.
+ *
+ * Requests are queued in submission order. When the hardware is idle, as
+ * many queued bytes as fit in the free BDs are written to the ring as one
+ * transfer. A BD covers up to the maximum transfer length, and continues
+ * into the next request if that is contiguous in source and destination.
+ * Completed BD lengths are accounted to the requests in order, and a request
+ * completes when all of its bytes have been copied.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 4.4   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+#include "xaxicdma.h"
+#include "xaxicdma_i.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* Cache maintenance of the copy buffers
+ */
+#ifdef __MICROBLAZE__
+#ifdef XCACHE_FLUSH_DCACHE_RANGE
+#define XAXICDMA_COPY_FLUSH(Addr, Len)	XCACHE_FLUSH_DCACHE_RANGE((Addr), (Len))
+#else
+#define XAXICDMA_COPY_FLUSH(Addr, Len)
+#endif
+
+#ifdef XCACHE_INVALIDATE_DCACHE_RANGE
+#define XAXICDMA_COPY_INVALIDATE(Addr, Len)	\
+	XCACHE_INVALIDATE_DCACHE_RANGE((Addr), (Len))
+#else
+#define XAXICDMA_COPY_INVALIDATE(Addr, Len)
+#endif
+
+#else /* __MICROBLAZE__*/
+#define XAXICDMA_COPY_FLUSH(Addr, Len)	Xil_DCacheFlushRange((Addr), (Len))
+#define XAXICDMA_COPY_INVALIDATE(Addr, Len)	\
+	Xil_DCacheInvalidateRange((Addr), (Len))
+#endif
+
+/************************** Function Prototypes ******************************/
+
+static u32 XAxiCdma_CopyNextSeg(XAxiCdma_CopyService *SvcPtr,
+	XAxiCdma_CopyReq **ReqPtr, u32 *OffsetPtr, UINTPTR *SrcPtr,
+	UINTPTR *DstPtr);
+static void XAxiCdma_CopyStart(XAxiCdma_CopyService *SvcPtr);
+static void XAxiCdma_CopyComplete(XAxiCdma_CopyService *SvcPtr, u32 Length);
+static void XAxiCdma_CopyFailAll(XAxiCdma_CopyService *SvcPtr, int Status);
+static void XAxiCdma_CopyCallBack(void *CallBackRef, u32 IrqMask,
+	int *NumBdPtr);
+
+/*****************************************************************************/
+/**
+ * This function initializes a copy service on a DMA engine. The BD ring of
+ * the engine must have been created, and the interrupt handler of the driver
+ * must be connected with the completion, delay and error interrupts enabled.
+ *
+ * @param	SvcPtr is the copy service to initialize
+ * @param	CdmaPtr is the driver instance of the DMA engine
+ *
+ * @return
+ *		- XST_SUCCESS for success
+ *		- XST_DMA_SG_NO_LIST if there is no BD ring
+ *		- XST_FAILURE if the driver is not initialized or the hardware
+ *		build is simple mode only
+ *
+ * @note	The service must be the only user of the BD ring. It can be
+ *		initialized again, with a new BD ring, after a fatal error.
+ *
+ *****************************************************************************/
+int XAxiCdma_CopyServiceInit(XAxiCdma_CopyService *SvcPtr,
+	XAxiCdma *CdmaPtr)
+{
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(CdmaPtr != NULL);
+
+	if ((!CdmaPtr->Initialized) || (CdmaPtr->SimpleOnlyBuild)) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "CopyServiceInit: driver instance "
+			"not in valid state or simple only build\r\n");
+		return XST_FAILURE;
+	}
+
+	if (CdmaPtr->AllBdCnt == 0) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "CopyServiceInit: no BD ring\r\n");
+		return XST_DMA_SG_NO_LIST;
+	}
+
+	SvcPtr->CdmaPtr = CdmaPtr;
+	SvcPtr->Head = NULL;
+	SvcPtr->Tail = NULL;
+	SvcPtr->SubmitReq = NULL;
+	SvcPtr->SubmitOffset = 0;
+	SvcPtr->HeadDone = 0;
+	SvcPtr->BatchBdCnt = 0;
+	SvcPtr->InCallBack = 0;
+	SvcPtr->Status = XST_SUCCESS;
+	SvcPtr->MergeCnt = 0;
+
+	/* Without DRE, splits must keep the addresses word aligned
+	 */
+	SvcPtr->MaxBdLen = (u32)CdmaPtr->MaxTransLen;
+	if (!CdmaPtr->HasDRE) {
+		SvcPtr->MaxBdLen &= ~((u32)CdmaPtr->WordLength - 1);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function queues a copy request. The copy is started right away if the
+ * hardware is idle, otherwise when the transfers ahead of it are done. The
+ * done function is called from the interrupt handler.
+ *
+ * @param	SvcPtr is the copy service
+ * @param	ReqPtr is the request, owned by the service until it is done
+ * @param	SrcAddr is the physical source address
+ * @param	DstAddr is the physical destination address
+ * @param	Length is the number of bytes to copy, of any size
+ * @param	Flags is a combination of XAXICDMA_COPY_FLUSH_SRC and
+ *		XAXICDMA_COPY_INVALIDATE_DST, for buffers in cached memory
+ * @param	DoneFn is the done function, NULL if not needed
+ * @param	DoneRef is the reference pointer passed to DoneFn
+ *
+ * @return
+ *		- XST_SUCCESS for success
+ *		- XST_INVALID_PARAM for zero length, or unaligned addresses
+ *		without DRE
+ *		- The fatal error of the service, if it has stopped
+ *
+ * @note	This function can be called from a done function. At other
+ *		places, the engine interrupts are masked while the queue is
+ *		updated.
+ *
+ *****************************************************************************/
+int XAxiCdma_CopySubmit(XAxiCdma_CopyService *SvcPtr,
+	XAxiCdma_CopyReq *ReqPtr, UINTPTR SrcAddr, UINTPTR DstAddr,
+	u32 Length, u32 Flags, XAxiCdma_CopyDoneFn DoneFn, void *DoneRef)
+{
+	XAxiCdma *CdmaPtr;
+	u32 IntrMask = 0;
+
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+
+	CdmaPtr = SvcPtr->CdmaPtr;
+
+	if (SvcPtr->Status != XST_SUCCESS) {
+		return SvcPtr->Status;
+	}
+
+	if (Length == 0) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((!CdmaPtr->HasDRE) &&
+	    ((SrcAddr | DstAddr) & (CdmaPtr->WordLength - 1))) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "CopySubmit: unaligned transfers "
+			"not supported\r\n");
+		return XST_INVALID_PARAM;
+	}
+
+	ReqPtr->SrcAddr = SrcAddr;
+	ReqPtr->DstAddr = DstAddr;
+	ReqPtr->Length = Length;
+	ReqPtr->Flags = Flags;
+	ReqPtr->DoneFn = DoneFn;
+	ReqPtr->DoneRef = DoneRef;
+	ReqPtr->Next = NULL;
+
+	if (Flags & XAXICDMA_COPY_FLUSH_SRC) {
+		XAXICDMA_COPY_FLUSH(SrcAddr, Length);
+	}
+	if (Flags & XAXICDMA_COPY_INVALIDATE_DST) {
+		XAXICDMA_COPY_INVALIDATE(DstAddr, Length);
+	}
+
+	if (!SvcPtr->InCallBack) {
+		IntrMask = XAxiCdma_IntrGetEnabled(CdmaPtr);
+		XAxiCdma_IntrDisable(CdmaPtr, IntrMask);
+	}
+
+	if (SvcPtr->Tail != NULL) {
+		SvcPtr->Tail->Next = ReqPtr;
+	}
+	else {
+		SvcPtr->Head = ReqPtr;
+		SvcPtr->HeadDone = 0;
+	}
+	SvcPtr->Tail = ReqPtr;
+
+	if (SvcPtr->SubmitReq == NULL) {
+		SvcPtr->SubmitReq = ReqPtr;
+		SvcPtr->SubmitOffset = 0;
+	}
+
+	/* Inside the callback, the next batch is started on its return
+	 */
+	if (!SvcPtr->InCallBack) {
+		XAxiCdma_CopyStart(SvcPtr);
+		XAxiCdma_IntrEnable(CdmaPtr, IntrMask);
+	}
+
+	return SvcPtr->Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks whether all copy requests have completed.
+ *
+ * @param	SvcPtr is the copy service
+ *
+ * @return	TRUE if no request is outstanding, FALSE otherwise
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiCdma_CopyIsIdle(XAxiCdma_CopyService *SvcPtr)
+{
+	Xil_AssertNonvoid(SvcPtr != NULL);
+
+	return (SvcPtr->Head == NULL) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/*
+ * This function gets the next BD worth of bytes from the request queue,
+ * merging the following requests while they are contiguous.
+ *
+ * @param	SvcPtr is the copy service
+ * @param	ReqPtr is the cursor request, updated past the segment
+ * @param	OffsetPtr is the cursor offset in the request, updated
+ * @param	SrcPtr is where the source address is returned
+ * @param	DstPtr is where the destination address is returned
+ *
+ * @return	The length of the segment, 0 if there are no more bytes
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+static u32 XAxiCdma_CopyNextSeg(XAxiCdma_CopyService *SvcPtr,
+	XAxiCdma_CopyReq **ReqPtr, u32 *OffsetPtr, UINTPTR *SrcPtr,
+	UINTPTR *DstPtr)
+{
+	XAxiCdma_CopyReq *CurReqPtr = *ReqPtr;
+	u32 Offset = *OffsetPtr;
+	u32 Length = 0;
+	u32 Chunk;
+
+	if (CurReqPtr == NULL) {
+		return 0;
+	}
+
+	*SrcPtr = CurReqPtr->SrcAddr + Offset;
+	*DstPtr = CurReqPtr->DstAddr + Offset;
+
+	while (1) {
+		Chunk = CurReqPtr->Length - Offset;
+		if (Chunk > (SvcPtr->MaxBdLen - Length)) {
+			Chunk = SvcPtr->MaxBdLen - Length;
+		}
+
+		Length += Chunk;
+		Offset += Chunk;
+
+		/* The BD is full in the middle of the request
+		 */
+		if (Offset < CurReqPtr->Length) {
+			break;
+		}
+
+		CurReqPtr = CurReqPtr->Next;
+		Offset = 0;
+
+		if ((CurReqPtr == NULL) || (Length == SvcPtr->MaxBdLen) ||
+		    (CurReqPtr->SrcAddr != (*SrcPtr + Length)) ||
+		    (CurReqPtr->DstAddr != (*DstPtr + Length))) {
+			break;
+		}
+
+		SvcPtr->MergeCnt++;
+	}
+
+	*ReqPtr = CurReqPtr;
+	*OffsetPtr = Offset;
+
+	return Length;
+}
+
+/*****************************************************************************/
+/*
+ * This function starts the queued bytes on the hardware if it is idle, using
+ * as many free BDs as needed and available. A failure to start is fatal for
+ * the service, as nothing would restart the queue.
+ *
+ * @param	SvcPtr is the copy service
+ *
+ * @return	None
+ *
+ * @note	Called with the engine interrupts masked, or from the
+ *		interrupt handler.
+ *
+ *****************************************************************************/
+static void XAxiCdma_CopyStart(XAxiCdma_CopyService *SvcPtr)
+{
+	XAxiCdma *CdmaPtr = SvcPtr->CdmaPtr;
+	XAxiCdma_CopyReq *ReqPtr;
+	XAxiCdma_Bd *BdPtr;
+	XAxiCdma_Bd *CurBdPtr;
+	UINTPTR SrcAddr;
+	UINTPTR DstAddr;
+	u32 Offset;
+	u32 MergeCnt;
+	u32 Length;
+	int FreeBdCnt;
+	int NumBd = 0;
+	int Index;
+	int Status;
+
+	if ((SvcPtr->BatchBdCnt != 0) || (SvcPtr->SubmitReq == NULL)) {
+		return;
+	}
+
+	FreeBdCnt = (int)XAxiCdma_BdRingGetFreeCnt(CdmaPtr);
+
+	/* Count the BDs needed for the queued bytes
+	 */
+	ReqPtr = SvcPtr->SubmitReq;
+	Offset = SvcPtr->SubmitOffset;
+	MergeCnt = SvcPtr->MergeCnt;
+	while ((NumBd < FreeBdCnt) && (XAxiCdma_CopyNextSeg(SvcPtr, &ReqPtr,
+	    &Offset, &SrcAddr, &DstAddr) != 0)) {
+		NumBd++;
+	}
+	SvcPtr->MergeCnt = MergeCnt;
+
+	if (NumBd == 0) {
+		return;
+	}
+
+	Status = XAxiCdma_BdRingAlloc(CdmaPtr, NumBd, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		XAxiCdma_CopyFailAll(SvcPtr, Status);
+		return;
+	}
+
+	ReqPtr = SvcPtr->SubmitReq;
+	Offset = SvcPtr->SubmitOffset;
+	CurBdPtr = BdPtr;
+	for (Index = 0; Index < NumBd; Index++) {
+		Length = XAxiCdma_CopyNextSeg(SvcPtr, &ReqPtr, &Offset,
+			&SrcAddr, &DstAddr);
+
+		XAxiCdma_BdSetSrcBufAddr(CurBdPtr, SrcAddr);
+		XAxiCdma_BdSetDstBufAddr(CurBdPtr, DstAddr);
+		XAxiCdma_BdSetLength(CurBdPtr, Length);
+
+		CurBdPtr = XAxiCdma_BdRingNext(CdmaPtr, CurBdPtr);
+	}
+
+	Status = XAxiCdma_BdRingToHw(CdmaPtr, NumBd, BdPtr,
+		XAxiCdma_CopyCallBack, SvcPtr);
+	if (Status != XST_SUCCESS) {
+		XAxiCdma_BdRingUnAlloc(CdmaPtr, NumBd, BdPtr);
+		XAxiCdma_CopyFailAll(SvcPtr, Status);
+		return;
+	}
+
+	SvcPtr->SubmitReq = ReqPtr;
+	SvcPtr->SubmitOffset = Offset;
+	SvcPtr->BatchBdCnt = NumBd;
+}
+
+/*****************************************************************************/
+/*
+ * This function accounts copied bytes to the requests in order, and calls
+ * the done function of each request that has been fully copied.
+ *
+ * @param	SvcPtr is the copy service
+ * @param	Length is the number of bytes copied by a BD
+ *
+ * @return	None
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+static void XAxiCdma_CopyComplete(XAxiCdma_CopyService *SvcPtr, u32 Length)
+{
+	XAxiCdma_CopyReq *ReqPtr;
+	u32 Chunk;
+
+	while ((Length != 0) && (SvcPtr->Head != NULL)) {
+		ReqPtr = SvcPtr->Head;
+
+		Chunk = ReqPtr->Length - SvcPtr->HeadDone;
+		if (Chunk > Length) {
+			Chunk = Length;
+		}
+
+		SvcPtr->HeadDone += Chunk;
+		Length -= Chunk;
+
+		if (SvcPtr->HeadDone < ReqPtr->Length) {
+			break;
+		}
+
+		SvcPtr->Head = ReqPtr->Next;
+		SvcPtr->HeadDone = 0;
+		if (SvcPtr->Head == NULL) {
+			SvcPtr->Tail = NULL;
+		}
+
+		/* Drop lines speculatively fetched during the copy
+		 */
+		if (ReqPtr->Flags & XAXICDMA_COPY_INVALIDATE_DST) {
+			XAXICDMA_COPY_INVALIDATE(ReqPtr->DstAddr,
+				ReqPtr->Length);
+		}
+
+		if (ReqPtr->DoneFn != NULL) {
+			ReqPtr->DoneFn(ReqPtr->DoneRef, XST_SUCCESS);
+		}
+	}
+}
+
+/*****************************************************************************/
+/*
+ * This function stops the service after a fatal error, and fails all
+ * outstanding requests.
+ *
+ * @param	SvcPtr is the copy service
+ * @param	Status is the error passed to the done functions
+ *
+ * @return	None
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+static void XAxiCdma_CopyFailAll(XAxiCdma_CopyService *SvcPtr, int Status)
+{
+	XAxiCdma_CopyReq *ReqPtr;
+
+	SvcPtr->Status = Status;
+
+	while (SvcPtr->Head != NULL) {
+		ReqPtr = SvcPtr->Head;
+		SvcPtr->Head = ReqPtr->Next;
+
+		if (ReqPtr->DoneFn != NULL) {
+			ReqPtr->DoneFn(ReqPtr->DoneRef, Status);
+		}
+	}
+
+	SvcPtr->Tail = NULL;
+	SvcPtr->SubmitReq = NULL;
+	SvcPtr->SubmitOffset = 0;
+	SvcPtr->HeadDone = 0;
+}
+
+/*****************************************************************************/
+/*
+ * This function is the callback of the copy service transfers, called by
+ * the driver interrupt handler. It retires the completed BDs, completes the
+ * requests they finish, and starts the next batch once this one is done.
+ *
+ * @param	CallBackRef is the copy service
+ * @param	IrqMask is the interrupt mask
+ * @param	NumBdPtr is the number of BDs of this batch still on hardware
+ *
+ * @return	None
+ *
+ * @note	On an error the driver resets the hardware, the service then
+ *		fails all requests and has to be initialized again.
+ *
+ *****************************************************************************/
+static void XAxiCdma_CopyCallBack(void *CallBackRef, u32 IrqMask,
+	int *NumBdPtr)
+{
+	XAxiCdma_CopyService *SvcPtr = (XAxiCdma_CopyService *)CallBackRef;
+	XAxiCdma *CdmaPtr = SvcPtr->CdmaPtr;
+	XAxiCdma_Bd *BdPtr;
+	XAxiCdma_Bd *CurBdPtr;
+	int BdCount;
+	int Index;
+	int Error = 0;
+
+	SvcPtr->InCallBack = 1;
+
+	if (IrqMask & XAXICDMA_XR_IRQ_ERROR_MASK) {
+		Error = 1;
+	}
+	else {
+		BdCount = XAxiCdma_BdRingFromHw(CdmaPtr, *NumBdPtr, &BdPtr);
+
+		CurBdPtr = BdPtr;
+		for (Index = 0; Index < BdCount; Index++) {
+			if (XAxiCdma_BdGetSts(CurBdPtr) &
+			    XAXICDMA_BD_STS_ALL_ERR_MASK) {
+				Error = 1;
+				break;
+			}
+
+			XAxiCdma_CopyComplete(SvcPtr,
+			    XAxiCdma_BdGetLength(CurBdPtr) &
+			    XAXICDMA_BD_CTRL_LENGTH_MASK);
+
+			CurBdPtr = XAxiCdma_BdRingNext(CdmaPtr, CurBdPtr);
+		}
+
+		if (BdCount > 0) {
+			XAxiCdma_BdRingFree(CdmaPtr, BdCount, BdPtr);
+			*NumBdPtr -= BdCount;
+		}
+	}
+
+	if (Error) {
+		*NumBdPtr = 0;
+		SvcPtr->BatchBdCnt = 0;
+		XAxiCdma_CopyFailAll(SvcPtr, XST_DMA_ERROR);
+	}
+	else {
+		SvcPtr->BatchBdCnt = *NumBdPtr;
+		XAxiCdma_CopyStart(SvcPtr);
+	}
+
+	SvcPtr->InCallBack = 0;
+}
+/** @} */
@@ -348,6 +348,9 @@
 *
 * This driver does not have any mechanisms for mutual exclusion. It is up to
 * the application to provide this protection.
+* The exception are BD rings switched to single producer / single consumer
+* operation with XAxiDma_BdRingSpscInit(), which may be shared by one task
+* and one interrupt handler without further protection.
 *
 * <b> Hardware Defaults & Exclusive Use </b>
 *
@@ -476,6 +479,10 @@
 *      adk   13/11/17 Fixed CR#989455 multi-channel interrupt example fails on A53.
 * 9.6  rsp   01/11/18 Fixed CR#976392 In XAxiDma struct use UINTPTR for RegBase.
 *                     In XAxiDma_LookupConfigBaseAddr() use UINTPTR for Baseaddr.
+*      ag    10/14/26 Added lock-free SPSC BD ring functions, and zero-copy
+*                     receive streaming in xaxidma_stream.c.
+*      ag    10/14/26 Added cyclic period rings with period elapsed
+*                     callbacks and xrun recovery in xaxidma_period.c.
 * </pre>
 *
 ******************************************************************************/
@@ -521,6 +528,63 @@ typedef struct XAxiDma {
 	int AddrWidth;		  /**< Address Width */
 } XAxiDma;
 
+/**
+ * Handler called for every receive buffer lent to the application by the
+ * streaming functions in xaxidma_stream.c.
+ */
+typedef void (*XAxiDma_StreamHandler) (void *CallBackRef, u32 BufId,
+		UINTPTR BufAddr, u32 Length);
+
+/**
+ * Zero-copy receive stream over a pool of buffers bound to the S2MM BD ring.
+ */
+typedef struct {
+	XAxiDma *InstancePtr;	/**< DMA engine of the stream */
+	XAxiDma_BdRing *RingPtr;	/**< S2MM BD ring of the stream */
+	UINTPTR BufBase;	/**< Address of the first buffer */
+	u32 BufSize;		/**< Size of each buffer in bytes */
+	u32 NumBufs;		/**< Number of buffers in the pool */
+	int Cyclic;		/**< Engine loops over the ring */
+	u32 LentCnt;		/**< Buffers held by the application */
+	u32 Overruns;		/**< Cyclic mode: buffers filled while lent */
+	XAxiDma_StreamHandler Handler;	/**< Buffer lent handler */
+	void *CallBackRef;	/**< Reference passed to the handler */
+} XAxiDma_Stream;
+
+/**
+ * Handler called for every period completed by the engine on a period ring,
+ * see xaxidma_period.c.
+ */
+typedef void (*XAxiDma_PeriodHandler) (void *CallBackRef, u32 Period);
+
+/**
+ * Handler called when the application fell behind the engine on a period
+ * ring (underrun on MM2S, overrun on S2MM).
+ */
+typedef void (*XAxiDma_XrunHandler) (void *CallBackRef, u32 Xruns);
+
+/**
+ * Cyclic ring of equally sized periods, e.g. for audio samples. The engine
+ * loops over the periods for good and interrupts once per period.
+ */
+typedef struct {
+	XAxiDma *InstancePtr;	/**< DMA engine of the ring */
+	XAxiDma_BdRing *RingPtr;	/**< BD ring of the channel */
+	int Direction;		/**< XAXIDMA_DMA_TO_DEVICE or
+				  *  XAXIDMA_DEVICE_TO_DMA */
+	UINTPTR BufBase;	/**< Address of the first period */
+	u32 PeriodBytes;	/**< Size of each period in bytes */
+	u32 NumPeriods;		/**< Number of periods in the ring */
+	u32 HwPeriods;		/**< Periods completed by the engine */
+	u32 AppPeriods;		/**< Periods filled (MM2S) or consumed (S2MM)
+				  *  by the application */
+	u32 Xruns;		/**< Underruns or overruns */
+	XAxiDma_PeriodHandler Handler;	/**< Period elapsed handler */
+	void *CallBackRef;	/**< Reference passed to the handler */
+	XAxiDma_XrunHandler XrunHandler;	/**< Xrun handler */
+	void *XrunRef;		/**< Reference passed to the xrun handler */
+} XAxiDma_PeriodRing;
+
 /**
  * The configuration structure for AXI DMA engine
  *
@@ -755,6 +819,33 @@ u32 XAxiDma_SimpleTransfer(XAxiDma *InstancePtr, UINTPTR BuffAddr, u32 Length,
 int XAxiDma_SelectKeyHole(XAxiDma *InstancePtr, int Direction, int Select);
 int XAxiDma_SelectCyclicMode(XAxiDma *InstancePtr, int Direction, int Select);
 int XAxiDma_Selftest(XAxiDma * InstancePtr);
+
+/*
+ * Zero-copy receive streaming functions in xaxidma_stream.c
+ */
+int XAxiDma_StreamInit(XAxiDma_Stream *StreamPtr, XAxiDma *InstancePtr,
+		UINTPTR BufBase, u32 BufSize, u32 NumBufs, int Cyclic);
+void XAxiDma_StreamSetHandler(XAxiDma_Stream *StreamPtr,
+		XAxiDma_StreamHandler FuncPtr, void *CallBackRef);
+int XAxiDma_StreamStart(XAxiDma_Stream *StreamPtr);
+int XAxiDma_StreamPoll(XAxiDma_Stream *StreamPtr);
+int XAxiDma_StreamRelease(XAxiDma_Stream *StreamPtr, u32 BufId);
+
+/*
+ * Cyclic period ring functions in xaxidma_period.c
+ */
+int XAxiDma_PeriodRingInit(XAxiDma_PeriodRing *PrPtr, XAxiDma *InstancePtr,
+		int Direction, UINTPTR BufBase, u32 PeriodBytes,
+		u32 NumPeriods);
+void XAxiDma_PeriodRingSetHandler(XAxiDma_PeriodRing *PrPtr,
+		XAxiDma_PeriodHandler FuncPtr, void *CallBackRef);
+void XAxiDma_PeriodRingSetXrunHandler(XAxiDma_PeriodRing *PrPtr,
+		XAxiDma_XrunHandler FuncPtr, void *CallBackRef);
+int XAxiDma_PeriodRingStart(XAxiDma_PeriodRing *PrPtr);
+int XAxiDma_PeriodRingPoll(XAxiDma_PeriodRing *PrPtr);
+u32 XAxiDma_PeriodRingAvail(XAxiDma_PeriodRing *PrPtr);
+UINTPTR XAxiDma_PeriodRingAppAddr(XAxiDma_PeriodRing *PrPtr);
+int XAxiDma_PeriodRingCommit(XAxiDma_PeriodRing *PrPtr);
 #ifdef __cplusplus
 }
 #endif
@@ -69,6 +69,10 @@
 * 9.6   rsp  01/11/18  Use UINTPTR for all RegBase instances CR#976392
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
+*       ag   10/14/26  Added single producer / single consumer variants of
+*                      the ring functions that need no mutual exclusion.
+*       ag   10/14/26  XAxiDma_BdRingToHw, _FromHw, _Free and the tail update
+*                      can be placed in R5 TCM.
 *
 * </pre>
 ******************************************************************************/
@@ -76,6 +80,7 @@
 /***************************** Include Files *********************************/
 
 #include "xaxidma_bdring.h"
+#include "xil_tcm.h"
 
 /************************** Constant Definitions *****************************/
 /* Use 100 milliseconds for 100 MHz
@@ -989,65 +994,32 @@ int XAxiDma_BdRingUnAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
 }
 /*****************************************************************************/
 /**
- * Enqueue a set of BDs to hardware that were previously allocated by
- * XAxiDma_BdRingAlloc(). Once this function returns, the argument BD set goes
- * under hardware control. Changes to these BDs should be held until they are
- * finished by hardware to avoid data corruption and system instability.
- *
- * For transmit, the set will be rejected if the last BD of the set does not
- * mark the end of a packet or the first BD does not mark the start of a packet.
+ * Check a set of BDs about to be given to hardware and clear their completed
+ * status bits.
  *
  * @param	RingPtr is a pointer to the descriptor ring instance to be
  *		worked on.
- * @param	NumBd is the number of BDs in the set.
- * @param	BdSetPtr is the first BD of the set to commit to hardware.
+ * @param	NumBd is the number of BDs in the set, must be positive.
+ * @param	BdSetPtr is the first BD of the set.
+ * @param	LastBdPtr is an output parameter, it points to the last BD of
+ *		the set.
  *
  * @return
- *		- XST_SUCCESS if the set of BDs was accepted and enqueued to
- *		hardware
- *		- XST_INVALID_PARAM if passed in NumBd is negative
- *		- XST_FAILURE if the set of BDs was rejected because the first
- *		BD does not have its start-of-packet bit set, or the last BD
- *		does not have its end-of-packet bit set, or any one of the BDs
- *		has 0 length.
- *		- XST_DMA_SG_LIST_ERROR if this function was called out of
- *		sequence with XAxiDma_BdRingAlloc()
- *
- * @note	This function should not be preempted by another XAxiDma ring
- *		function call that modifies the BD space. It is the caller's
- *		responsibility to provide a mutual exclusion mechanism.
+ *		- XST_SUCCESS if the set of BDs is ready for hardware
+ *		- XST_FAILURE if the first BD does not have its start-of-packet
+ *		bit set, or the last BD does not have its end-of-packet bit
+ *		set, or any one of the BDs has 0 length.
  *
- *		This function can be used only when DMA is in SG mode
+ * @note	This function can be used only when DMA is in SG mode
  *
  *****************************************************************************/
-int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
-	XAxiDma_Bd * BdSetPtr)
+static int XAxiDma_BdRingPrepare(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd * BdSetPtr, XAxiDma_Bd ** LastBdPtr)
 {
 	XAxiDma_Bd *CurBdPtr;
 	int i;
 	u32 BdCr;
 	u32 BdSts;
-	int RingIndex = RingPtr->RingIndex;
-
-	if (NumBd < 0) {
-
-		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingToHw: negative BD number "
-			"%d\r\n", NumBd);
-
-		return XST_INVALID_PARAM;
-	}
-
-	/* If the commit set is empty, do nothing */
-	if (NumBd == 0) {
-		return XST_SUCCESS;
-	}
-
-	/* Make sure we are in sync with XAxiDma_BdRingAlloc() */
-	if ((RingPtr->PreCnt < NumBd) || (RingPtr->PreHead != BdSetPtr)) {
-
-		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
-		return XST_DMA_SG_LIST_ERROR;
-	}
 
 	CurBdPtr = BdSetPtr;
 	BdCr = XAxiDma_BdGetCtrl(CurBdPtr);
@@ -1115,15 +1087,28 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	XAXIDMA_CACHE_FLUSH(CurBdPtr);
 	DATA_SYNC;
 
-	/* This set has completed pre-processing, adjust ring pointers and
-	 * counters
-	 */
-	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
-	RingPtr->PreCnt -= NumBd;
-	RingPtr->HwTail = CurBdPtr;
-	RingPtr->HwCnt += NumBd;
+	*LastBdPtr = CurBdPtr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Signal a running engine that new BDs up to RingPtr->HwTail are available
+ * by updating the tail descriptor register.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+static void XIL_TCM_ISR XAxiDma_BdRingUpdateTail(XAxiDma_BdRing * RingPtr)
+{
+	int RingIndex = RingPtr->RingIndex;
 
-	/* If it is running, signal the engine to begin processing */
 	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
 			if (RingPtr->Cyclic) {
 				XAxiDma_WriteReg(RingPtr->ChanBase,
@@ -1133,7 +1118,7 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 					XAxiDma_WriteReg(RingPtr->ChanBase,
 							 XAXIDMA_TDESC_MSB_OFFSET,
 							 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd)));
-				return XST_SUCCESS;
+				return;
 			}
 
 			if (RingPtr->IsRxChannel) {
@@ -1164,10 +1149,172 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 								UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
 			}
 	}
+}
+
+/*****************************************************************************/
+/**
+ * Enqueue a set of BDs to hardware that were previously allocated by
+ * XAxiDma_BdRingAlloc(). Once this function returns, the argument BD set goes
+ * under hardware control. Changes to these BDs should be held until they are
+ * finished by hardware to avoid data corruption and system instability.
+ *
+ * For transmit, the set will be rejected if the last BD of the set does not
+ * mark the end of a packet or the first BD does not mark the start of a packet.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	BdSetPtr is the first BD of the set to commit to hardware.
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was accepted and enqueued to
+ *		hardware
+ *		- XST_INVALID_PARAM if passed in NumBd is negative
+ *		- XST_FAILURE if the set of BDs was rejected because the first
+ *		BD does not have its start-of-packet bit set, or the last BD
+ *		does not have its end-of-packet bit set, or any one of the BDs
+ *		has 0 length.
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingAlloc()
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XIL_TCM_ISR XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd * BdSetPtr)
+{
+	XAxiDma_Bd *LastBdPtr;
+	int Status;
+
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingToHw: negative BD number "
+			"%d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	/* If the commit set is empty, do nothing */
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingAlloc() */
+	if ((RingPtr->PreCnt < NumBd) || (RingPtr->PreHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	Status = XAxiDma_BdRingPrepare(RingPtr, NumBd, BdSetPtr, &LastBdPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* This set has completed pre-processing, adjust ring pointers and
+	 * counters
+	 */
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
+	RingPtr->PreCnt -= NumBd;
+	RingPtr->HwTail = LastBdPtr;
+	RingPtr->HwCnt += NumBd;
+
+	/* If it is running, signal the engine to begin processing */
+	XAxiDma_BdRingUpdateTail(RingPtr);
 
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+ * Count the BDs at the head of the work group that hardware has completed,
+ * excluding the BDs of a packet that is only partially completed.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdLimit is the maximum number of BDs to examine, it must not
+ *		be larger than the number of BDs in the work group.
+ * @param	TailBdPtr is the last BD of the work group, or NULL to stop
+ *		only on BdLimit.
+ *
+ * @return	The number of completed BDs starting at RingPtr->HwHead.
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+static int XAxiDma_BdRingScan(XAxiDma_BdRing * RingPtr, int BdLimit,
+	XAxiDma_Bd * TailBdPtr)
+{
+	XAxiDma_Bd *CurBdPtr;
+	int BdCount;
+	int BdPartialCount;
+	u32 BdSts;
+	u32 BdCr;
+
+	CurBdPtr = RingPtr->HwHead;
+	BdCount = 0;
+	BdPartialCount = 0;
+
+	/* Starting at HwHead, keep moving forward in the list until:
+	 *  - A BD is encountered with its completed bit clear in the status
+	 *    word which means hardware has not completed processing of that
+	 *    BD.
+	 *  - TailBdPtr is reached
+	 *  - The number of requested BDs has been processed
+	 */
+
+	while (BdCount < BdLimit) {
+		/* Read the status */
+		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
+		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
+		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
+
+		/* If the hardware still hasn't processed this BD then we are
+		 * done
+		 */
+		if (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK)) {
+			break;
+		}
+
+		BdCount++;
+
+		/* Hardware has processed this BD so check the "last" bit. If
+		 * it is clear, then there are more BDs for the current packet.
+		 * Keep a count of these partial packet BDs.
+		 *
+		 * For tx BDs, EOF bit is in the control word
+		 * For rx BDs, EOF bit is in the status word
+		 */
+		if (((!(RingPtr->IsRxChannel) &&
+		(BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) ||
+		((RingPtr->IsRxChannel) && (BdSts &
+			XAXIDMA_BD_STS_RXEOF_MASK)))) {
+
+			BdPartialCount = 0;
+		}
+		else {
+			BdPartialCount++;
+		}
+
+		/* Reached the end of the work group */
+		if (CurBdPtr == TailBdPtr) {
+			break;
+		}
+
+		/* Move on to the next BD in work group */
+		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
+	}
+
+	/* Subtract off any partial packet BDs found */
+	BdCount -= BdPartialCount;
+
+	return BdCount;
+}
+
 /*****************************************************************************/
 /**
  * Returns a set of BD(s) that have been processed by hardware. The returned
@@ -1240,20 +1387,10 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
  *		This function can be used only when DMA is in SG mode
  *
  *****************************************************************************/
-int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
+int XIL_TCM_ISR XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 			     XAxiDma_Bd ** BdSetPtr)
 {
-	XAxiDma_Bd *CurBdPtr;
 	int BdCount;
-	int BdPartialCount;
-	u32 BdSts;
-	u32 BdCr;
-
-	CurBdPtr = RingPtr->HwHead;
-	BdCount = 0;
-	BdPartialCount = 0;
-	BdSts = 0;
-	BdCr = 0;
 
 	/* If no BDs in work group, then there's nothing to search */
 	if (RingPtr->HwCnt == 0) {
@@ -1266,74 +1403,23 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		BdLimit = RingPtr->HwCnt;
 	}
 
-	/* Starting at HwHead, keep moving forward in the list until:
-	 *  - A BD is encountered with its completed bit clear in the status
-	 *    word which means hardware has not completed processing of that
-	 *    BD.
-	 *  - RingPtr->HwTail is reached
-	 *  - The number of requested BDs has been processed
-	 */
-
-	while (BdCount < BdLimit) {
-		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
-		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
-		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
+	BdCount = XAxiDma_BdRingScan(RingPtr, BdLimit, RingPtr->HwTail);
 
-		/* If the hardware still hasn't processed this BD then we are
-		 * done
-		 */
-		if (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK)) {
-			break;
+	/* If BdCount is non-zero then BDs were found to return. Set return
+	 * parameters, update pointers and counters, return success
+	 */
+	if (BdCount) {
+		*BdSetPtr = RingPtr->HwHead;
+		if (!RingPtr->Cyclic) {
+			RingPtr->HwCnt -= BdCount;
+			RingPtr->PostCnt += BdCount;
 		}
+		XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
 
-		BdCount++;
-
-		/* Hardware has processed this BD so check the "last" bit. If
-		 * it is clear, then there are more BDs for the current packet.
-		 * Keep a count of these partial packet BDs.
-		 *
-		 * For tx BDs, EOF bit is in the control word
-		 * For rx BDs, EOF bit is in the status word
-		 */
-		if (((!(RingPtr->IsRxChannel) &&
-		(BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) ||
-		((RingPtr->IsRxChannel) && (BdSts &
-			XAXIDMA_BD_STS_RXEOF_MASK)))) {
-
-			BdPartialCount = 0;
-		}
-		else {
-			BdPartialCount++;
-		}
-
-		/* Reached the end of the work group */
-		if (CurBdPtr == RingPtr->HwTail) {
-			break;
-		}
-
-		/* Move on to the next BD in work group */
-		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
-	}
-
-	/* Subtract off any partial packet BDs found */
-	BdCount -= BdPartialCount;
-
-	/* If BdCount is non-zero then BDs were found to return. Set return
-	 * parameters, update pointers and counters, return success
-	 */
-	if (BdCount) {
-		*BdSetPtr = RingPtr->HwHead;
-		if (!RingPtr->Cyclic) {
-			RingPtr->HwCnt -= BdCount;
-			RingPtr->PostCnt += BdCount;
-		}
-		XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
-
-		return BdCount;
-	}
-	else {
-		*BdSetPtr = (XAxiDma_Bd *)NULL;
+		return BdCount;
+	}
+	else {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
 
 		return 0;
 	}
@@ -1362,7 +1448,7 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
  *		This function can be used only when DMA is in SG mode
  *
  *****************************************************************************/
-int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
+int XIL_TCM_ISR XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 		      XAxiDma_Bd * BdSetPtr)
 {
 	if (NumBd < 0) {
@@ -1398,6 +1484,381 @@ int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 
 	return XST_SUCCESS;
 }
+/*****************************************************************************/
+/**
+ * Switch a BD ring to single producer / single consumer (SPSC) operation.
+ *
+ * In SPSC operation one context (the producer, typically a task) calls
+ * XAxiDma_BdRingSpscAlloc(), XAxiDma_BdRingSpscUnAlloc() and
+ * XAxiDma_BdRingSpscToHw(), while one other context (the consumer,
+ * typically the completion interrupt handler) calls
+ * XAxiDma_BdRingSpscFromHw() and XAxiDma_BdRingSpscFree(). The two
+ * contexts share no read-modify-write state: each side only advances its
+ * own free running indices and reads the indices of the other side, so no
+ * interrupt masking or other mutual exclusion is needed between them.
+ *
+ * The SPSC functions and the regular ring functions must not be mixed on
+ * the same ring.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the ring is ready for SPSC operation
+ *		- XST_FAILURE if the ring is in cyclic mode
+ *		- XST_DMA_SG_LIST_ERROR if some BDs are not in the free group
+ *
+ * @note	The ring should be started with XAxiDma_BdRingStart() before
+ *		BDs are given to hardware with XAxiDma_BdRingSpscToHw().
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscInit(XAxiDma_BdRing * RingPtr)
+{
+	if (RingPtr->Cyclic) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscInit: cyclic ring\r\n");
+
+		return XST_FAILURE;
+	}
+
+	if (RingPtr->FreeCnt != RingPtr->AllCnt) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscInit: BDs in use "
+			"%d/%d\r\n", RingPtr->AllCnt - RingPtr->FreeCnt,
+			RingPtr->AllCnt);
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	/* All four groups start out at the same BD */
+	RingPtr->PreHead = RingPtr->FreeHead;
+	RingPtr->HwHead = RingPtr->FreeHead;
+	RingPtr->PostHead = RingPtr->FreeHead;
+
+	RingPtr->SpscAllocIdx = 0;
+	RingPtr->SpscToHwIdx = 0;
+	RingPtr->SpscFromHwIdx = 0;
+	RingPtr->SpscFreeIdx = 0;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Return the number of BDs the producer of an SPSC ring can allocate. The
+ * count may grow concurrently as the consumer frees BDs, but never shrinks
+ * behind the producer's back.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return	Number of BDs in the free group
+ *
+ * @note	Producer side. This function can be used only when DMA is in
+ *		SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscGetFreeCnt(XAxiDma_BdRing * RingPtr)
+{
+	u32 FreeIdx = RingPtr->SpscFreeIdx;
+
+	return RingPtr->AllCnt - (int)(RingPtr->SpscAllocIdx - FreeIdx);
+}
+
+/*****************************************************************************/
+/**
+ * SPSC counterpart of XAxiDma_BdRingAlloc().
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs to allocate
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for modification.
+ *
+ * @return
+ *		- XST_SUCCESS if the requested number of BDs were returned in
+ *		the BdSetPtr parameter.
+ *		- XST_INVALID_PARAM if passed in NumBd is not positive
+ *		- XST_FAILURE if there were not enough free BDs to satisfy
+ *		the request.
+ *
+ * @note	Producer side. This function can be used only when DMA is in
+ *		SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd ** BdSetPtr)
+{
+	if (NumBd <= 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscAlloc: negative BD "
+				"number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (XAxiDma_BdRingSpscGetFreeCnt(RingPtr) < NumBd) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		"Not enough BDs to alloc %d\r\n", NumBd);
+
+		return XST_FAILURE;
+	}
+
+	/* The BDs have been released by the consumer (read of SpscFreeIdx)
+	 * before they may be rewritten by the caller
+	 */
+	DATA_SYNC;
+
+	*BdSetPtr = RingPtr->FreeHead;
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->FreeHead, NumBd);
+	RingPtr->SpscAllocIdx += NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * SPSC counterpart of XAxiDma_BdRingUnAlloc(). A partial UnAlloc must
+ * include the last BD in the list that was allocated.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs to unallocate
+ * @param	BdSetPtr points to the first of the BDs to be returned.
+ *
+ * @return
+ *		- XST_SUCCESS if the BDs were unallocated.
+ *		- XST_INVALID_PARAM if passed in NumBd is not positive
+ *		- XST_FAILURE if NumBd parameter was greater that the number of
+ *		BDs in the preprocessing state, or BdSetPtr does not end at
+ *		the free group.
+ *
+ * @note	Producer side. This function can be used only when DMA is in
+ *		SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscUnAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd * BdSetPtr)
+{
+	XAxiDma_Bd *TmpBd;
+
+	if (NumBd <= 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscUnAlloc: negative BD"
+		" number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if ((int)(RingPtr->SpscAllocIdx - RingPtr->SpscToHwIdx) < NumBd) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		"Pre-allocated BDs less than requested %d\r\n", NumBd);
+
+		return XST_FAILURE;
+	}
+
+	TmpBd = BdSetPtr;
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, TmpBd, NumBd);
+
+	if (TmpBd != RingPtr->FreeHead) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		    "Unalloc does not go back to free head\r\n");
+
+		return XST_FAILURE;
+	}
+
+	XAXIDMA_RING_SEEKBACK(RingPtr, RingPtr->FreeHead, NumBd);
+	RingPtr->SpscAllocIdx -= NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * SPSC counterpart of XAxiDma_BdRingToHw(). The BDs are published to the
+ * consumer only after they have been written back and the tail descriptor
+ * register has been updated.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	BdSetPtr is the first BD of the set to commit to hardware.
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was accepted and enqueued to
+ *		hardware
+ *		- XST_INVALID_PARAM if passed in NumBd is negative
+ *		- XST_FAILURE if the set of BDs was rejected because the first
+ *		BD does not have its start-of-packet bit set, or the last BD
+ *		does not have its end-of-packet bit set, or any one of the BDs
+ *		has 0 length.
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingSpscAlloc()
+ *
+ * @note	Producer side. This function can be used only when DMA is in
+ *		SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscToHw(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd * BdSetPtr)
+{
+	XAxiDma_Bd *LastBdPtr;
+	int Status;
+
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscToHw: negative BD "
+			"number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingSpscAlloc() */
+	if (((int)(RingPtr->SpscAllocIdx - RingPtr->SpscToHwIdx) < NumBd) ||
+			(RingPtr->PreHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	/* Leaves the BDs written back, followed by a barrier */
+	Status = XAxiDma_BdRingPrepare(RingPtr, NumBd, BdSetPtr, &LastBdPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
+	RingPtr->HwTail = LastBdPtr;
+
+	XAxiDma_BdRingUpdateTail(RingPtr);
+
+	/* Publish the BDs to the consumer */
+	DATA_SYNC;
+	RingPtr->SpscToHwIdx += NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * SPSC counterpart of XAxiDma_BdRingFromHw().
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdLimit is the maximum number of BDs to return in the set. Use
+ *		XAXIDMA_ALL_BDS to return all BDs that have been processed.
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for examination.
+ *
+ * @return	The number of BDs processed by hardware. A value of 0 indicates
+ *		that no data is available. No more than BdLimit BDs will be
+ *		returned.
+ *
+ * @note	Consumer side. Treat BDs returned by this function as
+ *		read-only.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
+			     XAxiDma_Bd ** BdSetPtr)
+{
+	int HwCnt;
+	int BdCount;
+
+	HwCnt = (int)(RingPtr->SpscToHwIdx - RingPtr->SpscFromHwIdx);
+
+	/* The BDs counted in HwCnt are visible before they are examined */
+	DATA_SYNC;
+
+	if (HwCnt == 0) {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+
+	if (BdLimit > HwCnt) {
+		BdLimit = HwCnt;
+	}
+
+	/* HwTail belongs to the producer, so stop on the count only */
+	BdCount = XAxiDma_BdRingScan(RingPtr, BdLimit, NULL);
+
+	if (BdCount) {
+		*BdSetPtr = RingPtr->HwHead;
+		XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
+		RingPtr->SpscFromHwIdx += BdCount;
+
+		return BdCount;
+	}
+	else {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * SPSC counterpart of XAxiDma_BdRingFree(). The BDs are handed back to the
+ * producer once the caller is done examining them.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs to free.
+ * @param	BdSetPtr is the head of a list of BDs returned by
+ *		XAxiDma_BdRingSpscFromHw().
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was freed.
+ *		- XST_INVALID_PARAM if NumBd is negative
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingSpscFromHw().
+ *
+ * @note	Consumer side. This function can be used only when DMA is in
+ *		SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscFree(XAxiDma_BdRing * RingPtr, int NumBd,
+		      XAxiDma_Bd * BdSetPtr)
+{
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		    "BdRingSpscFree: negative BDs %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingSpscFromHw() */
+	if (((int)(RingPtr->SpscFromHwIdx - RingPtr->SpscFreeIdx) < NumBd) ||
+			(RingPtr->PostHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscFree: Error free BDs: "
+		"to free %d, PostHead %x to free ptr %x\r\n", NumBd,
+			(UINTPTR)RingPtr->PostHead,
+			(UINTPTR)BdSetPtr);
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PostHead, NumBd);
+
+	/* Reads of the BDs are complete before the producer may reuse them */
+	DATA_SYNC;
+	RingPtr->SpscFreeIdx += NumBd;
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
  * Check the internal data structures of the BD ring for the provided channel.
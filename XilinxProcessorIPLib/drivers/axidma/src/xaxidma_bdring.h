@@ -69,6 +69,7 @@
 *		       backward compatibility.
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
+*       ag   10/14/26  Added SPSC ring indices and functions.
 *
 * </pre>
 *
@@ -135,6 +136,10 @@ typedef struct {
 	int AllCnt;		/**< Total Number of BDs for channel */
 	int RingIndex;		/**< Ring Index */
 	int Cyclic;		/**< Check for cyclic DMA Mode */
+	volatile u32 SpscAllocIdx;	/**< SPSC: BDs allocated, producer */
+	volatile u32 SpscToHwIdx;	/**< SPSC: BDs given to hw, producer */
+	volatile u32 SpscFromHwIdx;	/**< SPSC: BDs taken from hw, consumer */
+	volatile u32 SpscFreeIdx;	/**< SPSC: BDs freed, consumer */
 } XAxiDma_BdRing;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -529,6 +534,18 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		XAxiDma_Bd ** BdSetPtr);
 int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 		XAxiDma_Bd * BdSetPtr);
+int XAxiDma_BdRingSpscInit(XAxiDma_BdRing * RingPtr);
+int XAxiDma_BdRingSpscGetFreeCnt(XAxiDma_BdRing * RingPtr);
+int XAxiDma_BdRingSpscAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd ** BdSetPtr);
+int XAxiDma_BdRingSpscUnAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd * BdSetPtr);
+int XAxiDma_BdRingSpscToHw(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd * BdSetPtr);
+int XAxiDma_BdRingSpscFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
+		XAxiDma_Bd ** BdSetPtr);
+int XAxiDma_BdRingSpscFree(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd * BdSetPtr);
 int XAxiDma_BdRingStart(XAxiDma_BdRing * RingPtr);
 int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing * RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing * RingPtr,
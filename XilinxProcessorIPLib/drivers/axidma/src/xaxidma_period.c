@@ -0,0 +1,490 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xaxidma_period.c
+* @addtogroup axidma_v9_5
+* @{
+ *
+ * Cyclic period rings on top of the scatter gather BD ring of either channel,
+ * for streams that run at a fixed rate such as audio.
+ *
+ * The buffer is split into NumPeriods periods of PeriodBytes each, and every
+ * period is bound to one BD for good. The channel runs in cyclic mode, so the
+ * engine loops over the periods without any descriptor work, and interrupts
+ * once per period. XAxiDma_PeriodRingPoll(), called from the channel
+ * interrupt handler, calls the period elapsed handler for every period the
+ * engine has completed.
+ *
+ * The application moves data with XAxiDma_PeriodRingAvail(),
+ * XAxiDma_PeriodRingAppAddr() and XAxiDma_PeriodRingCommit():
+ *   - MM2S (playback): Avail is the number of periods that can be filled,
+ *     AppAddr is the next period to fill and Commit hands it to the engine.
+ *     Every period the engine has played is cleared, so when the
+ *     application falls behind (underrun) the engine sends silence instead
+ *     of stale samples, and the application resumes on the period after the
+ *     one being played.
+ *   - S2MM (capture): Avail is the number of filled periods, AppAddr is the
+ *     oldest of them and Commit gives it back. When the engine comes round
+ *     to a period the application has not consumed yet (overrun) the oldest
+ *     periods are dropped.
+ * Each xrun is counted and reported to the xrun handler.
+ *
+ * The latency is set by the period size and the number of periods; e.g. two
+ * periods of 32 frames at 48 kHz give 1.3 ms of buffering in each direction.
+ *
+ * Typical use:
+ * <pre>
+ *	XAxiDma_BdRingCreate(XAxiDma_GetTxRing(&AxiDma), ...);
+ *	XAxiDma_PeriodRingInit(&Play, &AxiDma, XAXIDMA_DMA_TO_DEVICE,
+ *			BufBase, PeriodBytes, NumPeriods);
+ *	XAxiDma_PeriodRingSetHandler(&Play, PeriodElapsed, &App);
+ *	XAxiDma_PeriodRingStart(&Play);
+ *
+ *	// from the MM2S interrupt handler, after acknowledging the interrupt
+ *	XAxiDma_PeriodRingPoll(&Play);
+ *
+ *	// in PeriodElapsed or from a task
+ *	while (XAxiDma_PeriodRingAvail(&Play)) {
+ *		Fill(XAxiDma_PeriodRingAppAddr(&Play));
+ *		XAxiDma_PeriodRingCommit(&Play);
+ *	}
+ * </pre>
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 9.6   ag   10/14/26 First release
+ *
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* Address of a period of the ring */
+#define XAxiDma_PeriodAddr(PrPtr, Period) \
+	((PrPtr)->BufBase + ((UINTPTR)(Period) * (PrPtr)->PeriodBytes))
+
+/*****************************************************************************/
+/**
+ * Bind the periods of a buffer to the BD ring of one channel of a DMA engine,
+ * set the channel in cyclic mode and give all BDs to hardware.
+ *
+ * The BD ring must have been created with XAxiDma_BdRingCreate() with at
+ * least NumPeriods BDs, and must not be in use. The channel interrupts once
+ * per period; its interrupts are to be enabled by the application. For MM2S
+ * the buffer is cleared, so the engine sends silence until the application
+ * commits periods.
+ *
+ * @param	PrPtr is the period ring instance to be initialized.
+ * @param	InstancePtr is a pointer to the DMA engine instance, which
+ *		must be configured in SG mode.
+ * @param	Direction is XAXIDMA_DMA_TO_DEVICE or XAXIDMA_DEVICE_TO_DMA.
+ * @param	BufBase is the address of the first period. The periods are
+ *		laid out back to back in memory.
+ * @param	PeriodBytes is the size of each period in bytes.
+ * @param	NumPeriods is the number of periods, at least 2.
+ *
+ * @return
+ *		- XST_SUCCESS if the ring was set up
+ *		- XST_INVALID_PARAM if the engine has no such channel, is not
+ *		in SG mode, or a period size or address is invalid
+ *		- XST_FAILURE if the BD ring has fewer than NumPeriods free BDs
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiDma_PeriodRingInit(XAxiDma_PeriodRing *PrPtr, XAxiDma *InstancePtr,
+		int Direction, UINTPTR BufBase, u32 PeriodBytes,
+		u32 NumPeriods)
+{
+	XAxiDma_BdRing *RingPtr;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR BufAddr;
+	u32 Index;
+	u32 Ctrl;
+	int Status;
+
+	Xil_AssertNonvoid(PrPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((Direction == XAXIDMA_DMA_TO_DEVICE) ||
+			(Direction == XAXIDMA_DEVICE_TO_DMA));
+	Xil_AssertNonvoid(NumPeriods >= 2);
+
+	if (!InstancePtr->HasSg ||
+		((Direction == XAXIDMA_DMA_TO_DEVICE) && !InstancePtr->HasMm2S) ||
+		((Direction == XAXIDMA_DEVICE_TO_DMA) && !InstancePtr->HasS2Mm)) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			"PeriodRingInit: no such channel or not in SG mode\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (Direction == XAXIDMA_DMA_TO_DEVICE) {
+		RingPtr = XAxiDma_GetTxRing(InstancePtr);
+		Ctrl = XAXIDMA_BD_CTRL_TXSOF_MASK | XAXIDMA_BD_CTRL_TXEOF_MASK;
+	}
+	else {
+		RingPtr = XAxiDma_GetRxRing(InstancePtr);
+		Ctrl = 0;
+	}
+
+	if ((PeriodBytes == 0) || (PeriodBytes > RingPtr->MaxTransferLen)) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			"PeriodRingInit: invalid period size %d\r\n",
+			PeriodBytes);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (XAxiDma_BdRingGetFreeCnt(RingPtr) < (int)NumPeriods) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			"PeriodRingInit: not enough BDs %d/%d\r\n",
+			XAxiDma_BdRingGetFreeCnt(RingPtr), NumPeriods);
+
+		return XST_FAILURE;
+	}
+
+	PrPtr->InstancePtr = InstancePtr;
+	PrPtr->RingPtr = RingPtr;
+	PrPtr->Direction = Direction;
+	PrPtr->BufBase = BufBase;
+	PrPtr->PeriodBytes = PeriodBytes;
+	PrPtr->NumPeriods = NumPeriods;
+	PrPtr->HwPeriods = 0;
+	/* MM2S: the engine starts on period 0, the application fills from 1 */
+	PrPtr->AppPeriods = (Direction == XAXIDMA_DMA_TO_DEVICE) ? 1 : 0;
+	PrPtr->Xruns = 0;
+	PrPtr->Handler = NULL;
+	PrPtr->CallBackRef = NULL;
+	PrPtr->XrunHandler = NULL;
+	PrPtr->XrunRef = NULL;
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, (int)NumPeriods, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	BdCurPtr = BdPtr;
+	BufAddr = BufBase;
+	for (Index = 0; Index < NumPeriods; Index++) {
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, BufAddr);
+		if (Status == XST_SUCCESS) {
+			Status = XAxiDma_BdSetLength(BdCurPtr, PeriodBytes,
+					RingPtr->MaxTransferLen);
+		}
+		if (Status != XST_SUCCESS) {
+			XAxiDma_BdRingUnAlloc(RingPtr, (int)NumPeriods, BdPtr);
+
+			return XST_INVALID_PARAM;
+		}
+
+		XAxiDma_BdSetCtrl(BdCurPtr, Ctrl);
+		XAxiDma_BdSetId(BdCurPtr, Index);
+
+		if (Direction == XAXIDMA_DMA_TO_DEVICE) {
+			memset((void *)BufAddr, 0, PeriodBytes);
+			Xil_DCacheFlushRange(BufAddr, PeriodBytes);
+		}
+		else {
+			Xil_DCacheInvalidateRange(BufAddr, PeriodBytes);
+		}
+
+		BufAddr += PeriodBytes;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	/* One interrupt per period, without waiting for the delay timer */
+	(void)XAxiDma_BdRingSetCoalesce(RingPtr, 1, 0);
+
+	XAxiDma_BdRingEnableCyclicDMA(RingPtr);
+	XAxiDma_SelectCyclicMode(InstancePtr, Direction, 1);
+
+	Status = XAxiDma_BdRingToHw(RingPtr, (int)NumPeriods, BdPtr);
+	if (Status != XST_SUCCESS) {
+		XAxiDma_BdRingUnAlloc(RingPtr, (int)NumPeriods, BdPtr);
+
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Install the handler that is called for every period completed by the
+ * engine.
+ *
+ * @param	PrPtr is the period ring instance to be worked on.
+ * @param	FuncPtr is the handler function, called from
+ *		XAxiDma_PeriodRingPoll() with the index of the period.
+ * @param	CallBackRef is the upper layer callback reference passed back
+ *		when the handler is invoked.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+void XAxiDma_PeriodRingSetHandler(XAxiDma_PeriodRing *PrPtr,
+		XAxiDma_PeriodHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(PrPtr != NULL);
+	Xil_AssertVoid(FuncPtr != NULL);
+
+	PrPtr->Handler = FuncPtr;
+	PrPtr->CallBackRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+ * Install the handler that is called when an underrun (MM2S) or an overrun
+ * (S2MM) is detected. The ring has already recovered when it is called.
+ *
+ * @param	PrPtr is the period ring instance to be worked on.
+ * @param	FuncPtr is the handler function, called with the number of
+ *		xruns so far.
+ * @param	CallBackRef is the upper layer callback reference passed back
+ *		when the handler is invoked.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+void XAxiDma_PeriodRingSetXrunHandler(XAxiDma_PeriodRing *PrPtr,
+		XAxiDma_XrunHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(PrPtr != NULL);
+	Xil_AssertVoid(FuncPtr != NULL);
+
+	PrPtr->XrunHandler = FuncPtr;
+	PrPtr->XrunRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+ * Start the channel of the period ring. For MM2S, periods committed before
+ * the start are played straight away.
+ *
+ * @param	PrPtr is the period ring instance to be worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the channel was started
+ *		- XST_DMA_ERROR if the channel could not be started
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiDma_PeriodRingStart(XAxiDma_PeriodRing *PrPtr)
+{
+	Xil_AssertNonvoid(PrPtr != NULL);
+
+	return XAxiDma_BdRingStart(PrPtr->RingPtr);
+}
+
+/*****************************************************************************/
+/**
+ * Account for the periods completed by the engine, detect and recover from
+ * xruns, and call the period elapsed handler for each period.
+ *
+ * This function is meant to be called from the channel interrupt handler
+ * once the interrupt has been acknowledged.
+ *
+ * @param	PrPtr is the period ring instance to be worked on.
+ *
+ * @return	The number of periods completed since the last call.
+ *
+ * @note	The handlers are called in interrupt context. The other period
+ *		ring functions must not preempt this function for the same
+ *		ring.
+ *
+ *****************************************************************************/
+int XAxiDma_PeriodRingPoll(XAxiDma_PeriodRing *PrPtr)
+{
+	XAxiDma_BdRing *RingPtr;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR PeriodAddr;
+	u32 Period;
+	u32 Queued;
+	u8 Xrun;
+	int BdCount;
+	int Index;
+
+	Xil_AssertNonvoid(PrPtr != NULL);
+
+	RingPtr = PrPtr->RingPtr;
+
+	BdCount = XAxiDma_BdRingFromHw(RingPtr, XAXIDMA_ALL_BDS, &BdPtr);
+
+	BdCurPtr = BdPtr;
+	for (Index = 0; Index < BdCount; Index++) {
+		Period = XAxiDma_BdGetId(BdCurPtr);
+		PeriodAddr = XAxiDma_PeriodAddr(PrPtr, Period);
+
+		/* Arm the BD for the next lap */
+		XAxiDma_BdWrite(BdCurPtr, XAXIDMA_BD_STS_OFFSET, 0);
+		XAXIDMA_CACHE_FLUSH(BdCurPtr);
+
+		PrPtr->HwPeriods++;
+		Queued = PrPtr->AppPeriods - PrPtr->HwPeriods;
+		Xrun = FALSE;
+
+		if (PrPtr->Direction == XAXIDMA_DMA_TO_DEVICE) {
+			/* Next lap plays silence unless the period is filled */
+			memset((void *)PeriodAddr, 0, PrPtr->PeriodBytes);
+			Xil_DCacheFlushRange(PeriodAddr, PrPtr->PeriodBytes);
+
+			/* The engine is on a period that was not filled */
+			if ((Queued == 0) || (Queued > PrPtr->NumPeriods)) {
+				PrPtr->AppPeriods = PrPtr->HwPeriods + 1;
+				Xrun = TRUE;
+			}
+		}
+		else {
+			Xil_DCacheInvalidateRange(PeriodAddr,
+					PrPtr->PeriodBytes);
+
+			/* The engine is on a period that was not consumed */
+			if ((PrPtr->HwPeriods - PrPtr->AppPeriods) >=
+					PrPtr->NumPeriods) {
+				PrPtr->AppPeriods = PrPtr->HwPeriods -
+						(PrPtr->NumPeriods - 1);
+				Xrun = TRUE;
+			}
+		}
+
+		if (Xrun) {
+			PrPtr->Xruns++;
+			if (PrPtr->XrunHandler != NULL) {
+				PrPtr->XrunHandler(PrPtr->XrunRef,
+						PrPtr->Xruns);
+			}
+		}
+
+		if (PrPtr->Handler != NULL) {
+			PrPtr->Handler(PrPtr->CallBackRef, Period);
+		}
+
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/**
+ * Get the number of periods the application can work on: periods that can
+ * be filled for MM2S, filled periods that can be consumed for S2MM.
+ *
+ * @param	PrPtr is the period ring instance to be worked on.
+ *
+ * @return	The number of periods.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+u32 XAxiDma_PeriodRingAvail(XAxiDma_PeriodRing *PrPtr)
+{
+	Xil_AssertNonvoid(PrPtr != NULL);
+
+	if (PrPtr->Direction == XAXIDMA_DMA_TO_DEVICE) {
+		return PrPtr->NumPeriods -
+			(PrPtr->AppPeriods - PrPtr->HwPeriods);
+	}
+
+	return PrPtr->HwPeriods - PrPtr->AppPeriods;
+}
+
+/*****************************************************************************/
+/**
+ * Get the address of the period the application works on next: the next
+ * period to fill for MM2S, the oldest filled period for S2MM.
+ *
+ * @param	PrPtr is the period ring instance to be worked on.
+ *
+ * @return	The address of the period. It is only valid when
+ *		XAxiDma_PeriodRingAvail() is not 0.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+UINTPTR XAxiDma_PeriodRingAppAddr(XAxiDma_PeriodRing *PrPtr)
+{
+	Xil_AssertNonvoid(PrPtr != NULL);
+
+	return XAxiDma_PeriodAddr(PrPtr,
+			PrPtr->AppPeriods % PrPtr->NumPeriods);
+}
+
+/*****************************************************************************/
+/**
+ * Hand the period returned by XAxiDma_PeriodRingAppAddr() over: for MM2S it
+ * is flushed and will be played, for S2MM it is given back to the engine.
+ *
+ * @param	PrPtr is the period ring instance to be worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the period was handed over
+ *		- XST_FAILURE if no period is available to the application
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiDma_PeriodRingCommit(XAxiDma_PeriodRing *PrPtr)
+{
+	Xil_AssertNonvoid(PrPtr != NULL);
+
+	if (XAxiDma_PeriodRingAvail(PrPtr) == 0) {
+		return XST_FAILURE;
+	}
+
+	if (PrPtr->Direction == XAXIDMA_DMA_TO_DEVICE) {
+		Xil_DCacheFlushRange(XAxiDma_PeriodRingAppAddr(PrPtr),
+				PrPtr->PeriodBytes);
+	}
+
+	PrPtr->AppPeriods++;
+
+	return XST_SUCCESS;
+}
+/** @} */
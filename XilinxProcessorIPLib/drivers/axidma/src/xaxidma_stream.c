@@ -0,0 +1,424 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xaxidma_stream.c
+* @addtogroup axidma_v9_5
+* @{
+ *
+ * Zero-copy receive streaming on top of the scatter gather BD ring of the
+ * S2MM channel.
+ *
+ * The application registers a pool of equally sized buffers, each of which
+ * is bound to one BD of the receive ring. Filled buffers are lent to the
+ * application through a handler called from XAxiDma_StreamPoll(), and the
+ * application hands each of them back with XAxiDma_StreamRelease() once it
+ * is done with the data. Releasing a buffer only re-arms one BD; the length
+ * and control fields are set up once in XAxiDma_StreamInit().
+ *
+ * In cyclic mode the engine loops over the ring without waiting for the
+ * buffers to be released, so no descriptor work at all is done per buffer.
+ * The application then has to consume each buffer before the engine comes
+ * round to it again; completions that arrive while all other buffers are
+ * still lent are counted as overruns.
+ *
+ * Typical use:
+ * <pre>
+ *	XAxiDma_BdRingCreate(XAxiDma_GetRxRing(&AxiDma), ...);
+ *	XAxiDma_StreamInit(&Stream, &AxiDma, BufBase, BufSize, NumBufs, 0);
+ *	XAxiDma_StreamSetHandler(&Stream, BufferReady, &App);
+ *	XAxiDma_StreamStart(&Stream);
+ *
+ *	// from the S2MM interrupt handler, after acknowledging the interrupt
+ *	XAxiDma_StreamPoll(&Stream);
+ *
+ *	// once the application is done with the buffer
+ *	XAxiDma_StreamRelease(&Stream, BufId);
+ * </pre>
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 9.6   ag   10/14/26 First release
+ *
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma.h"
+
+/************************** Function Prototypes ******************************/
+
+static void XAxiDma_StreamStubHandler(void *CallBackRef, u32 BufId,
+		UINTPTR BufAddr, u32 Length);
+
+/*****************************************************************************/
+/**
+ * Bind a pool of receive buffers to the S2MM BD ring of a DMA engine and give
+ * all of them to hardware.
+ *
+ * The BD ring must have been created with XAxiDma_BdRingCreate() with at
+ * least NumBufs BDs, and must not be in use.
+ *
+ * @param	StreamPtr is the stream instance to be initialized.
+ * @param	InstancePtr is a pointer to the DMA engine instance, which
+ *		must be configured in SG mode.
+ * @param	BufBase is the address of the first buffer. The buffers are
+ *		laid out back to back in memory.
+ * @param	BufSize is the size of each buffer in bytes.
+ * @param	NumBufs is the number of buffers in the pool.
+ * @param	Cyclic selects cyclic mode (TRUE) or release driven mode
+ *		(FALSE).
+ *
+ * @return
+ *		- XST_SUCCESS if the stream was set up
+ *		- XST_INVALID_PARAM if the engine has no S2MM channel, is not
+ *		in SG mode, or a buffer size or address is invalid
+ *		- XST_FAILURE if the BD ring has fewer than NumBufs free BDs
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiDma_StreamInit(XAxiDma_Stream *StreamPtr, XAxiDma *InstancePtr,
+		UINTPTR BufBase, u32 BufSize, u32 NumBufs, int Cyclic)
+{
+	XAxiDma_BdRing *RingPtr;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR BufAddr;
+	u32 Index;
+	int Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(NumBufs > 0);
+
+	if (!InstancePtr->HasS2Mm || !InstancePtr->HasSg) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			"StreamInit: no S2MM channel or not in SG mode\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	RingPtr = XAxiDma_GetRxRing(InstancePtr);
+
+	if ((BufSize == 0) || (BufSize > RingPtr->MaxTransferLen)) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			"StreamInit: invalid buffer size %d\r\n", BufSize);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (XAxiDma_BdRingGetFreeCnt(RingPtr) < (int)NumBufs) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+			"StreamInit: not enough BDs %d/%d\r\n",
+			XAxiDma_BdRingGetFreeCnt(RingPtr), NumBufs);
+
+		return XST_FAILURE;
+	}
+
+	StreamPtr->InstancePtr = InstancePtr;
+	StreamPtr->RingPtr = RingPtr;
+	StreamPtr->BufBase = BufBase;
+	StreamPtr->BufSize = BufSize;
+	StreamPtr->NumBufs = NumBufs;
+	StreamPtr->Cyclic = Cyclic;
+	StreamPtr->LentCnt = 0;
+	StreamPtr->Overruns = 0;
+	StreamPtr->Handler = XAxiDma_StreamStubHandler;
+	StreamPtr->CallBackRef = StreamPtr;
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, (int)NumBufs, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Bind buffer Index to the Index-th BD, for good in cyclic mode */
+	BdCurPtr = BdPtr;
+	BufAddr = BufBase;
+	for (Index = 0; Index < NumBufs; Index++) {
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, BufAddr);
+		if (Status == XST_SUCCESS) {
+			Status = XAxiDma_BdSetLength(BdCurPtr, BufSize,
+					RingPtr->MaxTransferLen);
+		}
+		if (Status != XST_SUCCESS) {
+			XAxiDma_BdRingUnAlloc(RingPtr, (int)NumBufs, BdPtr);
+
+			return XST_INVALID_PARAM;
+		}
+
+		/* The hardware sets the SOF/EOF bits per stream status */
+		XAxiDma_BdSetCtrl(BdCurPtr, 0);
+		XAxiDma_BdSetId(BdCurPtr, Index);
+
+		/* No dirty lines may be evicted over the received data */
+		Xil_DCacheInvalidateRange(BufAddr, BufSize);
+
+		BufAddr += BufSize;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	if (Cyclic) {
+		XAxiDma_BdRingEnableCyclicDMA(RingPtr);
+		XAxiDma_SelectCyclicMode(InstancePtr, XAXIDMA_DEVICE_TO_DMA, 1);
+	}
+
+	Status = XAxiDma_BdRingToHw(RingPtr, (int)NumBufs, BdPtr);
+	if (Status != XST_SUCCESS) {
+		XAxiDma_BdRingUnAlloc(RingPtr, (int)NumBufs, BdPtr);
+
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Install the handler that is called for every filled buffer lent to the
+ * application.
+ *
+ * The handler is called from XAxiDma_StreamPoll() with the buffer index,
+ * its address and the number of bytes received. In release driven mode the
+ * buffer stays with the application until it is passed to
+ * XAxiDma_StreamRelease().
+ *
+ * @param	StreamPtr is the stream instance to be worked on.
+ * @param	FuncPtr is the handler function.
+ * @param	CallBackRef is the upper layer callback reference passed back
+ *		when the handler is invoked.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+void XAxiDma_StreamSetHandler(XAxiDma_Stream *StreamPtr,
+		XAxiDma_StreamHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(FuncPtr != NULL);
+
+	StreamPtr->Handler = FuncPtr;
+	StreamPtr->CallBackRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+ * Start the S2MM channel of the stream.
+ *
+ * @param	StreamPtr is the stream instance to be worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the channel was started
+ *		- XST_DMA_ERROR if the channel could not be started
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiDma_StreamStart(XAxiDma_Stream *StreamPtr)
+{
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	return XAxiDma_BdRingStart(StreamPtr->RingPtr);
+}
+
+/*****************************************************************************/
+/**
+ * Harvest the buffers filled by hardware and lend each of them to the
+ * application through the stream handler.
+ *
+ * This function is meant to be called from the S2MM interrupt handler once
+ * the interrupt has been acknowledged, or periodically in polled systems.
+ *
+ * @param	StreamPtr is the stream instance to be worked on.
+ *
+ * @return	The number of buffers handed to the application.
+ *
+ * @note	In release driven mode this function must not be preempted by
+ *		XAxiDma_StreamRelease() for the same stream.
+ *
+ *****************************************************************************/
+int XAxiDma_StreamPoll(XAxiDma_Stream *StreamPtr)
+{
+	XAxiDma_BdRing *RingPtr;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR BufAddr;
+	u32 BufId;
+	u32 Length;
+	int BdCount;
+	int Index;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	RingPtr = StreamPtr->RingPtr;
+
+	BdCount = XAxiDma_BdRingFromHw(RingPtr, XAXIDMA_ALL_BDS, &BdPtr);
+
+	/* Free the BDs up front so that the handler can release buffers
+	 * straight away. Those BDs are reallocated in ring order, behind the
+	 * BD being examined, so the fields read below stay intact. Cyclic
+	 * rings keep all BDs with hardware.
+	 */
+	if ((BdCount > 0) && !StreamPtr->Cyclic) {
+		XAxiDma_BdRingFree(RingPtr, BdCount, BdPtr);
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0; Index < BdCount; Index++) {
+		BufId = XAxiDma_BdGetId(BdCurPtr);
+		BufAddr = StreamPtr->BufBase + ((UINTPTR)BufId *
+					StreamPtr->BufSize);
+		Length = XAxiDma_BdGetActualLength(BdCurPtr,
+					RingPtr->MaxTransferLen);
+
+		if (StreamPtr->Cyclic) {
+			/* The engine does not wait for the buffer to be
+			 * released; arm the BD for the next lap now
+			 */
+			if (StreamPtr->LentCnt >= (StreamPtr->NumBufs - 1)) {
+				StreamPtr->Overruns++;
+			}
+			XAxiDma_BdWrite(BdCurPtr, XAXIDMA_BD_STS_OFFSET, 0);
+			XAXIDMA_CACHE_FLUSH(BdCurPtr);
+		}
+		StreamPtr->LentCnt++;
+
+		Xil_DCacheInvalidateRange(BufAddr, Length);
+		StreamPtr->Handler(StreamPtr->CallBackRef, BufId, BufAddr,
+					Length);
+
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/**
+ * Hand a buffer lent to the application back to hardware.
+ *
+ * In release driven mode the next free BD is pointed at the buffer and given
+ * to hardware; the length and control fields set up at initialization are
+ * reused as they are. In cyclic mode the buffer is already back in the ring
+ * and only the bookkeeping is updated.
+ *
+ * @param	StreamPtr is the stream instance to be worked on.
+ * @param	BufId is the buffer index passed to the stream handler.
+ *
+ * @return
+ *		- XST_SUCCESS if the buffer was handed back
+ *		- XST_INVALID_PARAM if BufId is not lent to the application
+ *		- XST_FAILURE if the buffer could not be given to hardware
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+int XAxiDma_StreamRelease(XAxiDma_Stream *StreamPtr, u32 BufId)
+{
+	XAxiDma_BdRing *RingPtr;
+	XAxiDma_Bd *BdPtr;
+	UINTPTR BufAddr;
+	int Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	if ((BufId >= StreamPtr->NumBufs) || (StreamPtr->LentCnt == 0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	StreamPtr->LentCnt--;
+
+	if (StreamPtr->Cyclic) {
+		return XST_SUCCESS;
+	}
+
+	RingPtr = StreamPtr->RingPtr;
+	BufAddr = StreamPtr->BufBase + ((UINTPTR)BufId * StreamPtr->BufSize);
+
+	/* The CPU may have pulled lines of the buffer back into the cache */
+	Xil_DCacheInvalidateRange(BufAddr, StreamPtr->BufSize);
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, 1, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		StreamPtr->LentCnt++;
+
+		return XST_FAILURE;
+	}
+
+	/* BDs are recycled in ring order, so only the buffer binding moves */
+	(void)XAxiDma_BdSetBufAddr(BdPtr, BufAddr);
+	XAxiDma_BdSetId(BdPtr, BufId);
+
+	Status = XAxiDma_BdRingToHw(RingPtr, 1, BdPtr);
+	if (Status != XST_SUCCESS) {
+		XAxiDma_BdRingUnAlloc(RingPtr, 1, BdPtr);
+		StreamPtr->LentCnt++;
+
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This is a stub for the stream handler. It is installed by
+ * XAxiDma_StreamInit() in case the application forgot to set a handler,
+ * and returns the buffer to hardware straight away.
+ *
+ * @param	CallBackRef is the stream instance.
+ * @param	BufId is the buffer index.
+ * @param	BufAddr is the buffer address, unused.
+ * @param	Length is the number of bytes received, unused.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+static void XAxiDma_StreamStubHandler(void *CallBackRef, u32 BufId,
+		UINTPTR BufAddr, u32 Length)
+{
+	(void)BufAddr;
+	(void)Length;
+
+	(void)XAxiDma_StreamRelease((XAxiDma_Stream *)CallBackRef, BufId);
+}
+/** @} */
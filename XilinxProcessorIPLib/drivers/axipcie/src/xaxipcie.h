@@ -81,6 +81,16 @@
 * the caller to enable/disable each individual interrupt as well as get/clear
 * pending interrupts. Implementation of callback handlers is left to the user.
 *
+* <b>Enumeration</b>
+*
+* When the IP is a root complex, XAxiPcie_Enumerate() scans the hierarchy
+* below the root port through the memory mapped ECAM window, assigns bus
+* numbers to the bridges it finds and records every function in an
+* XAxiPcie_EnumCache. Only function 0 of each device is probed, so empty
+* device slots cost one read. After a link retrain or hot reset,
+* XAxiPcie_EnumerateFromCache() restores the bridge bus numbers and checks
+* the cached functions without a new scan.
+*
 *
 * @note
 *
@@ -136,6 +146,8 @@
 *       ms   04/05/17 Added tabspace for return statements in functions
 *                     of axipcie examples for proper documentation while
 *                     generating doxygen.
+*       ag   10/14/26 Added the enumeration engine and topology cache in
+*                     xaxipcie_enum.c.
 *
 * </pre>
 *
@@ -177,6 +189,13 @@ extern "C" {
 #define XAXIPCIE_VSEC1		0x00 /**< First VSEC Register */
 #define XAXIPCIE_VSEC2		0x01 /**< Second VSEC Register */
 
+/*
+ * Number of functions an enumeration cache can hold.
+ */
+#ifndef XAXIPCIE_ENUM_MAX_FUNCS
+#define XAXIPCIE_ENUM_MAX_FUNCS	32
+#endif
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -222,6 +241,35 @@ typedef struct {
 	u32 UpperAddr;		/**< Upper 32 bits of translation value */
 } XAxiPcie_BarAddr;
 
+/**
+ * One function found by XAxiPcie_Enumerate().
+ */
+typedef struct {
+	u8  Bus;		/**< Bus number */
+	u8  Device;		/**< Device number */
+	u8  Function;		/**< Function number */
+	u8  HeaderType;		/**< Header type, without the multi function
+				 * bit */
+	u32 Id;			/**< Device ID (31:16) and Vendor ID (15:0) */
+	u32 ClassRev;		/**< Class code (31:8) and Revision ID (7:0) */
+	u32 BusNumbers;		/**< Bridges only: Primary/Secondary/
+				 * Subordinate Bus Number register as
+				 * programmed */
+} XAxiPcie_EnumFunc;
+
+/**
+ * Topology recorded by XAxiPcie_Enumerate(). Functions are stored in
+ * discovery order, so each bridge comes before the functions below it.
+ */
+typedef struct {
+	XAxiPcie_EnumFunc Func[XAXIPCIE_ENUM_MAX_FUNCS]; /**< Functions */
+	u32 NumFuncs;		/**< Number of valid entries in Func */
+	u32 RootBusNumbers;	/**< Root port Primary/Secondary/Subordinate
+				 * Bus Number register as programmed */
+	u8  LastBus;		/**< Highest bus number assigned */
+	u32 IsValid;		/**< Cache describes the whole hierarchy */
+} XAxiPcie_EnumCache;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 #ifndef XAxiPcie_GetRequestId
@@ -319,6 +367,14 @@ void XAxiPcie_ReadRemoteConfigSpace(XAxiPcie *InstancePtr, u8 Bus, u8 Device,
 		u8 Function, u16 Offset, u32 *DataPtr);
 void XAxiPcie_WriteRemoteConfigSpace(XAxiPcie *InstancePtr, u8 Bus, u8 Device,
 					u8 Function, u16 Offset, u32 Data);
+/*
+ * Enumeration Functions.
+ * This API is implemented in xaxipcie_enum.c
+ */
+int XAxiPcie_Enumerate(XAxiPcie *InstancePtr, XAxiPcie_EnumCache *CachePtr);
+int XAxiPcie_EnumerateFromCache(XAxiPcie *InstancePtr,
+					XAxiPcie_EnumCache *CachePtr);
+
 /*
  * Interrupt Functions.
  * This API is implemented in xaxipcie_intr.c
@@ -0,0 +1,513 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************
+**
+* @file xaxipcie_enum.c
+* @addtogroup axipcie_v3_1
+* @{
+*
+* This file implements the enumeration engine of the XAxiPcie IP when it is
+* configured as a root complex.
+*
+* The scan reads configuration headers straight from the memory mapped ECAM
+* window and waits for the ECAM to be idle once per function rather than once
+* per dword. Function 0 is probed first, and an empty slot is skipped
+* without probing functions 1 to 7. Single function devices are not probed
+* past function 0. The secondary bus of a root or downstream port is only
+* probed for device 0, since a PCI Express link has a single device on it.
+*
+* Bridges are given bus numbers depth first while they are found. The
+* resulting topology is kept in an XAxiPcie_EnumCache so that it can be
+* restored and checked after a link retrain with one read per function.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 3.1   ag   10/14/26  Original code.
+* </pre>
+*
+******************************************************************************/
+
+/****************************** Include Files ********************************/
+#include "xaxipcie.h"
+
+/*************************** Constant Definitions ****************************/
+
+/*
+ * Configuration header registers, as dword numbers.
+ */
+#define XAXIPCIE_CFG_ID_REG		0x00 /**< Vendor ID/Device ID */
+#define XAXIPCIE_CFG_CMD_STATUS_REG	0x01 /**< Command/Status */
+#define XAXIPCIE_CFG_CLASS_REV_REG	0x02 /**< Revision ID/Class Code */
+#define XAXIPCIE_CFG_HEADER_REG		0x03 /**< Header Type and others */
+#define XAXIPCIE_CFG_BUS_NUM_REG	0x06 /**< Primary/Secondary/
+					      * Subordinate Bus Number */
+#define XAXIPCIE_CFG_CAP_PTR_REG	0x0D /**< Capabilities Pointer */
+
+#define XAXIPCIE_CFG_VENDOR_MASK	0x0000FFFF /**< Vendor ID */
+#define XAXIPCIE_CFG_VENDOR_NONE	0x0000FFFF /**< No function */
+#define XAXIPCIE_CFG_CAP_LIST_MASK	0x00100000 /**< Capabilities List */
+#define XAXIPCIE_CFG_HEADER_SHIFT	16	   /**< Header Type shift */
+#define XAXIPCIE_CFG_HEADER_MASK	0x7F	   /**< Header layout */
+#define XAXIPCIE_CFG_MULTI_FUN_MASK	0x00800000 /**< Multi function */
+#define XAXIPCIE_CFG_HEADER_BRIDGE	0x01	   /**< Type 1 header */
+#define XAXIPCIE_CFG_CAP_PTR_MASK	0xFC	   /**< Capability pointer */
+
+#define XAXIPCIE_CFG_BUS_PRIMARY_MASK	0x000000FF /**< Primary Bus */
+#define XAXIPCIE_CFG_BUS_SEC_SHIFT	8	   /**< Secondary Bus */
+#define XAXIPCIE_CFG_BUS_SUB_SHIFT	16	   /**< Subordinate Bus */
+#define XAXIPCIE_CFG_BUS_SUB_MASK	0x00FF0000 /**< Subordinate Bus */
+#define XAXIPCIE_CFG_BUS_KEEP_MASK	0xFF000000 /**< Latency Timer */
+
+/*
+ * PCI Express Capability.
+ */
+#define XAXIPCIE_CAP_ID_MASK		0xFF	/**< Capability ID */
+#define XAXIPCIE_CAP_ID_PCIE		0x10	/**< PCI Express */
+#define XAXIPCIE_CAP_NEXT_SHIFT		8	/**< Next Capability */
+#define XAXIPCIE_CAP_PORT_TYPE_SHIFT	20	/**< Device/Port Type */
+#define XAXIPCIE_CAP_PORT_TYPE_MASK	0x0F	/**< Device/Port Type */
+#define XAXIPCIE_PORT_TYPE_ROOT		0x04	/**< Root Port */
+#define XAXIPCIE_PORT_TYPE_DOWNSTREAM	0x06	/**< Switch Downstream Port */
+#define XAXIPCIE_CAP_MAX_WALK		48	/**< Bound on the list walk */
+
+#define XAXIPCIE_ENUM_MAX_DEV		32	/**< Devices on a bus */
+#define XAXIPCIE_ENUM_MAX_FUN		8	/**< Functions in a device */
+
+/***************************** Type Definitions ******************************/
+
+/****************** Macros (Inline Functions) Definitions ********************/
+
+/*
+ * ECAM window offset of a configuration register.
+ */
+#define XAxiPcie_EnumAddr(Bus, Device, Function, Reg)			\
+	(((((u32)(Bus)) << XAXIPCIE_ECAM_BUS_SHIFT) |			\
+	  (((u32)(Device)) << XAXIPCIE_ECAM_DEV_SHIFT) |		\
+	  (((u32)(Function)) << XAXIPCIE_ECAM_FUN_SHIFT) |		\
+	  (((u32)(Reg)) << XAXIPCIE_ECAM_REG_SHIFT)) & XAXIPCIE_ECAM_MASK)
+
+#define XAxiPcie_EnumRead(InstancePtr, Bus, Device, Function, Reg)	\
+	XAxiPcie_ReadReg((InstancePtr)->Config.BaseAddress,		\
+		XAxiPcie_EnumAddr((Bus), (Device), (Function), (Reg)))
+
+/*************************** Variable Definitions ****************************/
+
+/*************************** Function Prototypes *****************************/
+
+static void XAxiPcie_EnumWaitEcam(XAxiPcie *InstancePtr);
+static void XAxiPcie_EnumWrite(XAxiPcie *InstancePtr, u8 Bus, u8 Device,
+				u8 Function, u8 Reg, u32 Data);
+static u32 XAxiPcie_EnumIsSingleDevice(XAxiPcie *InstancePtr, u8 Bus,
+				u8 Device, u8 Function);
+static int XAxiPcie_EnumScanBus(XAxiPcie *InstancePtr,
+				XAxiPcie_EnumCache *CachePtr, u8 Bus,
+				u32 SingleDevice, u8 LastBus, u8 *NextBusPtr);
+
+/*****************************************************************************/
+/**
+* Enumerate the PCIe hierarchy below the root port.
+*
+* The root port and every bridge found are given bus numbers depth first,
+* starting at bus 1 for the root port secondary bus. Each function found is
+* recorded in the cache.
+*
+* @param 	InstancePtr is the XAxiPcie instance to operate on.
+* @param 	CachePtr is the cache receiving the topology.
+*
+* @return
+*		- XST_SUCCESS if the whole hierarchy was recorded.
+*		- XST_BUFFER_TOO_SMALL if there were more functions than
+*		  XAXIPCIE_ENUM_MAX_FUNCS. Bus numbers are still assigned to
+*		  the whole hierarchy but the cache is not valid.
+*		- XST_FAILURE if the ECAM window has no room for a bus below
+*		  the root port.
+*
+* @note 	This function is valid only when IP is configured as a
+*		root complex. Memory and I/O resources are not assigned.
+*
+******************************************************************************/
+int XAxiPcie_Enumerate(XAxiPcie *InstancePtr, XAxiPcie_EnumCache *CachePtr)
+{
+	u32 RootBusNumbers;
+	u8 LastBus;
+	u8 NextBus;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->Config.IncludeRootComplex ==
+							XAXIPCIE_IS_RC);
+
+	CachePtr->NumFuncs = 0;
+	CachePtr->IsValid = FALSE;
+
+	/* The ECAM window decodes MaxNumOfBuses bits of bus number */
+	if (InstancePtr->MaxNumOfBuses >= 8) {
+		LastBus = 0xFF;
+	} else {
+		LastBus = (u8)((1U << InstancePtr->MaxNumOfBuses) - 1U);
+	}
+
+	if (LastBus == 0) {
+		return XST_FAILURE;
+	}
+
+	/* Open all the remaining buses below the root port for the scan */
+	XAxiPcie_ReadLocalConfigSpace(InstancePtr, XAXIPCIE_CFG_BUS_NUM_REG,
+							&RootBusNumbers);
+	RootBusNumbers = (RootBusNumbers & XAXIPCIE_CFG_BUS_KEEP_MASK) |
+			((u32)LastBus << XAXIPCIE_CFG_BUS_SUB_SHIFT) |
+			((u32)1 << XAXIPCIE_CFG_BUS_SEC_SHIFT);
+	XAxiPcie_WriteLocalConfigSpace(InstancePtr, XAXIPCIE_CFG_BUS_NUM_REG,
+							RootBusNumbers);
+
+	NextBus = 1;
+	Status = XAxiPcie_EnumScanBus(InstancePtr, CachePtr, 1, TRUE, LastBus,
+								&NextBus);
+
+	/* Close the root port range on the buses that were used */
+	RootBusNumbers = (RootBusNumbers & ~XAXIPCIE_CFG_BUS_SUB_MASK) |
+			((u32)NextBus << XAXIPCIE_CFG_BUS_SUB_SHIFT);
+	XAxiPcie_WriteLocalConfigSpace(InstancePtr, XAXIPCIE_CFG_BUS_NUM_REG,
+							RootBusNumbers);
+
+	CachePtr->RootBusNumbers = RootBusNumbers;
+	CachePtr->LastBus = NextBus;
+
+	if (Status == XST_SUCCESS) {
+		CachePtr->IsValid = TRUE;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Re-enumerate the PCIe hierarchy from a cache filled by
+* XAxiPcie_Enumerate(), typically after a link retrain or hot reset.
+*
+* The bus numbers of the root port and of the cached bridges are written
+* back, parents first, and the Vendor/Device ID of every cached function is
+* checked. Empty slots are not probed again.
+*
+* @param 	InstancePtr is the XAxiPcie instance to operate on.
+* @param 	CachePtr is the cache filled by XAxiPcie_Enumerate().
+*
+* @return
+*		- XST_SUCCESS if the hierarchy matches the cache.
+*		- XST_FAILURE if the cache is not valid or a cached function
+*		  is missing or changed. The cache is invalidated and
+*		  XAxiPcie_Enumerate() must be called again.
+*
+* @note 	This function is valid only when IP is configured as a
+*		root complex. The link must be up and the devices ready to
+*		accept configuration requests.
+*
+******************************************************************************/
+int XAxiPcie_EnumerateFromCache(XAxiPcie *InstancePtr,
+					XAxiPcie_EnumCache *CachePtr)
+{
+	XAxiPcie_EnumFunc *FuncPtr;
+	u32 Index;
+	u32 Id;
+	int Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->Config.IncludeRootComplex ==
+							XAXIPCIE_IS_RC);
+
+	if (CachePtr->IsValid != TRUE) {
+		return XST_FAILURE;
+	}
+
+	XAxiPcie_WriteLocalConfigSpace(InstancePtr, XAXIPCIE_CFG_BUS_NUM_REG,
+						CachePtr->RootBusNumbers);
+
+	for (Index = 0; Index < CachePtr->NumFuncs; Index++) {
+		FuncPtr = &CachePtr->Func[Index];
+
+		XAxiPcie_EnumWaitEcam(InstancePtr);
+		Id = XAxiPcie_EnumRead(InstancePtr, FuncPtr->Bus,
+				FuncPtr->Device, FuncPtr->Function,
+				XAXIPCIE_CFG_ID_REG);
+		if (Id != FuncPtr->Id) {
+			CachePtr->IsValid = FALSE;
+			Status = XST_FAILURE;
+			break;
+		}
+
+		if ((FuncPtr->HeaderType == XAXIPCIE_CFG_HEADER_BRIDGE) &&
+						(FuncPtr->BusNumbers != 0)) {
+			XAxiPcie_EnumWrite(InstancePtr, FuncPtr->Bus,
+					FuncPtr->Device, FuncPtr->Function,
+					XAXIPCIE_CFG_BUS_NUM_REG,
+					FuncPtr->BusNumbers);
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Wait for the ECAM to be idle.
+*
+* @param 	InstancePtr is the XAxiPcie instance to operate on.
+*
+* @return 	None
+*
+* @note 	None
+*
+******************************************************************************/
+static void XAxiPcie_EnumWaitEcam(XAxiPcie *InstancePtr)
+{
+	while (XAxiPcie_IsEcamBusy(InstancePtr));
+}
+
+/*****************************************************************************/
+/**
+* Write a configuration register of a function through the ECAM window.
+*
+* @param 	InstancePtr is the XAxiPcie instance to operate on.
+* @param 	Bus is the function's Bus number.
+* @param 	Device is the function's Device number.
+* @param 	Function is the function's Function number.
+* @param 	Reg is the dword number of the register.
+* @param 	Data is the value to write.
+*
+* @return 	None
+*
+* @note 	None
+*
+******************************************************************************/
+static void XAxiPcie_EnumWrite(XAxiPcie *InstancePtr, u8 Bus, u8 Device,
+				u8 Function, u8 Reg, u32 Data)
+{
+	XAxiPcie_EnumWaitEcam(InstancePtr);
+	XAxiPcie_WriteReg(InstancePtr->Config.BaseAddress,
+			XAxiPcie_EnumAddr(Bus, Device, Function, Reg), Data);
+}
+
+/*****************************************************************************/
+/**
+* Tell whether the secondary bus of a bridge can only hold device 0, which
+* is the case for root ports and switch downstream ports.
+*
+* @param 	InstancePtr is the XAxiPcie instance to operate on.
+* @param 	Bus is the bridge's Bus number.
+* @param 	Device is the bridge's Device number.
+* @param 	Function is the bridge's Function number.
+*
+* @return 	TRUE if only device 0 needs to be probed, FALSE otherwise.
+*
+* @note 	None
+*
+******************************************************************************/
+static u32 XAxiPcie_EnumIsSingleDevice(XAxiPcie *InstancePtr, u8 Bus,
+				u8 Device, u8 Function)
+{
+	u32 Data;
+	u32 Ptr;
+	u32 PortType;
+	u32 Count;
+
+	Data = XAxiPcie_EnumRead(InstancePtr, Bus, Device, Function,
+					XAXIPCIE_CFG_CMD_STATUS_REG);
+	if ((Data & XAXIPCIE_CFG_CAP_LIST_MASK) == 0) {
+		return FALSE;
+	}
+
+	Ptr = XAxiPcie_EnumRead(InstancePtr, Bus, Device, Function,
+			XAXIPCIE_CFG_CAP_PTR_REG) & XAXIPCIE_CFG_CAP_PTR_MASK;
+
+	for (Count = 0; (Ptr != 0) && (Count < XAXIPCIE_CAP_MAX_WALK);
+								Count++) {
+		Data = XAxiPcie_EnumRead(InstancePtr, Bus, Device, Function,
+								Ptr >> 2);
+		if ((Data & XAXIPCIE_CAP_ID_MASK) == XAXIPCIE_CAP_ID_PCIE) {
+			PortType = (Data >> XAXIPCIE_CAP_PORT_TYPE_SHIFT) &
+						XAXIPCIE_CAP_PORT_TYPE_MASK;
+			return ((PortType == XAXIPCIE_PORT_TYPE_ROOT) ||
+				(PortType == XAXIPCIE_PORT_TYPE_DOWNSTREAM)) ?
+				TRUE : FALSE;
+		}
+		Ptr = (Data >> XAXIPCIE_CAP_NEXT_SHIFT) &
+						XAXIPCIE_CFG_CAP_PTR_MASK;
+	}
+
+	return FALSE;
+}
+
+/*****************************************************************************/
+/**
+* Scan one bus, recording its functions and descending into the bridges.
+*
+* @param 	InstancePtr is the XAxiPcie instance to operate on.
+* @param 	CachePtr is the cache receiving the topology.
+* @param 	Bus is the bus to scan.
+* @param 	SingleDevice is TRUE if only device 0 can be present.
+* @param 	LastBus is the highest bus number the ECAM window decodes.
+* @param 	NextBusPtr holds the highest bus number assigned so far and
+*		is updated with the buses assigned below this one.
+*
+* @return
+*		- XST_SUCCESS if all functions were recorded.
+*		- XST_BUFFER_TOO_SMALL if the cache overflowed.
+*
+* @note 	The recursion depth is bounded by the bridge nesting, which is
+*		itself bounded by the number of bus numbers.
+*
+******************************************************************************/
+static int XAxiPcie_EnumScanBus(XAxiPcie *InstancePtr,
+				XAxiPcie_EnumCache *CachePtr, u8 Bus,
+				u32 SingleDevice, u8 LastBus, u8 *NextBusPtr)
+{
+	XAxiPcie_EnumFunc *FuncPtr;
+	u32 NumDevices;
+	u32 NumFunctions;
+	u32 Device;
+	u32 Function;
+	u32 Id;
+	u32 Header;
+	u32 BusNumbers;
+	u32 Index;
+	u8 Secondary;
+	int Result;
+	int Status = XST_SUCCESS;
+
+	NumDevices = (SingleDevice == TRUE) ? 1 : XAXIPCIE_ENUM_MAX_DEV;
+
+	for (Device = 0; Device < NumDevices; Device++) {
+		/* Function 0 tells whether the slot is populated at all */
+		XAxiPcie_EnumWaitEcam(InstancePtr);
+		Id = XAxiPcie_EnumRead(InstancePtr, Bus, Device, 0,
+							XAXIPCIE_CFG_ID_REG);
+		if ((Id & XAXIPCIE_CFG_VENDOR_MASK) ==
+						XAXIPCIE_CFG_VENDOR_NONE) {
+			continue;
+		}
+		Header = XAxiPcie_EnumRead(InstancePtr, Bus, Device, 0,
+						XAXIPCIE_CFG_HEADER_REG);
+		NumFunctions = ((Header & XAXIPCIE_CFG_MULTI_FUN_MASK) != 0) ?
+						XAXIPCIE_ENUM_MAX_FUN : 1;
+
+		for (Function = 0; Function < NumFunctions; Function++) {
+			if (Function != 0) {
+				XAxiPcie_EnumWaitEcam(InstancePtr);
+				Id = XAxiPcie_EnumRead(InstancePtr, Bus,
+						Device, Function,
+						XAXIPCIE_CFG_ID_REG);
+				if ((Id & XAXIPCIE_CFG_VENDOR_MASK) ==
+						XAXIPCIE_CFG_VENDOR_NONE) {
+					continue;
+				}
+				Header = XAxiPcie_EnumRead(InstancePtr, Bus,
+						Device, Function,
+						XAXIPCIE_CFG_HEADER_REG);
+			}
+
+			Index = CachePtr->NumFuncs;
+			FuncPtr = NULL;
+			if (Index < XAXIPCIE_ENUM_MAX_FUNCS) {
+				FuncPtr = &CachePtr->Func[Index];
+				FuncPtr->Bus = Bus;
+				FuncPtr->Device = (u8)Device;
+				FuncPtr->Function = (u8)Function;
+				FuncPtr->HeaderType = (u8)((Header >>
+					XAXIPCIE_CFG_HEADER_SHIFT) &
+					XAXIPCIE_CFG_HEADER_MASK);
+				FuncPtr->Id = Id;
+				FuncPtr->ClassRev = XAxiPcie_EnumRead(
+						InstancePtr, Bus, Device,
+						Function,
+						XAXIPCIE_CFG_CLASS_REV_REG);
+				FuncPtr->BusNumbers = 0;
+				CachePtr->NumFuncs++;
+			} else {
+				Status = XST_BUFFER_TOO_SMALL;
+			}
+
+			if ((((Header >> XAXIPCIE_CFG_HEADER_SHIFT) &
+				XAXIPCIE_CFG_HEADER_MASK) !=
+				XAXIPCIE_CFG_HEADER_BRIDGE) ||
+				(*NextBusPtr >= LastBus)) {
+				continue;
+			}
+
+			/*
+			 * Give the bridge the next bus and, while its
+			 * hierarchy is scanned, all the remaining ones.
+			 */
+			(*NextBusPtr)++;
+			Secondary = *NextBusPtr;
+			BusNumbers = (XAxiPcie_EnumRead(InstancePtr, Bus,
+					Device, Function,
+					XAXIPCIE_CFG_BUS_NUM_REG) &
+					XAXIPCIE_CFG_BUS_KEEP_MASK) |
+				((u32)LastBus << XAXIPCIE_CFG_BUS_SUB_SHIFT) |
+				((u32)Secondary << XAXIPCIE_CFG_BUS_SEC_SHIFT) |
+				((u32)Bus & XAXIPCIE_CFG_BUS_PRIMARY_MASK);
+			XAxiPcie_EnumWrite(InstancePtr, Bus, (u8)Device,
+					(u8)Function, XAXIPCIE_CFG_BUS_NUM_REG,
+					BusNumbers);
+
+			Result = XAxiPcie_EnumScanBus(InstancePtr, CachePtr,
+					Secondary,
+					XAxiPcie_EnumIsSingleDevice(InstancePtr,
+						Bus, (u8)Device, (u8)Function),
+					LastBus, NextBusPtr);
+			if (Result != XST_SUCCESS) {
+				Status = Result;
+			}
+
+			/* Trim the range to the buses found below */
+			BusNumbers = (BusNumbers & ~XAXIPCIE_CFG_BUS_SUB_MASK) |
+				((u32)*NextBusPtr << XAXIPCIE_CFG_BUS_SUB_SHIFT);
+			XAxiPcie_EnumWrite(InstancePtr, Bus, (u8)Device,
+					(u8)Function, XAXIPCIE_CFG_BUS_NUM_REG,
+					BusNumbers);
+			if (FuncPtr != NULL) {
+				FuncPtr->BusNumbers = BusNumbers;
+			}
+		}
+	}
+
+	return Status;
+}
+
+/** @} */
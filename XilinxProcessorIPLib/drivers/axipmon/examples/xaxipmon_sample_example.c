@@ -0,0 +1,362 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xaxipmon_sample_example.c
+*
+* This file contains a design example showing how to use the continuous
+* sampling service of the AXI Performance Monitor driver. Write and read
+* byte counts and read latency of one monitor slot are sampled on every
+* sample interval and exported over the UART as CSV lines:
+*
+*	seq,timestamp,slot:metric:count,...
+*
+* which can be captured on the host and plotted over time.
+*
+* @note
+*
+* The workload to be measured should be run in place of
+* AxiPmonSampleWorkload(). Samples are only exported between workload
+* steps, the ring buffer absorbs the samples taken meanwhile.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.6   ag     10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xaxipmon.h"
+#include "xparameters.h"
+#include "xstatus.h"
+#include "xil_exception.h"
+#include "xil_printf.h"
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+#include "xintc.h"
+#else
+#include "xscugic.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifdef XPAR_INTC_0_DEVICE_ID
+#define INTC					XIntc
+#define INTC_HANDLER				XIntc_InterruptHandler
+#define AXIPMON_DEVICE_ID			XPAR_AXIPMON_0_DEVICE_ID
+#define INTC_DEVICE_ID				XPAR_INTC_0_DEVICE_ID
+#define INTC_AXIPMON_INTERRUPT_ID		XPAR_INTC_0_AXIPMON_0_VEC_ID
+#else
+#define INTC					XScuGic
+#define INTC_HANDLER				XScuGic_InterruptHandler
+#define AXIPMON_DEVICE_ID			XPAR_AXIPMON_0_DEVICE_ID
+#define INTC_DEVICE_ID				XPAR_SCUGIC_0_DEVICE_ID
+#define INTC_AXIPMON_INTERRUPT_ID		XPAR_XAPMPS_0_INTR
+#endif
+
+#define SAMPLE_SLOT		0x1U	/* Monitor slot to be sampled */
+#define SAMPLE_INTERVAL		0x3FFFFU /* Sample interval in APM clocks */
+#define SAMPLE_RING_SIZE	64U	/* Ring buffer entries, power of 2 */
+#define SAMPLE_COUNT		256U	/* Samples to export */
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+int AxiPmonSampleExample(u16 AxiPmonDeviceId);
+
+static s32 AxiPmonSampleUartExport(void *CallBackRef,
+					const XAxiPmon_Sample *SamplePtr);
+
+static void AxiPmonSampleWorkload(void);
+
+static int AxiPmonSetupIntrSystem(INTC* IntcInstancePtr,
+				XAxiPmon_Sampler* SamplerPtr, u16 IntrId);
+
+/************************** Variable Definitions ****************************/
+
+static XAxiPmon AxiPmonInst;	/* AXI Performance Monitor driver instance */
+static XAxiPmon_Sampler Sampler; /* Sampling service instance */
+static XAxiPmon_Sample SampleRing[SAMPLE_RING_SIZE]; /* Sample storage */
+INTC Intc;	/* The Instance of the Interrupt Controller Driver */
+
+/****************************************************************************/
+/**
+*
+* Main function that invokes the example in this file.
+*
+* @param	None.
+*
+* @return
+*		- XST_SUCCESS if the example has completed successfully.
+*		- XST_FAILURE if the example has failed.
+*
+* @note		None.
+*
+*****************************************************************************/
+int main(void)
+{
+	int Status;
+
+	Status = AxiPmonSampleExample(AXIPMON_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("AXI Performance Monitor Sample example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran AXI Performance Monitor Sample "
+						"Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function samples the AXI Performance Monitor continuously while a
+* workload runs and exports the samples over the UART.
+* This function does the following tasks:
+*	- Initiate the AXI Performance Monitor device driver instance
+*	- Selects write bytes, read bytes and read latency of SAMPLE_SLOT
+*	  for Metric Counters 0 to 2
+*	- Initializes the sampler and sets up the interrupt system
+*	- Starts sampling
+*	- Runs the workload and exports samples until SAMPLE_COUNT samples
+*	  have been exported
+*	- Stops sampling and reports dropped samples
+*
+* @param	AxiPmonDeviceId is the XPAR_<AXIPMON_instance>_DEVICE_ID value
+*		from xparameters.h.
+*
+* @return
+*		- XST_SUCCESS if the example has completed successfully.
+*		- XST_FAILURE if the example has failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int AxiPmonSampleExample(u16 AxiPmonDeviceId)
+{
+	int Status;
+	XAxiPmon_Config *ConfigPtr;
+	XAxiPmon *AxiPmonInstPtr = &AxiPmonInst;
+	u32 Exported = 0U;
+
+	/*
+	 * Initialize the AxiPmon driver.
+	 */
+	ConfigPtr = XAxiPmon_LookupConfig(AxiPmonDeviceId);
+	if (ConfigPtr == NULL) {
+		return XST_FAILURE;
+	}
+	XAxiPmon_CfgInitialize(AxiPmonInstPtr, ConfigPtr,
+				ConfigPtr->BaseAddress);
+
+	if (AxiPmonInstPtr->Mode == XAPM_MODE_ADVANCED) {
+		XAxiPmon_SetMetrics(AxiPmonInstPtr, SAMPLE_SLOT,
+				XAPM_METRIC_SET_2, XAPM_METRIC_COUNTER_0);
+		XAxiPmon_SetMetrics(AxiPmonInstPtr, SAMPLE_SLOT,
+				XAPM_METRIC_SET_3, XAPM_METRIC_COUNTER_1);
+		XAxiPmon_SetMetrics(AxiPmonInstPtr, SAMPLE_SLOT,
+				XAPM_METRIC_SET_5, XAPM_METRIC_COUNTER_2);
+	}
+
+	Status = XAxiPmon_SamplerInitialize(&Sampler, AxiPmonInstPtr,
+						SampleRing, SAMPLE_RING_SIZE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = AxiPmonSetupIntrSystem(&Intc, &Sampler,
+					INTC_AXIPMON_INTERRUPT_ID);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XAxiPmon_SamplerStart(&Sampler, SAMPLE_INTERVAL);
+
+	while (Exported < SAMPLE_COUNT) {
+		AxiPmonSampleWorkload();
+		Exported += XAxiPmon_SamplerExport(&Sampler,
+					AxiPmonSampleUartExport, NULL,
+					SAMPLE_COUNT - Exported);
+	}
+
+	XAxiPmon_SamplerStop(&Sampler);
+
+	xil_printf("Dropped samples: %d\r\n", Sampler.Dropped);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the export handler of the example. It prints one sample
+* as a CSV line on the UART.
+*
+* @param	CallBackRef is unused.
+* @param	SamplePtr is a pointer to the sample to be exported.
+*
+* @return	XST_SUCCESS
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 AxiPmonSampleUartExport(void *CallBackRef,
+					const XAxiPmon_Sample *SamplePtr)
+{
+	u8 CounterNum;
+
+	(void)CallBackRef;
+
+	xil_printf("%d,0x%08x%08x", SamplePtr->SeqNum,
+			(u32)(SamplePtr->Timestamp >> 32U),
+			(u32)SamplePtr->Timestamp);
+	for (CounterNum = 0U; CounterNum < SamplePtr->NumCounters;
+							CounterNum++) {
+		xil_printf(",%d:%d:%d", SamplePtr->Slot[CounterNum],
+				SamplePtr->Metric[CounterNum],
+				SamplePtr->Counter[CounterNum]);
+	}
+	xil_printf("\r\n");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stands for one step of the workload to be measured. It
+* should be replaced by the application.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void AxiPmonSampleWorkload(void)
+{
+	volatile u32 Delay;
+
+	for (Delay = 0U; Delay < 0x10000U; Delay++) {
+		;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function connects the sampler interrupt handler to the interrupt
+* controller.
+*
+* @param	IntcInstancePtr is a reference to the Interrupt Controller
+*			driver Instance
+* @param	SamplerPtr is a reference to the XAxiPmon_Sampler
+* @param	IntrId is XPAR_<INTC_instance>_<AXIPMON_instance>_INTERRUPT_INTR
+*			value from xparameters.h
+*
+* @return
+*		- XST_SUCCESS if the interrupt setup is successful.
+*		- XST_FAILURE if interrupt setup is not successful.
+*
+* @note		None.
+*
+******************************************************************************/
+static int AxiPmonSetupIntrSystem(INTC* IntcInstancePtr,
+				XAxiPmon_Sampler* SamplerPtr, u16 IntrId)
+{
+	int Status;
+#ifdef XPAR_INTC_0_DEVICE_ID
+	Status = XIntc_Initialize(IntcInstancePtr, INTC_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Connect(IntcInstancePtr, IntrId,
+		(XInterruptHandler) XAxiPmon_SamplerIntrHandler, SamplerPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Start(IntcInstancePtr, XIN_REAL_MODE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XIntc_Enable(IntcInstancePtr, IntrId);
+#else
+	XScuGic_Config *IntcConfig;
+
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+					IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_Connect(IntcInstancePtr, IntrId,
+		(XInterruptHandler) XAxiPmon_SamplerIntrHandler, SamplerPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	XScuGic_Enable(IntcInstancePtr, IntrId);
+#endif
+
+	Xil_ExceptionInit();
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				(Xil_ExceptionHandler) INTC_HANDLER,
+					IntcInstancePtr);
+
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
@@ -114,6 +114,26 @@
 *
 * The AXI Performance Monitor does not support Interrupts
 *
+* <b> Continuous Sampling </b>
+*
+* The sampling service in xaxipmon_sample.c uses the Sample Interval Counter
+* Overflow interrupt to copy the sampled metric counters into a ring buffer
+* on every sample interval. The application connects
+* XAxiPmon_SamplerIntrHandler() to the interrupt controller, starts sampling
+* with XAxiPmon_SamplerStart() and drains the ring buffer with
+* XAxiPmon_SamplerRead() or XAxiPmon_SamplerExport() while the workload runs.
+*
+*
+* <b> QoS Manager </b>
+*
+* The QoS manager in xaxipmon_qos.c programs the Zynq UltraScale+ MPSoC
+* interconnect at runtime: XAxiPmon_QosSetPort() sets the read/write QoS and
+* outstanding transaction limits of an AFI FM port, or the read/write QoS
+* override (priority) of a CCI-400 slave interface. A QoS tuner uses the
+* latency counters of the performance monitor slot that watches a named
+* master (display, video, DMA, ...) to step the QoS of that master until
+* its average read latency meets a target. The application calls
+* XAxiPmon_QosTunerStep() periodically, e.g. once per video frame.
 *
 * <b> Virtual Memory </b>
 *
@@ -261,6 +281,14 @@
 *                     generation.
 * 6.6   ms   04/18/17 Modified tcl file to add suffix U for all macro
 *                     definitions of axipmon in xparameters.h
+*       ag   10/14/26 Added continuous sampling service in
+*                     xaxipmon_sample.c: XAxiPmon_Sample, XAxiPmon_Sampler,
+*                     XAxiPmon_SampleHandler, XAxiPmon_SamplerInitialize,
+*                     XAxiPmon_SamplerStart, XAxiPmon_SamplerStop,
+*                     XAxiPmon_SamplerIntrHandler, XAxiPmon_SamplerGetCount,
+*                     XAxiPmon_SamplerRead and XAxiPmon_SamplerExport.
+*       ag   10/14/26 Added runtime interconnect QoS manager with latency
+*                     feedback in xaxipmon_qos.c.
 * </pre>
 *
 *****************************************************************************/
@@ -371,6 +399,16 @@ extern "C" {
 
 #define XAPM_MAX_AGENTS 	8U /**< Maximum number of Agents */
 
+/**
+ * @name QoS manager port types
+ * @{
+ */
+#define XAPM_QOS_PORT_AFIFM	0U /**< AFI FM PL to PS slave port */
+#define XAPM_QOS_PORT_CCI	1U /**< CCI-400 slave interface */
+#define XAPM_QOS_MAX		15U /**< Highest AXI QoS value */
+#define XAPM_QOS_MAX_ISSUE	32U /**< Highest AFI FM issuing capability */
+/*@}*/
+
 /*@}*/
 
 /**
@@ -478,6 +516,110 @@ typedef struct {
 	u8   Mode;		/**< APM Mode */
 } XAxiPmon;
 
+/**
+ * One sample of the continuous sampling service. Counter[n] holds the
+ * count of metric counter n over one sample interval.
+ */
+typedef struct {
+	u64 Timestamp;		/**< APM clock cycles at the end of the
+				  *  sample interval */
+	u32 SeqNum;		/**< Sample sequence number, gaps show
+				  *  dropped samples */
+	u8  NumCounters;	/**< Number of valid counters */
+	u8  Slot[XAPM_MAX_COUNTERS_PROFILE];	/**< Slot of each counter */
+	u8  Metric[XAPM_MAX_COUNTERS_PROFILE];	/**< Metric of each counter */
+	u32 Counter[XAPM_MAX_COUNTERS_PROFILE];	/**< Sampled counter values */
+} XAxiPmon_Sample;
+
+/**
+ * Export handler of the continuous sampling service. It must return
+ * XST_SUCCESS once the sample has been consumed, any other value leaves
+ * the sample in the ring buffer.
+ */
+typedef s32 (*XAxiPmon_SampleHandler)(void *CallBackRef,
+					const XAxiPmon_Sample *SamplePtr);
+
+/**
+ * Continuous sampling service state. The ring buffer storage is provided
+ * by the application, Head is written only by the interrupt handler and
+ * Tail only by the consumer.
+ */
+typedef struct {
+	XAxiPmon *InstancePtr;		/**< Sampled device */
+	volatile XAxiPmon_Sample *BufferPtr; /**< Ring buffer storage */
+	u32 Mask;			/**< Ring buffer entries - 1 */
+	volatile u32 Head;		/**< Samples written */
+	volatile u32 Tail;		/**< Samples consumed */
+	volatile u32 Dropped;		/**< Samples lost on a full ring */
+	u32 SeqNum;			/**< Next sequence number */
+	u32 SampleInterval;		/**< Sample interval in clock cycles */
+	u8  NumCounters;		/**< Number of sampled counters */
+	u8  Slot[XAPM_MAX_COUNTERS_PROFILE];	/**< Slot of each counter */
+	u8  Metric[XAPM_MAX_COUNTERS_PROFILE];	/**< Metric of each counter */
+} XAxiPmon_Sampler;
+
+/**
+ * Interconnect port controlled by the QoS manager.
+ */
+typedef struct {
+	u8  Type;			/**< XAPM_QOS_PORT_AFIFM or
+					  *  XAPM_QOS_PORT_CCI */
+	u8  SlaveIf;			/**< CCI-400 slave interface 0 to 4 */
+	UINTPTR BaseAddress;		/**< AFI FM or CCI-400 base address */
+} XAxiPmon_QosPort;
+
+/**
+ * QoS settings of an interconnect port. Issuing capabilities and
+ * UseFabricQos only apply to AFI FM ports.
+ */
+typedef struct {
+	u8  RdQos;			/**< Read QoS, 0 to 15 */
+	u8  WrQos;			/**< Write QoS, 0 to 15 */
+	u8  RdIssue;			/**< Outstanding reads, 1 to 32 */
+	u8  WrIssue;			/**< Outstanding writes, 1 to 32 */
+	u8  UseFabricQos;		/**< 1 - use AxQOS driven by the PL,
+					  *  0 - use RdQos/WrQos */
+} XAxiPmon_QosPortCfg;
+
+/**
+ * Function used by the QoS tuner to apply a new QoS value to a master that
+ * is not behind an XAxiPmon_QosPort, e.g. XDpDma_SetQOS() for the display.
+ */
+typedef void (*XAxiPmon_QosSetFn)(void *CallBackRef, u8 Qos);
+
+/**
+ * Master tuned by the QoS tuner. Either PortPtr or SetQos selects how the
+ * QoS is applied; when both are set both are updated.
+ */
+typedef struct {
+	const char *Name;		/**< Master name, e.g. "display" */
+	u8  Slot;			/**< APM slot monitoring the master */
+	u8  LatCounter;			/**< Counter for total read latency */
+	u8  TransCounter;		/**< Counter for read transactions */
+	u8  MinQos;			/**< Lowest QoS the tuner may use */
+	u8  MaxQos;			/**< Highest QoS the tuner may use */
+	u8  Qos;			/**< Current QoS */
+	u32 TargetLatency;		/**< Target average read latency in
+					  *  APM clock cycles */
+	u32 Hysteresis;			/**< Dead band around the target */
+	XAxiPmon_QosPort *PortPtr;	/**< Port carrying the master or NULL */
+	XAxiPmon_QosSetFn SetQos;	/**< QoS setter or NULL */
+	void *SetQosRef;		/**< Callback reference for SetQos */
+	u32 Latency;			/**< Last measured average latency */
+	u32 Transactions;		/**< Last measured transaction count */
+} XAxiPmon_QosMaster;
+
+/**
+ * QoS tuner state.
+ */
+typedef struct {
+	XAxiPmon *InstancePtr;		/**< Monitor measuring the masters */
+	XAxiPmon_QosMaster *MasterPtr;	/**< Array of tuned masters */
+	u32 NumMasters;			/**< Number of entries in MasterPtr */
+	u32 MinTransactions;		/**< Transactions needed in a window
+					  *  before the QoS is changed */
+} XAxiPmon_QosTuner;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 
@@ -933,6 +1075,49 @@ u32 XAxiPmon_GetWriteIdMask(XAxiPmon *InstancePtr);
 u32 XAxiPmon_GetReadIdMask(XAxiPmon *InstancePtr);
 
 
+/**
+ * Functions in xaxipmon_sample.c
+ */
+s32 XAxiPmon_SamplerInitialize(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon *InstancePtr, XAxiPmon_Sample *BufferPtr,
+		u32 NumSamples);
+
+s32 XAxiPmon_SamplerStart(XAxiPmon_Sampler *SamplerPtr, u32 SampleInterval);
+
+s32 XAxiPmon_SamplerStop(XAxiPmon_Sampler *SamplerPtr);
+
+void XAxiPmon_SamplerIntrHandler(void *CallBackRef);
+
+u32 XAxiPmon_SamplerGetCount(XAxiPmon_Sampler *SamplerPtr);
+
+s32 XAxiPmon_SamplerRead(XAxiPmon_Sampler *SamplerPtr,
+					XAxiPmon_Sample *SamplePtr);
+
+u32 XAxiPmon_SamplerExport(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon_SampleHandler Handler, void *CallBackRef,
+		u32 MaxSamples);
+
+/**
+ * Functions in xaxipmon_qos.c
+ */
+s32 XAxiPmon_QosSetPort(const XAxiPmon_QosPort *PortPtr,
+		const XAxiPmon_QosPortCfg *CfgPtr);
+
+void XAxiPmon_QosGetPort(const XAxiPmon_QosPort *PortPtr,
+		XAxiPmon_QosPortCfg *CfgPtr);
+
+s32 XAxiPmon_QosTunerInitialize(XAxiPmon_QosTuner *TunerPtr,
+		XAxiPmon *InstancePtr, XAxiPmon_QosMaster *MasterPtr,
+		u32 NumMasters);
+
+XAxiPmon_QosMaster *XAxiPmon_QosFindMaster(XAxiPmon_QosTuner *TunerPtr,
+		const char *Name);
+
+s32 XAxiPmon_QosSetTarget(XAxiPmon_QosTuner *TunerPtr, const char *Name,
+		u32 TargetLatency);
+
+s32 XAxiPmon_QosTunerStep(XAxiPmon_QosTuner *TunerPtr);
+
 /**
  * Functions in xaxipmon_selftest.c
  */
@@ -79,6 +79,7 @@
 *					 Zynq MP APM.
 *
 * 6.3  kvn  07/02/15 Modified code according to MISRA-C:2012 guidelines.
+* 6.6  ag   10/14/26 Added AFI FM and CCI-400 QoS register definitions.
 * </pre>
 *
 *****************************************************************************/
@@ -519,6 +520,51 @@ extern "C" {
 
 /*@}*/
 
+/**
+ * @name Zynq UltraScale+ MPSoC interconnect QoS registers
+ *
+ * Registers of the AFI FM blocks in front of the PL to PS slave ports and
+ * of the CCI-400 slave interfaces, used by the QoS manager in
+ * xaxipmon_qos.c.
+ * @{
+ */
+
+#define XAPM_QOS_AFIFM_HPC0_BASEADDR	0xFD360000U /**< S_AXI_HPC0_FPD */
+#define XAPM_QOS_AFIFM_HPC1_BASEADDR	0xFD370000U /**< S_AXI_HPC1_FPD */
+#define XAPM_QOS_AFIFM_HP0_BASEADDR	0xFD380000U /**< S_AXI_HP0_FPD */
+#define XAPM_QOS_AFIFM_HP1_BASEADDR	0xFD390000U /**< S_AXI_HP1_FPD */
+#define XAPM_QOS_AFIFM_HP2_BASEADDR	0xFD3A0000U /**< S_AXI_HP2_FPD */
+#define XAPM_QOS_AFIFM_HP3_BASEADDR	0xFD3B0000U /**< S_AXI_HP3_FPD */
+#define XAPM_QOS_AFIFM_LPD_BASEADDR	0xFF9B0000U /**< S_AXI_LPD */
+#define XAPM_QOS_CCI_BASEADDR		0xFD6E0000U /**< CCI-400 GPV */
+
+#define XAPM_AFIFM_RDCTRL_OFFSET	0x00000000U /**< Read Control */
+#define XAPM_AFIFM_RDISSUE_OFFSET	0x00000004U /**< Read Issuing
+							  *  Capability */
+#define XAPM_AFIFM_RDQOS_OFFSET		0x00000008U /**< Read QoS */
+#define XAPM_AFIFM_WRCTRL_OFFSET	0x00000014U /**< Write Control */
+#define XAPM_AFIFM_WRISSUE_OFFSET	0x00000018U /**< Write Issuing
+							  *  Capability */
+#define XAPM_AFIFM_WRQOS_OFFSET		0x0000001CU /**< Write QoS */
+
+#define XAPM_AFIFM_CTRL_FABRIC_QOS_MASK	0x00000004U /**< Use AxQOS from the
+							  *  fabric instead of
+							  *  the QoS register */
+#define XAPM_AFIFM_ISSUE_MASK		0x0000001FU /**< Issuing capability
+							  *  minus one */
+#define XAPM_AFIFM_QOS_MASK		0x0000000FU /**< QoS value */
+
+#define XAPM_CCI_SI_OFFSET(SlaveIf)	(0x1000U * ((u32)(SlaveIf) + 1U))
+					/**< Slave interface register block */
+#define XAPM_CCI_SI_RDQOS_OFFSET	0x00000100U /**< Read Channel QoS
+							  *  Value Override */
+#define XAPM_CCI_SI_WRQOS_OFFSET	0x00000104U /**< Write Channel QoS
+							  *  Value Override */
+#define XAPM_CCI_SI_QOS_MASK		0x0000000FU /**< QoS value */
+#define XAPM_CCI_MAX_SLAVE_IF		5U	    /**< CCI-400 S0 to S4 */
+
+/*@}*/
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
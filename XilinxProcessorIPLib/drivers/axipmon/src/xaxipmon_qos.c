@@ -0,0 +1,533 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxipmon_qos.c
+* @addtogroup axipmon_v6_6
+* @{
+*
+* This file contains the runtime interconnect QoS manager of the XAxiPmon
+* driver for Zynq UltraScale+ MPSoC.
+*
+* The port functions give structured access to the QoS settings that are
+* otherwise only written once by psu_init: the read/write QoS and issuing
+* capabilities of the AFI FM blocks in front of the PL to PS slave ports,
+* and the read/write QoS override of the CCI-400 slave interfaces.
+*
+* The QoS tuner closes the loop with the performance monitor. Each tuned
+* master has two metric counters on the slot that watches it, counting
+* total read latency and read transactions. Every XAxiPmon_QosTunerStep()
+* computes the average read latency of the last window and raises the QoS
+* of masters above their target latency, or lowers it again for masters
+* comfortably below it, one step at a time.
+*
+* See xaxipmon.h for more information.
+*
+* @note	The tuner resets all metric counters of the monitor at every step,
+*	so the monitor should not be shared with other measurements while
+*	tuning.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.6   ag     10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <string.h>
+#include "xaxipmon.h"
+
+/************************** Constant Definitions ****************************/
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Variable Definitions ****************************/
+
+/************************** Function Prototypes *****************************/
+
+static void XAxiPmon_QosApply(XAxiPmon_QosMaster *MasterPtr);
+
+/*****************************************************************************/
+/**
+*
+* This function programs the QoS settings of an interconnect port.
+*
+* For an AFI FM port the read and write QoS, issuing capabilities and the
+* QoS source (register or PL AxQOS) are written. For a CCI-400 slave
+* interface the read and write QoS override values are written; the issue
+* and UseFabricQos fields are ignored.
+*
+* @param	PortPtr is a pointer to the port to program.
+* @param	CfgPtr is a pointer to the settings to apply.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if a value is out of range.
+*
+* @note		Outstanding transaction limits should only be lowered while
+*		the port is idle.
+*
+******************************************************************************/
+s32 XAxiPmon_QosSetPort(const XAxiPmon_QosPort *PortPtr,
+		const XAxiPmon_QosPortCfg *CfgPtr)
+{
+	UINTPTR BaseAddress;
+	u32 RegValue;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(PortPtr != NULL);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+	Xil_AssertNonvoid((PortPtr->Type == XAPM_QOS_PORT_AFIFM) ||
+			(PortPtr->Type == XAPM_QOS_PORT_CCI));
+
+	if ((CfgPtr->RdQos > XAPM_QOS_MAX) || (CfgPtr->WrQos > XAPM_QOS_MAX)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (PortPtr->Type == XAPM_QOS_PORT_CCI) {
+		if (PortPtr->SlaveIf >= XAPM_CCI_MAX_SLAVE_IF) {
+			return XST_INVALID_PARAM;
+		}
+
+		BaseAddress = PortPtr->BaseAddress +
+				XAPM_CCI_SI_OFFSET(PortPtr->SlaveIf);
+		XAxiPmon_WriteReg(BaseAddress, XAPM_CCI_SI_RDQOS_OFFSET,
+				(u32)CfgPtr->RdQos & XAPM_CCI_SI_QOS_MASK);
+		XAxiPmon_WriteReg(BaseAddress, XAPM_CCI_SI_WRQOS_OFFSET,
+				(u32)CfgPtr->WrQos & XAPM_CCI_SI_QOS_MASK);
+
+		return XST_SUCCESS;
+	}
+
+	if ((CfgPtr->RdIssue == 0U) || (CfgPtr->RdIssue > XAPM_QOS_MAX_ISSUE) ||
+		(CfgPtr->WrIssue == 0U) ||
+		(CfgPtr->WrIssue > XAPM_QOS_MAX_ISSUE)) {
+		return XST_INVALID_PARAM;
+	}
+
+	BaseAddress = PortPtr->BaseAddress;
+
+	XAxiPmon_WriteReg(BaseAddress, XAPM_AFIFM_RDQOS_OFFSET,
+			(u32)CfgPtr->RdQos & XAPM_AFIFM_QOS_MASK);
+	XAxiPmon_WriteReg(BaseAddress, XAPM_AFIFM_WRQOS_OFFSET,
+			(u32)CfgPtr->WrQos & XAPM_AFIFM_QOS_MASK);
+	XAxiPmon_WriteReg(BaseAddress, XAPM_AFIFM_RDISSUE_OFFSET,
+			((u32)CfgPtr->RdIssue - 1U) & XAPM_AFIFM_ISSUE_MASK);
+	XAxiPmon_WriteReg(BaseAddress, XAPM_AFIFM_WRISSUE_OFFSET,
+			((u32)CfgPtr->WrIssue - 1U) & XAPM_AFIFM_ISSUE_MASK);
+
+	RegValue = XAxiPmon_ReadReg(BaseAddress, XAPM_AFIFM_RDCTRL_OFFSET);
+	if (CfgPtr->UseFabricQos != 0U) {
+		RegValue |= XAPM_AFIFM_CTRL_FABRIC_QOS_MASK;
+	} else {
+		RegValue &= ~XAPM_AFIFM_CTRL_FABRIC_QOS_MASK;
+	}
+	XAxiPmon_WriteReg(BaseAddress, XAPM_AFIFM_RDCTRL_OFFSET, RegValue);
+
+	RegValue = XAxiPmon_ReadReg(BaseAddress, XAPM_AFIFM_WRCTRL_OFFSET);
+	if (CfgPtr->UseFabricQos != 0U) {
+		RegValue |= XAPM_AFIFM_CTRL_FABRIC_QOS_MASK;
+	} else {
+		RegValue &= ~XAPM_AFIFM_CTRL_FABRIC_QOS_MASK;
+	}
+	XAxiPmon_WriteReg(BaseAddress, XAPM_AFIFM_WRCTRL_OFFSET, RegValue);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads back the QoS settings of an interconnect port.
+*
+* @param	PortPtr is a pointer to the port to read.
+* @param	CfgPtr is a pointer to the settings to fill in. For a CCI-400
+*		slave interface the issue and UseFabricQos fields are set
+*		to 0.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAxiPmon_QosGetPort(const XAxiPmon_QosPort *PortPtr,
+		XAxiPmon_QosPortCfg *CfgPtr)
+{
+	UINTPTR BaseAddress;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(PortPtr != NULL);
+	Xil_AssertVoid(CfgPtr != NULL);
+	Xil_AssertVoid((PortPtr->Type == XAPM_QOS_PORT_AFIFM) ||
+			((PortPtr->Type == XAPM_QOS_PORT_CCI) &&
+			(PortPtr->SlaveIf < XAPM_CCI_MAX_SLAVE_IF)));
+
+	if (PortPtr->Type == XAPM_QOS_PORT_CCI) {
+		BaseAddress = PortPtr->BaseAddress +
+				XAPM_CCI_SI_OFFSET(PortPtr->SlaveIf);
+		CfgPtr->RdQos = (u8)(XAxiPmon_ReadReg(BaseAddress,
+				XAPM_CCI_SI_RDQOS_OFFSET) & XAPM_CCI_SI_QOS_MASK);
+		CfgPtr->WrQos = (u8)(XAxiPmon_ReadReg(BaseAddress,
+				XAPM_CCI_SI_WRQOS_OFFSET) & XAPM_CCI_SI_QOS_MASK);
+		CfgPtr->RdIssue = 0U;
+		CfgPtr->WrIssue = 0U;
+		CfgPtr->UseFabricQos = 0U;
+		return;
+	}
+
+	BaseAddress = PortPtr->BaseAddress;
+	CfgPtr->RdQos = (u8)(XAxiPmon_ReadReg(BaseAddress,
+			XAPM_AFIFM_RDQOS_OFFSET) & XAPM_AFIFM_QOS_MASK);
+	CfgPtr->WrQos = (u8)(XAxiPmon_ReadReg(BaseAddress,
+			XAPM_AFIFM_WRQOS_OFFSET) & XAPM_AFIFM_QOS_MASK);
+	CfgPtr->RdIssue = (u8)((XAxiPmon_ReadReg(BaseAddress,
+			XAPM_AFIFM_RDISSUE_OFFSET) & XAPM_AFIFM_ISSUE_MASK) + 1U);
+	CfgPtr->WrIssue = (u8)((XAxiPmon_ReadReg(BaseAddress,
+			XAPM_AFIFM_WRISSUE_OFFSET) & XAPM_AFIFM_ISSUE_MASK) + 1U);
+	CfgPtr->UseFabricQos = ((XAxiPmon_ReadReg(BaseAddress,
+			XAPM_AFIFM_RDCTRL_OFFSET) &
+			XAPM_AFIFM_CTRL_FABRIC_QOS_MASK) != 0U) ? 1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a QoS tuner. The latency and transaction
+* counters of every master are assigned to the master's slot, the initial
+* QoS of every master is applied and the metric counters are started.
+*
+* @param	TunerPtr is a pointer to the XAxiPmon_QosTuner to initialize.
+* @param	InstancePtr is a pointer to an initialized XAxiPmon instance
+*		in Advanced mode.
+* @param	MasterPtr is a pointer to an array of NumMasters masters. The
+*		array is owned by the tuner until it is no longer used.
+* @param	NumMasters is the number of masters.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_NO_FEATURE if the monitor is not in Advanced mode.
+*		- XST_INVALID_PARAM if a master uses a counter that does not
+*		  exist or is used twice, or has an invalid QoS range.
+*
+* @note		MinTransactions defaults to 1 and may be changed in the
+*		tuner structure after initialization.
+*
+******************************************************************************/
+s32 XAxiPmon_QosTunerInitialize(XAxiPmon_QosTuner *TunerPtr,
+		XAxiPmon *InstancePtr, XAxiPmon_QosMaster *MasterPtr,
+		u32 NumMasters)
+{
+	XAxiPmon_QosMaster *Master;
+	u32 UsedCounters = 0U;
+	u32 CounterMask;
+	u32 Index;
+	s32 Status;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(TunerPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MasterPtr != NULL);
+	Xil_AssertNonvoid(NumMasters != 0U);
+
+	if (InstancePtr->Mode != XAPM_MODE_ADVANCED) {
+		return XST_NO_FEATURE;
+	}
+
+	for (Index = 0U; Index < NumMasters; Index++) {
+		Master = &MasterPtr[Index];
+
+		if ((Master->LatCounter >= InstancePtr->Config.NumberofCounters) ||
+			(Master->TransCounter >=
+				InstancePtr->Config.NumberofCounters) ||
+			(Master->LatCounter == Master->TransCounter) ||
+			(Master->MinQos > Master->MaxQos) ||
+			(Master->MaxQos > XAPM_QOS_MAX)) {
+			return XST_INVALID_PARAM;
+		}
+
+		CounterMask = ((u32)1U << Master->LatCounter) |
+				((u32)1U << Master->TransCounter);
+		if ((UsedCounters & CounterMask) != 0U) {
+			return XST_INVALID_PARAM;
+		}
+		UsedCounters |= CounterMask;
+	}
+
+	TunerPtr->InstancePtr = InstancePtr;
+	TunerPtr->MasterPtr = MasterPtr;
+	TunerPtr->NumMasters = NumMasters;
+	TunerPtr->MinTransactions = 1U;
+
+	for (Index = 0U; Index < NumMasters; Index++) {
+		Master = &MasterPtr[Index];
+
+		Status = XAxiPmon_SetMetrics(InstancePtr, Master->Slot,
+				XAPM_METRIC_SET_5, Master->LatCounter);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+
+		Status = XAxiPmon_SetMetrics(InstancePtr, Master->Slot,
+				XAPM_METRIC_SET_1, Master->TransCounter);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+
+		if (Master->Qos < Master->MinQos) {
+			Master->Qos = Master->MinQos;
+		} else if (Master->Qos > Master->MaxQos) {
+			Master->Qos = Master->MaxQos;
+		} else {
+			/* Initial QoS is within range */
+		}
+
+		Master->Latency = 0U;
+		Master->Transactions = 0U;
+		XAxiPmon_QosApply(Master);
+	}
+
+	(void)XAxiPmon_ResetMetricCounter(InstancePtr);
+	XAxiPmon_EnableMetricsCounter(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up a tuned master by name.
+*
+* @param	TunerPtr is a pointer to the XAxiPmon_QosTuner.
+* @param	Name is the name of the master.
+*
+* @return	Pointer to the master, or NULL if no master has that name.
+*
+* @note		None.
+*
+******************************************************************************/
+XAxiPmon_QosMaster *XAxiPmon_QosFindMaster(XAxiPmon_QosTuner *TunerPtr,
+		const char *Name)
+{
+	u32 Index;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(TunerPtr != NULL);
+	Xil_AssertNonvoid(Name != NULL);
+
+	for (Index = 0U; Index < TunerPtr->NumMasters; Index++) {
+		if ((TunerPtr->MasterPtr[Index].Name != NULL) &&
+			(strcmp(TunerPtr->MasterPtr[Index].Name, Name) == 0)) {
+			return &TunerPtr->MasterPtr[Index];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function changes the target read latency of a named master.
+*
+* @param	TunerPtr is a pointer to the XAxiPmon_QosTuner.
+* @param	Name is the name of the master.
+* @param	TargetLatency is the new target average read latency in APM
+*		clock cycles.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if no master has that name.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XAxiPmon_QosSetTarget(XAxiPmon_QosTuner *TunerPtr, const char *Name,
+		u32 TargetLatency)
+{
+	XAxiPmon_QosMaster *Master;
+
+	Master = XAxiPmon_QosFindMaster(TunerPtr, Name);
+	if (Master == NULL) {
+		return XST_INVALID_PARAM;
+	}
+
+	Master->TargetLatency = TargetLatency;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs one step of the QoS tuner. It freezes the metric
+* counters, computes the average read latency of every master over the
+* window since the previous step and adjusts the QoS by one level:
+*	- up, when the latency is above TargetLatency + Hysteresis
+*	- down, when the latency is below TargetLatency - Hysteresis
+* Masters with fewer than MinTransactions reads in the window, or with a
+* TargetLatency of 0, are left unchanged. The counters are then reset for
+* the next window.
+*
+* @param	TunerPtr is a pointer to the XAxiPmon_QosTuner.
+*
+* @return
+*		- XST_SUCCESS if all masters are within their targets or at
+*		  the edge of their QoS range.
+*		- XST_FAILURE if at least one master is above its target
+*		  and already at MaxQos.
+*
+* @note		Call this periodically, with a window long enough for the
+*		masters to issue a representative number of reads.
+*
+******************************************************************************/
+s32 XAxiPmon_QosTunerStep(XAxiPmon_QosTuner *TunerPtr)
+{
+	XAxiPmon_QosMaster *Master;
+	XAxiPmon *InstancePtr;
+	u32 LatencyTotal;
+	u32 Index;
+	s32 Status = XST_SUCCESS;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(TunerPtr != NULL);
+	Xil_AssertNonvoid(TunerPtr->InstancePtr != NULL);
+
+	InstancePtr = TunerPtr->InstancePtr;
+
+	XAxiPmon_DisableMetricsCounter(InstancePtr);
+
+	for (Index = 0U; Index < TunerPtr->NumMasters; Index++) {
+		Master = &TunerPtr->MasterPtr[Index];
+
+		LatencyTotal = XAxiPmon_GetMetricCounter(InstancePtr,
+					Master->LatCounter);
+		Master->Transactions = XAxiPmon_GetMetricCounter(InstancePtr,
+					Master->TransCounter);
+
+		if ((Master->Transactions == 0U) ||
+			(Master->Transactions < TunerPtr->MinTransactions) ||
+			(Master->TargetLatency == 0U)) {
+			continue;
+		}
+
+		Master->Latency = LatencyTotal / Master->Transactions;
+
+		if (Master->Latency > (Master->TargetLatency +
+						Master->Hysteresis)) {
+			if (Master->Qos < Master->MaxQos) {
+				Master->Qos++;
+				XAxiPmon_QosApply(Master);
+			} else {
+				Status = XST_FAILURE;
+			}
+		} else if ((Master->Latency + Master->Hysteresis) <
+					Master->TargetLatency) {
+			if (Master->Qos > Master->MinQos) {
+				Master->Qos--;
+				XAxiPmon_QosApply(Master);
+			}
+		} else {
+			/* Within the dead band, keep the current QoS */
+		}
+	}
+
+	(void)XAxiPmon_ResetMetricCounter(InstancePtr);
+	XAxiPmon_EnableMetricsCounter(InstancePtr);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function applies the current QoS of a master to its port and setter.
+* On an AFI FM port only the read and write QoS registers are written, so
+* the issuing capabilities and QoS source programmed by the application are
+* kept.
+*
+* @param	MasterPtr is a pointer to the master.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XAxiPmon_QosApply(XAxiPmon_QosMaster *MasterPtr)
+{
+	XAxiPmon_QosPort *PortPtr = MasterPtr->PortPtr;
+	XAxiPmon_QosPortCfg Cfg;
+
+	if (PortPtr != NULL) {
+		if (PortPtr->Type == XAPM_QOS_PORT_CCI) {
+			Cfg.RdQos = MasterPtr->Qos;
+			Cfg.WrQos = MasterPtr->Qos;
+			Cfg.RdIssue = 0U;
+			Cfg.WrIssue = 0U;
+			Cfg.UseFabricQos = 0U;
+			(void)XAxiPmon_QosSetPort(PortPtr, &Cfg);
+		} else {
+			XAxiPmon_WriteReg(PortPtr->BaseAddress,
+					XAPM_AFIFM_RDQOS_OFFSET,
+					(u32)MasterPtr->Qos &
+					XAPM_AFIFM_QOS_MASK);
+			XAxiPmon_WriteReg(PortPtr->BaseAddress,
+					XAPM_AFIFM_WRQOS_OFFSET,
+					(u32)MasterPtr->Qos &
+					XAPM_AFIFM_QOS_MASK);
+		}
+	}
+
+	if (MasterPtr->SetQos != NULL) {
+		MasterPtr->SetQos(MasterPtr->SetQosRef, MasterPtr->Qos);
+	}
+}
+/** @} */
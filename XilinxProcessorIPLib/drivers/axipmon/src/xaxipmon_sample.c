@@ -0,0 +1,512 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxipmon_sample.c
+* @addtogroup axipmon_v6_6
+* @{
+*
+* This file contains the continuous sampling service of the XAxiPmon driver.
+* The sample interval interrupt is used to snapshot the sampled metric
+* counters into a ring buffer owned by the application, from where the
+* samples can be drained and exported (UART, shared memory, UDP, ...) while
+* the workload under test keeps running.
+*
+* The ring buffer has a single producer, XAxiPmon_SamplerIntrHandler(), and
+* a single consumer, XAxiPmon_SamplerRead() or XAxiPmon_SamplerExport(). The
+* producer only moves the head and the consumer only moves the tail, so no
+* locking or interrupt masking is needed as long as both run on the same
+* processor. When the consumer runs on another processor the buffer and the
+* sampler must be placed in non-cacheable memory.
+*
+* See xaxipmon.h for more information.
+*
+* @note	None.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.6   ag     10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xaxipmon.h"
+
+/************************** Constant Definitions ****************************/
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Variable Definitions ****************************/
+
+/************************** Function Prototypes *****************************/
+
+static u64 XAxiPmon_SamplerTimestamp(XAxiPmon_Sampler *SamplerPtr);
+static void XAxiPmon_SamplerCopy(XAxiPmon_Sample *DstPtr,
+				volatile XAxiPmon_Sample *SrcPtr);
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a sampler for the given AXI Performance Monitor
+* instance. The sampler does not touch the device until
+* XAxiPmon_SamplerStart() is called.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler to initialize.
+* @param	InstancePtr is a pointer to an initialized XAxiPmon instance.
+* @param	BufferPtr is a pointer to the ring buffer storage.
+* @param	NumSamples is the number of entries in BufferPtr. It must be a
+*		power of two.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if NumSamples is not a power of two.
+*		- XST_NO_FEATURE if the device is in Trace mode or has no
+*		  sampled metric counters.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XAxiPmon_SamplerInitialize(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon *InstancePtr, XAxiPmon_Sample *BufferPtr,
+		u32 NumSamples)
+{
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	if ((NumSamples == 0U) || ((NumSamples & (NumSamples - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((InstancePtr->Mode == XAPM_MODE_TRACE) ||
+		((InstancePtr->Mode == XAPM_MODE_ADVANCED) &&
+		(InstancePtr->Config.HaveSampledCounters != 1U))) {
+		return XST_NO_FEATURE;
+	}
+
+	SamplerPtr->InstancePtr = InstancePtr;
+	SamplerPtr->BufferPtr = BufferPtr;
+	SamplerPtr->Mask = NumSamples - 1U;
+	SamplerPtr->Head = 0U;
+	SamplerPtr->Tail = 0U;
+	SamplerPtr->Dropped = 0U;
+	SamplerPtr->SeqNum = 0U;
+	SamplerPtr->SampleInterval = 0U;
+	SamplerPtr->NumCounters = 0U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts continuous sampling. It records the slot and metric
+* selected for each counter, starts the counters with the given sample
+* interval and arms the Sample Interval Counter Overflow interrupt. The
+* metric counters are reset on every sample interval lapse, so each sample
+* holds the counts of one interval.
+*
+* XAxiPmon_SamplerIntrHandler() must already be connected to the interrupt
+* controller with SamplerPtr as its callback reference.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+* @param	SampleInterval is the sample interval in APM clock cycles.
+*
+* @return	XST_SUCCESS
+*
+* @note		Metric selection must not be changed while sampling. In
+*		Profile mode the slot and metric of a counter are fixed by the
+*		hardware and are recorded as 0.
+*
+******************************************************************************/
+s32 XAxiPmon_SamplerStart(XAxiPmon_Sampler *SamplerPtr, u32 SampleInterval)
+{
+	XAxiPmon *InstancePtr;
+	u8 CounterNum;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(SamplerPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(SampleInterval != 0U);
+
+	InstancePtr = SamplerPtr->InstancePtr;
+
+	SamplerPtr->NumCounters = InstancePtr->Config.NumberofCounters;
+	if (SamplerPtr->NumCounters > XAPM_MAX_COUNTERS_PROFILE) {
+		SamplerPtr->NumCounters = (u8)XAPM_MAX_COUNTERS_PROFILE;
+	}
+
+	for (CounterNum = 0U; CounterNum < SamplerPtr->NumCounters;
+							CounterNum++) {
+		SamplerPtr->Metric[CounterNum] = 0U;
+		SamplerPtr->Slot[CounterNum] = 0U;
+		if (InstancePtr->Mode == XAPM_MODE_ADVANCED) {
+			(void)XAxiPmon_GetMetrics(InstancePtr, CounterNum,
+					&SamplerPtr->Metric[CounterNum],
+					&SamplerPtr->Slot[CounterNum]);
+		}
+	}
+
+	SamplerPtr->Head = 0U;
+	SamplerPtr->Tail = 0U;
+	SamplerPtr->Dropped = 0U;
+	SamplerPtr->SeqNum = 0U;
+	SamplerPtr->SampleInterval = SampleInterval;
+
+	(void)XAxiPmon_ResetMetricCounter(InstancePtr);
+	if (InstancePtr->Mode == XAPM_MODE_ADVANCED) {
+		XAxiPmon_ResetGlobalClkCounter(InstancePtr);
+	}
+
+	XAxiPmon_IntrClear(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrEnable(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrGlobalEnable(InstancePtr);
+
+	(void)XAxiPmon_StartCounters(InstancePtr, SampleInterval);
+
+	/*
+	 * XAxiPmon_StartCounters leaves only the enable bit set, add the
+	 * metric counter reset on lapse
+	 */
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+			XAPM_SICR_ENABLE_MASK | XAPM_SICR_MCNTR_RST_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops continuous sampling. The samples already in the ring
+* buffer are kept and can still be read or exported.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+*
+* @return	XST_SUCCESS
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XAxiPmon_SamplerStop(XAxiPmon_Sampler *SamplerPtr)
+{
+	XAxiPmon *InstancePtr;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(SamplerPtr->InstancePtr != NULL);
+
+	InstancePtr = SamplerPtr->InstancePtr;
+
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+									0U);
+	XAxiPmon_IntrDisable(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrClear(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	(void)XAxiPmon_StopCounters(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the sampling service. On a
+* Sample Interval Counter Overflow interrupt it copies all sampled metric
+* counters, together with a timestamp and the slot and metric of every
+* counter, into the next free entry of the ring buffer. When the ring is
+* full the sample is dropped and counted, the sequence number still
+* advances so the gap is visible to the consumer.
+*
+* @param	CallBackRef is a pointer to the XAxiPmon_Sampler.
+*
+* @return	None.
+*
+* @note		This function is called within interrupt context. Only the
+*		Sample Interval Counter Overflow interrupt status is cleared.
+*
+******************************************************************************/
+void XAxiPmon_SamplerIntrHandler(void *CallBackRef)
+{
+	XAxiPmon_Sampler *SamplerPtr = (XAxiPmon_Sampler *)CallBackRef;
+	XAxiPmon *InstancePtr;
+	volatile XAxiPmon_Sample *SamplePtr;
+	u32 IntrStatus;
+	u32 Head;
+	u8 CounterNum;
+
+	Xil_AssertVoid(SamplerPtr != NULL);
+
+	InstancePtr = SamplerPtr->InstancePtr;
+
+	IntrStatus = XAxiPmon_IntrGetStatus(InstancePtr);
+	if ((IntrStatus & XAPM_IXR_SIC_OVERFLOW_MASK) == 0U) {
+		return;
+	}
+
+	Head = SamplerPtr->Head;
+	if ((Head - SamplerPtr->Tail) > SamplerPtr->Mask) {
+		SamplerPtr->Dropped++;
+		SamplerPtr->SeqNum++;
+		XAxiPmon_IntrClear(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+		return;
+	}
+
+	SamplePtr = &SamplerPtr->BufferPtr[Head & SamplerPtr->Mask];
+	SamplePtr->Timestamp = XAxiPmon_SamplerTimestamp(SamplerPtr);
+	SamplePtr->SeqNum = SamplerPtr->SeqNum;
+	SamplePtr->NumCounters = SamplerPtr->NumCounters;
+	for (CounterNum = 0U; CounterNum < SamplerPtr->NumCounters;
+							CounterNum++) {
+		SamplePtr->Slot[CounterNum] = SamplerPtr->Slot[CounterNum];
+		SamplePtr->Metric[CounterNum] = SamplerPtr->Metric[CounterNum];
+		SamplePtr->Counter[CounterNum] =
+			XAxiPmon_GetSampledMetricCounter(InstancePtr,
+							CounterNum);
+	}
+
+	SamplerPtr->SeqNum++;
+
+	/*
+	 * Publish the entry only after it is completely written
+	 */
+	SamplerPtr->Head = Head + 1U;
+
+	XAxiPmon_IntrClear(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of samples waiting in the ring buffer.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+*
+* @return	Number of samples that can be read.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XAxiPmon_SamplerGetCount(XAxiPmon_Sampler *SamplerPtr)
+{
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+
+	return SamplerPtr->Head - SamplerPtr->Tail;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes the oldest sample from the ring buffer.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+* @param	SamplePtr is a pointer to the sample to be filled.
+*
+* @return
+*		- XST_SUCCESS if a sample was returned.
+*		- XST_NO_DATA if the ring buffer is empty.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XAxiPmon_SamplerRead(XAxiPmon_Sampler *SamplerPtr,
+					XAxiPmon_Sample *SamplePtr)
+{
+	u32 Tail;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(SamplePtr != NULL);
+
+	Tail = SamplerPtr->Tail;
+	if (Tail == SamplerPtr->Head) {
+		return XST_NO_DATA;
+	}
+
+	XAxiPmon_SamplerCopy(SamplePtr,
+			&SamplerPtr->BufferPtr[Tail & SamplerPtr->Mask]);
+
+	/*
+	 * Release the entry only after it is copied out
+	 */
+	SamplerPtr->Tail = Tail + 1U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function drains samples from the ring buffer through an export
+* handler, which sends them to the transport of the application (UART,
+* shared memory mailbox, lwIP UDP socket, ...). A sample stays in the ring
+* buffer if the handler does not return XST_SUCCESS, so a transport that is
+* temporarily out of buffers does not lose data.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+* @param	Handler is the export handler called for every sample.
+* @param	CallBackRef is passed to Handler unchanged.
+* @param	MaxSamples is the maximum number of samples to export in this
+*		call, 0 exports all samples available.
+*
+* @return	Number of samples exported.
+*
+* @note		This function is not meant to be called from interrupt
+*		context.
+*
+******************************************************************************/
+u32 XAxiPmon_SamplerExport(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon_SampleHandler Handler, void *CallBackRef,
+		u32 MaxSamples)
+{
+	XAxiPmon_Sample Sample;
+	u32 Tail;
+	u32 Count = 0U;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(Handler != NULL);
+
+	Tail = SamplerPtr->Tail;
+	while ((Tail != SamplerPtr->Head) &&
+			((MaxSamples == 0U) || (Count < MaxSamples))) {
+		XAxiPmon_SamplerCopy(&Sample,
+			&SamplerPtr->BufferPtr[Tail & SamplerPtr->Mask]);
+		if (Handler(CallBackRef, &Sample) != XST_SUCCESS) {
+			break;
+		}
+		Tail++;
+		SamplerPtr->Tail = Tail;
+		Count++;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the timestamp of a sample. In Advanced mode it is
+* the Global Clock Counter, in Profile mode, which has no Global Clock
+* Counter, it is derived from the sequence number and the sample interval.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+*
+* @return	Timestamp in APM clock cycles.
+*
+* @note		None.
+*
+******************************************************************************/
+static u64 XAxiPmon_SamplerTimestamp(XAxiPmon_Sampler *SamplerPtr)
+{
+	XAxiPmon *InstancePtr = SamplerPtr->InstancePtr;
+	u32 CntHighValue = 0U;
+	u32 CntHighCheck;
+	u32 CntLowValue;
+
+	if (InstancePtr->Mode != XAPM_MODE_ADVANCED) {
+		return ((u64)SamplerPtr->SeqNum + 1U) *
+				(u64)SamplerPtr->SampleInterval;
+	}
+
+	if (InstancePtr->Config.GlobalClkCounterWidth == 64) {
+		/*
+		 * Re-read the upper half in case the lower half wrapped
+		 * between the two reads
+		 */
+		do {
+			CntHighValue = XAxiPmon_ReadReg(
+					InstancePtr->Config.BaseAddress,
+					XAPM_GCC_HIGH_OFFSET);
+			CntLowValue = XAxiPmon_ReadReg(
+					InstancePtr->Config.BaseAddress,
+					XAPM_GCC_LOW_OFFSET);
+			CntHighCheck = XAxiPmon_ReadReg(
+					InstancePtr->Config.BaseAddress,
+					XAPM_GCC_HIGH_OFFSET);
+		} while (CntHighValue != CntHighCheck);
+	} else {
+		CntLowValue = XAxiPmon_ReadReg(InstancePtr->Config.BaseAddress,
+						XAPM_GCC_LOW_OFFSET);
+	}
+
+	return ((u64)CntHighValue << 32U) | (u64)CntLowValue;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies a ring buffer entry out of the ring buffer.
+*
+* @param	DstPtr is a pointer to the destination sample.
+* @param	SrcPtr is a pointer to the ring buffer entry.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XAxiPmon_SamplerCopy(XAxiPmon_Sample *DstPtr,
+				volatile XAxiPmon_Sample *SrcPtr)
+{
+	u8 CounterNum;
+
+	DstPtr->Timestamp = SrcPtr->Timestamp;
+	DstPtr->SeqNum = SrcPtr->SeqNum;
+	DstPtr->NumCounters = SrcPtr->NumCounters;
+	for (CounterNum = 0U; CounterNum < DstPtr->NumCounters;
+							CounterNum++) {
+		DstPtr->Slot[CounterNum] = SrcPtr->Slot[CounterNum];
+		DstPtr->Metric[CounterNum] = SrcPtr->Metric[CounterNum];
+		DstPtr->Counter[CounterNum] = SrcPtr->Counter[CounterNum];
+	}
+}
+/** @} */
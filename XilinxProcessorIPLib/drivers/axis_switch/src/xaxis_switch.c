@@ -48,6 +48,8 @@
 * 1.1   sk  08/16/16 Used UINTPTR instead of u32 for Baseaddress as part of
 *                    adding 64 bit support. CR# 867425.
 *                    Changed the prototype of XAxisScr_CfgInitialize API.
+* 1.2   ag  10/14/26 Keep the MI MUX shadow up to date in the port
+*                    functions.
 * </pre>
 *
 ******************************************************************************/
@@ -152,6 +154,7 @@ void XAxisScr_MiPortEnable(XAxis_Switch *InstancePtr, u8 MiIndex, u8 SiIndex)
 	/* MUX[MiIndex] is sourced from SI[SiIndex] */
 	XAxisScr_WriteReg(InstancePtr->Config.BaseAddress, MiPortAddr,
 				SiIndex);
+	InstancePtr->MiMux[MiIndex] = SiIndex;
 }
 
 /*****************************************************************************/
@@ -184,6 +187,7 @@ void XAxisScr_MiPortDisable(XAxis_Switch *InstancePtr, u8 MiIndex)
 
 	XAxisScr_WriteReg(InstancePtr->Config.BaseAddress, MiPortAddr,
 				XAXIS_SCR_MI_X_DISABLE_MASK);
+	InstancePtr->MiMux[MiIndex] = XAXIS_SCR_MI_X_DISABLE_MASK;
 }
 
 /*****************************************************************************/
@@ -311,6 +315,7 @@ void XAxisScr_MiPortDisableAll(XAxis_Switch *InstancePtr)
 
 		XAxisScr_WriteReg(InstancePtr->Config.BaseAddress, MiPortAddr,
 				XAXIS_SCR_MI_X_DISABLE_MASK);
+		InstancePtr->MiMux[Index] = XAXIS_SCR_MI_X_DISABLE_MASK;
 	}
 }
 /** @} */
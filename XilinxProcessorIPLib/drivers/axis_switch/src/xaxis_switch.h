@@ -56,6 +56,24 @@
 * - Call XAxisScr_CfgInitialize to initialize the device and the driver
 *   instance associated with it.
 *
+* <b>Route Tables</b>
+*
+* Besides the per port functions, the driver keeps a copy of every MI MUX
+* register it wrote. XAxisScr_MiPortUpdate takes the wanted SI of every MI
+* and writes only the MI MUX registers that change, so reprogramming a switch
+* does not touch the untouched streams.
+*
+* Routes spanning several cascaded switches are handled by XAxisScr_Graph.
+* The application registers the switches and the links between them (an MI
+* of one switch feeding an SI of another), then adds end-to-end routes with
+* XAxisScr_GraphAddRoute, which finds the shortest chain of free links.
+* XAxisScr_GraphPrepare writes the changed MI MUX registers of all switches;
+* they have no effect until XAxisScr_GraphCommit sets the register update bit
+* of all the affected switches back to back. Each switch swaps its routing
+* at the next packet boundary, so calling XAxisScr_GraphCommit from a frame
+* start interrupt switches all the switches at the same frame boundary.
+* XAxisScr_GraphWaitCommit waits for the switches to take the new routing.
+*
 * <b>Interrupts </b>
 *
 * This driver does not have interrupt mechanism.
@@ -96,6 +114,8 @@
 *                    fix for CR-969126.
 *       ms  03/17/17 Added readme.txt file in examples folder for doxygen
 *                    generation.
+*       ag  10/14/26 Added MI MUX shadow, XAxisScr_MiPortUpdate and the
+*                    multi-switch route graph with grouped commit.
 * </pre>
 *
 ******************************************************************************/
@@ -115,6 +135,17 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+/** @name Route graph limits and special values
+* @{
+*/
+#define XAXIS_SCR_PORT_NONE		0xFF	/**< MI is not connected */
+#define XAXIS_SCR_GRAPH_MAX_SWITCHES	8	/**< Maximum number of switches
+						  *  in a route graph */
+#define XAXIS_SCR_GRAPH_MAX_LINKS	32	/**< Maximum number of links
+						  *  between switches */
+#define XAXIS_SCR_COMMIT_TIMEOUT	1000000	/**< Register update poll
+						  *  count */
+/*@}*/
 
 /**************************** Type Definitions *******************************/
 
@@ -140,8 +171,42 @@ typedef struct {
 	XAxis_Switch_Config Config;	/**< Hardware Configuration */
 	u32 IsReady;			/**< Core and the driver instance are
 					  *  initialized */
+	u32 MiMux[XAXIS_SCR_MAX_PORTS];	/**< Last value written to each MI
+					  *  MUX register */
 } XAxis_Switch;
 
+/**
+* This typedef describes a link between two switches of a route graph: the
+* stream leaving MI[FromMi] of switch FromSwitch enters SI[ToSi] of switch
+* ToSwitch.
+*/
+typedef struct {
+	u8 FromSwitch;		/**< Index of the upstream switch */
+	u8 FromMi;		/**< MI of the upstream switch */
+	u8 ToSwitch;		/**< Index of the downstream switch */
+	u8 ToSi;		/**< SI of the downstream switch */
+} XAxisScr_Link;
+
+/**
+* The route graph instance data. It holds the switches, the links between
+* them and the wanted SI of every MI of every switch.
+*/
+typedef struct {
+	XAxis_Switch *SwitchPtr[XAXIS_SCR_GRAPH_MAX_SWITCHES];
+				/**< Switches, indexed in order of addition */
+	u8 NumSwitches;		/**< Number of switches */
+	u8 NumLinks;		/**< Number of links */
+	XAxisScr_Link Link[XAXIS_SCR_GRAPH_MAX_LINKS];
+				/**< Links between switches */
+	u8 Route[XAXIS_SCR_GRAPH_MAX_SWITCHES][XAXIS_SCR_MAX_PORTS];
+				/**< Wanted SI of each MI, or
+				  *  XAXIS_SCR_PORT_NONE */
+	u32 PendingMask;	/**< Switches with prepared, uncommitted
+				  *  changes */
+	u32 CommitMask;		/**< Switches with a register update in
+				  *  flight */
+} XAxisScr_Graph;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -184,6 +249,25 @@ typedef struct {
 			XAXIS_SCR_CTRL_OFFSET) & \
 				(~XAXIS_SCR_CTRL_REG_UPDATE_MASK))
 
+/*****************************************************************************/
+/**
+*
+* This macro returns whether a register update is still waiting to be taken
+* by the core.
+*
+* @param	InstancePtr is a pointer to the XAxis_Switch core instance.
+*
+* @return	TRUE if the register update bit is still set, FALSE otherwise.
+*
+* @note		C-style signature:
+*		u32 XAxisScr_IsRegUpdatePending(XAxis_Switch *InstancePtr)
+*
+******************************************************************************/
+#define XAxisScr_IsRegUpdatePending(InstancePtr) \
+	((XAxisScr_ReadReg((InstancePtr)->Config.BaseAddress, \
+		XAXIS_SCR_CTRL_OFFSET) & XAXIS_SCR_CTRL_REG_UPDATE_MASK) ? \
+			TRUE : FALSE)
+
 /************************** Function Prototypes ******************************/
 
 /* Initialization function in xaxis_switch_sinit.c */
@@ -201,6 +285,20 @@ s32 XAxisScr_IsMiPortEnabled(XAxis_Switch *InstancePtr, u8 MiIndex,
 s32 XAxisScr_IsMiPortDisabled(XAxis_Switch *InstancePtr, u8 MiIndex);
 void XAxisScr_MiPortDisableAll(XAxis_Switch *InstancePtr);
 
+/* Route table functions in xaxis_switch_route.c */
+u32 XAxisScr_MiPortUpdate(XAxis_Switch *InstancePtr, const u8 *SiTable);
+void XAxisScr_GraphInit(XAxisScr_Graph *GraphPtr);
+s32 XAxisScr_GraphAddSwitch(XAxisScr_Graph *GraphPtr,
+				XAxis_Switch *InstancePtr);
+s32 XAxisScr_GraphAddLink(XAxisScr_Graph *GraphPtr, u8 FromSwitch, u8 FromMi,
+				u8 ToSwitch, u8 ToSi);
+void XAxisScr_GraphClearRoutes(XAxisScr_Graph *GraphPtr);
+s32 XAxisScr_GraphAddRoute(XAxisScr_Graph *GraphPtr, u8 SrcSwitch, u8 SrcSi,
+				u8 DstSwitch, u8 DstMi);
+void XAxisScr_GraphPrepare(XAxisScr_Graph *GraphPtr);
+void XAxisScr_GraphCommit(XAxisScr_Graph *GraphPtr);
+s32 XAxisScr_GraphWaitCommit(XAxisScr_Graph *GraphPtr);
+
 /* Self test function in xaxis_switch_selftest.c */
 s32 XAxisScr_SelfTest(XAxis_Switch *InstancePtr);
 
@@ -50,6 +50,7 @@
 * Ver   Who Date     Changes
 * ----- --- -------- --------------------------------------------------
 * 1.00  sha 01/28/15 Initial release.
+* 1.2   ag  10/14/26 Added XAXIS_SCR_MI_MUX_OFFSET and XAXIS_SCR_MAX_PORTS.
 * </pre>
 *
 ******************************************************************************/
@@ -76,6 +77,12 @@ extern "C" {
 						  *  offset */
 #define XAXIS_SCR_MI_MUX_END_OFFSET	0x07C	/**< End of MI MUX Register
 						  *  offset */
+#define XAXIS_SCR_MI_MUX_OFFSET(MiIndex) \
+	(XAXIS_SCR_MI_MUX_START_OFFSET + (4 * (u32)(MiIndex)))
+					/**< MI MUX Register offset of
+					  *  MI[MiIndex] */
+#define XAXIS_SCR_MAX_PORTS		16	/**< Maximum number of SI/MI
+						  *  ports of the core */
 
 /*@}*/
 
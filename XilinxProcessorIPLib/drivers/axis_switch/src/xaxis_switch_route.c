@@ -0,0 +1,455 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxis_switch_route.c
+* @addtogroup axis_switch_v1_2
+* @{
+*
+* This file contains the route table functions of the AXI4-Stream Switch
+* Control Router driver: differential MI MUX programming of one switch and
+* the route graph spanning several cascaded switches with a grouped commit.
+* Please see xaxis_switch.h for more details of the driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- --------------------------------------------------
+* 1.2   ag  10/14/26 Initial release.
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxis_switch.h"
+#include "string.h"
+
+/************************** Constant Definitions *****************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Function Prototypes ******************************/
+
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function programs all the MUX ports of the core from a route table,
+* writing only the MI MUX registers whose value changes. The new routing
+* takes effect at the next register update.
+*
+* @param	InstancePtr is a pointer to the XAxis_Switch core instance.
+* @param	SiTable holds, for every MI of the core, the index of the SI
+*		sourcing it or XAXIS_SCR_PORT_NONE to disable the MI.
+*
+* @return	Number of MI MUX registers written.
+*
+* @note		The comparison is done against the values last written by the
+*		driver, so the core must only be programmed through this driver.
+*
+******************************************************************************/
+u32 XAxisScr_MiPortUpdate(XAxis_Switch *InstancePtr, const u8 *SiTable)
+{
+	u32 RegValue;
+	u32 Count = 0;
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(SiTable != NULL);
+
+	for (Index = 0; Index < InstancePtr->Config.MaxNumMI; Index++) {
+		if (SiTable[Index] == XAXIS_SCR_PORT_NONE) {
+			RegValue = XAXIS_SCR_MI_X_DISABLE_MASK;
+		}
+		else {
+			Xil_AssertNonvoid(SiTable[Index] <
+					InstancePtr->Config.MaxNumSI);
+			RegValue = SiTable[Index];
+		}
+
+		if (RegValue != InstancePtr->MiMux[Index]) {
+			XAxisScr_WriteReg(InstancePtr->Config.BaseAddress,
+				XAXIS_SCR_MI_MUX_OFFSET(Index), RegValue);
+			InstancePtr->MiMux[Index] = RegValue;
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a route graph with no switches, no links and no
+* routes.
+*
+* @param	GraphPtr is a pointer to the route graph.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAxisScr_GraphInit(XAxisScr_Graph *GraphPtr)
+{
+	/* Verify argument. */
+	Xil_AssertVoid(GraphPtr != NULL);
+
+	(void)memset((void *)GraphPtr, 0, sizeof(XAxisScr_Graph));
+	XAxisScr_GraphClearRoutes(GraphPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds an initialized switch to a route graph. Switches are
+* indexed in the order they are added, starting from 0.
+*
+* @param	GraphPtr is a pointer to the route graph.
+* @param	InstancePtr is a pointer to the XAxis_Switch core instance.
+*
+* @return
+*		- XST_SUCCESS if the switch was added.
+*		- XST_FAILURE if the graph is full.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XAxisScr_GraphAddSwitch(XAxisScr_Graph *GraphPtr,
+				XAxis_Switch *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(GraphPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (GraphPtr->NumSwitches >= XAXIS_SCR_GRAPH_MAX_SWITCHES) {
+		return XST_FAILURE;
+	}
+
+	GraphPtr->SwitchPtr[GraphPtr->NumSwitches] = InstancePtr;
+	GraphPtr->NumSwitches++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function declares that MI[FromMi] of switch FromSwitch drives
+* SI[ToSi] of switch ToSwitch.
+*
+* @param	GraphPtr is a pointer to the route graph.
+* @param	FromSwitch is the index of the upstream switch.
+* @param	FromMi is the MI of the upstream switch.
+* @param	ToSwitch is the index of the downstream switch.
+* @param	ToSi is the SI of the downstream switch.
+*
+* @return
+*		- XST_SUCCESS if the link was added.
+*		- XST_FAILURE if the graph has no room for another link.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XAxisScr_GraphAddLink(XAxisScr_Graph *GraphPtr, u8 FromSwitch, u8 FromMi,
+				u8 ToSwitch, u8 ToSi)
+{
+	XAxisScr_Link *LinkPtr;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(GraphPtr != NULL);
+	Xil_AssertNonvoid(FromSwitch < GraphPtr->NumSwitches);
+	Xil_AssertNonvoid(ToSwitch < GraphPtr->NumSwitches);
+	Xil_AssertNonvoid(FromSwitch != ToSwitch);
+	Xil_AssertNonvoid(FromMi <
+			GraphPtr->SwitchPtr[FromSwitch]->Config.MaxNumMI);
+	Xil_AssertNonvoid(ToSi <
+			GraphPtr->SwitchPtr[ToSwitch]->Config.MaxNumSI);
+
+	if (GraphPtr->NumLinks >= XAXIS_SCR_GRAPH_MAX_LINKS) {
+		return XST_FAILURE;
+	}
+
+	LinkPtr = &GraphPtr->Link[GraphPtr->NumLinks];
+	LinkPtr->FromSwitch = FromSwitch;
+	LinkPtr->FromMi = FromMi;
+	LinkPtr->ToSwitch = ToSwitch;
+	LinkPtr->ToSi = ToSi;
+	GraphPtr->NumLinks++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes all the routes of a route graph. The hardware is not
+* touched until XAxisScr_GraphPrepare is called.
+*
+* @param	GraphPtr is a pointer to the route graph.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XAxisScr_GraphClearRoutes(XAxisScr_Graph *GraphPtr)
+{
+	/* Verify argument. */
+	Xil_AssertVoid(GraphPtr != NULL);
+
+	(void)memset((void *)GraphPtr->Route, XAXIS_SCR_PORT_NONE,
+					sizeof(GraphPtr->Route));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a route from SI[SrcSi] of switch SrcSwitch to MI[DstMi]
+* of switch DstSwitch. The route takes the path crossing the fewest links
+* whose MI is free or already carries the same stream, so a stream can be
+* fanned out to several destinations sharing the start of its path.
+*
+* @param	GraphPtr is a pointer to the route graph.
+* @param	SrcSwitch is the index of the switch the stream enters.
+* @param	SrcSi is the SI of SrcSwitch the stream enters on.
+* @param	DstSwitch is the index of the switch the stream leaves.
+* @param	DstMi is the MI of DstSwitch the stream leaves on.
+*
+* @return
+*		- XST_SUCCESS if the route was added.
+*		- XST_FAILURE if no free path exists or DstMi already carries
+*		  another stream. The graph is left unchanged.
+*
+* @note		The hardware is not touched until XAxisScr_GraphPrepare is
+*		called.
+*
+******************************************************************************/
+s32 XAxisScr_GraphAddRoute(XAxisScr_Graph *GraphPtr, u8 SrcSwitch, u8 SrcSi,
+				u8 DstSwitch, u8 DstMi)
+{
+	u8 Queue[XAXIS_SCR_GRAPH_MAX_SWITCHES];
+	u8 InSi[XAXIS_SCR_GRAPH_MAX_SWITCHES];
+	u8 ViaLink[XAXIS_SCR_GRAPH_MAX_SWITCHES];
+	XAxisScr_Link *LinkPtr;
+	u8 Head = 0;
+	u8 Tail = 0;
+	u8 Switch;
+	u8 Index;
+	u8 Cur;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(GraphPtr != NULL);
+	Xil_AssertNonvoid(SrcSwitch < GraphPtr->NumSwitches);
+	Xil_AssertNonvoid(DstSwitch < GraphPtr->NumSwitches);
+	Xil_AssertNonvoid(SrcSi <
+			GraphPtr->SwitchPtr[SrcSwitch]->Config.MaxNumSI);
+	Xil_AssertNonvoid(DstMi <
+			GraphPtr->SwitchPtr[DstSwitch]->Config.MaxNumMI);
+
+	(void)memset((void *)InSi, XAXIS_SCR_PORT_NONE, sizeof(InSi));
+
+	/* Breadth first search over the switches, from the source */
+	InSi[SrcSwitch] = SrcSi;
+	ViaLink[SrcSwitch] = XAXIS_SCR_PORT_NONE;
+	Queue[Tail++] = SrcSwitch;
+
+	while (Head < Tail) {
+		Switch = Queue[Head++];
+		if (Switch == DstSwitch) {
+			break;
+		}
+
+		for (Index = 0; Index < GraphPtr->NumLinks; Index++) {
+			LinkPtr = &GraphPtr->Link[Index];
+			if ((LinkPtr->FromSwitch != Switch) ||
+			    (InSi[LinkPtr->ToSwitch] != XAXIS_SCR_PORT_NONE)) {
+				continue;
+			}
+
+			/* The link MI must be free or carry this stream */
+			Cur = GraphPtr->Route[Switch][LinkPtr->FromMi];
+			if ((Cur != XAXIS_SCR_PORT_NONE) &&
+			    (Cur != InSi[Switch])) {
+				continue;
+			}
+
+			InSi[LinkPtr->ToSwitch] = LinkPtr->ToSi;
+			ViaLink[LinkPtr->ToSwitch] = Index;
+			Queue[Tail++] = LinkPtr->ToSwitch;
+		}
+	}
+
+	if (InSi[DstSwitch] == XAXIS_SCR_PORT_NONE) {
+		return XST_FAILURE;
+	}
+
+	Cur = GraphPtr->Route[DstSwitch][DstMi];
+	if ((Cur != XAXIS_SCR_PORT_NONE) && (Cur != InSi[DstSwitch])) {
+		return XST_FAILURE;
+	}
+
+	/* Walk back from the destination and claim the MIs on the path */
+	GraphPtr->Route[DstSwitch][DstMi] = InSi[DstSwitch];
+	Switch = DstSwitch;
+	while (ViaLink[Switch] != XAXIS_SCR_PORT_NONE) {
+		LinkPtr = &GraphPtr->Link[ViaLink[Switch]];
+		Switch = LinkPtr->FromSwitch;
+		GraphPtr->Route[Switch][LinkPtr->FromMi] = InSi[Switch];
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes the changed MI MUX registers of every switch of a
+* route graph. The new routing stays inactive until XAxisScr_GraphCommit.
+*
+* @param	GraphPtr is a pointer to the route graph.
+*
+* @return	None.
+*
+* @note		Must not be called while a commit is in flight, i.e. between
+*		XAxisScr_GraphCommit and a successful XAxisScr_GraphWaitCommit.
+*
+******************************************************************************/
+void XAxisScr_GraphPrepare(XAxisScr_Graph *GraphPtr)
+{
+	u8 Index;
+
+	/* Verify argument. */
+	Xil_AssertVoid(GraphPtr != NULL);
+	Xil_AssertVoid(GraphPtr->CommitMask == 0);
+
+	for (Index = 0; Index < GraphPtr->NumSwitches; Index++) {
+		if (XAxisScr_MiPortUpdate(GraphPtr->SwitchPtr[Index],
+				GraphPtr->Route[Index]) != 0) {
+			GraphPtr->PendingMask |= ((u32)1 << Index);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function requests a register update on every switch with prepared
+* changes, back to back. Each switch applies its new routing at the next
+* packet boundary. The function does not wait and can be called from a frame
+* start interrupt handler.
+*
+* @param	GraphPtr is a pointer to the route graph.
+*
+* @return	None.
+*
+* @note		Switches with no change are not updated, so their streams are
+*		not held at a packet boundary.
+*
+******************************************************************************/
+void XAxisScr_GraphCommit(XAxisScr_Graph *GraphPtr)
+{
+	u8 Index;
+
+	/* Verify argument. */
+	Xil_AssertVoid(GraphPtr != NULL);
+
+	for (Index = 0; Index < GraphPtr->NumSwitches; Index++) {
+		if ((GraphPtr->PendingMask & ((u32)1 << Index)) != 0) {
+			XAxisScr_RegUpdateEnable(GraphPtr->SwitchPtr[Index]);
+		}
+	}
+
+	GraphPtr->CommitMask |= GraphPtr->PendingMask;
+	GraphPtr->PendingMask = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for every switch committed by XAxisScr_GraphCommit to
+* take its new routing.
+*
+* @param	GraphPtr is a pointer to the route graph.
+*
+* @return
+*		- XST_SUCCESS if all the switches took the new routing.
+*		- XST_FAILURE if a switch did not do so within
+*		  XAXIS_SCR_COMMIT_TIMEOUT polls; the call can be repeated.
+*
+* @note		A switch takes its new routing only at a packet boundary, so a
+*		stalled stream delays the commit.
+*
+******************************************************************************/
+s32 XAxisScr_GraphWaitCommit(XAxisScr_Graph *GraphPtr)
+{
+	u32 Timeout = XAXIS_SCR_COMMIT_TIMEOUT;
+	u8 Index;
+
+	/* Verify argument. */
+	Xil_AssertNonvoid(GraphPtr != NULL);
+
+	while (GraphPtr->CommitMask != 0) {
+		for (Index = 0; Index < GraphPtr->NumSwitches; Index++) {
+			if (((GraphPtr->CommitMask & ((u32)1 << Index)) != 0) &&
+			    (!XAxisScr_IsRegUpdatePending(
+					GraphPtr->SwitchPtr[Index]))) {
+				GraphPtr->CommitMask &= ~((u32)1 << Index);
+			}
+		}
+
+		if (Timeout == 0) {
+			return XST_FAILURE;
+		}
+		Timeout--;
+	}
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -69,6 +69,8 @@
 *			parameters (CR: 703738)
 * 6.1   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototype of XAxiVdma_CfgInitialize API.
+* 6.5   ag   10/14/26 Added XAxiVdma_SetSliceMonitor() API. Write channel
+*                     buffer addresses are kept for the slice monitor.
 *
 * </pre>
 *
@@ -158,6 +160,8 @@ int XAxiVdma_CfgInitialize(XAxiVdma *InstancePtr, XAxiVdma_Config *CfgPtr,
 	InstancePtr->ReadCallBack.ErrCallBack = 0x0;
 	InstancePtr->WriteCallBack.CompletionCallBack = 0x0;
 	InstancePtr->WriteCallBack.ErrCallBack = 0x0;
+	InstancePtr->SliceMonPtr = NULL;
+	InstancePtr->SchedPtr = NULL;
 
 	InstancePtr->BaseAddr = EffectiveAddr;
 	InstancePtr->MaxNumFrames = CfgPtr->MaxFrameStoreNum;
@@ -1025,6 +1029,15 @@ int XAxiVdma_DmaSetBufferAddr(XAxiVdma *InstancePtr, u16 Direction,
 	}
 
 	if (Channel->IsValid) {
+		if (Direction == XAXIVDMA_WRITE) {
+			int i;
+
+			for (i = 0; i < Channel->NumFrames; i++) {
+				InstancePtr->WriteFrameAddr[i] =
+				    BufferAddrSet[i];
+			}
+		}
+
 		return XAxiVdma_ChannelSetBufferAddr(Channel, BufferAddrSet,
 		    Channel->NumFrames);
 	}
@@ -1395,4 +1408,63 @@ int XAxiVdma_ClearDmaChannelErrors(XAxiVdma *InstancePtr, u16 Direction,
 		return XST_DEVICE_NOT_FOUND;
 	}
 }
+/*****************************************************************************/
+/**
+ * Attach a slice monitor to the write channel
+ *
+ * The first frame store is armed and started, as the channel begins with it,
+ * and the second one is armed for the next frame. From then on the write
+ * interrupt handler tracks the frames on every frame count interrupt.
+ *
+ * @param InstancePtr is the pointer to the DMA engine to work on
+ * @param MonPtr is the pointer to the initialized slice monitor, or NULL to
+ *        detach it
+ *
+ * @return
+ * - XST_SUCCESS if the monitor is attached or detached
+ * - XST_DEVICE_NOT_FOUND if the write channel is invalid
+ * - XST_DEVICE_BUSY if the write channel is running or has a frame store
+ *   scheduler
+ * - XST_INVALID_PARAM if the channel has less than two frame stores
+ *
+ * @note
+ * Call after XAxiVdma_DmaSetBufferAddr() and before XAxiVdma_DmaStart(). The
+ * write frame counter must be 1 and the frame count interrupt enabled.
+ *****************************************************************************/
+int XAxiVdma_SetSliceMonitor(XAxiVdma *InstancePtr, XVidC_SliceMon *MonPtr)
+{
+	XAxiVdma_Channel *Channel;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XAXIVDMA_DEVICE_READY);
+
+	Channel = XAxiVdma_GetChannel(InstancePtr, XAXIVDMA_WRITE);
+
+	if (!Channel->IsValid) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	if (MonPtr == NULL) {
+		InstancePtr->SliceMonPtr = NULL;
+
+		return XST_SUCCESS;
+	}
+
+	if (XAxiVdma_ChannelIsRunning(Channel) || InstancePtr->SchedPtr) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (Channel->NumFrames < 2) {
+		return XST_INVALID_PARAM;
+	}
+
+	XVidC_SliceMonArm(MonPtr, InstancePtr->WriteFrameAddr[0]);
+	XVidC_SliceMonStart(MonPtr);
+	XVidC_SliceMonArm(MonPtr, InstancePtr->WriteFrameAddr[1]);
+
+	InstancePtr->SliceFrame = 1;
+	InstancePtr->SliceMonPtr = MonPtr;
+
+	return XST_SUCCESS;
+}
 /** @} */
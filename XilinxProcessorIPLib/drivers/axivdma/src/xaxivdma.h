@@ -171,6 +171,28 @@
 * XAxiVdma_DmaStart() to start the transfer again. Note that the transfer
 * always starts from the first video frame.
 *
+* <b>Slice Notification</b>
+*
+* To process a frame before it is complete, attach a slice monitor (see
+* xvidc_slice.h in video_common) to the write channel using
+* XAxiVdma_SetSliceMonitor(), after the buffer addresses are set and before
+* the channel is started. The write channel must run in circular mode with at
+* least two frame stores, its frame counter set to 1 and the frame count
+* interrupt enabled. On each frame count interrupt the handler completes the
+* frame just written and arms the frame store after the next one. The
+* application polls the monitor with XVidC_SliceMonPoll() to get "first N
+* lines ready" callbacks. The monitor has to be attached again after the
+* channel is reset or stopped.
+*
+* <b>Frame Store Scheduler</b>
+*
+* To show the latest complete frame of a write channel on one or more read
+* channels without tearing, initialize a scheduler on the write channel with
+* XAxiVdma_SchedInit() and add the read channels with
+* XAxiVdma_SchedAddReader(), once the channels are running. All channels then
+* run in park mode and the write interrupt handler moves the park pointers on
+* every frame count interrupt. See xaxivdma_sched.c for the requirements.
+*
 * <b> Examples</b>
 *
 * We provide one example on how to use the AXI VDMA with AXI Video IPs. This
@@ -301,6 +323,9 @@
 * 6.4   ms   04/18/17 Modified tcl file to add suffix U for all macro
 *                     definitions of axivdma in xparameters.h
 *       ms   08/07/17 Fixed compilation warnings in xaxivdma_sinit.c
+* 6.5   ag   10/14/26 Added slice notification for the write channel.
+*       ag   10/14/26 Added frame store scheduler for dynamic parking of
+*                     read channels on the latest write frame.
 * </pre>
 *
 ******************************************************************************/
@@ -318,6 +343,7 @@ extern "C" {
 #include "xaxivdma_i.h"
 #include "xstatus.h"
 #include "xil_assert.h"
+#include "xvidc_slice.h"
 
 
 /************************** Constant Definitions *****************************/
@@ -536,8 +562,36 @@ typedef struct {
     XAxiVdma_Channel ReadChannel;  /**< Channel to read from memory */
     XAxiVdma_Channel WriteChannel; /**< Channel to write to memory */
 	int AddrWidth;		  /**< Address Width */
+
+    XVidC_SliceMon *SliceMonPtr;    /**< Write channel slice monitor */
+    UINTPTR WriteFrameAddr[XAXIVDMA_MAX_FRAMESTORE];
+                                    /**< Write channel frame stores */
+    int SliceFrame;                 /**< Frame store armed for next frame */
+    struct XAxiVdma_SchedS *SchedPtr; /**< Write channel frame store
+                                        *  scheduler */
 } XAxiVdma;
 
+#define XAXIVDMA_SCHED_MAX_READERS  4 /**< Read channels per scheduler */
+
+/**
+ * The frame store scheduler. The user allocates one for each write channel
+ * whose frames are shown by read channels in park mode.
+ */
+typedef struct XAxiVdma_SchedS {
+    XAxiVdma *WriterPtr;            /**< Engine of the write channel */
+    XAxiVdma *ReaderPtr[XAXIVDMA_SCHED_MAX_READERS];
+                                    /**< Engines of the read channels */
+    int ReadPark[XAXIVDMA_SCHED_MAX_READERS];
+                                    /**< Frame each read channel is parked
+                                      *  on */
+    int NumReaders;                 /**< Number of read channels */
+    int NumFrames;                  /**< Number of frame stores */
+    int WriteFrame;                 /**< Frame store being written */
+    int LatestFrame;                /**< Latest complete frame, -1 if none */
+    u32 Dropped;                    /**< Frames not published for lack of a
+                                      *  free frame store */
+} XAxiVdma_Sched;
+
 
 /************************** Function Prototypes ******************************/
 /* Initialization */
@@ -581,6 +635,16 @@ int XAxiVdma_ClearDmaChannelErrors(XAxiVdma *InstancePtr, u16 Direction,
 					u32 ErrorMask);
 int XAxiVdma_MaskS2MMErrIntr(XAxiVdma *InstancePtr, u32 ErrorMask,
                                         u16 Direction);
+int XAxiVdma_SetSliceMonitor(XAxiVdma *InstancePtr, XVidC_SliceMon *MonPtr);
+
+/*
+ * Frame store scheduler functions in xaxivdma_sched.c
+ */
+int XAxiVdma_SchedInit(XAxiVdma_Sched *SchedPtr, XAxiVdma *WriterPtr);
+int XAxiVdma_SchedAddReader(XAxiVdma_Sched *SchedPtr, XAxiVdma *ReaderPtr);
+int XAxiVdma_SchedRemoveReader(XAxiVdma_Sched *SchedPtr, XAxiVdma *ReaderPtr);
+void XAxiVdma_SchedStop(XAxiVdma_Sched *SchedPtr);
+void XAxiVdma_SchedFrameDone(XAxiVdma_Sched *SchedPtr);
 
 /* Transfers */
 int XAxiVdma_StartWriteFrame(XAxiVdma *InstancePtr,
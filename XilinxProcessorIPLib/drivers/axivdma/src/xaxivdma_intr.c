@@ -52,6 +52,10 @@
 *		      the S2MM interrupt for the error mask provided.
 *		      (CR 734741)
 * 6.3   ms   02/20/17 Fixed compilation error. CR-969129.
+* 6.5   ag   10/14/26 Track slice monitor frames in the write interrupt
+*		      handler.
+*       ag   10/14/26 Run the frame store scheduler in the write interrupt
+*		      handler.
 * </pre>
 *
 ******************************************************************************/
@@ -61,6 +65,10 @@
 #include "xaxivdma.h"
 #include "xaxivdma_i.h"
 
+/************************** Function Prototypes ******************************/
+
+static void XAxiVdma_SliceFrameDone(XAxiVdma *InstancePtr);
+
 /*****************************************************************************/
 /**
  * Enable specific interrupts for a channel
@@ -325,6 +333,15 @@ void XAxiVdma_WriteIntrHandler(void * InstancePtr)
 
 	XAxiVdma_ChannelIntrClear(Channel, PendingIntr);
 
+	/* Park pointers have to be moved before the next frame starts */
+	if ((PendingIntr & XAXIVDMA_IXR_FRMCNT_MASK) && DmaPtr->SchedPtr) {
+		XAxiVdma_SchedFrameDone(DmaPtr->SchedPtr);
+	}
+
+	if ((PendingIntr & XAXIVDMA_IXR_FRMCNT_MASK) && DmaPtr->SliceMonPtr) {
+		XAxiVdma_SliceFrameDone(DmaPtr);
+	}
+
 	CallBack = &(DmaPtr->WriteCallBack);
 
 	if (!CallBack->CompletionCallBack) {
@@ -408,4 +425,37 @@ int XAxiVdma_SetCallBack(XAxiVdma * InstancePtr, u32 HandlerType,
 
 	return XST_SUCCESS;
 }
+/*****************************************************************************/
+/**
+ * Advance the slice monitor of the write channel at the end of a frame
+ *
+ * The frame just written is completed and the armed frame store, which the
+ * channel writes next, is started. The frame store after it is armed, it is
+ * neither being written nor about to be.
+ *
+ * @param InstancePtr is the pointer to the DMA engine to work on
+ *
+ * @return
+ *  None
+ *
+ * @note
+ * Frames are counted, so the frame counter must generate one interrupt per
+ * frame.
+ *****************************************************************************/
+static void XAxiVdma_SliceFrameDone(XAxiVdma *InstancePtr)
+{
+	XVidC_SliceMon *MonPtr = InstancePtr->SliceMonPtr;
+	int Frame;
+
+	XVidC_SliceMonDone(MonPtr);
+	XVidC_SliceMonStart(MonPtr);
+
+	Frame = InstancePtr->SliceFrame + 1;
+	if (Frame >= InstancePtr->WriteChannel.NumFrames) {
+		Frame = 0;
+	}
+
+	XVidC_SliceMonArm(MonPtr, InstancePtr->WriteFrameAddr[Frame]);
+	InstancePtr->SliceFrame = Frame;
+}
 /** @} */
@@ -0,0 +1,397 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxivdma_sched.c
+* @addtogroup axivdma_v6_5
+* @{
+*
+* Contains the frame store scheduler, which lets one or more read channels
+* show the latest frame completed by a write channel without tearing.
+*
+* Both the write channel and the read channels run in park mode. On every
+* frame count interrupt of the write channel the frame store just written
+* becomes the latest frame, and the write channel is parked on a frame store
+* which is neither the latest frame nor read, or about to be read, by any of
+* the read channels. The read channels are then parked on the latest frame,
+* which each of them picks up at its next frame start. If no frame store is
+* free the frame just written is not published and the write channel writes
+* into it again, so the read channels repeat their frame.
+*
+* All channels must use the same frame store addresses, in the same order.
+* With at least two frame stores more than read channels, no frames are
+* dropped. The write channel frame counter must be 1 and its frame count
+* interrupt enabled. The read channels must not use genlock. The scheduler
+* cannot be combined with the write channel slice monitor, which expects the
+* write channel to run in circular mode.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 6.5   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxivdma.h"
+#include "xaxivdma_i.h"
+
+/************************** Function Prototypes ******************************/
+
+static void XAxiVdma_SchedPark(XAxiVdma *InstancePtr, int FrameIndex,
+        u16 Direction);
+static int XAxiVdma_SchedIsFree(XAxiVdma_Sched *SchedPtr, int FrameIndex);
+
+/*****************************************************************************/
+/**
+ * Initialize a frame store scheduler for a write channel
+ *
+ * The write channel is parked on the frame store it is writing.
+ *
+ * @param SchedPtr is the pointer to the scheduler
+ * @param WriterPtr is the pointer to the DMA engine whose write channel
+ *        produces the frames
+ *
+ * @return
+ * - XST_SUCCESS if the scheduler is initialized
+ * - XST_DEVICE_NOT_FOUND if the write channel is invalid
+ * - XST_DEVICE_BUSY if a slice monitor is attached to the write channel
+ * - XST_INVALID_PARAM if the write channel has less than three frame stores
+ * - XST_FAILURE if the write channel is not running
+ *
+ *****************************************************************************/
+int XAxiVdma_SchedInit(XAxiVdma_Sched *SchedPtr, XAxiVdma *WriterPtr)
+{
+	XAxiVdma_Channel *Channel;
+	int Status;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(WriterPtr != NULL);
+	Xil_AssertNonvoid(WriterPtr->IsReady == XAXIVDMA_DEVICE_READY);
+
+	Channel = XAxiVdma_GetChannel(WriterPtr, XAXIVDMA_WRITE);
+
+	if (!Channel->IsValid) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	if (WriterPtr->SliceMonPtr) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (Channel->NumFrames < 3) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset((void *)SchedPtr, 0, sizeof(XAxiVdma_Sched));
+
+	SchedPtr->WriterPtr = WriterPtr;
+	SchedPtr->NumFrames = Channel->NumFrames;
+	SchedPtr->LatestFrame = -1;
+	SchedPtr->WriteFrame = (int)XAxiVdma_CurrFrameStore(WriterPtr,
+	    XAXIVDMA_WRITE);
+
+	Status = XAxiVdma_StartParking(WriterPtr, SchedPtr->WriteFrame,
+	    XAXIVDMA_WRITE);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	WriterPtr->SchedPtr = SchedPtr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Add a read channel to a frame store scheduler
+ *
+ * The read channel is parked on the latest frame, or on a frame store not
+ * being written if no frame has been completed yet.
+ *
+ * @param SchedPtr is the pointer to the scheduler
+ * @param ReaderPtr is the pointer to the DMA engine whose read channel shows
+ *        the frames, it may be the same engine as the write channel
+ *
+ * @return
+ * - XST_SUCCESS if the read channel is added
+ * - XST_DEVICE_NOT_FOUND if the read channel is invalid
+ * - XST_INVALID_PARAM if the read channel has a different number of frame
+ *   stores than the write channel
+ * - XST_FAILURE if the scheduler is full or the read channel is not running
+ *
+ *****************************************************************************/
+int XAxiVdma_SchedAddReader(XAxiVdma_Sched *SchedPtr, XAxiVdma *ReaderPtr)
+{
+	XAxiVdma_Channel *Channel;
+	int FrameIndex;
+	int Status;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(ReaderPtr != NULL);
+	Xil_AssertNonvoid(ReaderPtr->IsReady == XAXIVDMA_DEVICE_READY);
+
+	Channel = XAxiVdma_GetChannel(ReaderPtr, XAXIVDMA_READ);
+
+	if (!Channel->IsValid) {
+		return XST_DEVICE_NOT_FOUND;
+	}
+
+	if (Channel->NumFrames != SchedPtr->NumFrames) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (SchedPtr->NumReaders == XAXIVDMA_SCHED_MAX_READERS) {
+		return XST_FAILURE;
+	}
+
+	if (SchedPtr->LatestFrame >= 0) {
+		FrameIndex = SchedPtr->LatestFrame;
+	}
+	else {
+		FrameIndex = (SchedPtr->WriteFrame + 1) % SchedPtr->NumFrames;
+	}
+
+	Status = XAxiVdma_StartParking(ReaderPtr, FrameIndex, XAXIVDMA_READ);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	SchedPtr->ReaderPtr[SchedPtr->NumReaders] = ReaderPtr;
+	SchedPtr->ReadPark[SchedPtr->NumReaders] = FrameIndex;
+	SchedPtr->NumReaders++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Remove a read channel from a frame store scheduler
+ *
+ * The read channel returns to circular buffer mode.
+ *
+ * @param SchedPtr is the pointer to the scheduler
+ * @param ReaderPtr is the pointer to the DMA engine of the read channel
+ *
+ * @return
+ * - XST_SUCCESS if the read channel is removed
+ * - XST_INVALID_PARAM if the read channel is not in the scheduler
+ *
+ * @note
+ * The write channel interrupt must be disabled while a read channel is
+ * removed.
+ *****************************************************************************/
+int XAxiVdma_SchedRemoveReader(XAxiVdma_Sched *SchedPtr, XAxiVdma *ReaderPtr)
+{
+	int i;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(ReaderPtr != NULL);
+
+	for (i = 0; i < SchedPtr->NumReaders; i++) {
+		if (SchedPtr->ReaderPtr[i] == ReaderPtr) {
+			break;
+		}
+	}
+
+	if (i == SchedPtr->NumReaders) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (; i < (SchedPtr->NumReaders - 1); i++) {
+		SchedPtr->ReaderPtr[i] = SchedPtr->ReaderPtr[i + 1];
+		SchedPtr->ReadPark[i] = SchedPtr->ReadPark[i + 1];
+	}
+	SchedPtr->NumReaders--;
+
+	XAxiVdma_StopParking(ReaderPtr, XAXIVDMA_READ);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Stop a frame store scheduler
+ *
+ * The write channel and all read channels return to circular buffer mode.
+ *
+ * @param SchedPtr is the pointer to the scheduler
+ *
+ * @return
+ *  None
+ *
+ *****************************************************************************/
+void XAxiVdma_SchedStop(XAxiVdma_Sched *SchedPtr)
+{
+	int i;
+
+	Xil_AssertVoid(SchedPtr != NULL);
+
+	SchedPtr->WriterPtr->SchedPtr = NULL;
+	XAxiVdma_StopParking(SchedPtr->WriterPtr, XAXIVDMA_WRITE);
+
+	for (i = 0; i < SchedPtr->NumReaders; i++) {
+		XAxiVdma_StopParking(SchedPtr->ReaderPtr[i], XAXIVDMA_READ);
+	}
+	SchedPtr->NumReaders = 0;
+}
+
+/*****************************************************************************/
+/**
+ * Publish the frame just completed by the write channel
+ *
+ * The write channel is parked on a free frame store first, as it has to be
+ * updated before its next frame starts. Read channels are only re-parked if
+ * they are not already parked on the latest frame.
+ *
+ * @param SchedPtr is the pointer to the scheduler
+ *
+ * @return
+ *  None
+ *
+ * @note
+ * Called by the write interrupt handler on the frame count interrupt.
+ * Applications need to call it only if they service the write channel
+ * interrupt outside the driver.
+ *****************************************************************************/
+void XAxiVdma_SchedFrameDone(XAxiVdma_Sched *SchedPtr)
+{
+	int Done;
+	int Next;
+	int i;
+
+	Xil_AssertVoid(SchedPtr != NULL);
+
+	Done = SchedPtr->WriteFrame;
+
+	for (i = 1; i < SchedPtr->NumFrames; i++) {
+		Next = (Done + i) % SchedPtr->NumFrames;
+		if (XAxiVdma_SchedIsFree(SchedPtr, Next)) {
+			break;
+		}
+	}
+
+	if (i == SchedPtr->NumFrames) {
+		/* Write the next frame over this one and keep showing the
+		 * previous one
+		 */
+		SchedPtr->Dropped++;
+
+		return;
+	}
+
+	XAxiVdma_SchedPark(SchedPtr->WriterPtr, Next, XAXIVDMA_WRITE);
+	SchedPtr->WriteFrame = Next;
+	SchedPtr->LatestFrame = Done;
+
+	for (i = 0; i < SchedPtr->NumReaders; i++) {
+		if (SchedPtr->ReadPark[i] != Done) {
+			XAxiVdma_SchedPark(SchedPtr->ReaderPtr[i], Done,
+			    XAXIVDMA_READ);
+			SchedPtr->ReadPark[i] = Done;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Change the frame a channel in park mode is parked on
+ *
+ * @param InstancePtr is the pointer to the DMA engine to work on
+ * @param FrameIndex is the frame to park on
+ * @param Direction is the channel to work on, use XAXIVDMA_READ/WRITE
+ *
+ * @return
+ *  None
+ *
+ *****************************************************************************/
+static void XAxiVdma_SchedPark(XAxiVdma *InstancePtr, int FrameIndex,
+        u16 Direction)
+{
+	u32 RegValue;
+
+	RegValue = XAxiVdma_ReadReg(InstancePtr->BaseAddr,
+	    XAXIVDMA_PARKPTR_OFFSET);
+
+	if (Direction == XAXIVDMA_READ) {
+		RegValue &= ~XAXIVDMA_PARKPTR_READREF_MASK;
+		RegValue |= (FrameIndex << XAXIVDMA_READREF_SHIFT) &
+		    XAXIVDMA_PARKPTR_READREF_MASK;
+	}
+	else {
+		RegValue &= ~XAXIVDMA_PARKPTR_WRTREF_MASK;
+		RegValue |= (FrameIndex << XAXIVDMA_WRTREF_SHIFT) &
+		    XAXIVDMA_PARKPTR_WRTREF_MASK;
+	}
+
+	XAxiVdma_WriteReg(InstancePtr->BaseAddr, XAXIVDMA_PARKPTR_OFFSET,
+	    RegValue);
+}
+
+/*****************************************************************************/
+/**
+ * Check if the write channel can be parked on a frame store
+ *
+ * A frame store is free if it is not the frame just completed, and no read
+ * channel is reading it or is parked on it.
+ *
+ * @param SchedPtr is the pointer to the scheduler
+ * @param FrameIndex is the frame store to check
+ *
+ * @return
+ * TRUE if the frame store is free, FALSE otherwise
+ *
+ *****************************************************************************/
+static int XAxiVdma_SchedIsFree(XAxiVdma_Sched *SchedPtr, int FrameIndex)
+{
+	int i;
+
+	if (FrameIndex == SchedPtr->WriteFrame) {
+		return FALSE;
+	}
+
+	for (i = 0; i < SchedPtr->NumReaders; i++) {
+		if ((SchedPtr->ReadPark[i] == FrameIndex) ||
+		    ((int)XAxiVdma_CurrFrameStore(SchedPtr->ReaderPtr[i],
+		    XAXIVDMA_READ) == FrameIndex)) {
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+/** @} */
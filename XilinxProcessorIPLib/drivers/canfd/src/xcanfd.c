@@ -56,6 +56,8 @@
 *                     Changed the prototype of XCanFd_CfgInitialize API.
 * 1.2   mi   09/22/16 Fixed compilation warnings.
 *		      .
+*       ag   10/14/26 Added XCanFd_Recv_Sequential_Bulk() and
+*		      XCanFd_Send_Bulk().
 *
 * </pre>
 ******************************************************************************/
@@ -720,6 +722,89 @@ u32 XCanFd_Recv_Sequential(XCanFd *InstancePtr, u32 *FramePtr)
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* This function receives all the CAN/CAN FD Frames stored in the Rx FIFO, up
+* to MaxFrames, in Sequential Mode. The fill level is read once from the FSR
+* Register and that many frames are copied into consecutive slots of the user
+* array, each XCANFD_MAX_FRAME_WORDS words long, without the extra FSR reads
+* done by XCanFd_Recv_Sequential().
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FramePtr is a pointer to a 32-bit aligned array of MaxFrames
+*		frames of XCANFD_MAX_FRAME_WORDS words each.
+* @param	MaxFrames is the number of frames the array can hold.
+*
+* @return	The number of frames received, 0 if the Rx FIFO was empty.
+*
+* @note		This routine is useful for Sequential Mode. Frames received
+*		while it runs are left in the FIFO for the next call.
+*
+******************************************************************************/
+u32 XCanFd_Recv_Sequential_Bulk(XCanFd *InstancePtr, u32 *FramePtr,
+						u32 MaxFrames)
+{
+	u32 ReadIndex;
+	u32 Result;
+	u32 FillLevel;
+	u32 Count;
+	u32 Dlc;
+	u32 Len;
+	u32 *DataPtr;
+	UINTPTR BaseAddr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	BaseAddr = InstancePtr->CanFdConfig.BaseAddress;
+
+	Result = XCanFd_ReadReg(BaseAddr, XCANFD_FSR_OFFSET);
+	FillLevel = (Result & XCANFD_FSR_FL_MASK) >> XCANFD_FSR_FL_SHIFT;
+	if (FillLevel > MaxFrames) {
+		FillLevel = MaxFrames;
+	}
+
+	for (Count = 0; Count < FillLevel; Count++) {
+
+		/*
+		 * The read index moves after each IRI write, the first one
+		 * comes from the FSR read which gave the fill level.
+		 */
+		if (Count != 0) {
+			Result = XCanFd_ReadReg(BaseAddr, XCANFD_FSR_OFFSET);
+		}
+		ReadIndex = Result & XCANFD_FSR_RI_MASK;
+
+		/* Read ID and DLC */
+		FramePtr[0] = XCanFd_ReadReg(BaseAddr,
+				XCANFD_RXID_OFFSET(ReadIndex));
+		FramePtr[1] = XCanFd_ReadReg(BaseAddr,
+				XCANFD_RXDLC_OFFSET(ReadIndex));
+
+		/*
+		 * CAN FD and legacy CAN frames use the same data word
+		 * layout, only the length differs.
+		 */
+		Dlc = XCanFd_GetDlc2len(FramePtr[1] & XCANFD_DLCR_DLC_MASK);
+		DataPtr = &FramePtr[2];
+		for (Len = 0; Len < Dlc; Len += XCANFD_DW_BYTES) {
+			*DataPtr = Xil_EndianSwap32(XCanFd_ReadReg(BaseAddr,
+					XCANFD_RXDW_OFFSET(ReadIndex) + Len));
+			DataPtr++;
+		}
+
+		/* Set the IRI bit causes core to increment RI in FSR Register */
+		XCanFd_WriteReg(BaseAddr, XCANFD_FSR_OFFSET,
+				Result | XCANFD_FSR_IRI_MASK);
+
+		FramePtr += XCANFD_MAX_FRAME_WORDS;
+	}
+
+	return FillLevel;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1458,6 +1543,92 @@ int XCanFd_Send_Queue(XCanFd *InstancePtr)
 
 }
 
+/*****************************************************************************/
+/**
+*
+* This function writes up to NumFrames CAN/CAN FD Frames into the Tx Buffers
+* which have no pending transmission request and requests the transmission of
+* all of them with a single write to the TRR Register. The TRR Register is
+* read once to find the pending buffers. Frames are written to the free
+* buffers in ascending buffer order, keeping the order of the user array.
+* Buffers filled with XCanFd_Addto_Queue() and not yet sent are skipped.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FramePtr is a pointer to a 32-bit aligned array of NumFrames
+*		frames of XCANFD_MAX_FRAME_WORDS words each.
+* @param	NumFrames is the number of frames in the array.
+*
+* @return	The number of frames written, which is less than NumFrames
+*		when all the Tx Buffers are in use. The remaining frames can be
+*		passed again once transmissions complete, for example from the
+*		Tx Ready Request Served interrupt.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCanFd_Send_Bulk(XCanFd *InstancePtr, u32 *FramePtr, u32 NumFrames)
+{
+	u32 FreeTxBuffer;
+	u32 NumTxBuf;
+	u32 Pending;
+	u32 TrrVal = 0;
+	u32 Sent = 0;
+	u32 Dlc;
+	u32 Len;
+	u32 *DataPtr;
+	UINTPTR BaseAddr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	BaseAddr = InstancePtr->CanFdConfig.BaseAddress;
+
+	NumTxBuf = InstancePtr->CanFdConfig.NumofTxBuf;
+	if (NumTxBuf > 32) {
+		NumTxBuf = 32;
+	}
+
+	/* Buffers with a TRR bit set are still waiting to be transmitted */
+	Pending = XCanFd_ReadReg(BaseAddr, XCANFD_TRR_OFFSET);
+
+	for (FreeTxBuffer = 0; (FreeTxBuffer < NumTxBuf) &&
+		(Sent < NumFrames); FreeTxBuffer++) {
+
+		if ((Pending & (1U << FreeTxBuffer)) ||
+			(InstancePtr->FreeBuffStatus[FreeTxBuffer] == 1)) {
+			continue;
+		}
+
+		/* Write ID and DLC */
+		XCanFd_WriteReg(BaseAddr, XCANFD_TXID_OFFSET(FreeTxBuffer),
+				FramePtr[0]);
+		XCanFd_WriteReg(BaseAddr, XCANFD_TXDLC_OFFSET(FreeTxBuffer),
+				FramePtr[1]);
+
+		/* Write Data, same word layout for CAN FD and legacy CAN */
+		Dlc = XCanFd_GetDlc2len(FramePtr[1] & XCANFD_DLCR_DLC_MASK);
+		DataPtr = &FramePtr[2];
+		for (Len = 0; Len < Dlc; Len += XCANFD_DW_BYTES) {
+			XCanFd_WriteReg(BaseAddr,
+					XCANFD_TXDW_OFFSET(FreeTxBuffer) + Len,
+					Xil_EndianSwap32(*DataPtr));
+			DataPtr++;
+		}
+
+		TrrVal |= 1U << FreeTxBuffer;
+		FramePtr += XCANFD_MAX_FRAME_WORDS;
+		Sent++;
+	}
+
+	/* Request transmission of all the new buffers at once */
+	if (TrrVal != 0) {
+		XCanFd_WriteReg(BaseAddr, XCANFD_TRR_OFFSET, TrrVal);
+	}
+
+	return Sent;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -113,6 +113,16 @@
 * It is important to note that frame buffers passed to the driver must be
 * 32-bit aligned.
 *
+* <b>Bulk Transfers</b>
+*
+* XCanFd_Recv_Sequential_Bulk() drains every frame stored in the Rx FIFO,
+* up to a given count, into an array of frames and XCanFd_Send_Bulk() writes
+* an array of frames into all the Tx buffers which are not pending and
+* requests their transmission with a single write to the TRR register. Frames
+* in these arrays are XCANFD_MAX_FRAME_WORDS words apart. Calling
+* XCanFd_Send_Bulk() from the Tx Ready Request Served interrupt keeps the Tx
+* buffers populated while there is data to send.
+*
 * <b>Receive Address Filtering</b>
 *
 * The device can be set to accept frames whose Identifiers match any of up to
@@ -127,6 +137,18 @@
 * If the incoming identifier passes through any acceptance filter then the
 * frame is stored in the RX FIFO.
 *
+* <b>Filter Manager</b>
+*
+* XCanFd_FilterMgr_Compile() turns a list of identifiers and identifier
+* ranges into acceptance filter mask/ID pairs. Ranges are split into aligned
+* blocks and blocks are merged while the result stays exact. If more filters
+* are needed than available, the closest pairs are merged into wider filters
+* and the blocks they absorb are kept in a software residue. The wanted
+* single IDs go into a hash table. XCanFd_FilterMgr_Apply() programs the
+* filters (Sequential Mode only). XCanFd_FilterMgr_Accept() then checks a
+* received frame, with software work only for those hitting a widened filter,
+* and extends the 16-bit hardware timestamp to 32 bits.
+*
 * <b>PHY Communication</b>
 *
 * This driver does not provide any mechanism for directly programming PHY.
@@ -214,6 +236,10 @@ exclusion
 *       ms   04/05/17 Added tabspace for return statements in functions
 *                     of canfd examples for proper documentation while
 *                     generating doxygen.
+*       ag   10/14/26 Added XCanFd_Recv_Sequential_Bulk() and
+*                     XCanFd_Send_Bulk().
+*                     Added the acceptance filter manager in xcanfd_filter.c
+*                     and XCanFd_GetRxTimestamp().
 * </pre>
 *
 ******************************************************************************/
@@ -259,6 +285,14 @@ extern "C" {
 #define XCANFD_HANDLER_EVENT  4 /**< Handler type for all other interrupts */
 /* @} */
 
+/** @name Filter manager limits
+ *  @{
+ */
+#define XCANFD_FM_MAX_BLOCKS	64	/**< Max ID blocks per rule set */
+#define XCANFD_FM_HASH_SIZE	128	/**< Software residue hash size,
+					  *  power of 2 */
+/* @} */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -337,6 +371,46 @@ typedef struct {
 
 }XCanFd;
 
+/*****************************************************************************/
+/**
+ * A filter rule given to XCanFd_FilterMgr_Compile(). It selects the range of
+ * identifiers IdLow to IdHigh, inclusive. Use IdLow == IdHigh for a single
+ * identifier.
+ */
+typedef struct {
+	u32 IdLow;		/**< First identifier of the range */
+	u32 IdHigh;		/**< Last identifier of the range */
+	u8 Extended;		/**< 1 for 29-bit, 0 for 11-bit identifiers */
+} XCanFd_FilterRule;
+
+/**
+ * A block of identifiers sharing the Care bits of Key, used by the filter
+ * manager for hardware filters and the software residue.
+ */
+typedef struct {
+	u32 Key;		/**< Identifier bits */
+	u32 Care;		/**< Bits of Key which must match */
+	u8 Extended;		/**< 1 for 29-bit, 0 for 11-bit identifiers */
+	u8 Exact;		/**< 1 if no unwanted identifier matches */
+} XCanFd_FilterBlock;
+
+/**
+ * The filter manager. It holds the hardware filters compiled from a list of
+ * rules, and the software residue used to reject the frames accepted by a
+ * hardware filter which had to be widened to fit the number of filters.
+ */
+typedef struct {
+	XCanFd_FilterBlock Hw[XCANFD_NOOF_AFR];	/**< Hardware filters */
+	u32 NumHw;			/**< Number of hardware filters used */
+	XCanFd_FilterBlock Blocks[XCANFD_FM_MAX_BLOCKS]; /**< Residue blocks
+						 *  of more than one ID */
+	u32 NumBlocks;			/**< Number of residue blocks */
+	u32 Hash[XCANFD_FM_HASH_SIZE];	/**< Residue single IDs */
+	u32 NumHashed;			/**< Number of hashed IDs */
+	u32 TsHigh;			/**< Upper bits of the Rx timestamp */
+	u32 TsLast;			/**< Last 16-bit Rx timestamp */
+} XCanFd_FilterMgr;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -491,6 +565,24 @@ typedef struct {
 	for (BufferNr = 0;BufferNr <= 31; BufferNr++) \
 		InstancePtr->FreeBuffStatus[BufferNr] = 0
 
+/****************************************************************************/
+/**
+*
+* This macro returns the 16-bit hardware timestamp of a received frame, taken
+* by the core at the start of frame.
+*
+* @param	FramePtr is a pointer to a frame read by one of the receive
+*		functions.
+*
+* @return	The timestamp, in CAN bit times.
+*
+* @note		C-Style signature:
+*		u32 XCanFd_GetRxTimestamp(u32 *FramePtr);
+*
+*****************************************************************************/
+#define XCanFd_GetRxTimestamp(FramePtr)	\
+		((FramePtr)[1] & XCANFD_DLCR_TIMESTAMP_MASK)
+
 /*****************************************************************************/
 /**
 * This macro Returns the TXBUFFER ID Offset
@@ -937,6 +1029,16 @@ u32 XCanFd_Set_MailBox_IdMask(XCanFd *InstancePtr, u32 RxBuffer,
 						u32 MaskValue, u32 IdValue);
 u32 XCanFd_Recv_Sequential(XCanFd *InstancePtr, u32 *FramePtr);
 u32 XCanFd_Recv_Mailbox(XCanFd *InstancePtr, u32 *FramePtr);
+u32 XCanFd_Recv_Sequential_Bulk(XCanFd *InstancePtr, u32 *FramePtr,
+						u32 MaxFrames);
+u32 XCanFd_Send_Bulk(XCanFd *InstancePtr, u32 *FramePtr, u32 NumFrames);
+
+/* Functions in xcanfd_filter.c */
+int XCanFd_FilterMgr_Compile(XCanFd_FilterMgr *MgrPtr,
+		XCanFd_FilterRule *RulePtr, u32 NumRules, u32 NumFilters);
+int XCanFd_FilterMgr_Apply(XCanFd *InstancePtr, XCanFd_FilterMgr *MgrPtr);
+u32 XCanFd_FilterMgr_Accept(XCanFd_FilterMgr *MgrPtr, u32 *FramePtr,
+						u32 *TimestampPtr);
 
 /* Functions in xcanfd_sinit.c */
 XCanFd_Config *XCanFd_LookupConfig(u16 Deviceid);
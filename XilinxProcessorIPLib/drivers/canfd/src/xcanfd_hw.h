@@ -873,6 +873,7 @@ Mask/Acceptance Filter ID)
  *  @{
  */
 #define XCANFD_FSR_FL_MASK	0x00003F00  /**< Fill Level Mask */
+#define XCANFD_FSR_FL_SHIFT	8	    /**< Fill Level Shift */
 #define XCANFD_FSR_RI_MASK	0x0000001F  /**< Read Index Mask */
 #define XCANFD_FSR_IRI_MASK	0x00000080  /**< Increment Read Index Mask */
 /* @} */
@@ -1155,6 +1156,10 @@ Mask/Acceptance Filter ID)
 #define XCANFD_MAX_FRAME_SIZE 72	/**< Maximum CAN frame length in bytes
 					 */
 #define XCANFD_DW_BYTES	4		/**< Data Word Bytes */
+#define XCANFD_MAX_FRAME_WORDS	(XCANFD_MAX_FRAME_SIZE / XCANFD_DW_BYTES)
+					/**< Maximum CAN frame length in
+					 *  words, stride of the frame arrays
+					 *  used by the bulk functions */
 #define XST_NOBUFFER	33L	/**< All Buffers (32) are filled */
 #define XST_BUFFER_ALREADY_FILLED	34L	/**< Given Buffer is Already
 						filled */
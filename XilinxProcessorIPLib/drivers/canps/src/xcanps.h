@@ -132,6 +132,18 @@
 * If the Accpetance Filters are not set up then all the received messages are
 * stroed in the RX FIFO.
 *
+* <b>Filter Manager</b>
+*
+* XCanPs_FilterMgr_Compile() turns a list of identifiers and identifier
+* ranges into acceptance filter mask/ID pairs. Ranges are split into aligned
+* blocks and blocks are merged while the result stays exact. If more than the
+* four filters are needed, the closest pairs are merged into wider filters
+* and the blocks they absorb are kept in a software residue, with the wanted
+* single IDs in a hash table. XCanPs_FilterMgr_Apply() programs the filters
+* and XCanPs_FilterMgr_Accept() checks a received frame, doing software work
+* only for frames hitting a widened filter. It also extends the 16-bit
+* hardware timestamp to 32 bits.
+*
 * <b>PHY Communication</b>
 *
 * This driver does not provide any mechanism for directly programming PHY.
@@ -206,6 +218,8 @@
 *			error interrupts correctly. CR#925615
 *     ms      03/17/17  Added readme.txt file in examples folder for doxygen
 *                       generation.
+*     ag      10/14/26  Added the acceptance filter manager in xcanps_filter.c
+*                       and XCanPs_GetRxTimestamp().
 * </pre>
 *
 ******************************************************************************/
@@ -243,6 +257,15 @@ extern "C" {
 #define XCANPS_HANDLER_EVENT  4U /**< Handler type for all other interrupts */
 /* @} */
 
+/** @name Filter manager limits
+ *  @{
+ */
+#define XCANPS_FM_NUM_FILTERS	4U	/**< Number of acceptance filters */
+#define XCANPS_FM_MAX_BLOCKS	64U	/**< Max ID blocks per rule set */
+#define XCANPS_FM_HASH_SIZE	128U	/**< Software residue hash size,
+					  *  power of 2 */
+/* @} */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -325,6 +348,46 @@ typedef struct {
 
 } XCanPs;
 
+/*****************************************************************************/
+/**
+ * A filter rule given to XCanPs_FilterMgr_Compile(). It selects the range of
+ * identifiers IdLow to IdHigh, inclusive. Use IdLow == IdHigh for a single
+ * identifier.
+ */
+typedef struct {
+	u32 IdLow;		/**< First identifier of the range */
+	u32 IdHigh;		/**< Last identifier of the range */
+	u8 Extended;		/**< 1 for 29-bit, 0 for 11-bit identifiers */
+} XCanPs_FilterRule;
+
+/**
+ * A block of identifiers sharing the Care bits of Key, used by the filter
+ * manager for hardware filters and the software residue.
+ */
+typedef struct {
+	u32 Key;		/**< Identifier bits */
+	u32 Care;		/**< Bits of Key which must match */
+	u8 Extended;		/**< 1 for 29-bit, 0 for 11-bit identifiers */
+	u8 Exact;		/**< 1 if no unwanted identifier matches */
+} XCanPs_FilterBlock;
+
+/**
+ * The filter manager. It holds the hardware filters compiled from a list of
+ * rules, and the software residue used to reject the frames accepted by a
+ * hardware filter which had to be widened to fit the number of filters.
+ */
+typedef struct {
+	XCanPs_FilterBlock Hw[XCANPS_FM_NUM_FILTERS]; /**< Hardware filters */
+	u32 NumHw;			/**< Number of hardware filters used */
+	XCanPs_FilterBlock Blocks[XCANPS_FM_MAX_BLOCKS]; /**< Residue blocks
+						 *  of more than one ID */
+	u32 NumBlocks;			/**< Number of residue blocks */
+	u32 Hash[XCANPS_FM_HASH_SIZE];	/**< Residue single IDs */
+	u32 NumHashed;			/**< Number of hashed IDs */
+	u32 TsHigh;			/**< Upper bits of the Rx timestamp */
+	u32 TsLast;			/**< Last 16-bit Rx timestamp */
+} XCanPs_FilterMgr;
+
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -508,6 +571,23 @@ typedef struct {
 	XCanPs_WriteReg((InstancePtr)->CanConfig.BaseAddr, 		\
 				XCANPS_TCR_OFFSET, XCANPS_TCR_CTS_MASK)
 
+/****************************************************************************/
+/**
+*
+* This macro returns the 16-bit hardware timestamp of a received frame, taken
+* by the core at the start of frame.
+*
+* @param	FramePtr is a pointer to a frame read by XCanPs_Recv().
+*
+* @return	The timestamp, in CAN bit times.
+*
+* @note		C-Style signature:
+*		u32 XCanPs_GetRxTimestamp(u32 *FramePtr);
+*
+*****************************************************************************/
+#define XCanPs_GetRxTimestamp(FramePtr)	\
+		((FramePtr)[1] & XCANPS_DLCR_TIMESTAMP_MASK)
+
 /************************** Function Prototypes ******************************/
 
 /*
@@ -564,6 +644,15 @@ void XCanPs_IntrHandler(void *InstancePtr);
 s32 XCanPs_SetHandler(XCanPs *InstancePtr, u32 HandlerType,
 			void *CallBackFunc, void *CallBackRef);
 
+/*
+ * Functions in xcanps_filter.c
+ */
+s32 XCanPs_FilterMgr_Compile(XCanPs_FilterMgr *MgrPtr,
+		XCanPs_FilterRule *RulePtr, u32 NumRules, u32 NumFilters);
+s32 XCanPs_FilterMgr_Apply(XCanPs *InstancePtr, XCanPs_FilterMgr *MgrPtr);
+u32 XCanPs_FilterMgr_Accept(XCanPs_FilterMgr *MgrPtr, u32 *FramePtr,
+				u32 *TimestampPtr);
+
 /*
  * Functions in xcanps_sinit.c
  */
@@ -0,0 +1,630 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xcanps_filter.c
+* @addtogroup canps_v3_2
+* @{
+*
+* This file contains the acceptance filter manager of the XCanPs driver. It
+* compiles a list of wanted identifiers and identifier ranges into the
+* acceptance filter mask/ID registers, keeps a software residue for the
+* frames accepted by widened filters and extends the Rx timestamps.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date      Changes
+* ----- ---- --------- -------------------------------------------------------
+* 3.2   ag   10/14/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xcanps.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XCANPS_FM_STD_MASK	0x000007FFU	/* 11-bit identifier */
+#define XCANPS_FM_EXT_MASK	0x1FFFFFFFU	/* 29-bit identifier */
+#define XCANPS_FM_EXT_ID2_BITS	18U		/* Low bits in ID2 */
+#define XCANPS_FM_EXT_FLAG	0x80000000U	/* Extended flag in hash */
+#define XCANPS_FM_HASH_EMPTY	0xFFFFFFFFU	/* Unused hash entry */
+#define XCANPS_FM_TS_WRAP	0x00010000U	/* Timestamp counter wrap */
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*
+ * Mask of the identifier bits for a block.
+ */
+#define XCanPs_FmIdMask(Extended) \
+	((Extended) ? XCANPS_FM_EXT_MASK : XCANPS_FM_STD_MASK)
+
+/*
+ * Checks whether an identifier is inside a block.
+ */
+#define XCanPs_FmMatch(BlockPtr, Key, Extended) \
+	(((BlockPtr)->Extended == (Extended)) && \
+	 ((((Key) ^ (BlockPtr)->Key) & (BlockPtr)->Care) == 0U))
+
+/************************** Function Prototypes ******************************/
+
+static s32 XCanPs_FmSplitRange(XCanPs_FilterMgr *MgrPtr,
+				XCanPs_FilterRule *RulePtr);
+static void XCanPs_FmMergeExact(XCanPs_FilterMgr *MgrPtr);
+static s32 XCanPs_FmReduce(XCanPs_FilterMgr *MgrPtr, u32 NumFilters);
+static void XCanPs_FmAddResidue(XCanPs_FilterMgr *MgrPtr,
+				XCanPs_FilterBlock *BlockPtr);
+static u32 XCanPs_FmHashIndex(u32 Entry);
+static u32 XCanPs_FmPopCount(u32 Value);
+
+/************************** Variable Definitions *****************************/
+
+
+/*****************************************************************************/
+/**
+*
+* This function compiles a list of identifier rules into at most NumFilters
+* acceptance filters. Each range is split into blocks of identifiers that
+* differ only in their low bits, then blocks that differ in a single bit are
+* merged, which keeps the filters exact. If more than NumFilters blocks are
+* left, the pair of blocks whose merge keeps the most identifier bits is
+* merged into a wider filter until the blocks fit. The blocks absorbed by a
+* widened filter form the software residue checked by
+* XCanPs_FilterMgr_Accept().
+*
+* @param	MgrPtr is a pointer to the filter manager to fill.
+* @param	RulePtr is a pointer to an array of NumRules rules.
+* @param	NumRules is the number of rules, at least one.
+* @param	NumFilters is the number of acceptance filters to use, from 1
+*		to XCANPS_FM_NUM_FILTERS.
+*
+* @return	- XST_SUCCESS if the rules were compiled.
+*		- XST_INVALID_PARAM if a rule has an invalid range.
+*		- XST_BUFFER_TOO_SMALL if the rules split into more than
+*		XCANPS_FM_MAX_BLOCKS blocks.
+*		- XST_FAILURE if standard and extended rules need more filters
+*		than NumFilters.
+*
+* @note		The timestamp extension state is reset.
+*
+******************************************************************************/
+s32 XCanPs_FilterMgr_Compile(XCanPs_FilterMgr *MgrPtr,
+		XCanPs_FilterRule *RulePtr, u32 NumRules, u32 NumFilters)
+{
+	u32 Index;
+	s32 Status;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(RulePtr != NULL);
+	Xil_AssertNonvoid(NumRules > 0U);
+	Xil_AssertNonvoid((NumFilters > 0U) && (NumFilters <= XCANPS_FM_NUM_FILTERS));
+
+	MgrPtr->NumHw = 0U;
+	MgrPtr->NumBlocks = 0U;
+	MgrPtr->NumHashed = 0U;
+	MgrPtr->TsHigh = 0U;
+	MgrPtr->TsLast = 0U;
+	for (Index = 0U; Index < XCANPS_FM_HASH_SIZE; Index++) {
+		MgrPtr->Hash[Index] = XCANPS_FM_HASH_EMPTY;
+	}
+
+	/*
+	 * Split the ranges into aligned blocks, built in Blocks[].
+	 */
+	for (Index = 0U; Index < NumRules; Index++) {
+		Status = XCanPs_FmSplitRange(MgrPtr, &RulePtr[Index]);
+		if (Status != XST_SUCCESS) {
+			MgrPtr->NumBlocks = 0U;
+			return Status;
+		}
+	}
+
+	XCanPs_FmMergeExact(MgrPtr);
+
+	/*
+	 * The exact blocks are the hardware filters if they fit.
+	 */
+	if (MgrPtr->NumBlocks <= NumFilters) {
+		for (Index = 0U; Index < MgrPtr->NumBlocks; Index++) {
+			MgrPtr->Hw[Index] = MgrPtr->Blocks[Index];
+		}
+		MgrPtr->NumHw = MgrPtr->NumBlocks;
+		MgrPtr->NumBlocks = 0U;
+		return XST_SUCCESS;
+	}
+
+	Status = XCanPs_FmReduce(MgrPtr, NumFilters);
+	if (Status != XST_SUCCESS) {
+		MgrPtr->NumHw = 0U;
+		MgrPtr->NumBlocks = 0U;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs the acceptance filters compiled by
+* XCanPs_FilterMgr_Compile(). All the filters are disabled while the mask/ID
+* registers are written, then the used filters are enabled.
+*
+* @param	InstancePtr is a pointer to the XCanPs instance.
+* @param	MgrPtr is a pointer to a compiled filter manager.
+*
+* @return	- XST_SUCCESS if the filters were programmed.
+*		- XST_FAILURE if nothing was compiled or the filters could
+*		not be written.
+*
+* @note		Frames received while the filters are disabled are not
+*		filtered.
+*
+******************************************************************************/
+s32 XCanPs_FilterMgr_Apply(XCanPs *InstancePtr, XCanPs_FilterMgr *MgrPtr)
+{
+	XCanPs_FilterBlock *BlockPtr;
+	u32 Index;
+	u32 MaskValue;
+	u32 IdValue;
+	u32 Enable = 0U;
+	s32 Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MgrPtr != NULL);
+
+	if (MgrPtr->NumHw == 0U) {
+		Status = XST_FAILURE;
+	} else {
+		XCanPs_AcceptFilterDisable(InstancePtr, XCANPS_AFR_UAF_ALL_MASK);
+
+		/*
+		 * Wait for the device to accept writes to AFMR and AFIR.
+		 */
+		while (XCanPs_IsAcceptFilterBusy(InstancePtr) == TRUE) {
+			;
+		}
+
+		for (Index = 0U; Index < MgrPtr->NumHw; Index++) {
+			BlockPtr = &MgrPtr->Hw[Index];
+
+			if (BlockPtr->Extended != 0U) {
+				IdValue = XCanPs_CreateIdValue(
+					BlockPtr->Key >> XCANPS_FM_EXT_ID2_BITS,
+					1U, 1U, BlockPtr->Key, 0U);
+				MaskValue = XCanPs_CreateIdValue(
+					BlockPtr->Care >> XCANPS_FM_EXT_ID2_BITS,
+					0U, 1U, BlockPtr->Care, 0U);
+			} else {
+				IdValue = XCanPs_CreateIdValue(BlockPtr->Key,
+					0U, 0U, 0U, 0U);
+				MaskValue = XCanPs_CreateIdValue(BlockPtr->Care,
+					0U, 1U, 0U, 0U);
+			}
+
+			/* UAF1 to UAF4 are bits 0 to 3 */
+			Status = XCanPs_AcceptFilterSet(InstancePtr,
+					(u32)1U << Index, MaskValue, IdValue);
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+			Enable |= (u32)1U << Index;
+		}
+
+		XCanPs_AcceptFilterEnable(InstancePtr, Enable);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks whether a frame accepted by the hardware filters is
+* wanted by the rules, and extends its 16-bit timestamp. Frames matching an
+* exact hardware filter are accepted at once. Only the frames matching a
+* widened filter are looked up in the software residue.
+*
+* @param	InstancePtr is a pointer to the filter manager used to program
+*		the acceptance filters.
+* @param	FramePtr is a pointer to a frame read by one of the receive
+*		functions.
+* @param	TimestampPtr is a pointer to store the 32-bit timestamp of the
+*		frame. It can be NULL.
+*
+* @return	TRUE if the frame is wanted, FALSE otherwise.
+*
+* @note		The timestamp extension assumes the frames are passed in the
+*		order they were received, at least once per wrap of the 16-bit
+*		timestamp counter. Pass every received frame, including the
+*		rejected ones, to keep it accurate.
+*
+******************************************************************************/
+u32 XCanPs_FilterMgr_Accept(XCanPs_FilterMgr *MgrPtr, u32 *FramePtr,
+						u32 *TimestampPtr)
+{
+	XCanPs_FilterBlock *BlockPtr;
+	u32 IdReg;
+	u32 Key;
+	u32 Entry;
+	u32 Slot;
+	u32 Stamp;
+	u8 Extended;
+	u32 Index;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	/*
+	 * Extend the timestamp, a smaller value than the last one means
+	 * the counter has wrapped.
+	 */
+	Stamp = XCanPs_GetRxTimestamp(FramePtr);
+	if (Stamp < MgrPtr->TsLast) {
+		MgrPtr->TsHigh += XCANPS_FM_TS_WRAP;
+	}
+	MgrPtr->TsLast = Stamp;
+	if (TimestampPtr != NULL) {
+		*TimestampPtr = MgrPtr->TsHigh | Stamp;
+	}
+
+	IdReg = FramePtr[0];
+	if (IdReg & XCANPS_IDR_IDE_MASK) {
+		Extended = 1;
+		Key = (((IdReg & XCANPS_IDR_ID1_MASK) >> XCANPS_IDR_ID1_SHIFT) <<
+				XCANPS_FM_EXT_ID2_BITS) |
+		      ((IdReg & XCANPS_IDR_ID2_MASK) >> XCANPS_IDR_ID2_SHIFT);
+	} else {
+		Extended = 0;
+		Key = (IdReg & XCANPS_IDR_ID1_MASK) >> XCANPS_IDR_ID1_SHIFT;
+	}
+
+	for (Index = 0U; Index < MgrPtr->NumHw; Index++) {
+		BlockPtr = &MgrPtr->Hw[Index];
+		if ((BlockPtr->Exact != 0U) &&
+			XCanPs_FmMatch(BlockPtr, Key, Extended)) {
+			return TRUE;
+		}
+	}
+
+	/*
+	 * Residue: single IDs in the hash table, then the wider blocks.
+	 */
+	if (MgrPtr->NumHashed != 0U) {
+		Entry = Extended ? (Key | XCANPS_FM_EXT_FLAG) : Key;
+		Slot = XCanPs_FmHashIndex(Entry);
+		while (MgrPtr->Hash[Slot] != XCANPS_FM_HASH_EMPTY) {
+			if (MgrPtr->Hash[Slot] == Entry) {
+				return TRUE;
+			}
+			Slot = (Slot + 1) & (XCANPS_FM_HASH_SIZE - 1);
+		}
+	}
+
+	for (Index = 0U; Index < MgrPtr->NumBlocks; Index++) {
+		if (XCanPs_FmMatch(&MgrPtr->Blocks[Index], Key, Extended)) {
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Splits a rule into the minimum number of aligned power of two blocks and
+* appends them to the block list.
+*
+* @param	MgrPtr is a pointer to the filter manager.
+* @param	RulePtr is a pointer to the rule.
+*
+* @return	XST_SUCCESS, XST_INVALID_PARAM or XST_BUFFER_TOO_SMALL.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XCanPs_FmSplitRange(XCanPs_FilterMgr *MgrPtr,
+				XCanPs_FilterRule *RulePtr)
+{
+	XCanPs_FilterBlock *BlockPtr;
+	u32 IdMask = XCanPs_FmIdMask(RulePtr->Extended);
+	u32 Low = RulePtr->IdLow;
+	u32 Size;
+
+	if ((Low > RulePtr->IdHigh) || (RulePtr->IdHigh > IdMask)) {
+		return XST_INVALID_PARAM;
+	}
+
+	while (Low <= RulePtr->IdHigh) {
+		/*
+		 * Largest block aligned on Low which does not pass IdHigh.
+		 */
+		Size = 1U;
+		while (((Low & ((Size << 1) - 1)) == 0) &&
+			((Low + (Size << 1) - 1) <= RulePtr->IdHigh) &&
+			((Size << 1) <= (IdMask + 1))) {
+			Size <<= 1;
+		}
+
+		if (MgrPtr->NumBlocks == XCANPS_FM_MAX_BLOCKS) {
+			return XST_BUFFER_TOO_SMALL;
+		}
+		BlockPtr = &MgrPtr->Blocks[MgrPtr->NumBlocks];
+		BlockPtr->Key = Low;
+		BlockPtr->Care = IdMask & ~(Size - 1);
+		BlockPtr->Extended = RulePtr->Extended ? 1 : 0;
+		BlockPtr->Exact = 1;
+		MgrPtr->NumBlocks++;
+
+		Low += Size;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Removes the blocks contained in another block and merges the pairs of
+* blocks with the same care bits whose keys differ in one care bit, until no
+* more exact merge is possible.
+*
+* @param	MgrPtr is a pointer to the filter manager.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanPs_FmMergeExact(XCanPs_FilterMgr *MgrPtr)
+{
+	XCanPs_FilterBlock *APtr;
+	XCanPs_FilterBlock *BPtr;
+	u32 Diff;
+	u32 Index;
+	u32 Other;
+	u32 Changed;
+
+	do {
+		Changed = FALSE;
+		for (Index = 0U; Index < MgrPtr->NumBlocks; Index++) {
+			APtr = &MgrPtr->Blocks[Index];
+			for (Other = Index + 1; Other < MgrPtr->NumBlocks;
+								Other++) {
+				BPtr = &MgrPtr->Blocks[Other];
+				if (APtr->Extended != BPtr->Extended) {
+					continue;
+				}
+
+				Diff = APtr->Key ^ BPtr->Key;
+				if (((BPtr->Care & APtr->Care) == APtr->Care) &&
+					((Diff & APtr->Care) == 0U)) {
+					/* B is inside A */
+				} else if (((APtr->Care & BPtr->Care) ==
+						BPtr->Care) &&
+						((Diff & BPtr->Care) == 0U)) {
+					/* A is inside B */
+					*APtr = *BPtr;
+				} else if ((APtr->Care == BPtr->Care) &&
+						((Diff & APtr->Care) == Diff) &&
+						((Diff & (Diff - 1)) == 0U)) {
+					/* Neighbours, one bit apart */
+					APtr->Care &= ~Diff;
+					APtr->Key &= APtr->Care;
+				} else {
+					continue;
+				}
+
+				/* Drop B, keep scanning from A again */
+				MgrPtr->NumBlocks--;
+				*BPtr = MgrPtr->Blocks[MgrPtr->NumBlocks];
+				Changed = TRUE;
+				Other = Index;
+			}
+		}
+	} while (Changed == TRUE);
+}
+
+/*****************************************************************************/
+/**
+*
+* Reduces the hardware filters to NumFilters by merging, each time, the pair
+* of filters of the same identifier type whose merge keeps the most care
+* bits. The exact blocks absorbed move to the software residue.
+*
+* @param	MgrPtr is a pointer to the filter manager, with the exact
+*		blocks in Blocks[].
+* @param	NumFilters is the number of hardware filters available.
+*
+* @return	XST_SUCCESS, or XST_FAILURE if no pair can be merged.
+*
+* @note		Blocks[] is reused for the residue, the exact blocks are
+*		copied to a work array on the stack first.
+*
+******************************************************************************/
+static s32 XCanPs_FmReduce(XCanPs_FilterMgr *MgrPtr, u32 NumFilters)
+{
+	XCanPs_FilterBlock Exact[XCANPS_FM_MAX_BLOCKS];
+	XCanPs_FilterBlock *APtr;
+	XCanPs_FilterBlock *BPtr;
+	u32 NumExact = MgrPtr->NumBlocks;
+	u32 NumHw;
+	u32 Index;
+	u32 Other;
+	u32 Care;
+	u32 Bits;
+	u32 BestBits;
+	u32 BestA = 0U;
+	u32 BestB = 0U;
+
+	for (Index = 0U; Index < NumExact; Index++) {
+		Exact[Index] = MgrPtr->Blocks[Index];
+	}
+	NumHw = NumExact;
+	MgrPtr->NumBlocks = 0U;
+
+	while (NumHw > NumFilters) {
+		BestBits = 0U;
+		for (Index = 0U; Index < NumHw; Index++) {
+			APtr = &Exact[Index];
+			for (Other = Index + 1; Other < NumHw; Other++) {
+				BPtr = &Exact[Other];
+				if (APtr->Extended != BPtr->Extended) {
+					continue;
+				}
+				Care = APtr->Care & BPtr->Care &
+					~(APtr->Key ^ BPtr->Key);
+				Bits = XCanPs_FmPopCount(Care) + 1;
+				if (Bits > BestBits) {
+					BestBits = Bits;
+					BestA = Index;
+					BestB = Other;
+				}
+			}
+		}
+
+		if (BestBits == 0U) {
+			return XST_FAILURE;
+		}
+
+		APtr = &Exact[BestA];
+		BPtr = &Exact[BestB];
+		XCanPs_FmAddResidue(MgrPtr, APtr);
+		XCanPs_FmAddResidue(MgrPtr, BPtr);
+
+		APtr->Care &= BPtr->Care & ~(APtr->Key ^ BPtr->Key);
+		APtr->Key &= APtr->Care;
+		APtr->Exact = 0;
+
+		NumHw--;
+		*BPtr = Exact[NumHw];
+	}
+
+	for (Index = 0U; Index < NumHw; Index++) {
+		MgrPtr->Hw[Index] = Exact[Index];
+	}
+	MgrPtr->NumHw = NumHw;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Moves an exact block absorbed by a widened filter to the software residue,
+* in the hash table for a single identifier or in the block list otherwise.
+* Blocks already absorbed by an earlier merge are ignored.
+*
+* @param	MgrPtr is a pointer to the filter manager.
+* @param	BlockPtr is a pointer to the block.
+*
+* @return	None.
+*
+* @note		The residue cannot overflow, it holds at most one entry per
+*		compiled block.
+*
+******************************************************************************/
+static void XCanPs_FmAddResidue(XCanPs_FilterMgr *MgrPtr,
+				XCanPs_FilterBlock *BlockPtr)
+{
+	u32 Entry;
+	u32 Slot;
+
+	if (BlockPtr->Exact == 0U) {
+		return;
+	}
+
+	if (BlockPtr->Care == XCanPs_FmIdMask(BlockPtr->Extended)) {
+		Entry = BlockPtr->Extended ?
+			(BlockPtr->Key | XCANPS_FM_EXT_FLAG) : BlockPtr->Key;
+		Slot = XCanPs_FmHashIndex(Entry);
+		while (MgrPtr->Hash[Slot] != XCANPS_FM_HASH_EMPTY) {
+			Slot = (Slot + 1) & (XCANPS_FM_HASH_SIZE - 1);
+		}
+		MgrPtr->Hash[Slot] = Entry;
+		MgrPtr->NumHashed++;
+	} else {
+		MgrPtr->Blocks[MgrPtr->NumBlocks] = *BlockPtr;
+		MgrPtr->NumBlocks++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the hash table slot of an identifier, multiplicative hashing.
+*
+* @param	Entry is the identifier, with XCANPS_FM_EXT_FLAG for 29-bit
+*		identifiers.
+*
+* @return	The hash table slot.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XCanPs_FmHashIndex(u32 Entry)
+{
+	return ((Entry * 0x9E3779B1U) >> 16) & (XCANPS_FM_HASH_SIZE - 1);
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the number of bits set in a value.
+*
+* @param	Value is the value.
+*
+* @return	The number of bits set.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XCanPs_FmPopCount(u32 Value)
+{
+	u32 Count = 0U;
+
+	while (Value != 0U) {
+		Value &= Value - 1U;
+		Count++;
+	}
+
+	return Count;
+}
+/** @} */
@@ -48,6 +48,8 @@
 * 1.1 siv 8/17/16 Used UINTPTR instead of u32 for Baseaddress
 * 	Changed the prototype of XClk_Wiz_CfgInitialize
 * 1.2 ms  3/02/17 Fixed compilation warnings. Fix for CR-970507.
+*     ag  10/14/26 Set the default divider search limits and clear the
+*                  rate cache in XClk_Wiz_CfgInitialize.
 * </pre>
 ******************************************************************************/
 
@@ -56,6 +58,7 @@
 #include "xparameters.h"
 #include "xstatus.h"
 #include "xclk_wiz.h"
+#include <string.h>
 
 /************************** Constant Definitions *****************************/
 
@@ -119,6 +122,19 @@ u32 XClk_Wiz_CfgInitialize(XClk_Wiz *InstancePtr, XClk_Wiz_Config *CfgPtr,
 
 	InstancePtr->ErrorCallBack = StubErrCallBack;
 
+	/* UltraScale+ MMCM limits, the input frequency is set by the user */
+	InstancePtr->Limits.InputFreq = 0.0;
+	InstancePtr->Limits.VcoMinFreq = 800.0;
+	InstancePtr->Limits.VcoMaxFreq = 1600.0;
+	InstancePtr->Limits.PfdMinFreq = 10.0;
+	InstancePtr->Limits.PfdMaxFreq = 500.0;
+	InstancePtr->Limits.MultMax = 128U;
+	InstancePtr->Limits.DivMax = 106U;
+	InstancePtr->Limits.OutDivMax = 128U;
+	InstancePtr->Limits.FracEnable = 1U;
+	(void)memset(InstancePtr->RateCache, 0, sizeof(InstancePtr->RateCache));
+	InstancePtr->RateCacheNext = 0U;
+
 	InstancePtr->IsReady = (u32)(XIL_COMPONENT_IS_READY);
 
 	return XST_SUCCESS;
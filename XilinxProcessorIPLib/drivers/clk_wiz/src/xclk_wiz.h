@@ -104,6 +104,9 @@
 *                  and warnings in xclk_wiz.c files. Fix for CR-970507.
 *     ms  03/17/17 Added readme.txt file in examples folder for doxygen
 *                  generation.
+*     ag  10/14/26 Added XClk_Wiz_SetRate and related functions computing
+*                  the MMCM/PLL dividers for an output frequency, with a
+*                  cache of computed settings.
 * </pre>
 *
 ******************************************************************************/
@@ -137,6 +140,23 @@ extern "C" {
 
 /*@}*/
 
+/** @name Flags for XClk_Wiz_CalcRate and XClk_Wiz_SetRate
+ * @{
+ */
+#define XCLK_WIZ_RATE_KEEP_VCO		0x00000001 /**< Only change the output
+						     divider, the other
+						     outputs keep their
+						     frequency */
+/*@}*/
+
+#ifndef XCLK_WIZ_RATE_CACHE_SIZE
+#define XCLK_WIZ_RATE_CACHE_SIZE	8  /**< Settings kept by
+					     XClk_Wiz_SetRate */
+#endif
+
+#define XCLK_WIZ_LOCK_TIMEOUT		1000000 /**< Status reads waiting
+						  for lock */
+
 /*****************************************************************************/
 /**
 * The configuration structure for CLK_WIZ Controller
@@ -182,6 +202,46 @@ typedef struct {
  *****************************************************************************/
 typedef void (*XClk_Wiz_CallBack) (void *CallBackRef, u32 Mask);
 
+/**
+* Limits of the MMCM/PLL used by the divider search, see XClk_Wiz_SetLimits.
+* The defaults set by XClk_Wiz_CfgInitialize are for an UltraScale+ MMCM,
+* the input frequency has to be set by the application.
+*/
+typedef struct {
+	double InputFreq;	/**< Input clock frequency in MHz */
+	double VcoMinFreq;	/**< Minimum VCO frequency in MHz */
+	double VcoMaxFreq;	/**< Maximum VCO frequency in MHz */
+	double PfdMinFreq;	/**< Minimum phase detector frequency in MHz */
+	double PfdMaxFreq;	/**< Maximum phase detector frequency in MHz */
+	u32 MultMax;		/**< Maximum feedback multiplier M */
+	u32 DivMax;		/**< Maximum input divider D */
+	u32 OutDivMax;		/**< Maximum output divider O */
+	u32 FracEnable;		/**< Fractional M and output 0 divider are
+				  *  allowed, MMCM only */
+} XClk_Wiz_Limits;
+
+/**
+* Divider settings for one output frequency. Settings can be computed once
+* with XClk_Wiz_CalcRate and applied later with XClk_Wiz_ApplyRate.
+*/
+typedef struct {
+	u32 Output;	/**< Output clock, 0 to XCLK_WIZ_MAX_OUTPUTS - 1 */
+	u32 Mult;	/**< Feedback multiplier M in 1/8 steps */
+	u32 Div;	/**< Input divider D */
+	u32 OutDiv;	/**< Output divider O in 1/8 steps */
+	double Freq;	/**< Resulting output frequency in MHz */
+} XClk_Wiz_Rate;
+
+/**
+* Cached result of a divider search
+*/
+typedef struct {
+	double ReqFreq;		/**< Requested frequency in MHz */
+	u32 Flags;		/**< XCLK_WIZ_RATE_* flags of the request */
+	u32 IsValid;		/**< Entry is in use */
+	XClk_Wiz_Rate Rate;	/**< Computed settings */
+} XClk_Wiz_RateEntry;
+
 /**
 * The XClk_Wiz driver instance data.
 * An instance must be allocated for each CLK_WIZ in use.
@@ -211,6 +271,11 @@ typedef struct {
 					   *  for rest all errors */
 	void *ErrRef; /**< To be passed to the Error Call back */
 	u32 IsReady; /**< Driver is ready */
+	XClk_Wiz_Limits Limits; /**< MMCM/PLL limits for the divider
+				  *  search */
+	XClk_Wiz_RateEntry RateCache[XCLK_WIZ_RATE_CACHE_SIZE];
+				/**< Settings computed by XClk_Wiz_SetRate */
+	u32 RateCacheNext;	/**< Next cache entry to replace */
 } XClk_Wiz;
 
 /************************** Macros Definitions *******************************/
@@ -426,6 +491,17 @@ void XClk_Wiz_GetInterruptSettings(XClk_Wiz  *InstancePtr);
 int XClk_Wiz_SetCallBack(XClk_Wiz *InstancePtr, u32 HandleType,
 			void *CallBackFunc, void *CallBackRef);
 
+/* Dynamic reconfiguration functions in xclk_wiz_rate.c */
+void XClk_Wiz_GetLimits(XClk_Wiz *InstancePtr, XClk_Wiz_Limits *LimitsPtr);
+void XClk_Wiz_SetLimits(XClk_Wiz *InstancePtr,
+			const XClk_Wiz_Limits *LimitsPtr);
+int XClk_Wiz_CalcRate(XClk_Wiz *InstancePtr, u32 Output, double Freq,
+			u32 Flags, XClk_Wiz_Rate *RatePtr);
+int XClk_Wiz_ApplyRate(XClk_Wiz *InstancePtr, const XClk_Wiz_Rate *RatePtr);
+int XClk_Wiz_SetRate(XClk_Wiz *InstancePtr, u32 Output, double Freq,
+			u32 Flags);
+int XClk_Wiz_WaitForLock(XClk_Wiz *InstancePtr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,7 @@
  * Ver Who Date     Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.0 ram 02/12/16 Initial version for Clock Wizard
+ * 1.2 ag  10/14/26 Added dynamic reconfiguration registers
  * </pre>
  *
  *****************************************************************************/
@@ -67,11 +68,55 @@ extern "C" {
  *  @{
  */
 
+#define XCLK_WIZ_SRR_OFFSET	0x00000000  /**< Software Reset Register */
+#define XCLK_WIZ_STATUS_OFFSET	0x00000004  /**< Status Register */
 #define XCLK_WIZ_ISR_OFFSET	0x0000000C  /**< Interrupt Status Register */
 #define XCLK_WIZ_IER_OFFSET	0x00000010  /**< Interrupt Enable Register */
+#define XCLK_WIZ_CFG0_OFFSET	0x00000200  /**< Clock Configuration
+						Register 0, M and D */
+#define XCLK_WIZ_RECONFIG_OFFSET 0x0000025C /**< Clock Configuration
+						Register 23, load */
 
 /*@}*/
 
+/**
+ * Divide register of output clock n, 0 to XCLK_WIZ_MAX_OUTPUTS - 1. The
+ * phase and duty cycle registers of an output follow it.
+ */
+#define XCLK_WIZ_OUT_DIV_OFFSET(n)	(0x00000208 + ((u32)(n) * 12U))
+
+#define XCLK_WIZ_MAX_OUTPUTS		7   /**< Number of output clocks */
+
+/** @name Bitmasks and offsets of the dynamic reconfiguration registers
+ * @{
+ */
+#define XCLK_WIZ_STATUS_LOCKED_MASK	0x00000001  /**< MMCM/PLL locked */
+#define XCLK_WIZ_SRR_RESET_VALUE	0x0000000A  /**< Software reset key */
+
+#define XCLK_WIZ_CFG0_DIV_MASK		0x000000FF  /**< Input divider D */
+#define XCLK_WIZ_CFG0_DIV_SHIFT		0
+#define XCLK_WIZ_CFG0_MULT_MASK		0x0000FF00  /**< Feedback multiplier
+							M, integer part */
+#define XCLK_WIZ_CFG0_MULT_SHIFT	8
+#define XCLK_WIZ_CFG0_MULT_FRAC_MASK	0x03FF0000  /**< M fractional part
+							in 1/1000 */
+#define XCLK_WIZ_CFG0_MULT_FRAC_SHIFT	16
+#define XCLK_WIZ_CFG0_MULT_FRAC_EN_MASK	0x04000000  /**< M fraction enable */
+
+#define XCLK_WIZ_OUT_DIV_MASK		0x000000FF  /**< Output divider O,
+							integer part */
+#define XCLK_WIZ_OUT_DIV_SHIFT		0
+#define XCLK_WIZ_OUT_DIV_FRAC_MASK	0x0003FF00  /**< O fractional part in
+							1/1000, output 0 */
+#define XCLK_WIZ_OUT_DIV_FRAC_SHIFT	8
+#define XCLK_WIZ_OUT_DIV_FRAC_EN_MASK	0x00040000  /**< O fraction enable */
+
+#define XCLK_WIZ_RECONFIG_LOAD_MASK	0x00000001  /**< Load the settings */
+#define XCLK_WIZ_RECONFIG_SADDR_MASK	0x00000002  /**< Use the register
+							settings, not the
+							defaults */
+/*@}*/
+
 /** @name Bitmasks and offsets of XCLK_WIZ_ISR_OFFSET register
  * This register is used to display interrupt status register
  * @{
@@ -0,0 +1,516 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xclk_wiz_rate.c
+* @addtogroup clk_wiz_v1_2
+* @{
+*
+* This file implements the dynamic reconfiguration of the Clocking Wizard.
+* XClk_Wiz_CalcRate searches the input divider D, feedback multiplier M and
+* output divider O for a requested output frequency within the MMCM/PLL
+* limits. M and the divider of output 0 may be fractional in 1/8 steps on
+* an MMCM. XClk_Wiz_SetRate keeps the last XCLK_WIZ_RATE_CACHE_SIZE results,
+* so switching between a set of frequencies does not repeat the search.
+*
+* M and D are shared by all outputs. With XCLK_WIZ_RATE_KEEP_VCO only the
+* divider of the requested output is changed, so the other outputs keep
+* their frequency.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver Who Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.2 ag  10/14/26 Initial version
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xparameters.h"
+#include "xstatus.h"
+#include "xclk_wiz_hw.h"
+#include "xclk_wiz.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XCLK_WIZ_FRAC_STEPS	8U	/* Fractional steps of M and O */
+#define XCLK_WIZ_FRAC_UNIT	125U	/* One step in register units */
+#define XCLK_WIZ_MULT_MIN	2U
+#define XCLK_WIZ_FRAC_OUT_DIV_MIN	2U	/* Fractional O starts at 2 */
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Macros Definitions *******************************/
+
+
+/************************** Function Prototypes ******************************/
+
+static u32 XClk_Wiz_Round(double Value);
+static double XClk_Wiz_Diff(double A, double B);
+static u32 XClk_Wiz_CalcOutDiv(const XClk_Wiz *InstancePtr, u32 Output,
+				double Vco, double Freq);
+static void XClk_Wiz_ReadMultDiv(const XClk_Wiz *InstancePtr, u32 *MultPtr,
+				u32 *DivPtr);
+
+/************************** Variable Definitions *****************************/
+
+
+/*****************************************************************************/
+/**
+* Rounds a non negative value to the nearest integer.
+*
+* @param	Value is the value to round
+*
+* @return	Rounded value
+*
+******************************************************************************/
+static u32 XClk_Wiz_Round(double Value)
+{
+	return (u32)(Value + 0.5);
+}
+
+/*****************************************************************************/
+/**
+* Returns the absolute difference of two frequencies.
+*
+* @param	A is the first frequency
+* @param	B is the second frequency
+*
+* @return	Absolute difference
+*
+******************************************************************************/
+static double XClk_Wiz_Diff(double A, double B)
+{
+	return (A > B) ? (A - B) : (B - A);
+}
+
+/*****************************************************************************/
+/**
+* Computes the output divider closest to a frequency for a VCO frequency.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+* @param	Output is the output clock
+* @param	Vco is the VCO frequency in MHz
+* @param	Freq is the requested output frequency in MHz
+*
+* @return	Output divider in 1/8 steps
+*
+******************************************************************************/
+static u32 XClk_Wiz_CalcOutDiv(const XClk_Wiz *InstancePtr, u32 Output,
+				double Vco, double Freq)
+{
+	u32 OutDiv;
+	u32 Max = InstancePtr->Limits.OutDivMax * XCLK_WIZ_FRAC_STEPS;
+
+	if ((Output == 0U) && (InstancePtr->Limits.FracEnable != 0U)) {
+		OutDiv = XClk_Wiz_Round((Vco * XCLK_WIZ_FRAC_STEPS) / Freq);
+		/* Fractional values are only allowed from 2 */
+		if ((OutDiv < (XCLK_WIZ_FRAC_OUT_DIV_MIN *
+				XCLK_WIZ_FRAC_STEPS)) &&
+			((OutDiv % XCLK_WIZ_FRAC_STEPS) != 0U)) {
+			OutDiv = XClk_Wiz_Round(Vco / Freq) *
+					XCLK_WIZ_FRAC_STEPS;
+		}
+	} else {
+		OutDiv = XClk_Wiz_Round(Vco / Freq) * XCLK_WIZ_FRAC_STEPS;
+	}
+
+	if (OutDiv < XCLK_WIZ_FRAC_STEPS) {
+		OutDiv = XCLK_WIZ_FRAC_STEPS;
+	} else if (OutDiv > Max) {
+		OutDiv = Max;
+	}
+
+	return OutDiv;
+}
+
+/*****************************************************************************/
+/**
+* Reads the current feedback multiplier and input divider from the core.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+* @param	MultPtr is updated with M in 1/8 steps
+* @param	DivPtr is updated with D
+*
+* @return	None
+*
+******************************************************************************/
+static void XClk_Wiz_ReadMultDiv(const XClk_Wiz *InstancePtr, u32 *MultPtr,
+				u32 *DivPtr)
+{
+	u32 Cfg0;
+	u32 Mult;
+
+	Cfg0 = XClk_Wiz_ReadReg(InstancePtr->Config.BaseAddr,
+				XCLK_WIZ_CFG0_OFFSET);
+	Mult = ((Cfg0 & XCLK_WIZ_CFG0_MULT_MASK) >> XCLK_WIZ_CFG0_MULT_SHIFT) *
+		XCLK_WIZ_FRAC_STEPS;
+	if ((Cfg0 & XCLK_WIZ_CFG0_MULT_FRAC_EN_MASK) != 0U) {
+		Mult += ((Cfg0 & XCLK_WIZ_CFG0_MULT_FRAC_MASK) >>
+			XCLK_WIZ_CFG0_MULT_FRAC_SHIFT) / XCLK_WIZ_FRAC_UNIT;
+	}
+
+	*MultPtr = Mult;
+	*DivPtr = (Cfg0 & XCLK_WIZ_CFG0_DIV_MASK) >> XCLK_WIZ_CFG0_DIV_SHIFT;
+}
+
+/*****************************************************************************/
+/**
+* XClk_Wiz_GetLimits returns the MMCM/PLL limits used by the divider search.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+* @param	LimitsPtr is updated with the limits
+*
+* @return	None
+*
+******************************************************************************/
+void XClk_Wiz_GetLimits(XClk_Wiz *InstancePtr, XClk_Wiz_Limits *LimitsPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(LimitsPtr != NULL);
+
+	*LimitsPtr = InstancePtr->Limits;
+}
+
+/*****************************************************************************/
+/**
+* XClk_Wiz_SetLimits sets the input frequency and MMCM/PLL limits used by
+* the divider search. The rate cache is cleared.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+* @param	LimitsPtr is pointer to the limits
+*
+* @return	None
+*
+* @note		The limits depend on the primitive and speed grade, see the
+*		data sheet of the device. FracEnable has to be 0 for a PLL.
+*
+******************************************************************************/
+void XClk_Wiz_SetLimits(XClk_Wiz *InstancePtr,
+			const XClk_Wiz_Limits *LimitsPtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(LimitsPtr != NULL);
+	Xil_AssertVoid(LimitsPtr->MultMax <= (XCLK_WIZ_CFG0_MULT_MASK >>
+					XCLK_WIZ_CFG0_MULT_SHIFT));
+	Xil_AssertVoid(LimitsPtr->DivMax <= XCLK_WIZ_CFG0_DIV_MASK);
+	Xil_AssertVoid(LimitsPtr->OutDivMax <= XCLK_WIZ_OUT_DIV_MASK);
+
+	InstancePtr->Limits = *LimitsPtr;
+
+	for (Index = 0U; Index < XCLK_WIZ_RATE_CACHE_SIZE; Index++) {
+		InstancePtr->RateCache[Index].IsValid = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* XClk_Wiz_CalcRate computes the divider settings closest to an output
+* frequency. Among the settings with the least error the one with the
+* highest VCO frequency is taken, which has the lowest jitter. Nothing is
+* written to the core.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+* @param	Output is the output clock, 0 to XCLK_WIZ_MAX_OUTPUTS - 1
+* @param	Freq is the requested output frequency in MHz
+* @param	Flags is 0 or XCLK_WIZ_RATE_KEEP_VCO to keep the current M
+*		and D
+* @param	RatePtr is updated with the settings
+*
+* @return
+*		- XST_SUCCESS if settings are found
+*		- XST_FAILURE if the input frequency is not set or no
+*		  settings are within the limits
+*
+******************************************************************************/
+int XClk_Wiz_CalcRate(XClk_Wiz *InstancePtr, u32 Output, double Freq,
+			u32 Flags, XClk_Wiz_Rate *RatePtr)
+{
+	const XClk_Wiz_Limits *Lim;
+	double Pfd;
+	double Vco;
+	double Err;
+	double BestErr = Freq;
+	double BestVco = 0.0;
+	u32 Mult;
+	u32 Div;
+	u32 OutDiv;
+	int Status = XST_FAILURE;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Output < XCLK_WIZ_MAX_OUTPUTS);
+	Xil_AssertNonvoid(Freq > 0.0);
+	Xil_AssertNonvoid(RatePtr != NULL);
+
+	Lim = &InstancePtr->Limits;
+	if (Lim->InputFreq <= 0.0) {
+		goto END;
+	}
+
+	RatePtr->Output = Output;
+
+	if ((Flags & XCLK_WIZ_RATE_KEEP_VCO) != 0U) {
+		XClk_Wiz_ReadMultDiv(InstancePtr, &Mult, &Div);
+		if ((Div == 0U) || (Mult == 0U)) {
+			goto END;
+		}
+
+		Vco = (Lim->InputFreq * Mult) / (Div * XCLK_WIZ_FRAC_STEPS);
+		OutDiv = XClk_Wiz_CalcOutDiv(InstancePtr, Output, Vco, Freq);
+		RatePtr->Mult = Mult;
+		RatePtr->Div = Div;
+		RatePtr->OutDiv = OutDiv;
+		RatePtr->Freq = (Vco * XCLK_WIZ_FRAC_STEPS) / OutDiv;
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	for (Div = 1U; Div <= Lim->DivMax; Div++) {
+		Pfd = Lim->InputFreq / Div;
+		if (Pfd > Lim->PfdMaxFreq) {
+			continue;
+		}
+		if (Pfd < Lim->PfdMinFreq) {
+			break;
+		}
+
+		for (OutDiv = 1U; OutDiv <= Lim->OutDivMax; OutDiv++) {
+			/* M for this D and integer O, fractional on an MMCM */
+			if (Lim->FracEnable != 0U) {
+				Mult = XClk_Wiz_Round((Freq * OutDiv *
+					XCLK_WIZ_FRAC_STEPS) / Pfd);
+			} else {
+				Mult = XClk_Wiz_Round((Freq * OutDiv) / Pfd) *
+					XCLK_WIZ_FRAC_STEPS;
+			}
+			if ((Mult < (XCLK_WIZ_MULT_MIN * XCLK_WIZ_FRAC_STEPS)) ||
+				(Mult > (Lim->MultMax * XCLK_WIZ_FRAC_STEPS))) {
+				continue;
+			}
+
+			Vco = (Pfd * Mult) / XCLK_WIZ_FRAC_STEPS;
+			if ((Vco < Lim->VcoMinFreq) || (Vco > Lim->VcoMaxFreq)) {
+				continue;
+			}
+
+			Err = XClk_Wiz_Diff(Vco / OutDiv, Freq);
+			if ((Status != XST_SUCCESS) || (Err < BestErr) ||
+				((Err == BestErr) && (Vco > BestVco))) {
+				BestErr = Err;
+				BestVco = Vco;
+				RatePtr->Mult = Mult;
+				RatePtr->Div = Div;
+				RatePtr->OutDiv = OutDiv * XCLK_WIZ_FRAC_STEPS;
+				RatePtr->Freq = Vco / OutDiv;
+				Status = XST_SUCCESS;
+			}
+		}
+	}
+
+	if (Status == XST_SUCCESS) {
+		/* A fractional output 0 divider may get closer */
+		OutDiv = XClk_Wiz_CalcOutDiv(InstancePtr, Output, BestVco, Freq);
+		Err = XClk_Wiz_Diff((BestVco * XCLK_WIZ_FRAC_STEPS) / OutDiv,
+					Freq);
+		if (Err < BestErr) {
+			RatePtr->OutDiv = OutDiv;
+			RatePtr->Freq = (BestVco * XCLK_WIZ_FRAC_STEPS) / OutDiv;
+		}
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* XClk_Wiz_ApplyRate writes divider settings to the core, starts the
+* reconfiguration and waits for the MMCM/PLL to lock.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+* @param	RatePtr is pointer to settings from XClk_Wiz_CalcRate
+*
+* @return
+*		- XST_SUCCESS if the MMCM/PLL locked
+*		- XST_FAILURE on lock timeout
+*
+* @note		Changing M or D changes the frequency of every output.
+*
+******************************************************************************/
+int XClk_Wiz_ApplyRate(XClk_Wiz *InstancePtr, const XClk_Wiz_Rate *RatePtr)
+{
+	u32 Cfg0;
+	u32 OutCfg;
+	u32 Frac;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(RatePtr != NULL);
+	Xil_AssertNonvoid(RatePtr->Output < XCLK_WIZ_MAX_OUTPUTS);
+	Xil_AssertNonvoid(RatePtr->Div != 0U);
+	Xil_AssertNonvoid(RatePtr->Mult != 0U);
+	Xil_AssertNonvoid(RatePtr->OutDiv != 0U);
+
+	Cfg0 = (RatePtr->Div << XCLK_WIZ_CFG0_DIV_SHIFT) |
+		((RatePtr->Mult / XCLK_WIZ_FRAC_STEPS) <<
+			XCLK_WIZ_CFG0_MULT_SHIFT);
+	Frac = (RatePtr->Mult % XCLK_WIZ_FRAC_STEPS) * XCLK_WIZ_FRAC_UNIT;
+	if (Frac != 0U) {
+		Cfg0 |= (Frac << XCLK_WIZ_CFG0_MULT_FRAC_SHIFT) |
+			XCLK_WIZ_CFG0_MULT_FRAC_EN_MASK;
+	}
+
+	OutCfg = (RatePtr->OutDiv / XCLK_WIZ_FRAC_STEPS) <<
+			XCLK_WIZ_OUT_DIV_SHIFT;
+	Frac = (RatePtr->OutDiv % XCLK_WIZ_FRAC_STEPS) * XCLK_WIZ_FRAC_UNIT;
+	if (Frac != 0U) {
+		Xil_AssertNonvoid(RatePtr->Output == 0U);
+		OutCfg |= (Frac << XCLK_WIZ_OUT_DIV_FRAC_SHIFT) |
+			XCLK_WIZ_OUT_DIV_FRAC_EN_MASK;
+	}
+
+	XClk_Wiz_WriteReg(InstancePtr->Config.BaseAddr, XCLK_WIZ_CFG0_OFFSET,
+				Cfg0);
+	XClk_Wiz_WriteReg(InstancePtr->Config.BaseAddr,
+				XCLK_WIZ_OUT_DIV_OFFSET(RatePtr->Output), OutCfg);
+
+	XClk_Wiz_WriteReg(InstancePtr->Config.BaseAddr,
+			XCLK_WIZ_RECONFIG_OFFSET,
+			XCLK_WIZ_RECONFIG_LOAD_MASK |
+			XCLK_WIZ_RECONFIG_SADDR_MASK);
+
+	return XClk_Wiz_WaitForLock(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* XClk_Wiz_SetRate sets an output clock to the frequency closest to the
+* requested one. The divider settings of the last XCLK_WIZ_RATE_CACHE_SIZE
+* requests are cached and reused without a new search.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+* @param	Output is the output clock, 0 to XCLK_WIZ_MAX_OUTPUTS - 1
+* @param	Freq is the requested output frequency in MHz
+* @param	Flags is 0 or XCLK_WIZ_RATE_KEEP_VCO
+*
+* @return
+*		- XST_SUCCESS if the output is set and the MMCM/PLL locked
+*		- XST_FAILURE if no settings are found or on lock timeout
+*
+******************************************************************************/
+int XClk_Wiz_SetRate(XClk_Wiz *InstancePtr, u32 Output, double Freq,
+			u32 Flags)
+{
+	XClk_Wiz_RateEntry *Entry = NULL;
+	u32 Mult;
+	u32 Div;
+	u32 Index;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Output < XCLK_WIZ_MAX_OUTPUTS);
+
+	/* Results which keep the VCO are only valid for the same M and D */
+	XClk_Wiz_ReadMultDiv(InstancePtr, &Mult, &Div);
+
+	for (Index = 0U; Index < XCLK_WIZ_RATE_CACHE_SIZE; Index++) {
+		Entry = &InstancePtr->RateCache[Index];
+		if ((Entry->IsValid != 0U) && (Entry->Rate.Output == Output) &&
+			(Entry->ReqFreq == Freq) && (Entry->Flags == Flags) &&
+			(((Flags & XCLK_WIZ_RATE_KEEP_VCO) == 0U) ||
+			 ((Entry->Rate.Mult == Mult) &&
+			  (Entry->Rate.Div == Div)))) {
+			break;
+		}
+	}
+
+	if (Index == XCLK_WIZ_RATE_CACHE_SIZE) {
+		Entry = &InstancePtr->RateCache[InstancePtr->RateCacheNext];
+		Entry->IsValid = 0U;
+		Status = XClk_Wiz_CalcRate(InstancePtr, Output, Freq, Flags,
+						&Entry->Rate);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Entry->ReqFreq = Freq;
+		Entry->Flags = Flags;
+		Entry->IsValid = 1U;
+		InstancePtr->RateCacheNext = (InstancePtr->RateCacheNext + 1U) %
+						XCLK_WIZ_RATE_CACHE_SIZE;
+	}
+
+	Status = XClk_Wiz_ApplyRate(InstancePtr, &Entry->Rate);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* XClk_Wiz_WaitForLock polls the status register until the MMCM/PLL is
+* locked.
+*
+* @param	InstancePtr is the XClk_Wiz instance to operate on
+*
+* @return
+*		- XST_SUCCESS if locked
+*		- XST_FAILURE if not locked after XCLK_WIZ_LOCK_TIMEOUT reads
+*
+******************************************************************************/
+int XClk_Wiz_WaitForLock(XClk_Wiz *InstancePtr)
+{
+	u32 Count = XCLK_WIZ_LOCK_TIMEOUT;
+	int Status = XST_FAILURE;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	while (Count > 0U) {
+		if ((XClk_Wiz_ReadReg(InstancePtr->Config.BaseAddr,
+				XCLK_WIZ_STATUS_OFFSET) &
+				XCLK_WIZ_STATUS_LOCKED_MASK) != 0U) {
+			Status = XST_SUCCESS;
+			break;
+		}
+		Count--;
+	}
+
+	return Status;
+}
+/** @} */
@@ -57,7 +57,10 @@
 *
 * <b> Interrupts </b>
 * This driver will not support handling of interrupts user should write handler
-* to handle the interrupts.
+* to handle the interrupts. The exception are chained transfers, which queue
+* a list of XCsuDma_Segment on a channel with XCsuDma_SgStart() and program
+* the next segment from XCsuDma_SgIntrHandler() as soon as the previous one
+* is done.
 *
 * <b> Virtual Memory </b>
 *
@@ -106,6 +109,8 @@
 * 1.2   adk     11/22/17 Added peripheral test app support for CSUDMA driver.
 *	adk	09/03/18 Added new API XCsuDma_64BitTransfer() useful for 64-bit
 *			 dma transfers through PMU processor(CR#996201).
+*	ag	10/14/26 Added chained segment transfers advanced from the done
+*			 interrupt, see xcsudma_sg.c.
 * </pre>
 *
 ******************************************************************************/
@@ -369,6 +374,47 @@ typedef struct {
 				  *  commands */
 }XCsuDma_Configure;
 
+/******************************************************************************/
+/**
+* One segment of a chained transfer. Address and size follow the rules of
+* XCsuDma_Transfer.
+*/
+typedef struct {
+	UINTPTR Addr;		/**< Word aligned start address */
+	u32 Size;		/**< Number of 4 byte words */
+	u8 EnDataLast;		/**< Assert data_inp_last at the end of the
+				  *  segment, source channel only */
+}XCsuDma_Segment;
+
+/**
+* Callback invoked from XCsuDma_SgIntrHandler when a chain has completed.
+* Status is XST_SUCCESS, or XST_FAILURE if the channel reported an error.
+*/
+typedef void (*XCsuDma_SgHandler)(void *CallBackRef, XCsuDma_Channel Channel,
+				s32 Status);
+
+/**
+* Chain state of one channel.
+*/
+typedef struct {
+	const XCsuDma_Segment *List;	/**< Segments of the running chain */
+	u32 Count;			/**< Number of segments */
+	volatile u32 Next;		/**< Next segment to program */
+	volatile u32 Busy;		/**< Chain is running */
+	volatile s32 Status;		/**< Result of the last chain */
+	XCsuDma_SgHandler Handler;	/**< Completion handler */
+	void *CallBackRef;		/**< Argument of the handler */
+}XCsuDma_SgChannel;
+
+/**
+* Chained transfer context. The user allocates one per XCsuDma instance and
+* connects XCsuDma_SgIntrHandler to the CSU_DMA interrupt with it.
+*/
+typedef struct {
+	XCsuDma *InstancePtr;		/**< Instance the chains run on */
+	XCsuDma_SgChannel Chan[2];	/**< Source and destination chains */
+}XCsuDma_Sg;
+
 /*****************************************************************************/
 
 
@@ -418,6 +464,14 @@ u32 XCsuDma_GetIntrMask(XCsuDma *InstancePtr, XCsuDma_Channel Channel);
 
 s32 XCsuDma_SelfTest(XCsuDma *InstancePtr);
 
+/* Chained transfer APIs */
+s32 XCsuDma_SgInitialize(XCsuDma_Sg *SgPtr, XCsuDma *InstancePtr);
+s32 XCsuDma_SgStart(XCsuDma_Sg *SgPtr, XCsuDma_Channel Channel,
+		const XCsuDma_Segment *List, u32 Count,
+		XCsuDma_SgHandler Handler, void *CallBackRef);
+u32 XCsuDma_SgIsBusy(XCsuDma_Sg *SgPtr, XCsuDma_Channel Channel);
+void XCsuDma_SgIntrHandler(void *CallBackRef);
+
 /******************************************************************************/
 
 #ifdef __cplusplus
@@ -0,0 +1,363 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xcsudma_sg.c
+* @addtogroup csudma_v1_2
+* @{
+*
+* This file contains the chained transfer functions of the CSU_DMA driver.
+*
+* A chain is a list of XCsuDma_Segment started on one channel with
+* XCsuDma_SgStart(). Cache maintenance for all segments is done when the
+* chain is started, so that XCsuDma_SgIntrHandler() only has to acknowledge
+* the done interrupt and write the address and size of the next segment.
+* This keeps the gap between two segments, during which SHA, AES or PCAP
+* get no data, to the interrupt latency. Source and destination chains can
+* run at the same time, as needed for AES.
+*
+* XCsuDma_SgIntrHandler() must be connected to the CSU_DMA interrupt by the
+* application. Without interrupts it can be called in a loop until
+* XCsuDma_SgIsBusy() returns FALSE. XCsuDma_Transfer() and
+* XCsuDma_WaitForDone() must not be used on a channel while a chain runs on
+* it.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ---------------------------------------------------
+* 1.2   ag      10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xcsudma.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Interrupts ending a chain with an error */
+#define XCSUDMA_SG_ERR_MASK	((u32)XCSUDMA_IXR_INVALID_APB_MASK | \
+				(u32)XCSUDMA_IXR_TIMEOUT_MEM_MASK | \
+				(u32)XCSUDMA_IXR_TIMEOUT_STRM_MASK | \
+				(u32)XCSUDMA_IXR_AXI_WRERR_MASK)
+
+/* Interrupts used by a running chain */
+#define XCSUDMA_SG_INTR_MASK	((u32)XCSUDMA_IXR_DONE_MASK | \
+				XCSUDMA_SG_ERR_MASK)
+
+/************************** Function Prototypes ******************************/
+
+static void XCsuDma_SgProgram(u32 BaseAddress, XCsuDma_Channel Channel,
+				const XCsuDma_Segment *SegPtr);
+static void XCsuDma_SgService(XCsuDma_Sg *SgPtr, XCsuDma_Channel Channel);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a chained transfer context for a CSU_DMA
+* instance. The instance must have been initialized with
+* XCsuDma_CfgInitialize.
+*
+* @param	SgPtr is a pointer to the chained transfer context.
+* @param	InstancePtr is a pointer to the XCsuDma instance.
+*
+* @return	XST_SUCCESS.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XCsuDma_SgInitialize(XCsuDma_Sg *SgPtr, XCsuDma *InstancePtr)
+{
+	u32 Channel;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SgPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady ==
+				(u32)(XIL_COMPONENT_IS_READY));
+
+	(void)memset((void *)SgPtr, 0, sizeof(XCsuDma_Sg));
+	SgPtr->InstancePtr = InstancePtr;
+
+	for (Channel = (u32)XCSUDMA_SRC_CHANNEL;
+		Channel <= (u32)XCSUDMA_DST_CHANNEL; Channel++) {
+		XCsuDma_DisableIntr(InstancePtr, (XCsuDma_Channel)Channel,
+					XCSUDMA_SG_INTR_MASK);
+		SgPtr->Chan[Channel].Status = (s32)XST_SUCCESS;
+	}
+
+	return (s32)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts a chain of transfers on a channel. The segments are
+* transfered in list order, each one is started from the done interrupt of
+* the previous one. The list must stay valid until the chain has completed.
+*
+* @param	SgPtr is a pointer to the chained transfer context.
+* @param	Channel represents the type of channel either it is Source or
+*		Destination.
+*		Source channel      - XCSUDMA_SRC_CHANNEL
+*		Destination Channel - XCSUDMA_DST_CHANNEL
+* @param	List is the array of segments.
+* @param	Count is the number of segments in List.
+* @param	Handler is called from XCsuDma_SgIntrHandler when the chain
+*		has completed. It may be NULL.
+* @param	CallBackRef is passed to Handler.
+*
+* @return
+*		- XST_SUCCESS if the first segment has been started.
+*		- XST_DEVICE_BUSY if a chain is running on the channel.
+*		- XST_INVALID_PARAM if the list is empty or a segment is
+*		  unaligned, empty or too large.
+*
+* @note		The caches are maintained for all segments before the first
+*		one is started.
+*
+******************************************************************************/
+s32 XCsuDma_SgStart(XCsuDma_Sg *SgPtr, XCsuDma_Channel Channel,
+		const XCsuDma_Segment *List, u32 Count,
+		XCsuDma_SgHandler Handler, void *CallBackRef)
+{
+	XCsuDma_SgChannel *ChanPtr;
+	XCsuDma *InstancePtr;
+	u32 Index;
+	u32 Len;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SgPtr != NULL);
+	Xil_AssertNonvoid(SgPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid((Channel == (XCSUDMA_SRC_CHANNEL)) ||
+					(Channel == (XCSUDMA_DST_CHANNEL)));
+	Xil_AssertNonvoid(List != NULL);
+
+	InstancePtr = SgPtr->InstancePtr;
+	ChanPtr = &SgPtr->Chan[Channel];
+
+	if (ChanPtr->Busy != 0U) {
+		return (s32)(XST_DEVICE_BUSY);
+	}
+	if (Count == 0U) {
+		return (s32)(XST_INVALID_PARAM);
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		if (((List[Index].Addr & (UINTPTR)(XCSUDMA_ADDR_LSB_MASK)) !=
+			(UINTPTR)0U) || (List[Index].Size == 0U) ||
+			(List[Index].Size > (u32)(XCSUDMA_SIZE_MAX))) {
+			return (s32)(XST_INVALID_PARAM);
+		}
+	}
+
+	/* Maintain the caches of the whole chain now, not between segments */
+	for (Index = 0U; Index < Count; Index++) {
+		Len = List[Index].Size << (u32)(XCSUDMA_SIZE_SHIFT);
+		if (Channel == (XCSUDMA_SRC_CHANNEL)) {
+			Xil_DCacheFlushRange(List[Index].Addr, Len);
+		}
+		else {
+#if defined(__aarch64__)
+			Xil_DCacheInvalidateRange(List[Index].Addr, Len);
+#else
+			Xil_DCacheFlushRange(List[Index].Addr, Len);
+#endif
+		}
+	}
+
+	ChanPtr->List = List;
+	ChanPtr->Count = Count;
+	ChanPtr->Next = 1U;
+	ChanPtr->Status = (s32)(XST_DEVICE_BUSY);
+	ChanPtr->Handler = Handler;
+	ChanPtr->CallBackRef = CallBackRef;
+	ChanPtr->Busy = 1U;
+
+	XCsuDma_IntrClear(InstancePtr, Channel, XCSUDMA_SG_INTR_MASK);
+	XCsuDma_EnableIntr(InstancePtr, Channel, XCSUDMA_SG_INTR_MASK);
+
+	XCsuDma_SgProgram(InstancePtr->Config.BaseAddress, Channel, &List[0]);
+
+	return (s32)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function tells whether a chain is running on a channel.
+*
+* @param	SgPtr is a pointer to the chained transfer context.
+* @param	Channel represents the type of channel either it is Source or
+*		Destination.
+*		Source channel      - XCSUDMA_SRC_CHANNEL
+*		Destination Channel - XCSUDMA_DST_CHANNEL
+*
+* @return	TRUE while the chain runs, FALSE otherwise. The result of the
+*		last chain is kept in SgPtr->Chan[Channel].Status.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCsuDma_SgIsBusy(XCsuDma_Sg *SgPtr, XCsuDma_Channel Channel)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(SgPtr != NULL);
+	Xil_AssertNonvoid((Channel == (XCSUDMA_SRC_CHANNEL)) ||
+					(Channel == (XCSUDMA_DST_CHANNEL)));
+
+	return (SgPtr->Chan[Channel].Busy != 0U) ? (u32)TRUE : (u32)FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of chained transfers. It starts the
+* next segment of every channel whose segment is done and calls the
+* completion handler of chains that have ended.
+*
+* @param	CallBackRef is a pointer to the XCsuDma_Sg context.
+*
+* @return	None.
+*
+* @note		Interrupts of channels without a running chain are left
+*		untouched.
+*
+******************************************************************************/
+void XCsuDma_SgIntrHandler(void *CallBackRef)
+{
+	XCsuDma_Sg *SgPtr = (XCsuDma_Sg *)CallBackRef;
+
+	Xil_AssertVoid(SgPtr != NULL);
+
+	if (SgPtr->Chan[XCSUDMA_SRC_CHANNEL].Busy != 0U) {
+		XCsuDma_SgService(SgPtr, XCSUDMA_SRC_CHANNEL);
+	}
+	if (SgPtr->Chan[XCSUDMA_DST_CHANNEL].Busy != 0U) {
+		XCsuDma_SgService(SgPtr, XCSUDMA_DST_CHANNEL);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Handles the pending interrupts of one channel with a running chain.
+*
+* @param	SgPtr is a pointer to the chained transfer context.
+* @param	Channel is the channel to service.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XCsuDma_SgService(XCsuDma_Sg *SgPtr, XCsuDma_Channel Channel)
+{
+	XCsuDma_SgChannel *ChanPtr = &SgPtr->Chan[Channel];
+	u32 BaseAddress = SgPtr->InstancePtr->Config.BaseAddress;
+	u32 Offset = (u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF);
+	u32 Status;
+	s32 Result;
+
+	Status = XCsuDma_ReadReg(BaseAddress,
+			(u32)(XCSUDMA_I_STS_OFFSET) + Offset) &
+						XCSUDMA_SG_INTR_MASK;
+	if (Status == 0U) {
+		return;
+	}
+
+	/*
+	 * Acknowledge before the next segment is started, a short segment
+	 * could otherwise be done before its done bit is cleared.
+	 */
+	XCsuDma_WriteReg(BaseAddress, (u32)(XCSUDMA_I_STS_OFFSET) + Offset,
+								Status);
+
+	if ((Status & XCSUDMA_SG_ERR_MASK) != 0U) {
+		Result = (s32)(XST_FAILURE);
+	}
+	else if (ChanPtr->Next < ChanPtr->Count) {
+		XCsuDma_SgProgram(BaseAddress, Channel,
+					&ChanPtr->List[ChanPtr->Next]);
+		ChanPtr->Next++;
+		return;
+	}
+	else {
+		Result = (s32)(XST_SUCCESS);
+	}
+
+	XCsuDma_WriteReg(BaseAddress, (u32)(XCSUDMA_I_DIS_OFFSET) + Offset,
+						XCSUDMA_SG_INTR_MASK);
+	ChanPtr->Status = Result;
+	ChanPtr->Busy = 0U;
+
+	if (ChanPtr->Handler != NULL) {
+		ChanPtr->Handler(ChanPtr->CallBackRef, Channel, Result);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes the address and size of a segment, which starts its transfer. The
+* caches must already have been maintained.
+*
+* @param	BaseAddress is the base address of the CSU_DMA.
+* @param	Channel is the channel to start.
+* @param	SegPtr is the segment.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XCsuDma_SgProgram(u32 BaseAddress, XCsuDma_Channel Channel,
+				const XCsuDma_Segment *SegPtr)
+{
+	u32 Offset = (u32)Channel * (u32)(XCSUDMA_OFFSET_DIFF);
+	u32 Size = SegPtr->Size << (u32)(XCSUDMA_SIZE_SHIFT);
+
+	if (SegPtr->EnDataLast == (u8)(XCSUDMA_LAST_WORD_MASK)) {
+		Size |= (u32)(XCSUDMA_LAST_WORD_MASK);
+	}
+
+	XCsuDma_WriteReg(BaseAddress, (u32)(XCSUDMA_ADDR_OFFSET) + Offset,
+			((u32)(SegPtr->Addr) & (u32)(XCSUDMA_ADDR_MASK)));
+	XCsuDma_WriteReg(BaseAddress, (u32)(XCSUDMA_ADDR_MSB_OFFSET) + Offset,
+			(u32)(((u64)SegPtr->Addr >> (u32)(XCSUDMA_MSB_ADDR_SHIFT)) &
+					(u32)(XCSUDMA_MSB_ADDR_MASK)));
+	XCsuDma_WriteReg(BaseAddress, (u32)(XCSUDMA_SIZE_OFFSET) + Offset,
+								Size);
+}
+/** @} */
@@ -81,7 +81,7 @@
 *			XDCFG_INT_STS_OFFSET) &
 *			XDCFG_IXR_D_P_DONE_MASK) !=
 *			XDCFG_IXR_D_P_DONE_MASK);
-*
+* 3.5   ag  10/14/26 Reset the transfer queue in XDcfg_CfgInitialize.
 *
 * </pre>
 *
@@ -168,6 +168,13 @@ int XDcfg_CfgInitialize(XDcfg *InstancePtr,
 	 */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
+	/*
+	 * Start with an empty transfer queue and no queue handler.
+	 */
+	InstancePtr->QueueHandler = NULL;
+	InstancePtr->QueueRef = NULL;
+	XDcfg_QueueReset(InstancePtr);
+
 	return XST_SUCCESS;
 }
 
@@ -159,6 +159,9 @@
 * 3.5   ms  04/18/17 Modified tcl file to add suffix U for all macros
 *                    definitions of devcfg in xparameters.h
 *       ms  08/07/17 Fixed compilation warnings in xdevcfg_sinit.c
+*       ag  10/14/26 Added the interrupt driven transfer queue in
+*		     xdevcfg_queue.c which keeps the DMA command queue
+*		     filled and supports chained and readback transfers.
 * </pre>
 *
 ******************************************************************************/
@@ -185,6 +188,15 @@ extern "C" {
 #define XDCFG_CONCURRENT_SECURE_READ_WRITE	4
 #define XDCFG_CONCURRENT_NONSEC_READ_WRITE	5
 
+/* Depth of the software transfer queue */
+#define XDCFG_QUEUE_DEPTH			8U
+
+/*
+ * Transfer queue flags. XDCFG_QUEUE_PARTIAL marks a piece of a split
+ * transfer which is followed by more pieces, the last DMA command marker
+ * is only set on the final piece.
+ */
+#define XDCFG_QUEUE_PARTIAL			0x1U
 
 /**************************** Type Definitions *******************************/
 /**
@@ -200,6 +212,34 @@ extern "C" {
 */
 typedef void (*XDcfg_IntrHandler) (void *CallBackRef, u32 Status);
 
+/**
+* The queue handler data type allows the user to define a callback function
+* which is invoked in interrupt context when a queued transfer completes.
+*
+* @param	CallBackRef is the callback reference passed in by the upper
+*		layer when setting the queue handler.
+* @param	TransferRef is the reference passed in with the transfer when
+*		it was queued.
+* @param	Status is XST_SUCCESS if the transfer completed or
+*		XST_FAILURE if it was aborted due to a DMA/PCAP error.
+*/
+typedef void (*XDcfg_QueueHandler) (void *CallBackRef, void *TransferRef,
+					u32 Status);
+
+/**
+ * This typedef contains a transfer of the software transfer queue.
+ */
+typedef struct {
+	u32 SourcePtr;		/**< Source address */
+	u32 SrcWordLength;	/**< Source length in words */
+	u32 DestPtr;		/**< Destination address */
+	u32 DestWordLength;	/**< Destination length in words */
+	u32 TransferType;	/**< Type of PCAP transfer */
+	u32 Flags;		/**< XDCFG_QUEUE_* flags */
+	u32 Phase;		/**< Readback phase of the transfer */
+	void *TransferRef;	/**< Reference passed to the queue handler */
+} XDcfg_QueueEntry;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -219,6 +259,16 @@ typedef struct {
 				  */
 	XDcfg_IntrHandler StatusHandler;  /* Event handler function */
 	void *CallBackRef;	/* Callback reference for event handler */
+	XDcfg_QueueEntry Queue[XDCFG_QUEUE_DEPTH]; /**< Transfer queue */
+	u32 QueueHead;		/**< Oldest transfer in the queue */
+	u32 QueueCount;		/**< Number of transfers in the queue */
+	u32 QueueIssued;	/**< DMA commands issued to the hardware */
+	u32 QueuePcapBusy;	/**< Waiting for DMA and PCAP done of
+				  *  the last DMA command
+				  */
+	u32 QueueMode;		/**< Transfer type the PCAP is set up for */
+	XDcfg_QueueHandler QueueHandler; /**< Transfer done handler */
+	void *QueueRef;		/**< Callback reference for queue handler */
 } XDcfg;
 
 /****************************************************************************/
@@ -395,6 +445,23 @@ void XDcfg_InterruptHandler(XDcfg *InstancePtr);
 void XDcfg_SetHandler(XDcfg *InstancePtr, void *CallBackFunc,
 				void *CallBackRef);
 
+/*
+ * Transfer queue functions implemented in xdevcfg_queue.c
+ */
+void XDcfg_QueueReset(XDcfg *InstancePtr);
+
+void XDcfg_SetQueueHandler(XDcfg *InstancePtr, XDcfg_QueueHandler FuncPtr,
+				void *CallBackRef);
+
+u32 XDcfg_QueueTransfer(XDcfg *InstancePtr,
+				void *SourcePtr, u32 SrcWordLength,
+				void *DestPtr, u32 DestWordLength,
+				u32 TransferType, u32 Flags, void *TransferRef);
+
+u32 XDcfg_QueueIsEmpty(XDcfg *InstancePtr);
+
+void XDcfg_QueueIntrHandler(XDcfg *InstancePtr, u32 IntrStatus);
+
 #ifdef __cplusplus
 }
 #endif
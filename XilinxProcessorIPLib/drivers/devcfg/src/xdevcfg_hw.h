@@ -52,6 +52,8 @@
 *		     version UG585 (v1.4) November 16, 2012.
 * 2.04a	kpc	10/07/13 Added function prototype.
 * 3.00a	kpc	25/02/14 Corrected the XDCFG_BASE_ADDRESS macro value.
+* 3.5   ag  10/14/26 Added XDCFG_STATUS_DMA_DONE_CNT_SHIFT and
+*		     XDCFG_DMA_LAST_CMD for the transfer queue.
 * </pre>
 *
 ******************************************************************************/
@@ -266,6 +268,9 @@ extern "C" {
 						     *  completed DMA
 						     *  transfers
 						     */
+#define XDCFG_STATUS_DMA_DONE_CNT_SHIFT	28	   /**< Shift for the
+						     *  DMA done count
+						     */
 #define XDCFG_STATUS_RX_FIFO_LVL_MASK	0x01F000000 /**< Rx FIFO level */
 #define XDCFG_STATUS_TX_FIFO_LVL_MASK	0x0007F000  /**< Tx FIFO level */
 
@@ -335,6 +340,10 @@ extern "C" {
 
 /* Miscellaneous constant values */
 #define XDCFG_DMA_INVALID_ADDRESS	0xFFFFFFFF  /**< Invalid DMA address */
+#define XDCFG_DMA_LAST_CMD		0x1	    /**< Address LSBs marking
+						      *  the last DMA command
+						      *  of a transfer
+						      */
 #define XDCFG_UNLOCK_DATA		0x757BDF0D  /**< First APB access data*/
 #define XDCFG_BASE_ADDRESS		0xF8007000  /**< Device Config base
 						      * address
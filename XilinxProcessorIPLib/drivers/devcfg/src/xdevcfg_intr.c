@@ -48,6 +48,9 @@
 * 2.01a nm  07/07/12 Updated the XDcfg_IntrClear function to directly
 *		     set the mask instead of oring it with the
 *		     value read from the interrupt status register
+* 3.5   ag  10/14/26 Updated XDcfg_InterruptHandler to service the
+*		     transfer queue and to skip the status handler when
+*		     it is not set.
 * </pre>
 *
 ******************************************************************************/
@@ -260,19 +263,34 @@ void XDcfg_InterruptHandler(XDcfg *InstancePtr)
 	IntrStatusReg = XDcfg_ReadReg(InstancePtr->Config.BaseAddr,
 					 XDCFG_INT_STS_OFFSET);
 
-	/*
-	 * Write the status back to clear the interrupts so that no
-	 * subsequent interrupts are missed while processing this interrupt.
-	 * This also does the DMA acknowledgment automatically.
-	 */
-	XDcfg_WriteReg(InstancePtr->Config.BaseAddr,
+	if (InstancePtr->QueueCount != 0U) {
+		/*
+		 * The transfer queue acknowledges every completed DMA
+		 * command itself, so the DMA done bit is not written back.
+		 */
+		XDcfg_WriteReg(InstancePtr->Config.BaseAddr,
+				XDCFG_INT_STS_OFFSET,
+				IntrStatusReg & ~XDCFG_IXR_DMA_DONE_MASK);
+
+		XDcfg_QueueIntrHandler(InstancePtr, IntrStatusReg);
+	} else {
+		/*
+		 * Write the status back to clear the interrupts so that no
+		 * subsequent interrupts are missed while processing this
+		 * interrupt. This also does the DMA acknowledgment
+		 * automatically.
+		 */
+		XDcfg_WriteReg(InstancePtr->Config.BaseAddr,
 				XDCFG_INT_STS_OFFSET, IntrStatusReg);
+	}
 
 	/*
 	 * Signal application that there are events to handle.
 	 */
-	InstancePtr->StatusHandler(InstancePtr->CallBackRef,
+	if (InstancePtr->StatusHandler != NULL) {
+		InstancePtr->StatusHandler(InstancePtr->CallBackRef,
 					   IntrStatusReg);
+	}
 
 }
 
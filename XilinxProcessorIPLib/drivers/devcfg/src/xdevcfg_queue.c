@@ -0,0 +1,540 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xdevcfg_queue.c
+* @addtogroup devcfg_v3_5
+* @{
+*
+* Contains the implementation of the interrupt driven transfer queue of the
+* XDcfg driver.
+*
+* Transfers are added to a software queue with XDcfg_QueueTransfer and are
+* issued to the DMA command queue, which has a depth of two, from the
+* interrupt handler as earlier commands complete. This keeps the PCAP busy
+* without the processor polling for DMA done between the transfers.
+*
+* A bitstream which is split over several buffers is queued as several
+* transfers with XDCFG_QUEUE_PARTIAL set on all but the final piece. Only
+* the final piece carries the last DMA command marker, so the pieces are
+* streamed back to back to the PCAP. Transfers of a different type, or
+* following a final piece, are issued once the DMA and PCAP done of the
+* previous last DMA command is received, as the PCAP mode may change.
+*
+* Readback transfers are handled in two phases from the interrupt handler,
+* the read command is sent first and the read data is received with a
+* second DMA command once the PCAP has accepted the read command.
+*
+* XDcfg_InterruptHandler must be connected to the interrupt system for the
+* queue to make progress. The queue handler set with XDcfg_SetQueueHandler
+* is invoked in interrupt context as each transfer completes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- ---------------------------------------------
+* 3.5   ag  10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xdevcfg.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Depth of the DMA command queue */
+#define XDCFG_DMA_CMD_QUEUE_DEPTH	2U
+
+/* Interrupts used by the transfer queue */
+#define XDCFG_QUEUE_IXR_MASK	(XDCFG_IXR_DMA_DONE_MASK | \
+				 XDCFG_IXR_D_P_DONE_MASK | \
+				 XDCFG_IXR_ERROR_FLAGS_MASK)
+
+/* Phases of a readback transfer */
+#define XDCFG_READBACK_CMD		0U	/**< Read command to be sent */
+#define XDCFG_READBACK_CMD_SENT		1U	/**< Read command issued */
+#define XDCFG_READBACK_DATA		2U	/**< Read data to be received */
+#define XDCFG_READBACK_DATA_SENT	3U	/**< Read data command issued */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static void XDcfg_QueueSetMode(XDcfg *InstancePtr, u32 TransferType);
+static void XDcfg_QueueIssue(XDcfg *InstancePtr);
+static void XDcfg_QueueComplete(XDcfg *InstancePtr, u32 Status);
+
+/************************** Variable Definitions *****************************/
+
+/****************************************************************************/
+/**
+*
+* This function empties the transfer queue. Transfers in the queue are
+* dropped without invoking the queue handler.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+*
+* @return	None.
+*
+* @note		This function should only be called when no DMA command of
+*		the queue is in progress, for example after the PCAP has been
+*		reset following a DMA or PCAP error.
+*
+*****************************************************************************/
+void XDcfg_QueueReset(XDcfg *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->QueueHead = 0U;
+	InstancePtr->QueueCount = 0U;
+	InstancePtr->QueueIssued = 0U;
+	InstancePtr->QueuePcapBusy = 0U;
+	InstancePtr->QueueMode = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets the handler that will be called in interrupt context
+* when a queued transfer completes.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+* @param	FuncPtr is the address of the callback function, NULL if no
+*		notification is required.
+* @param	CallBackRef is a user data item that will be passed to the
+*		callback function when it is invoked.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XDcfg_SetQueueHandler(XDcfg *InstancePtr, XDcfg_QueueHandler FuncPtr,
+				void *CallBackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->QueueHandler = FuncPtr;
+	InstancePtr->QueueRef = CallBackRef;
+}
+
+/****************************************************************************/
+/**
+*
+* This function adds a transfer to the transfer queue. The transfer is
+* started right away if the DMA command queue has room for it, otherwise it
+* is started from the interrupt handler when the earlier transfers complete.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+* @param	SourcePtr contains a pointer to the source memory where the data
+*		is to be transferred from.
+* @param	SrcWordLength is the number of words (32 bit) to be transferred
+*		for the source transfer.
+* @param	DestPtr contains a pointer to the destination memory
+*		where the data is to be transferred to.
+* @param	DestWordLength is the number of words (32 bit) to be transferred
+*		for the Destination transfer.
+* @param	TransferType contains the type of PCAP transfer being requested.
+*		The definitions can be found in the xdevcfg.h file.
+* @param	Flags is XDCFG_QUEUE_PARTIAL for a piece of a split PCAP write
+*		which is followed by more pieces, 0 otherwise.
+* @param	TransferRef is passed back to the queue handler when the
+*		transfer completes.
+*
+* @return
+*		- XST_SUCCESS if the transfer is queued
+*		- XST_DEVICE_BUSY if the transfer queue is full
+*		- XST_INVALID_PARAM if invalid Source / Destination address
+*			or length or an invalid transfer type is sent
+*		- XST_FAILURE if the fabric is not in initialized state
+*
+* @note		The cache maintenance and address requirements of
+*		XDcfg_Transfer apply to the queued transfers as well.
+*
+*		The queue sets the last DMA command marker in the 2 LSBs of the
+*		addresses itself, the addresses passed in must be word aligned
+*		or have the marker already set.
+*
+*		XDCFG_QUEUE_PARTIAL is only supported for PCAP write transfers.
+*
+*****************************************************************************/
+u32 XDcfg_QueueTransfer(XDcfg *InstancePtr,
+				void *SourcePtr, u32 SrcWordLength,
+				void *DestPtr, u32 DestWordLength,
+				u32 TransferType, u32 Flags, void *TransferRef)
+{
+	XDcfg_QueueEntry *EntryPtr;
+	u32 IntrReg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	switch (TransferType) {
+	case XDCFG_NON_SECURE_PCAP_WRITE:
+	case XDCFG_SECURE_PCAP_WRITE:
+		if ((SourcePtr == NULL) || (SrcWordLength == 0U)) {
+			return XST_INVALID_PARAM;
+		}
+		break;
+
+	case XDCFG_PCAP_READBACK:
+		if ((SourcePtr == NULL) || (SrcWordLength == 0U) ||
+			(DestPtr == NULL) || (DestWordLength == 0U)) {
+			return XST_INVALID_PARAM;
+		}
+		break;
+
+	case XDCFG_CONCURRENT_SECURE_READ_WRITE:
+	case XDCFG_CONCURRENT_NONSEC_READ_WRITE:
+		if ((SourcePtr == NULL) || (SrcWordLength == 0U) ||
+			(DestPtr == NULL) || (DestWordLength == 0U)) {
+			return XST_INVALID_PARAM;
+		}
+		break;
+
+	default:
+		return XST_INVALID_PARAM;
+	}
+
+	if (((Flags & XDCFG_QUEUE_PARTIAL) != 0U) &&
+		(TransferType != XDCFG_NON_SECURE_PCAP_WRITE) &&
+		(TransferType != XDCFG_SECURE_PCAP_WRITE)) {
+		return XST_INVALID_PARAM;
+	}
+
+	/*
+	 * Check whether the fabric is in initialized state, this is not
+	 * needed for non-encrypted loopback transfers.
+	 */
+	if (((XDcfg_ReadReg(InstancePtr->Config.BaseAddr, XDCFG_STATUS_OFFSET)
+			& XDCFG_STATUS_PCFG_INIT_MASK) == 0U) &&
+		(TransferType != XDCFG_CONCURRENT_NONSEC_READ_WRITE)) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * The queue is also updated from the interrupt handler, keep the
+	 * device interrupts disabled while the transfer is added.
+	 */
+	IntrReg = XDcfg_IntrGetEnabled(InstancePtr);
+	XDcfg_IntrDisable(InstancePtr, XDCFG_IXR_ALL_MASK);
+
+	if (InstancePtr->QueueCount == XDCFG_QUEUE_DEPTH) {
+		XDcfg_IntrEnable(InstancePtr, IntrReg);
+		return XST_DEVICE_BUSY;
+	}
+
+	EntryPtr = &InstancePtr->Queue[(InstancePtr->QueueHead +
+			InstancePtr->QueueCount) % XDCFG_QUEUE_DEPTH];
+	EntryPtr->SourcePtr = (u32)SourcePtr;
+	EntryPtr->SrcWordLength = SrcWordLength;
+	EntryPtr->DestPtr = (u32)DestPtr;
+	EntryPtr->DestWordLength = DestWordLength;
+	EntryPtr->TransferType = TransferType;
+	EntryPtr->Flags = Flags;
+	EntryPtr->Phase = XDCFG_READBACK_CMD;
+	EntryPtr->TransferRef = TransferRef;
+	InstancePtr->QueueCount++;
+
+	XDcfg_QueueIssue(InstancePtr);
+
+	XDcfg_IntrEnable(InstancePtr, IntrReg | XDCFG_QUEUE_IXR_MASK);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function checks whether all the queued transfers have completed.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+*
+* @return	TRUE if the transfer queue is empty, FALSE otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XDcfg_QueueIsEmpty(XDcfg *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	return (InstancePtr->QueueCount == 0U) ? (u32)TRUE : (u32)FALSE;
+}
+
+/****************************************************************************/
+/**
+*
+* This function services the transfer queue. It retires the DMA commands
+* reported as done by the DMA done count, completes the transfers and
+* issues the next DMA commands. It is called from XDcfg_InterruptHandler.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+* @param	IntrStatus is the interrupt status read by the interrupt
+*		handler.
+*
+* @return	None.
+*
+* @note		On a DMA or PCAP error all the queued transfers are completed
+*		with XST_FAILURE. The application has to recover the PCAP
+*		before queuing further transfers.
+*
+*****************************************************************************/
+void XDcfg_QueueIntrHandler(XDcfg *InstancePtr, u32 IntrStatus)
+{
+	XDcfg_QueueEntry *EntryPtr;
+	u32 DoneCount;
+	u32 Count;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	DoneCount = (XDcfg_ReadReg(InstancePtr->Config.BaseAddr,
+			XDCFG_STATUS_OFFSET) & XDCFG_STATUS_DMA_DONE_CNT_MASK) >>
+			XDCFG_STATUS_DMA_DONE_CNT_SHIFT;
+
+	while (DoneCount > 0U) {
+		/*
+		 * Acknowledge one completed DMA command
+		 */
+		XDcfg_WriteReg(InstancePtr->Config.BaseAddr,
+				XDCFG_INT_STS_OFFSET, XDCFG_IXR_DMA_DONE_MASK);
+		DoneCount--;
+
+		if (InstancePtr->QueueIssued == 0U) {
+			continue;
+		}
+		InstancePtr->QueueIssued--;
+
+		EntryPtr = &InstancePtr->Queue[InstancePtr->QueueHead];
+		if ((EntryPtr->TransferType == XDCFG_PCAP_READBACK) &&
+			(EntryPtr->Phase == XDCFG_READBACK_CMD_SENT)) {
+			EntryPtr->Phase = XDCFG_READBACK_DATA;
+		} else {
+			XDcfg_QueueComplete(InstancePtr, XST_SUCCESS);
+		}
+	}
+
+	if ((IntrStatus & XDCFG_IXR_D_P_DONE_MASK) != 0U) {
+		InstancePtr->QueuePcapBusy = 0U;
+	}
+
+	if ((IntrStatus & XDCFG_IXR_ERROR_FLAGS_MASK) != 0U) {
+		/*
+		 * Fail the transfers queued so far, transfers queued again
+		 * from the queue handler are kept.
+		 */
+		Count = InstancePtr->QueueCount;
+		InstancePtr->QueueIssued = 0U;
+		InstancePtr->QueuePcapBusy = 0U;
+		while (Count > 0U) {
+			XDcfg_QueueComplete(InstancePtr, XST_FAILURE);
+			Count--;
+		}
+		return;
+	}
+
+	XDcfg_QueueIssue(InstancePtr);
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets up the PCAP loopback and rate for a transfer type the
+* same way XDcfg_Transfer does.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+* @param	TransferType contains the type of PCAP transfer.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDcfg_QueueSetMode(XDcfg *InstancePtr, u32 TransferType)
+{
+	u32 CtrlReg;
+
+	CtrlReg = XDcfg_ReadReg(InstancePtr->Config.BaseAddr,
+				XDCFG_MCTRL_OFFSET);
+	if (TransferType == XDCFG_CONCURRENT_NONSEC_READ_WRITE) {
+		/* Enable internal PCAP loopback */
+		CtrlReg |= XDCFG_MCTRL_PCAP_LPBK_MASK;
+	} else {
+		/* Clear internal PCAP loopback */
+		CtrlReg &= ~XDCFG_MCTRL_PCAP_LPBK_MASK;
+	}
+	XDcfg_WriteReg(InstancePtr->Config.BaseAddr, XDCFG_MCTRL_OFFSET,
+			CtrlReg);
+
+	if ((TransferType == XDCFG_SECURE_PCAP_WRITE) ||
+		(TransferType == XDCFG_CONCURRENT_SECURE_READ_WRITE)) {
+		/*
+		 * Encrypted PCAP data is sent every 4 clock cycles
+		 */
+		XDcfg_SetControlRegister(InstancePtr,
+					XDCFG_CTRL_PCAP_RATE_EN_MASK);
+	} else if (TransferType != XDCFG_PCAP_READBACK) {
+		XDcfg_ClearControlRegister(InstancePtr,
+					XDCFG_CTRL_PCAP_RATE_EN_MASK);
+	} else {
+		/* Readback keeps the current PCAP rate */
+	}
+
+	InstancePtr->QueueMode = TransferType;
+}
+
+/****************************************************************************/
+/**
+*
+* This function issues queued transfers to the DMA command queue while it
+* has room for them.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+*
+* @return	None.
+*
+* @note		A transfer is issued behind an outstanding DMA command only if
+*		it is a PCAP write piece of the same type following a partial
+*		piece. Any other transfer waits for the DMA command queue to
+*		drain and for the DMA and PCAP done of the last DMA command.
+*
+*****************************************************************************/
+static void XDcfg_QueueIssue(XDcfg *InstancePtr)
+{
+	XDcfg_QueueEntry *EntryPtr;
+	u32 SourcePtr;
+	u32 DestPtr;
+
+	while ((InstancePtr->QueueIssued < InstancePtr->QueueCount) &&
+		(InstancePtr->QueueIssued < XDCFG_DMA_CMD_QUEUE_DEPTH) &&
+		(InstancePtr->QueuePcapBusy == 0U)) {
+
+		EntryPtr = &InstancePtr->Queue[(InstancePtr->QueueHead +
+				InstancePtr->QueueIssued) % XDCFG_QUEUE_DEPTH];
+
+		if (InstancePtr->QueueIssued == 0U) {
+			XDcfg_QueueSetMode(InstancePtr, EntryPtr->TransferType);
+		} else if ((EntryPtr->TransferType != InstancePtr->QueueMode) ||
+			(EntryPtr->TransferType == XDCFG_PCAP_READBACK)) {
+			break;
+		} else if (XDcfg_IsDmaBusy(InstancePtr) == XST_SUCCESS) {
+			break;
+		} else {
+			/* Chained piece of the transfer in progress */
+		}
+
+		if (EntryPtr->TransferType == XDCFG_PCAP_READBACK) {
+			if (EntryPtr->Phase == XDCFG_READBACK_CMD) {
+				/*
+				 * Send READ Frame command to FPGA
+				 */
+				SourcePtr = (EntryPtr->SourcePtr &
+					~0x3U) | XDCFG_DMA_LAST_CMD;
+				XDcfg_InitiateDma(InstancePtr, SourcePtr,
+					XDCFG_DMA_INVALID_ADDRESS,
+					EntryPtr->SrcWordLength, 0U);
+				EntryPtr->Phase = XDCFG_READBACK_CMD_SENT;
+			} else {
+				/*
+				 * Receive the read data from FPGA
+				 */
+				DestPtr = (EntryPtr->DestPtr &
+					~0x3U) | XDCFG_DMA_LAST_CMD;
+				XDcfg_InitiateDma(InstancePtr,
+					XDCFG_DMA_INVALID_ADDRESS, DestPtr,
+					0U, EntryPtr->DestWordLength);
+				EntryPtr->Phase = XDCFG_READBACK_DATA_SENT;
+			}
+			InstancePtr->QueueIssued++;
+			InstancePtr->QueuePcapBusy = 1U;
+			break;
+		}
+
+		SourcePtr = EntryPtr->SourcePtr & ~0x3U;
+		DestPtr = EntryPtr->DestPtr;
+		if ((EntryPtr->Flags & XDCFG_QUEUE_PARTIAL) == 0U) {
+			SourcePtr |= XDCFG_DMA_LAST_CMD;
+			if ((EntryPtr->TransferType ==
+				XDCFG_CONCURRENT_SECURE_READ_WRITE) ||
+				(EntryPtr->TransferType ==
+				XDCFG_CONCURRENT_NONSEC_READ_WRITE)) {
+				DestPtr = (DestPtr & ~0x3U) |
+						XDCFG_DMA_LAST_CMD;
+			}
+			InstancePtr->QueuePcapBusy = 1U;
+		}
+
+		XDcfg_InitiateDma(InstancePtr, SourcePtr, DestPtr,
+				EntryPtr->SrcWordLength,
+				EntryPtr->DestWordLength);
+		InstancePtr->QueueIssued++;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function removes the oldest transfer from the queue and invokes the
+* queue handler for it.
+*
+* @param	InstancePtr is a pointer to the XDcfg instance.
+* @param	Status is the completion status passed to the queue handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDcfg_QueueComplete(XDcfg *InstancePtr, u32 Status)
+{
+	void *TransferRef;
+
+	TransferRef = InstancePtr->Queue[InstancePtr->QueueHead].TransferRef;
+	InstancePtr->QueueHead = (InstancePtr->QueueHead + 1U) %
+					XDCFG_QUEUE_DEPTH;
+	InstancePtr->QueueCount--;
+
+	if (InstancePtr->QueueHandler != NULL) {
+		InstancePtr->QueueHandler(InstancePtr->QueueRef, TransferRef,
+						Status);
+	}
+}
+/** @} */
@@ -70,6 +70,11 @@
 * 2.2  mus    12/08/16   Remove definition of INLINE macro to avoid re-definition,
 *                         since it is being defined in xil_io.h
 * 2.3 kpc     14/10/16   Fixed the compiler error when optimization O0 is used.
+*     ag      10/14/26   Added the per channel DMA program cache,
+*                        XDmaPs_Start2D() and XDmaPs_StartSg(). The
+*                        transfer body of XDmaPs_BuildDmaProg() is moved to
+*                        XDmaPs_BuildDmaSeg() so that it can be reused for
+*                        scatter-gather segments.
 * </pre>
 *
 *****************************************************************************/
@@ -112,6 +117,12 @@ static void XDmaPs_DoneISR_n(XDmaPs *InstPtr, unsigned Channel);
 static void *XDmaPs_BufPool_Allocate(XDmaPs_ProgBuf *Pool);
 static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 				unsigned CacheLength);
+static int XDmaPs_BuildDmaSeg(char *DmaProgStart, char *DmaProgBuf,
+			       XDmaPs_ChanCtrl *CmdChanCtrl, XDmaPs_BD *BD,
+			       unsigned CacheLength);
+static int XDmaPs_CheckBD(XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_BD *BD);
+static int XDmaPs_GenCachedDmaProg(XDmaPs *InstPtr, unsigned int Channel,
+				    XDmaPs_Cmd *Cmd);
 
 static void XDmaPs_Print_DmaProgBuf(char *Buf, int Length);
 
@@ -749,6 +760,44 @@ static INLINE int XDmaPs_Instr_DMAWMB(char *DmaProg)
 	return 1;
 }
 
+/*
+ * Register number for the DMAADDH instruction
+ */
+#define XDMAPS_ADDH_SAR 0x0
+#define XDMAPS_ADDH_DAR 0x1
+
+/****************************************************************************/
+/**
+*
+* Construction function for DMAADDH instruction. This function fills the
+* program buffer with the constructed instruction.
+*
+* @param	DmaProg is the DMA program buffer, it's the starting address
+*		for the instruction being constructed
+* @param	Ra is the address register, 0 for SAR and 1 for DAR
+* @param	Imm is the 16-bit immediate number added to the register
+*
+* @return 	The number of bytes for this instruction which is 3.
+*
+* @note		None.
+*
+*****************************************************************************/
+static INLINE int XDmaPs_Instr_DMAADDH(char *DmaProg, unsigned Ra, u16 Imm)
+{
+	/*
+	 * DMAADDH encoding
+	 * 15 ... 8 7 6 5 4 3 2 1  0
+	 * imm[7:0] 0 1 0 1 0 1 ra 0
+	 *
+	 * 23 ... 16
+	 * imm[15:8]
+	 */
+	*DmaProg = (u8)(0x54 | ((Ra & 1) << 1));
+	*(DmaProg + 1) = (u8)(Imm & 0xFF);
+	*(DmaProg + 2) = (u8)(Imm >> 8);
+	return 3;
+}
+
 /****************************************************************************/
 /**
 *
@@ -1090,20 +1139,73 @@ int XDmaPs_ConstructNestedLoop(char *DmaProgStart,
 *****************************************************************************/
 static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 				unsigned CacheLength)
+{
+	char *DmaProgBuf = (char *)Cmd->GeneratedDmaProg;
+	char *DmaProgStart = DmaProgBuf;
+	int SegBytes;
+	int DmaProgBytes;
+
+	SegBytes = XDmaPs_BuildDmaSeg(DmaProgStart, DmaProgBuf,
+				       &Cmd->ChanCtrl, &Cmd->BD,
+				       CacheLength);
+	if (SegBytes <= 0) {
+		xil_printf("DMA operation cannot fit in a 2-level "
+			   "loop for channel %d, please reduce the "
+			   "DMA length or increase the burst size or "
+			   "length",
+			   Channel);
+		return 0;
+	}
+	DmaProgBuf += SegBytes;
+
+	DmaProgBuf += XDmaPs_Instr_DMASEV(DmaProgBuf, Channel);
+	DmaProgBuf += XDmaPs_Instr_DMAEND(DmaProgBuf);
+
+	DmaProgBytes = DmaProgBuf - DmaProgStart;
+
+	Xil_DCacheFlushRange((u32)DmaProgStart, DmaProgBytes);
+
+	return DmaProgBytes;
+
+}
+
+/****************************************************************************/
+/**
+*
+* Construct the part of a DMA program that moves one block descriptor: the
+* DMAMOV instructions for SAR and DAR followed by the transfer loops. The
+* program neither signals an event nor ends, so segments can be chained.
+*
+* @param	DmaProgStart is the very start address of the DMA program.
+*		This is used to calculate whether a loop is in a cache line.
+* @param	DmaProgBuf is where the segment is constructed.
+* @param	CmdChanCtrl is the channel control of the transfer.
+* @param	BD is the block descriptor of the transfer.
+* @param	CacheLength is the icache line length, in terms of bytes.
+*		If it's zero, the performance enhancement feature will be
+*		turned off.
+*
+* @returns	The number of bytes for the segment, 0 if the transfer
+*		cannot be constructed.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int XDmaPs_BuildDmaSeg(char *DmaProgStart, char *DmaProgBuf,
+			       XDmaPs_ChanCtrl *CmdChanCtrl, XDmaPs_BD *BD,
+			       unsigned CacheLength)
 {
 	/*
 	 * unpack arguments
 	 */
-	char *DmaProgBuf = (char *)Cmd->GeneratedDmaProg;
-	unsigned DevChan = Channel;
-	unsigned long DmaLength = Cmd->BD.Length;
-	u32 SrcAddr = Cmd->BD.SrcAddr;
+	unsigned long DmaLength = BD->Length;
+	u32 SrcAddr = BD->SrcAddr;
 
-	unsigned SrcInc = Cmd->ChanCtrl.SrcInc;
-	u32 DstAddr = Cmd->BD.DstAddr;
-	unsigned DstInc = Cmd->ChanCtrl.DstInc;
+	unsigned SrcInc = CmdChanCtrl->SrcInc;
+	u32 DstAddr = BD->DstAddr;
+	unsigned DstInc = CmdChanCtrl->DstInc;
 
-	char *DmaProgStart = DmaProgBuf;
+	char *DmaProgSegStart = DmaProgBuf;
 
 	unsigned int BurstBytes;
 	unsigned int LoopCount;
@@ -1111,7 +1213,6 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 	unsigned int LoopResidue = 0;
 	unsigned int TailBytes;
 	unsigned int TailWords;
-	int DmaProgBytes;
 	u32 CCRValue;
 	unsigned int Unaligned;
 	unsigned int UnalignedCount;
@@ -1137,7 +1238,7 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 	Mem2MemByteCC.SrcBurstSize = 1;
 	Mem2MemByteCC.SrcInc = 1;
 
-	ChanCtrl = &Cmd->ChanCtrl;
+	ChanCtrl = CmdChanCtrl;
 
 	/* insert DMAMOV for SAR and DAR */
 	DmaProgBuf += XDmaPs_Instr_DMAMOV(DmaProgBuf,
@@ -1207,11 +1308,6 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 	if (LoopCount > 256) {
 		LoopCount1 = LoopCount / 256;
 		if (LoopCount1 > 256) {
-			xil_printf("DMA operation cannot fit in a 2-level "
-				   "loop for channel %d, please reduce the "
-				   "DMA length or increase the burst size or "
-				   "length",
-				   Channel);
 			return 0;
 		}
 		LoopResidue = LoopCount % 256;
@@ -1304,17 +1400,45 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 		}
 	}
 
-	DmaProgBuf += XDmaPs_Instr_DMASEV(DmaProgBuf, DevChan);
-	DmaProgBuf += XDmaPs_Instr_DMAEND(DmaProgBuf);
+	return DmaProgBuf - DmaProgSegStart;
+}
 
-	DmaProgBytes = DmaProgBuf - DmaProgStart;
 
-	Xil_DCacheFlushRange((u32)DmaProgStart, DmaProgBytes);
+/****************************************************************************/
+/**
+*
+* Check that a block descriptor can be transferred with the channel control.
+*
+* @param	ChanCtrl is the channel control of the transfer.
+* @param	BD is the block descriptor.
+*
+* @return	- XST_SUCCESS if the transfer is supported.
+* 		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int XDmaPs_CheckBD(XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_BD *BD)
+{
+	if (ChanCtrl->SrcBurstSize * ChanCtrl->SrcBurstLen
+	    != ChanCtrl->DstBurstSize * ChanCtrl->DstBurstLen) {
+		return XST_FAILURE;
+	}
 
-	return DmaProgBytes;
 
-}
+	/*
+	 * unaligned fixed address is not supported
+	 */
+	if (!ChanCtrl->SrcInc && BD->SrcAddr % ChanCtrl->SrcBurstSize) {
+		return XST_FAILURE;
+	}
 
+	if (!ChanCtrl->DstInc && BD->DstAddr % ChanCtrl->DstBurstSize) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
 
 /****************************************************************************/
 /**
@@ -1337,7 +1461,6 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 	void *Buf;
 	int ProgLen;
 	XDmaPs_ChannelData *ChanData;
-	XDmaPs_ChanCtrl *ChanCtrl;
 
 	Xil_AssertNonvoid(InstPtr != NULL);
 	Xil_AssertNonvoid(Cmd != NULL);
@@ -1347,22 +1470,8 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 		return XST_FAILURE;
 
 	ChanData = InstPtr->Chans + Channel;
-	ChanCtrl = &Cmd->ChanCtrl;
 
-	if (ChanCtrl->SrcBurstSize * ChanCtrl->SrcBurstLen
-	    != ChanCtrl->DstBurstSize * ChanCtrl->DstBurstLen) {
-		return XST_FAILURE;
-	}
-
-
-	/*
-	 * unaligned fixed address is not supported
-	 */
-	if (!ChanCtrl->SrcInc && Cmd->BD.SrcAddr % ChanCtrl->SrcBurstSize) {
-		return XST_FAILURE;
-	}
-
-	if (!ChanCtrl->DstInc && Cmd->BD.DstAddr % ChanCtrl->DstBurstSize) {
+	if (XDmaPs_CheckBD(&Cmd->ChanCtrl, &Cmd->BD) != XST_SUCCESS) {
 		return XST_FAILURE;
 	}
 
@@ -1393,6 +1502,134 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 }
 
 
+/****************************************************************************/
+/**
+*
+* Generate the DMA program for the DMA command in the program cache of the
+* channel. If the cached program was built for a command with the same
+* channel control, length and address alignment, only its SAR and DAR
+* DMAMOV instructions are rewritten. The GeneratedDmaProg field of the
+* command points to the cache buffer, which is not part of the channel
+* program buffer pool and is overwritten by the next command started on the
+* channel with the cache enabled.
+*
+* @param	InstPtr is then DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Cmd is the DMA command.
+*
+* @return	- XST_SUCCESS on success.
+* 		- XST_FAILURE if it fails
+*
+* @note		The channel must be idle.
+*
+*****************************************************************************/
+static int XDmaPs_GenCachedDmaProg(XDmaPs *InstPtr, unsigned int Channel,
+				    XDmaPs_Cmd *Cmd)
+{
+	XDmaPs_ProgCache *Cache;
+	XDmaPs_ChanCtrl *ChanCtrl;
+	char *DmaProgBuf;
+	u32 SrcAlign = 0;
+	u32 DstAlign = 0;
+	int ProgLen;
+
+	Cache = &InstPtr->Chans[Channel].ProgCache;
+	ChanCtrl = &Cmd->ChanCtrl;
+	DmaProgBuf = Cache->ProgBuf.Buf;
+
+	if (XDmaPs_CheckBD(ChanCtrl, &Cmd->BD) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (ChanCtrl->SrcInc)
+		SrcAlign = Cmd->BD.SrcAddr % ChanCtrl->SrcBurstSize;
+	if (ChanCtrl->DstInc)
+		DstAlign = Cmd->BD.DstAddr % ChanCtrl->DstBurstSize;
+
+	if (Cache->Valid && Cache->Length == Cmd->BD.Length &&
+	    Cache->SrcAlign == SrcAlign && Cache->DstAlign == DstAlign &&
+	    !memcmp(&Cache->ChanCtrl, ChanCtrl, sizeof(XDmaPs_ChanCtrl))) {
+		/*
+		 * same shape, the program starts with the DMAMOV for SAR
+		 * and DAR, rewrite them
+		 */
+		DmaProgBuf += XDmaPs_Instr_DMAMOV(DmaProgBuf,
+						   XDMAPS_MOV_SAR,
+						   Cmd->BD.SrcAddr);
+		DmaProgBuf += XDmaPs_Instr_DMAMOV(DmaProgBuf,
+						   XDMAPS_MOV_DAR,
+						   Cmd->BD.DstAddr);
+		Xil_DCacheFlushRange((u32)Cache->ProgBuf.Buf,
+				     DmaProgBuf - Cache->ProgBuf.Buf);
+
+		Cmd->GeneratedDmaProg = Cache->ProgBuf.Buf;
+		Cmd->GeneratedDmaProgLength = Cache->ProgBuf.Len;
+
+		return XST_SUCCESS;
+	}
+
+	Cache->Valid = 0;
+	Cmd->GeneratedDmaProg = Cache->ProgBuf.Buf;
+	ProgLen = XDmaPs_BuildDmaProg(Channel, Cmd, InstPtr->CacheLength);
+	if (ProgLen <= 0) {
+		Cmd->GeneratedDmaProg = NULL;
+		Cmd->GeneratedDmaProgLength = 0;
+		return XST_FAILURE;
+	}
+	Cmd->GeneratedDmaProgLength = ProgLen;
+
+	Cache->ProgBuf.Len = ProgLen;
+	Cache->ChanCtrl = *ChanCtrl;
+	Cache->Length = Cmd->BD.Length;
+	Cache->SrcAlign = SrcAlign;
+	Cache->DstAlign = DstAlign;
+	Cache->Valid = 1;
+
+#ifdef XDMAPS_DEBUG
+	XDmaPs_Print_DmaProg(Cmd);
+#endif
+
+	return XST_SUCCESS;
+}
+
+
+/****************************************************************************/
+/**
+*
+* Enable or disable the DMA program cache of a channel. With the cache
+* enabled, XDmaPs_Start() builds the program of a command without a
+* generated or user program in the channel program cache and reuses it for
+* following commands of the same shape, which only differ in the source and
+* destination addresses.
+*
+* @param	InstPtr is then DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Enable is 1 to enable the cache, 0 to disable it.
+*
+* @return	- XST_SUCCESS on success.
+* 		- XST_FAILURE if the channel number is invalid.
+*
+* @note		A program held with HoldDmaProg points to the cache buffer
+*		and is changed by the next command started on the channel.
+*
+*****************************************************************************/
+int XDmaPs_SetProgCache(XDmaPs *InstPtr, unsigned int Channel, int Enable)
+{
+	XDmaPs_ProgCache *Cache;
+
+	Xil_AssertNonvoid(InstPtr != NULL);
+
+	if (Channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	Cache = &InstPtr->Chans[Channel].ProgCache;
+	Cache->Valid = 0;
+	Cache->Enabled = Enable ? 1 : 0;
+
+	return XST_SUCCESS;
+}
+
+
 /****************************************************************************/
 /**
  * Free the DMA program buffer that is pointed by the GeneratedDmaProg field
@@ -1475,7 +1712,10 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 		return XST_DEVICE_BUSY;
 
 	if (!Cmd->UserDmaProg && !Cmd->GeneratedDmaProg) {
-		Status = XDmaPs_GenDmaProg(InstPtr, Channel, Cmd);
+		if (InstPtr->Chans[Channel].ProgCache.Enabled)
+			Status = XDmaPs_GenCachedDmaProg(InstPtr, Channel, Cmd);
+		else
+			Status = XDmaPs_GenDmaProg(InstPtr, Channel, Cmd);
 		if (Status)
 			return XST_FAILURE;
 	}
@@ -1519,6 +1759,254 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 	return Status;
 }
 
+/****************************************************************************/
+/**
+*
+* Start a 2D DMA command. The BD field of the command describes the first
+* row; NumRows rows are moved, each one SrcStride bytes after the previous
+* one in the source and DstStride bytes after the previous one in the
+* destination. The whole transfer is a single loop based DMA program, so the
+* CPU is not involved between the rows.
+*
+* @param	InstPtr is then DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Cmd is the DMA command. Its UserDmaProg field must be NULL, a
+*		program held from a previous command is released.
+* @param	NumRows is the number of rows, 1 to XDMAPS_2D_MAX_ROWS.
+* @param	SrcStride is the distance between the source rows in bytes.
+*		It is ignored for a fixed source address.
+* @param	DstStride is the distance between the destination rows in
+*		bytes. It is ignored for a fixed destination address.
+* @param	HoldDmaProg is tag indicating whether the driver can release
+* 		the allocated DMA buffer or not, see XDmaPs_Start().
+*
+* @return
+*		- XST_SUCCESS on success
+*		- XST_DEVICE_BUSY if DMA is busy
+*		- XST_FAILURE on other failures
+*
+* @note		The row length must be a multiple of the burst size times
+*		the burst length, and at most 256 bursts. The gap between rows
+*		(stride minus row length) must be less than 64 KB and the
+*		incrementing addresses must be aligned to the burst size.
+*
+****************************************************************************/
+int XDmaPs_Start2D(XDmaPs *InstPtr, unsigned int Channel,
+		    XDmaPs_Cmd *Cmd, unsigned int NumRows,
+		    u32 SrcStride, u32 DstStride,
+		    int HoldDmaProg)
+{
+	XDmaPs_ChannelData *ChanData;
+	XDmaPs_ChanCtrl *ChanCtrl;
+	char *DmaProgBuf;
+	char *DmaProgStart;
+	char *OuterLoopStart;
+	unsigned int RowLength;
+	unsigned int BurstBytes;
+	unsigned int RowBursts;
+	u32 SrcGap = 0;
+	u32 DstGap = 0;
+	int DmaProgBytes;
+
+	Xil_AssertNonvoid(InstPtr != NULL);
+	Xil_AssertNonvoid(Cmd != NULL);
+
+	if (Channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	if (XDmaPs_IsActive(InstPtr, Channel))
+		return XST_DEVICE_BUSY;
+
+	ChanData = InstPtr->Chans + Channel;
+	ChanCtrl = &Cmd->ChanCtrl;
+	RowLength = Cmd->BD.Length;
+	BurstBytes = ChanCtrl->SrcBurstSize * ChanCtrl->SrcBurstLen;
+
+	if (Cmd->UserDmaProg || NumRows == 0 || NumRows > XDMAPS_2D_MAX_ROWS)
+		return XST_FAILURE;
+
+	if (XDmaPs_CheckBD(ChanCtrl, &Cmd->BD) != XST_SUCCESS ||
+	    BurstBytes == 0 || RowLength % BurstBytes)
+		return XST_FAILURE;
+
+	RowBursts = RowLength / BurstBytes;
+	if (RowBursts == 0 || RowBursts > 256)
+		return XST_FAILURE;
+
+	if (ChanCtrl->SrcInc) {
+		if (Cmd->BD.SrcAddr % ChanCtrl->SrcBurstSize ||
+		    SrcStride < RowLength || SrcStride - RowLength > 0xFFFF)
+			return XST_FAILURE;
+		SrcGap = SrcStride - RowLength;
+	}
+
+	if (ChanCtrl->DstInc) {
+		if (Cmd->BD.DstAddr % ChanCtrl->DstBurstSize ||
+		    DstStride < RowLength || DstStride - RowLength > 0xFFFF)
+			return XST_FAILURE;
+		DstGap = DstStride - RowLength;
+	}
+
+	XDmaPs_FreeDmaProg(InstPtr, Channel, Cmd);
+
+	DmaProgBuf = XDmaPs_BufPool_Allocate(ChanData->ProgBufPool);
+	if (DmaProgBuf == NULL)
+		return XST_FAILURE;
+
+	DmaProgStart = DmaProgBuf;
+
+	DmaProgBuf += XDmaPs_Instr_DMAMOV(DmaProgBuf,
+					   XDMAPS_MOV_SAR,
+					   Cmd->BD.SrcAddr);
+	DmaProgBuf += XDmaPs_Instr_DMAMOV(DmaProgBuf,
+					   XDMAPS_MOV_DAR,
+					   Cmd->BD.DstAddr);
+	DmaProgBuf += XDmaPs_Instr_DMAMOV(DmaProgBuf,
+					   XDMAPS_MOV_CCR,
+					   XDmaPs_ToCCRValue(ChanCtrl));
+
+	/* outer loop over the rows, inner loop over the bursts of a row */
+	DmaProgBuf += XDmaPs_Instr_DMALP(DmaProgBuf, 1, NumRows);
+	OuterLoopStart = DmaProgBuf;
+	DmaProgBuf += XDmaPs_ConstructSingleLoop(DmaProgStart,
+						  InstPtr->CacheLength,
+						  DmaProgBuf,
+						  RowBursts);
+	if (SrcGap)
+		DmaProgBuf += XDmaPs_Instr_DMAADDH(DmaProgBuf,
+						    XDMAPS_ADDH_SAR,
+						    (u16)SrcGap);
+	if (DstGap)
+		DmaProgBuf += XDmaPs_Instr_DMAADDH(DmaProgBuf,
+						    XDMAPS_ADDH_DAR,
+						    (u16)DstGap);
+	DmaProgBuf += XDmaPs_Instr_DMALPEND(DmaProgBuf, OuterLoopStart, 1);
+
+	DmaProgBuf += XDmaPs_Instr_DMASEV(DmaProgBuf, Channel);
+	DmaProgBuf += XDmaPs_Instr_DMAEND(DmaProgBuf);
+
+	DmaProgBytes = DmaProgBuf - DmaProgStart;
+	Xil_DCacheFlushRange((u32)DmaProgStart, DmaProgBytes);
+
+	Cmd->GeneratedDmaProg = DmaProgStart;
+	Cmd->GeneratedDmaProgLength = DmaProgBytes;
+
+#ifdef XDMAPS_DEBUG
+	XDmaPs_Print_DmaProg(Cmd);
+#endif
+
+	/*
+	 * XDmaPs_Start only maintains the first row
+	 */
+	if (ChanCtrl->SrcInc) {
+		Xil_DCacheFlushRange(Cmd->BD.SrcAddr,
+				     (NumRows - 1) * SrcStride + RowLength);
+	}
+	if (ChanCtrl->DstInc) {
+		Xil_DCacheInvalidateRange(Cmd->BD.DstAddr,
+				     (NumRows - 1) * DstStride + RowLength);
+	}
+
+	return XDmaPs_Start(InstPtr, Channel, Cmd, HoldDmaProg);
+}
+
+/****************************************************************************/
+/**
+*
+* Start a scatter-gather DMA command. One DMA program is built for the whole
+* list of block descriptors, all moved with the channel control of the
+* command, and the done interrupt is signaled once after the last one. The
+* CPU is not involved between the block descriptors.
+*
+* @param	InstPtr is then DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Cmd is the DMA command. The program is set as its user
+*		defined DMA program and its BD field is set to the first block
+*		descriptor.
+* @param	BdList is the list of block descriptors.
+* @param	NumBd is the number of block descriptors in the list.
+* @param	ProgBuf is the buffer for the DMA program. It must stay valid
+*		until the command is done.
+* @param	ProgBufLen is the length of ProgBuf in bytes, at least
+*		NumBd * XDMAPS_SG_BD_PROG_LEN + 2.
+*
+* @return
+*		- XST_SUCCESS on success
+*		- XST_DEVICE_BUSY if DMA is busy
+*		- XST_FAILURE on other failures
+*
+* @note		The command can be started again with XDmaPs_Start() to
+*		replay the list, in which case only the cache of the first
+*		block descriptor is maintained by the driver.
+*
+****************************************************************************/
+int XDmaPs_StartSg(XDmaPs *InstPtr, unsigned int Channel,
+		    XDmaPs_Cmd *Cmd, XDmaPs_BD *BdList,
+		    unsigned int NumBd, void *ProgBuf,
+		    unsigned int ProgBufLen)
+{
+	char *DmaProgBuf = (char *)ProgBuf;
+	char *DmaProgStart = (char *)ProgBuf;
+	unsigned int Index;
+	int SegBytes;
+	int DmaProgBytes;
+
+	Xil_AssertNonvoid(InstPtr != NULL);
+	Xil_AssertNonvoid(Cmd != NULL);
+	Xil_AssertNonvoid(BdList != NULL);
+	Xil_AssertNonvoid(ProgBuf != NULL);
+
+	if (Channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	if (XDmaPs_IsActive(InstPtr, Channel))
+		return XST_DEVICE_BUSY;
+
+	if (NumBd == 0 || ProgBufLen < NumBd * XDMAPS_SG_BD_PROG_LEN + 2)
+		return XST_FAILURE;
+
+	for (Index = 0; Index < NumBd; Index++) {
+		if (XDmaPs_CheckBD(&Cmd->ChanCtrl, BdList + Index)
+		    != XST_SUCCESS)
+			return XST_FAILURE;
+	}
+
+	for (Index = 0; Index < NumBd; Index++) {
+		SegBytes = XDmaPs_BuildDmaSeg(DmaProgStart, DmaProgBuf,
+					       &Cmd->ChanCtrl, BdList + Index,
+					       InstPtr->CacheLength);
+		if (SegBytes <= 0)
+			return XST_FAILURE;
+		DmaProgBuf += SegBytes;
+	}
+
+	DmaProgBuf += XDmaPs_Instr_DMASEV(DmaProgBuf, Channel);
+	DmaProgBuf += XDmaPs_Instr_DMAEND(DmaProgBuf);
+
+	DmaProgBytes = DmaProgBuf - DmaProgStart;
+	Xil_DCacheFlushRange((u32)DmaProgStart, DmaProgBytes);
+
+	/*
+	 * XDmaPs_Start only maintains the first block descriptor
+	 */
+	for (Index = 1; Index < NumBd; Index++) {
+		if (Cmd->ChanCtrl.SrcInc) {
+			Xil_DCacheFlushRange(BdList[Index].SrcAddr,
+					     BdList[Index].Length);
+		}
+		if (Cmd->ChanCtrl.DstInc) {
+			Xil_DCacheInvalidateRange(BdList[Index].DstAddr,
+						  BdList[Index].Length);
+		}
+	}
+
+	Cmd->BD = BdList[0];
+	Cmd->UserDmaProg = ProgBuf;
+	Cmd->UserDmaProgLength = DmaProgBytes;
+
+	return XDmaPs_Start(InstPtr, Channel, Cmd, 0);
+}
+
 /****************************************************************************/
 /**
 *
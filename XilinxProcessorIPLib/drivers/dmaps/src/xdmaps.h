@@ -83,6 +83,9 @@
 *                       for CR-965028.
 *       ms     03/17/17 Added readme.txt file in examples folder for doxygen
 *                       generation.
+*       ag     10/14/26 Added per channel DMA program cache for repeated
+*                       transfer shapes, XDmaPs_Start2D for strided copies
+*                       and XDmaPs_StartSg for scatter-gather lists.
 * </pre>
 *
 *****************************************************************************/
@@ -205,6 +208,17 @@ typedef void (*XDmaPsFaultHandler) (unsigned int Channel,
 #define XDMAPS_MAX_CHAN_BUFS	2
 #define XDMAPS_CHAN_BUF_LEN	128
 
+/**
+ * Program buffer space reserved for each block descriptor of a
+ * scatter-gather list, see XDmaPs_StartSg()
+ */
+#define XDMAPS_SG_BD_PROG_LEN	XDMAPS_CHAN_BUF_LEN
+
+/**
+ * Maximum number of rows of a 2D transfer, see XDmaPs_Start2D()
+ */
+#define XDMAPS_2D_MAX_ROWS	256
+
 /**
  * The XDmaPs_ProgBuf is the struct for a DMA program buffer.
  */
@@ -217,6 +231,22 @@ typedef struct {
 					  *  buffer is allocated or not */
 } XDmaPs_ProgBuf;
 
+/**
+ * The XDmaPs_ProgCache is the struct for the cached DMA program of a
+ * channel. A program is reused when a command has the same channel control,
+ * length and address alignment as the one it was built for; only the source
+ * and destination addresses are patched.
+ */
+typedef struct {
+	XDmaPs_ProgBuf ProgBuf;		/**< Cached DMA program */
+	XDmaPs_ChanCtrl ChanCtrl;	/**< Channel control it was built for */
+	unsigned int Length;		/**< Transfer length it was built for */
+	u32 SrcAlign;			/**< Source address alignment */
+	u32 DstAlign;			/**< Destination address alignment */
+	int Valid;			/**< Program buffer holds a program */
+	int Enabled;			/**< Program cache is enabled */
+} XDmaPs_ProgCache;
+
 /**
  * The XDmaPs_ChannelData is a struct to book keep individual channel of
  * the DMAC.
@@ -235,6 +265,7 @@ typedef struct {
 	int HoldDmaProg;		/**< A tag indicating whether to hold the
 					  *  DMA program after the DMA is done.
 					  */
+	XDmaPs_ProgCache ProgCache;	/**< Cached DMA program */
 
 } XDmaPs_ChannelData;
 
@@ -266,6 +297,18 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 		  XDmaPs_Cmd *Cmd,
 		  int HoldDmaProg);
 
+int XDmaPs_Start2D(XDmaPs *InstPtr, unsigned int Channel,
+		    XDmaPs_Cmd *Cmd, unsigned int NumRows,
+		    u32 SrcStride, u32 DstStride,
+		    int HoldDmaProg);
+
+int XDmaPs_StartSg(XDmaPs *InstPtr, unsigned int Channel,
+		    XDmaPs_Cmd *Cmd, XDmaPs_BD *BdList,
+		    unsigned int NumBd, void *ProgBuf,
+		    unsigned int ProgBufLen);
+
+int XDmaPs_SetProgCache(XDmaPs *InstPtr, unsigned int Channel, int Enable);
+
 int XDmaPs_IsActive(XDmaPs *InstPtr, unsigned int Channel);
 int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel,
 		       XDmaPs_Cmd *Cmd);
@@ -308,6 +351,7 @@ extern INLINE int XDmaPs_Instr_DMARMB(char *DmaProg);
 extern INLINE int XDmaPs_Instr_DMASEV(char *DmaProg, unsigned int EventNumber);
 extern INLINE int XDmaPs_Instr_DMAST(char *DmaProg);
 extern INLINE int XDmaPs_Instr_DMAWMB(char *DmaProg);
+extern INLINE int XDmaPs_Instr_DMAADDH(char *DmaProg, unsigned Ra, u16 Imm);
 extern INLINE unsigned XDmaPs_ToEndianSwapSizeBits(unsigned int EndianSwapSize);
 extern INLINE unsigned XDmaPs_ToBurstSizeBits(unsigned BurstSize);
 #endif
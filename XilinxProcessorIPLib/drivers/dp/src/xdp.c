@@ -57,6 +57,9 @@
  * 5.2	 aad  01/21/17 Added training timeout disable for RX MST mode for
  *		       soft-disconnect to work.
  * 6.0	 tu   05/14/17 Added AUX defer to 6
+ * 7.0   ag   10/14/26 Added fast link training from the per-sink training
+ *                     cache. The POST_LT_ADJ_REQ_GRANTED write no longer reads
+ *                     back LANE_COUNT_SET over AUX.
  * </pre>
  *
 *******************************************************************************/
@@ -131,6 +134,12 @@ static u32 XDp_RxInitialize(XDp *InstancePtr);
 #if XPAR_XDPTXSS_NUM_INSTANCES
 /* Training functions. */
 static u32 XDp_TxRunTraining(XDp *InstancePtr);
+static u32 XDp_TxRunFastTraining(XDp *InstancePtr,
+					XDp_TxTrainCacheEntry *Entry);
+static XDp_TxTrainCacheEntry *XDp_TxTrainCacheLookup(XDp *InstancePtr,
+					u8 ReqLinkRate, u8 ReqLaneCount);
+static void XDp_TxTrainCacheStore(XDp *InstancePtr, u8 ReqLinkRate,
+					u8 ReqLaneCount);
 static XDp_TxTrainingState XDp_TxTrainingStateClockRecovery(XDp *InstancePtr);
 static XDp_TxTrainingState XDp_TxTrainingStateChannelEqualization(
 							XDp *InstancePtr);
@@ -144,6 +153,8 @@ static u32 XDp_TxCheckChannelEqualization(XDp *InstancePtr, u8 LaneCount);
 static void XDp_TxSetVswingPreemp(XDp *InstancePtr, u8 *AuxData);
 static u32 XDp_TxAdjVswingPreemp(XDp *InstancePtr);
 static u32 XDp_TxSetTrainingPattern(XDp *InstancePtr, u32 Pattern);
+static u32 XDp_TxSetEqTrainingPattern(XDp *InstancePtr);
+static u32 XDp_TxGrantPostLtAdjReq(XDp *InstancePtr);
 static u32 XDp_TxGetTrainingDelay(XDp *InstancePtr,
 					XDp_TxTrainingState TrainingState);
 /* AUX transaction functions. */
@@ -459,6 +470,9 @@ u32 XDp_TxEstablishLink(XDp *InstancePtr)
 	u32 Status;
 	u32 Status2;
 	u32 ReenableMainLink;
+	u8 ReqLinkRate;
+	u8 ReqLaneCount;
+	XDp_TxTrainCacheEntry *Entry;
 	XDp_TxLinkConfig *LinkConfig = &InstancePtr->TxInstance.LinkConfig;
 
 	/* Verify arguments. */
@@ -487,8 +501,41 @@ u32 XDp_TxEstablishLink(XDp *InstancePtr)
 		return XST_FAILURE;
 	}
 
-	/* Train main link. */
-	Status = XDp_TxRunTraining(InstancePtr);
+	/* Train main link. If this sink was trained before at the requested
+	 * link settings, try the cached outcome first. */
+	ReqLinkRate = LinkConfig->LinkRate;
+	ReqLaneCount = LinkConfig->LaneCount;
+	Entry = XDp_TxTrainCacheLookup(InstancePtr, ReqLinkRate, ReqLaneCount);
+	if (Entry != NULL) {
+		Status = XDp_TxRunFastTraining(InstancePtr, Entry);
+		if (Status != XST_SUCCESS) {
+			/* The cached settings no longer work; fall back to the
+			 * full training sequence from the requested link
+			 * settings. */
+			Entry->Key = 0;
+			Status = XDp_TxSetTrainingPattern(InstancePtr,
+					XDP_TX_TRAINING_PATTERN_SET_OFF);
+			if ((Status == XST_SUCCESS) &&
+					(LinkConfig->LinkRate != ReqLinkRate)) {
+				Status = XDp_TxSetLinkRate(InstancePtr,
+								ReqLinkRate);
+			}
+			if ((Status == XST_SUCCESS) &&
+					(LinkConfig->LaneCount != ReqLaneCount)) {
+				Status = XDp_TxSetLaneCount(InstancePtr,
+								ReqLaneCount);
+			}
+			if (Status == XST_SUCCESS) {
+				Status = XDp_TxRunTraining(InstancePtr);
+			}
+		}
+	}
+	else {
+		Status = XDp_TxRunTraining(InstancePtr);
+	}
+	if (Status == XST_SUCCESS) {
+		XDp_TxTrainCacheStore(InstancePtr, ReqLinkRate, ReqLaneCount);
+	}
 
 	/* Turn off the training pattern and enable scrambler. */
 	Status2 = XDp_TxSetTrainingPattern(InstancePtr,
@@ -585,6 +632,73 @@ void XDp_TxEnableTrainAdaptive(XDp *InstancePtr, u8 Enable)
 	InstancePtr->TxInstance.TrainAdaptive = Enable;
 }
 
+/******************************************************************************/
+/**
+ * This function sets the key that identifies the connected sink in the link
+ * training cache. XDp_TxGetEdid sets the key from the base EDID block, so this
+ * is only required if the EDID is not read through the driver.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Key identifies the sink. 0 disables fast link training.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XDp_TxTrainCacheSetKey(XDp *InstancePtr, u32 Key)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	InstancePtr->TxInstance.TrainCacheKey = Key;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the key that identifies the connected sink in the link
+ * training cache.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	The key of the connected sink, or 0 if none has been set.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XDp_TxTrainCacheGetKey(XDp *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	return InstancePtr->TxInstance.TrainCacheKey;
+}
+
+/******************************************************************************/
+/**
+ * This function discards all entries of the link training cache. The next
+ * XDp_TxEstablishLink call runs the full training sequence.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XDp_TxTrainCacheFlush(XDp *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	memset(InstancePtr->TxInstance.TrainCache, 0,
+				sizeof(InstancePtr->TxInstance.TrainCache));
+	InstancePtr->TxInstance.TrainCacheNext = 0;
+}
+
 /******************************************************************************/
 /**
  * This function sets a software switch that signifies whether or not a redriver
@@ -2238,14 +2352,7 @@ static u32 XDp_TxRunTraining(XDp *InstancePtr)
 	}
 
 	if (InstancePtr->Config.DpProtocol == XDP_PROTOCOL_DP_1_4) {
-		/* Post Link Training ; Write 0x101 bit5 to
-		 * set POST_LT_ADJ_REQ_GRANTED bit */
-		int Data;
-		Status = XDp_TxAuxRead(InstancePtr,
-				       XDP_DPCD_LANE_COUNT_SET, 1, &Data);
-		Data = Data | 0x20;
-		Status = XDp_TxAuxWrite(InstancePtr,
-					XDP_DPCD_LANE_COUNT_SET, 1, &Data);
+		Status = XDp_TxGrantPostLtAdjReq(InstancePtr);
 	}
 
 	/* Final status check. */
@@ -2258,6 +2365,172 @@ static u32 XDp_TxRunTraining(XDp *InstancePtr)
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function runs fast link training using the outcome of a previous
+ * successful training of the same sink. The cached link rate, lane count,
+ * voltage swing and pre-emphasis levels are applied directly, and clock
+ * recovery and channel equalization are each checked once without adjusting
+ * the drive settings.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Entry is the link training cache entry of the connected sink.
+ *
+ * @return
+ *		- XST_SUCCESS if the link trained with the cached settings.
+ *		- XST_FAILURE otherwise. The link rate and lane count may have
+ *		  been changed to the cached values.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxRunFastTraining(XDp *InstancePtr,
+					XDp_TxTrainCacheEntry *Entry)
+{
+	u32 Status;
+	XDp_TxLinkConfig *LinkConfig = &InstancePtr->TxInstance.LinkConfig;
+
+	if (LinkConfig->LinkRate != Entry->LinkRate) {
+		Status = XDp_TxSetLinkRate(InstancePtr, Entry->LinkRate);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+	if (LinkConfig->LaneCount != Entry->LaneCount) {
+		Status = XDp_TxSetLaneCount(InstancePtr, Entry->LaneCount);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	/* Transmit training pattern 1 at the cached drive settings. */
+	LinkConfig->VsLevel = Entry->VsLevel;
+	LinkConfig->PeLevel = Entry->PeLevel;
+	Status = XDp_TxSetTrainingPattern(InstancePtr,
+					XDP_TX_TRAINING_PATTERN_SET_TP1);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	XDp_WaitUs(InstancePtr, XDp_TxGetTrainingDelay(InstancePtr,
+						XDP_TX_TS_CLOCK_RECOVERY));
+	Status = XDp_TxGetLaneStatusAdjReqs(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	Status = XDp_TxCheckClockRecovery(InstancePtr, LinkConfig->LaneCount);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Transmit training pattern 2/3/4 with the same drive settings. */
+	Status = XDp_TxSetEqTrainingPattern(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	XDp_WaitUs(InstancePtr, XDp_TxGetTrainingDelay(InstancePtr,
+					XDP_TX_TS_CHANNEL_EQUALIZATION));
+	Status = XDp_TxGetLaneStatusAdjReqs(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	if ((XDp_TxCheckClockRecovery(InstancePtr,
+				LinkConfig->LaneCount) != XST_SUCCESS) ||
+			(XDp_TxCheckChannelEqualization(InstancePtr,
+				LinkConfig->LaneCount) != XST_SUCCESS)) {
+		return XST_FAILURE;
+	}
+
+	if (InstancePtr->Config.DpProtocol == XDP_PROTOCOL_DP_1_4) {
+		Status = XDp_TxGrantPostLtAdjReq(InstancePtr);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function finds the link training cache entry of the connected sink for
+ * the requested link rate and lane count.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	ReqLinkRate is the link rate requested for training.
+ * @param	ReqLaneCount is the lane count requested for training.
+ *
+ * @return	A pointer to the entry, or NULL if there is none.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XDp_TxTrainCacheEntry *XDp_TxTrainCacheLookup(XDp *InstancePtr,
+					u8 ReqLinkRate, u8 ReqLaneCount)
+{
+	u8 Index;
+	XDp_TxTrainCacheEntry *Entry;
+	u32 Key = InstancePtr->TxInstance.TrainCacheKey;
+
+	if (Key == 0) {
+		return NULL;
+	}
+
+	for (Index = 0; Index < XDP_TX_TRAIN_CACHE_ENTRIES; Index++) {
+		Entry = &InstancePtr->TxInstance.TrainCache[Index];
+		if ((Entry->Key == Key) &&
+				(Entry->ReqLinkRate == ReqLinkRate) &&
+				(Entry->ReqLaneCount == ReqLaneCount)) {
+			return Entry;
+		}
+	}
+
+	return NULL;
+}
+
+/******************************************************************************/
+/**
+ * This function records the current link settings as the outcome of a
+ * successful training of the connected sink. An existing entry for the same
+ * sink and requested link settings is updated; otherwise the oldest entry is
+ * replaced.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	ReqLinkRate is the link rate requested for training.
+ * @param	ReqLaneCount is the lane count requested for training.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XDp_TxTrainCacheStore(XDp *InstancePtr, u8 ReqLinkRate,
+					u8 ReqLaneCount)
+{
+	XDp_TxTrainCacheEntry *Entry;
+	XDp_TxLinkConfig *LinkConfig = &InstancePtr->TxInstance.LinkConfig;
+
+	if (InstancePtr->TxInstance.TrainCacheKey == 0) {
+		return;
+	}
+
+	Entry = XDp_TxTrainCacheLookup(InstancePtr, ReqLinkRate, ReqLaneCount);
+	if (Entry == NULL) {
+		Entry = &InstancePtr->TxInstance.TrainCache[
+				InstancePtr->TxInstance.TrainCacheNext];
+		InstancePtr->TxInstance.TrainCacheNext =
+				(InstancePtr->TxInstance.TrainCacheNext + 1) %
+				XDP_TX_TRAIN_CACHE_ENTRIES;
+	}
+
+	Entry->Key = InstancePtr->TxInstance.TrainCacheKey;
+	Entry->ReqLinkRate = ReqLinkRate;
+	Entry->ReqLaneCount = ReqLaneCount;
+	Entry->LinkRate = LinkConfig->LinkRate;
+	Entry->LaneCount = LinkConfig->LaneCount;
+	Entry->VsLevel = LinkConfig->VsLevel;
+	Entry->PeLevel = LinkConfig->PeLevel;
+}
+
 /******************************************************************************/
 /**
  * This function runs the clock recovery sequence as part of link training. The
@@ -2420,23 +2693,7 @@ static XDp_TxTrainingState XDp_TxTrainingStateChannelEqualization(
 
 	/* Write the current drive settings. */
 	/* Transmit training pattern 2/3. */
-	if (InstancePtr->TxInstance.RxConfig.
-				DpcdRxCapsField[XDP_DPCD_MAX_DOWNSPREAD] &
-				XDP_DPCD_TPS4_SUPPORT_MASK) {
-		if (InstancePtr->Config.DpProtocol == XDP_PROTOCOL_DP_1_4) {
-			Status = XDp_TxSetTrainingPattern(InstancePtr,
-					XDP_TX_TRAINING_PATTERN_SET_TP4);
-		}
-	} else if (InstancePtr->TxInstance.RxConfig.
-				DpcdRxCapsField[XDP_DPCD_MAX_LANE_COUNT] &
-				XDP_DPCD_TPS3_SUPPORT_MASK) {
-		Status = XDp_TxSetTrainingPattern(InstancePtr,
-					XDP_TX_TRAINING_PATTERN_SET_TP3);
-	} else {
-		Status = XDp_TxSetTrainingPattern(InstancePtr,
-					XDP_TX_TRAINING_PATTERN_SET_TP2);
-	}
-	
+	Status = XDp_TxSetEqTrainingPattern(InstancePtr);
 	if (Status != XST_SUCCESS) {
 		return XDP_TX_TS_FAILURE;
 	}
@@ -3045,6 +3302,81 @@ static u32 XDp_TxSetTrainingPattern(XDp *InstancePtr, u32 Pattern)
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function sets the training pattern used for channel equalization: TP4
+ * if supported by the RX device (DP 1.4 only), else TP3 if supported, else TP2.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return
+ *		- XST_SUCCESS if setting the pattern was successful.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxSetEqTrainingPattern(XDp *InstancePtr)
+{
+	u32 Status = XST_SUCCESS;
+
+	if (InstancePtr->TxInstance.RxConfig.
+				DpcdRxCapsField[XDP_DPCD_MAX_DOWNSPREAD] &
+				XDP_DPCD_TPS4_SUPPORT_MASK) {
+		if (InstancePtr->Config.DpProtocol == XDP_PROTOCOL_DP_1_4) {
+			Status = XDp_TxSetTrainingPattern(InstancePtr,
+					XDP_TX_TRAINING_PATTERN_SET_TP4);
+		}
+	} else if (InstancePtr->TxInstance.RxConfig.
+				DpcdRxCapsField[XDP_DPCD_MAX_LANE_COUNT] &
+				XDP_DPCD_TPS3_SUPPORT_MASK) {
+		Status = XDp_TxSetTrainingPattern(InstancePtr,
+					XDP_TX_TRAINING_PATTERN_SET_TP3);
+	} else {
+		Status = XDp_TxSetTrainingPattern(InstancePtr,
+					XDP_TX_TRAINING_PATTERN_SET_TP2);
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+ * This function sets POST_LT_ADJ_REQ_GRANTED in the RX device's LANE_COUNT_SET
+ * register after link training (DP 1.4). The register is rebuilt from the lane
+ * count and enhanced frame mode programmed in the DisplayPort TX core, which
+ * avoids an AUX read of the current value.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the AUX write was successful.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxGrantPostLtAdjReq(XDp *InstancePtr)
+{
+	u32 Status;
+	u8 RegVal;
+
+	RegVal = InstancePtr->TxInstance.LinkConfig.LaneCount |
+				XDP_DPCD_POST_LT_ADJ_REQ_GRANTED_MASK;
+	if (XDp_ReadReg(InstancePtr->Config.BaseAddr,
+					XDP_TX_ENHANCED_FRAME_EN) & 0x1) {
+		RegVal |= XDP_DPCD_ENHANCED_FRAME_EN_MASK;
+	}
+
+	Status = XDp_TxAuxWrite(InstancePtr, XDP_DPCD_LANE_COUNT_SET, 1,
+								&RegVal);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
 /******************************************************************************/
 /**
  * This function determines what the RX device's required training delay is for
@@ -281,6 +281,30 @@
  * audio source connected to the Displayport TX instance and set up the audio
  * info frame as per user requirements.
  *
+ * <b>Link training cache: TX mode of operation</b>
+ *
+ * The TX driver keeps the outcome of the last successful link training for a
+ * small number of sinks. Each sink is identified by a 32-bit key which
+ * XDp_TxGetEdid derives from the base EDID block; applications that identify
+ * sinks by other means may set the key with XDp_TxTrainCacheSetKey. When
+ * XDp_TxEstablishLink finds an entry for the current key and requested link
+ * rate and lane count, it first attempts fast link training: the cached link
+ * rate, lane count, voltage swing and pre-emphasis are applied directly and
+ * both clock recovery and channel equalization are checked once. If either
+ * check fails the entry is discarded and the full training sequence is run
+ * from the requested link settings. A key of 0 disables the cache; the key is
+ * invalid after the sink is replaced until the EDID is read again, but since
+ * the fast path is always verified such a stale key only costs one attempt.
+ *
+ * <b>EDID cache: TX mode of operation</b>
+ *
+ * XDp_TxGetEdid keeps a copy of the immediately connected sink's base EDID
+ * block and returns it without AUX transactions until the cache is
+ * invalidated. The TX interrupt handler invalidates the cache on every HPD
+ * event, before the HPD event handlers are invoked. Applications that do not
+ * use the interrupt handler must call XDp_TxInvalidateEdidCache on a hot-plug.
+ * XDp_TxGetEdidBlock and the remote EDID functions always read the sink.
+ *
  * <b>Asserts</b>
  *
  * Asserts are used within all Xilinx drivers to enforce constraints on argument
@@ -376,6 +400,11 @@
  *                     DrvHpdEventHandler and DrvHpdPulseHandler
  * 6.0   tu   09/08/17 Added three interrupt handler that addresses callback
  *                     function of driver
+ * 7.0   ag   10/14/26 Added a per-sink link training cache used for fast link
+ *                     training. New APIs: XDp_TxTrainCacheSetKey,
+ *                     XDp_TxTrainCacheFlush, XDp_TxTrainCacheGetKey.
+ *       ag   10/14/26 XDp_TxGetEdid caches the base EDID block until the next
+ *                     HPD event. New API: XDp_TxInvalidateEdidCache.
  * </pre>
  *
 *******************************************************************************/
@@ -392,6 +421,11 @@
 #include "xstatus.h"
 #include "xvidc.h"
 
+/**************************** Constant Definitions ****************************/
+
+/* The number of sinks whose link training results are cached by the TX. */
+#define XDP_TX_TRAIN_CACHE_ENTRIES 4
+
 /****************************** Type Definitions ******************************/
 
 /**
@@ -640,6 +674,26 @@ typedef struct {
 					pre-emphasis is used. */
 } XDp_TxBoardChar;
 
+/**
+ * This typedef describes the outcome of a successful link training for a sink,
+ * as used by fast link training.
+ */
+typedef struct {
+	u32 Key;		/**< The key identifying the sink, derived from
+					its EDID. 0 if the entry is unused. */
+	u8 ReqLinkRate;		/**< The link rate requested when training
+					started. */
+	u8 ReqLaneCount;	/**< The lane count requested when training
+					started. */
+	u8 LinkRate;		/**< The link rate the link was trained at. */
+	u8 LaneCount;		/**< The lane count the link was trained
+					at. */
+	u8 VsLevel;		/**< The voltage swing level at the end of
+					training. */
+	u8 PeLevel;		/**< The pre-emphasis level at the end of
+					training. */
+} XDp_TxTrainCacheEntry;
+
 /**
  * This typedef describes a downstream DisplayPort device when the driver is
  * running in multi-stream transport (MST) mode.
@@ -863,6 +917,22 @@ typedef struct {
 							during training. */
 	u8 IsTps4Supported;		/**< Is TPS4 supported by the
 							downstream sink */
+	u32 TrainCacheKey;			/**< Key of the connected sink
+							in the link training
+							cache. 0 disables fast
+							link training. */
+	u8 TrainCacheNext;			/**< Next cache entry to be
+							replaced. */
+	XDp_TxTrainCacheEntry TrainCache[XDP_TX_TRAIN_CACHE_ENTRIES];
+						/**< Outcome of the last
+							successful link
+							training per sink. */
+	u8 EdidCacheValid;			/**< EdidCache holds the base
+							EDID block of the
+							connected sink. */
+	u8 EdidCache[XDP_EDID_BLOCK_SIZE];	/**< Copy of the base EDID
+							block of the connected
+							sink. */
 	XDp_TxSinkConfig RxConfig;		/**< Configuration structure for
 							the RX device. */
 	XDp_TxLinkConfig LinkConfig;		/**< Configuration structure for
@@ -1229,6 +1299,9 @@ u32 XDp_TxCfgMainLinkMax(XDp *InstancePtr);
 u32 XDp_TxEstablishLink(XDp *InstancePtr);
 u32 XDp_TxCheckLinkStatus(XDp *InstancePtr, u8 LaneCount);
 void XDp_TxEnableTrainAdaptive(XDp *InstancePtr, u8 Enable);
+void XDp_TxTrainCacheSetKey(XDp *InstancePtr, u32 Key);
+u32 XDp_TxTrainCacheGetKey(XDp *InstancePtr);
+void XDp_TxTrainCacheFlush(XDp *InstancePtr);
 void XDp_TxSetHasRedriverInPath(XDp *InstancePtr, u8 Set);
 void XDp_TxCfgTxVsOffset(XDp *InstancePtr, u8 Offset);
 void XDp_TxCfgTxVsLevel(XDp *InstancePtr, u8 Level, u8 TxLevel);
@@ -1289,6 +1362,7 @@ void XDp_RxVSCDis(XDp *InstancePtr);
 #if XPAR_XDPTXSS_NUM_INSTANCES
 /* xdp_edid.c: EDID utility functions. */
 u32 XDp_TxGetEdid(XDp *InstancePtr, u8 *Edid);
+void XDp_TxInvalidateEdidCache(XDp *InstancePtr);
 u32 XDp_TxGetRemoteEdid(XDp *InstancePtr, u8 LinkCountTotal,
 						u8 *RelativeAddress, u8 *Edid);
 u32 XDp_TxGetEdidBlock(XDp *InstancePtr, u8 *Data, u8 BlockNum);
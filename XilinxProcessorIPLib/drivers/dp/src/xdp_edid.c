@@ -48,14 +48,23 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als  01/20/15 Initial release. TX code merged from the dptx driver.
+ * 7.0   ag   10/14/26 XDp_TxGetEdid sets the link training cache key.
+ *       ag   10/14/26 XDp_TxGetEdid caches the base EDID block.
  * </pre>
  *
 *******************************************************************************/
 
 /******************************* Include Files ********************************/
 
+#include <string.h>
 #include "xdp.h"
 
+/**************************** Function Prototypes *****************************/
+
+#if XPAR_XDPTXSS_NUM_INSTANCES
+static u32 XDp_TxEdidKey(u8 *Edid);
+#endif /* XPAR_XDPTXSS_NUM_INSTANCES */
+
 /**************************** Function Definitions ****************************/
 
 #if XPAR_XDPTXSS_NUM_INSTANCES
@@ -74,7 +83,8 @@
  *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
  *		- XST_FAILURE otherwise.
  *
- * @note	None.
+ * @note	Once read, the base EDID block is returned from the EDID cache
+ *		until the next HPD event or XDp_TxInvalidateEdidCache call.
  *
 *******************************************************************************/
 u32 XDp_TxGetEdid(XDp *InstancePtr, u8 *Edid)
@@ -87,12 +97,47 @@ u32 XDp_TxGetEdid(XDp *InstancePtr, u8 *Edid)
 	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
 	Xil_AssertNonvoid(Edid != NULL);
 
+	if (InstancePtr->TxInstance.EdidCacheValid) {
+		memcpy(Edid, InstancePtr->TxInstance.EdidCache,
+							XDP_EDID_BLOCK_SIZE);
+		return XST_SUCCESS;
+	}
+
 	/* Retrieve the base EDID block = EDID block #0. */
 	Status = XDp_TxGetEdidBlock(InstancePtr, Edid, 0);
+	if (Status == XST_SUCCESS) {
+		memcpy(InstancePtr->TxInstance.EdidCache, Edid,
+							XDP_EDID_BLOCK_SIZE);
+		InstancePtr->TxInstance.EdidCacheValid = 1;
+
+		/* Identify the sink in the link training cache. */
+		InstancePtr->TxInstance.TrainCacheKey = XDp_TxEdidKey(Edid);
+	}
 
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * This function invalidates the EDID cache. The next XDp_TxGetEdid call reads
+ * the base EDID block from the RX device.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	None.
+ *
+ * @note	The TX interrupt handler calls this on every HPD event.
+ *
+*******************************************************************************/
+void XDp_TxInvalidateEdidCache(XDp *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	InstancePtr->TxInstance.EdidCacheValid = 0;
+}
+
 /******************************************************************************/
 /**
  * This function retrieves a remote RX device's Extended Display Identification
@@ -417,5 +462,29 @@ u32 XDp_TxGetRemoteTiledDisplayDb(XDp *InstancePtr, u8 *EdidExt,
 
 	return XST_SUCCESS;
 }
+
+/******************************************************************************/
+/**
+ * This function derives the link training cache key of a sink from its base
+ * EDID block, using the 32-bit FNV-1a hash.
+ *
+ * @param	Edid is a pointer to the base EDID block.
+ *
+ * @return	The key of the sink. Never 0, which disables the cache.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxEdidKey(u8 *Edid)
+{
+	u32 Key = 0x811C9DC5;
+	u8 Index;
+
+	for (Index = 0; Index < XDP_EDID_BLOCK_SIZE; Index++) {
+		Key = (Key ^ Edid[Index]) * 0x01000193;
+	}
+
+	return (Key == 0) ? 1 : Key;
+}
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 /** @} */
@@ -2644,6 +2644,7 @@
 #define XDP_DPCD_LANE_COUNT_SET_1				0x01
 #define XDP_DPCD_LANE_COUNT_SET_2				0x02
 #define XDP_DPCD_LANE_COUNT_SET_4				0x04
+#define XDP_DPCD_POST_LT_ADJ_REQ_GRANTED_MASK			0x20
 #define XDP_DPCD_ENHANCED_FRAME_EN_MASK				0x80
 /* 0x00102: TP_SET */
 #define XDP_DPCD_TP_SEL_MASK					0x03
@@ -58,6 +58,7 @@
  *                     DrvHpdEventHandler and DrvHpdPulseHandler
  * 6.0   tu   09/08/17 Added three interrupt handler that addresses callback
  *                     function of application
+ * 7.0   ag   10/14/26 Invalidate the EDID cache on HPD events.
  * </pre>
  *
 *******************************************************************************/
@@ -652,6 +653,9 @@ static void XDp_TxInterruptHandler(XDp *InstancePtr)
 				XDP_TX_INTERRUPT_STATUS_HPD_PULSE_DETECTED_MASK;
 
 	if (HpdEventDetected) {
+		/* The sink may have been replaced. */
+		XDp_TxInvalidateEdidCache(InstancePtr);
+
 		if (InstancePtr->TxInstance.DrvHpdEventHandler)
 			InstancePtr->TxInstance.DrvHpdEventHandler(
 				InstancePtr->TxInstance.DrvHpdEventCallbackRef);
@@ -46,12 +46,15 @@
  * Ver	Who   Date     Changes
  * ---- ----- -------- ----------------------------------------------------
  * 1.0  aad   04/12/16 Initial release.
+ *      ag    10/14/26 Added display lists with partial and queued flips.
  *
  *****************************************************************************/
 
 /***************************** Include Files **********************************/
+#include <string.h>
 #include "xdpdma.h"
 #include "xavbuf.h"
+#include "xil_cache.h"
 
 /************************** Constant Definitions ******************************/
 #define XDPDMA_CH_OFFSET		0x100
@@ -75,6 +78,9 @@
 #define XDPDMA_QOS_MIN			4
 #define XDPDMA_QOS_MAX			11
 
+#define XDPDMA_DLIST_NONE		0xFF
+#define XDPDMA_DLIST_SLOTS		(XDPDMA_FLIP_QUEUE_DEPTH + 1)
+
 /*************************************************************************/
 /**
  *
@@ -227,6 +233,99 @@ static XDpDma_Descriptor *XDpDma_UpdateVideoDescriptor(XDpDma_Channel *Channel)
 	return Channel->Current;
 }
 
+/*************************************************************************/
+/**
+ *
+ * This function returns the Video/Graphics channel structure for a channel
+ * type and plane.
+ *
+ * @param    InstancePtr is a pointer to the driver instance.
+ * @param    Channel is VideoChan or GraphicsChan.
+ * @param    Plane is the video plane; 0 for the graphics channel.
+ *
+ * @return   Pointer to the channel, or NULL if Channel or Plane is invalid.
+ *
+ * @note     None.
+ *
+ * **************************************************************************/
+static XDpDma_Channel *XDpDma_GetChannel(XDpDma *InstancePtr,
+					 XDpDma_ChannelType Channel, u8 Plane)
+{
+	if((Channel == VideoChan) && (Plane <= XDPDMA_VIDEO_CHANNEL2)) {
+		return &InstancePtr->Video.Channel[Plane];
+	}
+	else if((Channel == GraphicsChan) && (Plane == 0)) {
+		return &InstancePtr->Gfx.Channel;
+	}
+	return NULL;
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function patches the source address of a display list band
+ * descriptor.
+ *
+ * @param    Desc is a pointer to the band descriptor.
+ * @param    Address is the new source address of the band.
+ *
+ * @return   None.
+ *
+ * @note     None.
+ *
+ * **************************************************************************/
+static void XDpDma_PatchSrcAddr(XDpDma_Descriptor *Desc, u64 Address)
+{
+	Desc->ADDR_EXT = (Desc->ADDR_EXT &
+			  ~XDPDMA_DESCRIPTOR_ADDR_EXT_SRC_ADDR_EXT_MASK) |
+			 ((Address >> XDPDMA_DESCRIPTOR_SRC_ADDR_WIDTH) <<
+			  XDPDMA_DESCRIPTOR_ADDR_EXT_SRC_ADDR_EXT_SHIFT);
+	Desc->SRC_ADDR = Address;
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function consumes the oldest queued flip of a display list. The
+ * chain that is not being fetched is patched where its band addresses differ
+ * from the flip, and becomes the current descriptor of the channel.
+ *
+ * @param    Channel is a pointer to the channel owning the display list.
+ *
+ * @return   None.
+ *
+ * @note     Called on VSync. Nothing changes if no flip is queued.
+ *
+ * **************************************************************************/
+static void XDpDma_DisplayListFlip(XDpDma_Channel *Channel)
+{
+	XDpDma_DisplayList *List = Channel->List;
+	u64 *Flip;
+	u8 Next;
+	u8 Index;
+
+	if(!XDpDma_DisplayListPending(List)) {
+		return;
+	}
+
+	Next = (List->Active == XDPDMA_DLIST_NONE) ? 0 : List->Active ^ 1;
+	Flip = List->Queue[List->QueueHead];
+	for(Index = 0; Index < List->NumBands; Index++) {
+		if(List->ChainAddr[Next][Index] != Flip[Index]) {
+			XDpDma_PatchSrcAddr(
+				&List->Chain[Next][Index].Descriptor,
+				Flip[Index]);
+			List->ChainAddr[Next][Index] = Flip[Index];
+		}
+	}
+	Xil_DCacheFlushRange((INTPTR) List->Chain[Next],
+			     List->NumBands * sizeof(XDpDma_DisplayListBand));
+
+	List->QueueHead = (List->QueueHead + 1) % XDPDMA_DLIST_SLOTS;
+	List->Active = Next;
+	Channel->Current = &List->Chain[Next][0].Descriptor;
+}
+
 /*************************************************************************/
 /**
  * This function programs the address of the descriptor about to be active
@@ -352,7 +451,12 @@ void XDpDma_CfgInitialize(XDpDma *InstancePtr, XDpDma_Config *CfgPtr)
 	InstancePtr->Video.FrameBuffer[XDPDMA_VIDEO_CHANNEL1] = NULL;
 	InstancePtr->Video.FrameBuffer[XDPDMA_VIDEO_CHANNEL2] = NULL;
 
+	InstancePtr->Video.Channel[XDPDMA_VIDEO_CHANNEL0].List = NULL;
+	InstancePtr->Video.Channel[XDPDMA_VIDEO_CHANNEL1].List = NULL;
+	InstancePtr->Video.Channel[XDPDMA_VIDEO_CHANNEL2].List = NULL;
+
 	InstancePtr->Gfx.Channel.Current = NULL;
+	InstancePtr->Gfx.Channel.List = NULL;
 	InstancePtr->Gfx.TriggerStatus = XDPDMA_TRIGGER_DONE;
 	InstancePtr->Gfx.VideoInfo = NULL;
 	InstancePtr->Gfx.FrameBuffer = NULL;
@@ -927,9 +1031,15 @@ void XDpDma_SetupChannel(XDpDma *InstancePtr, XDpDma_ChannelType Channel)
 			NumPlanes = InstancePtr->Video.VideoInfo->Mode;
 			for(Index = 0; Index <= NumPlanes; Index++) {
 				Chan = &InstancePtr->Video.Channel[Index];
-				FB = InstancePtr->Video.FrameBuffer[Index];
-				XDpDma_UpdateVideoDescriptor(Chan);
-				XDpDma_InitVideoDescriptor(Chan->Current, FB);
+				if(Chan->List != NULL) {
+					XDpDma_DisplayListFlip(Chan);
+				}
+				else {
+					FB = InstancePtr->Video.FrameBuffer[Index];
+					XDpDma_UpdateVideoDescriptor(Chan);
+					XDpDma_InitVideoDescriptor(Chan->Current,
+								   FB);
+				}
 				XDpDma_SetDescriptorAddress(InstancePtr,
 							    Index);
 			}
@@ -937,11 +1047,17 @@ void XDpDma_SetupChannel(XDpDma *InstancePtr, XDpDma_ChannelType Channel)
 
 		case GraphicsChan:
 			Xil_AssertVoid(InstancePtr->Gfx.VideoInfo != NULL);
-			Xil_AssertVoid(InstancePtr->Gfx.FrameBuffer != NULL);
 			Chan = &InstancePtr->Gfx.Channel;
-			FB = InstancePtr->Gfx.FrameBuffer;
-			XDpDma_UpdateVideoDescriptor(Chan);
-			XDpDma_InitVideoDescriptor(Chan->Current, FB);
+			if(Chan->List != NULL) {
+				XDpDma_DisplayListFlip(Chan);
+			}
+			else {
+				Xil_AssertVoid(InstancePtr->Gfx.FrameBuffer !=
+					       NULL);
+				FB = InstancePtr->Gfx.FrameBuffer;
+				XDpDma_UpdateVideoDescriptor(Chan);
+				XDpDma_InitVideoDescriptor(Chan->Current, FB);
+			}
 			XDpDma_SetDescriptorAddress(InstancePtr,
 						    XDPDMA_GRAPHICS_CHANNEL);
 			break;
@@ -964,3 +1080,218 @@ void XDpDma_SetupChannel(XDpDma *InstancePtr, XDpDma_ChannelType Channel)
 			break;
 	}
 }
+
+/*************************************************************************/
+/**
+ *
+ * This function attaches a display list to a Video plane or the Graphics
+ * channel. Both descriptor chains of the list are built for the geometry of
+ * FrameBuffer, and a flip to FrameBuffer is queued.
+ *
+ * @param    InstancePtr is pointer to the instance of DPDMA.
+ * @param    Channel is VideoChan or GraphicsChan.
+ * @param    Plane is the video plane; 0 for the graphics channel.
+ * @param    List is a pointer to the display list to use.
+ * @param    FrameBuffer is the first frame buffer to display. Its geometry
+ *	     applies to all buffers later flipped to.
+ * @param    NumBands is the number of bands to split the frame into, in the
+ *	     range [1, XDPDMA_DISPLAY_LIST_MAX_BANDS].
+ *
+ * @return   XST_SUCCESS if the display list was attached.
+ *	     XST_INVALID_PARAM if Channel or Plane is invalid.
+ *	     XST_DEVICE_BUSY if the channel is already fetching frames.
+ *
+ * @note     The list must stay allocated for as long as the channel runs.
+ *
+ **************************************************************************/
+int XDpDma_SetDisplayList(XDpDma *InstancePtr, XDpDma_ChannelType Channel,
+			  u8 Plane, XDpDma_DisplayList *List,
+			  XDpDma_FrameBuffer *FrameBuffer, u8 NumBands)
+{
+	XDpDma_Channel *Chan;
+	XDpDma_Descriptor *Desc;
+	XDpDma_Descriptor *Next;
+	u32 FirstLine;
+	u32 Lines;
+	u8 Index;
+	u8 Band;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(List != NULL);
+	Xil_AssertNonvoid(FrameBuffer != NULL);
+	Xil_AssertNonvoid(FrameBuffer->LineSize != 0);
+	Xil_AssertNonvoid((FrameBuffer->Stride) % XDPDMA_DESCRIPTOR_ALIGN == 0);
+	Xil_AssertNonvoid((NumBands >= 1) &&
+			  (NumBands <= XDPDMA_DISPLAY_LIST_MAX_BANDS));
+
+	Chan = XDpDma_GetChannel(InstancePtr, Channel, Plane);
+	if(Chan == NULL) {
+		return XST_INVALID_PARAM;
+	}
+	if(Chan->Current != NULL) {
+		return XST_DEVICE_BUSY;
+	}
+
+	List->Stride = FrameBuffer->Stride;
+	List->LineSize = FrameBuffer->LineSize;
+	List->Height = FrameBuffer->Size / FrameBuffer->LineSize;
+	List->BandLines = (List->Height + NumBands - 1) / NumBands;
+	List->NumBands = (List->Height + List->BandLines - 1) /
+			 List->BandLines;
+	List->Active = XDPDMA_DLIST_NONE;
+	List->QueueHead = 0;
+	List->QueueTail = 0;
+
+	/* Build both chains once; flips only patch source addresses. */
+	for(Index = 0; Index < 2; Index++) {
+		for(Band = 0; Band < List->NumBands; Band++) {
+			Desc = &List->Chain[Index][Band].Descriptor;
+			FirstLine = Band * List->BandLines;
+			Lines = List->Height - FirstLine;
+			if(Lines > List->BandLines) {
+				Lines = List->BandLines;
+			}
+			List->ChainAddr[Index][Band] = FrameBuffer->Address +
+				(u64)FirstLine * List->Stride;
+			List->Last[Band] = List->ChainAddr[Index][Band];
+
+			/* The last band ends the frame and loops back to the
+			 * first one, like the single frame descriptor. */
+			XDpDma_InitVideoDescriptor(Desc, FrameBuffer);
+			if(Band != List->NumBands - 1) {
+				Desc->Control &= ~XDPDMA_DESC_LAST_FRAME;
+				Next = &List->Chain[Index][Band + 1].Descriptor;
+			}
+			else {
+				Next = &List->Chain[Index][0].Descriptor;
+			}
+			Desc->ADDR_EXT &= ~XDPDMA_DESCRIPTOR_ADDR_EXT_DSC_NXT_MASK;
+			Desc->ADDR_EXT |= (INTPTR) Next >>
+					  XDPDMA_DESCRIPTOR_NEXT_DESR_WIDTH;
+			Desc->NEXT_DESR = (INTPTR) Next;
+			Desc->XFER_SIZE = Lines * List->LineSize;
+			XDpDma_PatchSrcAddr(Desc, List->ChainAddr[Index][Band]);
+		}
+		Xil_DCacheFlushRange((INTPTR) List->Chain[Index],
+				List->NumBands * sizeof(XDpDma_DisplayListBand));
+	}
+
+	Chan->List = List;
+
+	return XDpDma_QueueFlip(InstancePtr, Channel, Plane,
+				FrameBuffer->Address);
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function queues a flip of all bands of a display list to a new frame
+ * buffer. The flip takes effect on a following VSync.
+ *
+ * @param    InstancePtr is pointer to the instance of DPDMA.
+ * @param    Channel is VideoChan or GraphicsChan.
+ * @param    Plane is the video plane; 0 for the graphics channel.
+ * @param    Address is the address of the new frame buffer, with the
+ *	     geometry given to XDpDma_SetDisplayList.
+ *
+ * @return   XST_SUCCESS if the flip was queued.
+ *	     XST_INVALID_PARAM if the channel has no display list.
+ *	     XST_DEVICE_BUSY if XDPDMA_FLIP_QUEUE_DEPTH flips are pending.
+ *
+ * @note     None.
+ *
+ **************************************************************************/
+int XDpDma_QueueFlip(XDpDma *InstancePtr, XDpDma_ChannelType Channel,
+		     u8 Plane, u64 Address)
+{
+	XDpDma_Channel *Chan;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Chan = XDpDma_GetChannel(InstancePtr, Channel, Plane);
+	if((Chan == NULL) || (Chan->List == NULL)) {
+		return XST_INVALID_PARAM;
+	}
+
+	return XDpDma_QueuePartialFlip(InstancePtr, Channel, Plane, Address, 0,
+				       Chan->List->Height);
+}
+
+/*************************************************************************/
+/**
+ *
+ * This function queues a flip of the bands of a display list that contain
+ * the lines [FirstLine, FirstLine + NumLines) to a new frame buffer. Other
+ * bands keep fetching from the buffers of the previously queued flip. The
+ * flip takes effect on a following VSync.
+ *
+ * @param    InstancePtr is pointer to the instance of DPDMA.
+ * @param    Channel is VideoChan or GraphicsChan.
+ * @param    Plane is the video plane; 0 for the graphics channel.
+ * @param    Address is the address of the new frame buffer, with the
+ *	     geometry given to XDpDma_SetDisplayList. All lines of the
+ *	     affected bands must be valid in it.
+ * @param    FirstLine is the first changed line.
+ * @param    NumLines is the number of changed lines.
+ *
+ * @return   XST_SUCCESS if the flip was queued.
+ *	     XST_INVALID_PARAM if the channel has no display list or the
+ *	     lines are outside the frame.
+ *	     XST_DEVICE_BUSY if XDPDMA_FLIP_QUEUE_DEPTH flips are pending.
+ *
+ * @note     The lines are rounded out to band boundaries; see the
+ *	     BandLines member of the display list.
+ *
+ **************************************************************************/
+int XDpDma_QueuePartialFlip(XDpDma *InstancePtr, XDpDma_ChannelType Channel,
+			    u8 Plane, u64 Address, u32 FirstLine,
+			    u32 NumLines)
+{
+	XDpDma_Channel *Chan;
+	XDpDma_DisplayList *List;
+	u32 Band;
+	u32 LastBand;
+	u8 Tail;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Chan = XDpDma_GetChannel(InstancePtr, Channel, Plane);
+	if((Chan == NULL) || (Chan->List == NULL)) {
+		return XST_INVALID_PARAM;
+	}
+	List = Chan->List;
+	if((NumLines == 0) || (FirstLine >= List->Height) ||
+	   (NumLines > List->Height - FirstLine)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Tail = (List->QueueTail + 1) % XDPDMA_DLIST_SLOTS;
+	if(Tail == List->QueueHead) {
+		return XST_DEVICE_BUSY;
+	}
+
+	LastBand = (FirstLine + NumLines - 1) / List->BandLines;
+	for(Band = FirstLine / List->BandLines; Band <= LastBand; Band++) {
+		List->Last[Band] = Address +
+			(u64)Band * List->BandLines * List->Stride;
+	}
+	memcpy(List->Queue[List->QueueTail], List->Last, sizeof(List->Last));
+	List->QueueTail = Tail;
+
+	if(Channel == VideoChan) {
+		if(InstancePtr->Video.Channel[XDPDMA_VIDEO_CHANNEL0].Current ==
+		   NULL) {
+			InstancePtr->Video.TriggerStatus = XDPDMA_TRIGGER_EN;
+		}
+		else {
+			InstancePtr->Video.TriggerStatus = XDPDMA_RETRIGGER_EN;
+		}
+	}
+	else {
+		if(InstancePtr->Gfx.Channel.Current == NULL) {
+			InstancePtr->Gfx.TriggerStatus = XDPDMA_TRIGGER_EN;
+		}
+		else {
+			InstancePtr->Gfx.TriggerStatus = XDPDMA_RETRIGGER_EN;
+		}
+	}
+
+	return XST_SUCCESS;
+}
@@ -38,6 +38,30 @@
  * This file defines the functions implemented by the DPDMA driver present
  * in the Zynq Ultrascale MP.
  *
+ * <b>Display lists</b>
+ *
+ * By default the video and graphics channels fetch each frame through one
+ * descriptor, which is rebuilt on every flip. A channel (or video plane) may
+ * instead be given a display list with XDpDma_SetDisplayList. A display list
+ * splits the frame into up to XDPDMA_DISPLAY_LIST_MAX_BANDS horizontal bands,
+ * one descriptor per band, and holds two such descriptor chains which are
+ * built once and used alternately. On a flip only the source addresses of the
+ * bands that change are patched into the chain that is not being fetched.
+ *
+ * XDpDma_QueuePartialFlip replaces only the bands covering the given lines:
+ * the remaining bands keep fetching from the buffers they fetched from before,
+ * so a mostly static screen can be updated by rendering just the changed bands
+ * into a new buffer, without copying the rest of the frame. The whole of each
+ * affected band must be valid in the new buffer. XDpDma_QueueFlip replaces
+ * all bands. Up to XDPDMA_FLIP_QUEUE_DEPTH flips may be queued ahead, which
+ * allows triple buffering; one queued flip is consumed per VSync by
+ * XDpDma_VSyncHandler.
+ *
+ * The display still fetches every line of every frame; display lists reduce
+ * the rendering and copy traffic of the application, and the descriptor writes
+ * of the driver, not the scanout bandwidth. When display lists are used on
+ * the video channel, every plane of the video format must have one.
+ *
  * @note	None.
  *
  * <pre>
@@ -46,6 +70,7 @@
  * Ver	Who   Date     Changes
  * ---- ----- -------- ----------------------------------------------------
  * 1.0  aad   04/12/16 Initial release.
+ *      ag    10/14/26 Added display lists with partial and queued flips.
  *
  *****************************************************************************/
 
@@ -72,6 +97,10 @@ extern "C" {
 #define XDPDMA_DESCRIPTOR_ALIGN 256
 /* DPDMA preamble field */
 #define XDPDMA_DESCRIPTOR_PREAMBLE 0xA5
+/* Maximum number of bands (descriptors per frame) of a display list */
+#define XDPDMA_DISPLAY_LIST_MAX_BANDS 8
+/* Maximum number of flips that can be queued ahead on a display list */
+#define XDPDMA_FLIP_QUEUE_DEPTH 2
 /**************************** Type Definitions ********************************/
 
 /**
@@ -165,6 +194,34 @@ typedef struct {
 	u64 Size;
 } XDpDma_AudioBuffer;
 
+/**
+ * This typedef wraps a descriptor so that arrays of descriptors keep the
+ * required alignment.
+ */
+typedef struct {
+	XDpDma_Descriptor Descriptor;
+} XDpDma_DisplayListBand;
+
+/**
+ * This typedef defines a display list: two preallocated descriptor chains
+ * describing a frame as horizontal bands, and a queue of pending flips. It is
+ * allocated by the application and handed to XDpDma_SetDisplayList.
+ */
+typedef struct {
+	XDpDma_DisplayListBand Chain[2][XDPDMA_DISPLAY_LIST_MAX_BANDS];
+	u64 ChainAddr[2][XDPDMA_DISPLAY_LIST_MAX_BANDS];
+	u64 Queue[XDPDMA_FLIP_QUEUE_DEPTH + 1][XDPDMA_DISPLAY_LIST_MAX_BANDS];
+	u64 Last[XDPDMA_DISPLAY_LIST_MAX_BANDS];
+	u32 Stride;
+	u32 LineSize;
+	u32 Height;
+	u32 BandLines;
+	u8 NumBands;
+	u8 Active;
+	volatile u8 QueueHead;
+	volatile u8 QueueTail;
+} XDpDma_DisplayList;
+
 /**
  * This typedef defines the Video/Graphics Channel attributes.
  */
@@ -172,6 +229,7 @@ typedef struct {
 	XDpDma_Descriptor Descriptor0;
 	XDpDma_Descriptor Descriptor1;
 	XDpDma_Descriptor *Current;
+	XDpDma_DisplayList *List;
 } XDpDma_Channel;
 
 /**
@@ -276,6 +334,32 @@ void XDpDma_InitAudioDescriptor(XDpDma_AudioChannel *Channel,
 			       XDpDma_AudioBuffer *AudioBuffer);
 int XDpDma_PlayAudio(XDpDma *InstancePtr, XDpDma_AudioBuffer *Buffer,
 		      u8 ChannelNum);
+int XDpDma_SetDisplayList(XDpDma *InstancePtr, XDpDma_ChannelType Channel,
+			  u8 Plane, XDpDma_DisplayList *List,
+			  XDpDma_FrameBuffer *FrameBuffer, u8 NumBands);
+int XDpDma_QueueFlip(XDpDma *InstancePtr, XDpDma_ChannelType Channel,
+		     u8 Plane, u64 Address);
+int XDpDma_QueuePartialFlip(XDpDma *InstancePtr, XDpDma_ChannelType Channel,
+			    u8 Plane, u64 Address, u32 FirstLine,
+			    u32 NumLines);
+
+/*************************************************************************/
+/**
+ *
+ * This macro checks whether a display list has flips queued that have not
+ * been consumed by a VSync yet.
+ *
+ * @param    List is a pointer to the display list, or NULL.
+ *
+ * @return   1 if a flip is pending, 0 otherwise.
+ *
+ * @note     C-style signature:
+ *	     u8 XDpDma_DisplayListPending(XDpDma_DisplayList *List)
+ *
+ **************************************************************************/
+#define XDpDma_DisplayListPending(List) \
+	(((List) != NULL) && ((List)->QueueHead != (List)->QueueTail))
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,7 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   aad  01/17/17 Initial release.
+ *       ag   10/14/26 Keep retriggering while display list flips are queued.
  * </pre>
  *
 *******************************************************************************/
@@ -132,6 +133,12 @@ void XDpDma_VSyncHandler(XDpDma *InstancePtr)
 		XDpDma_SetupChannel(InstancePtr, VideoChan);
 		XDpDma_ReTrigger(InstancePtr, VideoChan);
 	}
+	/* Consume the remaining queued flips on the next VSyncs */
+	if(XDpDma_DisplayListPending(InstancePtr->Video.Channel[0].List) ||
+	   XDpDma_DisplayListPending(InstancePtr->Video.Channel[1].List) ||
+	   XDpDma_DisplayListPending(InstancePtr->Video.Channel[2].List)) {
+		InstancePtr->Video.TriggerStatus = XDPDMA_RETRIGGER_EN;
+	}
 
 	/* Graphics Channel Trigger/Retrigger Handler */
 	if(InstancePtr->Gfx.TriggerStatus == XDPDMA_TRIGGER_EN) {
@@ -144,6 +151,9 @@ void XDpDma_VSyncHandler(XDpDma *InstancePtr)
 		XDpDma_SetupChannel(InstancePtr, GraphicsChan);
 		XDpDma_ReTrigger(InstancePtr, GraphicsChan);
 	}
+	if(XDpDma_DisplayListPending(InstancePtr->Gfx.Channel.List)) {
+		InstancePtr->Gfx.TriggerStatus = XDPDMA_RETRIGGER_EN;
+	}
 
 	/* Audio Channel 0 Trigger Handler */
 	if(InstancePtr->Audio[0].TriggerStatus == XDPDMA_TRIGGER_EN) {
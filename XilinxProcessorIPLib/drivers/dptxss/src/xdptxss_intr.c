@@ -56,6 +56,8 @@
 * 5.0  tu  09/08/17 Added two interrupt handler that addresses driver's
 *                   internal callback function of application
 *                   DrvHpdEventHandler and DrvHpdPulseHandler
+* 6.0  ag  10/14/26 Read the EDID on HPD events through XDp_TxGetEdid so that
+*                   it is cached for the following mode selection.
 * </pre>
 *
 ******************************************************************************/
@@ -207,8 +209,9 @@ void XDpTxSs_HpdEventProcess(void *InstancePtr)
 
 	Status |= XDp_TxAuxRead(XDpTxSsPtr->DpPtr, XDP_DPCD_REV, 11,
 				&UsrHpdEventData->Dpcd);
-	Status |= XDp_TxGetEdidBlock(XDpTxSsPtr->DpPtr,
-				     UsrHpdEventData->EdidOrg, 0);
+	/* The DP driver invalidated its EDID cache on this HPD event; this
+	 * read refills it for the mode selection that follows. */
+	Status |= XDp_TxGetEdid(XDpTxSsPtr->DpPtr, UsrHpdEventData->EdidOrg);
 	Status |= XDp_TxAuxRead(XDpTxSsPtr->DpPtr, XDP_DPCD_SINK_COUNT, 1,
 				&UsrHpdEventData->Rd200);
 	Status |= XDp_TxAuxRead(XDpTxSsPtr->DpPtr, XDP_DPCD_STATUS_LANE_0_1, 1,
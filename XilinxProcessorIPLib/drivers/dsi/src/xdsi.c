@@ -47,6 +47,8 @@
 * 1.0 ram 11/02/16 Initial Release DSI driver
 * 1.1 sss 08/17/16 Added 64 bit support
 *     sss 08/26/16 Add "Command Queue Vacancy" API
+*     ag  10/14/26 Added XDsi_SendShortPacketBatch, XDsi_WaitCmdQDrain,
+*                  XDsi_SetBlankingConfig and XDsi_SetBurstPacketSize
 *
 * </pre>
 *
@@ -76,6 +78,7 @@
 * function, these functions will be called for doing nothing.
 */
 static void StubErrCallback(void *CallbackRef, u32 ErrorMask);
+static inline u32 XDsi_EncodeShortPacket(const XDsi_ShortPacket *ShortPacket);
 
 /************************** Function Definitions *****************************/
 
@@ -119,6 +122,9 @@ u32 XDsi_CfgInitialize(XDsi *InstancePtr, XDsi_Config *CfgPtr,
 
 	InstancePtr->ErrorCallback = StubErrCallback;
 
+	/* No command has been issued yet, so the vacancy is the queue depth */
+	InstancePtr->CmdQDepth = XDsi_GetCmdQVacancy(InstancePtr);
+
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
 	return XST_SUCCESS;
@@ -244,20 +250,200 @@ u32 XDsi_Activate(XDsi *InstancePtr, XDsi_Selection Flag)
 ****************************************************************************/
 void XDsi_SendShortPacket(XDsi *InstancePtr, XDsi_ShortPacket *ShortPacket)
 {
-	u32 Value = 0;
-
 	/* Verify arguments */
 	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(ShortPacket != NULL);
 
+	XDsi_WriteReg(InstancePtr->Config.BaseAddr, XDSI_COMMAND_OFFSET,
+				XDsi_EncodeShortPacket(ShortPacket));
+}
+
+/*****************************************************************************/
+/**
+* This function will queue a sequence of short packets, e.g. a panel
+* initialization sequence, into the command queue FIFO. The command queue
+* vacancy is read once and then only again when the known free entries are
+* used up, instead of once per packet.
+*
+* @param	InstancePtr is the XDsi instance to operate on
+* @param	ShortPacket is an array of NumPackets short packets to send
+* @param	NumPackets is the number of packets in the array
+* @param	MaxPolls is the number of vacancy reads allowed while the
+*		command queue is full, e.g. XDSI_CMDQ_MAX_POLLS
+*
+* @return
+*		- XST_SUCCESS if all packets were written to the command queue
+*		- XST_FAILURE if the command queue stayed full for MaxPolls
+*		  reads. Packets before the failing one have been queued.
+*
+* @note		Use XDsi_WaitCmdQDrain to wait for the packets to be sent.
+*
+****************************************************************************/
+s32 XDsi_SendShortPacketBatch(XDsi *InstancePtr,
+		const XDsi_ShortPacket *ShortPacket, u32 NumPackets,
+		u32 MaxPolls)
+{
+	u32 Vacancy;
+	u32 Polls;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((ShortPacket != NULL) || (NumPackets == 0));
+
+	Vacancy = XDsi_GetCmdQVacancy(InstancePtr);
+
+	for (Index = 0; Index < NumPackets; Index++) {
+		Polls = 0;
+		while (Vacancy == 0) {
+			if (Polls++ >= MaxPolls) {
+				return XST_FAILURE;
+			}
+			Vacancy = XDsi_GetCmdQVacancy(InstancePtr);
+		}
+
+		XDsi_WriteReg(InstancePtr->Config.BaseAddr,
+				XDSI_COMMAND_OFFSET,
+				XDsi_EncodeShortPacket(&ShortPacket[Index]));
+		Vacancy--;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function will wait until all queued short packets have been taken
+* from the command queue FIFO.
+*
+* @param	InstancePtr is the XDsi instance to operate on
+* @param	MaxPolls is the number of vacancy reads allowed, e.g.
+*		XDSI_CMDQ_MAX_POLLS
+*
+* @return
+*		- XST_SUCCESS if the command queue is empty
+*		- XST_FAILURE if it did not drain within MaxPolls reads
+*
+* @note		The controller must be enabled for the queue to drain.
+*
+****************************************************************************/
+s32 XDsi_WaitCmdQDrain(XDsi *InstancePtr, u32 MaxPolls)
+{
+	u32 Polls;
+
+	/* Verify argument */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	for (Polls = 0; Polls < MaxPolls; Polls++) {
+		if (XDsi_GetCmdQVacancy(InstancePtr) >= InstancePtr->CmdQDepth) {
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+* This function will set the blanking packet type, the BLLP mode and the
+* EoTp enable in one protocol control register update, and keep them in the
+* instance for XDsi_DefaultConfigure.
+*
+* @param	InstancePtr is the XDsi instance to operate on
+* @param	BlankPacketType selects blanking (1) or NULL (0) packets for
+*		the BLLP region
+* @param	BLLPMode set to 1 lets the controller enter LP mode during BLLP,
+*		set to 0 keeps the link in HS mode with blanking packets
+* @param	EoTp enables (1) or disables (0) the EoT packet
+*
+* @return	None.
+*
+* @note		In burst mode, entering LP mode during BLLP gives the best
+*		link efficiency and power.
+*
+****************************************************************************/
+void XDsi_SetBlankingConfig(XDsi *InstancePtr, u8 BlankPacketType,
+		u8 BLLPMode, u8 EoTp)
+{
+	u32 Value;
+
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(BlankPacketType <= 1);
+	Xil_AssertVoid(BLLPMode <= 1);
+	Xil_AssertVoid(EoTp <= 1);
+
+	InstancePtr->BlankPacketType = BlankPacketType;
+	InstancePtr->BLLPMode = BLLPMode;
+	InstancePtr->EoTp = EoTp;
+
+	Value = XDsi_ReadReg(InstancePtr->Config.BaseAddr, XDSI_PCR_OFFSET);
+	Value &= ~(XDSI_PCR_BLLPTYPE_MASK | XDSI_PCR_BLLPMODE_MASK |
+			XDSI_PCR_EOTPENABLE_MASK);
+	Value |= ((u32)BlankPacketType << XDSI_PCR_BLLPTYPE_SHIFT) |
+		((u32)BLLPMode << XDSI_PCR_BLLPMODE_SHIFT) |
+		((u32)EoTp << XDSI_PCR_EOTPENABLE_SHIFT);
+	XDsi_WriteReg(InstancePtr->Config.BaseAddr, XDSI_PCR_OFFSET, Value);
+}
+
+/*****************************************************************************/
+/**
+* This function will set the BLLP burst packet size used in burst mode.
+* A larger burst packet sends the line in fewer packets and leaves a longer
+* BLLP in which the link can enter LP mode.
+*
+* @param	InstancePtr is the XDsi instance to operate on
+* @param	BurstPacketSize is the BLLP packet payload size in bytes(WC)
+*
+* @return
+*		- XST_SUCCESS if the burst packet size was set
+*		- XST_INVALID_PARAM if it does not fit in the DSI byte FIFO
+*		- XST_FAILURE if the controller is not in burst mode
+*
+* @note		None.
+*
+****************************************************************************/
+s32 XDsi_SetBurstPacketSize(XDsi *InstancePtr, u16 BurstPacketSize)
+{
+	/* Verify argument */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (BurstPacketSize > InstancePtr->Config.DsiByteFifo) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (XDsi_GetBitField(InstancePtr->Config.BaseAddr, XDSI_PCR_OFFSET,
+			XDSI_PCR_VIDEOMODE_MASK, XDSI_PCR_VIDEOMODE_SHIFT) !=
+			XDSI_VM_BURST_MODE) {
+		return XST_FAILURE;
+	}
+
+	XDsi_SetBitField(InstancePtr->Config.BaseAddr,
+	XDSI_TIME1_OFFSET, XDSI_TIME1_BLLP_BURST_MASK,
+	XDSI_TIME1_BLLP_BURST_SHIFT, BurstPacketSize);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function will encode a short packet into the Generic Short Packet
+* Register format.
+*
+* @param	ShortPacket is the short packet to encode
+*
+* @return	Register value for the command queue.
+*
+* @note		None.
+*
+****************************************************************************/
+static inline u32 XDsi_EncodeShortPacket(const XDsi_ShortPacket *ShortPacket)
+{
 	/* Byte 1: 2 bits:VcId 6 bits:DataType Byte 2:Data0  Byte 3:Data1 */
-	Value = ((ShortPacket->VcId << XDSI_SPKTR_VC_SHIFT |
+	return ((ShortPacket->VcId << XDSI_SPKTR_VC_SHIFT |
 		ShortPacket->DataType) |
 		(u32)(ShortPacket->Data0 << XDSI_SPKTR_BYTE1_SHIFT) |
 		(u32)(ShortPacket->Data1 << XDSI_SPKTR_BYTE2_SHIFT));
-
-	XDsi_WriteReg(InstancePtr->Config.BaseAddr, XDSI_COMMAND_OFFSET,
-								Value);
 }
 
 /*****************************************************************************/
@@ -61,6 +61,8 @@
 *     ms  04/05/17 Modified Comment lines in functions of dsi
 *                  examples to recognize it as documentation block
 *                  for doxygen generation of examples.
+*     ag  10/14/26 Added batched short packet submission and video mode
+*                  burst/blanking configuration API.
 * </pre>
 *
 ******************************************************************************/
@@ -88,6 +90,12 @@ extern "C" {
 #define XDSI_HANDLER_OTHERERROR			3
 #define XDSI_HANDLER_CMDQ_FIFOFULL		4
 
+/*
+ * Default number of command queue vacancy reads a batched send or a drain
+ * wait may spend before giving up
+ */
+#define XDSI_CMDQ_MAX_POLLS			100000
+
 typedef enum {
 	XDSI_DISABLE, /* DSI Tx controller Disable */
 	XDSI_ENABLE   /* DSI Tx controller Disable */
@@ -222,6 +230,7 @@ typedef struct {
 				       *  rest all errors */
 	void *ErrRef; /**< To be passed to the Error Call back */
 	u32 IsReady; /**< Driver is ready */
+	u32 CmdQDepth; /**< Command queue vacancy when the queue is empty */
 } XDsi;
 
 /************************** Macros Definitions *******************************/
@@ -633,6 +642,13 @@ void XDsi_Reset(XDsi *InstancePtr);
 u32 XDsi_DefaultConfigure(XDsi *InstancePtr);
 u32 XDsi_SelfTest(XDsi *InstancePtr);
 void XDsi_SendShortPacket(XDsi *InstancePtr, XDsi_ShortPacket *ShortPacket);
+s32 XDsi_SendShortPacketBatch(XDsi *InstancePtr,
+		const XDsi_ShortPacket *ShortPacket, u32 NumPackets,
+		u32 MaxPolls);
+s32 XDsi_WaitCmdQDrain(XDsi *InstancePtr, u32 MaxPolls);
+void XDsi_SetBlankingConfig(XDsi *InstancePtr, u8 BlankPacketType,
+		u8 BLLPMode, u8 EoTp);
+s32 XDsi_SetBurstPacketSize(XDsi *InstancePtr, u16 BurstPacketSize);
 void XDsi_GetConfigParams(XDsi *InstancePtr,
 		XDsi_ConfigParameters *ConfigInfo);
 s32 XDsi_SetVideoInterfaceTiming(XDsi *InstancePtr, XDsi_VideoMode VideoMode,
@@ -48,6 +48,8 @@
 * 1.1 sss 08/17/16 Added 64 bit support
 *     sss 08/26/16 Add "Command Queue Vacancy" API
 *                  API for getting pixel format
+*     ag  10/14/26 Added XDsiTxSs_SendShortPacketBatch,
+*                  XDsiTxSs_SetBlankingConfig and XDsiTxSs_SetBurstPacketSize
 * </pre>
 *
 ******************************************************************************/
@@ -299,6 +301,91 @@ void XDsiTxSs_SendShortPacket(XDsiTxSs *InstancePtr)
 	XDsi_SendShortPacket(InstancePtr->DsiPtr, &InstancePtr->SpktData);
 }
 
+/*****************************************************************************/
+/**
+* This function will send a sequence of short packets, e.g. a panel
+* initialization sequence, and wait once for all of them to be sent.
+*
+* @param	InstancePtr is the XDsiTxSs instance to operate on
+* @param	ShortPacket is an array of NumPackets short packets to send
+* @param	NumPackets is the number of packets in the array
+*
+* @return
+*		- XST_SUCCESS if all packets were sent
+*		- XST_FAILURE if the command queue stayed full or did not
+*		  drain within XDSI_CMDQ_MAX_POLLS vacancy reads
+*
+* @note		None.
+*
+****************************************************************************/
+s32 XDsiTxSs_SendShortPacketBatch(XDsiTxSs *InstancePtr,
+		const XDsi_ShortPacket *ShortPacket, u32 NumPackets)
+{
+	s32 Status;
+
+	/* Verify argument */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Status = XDsi_SendShortPacketBatch(InstancePtr->DsiPtr, ShortPacket,
+					NumPackets, XDSI_CMDQ_MAX_POLLS);
+	if (Status == XST_SUCCESS) {
+		Status = XDsi_WaitCmdQDrain(InstancePtr->DsiPtr,
+					XDSI_CMDQ_MAX_POLLS);
+	}
+	if (Status != XST_SUCCESS) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "Send short packet batch failed\r\n");
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This function will set the BLLP blanking packet type, BLLP mode and EoTp
+*
+* @param	InstancePtr is the XDsiTxSs instance to operate on
+* @param	BlankPacketType selects blanking (1) or NULL (0) packets
+* @param	BLLPMode set to 1 enters LP mode during BLLP
+* @param	EoTp enables (1) or disables (0) the EoT packet
+*
+* @return	None
+*
+* @note		None.
+*
+****************************************************************************/
+void XDsiTxSs_SetBlankingConfig(XDsiTxSs *InstancePtr, u8 BlankPacketType,
+		u8 BLLPMode, u8 EoTp)
+{
+	/* Verify argument */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	XDsi_SetBlankingConfig(InstancePtr->DsiPtr, BlankPacketType,
+				BLLPMode, EoTp);
+}
+
+/*****************************************************************************/
+/**
+* This function will set the BLLP burst packet size used in burst mode
+*
+* @param	InstancePtr is the XDsiTxSs instance to operate on
+* @param	BurstPacketSize is the BLLP packet payload size in bytes(WC)
+*
+* @return
+*		- XST_SUCCESS if the burst packet size was set
+*		- XST_INVALID_PARAM if it does not fit in the DSI byte FIFO
+*		- XST_FAILURE if the controller is not in burst mode
+*
+* @note		None.
+*
+****************************************************************************/
+s32 XDsiTxSs_SetBurstPacketSize(XDsiTxSs *InstancePtr, u16 BurstPacketSize)
+{
+	/* Verify argument */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return XDsi_SetBurstPacketSize(InstancePtr->DsiPtr, BurstPacketSize);
+}
+
 /*****************************************************************************/
 /**
 * This function will get the information from the GUI settings
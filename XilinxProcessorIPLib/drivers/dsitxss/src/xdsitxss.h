@@ -132,6 +132,7 @@
 *     ms  04/05/17 Added tabspace for return statements in functions of
 *                  xdsitxss_intr_example.c for proper documentation
 *                  while generating doxygen.
+*     ag  10/14/26 Added batched short packet and burst/blanking API.
 * </pre>
 *
 ******************************************************************************/
@@ -261,6 +262,11 @@ void XDsiTxSs_Reset(XDsiTxSs *InstancePtr);
 void XDsiTxSs_ReportCoreInfo(XDsiTxSs *InstancePtr);
 u32 XDsiTxSs_SelfTest(XDsiTxSs *InstancePtr);
 void XDsiTxSs_SendShortPacket(XDsiTxSs *InstancePtr);
+s32 XDsiTxSs_SendShortPacketBatch(XDsiTxSs *InstancePtr,
+		const XDsi_ShortPacket *ShortPacket, u32 NumPackets);
+void XDsiTxSs_SetBlankingConfig(XDsiTxSs *InstancePtr, u8 BlankPacketType,
+		u8 BLLPMode, u8 EoTp);
+s32 XDsiTxSs_SetBurstPacketSize(XDsiTxSs *InstancePtr, u16 BurstPacketSize);
 void XDsiTxSs_GetConfigParams(XDsiTxSs *InstancePtr);
 u32 XDsiTxSs_IsControllerReady(XDsiTxSs *InstancePtr);
 u32 XDsiTxSs_GetPixelFormat(XDsiTxSs *InstancePtr);
@@ -67,6 +67,10 @@
 * 4.2   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototypes of XEmacLite_GetReceiveDataLength,
 *                     XEmacLite_CfgInitialize API's.
+*       ag   10/14/26 Added XEmacLite_TxBufferGet, XEmacLite_TxBufferWrite and
+*                     XEmacLite_TxBufferSend to gather a frame directly into
+*                     a ping or pong transmit buffer. XEmacLite_Send uses
+*                     them.
 *
 * </pre>
 ******************************************************************************/
@@ -189,22 +193,13 @@ int XEmacLite_CfgInitialize(XEmacLite *InstancePtr,
 ******************************************************************************/
 int XEmacLite_Send(XEmacLite *InstancePtr, u8 *FramePtr, unsigned ByteCount)
 {
-	u32 Register;
 	UINTPTR BaseAddress;
-	UINTPTR EmacBaseAddress;
-	u32 IntrEnableStatus;
 
 	/*
 	 * Verify that each of the inputs are valid.
 	 */
 	Xil_AssertNonvoid(InstancePtr != NULL);
 
-	/*
-	 * Determine the expected TX buffer address.
-	 */
-	BaseAddress = XEmacLite_NextTransmitAddr(InstancePtr);
-	EmacBaseAddress = InstancePtr->EmacLiteConfig.BaseAddress;
-
 	/*
 	 * Check the Length if it is too large, truncate it.
 	 * The maximum Tx packet size is
@@ -216,14 +211,70 @@ int XEmacLite_Send(XEmacLite *InstancePtr, u8 *FramePtr, unsigned ByteCount)
 	}
 
 	/*
-	 * Determine if the expected buffer address is empty.
+	 * Get an empty TX buffer, the expected one or the other one if
+	 * configured.
 	 */
-	Register = XEmacLite_GetTxStatus(BaseAddress);
+	BaseAddress = XEmacLite_TxBufferGet(InstancePtr);
+	if (BaseAddress == 0) {
+		/*
+		 * Buffer(s) was(were) full, return failure to allow for
+		 * polling usage.
+		 */
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Write the frame to the buffer.
+	 */
+	XEmacLite_AlignedWrite(FramePtr, (UINTPTR *) BaseAddress, ByteCount);
+
+	/*
+	 * The frame is in the buffer, now send it.
+	 */
+	XEmacLite_TxBufferSend(InstancePtr, BaseAddress, ByteCount);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Get an empty transmit buffer that a frame can be written into with
+* XEmacLite_TxBufferWrite() and then sent with XEmacLite_TxBufferSend().
+* This allows a frame made of several fragments to be gathered directly
+* into the transmit buffer instead of being assembled in memory first.
+*
+* If the device is configured with ping and pong transmit buffers, the
+* expected buffer is returned if it is empty, and the other buffer
+* otherwise, so a frame can be written into one buffer while the frame in
+* the other buffer is transmitted.
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+*
+* @return	The address of the empty transmit buffer, or 0 if the
+*		buffer(s) was (were) full.
+*
+* @note		The buffer is owned by the caller until it is passed to
+*		XEmacLite_TxBufferSend(). Only one buffer should be held at a
+*		time.
+*
+******************************************************************************/
+UINTPTR XEmacLite_TxBufferGet(XEmacLite *InstancePtr)
+{
+	u32 Register;
+	UINTPTR BaseAddress;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	/*
+	 * Determine the expected TX buffer address.
+	 */
+	BaseAddress = XEmacLite_NextTransmitAddr(InstancePtr);
 
 	/*
-	 * If the expected buffer is available, fill it with the provided data
-	 * Align if necessary.
+	 * Determine if the expected buffer address is empty.
 	 */
+	Register = XEmacLite_GetTxStatus(BaseAddress);
 	if ((Register & (XEL_TSR_XMIT_BUSY_MASK |
 			XEL_TSR_XMIT_ACTIVE_MASK)) == 0) {
 
@@ -234,104 +285,103 @@ int XEmacLite_Send(XEmacLite *InstancePtr, u8 *FramePtr, unsigned ByteCount)
 			InstancePtr->NextTxBufferToUse ^= XEL_BUFFER_OFFSET;
 		}
 
-		/*
-		 * Write the frame to the buffer.
-		 */
-		XEmacLite_AlignedWrite(FramePtr, (UINTPTR *) BaseAddress,
-				       ByteCount);
-
-
-		/*
-		 * The frame is in the buffer, now send it.
-		 */
-		XEmacLite_WriteReg(BaseAddress, XEL_TPLR_OFFSET,
-					(ByteCount & (XEL_TPLR_LENGTH_MASK_HI |
-					XEL_TPLR_LENGTH_MASK_LO)));
-
-		/*
-		 * Update the Tx Status Register to indicate that there is a
-		 * frame to send.
-		 * If the interrupt enable bit of Ping buffer(since this
-		 * controls both the buffers) is enabled then set the
-		 * XEL_TSR_XMIT_ACTIVE_MASK flag which is used by the interrupt
-		 * handler to call the callback function provided by the user
-		 * to indicate that the frame has been transmitted.
-		 */
-		Register = XEmacLite_GetTxStatus(BaseAddress);
-		Register |= XEL_TSR_XMIT_BUSY_MASK;
-		IntrEnableStatus = XEmacLite_GetTxStatus(EmacBaseAddress);
-		if ((IntrEnableStatus & XEL_TSR_XMIT_IE_MASK) != 0) {
-			Register |= XEL_TSR_XMIT_ACTIVE_MASK;
-		}
-		XEmacLite_SetTxStatus(BaseAddress, Register);
-
-		return XST_SUCCESS;
+		return BaseAddress;
 	}
 
 	/*
 	 * If the expected buffer was full, try the other buffer if configured.
+	 * Do not switch to next buffer, there is a sync problem and the
+	 * expected buffer should not change.
 	 */
 	if (InstancePtr->EmacLiteConfig.TxPingPong != 0) {
 
 		BaseAddress ^= XEL_BUFFER_OFFSET;
 
-		/*
-		 * Determine if the expected buffer address is empty.
-		 */
 		Register = XEmacLite_GetTxStatus(BaseAddress);
-
-		/*
-		 * If the next buffer is available, fill it with the provided
-		 * data.
-		 */
 		if ((Register & (XEL_TSR_XMIT_BUSY_MASK |
 				XEL_TSR_XMIT_ACTIVE_MASK)) == 0) {
+			return BaseAddress;
+		}
+	}
 
-			/*
-			 * Write the frame to the buffer.
-			 */
-			XEmacLite_AlignedWrite(FramePtr, (UINTPTR *) BaseAddress,
-					       ByteCount);
-
-			/*
-			 * The frame is in the buffer, now send it.
-			 */
-			XEmacLite_WriteReg(BaseAddress, XEL_TPLR_OFFSET,
-					(ByteCount & (XEL_TPLR_LENGTH_MASK_HI |
-					   XEL_TPLR_LENGTH_MASK_LO)));
+	return 0;
+}
 
-			/*
-			 * Update the Tx Status Register to indicate that there
-			 * is a frame to send.
-			 * If the interrupt enable bit of Ping buffer(since this
-			 * controls both the buffers) is enabled then set the
-			 * XEL_TSR_XMIT_ACTIVE_MASK flag which is used by the
-			 * interrupt handler to call the callback function
-			 * provided by the user to indicate that the frame has
-			 * been transmitted.
-			 */
-			Register = XEmacLite_GetTxStatus(BaseAddress);
-			Register |= XEL_TSR_XMIT_BUSY_MASK;
-			IntrEnableStatus =
-					XEmacLite_GetTxStatus(EmacBaseAddress);
-			if ((IntrEnableStatus & XEL_TSR_XMIT_IE_MASK) != 0) {
-				Register |= XEL_TSR_XMIT_ACTIVE_MASK;
-			}
-			XEmacLite_SetTxStatus(BaseAddress, Register);
+/*****************************************************************************/
+/**
+*
+* Write a fragment of a frame into a transmit buffer obtained with
+* XEmacLite_TxBufferGet(), at the given byte offset from the start of the
+* frame. The buffer is only accessed with 32-bit reads and writes.
+*
+* @param	BufferAddr is the transmit buffer address returned by
+*		XEmacLite_TxBufferGet().
+* @param	Offset is the offset of the fragment in the frame.
+* @param	DataPtr is a pointer to the fragment, of any alignment.
+* @param	ByteCount is the size, in bytes, of the fragment.
+*
+* @return	None.
+*
+* @note		Fragments must be written in order of increasing offset.
+*
+******************************************************************************/
+void XEmacLite_TxBufferWrite(UINTPTR BufferAddr, unsigned Offset,
+			     u8 *DataPtr, unsigned ByteCount)
+{
+	Xil_AssertVoid(BufferAddr != 0);
+	Xil_AssertVoid((Offset + ByteCount) <= XEL_MAX_TX_FRAME_SIZE);
 
-			/*
-			 * Do not switch to next buffer, there is a sync problem
-			 * and the expected buffer should not change.
-			 */
-			return XST_SUCCESS;
-		}
-	}
+	XEmacLite_AlignedWriteOffset((UINTPTR *) BufferAddr, Offset, DataPtr,
+				     ByteCount);
+}
 
+/*****************************************************************************/
+/**
+*
+* Send the frame written into a transmit buffer obtained with
+* XEmacLite_TxBufferGet().
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+* @param	BufferAddr is the transmit buffer address returned by
+*		XEmacLite_TxBufferGet().
+* @param	ByteCount is the size, in bytes, of the frame.
+*
+* @return	None.
+*
+* @note		This function call is not blocking in nature, i.e. it will
+*		not wait until the frame is transmitted.
+*
+******************************************************************************/
+void XEmacLite_TxBufferSend(XEmacLite *InstancePtr, UINTPTR BufferAddr,
+			    unsigned ByteCount)
+{
+	u32 Register;
+	u32 IntrEnableStatus;
 
-	/*
-	 * Buffer(s) was(were) full, return failure to allow for polling usage.
-	 */
-	return XST_FAILURE;
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(BufferAddr != 0);
+
+	XEmacLite_WriteReg(BufferAddr, XEL_TPLR_OFFSET,
+				(ByteCount & (XEL_TPLR_LENGTH_MASK_HI |
+				XEL_TPLR_LENGTH_MASK_LO)));
+
+	/*
+	 * Update the Tx Status Register to indicate that there is a
+	 * frame to send.
+	 * If the interrupt enable bit of Ping buffer(since this
+	 * controls both the buffers) is enabled then set the
+	 * XEL_TSR_XMIT_ACTIVE_MASK flag which is used by the interrupt
+	 * handler to call the callback function provided by the user
+	 * to indicate that the frame has been transmitted.
+	 */
+	Register = XEmacLite_GetTxStatus(BufferAddr);
+	Register |= XEL_TSR_XMIT_BUSY_MASK;
+	IntrEnableStatus = XEmacLite_GetTxStatus(
+				InstancePtr->EmacLiteConfig.BaseAddress);
+	if ((IntrEnableStatus & XEL_TSR_XMIT_IE_MASK) != 0) {
+		Register |= XEL_TSR_XMIT_ACTIVE_MASK;
+	}
+	XEmacLite_SetTxStatus(BufferAddr, Register);
 }
 
 /*****************************************************************************/
@@ -209,6 +209,11 @@
 *                     for CR-965028.
 *       ms   03/17/17 Modified text file in examples folder for doxygen
 *                     generation.
+*       ag   10/14/26 Added XEmacLite_TxBufferGet, XEmacLite_TxBufferWrite and
+*                     XEmacLite_TxBufferSend to write a frame into a ping or
+*                     pong buffer in fragments. Unaligned frames are copied
+*                     a word at a time. Define __LITTLE_ENDIAN__ on
+*                     AArch64 too.
 *
 * </pre>
 *
@@ -229,7 +234,7 @@ extern "C" {
 #include "xstatus.h"
 #include "xemaclite_l.h"
 
-#ifdef __ARMEL__
+#if defined (__ARMEL__) || defined (__AARCH64EL__)
 #ifndef __LITTLE_ENDIAN__
 #define __LITTLE_ENDIAN__
 #endif
@@ -380,6 +385,11 @@ int XEmacLite_TxBufferAvailable(XEmacLite *InstancePtr);
 void XEmacLite_FlushReceive(XEmacLite *InstancePtr);
 
 int XEmacLite_Send(XEmacLite *InstancePtr, u8 *FramePtr, unsigned ByteCount);
+UINTPTR XEmacLite_TxBufferGet(XEmacLite *InstancePtr);
+void XEmacLite_TxBufferWrite(UINTPTR BufferAddr, unsigned Offset,
+			     u8 *DataPtr, unsigned ByteCount);
+void XEmacLite_TxBufferSend(XEmacLite *InstancePtr, UINTPTR BufferAddr,
+			    unsigned ByteCount);
 u16 XEmacLite_Recv(XEmacLite *InstancePtr, u8 *FramePtr);
 
 int XEmacLite_PhyRead(XEmacLite *InstancePtr, u32 PhyAddress, u32 RegNum,
@@ -126,6 +126,8 @@ extern XEmacLite_Config XEmacLite_ConfigTable[];
 /************************** Function Prototypes ******************************/
 
 void XEmacLite_AlignedWrite(void *SrcPtr, UINTPTR *DestPtr, unsigned ByteCount);
+void XEmacLite_AlignedWriteOffset(UINTPTR *DestPtr, unsigned Offset,
+				  void *SrcPtr, unsigned ByteCount);
 void XEmacLite_AlignedRead(UINTPTR *SrcPtr, void *DestPtr, unsigned ByteCount);
 
 void StubHandler(void *CallBackRef);
@@ -62,6 +62,10 @@
 *                     XEmacLite_AlignedRead APIs.
 * 4.3   asa  08/27/16 Fix compilation warning by making changes in
 *                     XEmacLite_AlignedWrite.
+*       ag   10/14/26 Copy unaligned sources in XEmacLite_AlignedWrite a word
+*                     at a time and add XEmacLite_AlignedWriteOffset to
+*                     gather a frame into a transmit buffer. Use 32-bit
+*                     accesses to the buffers on 64-bit processors.
 * </pre>
 *
 ******************************************************************************/
@@ -81,6 +85,8 @@
 
 /************************** Function Prototypes ******************************/
 void XEmacLite_AlignedWrite(void *SrcPtr, UINTPTR *DestPtr, unsigned ByteCount);
+void XEmacLite_AlignedWriteOffset(UINTPTR *DestPtr, unsigned Offset,
+				  void *SrcPtr, unsigned ByteCount);
 void XEmacLite_AlignedRead(UINTPTR *SrcPtr, void *DestPtr, unsigned ByteCount);
 
 /************************** Variable Definitions *****************************/
@@ -238,16 +244,18 @@ void XEmacLite_AlignedWrite(void *SrcPtr, UINTPTR *DestPtr, unsigned ByteCount)
 	unsigned Index;
 	unsigned Length = ByteCount;
 	volatile u32 AlignBuffer;
-	volatile UINTPTR *To32Ptr;
+	volatile u32 *To32Ptr;
 	u32 *From32Ptr;
-	volatile u16 *To16Ptr;
-	u16 *From16Ptr;
 	volatile u8 *To8Ptr;
 	u8 *From8Ptr;
+	u32 Shift;
+	u32 Word;
+	u32 NextWord;
 
-	To32Ptr = (volatile UINTPTR *)DestPtr;
+	To32Ptr = (volatile u32 *)DestPtr;
+	From8Ptr = (u8 *) SrcPtr;
 
-	if ((((u32) SrcPtr) & 0x00000003) == 0) {
+	if ((((UINTPTR) SrcPtr) & 0x00000003) == 0) {
 
 		/*
 		 * Word aligned buffer, no correction needed.
@@ -266,110 +274,40 @@ void XEmacLite_AlignedWrite(void *SrcPtr, UINTPTR *DestPtr, unsigned ByteCount)
 			Length -= 4;
 		}
 
-		/*
-		 * Set up to output the remaining data, zero the temp buffer
-		 first.
-		 */
-		AlignBuffer = 0;
-		To8Ptr = (u8 *) &AlignBuffer;
 		From8Ptr = (u8 *) From32Ptr;
-
-	}
-	else if ((((u32) SrcPtr) & 0x00000001) != 0) {
-		/*
-		 * Byte aligned buffer, correct.
-		 */
-		AlignBuffer = 0;
-		To8Ptr = (u8 *) &AlignBuffer;
-		From8Ptr = (u8 *) SrcPtr;
-
-		while (Length > 3) {
-			/*
-			 * Copy each byte into the temporary buffer.
-			 */
-			for (Index = 0; Index < 4; Index++) {
-				*To8Ptr++ = *From8Ptr++;
-			}
-
-			/*
-			 * Output the buffer
-			 */
-			*To32Ptr++ = AlignBuffer;
-
-			/*.
-			 * Reset the temporary buffer pointer and adjust length.
-			 */
-			To8Ptr = (u8 *) &AlignBuffer;
-			Length -= 4;
-		}
-
-		/*
-		 * Set up to output the remaining data, zero the temp buffer
-		 * first.
-		 */
-		AlignBuffer = 0;
-		To8Ptr = (u8 *) &AlignBuffer;
-
 	}
-	else {
+	else if (Length > 3) {
 		/*
-		 * Half-Word aligned buffer, correct.
+		 * Unaligned buffer. Read the source through the aligned words
+		 * that contain it and merge each pair of neighbouring words
+		 * into one output word, so the copy runs at one load and one
+		 * store per word whatever the source alignment. The words
+		 * read never extend past the aligned word holding the last
+		 * source byte.
 		 */
-		AlignBuffer = 0;
-
-		/*
-		 * This is a funny looking cast. The new gcc, version 3.3.x has
-		 * a strict cast check for 16 bit pointers, aka short pointers.
-		 * The following warning is issued if the initial 'void *' cast
-		 * is  not used:
-		 * 'dereferencing type-punned pointer will break strict-aliasing
-		 * rules'
-		 */
-
-		To16Ptr = (u16 *) ((void *) &AlignBuffer);
-		From16Ptr = (u16 *) SrcPtr;
+		Shift = (((UINTPTR) SrcPtr) & 0x00000003) * 8;
+		From32Ptr = (u32 *) (((UINTPTR) SrcPtr) & ~(UINTPTR)0x00000003);
+		Word = *From32Ptr++;
 
 		while (Length > 3) {
-			/*
-			 * Copy each half word into the temporary buffer.
-			 */
-			for (Index = 0; Index < 2; Index++) {
-				*To16Ptr++ = *From16Ptr++;
-			}
-
-			/*
-			 * Output the buffer.
-			 */
-			*To32Ptr++ = AlignBuffer;
-
-			/*
-			 * Reset the temporary buffer pointer and adjust length.
-			 */
-
-			/*
-			 * This is a funny looking cast. The new gcc, version
-			 * 3.3.x has a strict cast check for 16 bit pointers,
-			 * aka short  pointers. The following warning is issued
-			 * if the initial 'void *' cast is not used:
-			 * 'dereferencing type-punned pointer will break
-			 * strict-aliasing  rules'
-			 */
-			To16Ptr = (u16 *) ((void *) &AlignBuffer);
+			NextWord = *From32Ptr++;
+#ifdef __LITTLE_ENDIAN__
+			*To32Ptr++ = (Word >> Shift) | (NextWord << (32 - Shift));
+#else
+			*To32Ptr++ = (Word << Shift) | (NextWord >> (32 - Shift));
+#endif
+			Word = NextWord;
 			Length -= 4;
 		}
 
-		/*
-		 * Set up to output the remaining data, zero the temp buffer
-		 * first.
-		 */
-		AlignBuffer = 0;
-		To8Ptr = (u8 *) &AlignBuffer;
-		From8Ptr = (u8 *) From16Ptr;
+		From8Ptr = (u8 *) SrcPtr + (ByteCount - Length);
 	}
 
 	/*
 	 * Output the remaining data, zero the temp buffer first.
 	 */
+	AlignBuffer = 0;
+	To8Ptr = (u8 *) &AlignBuffer;
 	for (Index = 0; Index < Length; Index++) {
 		*To8Ptr++ = *From8Ptr++;
 	}
@@ -378,6 +316,61 @@ void XEmacLite_AlignedWrite(void *SrcPtr, UINTPTR *DestPtr, unsigned ByteCount)
 	}
 }
 
+/******************************************************************************/
+/**
+*
+* This function writes data of any alignment to a byte offset of a 32-bit
+* aligned destination buffer, such as an EmacLite transmit buffer. It is
+* used to gather a frame from several fragments directly into the transmit
+* buffer. A destination word only partly covered by the data is read,
+* merged and written back, so all accesses to the buffer are 32-bit wide.
+*
+* @param	DestPtr is a pointer to the 32-bit aligned destination buffer.
+* @param	Offset is the byte offset in the destination buffer at which
+*		the data is written.
+* @param	SrcPtr is a pointer to incoming data of any alignment.
+* @param	ByteCount is the number of bytes to write.
+*
+* @return	None.
+*
+* @note		The bytes following the data up to the next word boundary
+*		are zeroed when the data ends at an unaligned offset; they are
+*		merged again when the next fragment is written.
+*
+******************************************************************************/
+void XEmacLite_AlignedWriteOffset(UINTPTR *DestPtr, unsigned Offset,
+				  void *SrcPtr, unsigned ByteCount)
+{
+	volatile u32 *To32Ptr;
+	u32 AlignBuffer;
+	u8 *To8Ptr;
+	u8 *From8Ptr = (u8 *) SrcPtr;
+	unsigned Head;
+
+	To32Ptr = (volatile u32 *) ((UINTPTR) DestPtr + (Offset & ~0x3U));
+
+	if ((Offset & 0x3U) != 0) {
+		/*
+		 * Merge the leading bytes into the partly written word.
+		 */
+		Head = 4 - (Offset & 0x3U);
+		if (Head > ByteCount) {
+			Head = ByteCount;
+		}
+		AlignBuffer = *To32Ptr;
+		To8Ptr = (u8 *) &AlignBuffer + (Offset & 0x3U);
+		ByteCount -= Head;
+		while (Head-- > 0) {
+			*To8Ptr++ = *From8Ptr++;
+		}
+		*To32Ptr++ = AlignBuffer;
+	}
+
+	if (ByteCount != 0) {
+		XEmacLite_AlignedWrite(From8Ptr, (UINTPTR *) To32Ptr, ByteCount);
+	}
+}
+
 /******************************************************************************/
 /**
 *
@@ -54,6 +54,10 @@
 * 3.1  hk   08/10/15 Update upper 32 bit tx and rx queue ptr registers
 * 3.5  hk   08/14/17 Update cache coherency information of the interface in
 *                    its config structure.
+* 3.7  ag   10/14/26 Fix RX queue 1 base address programming, enable RX Q1
+*                    interrupts when a Q1 receive handler is installed and
+*                    clear the screeners on reset.
+*                    Enable extended BDs when built with XEMACPS_BD_TIMESTAMP.
 *
 * </pre>
 ******************************************************************************/
@@ -114,6 +118,7 @@ LONG XEmacPs_CfgInitialize(XEmacPs *InstancePtr, XEmacPs_Config * CfgPtr,
 	/* Set callbacks to an initial stub routine */
 	InstancePtr->SendHandler = ((XEmacPs_Handler)((void*)XEmacPs_StubHandler));
 	InstancePtr->RecvHandler = ((XEmacPs_Handler)(void*)XEmacPs_StubHandler);
+	InstancePtr->RecvQ1Handler = ((XEmacPs_Handler)(void*)XEmacPs_StubHandler);
 	InstancePtr->ErrorHandler = ((XEmacPs_ErrHandler)(void*)XEmacPs_StubHandler);
 
 	/* Reset the hardware and set default options */
@@ -210,6 +215,12 @@ void XEmacPs_Start(XEmacPs *InstancePtr)
 	if (InstancePtr->Version > 2)
 		XEmacPs_IntQ1Enable(InstancePtr, XEMACPS_INTQ1_IXR_ALL_MASK);
 
+	/* Enable RX Q1 Interrupts if the RX priority queue is in use */
+	if ((InstancePtr->Version > 2) && (InstancePtr->RecvQ1Handler !=
+			((XEmacPs_Handler)(void*)XEmacPs_StubHandler))) {
+		XEmacPs_IntQ1Enable(InstancePtr, XEMACPS_INTQ1SR_RXCOMPL_MASK);
+	}
+
 	/* Mark as started */
 	InstancePtr->IsStarted = XIL_COMPONENT_IS_STARTED;
 
@@ -363,6 +374,10 @@ void XEmacPs_Reset(XEmacPs *InstancePtr)
 			(XEmacPs_ReadReg(InstancePtr->Config.BaseAddress, XEMACPS_DMACR_OFFSET) |
 #ifdef __aarch64__
 			(u32)XEMACPS_DMACR_ADDR_WIDTH_64 |
+#endif
+#ifdef XEMACPS_BD_TIMESTAMP
+			(u32)XEMACPS_DMACR_TXEXTEND_MASK |
+			(u32)XEMACPS_DMACR_RXEXTEND_MASK |
 #endif
 			(u32)XEMACPS_DMACR_INCR16_AHB_BURST));
 	}
@@ -374,6 +389,8 @@ void XEmacPs_Reset(XEmacPs *InstancePtr)
 	if (InstancePtr->Version > 2)
 		XEmacPs_SetQueuePtr(InstancePtr, 0, 0x01U, (u16)XEMACPS_SEND);
 	XEmacPs_SetQueuePtr(InstancePtr, 0, 0x00U, (u16)XEMACPS_RECV);
+	if (InstancePtr->Version > 2)
+		XEmacPs_SetQueuePtr(InstancePtr, 0, 0x01U, (u16)XEMACPS_RECV);
 
 	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
 			   XEMACPS_RXSR_OFFSET, 0x0U);
@@ -387,6 +404,7 @@ void XEmacPs_Reset(XEmacPs *InstancePtr)
 			   Reg);
 
 	XEmacPs_ClearHash(InstancePtr);
+	XEmacPs_ClearScreeners(InstancePtr);
 
 	for (i = 1U; i < 5U; i++) {
 		(void)XEmacPs_SetMacAddress(InstancePtr, EmacPs_zero_MAC, i);
@@ -471,9 +489,15 @@ void XEmacPs_SetQueuePtr(XEmacPs *InstancePtr, UINTPTR QPtr, u8 QueueNum,
 		}
 	}
 	 else {
-		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
-			XEMACPS_TXQ1BASE_OFFSET,
-			(QPtr & ULONG64_LO_MASK));
+		if (Direction == XEMACPS_SEND) {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_TXQ1BASE_OFFSET,
+				(QPtr & ULONG64_LO_MASK));
+		} else {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_RXQ1BASE_OFFSET,
+				(QPtr & ULONG64_LO_MASK));
+		}
 	}
 #ifdef __aarch64__
 	if (Direction == XEMACPS_SEND) {
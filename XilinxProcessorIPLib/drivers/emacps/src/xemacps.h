@@ -330,6 +330,11 @@
  * 3.6   rb   09/08/17 HwCnt variable (in XEmacPs_BdRing structure) is
  *		       changed to volatile.
  *		       Add API XEmacPs_BdRingPtrReset() to reset pointers
+ * 3.7   ag   10/14/26 Added RX BD checksum status masks.
+ *                     Added RX priority queue 1 ring and handler, and type 1
+ *                     and type 2 screener APIs for RX flow steering.
+ *                     Added TSU time, offset and frequency adjust APIs and
+ *                     timestamps in extended BDs (XEMACPS_BD_TIMESTAMP).
  *
  * </pre>
  *
@@ -456,6 +461,7 @@ extern "C" {
 #define XEMACPS_HANDLER_DMASEND 1U
 #define XEMACPS_HANDLER_DMARECV 2U
 #define XEMACPS_HANDLER_ERROR   3U
+#define XEMACPS_HANDLER_DMARECVQ1 4U
 /*@}*/
 
 /* Constants to determine the configuration of the hardware device. They are
@@ -487,6 +493,20 @@ extern "C" {
 #define XEMACPS_8BYTE_BURST		0x00000008
 #define XEMACPS_16BYTE_BURST	0x00000010
 
+/** @name BD timestamp modes
+ *
+ * Frames timestamped into extended BDs by the TSU, see XEmacPs_SetBdTsMode().
+ * @{
+ */
+#define XEMACPS_TS_MODE_NONE		0U	/**< No timestamps */
+#define XEMACPS_TS_MODE_PTP_EVENT	1U	/**< PTP event frames */
+#define XEMACPS_TS_MODE_PTP_ALL		2U	/**< All PTP frames */
+#define XEMACPS_TS_MODE_ALL		3U	/**< All frames */
+/*@}*/
+
+#define XEMACPS_TSU_NSEC_PER_SEC	1000000000U
+#define XEMACPS_TSU_SUBNS_SHIFT		24U	/* sub-ns increment bits */
+
 
 /**************************** Type Definitions ******************************/
 /** @name Typedefs for callback functions
@@ -546,11 +566,14 @@ typedef struct XEmacPs_Instance {
 
 	XEmacPs_BdRing TxBdRing;	/* Transmit BD ring */
 	XEmacPs_BdRing RxBdRing;	/* Receive BD ring */
+	XEmacPs_BdRing RxQ1BdRing;	/* Receive priority queue 1 BD ring */
 
 	XEmacPs_Handler SendHandler;
 	XEmacPs_Handler RecvHandler;
+	XEmacPs_Handler RecvQ1Handler;
 	void *SendRef;
 	void *RecvRef;
+	void *RecvQ1Ref;
 
 	XEmacPs_ErrHandler ErrorHandler;
 	void *ErrorRef;
@@ -559,9 +582,19 @@ typedef struct XEmacPs_Instance {
 	u32 MaxMtuSize;
 	u32 MaxFrameSize;
 	u32 MaxVlanFrameSize;
+	u32 TsuIncr;		/* Nominal TSU increment, ns << 24 */
 
 } XEmacPs;
 
+/**
+ * TSU time. The ZynqMP GEM has a 48-bit and the Zynq GEM a 32-bit seconds
+ * counter.
+ */
+typedef struct {
+	u64 Seconds;		/**< Seconds */
+	u32 NanoSeconds;	/**< Nanoseconds, below 1000000000 */
+} XEmacPs_TsuTime;
+
 
 /***************** Macros (Inline Functions) Definitions ********************/
 
@@ -597,6 +630,22 @@ typedef struct XEmacPs_Instance {
 *****************************************************************************/
 #define XEmacPs_GetRxRing(InstancePtr) ((InstancePtr)->RxBdRing)
 
+/****************************************************************************/
+/**
+* Retrieve the RX priority queue 1 ring object. This object can be used in
+* the various Ring API functions.
+*
+* @param  InstancePtr is the DMA channel to operate on.
+*
+* @return RxQ1BdRing attribute
+*
+* @note
+* C-style signature:
+*    XEmacPs_BdRing XEmacPs_GetRxQ1Ring(XEmacPs * InstancePtr)
+*
+*****************************************************************************/
+#define XEmacPs_GetRxQ1Ring(InstancePtr) ((InstancePtr)->RxQ1BdRing)
+
 /****************************************************************************/
 /**
 *
@@ -797,10 +846,30 @@ LONG XEmacPs_PhyRead(XEmacPs *InstancePtr, u32 PhyAddress,
 LONG XEmacPs_PhyWrite(XEmacPs *InstancePtr, u32 PhyAddress,
 		      u32 RegisterNum, u16 PhyData);
 LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index);
+void XEmacPs_SetType1Screener(XEmacPs *InstancePtr, u8 Index, u8 QueueNum,
+			u32 MatchOptions, u8 DsTc, u16 UdpPort);
+void XEmacPs_SetType2Screener(XEmacPs *InstancePtr, u8 Index, u8 QueueNum,
+			u32 MatchOptions, u8 VlanPriority, u8 EthTypeIndex);
+void XEmacPs_SetScreenerEthType(XEmacPs *InstancePtr, u8 Index, u16 EthType);
+void XEmacPs_ClearScreeners(XEmacPs *InstancePtr);
 
 LONG XEmacPs_SendPausePacket(XEmacPs *InstancePtr);
 void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength);
 
+/*
+ * IEEE 1588 timer unit functions in xemacps_tsu.c
+ */
+LONG XEmacPs_TsuInit(XEmacPs *InstancePtr, u32 TsuClkFreqHz);
+void XEmacPs_TsuGetTime(XEmacPs *InstancePtr, XEmacPs_TsuTime *TimePtr);
+void XEmacPs_TsuSetTime(XEmacPs *InstancePtr, const XEmacPs_TsuTime *TimePtr);
+LONG XEmacPs_TsuAdjTime(XEmacPs *InstancePtr, s64 OffsetNs);
+LONG XEmacPs_TsuAdjFreq(XEmacPs *InstancePtr, s32 Ppb);
+LONG XEmacPs_SetBdTsMode(XEmacPs *InstancePtr, u32 TxMode, u32 RxMode);
+#ifdef XEMACPS_BD_TIMESTAMP
+void XEmacPs_BdGetTimestamp(XEmacPs *InstancePtr, XEmacPs_Bd *BdPtr,
+			XEmacPs_TsuTime *TimePtr);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -69,6 +69,8 @@
  *                     Disable extended mode. Perform all 64 bit changes under
  *                     check for arch64.
  * 3.2   hk   11/18/15 Change BD typedef and number of words.
+ * 3.7   ag   10/14/26 Added extended BDs with timestamp words, selected with
+ *                     XEMACPS_BD_TIMESTAMP, and BD timestamp macros.
  *
  * </pre>
  *
@@ -91,15 +93,28 @@ extern "C" {
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/*
+ * Build the driver with XEMACPS_BD_TIMESTAMP defined (e.g. through the BSP
+ * extra_compiler_flags) to use extended BDs, which carry the TSU timestamp
+ * of the frame in two extra words. See XEmacPs_SetBdTsMode().
+ */
 #ifdef __aarch64__
 /* Minimum BD alignment */
 #define XEMACPS_DMABD_MINIMUM_ALIGNMENT  64U
+#ifdef XEMACPS_BD_TIMESTAMP
+#define XEMACPS_BD_NUM_WORDS 6U
+#else
 #define XEMACPS_BD_NUM_WORDS 4U
+#endif
 #else
 /* Minimum BD alignment */
 #define XEMACPS_DMABD_MINIMUM_ALIGNMENT  4U
+#ifdef XEMACPS_BD_TIMESTAMP
+#define XEMACPS_BD_NUM_WORDS 4U
+#else
 #define XEMACPS_BD_NUM_WORDS 2U
 #endif
+#endif
 
 /**
  * The XEmacPs_Bd is the type for buffer descriptors (BDs).
@@ -794,6 +809,44 @@ typedef u32 XEmacPs_Bd[XEMACPS_BD_NUM_WORDS];
     XEMACPS_RXBUF_SOF_MASK)!=0U ? TRUE : FALSE)
 
 
+#ifdef XEMACPS_BD_TIMESTAMP
+/*****************************************************************************/
+/**
+ * Determine whether the GEM stored a timestamp in a transmit BD. Only the
+ * last BD of a frame holds the timestamp.
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @return TRUE if the BD holds a timestamp, FALSE otherwise
+ *
+ * @note
+ * C-style signature:
+ *    u8 XEmacPs_BdIsTxTimestamp(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdIsTxTimestamp(BdPtr)                             \
+    ((XEmacPs_BdRead((BdPtr), XEMACPS_BD_STAT_OFFSET) &           \
+    XEMACPS_TXBUF_TS_MASK)!=0U ? TRUE : FALSE)
+
+/*****************************************************************************/
+/**
+ * Determine whether the GEM stored a timestamp in a receive BD.
+ *
+ * @param  BdPtr is the BD pointer to operate on
+ *
+ * @return TRUE if the BD holds a timestamp, FALSE otherwise
+ *
+ * @note
+ * C-style signature:
+ *    u8 XEmacPs_BdIsRxTimestamp(XEmacPs_Bd* BdPtr)
+ *
+ *****************************************************************************/
+#define XEmacPs_BdIsRxTimestamp(BdPtr)                             \
+    ((XEmacPs_BdRead((BdPtr), XEMACPS_BD_ADDR_OFFSET) &           \
+    XEMACPS_RXBUF_TS_MASK)!=0U ? TRUE : FALSE)
+#endif
+
+
 /************************** Function Prototypes ******************************/
 
 #ifdef __cplusplus
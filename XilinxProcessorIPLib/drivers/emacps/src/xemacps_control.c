@@ -52,6 +52,8 @@
  * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
  * 3.0   hk   02/20/15 Added support for jumbo frames.
  * 3.2   hk   02/22/16 Added SGMII support for Zynq Ultrascale+ MPSoC.
+ * 3.7   ag   10/14/26 Added type 1 and type 2 screener APIs for steering
+ *                     received frames to priority queues.
  * </pre>
  *****************************************************************************/
 
@@ -435,6 +437,128 @@ LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Program a type 1 screener. A type 1 screener steers received frames whose
+ * IP DS/TC field and/or UDP destination port match to the given priority
+ * queue. Screeners may be reprogrammed while the device is running.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Index is the screener to be configured (0-3).
+ * @param QueueNum is the receive queue matching frames are steered to.
+ * @param MatchOptions is an OR of XEMACPS_SCREEN_T1_DSTC_EN_MASK and
+ *        XEMACPS_SCREEN_T1_UDP_EN_MASK. Passing 0 disables the screener.
+ * @param DsTc is the DS/TC value to be matched.
+ * @param UdpPort is the UDP destination port to be matched.
+ *
+ *****************************************************************************/
+void XEmacPs_SetType1Screener(XEmacPs *InstancePtr, u8 Index, u8 QueueNum,
+			u32 MatchOptions, u8 DsTc, u16 UdpPort)
+{
+	u32 Reg;
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Index < (u8)XEMACPS_MAX_SCREEN_T1);
+	Xil_AssertVoid(QueueNum <= (u8)XEMACPS_SCREEN_T1_QUEUE_MASK);
+
+	Reg = (u32)QueueNum & XEMACPS_SCREEN_T1_QUEUE_MASK;
+	Reg |= ((u32)DsTc << XEMACPS_SCREEN_T1_DSTC_SHIFT) &
+			XEMACPS_SCREEN_T1_DSTC_MASK;
+	Reg |= ((u32)UdpPort << XEMACPS_SCREEN_T1_UDP_SHIFT) &
+			XEMACPS_SCREEN_T1_UDP_MASK;
+	Reg |= MatchOptions & ((u32)XEMACPS_SCREEN_T1_DSTC_EN_MASK |
+			(u32)XEMACPS_SCREEN_T1_UDP_EN_MASK);
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+		((u32)XEMACPS_SCREEN_T1_OFFSET + ((u32)Index * (u32)4)), Reg);
+}
+
+/*****************************************************************************/
+/**
+ * Program a type 2 screener. A type 2 screener steers received frames whose
+ * VLAN priority and/or ethertype match to the given priority queue. The
+ * ethertype itself is held in one of the screener ethertype registers, see
+ * XEmacPs_SetScreenerEthType(). Screeners may be reprogrammed while the
+ * device is running.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Index is the screener to be configured (0-3).
+ * @param QueueNum is the receive queue matching frames are steered to.
+ * @param MatchOptions is an OR of XEMACPS_SCREEN_T2_VLAN_EN_MASK and
+ *        XEMACPS_SCREEN_T2_ETH_EN_MASK. Passing 0 disables the screener.
+ * @param VlanPriority is the VLAN priority to be matched.
+ * @param EthTypeIndex is the screener ethertype register to be matched (0-3).
+ *
+ *****************************************************************************/
+void XEmacPs_SetType2Screener(XEmacPs *InstancePtr, u8 Index, u8 QueueNum,
+			u32 MatchOptions, u8 VlanPriority, u8 EthTypeIndex)
+{
+	u32 Reg;
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Index < (u8)XEMACPS_MAX_SCREEN_T2);
+	Xil_AssertVoid(QueueNum <= (u8)XEMACPS_SCREEN_T2_QUEUE_MASK);
+	Xil_AssertVoid(EthTypeIndex < (u8)XEMACPS_MAX_SCREEN_ETHTYPE);
+
+	Reg = (u32)QueueNum & XEMACPS_SCREEN_T2_QUEUE_MASK;
+	Reg |= ((u32)VlanPriority << XEMACPS_SCREEN_T2_VPRI_SHIFT) &
+			XEMACPS_SCREEN_T2_VPRI_MASK;
+	Reg |= ((u32)EthTypeIndex << XEMACPS_SCREEN_T2_ETH_SHIFT) &
+			XEMACPS_SCREEN_T2_ETH_MASK;
+	Reg |= MatchOptions & ((u32)XEMACPS_SCREEN_T2_VLAN_EN_MASK |
+			(u32)XEMACPS_SCREEN_T2_ETH_EN_MASK);
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+		((u32)XEMACPS_SCREEN_T2_OFFSET + ((u32)Index * (u32)4)), Reg);
+}
+
+/*****************************************************************************/
+/**
+ * Set one of the ethertype registers referenced by the type 2 screeners.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Index is the ethertype register to be configured (0-3).
+ * @param EthType is the ethertype to be matched, in host order.
+ *
+ *****************************************************************************/
+void XEmacPs_SetScreenerEthType(XEmacPs *InstancePtr, u8 Index, u16 EthType)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Index < (u8)XEMACPS_MAX_SCREEN_ETHTYPE);
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+		((u32)XEMACPS_SCREEN_ETHTYPE_OFFSET + ((u32)Index * (u32)4)),
+		(u32)EthType);
+}
+
+/*****************************************************************************/
+/**
+ * Disable all type 1 and type 2 screeners so that every received frame is
+ * placed on queue 0.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ *
+ *****************************************************************************/
+void XEmacPs_ClearScreeners(XEmacPs *InstancePtr)
+{
+	u32 Index;
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	/* Screeners are only present on GEM versions with priority queues */
+	if (InstancePtr->Version > 2) {
+		for (Index = 0U; Index < XEMACPS_MAX_SCREEN_T1; Index++) {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				(XEMACPS_SCREEN_T1_OFFSET + (Index * (u32)4)), 0x0U);
+		}
+		for (Index = 0U; Index < XEMACPS_MAX_SCREEN_T2; Index++) {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				(XEMACPS_SCREEN_T2_OFFSET + (Index * (u32)4)), 0x0U);
+		}
+	}
+}
+
 /*****************************************************************************/
 /**
  * Set options for the driver/device. The driver should be stopped with
@@ -61,6 +61,8 @@
 *                    Remove "used bit set" from TX error interrupt masks.
 * 3.1  hk   08/10/15 Update upper 32 bit tx and rx queue ptr register offsets.
 * 3.2   hk   02/22/16 Added SGMII support for Zynq Ultrascale+ MPSoC.
+* 3.7   ag   10/14/26 Added TSU sub-nanosecond increment, seconds high and
+*                    BD timestamp control registers and BD timestamp masks.
 * </pre>
 *
 ******************************************************************************/
@@ -83,6 +85,12 @@ extern "C" {
 #define XEMACPS_MAX_MAC_ADDR     4U   /**< Maxmum number of mac address
                                            supported */
 #define XEMACPS_MAX_TYPE_ID      4U   /**< Maxmum number of type id supported */
+#define XEMACPS_MAX_SCREEN_T1     4U   /**< Maximum number of type 1
+                                           screeners supported */
+#define XEMACPS_MAX_SCREEN_T2     4U   /**< Maximum number of type 2
+                                           screeners supported */
+#define XEMACPS_MAX_SCREEN_ETHTYPE 4U  /**< Maximum number of type 2
+                                           screener ethertype registers */
 
 #ifdef __aarch64__
 #define XEMACPS_BD_ALIGNMENT     64U   /**< Minimum buffer descriptor alignment
@@ -273,6 +281,11 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_LAST_OFFSET          0x000001B4U /**< Last statistic counter
 						      offset, for clearing */
 
+#define XEMACPS_1588_SUBNSINC_OFFSET 0x000001BCU /**< 1588 sub-nanosecond
+						      increment (ZynqMP) */
+#define XEMACPS_1588_SEC_HI_OFFSET   0x000001C0U /**< 1588 second counter
+						      bits [47:32] (ZynqMP) */
+
 #define XEMACPS_1588_SEC_OFFSET      0x000001D0U /**< 1588 second counter */
 #define XEMACPS_1588_NANOSEC_OFFSET  0x000001D4U /**< 1588 nanosecond counter */
 #define XEMACPS_1588_ADJ_OFFSET      0x000001D8U /**< 1588 nanosecond
@@ -304,6 +317,10 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 							reg */
 #define XEMACPS_MSBBUF_TXQBASE_OFFSET  0x000004C8U /**< MSB Buffer TX Q Base
 							reg */
+#define XEMACPS_TXBDCTRL_OFFSET      0x000004CCU /**< TX BD timestamp
+							control reg */
+#define XEMACPS_RXBDCTRL_OFFSET      0x000004D0U /**< RX BD timestamp
+							control reg */
 #define XEMACPS_MSBBUF_RXQBASE_OFFSET  0x000004D4U /**< MSB Buffer RX Q Base
 							reg */
 #define XEMACPS_INTQ1_IER_OFFSET     0x00000600U /**< Interrupt Q1 Enable
@@ -312,6 +329,12 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 							reg */
 #define XEMACPS_INTQ1_IMR_OFFSET     0x00000640U /**< Interrupt Q1 Mask
 							reg */
+#define XEMACPS_SCREEN_T1_OFFSET     0x00000500U /**< Type 1 screener 0
+							reg */
+#define XEMACPS_SCREEN_T2_OFFSET     0x00000540U /**< Type 2 screener 0
+							reg */
+#define XEMACPS_SCREEN_ETHTYPE_OFFSET 0x000006E0U /**< Type 2 screener
+							ethertype 0 reg */
 
 /* Define some bit positions for registers. */
 
@@ -400,6 +423,23 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 /*@}*/
 
 
+/** @name 1588 timer unit register bit definitions
+ * @{
+ */
+#define XEMACPS_1588_ADJ_SUB_MASK      0x80000000U /**< Subtract the
+                                                        adjustment */
+#define XEMACPS_1588_ADJ_NS_MASK       0x3FFFFFFFU /**< Adjustment in ns */
+#define XEMACPS_1588_INC_NS_MASK       0x000000FFU /**< ns per TSU clock */
+#define XEMACPS_1588_SUBNSINC_HI_MASK  0x0000FFFFU /**< Sub-ns increment
+                                                        bits [23:8] */
+#define XEMACPS_1588_SUBNSINC_LO_SHIFT 24U         /**< Sub-ns increment
+                                                        bits [7:0] */
+#define XEMACPS_1588_SEC_HI_MASK       0x0000FFFFU /**< Seconds [47:32] */
+#define XEMACPS_BDCTRL_TSMODE_MASK     0x00000030U /**< BD timestamp mode */
+#define XEMACPS_BDCTRL_TSMODE_SHIFT    4U          /**< BD timestamp mode
+                                                        shift */
+/*@}*/
+
 /** @name DMA control register bit definitions
  * @{
  */
@@ -463,12 +503,50 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
  */
 #define XEMACPS_INTQ1SR_TXCOMPL_MASK	0x00000080U /**< Transmit completed OK */
 #define XEMACPS_INTQ1SR_TXERR_MASK	0x00000040U /**< Transmit AMBA Error */
+#define XEMACPS_INTQ1SR_RXUSED_MASK	0x00000004U /**< RX Q1 buffer used bit
+							 read */
+#define XEMACPS_INTQ1SR_RXCOMPL_MASK	0x00000002U /**< Receive Q1 completed
+							 OK */
 
 #define XEMACPS_INTQ1_IXR_ALL_MASK	((u32)XEMACPS_INTQ1SR_TXCOMPL_MASK | \
 					 (u32)XEMACPS_INTQ1SR_TXERR_MASK)
 
 /*@}*/
 
+/**
+ * @name Type 1 screener register bit definitions
+ * A type 1 screener steers frames to a priority queue based on the IP
+ * DS/TC field and/or the UDP destination port.
+ * @{
+ */
+#define XEMACPS_SCREEN_T1_QUEUE_MASK	0x0000000FU /**< Destination queue */
+#define XEMACPS_SCREEN_T1_DSTC_MASK	0x00000FF0U /**< DS/TC match value */
+#define XEMACPS_SCREEN_T1_DSTC_SHIFT	4U
+#define XEMACPS_SCREEN_T1_UDP_MASK	0x0FFFF000U /**< UDP port match value */
+#define XEMACPS_SCREEN_T1_UDP_SHIFT	12U
+#define XEMACPS_SCREEN_T1_DSTC_EN_MASK	0x10000000U /**< DS/TC match enable */
+#define XEMACPS_SCREEN_T1_UDP_EN_MASK	0x20000000U /**< UDP port match
+							 enable */
+/*@}*/
+
+/**
+ * @name Type 2 screener register bit definitions
+ * A type 2 screener steers frames to a priority queue based on the VLAN
+ * priority and/or the ethertype.
+ * @{
+ */
+#define XEMACPS_SCREEN_T2_QUEUE_MASK	0x0000000FU /**< Destination queue */
+#define XEMACPS_SCREEN_T2_VPRI_MASK	0x00000070U /**< VLAN priority */
+#define XEMACPS_SCREEN_T2_VPRI_SHIFT	4U
+#define XEMACPS_SCREEN_T2_VLAN_EN_MASK	0x00000100U /**< VLAN priority match
+							 enable */
+#define XEMACPS_SCREEN_T2_ETH_MASK	0x00000E00U /**< Ethertype register
+							 index */
+#define XEMACPS_SCREEN_T2_ETH_SHIFT	9U
+#define XEMACPS_SCREEN_T2_ETH_EN_MASK	0x00001000U /**< Ethertype match
+							 enable */
+/*@}*/
+
 /**
  * @name interrupts bit definitions
  * Bits definitions are same in XEMACPS_ISR_OFFSET,
@@ -532,6 +610,22 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_BD_ADDR_OFFSET  0x00000000U /**< word 0/addr of BDs */
 #define XEMACPS_BD_STAT_OFFSET  0x00000004U /**< word 1/status of BDs */
 #define XEMACPS_BD_ADDR_HI_OFFSET  0x00000008U /**< word 2/addr of BDs */
+#ifdef __aarch64__
+#define XEMACPS_BD_TS1_OFFSET   0x00000010U /**< word 4/timestamp ns and
+						  seconds [1:0] */
+#define XEMACPS_BD_TS2_OFFSET   0x00000014U /**< word 5/timestamp seconds
+						  [5:2] */
+#else
+#define XEMACPS_BD_TS1_OFFSET   0x00000008U /**< word 2/timestamp ns and
+						  seconds [1:0] */
+#define XEMACPS_BD_TS2_OFFSET   0x0000000CU /**< word 3/timestamp seconds
+						  [5:2] */
+#endif
+
+#define XEMACPS_BD_TS_NSEC_MASK  0x3FFFFFFFU /**< Timestamp nanoseconds */
+#define XEMACPS_BD_TS_SECL_SHIFT 30U         /**< Timestamp seconds [1:0] */
+#define XEMACPS_BD_TS_SECH_MASK  0x0000000FU /**< Timestamp seconds [5:2] */
+#define XEMACPS_BD_TS_SEC_BITS   6U          /**< Seconds bits held in BD */
 
 /*
  * @}
@@ -551,6 +645,7 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_TXBUF_RETRY_MASK 0x20000000U /**< Retry limit exceeded */
 #define XEMACPS_TXBUF_URUN_MASK  0x10000000U /**< Transmit underrun occurred */
 #define XEMACPS_TXBUF_EXH_MASK   0x08000000U /**< Buffers exhausted */
+#define XEMACPS_TXBUF_TS_MASK    0x00800000U /**< Timestamp captured */
 #define XEMACPS_TXBUF_TCP_MASK   0x04000000U /**< Late collision. */
 #define XEMACPS_TXBUF_NOCRC_MASK 0x00010000U /**< No CRC */
 #define XEMACPS_TXBUF_LAST_MASK  0x00008000U /**< Last buffer */
@@ -578,6 +673,17 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
                                                       matched */
 #define XEMACPS_RXBUF_IDFOUND_MASK   0x01000000U /**< Type ID matched */
 #define XEMACPS_RXBUF_IDMATCH_MASK   0x00C00000U /**< ID matched mask */
+#define XEMACPS_RXBUF_CSUM_MASK      0x00C00000U /**< Checksum status mask,
+                                                      valid when RX checksum
+                                                      offload is enabled */
+#define XEMACPS_RXBUF_CSUM_NONE      0x00000000U /**< Neither IP header nor
+                                                      TCP/UDP checked */
+#define XEMACPS_RXBUF_CSUM_IP        0x00400000U /**< IP header checked,
+                                                      TCP/UDP not checked */
+#define XEMACPS_RXBUF_CSUM_IP_TCP    0x00800000U /**< IP header and TCP
+                                                      checked */
+#define XEMACPS_RXBUF_CSUM_IP_UDP    0x00C00000U /**< IP header and UDP
+                                                      checked */
 #define XEMACPS_RXBUF_VLAN_MASK      0x00200000U /**< VLAN tagged */
 #define XEMACPS_RXBUF_PRI_MASK       0x00100000U /**< Priority tagged */
 #define XEMACPS_RXBUF_VPRI_MASK      0x000E0000U /**< Vlan priority */
@@ -587,6 +693,8 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_RXBUF_LEN_MASK       0x00001FFFU /**< Mask for length field */
 #define XEMACPS_RXBUF_LEN_JUMBO_MASK 0x00003FFFU /**< Mask for jumbo length */
 
+#define XEMACPS_RXBUF_TS_MASK        0x00000004U /**< Timestamp captured,
+                                                      extended BDs only */
 #define XEMACPS_RXBUF_WRAP_MASK      0x00000002U /**< Wrap bit, last BD */
 #define XEMACPS_RXBUF_NEW_MASK       0x00000001U /**< Used bit.. */
 #define XEMACPS_RXBUF_ADD_MASK       0xFFFFFFFCU /**< Mask for address */
@@ -0,0 +1,395 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xemacps_tsu.c
+* @addtogroup emacps_v3_7
+* @{
+ *
+ * Functions in this file drive the IEEE 1588 timer unit (TSU) of the GEM:
+ * reading and setting the time, offset and frequency adjustment, and the
+ * timestamps the ZynqMP GEM stores in extended buffer descriptors.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 3.7   ag   10/14/26 First release
+ * </pre>
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xemacps.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XEMACPS_TSU_INCR_MAX	((u64)XEMACPS_1588_INC_NS_MASK << \
+					XEMACPS_TSU_SUBNS_SHIFT)
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static void XEmacPs_TsuSetIncr(XEmacPs *InstancePtr, u32 Incr);
+
+/************************** Variable Definitions *****************************/
+
+
+/*****************************************************************************/
+/**
+ * Program the TSU increment. Incr is the number of nanoseconds the timer
+ * advances per TSU clock, with 24 fractional bits. The Zynq GEM has no
+ * sub-nanosecond increment and uses the rounded value.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Incr is the increment, ns << 24.
+ *
+ *****************************************************************************/
+static void XEmacPs_TsuSetIncr(XEmacPs *InstancePtr, u32 Incr)
+{
+	u32 SubNs;
+
+	if (InstancePtr->Version > 2) {
+		SubNs = Incr & (((u32)1 << XEMACPS_TSU_SUBNS_SHIFT) - (u32)1);
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			XEMACPS_1588_SUBNSINC_OFFSET,
+			((SubNs >> 8U) & XEMACPS_1588_SUBNSINC_HI_MASK) |
+			((SubNs & 0xFFU) << XEMACPS_1588_SUBNSINC_LO_SHIFT));
+	} else {
+		Incr += (u32)1 << (XEMACPS_TSU_SUBNS_SHIFT - 1U);
+	}
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+		XEMACPS_1588_INC_OFFSET,
+		(Incr >> XEMACPS_TSU_SUBNS_SHIFT) & XEMACPS_1588_INC_NS_MASK);
+}
+
+/*****************************************************************************/
+/**
+ * Set the nominal TSU increment for the TSU reference clock. The timer then
+ * counts nanoseconds at the nominal rate; XEmacPs_TsuAdjFreq() adjusts the
+ * rate relative to it.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TsuClkFreqHz is the TSU clock frequency, e.g.
+ *        XPAR_XEMACPS_0_ENET_TSU_CLK_FREQ_HZ.
+ *
+ * @return
+ * - XST_SUCCESS if the increment was set
+ * - XST_INVALID_PARAM if the clock is out of the range of the TSU
+ *
+ *****************************************************************************/
+LONG XEmacPs_TsuInit(XEmacPs *InstancePtr, u32 TsuClkFreqHz)
+{
+	u64 Incr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TsuClkFreqHz != 0U);
+
+	Incr = ((u64)XEMACPS_TSU_NSEC_PER_SEC << XEMACPS_TSU_SUBNS_SHIFT) /
+		(u64)TsuClkFreqHz;
+	if ((Incr == 0U) || (Incr > XEMACPS_TSU_INCR_MAX)) {
+		return (LONG)(XST_INVALID_PARAM);
+	}
+
+	InstancePtr->TsuIncr = (u32)Incr;
+	XEmacPs_TsuSetIncr(InstancePtr, InstancePtr->TsuIncr);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * Read the TSU time.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TimePtr returns the current time.
+ *
+ * @note A seconds rollover between the register reads is detected and the
+ *       nanoseconds are read again.
+ *
+ *****************************************************************************/
+void XEmacPs_TsuGetTime(XEmacPs *InstancePtr, XEmacPs_TsuTime *TimePtr)
+{
+	UINTPTR Base;
+	u32 Sec;
+	u32 SecAgain;
+	u32 NanoSec;
+	u64 SecHi = 0U;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(TimePtr != NULL);
+
+	Base = InstancePtr->Config.BaseAddress;
+
+	Sec = XEmacPs_ReadReg(Base, XEMACPS_1588_SEC_OFFSET);
+	NanoSec = XEmacPs_ReadReg(Base, XEMACPS_1588_NANOSEC_OFFSET);
+	SecAgain = XEmacPs_ReadReg(Base, XEMACPS_1588_SEC_OFFSET);
+	if (SecAgain != Sec) {
+		NanoSec = XEmacPs_ReadReg(Base, XEMACPS_1588_NANOSEC_OFFSET);
+	}
+	if (InstancePtr->Version > 2) {
+		SecHi = (u64)(XEmacPs_ReadReg(Base, XEMACPS_1588_SEC_HI_OFFSET) &
+			XEMACPS_1588_SEC_HI_MASK);
+	}
+
+	TimePtr->Seconds = (SecHi << 32U) | (u64)SecAgain;
+	TimePtr->NanoSeconds = NanoSec;
+}
+
+/*****************************************************************************/
+/**
+ * Set the TSU time.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TimePtr is the time to be set. Seconds above 32 bits are ignored
+ *        on the Zynq GEM.
+ *
+ *****************************************************************************/
+void XEmacPs_TsuSetTime(XEmacPs *InstancePtr, const XEmacPs_TsuTime *TimePtr)
+{
+	UINTPTR Base;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(TimePtr != NULL);
+	Xil_AssertVoid(TimePtr->NanoSeconds < XEMACPS_TSU_NSEC_PER_SEC);
+
+	Base = InstancePtr->Config.BaseAddress;
+
+	if (InstancePtr->Version > 2) {
+		XEmacPs_WriteReg(Base, XEMACPS_1588_SEC_HI_OFFSET,
+			(u32)(TimePtr->Seconds >> 32U) & XEMACPS_1588_SEC_HI_MASK);
+	}
+	XEmacPs_WriteReg(Base, XEMACPS_1588_SEC_OFFSET,
+			(u32)(TimePtr->Seconds & ULONG64_LO_MASK));
+	XEmacPs_WriteReg(Base, XEMACPS_1588_NANOSEC_OFFSET,
+			TimePtr->NanoSeconds);
+}
+
+/*****************************************************************************/
+/**
+ * Shift the TSU time by an offset. Offsets below one second are applied by
+ * the TSU adjust register without stopping the timer; larger offsets are
+ * applied by reading and writing the time.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param OffsetNs is the offset in nanoseconds, negative to go back.
+ *
+ * @return
+ * - XST_SUCCESS if the time was adjusted
+ * - XST_INVALID_PARAM if the time would go below zero
+ *
+ *****************************************************************************/
+LONG XEmacPs_TsuAdjTime(XEmacPs *InstancePtr, s64 OffsetNs)
+{
+	XEmacPs_TsuTime Time;
+	s64 Sec;
+	s64 NanoSec;
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if ((OffsetNs > -(s64)XEMACPS_TSU_NSEC_PER_SEC) &&
+	    (OffsetNs < (s64)XEMACPS_TSU_NSEC_PER_SEC)) {
+		if (OffsetNs < 0) {
+			Reg = (u32)(-OffsetNs) | XEMACPS_1588_ADJ_SUB_MASK;
+		} else {
+			Reg = (u32)OffsetNs;
+		}
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XEMACPS_1588_ADJ_OFFSET, Reg);
+		return (LONG)(XST_SUCCESS);
+	}
+
+	XEmacPs_TsuGetTime(InstancePtr, &Time);
+
+	Sec = OffsetNs / (s64)XEMACPS_TSU_NSEC_PER_SEC;
+	NanoSec = (s64)Time.NanoSeconds +
+		(OffsetNs % (s64)XEMACPS_TSU_NSEC_PER_SEC);
+	if (NanoSec < 0) {
+		NanoSec += (s64)XEMACPS_TSU_NSEC_PER_SEC;
+		Sec--;
+	} else if (NanoSec >= (s64)XEMACPS_TSU_NSEC_PER_SEC) {
+		NanoSec -= (s64)XEMACPS_TSU_NSEC_PER_SEC;
+		Sec++;
+	} else {
+		/* nanoseconds in range */
+	}
+
+	if ((Sec < 0) && ((u64)(-Sec) > Time.Seconds)) {
+		return (LONG)(XST_INVALID_PARAM);
+	}
+
+	Time.Seconds = (u64)((s64)Time.Seconds + Sec);
+	Time.NanoSeconds = (u32)NanoSec;
+	XEmacPs_TsuSetTime(InstancePtr, &Time);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * Adjust the TSU rate relative to the nominal increment set by
+ * XEmacPs_TsuInit().
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Ppb is the frequency offset in parts per billion, positive to run
+ *        faster.
+ *
+ * @return
+ * - XST_SUCCESS if the rate was adjusted
+ * - XST_INVALID_PARAM if the adjusted increment is out of range
+ * - XST_NO_FEATURE if the GEM has no sub-nanosecond increment (Zynq) and
+ *   Ppb is not zero
+ *
+ *****************************************************************************/
+LONG XEmacPs_TsuAdjFreq(XEmacPs *InstancePtr, s32 Ppb)
+{
+	s64 Incr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->TsuIncr != 0U);
+
+	if ((InstancePtr->Version <= 2) && (Ppb != 0)) {
+		return (LONG)(XST_NO_FEATURE);
+	}
+
+	Incr = (s64)InstancePtr->TsuIncr +
+		(((s64)InstancePtr->TsuIncr * (s64)Ppb) /
+		(s64)XEMACPS_TSU_NSEC_PER_SEC);
+	if ((Incr <= 0) || (Incr > (s64)XEMACPS_TSU_INCR_MAX)) {
+		return (LONG)(XST_INVALID_PARAM);
+	}
+
+	XEmacPs_TsuSetIncr(InstancePtr, (u32)Incr);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * Select which transmitted and received frames the TSU timestamps into
+ * their buffer descriptors. Requires the ZynqMP GEM and a driver built with
+ * XEMACPS_BD_TIMESTAMP.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param TxMode is the transmit timestamp mode, XEMACPS_TS_MODE_*.
+ * @param RxMode is the receive timestamp mode, XEMACPS_TS_MODE_*.
+ *
+ * @return
+ * - XST_SUCCESS if the modes were set
+ * - XST_NO_FEATURE if the GEM or the driver build has no extended BDs
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetBdTsMode(XEmacPs *InstancePtr, u32 TxMode, u32 RxMode)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TxMode <= XEMACPS_TS_MODE_ALL);
+	Xil_AssertNonvoid(RxMode <= XEMACPS_TS_MODE_ALL);
+
+#ifndef XEMACPS_BD_TIMESTAMP
+	if ((TxMode != XEMACPS_TS_MODE_NONE) ||
+	    (RxMode != XEMACPS_TS_MODE_NONE)) {
+		return (LONG)(XST_NO_FEATURE);
+	}
+#endif
+	if (InstancePtr->Version <= 2) {
+		return (LONG)(XST_NO_FEATURE);
+	}
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+		XEMACPS_TXBDCTRL_OFFSET,
+		(TxMode << XEMACPS_BDCTRL_TSMODE_SHIFT) &
+		XEMACPS_BDCTRL_TSMODE_MASK);
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+		XEMACPS_RXBDCTRL_OFFSET,
+		(RxMode << XEMACPS_BDCTRL_TSMODE_SHIFT) &
+		XEMACPS_BDCTRL_TSMODE_MASK);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+#ifdef XEMACPS_BD_TIMESTAMP
+/*****************************************************************************/
+/**
+ * Get the timestamp the TSU stored in an extended BD. The BD holds the low
+ * six bits of the seconds; the upper bits are taken from the current TSU
+ * time, so the BD has to be processed within 64 seconds of the frame.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param BdPtr is a BD for which XEmacPs_BdIsTxTimestamp() or
+ *        XEmacPs_BdIsRxTimestamp() is TRUE.
+ * @param TimePtr returns the timestamp.
+ *
+ *****************************************************************************/
+void XEmacPs_BdGetTimestamp(XEmacPs *InstancePtr, XEmacPs_Bd *BdPtr,
+			XEmacPs_TsuTime *TimePtr)
+{
+	XEmacPs_TsuTime Now;
+	u32 Ts1;
+	u32 Ts2;
+	u64 Sec;
+	u64 SecMask = ((u64)1 << XEMACPS_BD_TS_SEC_BITS) - (u64)1;
+
+	Xil_AssertVoid(BdPtr != NULL);
+	Xil_AssertVoid(TimePtr != NULL);
+
+	Ts1 = XEmacPs_BdRead(BdPtr, XEMACPS_BD_TS1_OFFSET);
+	Ts2 = XEmacPs_BdRead(BdPtr, XEMACPS_BD_TS2_OFFSET);
+
+	XEmacPs_TsuGetTime(InstancePtr, &Now);
+
+	Sec = (u64)(Ts1 >> XEMACPS_BD_TS_SECL_SHIFT) |
+		((u64)(Ts2 & XEMACPS_BD_TS_SECH_MASK) << 2U);
+	Sec |= Now.Seconds & ~SecMask;
+	if (Sec > Now.Seconds) {
+		Sec -= SecMask + (u64)1;
+	}
+
+	TimePtr->Seconds = Sec;
+	TimePtr->NanoSeconds = Ts1 & XEMACPS_BD_TS_NSEC_MASK;
+}
+#endif
+/** @} */
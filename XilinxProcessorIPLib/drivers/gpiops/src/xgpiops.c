@@ -52,6 +52,7 @@
 * 2.1   hk   04/29/14 Use Input data register DATA_RO for read. CR# 771667.
 * 3.00  kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1	kvn  04/13/15 Add support for Zynq Ultrascale+ MP. CR# 856980.
+*       ag   10/14/26 Added XGpioPs_WriteMask().
 *
 * </pre>
 *
@@ -99,6 +100,7 @@ s32 XGpioPs_CfgInitialize(XGpioPs *InstancePtr, XGpioPs_Config *ConfigPtr,
 {
 	s32 Status = XST_SUCCESS;
 	u8 i;
+	u32 Pin;
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(ConfigPtr != NULL);
 	Xil_AssertNonvoid(EffectiveAddr != (u32)0);
@@ -110,6 +112,13 @@ s32 XGpioPs_CfgInitialize(XGpioPs *InstancePtr, XGpioPs_Config *ConfigPtr,
 	InstancePtr->GpioConfig.BaseAddr = EffectiveAddr;
 	InstancePtr->GpioConfig.DeviceId = ConfigPtr->DeviceId;
 	InstancePtr->Handler = StubHandler;
+	for (i = 0U; i < XGPIOPS_MAX_BANKS_ZYNQMP; i++) {
+		InstancePtr->PinHandlerMask[i] = 0U;
+		for (Pin = 0U; Pin < XGPIOPS_BANK_MAX_PINS; Pin++) {
+			InstancePtr->PinHandler[i][Pin] = NULL;
+			InstancePtr->PinCallBackRef[i][Pin] = NULL;
+		}
+	}
 	InstancePtr->Platform = XGetPlatform_Info();
 
 	/* Initialize the Bank data based on platform */
@@ -240,6 +249,55 @@ void XGpioPs_Write(XGpioPs *InstancePtr, u8 Bank, u32 Data)
 			  XGPIOPS_DATA_OFFSET, Data);
 }
 
+/****************************************************************************/
+/**
+*
+* Write data to the selected pins of the specified GPIO Bank.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	Bank is the bank number of the GPIO to operate on.
+*		Valid values are 0-3 in Zynq and 0-5 in Zynq Ultrascale+ MP.
+* @param	Mask is the 32 bit mask of the pins to be written. Bits with 1
+*		are written, bits with 0 are left unchanged.
+* @param	Data is the value to be written to the selected pins.
+*
+* @return	None.
+*
+* @note		The pins are written through the MASK_DATA_LSW/MSW registers,
+*		one write for each half of the bank which has a selected pin.
+*		No read-modify-write of the Data register is done, so the
+*		other pins are not affected by concurrent writers.
+*
+*****************************************************************************/
+void XGpioPs_WriteMask(XGpioPs *InstancePtr, u8 Bank, u32 Mask, u32 Data)
+{
+	u32 RegOffset;
+	u32 Value;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Bank < InstancePtr->MaxBanks);
+
+	RegOffset = (u32)Bank * XGPIOPS_DATA_MASK_OFFSET;
+
+	/*
+	 * The upper 16 bits of the Mask/Data registers are the mask, where a
+	 * bit with 0 selects the pin for the write, and the lower 16 bits are
+	 * the data.
+	 */
+	if ((Mask & 0x0000FFFFU) != (u32)0) {
+		Value = ((~Mask & 0x0000FFFFU) << 16U) | (Data & 0x0000FFFFU);
+		XGpioPs_WriteReg(InstancePtr->GpioConfig.BaseAddr,
+				  RegOffset + XGPIOPS_DATA_LSW_OFFSET, Value);
+	}
+
+	if ((Mask & 0xFFFF0000U) != (u32)0) {
+		Value = (~Mask & 0xFFFF0000U) | (Data >> 16U);
+		XGpioPs_WriteReg(InstancePtr->GpioConfig.BaseAddr,
+				  RegOffset + XGPIOPS_DATA_MSW_OFFSET, Value);
+	}
+}
+
 /****************************************************************************/
 /**
 *
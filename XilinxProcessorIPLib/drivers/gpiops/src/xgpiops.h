@@ -64,6 +64,18 @@
 * Users of this driver need to provide callback functions. An interrupt handler
 * example is available with the driver.
 *
+* A callback can also be set for a single pin with
+* XGpioPs_SetPinCallbackHandler(). The interrupt handler then walks the
+* pending pins of a bank lowest first, calls the pin callbacks and passes only
+* the remaining pins to the bank callback.
+*
+* <b>Masked Writes</b>
+*
+* XGpioPs_WriteMask() updates any set of pins of a bank with at most two writes
+* to the MASK_DATA_LSW/MSW registers. The other pins of the bank are left
+* unchanged without a read-modify-write of the DATA register, so the update is
+* safe against other writers of the same bank.
+*
 * <b>Threads</b>
 *
 * This driver is not thread safe. Any needs for threads or thread mutual
@@ -107,6 +119,8 @@
 *                     for zcu102 and zc702 boards in polled and interrupt
 *                     example, configured Interrupt pin to input pin for
 *                     proper functioning of interrupt example.
+*       ag   10/14/26 Added XGpioPs_WriteMask() and per pin interrupt
+*                     callbacks with XGpioPs_SetPinCallbackHandler().
 * </pre>
 *
 ******************************************************************************/
@@ -190,6 +204,20 @@ extern "C" {
  *****************************************************************************/
 typedef void (*XGpioPs_Handler) (void *CallBackRef, u32 Bank, u32 Status);
 
+/****************************************************************************/
+/**
+ * This handler data type allows the user to define a callback function to
+ * handle the interrupt of a single pin.
+ *
+ * @param	CallBackRef is a callback reference passed in by the upper layer
+ *		when setting the callback function for the pin.
+ * @param	Bank is the bank of the pin which caused the interrupt.
+ * @param	PinNumber is the pin number within the bank.
+ *
+ *****************************************************************************/
+typedef void (*XGpioPs_PinHandler) (void *CallBackRef, u32 Bank,
+					u32 PinNumber);
+
 /**
  * This typedef contains configuration information for a device.
  */
@@ -211,6 +239,12 @@ typedef struct {
 	u32 Platform;			/**< Platform data */
 	u32 MaxPinNum;			/**< Max pins in the GPIO device */
 	u8 MaxBanks;			/**< Max banks in a GPIO device */
+	XGpioPs_PinHandler PinHandler[XGPIOPS_MAX_BANKS_ZYNQMP]
+				[XGPIOPS_BANK_MAX_PINS]; /**< Pin handlers */
+	void *PinCallBackRef[XGPIOPS_MAX_BANKS_ZYNQMP]
+				[XGPIOPS_BANK_MAX_PINS]; /**< Pin callback refs */
+	u32 PinHandlerMask[XGPIOPS_MAX_BANKS_ZYNQMP]; /**< Pins of each bank
+						       *  with a pin handler */
 } XGpioPs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -224,6 +258,7 @@ s32 XGpioPs_CfgInitialize(XGpioPs *InstancePtr, XGpioPs_Config *ConfigPtr,
 /* Bank APIs in xgpiops.c */
 u32 XGpioPs_Read(XGpioPs *InstancePtr, u8 Bank);
 void XGpioPs_Write(XGpioPs *InstancePtr, u8 Bank, u32 Data);
+void XGpioPs_WriteMask(XGpioPs *InstancePtr, u8 Bank, u32 Mask, u32 Data);
 void XGpioPs_SetDirection(XGpioPs *InstancePtr, u8 Bank, u32 Direction);
 u32 XGpioPs_GetDirection(XGpioPs *InstancePtr, u8 Bank);
 void XGpioPs_SetOutputEnable(XGpioPs *InstancePtr, u8 Bank, u32 OpEnable);
@@ -254,6 +289,8 @@ void XGpioPs_GetIntrType(XGpioPs *InstancePtr, u8 Bank, u32 *IntrType,
 			  u32 *IntrPolarity, u32 *IntrOnAny);
 void XGpioPs_SetCallbackHandler(XGpioPs *InstancePtr, void *CallBackRef,
 			     XGpioPs_Handler FuncPointer);
+void XGpioPs_SetPinCallbackHandler(XGpioPs *InstancePtr, u32 Pin,
+				void *CallBackRef, XGpioPs_PinHandler FuncPointer);
 void XGpioPs_IntrHandler(XGpioPs *InstancePtr);
 
 /* Pin APIs in xgpiops_intr.c */
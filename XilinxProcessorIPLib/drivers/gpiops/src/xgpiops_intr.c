@@ -48,6 +48,8 @@
 * 					  passed to API's. CR# 822636
 * 3.00  kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1	kvn  04/13/15 Add support for Zynq Ultrascale+ MP. CR# 856980.
+*       ag   10/14/26 Added per pin callbacks dispatched from
+*                     XGpioPs_IntrHandler().
 * </pre>
 *
 ******************************************************************************/
@@ -62,6 +64,9 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+/* Number of the lowest set bit of a non zero value */
+#define XGpioPs_LowestPin(Value)	((u32)__builtin_ctz(Value))
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Prototypes ******************************/
@@ -665,6 +670,51 @@ void XGpioPs_SetCallbackHandler(XGpioPs *InstancePtr, void *CallBackRef,
 	InstancePtr->CallBackRef = CallBackRef;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function sets the callback function for the interrupt of a single pin.
+* The callback function is called by the XGpioPs_IntrHandler when an
+* interrupt occurs on the pin, instead of the bank callback.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	Pin is the pin number for which the callback is set.
+*		Valid values are 0-117 in Zynq and 0-173 in Zynq Ultrascale+ MP.
+* @param	CallBackRef is the upper layer callback reference passed back
+*		when the callback function is invoked.
+* @param	FuncPointer is the pointer to the callback function, or NULL
+*		to give the pin back to the bank callback.
+*
+* @return	None.
+*
+* @note		The handler is called within interrupt context, so it should do
+*		its work quickly and queue potentially time-consuming work to a
+*		task-level thread.
+*
+******************************************************************************/
+void XGpioPs_SetPinCallbackHandler(XGpioPs *InstancePtr, u32 Pin,
+				void *CallBackRef, XGpioPs_PinHandler FuncPointer)
+{
+	u8 Bank;
+	u8 PinNumber;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Pin < InstancePtr->MaxPinNum);
+
+	/* Get the Bank number and Pin number within the bank. */
+	XGpioPs_GetBankPin((u8)Pin, &Bank, &PinNumber);
+
+	InstancePtr->PinHandler[Bank][PinNumber] = FuncPointer;
+	InstancePtr->PinCallBackRef[Bank][PinNumber] = CallBackRef;
+
+	if (FuncPointer != NULL) {
+		InstancePtr->PinHandlerMask[Bank] |= ((u32)1 << PinNumber);
+	} else {
+		InstancePtr->PinHandlerMask[Bank] &= ~((u32)1 << PinNumber);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -674,6 +724,10 @@ void XGpioPs_SetCallbackHandler(XGpioPs *InstancePtr, void *CallBackRef,
 * handler set by the function XGpioPs_SetBankHandler(). The callback is called
 * when an interrupt
 *
+* The pending pins which have a callback set by XGpioPs_SetPinCallbackHandler()
+* are taken lowest first and their callbacks are called. The bank callback is
+* then called with the remaining pins, if any.
+*
 * @param	InstancePtr is a pointer to the XGpioPs instance.
 *
 * @return	None.
@@ -687,6 +741,8 @@ void XGpioPs_IntrHandler(XGpioPs *InstancePtr)
 	u8 Bank;
 	u32 IntrStatus;
 	u32 IntrEnabled;
+	u32 PinStatus;
+	u32 PinNumber;
 
 	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
@@ -696,11 +752,27 @@ void XGpioPs_IntrHandler(XGpioPs *InstancePtr)
 		if (IntrStatus != (u32)0) {
 			IntrEnabled = XGpioPs_IntrGetEnabled(InstancePtr,
 							      Bank);
+			IntrStatus &= IntrEnabled;
 			XGpioPs_IntrClear((XGpioPs *)InstancePtr, Bank,
-							(IntrStatus & IntrEnabled));
-			InstancePtr->Handler(InstancePtr->
-					     CallBackRef, Bank,
-					     (IntrStatus & IntrEnabled));
+							IntrStatus);
+
+			/* Dispatch the pins which have their own handler */
+			PinStatus = IntrStatus &
+				InstancePtr->PinHandlerMask[Bank];
+			IntrStatus &= ~PinStatus;
+			while (PinStatus != (u32)0) {
+				PinNumber = XGpioPs_LowestPin(PinStatus);
+				PinStatus &= PinStatus - (u32)1;
+				InstancePtr->PinHandler[Bank][PinNumber](
+					InstancePtr->PinCallBackRef[Bank]
+					[PinNumber], Bank, PinNumber);
+			}
+
+			if (IntrStatus != (u32)0) {
+				InstancePtr->Handler(InstancePtr->
+						     CallBackRef, Bank,
+						     IntrStatus);
+			}
 		}
 	}
 }
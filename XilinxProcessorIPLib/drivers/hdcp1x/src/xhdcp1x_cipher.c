@@ -47,6 +47,7 @@
 * 1.00  fidus  07/16/15 Initial release.
 * 3.1   yas    06/14/16 Added new functions XHdcp1x_CipherEnableBlank
 *                       and XHdcp1x_CipherDisableBlank
+*       ag     10/14/26 Added XHdcp1x_CipherWaitRequestComplete.
 * </pre>
 *
 ******************************************************************************/
@@ -406,6 +407,40 @@ int XHdcp1x_CipherIsRequestComplete(const XHdcp1x *InstancePtr)
 	return (IsComplete);
 }
 
+/*****************************************************************************/
+/**
+* This function waits a bounded number of status reads for the current
+* request to complete.
+*
+* @param	InstancePtr is the device to query.
+* @param	MaxPolls is the maximum number of status reads.
+*
+* @return
+*		- XST_SUCCESS if the request completed.
+*		- XST_FAILURE if it is still in progress.
+*
+* @note		The cipher has no request complete interrupt. Block and rng
+*		requests complete within a few hundred core clock cycles,
+*		which lets the state machines finish the computations in the
+*		same pass instead of waiting for the next poll from the
+*		application main loop.
+*
+******************************************************************************/
+int XHdcp1x_CipherWaitRequestComplete(const XHdcp1x *InstancePtr,
+		u32 MaxPolls)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	do {
+		if (XHdcp1x_CipherIsRequestComplete(InstancePtr)) {
+			return (XST_SUCCESS);
+		}
+	} while (MaxPolls-- > 0);
+
+	return (XST_FAILURE);
+}
+
 /*****************************************************************************/
 /**
 * This function retrieves the current number of lanes of the HDCP cipher.
@@ -48,6 +48,7 @@
 *                       Added macro HDCP1X_CIPHER_BIT_REPEATER_ENABLE
 * 3.1   yas    06/15/16 Added new functions XHdcp1x_CipherEnableBlank
 *                       and XHdcp1x_CipherDisableBlank.
+*       ag     10/14/26 Added XHdcp1x_CipherWaitRequestComplete.
 * </pre>
 *
 ******************************************************************************/
@@ -107,6 +108,10 @@ typedef enum {
 							   *  indicate
 							   *  Repeater */
 
+#define XHDCP1X_CIPHER_REQUEST_POLLS	(1000u) /**< Status reads allowed for
+						  *  a block/rng request to
+						  *  complete in line */
+
 /************************** Function Prototypes ******************************/
 
 void XHdcp1x_CipherInit(XHdcp1x *InstancePtr);
@@ -126,6 +131,8 @@ int XHdcp1x_CipherSetKeySelect(XHdcp1x *InstancePtr, u8 KeySelect);
 int XHdcp1x_CipherDoRequest(XHdcp1x *InstancePtr,
 		XHdcp1x_CipherRequestType Request);
 int XHdcp1x_CipherIsRequestComplete(const XHdcp1x *InstancePtr);
+int XHdcp1x_CipherWaitRequestComplete(const XHdcp1x *InstancePtr,
+		u32 MaxPolls);
 
 u32 XHdcp1x_CipherGetNumLanes(const XHdcp1x *InstancePtr);
 int XHdcp1x_CipherSetNumLanes(XHdcp1x *InstancePtr, u32 NumLanes);
@@ -74,6 +74,8 @@
 *                       XHdcp1x_RxSetTopologyMaxDevsExceeded,
 *                       XHdcp1x_RxCheckEncryptionChange.
 * 4.1   yas    11/10/16 Added function XHdcp1x_RxSetHdmiMode.
+*       ag     10/14/26 Publish Ro' from XHdcp1x_RxStartComputations when the
+*                       cipher completes within XHDCP1X_CIPHER_REQUEST_POLLS.
 * </pre>
 *
 *****************************************************************************/
@@ -1179,9 +1181,6 @@ static void XHdcp1x_RxDisableState(XHdcp1x *InstancePtr)
 static void XHdcp1x_RxStartComputations(XHdcp1x *InstancePtr,
 		XHdcp1x_StateType *NextStatePtr)
 {
-	/* NextStatePtr not being used */
-	UNUSED(NextStatePtr);
-
 	u8 Buf[8];
 	u64 Value = 0;
 	u32 X = 0;
@@ -1224,6 +1223,12 @@ static void XHdcp1x_RxStartComputations(XHdcp1x *InstancePtr,
 
 	/* Initiate the block cipher */
 	XHdcp1x_CipherDoRequest(InstancePtr, XHDCP1X_CIPHER_REQUEST_BLOCK);
+
+	/* Publish Ro' right away if the cipher is done, otherwise poll for it */
+	if (XHdcp1x_CipherWaitRequestComplete(InstancePtr,
+			XHDCP1X_CIPHER_REQUEST_POLLS) == XST_SUCCESS) {
+		XHdcp1x_RxPollForComputations(InstancePtr, NextStatePtr);
+	}
 }
 
 /*****************************************************************************/
@@ -73,6 +73,10 @@
 *                       Increase timeout for topology propagation.
 * 4.1   yas    08/03/17 Updated the XHdcp1x_TxIsInProgress to track any
 *                       pending authentication requests.
+*       ag     10/14/26 Complete the cipher computations in line when done
+*                       within XHDCP1X_CIPHER_REQUEST_POLLS, bound the An
+*                       generation wait and check Ri/Ri' without leaving the
+*                       authenticated state when they match.
 * </pre>
 *
 *****************************************************************************/
@@ -176,6 +180,7 @@ static void XHdcp1x_TxValidateRx(XHdcp1x *InstancePtr,
 		XHdcp1x_StateType *NextStatePtr);
 static void XHdcp1x_TxCheckLinkIntegrity(XHdcp1x *InstancePtr,
 		XHdcp1x_StateType *NextStatePtr);
+static int XHdcp1x_TxIsRiMatch(XHdcp1x *InstancePtr);
 static void XHdcp1x_TxTestForRepeater(XHdcp1x *InstancePtr,
 		XHdcp1x_StateType *NextStatePtr);
 static void XHdcp1x_TxPollForWaitForReady(XHdcp1x *InstancePtr,
@@ -1353,10 +1358,11 @@ static u64 XHdcp1x_TxGenerateAn(XHdcp1x *InstancePtr)
 	if (XHdcp1x_CipherDoRequest(InstancePtr,
 		XHDCP1X_CIPHER_REQUEST_RNG) == XST_SUCCESS) {
 		/* Wait until done */
-		while (!XHdcp1x_CipherIsRequestComplete(InstancePtr));
-
-		/* Update theAn */
-		An = XHdcp1x_CipherGetMi(InstancePtr);
+		if (XHdcp1x_CipherWaitRequestComplete(InstancePtr,
+				XHDCP1X_CIPHER_REQUEST_POLLS) == XST_SUCCESS) {
+			/* Update theAn */
+			An = XHdcp1x_CipherGetMi(InstancePtr);
+		}
 	}
 
 	/* Check if zero */
@@ -1538,6 +1544,12 @@ static void XHdcp1x_TxStartComputations(XHdcp1x *InstancePtr,
 
 	/* Update NextStatePtr */
 	*NextStatePtr = XHDCP1X_STATE_COMPUTATIONS;
+
+	/* Move on right away if the cipher is done, otherwise poll for it */
+	if (XHdcp1x_CipherWaitRequestComplete(InstancePtr,
+			XHDCP1X_CIPHER_REQUEST_POLLS) == XST_SUCCESS) {
+		XHdcp1x_TxPollForComputations(InstancePtr, NextStatePtr);
+	}
 }
 
 /*****************************************************************************/
@@ -1713,6 +1725,44 @@ static void XHdcp1x_TxCheckLinkIntegrity(XHdcp1x *InstancePtr,
 	}
 }
 
+/*****************************************************************************/
+/**
+* This function performs a single Ri/Ri' comparison for the periodic link
+* check from the authenticated state.
+*
+* @param	InstancePtr is the hdcp state machine.
+*
+* @return	Truth value indicating match (TRUE) or not (FALSE).
+*
+* @note		A match is accounted as a passed link check. Read failures
+*		and mismatches are left to XHdcp1x_TxCheckLinkIntegrity()
+*		which retries and accounts the result.
+*
+******************************************************************************/
+static int XHdcp1x_TxIsRiMatch(XHdcp1x *InstancePtr)
+{
+	u8 Buf[2];
+	u16 RemoteRi = 0;
+
+	/* Read the remote Ri' */
+	if (XHdcp1x_PortRead(InstancePtr, XHDCP1X_PORT_OFFSET_RO,
+			Buf, 2) <= 0) {
+		return (FALSE);
+	}
+
+	/* Determine theRemoteRi */
+	XHDCP1X_PORT_BUF_TO_UINT(RemoteRi, Buf, 16);
+
+	/* Compare with the local value */
+	if (XHdcp1x_CipherGetRi(InstancePtr) != RemoteRi) {
+		return (FALSE);
+	}
+
+	InstancePtr->Tx.Stats.LinkCheckPassed++;
+
+	return (TRUE);
+}
+
 /*****************************************************************************/
 /**
 * This function checks the remote end to see if its a repeater.
@@ -2767,9 +2817,6 @@ static void XHdcp1x_TxRunValidateRxState(XHdcp1x *InstancePtr,
 static void XHdcp1x_TxRunAuthenticatedState(XHdcp1x *InstancePtr,
 		XHdcp1x_EventType Event, XHdcp1x_StateType *NextStatePtr)
 {
-	/* InstancePtr not being used */
-	UNUSED(InstancePtr);
-
 	/* Case-wise process the kind of event called */
 	switch (Event) {
 		/* For authenticate */
@@ -2779,7 +2826,11 @@ static void XHdcp1x_TxRunAuthenticatedState(XHdcp1x *InstancePtr,
 
 		/* For check */
 		case XHDCP1X_EVENT_CHECK:
-			*NextStatePtr = XHDCP1X_STATE_LINKINTEGRITYCHECK;
+			/* Only leave the state if Ri/Ri' do not match */
+			if (!XHdcp1x_TxIsRiMatch(InstancePtr)) {
+				*NextStatePtr =
+					XHDCP1X_STATE_LINKINTEGRITYCHECK;
+			}
 			break;
 
 		/* For disable */
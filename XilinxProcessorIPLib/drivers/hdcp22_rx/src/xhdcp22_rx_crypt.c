@@ -48,6 +48,8 @@
 * 1.00  MH   10/30/15 First Release
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.20  MH   06/21/17 Updated for 64 bit support.
+*       ag   10/14/26 Changed the private key exponentiation to a sliding
+*                     window method.
 *</pre>
 *
 *****************************************************************************/
@@ -62,6 +64,8 @@
 #include "xhdcp22_common.h"
 
 /************************** Constant Definitions ****************************/
+#define XHDCP22_RX_MONTEXP_WINDOW	4	/**< Exponentiation window in bits */
+#define XHDCP22_RX_MONTEXP_TABLE	(1 << (XHDCP22_RX_MONTEXP_WINDOW - 1))
 
 /**************************** Type Definitions ******************************/
 
@@ -90,6 +94,8 @@ static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B, u32 *N,
 	            const u32 *NPrime, int NDigits);
 static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits);
 #endif
+static void XHdcp22Rx_Pkcs1MontMult(XHdcp22_Rx *InstancePtr, u32 *U, u32 *A,
+	            u32 *B, u32 *N, const u32 *NPrime, int NDigits);
 static int  XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A, u32 *E,
 	            u32 *N, const u32 *NPrime, int NDigits);
 
@@ -903,10 +909,42 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 }
 #endif
 
+/****************************************************************************/
+/**
+* This function performs a Montgomery multiplication on the MMULT hardware,
+* or in software when _XHDCP22_RX_SW_MMULT_ is defined. The hardware has to
+* be initialized with the modulus using XHdcp22Rx_Pkcs1MontMultFiosInit.
+*
+* U = MontMult(A,B,N)
+*
+* @param	InstancePtr is a pointer to the HDCP22 Rx instance.
+* @param	U is the MMM result
+* @param	A is the n-residue input, A' = A*R mod N
+* @param	B is the n-residue input, B' = B*R mod N
+* @param	N is the modulus
+* @param	NPrime is a pre-computed constant, NPrime = (1-R*Rbar)/N
+* @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime)
+*
+* @return	None.
+*
+* @note		None.
+*****************************************************************************/
+static void XHdcp22Rx_Pkcs1MontMult(XHdcp22_Rx *InstancePtr, u32 *U, u32 *A,
+	u32 *B, u32 *N, const u32 *NPrime, int NDigits)
+{
+#ifndef _XHDCP22_RX_SW_MMULT_
+	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, U, A, B, NDigits);
+#else
+	XHdcp22Rx_Pkcs1MontMultFiosStub(U, A, B, N, NPrime, NDigits);
+#endif
+}
+
 /****************************************************************************/
 /**
 * This function performs the modular exponentation operation using the
-* binary square and multiply method.
+* sliding window method. The odd powers of the base up to the window size
+* are precomputed, after which each window of exponent bits takes a single
+* multiplication instead of one for every set bit.
 *
 * C = ModExp(A, E, N) = A^E*mod(N)
 *
@@ -926,9 +964,13 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	u32 *E, u32 *N, const u32 *NPrime, int NDigits)
 {
 	int Offset;
+	int Low;
+	int Bit;
+	int Window;
 	u32 R[XHDCP22_RX_N_SIZE/4];
 	u32 Abar[XHDCP22_RX_N_SIZE/4];
 	u32 Xbar[XHDCP22_RX_N_SIZE/4];
+	u32 Table[XHDCP22_RX_MONTEXP_TABLE][XHDCP22_RX_P_SIZE/4];
 
 	memset(R, 0, sizeof(R));
 	memset(Abar, 0, sizeof(Abar));
@@ -948,34 +990,55 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	/* Step 2: Abar = A*R*mod(N) */
 	mpModMult(Abar, A, Xbar, N, 2*NDigits);
 
-	/* Step 3: Binary square and multiply */
-	for(Offset=32*NDigits-1; Offset>=0; Offset--)
+	/* Step 3: Table[i] = Abar^(2i+1), Abar is reused for Abar^2 */
+	memcpy(Table[0], Abar, 4*NDigits);
+	XHdcp22Rx_Pkcs1MontMult(InstancePtr, Abar, Abar, Abar, N, NPrime, NDigits);
+	for(Window=1; Window<XHDCP22_RX_MONTEXP_TABLE; Window++)
 	{
-#ifndef _XHDCP22_RX_SW_MMULT_
-		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
-#else
-		XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Xbar, N, NPrime, NDigits);
-#endif
+		XHdcp22Rx_Pkcs1MontMult(InstancePtr, Table[Window],
+			Table[Window-1], Abar, N, NPrime, NDigits);
+	}
 
-		if(mpGetBit(E, NDigits, Offset) == TRUE)
+	/* Step 4: Sliding window square and multiply */
+	Offset = 32*NDigits-1;
+	while(Offset >= 0)
+	{
+		if(mpGetBit(E, NDigits, Offset) == FALSE)
 		{
-#ifndef _XHDCP22_RX_SW_MMULT_
-			XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Abar, NDigits);
-#else
-			XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Abar, N, NPrime, NDigits);
-#endif
+			XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Xbar, N, NPrime, NDigits);
+			Offset--;
+			continue;
+		}
+
+		/* Longest window ending with a set bit */
+		Low = Offset - XHDCP22_RX_MONTEXP_WINDOW + 1;
+		if(Low < 0)
+		{
+			Low = 0;
 		}
+		while(mpGetBit(E, NDigits, Low) == FALSE)
+		{
+			Low++;
+		}
+
+		Window = 0;
+		for(Bit=Offset; Bit>=Low; Bit--)
+		{
+			XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Xbar, N, NPrime, NDigits);
+			Window = (Window << 1) | ((mpGetBit(E, NDigits, Bit) == TRUE) ? 1 : 0);
+		}
+
+		XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Table[Window >> 1],
+			N, NPrime, NDigits);
+
+		Offset = Low - 1;
 	}
 
-	/* Step 4: C=MonPro(Xbar,1) */
+	/* Step 5: C=MonPro(Xbar,1) */
 	memset(R, 0, sizeof(R));
 	R[0] = 1;
 
-#ifndef _XHDCP22_RX_SW_MMULT_
-	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, C, Xbar, R, NDigits);
-#else
-	XHdcp22Rx_Pkcs1MontMultFiosStub(C, Xbar, R, N, NPrime, NDigits);
-#endif
+	XHdcp22Rx_Pkcs1MontMult(InstancePtr, C, Xbar, R, N, NPrime, NDigits);
 
 	return XST_SUCCESS;
 }
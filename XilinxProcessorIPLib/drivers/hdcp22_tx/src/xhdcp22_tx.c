@@ -75,6 +75,10 @@
 *                          buffer.
 *                       6. Check return status of DDC write/read when polling
 *                          RxStatus register.
+*       ag     10/14/26 Added XHdcp22Tx_LoadPairingInfo and the pairing info
+*                       update callback so the pairing table can be kept in
+*                       non-volatile storage. A full table now replaces the
+*                       least recently used entry instead of the first one.
 * </pre>
 *
 ******************************************************************************/
@@ -198,6 +202,9 @@ static void XHdcp22Tx_InvalidatePairingInfo(XHdcp22_Tx *InstancePtr,
                                              const u8* ReceiverId);
 static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(XHdcp22_Tx *InstancePtr,
                               const XHdcp22_Tx_PairingInfo *PairingInfo, u8 Ready);
+static XHdcp22_Tx_PairingInfo *XHdcp22Tx_StorePairingInfo(XHdcp22_Tx *InstancePtr,
+                              const XHdcp22_Tx_PairingInfo *PairingInfo, u8 Ready);
+static void XHdcp22Tx_NotifyPairingInfo(XHdcp22_Tx *InstancePtr);
 
 /* Timer functions */
 static void XHdcp22Tx_TimerHandler(void *CallbackRef, u8 TmrCntNumber);
@@ -1404,6 +1411,7 @@ u8 XHdcp22Tx_IsDwnstrmCapable (XHdcp22_Tx *InstancePtr)
 * (XHDCP22_TX_HANDLER_AUTHENTICATED)                 AuthenticatedCallback
 * (XHDCP22_TX_HANDLER_UNAUTHENTICATED)               UnauthenticatedCallback
 * (XHDCP22_TX_HANDLER_DOWNSTREAM_TOPOLOGY_AVAILABLE) DownstreamTopologyAvailableCallback
+* (XHDCP22_TX_HANDLER_PAIRINGINFO_UPDATE)            PairingInfoUpdateCallback
 * </pre>
 *
 * @param	InstancePtr is a pointer to the HDMI RX core instance.
@@ -1474,6 +1482,14 @@ int XHdcp22Tx_SetCallback(XHdcp22_Tx *InstancePtr, XHdcp22_Tx_HandlerType Handle
 			Status = (XST_SUCCESS);
 			break;
 
+		// Pairing info table has changed
+		case (XHDCP22_TX_HANDLER_PAIRINGINFO_UPDATE) :
+			InstancePtr->PairingInfoUpdateCallback = (XHdcp22_Tx_PairingInfoHandler)CallbackFunc;
+			InstancePtr->PairingInfoUpdateCallbackRef = CallbackRef;
+			InstancePtr->IsPairingInfoUpdateCallbackSet = (TRUE);
+			Status = (XST_SUCCESS);
+			break;
+
 		default:
 			Status = (XST_INVALID_PARAM);
 			break;
@@ -1786,6 +1802,9 @@ XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_1(XHdcp22_Tx *InstancePtr)
 			memcpy(PairingInfoPtr->RxCaps, MsgPtr->Message.AKESendCert.RxCaps,
 				sizeof(PairingInfoPtr->RxCaps));
 
+			/* Mark entry as recently used */
+			PairingInfoPtr->LastUsed = ++InstancePtr->Info.PairingInfoUseCnt;
+
 			/* Write encrypted Km */
 			Result = XHdcp22Tx_WriteAKEStoredKm(InstancePtr, PairingInfoPtr);
 
@@ -3843,7 +3862,8 @@ static int XHdcp22Tx_ReceiveMsg(XHdcp22_Tx *InstancePtr, u8 MessageId,
 *
 * @return  XST_SUCCESS
 *
-* @note    None.
+* @note    The pairing info update callback is invoked, if set, so that a
+*          persistent copy of the table can be cleared as well.
 *
 ******************************************************************************/
 int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr)
@@ -3852,9 +3872,64 @@ int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr)
 
 	memset(InstancePtr->Info.PairingInfo, 0x00,
 	       sizeof(InstancePtr->Info.PairingInfo));
+	InstancePtr->Info.PairingInfoUseCnt = 0;
+
+	XHdcp22Tx_NotifyPairingInfo(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads a previously saved pairing info table, so receivers
+* that were paired before a power cycle can authenticate with the
+* 'stored km' sequence. Only valid entries are taken over. If there are
+* more valid entries than slots, the least recently used ones are dropped.
+*
+* @param   InstancePtr is a pointer to the XHdcp22Tx core instance.
+* @param   PairingInfoPtr is a pointer to the table as it was passed to
+*          the pairing info update callback.
+* @param   NumEntries is the number of entries in the table.
+*
+* @return  XST_SUCCESS
+*
+* @note    This function must be called after #XHdcp22Tx_CfgInitialize,
+*          which clears the pairing info table. The table holds the master
+*          key Km of every receiver and must be kept in protected storage.
+*
+******************************************************************************/
+int XHdcp22Tx_LoadPairingInfo(XHdcp22_Tx *InstancePtr,
+                              const XHdcp22_Tx_PairingInfo *PairingInfoPtr,
+                              u32 NumEntries)
+{
+	u32 i;
+	u8 IllegalRecvID[] = {0x0, 0x0, 0x0, 0x0, 0x0};
+	XHdcp22_Tx_PairingInfo *EntryPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((PairingInfoPtr != NULL) || (NumEntries == 0));
+
+	for (i=0; i<NumEntries; i++) {
+		if ((PairingInfoPtr[i].Ready != TRUE) ||
+		    (memcmp(PairingInfoPtr[i].ReceiverId, IllegalRecvID,
+		            XHDCP22_TX_CERT_RCVID_SIZE) == 0)) {
+			continue;
+		}
+
+		EntryPtr = XHdcp22Tx_StorePairingInfo(InstancePtr,
+		                                      &PairingInfoPtr[i], TRUE);
+
+		/* Keep the saved use order */
+		EntryPtr->LastUsed = PairingInfoPtr[i].LastUsed;
+		if (PairingInfoPtr[i].LastUsed > InstancePtr->Info.PairingInfoUseCnt) {
+			InstancePtr->Info.PairingInfoUseCnt = PairingInfoPtr[i].LastUsed;
+		}
+	}
 
 	return XST_SUCCESS;
 }
+
 /*****************************************************************************/
 /**
 *
@@ -3893,13 +3968,12 @@ static XHdcp22_Tx_PairingInfo *XHdcp22Tx_GetPairingInfo(XHdcp22_Tx *InstancePtr,
 /*****************************************************************************/
 /**
 *
-* This function updates a pairing info entry in the storage.
+* This function updates a pairing info entry in the storage. When the
+* entry becomes valid, the pairing info update callback is invoked.
 *
 * @param  PairingInfo is a pointer to a pairing info structure.
 *
-* @return
-*         - XST_SUCCESS if there was enough room
-*         - XST_FAILURE if there was no room for this receiver
+* @return A pointer to the updated entry in the storage.
 *
 * @note   None.
 *
@@ -3908,9 +3982,41 @@ static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(
 	                          XHdcp22_Tx *InstancePtr,
                               const XHdcp22_Tx_PairingInfo *PairingInfo,
                               u8 Ready)
+{
+	XHdcp22_Tx_PairingInfo * PairingInfoPtr;
+
+	PairingInfoPtr = XHdcp22Tx_StorePairingInfo(InstancePtr, PairingInfo,
+	                                            Ready);
+
+	if (Ready == TRUE) {
+		XHdcp22Tx_NotifyPairingInfo(InstancePtr);
+	}
+
+	return PairingInfoPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stores a pairing info entry in the first slot that matches
+* the receiver Id, otherwise in the first empty slot. If the storage is
+* full, the least recently used entry is replaced.
+*
+* @param  PairingInfo is a pointer to a pairing info structure.
+*
+* @return A pointer to the stored entry.
+*
+* @note   None.
+*
+******************************************************************************/
+static XHdcp22_Tx_PairingInfo *XHdcp22Tx_StorePairingInfo(
+	                          XHdcp22_Tx *InstancePtr,
+                              const XHdcp22_Tx_PairingInfo *PairingInfo,
+                              u8 Ready)
 {
 	int i = 0;
 	int i_match = 0;
+	int i_lru = 0;
 	u8 Match = (FALSE);
 	XHdcp22_Tx_PairingInfo * PairingInfoPtr = NULL;
 
@@ -3925,25 +4031,63 @@ static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(
 			Match = (TRUE);
 		}
 
+		/* Track least recently used slot */
+		if (PairingInfoPtr->LastUsed <
+		    InstancePtr->Info.PairingInfo[i_lru].LastUsed) {
+			i_lru = i;
+		}
+
 		/* Look for match, match overrides empty slot */
 		if (memcmp(PairingInfo->ReceiverId, PairingInfoPtr->ReceiverId,
 		           XHDCP22_TX_CERT_RCVID_SIZE) == 0) {
 			i_match = i;
+			Match = (TRUE);
 			break;
 		}
 	}
 
+	/* Storage full, replace least recently used entry */
+	if (Match == FALSE) {
+		i_match = i_lru;
+	}
+
 	PairingInfoPtr = &InstancePtr->Info.PairingInfo[i_match];
 
 	/* Copy pairing info*/
-	memcpy(PairingInfoPtr, PairingInfo, sizeof(XHdcp22_Tx_PairingInfo));
+	if (PairingInfoPtr != PairingInfo) {
+		memcpy(PairingInfoPtr, PairingInfo, sizeof(XHdcp22_Tx_PairingInfo));
+	}
 
 	/* Set table ready */
 	PairingInfoPtr->Ready = Ready;
+	PairingInfoPtr->LastUsed = ++InstancePtr->Info.PairingInfoUseCnt;
 
 	return PairingInfoPtr;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function passes the pairing info table to the pairing info update
+* callback, so it can be written to non-volatile storage.
+*
+* @param  InstancePtr is a pointer to the XHdcp22Tx core instance.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+static void XHdcp22Tx_NotifyPairingInfo(XHdcp22_Tx *InstancePtr)
+{
+	if (InstancePtr->IsPairingInfoUpdateCallbackSet) {
+		InstancePtr->PairingInfoUpdateCallback(
+			InstancePtr->PairingInfoUpdateCallbackRef,
+			InstancePtr->Info.PairingInfo,
+			XHDCP22_TX_MAX_STORED_PAIRINGINFO);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -3962,12 +4106,21 @@ static void XHdcp22Tx_InvalidatePairingInfo(XHdcp22_Tx *InstancePtr,
 	XHdcp22_Tx_PairingInfo *InfoPtr = XHdcp22Tx_GetPairingInfo(InstancePtr,
 		                                                       ReceiverId);
 
+	u8 WasReady;
+
 	/* do nothing if the id was not found */
 	if (InfoPtr == NULL) {
 		return;
 	}
+	WasReady = InfoPtr->Ready;
+
 	/* clear the found structure */
 	memset(InfoPtr, 0x00, sizeof(XHdcp22_Tx_PairingInfo));
+
+	/* A stored entry was dropped, the persistent copy is stale */
+	if (WasReady == TRUE) {
+		XHdcp22Tx_NotifyPairingInfo(InstancePtr);
+	}
 }
 
 /*****************************************************************************/
@@ -86,6 +86,8 @@
 * 2.01  MH     02/28/17 Fixed compiler warnings.
 * 2.20  MH     04/12/17 Added function XHdcp22Tx_IsDwnstrmCapable.
 * 2.30  MH     07/06/17 Changed default polling value to 10 ms.
+*       ag     10/14/26 Added pairing info load function, LRU replacement
+*                       and pairing info update callback.
 * </pre>
 *
 ******************************************************************************/
@@ -130,9 +132,12 @@ extern "C" {
 #define XHDCP22_TX_REVOCATION_LIST_MAX_DEVICES 944
 
 /**
-* The list of maximum pairing info items to store.
+* The list of maximum pairing info items to store. May be overridden at
+* compile time to size the pairing table for the expected number of sinks.
 */
-#define XHDCP22_TX_MAX_STORED_PAIRINGINFO  2
+#ifndef XHDCP22_TX_MAX_STORED_PAIRINGINFO
+#define XHDCP22_TX_MAX_STORED_PAIRINGINFO  8
+#endif
 
 /**
 * The size of the log buffer.
@@ -152,6 +157,7 @@ typedef enum
 	XHDCP22_TX_HANDLER_AUTHENTICATED,
 	XHDCP22_TX_HANDLER_UNAUTHENTICATED,
 	XHDCP22_TX_HANDLER_DOWNSTREAM_TOPOLOGY_AVAILABLE,
+	XHDCP22_TX_HANDLER_PAIRINGINFO_UPDATE,
 	XHDCP22_TX_HANDLER_INVALID
 } XHdcp22_Tx_HandlerType;
 
@@ -319,6 +325,7 @@ typedef struct {
 	u8 Km[16];           /**< Km. */
 	u8 Ekh_Km[16];       /**< Ekh(Km). */
      u8 Ready;            /**< Indicates a valid entry */
+	u32 LastUsed;        /**< Use stamp for least recently used replacement. */
 } XHdcp22_Tx_PairingInfo;
 /**
 * This typedef contains information about the HDCP22 transmitter.
@@ -338,6 +345,7 @@ typedef struct
 	u8 MsgAvailable;                    /**< Message is available for reading. */
 
 	XHdcp22_Tx_PairingInfo PairingInfo[XHDCP22_TX_MAX_STORED_PAIRINGINFO];
+	u32 PairingInfoUseCnt;              /**< Last use stamp given to a pairing info entry. */
 	/** The result after a call to #XHdcp22Tx_Poll. */
 	XHdcp22_Tx_AuthenticationType AuthenticationStatus;
 
@@ -496,6 +504,24 @@ typedef int (*XHdcp22_Tx_DdcHandler)(u8 DeviceAddress, u16 ByteCount, u8* Buffer
 /** Callback type used for pointer to single input function */
 typedef void (*XHdcp22_Tx_Callback)(void *HandlerRef);
 
+/**
+* Callback type used for persisting the pairing info table.
+*
+* @param  HandlerRef is a callback reference passed in by the upper layer
+*         when setting the callback function.
+* @param  PairingInfoPtr is a pointer to the first entry of the pairing
+*         info table.
+* @param  NumEntries is the number of entries in the table.
+*
+* @return None.
+*
+* @note   The table contains the master key Km of every paired receiver
+*         and must only be written to protected storage.
+*
+*/
+typedef void (*XHdcp22_Tx_PairingInfoHandler)(void *HandlerRef,
+             const XHdcp22_Tx_PairingInfo *PairingInfoPtr, u32 NumEntries);
+
 
 /**
 * The XHdcpTx driver instance data. An instance must be allocated for each
@@ -544,6 +570,12 @@ typedef struct
 	u8 IsDownstreamTopologyAvailableCallbackSet;
 	void *DownstreamTopologyAvailableCallbackRef;
 
+	/** Function pointer called after the pairing info table has changed */
+	XHdcp22_Tx_PairingInfoHandler PairingInfoUpdateCallback;
+	/** Set if PairingInfoUpdateCallback handler is defined. */
+	u8 IsPairingInfoUpdateCallbackSet;
+	void *PairingInfoUpdateCallbackRef;
+
 	/** Internal used timer. */
 	XHdcp22_Tx_Timer Timer;
 
@@ -588,6 +620,9 @@ int XHdcp22Tx_CfgInitialize(XHdcp22_Tx *InstancePtr, XHdcp22_Tx_Config *CfgPtr,
                             UINTPTR EffectiveAddr);
 int XHdcp22Tx_Reset(XHdcp22_Tx *InstancePtr);
 int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr);
+int XHdcp22Tx_LoadPairingInfo(XHdcp22_Tx *InstancePtr,
+                              const XHdcp22_Tx_PairingInfo *PairingInfoPtr,
+                              u32 NumEntries);
 int XHdcp22Tx_Authenticate (XHdcp22_Tx *InstancePtr);
 int XHdcp22Tx_Poll(XHdcp22_Tx *InstancePtr);
 int XHdcp22Tx_Enable (XHdcp22_Tx *InstancePtr);
@@ -189,6 +189,9 @@
 *                      for CR-965028.
 *       ms    03/17/17 Added readme.txt file in examples folder for doxygen
 *                      generation.
+* 11.1  ag    10/14/26 Added XHwIcap_DeviceReadFrames and
+*                      XHwIcap_DeviceWriteFrames in xhwicap_device_frames.c
+*                      to read/write a range of frames with one packet.
 *
 * </pre>
 *
@@ -692,6 +695,18 @@ int XHwIcap_DeviceWriteFrame(XHwIcap *InstancePtr, long Top,
 				long MajorFrame, long MinorFrame,
 				u32 *FrameData);
 
+/*
+ * Functions in the xhwicap_device_frames.c
+ */
+int XHwIcap_DeviceReadFrames(XHwIcap *InstancePtr, long Top,
+				long Block, long HClkRow,
+				long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameBuffer);
+int XHwIcap_DeviceWriteFrames(XHwIcap *InstancePtr, long Top,
+				long Block, long HClkRow,
+				long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameData);
+
 /****************************************************************************/
 /**
 *
@@ -0,0 +1,520 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xhwicap_device_frames.c
+* @addtogroup hwicap_v11_1
+* @{
+*
+* This file contains the functions that read and write a range of
+* consecutive frames from/to the device (ICAP) with a single FDRO/FDRI
+* packet.
+*
+* The frame data is streamed through the Write FIFO in bursts of the FIFO
+* vacancy while the FIFO is being drained to the ICAP, the vacancy is only
+* polled again once the previous burst has been written.
+*
+* @note none.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/14/26 First release
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xhwicap_i.h"
+#include "xhwicap.h"
+#include "xparameters.h"
+#include <xil_types.h>
+#include <xil_assert.h>
+
+/************************** Constant Definitions ****************************/
+
+#define FRAMES_HEADER_SIZE	91
+
+/*
+ * Maximum number of words read with one read back of the Read FIFO
+ */
+#define FRAMES_READ_CHUNK_WORDS	2048U
+
+/**************************** Type Definitions ******************************/
+
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+
+/************************** Variable Definitions ****************************/
+
+
+/************************** Function Prototypes *****************************/
+
+static int XHwIcap_BurstStart(XHwIcap *InstancePtr);
+static void XHwIcap_BurstWrite(XHwIcap *InstancePtr, const u32 *Buffer,
+				u32 NumWords);
+static void XHwIcap_BurstEnd(XHwIcap *InstancePtr);
+
+/****************************************************************************/
+/**
+*
+* Reads a range of consecutive frames from the device and puts them in memory
+* specified by the user.
+*
+* @param	InstancePtr - a pointer to the XHwIcap instance to be worked on.
+* @param	Top - top (0) or bottom (1) half of device
+* @param	Block - Block Address (XHI_FAR_CLB_BLOCK,
+*		XHI_FAR_BRAM_BLOCK, XHI_FAR_BRAM_INT_BLOCK)
+* @param	HClkRow - selects the HClk Row
+* @param	MajorFrame - selects the column
+* @param	MinorFrame - selects the first frame inside column
+* @param	NumFrames - number of frames to read
+* @param	FrameBuffer is a pointer to the memory where the frames read
+*		from the device are stored. It has to hold NumFrames + 1
+*		frames, plus 10 words for Ultrascale and 25 words
+*		for Ultrascale plus devices.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		This is a blocking call.
+*		As with XHwIcap_DeviceReadFrame the frames are preceded by a
+*		pad frame in the FrameBuffer. The frame address is incremented
+*		by the device, so the range must not cross a row.
+*
+*****************************************************************************/
+int XHwIcap_DeviceReadFrames(XHwIcap *InstancePtr, long Top, long Block,
+				long HClkRow, long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameBuffer)
+{
+	u32 Packet;
+	u32 Data;
+	u32 TotalWords;
+	u32 ReadWords;
+	int Status;
+	u32 WriteBuffer[FRAMES_HEADER_SIZE];
+	u32 Index = 0;
+	u32 NumNoops;
+	u32 i;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(FrameBuffer != NULL);
+	Xil_AssertNonvoid(NumFrames > 0U);
+
+	/*
+	 * DUMMY and SYNC
+	 */
+	WriteBuffer[Index++] = XHI_DUMMY_PACKET;
+	WriteBuffer[Index++] = XHI_BUS_WTH_PACKET;
+	WriteBuffer[Index++] = XHI_BUS_DET_PACKET;
+	WriteBuffer[Index++] = XHI_DUMMY_PACKET;
+	WriteBuffer[Index++] = XHI_SYNC_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	/*
+	 * Reset CRC
+	 */
+	Packet = XHwIcap_Type1Write(XHI_CMD) | 1;
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = XHI_CMD_RCRC;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	/*
+	 * Setup CMD register to read configuration
+	 */
+	Packet = XHwIcap_Type1Write(XHI_CMD) | 1;
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = XHI_CMD_RCFG;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	/*
+	 * Setup FAR register.
+	 */
+	Packet = XHwIcap_Type1Write(XHI_FAR) | 1;
+	Data = XHwIcap_SetupFar(Top, Block, HClkRow,  MajorFrame, MinorFrame);
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = Data;
+
+	/*
+	 * Setup read data packet header for all the frames, which are
+	 * preceded by a dummy frame.
+	 */
+	TotalWords = InstancePtr->WordsPerFrame * (NumFrames + 1U);
+	switch (InstancePtr->DeviceFamily) {
+		case DEVICE_TYPE_7SERIES :
+			NumNoops = 32;
+			break;
+		case DEVICE_TYPE_ULTRA :
+			TotalWords += 10U;
+			NumNoops = 64;
+			break;
+		case DEVICE_TYPE_ULTRA_PLUS :
+			TotalWords += 25U;
+			NumNoops = 64;
+			break;
+		default:
+			return XST_FAILURE;
+	}
+
+	/*
+	 * Create Type one packet followed by the Type two word count
+	 */
+	Packet = XHwIcap_Type1Read(XHI_FDRO);
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = XHI_TYPE_2_READ | TotalWords;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	for (i = 0U; i < NumNoops; i++) {
+		WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	}
+
+	/*
+	 * Write the command header to the ICAP device.
+	 */
+	Status = XHwIcap_BurstStart(InstancePtr);
+	if (Status != XST_SUCCESS)  {
+		return XST_FAILURE;
+	}
+	XHwIcap_BurstWrite(InstancePtr, &WriteBuffer[0], Index);
+	XHwIcap_BurstEnd(InstancePtr);
+
+	/*
+	 * Wait till the write is done.
+	 */
+	while (XHwIcap_IsDeviceBusy(InstancePtr) != FALSE);
+
+	/*
+	 * Read the frames including the NULL frame, in chunks which fit in
+	 * the Size register.
+	 */
+	while (TotalWords > 0U) {
+		ReadWords = (TotalWords > FRAMES_READ_CHUNK_WORDS) ?
+				FRAMES_READ_CHUNK_WORDS : TotalWords;
+		Status = XHwIcap_DeviceRead(InstancePtr, FrameBuffer,
+				ReadWords);
+		if (Status != XST_SUCCESS)  {
+			return XST_FAILURE;
+		}
+		FrameBuffer += ReadWords;
+		TotalWords -= ReadWords;
+	}
+
+	/*
+	 * Send DESYNC command
+	 */
+	Status = XHwIcap_CommandDesync(InstancePtr);
+	if (Status != XST_SUCCESS)  {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Writes a range of consecutive frames from the specified buffer and puts
+* them in the device (ICAP).
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+* @param	Top - top (0) or bottom (1) half of device
+* @param	Block - Block Address (XHI_FAR_CLB_BLOCK,
+* 		XHI_FAR_BRAM_BLOCK, XHI_FAR_BRAM_INT_BLOCK)
+* @param	HClkRow - selects the HClk Row
+* @param	MajorFrame - selects the column
+* @param	MinorFrame - selects the first frame inside column
+* @param	NumFrames - number of frames to write
+* @param	FrameData is a pointer to the frames that are to be written
+*		to the device, preceded by a pad frame.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		This is a blocking function.
+*		This function is used in conjunction with the function
+*		XHwIcap_DeviceReadFrames. This function is used to write back
+*		the frames of data read using the XHwIcap_DeviceReadFrames.
+*
+*****************************************************************************/
+int XHwIcap_DeviceWriteFrames(XHwIcap *InstancePtr, long Top, long Block,
+				long HClkRow, long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameData)
+{
+	u32 Packet;
+	u32 Data;
+	u32 TotalWords;
+	int Status;
+	u32 WriteBuffer[FRAMES_HEADER_SIZE];
+	u32 Index = 0;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(FrameData != NULL);
+	Xil_AssertNonvoid(NumFrames > 0U);
+
+	/*
+	 * DUMMY and SYNC
+	 */
+	WriteBuffer[Index++] = XHI_DUMMY_PACKET;
+	WriteBuffer[Index++] = XHI_SYNC_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	/*
+	 * Reset CRC
+	 */
+	Packet = XHwIcap_Type1Write(XHI_CMD) | 1;
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = XHI_CMD_RCRC;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	/*
+	 * ID register
+	 */
+	Packet = XHwIcap_Type1Write(XHI_IDCODE) | 1;
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = InstancePtr->DeviceIdCode;
+
+	/*
+	 * Setup FAR
+	 */
+	Packet = XHwIcap_Type1Write(XHI_FAR) | 1;
+	Data = XHwIcap_SetupFar(Top, Block, HClkRow,  MajorFrame, MinorFrame);
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = Data;
+
+	/*
+	 * Setup CMD register - write configuration
+	 */
+	Packet = XHwIcap_Type1Write(XHI_CMD) | 1;
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = XHI_CMD_WCFG;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	/*
+	 * Setup Packet header for all the frames and the pad frame.
+	 */
+	TotalWords = InstancePtr->WordsPerFrame * (NumFrames + 1U);
+	if (TotalWords < XHI_TYPE_1_PACKET_MAX_WORDS)  {
+		/*
+		 * Create Type 1 Packet.
+		 */
+		Packet = XHwIcap_Type1Write(XHI_FDRI) | TotalWords;
+		WriteBuffer[Index++] = Packet;
+	}
+	else {
+		/*
+		 * Create Type 2 Packet.
+		 */
+		Packet = XHwIcap_Type1Write(XHI_FDRI);
+		WriteBuffer[Index++] = Packet;
+
+		Packet = XHI_TYPE_2_WRITE | TotalWords;
+		WriteBuffer[Index++] = Packet;
+	}
+
+	Status = XHwIcap_BurstStart(InstancePtr);
+	if (Status != XST_SUCCESS)  {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Stream the header, the frames and the pad frame without waiting
+	 * for the Write FIFO to drain in between.
+	 */
+	XHwIcap_BurstWrite(InstancePtr, &WriteBuffer[0], Index);
+	XHwIcap_BurstWrite(InstancePtr, &FrameData[InstancePtr->WordsPerFrame],
+				InstancePtr->WordsPerFrame * NumFrames);
+	XHwIcap_BurstWrite(InstancePtr, &FrameData[0],
+				InstancePtr->WordsPerFrame);
+
+	/* Add CRC */
+	Index = 0;
+	Packet = XHwIcap_Type1Write(XHI_CMD) | 1;
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = XHI_CMD_RCRC;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	/* Park the FAR */
+	Packet = XHwIcap_Type1Write(XHI_FAR) | 1;
+	Data = XHwIcap_SetupFar(0, 0, 3, 33, 0);
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = Data;
+
+	/* Add CRC */
+	Packet = XHwIcap_Type1Write(XHI_CMD) | 1;
+	WriteBuffer[Index++] = Packet;
+	WriteBuffer[Index++] = XHI_CMD_RCRC;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+	WriteBuffer[Index++] = XHI_NOOP_PACKET;
+
+	XHwIcap_BurstWrite(InstancePtr, &WriteBuffer[0], Index);
+	XHwIcap_BurstEnd(InstancePtr);
+
+	/*
+	 * Send DESYNC command
+	 */
+	Status = XHwIcap_CommandDesync(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Starts a burst transfer to the ICAP device.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+*
+* @return	XST_SUCCESS else XST_FAILURE if the device is busy with the
+*		last Read/Write.
+*
+* @note		The global interrupt is disabled, the burst transfer is
+*		always done in polled mode.
+*
+*****************************************************************************/
+static int XHwIcap_BurstStart(XHwIcap *InstancePtr)
+{
+	if (XHwIcap_IsTransferDone(InstancePtr) == FALSE) {
+		return XST_FAILURE;
+	}
+
+	if (XHwIcap_IsDeviceBusy(InstancePtr) == TRUE) {
+		return XST_FAILURE;
+	}
+
+#if (XPAR_HWICAP_0_MODE == 0) && (XPAR_HWICAP_0_ICAP_DWIDTH != 8) && \
+	(XPAR_HWICAP_0_ICAP_DWIDTH != 16)
+	InstancePtr->IsTransferInProgress = TRUE;
+	XHwIcap_IntrGlobalDisable(InstancePtr);
+#endif
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Writes the given words to the Write FIFO as part of a burst transfer.
+*
+* The Write FIFO is filled up to the vacancy read from the device and the
+* transfer to the ICAP is kept running, the vacancy is only read again when
+* the previous vacancy has been used up.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+* @param	Buffer is a pointer to the data to be written.
+* @param	NumWords is the number of words to write.
+*
+* @return	None.
+*
+* @note		Lite Mode and 8/16 bit ICAP widths fall back to
+*		XHwIcap_DeviceWrite.
+*
+*****************************************************************************/
+static void XHwIcap_BurstWrite(XHwIcap *InstancePtr, const u32 *Buffer,
+				u32 NumWords)
+{
+#if (XPAR_HWICAP_0_MODE == 0) && (XPAR_HWICAP_0_ICAP_DWIDTH != 8) && \
+	(XPAR_HWICAP_0_ICAP_DWIDTH != 16)
+	u32 WrFifoVacancy = 0U;
+
+	while (NumWords > 0U) {
+		if (WrFifoVacancy == 0U) {
+			WrFifoVacancy = XHwIcap_GetWrFifoVacancy(InstancePtr);
+		}
+
+		while ((WrFifoVacancy != 0U) && (NumWords > 0U)) {
+			XHwIcap_FifoWrite(InstancePtr, *Buffer);
+			Buffer++;
+			NumWords--;
+			WrFifoVacancy--;
+		}
+
+		/*
+		 * Keep the transfer from the FIFO to the ICAP running.
+		 */
+		if ((XHwIcap_ReadReg(InstancePtr->HwIcapConfig.BaseAddress,
+				XHI_CR_OFFSET) & XHI_CR_WRITE_MASK) == 0U) {
+			XHwIcap_StartConfig(InstancePtr);
+		}
+	}
+#else
+	if (XHwIcap_DeviceWrite(InstancePtr, (u32 *)Buffer, NumWords) ==
+			XST_SUCCESS) {
+		while (XHwIcap_IsTransferDone(InstancePtr) == FALSE);
+	}
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* Ends a burst transfer by waiting for the Write FIFO to be drained to the
+* ICAP device.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XHwIcap_BurstEnd(XHwIcap *InstancePtr)
+{
+#if (XPAR_HWICAP_0_MODE == 0) && (XPAR_HWICAP_0_ICAP_DWIDTH != 8) && \
+	(XPAR_HWICAP_0_ICAP_DWIDTH != 16)
+	while ((XHwIcap_ReadReg(InstancePtr->HwIcapConfig.BaseAddress,
+				XHI_CR_OFFSET)) & XHI_CR_WRITE_MASK);
+
+	InstancePtr->IsTransferInProgress = FALSE;
+	InstancePtr->RequestedWords = 0x0;
+#else
+	(void)InstancePtr;
+#endif
+}
+/** @} */
@@ -42,6 +42,7 @@
  * Ver   Who    Date      Changes
  * ----- ------ -------- --------------------------------------------------
  * 1.0   kar    01/25/18  Initial release.
+ *       ag     10/14/26  Added XI2s_Rx_AesToPcmS16 and XI2s_Rx_AesToPcmS32.
  * </pre>
  *
  *****************************************************************************/
@@ -54,11 +55,15 @@
 #include "xil_assert.h"
 #include "xstatus.h"
 #include "xil_types.h"
+#if defined (__aarch64__) && defined (__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 /************************** Constant Definitions *****************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XI2S_RX_CLK_MASK (0xFF)
+#define XI2S_RX_PCM_S32_MASK (0xFFFFFF00) /* 24 bit sample in a s32 */
 
 /**************************** Type Definitions *******************************/
 
@@ -354,4 +359,77 @@ void XI2s_Rx_ClrAesChStatRegs(XI2s_Rx *InstancePtr)
 	XI2s_Rx_WriteReg((InstancePtr)->Config.BaseAddress,
 			(XI2S_RX_AES_CHSTS0_OFFSET), (u32)0);
 }
+/*****************************************************************************/
+/**
+ *
+ * This function converts the AES3 sub-frame words produced by the core on
+ * its AXI4-Stream audio interface to 16 bit PCM samples. The 16 most
+ * significant bits of the audio sample field (bits [27:4]) are kept.
+ *
+ * @param PcmBuf is the buffer the interleaved PCM samples are written to.
+ * @param AesBuf is the buffer holding the AES3 words, e.g. a period of an
+ *        AXI DMA period ring.
+ * @param Count is the number of samples to convert.
+ *
+ * @return None.
+ *
+ *****************************************************************************/
+void XI2s_Rx_AesToPcmS16(s16 *PcmBuf, const u32 *AesBuf, u32 Count)
+{
+	u32 Index = 0;
+
+	Xil_AssertVoid(PcmBuf != NULL);
+	Xil_AssertVoid(AesBuf != NULL);
+
+#if defined (__aarch64__) && defined (__ARM_NEON)
+	for (; (Index + 8) <= Count; Index += 8) {
+		uint16x4_t Lo = vshrn_n_u32(vld1q_u32(&AesBuf[Index]), 12);
+		uint16x4_t Hi = vshrn_n_u32(vld1q_u32(&AesBuf[Index + 4]), 12);
+
+		vst1q_s16(&PcmBuf[Index],
+				vreinterpretq_s16_u16(vcombine_u16(Lo, Hi)));
+	}
+#endif
+	for (; Index < Count; Index++) {
+		PcmBuf[Index] = (s16)(u16)(AesBuf[Index] >> 12);
+	}
+}
+/*****************************************************************************/
+/**
+ *
+ * This function converts the AES3 sub-frame words produced by the core on
+ * its AXI4-Stream audio interface to 32 bit PCM samples. The audio sample
+ * field (bits [27:4]) goes to the 24 most significant bits of the sample,
+ * the 8 least significant bits are 0.
+ *
+ * @param PcmBuf is the buffer the interleaved PCM samples are written to.
+ * @param AesBuf is the buffer holding the AES3 words, e.g. a period of an
+ *        AXI DMA period ring.
+ * @param Count is the number of samples to convert.
+ *
+ * @return None.
+ *
+ *****************************************************************************/
+void XI2s_Rx_AesToPcmS32(s32 *PcmBuf, const u32 *AesBuf, u32 Count)
+{
+	u32 Index = 0;
+
+	Xil_AssertVoid(PcmBuf != NULL);
+	Xil_AssertVoid(AesBuf != NULL);
+
+#if defined (__aarch64__) && defined (__ARM_NEON)
+	const uint32x4_t Mask = vdupq_n_u32(XI2S_RX_PCM_S32_MASK);
+
+	for (; (Index + 4) <= Count; Index += 4) {
+		uint32x4_t Aes = vld1q_u32(&AesBuf[Index]);
+
+		vst1q_s32(&PcmBuf[Index], vreinterpretq_s32_u32(
+				vandq_u32(vshlq_n_u32(Aes, 4), Mask)));
+	}
+#endif
+	for (; Index < Count; Index++) {
+		PcmBuf[Index] = (s32)((AesBuf[Index] << 4) &
+				XI2S_RX_PCM_S32_MASK);
+	}
+}
 /** @} */
@@ -43,6 +43,7 @@
  * Ver   Who     Date     Changes
  * ----- ------ -------- --------------------------------------------------
  * 1.0   kar    01/25/18  Initial release.
+ *       ag     10/14/26  Added AES3 to PCM sample conversion.
  * </pre>
  *
  *****************************************************************************/
@@ -292,6 +293,10 @@ static inline void XI2s_Rx_LogClear(XI2s_Rx *InstancePtr)
 	void XI2s_Rx_SetAesChStatus(XI2s_Rx *InstancePtr, u8 *AesChStatusBuf);
 	void XI2s_Rx_ClrAesChStatRegs(XI2s_Rx *InstancePtr);
 
+	/* Sample format conversion */
+	void XI2s_Rx_AesToPcmS16(s16 *PcmBuf, const u32 *AesBuf, u32 Count);
+	void XI2s_Rx_AesToPcmS32(s32 *PcmBuf, const u32 *AesBuf, u32 Count);
+
 /************************** Variable Declarations ****************************/
 
 #ifdef __cplusplus
@@ -48,6 +48,7 @@
  * Ver   Who    Date     Changes
  * ----- ------ -------- --------------------------------------------------
  * 1.0   kar    11/16/17 Initial release.
+ *       ag     10/14/26 Added XI2s_Tx_PcmS16ToAes and XI2s_Tx_PcmS32ToAes.
  * </pre>
  *
  *****************************************************************************/
@@ -60,11 +61,15 @@
 #include "xil_assert.h"
 #include "xstatus.h"
 #include "xil_types.h"
+#if defined (__aarch64__) && defined (__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 /************************** Constant Definitions *****************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XI2S_TX_CLK_MASK (0xFF)
+#define XI2S_TX_AES_SAMPLE_MASK (0x0FFFFFF0) /* AES3 audio sample bits */
 /**************************** Type Definitions *******************************/
 
 /************************** Function Prototypes ******************************/
@@ -336,4 +341,87 @@ void XI2s_Tx_ClrAesChStatRegs(XI2s_Tx *InstancePtr)
 	XI2s_Tx_WriteReg((InstancePtr)->Config.BaseAddress,
 			(XI2S_TX_AES_CHSTS0_OFFSET), (u32)0);
 }
+/*****************************************************************************/
+/**
+ *
+ * This function converts 16 bit PCM samples to the AES3 sub-frame words
+ * taken by the core on its AXI4-Stream audio interface. The sample is
+ * placed in the most significant bits of the 24 bit audio sample field
+ * (bits [27:4]); the preamble, validity, user, channel status and parity
+ * bits are left to 0.
+ *
+ * @param AesBuf is the buffer the AES3 words are written to, e.g. a period
+ *        of an AXI DMA period ring.
+ * @param PcmBuf is the buffer holding the interleaved PCM samples.
+ * @param Count is the number of samples to convert.
+ *
+ * @return None.
+ *
+ *****************************************************************************/
+void XI2s_Tx_PcmS16ToAes(u32 *AesBuf, const s16 *PcmBuf, u32 Count)
+{
+	u32 Index = 0;
+
+	Xil_AssertVoid(AesBuf != NULL);
+	Xil_AssertVoid(PcmBuf != NULL);
+
+#if defined (__aarch64__) && defined (__ARM_NEON)
+	const uint32x4_t Mask = vdupq_n_u32(XI2S_TX_AES_SAMPLE_MASK);
+
+	for (; (Index + 8) <= Count; Index += 8) {
+		int16x8_t Pcm = vld1q_s16(&PcmBuf[Index]);
+		uint32x4_t Lo = vreinterpretq_u32_s32(
+				vmovl_s16(vget_low_s16(Pcm)));
+		uint32x4_t Hi = vreinterpretq_u32_s32(
+				vmovl_s16(vget_high_s16(Pcm)));
+
+		vst1q_u32(&AesBuf[Index], vandq_u32(vshlq_n_u32(Lo, 12), Mask));
+		vst1q_u32(&AesBuf[Index + 4],
+				vandq_u32(vshlq_n_u32(Hi, 12), Mask));
+	}
+#endif
+	for (; Index < Count; Index++) {
+		AesBuf[Index] = ((u32)(u16)PcmBuf[Index] << 12) &
+				XI2S_TX_AES_SAMPLE_MASK;
+	}
+}
+/*****************************************************************************/
+/**
+ *
+ * This function converts 32 bit PCM samples to the AES3 sub-frame words
+ * taken by the core on its AXI4-Stream audio interface. The 24 most
+ * significant bits of the sample go to the audio sample field (bits [27:4]);
+ * the preamble, validity, user, channel status and parity bits are left
+ * to 0.
+ *
+ * @param AesBuf is the buffer the AES3 words are written to, e.g. a period
+ *        of an AXI DMA period ring.
+ * @param PcmBuf is the buffer holding the interleaved PCM samples.
+ * @param Count is the number of samples to convert.
+ *
+ * @return None.
+ *
+ *****************************************************************************/
+void XI2s_Tx_PcmS32ToAes(u32 *AesBuf, const s32 *PcmBuf, u32 Count)
+{
+	u32 Index = 0;
+
+	Xil_AssertVoid(AesBuf != NULL);
+	Xil_AssertVoid(PcmBuf != NULL);
+
+#if defined (__aarch64__) && defined (__ARM_NEON)
+	const uint32x4_t Mask = vdupq_n_u32(XI2S_TX_AES_SAMPLE_MASK);
+
+	for (; (Index + 4) <= Count; Index += 4) {
+		uint32x4_t Pcm = vreinterpretq_u32_s32(
+				vld1q_s32(&PcmBuf[Index]));
+
+		vst1q_u32(&AesBuf[Index], vandq_u32(vshrq_n_u32(Pcm, 4), Mask));
+	}
+#endif
+	for (; Index < Count; Index++) {
+		AesBuf[Index] = ((u32)PcmBuf[Index] >> 4) &
+				XI2S_TX_AES_SAMPLE_MASK;
+	}
+}
 /** @} */
@@ -52,6 +52,7 @@
  * Ver   Who    Date     Changes
  * ----- ------ -------- --------------------------------------------------
  * 1.0   kar    11/16/17 Initial release.
+ *       ag     10/14/26 Added PCM to AES3 sample conversion.
  * </pre>
  *
  *****************************************************************************/
@@ -310,6 +311,10 @@ int XI2s_Tx_SetHandler(XI2s_Tx *InstancePtr, XI2s_Tx_HandlerType HandlerType,
 void XI2s_Tx_GetAesChStatus(XI2s_Tx *InstancePtr, u8 *AesChStatusBuf);
 void XI2s_Tx_ClrAesChStatRegs(XI2s_Tx *InstancePtr);
 
+/* Sample format conversion */
+void XI2s_Tx_PcmS16ToAes(u32 *AesBuf, const s16 *PcmBuf, u32 Count);
+void XI2s_Tx_PcmS32ToAes(u32 *AesBuf, const s32 *PcmBuf, u32 Count);
+
 /* Logging */
 void XI2s_Tx_LogDisplay(XI2s_Tx *InstancePtr);
 void XI2s_Tx_LogReset(XI2s_Tx *InstancePtr);
@@ -55,6 +55,7 @@
 *				12/06/14 Implemented Repeated start feature.
 *				01/31/15 Modified the code according to MISRAC 2012 Compliant.
 * 3.3   kvn		05/05/16 Modified latest code for MISRA-C:2012 Compliance.
+*       ag		10/14/26 Initialize the queued transfer state.
 *
 * </pre>
 *
@@ -122,6 +123,9 @@ s32 XIicPs_CfgInitialize(XIicPs *InstancePtr, XIicPs_Config *ConfigPtr,
 	InstancePtr->Config.InputClockHz = ConfigPtr->InputClockHz;
 	InstancePtr->StatusHandler = StubHandler;
 	InstancePtr->CallBackRef = NULL;
+	InstancePtr->XferHead = NULL;
+	InstancePtr->XferTail = NULL;
+	InstancePtr->XferMsgIndex = 0U;
 
 	InstancePtr->IsReady = (u32)XIL_COMPONENT_IS_READY;
 
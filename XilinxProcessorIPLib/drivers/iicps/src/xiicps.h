@@ -143,6 +143,19 @@
 * bit is set. Due to this errata, repeated start cannot be used if a receive
 * transfer is followed by any other transfer.
 *
+* <b>Queued Transfers</b>
+*
+* XIicPs_QueueTransfer() takes a list of write and read messages (segments)
+* that are issued back to back joined by repeated starts, with a single stop
+* at the end, and queues it behind any lists already in progress. The lists
+* are run from XIicPs_XferInterruptHandler(), which the application connects
+* in place of XIicPs_MasterInterruptHandler(). Write segments are refilled
+* each time the FIFO drains and read segments are drained at the FIFO data
+* threshold. The callback of a list is invoked once, after its last segment
+* or on the first error, and the next queued list is started right away.
+* Because of the errata above a read segment may only be the last segment of
+* a list, and it is limited to XIICPS_MAX_TRANSFER_SIZE bytes.
+*
 * <pre> MODIFICATION HISTORY:
 *
 * Ver   Who     Date     Changes
@@ -186,6 +199,8 @@
 * 3.3   kvn 05/05/16 Modified latest code for MISRA-C:2012 Compliance.
 *       ms  03/17/17 Added readme.txt file in examples folder for doxygen
 *                    generation.
+*       ag  10/14/26 Added queued transfers with repeated start segments,
+*                    XIicPs_QueueTransfer and XIicPs_XferInterruptHandler.
 *
 * </pre>
 *
@@ -253,6 +268,14 @@ extern "C" {
 /* Maximum transfer size */
 #define XIICPS_MAX_TRANSFER_SIZE	(u32)(255U - 3U)
 
+/** @name Message flags
+ * Flags for the Flags member of XIicPs_Msg.
+ * @{
+ */
+#define XIICPS_MSG_WRITE	0x0000U  /**< Segment writes to the slave */
+#define XIICPS_MSG_READ		0x0001U  /**< Segment reads from the slave */
+/*@}*/
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -268,6 +291,46 @@ extern "C" {
 */
 typedef void (*XIicPs_IntrHandler) (void *CallBackRef, u32 StatusEvent);
 
+/**
+ * One segment of a queued transfer. Consecutive segments of a transfer are
+ * joined by repeated starts.
+ */
+typedef struct {
+	u16 SlaveAddr;	/**< Address of the slave */
+	u16 Flags;	/**< XIICPS_MSG_WRITE or XIICPS_MSG_READ */
+	s32 ByteCount;	/**< Number of bytes to write or read */
+	u8 *BufPtr;	/**< Data to write or buffer to read into */
+} XIicPs_Msg;
+
+struct XIicPs_TransferS;
+
+/**
+* The handler data type for queued transfers. It is called once per transfer,
+* in interrupt context, when the transfer is complete or has failed.
+*
+* @param	CallBackRef is the reference given in the transfer.
+* @param	XferPtr is the transfer that finished. Its Status, StatusEvent
+*		and MsgsDone members describe the outcome.
+*/
+typedef void (*XIicPs_XferHandler) (void *CallBackRef,
+				struct XIicPs_TransferS *XferPtr);
+
+/**
+ * A queued transfer: a list of segments issued as one bus transaction. The
+ * structure is owned by the driver from XIicPs_QueueTransfer() until its
+ * handler is called.
+ */
+typedef struct XIicPs_TransferS {
+	XIicPs_Msg *Msgs;		/**< Segments of the transfer */
+	u32 NumMsgs;			/**< Number of segments */
+	XIicPs_XferHandler Handler;	/**< Completion handler */
+	void *CallBackRef;		/**< Reference passed to the handler */
+	s32 Status;			/**< XST_SUCCESS or XST_FAILURE */
+	u32 StatusEvent;		/**< XIICPS_EVENT_* bits on failure */
+	u32 MsgsDone;			/**< Segments completed */
+	struct XIicPs_TransferS *Next;	/**< Used by the driver queue */
+} XIicPs_Transfer;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -299,6 +362,10 @@ typedef struct {
 
 	XIicPs_IntrHandler StatusHandler;  /* Event handler function */
 	void *CallBackRef;	/* Callback reference for event handler */
+
+	XIicPs_Transfer *XferHead;	/* Transfer in progress */
+	XIicPs_Transfer *XferTail;	/* Last queued transfer */
+	u32 XferMsgIndex;		/* Segment in progress */
 } XIicPs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -390,6 +457,13 @@ void XIicPs_EnableSlaveMonitor(XIicPs *InstancePtr, u16 SlaveAddr);
 void XIicPs_DisableSlaveMonitor(XIicPs *InstancePtr);
 void XIicPs_MasterInterruptHandler(XIicPs *InstancePtr);
 
+/*
+ * Functions for queued master transfers, in xiicps_xfer.c
+ */
+s32 XIicPs_QueueTransfer(XIicPs *InstancePtr, XIicPs_Transfer *XferPtr);
+void XIicPs_CancelTransfers(XIicPs *InstancePtr);
+void XIicPs_XferInterruptHandler(XIicPs *InstancePtr);
+
 /*
  * Functions for device as slave, in xiicps_slave.c
  */
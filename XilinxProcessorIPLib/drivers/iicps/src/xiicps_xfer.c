@@ -0,0 +1,528 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xiicps_xfer.c
+* @addtogroup iicps_v3_5
+* @{
+*
+* Handles queued master mode transfers. A transfer is a list of write and
+* read segments issued as one bus transaction, the segments being joined by
+* repeated starts. Transfers are queued and run back to back from the
+* interrupt handler, so a polling loop over many sensor registers costs one
+* call and one callback per transfer rather than a blocking call per message.
+*
+* <pre> MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---  -------- ---------------------------------------------
+* 3.5   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xiicps.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Interrupts used while a write segment is in progress */
+#define XIICPS_XFER_SEND_INTR	((u32)XIICPS_IXR_NACK_MASK |		\
+				 (u32)XIICPS_IXR_COMP_MASK |		\
+				 (u32)XIICPS_IXR_ARB_LOST_MASK |	\
+				 (u32)XIICPS_IXR_TO_MASK |		\
+				 (u32)XIICPS_IXR_TX_OVR_MASK)
+
+/* Interrupts used while a read segment is in progress */
+#define XIICPS_XFER_RECV_INTR	((u32)XIICPS_IXR_NACK_MASK |		\
+				 (u32)XIICPS_IXR_DATA_MASK |		\
+				 (u32)XIICPS_IXR_COMP_MASK |		\
+				 (u32)XIICPS_IXR_ARB_LOST_MASK |	\
+				 (u32)XIICPS_IXR_TO_MASK |		\
+				 (u32)XIICPS_IXR_RX_OVR_MASK |		\
+				 (u32)XIICPS_IXR_RX_UNF_MASK)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+s32 TransmitFifoFill(XIicPs *InstancePtr);
+
+static void XferStartMsg(XIicPs *InstancePtr);
+static void XferNextMsg(XIicPs *InstancePtr);
+static void XferFinish(XIicPs *InstancePtr, s32 Status, u32 StatusEvent);
+static void XferClearHold(u32 BaseAddr);
+
+/************************* Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* This function queues a transfer. If no transfer is in progress it is
+* started immediately, otherwise it is started from the interrupt handler
+* when the transfers queued before it are finished.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	XferPtr is the transfer to queue. It must stay valid until its
+*		handler is called.
+*
+* @return
+*		- XST_SUCCESS if the transfer was queued.
+*		- XST_INVALID_PARAM if a segment is empty, a read segment is
+*		  not the last segment or is longer than
+*		  XIICPS_MAX_TRANSFER_SIZE.
+*		- XST_DEVICE_BUSY if the bus is busy and no queued transfer
+*		  owns it.
+*
+* @note		XIicPs_XferInterruptHandler() must be connected to the
+*		interrupt system before transfers are queued.
+*
+****************************************************************************/
+s32 XIicPs_QueueTransfer(XIicPs *InstancePtr, XIicPs_Transfer *XferPtr)
+{
+	u32 BaseAddr;
+	u32 IntrMaskReg;
+	u32 Index;
+	XIicPs_Msg *MsgPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(XferPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if ((XferPtr->Msgs == NULL) || (XferPtr->NumMsgs == 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < XferPtr->NumMsgs; Index++) {
+		MsgPtr = &XferPtr->Msgs[Index];
+		if ((MsgPtr->BufPtr == NULL) || (MsgPtr->ByteCount <= 0) ||
+			(MsgPtr->SlaveAddr > (u16)XIICPS_ADDR_MASK)) {
+			return (s32)XST_INVALID_PARAM;
+		}
+
+		/*
+		 * The controller does not signal completion of a receive with
+		 * HOLD set, so a read can only end the transaction.
+		 */
+		if (((MsgPtr->Flags & XIICPS_MSG_READ) != 0U) &&
+			((Index != (XferPtr->NumMsgs - 1U)) ||
+			(MsgPtr->ByteCount > (s32)XIICPS_MAX_TRANSFER_SIZE))) {
+			return (s32)XST_INVALID_PARAM;
+		}
+	}
+
+	XferPtr->Status = (s32)XST_DEVICE_BUSY;
+	XferPtr->StatusEvent = 0U;
+	XferPtr->MsgsDone = 0U;
+	XferPtr->Next = NULL;
+
+	BaseAddr = InstancePtr->Config.BaseAddress;
+
+	/*
+	 * Keep the interrupt handler off the queue while it is updated.
+	 */
+	IntrMaskReg = XIicPs_ReadReg(BaseAddr, XIICPS_IMR_OFFSET);
+	XIicPs_DisableAllInterrupts(BaseAddr);
+
+	if (InstancePtr->XferHead != NULL) {
+		InstancePtr->XferTail->Next = XferPtr;
+		InstancePtr->XferTail = XferPtr;
+
+		XIicPs_EnableInterrupts(BaseAddr,
+			(u32)XIICPS_IXR_ALL_INTR_MASK & (~IntrMaskReg));
+		return (s32)XST_SUCCESS;
+	}
+
+	if (((XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET) &
+			(u32)XIICPS_CR_HOLD_MASK) == 0U) &&
+		(XIicPs_BusIsBusy(InstancePtr) == (s32)1)) {
+		XIicPs_EnableInterrupts(BaseAddr,
+			(u32)XIICPS_IXR_ALL_INTR_MASK & (~IntrMaskReg));
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	InstancePtr->XferHead = XferPtr;
+	InstancePtr->XferTail = XferPtr;
+	InstancePtr->XferMsgIndex = 0U;
+
+	XferStartMsg(InstancePtr);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function stops the transfer in progress and removes all queued
+* transfers. The handler of each removed transfer is called with Status set
+* to XST_FAILURE.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void XIicPs_CancelTransfers(XIicPs *InstancePtr)
+{
+	u32 BaseAddr;
+	XIicPs_Transfer *XferPtr;
+	XIicPs_Transfer *NextPtr;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	BaseAddr = InstancePtr->Config.BaseAddress;
+
+	XIicPs_DisableAllInterrupts(BaseAddr);
+
+	XferPtr = InstancePtr->XferHead;
+	InstancePtr->XferHead = NULL;
+	InstancePtr->XferTail = NULL;
+	InstancePtr->XferMsgIndex = 0U;
+
+	if (XferPtr != NULL) {
+		XferClearHold(BaseAddr);
+	}
+
+	/*
+	 * The queue is detached first so that a handler may queue new
+	 * transfers.
+	 */
+	while (XferPtr != NULL) {
+		NextPtr = XferPtr->Next;
+		XferPtr->Status = (s32)XST_FAILURE;
+		if (XferPtr->Handler != NULL) {
+			XferPtr->Handler(XferPtr->CallBackRef, XferPtr);
+		}
+		XferPtr = NextPtr;
+	}
+}
+
+/*****************************************************************************/
+/**
+* The interrupt handler for queued transfers. It must be connected to the
+* interrupt system by the application in place of
+* XIicPs_MasterInterruptHandler() when XIicPs_QueueTransfer() is used.
+*
+* - Transfer complete on a write segment refills the FIFO, or moves to the
+*   next segment once all bytes are sent.
+* - Data and transfer complete on a read segment drain the FIFO, and the
+*   transfer finishes once all bytes are received.
+* - NACK, arbitration lost, time out and FIFO errors end the transfer with
+*   Status set to XST_FAILURE and StatusEvent set to the matching
+*   XIICPS_EVENT_* bits.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return	None.
+*
+* @note 	None.
+*
+****************************************************************************/
+void XIicPs_XferInterruptHandler(XIicPs *InstancePtr)
+{
+	u32 IntrStatusReg;
+	u32 StatusEvent = 0U;
+	u32 BaseAddr;
+	u32 IsLast;
+	s32 IsHold;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	BaseAddr = InstancePtr->Config.BaseAddress;
+
+	IntrStatusReg = XIicPs_ReadReg(BaseAddr, (u32)XIICPS_ISR_OFFSET);
+	XIicPs_WriteReg(BaseAddr, (u32)XIICPS_ISR_OFFSET, IntrStatusReg);
+	IntrStatusReg &= ~(XIicPs_ReadReg(BaseAddr, (u32)XIICPS_IMR_OFFSET));
+
+	if (InstancePtr->XferHead == NULL) {
+		return;
+	}
+
+	if (0U != (IntrStatusReg & XIICPS_IXR_NACK_MASK)) {
+		StatusEvent |= XIICPS_EVENT_NACK;
+	}
+	if (0U != (IntrStatusReg & XIICPS_IXR_ARB_LOST_MASK)) {
+		StatusEvent |= XIICPS_EVENT_ARB_LOST;
+	}
+	if (0U != (IntrStatusReg & XIICPS_IXR_TO_MASK)) {
+		StatusEvent |= XIICPS_EVENT_TIME_OUT;
+	}
+	if (0U != (IntrStatusReg & XIICPS_IXR_RX_OVR_MASK)) {
+		StatusEvent |= XIICPS_EVENT_RX_OVR | XIICPS_EVENT_ERROR;
+	}
+	if (0U != (IntrStatusReg & XIICPS_IXR_TX_OVR_MASK)) {
+		StatusEvent |= XIICPS_EVENT_TX_OVR | XIICPS_EVENT_ERROR;
+	}
+	if (0U != (IntrStatusReg & XIICPS_IXR_RX_UNF_MASK)) {
+		StatusEvent |= XIICPS_EVENT_RX_UNF | XIICPS_EVENT_ERROR;
+	}
+
+	if (StatusEvent != 0U) {
+		XferFinish(InstancePtr, (s32)XST_FAILURE, StatusEvent);
+		return;
+	}
+
+	IsLast = (u32)((InstancePtr->XferMsgIndex + 1U) ==
+			InstancePtr->XferHead->NumMsgs);
+
+	if (InstancePtr->IsSend != 0) {
+		if (0U != (IntrStatusReg & XIICPS_IXR_COMP_MASK)) {
+			if (InstancePtr->SendByteCount > 0) {
+				(void)TransmitFifoFill(InstancePtr);
+				if ((IsLast != 0U) &&
+					(InstancePtr->SendByteCount == 0)) {
+					XferClearHold(BaseAddr);
+				}
+			} else {
+				XferNextMsg(InstancePtr);
+			}
+		}
+		return;
+	}
+
+	if (0U != (IntrStatusReg & (XIICPS_IXR_DATA_MASK |
+			XIICPS_IXR_COMP_MASK))) {
+		IsHold = 0;
+		if ((XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET) &
+				(u32)XIICPS_CR_HOLD_MASK) != 0U) {
+			IsHold = 1;
+		}
+
+		while (((XIicPs_ReadReg(BaseAddr, (u32)XIICPS_SR_OFFSET) &
+				XIICPS_SR_RXDV_MASK) != 0U) &&
+			(InstancePtr->RecvByteCount > 0)) {
+			/*
+			 * Release the bus once the rest of the segment fits
+			 * in the FIFO so that the stop is generated.
+			 */
+			if ((IsHold != 0) && (InstancePtr->RecvByteCount <
+					XIICPS_DATA_INTR_DEPTH)) {
+				IsHold = 0;
+				XferClearHold(BaseAddr);
+			}
+			XIicPs_RecvByte(InstancePtr);
+		}
+	}
+
+	if ((0U != (IntrStatusReg & XIICPS_IXR_COMP_MASK)) &&
+		(InstancePtr->RecvByteCount == 0)) {
+		XferNextMsg(InstancePtr);
+	}
+}
+
+/*****************************************************************************/
+/*
+* This function starts the current segment of the transfer at the head of
+* the queue. HOLD is kept set between segments so that the next segment
+* starts with a repeated start.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XferStartMsg(XIicPs *InstancePtr)
+{
+	u32 BaseAddr = InstancePtr->Config.BaseAddress;
+	XIicPs_Transfer *XferPtr = InstancePtr->XferHead;
+	XIicPs_Msg *MsgPtr = &XferPtr->Msgs[InstancePtr->XferMsgIndex];
+	u32 IsLast;
+	u32 ControlReg;
+
+	IsLast = (u32)((InstancePtr->XferMsgIndex + 1U) == XferPtr->NumMsgs);
+
+	ControlReg = XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET);
+	if ((IsLast == 0U) || (MsgPtr->ByteCount > XIICPS_FIFO_DEPTH)) {
+		ControlReg |= (u32)XIICPS_CR_HOLD_MASK;
+	}
+
+	ControlReg |= (u32)XIICPS_CR_ACKEN_MASK | (u32)XIICPS_CR_CLR_FIFO_MASK |
+			(u32)XIICPS_CR_NEA_MASK | (u32)XIICPS_CR_MS_MASK;
+
+	if ((MsgPtr->Flags & XIICPS_MSG_READ) != 0U) {
+		ControlReg |= (u32)XIICPS_CR_RD_WR_MASK;
+	} else {
+		ControlReg &= (u32)(~XIICPS_CR_RD_WR_MASK);
+	}
+
+	XIicPs_WriteReg(BaseAddr, XIICPS_CR_OFFSET, ControlReg);
+	XIicPs_WriteReg(BaseAddr, XIICPS_ISR_OFFSET,
+			XIicPs_ReadReg(BaseAddr, XIICPS_ISR_OFFSET));
+
+	if ((MsgPtr->Flags & XIICPS_MSG_READ) != 0U) {
+		InstancePtr->IsSend = 0;
+		InstancePtr->SendBufferPtr = NULL;
+		InstancePtr->RecvBufferPtr = MsgPtr->BufPtr;
+		InstancePtr->RecvByteCount = MsgPtr->ByteCount;
+		InstancePtr->CurrByteCount = MsgPtr->ByteCount;
+		InstancePtr->UpdateTxSize = 0;
+
+		XIicPs_WriteReg(BaseAddr, XIICPS_TRANS_SIZE_OFFSET,
+				(u32)MsgPtr->ByteCount);
+
+		XIicPs_EnableInterrupts(BaseAddr, XIICPS_XFER_RECV_INTR);
+
+		XIicPs_WriteReg(BaseAddr, XIICPS_ADDR_OFFSET,
+				(u32)MsgPtr->SlaveAddr);
+
+		/*
+		 * A read is always the last segment. If it fits below the data
+		 * interrupt threshold release the bus now, otherwise the
+		 * interrupt handler does it once the rest fits in the FIFO.
+		 */
+		if (MsgPtr->ByteCount < XIICPS_DATA_INTR_DEPTH) {
+			XferClearHold(BaseAddr);
+		}
+	} else {
+		InstancePtr->IsSend = 1;
+		InstancePtr->RecvBufferPtr = NULL;
+		InstancePtr->SendBufferPtr = MsgPtr->BufPtr;
+		InstancePtr->SendByteCount = MsgPtr->ByteCount;
+
+		/*
+		 * Fill the FIFO before the address so that the slave sees the
+		 * data right after it is addressed.
+		 */
+		(void)TransmitFifoFill(InstancePtr);
+
+		XIicPs_EnableInterrupts(BaseAddr, XIICPS_XFER_SEND_INTR);
+
+		XIicPs_WriteReg(BaseAddr, XIICPS_ADDR_OFFSET,
+				(u32)MsgPtr->SlaveAddr);
+
+		if ((IsLast != 0U) && (InstancePtr->SendByteCount == 0)) {
+			XferClearHold(BaseAddr);
+		}
+	}
+}
+
+/*****************************************************************************/
+/*
+* This function moves the transfer at the head of the queue to its next
+* segment, or finishes it after the last segment.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XferNextMsg(XIicPs *InstancePtr)
+{
+	XIicPs_Transfer *XferPtr = InstancePtr->XferHead;
+
+	XferPtr->MsgsDone++;
+	InstancePtr->XferMsgIndex++;
+
+	if (InstancePtr->XferMsgIndex < XferPtr->NumMsgs) {
+		XferStartMsg(InstancePtr);
+	} else {
+		XferFinish(InstancePtr, (s32)XST_SUCCESS, 0U);
+	}
+}
+
+/*****************************************************************************/
+/*
+* This function completes the transfer at the head of the queue, starts the
+* next queued transfer if there is one and then calls the handler of the
+* completed transfer.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	Status is XST_SUCCESS or XST_FAILURE.
+* @param	StatusEvent is the set of XIICPS_EVENT_* bits for a failure.
+*
+* @return	None.
+*
+* @note		The next transfer is started before the handler is called so
+*		that a handler queueing a new transfer does not race with it.
+*
+****************************************************************************/
+static void XferFinish(XIicPs *InstancePtr, s32 Status, u32 StatusEvent)
+{
+	u32 BaseAddr = InstancePtr->Config.BaseAddress;
+	XIicPs_Transfer *XferPtr = InstancePtr->XferHead;
+
+	XIicPs_DisableAllInterrupts(BaseAddr);
+
+	if (Status != (s32)XST_SUCCESS) {
+		/* Release the bus and drop whatever is left in the FIFO */
+		XIicPs_WriteReg(BaseAddr, XIICPS_CR_OFFSET,
+				(XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET) &
+				(u32)(~XIICPS_CR_HOLD_MASK)) |
+				(u32)XIICPS_CR_CLR_FIFO_MASK);
+	}
+
+	XferPtr->Status = Status;
+	XferPtr->StatusEvent = StatusEvent;
+
+	InstancePtr->XferHead = XferPtr->Next;
+	if (InstancePtr->XferHead == NULL) {
+		InstancePtr->XferTail = NULL;
+	}
+	InstancePtr->XferMsgIndex = 0U;
+
+	if (InstancePtr->XferHead != NULL) {
+		XferStartMsg(InstancePtr);
+	}
+
+	if (XferPtr->Handler != NULL) {
+		XferPtr->Handler(XferPtr->CallBackRef, XferPtr);
+	}
+}
+
+/*****************************************************************************/
+/*
+* This function clears the HOLD bit so that the controller generates a stop
+* at the end of the current segment.
+*
+* @param	BaseAddr is the base address of the device.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XferClearHold(u32 BaseAddr)
+{
+	XIicPs_WriteReg(BaseAddr, XIICPS_CR_OFFSET,
+			XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET) &
+			(u32)(~XIICPS_CR_HOLD_MASK));
+}
+/** @} */
@@ -71,6 +71,8 @@
 * 3.0   bss  01/28/13 Modified to initialize IVAR register with
 *		      XPAR_MICROBLAZE_BASE_VECTORS + 0x10 to fix
 *		      CR#765931
+* 3.7   ag   10/14/26 XIntc_Connect dispatches the handler vectored when
+*		      fast interrupts are enabled.
 *
 * </pre>
 *
@@ -422,6 +424,15 @@ int XIntc_Connect(XIntc * InstancePtr, u8 Id,
 		InstancePtr->CfgPtr->HandlerTable[Id].Handler = Handler;
 		InstancePtr->CfgPtr->HandlerTable[Id].CallBackRef =
 								CallBackRef;
+
+		/*
+		 * With fast interrupts in the hardware, dispatch the handler
+		 * vectored. If no vector stub can be used the interrupt stays
+		 * on the normal dispatch path.
+		 */
+		if (InstancePtr->CfgPtr->FastIntr == TRUE) {
+			(void)XIntc_VectorInstall(InstancePtr, Id);
+		}
 	}
 
 	return XST_SUCCESS;
@@ -93,6 +93,23 @@
 * tables should not mislead the user into thinking they no longer need to
 * register/connect interrupt handlers with this driver.
 *
+* <b>Nested Priority Mode</b>
+*
+* When the controller has the Interrupt Level Register (C_HAS_ILR), the
+* driver lets higher priority interrupts preempt a running handler. Before
+* a handler of interrupt N runs, ILR is lowered to N so that only interrupts
+* 0 to N-1 can be taken. XIntc_SetPreemptLevel() limits nesting further:
+* only interrupts with an Id below the chosen level preempt, handlers at or
+* above it always run to completion, which keeps the stack depth and the
+* nesting overhead of low priority sources bounded.
+*
+* When fast interrupts are enabled in the hardware, handlers connected with
+* XIntc_Connect() are dispatched vectored: the IVAR of the interrupt is
+* pointed at a per-interrupt entry stub, so the processor jumps straight to
+* the handler without the ISR scan of XIntc_DeviceInterruptHandler(). The
+* stubs apply the same ILR based nesting. XIntc_SetNormalIntrMode() returns
+* an interrupt to the normal dispatch path.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -215,6 +232,11 @@
 *                     generation.
 * 3.7   ms   04/18/17 Modified tcl file to add suffix U for macro definitions
 *                     of intc in xparameters.h
+*       ag   10/14/26 Added nested priority mode: XIntc_SetPreemptLevel and
+*                     XIntc_GetPreemptLevel in xintc_nested.c and the
+*                     NoPreemptLevels field in XIntc_Config. Handlers
+*                     connected with XIntc_Connect on a controller with
+*                     fast interrupts enabled are dispatched vectored.
 * </pre>
 *
 ******************************************************************************/
@@ -308,6 +330,10 @@ typedef struct {
 #else
 	XIntc_VectorTableEntry HandlerTable[XPAR_INTC_MAX_NUM_INTR_INPUTS];
 #endif
+	u32 NoPreemptLevels;	/**< Number of lowest priority levels that
+				  *  cannot preempt a running handler,
+				  *  0 - any higher priority interrupt
+				  *  can preempt */
 
 } XIntc_Config;
 
@@ -364,6 +390,12 @@ void XIntc_InterruptHandler(XIntc * InstancePtr);
 int XIntc_SetOptions(XIntc * InstancePtr, u32 Options);
 u32 XIntc_GetOptions(XIntc * InstancePtr);
 
+/*
+ * Nested priority functions in xintc_nested.c
+ */
+void XIntc_SetPreemptLevel(XIntc * InstancePtr, u8 Level);
+u8 XIntc_GetPreemptLevel(XIntc * InstancePtr);
+
 /*
  * Self-test functions in xintc_selftest.c
  */
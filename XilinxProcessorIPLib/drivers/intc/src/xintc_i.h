@@ -50,6 +50,8 @@
 *                     pointer.
 * 1.10c mta  03/21/07 Updated to new coding style
 * 2.00a ktn  10/20/09 Updated to use HAL Processor APIs.
+* 3.7   ag   10/14/26 Added XIntc_NestLevel and XIntc_VectorInstall for the
+*                     nested priority mode.
 * </pre>
 *
 ******************************************************************************/
@@ -75,9 +77,20 @@ extern "C" {
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+/*
+ * Value to write to ILR while the handler of interrupt IntrNumber runs:
+ * the interrupt number itself, capped by the preemption level so that
+ * interrupts at or above the level never nest.
+ */
+#define XIntc_NestLevel(CfgPtr, IntrNumber)				\
+	(((u32)(IntrNumber) < (XIN_CONTROLLER_MAX_INTRS -		\
+			(CfgPtr)->NoPreemptLevels)) ? (u32)(IntrNumber) :	\
+	(XIN_CONTROLLER_MAX_INTRS - (CfgPtr)->NoPreemptLevels))
 
 /************************** Function Prototypes ******************************/
 
+int XIntc_VectorInstall(XIntc * InstancePtr, u8 Id);
+
 
 /************************** Variable Definitions *****************************/
 
@@ -72,6 +72,9 @@
 *                     Changed the prototypes of LookupConfigByBaseAddress,
 *                     XIntc_SetIntrSvcOption, XIntc_RegisterHandler,
 *                     XIntc_RegisterFastHandler APIs.
+* 3.7   ag   10/14/26 XIntc_DeviceInterruptHandler caps the ILR value with
+*                     the preemption level and leaves interrupts disabled
+*                     for handlers that cannot be preempted.
 *
 * </pre>
 *
@@ -176,7 +179,9 @@ void XIntc_LowLevelInterruptHandler(void)
 *		INTC on entry. On exit, it disables microblaze interrupts and
 *		restores ILR register default value(0xFFFFFFFF)back. It is
 *		recommended to increase STACK_SIZE in linker script for nested
-*		interrupts.
+*		interrupts. The value written to ILR is capped with the level
+*		set by XIntc_SetPreemptLevel(); handlers that nothing may
+*		preempt run with Microblaze interrupts disabled.
 *
 ******************************************************************************/
 void XIntc_DeviceInterruptHandler(void *DeviceId)
@@ -205,6 +210,7 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 		R14_register = mfgpr(r14);
 #endif
 		volatile u32 ILR_reg;
+		u32 NestLevel;
 		/* Save ILR register */
 		ILR_reg = Xil_In32(CfgPtr->BaseAddress + XIN_ILR_OFFSET);
 #endif
@@ -227,10 +233,12 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 				XIntc_VectorTableEntry *TablePtr;
 #if XPAR_XINTC_HAS_ILR == TRUE
 				/* Write to ILR the current interrupt
-				* number
+				* number, capped by the preemption level
 				*/
+				NestLevel = XIntc_NestLevel(CfgPtr,
+								IntrNumber);
 				Xil_Out32(CfgPtr->BaseAddress +
-						XIN_ILR_OFFSET, IntrNumber);
+						XIN_ILR_OFFSET, NestLevel);
 
 				/* Read back ILR to ensure the value
 				* has been updated and it is safe to
@@ -240,8 +248,12 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 				Xil_In32(CfgPtr->BaseAddress +
 						XIN_ILR_OFFSET);
 
-				/* Enable interrupts */
-				Xil_ExceptionEnable();
+				/* Enable interrupts if anything may
+				 * preempt this handler
+				 */
+				if (NestLevel != 0) {
+					Xil_ExceptionEnable();
+				}
 #endif
 				/* If the interrupt has been setup to
 				 * acknowledge it before servicing the
@@ -270,7 +282,9 @@ void XIntc_DeviceInterruptHandler(void *DeviceId)
 
 #if XPAR_XINTC_HAS_ILR == TRUE
 				/* Disable interrupts */
-				Xil_ExceptionDisable();
+				if (NestLevel != 0) {
+					Xil_ExceptionDisable();
+				}
 				/* Restore ILR */
 				Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET,
 								ILR_reg);
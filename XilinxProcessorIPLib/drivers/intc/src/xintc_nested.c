@@ -0,0 +1,312 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xintc_nested.c
+* @addtogroup intc_v3_7
+* @{
+*
+* Contains the nested priority mode functions of the XIntc driver. The
+* preemption level bounds which interrupts may preempt a running handler and
+* the vector stubs dispatch handlers connected with XIntc_Connect() directly
+* from the IVAR when fast interrupts are enabled in the hardware. See xintc.h
+* for a description of the nested priority mode.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------------
+* 3.7   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_exception.h"
+#include "xintc.h"
+#include "xintc_l.h"
+#include "xintc_i.h"
+
+/************************** Constant Definitions *****************************/
+
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#ifdef __MICROBLAZE__
+/*
+ * Defines the vector stub of one interrupt input. The stub is entered
+ * straight from the IVAR and hands over to the common dispatch routine.
+ */
+#define XINTC_VECTOR_STUB(Id)						\
+static void XIntc_VectorStub##Id(void) __attribute__ ((fast_interrupt)); \
+static void XIntc_VectorStub##Id(void)					\
+{									\
+	XIntc_VectorDispatch(Id);					\
+}
+#endif
+
+/************************** Function Prototypes ******************************/
+
+#ifdef __MICROBLAZE__
+static void XIntc_VectorDispatch(u8 Id);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __MICROBLAZE__
+/*
+ * Configuration the vector stubs dispatch to. The stubs are shared, so only
+ * one non-cascaded controller can use vectored dispatch at a time.
+ */
+static XIntc_Config *XIntc_VectorCfgPtr;
+
+XINTC_VECTOR_STUB(0)  XINTC_VECTOR_STUB(1)  XINTC_VECTOR_STUB(2)
+XINTC_VECTOR_STUB(3)  XINTC_VECTOR_STUB(4)  XINTC_VECTOR_STUB(5)
+XINTC_VECTOR_STUB(6)  XINTC_VECTOR_STUB(7)  XINTC_VECTOR_STUB(8)
+XINTC_VECTOR_STUB(9)  XINTC_VECTOR_STUB(10) XINTC_VECTOR_STUB(11)
+XINTC_VECTOR_STUB(12) XINTC_VECTOR_STUB(13) XINTC_VECTOR_STUB(14)
+XINTC_VECTOR_STUB(15) XINTC_VECTOR_STUB(16) XINTC_VECTOR_STUB(17)
+XINTC_VECTOR_STUB(18) XINTC_VECTOR_STUB(19) XINTC_VECTOR_STUB(20)
+XINTC_VECTOR_STUB(21) XINTC_VECTOR_STUB(22) XINTC_VECTOR_STUB(23)
+XINTC_VECTOR_STUB(24) XINTC_VECTOR_STUB(25) XINTC_VECTOR_STUB(26)
+XINTC_VECTOR_STUB(27) XINTC_VECTOR_STUB(28) XINTC_VECTOR_STUB(29)
+XINTC_VECTOR_STUB(30) XINTC_VECTOR_STUB(31)
+
+static XFastInterruptHandler XIntc_VectorStubTable[XIN_CONTROLLER_MAX_INTRS] =
+{
+	XIntc_VectorStub0,  XIntc_VectorStub1,  XIntc_VectorStub2,
+	XIntc_VectorStub3,  XIntc_VectorStub4,  XIntc_VectorStub5,
+	XIntc_VectorStub6,  XIntc_VectorStub7,  XIntc_VectorStub8,
+	XIntc_VectorStub9,  XIntc_VectorStub10, XIntc_VectorStub11,
+	XIntc_VectorStub12, XIntc_VectorStub13, XIntc_VectorStub14,
+	XIntc_VectorStub15, XIntc_VectorStub16, XIntc_VectorStub17,
+	XIntc_VectorStub18, XIntc_VectorStub19, XIntc_VectorStub20,
+	XIntc_VectorStub21, XIntc_VectorStub22, XIntc_VectorStub23,
+	XIntc_VectorStub24, XIntc_VectorStub25, XIntc_VectorStub26,
+	XIntc_VectorStub27, XIntc_VectorStub28, XIntc_VectorStub29,
+	XIntc_VectorStub30, XIntc_VectorStub31
+};
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Sets the preemption level of the nested priority mode. Only interrupts with
+* an Id below the level may preempt a running handler; handlers of interrupts
+* at or above the level run to completion with interrupts disabled. The level
+* only takes effect when the controller has the Interrupt Level Register.
+*
+* @param	InstancePtr is a pointer to the XIntc instance to be worked on.
+* @param	Level is the preemption level in the range 0 to
+*		XIN_CONTROLLER_MAX_INTRS. 0 disables nesting,
+*		XIN_CONTROLLER_MAX_INTRS (the default) lets any higher priority
+*		interrupt preempt.
+*
+* @return	None.
+*
+* @note		The level applies to the next dispatched handler, handlers
+*		already running keep the level they started with.
+*
+******************************************************************************/
+void XIntc_SetPreemptLevel(XIntc * InstancePtr, u8 Level)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Level <= XIN_CONTROLLER_MAX_INTRS);
+
+	InstancePtr->CfgPtr->NoPreemptLevels = XIN_CONTROLLER_MAX_INTRS - Level;
+}
+
+/*****************************************************************************/
+/**
+*
+* Gets the preemption level of the nested priority mode.
+*
+* @param	InstancePtr is a pointer to the XIntc instance to be worked on.
+*
+* @return	The preemption level set with XIntc_SetPreemptLevel().
+*
+* @note		None.
+*
+******************************************************************************/
+u8 XIntc_GetPreemptLevel(XIntc * InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	return (u8)(XIN_CONTROLLER_MAX_INTRS -
+				InstancePtr->CfgPtr->NoPreemptLevels);
+}
+
+/*****************************************************************************/
+/**
+*
+* Points the IVAR of an interrupt at its vector stub and switches the
+* interrupt to fast mode in the IMR, so that the handler in the handler table
+* is called without the ISR scan of XIntc_DeviceInterruptHandler().
+*
+* @param	InstancePtr is a pointer to the XIntc instance to be worked on.
+* @param	Id is the ID of the interrupt source.
+*
+* @return
+*		- XST_SUCCESS if the interrupt is dispatched vectored.
+*		- XST_FAILURE if the interrupt or the controller cannot use
+*		vectored dispatch, or the vector stubs are bound to another
+*		controller.
+*		- XST_NO_FEATURE if the processor has no fast interrupts.
+*
+* @note		Cascaded controllers keep the normal dispatch path. The
+*		acknowledge is done by the hardware in fast mode, so the
+*		XIN_SVC_SGL_ISR_OPTION and AckBeforeService settings do not
+*		apply to vectored interrupts.
+*
+******************************************************************************/
+int XIntc_VectorInstall(XIntc * InstancePtr, u8 Id)
+{
+#ifdef __MICROBLAZE__
+	XIntc_Config *CfgPtr = InstancePtr->CfgPtr;
+	u32 CurrentIER;
+	u32 Mask;
+	u32 Imr;
+
+	if ((Id >= XIN_CONTROLLER_MAX_INTRS) || (CfgPtr->FastIntr != TRUE) ||
+			(CfgPtr->IntcType != XIN_INTC_NOCASCADE)) {
+		return XST_FAILURE;
+	}
+
+	if ((XIntc_VectorCfgPtr != NULL) && (XIntc_VectorCfgPtr != CfgPtr)) {
+		return XST_FAILURE;
+	}
+	XIntc_VectorCfgPtr = CfgPtr;
+
+	/* Get the Enabled Interrupts */
+	CurrentIER = XIntc_In32(InstancePtr->BaseAddress + XIN_IER_OFFSET);
+
+	/* Convert from integer id to bit mask */
+	Mask = XIntc_BitPosMask[Id];
+
+	/* Disable the Interrupt if it was enabled before calling
+	 * this function
+	 */
+	if (CurrentIER & Mask) {
+		XIntc_Disable(InstancePtr, Id);
+	}
+
+	XIntc_Out32(InstancePtr->BaseAddress + XIN_IVAR_OFFSET + (Id * 4),
+				(u32) XIntc_VectorStubTable[Id]);
+
+	Imr = XIntc_In32(InstancePtr->BaseAddress + XIN_IMR_OFFSET);
+	XIntc_Out32(InstancePtr->BaseAddress + XIN_IMR_OFFSET, Imr | Mask);
+
+	/* Enable the Interrupt if it was enabled before calling this
+	 * function
+	 */
+	if (CurrentIER & Mask) {
+		XIntc_Enable(InstancePtr, Id);
+	}
+
+	return XST_SUCCESS;
+#else
+	(void)InstancePtr;
+	(void)Id;
+
+	return XST_NO_FEATURE;
+#endif
+}
+
+#ifdef __MICROBLAZE__
+/*****************************************************************************/
+/**
+*
+* Common part of the vector stubs. Lowers ILR to the nesting level of the
+* interrupt, calls its handler and restores ILR. Like
+* XIntc_DeviceInterruptHandler(), r14 is saved around the handler because it
+* holds the return address of the interrupted code while interrupts are
+* enabled again.
+*
+* @param	Id is the ID of the interrupt source.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XIntc_VectorDispatch(u8 Id)
+{
+	XIntc_Config *CfgPtr = XIntc_VectorCfgPtr;
+	XIntc_VectorTableEntry *TablePtr;
+#if XPAR_XINTC_HAS_ILR == TRUE
+	volatile u32 R14_register;
+	volatile u32 ILR_reg;
+	u32 NestLevel;
+
+	/* Save r14 register */
+	R14_register = mfgpr(r14);
+
+	/* Save ILR register */
+	ILR_reg = Xil_In32(CfgPtr->BaseAddress + XIN_ILR_OFFSET);
+
+	/* Write to ILR the interrupt number, capped by the preemption level,
+	 * and read it back before enabling interrupts
+	 */
+	NestLevel = XIntc_NestLevel(CfgPtr, Id);
+	Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET, NestLevel);
+	Xil_In32(CfgPtr->BaseAddress + XIN_ILR_OFFSET);
+
+	if (NestLevel != 0) {
+		Xil_ExceptionEnable();
+	}
+#endif
+
+	TablePtr = &(CfgPtr->HandlerTable[Id]);
+	TablePtr->Handler(TablePtr->CallBackRef);
+
+#if XPAR_XINTC_HAS_ILR == TRUE
+	if (NestLevel != 0) {
+		Xil_ExceptionDisable();
+	}
+
+	/* Restore ILR and r14 */
+	Xil_Out32(CfgPtr->BaseAddress + XIN_ILR_OFFSET, ILR_reg);
+	mtgpr(r14, R14_register);
+#endif
+}
+#endif
+/** @} */
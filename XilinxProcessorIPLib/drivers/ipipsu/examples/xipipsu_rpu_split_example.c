@@ -0,0 +1,325 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+* @file xipipsu_rpu_split_example.c
+*
+* This file contains an example that splits a control loop across both R5
+* cores in split mode. The same image runs on both cores: core 0 sends
+* samples to core 1 through a queue in OCM, core 1 runs the control law and
+* returns the results through a second queue. A message sent to an empty
+* queue raises an IPI on the consumer, which waits for it with WFI.
+*
+* The image has to be linked to the TCM and the boot image has to load the
+* ELF to both R5-0 and R5-1. The IPI channel of R5-1 is not in the
+* xparameters.h of an R5-0 BSP, the CORE1_IPI_* definitions below match the
+* default PS configuration.
+*
+* Example control flow:
+* - Both cores map the shared OCM non-cacheable and set up IPI and GIC
+* - Core 0 creates the queues, core 1 attaches to them
+* - Core 0 sends NUM_SAMPLES samples and checks every result
+* - Core 1 keeps serving samples
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver  Who Date     Changes
+* ---- --- -------- --------------------------------------------------
+* 2.3  ag  10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+/*****************************************************************************/
+/***************************** Include Files *********************************/
+
+#include "xparameters.h"
+#include "xil_exception.h"
+#include "xil_rpu.h"
+#include "xscugic.h"
+#include "xipipsu.h"
+#include "xil_printf.h"
+
+/************************* Test Configuration ********************************/
+/* IPI device ID of this BSP, the channel of R5-0 */
+#define IPI_DEVICE_ID		XPAR_XIPIPSU_0_DEVICE_ID
+/* Interrupt Controller device ID */
+#define INTC_DEVICE_ID		XPAR_SCUGIC_0_DEVICE_ID
+
+/* IPI channel of R5-1 in the default PS configuration */
+#define CORE1_IPI_BASEADDR	0xFF320000U
+#define CORE1_IPI_BITMASK	0x00000200U
+#define CORE1_IPI_BUFFER_INDEX	2U
+#define CORE1_IPI_INT_ID	66U
+
+/* Shared OCM holding both queues */
+#define SHARED_BASEADDR		0xFFFC0000U
+#define SHARED_SIZE		0x1000U
+#define QUEUE_DEPTH		16U
+
+#define NUM_SAMPLES		1000U
+
+/*****************************************************************************/
+
+typedef struct {
+	u32 Seq;
+	s32 Value;
+} Sample;
+
+/* Instances are per core, the image is loaded to the TCM of each core */
+XScuGic GicInst;
+XIpiPsu IpiInst;
+XIpiPsu_Config IpiCfg;
+XRpu_Queue SampleQueue;
+XRpu_Queue ResultQueue;
+u32 PeerMask;
+volatile u32 IpiPending;
+
+/**
+ * Control law run on core 1
+ */
+static s32 ControlLaw(s32 Value)
+{
+	return (Value * 2) + 1;
+}
+
+/**
+ * IPI handler : clears the IPI and wakes up the waiting consumer
+ */
+static void IpiIntrHandler(void *XIpiPsuPtr)
+{
+	XIpiPsu *InstancePtr = (XIpiPsu *) XIpiPsuPtr;
+	u32 IpiSrcMask;
+
+	IpiSrcMask = XIpiPsu_GetInterruptStatus(InstancePtr);
+	XIpiPsu_ClearInterruptStatus(InstancePtr, IpiSrcMask);
+	IpiPending = 1U;
+}
+
+/**
+ * Queue notify callback : raises an IPI on the other core
+ */
+static void NotifyPeer(void *CallBackRef)
+{
+	(void)XIpiPsu_TriggerIpi((XIpiPsu *) CallBackRef, PeerMask);
+}
+
+/**
+ * Receives a message, sleeping until the other core sends one
+ */
+static void QueueReceiveWait(XRpu_Queue *Queue, void *Msg)
+{
+	while (1) {
+		IpiPending = 0U;
+		if (Xil_RpuQueueReceive(Queue, Msg) == XST_SUCCESS) {
+			break;
+		}
+		/* WFI wakes up on a pending IRQ even when it is masked */
+		Xil_ExceptionDisable();
+		if (IpiPending == 0U) {
+			__asm("wfi");
+		}
+		Xil_ExceptionEnable();
+	}
+}
+
+/**
+ * Sets up the IPI channel of this core and connects it to the GIC
+ */
+static s32 SetupIpi(u32 CoreId)
+{
+	XIpiPsu_Config *CfgPtr;
+	XScuGic_Config *IntcConfig;
+	u32 PeerIntId;
+	s32 Status;
+
+	CfgPtr = XIpiPsu_LookupConfig(IPI_DEVICE_ID);
+	if (CfgPtr == NULL) {
+		return XST_FAILURE;
+	}
+	IpiCfg = *CfgPtr;
+	PeerMask = CORE1_IPI_BITMASK;
+	PeerIntId = CORE1_IPI_INT_ID;
+	if (CoreId == XRPU_CORE_1) {
+		PeerMask = CfgPtr->BitMask;
+		PeerIntId = CfgPtr->IntId;
+		IpiCfg.BaseAddress = CORE1_IPI_BASEADDR;
+		IpiCfg.BitMask = CORE1_IPI_BITMASK;
+		IpiCfg.BufferIndex = CORE1_IPI_BUFFER_INDEX;
+		IpiCfg.IntId = CORE1_IPI_INT_ID;
+	}
+	Status = XIpiPsu_CfgInitialize(&IpiInst, &IpiCfg, IpiCfg.BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* The second core only adds itself to the running distributor */
+	XScuGic_SetCpuID(CoreId);
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+	Status = XScuGic_CfgInitialize(&GicInst, IntcConfig,
+			IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+			(Xil_ExceptionHandler) XScuGic_InterruptHandler, &GicInst);
+
+	Status = XScuGic_Connect(&GicInst, IpiCfg.IntId,
+			(Xil_InterruptHandler) IpiIntrHandler, (void *) &IpiInst);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	/* Only take the IPI of this core */
+	XScuGic_InterruptMaptoCpu(&GicInst, (u8)CoreId, IpiCfg.IntId);
+	XScuGic_InterruptUnmapFromCpu(&GicInst, (u8)CoreId, PeerIntId);
+	XScuGic_Enable(&GicInst, IpiCfg.IntId);
+
+	XIpiPsu_ClearInterruptStatus(&IpiInst, XIPIPSU_ALL_MASK);
+	XIpiPsu_InterruptEnable(&IpiInst, PeerMask);
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
+
+/**
+ * Core 0 : producer of samples, consumer of results
+ */
+static void Core0Main(void *Data)
+{
+	Sample Msg;
+	u32 Sent = 0U;
+	u32 Received = 0U;
+	u32 Errors = 0U;
+	s32 Status = XST_FAILURE;
+
+	(void)Data;
+
+	if (Xil_RpuShareRegion(SHARED_BASEADDR, SHARED_SIZE) != XST_SUCCESS) {
+		goto END;
+	}
+	if ((Xil_RpuQueueCreate(&SampleQueue, SHARED_BASEADDR, QUEUE_DEPTH,
+			sizeof(Sample)) != XST_SUCCESS) ||
+		(Xil_RpuQueueCreate(&ResultQueue, SHARED_BASEADDR +
+			XRPU_QUEUE_SIZE(QUEUE_DEPTH, sizeof(Sample)),
+			QUEUE_DEPTH, sizeof(Sample)) != XST_SUCCESS)) {
+		goto END;
+	}
+	if (SetupIpi(XRPU_CORE_0) != XST_SUCCESS) {
+		goto END;
+	}
+	Xil_RpuQueueSetNotify(&SampleQueue, NotifyPeer, &IpiInst);
+
+	while (Received < NUM_SAMPLES) {
+		if (Sent < NUM_SAMPLES) {
+			Msg.Seq = Sent;
+			Msg.Value = (s32)Sent - (s32)(NUM_SAMPLES / 2U);
+			if (Xil_RpuQueueSend(&SampleQueue, &Msg) == XST_SUCCESS) {
+				Sent++;
+				continue;
+			}
+		}
+
+		/* the sample queue is full or all samples are sent */
+		QueueReceiveWait(&ResultQueue, &Msg);
+		if ((Msg.Seq != Received) || (Msg.Value != ControlLaw(
+				(s32)Received - (s32)(NUM_SAMPLES / 2U)))) {
+			Errors++;
+		}
+		Received++;
+	}
+
+	if (Errors == 0U) {
+		Status = XST_SUCCESS;
+	}
+
+END:
+	if (Status == XST_SUCCESS) {
+		xil_printf("Successfully ran Ipipsu RPU split Example\r\n");
+	} else {
+		xil_printf("Ipipsu RPU split Example Failed\r\n");
+	}
+}
+
+/**
+ * Core 1 : consumer of samples, producer of results
+ */
+static void Core1Main(void *Data)
+{
+	Sample Msg;
+
+	(void)Data;
+
+	if (Xil_RpuShareRegion(SHARED_BASEADDR, SHARED_SIZE) != XST_SUCCESS) {
+		return;
+	}
+	/* core 0 creates the queues */
+	while (Xil_RpuQueueAttach(&SampleQueue, SHARED_BASEADDR) !=
+			XST_SUCCESS) {
+	}
+	while (Xil_RpuQueueAttach(&ResultQueue, SHARED_BASEADDR +
+			XRPU_QUEUE_SIZE(QUEUE_DEPTH, sizeof(Sample))) !=
+			XST_SUCCESS) {
+	}
+	if (SetupIpi(XRPU_CORE_1) != XST_SUCCESS) {
+		return;
+	}
+	Xil_RpuQueueSetNotify(&ResultQueue, NotifyPeer, &IpiInst);
+
+	while (1) {
+		QueueReceiveWait(&SampleQueue, &Msg);
+		Msg.Value = ControlLaw(Msg.Value);
+		while (Xil_RpuQueueSend(&ResultQueue, &Msg) != XST_SUCCESS) {
+			/* core 0 drains the results */
+		}
+	}
+}
+
+int main()
+{
+	if (Xil_RpuIsSplitMode() == 0U) {
+		xil_printf("Ipipsu RPU split Example Failed: RPU in lockstep\r\n");
+		return XST_FAILURE;
+	}
+
+	Xil_RpuDispatch(Core0Main, Core1Main, NULL);
+
+	do {
+		__asm("wfi");
+	} while (1);
+
+	/* Control never reaches here */
+	return XST_SUCCESS;
+}
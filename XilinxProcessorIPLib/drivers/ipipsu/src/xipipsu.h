@@ -48,6 +48,8 @@
  * - Read the status of Observation Register to get status of Triggered IPI
  * - Enable/Disable IPIs from selected Masters
  * - Read the Status register to get the source of an incoming IPI
+ * - Send batches of larger messages through shared memory mailboxes, see
+ *   xipipsu_mbox.h
  *
  * <b>Initialization</b>
  * The config data for the driver is loaded and is based on the HW build. The
@@ -90,6 +92,7 @@
  *                    generation.
  * 2.3  ms  04/11/17  Modified tcl file to add suffix U for all macro
  *                    definitions of ipipsu in xparameters.h
+ *      ag  10/14/26  Added multi-channel shared memory mailboxes
  * </pre>
  *
  *****************************************************************************/
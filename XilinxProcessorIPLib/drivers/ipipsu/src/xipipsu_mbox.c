@@ -0,0 +1,445 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xipipsu_mbox.c
+* @addtogroup ipipsu_v2_3
+* @{
+*
+* This file contains the implementation of the shared memory mailbox
+* transport for XIpiPsu. Refer to the header file xipipsu_mbox.h for more
+* detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date	Changes
+* ----- ------ -------- ----------------------------------------------
+* 2.3	ag	10/14/26	First Release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xipipsu_mbox.h"
+
+/************************** Constant Definitions *****************************/
+/* Slot header word of a message */
+#define XIPIPSU_MBOX_HDR(Channel, Length) \
+	(((Channel) << XIPIPSU_MBOX_HDR_CHANNEL_SHIFT) | (Length))
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/*
+ * Orders accesses to the ring, so that the remote never sees a head or tail
+ * update before the slot contents it covers
+ */
+#if defined (__MICROBLAZE__)
+#define XIpiPsu_MboxBarrier()	mbar(1)
+#else
+#define XIpiPsu_MboxBarrier()	dmb()
+#endif
+
+/****************************************************************************/
+/**
+ * @brief	Get the address of a slot in a ring
+ *
+ * @param	RingAddr is the address of the ring
+ * @param	Index is the free running head or tail index
+ * @param	SlotCount is the number of slots in the ring
+ * @param	SlotWords is the size of a slot in words
+ *
+ * @return	Address of the slot header word
+ */
+static UINTPTR XIpiPsu_MboxSlotAddr(UINTPTR RingAddr, u32 Index,
+		u32 SlotCount, u32 SlotWords)
+{
+	return RingAddr + XIPIPSU_MBOX_DATA_OFFSET +
+		((UINTPTR)(Index & (SlotCount - 1U)) * SlotWords * 4U);
+}
+
+/****************************************************************************/
+/**
+ * @brief	Check if ring geometry is valid
+ *
+ * @param	SlotCount is the number of slots in the ring
+ * @param	SlotWords is the size of a slot in words
+ *
+ * @return	TRUE if slot count is a power of two and a slot holds at least
+ *		the header and one payload word, FALSE otherwise
+ */
+static u32 XIpiPsu_MboxIsValidRing(u32 SlotCount, u32 SlotWords)
+{
+	u32 IsValid = (u32)FALSE;
+
+	if ((SlotCount != 0U) && ((SlotCount & (SlotCount - 1U)) == 0U) &&
+			(SlotWords >= 2U) &&
+			(SlotWords <= (XIPIPSU_MBOX_HDR_LENGTH_MASK + 1U))) {
+		IsValid = (u32)TRUE;
+	}
+
+	return IsValid;
+}
+
+/****************************************************************************/
+/**
+ * Initialize a mailbox with a remote CPU. The transmit ring is reset here,
+ * the receive ring is owned and initialized by the remote CPU.
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ * @param	IpiPtr is a pointer to an initialized IPI instance
+ * @param	RemoteCpuMask is the IPI mask of the remote CPU
+ * @param	TxAddr is the shared memory address of the transmit ring
+ * @param	RxAddr is the shared memory address of the receive ring
+ * @param	SlotCount is the number of transmit slots, a power of two
+ * @param	SlotWords is the size of a transmit slot in words, including
+ *		the header word
+ *
+ * @return	XST_SUCCESS if the mailbox is initialized
+ *		XST_INVALID_PARAM if the ring geometry is invalid
+ *
+ * @note	XIpiPsu_MboxRingSize() gives the memory needed at TxAddr.
+ */
+XStatus XIpiPsu_MboxInitialize(XIpiPsu_Mbox *MboxPtr, XIpiPsu *IpiPtr,
+		u32 RemoteCpuMask, UINTPTR TxAddr, UINTPTR RxAddr,
+		u32 SlotCount, u32 SlotWords)
+{
+	u32 Index;
+	XStatus Status;
+
+	Xil_AssertNonvoid(MboxPtr != NULL);
+	Xil_AssertNonvoid(IpiPtr != NULL);
+	Xil_AssertNonvoid(IpiPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (XIpiPsu_MboxIsValidRing(SlotCount, SlotWords) == (u32)FALSE) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	MboxPtr->IpiPtr = IpiPtr;
+	MboxPtr->RemoteCpuMask = RemoteCpuMask;
+	MboxPtr->TxAddr = TxAddr;
+	MboxPtr->RxAddr = RxAddr;
+	MboxPtr->TxHead = 0U;
+	MboxPtr->TxDoneTail = 0U;
+	MboxPtr->TxDoneHandler = NULL;
+	MboxPtr->TxDoneRef = NULL;
+
+	for (Index = 0U; Index < XIPIPSU_MBOX_MAX_CHANNELS; Index++) {
+		MboxPtr->Channel[Index].Handler = NULL;
+		MboxPtr->Channel[Index].CallBackRef = NULL;
+	}
+
+	/* Reset the transmit ring */
+	Xil_Out32(TxAddr + XIPIPSU_MBOX_HEAD_OFFSET, 0U);
+	Xil_Out32(TxAddr + XIPIPSU_MBOX_TAIL_OFFSET, 0U);
+	Xil_Out32(TxAddr + XIPIPSU_MBOX_SLOTS_OFFSET, SlotCount);
+	Xil_Out32(TxAddr + XIPIPSU_MBOX_SLOT_WORDS_OFFSET, SlotWords);
+
+	MboxPtr->IsReady = XIL_COMPONENT_IS_READY;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Set the receive handler of a channel
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ * @param	Channel is the channel number
+ * @param	Handler is called for each message received on the channel, or
+ *		NULL to drop messages of the channel
+ * @param	CallBackRef is passed to the handler
+ *
+ * @return	XST_SUCCESS if the handler is set
+ *		XST_INVALID_PARAM if the channel number is invalid
+ */
+XStatus XIpiPsu_MboxSetHandler(XIpiPsu_Mbox *MboxPtr, u32 Channel,
+		XIpiPsu_MboxHandler Handler, void *CallBackRef)
+{
+	XStatus Status;
+
+	Xil_AssertNonvoid(MboxPtr != NULL);
+	Xil_AssertNonvoid(MboxPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (Channel >= XIPIPSU_MBOX_MAX_CHANNELS) {
+		Status = XST_INVALID_PARAM;
+	} else {
+		MboxPtr->Channel[Channel].Handler = Handler;
+		MboxPtr->Channel[Channel].CallBackRef = CallBackRef;
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Set the handler called when transmitted messages are consumed
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ * @param	Handler is called with the number of consumed messages
+ * @param	CallBackRef is passed to the handler
+ */
+void XIpiPsu_MboxSetTxDoneHandler(XIpiPsu_Mbox *MboxPtr,
+		XIpiPsu_MboxTxDoneHandler Handler, void *CallBackRef)
+{
+	Xil_AssertVoid(MboxPtr != NULL);
+	Xil_AssertVoid(MboxPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	MboxPtr->TxDoneHandler = Handler;
+	MboxPtr->TxDoneRef = CallBackRef;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Get the number of free transmit slots
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ *
+ * @return	Number of messages which can be queued without blocking
+ */
+u32 XIpiPsu_MboxGetTxFree(XIpiPsu_Mbox *MboxPtr)
+{
+	u32 SlotCount;
+	u32 Tail;
+
+	Xil_AssertNonvoid(MboxPtr != NULL);
+	Xil_AssertNonvoid(MboxPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	SlotCount = Xil_In32(MboxPtr->TxAddr + XIPIPSU_MBOX_SLOTS_OFFSET);
+	Tail = Xil_In32(MboxPtr->TxAddr + XIPIPSU_MBOX_TAIL_OFFSET);
+
+	return SlotCount - (MboxPtr->TxHead - Tail);
+}
+
+/****************************************************************************/
+/**
+ * Queue a message for the remote CPU. The message is copied into the ring
+ * and becomes visible to the remote with the next XIpiPsu_MboxFlush().
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ * @param	Channel is the channel number
+ * @param	MsgPtr is the pointer to the message
+ * @param	MsgLength is the length of the message in words
+ *
+ * @return	XST_SUCCESS if the message is queued
+ *		XST_DEVICE_BUSY if the ring is full
+ *		XST_INVALID_PARAM if the channel or length is invalid
+ */
+XStatus XIpiPsu_MboxSend(XIpiPsu_Mbox *MboxPtr, u32 Channel,
+		const u32 *MsgPtr, u32 MsgLength)
+{
+	UINTPTR SlotAddr;
+	u32 SlotCount;
+	u32 SlotWords;
+	u32 Index;
+	XStatus Status;
+
+	Xil_AssertNonvoid(MboxPtr != NULL);
+	Xil_AssertNonvoid(MboxPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((MsgPtr != NULL) || (MsgLength == 0U));
+
+	SlotCount = Xil_In32(MboxPtr->TxAddr + XIPIPSU_MBOX_SLOTS_OFFSET);
+	SlotWords = Xil_In32(MboxPtr->TxAddr + XIPIPSU_MBOX_SLOT_WORDS_OFFSET);
+
+	if ((Channel >= XIPIPSU_MBOX_MAX_CHANNELS) ||
+			(MsgLength >= SlotWords)) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	if (XIpiPsu_MboxGetTxFree(MboxPtr) == 0U) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	SlotAddr = XIpiPsu_MboxSlotAddr(MboxPtr->TxAddr, MboxPtr->TxHead,
+			SlotCount, SlotWords);
+	Xil_Out32(SlotAddr, XIPIPSU_MBOX_HDR(Channel, MsgLength));
+	for (Index = 0U; Index < MsgLength; Index++) {
+		Xil_Out32(SlotAddr + ((Index + 1U) * 4U), MsgPtr[Index]);
+	}
+	MboxPtr->TxHead++;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * Publish all queued messages and notify the remote CPU with one IPI.
+ * Nothing is triggered if no message was queued since the last flush.
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ *
+ * @return	XST_SUCCESS if successful
+ *		XST_FAILURE if the IPI could not be triggered
+ */
+XStatus XIpiPsu_MboxFlush(XIpiPsu_Mbox *MboxPtr)
+{
+	XStatus Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(MboxPtr != NULL);
+	Xil_AssertNonvoid(MboxPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (Xil_In32(MboxPtr->TxAddr + XIPIPSU_MBOX_HEAD_OFFSET) !=
+			MboxPtr->TxHead) {
+		XIpiPsu_MboxBarrier();
+		Xil_Out32(MboxPtr->TxAddr + XIPIPSU_MBOX_HEAD_OFFSET,
+				MboxPtr->TxHead);
+		XIpiPsu_MboxBarrier();
+		Status = XIpiPsu_TriggerIpi(MboxPtr->IpiPtr,
+				MboxPtr->RemoteCpuMask);
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Hand all published messages of the receive ring to the
+ *		channel handlers
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ *
+ * @return	Number of consumed messages
+ *
+ * @note	Messages with an invalid channel or length, or for a channel
+ *		without a handler, are consumed and dropped.
+ */
+static u32 XIpiPsu_MboxReceive(XIpiPsu_Mbox *MboxPtr)
+{
+	const XIpiPsu_MboxChannel *ChannelPtr;
+	UINTPTR SlotAddr;
+	u32 SlotCount;
+	u32 SlotWords;
+	u32 Head;
+	u32 Tail;
+	u32 Header;
+	u32 Channel;
+	u32 Length;
+	u32 Count = 0U;
+
+	SlotCount = Xil_In32(MboxPtr->RxAddr + XIPIPSU_MBOX_SLOTS_OFFSET);
+	SlotWords = Xil_In32(MboxPtr->RxAddr + XIPIPSU_MBOX_SLOT_WORDS_OFFSET);
+	if (XIpiPsu_MboxIsValidRing(SlotCount, SlotWords) == (u32)FALSE) {
+		/* Remote has not initialized its ring yet */
+		goto END;
+	}
+
+	Head = Xil_In32(MboxPtr->RxAddr + XIPIPSU_MBOX_HEAD_OFFSET);
+	Tail = Xil_In32(MboxPtr->RxAddr + XIPIPSU_MBOX_TAIL_OFFSET);
+	XIpiPsu_MboxBarrier();
+
+	while (Tail != Head) {
+		SlotAddr = XIpiPsu_MboxSlotAddr(MboxPtr->RxAddr, Tail,
+				SlotCount, SlotWords);
+		Header = Xil_In32(SlotAddr);
+		Channel = Header >> XIPIPSU_MBOX_HDR_CHANNEL_SHIFT;
+		Length = Header & XIPIPSU_MBOX_HDR_LENGTH_MASK;
+
+		if ((Channel < XIPIPSU_MBOX_MAX_CHANNELS) &&
+				(Length < SlotWords)) {
+			ChannelPtr = &MboxPtr->Channel[Channel];
+			if (ChannelPtr->Handler != NULL) {
+				ChannelPtr->Handler(ChannelPtr->CallBackRef,
+						(const u32 *)(SlotAddr + 4U),
+						Length);
+			}
+		}
+		Tail++;
+		Count++;
+	}
+
+	if (Count != 0U) {
+		/* Slots are free for the remote once tail is updated */
+		XIpiPsu_MboxBarrier();
+		Xil_Out32(MboxPtr->RxAddr + XIPIPSU_MBOX_TAIL_OFFSET, Tail);
+	}
+
+END:
+	return Count;
+}
+
+/****************************************************************************/
+/**
+ * Handle an IPI from the remote CPU of the mailbox. This function should be
+ * called from the IPI interrupt handler when the status bit of the remote
+ * CPU is set.
+ *
+ * The IPI is acked first, so a doorbell rung by the remote while messages
+ * are being handled raises a new interrupt. Received messages are handed to
+ * the channel handlers and consumed transmit messages are reported to the
+ * transmit completion handler. If any message was received or queued
+ * locally, one IPI is triggered to the remote, which acks the received
+ * batch and publishes the queued one.
+ *
+ * @param	MboxPtr is a pointer to the mailbox instance to be worked on
+ */
+void XIpiPsu_MboxIntrHandler(XIpiPsu_Mbox *MboxPtr)
+{
+	u32 Received;
+	u32 Tail;
+	u32 Count;
+
+	Xil_AssertVoid(MboxPtr != NULL);
+	Xil_AssertVoid(MboxPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	XIpiPsu_ClearInterruptStatus(MboxPtr->IpiPtr, MboxPtr->RemoteCpuMask);
+
+	Received = XIpiPsu_MboxReceive(MboxPtr);
+
+	/* Report messages consumed by the remote */
+	Tail = Xil_In32(MboxPtr->TxAddr + XIPIPSU_MBOX_TAIL_OFFSET);
+	Count = Tail - MboxPtr->TxDoneTail;
+	if (Count != 0U) {
+		MboxPtr->TxDoneTail = Tail;
+		if (MboxPtr->TxDoneHandler != NULL) {
+			MboxPtr->TxDoneHandler(MboxPtr->TxDoneRef, Count);
+		}
+	}
+
+	if (Xil_In32(MboxPtr->TxAddr + XIPIPSU_MBOX_HEAD_OFFSET) !=
+			MboxPtr->TxHead) {
+		(void)XIpiPsu_MboxFlush(MboxPtr);
+	} else if (Received != 0U) {
+		(void)XIpiPsu_TriggerIpi(MboxPtr->IpiPtr,
+				MboxPtr->RemoteCpuMask);
+	} else {
+		/* Nothing to notify the remote about */
+	}
+}
+/** @} */
@@ -0,0 +1,185 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+* @file xipipsu_mbox.h
+* @addtogroup ipipsu_v2_3
+* @{
+* @details
+*
+* Multi-channel message transport over IPI using shared memory mailboxes.
+* The 32 byte IPI buffers limit each message to one buffer and each message
+* to a trigger and an ack poll. A mailbox instead keeps a ring of fixed size
+* message slots in memory shared by two CPUs, so many messages can be queued
+* and the remote is notified of a whole batch with a single IPI.
+*
+* Each side of a CPU pair owns one ring for transmitting and reads the ring
+* of the remote for receiving. A ring starts with four words (head, tail,
+* slot count and slot size) followed by the slots. Head is only written by
+* the sender and tail only by the receiver. Every slot starts with a header
+* word holding the channel number and the payload length in words, so one
+* mailbox multiplexes up to XIPIPSU_MBOX_MAX_CHANNELS message streams.
+*
+* <b>Sending messages</b>
+* - Queue messages using XIpiPsu_MboxSend(), this never blocks and returns
+*   XST_DEVICE_BUSY if the ring is full
+* - Publish the queued batch and trigger one IPI using XIpiPsu_MboxFlush()
+* - Completions are reported to the handler set by
+*   XIpiPsu_MboxSetTxDoneHandler() once the remote has consumed the messages
+*
+* <b>Receiving messages</b>
+* - Register a handler per channel using XIpiPsu_MboxSetHandler()
+* - Enable the IPI from the remote CPU using XIpiPsu_InterruptEnable()
+* - Call XIpiPsu_MboxIntrHandler() from the IPI interrupt handler when the
+*   status bit of the remote CPU is set
+*
+* The interrupt handler acks the IPI, hands received messages to the channel
+* handlers, reports transmit completions and then, with a single IPI, tells
+* the remote that its messages were consumed and publishes any messages
+* queued locally. The remote therefore gets transmit completions from an
+* interrupt instead of polling with XIpiPsu_PollForAck().
+*
+* @note	The ring memory has to be mapped as non-cacheable on both CPUs.
+* Message pointers passed to the channel handlers point into the shared ring
+* and are only valid until the handler returns.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 2.3   ag  10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIPIPSU_MBOX_H_
+#define XIPIPSU_MBOX_H_
+
+/***************************** Include Files *********************************/
+#include "xipipsu.h"
+
+/************************** Constant Definitions *****************************/
+/* Number of channels multiplexed over one mailbox */
+#define XIPIPSU_MBOX_MAX_CHANNELS	8U
+
+/* Offsets of the ring header words in shared memory */
+#define XIPIPSU_MBOX_HEAD_OFFSET	0x00U
+#define XIPIPSU_MBOX_TAIL_OFFSET	0x04U
+#define XIPIPSU_MBOX_SLOTS_OFFSET	0x08U
+#define XIPIPSU_MBOX_SLOT_WORDS_OFFSET	0x0CU
+#define XIPIPSU_MBOX_DATA_OFFSET	0x10U
+
+/* Slot header word fields */
+#define XIPIPSU_MBOX_HDR_CHANNEL_SHIFT	16U
+#define XIPIPSU_MBOX_HDR_LENGTH_MASK	0x0000FFFFU
+
+/**************************** Type Definitions *******************************/
+/**
+ * Handler called for every message received on a channel. MsgLength is in
+ * words.
+ */
+typedef void (*XIpiPsu_MboxHandler)(void *CallBackRef, const u32 *MsgPtr,
+		u32 MsgLength);
+
+/**
+ * Handler called when the remote has consumed Count transmitted messages.
+ */
+typedef void (*XIpiPsu_MboxTxDoneHandler)(void *CallBackRef, u32 Count);
+
+/**
+ * Receive handler of a mailbox channel
+ */
+typedef struct {
+	XIpiPsu_MboxHandler Handler; /**< Called for received messages */
+	void *CallBackRef; /**< Argument passed to the handler */
+} XIpiPsu_MboxChannel;
+
+/**
+ * The XIpiPsu_Mbox instance data, one for each remote CPU a mailbox is used
+ * with.
+ */
+typedef struct {
+	XIpiPsu *IpiPtr; /**< IPI instance used for the doorbells */
+	u32 RemoteCpuMask; /**< IPI mask of the remote CPU */
+	UINTPTR TxAddr; /**< Ring written locally and read by the remote */
+	UINTPTR RxAddr; /**< Ring written by the remote and read locally */
+	u32 TxHead; /**< Head including messages not yet published */
+	u32 TxDoneTail; /**< Tail value completions were reported up to */
+	XIpiPsu_MboxTxDoneHandler TxDoneHandler; /**< Transmit completion */
+	void *TxDoneRef; /**< Argument passed to TxDoneHandler */
+	XIpiPsu_MboxChannel Channel[XIPIPSU_MBOX_MAX_CHANNELS]; /**< Channels */
+	u32 IsReady; /**< Mailbox is initialized and ready */
+} XIpiPsu_Mbox;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/****************************************************************************/
+/**
+*
+* Get the number of bytes of shared memory needed by one ring
+*
+* @param	SlotCount is the number of slots in the ring (power of two)
+* @param	SlotWords is the size of a slot in words, header word included
+*
+* @return	Size of the ring in bytes
+* @note
+* C-style signature
+*	u32 XIpiPsu_MboxRingSize(u32 SlotCount, u32 SlotWords)
+*
+*****************************************************************************/
+#define XIpiPsu_MboxRingSize(SlotCount, SlotWords) \
+	(XIPIPSU_MBOX_DATA_OFFSET + ((SlotCount) * (SlotWords) * 4U))
+
+/************************** Function Prototypes *****************************/
+
+/* Interface Functions implemented in xipipsu_mbox.c */
+
+XStatus XIpiPsu_MboxInitialize(XIpiPsu_Mbox *MboxPtr, XIpiPsu *IpiPtr,
+		u32 RemoteCpuMask, UINTPTR TxAddr, UINTPTR RxAddr,
+		u32 SlotCount, u32 SlotWords);
+
+XStatus XIpiPsu_MboxSetHandler(XIpiPsu_Mbox *MboxPtr, u32 Channel,
+		XIpiPsu_MboxHandler Handler, void *CallBackRef);
+
+void XIpiPsu_MboxSetTxDoneHandler(XIpiPsu_Mbox *MboxPtr,
+		XIpiPsu_MboxTxDoneHandler Handler, void *CallBackRef);
+
+XStatus XIpiPsu_MboxSend(XIpiPsu_Mbox *MboxPtr, u32 Channel,
+		const u32 *MsgPtr, u32 MsgLength);
+
+XStatus XIpiPsu_MboxFlush(XIpiPsu_Mbox *MboxPtr);
+
+u32 XIpiPsu_MboxGetTxFree(XIpiPsu_Mbox *MboxPtr);
+
+void XIpiPsu_MboxIntrHandler(XIpiPsu_Mbox *MboxPtr);
+
+#endif /* XIPIPSU_MBOX_H_ */
+/** @} */
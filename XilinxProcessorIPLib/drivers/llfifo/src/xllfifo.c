@@ -57,6 +57,12 @@
  * 5.1   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
  *                     Changed the prototypes of XLlFifo_CfgInitialize,
  *                     XLlFifo_Initialize APIs.
+ *       ag   10/14/26 Hoisted the data port address out of the word loops
+ *                     in XLlFifo_iRead_Aligned/XLlFifo_iWrite_Aligned and
+ *                     used incrementing addresses in the AXI4 data window
+ *                     so that the transfers can be issued as bursts.
+ *                     Added XLlFifo_TxPutPackets and XLlFifo_RxGetPackets
+ *                     to move several frames per vacancy/occupancy check.
  * </pre>
  ******************************************************************************/
 
@@ -70,6 +76,20 @@
 /************************** Constant Definitions *****************************/
 #define FIFO_WIDTH_BYTES 4
 
+#define XLLF_AXI4_DATA_WINDOW_MASK	(XLLF_AXI4_DATA_WINDOW_SIZE - 1)
+#define XLLF_WORDS_PER_BURST		4U
+
+/************************** Function Prototypes ******************************/
+
+static void XLlFifo_Axi4Read(UINTPTR DataAddr, u32 *BufPtr,
+				unsigned WordCount);
+static void XLlFifo_LiteRead(UINTPTR DataAddr, u32 *BufPtr,
+				unsigned WordCount);
+static void XLlFifo_Axi4Write(UINTPTR DataAddr, const u32 *BufPtr,
+				unsigned WordCount);
+static void XLlFifo_LiteWrite(UINTPTR DataAddr, const u32 *BufPtr,
+				unsigned WordCount);
+
 /*
  * Implementation Notes:
  *
@@ -97,8 +117,17 @@
  * The streamer driver will eventually make calls back into the routines (which
  * reside in this driver) given at initialization to peform the actual I/O.
  *
+ * Data path
+ * XLlFifo_iRead_Aligned and XLlFifo_iWrite_Aligned resolve the data port once
+ * per call. With the AXI4-lite data interface every word goes through the
+ * fixed TDFD/RDFD register. With the AXI4 (full) data interface every address
+ * in the 4 KB data window maps to the data FIFO, so the words are accessed at
+ * incrementing addresses which lets the processor and the interconnect issue
+ * INCR bursts instead of single beats.
+ *
  * Interrupts
- * Interrupts are handled in the OS/Application layer above this driver.
+ * Interrupts are handled in the OS/Application layer above this driver, or
+ * by the optional streaming layer in xllfifo_stream.c.
  ******************************************************************************/
 
 xdbg_stmnt(u32 _xllfifo_rr_value;)
@@ -187,17 +216,16 @@ int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	Xil_AssertNonvoid(InstancePtr);
 	Xil_AssertNonvoid(BufPtr);
 	/* assert bufer is 32 bit aligned */
-	Xil_AssertNonvoid(((unsigned)BufPtr & 0x3) == 0x0);
+	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: after asserts\n");
 
-	while (WordsRemaining) {
-/*		xdbg_printf(XDBG_DEBUG_FIFO_RX,
-			    "XLlFifo_iRead_Aligned: WordsRemaining: %d\n",
-			    WordsRemaining);
-*/
-		*BufPtrIdx = XLlFifo_RxGetWord(InstancePtr);
-		BufPtrIdx++;
-		WordsRemaining--;
+	if (InstancePtr->Datainterface) {
+		XLlFifo_Axi4Read((UINTPTR)InstancePtr->Axi4BaseAddress +
+				XLLF_AXI4_RDFD_OFFSET, BufPtrIdx,
+				WordsRemaining);
+	} else {
+		XLlFifo_LiteRead((UINTPTR)InstancePtr->Axi4BaseAddress +
+				XLLF_RDFD_OFFSET, BufPtrIdx, WordsRemaining);
 	}
 	xdbg_printf(XDBG_DEBUG_FIFO_RX,
 		    "XLlFifo_iRead_Aligned: returning SUCCESS\n");
@@ -295,15 +323,18 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	Xil_AssertNonvoid(InstancePtr);
 	Xil_AssertNonvoid(BufPtr);
 	/* assert bufer is 32 bit aligned */
-	Xil_AssertNonvoid(((unsigned)BufPtr & 0x3) == 0x0);
+	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
 
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: WordsRemaining: %d\n",
 		    WordsRemaining);
-	while (WordsRemaining) {
-		XLlFifo_TxPutWord(InstancePtr, *BufPtrIdx);
-		BufPtrIdx++;
-		WordsRemaining--;
+	if (InstancePtr->Datainterface) {
+		XLlFifo_Axi4Write((UINTPTR)InstancePtr->Axi4BaseAddress +
+				XLLF_AXI4_TDFD_OFFSET, BufPtrIdx,
+				WordsRemaining);
+	} else {
+		XLlFifo_LiteWrite((UINTPTR)InstancePtr->Axi4BaseAddress +
+				XLLF_TDFD_OFFSET, BufPtrIdx, WordsRemaining);
 	}
 
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
@@ -494,4 +525,282 @@ void XLlFifo_Initialize(XLlFifo *InstancePtr, UINTPTR BaseAddress)
 			(XStrm_SetLenFnType)XLlFifo_iTxSetLen,
 			(XStrm_GetVacancyFnType)XLlFifo_iTxVacancy);
 }
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_TxPutPackets writes as many of the <i>NumPkts</i> frames described
+* by <i>PktArray</i> as fit in the transmit channel of the FIFO specified by
+* <i>InstancePtr</i>, and starts the transmission of each of them.
+*
+* The transmit vacancy is read once for the whole batch, instead of once per
+* frame, and the frames are written with XLlFifo_iWrite_Aligned(). Frames are
+* written in order, the first frame that does not fit ends the batch.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @param    PktArray is the array of frames to be sent. Each BufPtr must be
+*           32 bit aligned and readable up to the next whole 32 bit word.
+*
+* @param    NumPkts is the number of entries in <i>PktArray</i>.
+*
+* @return   The number of frames handed to the FIFO, from 0 to
+*           <i>NumPkts</i>.
+*
+* @note     This routine bypasses the byte streamer. It must not be called
+*           while a frame written with XLlFifo_Write() is still waiting for
+*           its XLlFifo_TxSetLen().
+*
+******************************************************************************/
+u32 XLlFifo_TxPutPackets(XLlFifo *InstancePtr, XLlFifo_Packet *PktArray,
+			u32 NumPkts)
+{
+	u32 Vacancy;
+	u32 Words;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(PktArray);
+
+	Vacancy = XLlFifo_iTxVacancy(InstancePtr);
+
+	for (Index = 0; Index < NumPkts; Index++) {
+		Words = (PktArray[Index].Length + FIFO_WIDTH_BYTES - 1) /
+			FIFO_WIDTH_BYTES;
+		if (Words > Vacancy)
+			break;
+
+		XLlFifo_iWrite_Aligned(InstancePtr, PktArray[Index].BufPtr,
+				Words);
+		XLlFifo_iTxSetLen(InstancePtr, PktArray[Index].Length);
+		Vacancy -= Words;
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_RxGetPackets reads up to <i>NumPkts</i> complete frames from the
+* receive channel of the FIFO specified by <i>InstancePtr</i> into the buffers
+* described by <i>PktArray</i>.
+*
+* The receive occupancy is only read again once the words reported by the
+* previous read have been consumed, so a burst of small frames is drained
+* with a single occupancy check.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @param    PktArray is the array of receive buffers. On entry Length holds
+*           the size of each buffer in bytes, which must be a multiple of 4.
+*           On return Length holds the length of the frame received in it.
+*           Each BufPtr must be 32 bit aligned.
+*
+* @param    NumPkts is the number of entries in <i>PktArray</i>.
+*
+* @return   The number of frames received, from 0 to <i>NumPkts</i>.
+*
+* @note     A frame that is longer than its buffer is truncated to the
+*           buffer size, the remaining words are read and dropped. This
+*           routine bypasses the byte streamer and must not be mixed with
+*           a partially read XLlFifo_Read() frame.
+*
+******************************************************************************/
+u32 XLlFifo_RxGetPackets(XLlFifo *InstancePtr, XLlFifo_Packet *PktArray,
+			u32 NumPkts)
+{
+	u32 Occupancy = 0;
+	u32 FrameLen;
+	u32 Words;
+	u32 BufWords;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(PktArray);
+
+	for (Index = 0; Index < NumPkts; Index++) {
+		if (Occupancy == 0) {
+			Occupancy = XLlFifo_iRxOccupancy(InstancePtr);
+			if (Occupancy == 0)
+				break;
+		}
+
+		FrameLen = XLlFifo_iRxGetLen(InstancePtr);
+		Words = (FrameLen + FIFO_WIDTH_BYTES - 1) / FIFO_WIDTH_BYTES;
+		BufWords = PktArray[Index].Length / FIFO_WIDTH_BYTES;
+
+		if (Words <= BufWords) {
+			XLlFifo_iRead_Aligned(InstancePtr,
+					PktArray[Index].BufPtr, Words);
+			PktArray[Index].Length = FrameLen;
+		} else {
+			XLlFifo_iRead_Aligned(InstancePtr,
+					PktArray[Index].BufPtr, BufWords);
+			XLlFifo_iRxDiscard(InstancePtr, Words - BufWords);
+			PktArray[Index].Length = BufWords * FIFO_WIDTH_BYTES;
+		}
+
+		Occupancy = (Words < Occupancy) ? (Occupancy - Words) : 0;
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_iRxDiscard reads and drops <i>WordCount</i> words from the receive
+* channel of the FIFO specified by <i>InstancePtr</i>.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @param    WordCount specifies the number of 32 bit words to drop.
+*
+* @return   N/A
+*
+******************************************************************************/
+void XLlFifo_iRxDiscard(XLlFifo *InstancePtr, unsigned WordCount)
+{
+	Xil_AssertVoid(InstancePtr);
+
+	while (WordCount) {
+		(void)XLlFifo_RxGetWord(InstancePtr);
+		WordCount--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_Axi4Read reads <i>WordCount</i> words from the AXI4 receive data
+* window starting at <i>DataAddr</i>. The offset into the window is
+* incremented for every word and wraps at the end of the window.
+*
+* @param    DataAddr is the address of the receive data window.
+* @param    BufPtr is the 32 bit aligned destination buffer.
+* @param    WordCount specifies the number of 32 bit words to read.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_Axi4Read(UINTPTR DataAddr, u32 *BufPtr,
+				unsigned WordCount)
+{
+	u32 Offset = 0;
+
+	while (WordCount >= XLLF_WORDS_PER_BURST) {
+		BufPtr[0] = XLlFifo_ReadReg(DataAddr, Offset);
+		BufPtr[1] = XLlFifo_ReadReg(DataAddr, Offset + 4);
+		BufPtr[2] = XLlFifo_ReadReg(DataAddr, Offset + 8);
+		BufPtr[3] = XLlFifo_ReadReg(DataAddr, Offset + 12);
+		Offset = (Offset + 16) & XLLF_AXI4_DATA_WINDOW_MASK;
+		BufPtr += XLLF_WORDS_PER_BURST;
+		WordCount -= XLLF_WORDS_PER_BURST;
+	}
+
+	while (WordCount) {
+		*BufPtr++ = XLlFifo_ReadReg(DataAddr, Offset);
+		Offset += 4;
+		WordCount--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_LiteRead reads <i>WordCount</i> words from the AXI4-lite receive
+* data register at <i>DataAddr</i>.
+*
+* @param    DataAddr is the address of the RDFD register.
+* @param    BufPtr is the 32 bit aligned destination buffer.
+* @param    WordCount specifies the number of 32 bit words to read.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_LiteRead(UINTPTR DataAddr, u32 *BufPtr,
+				unsigned WordCount)
+{
+	while (WordCount >= XLLF_WORDS_PER_BURST) {
+		BufPtr[0] = XLlFifo_ReadReg(DataAddr, 0);
+		BufPtr[1] = XLlFifo_ReadReg(DataAddr, 0);
+		BufPtr[2] = XLlFifo_ReadReg(DataAddr, 0);
+		BufPtr[3] = XLlFifo_ReadReg(DataAddr, 0);
+		BufPtr += XLLF_WORDS_PER_BURST;
+		WordCount -= XLLF_WORDS_PER_BURST;
+	}
+
+	while (WordCount) {
+		*BufPtr++ = XLlFifo_ReadReg(DataAddr, 0);
+		WordCount--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_Axi4Write writes <i>WordCount</i> words to the AXI4 transmit data
+* window starting at <i>DataAddr</i>. The offset into the window is
+* incremented for every word and wraps at the end of the window.
+*
+* @param    DataAddr is the address of the transmit data window.
+* @param    BufPtr is the 32 bit aligned source buffer.
+* @param    WordCount specifies the number of 32 bit words to write.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_Axi4Write(UINTPTR DataAddr, const u32 *BufPtr,
+				unsigned WordCount)
+{
+	u32 Offset = 0;
+
+	while (WordCount >= XLLF_WORDS_PER_BURST) {
+		XLlFifo_WriteReg(DataAddr, Offset, BufPtr[0]);
+		XLlFifo_WriteReg(DataAddr, Offset + 4, BufPtr[1]);
+		XLlFifo_WriteReg(DataAddr, Offset + 8, BufPtr[2]);
+		XLlFifo_WriteReg(DataAddr, Offset + 12, BufPtr[3]);
+		Offset = (Offset + 16) & XLLF_AXI4_DATA_WINDOW_MASK;
+		BufPtr += XLLF_WORDS_PER_BURST;
+		WordCount -= XLLF_WORDS_PER_BURST;
+	}
+
+	while (WordCount) {
+		XLlFifo_WriteReg(DataAddr, Offset, *BufPtr++);
+		Offset += 4;
+		WordCount--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_LiteWrite writes <i>WordCount</i> words to the AXI4-lite transmit
+* data register at <i>DataAddr</i>.
+*
+* @param    DataAddr is the address of the TDFD register.
+* @param    BufPtr is the 32 bit aligned source buffer.
+* @param    WordCount specifies the number of 32 bit words to write.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_LiteWrite(UINTPTR DataAddr, const u32 *BufPtr,
+				unsigned WordCount)
+{
+	while (WordCount >= XLLF_WORDS_PER_BURST) {
+		XLlFifo_WriteReg(DataAddr, 0, BufPtr[0]);
+		XLlFifo_WriteReg(DataAddr, 0, BufPtr[1]);
+		XLlFifo_WriteReg(DataAddr, 0, BufPtr[2]);
+		XLlFifo_WriteReg(DataAddr, 0, BufPtr[3]);
+		BufPtr += XLLF_WORDS_PER_BURST;
+		WordCount -= XLLF_WORDS_PER_BURST;
+	}
+
+	while (WordCount) {
+		XLlFifo_WriteReg(DataAddr, 0, *BufPtr++);
+		WordCount--;
+	}
+}
 /** @} */
@@ -123,11 +123,30 @@
  * twice in a row. Each frame must be written by writting the data for one
  * frame and then calling iTxSetLen().
  *
+ * <h3>Batched transfers</h3>
+ * XLlFifo_TxPutPackets() writes an array of word aligned frames with a single
+ * vacancy check, setting the transmit length after each frame.
+ * XLlFifo_RxGetPackets() drains complete frames into an array of word aligned
+ * buffers with a single occupancy check per batch. When the core is built
+ * with the AXI4 (full) data interface the data words are moved with
+ * incrementing addresses in the AXI4 data window so they can be issued as
+ * bursts.
+ *
  * <h2>Interrupts</h2>
- * This driver does not handle interrupts from the FIFO hardware. The
+ * The core driver does not handle interrupts from the FIFO hardware. The
  * software layer above may make use of the interrupts by setting up its
  * own handlers for the interrupts.
  *
+ * Alternatively the streaming layer (xllfifo_stream.c) can be used. The
+ * application provides two rings of XLlFifo_Packet entries with
+ * XLlFifo_StreamInitialize(), installs callbacks with
+ * XLlFifo_SetStreamHandler() and connects XLlFifo_StreamIntrHandler() to the
+ * FIFO interrupt. XLlFifo_StreamSend() queues a frame for transmission and
+ * XLlFifo_StreamPostRecv() queues an empty receive buffer. The send callback
+ * is invoked once a frame has been written into the FIFO, that is when its
+ * buffer may be reused, and the receive callback once a frame has been
+ * copied into a posted buffer.
+ *
  * <pre>
  * MODIFICATION HISTORY:
  *
@@ -187,6 +206,10 @@
  * 5.2 adk    03/07/17 CR#978769 Fix doxygen issues in the driver.
  *		       Updated comments in the usage section as per example code.
  *		       Fix doxygen warnings in the driver.
+ *      ag    10/14/26 Added burst data path for the AXI4 data interface,
+ *		       XLlFifo_TxPutPackets/XLlFifo_RxGetPackets batched
+ *		       transfers and the interrupt driven streaming layer
+ *		       with software packet queues (xllfifo_stream.c).
  * </pre>
  *
  *****************************************************************************/
@@ -204,8 +227,52 @@ extern "C" {
 #include "xstreamer.h"
 #include "xllfifo_hw.h"
 
+/************************** Constant Definitions *****************************/
+
+/** @name Handler types
+ * These constants are used as parameters to XLlFifo_SetStreamHandler()
+ * @{
+ */
+#define XLLF_HANDLER_SEND	1U /**< Frame written into the FIFO */
+#define XLLF_HANDLER_RECV	2U /**< Frame received into a posted buffer */
+#define XLLF_HANDLER_ERROR	3U /**< Error interrupt */
+/*@}*/
+
 /**************************** Type Definitions *******************************/
 
+/**
+ * This typedef describes one frame for the batched and streaming APIs.
+ */
+typedef struct XLlFifo_Packet {
+	void *BufPtr;		/**< 32 bit aligned frame buffer */
+	u32 Length;		/**< Frame length in bytes, or buffer size for
+				 *	receive buffers that are not filled yet
+				 */
+} XLlFifo_Packet;
+
+/**
+ * Callback invoked by the streaming layer for a completed send or receive.
+ * <i>PktPtr</i> is only valid for the duration of the callback.
+ */
+typedef void (*XLlFifo_StreamHandler)(void *CallBackRef,
+					XLlFifo_Packet *PktPtr);
+
+/**
+ * Callback invoked by the streaming layer for error interrupts.
+ * <i>ErrorMask</i> is a set of <code>XLLF_INT_*_MASK</code> values.
+ */
+typedef void (*XLlFifo_ErrorHandler)(void *CallBackRef, u32 ErrorMask);
+
+/**
+ * Software ring of frames used by the streaming layer.
+ */
+typedef struct XLlFifo_PktQueue {
+	XLlFifo_Packet *Ring;	/**< Application provided storage */
+	u32 Size;		/**< Number of entries in Ring */
+	u32 Head;		/**< Next entry to be serviced */
+	u32 Count;		/**< Number of entries in use */
+} XLlFifo_PktQueue;
+
 /**
  * This typedef defines a run-time instance of an XLlFifo device.
  */
@@ -231,6 +298,21 @@ typedef struct XLlFifo {
 	XStrm_TxFifoStreamer TxStreamer; /**< TxStreamer is the byte streamer
 	                                  *   instance for the transmit channel.
 	                                  */
+	XLlFifo_PktQueue TxQueue;	/**< Frames waiting for FIFO space */
+	XLlFifo_PktQueue RxQueue;	/**< Posted receive buffers */
+	u32 TxMaxWords;			/**< Largest frame, in words, the
+					 *	transmit FIFO can hold
+					 */
+	u32 StreamBusy;			/**< Streaming ring service in
+					 *	progress, guards against
+					 *	callbacks re-entering it
+					 */
+	XLlFifo_StreamHandler SendHandler;	/**< Streaming send callback */
+	void *SendRef;				/**< Send callback reference */
+	XLlFifo_StreamHandler RecvHandler;	/**< Streaming recv callback */
+	void *RecvRef;				/**< Recv callback reference */
+	XLlFifo_ErrorHandler ErrorHandler;	/**< Streaming error callback */
+	void *ErrorRef;				/**< Error callback reference */
 } XLlFifo;
 
 typedef struct XLlFifo_Config {
@@ -726,6 +808,33 @@ u32 XLlFifo_iTxVacancy(XLlFifo *InstancePtr);
 void XLlFifo_iTxSetLen(XLlFifo *InstancePtr, u32 Bytes);
 u32 XLlFifo_RxGetWord(XLlFifo *InstancePtr);
 void XLlFifo_TxPutWord(XLlFifo *InstancePtr, u32 Word);
+int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
+			unsigned WordCount);
+int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
+			unsigned WordCount);
+void XLlFifo_iRxDiscard(XLlFifo *InstancePtr, unsigned WordCount);
+
+/*
+ * Batched transfer functions xllfifo.c
+ */
+u32 XLlFifo_TxPutPackets(XLlFifo *InstancePtr, XLlFifo_Packet *PktArray,
+			u32 NumPkts);
+u32 XLlFifo_RxGetPackets(XLlFifo *InstancePtr, XLlFifo_Packet *PktArray,
+			u32 NumPkts);
+
+/*
+ * Interrupt driven streaming functions xllfifo_stream.c
+ */
+int XLlFifo_StreamInitialize(XLlFifo *InstancePtr, XLlFifo_Packet *TxRing,
+			u32 TxRingSize, XLlFifo_Packet *RxRing,
+			u32 RxRingSize);
+int XLlFifo_SetStreamHandler(XLlFifo *InstancePtr, u32 HandlerType,
+			void *FuncPtr, void *CallBackRef);
+void XLlFifo_StreamStart(XLlFifo *InstancePtr);
+void XLlFifo_StreamStop(XLlFifo *InstancePtr);
+int XLlFifo_StreamSend(XLlFifo *InstancePtr, void *BufPtr, u32 Bytes);
+int XLlFifo_StreamPostRecv(XLlFifo *InstancePtr, void *BufPtr, u32 Size);
+void XLlFifo_StreamIntrHandler(void *CallBackRef);
 
 #ifdef __cplusplus
 }
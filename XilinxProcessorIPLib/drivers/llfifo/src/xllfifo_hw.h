@@ -53,6 +53,8 @@
 *		       XLLF_INT_TFPE_MASK, XLLF_INT_RFPF_MASK and
 *		       XLLF_INT_RFPE_MASK for the new version of the
 *		       AXI4-Stream FIFO core (v2.01a and later)
+*       ag   10/14/26 Added XLLF_AXI4_DATA_WINDOW_SIZE for AXI4 data
+*		       interface burst transfers.
 * </pre>
 *
 ******************************************************************************/
@@ -97,6 +99,12 @@ extern "C" {
 #define XLLF_TDR_OFFSET  0x0000002C  /**< Transmit Destination  */
 #define XLLF_RDR_OFFSET  0x00000030  /**< Receive Destination  */
 
+#define XLLF_AXI4_DATA_WINDOW_SIZE 0x00001000 /**< Size of each Axi4 data
+						* window, any address in
+						* the window accesses the
+						* data FIFO
+						*/
+
 /*@}*/
 
 /* Register masks. The following constants define bit locations of various
@@ -0,0 +1,461 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xllfifo_stream.c
+* @addtogroup llfifo_v5_2
+* @{
+*
+* This file implements the interrupt driven streaming layer of the Axi
+* Streaming FIFO driver. Frames to be sent and empty receive buffers are kept
+* in application provided software rings, and the FIFO interrupts move them
+* in and out of the hardware FIFO in batches.
+*
+* The transmit ring is refilled into the FIFO from XLlFifo_StreamSend() and
+* from the transmit complete interrupt. The receive ring is drained from the
+* receive complete interrupt and from XLlFifo_StreamPostRecv(), so frames that
+* arrived while no buffer was posted are not lost.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.2   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xstatus.h"
+#include "xllfifo.h"
+#include "xil_assert.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XLLF_STREAM_INT_MASK	(XLLF_INT_TC_MASK | XLLF_INT_RC_MASK | \
+				 XLLF_INT_ERROR_MASK)
+
+#define XLLF_STREAM_TX_BUSY	0x1U
+#define XLLF_STREAM_RX_BUSY	0x2U
+
+/************************** Function Prototypes ******************************/
+
+static void XLlFifo_iStreamTx(XLlFifo *InstancePtr);
+static void XLlFifo_iStreamRx(XLlFifo *InstancePtr);
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_StreamInitialize sets up the software rings used by the streaming
+* layer for the FIFO specified by <i>InstancePtr</i>. The FIFO must have been
+* initialized with XLlFifo_CfgInitialize() and its transmit channel must be
+* empty, as the current vacancy is taken as the largest frame that can be
+* queued.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    TxRing is the storage for frames waiting to be sent. It may be
+*           NULL if <i>TxRingSize</i> is zero.
+* @param    TxRingSize is the number of entries in <i>TxRing</i>.
+* @param    RxRing is the storage for posted receive buffers. It may be
+*           NULL if <i>RxRingSize</i> is zero.
+* @param    RxRingSize is the number of entries in <i>RxRing</i>.
+*
+* @return
+*           - XST_SUCCESS if the rings were set up.
+*           - XST_INVALID_PARAM if a ring size is given without storage.
+*
+******************************************************************************/
+int XLlFifo_StreamInitialize(XLlFifo *InstancePtr, XLlFifo_Packet *TxRing,
+			u32 TxRingSize, XLlFifo_Packet *RxRing,
+			u32 RxRingSize)
+{
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (((TxRing == NULL) && (TxRingSize != 0)) ||
+	    ((RxRing == NULL) && (RxRingSize != 0))) {
+		return XST_INVALID_PARAM;
+	}
+
+	InstancePtr->TxQueue.Ring = TxRing;
+	InstancePtr->TxQueue.Size = TxRingSize;
+	InstancePtr->TxQueue.Head = 0;
+	InstancePtr->TxQueue.Count = 0;
+
+	InstancePtr->RxQueue.Ring = RxRing;
+	InstancePtr->RxQueue.Size = RxRingSize;
+	InstancePtr->RxQueue.Head = 0;
+	InstancePtr->RxQueue.Count = 0;
+
+	InstancePtr->TxMaxWords = XLlFifo_iTxVacancy(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_SetStreamHandler installs a callback for the streaming layer.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    HandlerType is one of the <code>XLLF_HANDLER_*</code> values.
+* @param    FuncPtr is an XLlFifo_StreamHandler for XLLF_HANDLER_SEND and
+*           XLLF_HANDLER_RECV, and an XLlFifo_ErrorHandler for
+*           XLLF_HANDLER_ERROR. NULL removes the callback.
+* @param    CallBackRef is passed back to the callback.
+*
+* @return
+*           - XST_SUCCESS if the callback was installed.
+*           - XST_INVALID_PARAM if <i>HandlerType</i> is not recognized.
+*
+******************************************************************************/
+int XLlFifo_SetStreamHandler(XLlFifo *InstancePtr, u32 HandlerType,
+			void *FuncPtr, void *CallBackRef)
+{
+	Xil_AssertNonvoid(InstancePtr);
+
+	switch (HandlerType) {
+	case XLLF_HANDLER_SEND:
+		InstancePtr->SendHandler = (XLlFifo_StreamHandler)FuncPtr;
+		InstancePtr->SendRef = CallBackRef;
+		break;
+	case XLLF_HANDLER_RECV:
+		InstancePtr->RecvHandler = (XLlFifo_StreamHandler)FuncPtr;
+		InstancePtr->RecvRef = CallBackRef;
+		break;
+	case XLLF_HANDLER_ERROR:
+		InstancePtr->ErrorHandler = (XLlFifo_ErrorHandler)FuncPtr;
+		InstancePtr->ErrorRef = CallBackRef;
+		break;
+	default:
+		return XST_INVALID_PARAM;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_StreamStart clears any stale status and enables the transmit
+* complete, receive complete and error interrupts used by the streaming
+* layer.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   N/A
+*
+******************************************************************************/
+void XLlFifo_StreamStart(XLlFifo *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr);
+
+	XLlFifo_IntClear(InstancePtr, XLLF_INT_ALL_MASK);
+	XLlFifo_IntEnable(InstancePtr, XLLF_STREAM_INT_MASK);
+
+	/* Frames may have arrived before the interrupts were enabled */
+	XLlFifo_iStreamRx(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_StreamStop disables the interrupts used by the streaming layer.
+* Queued frames and posted buffers stay in the rings.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   N/A
+*
+******************************************************************************/
+void XLlFifo_StreamStop(XLlFifo *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr);
+
+	XLlFifo_IntDisable(InstancePtr, XLLF_STREAM_INT_MASK);
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_StreamSend queues a frame for transmission and writes as many
+* queued frames as fit into the FIFO. The send callback is invoked for each
+* frame once it has been written into the FIFO, after which its buffer may be
+* reused.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    BufPtr is the 32 bit aligned frame, readable up to the next
+*           whole 32 bit word.
+* @param    Bytes is the frame length in bytes.
+*
+* @return
+*           - XST_SUCCESS if the frame was queued.
+*           - XST_INVALID_PARAM if the frame is empty or larger than the FIFO.
+*           - XST_DEVICE_BUSY if the transmit ring is full.
+*
+******************************************************************************/
+int XLlFifo_StreamSend(XLlFifo *InstancePtr, void *BufPtr, u32 Bytes)
+{
+	XLlFifo_PktQueue *QueuePtr;
+	u32 Ier;
+	int Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(BufPtr);
+
+	if ((Bytes == 0) || (((Bytes + 3) / 4) > InstancePtr->TxMaxWords)) {
+		return XST_INVALID_PARAM;
+	}
+
+	QueuePtr = &InstancePtr->TxQueue;
+
+	/* Keep the interrupt handler off the rings while they are updated */
+	Ier = XLlFifo_ReadReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET);
+	XLlFifo_WriteReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET, 0);
+
+	if (QueuePtr->Count == QueuePtr->Size) {
+		Status = XST_DEVICE_BUSY;
+	} else {
+		XLlFifo_Packet *PktPtr = &QueuePtr->Ring[(QueuePtr->Head +
+					QueuePtr->Count) % QueuePtr->Size];
+
+		PktPtr->BufPtr = BufPtr;
+		PktPtr->Length = Bytes;
+		QueuePtr->Count++;
+	}
+
+	XLlFifo_iStreamTx(InstancePtr);
+
+	XLlFifo_WriteReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET, Ier);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_StreamPostRecv queues an empty receive buffer and drains any frames
+* already waiting in the FIFO.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    BufPtr is the 32 bit aligned receive buffer.
+* @param    Size is the buffer size in bytes, a multiple of 4. Longer frames
+*           are truncated to this size.
+*
+* @return
+*           - XST_SUCCESS if the buffer was queued.
+*           - XST_INVALID_PARAM if <i>Size</i> is smaller than one word.
+*           - XST_DEVICE_BUSY if the receive ring is full.
+*
+******************************************************************************/
+int XLlFifo_StreamPostRecv(XLlFifo *InstancePtr, void *BufPtr, u32 Size)
+{
+	XLlFifo_PktQueue *QueuePtr;
+	u32 Ier;
+	int Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(BufPtr);
+
+	if (Size < 4) {
+		return XST_INVALID_PARAM;
+	}
+
+	QueuePtr = &InstancePtr->RxQueue;
+
+	Ier = XLlFifo_ReadReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET);
+	XLlFifo_WriteReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET, 0);
+
+	if (QueuePtr->Count == QueuePtr->Size) {
+		Status = XST_DEVICE_BUSY;
+	} else {
+		XLlFifo_Packet *PktPtr = &QueuePtr->Ring[(QueuePtr->Head +
+					QueuePtr->Count) % QueuePtr->Size];
+
+		PktPtr->BufPtr = BufPtr;
+		PktPtr->Length = Size & ~3U;
+		QueuePtr->Count++;
+	}
+
+	XLlFifo_iStreamRx(InstancePtr);
+
+	XLlFifo_WriteReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET, Ier);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_StreamIntrHandler is the interrupt handler of the streaming layer.
+* It should be connected to the FIFO interrupt with <i>CallBackRef</i> set to
+* the XLlFifo instance.
+*
+* @param    CallBackRef is the XLlFifo instance that raised the interrupt.
+*
+* @return   N/A
+*
+******************************************************************************/
+void XLlFifo_StreamIntrHandler(void *CallBackRef)
+{
+	XLlFifo *InstancePtr = (XLlFifo *)CallBackRef;
+	u32 Pending;
+
+	Xil_AssertVoid(InstancePtr);
+
+	Pending = XLlFifo_IntPending(InstancePtr);
+	XLlFifo_IntClear(InstancePtr, Pending);
+
+	if ((Pending & XLLF_INT_ERROR_MASK) &&
+	    (InstancePtr->ErrorHandler != NULL)) {
+		InstancePtr->ErrorHandler(InstancePtr->ErrorRef,
+				Pending & XLLF_INT_ERROR_MASK);
+	}
+
+	if (Pending & XLLF_INT_RC_MASK) {
+		XLlFifo_iStreamRx(InstancePtr);
+	}
+
+	if (Pending & XLLF_INT_TC_MASK) {
+		XLlFifo_iStreamTx(InstancePtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_iStreamTx writes queued frames into the FIFO, one batch per
+* contiguous run of the transmit ring, and reports each written frame to the
+* send callback.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_iStreamTx(XLlFifo *InstancePtr)
+{
+	XLlFifo_PktQueue *QueuePtr = &InstancePtr->TxQueue;
+	XLlFifo_Packet Pkt;
+	u32 Run;
+	u32 Done;
+
+	/*
+	 * A callback that queues more work lands here again, the loop below
+	 * picks the new entries up once the current batch is retired.
+	 */
+	if (InstancePtr->StreamBusy & XLLF_STREAM_TX_BUSY)
+		return;
+	InstancePtr->StreamBusy |= XLLF_STREAM_TX_BUSY;
+
+	while (QueuePtr->Count) {
+		Run = QueuePtr->Size - QueuePtr->Head;
+		if (Run > QueuePtr->Count)
+			Run = QueuePtr->Count;
+
+		Done = XLlFifo_TxPutPackets(InstancePtr,
+				&QueuePtr->Ring[QueuePtr->Head], Run);
+
+		while (Done--) {
+			Pkt = QueuePtr->Ring[QueuePtr->Head];
+			QueuePtr->Head = (QueuePtr->Head + 1) % QueuePtr->Size;
+			QueuePtr->Count--;
+			if (InstancePtr->SendHandler != NULL)
+				InstancePtr->SendHandler(InstancePtr->SendRef,
+						&Pkt);
+			Run--;
+		}
+
+		/* The FIFO is full, the next TC interrupt resumes here */
+		if (Run)
+			break;
+	}
+
+	InstancePtr->StreamBusy &= ~XLLF_STREAM_TX_BUSY;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_iStreamRx drains received frames into the posted buffers, one batch
+* per contiguous run of the receive ring, and reports each filled buffer to
+* the receive callback.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_iStreamRx(XLlFifo *InstancePtr)
+{
+	XLlFifo_PktQueue *QueuePtr = &InstancePtr->RxQueue;
+	XLlFifo_Packet Pkt;
+	u32 Run;
+	u32 Done;
+
+	/*
+	 * A callback that queues more work lands here again, the loop below
+	 * picks the new entries up once the current batch is retired.
+	 */
+	if (InstancePtr->StreamBusy & XLLF_STREAM_RX_BUSY)
+		return;
+	InstancePtr->StreamBusy |= XLLF_STREAM_RX_BUSY;
+
+	while (QueuePtr->Count) {
+		Run = QueuePtr->Size - QueuePtr->Head;
+		if (Run > QueuePtr->Count)
+			Run = QueuePtr->Count;
+
+		Done = XLlFifo_RxGetPackets(InstancePtr,
+				&QueuePtr->Ring[QueuePtr->Head], Run);
+
+		while (Done--) {
+			Pkt = QueuePtr->Ring[QueuePtr->Head];
+			QueuePtr->Head = (QueuePtr->Head + 1) % QueuePtr->Size;
+			QueuePtr->Count--;
+			if (InstancePtr->RecvHandler != NULL)
+				InstancePtr->RecvHandler(InstancePtr->RecvRef,
+						&Pkt);
+			Run--;
+		}
+
+		/* The FIFO is empty, the next RC interrupt resumes here */
+		if (Run)
+			break;
+	}
+
+	InstancePtr->StreamBusy &= ~XLLF_STREAM_RX_BUSY;
+}
+/** @} */
@@ -43,6 +43,7 @@
 # 4.2   ms   04/18/17 Modified tcl file to add suffix U for all macros
 #                     definitions of mbox in xparameters.h
 # 4.3   sd   07/26/17 Modified tcl file to prevent false unconnected flagging.
+#       ag   10/14/26 Added MAILBOX_DEPTH to the configuration.
 #
 ##############################################################################
 #uses "xillib.tcl"
@@ -62,6 +63,7 @@ proc xdefine_mbox_config_if {periph hfile_handle cfile_handle bus_if if_num dev_
 	set mbox_use_fsl	0
 	set mbox_send_fsl	0
 	set mbox_recv_fsl	0
+	set mbox_depth		[common::get_property CONFIG.C_MAILBOX_DEPTH $periph]
 	set if_isaxi		0
 	set use_fsl 		0
 	set uSuffix "U"
@@ -106,6 +108,7 @@ proc xdefine_mbox_config_if {periph hfile_handle cfile_handle bus_if if_num dev_
 	    puts $hfile_handle [format "#define XPAR_%s_IF_%d_USE_FSL %d$uSuffix" $periph_name $if_num $mbox_use_fsl]
 	    puts $hfile_handle [format "#define XPAR_%s_IF_%d_SEND_FSL %d$uSuffix" $periph_name $if_num $mbox_send_fsl]
 	    puts $hfile_handle [format "#define XPAR_%s_IF_%d_RECV_FSL %d$uSuffix" $periph_name $if_num $mbox_recv_fsl]
+	    puts $hfile_handle [format "#define XPAR_%s_IF_%d_MAILBOX_DEPTH %d$uSuffix" $periph_name $if_num $mbox_depth]
 
 	    if {!$has_if0_device_id} {
 		puts $hfile_handle ""
@@ -118,7 +121,8 @@ proc xdefine_mbox_config_if {periph hfile_handle cfile_handle bus_if if_num dev_
 	    puts $cfile_handle [format "\t\t XPAR_%s_IF_%d_BASEADDR, " $periph_name $if_num]
 	    puts $cfile_handle [format "\t\t XPAR_%s_IF_%d_USE_FSL," $periph_name $if_num]
 	    puts $cfile_handle [format "\t\t XPAR_%s_IF_%d_SEND_FSL," $periph_name $if_num]
-	    puts $cfile_handle [format "\t\t XPAR_%s_IF_%d_RECV_FSL" $periph_name $if_num]
+	    puts $cfile_handle [format "\t\t XPAR_%s_IF_%d_RECV_FSL," $periph_name $if_num]
+	    puts $cfile_handle [format "\t\t XPAR_%s_IF_%d_MAILBOX_DEPTH" $periph_name $if_num]
 	    puts -nonewline $cfile_handle "\t\}"
 	    puts $cfile_handle ","
 	    set has_if0_device_id 1
@@ -238,6 +242,7 @@ proc gen_canonical_fsl_param_def {file_handle canonical_name periph if_num} {
 	puts $file_handle [format "#define [::hsi::utils::get_driver_param_name $canonical_name "USE_FSL"] XPAR_%s_IF_%d_USE_FSL" $periph_name $if_num]
 	puts $file_handle [format "#define [::hsi::utils::get_driver_param_name $canonical_name "SEND_FSL"] XPAR_%s_IF_%d_SEND_FSL" $periph_name $if_num]
 	puts $file_handle [format "#define [::hsi::utils::get_driver_param_name $canonical_name "RECV_FSL"] XPAR_%s_IF_%d_RECV_FSL" $periph_name $if_num]
+	puts $file_handle [format "#define [::hsi::utils::get_driver_param_name $canonical_name "MAILBOX_DEPTH"] XPAR_%s_IF_%d_MAILBOX_DEPTH" $periph_name $if_num]
 }
 
 # Generate canonical definitions for an interface
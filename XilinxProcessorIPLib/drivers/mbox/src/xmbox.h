@@ -101,6 +101,22 @@
 * The user can create a handler to service the interrupts generated by the
 * Mailbox IP.
 *
+* <b>Bulk Transfers</b>
+*
+* XMbox_BulkSend() and XMbox_BulkRecv() move a buffer of any length without
+* spinning. As much as fits is transferred right away, and the rest is moved
+* from XMbox_BulkInterruptHandler(), which the user connects to the mailbox
+* interrupt. For a memory mapped interface the send and receive thresholds
+* are set to half the FIFO depth, so that each interrupt moves a batch of
+* words. The send and receive handlers are called once the whole buffer has
+* been transferred.
+*
+* For an FSL interface there are no threshold interrupts. A bulk send uses
+* blocking FSL writes, one access per word, and a bulk receive drains the
+* FIFO with non-blocking FSL reads from the interrupt handler. As the FSL
+* interrupt is active while there is data, it should only be enabled while
+* a bulk receive is outstanding.
+*
 * Using the Blocking version of the Read function is not recommended since
 * the processor will hang until the requested length is received, which might
 * be quite a long time.
@@ -163,6 +179,8 @@
 *       ms   08/07/17 Fixed compilation warnings in xmbox_sinit.c
 * 4.3   sa   04/20/17 Support for FIFO reset using hardware control register.
 *       sd   07/26/17 Modified tcl file to prevent false unconnected flagging.
+*       ag   10/14/26 Added interrupt driven bulk transfers and the
+*                     MailboxDepth configuration parameter.
 *
 *</pre>
 *
@@ -193,9 +211,26 @@ typedef struct {
 	u8 UseFSL;		/**< use the FSL for the interface. */
 	u8 SendID;		/**< FSL link for the write i/f mailbox. */
 	u8 RecvID;		/**< FSL link for the read i/f mailbox. */
+	u32 MailboxDepth;	/**< Depth of the mailbox FIFOs in words */
 
 } XMbox_Config;
 
+/**
+ * Callback function for bulk transfers. The first argument is a callback
+ * reference passed in by the upper layer when setting the callback function,
+ * and the second argument is the number of bytes transferred.
+ */
+typedef void (*XMbox_Handler)(void *CallBackRef, u32 ByteCount);
+
+/**
+ * State of an outstanding bulk transfer
+ */
+typedef struct {
+	u32 *NextPtr;		/**< Next word to transfer */
+	u32 RemainingBytes;	/**< Bytes left to transfer */
+	u32 RequestedBytes;	/**< Bytes requested for the transfer */
+} XMbox_Buffer;
+
 /**
  * The XMbox driver instance data. The user is required to allocate a
  * variable of this type for every mbox device in the system. A
@@ -206,6 +241,12 @@ typedef struct {
 	XMbox_Config Config;	/**< Configuration data, includes base address
 				  */
 	u32 IsReady;		/**< Device is initialized and ready */
+	XMbox_Buffer SendBuffer;	/**< Outstanding bulk send */
+	XMbox_Buffer RecvBuffer;	/**< Outstanding bulk receive */
+	XMbox_Handler SendHandler;	/**< Bulk send done callback */
+	void *SendCallBackRef;		/**< Callback ref for send handler */
+	XMbox_Handler RecvHandler;	/**< Bulk receive done callback */
+	void *RecvCallBackRef;		/**< Callback ref for receive handler */
 } XMbox;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -237,6 +278,17 @@ u32 XMbox_GetStatus(XMbox *InstancePtr);
 void XMbox_SetSendThreshold(XMbox *InstancePtr, u32 Value);
 void XMbox_SetReceiveThreshold(XMbox *InstancePtr, u32 Value);
 
+/*
+ * Bulk transfer functions, in file xmbox_bulk.c
+ */
+void XMbox_SetSendHandler(XMbox *InstancePtr, XMbox_Handler FuncPtr,
+			  void *CallBackRef);
+void XMbox_SetRecvHandler(XMbox *InstancePtr, XMbox_Handler FuncPtr,
+			  void *CallBackRef);
+int XMbox_BulkSend(XMbox *InstancePtr, u32 *BufferPtr, u32 NumBytes);
+int XMbox_BulkRecv(XMbox *InstancePtr, u32 *BufferPtr, u32 NumBytes);
+void XMbox_BulkInterruptHandler(void *InstancePtr);
+
 /*
  * Static initialization function, in file xmbox_sinit.c
  */
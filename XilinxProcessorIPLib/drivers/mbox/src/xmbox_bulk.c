@@ -0,0 +1,451 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xmbox_bulk.c
+* @addtogroup mbox_v4_3
+* @{
+*
+* Contains the interrupt driven bulk transfer functions for the XMbox driver.
+* See xmbox.h for a description of the bulk transfers.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 4.3   ag   10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xmbox.h"
+#include "xil_assert.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static int XMbox_BulkSendProgress(XMbox *InstancePtr);
+static int XMbox_BulkRecvProgress(XMbox *InstancePtr);
+static int XMbox_BulkFSLRecvProgress(XMbox *InstancePtr);
+static void XMbox_BulkIntrEnable(XMbox *InstancePtr, u32 Mask, u32 Enable);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Sets the handler that is called when a bulk send has completed.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+* @param	FuncPtr is the pointer to the callback function.
+* @param	CallBackRef is the upper layer callback reference passed back
+*		when the callback function is invoked.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMbox_SetSendHandler(XMbox *InstancePtr, XMbox_Handler FuncPtr,
+			  void *CallBackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->SendHandler = FuncPtr;
+	InstancePtr->SendCallBackRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+* Sets the handler that is called when a bulk receive has completed.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+* @param	FuncPtr is the pointer to the callback function.
+* @param	CallBackRef is the upper layer callback reference passed back
+*		when the callback function is invoked.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMbox_SetRecvHandler(XMbox *InstancePtr, XMbox_Handler FuncPtr,
+			  void *CallBackRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->RecvHandler = FuncPtr;
+	InstancePtr->RecvCallBackRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+* Starts a bulk send of the buffer. The words that fit in the send FIFO are
+* written right away, the rest is written from XMbox_BulkInterruptHandler()
+* each time the send FIFO has drained to half its depth. The number of bytes
+* must be a multiple of 4 (bytes). If not, the call will fail in an assert.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+* @param	BufferPtr is the source data buffer, aligned to a word
+*		boundary. It must not be modified until the send has completed.
+* @param	NumBytes is the number of bytes to be sent.
+*
+* @return
+*		- XST_SUCCESS if the send was started or has completed.
+*		- XST_DEVICE_BUSY if a bulk send is already in progress.
+*
+* @note		The send handler is called when all bytes have been written,
+*		from this function if they all fit. For an FSL interface the
+*		function returns after all bytes have been written with
+*		blocking FSL writes.
+*
+******************************************************************************/
+int XMbox_BulkSend(XMbox *InstancePtr, u32 *BufferPtr, u32 NumBytes)
+{
+	XMbox_Buffer *BufPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(!((UINTPTR) BufferPtr & 0x3));
+	Xil_AssertNonvoid(NumBytes != 0);
+	Xil_AssertNonvoid((NumBytes % 4) == 0);
+
+	BufPtr = &InstancePtr->SendBuffer;
+	if (BufPtr->RemainingBytes != 0) {
+		return XST_DEVICE_BUSY;
+	}
+
+	BufPtr->NextPtr = BufferPtr;
+	BufPtr->RemainingBytes = NumBytes;
+	BufPtr->RequestedBytes = NumBytes;
+
+	if (InstancePtr->Config.UseFSL == 0) {
+		/* For memory mapped IO */
+		XMbox_SetSendThreshold(InstancePtr,
+				       InstancePtr->Config.MailboxDepth / 2);
+
+		if (!XMbox_BulkSendProgress(InstancePtr)) {
+			XMbox_BulkIntrEnable(InstancePtr, XMB_IX_STA, TRUE);
+			return XST_SUCCESS;
+		}
+	} else {
+		/* FSL based Access, the processor stalls while full */
+		do {
+			XMbox_FSLWriteMBox(InstancePtr->Config.SendID,
+					    *BufPtr->NextPtr++);
+			BufPtr->RemainingBytes -= 4;
+		} while (BufPtr->RemainingBytes != 0);
+	}
+
+	if (InstancePtr->SendHandler != NULL) {
+		InstancePtr->SendHandler(InstancePtr->SendCallBackRef,
+					 NumBytes);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Starts a bulk receive into the buffer. The words in the receive FIFO are
+* read right away, the rest is read from XMbox_BulkInterruptHandler() each
+* time the receive FIFO holds half its depth, or the remaining words. The
+* number of bytes must be a multiple of 4 (bytes). If not, the call will fail
+* in an assert.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+* @param	BufferPtr is the buffer to read the mailbox contents into,
+*		aligned to a word boundary.
+* @param	NumBytes is the number of bytes to be received.
+*
+* @return
+*		- XST_SUCCESS if the receive was started or has completed.
+*		- XST_DEVICE_BUSY if a bulk receive is already in progress.
+*
+* @note		The receive handler is called when all bytes have been read,
+*		from this function if they were all available.
+*
+******************************************************************************/
+int XMbox_BulkRecv(XMbox *InstancePtr, u32 *BufferPtr, u32 NumBytes)
+{
+	XMbox_Buffer *BufPtr;
+	int Done;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(!((UINTPTR) BufferPtr & 0x3));
+	Xil_AssertNonvoid(NumBytes != 0);
+	Xil_AssertNonvoid((NumBytes % 4) == 0);
+
+	BufPtr = &InstancePtr->RecvBuffer;
+	if (BufPtr->RemainingBytes != 0) {
+		return XST_DEVICE_BUSY;
+	}
+
+	BufPtr->NextPtr = BufferPtr;
+	BufPtr->RemainingBytes = NumBytes;
+	BufPtr->RequestedBytes = NumBytes;
+
+	if (InstancePtr->Config.UseFSL == 0) {
+		/* For memory mapped IO */
+		Done = XMbox_BulkRecvProgress(InstancePtr);
+		if (!Done) {
+			XMbox_BulkIntrEnable(InstancePtr, XMB_IX_RTA, TRUE);
+		}
+	} else {
+		/* FSL based Access */
+		Done = XMbox_BulkFSLRecvProgress(InstancePtr);
+	}
+
+	if (Done && (InstancePtr->RecvHandler != NULL)) {
+		InstancePtr->RecvHandler(InstancePtr->RecvCallBackRef,
+					 NumBytes);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Interrupt handler for bulk transfers. It continues the outstanding bulk
+* send and receive, and calls their handlers when they complete. The user
+* connects this function to the interrupt of the mailbox interface.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+*
+* @return	None.
+*
+* @note		The error interrupt is acknowledged but not reported.
+*
+******************************************************************************/
+void XMbox_BulkInterruptHandler(void *InstancePtr)
+{
+	XMbox *MboxPtr = (XMbox *) InstancePtr;
+	UINTPTR BaseAddress;
+	u32 Pending;
+
+	Xil_AssertVoid(MboxPtr != NULL);
+
+	if (MboxPtr->Config.UseFSL != 0) {
+		/* FSL based Access, the interrupt means there is data */
+		if ((MboxPtr->RecvBuffer.RemainingBytes != 0) &&
+		    XMbox_BulkFSLRecvProgress(MboxPtr) &&
+		    (MboxPtr->RecvHandler != NULL)) {
+			MboxPtr->RecvHandler(MboxPtr->RecvCallBackRef,
+					MboxPtr->RecvBuffer.RequestedBytes);
+		}
+		return;
+	}
+
+	BaseAddress = MboxPtr->Config.BaseAddress;
+	Pending = XMbox_ReadReg(BaseAddress, XMB_IS_REG_OFFSET) &
+		  XMbox_ReadReg(BaseAddress, XMB_IE_REG_OFFSET);
+
+	/* Acknowledge before refilling, so that no new edge is lost */
+	XMbox_WriteReg(BaseAddress, XMB_IS_REG_OFFSET, Pending);
+
+	if ((Pending & XMB_IX_STA) &&
+	    (MboxPtr->SendBuffer.RemainingBytes != 0) &&
+	    XMbox_BulkSendProgress(MboxPtr)) {
+		XMbox_BulkIntrEnable(MboxPtr, XMB_IX_STA, FALSE);
+		if (MboxPtr->SendHandler != NULL) {
+			MboxPtr->SendHandler(MboxPtr->SendCallBackRef,
+					MboxPtr->SendBuffer.RequestedBytes);
+		}
+	}
+
+	if ((Pending & XMB_IX_RTA) &&
+	    (MboxPtr->RecvBuffer.RemainingBytes != 0) &&
+	    XMbox_BulkRecvProgress(MboxPtr)) {
+		XMbox_BulkIntrEnable(MboxPtr, XMB_IX_RTA, FALSE);
+		if (MboxPtr->RecvHandler != NULL) {
+			MboxPtr->RecvHandler(MboxPtr->RecvCallBackRef,
+					MboxPtr->RecvBuffer.RequestedBytes);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* Writes words of the outstanding bulk send until the send FIFO is full. The
+* send threshold interrupt is cleared while the FIFO is full, so that the
+* next drain to the threshold raises a new interrupt.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+*
+* @return	TRUE if all bytes have been written, FALSE otherwise.
+*
+* @note		Memory mapped interface only.
+*
+******************************************************************************/
+static int XMbox_BulkSendProgress(XMbox *InstancePtr)
+{
+	XMbox_Buffer *BufPtr = &InstancePtr->SendBuffer;
+	UINTPTR BaseAddress = InstancePtr->Config.BaseAddress;
+
+	do {
+		while ((BufPtr->RemainingBytes != 0) &&
+		       !XMbox_IsFullHw(BaseAddress)) {
+			XMbox_WriteMBox(BaseAddress, *BufPtr->NextPtr++);
+			BufPtr->RemainingBytes -= 4;
+		}
+
+		if (BufPtr->RemainingBytes == 0) {
+			return TRUE;
+		}
+
+		XMbox_WriteReg(BaseAddress, XMB_IS_REG_OFFSET, XMB_IX_STA);
+
+		/* Refill if the FIFO drained before the clear */
+	} while (!XMbox_IsFullHw(BaseAddress));
+
+	return FALSE;
+}
+
+/*****************************************************************************/
+/**
+* Reads words of the outstanding bulk receive until the receive FIFO is
+* empty, and sets the receive threshold for the next batch. The receive
+* threshold interrupt is cleared while the FIFO is empty, so that the next
+* batch raises a new interrupt.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+*
+* @return	TRUE if all bytes have been read, FALSE otherwise.
+*
+* @note		Memory mapped interface only.
+*
+******************************************************************************/
+static int XMbox_BulkRecvProgress(XMbox *InstancePtr)
+{
+	XMbox_Buffer *BufPtr = &InstancePtr->RecvBuffer;
+	UINTPTR BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Words;
+	u32 Batch;
+
+	do {
+		while ((BufPtr->RemainingBytes != 0) &&
+		       !XMbox_IsEmptyHw(BaseAddress)) {
+			*BufPtr->NextPtr++ = XMbox_ReadMBox(BaseAddress);
+			BufPtr->RemainingBytes -= 4;
+		}
+
+		if (BufPtr->RemainingBytes == 0) {
+			return TRUE;
+		}
+
+		/* RTI is set when the FIFO holds more than RIT words */
+		Words = BufPtr->RemainingBytes / 4;
+		Batch = InstancePtr->Config.MailboxDepth / 2;
+		if ((Batch == 0) || (Batch > Words)) {
+			Batch = (Batch == 0) ? 1 : Words;
+		}
+		XMbox_SetReceiveThreshold(InstancePtr, Batch - 1);
+
+		XMbox_WriteReg(BaseAddress, XMB_IS_REG_OFFSET, XMB_IX_RTA);
+
+		/* Drain again if words arrived before the clear */
+	} while (!XMbox_IsEmptyHw(BaseAddress));
+
+	return FALSE;
+}
+
+/*****************************************************************************/
+/**
+* Reads words of the outstanding bulk receive until the FSL link is empty,
+* with one non-blocking FSL read per word.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+*
+* @return	TRUE if all bytes have been read, FALSE otherwise.
+*
+* @note		FSL interface only.
+*
+******************************************************************************/
+static int XMbox_BulkFSLRecvProgress(XMbox *InstancePtr)
+{
+	XMbox_Buffer *BufPtr = &InstancePtr->RecvBuffer;
+	u32 Value;
+
+	while (BufPtr->RemainingBytes != 0) {
+		if (XMbox_FSLReadMBoxNB(InstancePtr->Config.RecvID, Value)) {
+			return FALSE;
+		}
+
+		*BufPtr->NextPtr++ = Value;
+		BufPtr->RemainingBytes -= 4;
+	}
+
+	return TRUE;
+}
+
+/*****************************************************************************/
+/**
+* Enables or disables interrupts in the interrupt enable register, leaving
+* the other interrupts unchanged.
+*
+* @param	InstancePtr is a pointer to the XMbox instance to be worked on.
+* @param	Mask is a logical OR of XMB_IX_* constants.
+* @param	Enable is TRUE to enable and FALSE to disable the interrupts.
+*
+* @return	None.
+*
+* @note		Memory mapped interface only.
+*
+******************************************************************************/
+static void XMbox_BulkIntrEnable(XMbox *InstancePtr, u32 Mask, u32 Enable)
+{
+	u32 RegValue;
+
+	RegValue = XMbox_ReadReg(InstancePtr->Config.BaseAddress,
+				 XMB_IE_REG_OFFSET);
+	if (Enable) {
+		RegValue |= Mask;
+	} else {
+		RegValue &= ~Mask;
+	}
+	XMbox_WriteReg(InstancePtr->Config.BaseAddress, XMB_IE_REG_OFFSET,
+		       RegValue);
+}
+
+/** @} */
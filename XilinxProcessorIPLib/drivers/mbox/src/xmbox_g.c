@@ -44,6 +44,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.00a ecm  06/01/07 Cleanup, new coding standard, check into XCS
+*       ag   10/14/26 Added MailboxDepth.
 * </pre>
 *
 * @note
@@ -73,7 +74,8 @@ XMbox_Config XMbox_ConfigTable[] =
 		XPAR_XMBOX_0_BASEADDR,
 		XPAR_XMBOX_0_USE_FSL,
 		XPAR_XMBOX_0_SEND_ID,
-		XPAR_XMBOX_0_RECV_ID
+		XPAR_XMBOX_0_RECV_ID,
+		XPAR_XMBOX_0_MAILBOX_DEPTH
 	}
 };
 /** @} */
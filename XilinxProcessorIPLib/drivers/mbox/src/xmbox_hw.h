@@ -61,6 +61,7 @@
 *			Renamed _mIsEmpty to _IsEmptyHw and _mIsFull
 *			to _IsFullHw.
 * 4.3   sa   04/20/17   Added CTRL register definitions.
+*       ag   10/14/26   Added non-blocking FSL read and write macros.
 * </pre>
 *
 ******************************************************************************/
@@ -346,6 +347,53 @@ fsl_isinvalid(Full);			\
 Full;					\
 })
 
+/*****************************************************************************/
+/**
+* Read the mbox FIFO using FSL without blocking, in one FSL access.
+*
+* @param	ID contains the link to the mbox device.
+* @param	Value is the variable the read value is stored in.
+*
+* @return
+*		- TRUE if the Read FIFO was empty and no value was read.
+*		- FALSE if a value was read.
+*
+* @note		C-style signature:
+*		u32 XMbox_FSLReadMBoxNB(u32 ID, u32 Value)
+*
+******************************************************************************/
+#define XMbox_FSLReadMBoxNB(ID, Value)		\
+({ 					\
+u32 Invalid;				\
+getdfslx((Value),(ID),FSL_NONBLOCKING);	\
+fsl_isinvalid(Invalid);			\
+Invalid;				\
+})
+
+/*****************************************************************************/
+/**
+* Write a value to the mbox FIFO using FSL without blocking, in one FSL
+* access.
+*
+* @param	ID contains the link to the mbox device.
+* @param	ValueToWrite is the 32 bit value to be written.
+*
+* @return
+*		- TRUE if the Write FIFO was full and the value was not written.
+*		- FALSE if the value was written.
+*
+* @note		C-style signature:
+*		u32 XMbox_FSLWriteMBoxNB(u32 ID, u32 ValueToWrite)
+*
+******************************************************************************/
+#define XMbox_FSLWriteMBoxNB(ID, ValueToWrite)	\
+({ 					\
+u32 Invalid;				\
+putdfslx((ValueToWrite),(ID),FSL_NONBLOCKING); \
+fsl_isinvalid(Invalid);			\
+Invalid;				\
+})
+
 #else
 
 /* these definitions allow the PPC version to compile, empty calls */
@@ -354,6 +402,8 @@ Full;					\
 #define XMbox_FSLWriteMBox(ID, ValueToWrite)
 #define XMbox_FSLIsEmpty(ID) 			0
 #define XMbox_FSLIsFull(ID)			0
+#define XMbox_FSLReadMBoxNB(ID, Value)		((Value) = 0, 1)
+#define XMbox_FSLWriteMBoxNB(ID, ValueToWrite)	1
 
 #endif /* __MICROBLAZE__ */
 
@@ -46,6 +46,7 @@
 * 1.0    adk    18/07/17 Initial version.
 * 1.1    rsp    20/02/18 Fix unused variable warning.
 *                        Remove TimeOut variable.CR-979061
+* 1.1    ag     10/14/26 Added the weighted round robin submit scheduler.
 *
 ******************************************************************************/
 
@@ -588,6 +589,189 @@ u32 XMCdma_SetChan_Weight(XMcdma_ChanCtrl *Chan, u8 Weight)
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+*
+* Initializes a software weighted round robin submit scheduler for the MM2S
+* channels of an MCDMA instance. No channel takes part in the scheduling
+* until it has been given a weight with XMcdma_WrrSetWeight().
+*
+* @param	Sched is the scheduler to be initialized.
+* @param	InstancePtr is a pointer to the DMA engine instance.
+* @param	FetchHandler is called by XMcdma_WrrSubmit() to get the next
+*		buffer of a channel. It must return XST_SUCCESS and fill in
+*		the buffer address and a length of at most MaxLen bytes when
+*		a buffer is available, or XST_NO_DATA otherwise.
+* @param	FetchRef is passed to FetchHandler.
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+void XMcdma_WrrInit(XMcdma_WrrSched *Sched, XMcdma *InstancePtr,
+		    XMcdma_WrrFetchHandler FetchHandler, void *FetchRef)
+{
+	u32 i;
+
+	Xil_AssertVoid(Sched != NULL);
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(FetchHandler != NULL);
+
+	Sched->InstancePtr = InstancePtr;
+	Sched->ChanMask = 0;
+	Sched->NextChan = 1;
+	Sched->FetchHandler = FetchHandler;
+	Sched->FetchRef = FetchRef;
+
+	for (i = 0; i < XMCDMA_MAX_CHAN_PER_DEVICE; i++)
+		Sched->Weight[i] = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Sets the weight of an MM2S channel in the software scheduler and programs
+* the same weight into the hardware WRR register of the channel. The weight
+* is the number of buffers the channel may queue per scheduling round.
+*
+* @param	Sched is the scheduler to be worked on.
+* @param	Chan_id is the MM2S channel number.
+* @param	Weight is the channel weight, 1 to XMCDMA_MAX_WRR_WEIGHT. A
+*		weight of 0 removes the channel from the scheduler and
+*		leaves the hardware weight unchanged.
+*
+* @return
+*		- XST_SUCCESS if the weight was set.
+*		- XST_INVALID_PARAM if the channel or weight is out of range.
+*		- XST_FAILURE if the hardware weight could not be set.
+*
+* @note		None
+*
+******************************************************************************/
+u32 XMcdma_WrrSetWeight(XMcdma_WrrSched *Sched, u32 Chan_id, u8 Weight)
+{
+	XMcdma_ChanCtrl *Chan;
+	u32 Status;
+
+	Xil_AssertNonvoid(Sched != NULL);
+
+	if (Chan_id == 0 ||
+	    Chan_id > (u32)Sched->InstancePtr->Config.TxNumChannels ||
+	    Weight > XMCDMA_MAX_WRR_WEIGHT)
+		return XST_INVALID_PARAM;
+
+	if (Weight == 0) {
+		Sched->ChanMask &= ~(1U << (Chan_id - 1));
+		Sched->Weight[Chan_id - 1] = 0;
+		return XST_SUCCESS;
+	}
+
+	Chan = XMcdma_GetMcdmaTxChan(Sched->InstancePtr, Chan_id);
+	Status = XMCdma_SetChan_Weight(Chan, Weight);
+	if (Status != XST_SUCCESS)
+		return Status;
+
+	Sched->Weight[Chan_id - 1] = Weight;
+	Sched->ChanMask |= 1U << (Chan_id - 1);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Queues buffers on the scheduled MM2S channels in weighted round robin
+* order. In each round every channel may queue up to its weight of buffers,
+* as long as the fetch handler supplies them and the channel has free BDs.
+* Rounds are repeated until BufLimit buffers have been queued or a round
+* queues nothing. The tail descriptor of every channel that got buffers is
+* then updated once, so the hardware sees the whole batch at a time.
+*
+* Scheduling resumes at the channel following the last one visited, so a
+* channel cut short by BufLimit does not lose its turn for good.
+*
+* @param	Sched is the scheduler to be worked on.
+* @param	BufLimit is the maximum number of buffers to queue.
+* @param	SubmitCntPtr is an output parameter holding the number of
+*		buffers queued. It may be NULL.
+*
+* @return
+*		- XST_SUCCESS if the queued buffers were handed to hardware.
+*		- XST_FAILURE if a submit or a channel start failed. Buffers
+*		queued before the failure are still counted.
+*
+* @note		None
+*
+******************************************************************************/
+u32 XMcdma_WrrSubmit(XMcdma_WrrSched *Sched, u32 BufLimit, u32 *SubmitCntPtr)
+{
+	XMcdma_ChanCtrl *Chan;
+	UINTPTR BufAddr;
+	u32 NumChannels;
+	u32 Chan_id;
+	u32 Credit;
+	u32 Len;
+	u32 Touched = 0;
+	u32 Submitted = 0;
+	u32 RoundCnt;
+	u32 Status = XST_SUCCESS;
+	u32 i;
+
+	Xil_AssertNonvoid(Sched != NULL);
+
+	NumChannels = Sched->InstancePtr->Config.TxNumChannels;
+
+	do {
+		RoundCnt = 0;
+
+		for (i = 0; i < NumChannels && Submitted < BufLimit; i++) {
+			Chan_id = Sched->NextChan;
+			Sched->NextChan = (Chan_id % NumChannels) + 1;
+
+			if (!(Sched->ChanMask & (1U << (Chan_id - 1))))
+				continue;
+
+			Chan = XMcdma_GetMcdmaTxChan(Sched->InstancePtr,
+						     Chan_id);
+
+			for (Credit = Sched->Weight[Chan_id - 1];
+			     Credit != 0 && Submitted < BufLimit &&
+			     Chan->BdCnt != 0; Credit--) {
+				if (Sched->FetchHandler(Sched->FetchRef, Chan_id,
+					Chan->BdCnt * Chan->MaxTransferLen,
+					&BufAddr, &Len) != XST_SUCCESS)
+					break;
+
+				if (XMcDma_ChanSubmit(Chan, BufAddr, Len) !=
+				    XST_SUCCESS) {
+					Status = XST_FAILURE;
+					goto tohw;
+				}
+
+				Touched |= 1U << (Chan_id - 1);
+				Submitted++;
+				RoundCnt++;
+			}
+		}
+	} while (RoundCnt != 0 && Submitted < BufLimit);
+
+tohw:
+	for (Chan_id = 1; Touched != 0; Chan_id++, Touched >>= 1) {
+		if (!(Touched & 1))
+			continue;
+
+		Chan = XMcdma_GetMcdmaTxChan(Sched->InstancePtr, Chan_id);
+		if (XMcDma_ChanToHw(Chan) != XST_SUCCESS)
+			Status = XST_FAILURE;
+	}
+
+	if (SubmitCntPtr != NULL)
+		*SubmitCntPtr = Submitted;
+
+	return Status;
+}
+
 u32 XMCdma_GetChan_PktDoneCnt(XMcdma_ChanCtrl *Chan)
 {
 	u32 Offset;
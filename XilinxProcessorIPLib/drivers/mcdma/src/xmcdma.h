@@ -88,6 +88,15 @@
 *   BDs back to the free pool:
 *      - XMcdma_BdChainFree(...)
 *
+* - When many channels are active, XMcdma_BdChainFromHWAll(...) retrieves
+*   and frees the completed BDs of every channel in a channel mask in one
+*   pass, calling a handler once per channel that has completions. The mask
+*   is typically the one returned by XMcdma_GetIntrServicedMask(...).
+*
+* - On the MM2S side XMcdma_WrrSubmit(...) queues buffers across channels in
+*   weighted round robin order, using the weights programmed with
+*   XMcdma_WrrSetWeight(...), and updates each channel tail once per call.
+*
 * The driver also provides API functions to get the status of a completed
 * BD, along with get functions for other fields in the BD.
 *
@@ -139,6 +148,9 @@
 * 1.0   adk 	18/07/17 Initial version.
 * 1.0   adk     09/02/18 Fixed CR#994435 Changes are made in the
 *			 driver tcl file.
+* 1.1   ag      10/14/26 Added XMcdma_BdChainFromHWAll() to harvest completed
+*			 BDs of several channels in one pass and a software
+*			 weighted round robin submit scheduler (XMcdma_Wrr*).
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -165,6 +177,8 @@ extern "C" {
 #define XMCDMA_CHAN_BUSY		2
 #define XMCDMA_BD_MINIMUM_ALIGNMENT	0x40
 #define XMCDMA_AXCACHE			0xB
+#define XMCDMA_MAX_WRR_WEIGHT		0xF	/**< Largest MM2S WRR weight */
+#define XMCDMA_ALL_CHAN_MASK		0xFFFFU	/**< All channels mask */
 
 /* Direction flags */
 #define XMCDMA_DEV_TO_MEM		0
@@ -197,6 +211,12 @@ typedef void (*XMcdma_ChanDoneHandler) (void *CallBackRef);
 typedef void (*XMcdma_ChanErrorHandler) (void *CallBackRef, u32 ErrorMask);
 typedef void (*XMcdma_ChanPktDropHandler) (void *CallBackRef);
 
+typedef void (*XMcdma_ChanHarvestHandler) (void *CallBackRef, u32 Chan_id,
+					   int BdCount, XMcdma_Bd *BdSetPtr);
+typedef s32 (*XMcdma_WrrFetchHandler) (void *CallBackRef, u32 Chan_id,
+				       u32 MaxLen, UINTPTR *BufAddrPtr,
+				       u32 *LenPtr);
+
 typedef enum {
 	XMCDMA_FIXED_PRIORITY,
 	XMCDMA_WRR,
@@ -294,6 +314,23 @@ typedef struct {
 	                                     * interrupt callback */
 
 } XMcdma;
+
+/**
+ * Software weighted round robin submit scheduler for the MM2S channels.
+ * The per channel weights are mirrored into the hardware WRR registers so
+ * that the order in which buffers are queued matches the order in which
+ * the hardware drains them.
+ */
+typedef struct {
+	XMcdma *InstancePtr;		/**< MCDMA instance being scheduled */
+	u32 ChanMask;			/**< Channels taking part, bit n-1 for
+					  *  channel n */
+	u32 NextChan;			/**< Channel the next pass starts at */
+	u8 Weight[XMCDMA_MAX_CHAN_PER_DEVICE];	/**< Buffers per round */
+	XMcdma_WrrFetchHandler FetchHandler;	/**< Supplies the buffers */
+	void *FetchRef;			/**< Passed to FetchHandler */
+} XMcdma_WrrSched;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -506,6 +543,30 @@ typedef struct {
 	XMcdma_ReadReg(Chan->ChanBase, ((ChanId - 1) * XMCDMA_NXTCHAN_OFFSET + \
 		       XMCDMA_PKTDROP_OFFSET))
 
+/*****************************************************************************/
+/**
+* Gets the mask of channels with a pending interrupt in the given direction,
+* bit n-1 set for channel n. The mask is read from the interrupt channel
+* service register with a single access and can be handed straight to
+* XMcdma_BdChainFromHWAll().
+*
+* @param	InstancePtr is the driver instance we are working on
+* @param	Direction is XMCDMA_DEV_TO_MEM (S2MM) or XMCDMA_MEM_TO_DEV
+*		(MM2S).
+*
+* @return	Mask of the channels with pending interrupts.
+*
+* @note		C-style signature:
+*		u32 XMcdma_GetIntrServicedMask(XMcdma *InstancePtr,
+*					       u32 Direction)
+*****************************************************************************/
+#define XMcdma_GetIntrServicedMask(InstancePtr, Direction)		\
+	(((Direction) == XMCDMA_MEM_TO_DEV) ?				\
+	 XMcdma_ReadReg((InstancePtr)->Config.BaseAddress,		\
+			XMCDMA_TXINT_SER_OFFSET) :			\
+	 XMcdma_ReadReg((InstancePtr)->Config.BaseAddress,		\
+			XMCDMA_RX_OFFSET + XMCDMA_RXINT_SER_OFFSET))
+
 /*****************************************************************************/
 /**
  * This function sets the arcache field with the user specified value
@@ -613,6 +674,10 @@ u32 XMCdma_GetChan_Weight(XMcdma_ChanCtrl *Chan);
 u32 XMCdma_GetChan_PktDoneCnt(XMcdma_ChanCtrl *Chan);
 void XMcdma_SetSGAWCache(XMcdma *InstancePtr, u8 Value);
 void XMcdma_SetSGARCache(XMcdma *InstancePtr, u8 Value);
+void XMcdma_WrrInit(XMcdma_WrrSched *Sched, XMcdma *InstancePtr,
+		    XMcdma_WrrFetchHandler FetchHandler, void *FetchRef);
+u32 XMcdma_WrrSetWeight(XMcdma_WrrSched *Sched, u32 Chan_id, u8 Weight);
+u32 XMcdma_WrrSubmit(XMcdma_WrrSched *Sched, u32 BufLimit, u32 *SubmitCntPtr);
 
 int XMcdma_UpdateChanCDesc(XMcdma_ChanCtrl *Chan);
 int XMcdma_UpdateChanTDesc(XMcdma_ChanCtrl *Chan);
@@ -621,6 +686,11 @@ u32 XMcDma_ChanSubmit(XMcdma_ChanCtrl *Chan, UINTPTR BufAddr, u32 len);
 u32 XMcDma_ChanToHw(XMcdma_ChanCtrl *Chan);
 int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit,
 			 XMcdma_Bd **BdSetPtr);
+int XMcdma_BdChainFree(XMcdma_ChanCtrl *Chan, int BdCount,
+		       XMcdma_Bd *BdSetPtr);
+int XMcdma_BdChainFromHWAll(XMcdma *InstancePtr, u32 Direction, u32 ChanMask,
+			    u32 BdLimit, XMcdma_ChanHarvestHandler Handler,
+			    void *CallBackRef);
 u32 XMcdma_BdSetBufAddr(XMcdma_Bd *BdPtr, UINTPTR Addr);
 void XMcDma_BdSetCtrl(XMcdma_Bd *BdPtr, u32 Data);
 void XMcDma_DumpBd(XMcdma_Bd* BdPtr);
@@ -44,6 +44,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 *  1.0  adk  18/07/17 Initial Version.
+*  1.1  ag   10/14/26 Added XMcdma_BdChainFromHWAll().
 ******************************************************************************/
 
 #include "xmcdma.h"
@@ -507,6 +508,80 @@ int XMcdma_BdChainFree(XMcdma_ChanCtrl *Chan, int BdCount, XMcdma_Bd *BdSetPtr)
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+ * Harvests the BDs completed by hardware on all the channels selected by
+ * ChanMask in a single pass. For every channel with completed BDs the
+ * handler is called once with the BD set, after which the BDs are freed
+ * back to the channel.
+ *
+ * Channels without BDs submitted to hardware are skipped without touching
+ * their BD chain, so passing XMCDMA_ALL_CHAN_MASK only costs work on the
+ * channels that are actually busy.
+ *
+ * @param	InstancePtr is the MCDMA instance to be worked on.
+ * @param	Direction is XMCDMA_DEV_TO_MEM (S2MM) or XMCDMA_MEM_TO_DEV
+ *		(MM2S).
+ * @param	ChanMask selects the channels to harvest, bit n-1 for
+ *		channel n. XMcdma_GetIntrServicedMask() returns a suitable
+ *		mask for use from an interrupt handler.
+ * @param	BdLimit is the maximum number of BDs to harvest per channel.
+ * @param	Handler is called for each channel with completed BDs. The
+ *		BDs must be treated as read-only and not be retained after
+ *		the handler returns.
+ * @param	CallBackRef is passed to the handler.
+ *
+ * @return	The total number of BDs harvested across all the channels.
+ *
+ * @note	This function should not be preempted by another XAxiMcDma
+ *		function call that modifies the BD space of the same channels.
+ *		It is the caller's responsibility to ensure mutual exclusion.
+ *
+ *****************************************************************************/
+int XMcdma_BdChainFromHWAll(XMcdma *InstancePtr, u32 Direction, u32 ChanMask,
+			    u32 BdLimit, XMcdma_ChanHarvestHandler Handler,
+			    void *CallBackRef)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_Bd *BdSetPtr;
+	u32 NumChannels;
+	u32 Chan_id;
+	int BdCount;
+	int Total = 0;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Handler != NULL);
+
+	if (Direction == XMCDMA_MEM_TO_DEV)
+		NumChannels = InstancePtr->Config.TxNumChannels;
+	else
+		NumChannels = InstancePtr->Config.RxNumChannels;
+
+	for (Chan_id = 1; ChanMask != 0 && Chan_id <= NumChannels;
+	     Chan_id++, ChanMask >>= 1) {
+		if (!(ChanMask & 1))
+			continue;
+
+		if (Direction == XMCDMA_MEM_TO_DEV)
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
+		else
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr, Chan_id);
+
+		if (Chan->BdSubmitCnt == 0)
+			continue;
+
+		BdCount = XMcdma_BdChainFromHW(Chan, BdLimit, &BdSetPtr);
+		if (BdCount <= 0)
+			continue;
+
+		Handler(CallBackRef, Chan_id, BdCount, BdSetPtr);
+		(void)XMcdma_BdChainFree(Chan, BdCount, BdSetPtr);
+		Total += BdCount;
+	}
+
+	return Total;
+}
+
 /*****************************************************************************/
 /**
 * Set the Buffer descriptor buffer address field.
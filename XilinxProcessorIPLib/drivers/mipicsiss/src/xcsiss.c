@@ -47,6 +47,7 @@
 * 1.0 vsa 07/21/15 Initial release
 * 1.1 sss 08/17/16 Added 64 bit support
 *     sss 08/29/16 Added check for Dphy register interface
+*     ag  10/14/26 Clear the virtual channel routes on initialization
 * </pre>
 *
 ******************************************************************************/
@@ -136,6 +137,9 @@ u32 XCsiSs_CfgInitialize(XCsiSs *InstancePtr, XCsiSs_Config *CfgPtr,
 				UINTPTR EffectiveAddr)
 {
 	u32 Status;
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	u8 Vc;
+#endif
 
 	/* Verify arguments */
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -146,6 +150,13 @@ u32 XCsiSs_CfgInitialize(XCsiSs *InstancePtr, XCsiSs_Config *CfgPtr,
 	InstancePtr->Config = *CfgPtr;
 	InstancePtr->Config.BaseAddr = EffectiveAddr;
 
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	for (Vc = 0; Vc < XCSI_MAX_VC; Vc++) {
+		InstancePtr->VcRoute[Vc].FrmbufWrPtr = NULL;
+		InstancePtr->VcRoute[Vc].FrameDoneCallBack = NULL;
+	}
+#endif
+
 	/* Determine sub-cores included in provided instance of subsystem */
 	CsiSs_GetIncludedSubCores(InstancePtr);
 
@@ -110,6 +110,23 @@
 * The XCsiSs_SetCallBack() is used to register the call back functions
 * for MIPI CSI2 Rx Subsystem driver with the corresponding handles
 *
+* <b>Virtual Channel Routing</b>
+*
+* When the output stream of the subsystem is split on TDEST (the virtual
+* channel) by an AXI4-Stream switch in the design, each virtual channel can be
+* routed to its own frame buffer write core with XCsiSs_SetVcRoute(). The
+* route attaches a frame buffer ring (see xvidc_fbring.h) to the frame buffer
+* write core, so buffers are rotated by the frame buffer write interrupt
+* handler without any per frame steering by the application. A frame done
+* callback can be registered for each virtual channel with
+* XCsiSs_SetVcCallBack(); it is given the sequence number of the frame that
+* has just been made available in the ring. If a data type is given for the
+* route, frames whose data type reported by the CSI Rx Controller differs are
+* counted and not reported. The ap_done and ap_ready interrupts of every
+* frame buffer write core must be enabled and connected to
+* XVFrmbufWr_InterruptHandler(). Routing is only built when the design
+* contains the frame buffer write core.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -150,6 +167,8 @@
 *                  for CR-965028.
 *     ms  03/17/17 Added readme.txt file in examples folder for doxygen
 *                  generation.
+*     ag  10/14/26 Added routing of virtual channels to frame buffer write
+*                  cores with frame buffer rings.
 * </pre>
 *
 ******************************************************************************/
@@ -172,6 +191,9 @@ extern "C" {
 #if (XPAR_XIIC_NUM_INSTANCES > 0)
 #include "xiic.h"
 #endif
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+#include "xv_frmbufwr_l2.h"
+#endif
 #include "xdebug.h"
 #include "xcsiss_hw.h"
 
@@ -193,6 +215,8 @@ extern "C" {
 #define XCSISS_HANDLER_OTHERERROR	XCSI_HANDLER_OTHERERROR
 /*@}*/
 
+#define XCSISS_VCROUTE_DT_ANY	0xFF	/**< Route frames of any data type */
+
 /**
 *
 * Callback type which acts as a wrapper on top of CSI Callback.
@@ -211,6 +235,45 @@ extern "C" {
  *****************************************************************************/
 typedef void (*XCsiSs_Callback)(void *CallbackRef, u32 Mask);
 
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+/**
+*
+* Callback type for the frame done event of a routed virtual channel.
+*
+* @param	CallbackRef is a callback reference passed in by the upper
+*		layer when setting the callback function, and passed back to
+*		the upper layer when the callback is invoked.
+* @param	Vc is the virtual channel the frame was received on.
+* @param	FrameSeq is the sequence number the frame was stamped with
+*		in the frame buffer ring of the route.
+*
+* @return	None.
+*
+* @note		None.
+*
+ *****************************************************************************/
+typedef void (*XCsiSs_VcCallback)(void *CallbackRef, u8 Vc, u32 FrameSeq);
+
+/**
+ * Route of a virtual channel to a frame buffer write core
+ */
+typedef struct {
+	void *CsiSsPtr;		/**< Subsystem the route belongs to */
+	XV_FrmbufWr_l2 *FrmbufWrPtr;	/**< Frame buffer write core, or NULL
+					  *  if the channel is not routed */
+	XVidC_FbRing *RingPtr;	/**< Frame buffer ring of the route */
+	u8 Vc;			/**< Virtual channel */
+	u8 DataType;		/**< Data type expected on the channel, or
+				  *  XCSISS_VCROUTE_DT_ANY */
+	XCsiSs_VcCallback FrameDoneCallBack;	/**< Frame done callback */
+	void *FrameDoneRef;	/**< To be passed to the frame done callback */
+	u32 LastSeq;		/**< Sequence number of the last frame
+				  *  reported */
+	u32 Frames;		/**< Frames reported */
+	u32 DtMismatch;		/**< Frames of another data type */
+} XCsiSs_VcRoute;
+#endif
+
 /**
  * Sub-Core Configuration Table
  */
@@ -275,6 +338,9 @@ typedef struct {
 							  *  information */
 	XCsi_SPktData SpktData;		/**< Short packet */
 	XCsi_VCInfo VCInfo[XCSI_MAX_VC];/**< Virtual Channel information */
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	XCsiSs_VcRoute VcRoute[XCSI_MAX_VC];	/**< Virtual Channel routes */
+#endif
 } XCsiSs;
 
 /************************** Function Prototypes ******************************/
@@ -305,6 +371,15 @@ void XCsiSs_IntrDisable(XCsiSs *InstancePtr, u32 IntrMask);
 u32 XCsiSs_SetCallBack(XCsiSs *InstancePtr, u32 HandlerType,
 			void *CallbackFunc, void *CallbackRef);
 
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+/* Virtual channel routing functions in xcsiss_vcroute.c */
+u32 XCsiSs_SetVcRoute(XCsiSs *InstancePtr, u8 Vc, u8 DataType,
+		XV_FrmbufWr_l2 *FrmbufWrPtr, XVidC_FbRing *RingPtr);
+void XCsiSs_ClearVcRoute(XCsiSs *InstancePtr, u8 Vc);
+u32 XCsiSs_SetVcCallBack(XCsiSs *InstancePtr, u8 Vc,
+		XCsiSs_VcCallback CallbackFunc, void *CallbackRef);
+#endif
+
 /************************** Variable Declarations ****************************/
 
 #ifdef __cplusplus
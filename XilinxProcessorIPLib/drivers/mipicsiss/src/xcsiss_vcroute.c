@@ -0,0 +1,259 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xcsiss_vcroute.c
+* @addtogroup csiss_v1_1
+* @{
+*
+* This file routes the virtual channels of the Xilinx MIPI CSI Rx Subsystem
+* to frame buffer write cores, each one with its own frame buffer ring.
+* Please see xcsiss.h for more details of the driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver Who Date     Changes
+* --- --- -------- ------------------------------------------------------------
+* 1.1 ag  10/14/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xparameters.h"
+#include "xstatus.h"
+#include "xcsi.h"
+#include "xcsiss.h"
+
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+
+/************************** Constant Definitions *****************************/
+
+
+/**************************** Type Definitions *******************************/
+
+
+/**************************** Local Global ***********************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static void CsiSs_VcFrameDone(void *CallbackRef);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* This function routes a virtual channel to a frame buffer write core. The
+* frame buffer ring is attached to the core, which takes its first buffer,
+* and the frame done interrupt of the core is hooked so that the frames are
+* reported per virtual channel. Call it before the frame buffer write core is
+* started.
+*
+* @param	InstancePtr is the MIPI CSI Rx Subsystem instance to operate on
+* @param	Vc is the virtual channel to be routed, 0 to XCSI_MAX_VC - 1
+* @param	DataType is the data type expected on the channel, or
+*		XCSISS_VCROUTE_DT_ANY
+* @param	FrmbufWrPtr is the frame buffer write core the AXI4-Stream of
+*		the virtual channel is connected to
+* @param	RingPtr is the initialized frame buffer ring of the route
+*
+* @return
+*		- XST_SUCCESS if the route is set
+*		- XST_DEVICE_BUSY if the channel or the core is already routed
+*		- XST_NO_DATA if the ring has no free buffer
+*		- XST_FAILURE if the first buffer can't be programmed
+*
+* @note		The frame done callback of the frame buffer write core is
+*		taken over by the route.
+*
+******************************************************************************/
+u32 XCsiSs_SetVcRoute(XCsiSs *InstancePtr, u8 Vc, u8 DataType,
+		XV_FrmbufWr_l2 *FrmbufWrPtr, XVidC_FbRing *RingPtr)
+{
+	XCsiSs_VcRoute *RoutePtr;
+	u8 Index;
+	int Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Vc < XCSI_MAX_VC);
+	Xil_AssertNonvoid(FrmbufWrPtr != NULL);
+	Xil_AssertNonvoid(RingPtr != NULL);
+
+	for (Index = 0; Index < XCSI_MAX_VC; Index++) {
+		if ((InstancePtr->VcRoute[Index].FrmbufWrPtr == FrmbufWrPtr) ||
+			((Index == Vc) &&
+			(InstancePtr->VcRoute[Index].FrmbufWrPtr != NULL))) {
+			return XST_DEVICE_BUSY;
+		}
+	}
+
+	Status = XVFrmbufWr_SetRing(FrmbufWrPtr, RingPtr);
+	if (Status == XST_NO_DATA) {
+		return XST_NO_DATA;
+	}
+	else if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	RoutePtr = &InstancePtr->VcRoute[Vc];
+	RoutePtr->CsiSsPtr = InstancePtr;
+	RoutePtr->RingPtr = RingPtr;
+	RoutePtr->Vc = Vc;
+	RoutePtr->DataType = DataType;
+	RoutePtr->LastSeq = RingPtr->WrSeq;
+	RoutePtr->Frames = 0;
+	RoutePtr->DtMismatch = 0;
+	RoutePtr->FrmbufWrPtr = FrmbufWrPtr;
+
+	XVFrmbufWr_SetCallback(FrmbufWrPtr, XVFRMBUFWR_HANDLER_DONE,
+				(void *)CsiSs_VcFrameDone, (void *)RoutePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function removes the route of a virtual channel. Frames written by the
+* frame buffer write core are no longer reported. The frame buffer ring stays
+* attached to the core, which is to be stopped by the application.
+*
+* @param	InstancePtr is the MIPI CSI Rx Subsystem instance to operate on
+* @param	Vc is the virtual channel, 0 to XCSI_MAX_VC - 1
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+void XCsiSs_ClearVcRoute(XCsiSs *InstancePtr, u8 Vc)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Vc < XCSI_MAX_VC);
+
+	InstancePtr->VcRoute[Vc].FrmbufWrPtr = NULL;
+}
+
+/*****************************************************************************/
+/**
+* This function registers the frame done callback of a virtual channel. The
+* callback is invoked from the frame buffer write interrupt handler once a
+* frame of the channel is complete and has been released to the frame buffer
+* ring of the route.
+*
+* @param	InstancePtr is the MIPI CSI Rx Subsystem instance to operate on
+* @param	Vc is the virtual channel, 0 to XCSI_MAX_VC - 1
+* @param	CallbackFunc is the address of the callback function
+* @param	CallbackRef is a user data item that will be passed to the
+*		callback function when it is invoked
+*
+* @return
+*		- XST_SUCCESS when callback has been registered
+*
+* @note		The callback can be registered before or after the route is
+*		set.
+*
+******************************************************************************/
+u32 XCsiSs_SetVcCallBack(XCsiSs *InstancePtr, u8 Vc,
+		XCsiSs_VcCallback CallbackFunc, void *CallbackRef)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Vc < XCSI_MAX_VC);
+	Xil_AssertNonvoid(CallbackFunc != NULL);
+	Xil_AssertNonvoid(CallbackRef != NULL);
+
+	InstancePtr->VcRoute[Vc].FrameDoneCallBack = CallbackFunc;
+	InstancePtr->VcRoute[Vc].FrameDoneRef = CallbackRef;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function is the frame done callback of a routed frame buffer write
+* core. The frame buffer write interrupt handler has already released the
+* frame to the ring; if the ring took a new frame it is checked against the
+* expected data type and reported to the callback of the virtual channel.
+* Frames dropped by the ring are not reported.
+*
+* @param	CallbackRef is the route of the virtual channel
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void CsiSs_VcFrameDone(void *CallbackRef)
+{
+	XCsiSs_VcRoute *RoutePtr = (XCsiSs_VcRoute *)CallbackRef;
+	XCsiSs *CsiSsPtr;
+	XCsi_VCInfo VCInfo;
+	u32 FrameSeq;
+
+	if (RoutePtr->FrmbufWrPtr == NULL) {
+		return;
+	}
+
+	FrameSeq = RoutePtr->RingPtr->WrSeq;
+	if (FrameSeq == RoutePtr->LastSeq) {
+		return;
+	}
+	RoutePtr->LastSeq = FrameSeq;
+
+	CsiSsPtr = (XCsiSs *)RoutePtr->CsiSsPtr;
+	if (RoutePtr->DataType != XCSISS_VCROUTE_DT_ANY) {
+		XCsi_GetVCInfo(CsiSsPtr->CsiPtr, RoutePtr->Vc, &VCInfo);
+		if (VCInfo.DataType != RoutePtr->DataType) {
+			RoutePtr->DtMismatch++;
+			return;
+		}
+	}
+
+	RoutePtr->Frames++;
+	if (RoutePtr->FrameDoneCallBack) {
+		RoutePtr->FrameDoneCallBack(RoutePtr->FrameDoneRef,
+						RoutePtr->Vc, FrameSeq);
+	}
+}
+
+#endif
+/** @} */
@@ -54,6 +54,8 @@
 * 4.1   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototype of XMutex_CfgInitialize API.
 * 4.2   mi   09/22/16 Fixed compilation warnings.
+* 4.3   ag   10/14/26 Initialize the backoff parameters in
+*                     XMutex_CfgInitialize.
 * </pre>
 *
 ******************************************************************************/
@@ -107,6 +109,9 @@ int XMutex_CfgInitialize(XMutex *InstancePtr, XMutex_Config *ConfigPtr,
 	memcpy(&InstancePtr->Config, ConfigPtr, sizeof(XMutex_Config));
 
 	InstancePtr->Config.BaseAddress = EffectiveAddress;
+	InstancePtr->BackoffMin = XMU_BACKOFF_MIN_DEFAULT;
+	InstancePtr->BackoffMax = XMU_BACKOFF_MAX_DEFAULT;
+	InstancePtr->Seed = XPAR_CPU_ID + 1U;
 
 	for(i=0; i < ConfigPtr->NumMutex; i++){
 		XMutex_Unlock(InstancePtr, i);
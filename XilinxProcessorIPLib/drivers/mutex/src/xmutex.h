@@ -51,6 +51,36 @@
 *   - An optional user field within each Mutex that can be read or
 *     written to by software.
 *
+* <b>Contention Handling</b>
+*
+* XMutex_Lock() retries the lock write back to back, which keeps the
+* interconnect busy for as long as the Mutex is held elsewhere. When several
+* processors contend for the same Mutex the following functions, in file
+* xmutex_ext.c, should be used instead:
+*
+*   - XMutex_LockBackoff() polls the Mutex register with reads and only
+*     attempts the lock write when the Mutex is seen free. Failed attempts are
+*     followed by an exponentially growing, randomized delay bounded by
+*     XMutex_SetBackoff().
+*
+*   - XMutex_TicketLock()/XMutex_TicketUnlock() grant the lock in FIFO order.
+*     The ticket counter is kept in the USER register of a guard Mutex and the
+*     now-serving counter in the USER register of a second Mutex, so a ticket
+*     lock occupies two Mutexes of a device configured with USER registers.
+*     A waiter polls with a delay proportional to its distance from the head
+*     of the queue.
+*
+*   - XMutex_ReadLock()/XMutex_WriteLock() implement a reader/writer lock. The
+*     reader count and writer flags are kept in the USER register of the
+*     Mutex, which is only modified while the hardware lock is held. Writers
+*     take preference over new readers once they start waiting.
+*
+* The counters kept in USER registers must be cleared by a single processor
+* with XMutex_TicketInit() or XMutex_RwInit() before any processor uses them.
+* Each instance counts acquisitions and retries made through these functions,
+* see XMutex_GetStats(). The counts are local to the processor owning the
+* instance.
+*
 * This driver is intended to be RTOS and processor independent. Any needs for
 * dynamic memory management, threads or thread mutual exclusion, virtual memory,
 * or cache control must be satisfied by the layer above this driver.
@@ -114,6 +144,8 @@
 * 4.3   ms   04/18/17 Modified tcl file to add suffix U for all macros
 *                     definitions of mutex in xparameters.h
 *       ms   08/07/17 Fixed compilation warnings in xmutex_sinit.c
+*       ag   10/14/26 Added backoff, ticket and reader/writer locks with
+*                     contention statistics in xmutex_ext.c.
 * </pre>
 *
 ******************************************************************************/
@@ -133,6 +165,23 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+/** @name Backoff Defaults
+ * Default bounds, in delay loop iterations, used by the backoff lock
+ * functions until XMutex_SetBackoff() is called.
+ * @{
+ */
+#define XMU_BACKOFF_MIN_DEFAULT	16U
+#define XMU_BACKOFF_MAX_DEFAULT	4096U
+/* @} */
+
+/** @name Reader/Writer Lock USER Register Layout
+ * @{
+ */
+#define XMU_RW_WRITER_BIT	0x80000000U /**< A writer holds the lock */
+#define XMU_RW_PENDING_BIT	0x40000000U /**< A writer is waiting */
+#define XMU_RW_READERS_MASK	0x3FFFFFFFU /**< Number of readers */
+/* @} */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -146,6 +195,25 @@ typedef struct {
 } XMutex_Config;
 
 
+/**
+ * Contention statistics of the lock functions in xmutex_ext.c.
+ */
+typedef struct {
+	u32 Acquisitions;	/**< Locks obtained */
+	u32 Contended;		/**< Locks that needed more than one attempt */
+	u32 Retries;		/**< Total failed attempts or polls */
+	u32 MaxRetries;		/**< Largest number of retries for one lock */
+} XMutex_Stats;
+
+/**
+ * A ticket lock built from two Mutexes of the same device.
+ */
+typedef struct {
+	u8 GuardMutex;	/**< Mutex whose USER register holds the next ticket */
+	u8 ServeMutex;	/**< Mutex whose USER register holds the ticket
+			  *  currently served */
+} XMutex_Ticket;
+
 /**
  * The XMutex driver instance data. The user is required to allocate a
  * variable of this type for every Mutex device in the system. A
@@ -155,6 +223,10 @@ typedef struct {
 typedef struct {
 	XMutex_Config Config; /**< Configuration data, includes base address */
 	u32 IsReady;	      /**< Device is initialized and ready */
+	u32 BackoffMin;	      /**< Initial backoff delay */
+	u32 BackoffMax;	      /**< Upper bound of the backoff delay */
+	u32 Seed;	      /**< Backoff randomization state */
+	XMutex_Stats Stats;   /**< Contention statistics */
 } XMutex;
 
 
@@ -177,6 +249,23 @@ void XMutex_GetStatus(XMutex *InstancePtr, u8 MutexNumber, u32 *Locked,
 int XMutex_GetUser(XMutex *InstancePtr, u8 MutexNumber, u32 *User);
 int XMutex_SetUser(XMutex *InstancePtr, u8 MutexNumber, u32 User);
 
+/*
+ * Contention aware lock functions, in file xmutex_ext.c
+ */
+void XMutex_SetBackoff(XMutex *InstancePtr, u32 MinDelay, u32 MaxDelay);
+void XMutex_LockBackoff(XMutex *InstancePtr, u8 MutexNumber);
+int XMutex_TicketInit(XMutex *InstancePtr, XMutex_Ticket *TicketPtr,
+			u8 GuardMutex, u8 ServeMutex);
+void XMutex_TicketLock(XMutex *InstancePtr, XMutex_Ticket *TicketPtr);
+void XMutex_TicketUnlock(XMutex *InstancePtr, XMutex_Ticket *TicketPtr);
+int XMutex_RwInit(XMutex *InstancePtr, u8 MutexNumber);
+void XMutex_ReadLock(XMutex *InstancePtr, u8 MutexNumber);
+void XMutex_ReadUnlock(XMutex *InstancePtr, u8 MutexNumber);
+void XMutex_WriteLock(XMutex *InstancePtr, u8 MutexNumber);
+void XMutex_WriteUnlock(XMutex *InstancePtr, u8 MutexNumber);
+void XMutex_GetStats(XMutex *InstancePtr, XMutex_Stats *StatsPtr);
+void XMutex_ResetStats(XMutex *InstancePtr);
+
 /*
  * Static Initialization function, in file xmutex_sinit.c
  */
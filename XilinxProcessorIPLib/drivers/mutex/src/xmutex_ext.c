@@ -0,0 +1,617 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xmutex_ext.c
+* @addtogroup mutex_v4_3
+* @{
+*
+* Contains the contention aware lock functions of the XMutex driver: a lock
+* with exponential backoff, a FIFO ticket lock, a reader/writer lock and the
+* contention statistics. See xmutex.h for more information about the driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 4.3   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xmutex.h"
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xil_assert.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XMutex_ReadUser(InstancePtr, MutexNumber)			\
+	XMutex_ReadReg((InstancePtr)->Config.BaseAddress, (MutexNumber),	\
+			XMU_USER_REG_OFFSET)
+
+#define XMutex_WriteUser(InstancePtr, MutexNumber, Value)		\
+	XMutex_WriteReg((InstancePtr)->Config.BaseAddress, (MutexNumber),	\
+			XMU_USER_REG_OFFSET, (Value))
+
+/************************** Function Prototypes ******************************/
+
+static void XMutex_Delay(u32 Count);
+static void XMutex_Backoff(XMutex *InstancePtr, u32 *BackoffPtr);
+static u32 XMutex_Acquire(XMutex *InstancePtr, u8 MutexNumber);
+static void XMutex_Account(XMutex *InstancePtr, u32 Retries);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* Sets the bounds of the delay inserted between failed lock attempts by the
+* functions in this file. The delay starts at MinDelay and doubles after every
+* failed attempt until it reaches MaxDelay.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MinDelay is the initial delay in delay loop iterations. It must
+*		be non-zero.
+* @param	MaxDelay is the largest delay in delay loop iterations. It must
+*		not be less than MinDelay.
+*
+* @return	None.
+*
+* @note		The defaults are XMU_BACKOFF_MIN_DEFAULT and
+*		XMU_BACKOFF_MAX_DEFAULT.
+*
+******************************************************************************/
+void XMutex_SetBackoff(XMutex *InstancePtr, u32 MinDelay, u32 MaxDelay)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(MinDelay != 0U);
+	Xil_AssertVoid(MinDelay <= MaxDelay);
+
+	InstancePtr->BackoffMin = MinDelay;
+	InstancePtr->BackoffMax = MaxDelay;
+}
+
+/*****************************************************************************/
+/**
+*
+* Locks a particular Mutex lock within a Mutex device. Call blocks till the
+* Mutex is locked. Unlike XMutex_Lock, the lock write is only issued when the
+* Mutex register reads as free and every failed attempt is followed by an
+* exponentially growing delay, which keeps a contended Mutex from saturating
+* the interconnect.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MutexNumber is the specific Mutex lock within the device to
+*		operate on. Each device may contain multiple Mutex locks.
+*		The Mutex number is a zero based number  with a range of
+*		0 - (InstancePtr->Config.NumMutex - 1).
+*
+* @return	None.
+*
+* @note		The Mutex is released with XMutex_Unlock.
+*
+******************************************************************************/
+void XMutex_LockBackoff(XMutex *InstancePtr, u8 MutexNumber)
+{
+	u32 Retries;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(MutexNumber < InstancePtr->Config.NumMutex);
+
+	Retries = XMutex_Acquire(InstancePtr, MutexNumber);
+	XMutex_Account(InstancePtr, Retries);
+}
+
+/*****************************************************************************/
+/**
+*
+* Initializes a ticket lock built from two Mutexes of the device. The USER
+* registers of both Mutexes are cleared, so this must be called by a single
+* processor before any processor uses the ticket lock. The other processors
+* set the GuardMutex and ServeMutex fields of their XMutex_Ticket to the same
+* Mutex numbers directly.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	TicketPtr is a pointer to the ticket lock to initialize.
+* @param	GuardMutex is the Mutex protecting the ticket counter.
+* @param	ServeMutex is the Mutex whose USER register holds the ticket
+*		currently served. The lock of this Mutex is not used.
+*
+* @return
+*		- XST_SUCCESS if the ticket lock was initialized.
+*		- XST_NO_FEATURE if the Mutex was not configured with USER
+*		  registers.
+*
+* @note		None.
+*
+******************************************************************************/
+int XMutex_TicketInit(XMutex *InstancePtr, XMutex_Ticket *TicketPtr,
+			u8 GuardMutex, u8 ServeMutex)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TicketPtr != NULL);
+	Xil_AssertNonvoid(GuardMutex < InstancePtr->Config.NumMutex);
+	Xil_AssertNonvoid(ServeMutex < InstancePtr->Config.NumMutex);
+	Xil_AssertNonvoid(GuardMutex != ServeMutex);
+
+	if (!(InstancePtr->Config.UserReg)) {
+		return XST_NO_FEATURE;
+	}
+
+	TicketPtr->GuardMutex = GuardMutex;
+	TicketPtr->ServeMutex = ServeMutex;
+
+	XMutex_WriteUser(InstancePtr, GuardMutex, 0U);
+	XMutex_WriteUser(InstancePtr, ServeMutex, 0U);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Acquires a ticket lock. The caller draws the next ticket under the guard
+* Mutex and then waits until the now-serving counter reaches its ticket, so
+* the lock is granted in the order the tickets were drawn. While waiting, the
+* now-serving counter is polled with a delay proportional to the number of
+* processors ahead of the caller.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	TicketPtr is a pointer to a ticket lock initialized with
+*		XMutex_TicketInit.
+*
+* @return	None.
+*
+* @note		The ticket lock is not recursive.
+*
+******************************************************************************/
+void XMutex_TicketLock(XMutex *InstancePtr, XMutex_Ticket *TicketPtr)
+{
+	u32 Ticket;
+	u32 Serving;
+	u32 Delay;
+	u32 Retries;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(TicketPtr != NULL);
+	Xil_AssertVoid(InstancePtr->Config.UserReg != 0U);
+
+	Retries = XMutex_Acquire(InstancePtr, TicketPtr->GuardMutex);
+	Ticket = XMutex_ReadUser(InstancePtr, TicketPtr->GuardMutex);
+	XMutex_WriteUser(InstancePtr, TicketPtr->GuardMutex, Ticket + 1U);
+	(void)XMutex_Unlock(InstancePtr, TicketPtr->GuardMutex);
+
+	while (1) {
+		Serving = XMutex_ReadUser(InstancePtr, TicketPtr->ServeMutex);
+		if (Serving == Ticket) {
+			break;
+		}
+
+		/* Counters wrap, the distance is modulo 2^32 */
+		Delay = (Ticket - Serving) * InstancePtr->BackoffMin;
+		if ((Delay > InstancePtr->BackoffMax) ||
+		    (Delay < InstancePtr->BackoffMin)) {
+			Delay = InstancePtr->BackoffMax;
+		}
+		XMutex_Delay(Delay);
+		Retries++;
+	}
+
+	XMutex_Account(InstancePtr, Retries);
+}
+
+/*****************************************************************************/
+/**
+*
+* Releases a ticket lock acquired with XMutex_TicketLock, granting it to the
+* holder of the next ticket.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	TicketPtr is a pointer to the ticket lock to release.
+*
+* @return	None.
+*
+* @note		Only the holder of the ticket lock writes the now-serving
+*		counter, so no Mutex is locked here.
+*
+******************************************************************************/
+void XMutex_TicketUnlock(XMutex *InstancePtr, XMutex_Ticket *TicketPtr)
+{
+	u32 Serving;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(TicketPtr != NULL);
+
+	Serving = XMutex_ReadUser(InstancePtr, TicketPtr->ServeMutex);
+	XMutex_WriteUser(InstancePtr, TicketPtr->ServeMutex, Serving + 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* Initializes the reader/writer lock kept in a Mutex by clearing its USER
+* register. This must be called by a single processor before any processor
+* uses the reader/writer lock.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MutexNumber is the Mutex holding the reader/writer lock.
+*
+* @return
+*		- XST_SUCCESS if the reader/writer lock was initialized.
+*		- XST_NO_FEATURE if the Mutex was not configured with USER
+*		  registers.
+*
+* @note		None.
+*
+******************************************************************************/
+int XMutex_RwInit(XMutex *InstancePtr, u8 MutexNumber)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MutexNumber < InstancePtr->Config.NumMutex);
+
+	if (!(InstancePtr->Config.UserReg)) {
+		return XST_NO_FEATURE;
+	}
+
+	XMutex_WriteUser(InstancePtr, MutexNumber, 0U);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Acquires a reader/writer lock for reading. Any number of readers may hold
+* the lock at the same time. The call blocks while a writer holds the lock or
+* waits for it.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MutexNumber is the Mutex holding the reader/writer lock.
+*
+* @return	None.
+*
+* @note		The hardware lock is only held while the USER register is
+*		updated, not while the reader/writer lock is held.
+*
+******************************************************************************/
+void XMutex_ReadLock(XMutex *InstancePtr, u8 MutexNumber)
+{
+	u32 State;
+	u32 Backoff;
+	u32 Retries = 0U;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(MutexNumber < InstancePtr->Config.NumMutex);
+	Xil_AssertVoid(InstancePtr->Config.UserReg != 0U);
+
+	Backoff = InstancePtr->BackoffMin;
+	while (1) {
+		Retries += XMutex_Acquire(InstancePtr, MutexNumber);
+		State = XMutex_ReadUser(InstancePtr, MutexNumber);
+		if ((State & (XMU_RW_WRITER_BIT | XMU_RW_PENDING_BIT)) == 0U) {
+			XMutex_WriteUser(InstancePtr, MutexNumber, State + 1U);
+			(void)XMutex_Unlock(InstancePtr, MutexNumber);
+			break;
+		}
+		(void)XMutex_Unlock(InstancePtr, MutexNumber);
+
+		XMutex_Backoff(InstancePtr, &Backoff);
+		Retries++;
+	}
+
+	XMutex_Account(InstancePtr, Retries);
+}
+
+/*****************************************************************************/
+/**
+*
+* Releases a reader/writer lock acquired with XMutex_ReadLock.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MutexNumber is the Mutex holding the reader/writer lock.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMutex_ReadUnlock(XMutex *InstancePtr, u8 MutexNumber)
+{
+	u32 State;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(MutexNumber < InstancePtr->Config.NumMutex);
+
+	(void)XMutex_Acquire(InstancePtr, MutexNumber);
+	State = XMutex_ReadUser(InstancePtr, MutexNumber);
+	if ((State & XMU_RW_READERS_MASK) != 0U) {
+		XMutex_WriteUser(InstancePtr, MutexNumber, State - 1U);
+	}
+	(void)XMutex_Unlock(InstancePtr, MutexNumber);
+}
+
+/*****************************************************************************/
+/**
+*
+* Acquires a reader/writer lock for writing. The call blocks until no reader
+* or writer holds the lock. While waiting, the writer marks itself pending so
+* that no new readers are admitted.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MutexNumber is the Mutex holding the reader/writer lock.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMutex_WriteLock(XMutex *InstancePtr, u8 MutexNumber)
+{
+	u32 State;
+	u32 Backoff;
+	u32 Retries = 0U;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(MutexNumber < InstancePtr->Config.NumMutex);
+	Xil_AssertVoid(InstancePtr->Config.UserReg != 0U);
+
+	Backoff = InstancePtr->BackoffMin;
+	while (1) {
+		Retries += XMutex_Acquire(InstancePtr, MutexNumber);
+		State = XMutex_ReadUser(InstancePtr, MutexNumber);
+		if ((State & (XMU_RW_WRITER_BIT | XMU_RW_READERS_MASK)) == 0U) {
+			XMutex_WriteUser(InstancePtr, MutexNumber,
+				(State & ~XMU_RW_PENDING_BIT) |
+				XMU_RW_WRITER_BIT);
+			(void)XMutex_Unlock(InstancePtr, MutexNumber);
+			break;
+		}
+		XMutex_WriteUser(InstancePtr, MutexNumber,
+				State | XMU_RW_PENDING_BIT);
+		(void)XMutex_Unlock(InstancePtr, MutexNumber);
+
+		XMutex_Backoff(InstancePtr, &Backoff);
+		Retries++;
+	}
+
+	XMutex_Account(InstancePtr, Retries);
+}
+
+/*****************************************************************************/
+/**
+*
+* Releases a reader/writer lock acquired with XMutex_WriteLock.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MutexNumber is the Mutex holding the reader/writer lock.
+*
+* @return	None.
+*
+* @note		The pending flag of other waiting writers is preserved.
+*
+******************************************************************************/
+void XMutex_WriteUnlock(XMutex *InstancePtr, u8 MutexNumber)
+{
+	u32 State;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(MutexNumber < InstancePtr->Config.NumMutex);
+
+	(void)XMutex_Acquire(InstancePtr, MutexNumber);
+	State = XMutex_ReadUser(InstancePtr, MutexNumber);
+	XMutex_WriteUser(InstancePtr, MutexNumber, State & ~XMU_RW_WRITER_BIT);
+	(void)XMutex_Unlock(InstancePtr, MutexNumber);
+}
+
+/*****************************************************************************/
+/**
+*
+* Gets the contention statistics of the lock functions in this file.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	StatsPtr is a pointer to the structure the statistics are
+*		copied to.
+*
+* @return	None.
+*
+* @note		The statistics only cover locks taken through this instance.
+*
+******************************************************************************/
+void XMutex_GetStats(XMutex *InstancePtr, XMutex_Stats *StatsPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	memcpy(StatsPtr, &InstancePtr->Stats, sizeof(XMutex_Stats));
+}
+
+/*****************************************************************************/
+/**
+*
+* Clears the contention statistics of the instance.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMutex_ResetStats(XMutex *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	memset(&InstancePtr->Stats, 0, sizeof(XMutex_Stats));
+}
+
+/*****************************************************************************/
+/**
+*
+* Busy waits for the given number of loop iterations without accessing the
+* interconnect.
+*
+* @param	Count is the number of loop iterations.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XMutex_Delay(u32 Count)
+{
+	volatile u32 Index;
+
+	for (Index = 0U; Index < Count; Index++) {
+		;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Waits for a randomized delay between half and all of the current backoff
+* and doubles the backoff up to the configured maximum. The randomization
+* keeps processors that failed at the same time from retrying in lock step.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	BackoffPtr is a pointer to the current backoff, updated by this
+*		function.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XMutex_Backoff(XMutex *InstancePtr, u32 *BackoffPtr)
+{
+	u32 Half = *BackoffPtr >> 1;
+
+	InstancePtr->Seed = (InstancePtr->Seed * 1664525U) + 1013904223U;
+	XMutex_Delay(Half + ((InstancePtr->Seed >> 16) %
+				(*BackoffPtr - Half + 1U)));
+
+	if (*BackoffPtr < (InstancePtr->BackoffMax >> 1)) {
+		*BackoffPtr <<= 1;
+	} else {
+		*BackoffPtr = InstancePtr->BackoffMax;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Locks a Mutex, reading the Mutex register until it is seen free before
+* issuing the lock write and backing off after every failed attempt.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	MutexNumber is the Mutex to lock.
+*
+* @return	The number of failed attempts.
+*
+* @note		As with XMutex_Lock, a Mutex already owned by this CPU is
+*		returned immediately.
+*
+******************************************************************************/
+static u32 XMutex_Acquire(XMutex *InstancePtr, u8 MutexNumber)
+{
+	u32 LockPattern = ((XPAR_CPU_ID << OWNER_SHIFT) | LOCKED_BIT);
+	u32 Backoff = InstancePtr->BackoffMin;
+	u32 Retries = 0U;
+	u32 Value;
+
+	while (1) {
+		Value = XMutex_ReadReg(InstancePtr->Config.BaseAddress,
+					MutexNumber, XMU_MUTEX_REG_OFFSET);
+		if ((Value & LOCKED_BIT) == 0U) {
+			XMutex_WriteReg(InstancePtr->Config.BaseAddress,
+					MutexNumber, XMU_MUTEX_REG_OFFSET,
+					LockPattern);
+			Value = XMutex_ReadReg(InstancePtr->Config.BaseAddress,
+						MutexNumber,
+						XMU_MUTEX_REG_OFFSET);
+		}
+		if (Value == LockPattern) {
+			break;
+		}
+
+		XMutex_Backoff(InstancePtr, &Backoff);
+		Retries++;
+	}
+
+	return Retries;
+}
+
+/*****************************************************************************/
+/**
+*
+* Updates the contention statistics after a lock was obtained.
+*
+* @param	InstancePtr is a pointer to the XMutex instance to be worked on.
+* @param	Retries is the number of failed attempts made for the lock.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XMutex_Account(XMutex *InstancePtr, u32 Retries)
+{
+	InstancePtr->Stats.Acquisitions++;
+	if (Retries != 0U) {
+		InstancePtr->Stats.Contended++;
+		InstancePtr->Stats.Retries += Retries;
+		if (Retries > InstancePtr->Stats.MaxRetries) {
+			InstancePtr->Stats.MaxRetries = Retries;
+		}
+	}
+}
+/** @} */
@@ -103,6 +103,14 @@
 * 1.2	nsk    01/19/17    Fix for the failure of reading nand first redundant
 * 	                   parameter page. CR#966603
 * 1,3	nsk    08/14/17    Added CCI support
+* 1.3   ag     10/14/26    Added cache read, cache program and multi-plane
+*			   program/erase support to XNandPsu_Read(),
+*			   XNandPsu_Write() and XNandPsu_Erase().
+*       ag     10/14/26    Translate blocks through the RAM based logical to
+*			   physical block map in XNandPsu_Read() and
+*			   XNandPsu_Write().
+*       ag     10/14/26    XNandPsu_PollRegTimeout() polls with a growing
+*			   delay using Xil_poll_timeout_backoff.
 *
 * </pre>
 *
@@ -181,10 +189,24 @@ static s32 XNandPsu_OnfiReadParamPage(XNandPsu *InstancePtr, u32 Target,
 						u8 *Buf);
 
 static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf);
+						u32 Col, u8 *Buf, u8 Cmd2);
 
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf);
+						u32 Col, u8 *Buf, u32 ProgMask);
+
+static u32 XNandPsu_CachePages(XNandPsu *InstancePtr, u32 Page, u64 Length);
+
+static s32 XNandPsu_ProgramCache(XNandPsu *InstancePtr, u32 Target, u32 Page,
+						u32 NumPages, u8 *Buf);
+
+static s32 XNandPsu_ProgramMultiPlane(XNandPsu *InstancePtr, u32 Target,
+						u32 Page, u8 *Buf);
+
+static s32 XNandPsu_ReadCache(XNandPsu *InstancePtr, u32 Target, u32 Page,
+						u32 NumPages, u8 *Buf);
+
+static s32 XNandPsu_EraseBlockCmd(XNandPsu *InstancePtr, u32 Target,
+						u32 Block, u8 Cmd2);
 
 static s32 XNandPsu_CheckOnDie(XNandPsu *InstancePtr, OnfiParamPage *Param);
 
@@ -531,6 +553,16 @@ static void XNandPsu_InitFeatures(XNandPsu *InstancePtr, OnfiParamPage *Param)
 								1U : 0U;
 	InstancePtr->Features.ExtPrmPage = ((Param->Features & (1U << 7)) != 0U) ?
 								1U : 0U;
+	InstancePtr->Features.CacheProg = ((Param->OptionalCmds & (1U << 0)) != 0U) ?
+								1U : 0U;
+	InstancePtr->Features.CacheRead = ((Param->OptionalCmds & (1U << 1)) != 0U) ?
+								1U : 0U;
+	/*
+	 * Multi-plane program and erase are only used on pairs of even/odd
+	 * blocks, which differ in the plane address bit alone.
+	 */
+	InstancePtr->Features.MultiPlane = (((Param->Features & (1U << 3)) != 0U) &&
+					(Param->PlaneAddrBits != 0U)) ? 1U : 0U;
 }
 
 /*****************************************************************************/
@@ -728,7 +760,7 @@ void XNandPsu_DisableEccMode(XNandPsu *InstancePtr)
 * @param	InstancePtr is a pointer to the XNandPsu instance.
 * @param	RegOffset is the offset of register.
 * @param	Mask is the bitmask.
-* @param	Timeout is the timeout value.
+* @param	Timeout is the timeout value, in microseconds.
 *
 * @return
 *		- XST_SUCCESS if successful.
@@ -741,22 +773,15 @@ static s32 XNandPsu_PollRegTimeout(XNandPsu *InstancePtr, u32 RegOffset,
 					u32 Mask, u32 Timeout)
 {
 	s32 Status = XST_FAILURE;
-	volatile u32 RegVal;
-	u32 TimeoutVar = Timeout;
-
-	while (TimeoutVar > 0U) {
-		RegVal = XNandPsu_ReadReg(InstancePtr->Config.BaseAddress,
-						RegOffset) & Mask;
-		if (RegVal != 0U) {
-			break;
-		}
-		TimeoutVar--;
-		usleep(1);
-	}
+	u32 RegVal;
 
-	if (TimeoutVar <= 0U) {
-		Status = XST_FAILURE;
-	} else {
+	/*
+	 * Poll with a growing delay, so that short operations complete
+	 * quickly and long ones (erase, program) do not spin on the register.
+	 */
+	if (Xil_poll_timeout_backoff(Xil_In32,
+			InstancePtr->Config.BaseAddress + RegOffset, RegVal,
+			(RegVal & Mask) != 0U, Timeout) == 0) {
 		Status = XST_SUCCESS;
 	}
 
@@ -1280,33 +1305,24 @@ static s32 XNandPsu_OnfiReadParamPage(XNandPsu *InstancePtr, u32 Target,
 static s32 XNandPsu_CalculateLength(XNandPsu *InstancePtr, u64 Offset,
 							u64 Length)
 {
-	s32 Status;
-	u32 BlockSize;
-	u32 BlockLen;
-	u32 Block;
-	u64 TempLen = 0;
-	u64 OffsetVar = Offset;
-
-	BlockSize = InstancePtr->Geometry.BlockSize;
+	s32 Status = XST_SUCCESS;
+	u32 BlockSize = InstancePtr->Geometry.BlockSize;
+	u32 Logical;
+	u64 NumBlocks;
 
-	while (TempLen < Length) {
-		Block = (u32)(OffsetVar/BlockSize);
-		BlockLen = BlockSize - (u32)(OffsetVar % BlockSize);
-		if (OffsetVar >= InstancePtr->Geometry.DeviceSize) {
-			Status = XST_FAILURE;
-			goto Out;
-		}
-		/* Check if the block is bad */
-		Status = XNandPsu_IsBlockBad(InstancePtr, Block);
-		if (Status != XST_SUCCESS) {
-			/* Good block */
-			TempLen += BlockLen;
-		}
-		OffsetVar += BlockLen;
+	/*
+	 * Bad blocks are skipped keeping the offset within the block, so the
+	 * transfer needs this many good blocks from the first good block at
+	 * or after Offset.
+	 */
+	NumBlocks = ((Offset % BlockSize) + Length + BlockSize - 1U) /
+								BlockSize;
+	Logical = XNandPsu_GetLogicalBlock(InstancePtr,
+						(u32)(Offset / BlockSize));
+	if (((u64)Logical + NumBlocks) > (u64)InstancePtr->NumGoodBlocks) {
+		Status = XST_FAILURE;
 	}
 
-	Status = XST_SUCCESS;
-Out:
 	return Status;
 }
 
@@ -1336,7 +1352,10 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 	u32 Block;
 	u32 PartialBytes = 0;
 	u32 NumBytes;
+	u32 NumPages;
 	u32 RemLen;
+	u32 Logical;
+	u32 PhysBlock;
 	u8 *BufPtr;
 	u8 *SrcBufPtr = (u8 *)SrcBuf;
 	u64 OffsetVar = Offset;
@@ -1359,15 +1378,23 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 		goto Out;
 	}
 
+	Logical = XNandPsu_GetLogicalBlock(InstancePtr,
+			(u32)(OffsetVar/InstancePtr->Geometry.BlockSize));
+
 	while (LengthVar > 0U) {
 		Block = (u32) (OffsetVar/InstancePtr->Geometry.BlockSize);
+		while (XNandPsu_PhysicalBlock(InstancePtr, Logical) < Block) {
+			Logical++;
+		}
 		/*
-		 * Skip the bad blocks. Increment the offset by block size.
+		 * Skip the bad blocks up to the next good block in the map.
 		 * For better results, always program the flash starting at
 		 * a block boundary.
 		 */
-		if (XNandPsu_IsBlockBad(InstancePtr, Block) == XST_SUCCESS) {
-			OffsetVar += (u64)InstancePtr->Geometry.BlockSize;
+		PhysBlock = XNandPsu_PhysicalBlock(InstancePtr, Logical);
+		if (PhysBlock != Block) {
+			OffsetVar += (u64)(PhysBlock - Block) *
+					(u64)InstancePtr->Geometry.BlockSize;
 			continue;
 		}
 		/* Calculate Page and Column address values */
@@ -1406,13 +1433,33 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 					InstancePtr->Geometry.BytesPerPage :
 					(u32)LengthVar;
 		}
-		/* Program page */
-		Status = XNandPsu_ProgramPage(InstancePtr, Target, Page, 0U,
-								BufPtr);
-		if (Status != XST_SUCCESS)
-			goto Out;
-
-		Status = XNandPsu_Device_Ready(InstancePtr, Target);
+		NumPages = XNandPsu_CachePages(InstancePtr, Page, LengthVar);
+
+		if ((InstancePtr->Features.MultiPlane != 0U) &&
+			((OffsetVar % InstancePtr->Geometry.BlockSize) == 0U) &&
+			((Block & 1U) == 0U) &&
+			(LengthVar >= (2U * (u64)InstancePtr->Geometry.BlockSize)) &&
+			(XNandPsu_PhysicalBlock(InstancePtr, Logical + 1U) ==
+							(Block + 1U))) {
+			/* Program this block and the next one side by side */
+			Status = XNandPsu_ProgramMultiPlane(InstancePtr, Target,
+							Page, SrcBufPtr);
+			NumBytes = 2U * InstancePtr->Geometry.BlockSize;
+		} else if ((InstancePtr->Features.CacheProg != 0U) &&
+				(PartialBytes == 0U) && (NumPages > 1U)) {
+			/* Program the rest of the block through the cache */
+			Status = XNandPsu_ProgramCache(InstancePtr, Target,
+						Page, NumPages, SrcBufPtr);
+			NumBytes = NumPages * InstancePtr->Geometry.BytesPerPage;
+		} else {
+			/* Program page */
+			Status = XNandPsu_ProgramPage(InstancePtr, Target, Page,
+					0U, BufPtr, ONFI_CMD_PG_PROG2);
+			if (Status == XST_SUCCESS) {
+				Status = XNandPsu_Device_Ready(InstancePtr,
+								Target);
+			}
+		}
 		if (Status != XST_SUCCESS)
 			goto Out;
 
@@ -1452,6 +1499,9 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 	u32 PartialBytes = 0U;
 	u32 RemLen;
 	u32 NumBytes;
+	u32 NumPages;
+	u32 Logical;
+	u32 PhysBlock;
 	u8 *BufPtr;
 	u8 *DestBufPtr = (u8 *)DestBuf;
 	u64 OffsetVar = Offset;
@@ -1473,15 +1523,23 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 		goto Out;
 	}
 
+	Logical = XNandPsu_GetLogicalBlock(InstancePtr,
+			(u32)(OffsetVar/InstancePtr->Geometry.BlockSize));
+
 	while (LengthVar > 0U) {
 		Block = (u32)(OffsetVar/InstancePtr->Geometry.BlockSize);
+		while (XNandPsu_PhysicalBlock(InstancePtr, Logical) < Block) {
+			Logical++;
+		}
 		/*
-		 * Skip the bad block. Increment the offset by block size.
+		 * Skip the bad blocks up to the next good block in the map.
 		 * The flash programming utility must make sure to start
 		 * writing always at a block boundary and skip blocks if any.
 		 */
-		if (XNandPsu_IsBlockBad(InstancePtr, Block) == XST_SUCCESS) {
-			OffsetVar += (u64)InstancePtr->Geometry.BlockSize;
+		PhysBlock = XNandPsu_PhysicalBlock(InstancePtr, Logical);
+		if (PhysBlock != Block) {
+			OffsetVar += (u64)(PhysBlock - Block) *
+					(u64)InstancePtr->Geometry.BlockSize;
 			continue;
 		}
 		/* Calculate Page and Column address values */
@@ -1515,9 +1573,19 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 					InstancePtr->Geometry.BytesPerPage :
 					(u32)LengthVar;
 		}
-		/* Read page */
-		Status = XNandPsu_ReadPage(InstancePtr, Target, Page, 0U,
-								BufPtr);
+		NumPages = XNandPsu_CachePages(InstancePtr, Page, LengthVar);
+
+		if ((InstancePtr->Features.CacheRead != 0U) &&
+				(PartialBytes == 0U) && (NumPages > 1U)) {
+			/* Stream the rest of the block through the cache */
+			Status = XNandPsu_ReadCache(InstancePtr, Target, Page,
+						NumPages, DestBufPtr);
+			NumBytes = NumPages * InstancePtr->Geometry.BytesPerPage;
+		} else {
+			/* Read page */
+			Status = XNandPsu_ReadPage(InstancePtr, Target, Page,
+					0U, BufPtr, XNANDPSU_PROG_RD_MASK);
+		}
 		if (Status != XST_SUCCESS) {
 			goto Out;
 		}
@@ -1617,6 +1685,25 @@ s32 XNandPsu_Erase(XNandPsu *InstancePtr, u64 Offset, u64 Length)
 		if (XNandPsu_IsBlockBad(InstancePtr, Block) ==
 							XST_SUCCESS)
 			continue;
+		/*
+		 * Queue the even block of a good pair with the multi-plane
+		 * erase command, the odd one then starts both erases.
+		 */
+		if ((InstancePtr->Features.MultiPlane != 0U) &&
+			((Block & 1U) == 0U) &&
+			((Block + 1U) < (StartBlock + NumBlocks)) &&
+			(XNandPsu_IsBlockBad(InstancePtr, Block + 1U) !=
+							XST_SUCCESS)) {
+			Status = XNandPsu_EraseBlockCmd(InstancePtr, Target,
+					Block, ONFI_CMD_MUL_BLK_ERASE2);
+			if (Status != XST_SUCCESS)
+				goto Out;
+
+			Status = XNandPsu_Device_Ready(InstancePtr, Target);
+			if (Status != XST_SUCCESS)
+				goto Out;
+			Block++;
+		}
 		/* Block Erase */
 		Status = XNandPsu_EraseBlock(InstancePtr, Target, Block);
 		if (Status != XST_SUCCESS)
@@ -1641,6 +1728,9 @@ Out:
 * @param	Page is the page address value to program.
 * @param	Col is the column address value to program.
 * @param	Buf is the data buffer to program.
+* @param	Cmd2 is the confirm command, ONFI_CMD_PG_PROG2 for a plain page
+*		program, ONFI_CMD_PG_CACHE_PROG2 for cache program or
+*		ONFI_CMD_MUL_PG_PROG2 to queue a multi-plane page.
 *
 * @return
 *		- XST_SUCCESS if successful.
@@ -1650,7 +1740,7 @@ Out:
 *
 ******************************************************************************/
 static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf)
+						u32 Col, u8 *Buf, u8 Cmd2)
 {
 	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
 				InstancePtr->Geometry.ColAddrCycles;
@@ -1670,7 +1760,7 @@ static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage/PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_PG_PROG1, ONFI_CMD_PG_PROG2,
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_PG_PROG1, Cmd2,
 					1U, 1U, (u8)AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
@@ -1709,6 +1799,131 @@ static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function returns the number of whole pages that can be transferred
+* from the given page onwards without leaving its block.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Page is the first page of the transfer.
+* @param	Length is the number of bytes left to transfer.
+*
+* @return	Number of whole pages.
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XNandPsu_CachePages(XNandPsu *InstancePtr, u32 Page, u64 Length)
+{
+	u32 PagesLeft = InstancePtr->Geometry.PagesPerBlock -
+			(Page % InstancePtr->Geometry.PagesPerBlock);
+	u64 NumPages = Length / InstancePtr->Geometry.BytesPerPage;
+
+	return (NumPages < (u64)PagesLeft) ? (u32)NumPages : PagesLeft;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs consecutive pages of a block with the ONFI Page
+* Cache Program command. Each page is confirmed with 15h so the flash moves
+* it from the cache register to the page register and starts the array
+* program, while the next page is transferred from memory. The last page is
+* confirmed with 10h.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page to program.
+* @param	NumPages is the number of pages to program.
+* @param	Buf is the data buffer to program.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		All pages must be in the same block.
+*
+******************************************************************************/
+static s32 XNandPsu_ProgramCache(XNandPsu *InstancePtr, u32 Target, u32 Page,
+						u32 NumPages, u8 *Buf)
+{
+	s32 Status = XST_FAILURE;
+	u32 Index;
+	u8 Cmd2;
+
+	for (Index = 0U; Index < NumPages; Index++) {
+		Cmd2 = (Index == (NumPages - 1U)) ? ONFI_CMD_PG_PROG2 :
+						ONFI_CMD_PG_CACHE_PROG2;
+		Status = XNandPsu_ProgramPage(InstancePtr, Target, Page + Index,
+			0U, Buf + (Index * InstancePtr->Geometry.BytesPerPage),
+			Cmd2);
+		if (Status != XST_SUCCESS)
+			goto Out;
+
+		/* Wait until the cache register is free again */
+		Status = XNandPsu_Device_Ready(InstancePtr, Target);
+		if (Status != XST_SUCCESS)
+			goto Out;
+	}
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs an even block and the following odd block together
+* with the ONFI Multi-plane Page Program command. For every page the even
+* block page is queued with 11h and the odd block page starts the program of
+* both planes with 10h.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page of the even block.
+* @param	Buf holds two blocks of data, even block first.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		Both blocks must be good.
+*
+******************************************************************************/
+static s32 XNandPsu_ProgramMultiPlane(XNandPsu *InstancePtr, u32 Target,
+						u32 Page, u8 *Buf)
+{
+	u32 PagesPerBlock = InstancePtr->Geometry.PagesPerBlock;
+	u32 BytesPerPage = InstancePtr->Geometry.BytesPerPage;
+	s32 Status = XST_FAILURE;
+	u32 Index;
+
+	for (Index = 0U; Index < PagesPerBlock; Index++) {
+		Status = XNandPsu_ProgramPage(InstancePtr, Target, Page + Index,
+				0U, Buf + (Index * BytesPerPage),
+				ONFI_CMD_MUL_PG_PROG2);
+		if (Status != XST_SUCCESS)
+			goto Out;
+
+		Status = XNandPsu_Device_Ready(InstancePtr, Target);
+		if (Status != XST_SUCCESS)
+			goto Out;
+
+		Status = XNandPsu_ProgramPage(InstancePtr, Target,
+				Page + PagesPerBlock + Index, 0U,
+				Buf + InstancePtr->Geometry.BlockSize +
+				(Index * BytesPerPage), ONFI_CMD_PG_PROG2);
+		if (Status != XST_SUCCESS)
+			goto Out;
+
+		Status = XNandPsu_Device_Ready(InstancePtr, Target);
+		if (Status != XST_SUCCESS)
+			goto Out;
+	}
+Out:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1860,6 +2075,10 @@ Out:
 * @param	Page is the page address value to read.
 * @param	Col is the column address value to read.
 * @param	Buf is the data buffer to fill in.
+* @param	ProgMask is XNANDPSU_PROG_RD_MASK for a page read, or
+*		XNANDPSU_PROG_RD_CACHE_SEQ_MASK/XNANDPSU_PROG_RD_CACHE_END_MASK
+*		to fetch the next page of a cache read started by
+*		XNandPsu_ReadCache().
 *
 * @return
 *		- XST_SUCCESS if successful.
@@ -1869,10 +2088,12 @@ Out:
 *
 ******************************************************************************/
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf)
+						u32 Col, u8 *Buf, u32 ProgMask)
 {
 	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
 				InstancePtr->Geometry.ColAddrCycles;
+	u8 Cmd1 = ONFI_CMD_RD1;
+	u8 Cmd2 = ONFI_CMD_RD2;
 	u32 PktSize;
 	u32 PktCount;
 	s32 Status = XST_FAILURE;
@@ -1889,8 +2110,18 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage/PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
-					1U, 1U, (u8)AddrCycles);
+	/* Cache read commands take no address */
+	if (ProgMask == XNANDPSU_PROG_RD_CACHE_SEQ_MASK) {
+		Cmd1 = ONFI_CMD_RD_CACHE_SEQ;
+		Cmd2 = ONFI_CMD_INVALID;
+		AddrCycles = 0U;
+	} else if (ProgMask == XNANDPSU_PROG_RD_CACHE_END_MASK) {
+		Cmd1 = ONFI_CMD_RD_CACHE_END;
+		Cmd2 = ONFI_CMD_INVALID;
+		AddrCycles = 0U;
+	}
+
+	XNandPsu_Prepare_Cmd(InstancePtr, Cmd1, Cmd2, 1U, 1U, (u8)AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
 		RegVal = XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK |
@@ -1927,7 +2158,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 
 	/* Set Read command in Program Register */
 	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
-				XNANDPSU_PROG_OFFSET,XNANDPSU_PROG_RD_MASK);
+				XNANDPSU_PROG_OFFSET, ProgMask);
 
 	Status = XNandPsu_Data_ReadWrite(InstancePtr, Buf, PktCount, PktSize, 0, 1);
 
@@ -1980,6 +2211,69 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function reads consecutive pages of a block with the ONFI Read Cache
+* Sequential command. The first page is loaded with 00h-30h, then every 31h
+* moves the loaded page to the cache register and starts the array read of
+* the next page while the current one is transferred to memory. The last
+* page is fetched with 3Fh.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page to read.
+* @param	NumPages is the number of pages to read.
+* @param	Buf is the data buffer to fill in.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		All pages must be in the same block.
+*
+******************************************************************************/
+static s32 XNandPsu_ReadCache(XNandPsu *InstancePtr, u32 Target, u32 Page,
+						u32 NumPages, u8 *Buf)
+{
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+				InstancePtr->Geometry.ColAddrCycles;
+	s32 Status = XST_FAILURE;
+	u32 ProgMask;
+	u32 Index;
+
+	/* Load the first page into the page register */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_INTR_STS_EN_OFFSET,
+			XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK);
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
+					0U, 0U, (u8)AddrCycles);
+	XNandPsu_SetPageColAddr(InstancePtr, Page, 0U);
+	XNandPsu_SelectChip(InstancePtr, Target);
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_PROG_OFFSET, XNANDPSU_PROG_RD_CACHE_START_MASK);
+	Status = XNandPsu_WaitFor_Transfer_Complete(InstancePtr);
+	if (Status != XST_SUCCESS)
+		goto Out;
+
+	for (Index = 0U; Index < NumPages; Index++) {
+		ProgMask = (Index == (NumPages - 1U)) ?
+				XNANDPSU_PROG_RD_CACHE_END_MASK :
+				XNANDPSU_PROG_RD_CACHE_SEQ_MASK;
+		Status = XNandPsu_ReadPage(InstancePtr, Target, Page + Index,
+			0U, Buf + (Index * InstancePtr->Geometry.BytesPerPage),
+			ProgMask);
+		if (Status != XST_SUCCESS) {
+			/* Leave cache mode so that the next command is taken */
+			if (ProgMask != XNANDPSU_PROG_RD_CACHE_END_MASK)
+				(void)XNandPsu_OnfiReset(InstancePtr, Target);
+			goto Out;
+		}
+	}
+Out:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -2066,18 +2360,44 @@ s32 XNandPsu_ReadSpareBytes(XNandPsu *InstancePtr, u32 Page, u8 *Buf)
 ******************************************************************************/
 s32 XNandPsu_EraseBlock(XNandPsu *InstancePtr, u32 Target, u32 Block)
 {
-	s32 Status = XST_FAILURE;
-	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles;
-	u32 Page;
-	u32 ErasePage;
-	u32 EraseCol;
-
 	/* Assert the input arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 	Xil_AssertNonvoid(Target < XNANDPSU_MAX_TARGETS);
 	Xil_AssertNonvoid(Block < InstancePtr->Geometry.NumBlocks);
 
+	return XNandPsu_EraseBlockCmd(InstancePtr, Target, Block,
+						ONFI_CMD_BLK_ERASE2);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends an ONFI block erase command with the given confirm
+* cycle to the flash.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Block is the block to erase.
+* @param	Cmd2 is ONFI_CMD_BLK_ERASE2 to start the erase or
+*		ONFI_CMD_MUL_BLK_ERASE2 to queue a multi-plane erase.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_EraseBlockCmd(XNandPsu *InstancePtr, u32 Target,
+						u32 Block, u8 Cmd2)
+{
+	s32 Status = XST_FAILURE;
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles;
+	u32 Page;
+	u32 ErasePage;
+	u32 EraseCol;
+
 	Page = Block * InstancePtr->Geometry.PagesPerBlock;
 	ErasePage = (Page >> 16U) & 0xFFFFU;
 	EraseCol = Page & 0xFFFFU;
@@ -2092,7 +2412,7 @@ s32 XNandPsu_EraseBlock(XNandPsu *InstancePtr, u32 Target, u32 Block)
 
 	/* Program Command */
 	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_BLK_ERASE1,
-			ONFI_CMD_BLK_ERASE2, 0U , 0U, (u8)AddrCycles);
+			Cmd2, 0U , 0U, (u8)AddrCycles);
 	/* Program Column, Page, Block address */
 	XNandPsu_SetPageColAddr(InstancePtr, ErasePage, (u16)EraseCol);
 	/* Program Memory Address Register2 for chip select */
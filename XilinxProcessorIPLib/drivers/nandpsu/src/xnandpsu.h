@@ -78,7 +78,10 @@
 * the number of bytes specified from the offset exceed flash boundaries
 * an error is reported back to the user. The write is blocking in nature in that
 * the control is returned back to user only after the write operation is
-* completed successfully or an error is reported.
+* completed successfully or an error is reported. Whole pages are programmed
+* with the page cache program command if the flash supports it, and whole
+* even/odd block pairs with multi-plane page program, so that the transfer of
+* a page overlaps the array program of the previous one.
 *
 * <b>Read Operation</b>
 *
@@ -87,7 +90,10 @@
 * the number of bytes specified from the offset exceed flash boundaries
 * an error is reported back to the user. The read is blocking in nature in that
 * the control is returned back to user only after the read operation is
-* completed successfully or an error is reported.
+* completed successfully or an error is reported. Runs of whole pages within
+* a block are read with the read cache sequential command if the flash
+* supports it, so that the array read of the next page overlaps the transfer
+* of the current one.
 *
 * <b>Erase Operation</b>
 *
@@ -167,6 +173,10 @@
 *       ms     04/10/17    Modified Comment lines in nandpsu_example.c to
 *                          follow doxygen rules.
 * 1.2	nsk    08/08/17    Added support to import example in SDK
+* 1.3   ag     10/14/26    Added cache read, cache program and multi-plane
+*			   program/erase support.
+*       ag     10/14/26    Added logical to physical block map to the
+*			   instance.
 *
 * </pre>
 *
@@ -343,6 +353,9 @@ typedef struct {
 	u32 EzNand;
 	u32 OnDie;
 	u32 ExtPrmPage;
+	u32 CacheRead;		/**< Read cache commands supported */
+	u32 CacheProg;		/**< Page cache program supported */
+	u32 MultiPlane;		/**< Multi-plane program and erase supported */
 } XNandPsu_Features;
 
 /**
@@ -395,6 +408,9 @@ typedef struct {
 	XNandPsu_BadBlockPattern BbPattern;	/**< Bad block pattern to
 						  search */
 	u8 Bbt[XNANDPSU_MAX_BLOCKS >> 2];	/**< Bad block table array */
+	u16 BlockMap[XNANDPSU_MAX_BLOCKS];	/**< Logical to physical block
+						  map of the good blocks */
+	u32 NumGoodBlocks;		/**< Number of valid BlockMap entries */
 } XNandPsu;
 
 /******************* Macro Definitions (Inline Functions) *******************/
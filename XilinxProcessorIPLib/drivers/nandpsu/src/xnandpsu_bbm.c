@@ -53,6 +53,9 @@
 *			   Oob and No-Oob region.
 * 1.1	nsk    11/07/16    Change memcpy to Xil_MemCpy to handle word aligned
 *	                   data access.
+* 1.3   ag     10/14/26    Added logical to physical block map built by
+*			   XNandPsu_ScanBbt and updated by
+*			   XNandPsu_MarkBlockBad.
 * </pre>
 *
 ******************************************************************************/
@@ -88,6 +91,8 @@ static s32 XNandPsu_MarkBbt(XNandPsu* InstancePtr, XNandPsu_BbtDesc *Desc,
 
 static s32 XNandPsu_UpdateBbt(XNandPsu *InstancePtr, u32 Target);
 
+static void XNandPsu_BuildBlockMap(XNandPsu *InstancePtr);
+
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
@@ -284,12 +289,15 @@ s32 XNandPsu_ScanBbt(XNandPsu *InstancePtr)
 	BbtLen = InstancePtr->Geometry.NumBlocks >>
 					XNANDPSU_BBT_BLOCK_SHIFT;
 	(void)memset(&InstancePtr->Bbt[0], 0, BbtLen);
+	/* The BBT is read and written through the block map */
+	XNandPsu_BuildBlockMap(InstancePtr);
 
 	for (Index = 0U; Index < InstancePtr->Geometry.NumTargets; Index++) {
 
 		if (XNandPsu_ReadBbt(InstancePtr, Index) != XST_SUCCESS) {
 			/* Create memory based Bad Block Table(BBT) */
 			XNandPsu_CreateBbt(InstancePtr, Index);
+			XNandPsu_BuildBlockMap(InstancePtr);
 			/* Write the Bad Block Table(BBT) to the flash */
 			Status = XNandPsu_WriteBbt(InstancePtr,
 					&InstancePtr->BbtDesc,
@@ -323,11 +331,44 @@ s32 XNandPsu_ScanBbt(XNandPsu *InstancePtr)
 		}
 	}
 
+	XNandPsu_BuildBlockMap(InstancePtr);
+
 	Status = XST_SUCCESS;
 Out:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* This function builds the logical to physical block map from the RAM based
+* Bad Block Table(BBT). Entry N of the map holds the physical block number of
+* the N-th block which is not bad.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+*
+* @return
+*		- NONE
+*
+******************************************************************************/
+static void XNandPsu_BuildBlockMap(XNandPsu *InstancePtr)
+{
+	u32 NumBlocks = InstancePtr->Geometry.NumBlocks;
+	u32 Block;
+	u32 Logical = 0U;
+
+	if (NumBlocks > XNANDPSU_MAX_BLOCKS) {
+		NumBlocks = XNANDPSU_MAX_BLOCKS;
+	}
+
+	for (Block = 0U; Block < NumBlocks; Block++) {
+		if (XNandPsu_IsBlockBad(InstancePtr, Block) != XST_SUCCESS) {
+			InstancePtr->BlockMap[Logical] = (u16)Block;
+			Logical++;
+		}
+	}
+	InstancePtr->NumGoodBlocks = Logical;
+}
+
 /*****************************************************************************/
 /**
 * This function converts the Bad Block Table(BBT) read from the flash to the
@@ -859,6 +900,42 @@ s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function returns the logical block of the first block at or after the
+* given physical block which is not bad.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	Block is the physical block number.
+*
+* @return	Logical block number, InstancePtr->NumGoodBlocks if there is no
+*		good block left at or after Block.
+*
+******************************************************************************/
+u32 XNandPsu_GetLogicalBlock(XNandPsu *InstancePtr, u32 Block)
+{
+	u32 Low = 0U;
+	u32 High;
+	u32 Mid;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	/* The map is sorted, find the first entry not below Block */
+	High = InstancePtr->NumGoodBlocks;
+	while (Low < High) {
+		Mid = Low + ((High - Low) >> 1U);
+		if ((u32)InstancePtr->BlockMap[Mid] < Block) {
+			Low = Mid + 1U;
+		} else {
+			High = Mid;
+		}
+	}
+
+	return Low;
+}
+
 /*****************************************************************************/
 /**
 * This function marks a block as bad in the RAM based Bad Block Table(BBT). It
@@ -881,6 +958,7 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 	u8 NewVal;
 	s32 Status;
 	u32 Target;
+	u32 Logical;
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
@@ -892,6 +970,15 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 	BlockShift = XNandPsu_BbtBlockShift(Block);
 	Data = InstancePtr->Bbt[BlockOffset];	/* Block information in BBT */
 
+	/* Drop the block from the logical to physical block map */
+	if (XNandPsu_IsBlockBad(InstancePtr, Block) != XST_SUCCESS) {
+		Logical = XNandPsu_GetLogicalBlock(InstancePtr, Block);
+		InstancePtr->NumGoodBlocks--;
+		(void)memmove(&InstancePtr->BlockMap[Logical],
+			&InstancePtr->BlockMap[Logical + 1U],
+			(InstancePtr->NumGoodBlocks - Logical) * sizeof(u16));
+	}
+
 	/* Mark the block as bad in the RAM based Bad Block Table */
 	OldVal = Data;
 	Data &= ~(XNANDPSU_BLOCK_TYPE_MASK << BlockShift);
@@ -78,6 +78,12 @@
 * XNandPsu_IsBlockBad and take the action based on the return value. Also user
 * can update the bad block table using XNandPsu_MarkBlockBad API.
 *
+* Once the RAM based BBT is loaded, a logical to physical block map of all the
+* blocks that are not bad is built from it and kept in sync by
+* XNandPsu_MarkBlockBad. Entry N holds the physical block of the N-th usable
+* block, so the read and write paths translate a block with a single lookup.
+* XNandPsu_GetLogicalBlock gives the entry for a physical block.
+*
 * @note		None
 *
 * <pre>
@@ -90,6 +96,7 @@
 *			   in page section by enabling XNANDPSU_BBT_NO_OOB.
 *			   Modified Bbt Signature and Version Offset value for
 *			   Oob and No-Oob region.
+* 1.3   ag     10/14/26    Added logical to physical block map.
 * </pre>
 *
 ******************************************************************************/
@@ -190,6 +197,23 @@ extern "C" {
 #define XNandPsu_BbtBlockShift(Block) \
 			(u8)(((Block) * 2U) & XNANDPSU_BLOCK_SHIFT_MASK)
 
+/****************************************************************************/
+/**
+*
+* This macro returns the physical block of a logical block.
+*
+* @param        InstancePtr is a pointer to the XNandPsu instance.
+* @param        Logical is the logical block number, less than
+*		InstancePtr->NumGoodBlocks.
+*
+* @return       Physical block number
+*
+* @note         None.
+*
+*****************************************************************************/
+#define XNandPsu_PhysicalBlock(InstancePtr, Logical) \
+			((u32)(InstancePtr)->BlockMap[(Logical)])
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Prototypes ******************************/
@@ -198,6 +222,8 @@ void XNandPsu_InitBbtDesc(XNandPsu *InstancePtr);
 
 s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block);
 
+u32 XNandPsu_GetLogicalBlock(XNandPsu *InstancePtr, u32 Block);
+
 #ifdef __cplusplus
 }
 #endif
@@ -136,6 +136,8 @@
 *                           Modified xprc.c, prc.tcl, xprc_hw.h to add a
 *                           new parameter "Cp_Compression" and status error
 *                           flags. Added the Updated api.tcl to data folder.
+*       ag     10/14/26     Added the RM manager in xprc_rmmgr.c/h, which
+*                           caches RM bitstreams in DDR and swaps them in.
 * </pre>
 *
 ******************************************************************************/
@@ -0,0 +1,671 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xprc_rmmgr.c
+* @addtogroup prc_v1_1
+* @{
+*
+* This file contains the RM manager functions for the XPrc driver. Refer
+* xprc_rmmgr.h for a detailed description of the RM manager.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date         Changes
+* ---- ----- -----------  ------------------------------------------------
+* 1.1   ag   10/14/26      First release.
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xprc_rmmgr.h"
+#include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XPRC_RMMGR_NO_NEXT	(0xFF)	/**< No RM followed the RM yet */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Prototypes ******************************/
+
+static s32 XPrc_RmMgrLoad(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			u16 *SlotIdPtr);
+static s32 XPrc_RmMgrFindSlot(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			u16 *SlotIdPtr);
+static u8 XPrc_RmMgrIsSlotBusy(XPrc_RmMgr *MgrPtr, u16 SlotId);
+static s32 XPrc_RmMgrMapBitstream(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			XPrc_RmSlot *SlotPtr);
+static s32 XPrc_RmMgrGetTrigger(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			u16 *TriggerIdPtr);
+
+/****************************** Functions Definitions ************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes an RM manager instance.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	PrcPtr is a pointer to the initialized PRC instance.
+* @param	CacheAddr is the DDR address of the bitstream cache. This region
+*		should not be used by anything else.
+* @param	SlotSize is the size of each cache slot in bytes, it should be
+*		large enough for the biggest RM bitstream.
+* @param	NumSlots is the number of cache slots, up to
+*		XPRC_RMMGR_MAX_SLOTS.
+*
+* @return
+*		- XST_SUCCESS if initialization was successful.
+*		- XST_INVALID_PARAM if the cache parameters are invalid.
+*
+* @note		The RM in each VSM is taken from the VSM status when the VSM
+*		is full, otherwise it is not known until the first swap.
+*
+******************************************************************************/
+s32 XPrc_RmMgrInitialize(XPrc_RmMgr *MgrPtr, XPrc *PrcPtr, u32 CacheAddr,
+			u32 SlotSize, u16 NumSlots)
+{
+	u16 Index;
+	u32 Status;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(PrcPtr != NULL);
+	Xil_AssertNonvoid(PrcPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((NumSlots == 0) || (NumSlots > XPRC_RMMGR_MAX_SLOTS) ||
+			(SlotSize == 0) || ((SlotSize & 0x3U) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(MgrPtr, 0, sizeof(XPrc_RmMgr));
+	memset(MgrPtr->NextRm, XPRC_RMMGR_NO_NEXT, sizeof(MgrPtr->NextRm));
+
+	MgrPtr->PrcPtr = PrcPtr;
+	MgrPtr->SlotSize = SlotSize;
+	MgrPtr->NumSlots = NumSlots;
+
+	for (Index = 0; Index < NumSlots; Index++) {
+		MgrPtr->Slots[Index].Address = CacheAddr + (Index * SlotSize);
+	}
+
+	for (Index = 0; Index < XPRC_MAX_NUMBER_OF_VSMS; Index++) {
+		MgrPtr->ActiveRm[Index] = XPRC_RMMGR_NO_RM;
+		MgrPtr->PendingRm[Index] = XPRC_RMMGR_NO_RM;
+		MgrPtr->PreloadRm[Index] = XPRC_RMMGR_NO_RM;
+
+		if (Index >= XPrc_GetNumberOfVsms(PrcPtr)) {
+			continue;
+		}
+
+		Status = XPrc_ReadStatusReg(PrcPtr, Index);
+		if (XPrc_GetVsmState(NULL, Status) == XPRC_SR_STATE_FULL) {
+			MgrPtr->ActiveRm[Index] =
+				XPrc_GetRmIdFromStatus(NULL, Status);
+		}
+	}
+
+	MgrPtr->IsReady = XIL_COMPONENT_IS_READY;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function installs the handlers of the RM manager.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	HandlerType is the type of the handler to install.
+*		- XPRC_RMMGR_HANDLER_LOAD for XPrc_RmLoadHandler, which is
+*		  required.
+*		- XPRC_RMMGR_HANDLER_SHUTDOWN for XPrc_RmHookHandler.
+*		- XPRC_RMMGR_HANDLER_STARTUP for XPrc_RmHookHandler.
+*		- XPRC_RMMGR_HANDLER_DONE for XPrc_RmDoneHandler.
+* @param	FuncPtr is the pointer to the handler function.
+* @param	CallBackRef is the argument passed to the handler.
+*
+* @return
+*		- XST_SUCCESS if the handler is installed.
+*		- XST_INVALID_PARAM if HandlerType is invalid.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XPrc_RmMgrSetHandler(XPrc_RmMgr *MgrPtr, u32 HandlerType,
+			void *FuncPtr, void *CallBackRef)
+{
+	s32 Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(MgrPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	switch (HandlerType) {
+	case XPRC_RMMGR_HANDLER_LOAD:
+		MgrPtr->LoadHandler = (XPrc_RmLoadHandler)FuncPtr;
+		MgrPtr->LoadRef = CallBackRef;
+		break;
+	case XPRC_RMMGR_HANDLER_SHUTDOWN:
+		MgrPtr->ShutdownHandler = (XPrc_RmHookHandler)FuncPtr;
+		MgrPtr->ShutdownRef = CallBackRef;
+		break;
+	case XPRC_RMMGR_HANDLER_STARTUP:
+		MgrPtr->StartupHandler = (XPrc_RmHookHandler)FuncPtr;
+		MgrPtr->StartupRef = CallBackRef;
+		break;
+	case XPRC_RMMGR_HANDLER_DONE:
+		MgrPtr->DoneHandler = (XPrc_RmDoneHandler)FuncPtr;
+		MgrPtr->DoneRef = CallBackRef;
+		break;
+	default:
+		Status = XST_INVALID_PARAM;
+		break;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the bitstream of an RM into the cache without swapping
+* it in, so that a later swap to it does not wait for the load.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @param	RmId is the identifier of the Reconfigurable Module.
+*
+* @return
+*		- XST_SUCCESS if the bitstream is in the cache.
+*		- XST_FAILURE if the bitstream could not be loaded.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XPrc_RmMgrPreload(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId)
+{
+	u16 SlotId;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(MgrPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(VsmId < XPrc_GetNumberOfVsms(MgrPtr->PrcPtr));
+	Xil_AssertNonvoid(RmId < XPRC_RMMGR_MAX_RMS);
+
+	return XPrc_RmMgrLoad(MgrPtr, VsmId, RmId, &SlotId);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function drops the cached bitstream of an RM, when it is updated.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @param	RmId is the identifier of the Reconfigurable Module.
+*
+* @return	None.
+*
+* @note		A bitstream being fetched by the PRC is not dropped.
+*
+******************************************************************************/
+void XPrc_RmMgrInvalidate(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId)
+{
+	u16 SlotId;
+
+	Xil_AssertVoid(MgrPtr != NULL);
+	Xil_AssertVoid(MgrPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((XPrc_RmMgrFindSlot(MgrPtr, VsmId, RmId, &SlotId) ==
+			XST_SUCCESS) &&
+			(XPrc_RmMgrIsSlotBusy(MgrPtr, SlotId) == FALSE)) {
+		MgrPtr->Slots[SlotId].IsValid = FALSE;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts swapping an RM into a VSM. The bitstream is loaded
+* into the cache when it is not there, the shutdown hook is called for the
+* current RM and the software trigger mapped to the RM is sent.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @param	RmId is the identifier of the Reconfigurable Module.
+*
+* @return
+*		- XST_SUCCESS if the swap is started, XPrc_RmMgrPoll()
+*		  completes it.
+*		- XST_DEVICE_BUSY if a swap is in progress in the VSM.
+*		- XST_FAILURE if the bitstream could not be loaded, no trigger
+*		  is mapped to the RM or the VSM did not shut down.
+*
+* @note		When the RM is already in the VSM, the done handler is called
+*		right away.
+*
+******************************************************************************/
+s32 XPrc_RmMgrSwap(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId)
+{
+	s32 Status;
+	u16 SlotId;
+	u16 TriggerId;
+	u16 ActiveRm;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(MgrPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(VsmId < XPrc_GetNumberOfVsms(MgrPtr->PrcPtr));
+	Xil_AssertNonvoid(RmId < XPRC_RMMGR_MAX_RMS);
+
+	if (MgrPtr->PendingRm[VsmId] != XPRC_RMMGR_NO_RM) {
+		return XST_DEVICE_BUSY;
+	}
+
+	ActiveRm = MgrPtr->ActiveRm[VsmId];
+	if (ActiveRm == RmId) {
+		if (MgrPtr->DoneHandler != NULL) {
+			MgrPtr->DoneHandler(MgrPtr->DoneRef, VsmId, RmId,
+					XPRC_SR_NO_ERROR);
+		}
+		return XST_SUCCESS;
+	}
+
+	Status = XPrc_RmMgrGetTrigger(MgrPtr, VsmId, RmId, &TriggerId);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XPrc_RmMgrLoad(MgrPtr, VsmId, RmId, &SlotId);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XPrc_RmMgrMapBitstream(MgrPtr, VsmId, RmId,
+			&MgrPtr->Slots[SlotId]);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if ((ActiveRm != XPRC_RMMGR_NO_RM) &&
+			(MgrPtr->ShutdownHandler != NULL)) {
+		MgrPtr->ShutdownHandler(MgrPtr->ShutdownRef, VsmId, ActiveRm);
+	}
+
+	/* Learn the RM sequence and pick the RM to prefetch for this one */
+	if (ActiveRm != XPRC_RMMGR_NO_RM) {
+		MgrPtr->NextRm[VsmId][ActiveRm] = (u8)RmId;
+	}
+	if (MgrPtr->NextRm[VsmId][RmId] != XPRC_RMMGR_NO_NEXT) {
+		MgrPtr->PreloadRm[VsmId] = MgrPtr->NextRm[VsmId][RmId];
+	}
+
+	MgrPtr->ActiveRm[VsmId] = XPRC_RMMGR_NO_RM;
+	MgrPtr->PendingRm[VsmId] = RmId;
+
+	XPrc_SendSwTrigger(MgrPtr->PrcPtr, VsmId, TriggerId);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function completes the swaps in progress and preloads the predicted
+* RMs. It should be called periodically (or) from the PRC interrupt handler.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+*
+* @return	None.
+*
+* @note		The startup hook is called only if the new RM is loaded.
+*		The preload runs while the PRC fetches the bitstream.
+*
+******************************************************************************/
+void XPrc_RmMgrPoll(XPrc_RmMgr *MgrPtr)
+{
+	u16 VsmId;
+	u16 RmId;
+	u16 SlotId;
+	u32 Status;
+	u32 ErrorStatus;
+
+	Xil_AssertVoid(MgrPtr != NULL);
+	Xil_AssertVoid(MgrPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	for (VsmId = 0; VsmId < XPrc_GetNumberOfVsms(MgrPtr->PrcPtr);
+			VsmId++) {
+		RmId = MgrPtr->PendingRm[VsmId];
+		if (RmId != XPRC_RMMGR_NO_RM) {
+			Status = XPrc_ReadStatusReg(MgrPtr->PrcPtr, VsmId);
+			ErrorStatus = XPrc_GetVsmErrorStatus(NULL, Status);
+
+			if ((ErrorStatus == XPRC_SR_NO_ERROR) &&
+				((XPrc_GetVsmState(NULL, Status) !=
+					XPRC_SR_STATE_FULL) ||
+				(XPrc_GetRmIdFromStatus(NULL, Status) != RmId) ||
+				(XPrc_IsSwTriggerPending(MgrPtr->PrcPtr, VsmId,
+					NULL) == XPRC_SW_TRIGGER_PENDING))) {
+				/* Still fetching, overlap it with the preload */
+				if (MgrPtr->PreloadRm[VsmId] !=
+						XPRC_RMMGR_NO_RM) {
+					(void)XPrc_RmMgrLoad(MgrPtr, VsmId,
+						MgrPtr->PreloadRm[VsmId],
+						&SlotId);
+					MgrPtr->PreloadRm[VsmId] =
+						XPRC_RMMGR_NO_RM;
+				}
+				continue;
+			}
+
+			MgrPtr->PendingRm[VsmId] = XPRC_RMMGR_NO_RM;
+			if (ErrorStatus == XPRC_SR_NO_ERROR) {
+				MgrPtr->ActiveRm[VsmId] = RmId;
+				if (MgrPtr->StartupHandler != NULL) {
+					MgrPtr->StartupHandler(
+						MgrPtr->StartupRef, VsmId, RmId);
+				}
+			}
+			if (MgrPtr->DoneHandler != NULL) {
+				MgrPtr->DoneHandler(MgrPtr->DoneRef, VsmId,
+						RmId, ErrorStatus);
+			}
+		}
+
+		if (MgrPtr->PreloadRm[VsmId] != XPRC_RMMGR_NO_RM) {
+			(void)XPrc_RmMgrLoad(MgrPtr, VsmId,
+					MgrPtr->PreloadRm[VsmId], &SlotId);
+			MgrPtr->PreloadRm[VsmId] = XPRC_RMMGR_NO_RM;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for the swap in progress in a VSM to complete.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+*
+* @return
+*		- XST_SUCCESS if the new RM is loaded.
+*		- XST_FAILURE if the swap failed.
+*
+* @note		The handlers are called from XPrc_RmMgrPoll().
+*
+******************************************************************************/
+s32 XPrc_RmMgrWaitForSwap(XPrc_RmMgr *MgrPtr, u16 VsmId)
+{
+	u16 RmId;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(MgrPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(VsmId < XPrc_GetNumberOfVsms(MgrPtr->PrcPtr));
+
+	RmId = MgrPtr->PendingRm[VsmId];
+	if (RmId == XPRC_RMMGR_NO_RM) {
+		return XST_SUCCESS;
+	}
+
+	while (MgrPtr->PendingRm[VsmId] != XPRC_RMMGR_NO_RM) {
+		XPrc_RmMgrPoll(MgrPtr);
+	}
+
+	return (MgrPtr->ActiveRm[VsmId] == RmId) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gets the cache slot holding the bitstream of an RM, loading
+* it into the least recently used slot on a miss.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @param	RmId is the identifier of the Reconfigurable Module.
+* @param	SlotIdPtr is a pointer to the variable to hold the slot.
+*
+* @return
+*		- XST_SUCCESS if the bitstream is in the slot.
+*		- XST_FAILURE if there is no free slot (or) the load failed.
+*
+* @note		Slots of the bitstreams being fetched are never evicted.
+*
+******************************************************************************/
+static s32 XPrc_RmMgrLoad(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			u16 *SlotIdPtr)
+{
+	XPrc_RmSlot *SlotPtr = NULL;
+	u16 Index;
+	s32 Status;
+
+	if (XPrc_RmMgrFindSlot(MgrPtr, VsmId, RmId, SlotIdPtr) ==
+			XST_SUCCESS) {
+		MgrPtr->Slots[*SlotIdPtr].LastUse = ++MgrPtr->UseCount;
+		return XST_SUCCESS;
+	}
+
+	if (MgrPtr->LoadHandler == NULL) {
+		return XST_FAILURE;
+	}
+
+	/* Pick a free slot, otherwise the least recently used one */
+	for (Index = 0; Index < MgrPtr->NumSlots; Index++) {
+		if (XPrc_RmMgrIsSlotBusy(MgrPtr, Index) == TRUE) {
+			continue;
+		}
+		if ((SlotPtr == NULL) || (MgrPtr->Slots[Index].IsValid ==
+				FALSE) || ((SlotPtr->IsValid == TRUE) &&
+				(MgrPtr->Slots[Index].LastUse <
+				SlotPtr->LastUse))) {
+			SlotPtr = &MgrPtr->Slots[Index];
+			*SlotIdPtr = Index;
+			if (SlotPtr->IsValid == FALSE) {
+				break;
+			}
+		}
+	}
+	if (SlotPtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	SlotPtr->IsValid = FALSE;
+	Status = MgrPtr->LoadHandler(MgrPtr->LoadRef, VsmId, RmId,
+			SlotPtr->Address, MgrPtr->SlotSize, &SlotPtr->Size);
+	if ((Status != XST_SUCCESS) || (SlotPtr->Size == 0U) ||
+			(SlotPtr->Size > MgrPtr->SlotSize)) {
+		return XST_FAILURE;
+	}
+
+	/* The PRC fetches the bitstream from memory */
+	Xil_DCacheFlushRange((UINTPTR)SlotPtr->Address, SlotPtr->Size);
+
+	SlotPtr->VsmId = VsmId;
+	SlotPtr->RmId = RmId;
+	SlotPtr->LastUse = ++MgrPtr->UseCount;
+	SlotPtr->IsValid = TRUE;
+
+	xprc_printf(XPRC_DEBUG_GENERAL,"XPrc_RmMgrLoad :: VSM_ID = %x, "
+		"RmId = %x, Slot = %x, Size = %x\n\r", VsmId, RmId,
+		*SlotIdPtr, SlotPtr->Size);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up the cache slot holding the bitstream of an RM.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @param	RmId is the identifier of the Reconfigurable Module.
+* @param	SlotIdPtr is a pointer to the variable to hold the slot.
+*
+* @return
+*		- XST_SUCCESS if the bitstream is cached.
+*		- XST_FAILURE if it is not.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XPrc_RmMgrFindSlot(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			u16 *SlotIdPtr)
+{
+	u16 Index;
+
+	for (Index = 0; Index < MgrPtr->NumSlots; Index++) {
+		if ((MgrPtr->Slots[Index].IsValid == TRUE) &&
+				(MgrPtr->Slots[Index].VsmId == VsmId) &&
+				(MgrPtr->Slots[Index].RmId == RmId)) {
+			*SlotIdPtr = Index;
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function finds out whether the PRC may be fetching from a slot.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	SlotId is the slot to check.
+*
+* @return	TRUE if a swap in progress uses the slot, FALSE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static u8 XPrc_RmMgrIsSlotBusy(XPrc_RmMgr *MgrPtr, u16 SlotId)
+{
+	XPrc_RmSlot *SlotPtr = &MgrPtr->Slots[SlotId];
+
+	return ((SlotPtr->IsValid == TRUE) &&
+		(MgrPtr->PendingRm[SlotPtr->VsmId] == SlotPtr->RmId)) ?
+		TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function points the Bitstream Information registers of an RM to its
+* cache slot. The VSM is shut down for the update, which is skipped when the
+* registers already point to the slot.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @param	RmId is the identifier of the Reconfigurable Module.
+* @param	SlotPtr is a pointer to the slot holding the bitstream.
+*
+* @return
+*		- XST_SUCCESS if the registers point to the slot.
+*		- XST_FAILURE if the VSM did not shut down.
+*
+* @note		The clearing bitstreams of UltraScale devices are not cached.
+*
+******************************************************************************/
+static s32 XPrc_RmMgrMapBitstream(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			XPrc_RmSlot *SlotPtr)
+{
+	XPrc *PrcPtr = MgrPtr->PrcPtr;
+	u16 BsIndex;
+	u32 TimeOut = XPRC_RMMGR_SHUTDOWN_TIMEOUT;
+
+	BsIndex = (u16)XPrc_GetRmBsIndex(PrcPtr, VsmId, RmId);
+	if ((XPrc_GetBsAddress(PrcPtr, VsmId, BsIndex) == SlotPtr->Address) &&
+		(XPrc_GetBsSize(PrcPtr, VsmId, BsIndex) == SlotPtr->Size)) {
+		return XST_SUCCESS;
+	}
+
+	XPrc_SendShutdownCommand(PrcPtr, VsmId);
+	while (XPrc_IsVsmInShutdown(PrcPtr, VsmId) == XPRC_SR_SHUTDOWN_OFF) {
+		TimeOut--;
+		if (TimeOut == 0U) {
+			return XST_FAILURE;
+		}
+	}
+
+	XPrc_SetBsAddress(PrcPtr, VsmId, BsIndex, SlotPtr->Address);
+	XPrc_SetBsSize(PrcPtr, VsmId, BsIndex, SlotPtr->Size);
+
+	XPrc_SendRestartWithNoStatusCommand(PrcPtr, VsmId);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function finds a trigger which is mapped to an RM.
+*
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @param	RmId is the identifier of the Reconfigurable Module.
+* @param	TriggerIdPtr is a pointer to the variable to hold the trigger.
+*
+* @return
+*		- XST_SUCCESS if a trigger is found.
+*		- XST_FAILURE if no trigger is mapped to the RM.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XPrc_RmMgrGetTrigger(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId,
+			u16 *TriggerIdPtr)
+{
+	u16 TriggerId;
+
+	for (TriggerId = 0; TriggerId < XPrc_GetNumTriggersAllocated(
+			MgrPtr->PrcPtr, VsmId); TriggerId++) {
+		if (XPrc_GetTriggerToRmMapping(MgrPtr->PrcPtr, VsmId,
+				TriggerId) == RmId) {
+			*TriggerIdPtr = TriggerId;
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+/** @} */
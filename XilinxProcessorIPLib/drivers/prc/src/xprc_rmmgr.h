@@ -0,0 +1,197 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xprc_rmmgr.h
+* @addtogroup prc_v1_1
+* @{
+*
+* The RM manager sits on top of the XPrc driver and manages swapping of
+* Reconfigurable Modules(RM) in the Virtual Sockets.
+*
+* A DDR region given by the user is split into fixed size slots which hold
+* the RM bitstreams, as the PRC fetches them (already decompressed by the
+* user load handler). The slots are used as an LRU cache, so that the RMs
+* swapped frequently need not be read from the boot device (or) network
+* again. The Bitstream Information registers of an RM are pointed to its
+* slot while the VSM is briefly in the shutdown state, only when the RM is
+* not already at that address.
+*
+* A swap is started by XPrc_RmMgrSwap() which calls the shutdown hook for the
+* current RM and sends the software trigger mapped to the new RM. While the
+* PRC fetches the bitstream, XPrc_RmMgrPoll() preloads the RM which followed
+* the new RM the last time, into the cache. When the VSM is full with the new
+* RM, the startup hook and then the done handler are called.
+*
+* The RMs and the triggers of each VSM should be configured before the
+* manager is used, and only the manager should trigger them afterwards.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date         Changes
+* ---- ----- -----------  ------------------------------------------------
+* 1.1   ag   10/14/26      First release.
+*
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XPRC_RMMGR_H_ /* Prevent circular inclusions */
+#define XPRC_RMMGR_H_ /* by using protection macros  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xprc.h"
+
+/************************** Constant Definitions *****************************/
+
+/** @name RM manager limits
+ * @{
+ */
+#define XPRC_RMMGR_MAX_SLOTS		(16)	/**< Maximum Number Of
+						  *  cache slots */
+#define XPRC_RMMGR_MAX_RMS		(128)	/**< Maximum Number Of RMs
+						  *  per VSM */
+#define XPRC_RMMGR_NO_RM		(0xFFFF)	/**< No RM */
+#define XPRC_RMMGR_SHUTDOWN_TIMEOUT	(1000000)	/**< Polls for the VSM
+							  *  to shut down */
+/*@}*/
+
+/** @name Handler types
+ * @{
+ */
+#define XPRC_RMMGR_HANDLER_LOAD		(1)	/**< Bitstream load handler */
+#define XPRC_RMMGR_HANDLER_SHUTDOWN	(2)	/**< RM shutdown hook */
+#define XPRC_RMMGR_HANDLER_STARTUP	(3)	/**< RM startup hook */
+#define XPRC_RMMGR_HANDLER_DONE		(4)	/**< Swap done handler */
+/*@}*/
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Load handler. It reads the bitstream of the RM into DestAddr, which can hold
+ * up to MaxSize bytes, and returns its size in bytes through SizePtr.
+ * It returns XST_SUCCESS if the bitstream is loaded.
+ */
+typedef s32 (*XPrc_RmLoadHandler) (void *CallBackRef, u16 VsmId, u16 RmId,
+				u32 DestAddr, u32 MaxSize, u32 *SizePtr);
+
+/**
+ * Shutdown hook, called for the current RM before it is swapped out, and
+ * startup hook, called for the new RM after it is loaded.
+ */
+typedef void (*XPrc_RmHookHandler) (void *CallBackRef, u16 VsmId, u16 RmId);
+
+/**
+ * Done handler, called when a swap completes. ErrorStatus is the VSM error
+ * status, XPRC_SR_NO_ERROR if the new RM is loaded.
+ */
+typedef void (*XPrc_RmDoneHandler) (void *CallBackRef, u16 VsmId, u16 RmId,
+				u32 ErrorStatus);
+
+/**
+ * This typedef contains the information of a cache slot.
+ */
+typedef struct {
+	u32 Address;		/**< Slot address in DDR */
+	u32 Size;		/**< Size of the bitstream in the slot */
+	u32 LastUse;		/**< Use count of the last access */
+	u16 VsmId;		/**< VSM of the RM in the slot */
+	u16 RmId;		/**< RM in the slot */
+	u8 IsValid;		/**< Slot holds a bitstream */
+} XPrc_RmSlot;
+
+/**
+ * The RM manager instance data structure.
+ */
+typedef struct {
+	XPrc *PrcPtr;			/**< PRC instance */
+	XPrc_RmSlot Slots[XPRC_RMMGR_MAX_SLOTS];	/**< Cache slots */
+	u32 SlotSize;			/**< Size of each slot */
+	u32 UseCount;			/**< LRU use counter */
+	u16 NumSlots;			/**< Number of slots */
+	u16 ActiveRm[XPRC_MAX_NUMBER_OF_VSMS];	/**< RM in each VSM */
+	u16 PendingRm[XPRC_MAX_NUMBER_OF_VSMS];	/**< RM being loaded */
+	u16 PreloadRm[XPRC_MAX_NUMBER_OF_VSMS];	/**< RM to be preloaded */
+	u8 NextRm[XPRC_MAX_NUMBER_OF_VSMS][XPRC_RMMGR_MAX_RMS];
+					/**< RM that followed each RM
+					  *  the last time */
+	XPrc_RmLoadHandler LoadHandler;		/**< Load handler */
+	void *LoadRef;				/**< Load handler ref */
+	XPrc_RmHookHandler ShutdownHandler;	/**< Shutdown hook */
+	void *ShutdownRef;			/**< Shutdown hook ref */
+	XPrc_RmHookHandler StartupHandler;	/**< Startup hook */
+	void *StartupRef;			/**< Startup hook ref */
+	XPrc_RmDoneHandler DoneHandler;		/**< Done handler */
+	void *DoneRef;				/**< Done handler ref */
+	u32 IsReady;			/**< Manager is initialized */
+} XPrc_RmMgr;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* This macro returns the RM that is loaded in the VSM by the manager.
+* @param	MgrPtr is a pointer to the RM manager instance.
+* @param	VsmId is the identifier of the VSM.
+* @return	RM identifier, XPRC_RMMGR_NO_RM if it is not known.
+* @note		None.
+******************************************************************************/
+#define XPrc_RmMgrGetActiveRm(MgrPtr, VsmId) \
+		(MgrPtr)->ActiveRm[VsmId]
+
+/************************** Function Prototypes ******************************/
+
+/* Functions in xprc_rmmgr.c */
+s32 XPrc_RmMgrInitialize(XPrc_RmMgr *MgrPtr, XPrc *PrcPtr, u32 CacheAddr,
+				u32 SlotSize, u16 NumSlots);
+s32 XPrc_RmMgrSetHandler(XPrc_RmMgr *MgrPtr, u32 HandlerType,
+				void *FuncPtr, void *CallBackRef);
+s32 XPrc_RmMgrPreload(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId);
+void XPrc_RmMgrInvalidate(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId);
+s32 XPrc_RmMgrSwap(XPrc_RmMgr *MgrPtr, u16 VsmId, u16 RmId);
+void XPrc_RmMgrPoll(XPrc_RmMgr *MgrPtr);
+s32 XPrc_RmMgrWaitForSwap(XPrc_RmMgr *MgrPtr, u16 VsmId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* End of protection macro */
+/** @} */
@@ -102,6 +102,10 @@
 * 					 when thresholds are used.
 * 3.3   sk  11/07/15 Modified the API prototypes according to MISRAC standards
 *                    to remove compilation warnings. CR# 868893.
+*       ag  10/14/26 XQspiPs_LqspiRead copies with Xil_MemCpy so that the
+*                    BSP copy (NEON or an installed offload handler such as
+*                    a PL330 channel) is used. Added XQspiPs_LqspiSetCacheable,
+*                    XQspiPs_LqspiPrefetch and XQspiPs_LqspiInvalidate.
 *
 * </pre>
 *
@@ -110,9 +114,21 @@
 /***************************** Include Files *********************************/
 
 #include "xqspips.h"
+#include "xil_mem.h"
+#include "xil_mmu.h"
+#include "xil_cache.h"
 
 /************************** Constant Definitions *****************************/
 
+/*
+ * MMU section attributes of the linear QSPI window. The cached mapping is
+ * normal write-through cacheable with AP[2] set, so it is read-only.
+ */
+#define XQSPIPS_LQSPI_ATTR_CACHED	(NORM_WT_CACHE | 0x8000U)
+#define XQSPIPS_LQSPI_ATTR_NONCACHED	NORM_NONCACHE
+
+#define XQSPIPS_LQSPI_CACHE_LINE	32U
+
 
 /**************************** Type Definitions *******************************/
 
@@ -1074,9 +1090,6 @@ int XQspiPs_LqspiRead(XQspiPs *InstancePtr, u8 *RecvBufPtr,
 	Xil_AssertNonvoid(ByteCount > 0);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
-#ifndef XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR
-#define	XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR 0xFC000000
-#endif
 	/*
 	 * Enable the controller
 	 */
@@ -1084,10 +1097,10 @@ int XQspiPs_LqspiRead(XQspiPs *InstancePtr, u8 *RecvBufPtr,
 
 	if (XQspiPs_GetLqspiConfigReg(InstancePtr) &
 		XQSPIPS_LQSPI_CR_LINEAR_MASK) {
-		memcpy((void*)RecvBufPtr,
+		Xil_MemCpy((void*)RecvBufPtr,
 		      (const void*)(XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR +
 		       Address),
-		      (size_t)ByteCount);
+		      (u32)ByteCount);
 		return XST_SUCCESS;
 	} else {
 		return XST_FAILURE;
@@ -1100,6 +1113,131 @@ int XQspiPs_LqspiRead(XQspiPs *InstancePtr, u8 *RecvBufPtr,
 
 }
 
+/*****************************************************************************/
+/**
+*
+* Change the MMU attributes of the linear QSPI window sections that cover a
+* flash range. A cacheable range is mapped normal write-through cacheable and
+* read-only, so XIP code and copies from the window are served by the L1 and
+* L2 caches. A non-cacheable range is mapped normal non-cacheable.
+*
+* @param	InstancePtr is a pointer to the XQspiPs instance.
+* @param	Address is the starting address within the flash.
+* @param	ByteCount is the number of bytes of the range.
+* @param	Cacheable is 1 to map the range cacheable, 0 otherwise.
+*
+* @return
+*		- XST_SUCCESS if the attributes are changed
+*		- XST_FAILURE if the range is outside of the linear window
+*
+* @note		The attributes are changed for complete 1 MB sections, so the
+*		whole sections covering the range are affected. After the
+*		flash is programmed or erased the cached range must be
+*		invalidated with XQspiPs_LqspiInvalidate.
+*
+******************************************************************************/
+int XQspiPs_LqspiSetCacheable(XQspiPs *InstancePtr, u32 Address,
+			u32 ByteCount, u32 Cacheable)
+{
+	u32 Section;
+	u32 LastSection;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ByteCount > 0);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((Address >= XQSPIPS_LQSPI_SIZE) ||
+		(ByteCount > (XQSPIPS_LQSPI_SIZE - Address))) {
+		return XST_FAILURE;
+	}
+
+	Section = Address & ~(XQSPIPS_LQSPI_SECTION_SIZE - 1U);
+	LastSection = (Address + ByteCount - 1U) &
+				~(XQSPIPS_LQSPI_SECTION_SIZE - 1U);
+
+	while (Section <= LastSection) {
+		Xil_SetTlbAttributes(XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR +
+				Section, (Cacheable != 0U) ?
+				XQSPIPS_LQSPI_ATTR_CACHED :
+				XQSPIPS_LQSPI_ATTR_NONCACHED);
+		Section += XQSPIPS_LQSPI_SECTION_SIZE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Prefetch a flash range of the cacheable linear QSPI window into the data
+* cache. A preload is issued for every cache line of the range, the function
+* does not wait for the lines to be filled.
+*
+* @param	InstancePtr is a pointer to the XQspiPs instance.
+* @param	Address is the starting address within the flash.
+* @param	ByteCount is the number of bytes to prefetch.
+*
+* @return	None.
+*
+* @note		The linear mode must be enabled. The preloads have no effect
+*		on a non-cacheable mapping.
+*
+******************************************************************************/
+void XQspiPs_LqspiPrefetch(XQspiPs *InstancePtr, u32 Address,
+			u32 ByteCount)
+{
+	u32 LineAddr;
+	u32 EndAddr;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(ByteCount > 0);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Address < XQSPIPS_LQSPI_SIZE);
+	Xil_AssertVoid(ByteCount <= (XQSPIPS_LQSPI_SIZE - Address));
+
+	LineAddr = (XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR + Address) &
+				~(XQSPIPS_LQSPI_CACHE_LINE - 1U);
+	EndAddr = XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR + Address + ByteCount;
+
+	while (LineAddr < EndAddr) {
+#if defined (__GNUC__)
+		__asm__ __volatile__("pld [%0]" : : "r" (LineAddr));
+#else
+		(void)*(volatile u32 *)LineAddr;
+#endif
+		LineAddr += XQSPIPS_LQSPI_CACHE_LINE;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Invalidate the data cache for a flash range of the linear QSPI window. This
+* is required after the flash range is programmed or erased through the I/O
+* mode while the window is mapped cacheable.
+*
+* @param	InstancePtr is a pointer to the XQspiPs instance.
+* @param	Address is the starting address within the flash.
+* @param	ByteCount is the number of bytes to invalidate.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XQspiPs_LqspiInvalidate(XQspiPs *InstancePtr, u32 Address,
+			u32 ByteCount)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(ByteCount > 0);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Address < XQSPIPS_LQSPI_SIZE);
+	Xil_AssertVoid(ByteCount <= (XQSPIPS_LQSPI_SIZE - Address));
+
+	Xil_DCacheInvalidateRange(XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR +
+				Address, ByteCount);
+}
+
 /*****************************************************************************/
 /**
 *
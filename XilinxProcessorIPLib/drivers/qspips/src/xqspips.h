@@ -281,6 +281,10 @@
 *                    xqspips_dual_flash_stack_lqspi_example.c to include it in
 *                    doxygen examples.
 * 3.4   nsk 31/07/17 Added QSPI_BUS_WIDTH parameter in xparameters.h file
+*       ag  10/14/26 XQspiPs_LqspiRead copies with Xil_MemCpy. Added
+*                    XQspiPs_LqspiSetCacheable, XQspiPs_LqspiPrefetch and
+*                    XQspiPs_LqspiInvalidate for cached reads of the linear
+*                    window.
 *
 * </pre>
 *
@@ -468,6 +472,20 @@ extern "C" {
 
 /*@}*/
 
+/** @name Linear QSPI window
+ *
+ * Base address and size of the linear QSPI (XIP) address window
+ *
+ * @{
+ */
+#ifndef XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR
+#define XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR	0xFC000000
+#endif
+#define XQSPIPS_LQSPI_SIZE			0x02000000U
+#define XQSPIPS_LQSPI_SECTION_SIZE		0x00100000U /**< MMU section */
+
+/*@}*/
+
 /**************************** Type Definitions *******************************/
 /**
  * The handler data type allows the user to define a callback function to
@@ -766,6 +784,12 @@ s32 XQspiPs_PolledTransfer(XQspiPs *InstancePtr, u8 *SendBufPtr,
 			    u8 *RecvBufPtr, u32 ByteCount);
 int XQspiPs_LqspiRead(XQspiPs *InstancePtr, u8 *RecvBufPtr,
 			u32 Address, unsigned ByteCount);
+int XQspiPs_LqspiSetCacheable(XQspiPs *InstancePtr, u32 Address,
+			u32 ByteCount, u32 Cacheable);
+void XQspiPs_LqspiPrefetch(XQspiPs *InstancePtr, u32 Address,
+			u32 ByteCount);
+void XQspiPs_LqspiInvalidate(XQspiPs *InstancePtr, u32 Address,
+			u32 ByteCount);
 
 int XQspiPs_SetSlaveSelect(XQspiPs *InstancePtr);
 
@@ -139,6 +139,13 @@
 * 1.7	tjs	03/14/18 Added support in EL1 NS mode (CR#974882)
 * 1.7	tjs 26/03/18 In dual parallel mode enable both CS when issuing Write
 *		     		 enable command. CR-998478
+* 1.7   ag  10/14/26 Added XQspiPsu_StreamRead() for pipelined DMA reads.
+*                    Added dual/quad I/O address phase to XQspiPsu_ReadCmd.
+*                    Added XQspiPsu_StreamProgram() for pipelined page
+*                    programming.
+*                    Added XQspiPsu_FlashProgramStart() and
+*                    XQspiPsu_FlashEraseStart() for background program and
+*                    erase.
 * </pre>
 *
 ******************************************************************************/
@@ -192,6 +199,45 @@ typedef struct {
 	u8 PollBusMask;
 } XQspiPsu_Msg;
 
+/**
+ * This typedef describes the flash read command used by
+ * XQspiPsu_StreamRead().
+ */
+typedef struct {
+	u8 Opcode;		/**< Read opcode, sent in SPI mode */
+	u8 AddrBytes;		/**< 3 or 4 address bytes */
+	u8 AddrBusWidth;	/**< Address phase width, XQSPIPSU_SELECT_MODE_*
+				  *  (dual/quad I/O reads), 0 for SPI */
+	u8 DummyCycles;		/**< Dummy clocks before the data phase */
+	u8 BusWidth;		/**< Data phase width, XQSPIPSU_SELECT_MODE_* */
+	u32 MaxChunk;		/**< Largest read per command, 0 for the DMA
+				  *  limit */
+} XQspiPsu_ReadCmd;
+
+/**
+ * This typedef describes the page program command used by
+ * XQspiPsu_StreamProgram().
+ */
+typedef struct {
+	u8 Opcode;		/**< Page program opcode, sent in SPI mode */
+	u8 AddrBytes;		/**< 3 or 4 address bytes, sent in SPI mode */
+	u8 BusWidth;		/**< Data phase width, XQSPIPSU_SELECT_MODE_* */
+	u8 StatusCmd;		/**< Status read opcode polled after each page */
+	u8 StatusMask;		/**< Status bits compared with StatusValue */
+	u8 StatusValue;		/**< Masked status of a ready flash */
+	u32 PageSize;		/**< Program page size of one flash, a power
+				  *  of 2 */
+	u32 PollTimeout;	/**< Poll timeout per page in controller
+				  *  clocks, 0 for none */
+} XQspiPsu_ProgramCmd;
+
+/**
+ * Completion handler of a background program or erase, called from
+ * XQspiPsu_FlashOpIntrHandler(). Status is XST_SUCCESS or
+ * XST_FLASH_TIMEOUT_ERROR.
+ */
+typedef void (*XQspiPsu_FlashOpHandler) (void *CallBackRef, s32 Status);
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -232,6 +278,28 @@ typedef struct {
 	void *StatusRef;  	 /**< Callback reference for status handler */
 } XQspiPsu;
 
+/**
+ * State of a background program or erase. The user allocates it and passes
+ * it as the callback reference of XQspiPsu_FlashOpIntrHandler().
+ */
+typedef struct {
+	XQspiPsu *InstancePtr;		/**< Controller of the operation */
+	const XQspiPsu_ProgramCmd *Cmd;	/**< Command of the operation */
+	u32 Address;		/**< Flash address of the next page */
+	const u8 *Buff;		/**< Data of the next page */
+	u32 ByteCount;		/**< Bytes left after the current page */
+	u32 Header[2];		/**< Opcode and address of the current page */
+	u32 HeaderCount;	/**< Number of words in Header */
+	u32 HeaderIndex;	/**< Next Header word to write */
+	const u8 *TxPtr;	/**< Page data not yet written */
+	u32 TxCount;		/**< Number of page bytes not yet written */
+	u32 ReadMode;		/**< Read mode restored on completion */
+	volatile u32 Busy;	/**< An operation is in progress */
+	s32 Status;		/**< Result of the last operation */
+	XQspiPsu_FlashOpHandler Handler;	/**< Completion handler */
+	void *CallBackRef;	/**< Callback reference for Handler */
+} XQspiPsu_FlashOp;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 #define XQSPIPSU_READMODE_DMA	0x0U
@@ -315,6 +383,20 @@ s32 XQspiPsu_InterruptTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 s32 XQspiPsu_InterruptHandler(XQspiPsu *InstancePtr);
 void XQspiPsu_SetStatusHandler(XQspiPsu *InstancePtr, void *CallBackRef,
 				XQspiPsu_StatusHandler FuncPointer);
+s32 XQspiPsu_StreamRead(XQspiPsu *InstancePtr, const XQspiPsu_ReadCmd *Cmd,
+			u32 Address, u8 *Buff, u32 ByteCount);
+s32 XQspiPsu_StreamProgram(XQspiPsu *InstancePtr,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address,
+			const u8 *Buff, u32 ByteCount);
+void XQspiPsu_FlashOpInitialize(XQspiPsu_FlashOp *Op, XQspiPsu *InstancePtr,
+			XQspiPsu_FlashOpHandler Handler, void *CallBackRef);
+s32 XQspiPsu_FlashProgramStart(XQspiPsu_FlashOp *Op,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address,
+			const u8 *Buff, u32 ByteCount);
+s32 XQspiPsu_FlashEraseStart(XQspiPsu_FlashOp *Op,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address);
+u32 XQspiPsu_FlashOpIsBusy(XQspiPsu_FlashOp *Op);
+void XQspiPsu_FlashOpIntrHandler(void *CallBackRef);
 
 /* Configuration functions */
 s32 XQspiPsu_SetClkPrescaler(XQspiPsu *InstancePtr, u8 Prescaler);
@@ -0,0 +1,1334 @@
+/******************************************************************************
+*
+* Copyright (C) 2014 - 2018 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xqspipsu_stream.c
+* @addtogroup qspipsu_v1_7
+* @{
+*
+* This file implements a streaming flash read on top of the GQSPI generic
+* FIFO. A large read is split into commands of at most MaxChunk bytes, each
+* with its own command, address, dummy and DMA data phase. While the DMA of
+* one command runs, the generic FIFO entries and command bytes of the next
+* command are already queued, so the controller goes from one command to the
+* next without waiting for software. Dual/quad I/O reads send the address on
+* the wide bus; mode bits, if the flash has them, are covered by the dummy
+* cycles. The address is sent as given, so with
+* 4 byte address opcodes the whole flash (and dual parallel pairs) is reached
+* without bank/extended address register updates.
+*
+* Programming works the same way in the other direction: the pages are
+* queued with a generic FIFO poll entry for the ready status after each one,
+* and the next page is written to the TX FIFO while the current one is being
+* programmed.
+*
+* XQspiPsu_FlashProgramStart() and XQspiPsu_FlashEraseStart() run the same
+* sequence in the background. The call returns once the first command is
+* queued; XQspiPsu_FlashOpIntrHandler() feeds the TX FIFO, queues the next
+* page when the poll of the previous one matched and calls the completion
+* handler at the end. The status itself is polled by the controller, so the
+* CPU is only involved once per page.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.7   ag  10/14/26 First release
+*                    Added XQspiPsu_StreamProgram()
+*                    Added background program and erase with
+*                    XQspiPsu_FlashOpIntrHandler()
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xqspipsu.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Largest DMA transfer per command, word aligned */
+#define XQSPIPSU_STREAM_CHUNK_MAX	(XQSPIPSU_DMA_BYTES_MAX - 4U)
+
+#define XQSPIPSU_STREAM_WREN_CMD	0x06U	/* Write enable opcode */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static void XQspiPsu_StreamFifoWrite(XQspiPsu *InstancePtr, u32 Entry);
+static void XQspiPsu_StreamFifoXfer(XQspiPsu *InstancePtr, u32 Entry,
+					u32 Count);
+static void XQspiPsu_StreamQueue(XQspiPsu *InstancePtr,
+			const XQspiPsu_ReadCmd *Cmd, u32 Address, u32 Count);
+static void XQspiPsu_StreamSetupDma(XQspiPsu *InstancePtr, u8 *Buff,
+					u32 Count);
+static u32 XQspiPsu_StreamMode(u8 BusWidth);
+static s32 XQspiPsu_StreamPio(XQspiPsu *InstancePtr,
+			const XQspiPsu_ReadCmd *Cmd, u32 Address, u8 *Buff,
+			u32 Count);
+static void XQspiPsu_ProgramQueue(XQspiPsu *InstancePtr,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Count);
+static s32 XQspiPsu_ProgramTx(XQspiPsu *InstancePtr, u32 Data);
+static s32 XQspiPsu_ProgramWait(XQspiPsu *InstancePtr, u32 Mask, u32 Expect);
+static u32 XQspiPsu_ProgramBegin(XQspiPsu *InstancePtr,
+			const XQspiPsu_ProgramCmd *Cmd);
+static void XQspiPsu_ProgramEnd(XQspiPsu *InstancePtr, u32 ReadMode);
+static u32 XQspiPsu_ProgramHeader(const XQspiPsu_ProgramCmd *Cmd,
+			u32 Address, u32 *Words);
+static s32 XQspiPsu_FlashOpStart(XQspiPsu_FlashOp *Op,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address,
+			const u8 *Buff, u32 ByteCount);
+static void XQspiPsu_FlashOpPage(XQspiPsu_FlashOp *Op);
+static u32 XQspiPsu_FlashOpFill(XQspiPsu_FlashOp *Op);
+static void XQspiPsu_FlashOpDone(XQspiPsu_FlashOp *Op, s32 Status);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* Reads a contiguous range of flash in DMA mode, keeping the next command
+* queued in the generic FIFO while the current DMA is still running.
+*
+* The flash(es) must be selected with XQspiPsu_SelectFlash() beforehand and
+* the driver must be in DMA read mode. In dual parallel mode the data phase
+* is striped across both buses: Address is the address within each flash and
+* advances by half the number of bytes read.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cmd describes the read command. MaxChunk of 0 reads up to
+*		the DMA limit per command.
+* @param	Address is the flash address of the first byte.
+* @param	Buff is the destination buffer.
+* @param	ByteCount is the number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the driver is not in DMA mode or the request
+*		  is not valid for the connection mode.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*
+* @note		Bytes before the first word boundary of Buff and a tail of
+*		less than 4 bytes, which the DMA cannot transfer, are read
+*		with additional XQspiPsu_PolledTransfer() commands. In dual
+*		parallel mode Buff must be at least 2 byte aligned.
+*
+******************************************************************************/
+s32 XQspiPsu_StreamRead(XQspiPsu *InstancePtr, const XQspiPsu_ReadCmd *Cmd,
+			u32 Address, u8 *Buff, u32 ByteCount)
+{
+	u32 BaseAddress;
+	u32 Chunk;
+	u32 Remaining;
+	u32 CurCount;
+	u32 NextCount = 0U;
+	u32 NextAddr;
+	u8 *NextBuff;
+	u32 Head;
+	u32 Tail;
+	u32 AddrStep;
+	u32 Status;
+	s32 Result;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Cmd != NULL);
+	Xil_AssertNonvoid((Cmd->AddrBytes == 3U) || (Cmd->AddrBytes == 4U));
+	Xil_AssertNonvoid(ByteCount > 0U);
+
+	if (InstancePtr->IsBusy == TRUE) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	AddrStep = (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) ? 2U : 1U;
+	Head = (u32)((4U - ((UINTPTR)Buff & 0x3U)) & 0x3U);
+	if (Head > ByteCount) {
+		Head = ByteCount;
+	}
+	if ((InstancePtr->ReadMode != XQSPIPSU_READMODE_DMA) ||
+			((ByteCount % AddrStep) != 0U) ||
+			((Head % AddrStep) != 0U)) {
+		return (s32)XST_FAILURE;
+	}
+
+	/* Bring the destination to a word boundary for the DMA */
+	if (Head != 0U) {
+		Result = XQspiPsu_StreamPio(InstancePtr, Cmd, Address, Buff,
+						Head);
+		if (Result != XST_SUCCESS) {
+			return Result;
+		}
+		Address += Head / AddrStep;
+		Buff += Head;
+		ByteCount -= Head;
+		if (ByteCount == 0U) {
+			return XST_SUCCESS;
+		}
+	}
+
+	Chunk = Cmd->MaxChunk;
+	if ((Chunk == 0U) || (Chunk > XQSPIPSU_STREAM_CHUNK_MAX)) {
+		Chunk = XQSPIPSU_STREAM_CHUNK_MAX;
+	}
+	Chunk &= ~0x3U;
+	Xil_AssertNonvoid(Chunk != 0U);
+
+	Tail = ByteCount & 0x3U;
+	Remaining = ByteCount - Tail;
+	BaseAddress = InstancePtr->Config.BaseAddress;
+
+	if (Remaining != 0U) {
+		InstancePtr->IsBusy = TRUE;
+		XQspiPsu_Enable(InstancePtr);
+
+		/* First command */
+		CurCount = (Remaining > Chunk) ? Chunk : Remaining;
+		XQspiPsu_StreamSetupDma(InstancePtr, Buff, CurCount);
+		XQspiPsu_StreamQueue(InstancePtr, Cmd, Address, CurCount);
+		NextAddr = Address + (CurCount / AddrStep);
+		NextBuff = Buff + CurCount;
+		Remaining -= CurCount;
+
+		while (CurCount != 0U) {
+			/* Queue the following command behind the running one */
+			if ((Remaining != 0U) && (NextCount == 0U)) {
+				NextCount = (Remaining > Chunk) ? Chunk : Remaining;
+				XQspiPsu_StreamQueue(InstancePtr, Cmd, NextAddr,
+							NextCount);
+			}
+
+			do {
+				Status = XQspiPsu_ReadReg(BaseAddress,
+					XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET);
+			} while ((Status & XQSPIPSU_QSPIDMA_DST_I_STS_DONE_MASK) ==
+					0U);
+			XQspiPsu_WriteReg(BaseAddress,
+				XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET, Status);
+
+			/*
+			 * The data of the queued command is held back in the RX
+			 * FIFO until the DMA is armed again.
+			 */
+			CurCount = NextCount;
+			if (CurCount != 0U) {
+				XQspiPsu_StreamSetupDma(InstancePtr, NextBuff,
+							CurCount);
+				NextAddr += CurCount / AddrStep;
+				NextBuff += CurCount;
+				Remaining -= CurCount;
+				NextCount = 0U;
+			}
+		}
+
+		/* Wait for the last CS de-assert */
+		do {
+			Status = XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET);
+		} while ((Status & XQSPIPSU_ISR_GENFIFOEMPTY_MASK) == 0U);
+
+		InstancePtr->IsBusy = FALSE;
+		XQspiPsu_Disable(InstancePtr);
+	}
+
+	if (Tail == 0U) {
+		return XST_SUCCESS;
+	}
+
+	/* Bytes the DMA cannot move go through the generic transfer */
+	return XQspiPsu_StreamPio(InstancePtr, Cmd,
+			Address + ((ByteCount - Tail) / AddrStep),
+			Buff + (ByteCount - Tail), Tail);
+}
+
+/*****************************************************************************/
+/**
+*
+* Programs a contiguous range of flash one page at a time, with the status
+* poll after each page done by the controller.
+*
+* Each page is queued as write enable, page program and a generic FIFO poll
+* entry that holds off the following entries until the status read matches
+* StatusValue. The entries and TX data of the next page are queued while the
+* current page is being programmed, so the TX FIFO is already filled when
+* the flash becomes ready.
+*
+* The flash(es) must be selected with XQspiPsu_SelectFlash() beforehand. In
+* dual parallel mode the data is striped across both buses: Address is the
+* address within each flash and a page covers 2 * PageSize bytes of Buff.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cmd describes the page program command and the ready poll.
+* @param	Address is the flash address of the first byte.
+* @param	Buff is the data to program.
+* @param	ByteCount is the number of bytes to program.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the request is not valid for the connection
+*		  mode.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*		- XST_FLASH_TIMEOUT_ERROR if a page did not complete within
+*		  PollTimeout. The controller is aborted in that case.
+*
+* @note		The transfer is done in IO mode; the read mode is restored
+*		before returning. The range must already be erased.
+*
+******************************************************************************/
+s32 XQspiPsu_StreamProgram(XQspiPsu *InstancePtr,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address,
+			const u8 *Buff, u32 ByteCount)
+{
+	u32 BaseAddress;
+	u32 ReadMode;
+	u32 AddrStep;
+	u32 Count;
+	u32 Index;
+	u32 Data;
+	u32 Value;
+	u32 Header[2];
+	u32 HeaderCount;
+	s32 Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Cmd != NULL);
+	Xil_AssertNonvoid(Buff != NULL);
+	Xil_AssertNonvoid((Cmd->AddrBytes == 3U) || (Cmd->AddrBytes == 4U));
+	Xil_AssertNonvoid((Cmd->PageSize != 0U) &&
+			((Cmd->PageSize & (Cmd->PageSize - 1U)) == 0U));
+	Xil_AssertNonvoid(ByteCount > 0U);
+
+	if (InstancePtr->IsBusy == TRUE) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	AddrStep = (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) ? 2U : 1U;
+	if ((ByteCount % AddrStep) != 0U) {
+		return (s32)XST_FAILURE;
+	}
+
+	BaseAddress = InstancePtr->Config.BaseAddress;
+	ReadMode = XQspiPsu_ProgramBegin(InstancePtr, Cmd);
+
+	while ((ByteCount != 0U) && (Status == XST_SUCCESS)) {
+		/* Up to the end of the page */
+		Count = (Cmd->PageSize - (Address & (Cmd->PageSize - 1U))) *
+				AddrStep;
+		if (Count > ByteCount) {
+			Count = ByteCount;
+		}
+
+		/* A whole page of entries fits once below the threshold */
+		Status = XQspiPsu_ProgramWait(InstancePtr,
+				XQSPIPSU_ISR_GENFIFONOT_FULL_MASK,
+				XQSPIPSU_ISR_GENFIFONOT_FULL_MASK);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		XQspiPsu_ProgramQueue(InstancePtr, Cmd, Count);
+
+		/* Opcode and address, then the page data */
+		HeaderCount = XQspiPsu_ProgramHeader(Cmd, Address, Header);
+		for (Index = 0U; (Index < HeaderCount) &&
+				(Status == XST_SUCCESS); Index++) {
+			Status = XQspiPsu_ProgramTx(InstancePtr, Header[Index]);
+		}
+
+		Data = 0U;
+		Index = 0U;
+		for (Value = 0U; (Value < Count) && (Status == XST_SUCCESS);
+				Value++) {
+			Data |= (u32)Buff[Value] << (Index * 8U);
+			Index++;
+			if ((Index == 4U) || (Value == (Count - 1U))) {
+				Status = XQspiPsu_ProgramTx(InstancePtr, Data);
+				Data = 0U;
+				Index = 0U;
+			}
+		}
+
+		Address += Count / AddrStep;
+		Buff += Count;
+		ByteCount -= Count;
+	}
+
+	/* The last CS de-assert is popped once the last poll matched */
+	if (Status == XST_SUCCESS) {
+		Status = XQspiPsu_ProgramWait(InstancePtr,
+				XQSPIPSU_ISR_GENFIFOEMPTY_MASK |
+				XQSPIPSU_ISR_TXEMPTY_MASK,
+				XQSPIPSU_ISR_GENFIFOEMPTY_MASK |
+				XQSPIPSU_ISR_TXEMPTY_MASK);
+	}
+	if (Status == XST_SUCCESS) {
+		while ((XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET) &
+				XQSPIPSU_ISR_RXEMPTY_MASK) == 0U) {
+			(void)XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_RXD_OFFSET);
+		}
+	} else {
+		XQspiPsu_Abort(InstancePtr);
+	}
+
+	XQspiPsu_ProgramEnd(InstancePtr, ReadMode);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Prepares a background flash operation. The handler is called from
+* XQspiPsu_FlashOpIntrHandler() each time an operation has completed.
+*
+* XQspiPsu_FlashOpIntrHandler() is to be connected to the QSPI interrupt
+* with Op as the callback reference. Without the interrupt it may instead be
+* called from a periodic timer or a main loop; each call does the work that
+* is due and returns.
+*
+* @param	Op is the operation state, owned by the caller.
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Handler is the completion handler, or NULL to poll with
+*		XQspiPsu_FlashOpIsBusy().
+* @param	CallBackRef is passed to the handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XQspiPsu_FlashOpInitialize(XQspiPsu_FlashOp *Op, XQspiPsu *InstancePtr,
+			XQspiPsu_FlashOpHandler Handler, void *CallBackRef)
+{
+	Xil_AssertVoid(Op != NULL);
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Op->InstancePtr = InstancePtr;
+	Op->Cmd = NULL;
+	Op->Busy = FALSE;
+	Op->Status = XST_SUCCESS;
+	Op->Handler = Handler;
+	Op->CallBackRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+*
+* Starts programming a contiguous range of flash in the background. Pages
+* are split and polled as in XQspiPsu_StreamProgram().
+*
+* @param	Op is the operation state set up by
+*		XQspiPsu_FlashOpInitialize().
+* @param	Cmd describes the page program command and the ready poll.
+* @param	Address is the flash address of the first byte.
+* @param	Buff is the data to program.
+* @param	ByteCount is the number of bytes to program.
+*
+* @return
+*		- XST_SUCCESS if the operation was started.
+*		- XST_FAILURE if the request is not valid for the connection
+*		  mode.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*
+* @note		Cmd and Buff must stay valid until the operation completes.
+*		PollTimeout applies to each page.
+*
+******************************************************************************/
+s32 XQspiPsu_FlashProgramStart(XQspiPsu_FlashOp *Op,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address,
+			const u8 *Buff, u32 ByteCount)
+{
+	Xil_AssertNonvoid(Op != NULL);
+	Xil_AssertNonvoid(Cmd != NULL);
+	Xil_AssertNonvoid(Buff != NULL);
+	Xil_AssertNonvoid((Cmd->AddrBytes == 3U) || (Cmd->AddrBytes == 4U));
+	Xil_AssertNonvoid((Cmd->PageSize != 0U) &&
+			((Cmd->PageSize & (Cmd->PageSize - 1U)) == 0U));
+	Xil_AssertNonvoid(ByteCount > 0U);
+
+	return XQspiPsu_FlashOpStart(Op, Cmd, Address, Buff, ByteCount);
+}
+
+/*****************************************************************************/
+/**
+*
+* Starts a sector, block or chip erase in the background: write enable, the
+* erase command and the ready poll.
+*
+* @param	Op is the operation state set up by
+*		XQspiPsu_FlashOpInitialize().
+* @param	Cmd describes the erase command and the ready poll. Opcode is
+*		the erase opcode, AddrBytes is 0 for a chip erase. BusWidth
+*		and PageSize are not used.
+* @param	Address is an address within the area to erase.
+*
+* @return
+*		- XST_SUCCESS if the operation was started.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*
+* @note		Cmd must stay valid until the operation completes. Erase times
+*		are long; PollTimeout of 0 waits without a limit.
+*
+******************************************************************************/
+s32 XQspiPsu_FlashEraseStart(XQspiPsu_FlashOp *Op,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address)
+{
+	Xil_AssertNonvoid(Op != NULL);
+	Xil_AssertNonvoid(Cmd != NULL);
+	Xil_AssertNonvoid((Cmd->AddrBytes == 0U) || (Cmd->AddrBytes == 3U) ||
+			(Cmd->AddrBytes == 4U));
+
+	return XQspiPsu_FlashOpStart(Op, Cmd, Address, NULL, 0U);
+}
+
+/*****************************************************************************/
+/**
+*
+* Tells whether a background flash operation is still running.
+*
+* @param	Op is the operation state.
+*
+* @return	TRUE while the operation runs, FALSE once it has completed.
+*		The result of the last operation is then in Op->Status.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XQspiPsu_FlashOpIsBusy(XQspiPsu_FlashOp *Op)
+{
+	Xil_AssertNonvoid(Op != NULL);
+
+	return Op->Busy;
+}
+
+/*****************************************************************************/
+/**
+*
+* Advances a background flash operation: drains the matched poll status,
+* refills the TX FIFO, queues the next page once the previous one is done
+* and completes the operation after the last one.
+*
+* @param	CallBackRef is the XQspiPsu_FlashOp of the operation.
+*
+* @return	None.
+*
+* @note		Called from the QSPI interrupt, or periodically when the
+*		interrupt is not used. Calls outside an operation are ignored.
+*
+******************************************************************************/
+void XQspiPsu_FlashOpIntrHandler(void *CallBackRef)
+{
+	XQspiPsu_FlashOp *Op = (XQspiPsu_FlashOp *)CallBackRef;
+	u32 BaseAddress;
+	u32 IntrStatus;
+	u32 Mask;
+
+	Xil_AssertVoid(Op != NULL);
+
+	if (Op->Busy == FALSE) {
+		return;
+	}
+
+	BaseAddress = Op->InstancePtr->Config.BaseAddress;
+	IntrStatus = XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET);
+	if ((IntrStatus & XQSPIPSU_ISR_POLL_TIME_EXPIRE_MASK) != 0U) {
+		XQspiPsu_FlashOpDone(Op, (s32)XST_FLASH_TIMEOUT_ERROR);
+		return;
+	}
+
+	while ((XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET) &
+			XQSPIPSU_ISR_RXEMPTY_MASK) == 0U) {
+		(void)XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_RXD_OFFSET);
+	}
+
+	if (XQspiPsu_FlashOpFill(Op) == FALSE) {
+		return;
+	}
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_IDR_OFFSET,
+			XQSPIPSU_IDR_TXNOT_FULL_MASK);
+
+	/* The last CS de-assert is popped once the poll matched */
+	Mask = XQSPIPSU_ISR_GENFIFOEMPTY_MASK | XQSPIPSU_ISR_TXEMPTY_MASK;
+	if ((IntrStatus & Mask) != Mask) {
+		return;
+	}
+
+	if (Op->ByteCount != 0U) {
+		XQspiPsu_FlashOpPage(Op);
+	} else {
+		XQspiPsu_FlashOpDone(Op, XST_SUCCESS);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads a few bytes with one command through XQspiPsu_PolledTransfer(), for
+* the unaligned head and tail of a streaming read.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cmd describes the read command.
+* @param	Address is the flash address.
+* @param	Buff is the destination.
+* @param	Count is the number of bytes.
+*
+* @return	Status of XQspiPsu_PolledTransfer().
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XQspiPsu_StreamPio(XQspiPsu *InstancePtr,
+			const XQspiPsu_ReadCmd *Cmd, u32 Address, u8 *Buff,
+			u32 Count)
+{
+	u8 CmdBfr[5];
+	XQspiPsu_Msg Msg[4];
+	u32 NumMsg = 0U;
+
+	CmdBfr[0] = Cmd->Opcode;
+	if (Cmd->AddrBytes == 4U) {
+		CmdBfr[1] = (u8)(Address >> 24);
+		CmdBfr[2] = (u8)(Address >> 16);
+		CmdBfr[3] = (u8)(Address >> 8);
+		CmdBfr[4] = (u8)Address;
+	} else {
+		CmdBfr[1] = (u8)(Address >> 16);
+		CmdBfr[2] = (u8)(Address >> 8);
+		CmdBfr[3] = (u8)Address;
+	}
+	Msg[NumMsg].TxBfrPtr = CmdBfr;
+	Msg[NumMsg].RxBfrPtr = NULL;
+	Msg[NumMsg].ByteCount = 1U + (u32)Cmd->AddrBytes;
+	Msg[NumMsg].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+	if (XQspiPsu_StreamMode(Cmd->AddrBusWidth) !=
+			XQSPIPSU_GENFIFO_MODE_SPI) {
+		/* Opcode in SPI mode, address on the wider bus */
+		Msg[NumMsg].ByteCount = 1U;
+		NumMsg++;
+		Msg[NumMsg].TxBfrPtr = &CmdBfr[1];
+		Msg[NumMsg].RxBfrPtr = NULL;
+		Msg[NumMsg].ByteCount = Cmd->AddrBytes;
+		Msg[NumMsg].BusWidth = Cmd->AddrBusWidth;
+		Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+	}
+	NumMsg++;
+
+	if (Cmd->DummyCycles != 0U) {
+		Msg[NumMsg].TxBfrPtr = NULL;
+		Msg[NumMsg].RxBfrPtr = NULL;
+		Msg[NumMsg].ByteCount = Cmd->DummyCycles;
+		Msg[NumMsg].BusWidth = Cmd->BusWidth;
+		Msg[NumMsg].Flags = 0U;
+		NumMsg++;
+	}
+
+	Msg[NumMsg].TxBfrPtr = NULL;
+	Msg[NumMsg].RxBfrPtr = Buff;
+	Msg[NumMsg].ByteCount = Count;
+	Msg[NumMsg].BusWidth = Cmd->BusWidth;
+	Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		Msg[NumMsg].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+	NumMsg++;
+
+	return XQspiPsu_PolledTransfer(InstancePtr, Msg, NumMsg);
+}
+
+/*****************************************************************************/
+/**
+*
+* Queues the generic FIFO entries and command bytes of one read command:
+* CS assert, opcode and address, dummy cycles, data and CS de-assert.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cmd describes the read command.
+* @param	Address is the flash address.
+* @param	Count is the number of data bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamQueue(XQspiPsu *InstancePtr,
+			const XQspiPsu_ReadCmd *Cmd, u32 Address, u32 Count)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Select;
+	u32 Entry;
+	u32 Data;
+
+	Select = InstancePtr->GenFifoCS | InstancePtr->GenFifoBus;
+
+	/* Address bytes MSB first, first byte on the wire in the low byte */
+	if (Cmd->AddrBytes == 4U) {
+		Data = (Address >> 24) & 0xFFU;
+		Data |= ((Address >> 16) & 0xFFU) << 8;
+		Data |= ((Address >> 8) & 0xFFU) << 16;
+		Data |= (Address & 0xFFU) << 24;
+	} else {
+		Data = (Address >> 16) & 0xFFU;
+		Data |= ((Address >> 8) & 0xFFU) << 8;
+		Data |= (Address & 0xFFU) << 16;
+	}
+
+	/* CS assert */
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_CS_SETUP);
+
+	Entry = XQSPIPSU_GENFIFO_MODE_SPI | Select | XQSPIPSU_GENFIFO_TX;
+	if (XQspiPsu_StreamMode(Cmd->AddrBusWidth) ==
+			XQSPIPSU_GENFIFO_MODE_SPI) {
+		/* Opcode and address in one entry */
+		XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_TXD_OFFSET,
+				(u32)Cmd->Opcode | (Data << 8));
+		if (Cmd->AddrBytes == 4U) {
+			XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_TXD_OFFSET,
+					Data >> 24);
+		}
+		XQspiPsu_StreamFifoXfer(InstancePtr, Entry,
+				1U + (u32)Cmd->AddrBytes);
+	} else {
+		/*
+		 * Dual/quad I/O: each TX entry consumes whole TXD words, so
+		 * the opcode and the address get a word each.
+		 */
+		XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_TXD_OFFSET,
+				(u32)Cmd->Opcode);
+		XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_TXD_OFFSET, Data);
+		XQspiPsu_StreamFifoXfer(InstancePtr, Entry, 1U);
+		Entry = XQspiPsu_StreamMode(Cmd->AddrBusWidth) | Select |
+				XQSPIPSU_GENFIFO_TX;
+		XQspiPsu_StreamFifoXfer(InstancePtr, Entry,
+				(u32)Cmd->AddrBytes);
+	}
+
+	/* Dummy cycles, clocked at the data phase width */
+	if (Cmd->DummyCycles != 0U) {
+		Entry = XQspiPsu_StreamMode(Cmd->BusWidth) | Select;
+		XQspiPsu_StreamFifoXfer(InstancePtr, Entry, Cmd->DummyCycles);
+	}
+
+	/* Data */
+	Entry = XQspiPsu_StreamMode(Cmd->BusWidth) | Select |
+			XQSPIPSU_GENFIFO_RX;
+	if (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		Entry |= XQSPIPSU_GENFIFO_STRIPE;
+	}
+	XQspiPsu_StreamFifoXfer(InstancePtr, Entry, Count);
+
+	/* CS de-assert */
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			InstancePtr->GenFifoBus | XQSPIPSU_GENFIFO_CS_HOLD);
+
+	if (InstancePtr->IsManualstart == TRUE) {
+		XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_CFG_OFFSET,
+			XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_CFG_OFFSET) |
+				XQSPIPSU_CFG_START_GEN_FIFO_MASK);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes a transfer of Count bytes (or clocks) to the generic FIFO, using
+* exponent entries for counts that do not fit the immediate field.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Entry holds the mode, select and direction bits.
+* @param	Count is the number of bytes or dummy clocks.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamFifoXfer(XQspiPsu *InstancePtr, u32 Entry,
+					u32 Count)
+{
+	u32 TempCount;
+	u32 Exponent = 8U;	/* 2^8 = 256 */
+
+	Entry |= XQSPIPSU_GENFIFO_DATA_XFER;
+
+	if (Count < XQSPIPSU_GENFIFO_IMM_DATA_MASK) {
+		XQspiPsu_StreamFifoWrite(InstancePtr, Entry | Count);
+		return;
+	}
+
+	TempCount = Count >> 8;
+	while (TempCount != 0U) {
+		if ((TempCount & 0x1U) != 0U) {
+			XQspiPsu_StreamFifoWrite(InstancePtr,
+				Entry | XQSPIPSU_GENFIFO_EXP | Exponent);
+		}
+		TempCount = TempCount >> 1;
+		Exponent++;
+	}
+
+	if ((Count & 0xFFU) != 0U) {
+		XQspiPsu_StreamFifoWrite(InstancePtr, Entry | (Count & 0xFFU));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes one generic FIFO entry, waiting while the FIFO is full. This is
+* where queueing the next command overlaps with the running DMA.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Entry is the generic FIFO entry.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamFifoWrite(XQspiPsu *InstancePtr, u32 Entry)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+
+	while ((XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET) &
+			XQSPIPSU_ISR_GENFIFOFULL_MASK) != 0U) {
+		/* Wait for the running command to drain an entry */
+	}
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_GEN_FIFO_OFFSET, Entry);
+}
+
+/*****************************************************************************/
+/**
+*
+* Arms the RX DMA for one command.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Buff is the word aligned destination.
+* @param	Count is the number of bytes, a multiple of 4.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamSetupDma(XQspiPsu *InstancePtr, u8 *Buff,
+					u32 Count)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheInvalidateRange((INTPTR)Buff, Count);
+	}
+
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_QSPIDMA_DST_ADDR_OFFSET,
+			(u32)((UINTPTR)Buff & XQSPIPSU_QSPIDMA_DST_ADDR_MASK));
+#ifdef __aarch64__
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_QSPIDMA_DST_ADDR_MSB_OFFSET,
+			(u32)((u64)(UINTPTR)Buff >> 32) &
+			XQSPIPSU_QSPIDMA_DST_ADDR_MSB_MASK);
+#endif
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_QSPIDMA_DST_SIZE_OFFSET, Count);
+}
+
+/*****************************************************************************/
+/**
+*
+* Converts a XQSPIPSU_SELECT_MODE_* bus width to the generic FIFO mode bits.
+*
+* @param	BusWidth is the bus width.
+*
+* @return	Generic FIFO mode bits.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XQspiPsu_StreamMode(u8 BusWidth)
+{
+	u32 Mode;
+
+	switch (BusWidth) {
+		case XQSPIPSU_SELECT_MODE_DUALSPI:
+			Mode = XQSPIPSU_GENFIFO_MODE_DUALSPI;
+			break;
+		case XQSPIPSU_SELECT_MODE_QUADSPI:
+			Mode = XQSPIPSU_GENFIFO_MODE_QUADSPI;
+			break;
+		default:
+			Mode = XQSPIPSU_GENFIFO_MODE_SPI;
+			break;
+	}
+
+	return Mode;
+}
+
+/*****************************************************************************/
+/**
+*
+* Queues the generic FIFO entries of one page: write enable, page program
+* and the ready poll. The TX data is supplied separately. With a Count of 0
+* only the command is sent, as for an erase.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cmd describes the page program command.
+* @param	Count is the number of data bytes of the page.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_ProgramQueue(XQspiPsu *InstancePtr,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Count)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Select;
+	u32 Stripe = 0U;
+	u32 Entry;
+
+	Select = InstancePtr->GenFifoCS | InstancePtr->GenFifoBus;
+	if (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		Stripe = XQSPIPSU_GENFIFO_STRIPE;
+	}
+
+	/* Write enable, opcode as immediate data */
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_CS_SETUP);
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_TX | XQSPIPSU_STREAM_WREN_CMD);
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			InstancePtr->GenFifoBus | XQSPIPSU_GENFIFO_CS_HOLD);
+
+	/* Page program */
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_CS_SETUP);
+	Entry = XQSPIPSU_GENFIFO_MODE_SPI | Select | XQSPIPSU_GENFIFO_TX;
+	XQspiPsu_StreamFifoXfer(InstancePtr, Entry, 1U + (u32)Cmd->AddrBytes);
+	if (Count != 0U) {
+		Entry = XQspiPsu_StreamMode(Cmd->BusWidth) | Select |
+				XQSPIPSU_GENFIFO_TX | Stripe;
+		XQspiPsu_StreamFifoXfer(InstancePtr, Entry, Count);
+	}
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			InstancePtr->GenFifoBus | XQSPIPSU_GENFIFO_CS_HOLD);
+
+	/* Status read, polled by the controller until it matches */
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_CS_SETUP);
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_TX | (u32)Cmd->StatusCmd);
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_RX | XQSPIPSU_GENFIFO_POLL |
+			Stripe);
+	XQspiPsu_StreamFifoWrite(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			InstancePtr->GenFifoBus | XQSPIPSU_GENFIFO_CS_HOLD);
+
+	if (InstancePtr->IsManualstart == TRUE) {
+		XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_CFG_OFFSET,
+			XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_CFG_OFFSET) |
+				XQSPIPSU_CFG_START_GEN_FIFO_MASK);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes one word to the TX FIFO, waiting while the FIFO is full. This is
+* where the next page is staged while the current one is programmed.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Data is the TX word, first byte in the low byte.
+*
+* @return	XST_SUCCESS, or XST_FLASH_TIMEOUT_ERROR on a poll timeout.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XQspiPsu_ProgramTx(XQspiPsu *InstancePtr, u32 Data)
+{
+	s32 Status;
+
+	Status = XQspiPsu_ProgramWait(InstancePtr, XQSPIPSU_ISR_TXFULL_MASK, 0U);
+	if (Status == XST_SUCCESS) {
+		XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress,
+				XQSPIPSU_TXD_OFFSET, Data);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Waits until the masked interrupt status equals Expect. The status words
+* the controller stores on each matched poll are drained meanwhile.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Mask selects the XQSPIPSU_ISR_* bits to wait on.
+* @param	Expect is the value of the masked bits to wait for.
+*
+* @return	XST_SUCCESS, or XST_FLASH_TIMEOUT_ERROR on a poll timeout.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XQspiPsu_ProgramWait(XQspiPsu *InstancePtr, u32 Mask, u32 Expect)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 IntrStatus;
+
+	do {
+		IntrStatus = XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET);
+		if ((IntrStatus & XQSPIPSU_ISR_POLL_TIME_EXPIRE_MASK) != 0U) {
+			return (s32)XST_FLASH_TIMEOUT_ERROR;
+		}
+		if ((IntrStatus & XQSPIPSU_ISR_RXNEMPTY_MASK) != 0U) {
+			(void)XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_RXD_OFFSET);
+		}
+	} while ((IntrStatus & Mask) != Expect);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Claims the controller for page programming or erase and sets up the ready
+* poll of Cmd.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cmd describes the ready poll.
+*
+* @return	The read mode to restore with XQspiPsu_ProgramEnd().
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XQspiPsu_ProgramBegin(XQspiPsu *InstancePtr,
+			const XQspiPsu_ProgramCmd *Cmd)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 ReadMode;
+	u32 Value;
+
+	/* The controller writes the matched status to the RX FIFO */
+	ReadMode = InstancePtr->ReadMode;
+	if (ReadMode != XQSPIPSU_READMODE_IO) {
+		(void)XQspiPsu_SetReadMode(InstancePtr, XQSPIPSU_READMODE_IO);
+	}
+
+	InstancePtr->IsBusy = TRUE;
+	XQspiPsu_Enable(InstancePtr);
+
+	Value = ((u32)Cmd->StatusMask << XQSPIPSU_POLL_CFG_MASK_EN_SHIFT) &
+			XQSPIPSU_POLL_CFG_MASK_EN_MASK;
+	Value |= ((u32)Cmd->StatusValue << XQSPIPSU_POLL_CFG_DATA_VALUE_SHIFT) &
+			XQSPIPSU_POLL_CFG_DATA_VALUE_MASK;
+	if ((InstancePtr->GenFifoBus & XQSPIPSU_GENFIFO_BUS_UPPER) != 0U) {
+		Value |= XQSPIPSU_POLL_CFG_EN_MASK_UPPER_MASK;
+	}
+	if ((InstancePtr->GenFifoBus & XQSPIPSU_GENFIFO_BUS_LOWER) != 0U) {
+		Value |= XQSPIPSU_POLL_CFG_EN_MASK_LOWER_MASK;
+	}
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_POLL_CFG_OFFSET, Value);
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_P_TO_OFFSET, Cmd->PollTimeout);
+	Value = XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_CFG_OFFSET);
+	if (Cmd->PollTimeout != 0U) {
+		Value |= XQSPIPSU_CFG_EN_POLL_TO_MASK;
+	} else {
+		Value &= ~XQSPIPSU_CFG_EN_POLL_TO_MASK;
+	}
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_CFG_OFFSET, Value);
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_ISR_OFFSET,
+			XQSPIPSU_ISR_POLL_TIME_EXPIRE_MASK);
+
+	return ReadMode;
+}
+
+/*****************************************************************************/
+/**
+*
+* Releases the controller after page programming or erase.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	ReadMode is the read mode returned by XQspiPsu_ProgramBegin().
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_ProgramEnd(XQspiPsu *InstancePtr, u32 ReadMode)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_CFG_OFFSET,
+			XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_CFG_OFFSET) &
+				~XQSPIPSU_CFG_EN_POLL_TO_MASK);
+	InstancePtr->IsBusy = FALSE;
+	XQspiPsu_Disable(InstancePtr);
+	if (ReadMode != XQSPIPSU_READMODE_IO) {
+		(void)XQspiPsu_SetReadMode(InstancePtr, ReadMode);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Packs the opcode and address of a command into TX words, address MSB
+* first.
+*
+* @param	Cmd describes the command.
+* @param	Address is the flash address.
+* @param	Words receives the TX words, at least 2.
+*
+* @return	The number of TX words.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XQspiPsu_ProgramHeader(const XQspiPsu_ProgramCmd *Cmd,
+			u32 Address, u32 *Words)
+{
+	u32 Count = 0U;
+	u32 Index = 1U;
+	u32 Data = (u32)Cmd->Opcode;
+	u32 Value;
+
+	for (Value = Cmd->AddrBytes; Value != 0U; Value--) {
+		Data |= ((Address >> ((Value - 1U) * 8U)) & 0xFFU) <<
+				(Index * 8U);
+		Index++;
+		if (Index == 4U) {
+			Words[Count] = Data;
+			Count++;
+			Data = 0U;
+			Index = 0U;
+		}
+	}
+	if (Index != 0U) {
+		Words[Count] = Data;
+		Count++;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* Claims the controller and queues the first command of a background
+* operation.
+*
+* @param	Op is the operation state.
+* @param	Cmd describes the command and the ready poll.
+* @param	Address is the flash address.
+* @param	Buff is the data to program, NULL for an erase.
+* @param	ByteCount is the number of bytes to program, 0 for an erase.
+*
+* @return	XST_SUCCESS, XST_FAILURE or XST_DEVICE_BUSY.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XQspiPsu_FlashOpStart(XQspiPsu_FlashOp *Op,
+			const XQspiPsu_ProgramCmd *Cmd, u32 Address,
+			const u8 *Buff, u32 ByteCount)
+{
+	XQspiPsu *InstancePtr = Op->InstancePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if ((InstancePtr->IsBusy == TRUE) || (Op->Busy == TRUE)) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	if ((InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) &&
+			((ByteCount % 2U) != 0U)) {
+		return (s32)XST_FAILURE;
+	}
+
+	Op->Cmd = Cmd;
+	Op->Address = Address;
+	Op->Buff = Buff;
+	Op->ByteCount = ByteCount;
+	Op->Status = XST_SUCCESS;
+	Op->Busy = TRUE;
+	Op->ReadMode = XQspiPsu_ProgramBegin(InstancePtr, Cmd);
+
+	XQspiPsu_FlashOpPage(Op);
+
+	XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress, XQSPIPSU_IER_OFFSET,
+			(u32)XQSPIPSU_IER_RXNEMPTY_MASK |
+			(u32)XQSPIPSU_IER_GENFIFOEMPTY_MASK |
+			(u32)XQSPIPSU_IER_POLL_TIME_EXPIRE_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Queues the next page, or the erase command, of a background operation and
+* writes as much of its TX data as fits. The TX FIFO threshold interrupt is
+* enabled for the rest.
+*
+* @param	Op is the operation state.
+*
+* @return	None.
+*
+* @note		The generic FIFO is empty here, so queueing does not wait.
+*
+******************************************************************************/
+static void XQspiPsu_FlashOpPage(XQspiPsu_FlashOp *Op)
+{
+	XQspiPsu *InstancePtr = Op->InstancePtr;
+	const XQspiPsu_ProgramCmd *Cmd = Op->Cmd;
+	u32 AddrStep;
+	u32 Count = 0U;
+
+	AddrStep = (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) ? 2U : 1U;
+
+	if (Op->ByteCount != 0U) {
+		/* Up to the end of the page */
+		Count = (Cmd->PageSize - (Op->Address &
+				(Cmd->PageSize - 1U))) * AddrStep;
+		if (Count > Op->ByteCount) {
+			Count = Op->ByteCount;
+		}
+	}
+
+	XQspiPsu_ProgramQueue(InstancePtr, Cmd, Count);
+
+	Op->HeaderCount = XQspiPsu_ProgramHeader(Cmd, Op->Address, Op->Header);
+	Op->HeaderIndex = 0U;
+	Op->TxPtr = Op->Buff;
+	Op->TxCount = Count;
+
+	Op->Address += Count / AddrStep;
+	Op->Buff += Count;
+	Op->ByteCount -= Count;
+
+	if (XQspiPsu_FlashOpFill(Op) == FALSE) {
+		XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress,
+				XQSPIPSU_IER_OFFSET,
+				XQSPIPSU_IER_TXNOT_FULL_MASK);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes the pending TX words of the current page until the TX FIFO is full.
+*
+* @param	Op is the operation state.
+*
+* @return	TRUE once all TX words of the page are written, FALSE if the
+*		TX FIFO filled up first.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XQspiPsu_FlashOpFill(XQspiPsu_FlashOp *Op)
+{
+	u32 BaseAddress = Op->InstancePtr->Config.BaseAddress;
+	u32 Index;
+	u32 Data;
+
+	while ((Op->HeaderIndex < Op->HeaderCount) || (Op->TxCount != 0U)) {
+		if ((XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET) &
+				XQSPIPSU_ISR_TXFULL_MASK) != 0U) {
+			return FALSE;
+		}
+
+		if (Op->HeaderIndex < Op->HeaderCount) {
+			Data = Op->Header[Op->HeaderIndex];
+			Op->HeaderIndex++;
+		} else {
+			Data = 0U;
+			for (Index = 0U; (Index < 4U) && (Op->TxCount != 0U);
+					Index++) {
+				Data |= (u32)*Op->TxPtr << (Index * 8U);
+				Op->TxPtr++;
+				Op->TxCount--;
+			}
+		}
+		XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_TXD_OFFSET, Data);
+	}
+
+	return TRUE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Completes a background operation, aborting the controller on an error,
+* and calls the completion handler.
+*
+* @param	Op is the operation state.
+* @param	Status is the result of the operation.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_FlashOpDone(XQspiPsu_FlashOp *Op, s32 Status)
+{
+	XQspiPsu *InstancePtr = Op->InstancePtr;
+
+	XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress, XQSPIPSU_IDR_OFFSET,
+			XQSPIPSU_IDR_ALL_MASK);
+	if (Status != XST_SUCCESS) {
+		XQspiPsu_Abort(InstancePtr);
+	}
+	XQspiPsu_ProgramEnd(InstancePtr, Op->ReadMode);
+
+	Op->Status = Status;
+	Op->Busy = FALSE;
+	if (Op->Handler != NULL) {
+		Op->Handler(Op->CallBackRef, Status);
+	}
+}
+/** @} */
@@ -98,6 +98,10 @@
 *       sk     03/09/18 Removed FIFO disable check in DDC and DUC APIs.
 *       sk     03/09/18 Add support for Marker event source for DAC block.
 *       sk     03/22/18 Updated PLL settings based on latest IP values.
+*       ag     10/14/26 Add XRFdc_SetMultiBlockSettings() to stage settings
+*                       for many blocks behind one update event, and skip
+*                       QMC/coarse delay register writes that do not change.
+*       ag     10/14/26 Add NCO hop table API's for fast frequency hopping.
 * </pre>
 *
 ******************************************************************************/
@@ -130,6 +134,11 @@ static u32 XRFdc_SetPLLConfig(XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
 static void XRFdc_SetSignalFlow(XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
 		u32 Mode, u32 DigitalDataPathId, u32 DataType,
 		int ConnectIData, int ConnectQData);
+static void XRFdc_ClrSetReg(XRFdc* InstancePtr, u32 BaseAddr, u32 RegOffset,
+		u16 Mask, u16 Data);
+static u32 XRFdc_GetNCOFreqWord(XRFdc* InstancePtr, u32 Type, int Tile_Id,
+		u32 Block_Id, double SamplingRate, double NCOFreq,
+		u8 CalibrationMode, s64 *FreqWord);
 /************************** Function Prototypes ******************************/
 
 /*****************************************************************************/
@@ -857,8 +866,6 @@ int XRFdc_SetMixerSettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 	XRFdc_Mixer_Settings *Mixer_Config;
 	u8 CalibrationMode;
 	u32 CoarseMixFreq;
-	double NCOFreq;
-	u32 NyquistZone;
 
 #ifdef __BAREMETAL__
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1113,7 +1120,7 @@ int XRFdc_SetMixerSettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 			}
 
 			CoarseMixFreq = Mixer_Settings->CoarseMixFreq;
-			NCOFreq = Mixer_Settings->Freq;
+			CalibrationMode = 0U;
 			if (Type == XRFDC_ADC_TILE) {
 				Status = XRFdc_GetCalibrationMode(InstancePtr,
 					Tile_Id, Block_Id, &CalibrationMode);
@@ -1136,39 +1143,14 @@ int XRFdc_SetMixerSettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 						XRFDC_COARSE_MIX_MIN_SAMPLE_FREQ_BY_FOUR)
 						CoarseMixFreq =
 							XRFDC_COARSE_MIX_SAMPLE_FREQ_BY_FOUR;
-					NCOFreq -= (SamplingRate * 1000) / 2.0;
 				}
 			}
 
-			if ((NCOFreq < -((SamplingRate * 1000) / 2.0)) ||
-				(NCOFreq > ((SamplingRate * 1000) / 2.0))) {
-				if (Type == XRFDC_ADC_TILE)
-					Status = XRFdc_GetNyquistZone(InstancePtr, XRFDC_ADC_TILE,
-						Tile_Id, Block_Id, &NyquistZone);
-				else
-					Status = XRFdc_GetNyquistZone(InstancePtr, XRFDC_DAC_TILE,
-						Tile_Id, Block_Id, &NyquistZone);
-				if (Status != XRFDC_SUCCESS)
-					return XRFDC_FAILURE;
-				do {
-					if (NCOFreq < -((SamplingRate * 1000) / 2.0))
-						NCOFreq +=  (SamplingRate * 1000);
-					if (NCOFreq > ((SamplingRate * 1000) / 2.0))
-						NCOFreq -= (SamplingRate * 1000);
-				} while ((NCOFreq < -((SamplingRate * 1000) / 2.0)) ||
-					(NCOFreq > ((SamplingRate * 1000) / 2.0)));
-
-				if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) &&
-						(NCOFreq != 0))
-					NCOFreq *= -1;
-			}
-
-			if (NCOFreq < 0)
-				Freq = ((NCOFreq * XRFDC_NCO_FREQ_MIN_MULTIPLIER) /
-												(SamplingRate * 1000U));
-			else
-				Freq = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) /
-												(SamplingRate * 1000U));
+			Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id,
+					Block_Id, SamplingRate, Mixer_Settings->Freq,
+					CalibrationMode, &Freq);
+			if (Status != XRFDC_SUCCESS)
+				return XRFDC_FAILURE;
 			XRFdc_WriteReg16(InstancePtr, BaseAddr,
 								XRFDC_ADC_NCO_FQWD_LOW_OFFSET, (u16)Freq);
 			ReadReg = (Freq >> 16) & XRFDC_NCO_FQWD_MID_MASK;
@@ -1445,12 +1427,8 @@ int XRFdc_SetMixerSettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 			XRFdc_WriteReg16(InstancePtr, BaseAddr,
 					XRFDC_MXR_MODE_OFFSET, ReadReg);
 
-			ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-								XRFDC_NCO_UPDT_OFFSET);
-			ReadReg &= ~XRFDC_NCO_UPDT_MODE_MASK;
-			ReadReg |= Mixer_Settings->EventSource;
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_UPDT_OFFSET,
-										ReadReg);
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_NCO_UPDT_OFFSET,
+					XRFDC_NCO_UPDT_MODE_MASK, Mixer_Settings->EventSource);
 			if (Mixer_Settings->EventSource == XRFDC_EVNT_SRC_IMMEDIATE) {
 				if (Type == XRFDC_ADC_TILE) {
 					ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
@@ -1477,6 +1455,7 @@ int XRFdc_SetMixerSettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 			Mixer_Config->Freq = Mixer_Settings->Freq;
 			Mixer_Config->CoarseMixMode =
 				Mixer_Settings->CoarseMixMode;
+			Mixer_Config->FineMixerScale = Mixer_Settings->FineMixerScale;
 		}
 	}
 	(void)BaseAddr;
@@ -2016,18 +1995,10 @@ int XRFdc_SetQMCSettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 				goto RETURN_PATH;
 			}
 
-			ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-								XRFDC_QMC_CFG_OFFSET);
-			ReadReg &= ~XRFDC_QMC_CFG_EN_GAIN_MASK;
-			ReadReg |= QMC_Settings->EnableGain;
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_QMC_CFG_OFFSET,
-								ReadReg);
-			ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-								XRFDC_QMC_CFG_OFFSET);
-			ReadReg &= ~XRFDC_QMC_CFG_EN_PHASE_MASK;
-			ReadReg |= (QMC_Settings->EnablePhase << 1U);
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_QMC_CFG_OFFSET,
-								ReadReg);
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_QMC_CFG_OFFSET,
+					(XRFDC_QMC_CFG_EN_GAIN_MASK | XRFDC_QMC_CFG_EN_PHASE_MASK),
+					(QMC_Settings->EnableGain |
+					(QMC_Settings->EnablePhase << 1U)));
 
 			/* Phase Correction factor is applicable to IQ mode only */
 			if (((Type == XRFDC_ADC_TILE) &&
@@ -2037,38 +2008,24 @@ int XRFdc_SetQMCSettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 				(InstancePtr->DAC_Tile[Tile_Id].DACBlock_Digital_Datapath[Index].
 						DataType == XRFDC_DATA_TYPE_IQ)))
 				{
-						ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-												XRFDC_QMC_PHASE_OFFSET);
-						ReadReg &= ~XRFDC_QMC_PHASE_CRCTN_MASK;
 						PhaseCorrectionFactor =
 						((QMC_Settings->PhaseCorrectionFactor / 26.5) *
 								XRFDC_QMC_PHASE_MULT);
-
-						ReadReg |= PhaseCorrectionFactor;
-						XRFdc_WriteReg16(InstancePtr, BaseAddr,
-										XRFDC_QMC_PHASE_OFFSET, ReadReg);
+						XRFdc_ClrSetReg(InstancePtr, BaseAddr,
+								XRFDC_QMC_PHASE_OFFSET,
+								XRFDC_QMC_PHASE_CRCTN_MASK,
+								PhaseCorrectionFactor);
 				}
 
-			ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-												XRFDC_QMC_GAIN_OFFSET);
-			ReadReg &= ~XRFDC_QMC_GAIN_CRCTN_MASK;
 			GainCorrectionFactor = ((QMC_Settings->GainCorrectionFactor *
 									XRFDC_QMC_GAIN_MULT) / 2.0);
-			ReadReg |= GainCorrectionFactor;
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_QMC_GAIN_OFFSET,
-														ReadReg);
-			ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-								XRFDC_QMC_OFF_OFFSET);
-			ReadReg &= ~XRFDC_QMC_OFFST_CRCTN_MASK;
-			ReadReg |= QMC_Settings->OffsetCorrectionFactor;
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_QMC_OFF_OFFSET,
-														ReadReg);
-			ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-										XRFDC_QMC_UPDT_OFFSET);
-			ReadReg &= ~XRFDC_QMC_UPDT_MODE_MASK;
-			ReadReg |= QMC_Settings->EventSource;
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_QMC_UPDT_OFFSET,
-										ReadReg);
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_QMC_GAIN_OFFSET,
+					XRFDC_QMC_GAIN_CRCTN_MASK, GainCorrectionFactor);
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_QMC_OFF_OFFSET,
+					XRFDC_QMC_OFFST_CRCTN_MASK,
+					QMC_Settings->OffsetCorrectionFactor);
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_QMC_UPDT_OFFSET,
+					XRFDC_QMC_UPDT_MODE_MASK, QMC_Settings->EventSource);
 			if (QMC_Settings->EventSource == XRFDC_EVNT_SRC_IMMEDIATE) {
 				if (Type == XRFDC_ADC_TILE) {
 					ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
@@ -2366,18 +2323,12 @@ int XRFdc_SetCoarseDelaySettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 				goto RETURN_PATH;
 			}
 			if (Type == XRFDC_ADC_TILE) {
-				ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-									XRFDC_ADC_CRSE_DLY_CFG_OFFSET);
-				ReadReg &= ~XRFDC_CRSE_DLY_CFG_MASK;
-				ReadReg |= CoarseDelay_Settings->CoarseDelay;
-				XRFdc_WriteReg16(InstancePtr, BaseAddr,
-							XRFDC_ADC_CRSE_DLY_CFG_OFFSET, ReadReg);
-				ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-								XRFDC_ADC_CRSE_DLY_UPDT_OFFSET);
-				ReadReg &= ~XRFDC_QMC_UPDT_MODE_MASK;
-				ReadReg |= CoarseDelay_Settings->EventSource;
-				XRFdc_WriteReg16(InstancePtr, BaseAddr,
-								XRFDC_ADC_CRSE_DLY_UPDT_OFFSET, ReadReg);
+				XRFdc_ClrSetReg(InstancePtr, BaseAddr,
+						XRFDC_ADC_CRSE_DLY_CFG_OFFSET, XRFDC_CRSE_DLY_CFG_MASK,
+						CoarseDelay_Settings->CoarseDelay);
+				XRFdc_ClrSetReg(InstancePtr, BaseAddr,
+						XRFDC_ADC_CRSE_DLY_UPDT_OFFSET, XRFDC_QMC_UPDT_MODE_MASK,
+						CoarseDelay_Settings->EventSource);
 				if (CoarseDelay_Settings->EventSource ==
 									XRFDC_EVNT_SRC_IMMEDIATE) {
 					ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
@@ -2388,18 +2339,12 @@ int XRFdc_SetCoarseDelaySettings(XRFdc* InstancePtr, u32 Type, int Tile_Id,
 									XRFDC_ADC_UPDATE_DYN_OFFSET, ReadReg);
 				}
 			} else {
-				ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-									XRFDC_DAC_CRSE_DLY_CFG_OFFSET);
-				ReadReg &= ~XRFDC_CRSE_DLY_CFG_MASK;
-				ReadReg |= CoarseDelay_Settings->CoarseDelay;
-				XRFdc_WriteReg16(InstancePtr, BaseAddr,
-									XRFDC_DAC_CRSE_DLY_CFG_OFFSET, ReadReg);
-				ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
-								XRFDC_DAC_CRSE_DLY_UPDT_OFFSET);
-				ReadReg &= ~XRFDC_QMC_UPDT_MODE_MASK;
-				ReadReg |= CoarseDelay_Settings->EventSource;
-				XRFdc_WriteReg16(InstancePtr, BaseAddr,
-								XRFDC_DAC_CRSE_DLY_UPDT_OFFSET, ReadReg);
+				XRFdc_ClrSetReg(InstancePtr, BaseAddr,
+						XRFDC_DAC_CRSE_DLY_CFG_OFFSET, XRFDC_CRSE_DLY_CFG_MASK,
+						CoarseDelay_Settings->CoarseDelay);
+				XRFdc_ClrSetReg(InstancePtr, BaseAddr,
+						XRFDC_DAC_CRSE_DLY_UPDT_OFFSET, XRFDC_QMC_UPDT_MODE_MASK,
+						CoarseDelay_Settings->EventSource);
 				if (CoarseDelay_Settings->EventSource ==
 									XRFDC_EVNT_SRC_IMMEDIATE) {
 					ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
@@ -6079,4 +6024,601 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* Read-modify-write helper for the 16 bit tile registers. The register is
+* written back only when the masked field actually changes.
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	BaseAddr is the tile/block base address of the register.
+* @param	RegOffset is the offset of the register.
+* @param	Mask is the mask of the field to be updated.
+* @param	Data is the new value of the field, already shifted into place.
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void XRFdc_ClrSetReg(XRFdc* InstancePtr, u32 BaseAddr, u32 RegOffset,
+		u16 Mask, u16 Data)
+{
+	u16 ReadReg;
+	u16 WriteReg;
+
+	ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, RegOffset);
+	WriteReg = (ReadReg & ~Mask) | (Data & Mask);
+	if (WriteReg != ReadReg) {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, RegOffset, WriteReg);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API applies mixer, QMC and coarse delay settings to a number of
+* ADC/DAC blocks, which may be spread over several tiles, and makes all of
+* them take effect on one update event. Settings that match what is already
+* programmed in a block are not written again.
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	BlockCfg is an array of XRFdc_BlockCfg entries. A NULL settings
+*			pointer in an entry leaves that part of the block untouched.
+*			The EventSource member of the referenced settings is ignored.
+* @param	NumBlocks is the number of entries in BlockCfg.
+* @param	EventSource is the update event used for all the blocks.
+*			Valid values are XRFDC_EVNT_SRC_TILE, XRFDC_EVNT_SRC_SYSREF
+*			and XRFDC_EVNT_SRC_PL.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*       - XRFDC_FAILURE if Block not enabled or settings are invalid.
+*
+* @note		With XRFDC_EVNT_SRC_TILE the driver triggers one tile event for
+*			every tile that was written, once all the blocks are staged.
+*			With XRFDC_EVNT_SRC_SYSREF the new settings are applied together
+*			on the next SYSREF edge and with XRFDC_EVNT_SRC_PL on the next PL
+*			event, both of which are issued external to the driver.
+*			On failure the blocks staged so far keep their new settings
+*			pending until the next event.
+*
+******************************************************************************/
+int XRFdc_SetMultiBlockSettings(XRFdc* InstancePtr, XRFdc_BlockCfg *BlockCfg,
+								u32 NumBlocks, u32 EventSource)
+{
+	s32 Status;
+	u32 Index;
+	u32 Type;
+	int Tile_Id;
+	u32 Block_Id;
+	u32 BaseAddr;
+	u32 TileMask[2] = {0U, 0U};
+	u32 IsCached;
+	XRFdc_Mixer_Settings Mixer_Settings;
+	XRFdc_Mixer_Settings *Mixer_Config;
+	XRFdc_QMC_Settings QMC_Settings;
+	XRFdc_QMC_Settings *QMC_Config;
+	XRFdc_CoarseDelay_Settings CoarseDelay_Settings;
+	XRFdc_CoarseDelay_Settings *CoarseDelay_Config;
+
+#ifdef __BAREMETAL__
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BlockCfg != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+#endif
+
+	if ((EventSource != XRFDC_EVNT_SRC_TILE) &&
+			(EventSource != XRFDC_EVNT_SRC_SYSREF) &&
+			(EventSource != XRFDC_EVNT_SRC_PL)) {
+		Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+		xdbg_printf(XDBG_DEBUG_ERROR, "\n Invalid event source selection "
+						"in %s\r\n", __func__);
+#else
+		metal_log(METAL_LOG_ERROR, "\n Invalid event source selection "
+						"in %s\r\n", __func__);
+#endif
+		goto RETURN_PATH;
+	}
+
+	for (Index = 0U; Index < NumBlocks; Index++) {
+		Type = BlockCfg[Index].Type;
+		Tile_Id = BlockCfg[Index].Tile_Id;
+		Block_Id = BlockCfg[Index].Block_Id;
+		if (((Type != XRFDC_ADC_TILE) && (Type != XRFDC_DAC_TILE)) ||
+				(Tile_Id < 0) || (Tile_Id > 3) || (Block_Id > 3U)) {
+			Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+			xdbg_printf(XDBG_DEBUG_ERROR, "\n Invalid block in %s\r\n",
+							__func__);
+#else
+			metal_log(METAL_LOG_ERROR, "\n Invalid block in %s\r\n",
+							__func__);
+#endif
+			goto RETURN_PATH;
+		}
+
+		/*
+		 * The cached settings of a 4GSPS ADC block are spread over
+		 * several slices, so those blocks are always written.
+		 */
+		IsCached = ((InstancePtr->ADC4GSPS != XRFDC_ADC_4GSPS) ||
+				(Type == XRFDC_DAC_TILE)) ? 1U : 0U;
+		if (Type == XRFDC_ADC_TILE) {
+			Mixer_Config = &InstancePtr->ADC_Tile[Tile_Id].
+					ADCBlock_Digital_Datapath[Block_Id].Mixer_Settings;
+			QMC_Config = &InstancePtr->ADC_Tile[Tile_Id].
+					ADCBlock_Analog_Datapath[Block_Id].QMC_Settings;
+			CoarseDelay_Config = &InstancePtr->ADC_Tile[Tile_Id].
+					ADCBlock_Analog_Datapath[Block_Id].CoarseDelay_Settings;
+		} else {
+			Mixer_Config = &InstancePtr->DAC_Tile[Tile_Id].
+					DACBlock_Digital_Datapath[Block_Id].Mixer_Settings;
+			QMC_Config = &InstancePtr->DAC_Tile[Tile_Id].
+					DACBlock_Analog_Datapath[Block_Id].QMC_Settings;
+			CoarseDelay_Config = &InstancePtr->DAC_Tile[Tile_Id].
+					DACBlock_Analog_Datapath[Block_Id].CoarseDelay_Settings;
+		}
+
+		if (BlockCfg[Index].Mixer_Settings != NULL) {
+			Mixer_Settings = *BlockCfg[Index].Mixer_Settings;
+			Mixer_Settings.EventSource = EventSource;
+			if ((IsCached == 0U) ||
+				(Mixer_Config->EventSource != EventSource) ||
+				(Mixer_Config->Freq != Mixer_Settings.Freq) ||
+				(Mixer_Config->PhaseOffset !=
+						Mixer_Settings.PhaseOffset) ||
+				(Mixer_Config->FineMixerMode !=
+						Mixer_Settings.FineMixerMode) ||
+				(Mixer_Config->CoarseMixFreq !=
+						Mixer_Settings.CoarseMixFreq) ||
+				(Mixer_Config->CoarseMixMode !=
+						Mixer_Settings.CoarseMixMode) ||
+				(Mixer_Config->FineMixerScale !=
+						Mixer_Settings.FineMixerScale)) {
+				Status = XRFdc_SetMixerSettings(InstancePtr, Type,
+						Tile_Id, Block_Id, &Mixer_Settings);
+				if (Status != XRFDC_SUCCESS) {
+					goto RETURN_PATH;
+				}
+				TileMask[Type] |= (1U << Tile_Id);
+			}
+		}
+
+		if (BlockCfg[Index].QMC_Settings != NULL) {
+			QMC_Settings = *BlockCfg[Index].QMC_Settings;
+			QMC_Settings.EventSource = EventSource;
+			if ((IsCached == 0U) ||
+				(QMC_Config->EventSource != EventSource) ||
+				(QMC_Config->EnablePhase != QMC_Settings.EnablePhase) ||
+				(QMC_Config->EnableGain != QMC_Settings.EnableGain) ||
+				(QMC_Config->GainCorrectionFactor !=
+						QMC_Settings.GainCorrectionFactor) ||
+				(QMC_Config->PhaseCorrectionFactor !=
+						QMC_Settings.PhaseCorrectionFactor) ||
+				(QMC_Config->OffsetCorrectionFactor !=
+						QMC_Settings.OffsetCorrectionFactor)) {
+				Status = XRFdc_SetQMCSettings(InstancePtr, Type,
+						Tile_Id, Block_Id, &QMC_Settings);
+				if (Status != XRFDC_SUCCESS) {
+					goto RETURN_PATH;
+				}
+				TileMask[Type] |= (1U << Tile_Id);
+			}
+		}
+
+		if (BlockCfg[Index].CoarseDelay_Settings != NULL) {
+			CoarseDelay_Settings = *BlockCfg[Index].CoarseDelay_Settings;
+			CoarseDelay_Settings.EventSource = EventSource;
+			if ((IsCached == 0U) ||
+				(CoarseDelay_Config->EventSource != EventSource) ||
+				(CoarseDelay_Config->CoarseDelay !=
+						CoarseDelay_Settings.CoarseDelay)) {
+				Status = XRFdc_SetCoarseDelaySettings(InstancePtr, Type,
+						Tile_Id, Block_Id, &CoarseDelay_Settings);
+				if (Status != XRFDC_SUCCESS) {
+					goto RETURN_PATH;
+				}
+				TileMask[Type] |= (1U << Tile_Id);
+			}
+		}
+	}
+
+	/*
+	 * A tile event updates every block of the tile that selected it, so
+	 * one trigger per touched tile applies all the staged settings.
+	 */
+	if (EventSource == XRFDC_EVNT_SRC_TILE) {
+		for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+			for (Tile_Id = 0; Tile_Id < 4; Tile_Id++) {
+				if ((TileMask[Type] & (1U << Tile_Id)) == 0U) {
+					continue;
+				}
+				BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) +
+								XRFDC_HSCOM_ADDR;
+				XRFdc_WriteReg16(InstancePtr, BaseAddr,
+								XRFDC_HSCOM_UPDT_DYN_OFFSET, 0x1);
+			}
+		}
+	}
+	(void)BaseAddr;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Converts an NCO frequency in MHz into the 48 bit NCO frequency word of a
+* block, folding it into the first Nyquist zone and accounting for the
+* calibration mode and Nyquist zone of the block.
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	Tile_Id Valid values are 0-3.
+* @param	Block_Id is ADC/DAC block number inside the tile. Valid values
+*			are 0-3.
+* @param	SamplingRate is the sampling rate of the tile in GHz.
+* @param	NCOFreq is the requested NCO frequency in MHz.
+* @param	CalibrationMode is the calibration mode of an ADC block, it is
+*			ignored for DAC blocks.
+* @param	FreqWord is a pointer in which the frequency word is returned.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*       - XRFDC_FAILURE if the Nyquist zone can not be read.
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XRFdc_GetNCOFreqWord(XRFdc* InstancePtr, u32 Type, int Tile_Id,
+		u32 Block_Id, double SamplingRate, double NCOFreq,
+		u8 CalibrationMode, s64 *FreqWord)
+{
+	s32 Status;
+	u32 NyquistZone;
+
+	if ((Type == XRFDC_ADC_TILE) &&
+			(CalibrationMode == XRFDC_CALIB_MODE1)) {
+		NCOFreq -= (SamplingRate * 1000) / 2.0;
+	}
+
+	if ((NCOFreq < -((SamplingRate * 1000) / 2.0)) ||
+		(NCOFreq > ((SamplingRate * 1000) / 2.0))) {
+		Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id,
+						Block_Id, &NyquistZone);
+		if (Status != XRFDC_SUCCESS)
+			return XRFDC_FAILURE;
+		do {
+			if (NCOFreq < -((SamplingRate * 1000) / 2.0))
+				NCOFreq +=  (SamplingRate * 1000);
+			if (NCOFreq > ((SamplingRate * 1000) / 2.0))
+				NCOFreq -= (SamplingRate * 1000);
+		} while ((NCOFreq < -((SamplingRate * 1000) / 2.0)) ||
+			(NCOFreq > ((SamplingRate * 1000) / 2.0)));
+
+		if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) &&
+				(NCOFreq != 0))
+			NCOFreq *= -1;
+	}
+
+	if (NCOFreq < 0)
+		*FreqWord = ((NCOFreq * XRFDC_NCO_FREQ_MIN_MULTIPLIER) /
+										(SamplingRate * 1000U));
+	else
+		*FreqWord = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) /
+										(SamplingRate * 1000U));
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API precomputes the NCO frequency and phase register images of a
+* block for a list of frequencies, so that XRFdc_NCOHop() can later switch
+* between them without any floating point work. The mixer of the block has
+* to be configured with XRFdc_SetMixerSettings() before, the hop table only
+* replaces the NCO frequency and phase. The NCO update event source of the
+* block is set to EventSource.
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	Tile_Id Valid values are 0-3.
+* @param	Block_Id is ADC/DAC block number inside the tile. Valid values
+*			are 0-3.
+* @param	Freq is an array of NumEntries NCO frequencies in MHz.
+* @param	PhaseOffset is an array of NumEntries NCO phase offsets in
+*			degrees, or NULL for a zero phase offset.
+* @param	NumEntries is the number of hop entries, up to
+*			XRFDC_NCO_HOP_MAX_ENTRIES.
+* @param	EventSource is the event that applies a hop. Valid values are
+*			XRFDC_EVNT_SRC_IMMEDIATE, XRFDC_EVNT_SRC_TILE,
+*			XRFDC_EVNT_SRC_SYSREF and XRFDC_EVNT_SRC_PL.
+* @param	HopTable is a pointer to the XRFdc_NCO_Hop_Table structure
+*			that is filled in.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*       - XRFDC_FAILURE if Block not enabled or arguments are invalid.
+*
+* @note		The table has to be rebuilt after the sampling rate, Nyquist
+*			zone or calibration mode of the block changes.
+*
+******************************************************************************/
+int XRFdc_BuildNCOHopTable(XRFdc* InstancePtr, u32 Type, int Tile_Id,
+		u32 Block_Id, const double *Freq, const double *PhaseOffset,
+		u32 NumEntries, u32 EventSource, XRFdc_NCO_Hop_Table *HopTable)
+{
+	s32 Status;
+	u32 IsBlockAvail;
+	u32 BaseAddr;
+	double SamplingRate;
+	s64 FreqWord;
+	s32 PhaseWord;
+	u8 CalibrationMode;
+	u16 Index;
+	u32 Entry;
+	XRFdc_NCO_Hop_Entry *HopEntry;
+
+#ifdef __BAREMETAL__
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Freq != NULL);
+	Xil_AssertNonvoid(HopTable != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+#endif
+
+	HopTable->NumEntries = 0U;
+
+	if (Type == XRFDC_ADC_TILE) {
+		IsBlockAvail = XRFdc_IsADCBlockEnabled(InstancePtr, Tile_Id,
+						Block_Id);
+		SamplingRate = InstancePtr->ADC_Tile[Tile_Id].
+					PLL_Settings.SampleRate;
+	} else {
+		IsBlockAvail = XRFdc_IsDACBlockEnabled(InstancePtr, Tile_Id,
+						Block_Id);
+		SamplingRate = InstancePtr->DAC_Tile[Tile_Id].
+					PLL_Settings.SampleRate;
+	}
+	if (IsBlockAvail == 0U) {
+		Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+		xdbg_printf(XDBG_DEBUG_ERROR, "\n Requested block not "
+						"available in %s\r\n", __func__);
+#else
+		metal_log(METAL_LOG_ERROR, "\n Requested block not "
+						"available in %s\r\n", __func__);
+#endif
+		goto RETURN_PATH;
+	}
+	if (SamplingRate <= 0) {
+		Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+		xdbg_printf(XDBG_DEBUG_ERROR, "\n Incorrect Sampling rate "
+				"in %s\r\n", __func__);
+#else
+		metal_log(METAL_LOG_ERROR, "\n Incorrect Sampling rate "
+						"in %s\r\n", __func__);
+#endif
+		goto RETURN_PATH;
+	}
+	if ((NumEntries == 0U) || (NumEntries > XRFDC_NCO_HOP_MAX_ENTRIES)) {
+		Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+		xdbg_printf(XDBG_DEBUG_ERROR, "\n Invalid number of hop entries "
+				"in %s\r\n", __func__);
+#else
+		metal_log(METAL_LOG_ERROR, "\n Invalid number of hop entries "
+						"in %s\r\n", __func__);
+#endif
+		goto RETURN_PATH;
+	}
+	if (((EventSource != XRFDC_EVNT_SRC_IMMEDIATE) &&
+			(EventSource != XRFDC_EVNT_SRC_TILE) &&
+			(EventSource != XRFDC_EVNT_SRC_SYSREF) &&
+			(EventSource != XRFDC_EVNT_SRC_PL)) ||
+		((InstancePtr->ADC4GSPS == XRFDC_ADC_4GSPS) &&
+			(Type == XRFDC_ADC_TILE) &&
+			(EventSource == XRFDC_EVNT_SRC_IMMEDIATE))) {
+		Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+		xdbg_printf(XDBG_DEBUG_ERROR, "\n Invalid event source selection "
+						"in %s\r\n", __func__);
+#else
+		metal_log(METAL_LOG_ERROR, "\n Invalid event source selection "
+						"in %s\r\n", __func__);
+#endif
+		goto RETURN_PATH;
+	}
+
+	CalibrationMode = 0U;
+	if (Type == XRFDC_ADC_TILE) {
+		Status = XRFdc_GetCalibrationMode(InstancePtr, Tile_Id, Block_Id,
+						&CalibrationMode);
+		if (Status != XRFDC_SUCCESS)
+			goto RETURN_PATH;
+	}
+
+	for (Entry = 0U; Entry < NumEntries; Entry++) {
+		if ((PhaseOffset != NULL) &&
+			((PhaseOffset[Entry] > XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT) ||
+			(PhaseOffset[Entry] < XRFDC_MIXER_PHASE_OFFSET_LOW_LIMIT))) {
+			Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+			xdbg_printf(XDBG_DEBUG_ERROR, "\n Invalid phase offset value "
+							"in %s\r\n", __func__);
+#else
+			metal_log(METAL_LOG_ERROR, "\n Invalid phase offset value "
+							"in %s\r\n", __func__);
+#endif
+			goto RETURN_PATH;
+		}
+		Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id,
+				Block_Id, SamplingRate, Freq[Entry], CalibrationMode,
+				&FreqWord);
+		if (Status != XRFDC_SUCCESS)
+			goto RETURN_PATH;
+
+		HopEntry = &HopTable->Entry[Entry];
+		HopEntry->Freq = Freq[Entry];
+		HopEntry->PhaseOffset = (PhaseOffset != NULL) ?
+						PhaseOffset[Entry] : 0.0;
+		PhaseWord = ((HopEntry->PhaseOffset *
+						XRFDC_NCO_PHASE_MULTIPLIER) / 180);
+		HopEntry->FreqWord[0] = (u16)FreqWord;
+		HopEntry->FreqWord[1] = (u16)((FreqWord >> 16) &
+						XRFDC_NCO_FQWD_MID_MASK);
+		HopEntry->FreqWord[2] = (u16)((FreqWord >> 32) &
+						XRFDC_NCO_FQWD_UPP_MASK);
+		HopEntry->PhaseWord[0] = (u16)PhaseWord;
+		HopEntry->PhaseWord[1] = (u16)((PhaseWord >> 16) &
+						XRFDC_NCO_PHASE_UPP_MASK);
+	}
+
+	/* A 4GSPS ADC block is made of two slices running the same NCO */
+	HopTable->FirstSlice = Block_Id;
+	HopTable->LastSlice = Block_Id;
+	if ((InstancePtr->ADC4GSPS == XRFDC_ADC_4GSPS) &&
+			(Type == XRFDC_ADC_TILE)) {
+		HopTable->FirstSlice = (Block_Id == 1U) ? 2U : 0U;
+		HopTable->LastSlice = HopTable->FirstSlice + 1U;
+	}
+
+	for (Index = HopTable->FirstSlice; Index <= HopTable->LastSlice;
+								Index++) {
+		BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) +
+						XRFDC_BLOCK_ADDR_OFFSET(Index);
+		XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_NCO_UPDT_OFFSET,
+					XRFDC_NCO_UPDT_MODE_MASK, EventSource);
+		if (Type == XRFDC_ADC_TILE) {
+			InstancePtr->ADC_Tile[Tile_Id].ADCBlock_Digital_Datapath[Index].
+					Mixer_Settings.EventSource = EventSource;
+		} else {
+			InstancePtr->DAC_Tile[Tile_Id].DACBlock_Digital_Datapath[Index].
+					Mixer_Settings.EventSource = EventSource;
+		}
+	}
+
+	HopTable->Type = Type;
+	HopTable->Tile_Id = Tile_Id;
+	HopTable->Block_Id = Block_Id;
+	HopTable->EventSource = EventSource;
+	HopTable->NumEntries = NumEntries;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API switches the NCO of a block to one entry of a hop table built
+* with XRFdc_BuildNCOHopTable(). Only the NCO frequency and phase words are
+* written, followed by the update event trigger for IMMEDIATE and TILE
+* event sources.
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	HopTable is a pointer to the hop table of the block.
+* @param	Entry is the index of the hop table entry to switch to.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*       - XRFDC_FAILURE if Entry is not in the table.
+*
+* @note		For XRFDC_EVNT_SRC_SYSREF and XRFDC_EVNT_SRC_PL the new
+*			frequency takes effect on the next SYSREF edge or PL event,
+*			which are issued external to the driver. The fine/coarse mixer
+*			mode of the block is left as it is.
+*
+******************************************************************************/
+int XRFdc_NCOHop(XRFdc* InstancePtr, XRFdc_NCO_Hop_Table *HopTable,
+								u32 Entry)
+{
+	s32 Status;
+	u32 BaseAddr;
+	u16 ReadReg;
+	u16 Index;
+	XRFdc_NCO_Hop_Entry *HopEntry;
+	XRFdc_Mixer_Settings *Mixer_Config;
+
+#ifdef __BAREMETAL__
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(HopTable != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+#endif
+
+	if (Entry >= HopTable->NumEntries) {
+		Status = XRFDC_FAILURE;
+#ifdef __MICROBLAZE__
+		xdbg_printf(XDBG_DEBUG_ERROR, "\n Invalid hop entry "
+						"in %s\r\n", __func__);
+#else
+		metal_log(METAL_LOG_ERROR, "\n Invalid hop entry "
+						"in %s\r\n", __func__);
+#endif
+		goto RETURN_PATH;
+	}
+
+	HopEntry = &HopTable->Entry[Entry];
+	for (Index = HopTable->FirstSlice; Index <= HopTable->LastSlice;
+								Index++) {
+		BaseAddr = XRFDC_DRP_BASE(HopTable->Type, HopTable->Tile_Id) +
+						XRFDC_BLOCK_ADDR_OFFSET(Index);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr,
+				XRFDC_ADC_NCO_FQWD_LOW_OFFSET, HopEntry->FreqWord[0]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr,
+				XRFDC_ADC_NCO_FQWD_MID_OFFSET, HopEntry->FreqWord[1]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr,
+				XRFDC_ADC_NCO_FQWD_UPP_OFFSET, HopEntry->FreqWord[2]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr,
+				XRFDC_NCO_PHASE_LOW_OFFSET, HopEntry->PhaseWord[0]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr,
+				XRFDC_NCO_PHASE_UPP_OFFSET, HopEntry->PhaseWord[1]);
+
+		if (HopTable->EventSource == XRFDC_EVNT_SRC_IMMEDIATE) {
+			if (HopTable->Type == XRFDC_ADC_TILE) {
+				ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
+							XRFDC_ADC_UPDATE_DYN_OFFSET);
+				ReadReg &= ~XRFDC_UPDT_EVNT_MASK;
+				ReadReg |= (0x1 << 1U); /* XRFDC_UPDT_EVNT_NCO_MASK */
+				XRFdc_WriteReg16(InstancePtr, BaseAddr,
+							XRFDC_ADC_UPDATE_DYN_OFFSET, ReadReg);
+			} else {
+				ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr,
+							XRFDC_DAC_UPDATE_DYN_OFFSET);
+				ReadReg &= ~XRFDC_UPDT_EVNT_MASK;
+				ReadReg |= (0x1 << 1U); /* XRFDC_UPDT_EVNT_NCO_MASK */
+				XRFdc_WriteReg16(InstancePtr, BaseAddr,
+							XRFDC_DAC_UPDATE_DYN_OFFSET, ReadReg);
+			}
+		}
+
+		if (HopTable->Type == XRFDC_ADC_TILE) {
+			Mixer_Config = &InstancePtr->ADC_Tile[HopTable->Tile_Id].
+					ADCBlock_Digital_Datapath[Index].Mixer_Settings;
+		} else {
+			Mixer_Config = &InstancePtr->DAC_Tile[HopTable->Tile_Id].
+					DACBlock_Digital_Datapath[Index].Mixer_Settings;
+		}
+		Mixer_Config->Freq = HopEntry->Freq;
+		Mixer_Config->PhaseOffset = HopEntry->PhaseOffset;
+	}
+
+	if (HopTable->EventSource == XRFDC_EVNT_SRC_TILE) {
+		BaseAddr = XRFDC_DRP_BASE(HopTable->Type, HopTable->Tile_Id) +
+						XRFDC_HSCOM_ADDR;
+		XRFdc_WriteReg16(InstancePtr, BaseAddr,
+						XRFDC_HSCOM_UPDT_DYN_OFFSET, 0x1);
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /** @} */
@@ -143,6 +143,8 @@
 *       jm     03/12/18 Added support for reloading DTC scans.
 *       jm     03/12/18 Add option to configure sysref capture after MTS.
 *       sk     03/22/18 Updated PLL settings based on latest IP values.
+*       ag     10/14/26 Add XRFdc_SetMultiBlockSettings() API.
+*       ag     10/14/26 Add NCO hop table API's.
 *
 * </pre>
 *
@@ -175,6 +177,10 @@ extern "C" {
 #endif
 #include "xrfdc_hw.h"
 
+/************************** Constant Definitions *****************************/
+
+#define XRFDC_NCO_HOP_MAX_ENTRIES	32U	/**< Max frequencies per hop table */
+
 /**************************** Type Definitions *******************************/
 
 #ifndef __BAREMETAL__
@@ -251,6 +257,43 @@ typedef struct {
 	u8 FineMixerScale;	/* NCO output scale, valid values 0,1 and 2 */
 } XRFdc_Mixer_Settings;
 
+/**
+ * Block configuration entry for XRFdc_SetMultiBlockSettings(). A NULL
+ * settings pointer leaves that part of the block unchanged.
+ */
+typedef struct {
+	u32 Type;	/* XRFDC_ADC_TILE or XRFDC_DAC_TILE */
+	int Tile_Id;
+	u32 Block_Id;
+	XRFdc_Mixer_Settings *Mixer_Settings;
+	XRFdc_QMC_Settings *QMC_Settings;
+	XRFdc_CoarseDelay_Settings *CoarseDelay_Settings;
+} XRFdc_BlockCfg;
+
+/**
+ * NCO hop table entry, precomputed NCO frequency and phase register images.
+ */
+typedef struct {
+	double Freq;
+	double PhaseOffset;
+	u16 FreqWord[3];	/* NCO frequency [15:0], [31:16], [47:32] */
+	u16 PhaseWord[2];	/* NCO phase [15:0], [17:16] */
+} XRFdc_NCO_Hop_Entry;
+
+/**
+ * NCO hop table of one ADC/DAC block, built by XRFdc_BuildNCOHopTable().
+ */
+typedef struct {
+	u32 Type;
+	int Tile_Id;
+	u32 Block_Id;
+	u32 EventSource;
+	u16 FirstSlice;	/* Slices written on a hop, two for 4GSPS ADC */
+	u16 LastSlice;
+	u32 NumEntries;
+	XRFdc_NCO_Hop_Entry Entry[XRFDC_NCO_HOP_MAX_ENTRIES];
+} XRFdc_NCO_Hop_Table;
+
 /**
  * ADC block Threshold settings.
  */
@@ -1149,6 +1192,13 @@ u32 XRFdc_SetInvSincFIR(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id,
 								u16 Enable);
 u32 XRFdc_GetInvSincFIR(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id,
 								u16 *Enable);
+int XRFdc_SetMultiBlockSettings(XRFdc* InstancePtr, XRFdc_BlockCfg *BlockCfg,
+								u32 NumBlocks, u32 EventSource);
+int XRFdc_BuildNCOHopTable(XRFdc* InstancePtr, u32 Type, int Tile_Id,
+		u32 Block_Id, const double *Freq, const double *PhaseOffset,
+		u32 NumEntries, u32 EventSource, XRFdc_NCO_Hop_Table *HopTable);
+int XRFdc_NCOHop(XRFdc* InstancePtr, XRFdc_NCO_Hop_Table *HopTable,
+								u32 Entry);
 
 #ifdef __cplusplus
 }
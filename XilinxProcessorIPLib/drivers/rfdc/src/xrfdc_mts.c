@@ -47,6 +47,10 @@
 * 3.2   jm     03/12/18 Fixed DAC latency calculation.
 *       jm     03/12/18 Added support for reloading DTC scans.
 *       jm     03/12/18 Add option to configure sysref capture after MTS.
+*       ag     10/14/26 Store reference markers after MTS, and add
+*                       XRFdc_MultiConverter_Resync() and
+*                       XRFdc_MultiConverter_GetDrift() to re-apply a
+*                       previous MTS result and check it for drift.
 *
 * </pre>
 *
@@ -70,7 +74,7 @@ static u32 XRFdc_MTS_Sysref_Ctrl(XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
 static u32 XRFdc_MTS_Sysref_Dist(XRFdc* InstancePtr, int Num_DAC);
 static u32 XRFdc_MTS_Sysref_Count(XRFdc* InstancePtr, u32 Type, u32 Count_Val);
 static u32 XRFdc_MTS_Dtc_Scan (XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
-							XRFdc_MTS_DTC_Settings* Settings);
+					XRFdc_MTS_DTC_Settings* Settings, u32 Reuse);
 static u32 XRFdc_MTS_Dtc_Code (XRFdc* InstancePtr, u32 Type, u32 BaseAddr,
 			u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl, u16 SRclr_m, u32 Code);
 static u32 XRFdc_MTS_Dtc_Calc (u32 Type, u32 Tile_Id,
@@ -85,6 +89,13 @@ static u32 XRFdc_MTS_Marker_Read(XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
 							u32 FIFO_Id, u32 *Count, u32 *Loc, u32 *Done);
 static u32 XRFdc_MTS_Latency(XRFdc* InstancePtr, u32 Type,
 		XRFdc_MultiConverter_Sync_Config* Config, XRFdc_MTS_Marker* Markers);
+static void XRFdc_MTS_MarkerWords(XRFdc* InstancePtr, u32 Type, u32 RefTile,
+		int *Count_w, int *Loc_w, u32 *Factor);
+static void XRFdc_MTS_SetDelay(XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
+		int Offset);
+static u32 XRFdc_MTS_CheckTiles(XRFdc* InstancePtr, u32 Type, u32 Tiles);
+static u32 XRFdc_MTS_RefMarker(XRFdc* InstancePtr, u32 Type,
+		XRFdc_MultiConverter_Sync_Config* Config, XRFdc_MTS_Marker* Markers);
 
 /*****************************************************************************/
 /**
@@ -554,6 +565,8 @@ static u32 XRFdc_MTS_Dtc_Code (XRFdc* InstancePtr, u32 Type, u32 BaseAddr,
 * @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
 * @param	Tile_Id Valid values are 0-3.
 * @param	Settings dtc settings structure.
+* @param	Reuse skips the scan and programs Settings->DTC_Code[Tile_Id]
+*			as found by a previous scan, when set to 1.
 *
 * @return
 * 		- XRFDC_MTS_OK if successful.
@@ -563,7 +576,7 @@ static u32 XRFdc_MTS_Dtc_Code (XRFdc* InstancePtr, u32 Type, u32 BaseAddr,
 *
 ******************************************************************************/
 static u32 XRFdc_MTS_Dtc_Scan (XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
-							XRFdc_MTS_DTC_Settings* Settings)
+					XRFdc_MTS_DTC_Settings* Settings, u32 Reuse)
 {
 	u32 Status;
     u32 BaseAddr;
@@ -588,17 +601,19 @@ static u32 XRFdc_MTS_Dtc_Scan (XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
 
     SRctl = XRFdc_ReadReg16(InstancePtr, BaseAddr, SRCtrlAddr) & ~SRclr_m;
 
-    for (i = 0; i < XRFDC_MTS_NUM_DTC; i++)
-	Flags[i] = 0;
-    for (i = 0; (i < XRFDC_MTS_NUM_DTC) && (Status == XRFDC_MTS_OK); i++) {
-	Status  |= XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr,
+    if (Reuse == 0U) {
+	for (i = 0; i < XRFDC_MTS_NUM_DTC; i++)
+		Flags[i] = 0;
+	for (i = 0; (i < XRFDC_MTS_NUM_DTC) && (Status == XRFDC_MTS_OK); i++) {
+		Status  |= XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr,
 					SRCtrlAddr, DTCAddr, SRctl, SRclr_m, i);
-	Flags[i] = (XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >>
-					Flag_s) & 0x3;
-    }
+		Flags[i] = (XRFdc_ReadReg16(InstancePtr, BaseAddr,
+					XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3;
+	}
 
 	/* Calculate the best DTC code */
-    XRFdc_MTS_Dtc_Calc(Type, Tile_Id, Settings, Flags);
+	XRFdc_MTS_Dtc_Calc(Type, Tile_Id, Settings, Flags);
+    }
 
 	/* Program the calculated code */
     if ( Settings->DTC_Code[Tile_Id] == - 1 ) {
@@ -861,7 +876,6 @@ static u32 XRFdc_MTS_Latency(XRFdc* InstancePtr, u32 Type,
 	int Count_w;
 	int Loc_w;
 	int i;
-	int Fifo;
 	int Latency;
 	int Offset;
 	int Max_Latency;
@@ -869,24 +883,11 @@ static u32 XRFdc_MTS_Latency(XRFdc* InstancePtr, u32 Type,
 	int Delta;
 	int i_part;
 	int f_part;
-	u32 Read_Words;
 	u32 Factor;
-	u32 BaseAddr;
-	u32 RegAddr;
-	u32 RegData;
 
 	Status = XRFDC_MTS_OK;
-	if (Type == XRFDC_ADC_TILE) {
-		XRFdc_GetDecimationFactor(InstancePtr, Config->RefTile, 0, &Factor);
-	} else {
-		XRFdc_GetInterpolationFactor(InstancePtr, Config->RefTile, 0, &Factor);
-	}
-    XRFdc_GetFabRdVldWords(InstancePtr, Type, Config->RefTile, 0, &Read_Words);
-    Count_w = Read_Words * Factor;
-    Loc_w   = Factor;
-
-    metal_log(METAL_LOG_DEBUG,
-			"Count_w %d, loc_w %d\n", Count_w, Loc_w);
+	XRFdc_MTS_MarkerWords(InstancePtr, Type, Config->RefTile, &Count_w,
+							&Loc_w, &Factor);
 
 	/* Find the individual latencies */
 	Max_Latency=0;
@@ -948,14 +949,7 @@ static u32 XRFdc_MTS_Latency(XRFdc* InstancePtr, u32 Type,
 			}
 
 			/* Adjust the latency, write the same value to each FIFO */
-			BaseAddr = XRFDC_DRP_BASE(Type, i) - 0x2000;
-			for (Fifo = 0; Fifo < 4; Fifo++) {
-				RegAddr  = XRFDC_MTS_DELAY_CTRL + (Fifo << 2);
-				RegData  = XRFdc_ReadReg(InstancePtr, BaseAddr, RegAddr);
-				RegData  = XRFDC_MTS_RMW(RegData, XRFDC_MTS_DELAY_VAL_M,
-										Offset);
-				XRFdc_WriteReg(InstancePtr, BaseAddr, RegAddr, RegData);
-			}
+			XRFdc_MTS_SetDelay(InstancePtr, Type, i, Offset);
 
 			/* Report the total latency for this tile */
 			Config->Latency[i] = Config->Latency[i] + (Offset * Factor);
@@ -1016,6 +1010,8 @@ void XRFdc_MultiConverter_Init (XRFdc_MultiConverter_Sync_Config* Config,
 
 		Config->DTC_Set_PLL.DTC_Code[i] = -1;
 		Config->DTC_Set_T1.DTC_Code[i] = -1;
+		Config->Ref_Markers.Count[i] = 0;
+		Config->Ref_Markers.Loc[i] = 0;
 	}
 
 }
@@ -1047,34 +1043,10 @@ u32 XRFdc_MultiConverter_Sync (XRFdc* InstancePtr, u32 Type,
 	u32 Status;
 	u32 i;
 	u32 RegData;
-	XRFdc_IPStatus IPStatus;
 	XRFdc_MTS_Marker Markers;
 	u32 BaseAddr;
-	u32 TileState;
-
-	Status = XRFDC_MTS_OK;
 
-	XRFdc_GetIPStatus(InstancePtr, &IPStatus);
-	for (i = 0; i < 4; i++) {
-		if (Config->Tiles & (1 << i)) {
-			TileState = (Type == XRFDC_DAC_TILE) ?
-							 IPStatus.DACTileStatus[i].TileState :
-							 IPStatus.ADCTileStatus[i].TileState ;
-			if(TileState != 0xF) {
-				metal_log(METAL_LOG_ERROR,
-				    "%s tile %d in Multi-Tile group not started\n",
-                    (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", i);
-				Status |= XRFDC_MTS_IP_NOT_READY;
-			}
-            BaseAddr = XRFDC_DRP_BASE(Type, i) - XRFDC_TILE_DRP_OFFSET;
-            RegData  = XRFdc_ReadReg(InstancePtr, BaseAddr, XRFDC_MTS_DLY_ALIGNER);
-			if (RegData == 0U) {
-				metal_log(METAL_LOG_ERROR,"%s tile %d is not enabled for MTS, check IP configuration\n",
-					(Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", i);
-				Status |= XRFDC_MTS_NOT_ENABLED;
-			}
-		}
-	}
+	Status = XRFdc_MTS_CheckTiles(InstancePtr, Type, Config->Tiles);
 	if(Status != XRFDC_MTS_OK) return Status;
 
 	/* Disable the FIFOs */
@@ -1100,7 +1072,7 @@ u32 XRFdc_MultiConverter_Sync (XRFdc* InstancePtr, u32 Type,
 				}
 				Config->DTC_Set_PLL.RefTile = Config->RefTile;
 				Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, i,
-									&Config->DTC_Set_PLL);
+									&Config->DTC_Set_PLL, 0U);
 			}
 		}
 	}
@@ -1111,7 +1083,7 @@ u32 XRFdc_MultiConverter_Sync (XRFdc* InstancePtr, u32 Type,
 		if (Config->Tiles & (1 << i)) {
 			Config->DTC_Set_T1 .RefTile = Config->RefTile;
 			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, i,
-									&Config->DTC_Set_T1);
+									&Config->DTC_Set_T1, 0U);
 		}
 	}
 
@@ -1126,5 +1098,332 @@ u32 XRFdc_MultiConverter_Sync (XRFdc* InstancePtr, u32 Type,
 	/* Calculate latency difference and adjust for it */
 	Status |= XRFdc_MTS_Latency(InstancePtr, Type, Config, &Markers);
 
+	/* Keep the aligned markers as reference for re-sync and drift checks */
+	if (Status == XRFDC_MTS_OK) {
+		Status |= XRFdc_MTS_RefMarker(InstancePtr, Type, Config,
+							&Config->Ref_Markers);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the sample weights of the marker count and location
+* fields, as used to convert a marker into a latency.
+*
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	RefTile is the reference tile of the group.
+* @param	Count_w is the weight of one marker count.
+* @param	Loc_w is the weight of one marker location step.
+* @param	Factor is the decimation/interpolation factor of the tile.
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void XRFdc_MTS_MarkerWords(XRFdc* InstancePtr, u32 Type, u32 RefTile,
+		int *Count_w, int *Loc_w, u32 *Factor)
+{
+	u32 Read_Words;
+
+	if (Type == XRFDC_ADC_TILE) {
+		XRFdc_GetDecimationFactor(InstancePtr, RefTile, 0, Factor);
+	} else {
+		XRFdc_GetInterpolationFactor(InstancePtr, RefTile, 0, Factor);
+	}
+	XRFdc_GetFabRdVldWords(InstancePtr, Type, RefTile, 0, &Read_Words);
+	*Count_w = Read_Words * (*Factor);
+	*Loc_w   = *Factor;
+
+	metal_log(METAL_LOG_DEBUG,
+			"Count_w %d, loc_w %d\n", *Count_w, *Loc_w);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the alignment delay of a tile to each of its FIFOs.
+*
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	Tile_Id Valid values are 0-3.
+* @param	Offset is the delay in FIFO words.
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void XRFdc_MTS_SetDelay(XRFdc* InstancePtr, u32 Type, u32 Tile_Id,
+		int Offset)
+{
+	u32 BaseAddr;
+	u32 RegAddr;
+	u32 RegData;
+	int Fifo;
+
+	BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) - 0x2000;
+	for (Fifo = 0; Fifo < 4; Fifo++) {
+		RegAddr  = XRFDC_MTS_DELAY_CTRL + (Fifo << 2);
+		RegData  = XRFdc_ReadReg(InstancePtr, BaseAddr, RegAddr);
+		RegData  = XRFDC_MTS_RMW(RegData, XRFDC_MTS_DELAY_VAL_M, Offset);
+		XRFdc_WriteReg(InstancePtr, BaseAddr, RegAddr, RegData);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks that all tiles of a group are started and have MTS
+* enabled in the IP.
+*
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	Tiles is the tile mask of the group.
+*
+* @return
+* 		- XRFDC_MTS_OK if successful.
+* 		- XRFDC_MTS_IP_NOT_READY
+* 		- XRFDC_MTS_NOT_ENABLED
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XRFdc_MTS_CheckTiles(XRFdc* InstancePtr, u32 Type, u32 Tiles)
+{
+	u32 Status;
+	u32 i;
+	u32 RegData;
+	XRFdc_IPStatus IPStatus;
+	u32 BaseAddr;
+	u32 TileState;
+
+	Status = XRFDC_MTS_OK;
+
+	XRFdc_GetIPStatus(InstancePtr, &IPStatus);
+	for (i = 0; i < 4; i++) {
+		if (Tiles & (1 << i)) {
+			TileState = (Type == XRFDC_DAC_TILE) ?
+							 IPStatus.DACTileStatus[i].TileState :
+							 IPStatus.ADCTileStatus[i].TileState ;
+			if(TileState != 0xF) {
+				metal_log(METAL_LOG_ERROR,
+				    "%s tile %d in Multi-Tile group not started\n",
+                    (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", i);
+				Status |= XRFDC_MTS_IP_NOT_READY;
+			}
+            BaseAddr = XRFDC_DRP_BASE(Type, i) - XRFDC_TILE_DRP_OFFSET;
+            RegData  = XRFdc_ReadReg(InstancePtr, BaseAddr, XRFDC_MTS_DLY_ALIGNER);
+			if (RegData == 0U) {
+				metal_log(METAL_LOG_ERROR,"%s tile %d is not enabled for MTS, check IP configuration\n",
+					(Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", i);
+				Status |= XRFDC_MTS_NOT_ENABLED;
+			}
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the markers of an aligned group, and restores the final
+* SysRef capture state that reading the DAC markers changes.
+*
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	Config is mts config structure.
+* @param	Markers is mts marker structure the markers are returned in.
+*
+* @return
+* 		- XRFDC_MTS_OK if successful.
+* 		- XRFDC_MTS_TIMEOUT if timeout occurs.
+* 		- XRFDC_MTS_MARKER_RUN
+* 		- XRFDC_MTS_MARKER_MISM
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XRFdc_MTS_RefMarker(XRFdc* InstancePtr, u32 Type,
+		XRFdc_MultiConverter_Sync_Config* Config, XRFdc_MTS_Marker* Markers)
+{
+	u32 Status;
+	u32 i;
+
+	Status = XRFdc_MTS_GetMarker(InstancePtr, Type, Config->Tiles, Markers,
+							Config->Marker_Delay);
+	for (i = 0; i < 4; i++) {
+		if (Config->Tiles & (1 << i)) {
+			XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, i, 0,
+							Config->SysRef_Enable, 0);
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API re-applies the result of a previous XRFdc_MultiConverter_Sync()
+* on the same Config, for example after a tile restart or a clock glitch.
+* The DTC codes found by the previous scans and the alignment delays are
+* programmed again without scanning or measuring the latency, and the
+* markers are then compared against the reference markers of that sync.
+*
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	Config Multi-tile sync config structure of a previous sync.
+*
+* @return
+* 		- XRFDC_MTS_OK if successful.
+*		- XRFDC_MTS_TIMEOUT if timeout occurs.
+* 		- XRFDC_MTS_DTC_INVALID if Config holds no previous sync result.
+* 		- XRFDC_MTS_MARKER_DRIFT if the markers moved, a full
+*		  XRFdc_MultiConverter_Sync() is needed then.
+*
+* @note		None
+*
+******************************************************************************/
+u32 XRFdc_MultiConverter_Resync (XRFdc* InstancePtr, u32 Type,
+						XRFdc_MultiConverter_Sync_Config* Config)
+{
+	u32 Status;
+	u32 i;
+	u32 RegData;
+	u32 BaseAddr;
+	u32 IsPLL[4];
+	int Drift[4];
+
+	Status = XRFdc_MTS_CheckTiles(InstancePtr, Type, Config->Tiles);
+	if(Status != XRFDC_MTS_OK) return Status;
+
+	for (i = 0; i < 4; i++) {
+		IsPLL[i] = 0U;
+		if (Config->Tiles & (1 << i)) {
+			BaseAddr = XRFDC_DRP_BASE(Type, i) + XRFDC_HSCOM_ADDR;
+			RegData  = XRFdc_ReadReg16(InstancePtr, BaseAddr,
+								XRFDC_MTS_CLKSTAT);
+			IsPLL[i] = (RegData & XRFDC_MTS_PLLEN_M) ? 1U : 0U;
+			if ((Config->DTC_Set_T1.DTC_Code[i] == -1) ||
+				((IsPLL[i] != 0U) &&
+				(Config->DTC_Set_PLL.DTC_Code[i] == -1))) {
+				metal_log(METAL_LOG_ERROR,
+					"No previous MTS result for %s tile %d\n",
+					(Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", i);
+				Status |= XRFDC_MTS_DTC_INVALID;
+			}
+		}
+	}
+	if(Status != XRFDC_MTS_OK) return Status;
+
+	/* Disable the FIFOs */
+	XRFdc_MTS_FIFOCtrl(InstancePtr, Type, XRFDC_MTS_FIFO_DISABLE, 0);
+
+	/* Enable SysRef Rx */
+	Status |= XRFdc_MTS_Sysref_TRx(InstancePtr, 1);
+
+	/* Update distribution */
+	Status |= XRFdc_MTS_Sysref_Dist(InstancePtr, -1);
+
+	/* Program the DTC codes of the previous scans */
+	for (i = 0; i < 4; i++) {
+		if ((Config->Tiles & (1 << i)) && (IsPLL[i] != 0U)) {
+			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, i,
+									&Config->DTC_Set_PLL, 1U);
+		}
+	}
+	for (i = 0; i < 4; i++) {
+		if (Config->Tiles & (1 << i)) {
+			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, i,
+									&Config->DTC_Set_T1, 1U);
+		}
+	}
+
+	/* Enable FIFOs */
+	XRFdc_MTS_FIFOCtrl(InstancePtr, Type, XRFDC_MTS_FIFO_ENABLE,
+									Config->Tiles);
+
+	/* Restore the alignment delays */
+	for (i = 0; i < 4; i++) {
+		if (Config->Tiles & (1 << i)) {
+			XRFdc_MTS_SetDelay(InstancePtr, Type, i, Config->Offset[i]);
+			XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, i, 0,
+							Config->SysRef_Enable, 0);
+		}
+	}
+
+	if (Status == XRFDC_MTS_OK) {
+		Status |= XRFdc_MultiConverter_GetDrift(InstancePtr, Type, Config,
+									Drift);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API measures how far the markers of an aligned group moved since the
+* last XRFdc_MultiConverter_Sync() on Config. Only the marker counter is
+* run, for a few SysRef periods, the DTC scans are not repeated.
+*
+*
+* @param	InstancePtr is a pointer to the XRfdc instance.
+* @param	Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param	Config Multi-tile sync config structure of a previous sync.
+* @param	Drift is an array of 4 entries the per tile drift in samples is
+*			returned in, 0 for tiles not in the group.
+*
+* @return
+* 		- XRFDC_MTS_OK if no tile drifted.
+*		- XRFDC_MTS_TIMEOUT if timeout occurs.
+* 		- XRFDC_MTS_MARKER_RUN
+* 		- XRFDC_MTS_MARKER_MISM
+* 		- XRFDC_MTS_MARKER_DRIFT if any tile drifted.
+*
+* @note		None
+*
+******************************************************************************/
+u32 XRFdc_MultiConverter_GetDrift (XRFdc* InstancePtr, u32 Type,
+				XRFdc_MultiConverter_Sync_Config* Config, int *Drift)
+{
+	u32 Status;
+	u32 i;
+	int Count_w;
+	int Loc_w;
+	u32 Factor;
+	XRFdc_MTS_Marker Markers;
+
+	XRFdc_MTS_MarkerWords(InstancePtr, Type, Config->RefTile, &Count_w,
+							&Loc_w, &Factor);
+	Status = XRFdc_MTS_RefMarker(InstancePtr, Type, Config, &Markers);
+
+	for (i = 0; i < 4; i++) {
+		Drift[i] = 0;
+		if (Config->Tiles & (1 << i)) {
+			Drift[i] = (((int)Markers.Count[i] -
+					(int)Config->Ref_Markers.Count[i]) * Count_w) +
+					(((int)Markers.Loc[i] -
+					(int)Config->Ref_Markers.Loc[i]) * Loc_w);
+			if (Drift[i] != 0) {
+				metal_log(METAL_LOG_INFO,
+					"%s%d: Marker drift %d\n", (Type == XRFDC_DAC_TILE) ?
+					"DAC" : "ADC", i, Drift[i]);
+				Status |= XRFDC_MTS_MARKER_DRIFT;
+			}
+		}
+	}
+
 	return Status;
 }
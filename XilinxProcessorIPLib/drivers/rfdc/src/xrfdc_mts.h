@@ -47,6 +47,8 @@
 * 3.2   jm     03/12/18 Fixed DAC latency calculation.
 *       jm     03/12/18 Added support for reloading DTC scans.
 *       jm     03/12/18 Add option to configure sysref capture after MTS.
+*       ag     10/14/26 Add reference markers to the sync config, and API's
+*                       to re-sync from a previous result and check drift.
 *
 * </pre>
 *
@@ -83,6 +85,11 @@ typedef struct {
 	int Max_Overlap[4];
 } XRFdc_MTS_DTC_Settings;
 
+typedef struct {
+	u32 Count[4];
+	u32 Loc[4];
+} XRFdc_MTS_Marker;
+
 typedef struct {
 	u32 RefTile;
 	u32 Tiles;
@@ -93,13 +100,9 @@ typedef struct {
 	int SysRef_Enable;
 	XRFdc_MTS_DTC_Settings DTC_Set_PLL;
 	XRFdc_MTS_DTC_Settings DTC_Set_T1;
+	XRFdc_MTS_Marker Ref_Markers;	/* Markers once aligned */
 } XRFdc_MultiConverter_Sync_Config;
 
-typedef struct {
-	u32 Count[4];
-	u32 Loc[4];
-} XRFdc_MTS_Marker;
-
 /***************** Macros (Inline Functions) Definitions *********************/
 
 #ifdef __MICROBLAZE__
@@ -144,6 +147,7 @@ typedef struct {
 #define XRFDC_MTS_TARGET_LOW		32L
 #define XRFDC_MTS_IP_NOT_READY      64L
 #define XRFDC_MTS_DTC_INVALID       128L
+#define XRFDC_MTS_MARKER_DRIFT      256L
 #define XRFDC_MTS_NOT_ENABLED       512L
 
 
@@ -178,6 +182,10 @@ u32 XRFdc_MultiConverter_Sync (XRFdc* InstancePtr, u32 Type,
 							XRFdc_MultiConverter_Sync_Config* Config);
 void XRFdc_MultiConverter_Init (XRFdc_MultiConverter_Sync_Config* Config,
 						int *PLL_Codes, int *T1_Codes);
+u32 XRFdc_MultiConverter_Resync (XRFdc* InstancePtr, u32 Type,
+							XRFdc_MultiConverter_Sync_Config* Config);
+u32 XRFdc_MultiConverter_GetDrift (XRFdc* InstancePtr, u32 Type,
+				XRFdc_MultiConverter_Sync_Config* Config, int *Drift);
 
 
 #ifdef __cplusplus
@@ -92,6 +92,16 @@
 * application specific interrupt handling. An application registers its own
 * handler through the XRtcPsu_SetHandler() function.
 *
+* <b>Time service</b>
+*
+* Reading the time with XRtcPsu_GetCurrentTime() accesses the RTC registers
+* and has a resolution of one second. On the ARM processors, the time service
+* started with XRtcPsu_TimeInitialize() keeps the RTC time of the last
+* seconds interrupt together with the timeline timestamp of that interrupt.
+* XRtcPsu_TimeGet() then gives the time in microseconds from the timestamp
+* counter alone. With GCC the service also becomes the source of
+* gettimeofday(), which is used by xilffs for the file time stamps.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -109,6 +119,7 @@
 *                       doxygen examples.
 * 1.5   ms     08/27/17 Fixed compilation warnings in xrtcpsu.c file.
 *       ms     08/29/17 Updated the code as per source code style.
+*       ag     10/14/26 Added the time service in xrtcpsu_time.c.
 * </pre>
 *
 ******************************************************************************/
@@ -128,6 +139,7 @@ extern "C" {
 #include "xil_io.h"
 #include "xrtcpsu_hw.h"
 #include "xil_types.h"
+#include "xparameters.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -146,6 +158,13 @@ extern "C" {
 #define XRTCPSU_CRYSTAL_OSC_EN		(u32)1 << XRTC_CTL_OSC_SHIFT
 /**< Separate Mask for Crystal oscillator bit Enable */
 
+#if defined (ARMR5) || defined (__aarch64__) || defined (ARMA53_32)
+#define XRTCPSU_TIME_SERVICE	/**< Time service is available */
+#endif
+
+#define XRTCPSU_UNIX_EPOCH_OFFSET	946684800U
+/**< Seconds from 1970-01-01 to 2000-01-01, the start of the RTC time */
+
 /**************************** Type Definitions *******************************/
 
 /******************************************************************************/
@@ -205,6 +224,21 @@ typedef struct {
 	u32 WeekDay;
 } XRtcPsu_DT;
 
+/**
+ * Time service state. The user allocates one per RTC and starts it with
+ * XRtcPsu_TimeInitialize().
+ */
+typedef struct {
+	XRtcPsu *RtcPtr;		/**< RTC instance */
+	volatile u32 Seq;		/**< Odd while the fields below change */
+	volatile u32 Seconds;		/**< RTC time at the last seconds
+					  *  interrupt */
+	volatile u64 Stamp;		/**< Timeline count at the last seconds
+					  *  interrupt */
+	XRtcPsu_Handler Handler;	/**< Application event handler */
+	void *CallBackRef;		/**< Callback reference of Handler */
+} XRtcPsu_Time;
+
 
 /************************* Variable Definitions ******************************/
 
@@ -389,6 +423,15 @@ void XRtcPsu_InterruptHandler(XRtcPsu *InstancePtr);
 void XRtcPsu_SetHandler(XRtcPsu *InstancePtr, XRtcPsu_Handler FuncPtr,
 			 void *CallBackRef);
 
+#ifdef XRTCPSU_TIME_SERVICE
+/* Functions in xrtcpsu_time.c */
+s32 XRtcPsu_TimeInitialize(XRtcPsu_Time *TimePtr, XRtcPsu *InstancePtr);
+void XRtcPsu_TimeSetHandler(XRtcPsu_Time *TimePtr, XRtcPsu_Handler FuncPtr,
+			 void *CallBackRef);
+void XRtcPsu_TimeGet(XRtcPsu_Time *TimePtr, u32 *Sec, u32 *USec);
+s32 XRtcPsu_TimeOfDay(void *CallBackRef, u32 *Sec, u32 *USec);
+#endif
+
 /* Functions in xrtcpsu_selftest.c */
 s32 XRtcPsu_SelfTest(XRtcPsu *InstancePtr);
 
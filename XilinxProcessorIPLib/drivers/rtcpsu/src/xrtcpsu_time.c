@@ -0,0 +1,256 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xrtcpsu_time.c
+* @addtogroup rtcpsu_v1_5
+* @{
+*
+* This file contains the time service of the RTC driver.
+*
+* The seconds interrupt handler stores the RTC time and the timeline count
+* (see xil_timeline.h) of the interrupt. XRtcPsu_TimeGet() adds the timeline
+* counts elapsed since then, so it reads no RTC register and can be used to
+* time stamp log records. The two values are published with a sequence
+* counter, readers retry when the interrupt handler updated them meanwhile.
+*
+* XRtcPsu_InterruptHandler() must be connected to the interrupt system by the
+* application. Time set with XRtcPsu_SetTime() is seen from the next seconds
+* interrupt on.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------
+* 1.5   ag     10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xrtcpsu.h"
+
+#ifdef XRTCPSU_TIME_SERVICE
+#include "xil_timeline.h"
+#include "xpseudo_asm.h"
+
+/************************** Function Prototypes ******************************/
+
+static void XRtcPsu_TimeHandler(void *CallBackRef, u32 Event);
+
+/************************** Function Definitions *****************************/
+
+/****************************************************************************/
+/**
+*
+* This function starts the time service of an RTC. It takes over the event
+* handler of the instance, calls the handler set before from it and enables
+* the seconds interrupt. With GCC the service becomes the source of
+* gettimeofday().
+*
+* @param	TimePtr is a pointer to the time service state.
+* @param	InstancePtr is a pointer to the XRtcPsu instance.
+*
+* @return	XST_SUCCESS.
+*
+* @note		Until the first seconds interrupt the fraction of the second
+*		is not known, the time can then be up to one second late.
+*
+*****************************************************************************/
+s32 XRtcPsu_TimeInitialize(XRtcPsu_Time *TimePtr, XRtcPsu *InstancePtr)
+{
+	Xil_AssertNonvoid(TimePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	TimePtr->RtcPtr = InstancePtr;
+	TimePtr->Handler = InstancePtr->Handler;
+	TimePtr->CallBackRef = InstancePtr->CallBackRef;
+	TimePtr->Seq = 0U;
+	TimePtr->Stamp = Xil_TimelineNow();
+	TimePtr->Seconds = XRtcPsu_GetCurrentTime(InstancePtr);
+
+	XRtcPsu_SetHandler(InstancePtr, XRtcPsu_TimeHandler, TimePtr);
+	XRtcPsu_SetInterruptMask(InstancePtr, XRTC_INT_EN_SECS_MASK);
+
+#if defined (__GNUC__)
+	Xil_SetTimeOfDayHook(XRtcPsu_TimeOfDay, TimePtr);
+#endif
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets the application event handler of an RTC with a running
+* time service. It is called from the interrupt handler after the time has
+* been updated.
+*
+* @param	TimePtr is a pointer to the time service state.
+* @param	FuncPtr is the pointer to the callback function.
+* @param	CallBackRef is passed back when the callback function is
+*		invoked.
+*
+* @return	None.
+*
+* @note		XRtcPsu_SetHandler() must not be used once the time service
+*		runs.
+*
+*****************************************************************************/
+void XRtcPsu_TimeSetHandler(XRtcPsu_Time *TimePtr, XRtcPsu_Handler FuncPtr,
+			 void *CallBackRef)
+{
+	Xil_AssertVoid(TimePtr != NULL);
+	Xil_AssertVoid(FuncPtr != NULL);
+
+	TimePtr->Handler = NULL;
+	TimePtr->CallBackRef = CallBackRef;
+	TimePtr->Handler = FuncPtr;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the current time without accessing the RTC.
+*
+* @param	TimePtr is a pointer to the time service state.
+* @param	Sec is where the RTC time in seconds is stored.
+* @param	USec is where the microseconds within the second are stored.
+*
+* @return	None.
+*
+* @note		The time does not pass the next second before its interrupt
+*		has been handled, unless the interrupt is more than a second
+*		late. This keeps the time monotonic when the timestamp counter
+*		runs faster than the RTC.
+*
+*****************************************************************************/
+void XRtcPsu_TimeGet(XRtcPsu_Time *TimePtr, u32 *Sec, u32 *USec)
+{
+	u32 Seq;
+	u32 Seconds;
+	u64 Stamp;
+	u64 Delta;
+	u64 Now;
+
+	Xil_AssertVoid(TimePtr != NULL);
+	Xil_AssertVoid(Sec != NULL);
+	Xil_AssertVoid(USec != NULL);
+
+	do {
+		Seq = TimePtr->Seq;
+		dmb();
+		Seconds = TimePtr->Seconds;
+		Stamp = TimePtr->Stamp;
+		dmb();
+	} while (((Seq & 1U) != 0U) || (Seq != TimePtr->Seq));
+
+	Now = Xil_TimelineNow();
+	Delta = (Now > Stamp) ? (Now - Stamp) : 0U;
+	if ((Delta >= XIL_TIMELINE_COUNTS_PER_SECOND) &&
+		(Delta < (2U * XIL_TIMELINE_COUNTS_PER_SECOND))) {
+		/* Seconds interrupt pending */
+		Delta = XIL_TIMELINE_COUNTS_PER_SECOND - 1U;
+	}
+
+	*Sec = Seconds + (u32)(Delta / XIL_TIMELINE_COUNTS_PER_SECOND);
+	*USec = (u32)Xil_TimelineCountsToUs(Delta %
+					XIL_TIMELINE_COUNTS_PER_SECOND);
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the time of day source given to Xil_SetTimeOfDayHook(). It
+* returns the time since 1970-01-01 as gettimeofday() does.
+*
+* @param	CallBackRef is a pointer to the time service state.
+* @param	Sec is where the seconds are stored.
+* @param	USec is where the microseconds are stored.
+*
+* @return	XST_SUCCESS.
+*
+* @note		None.
+*
+*****************************************************************************/
+s32 XRtcPsu_TimeOfDay(void *CallBackRef, u32 *Sec, u32 *USec)
+{
+	XRtcPsu_Time *TimePtr = (XRtcPsu_Time *)CallBackRef;
+
+	XRtcPsu_TimeGet(TimePtr, Sec, USec);
+	*Sec += XRTCPSU_UNIX_EPOCH_OFFSET;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Event handler of the time service. On a seconds interrupt it stores the RTC
+* time with the timeline count, then it calls the application handler.
+*
+* @param	CallBackRef is a pointer to the time service state.
+* @param	Event is the RTC event.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XRtcPsu_TimeHandler(void *CallBackRef, u32 Event)
+{
+	XRtcPsu_Time *TimePtr = (XRtcPsu_Time *)CallBackRef;
+	XRtcPsu_Handler Handler;
+	u32 Seconds;
+	u64 Now;
+
+	if (Event == XRTCPSU_EVENT_SECS_GEN) {
+		Now = Xil_TimelineNow();
+		Seconds = XRtcPsu_GetCurrentTime(TimePtr->RtcPtr);
+
+		TimePtr->Seq++;
+		dmb();
+		TimePtr->Seconds = Seconds;
+		TimePtr->Stamp = Now;
+		dmb();
+		TimePtr->Seq++;
+	}
+
+	Handler = TimePtr->Handler;
+	if (Handler != NULL) {
+		Handler(TimePtr->CallBackRef, Event);
+	}
+}
+#endif
+/** @} */
@@ -79,6 +79,15 @@
 *
 * Nested interrupts are not supported by this driver.
 *
+* <b>Deferred Interrupt Processing</b>
+*
+* A vector may be connected in threaded mode with XScuGic_ConnectDeferred().
+* Its handler is then not called from XScuGic_InterruptHandler(). Instead the
+* source is masked and queued on an XScuGic_DeferredQueue, and the handler is
+* called later by XScuGic_DeferredRun() from a low priority SGI or an RTOS task.
+* This keeps long device handlers from adding to the latency of high priority
+* interrupts. See xscugic_deferred.c for details.
+*
 * NOTE:
 * The generic interrupt controller is not a part of the snoop control unit
 * as indicated by the prefix "scu" in the name of the driver.
@@ -179,6 +188,12 @@
 *                     XScuGic_InterruptUnmapFromCpu, These API's can be used
 *                     by applications to unmap specific/all interrupts from
 *                     target CPU.
+*       ag   10/14/26 Added deferred (bottom-half) interrupt processing in
+*                     xscugic_deferred.c, see XScuGic_ConnectDeferred.
+*       ag   10/14/26 Added the SPI affinity manager in xscugic_affinity.c,
+*                     see XScuGic_AffinityConnect.
+*       ag   10/14/26 Added optional per-vector handler time statistics,
+*                     enabled with XSCUGIC_ISR_STATS, in xscugic_stats.c.
 *
 * </pre>
 *
@@ -207,6 +222,31 @@ extern "C" {
 #if !defined (ARMR5) && !defined (__aarch64__) && !defined (ARMA53_32)
 #define ARMA9
 #endif
+
+/** @name Deferred interrupt processing
+ * @{
+ */
+#define XSCUGIC_DEFERRED_MAX_VECTORS	16U /**< Vectors per queue, must be a
+					      power of 2 and at most 32 */
+#define XSCUGIC_DEFERRED_DONE		0U  /**< Handler is done, unmask the
+					      source */
+#define XSCUGIC_DEFERRED_RESCHEDULE	1U  /**< Handler has more work, call
+					      it again */
+#define XSCUGIC_DEFERRED_NO_SOFTIRQ	0xFFFFFFFFU /**< No SGI assigned */
+/*@}*/
+
+/** @name SPI affinity manager policies and limits
+ * @{
+ */
+#define XSCUGIC_AFFINITY_STATIC		0U /**< Fixed CPU per vector */
+#define XSCUGIC_AFFINITY_ROUND_ROBIN	1U /**< CPUs used in turn */
+#define XSCUGIC_AFFINITY_LOAD		2U /**< Rebalanced by interrupt
+					     count */
+#define XSCUGIC_AFFINITY_MAX_CPUS	8U  /**< CPU interfaces of a GICv2 */
+#define XSCUGIC_AFFINITY_MAX_VECTORS	32U /**< Vectors per manager */
+#define XSCUGIC_AFFINITY_ANY		0xFFFFFFFFU /**< Let the policy
+						     choose the CPU */
+/*@}*/
 /**************************** Type Definitions *******************************/
 
 /* The following data type defines each entry in an interrupt vector table.
@@ -243,6 +283,94 @@ typedef struct
 	u32 UnhandledInterrupts; /**< Intc Statistics */
 } XScuGic;
 
+/**
+ * Bottom-half handler of a deferred vector. It returns XSCUGIC_DEFERRED_DONE
+ * or XSCUGIC_DEFERRED_RESCHEDULE.
+ */
+typedef u32 (*XScuGic_DeferredHandler)(void *CallBackRef);
+
+/**
+ * Callback used by the top half to wake the bottom-half thread.
+ */
+typedef void (*XScuGic_DeferredNotify)(void *CallBackRef);
+
+struct XScuGic_DeferredQueueS;
+
+/**
+ * One deferred vector.
+ */
+typedef struct
+{
+	XScuGic_DeferredHandler Handler; /**< Bottom-half handler */
+	void *CallBackRef;		 /**< Argument to Handler */
+	struct XScuGic_DeferredQueueS *QueuePtr; /**< Owning queue */
+	u16 IntId;			 /**< Interrupt source */
+	u16 Index;			 /**< Index in the queue entry table */
+	u32 RunCount;			 /**< Number of bottom-half calls */
+} XScuGic_DeferredEntry;
+
+/**
+ * Deferred interrupt queue. The user allocates one per interrupt controller
+ * and initializes it with XScuGic_DeferredInitialize().
+ */
+typedef struct XScuGic_DeferredQueueS
+{
+	XScuGic *InstancePtr;		/**< Interrupt controller */
+	XScuGic_DeferredEntry Entry[XSCUGIC_DEFERRED_MAX_VECTORS]; /**<
+					     Deferred vectors */
+	u32 NumEntries;			/**< Entries in use */
+	volatile u32 Ring[XSCUGIC_DEFERRED_MAX_VECTORS]; /**< Queued entry
+					     indexes */
+	volatile u32 Head;		/**< Written by the top half only */
+	volatile u32 Tail;		/**< Written by the bottom half only */
+	u32 ReschedMask;		/**< Entries to run again */
+	u32 SoftIntId;			/**< SGI kicking the bottom half */
+	XScuGic_DeferredNotify NotifyHandler; /**< Bottom-half wake up */
+	void *NotifyRef;		/**< Argument to NotifyHandler */
+} XScuGic_DeferredQueue;
+
+/**
+ * One SPI managed by the affinity manager.
+ */
+typedef struct
+{
+	Xil_InterruptHandler Handler;	/**< User interrupt handler */
+	void *CallBackRef;		/**< Argument to Handler */
+	volatile u32 Count;		/**< Interrupts taken */
+	u32 LastCount;			/**< Count at the last rebalance */
+	u16 IntId;			/**< Interrupt source */
+	u8 Cpu;				/**< CPU the SPI is routed to */
+	u8 Pinned;			/**< Not moved by rebalancing */
+} XScuGic_AffinityEntry;
+
+/**
+ * SPI affinity manager. The user allocates one per interrupt controller and
+ * initializes it with XScuGic_AffinityInitialize().
+ */
+typedef struct
+{
+	XScuGic *InstancePtr;		/**< Interrupt controller */
+	u32 Policy;			/**< XSCUGIC_AFFINITY_* policy */
+	u32 CpuMask;			/**< CPUs interrupts may go to */
+	u32 NextCpu;			/**< Next round robin CPU */
+	u32 NumEntries;			/**< Entries in use */
+	XScuGic_AffinityEntry Entry[XSCUGIC_AFFINITY_MAX_VECTORS]; /**<
+					     Managed SPIs */
+} XScuGic_AffinityMgr;
+
+#ifdef XSCUGIC_ISR_STATS
+/**
+ * Handler statistics of one interrupt ID, times in XTime ticks.
+ */
+typedef struct
+{
+	u32 Count;			/**< Handler runs */
+	u32 MinTicks;			/**< Shortest handler run */
+	u32 MaxTicks;			/**< Longest handler run */
+	u64 TotalTicks;			/**< Sum of all handler runs */
+} XScuGic_IsrStats;
+#endif
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /****************************************************************************/
@@ -359,6 +487,40 @@ XScuGic_Config *XScuGic_LookupConfig(u16 DeviceId);
  */
 void XScuGic_InterruptHandler(XScuGic *InstancePtr);
 
+/*
+ * Deferred interrupt functions in xscugic_deferred.c
+ */
+void XScuGic_DeferredInitialize(XScuGic_DeferredQueue *QueuePtr,
+				XScuGic *InstancePtr);
+s32  XScuGic_ConnectDeferred(XScuGic_DeferredQueue *QueuePtr, u32 Int_Id,
+			XScuGic_DeferredHandler Handler, void *CallBackRef);
+s32  XScuGic_DeferredSetSoftIrq(XScuGic_DeferredQueue *QueuePtr, u32 SgiId);
+void XScuGic_DeferredSetNotify(XScuGic_DeferredQueue *QueuePtr,
+			XScuGic_DeferredNotify NotifyHandler, void *NotifyRef);
+u32  XScuGic_DeferredRun(XScuGic_DeferredQueue *QueuePtr, u32 Budget);
+
+/*
+ * SPI affinity functions in xscugic_affinity.c
+ */
+void XScuGic_AffinityInitialize(XScuGic_AffinityMgr *MgrPtr,
+			XScuGic *InstancePtr, u32 Policy, u32 CpuMask);
+s32  XScuGic_AffinityConnect(XScuGic_AffinityMgr *MgrPtr, u32 Int_Id,
+		Xil_InterruptHandler Handler, void *CallBackRef, u32 Cpu);
+s32  XScuGic_AffinitySetCpu(XScuGic_AffinityMgr *MgrPtr, u32 Int_Id, u32 Cpu);
+u32  XScuGic_AffinityRebalance(XScuGic_AffinityMgr *MgrPtr);
+u32  XScuGic_AffinityGetCount(XScuGic_AffinityMgr *MgrPtr, u32 Int_Id,
+				u32 *CpuPtr);
+
+#ifdef XSCUGIC_ISR_STATS
+/*
+ * Handler statistics functions in xscugic_stats.c
+ */
+void XScuGic_IsrStatsUpdate(u32 Int_Id, u32 Ticks);
+u32  XScuGic_IsrStatsGet(u32 Int_Id, XScuGic_IsrStats *StatsPtr);
+void XScuGic_IsrStatsReset(u32 Int_Id);
+void XScuGic_IsrStatsPrint(u32 BudgetUs);
+#endif
+
 /*
  * Self-test functions in xscugic_selftest.c
  */
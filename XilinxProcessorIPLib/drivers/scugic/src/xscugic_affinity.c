@@ -0,0 +1,468 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xscugic_affinity.c
+* @addtogroup scugic_v3_8
+* @{
+*
+* This file contains an SPI affinity manager for SMP systems where several
+* CPUs run the same image and take interrupts from the same distributor. A
+* vector connected through XScuGic_AffinityConnect() is routed to a single CPU
+* chosen by the manager policy:
+*   - XSCUGIC_AFFINITY_STATIC: the CPU given at connect time.
+*   - XSCUGIC_AFFINITY_ROUND_ROBIN: CPUs of the manager CPU mask are used in
+*     turn as vectors are connected.
+*   - XSCUGIC_AFFINITY_LOAD: vectors start as for round robin, and
+*     XScuGic_AffinityRebalance(), called periodically by the application,
+*     moves them so that the number of interrupts taken since the previous
+*     call is spread evenly over the CPUs. Vectors connected with an explicit
+*     CPU stay on that CPU.
+*
+* Per-vector interrupt counts are kept by a small wrapper installed in the
+* vector table in front of the user handler.
+*
+* The vector table in XScuGic_Config is shared by all CPUs, and
+* XScuGic_Connect() writes the handler and its callback reference one after
+* the other. A CPU taking the interrupt in between would call the new handler
+* with the old reference. The manager therefore masks the source, updates the
+* entry, and issues a barrier before the source is unmasked again. The target
+* of an SPI is changed with a byte write to its GICD_ITARGETSR field so that
+* two CPUs moving different vectors of the same register do not race.
+*
+* The manager must not be used in AMP configurations, where each image has
+* its own vector table and an SPI routed to another CPU would not find its
+* handler there.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------------
+* 3.9   ag   10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_io.h"
+#include "xscugic.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static void XScuGic_AffinityHandler(void *CallBackRef);
+static void XScuGic_AffinityRoute(XScuGic_AffinityMgr *MgrPtr,
+				XScuGic_AffinityEntry *EntryPtr, u32 Cpu);
+static u32 XScuGic_AffinityNextCpu(XScuGic_AffinityMgr *MgrPtr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* Initializes an affinity manager.
+*
+* @param	MgrPtr is a pointer to the manager to initialize.
+* @param	InstancePtr is a pointer to a ready XScuGic instance.
+* @param	Policy is XSCUGIC_AFFINITY_STATIC, XSCUGIC_AFFINITY_ROUND_ROBIN
+*		or XSCUGIC_AFFINITY_LOAD.
+* @param	CpuMask is the set of CPUs, one bit per CPU, that the manager
+*		may route interrupts to. All of them must be running this image
+*		with their CPU interface initialized.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XScuGic_AffinityInitialize(XScuGic_AffinityMgr *MgrPtr,
+			XScuGic *InstancePtr, u32 Policy, u32 CpuMask)
+{
+	Xil_AssertVoid(MgrPtr != NULL);
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Policy <= XSCUGIC_AFFINITY_LOAD);
+	Xil_AssertVoid((CpuMask != 0U) &&
+			(CpuMask < ((u32)1U << XSCUGIC_AFFINITY_MAX_CPUS)));
+
+	MgrPtr->InstancePtr = InstancePtr;
+	MgrPtr->Policy = Policy;
+	MgrPtr->CpuMask = CpuMask;
+	MgrPtr->NextCpu = 0U;
+	MgrPtr->NumEntries = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Connects a handler to an SPI and routes the SPI to a CPU. The vector table
+* entry is updated with the source masked so that no CPU can see a partly
+* written entry. If the source was enabled it is enabled again afterwards.
+*
+* @param	MgrPtr is a pointer to the affinity manager.
+* @param	Int_Id is the SPI, 32 to XSCUGIC_MAX_NUM_INTR_INPUTS - 1.
+* @param	Handler is the interrupt handler.
+* @param	CallBackRef is passed to Handler when it is called.
+* @param	Cpu is the CPU to route the SPI to, or XSCUGIC_AFFINITY_ANY to
+*		let the policy choose. A CPU given here is never changed by
+*		XScuGic_AffinityRebalance(). XSCUGIC_AFFINITY_STATIC requires a
+*		CPU.
+*
+* @return
+*		- XST_SUCCESS if the handler was connected.
+*		- XST_FAILURE if the manager is full or Cpu is not usable.
+*
+* @note		Connecting an SPI that is already managed replaces its handler
+*		and routing. Its interrupt count is kept. This function must not
+*		be called from the handler of Int_Id itself.
+*
+******************************************************************************/
+s32 XScuGic_AffinityConnect(XScuGic_AffinityMgr *MgrPtr, u32 Int_Id,
+		Xil_InterruptHandler Handler, void *CallBackRef, u32 Cpu)
+{
+	XScuGic_VectorTableEntry *TablePtr;
+	XScuGic_AffinityEntry *EntryPtr = NULL;
+	u32 EnableReg;
+	u32 Mask;
+	u32 Index;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+	Xil_AssertNonvoid(Int_Id >= 32U);
+	Xil_AssertNonvoid(Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS);
+	Xil_AssertNonvoid(Handler != NULL);
+
+	if (Cpu == XSCUGIC_AFFINITY_ANY) {
+		if (MgrPtr->Policy == XSCUGIC_AFFINITY_STATIC) {
+			return XST_FAILURE;
+		}
+	} else if ((Cpu >= XSCUGIC_AFFINITY_MAX_CPUS) ||
+			((MgrPtr->CpuMask & ((u32)1U << Cpu)) == 0U)) {
+		return XST_FAILURE;
+	} else {
+		/* CPU given by the caller */
+	}
+
+	for (Index = 0U; Index < MgrPtr->NumEntries; Index++) {
+		if (MgrPtr->Entry[Index].IntId == Int_Id) {
+			EntryPtr = &MgrPtr->Entry[Index];
+			break;
+		}
+	}
+
+	if (EntryPtr == NULL) {
+		if (MgrPtr->NumEntries >= XSCUGIC_AFFINITY_MAX_VECTORS) {
+			return XST_FAILURE;
+		}
+		EntryPtr = &MgrPtr->Entry[MgrPtr->NumEntries];
+		EntryPtr->Count = 0U;
+		EntryPtr->LastCount = 0U;
+		EntryPtr->Cpu = (u8)XSCUGIC_AFFINITY_MAX_CPUS;
+		MgrPtr->NumEntries++;
+	}
+
+	EnableReg = (u32)XSCUGIC_ENABLE_SET_OFFSET + ((Int_Id / 32U) * 4U);
+	Mask = (u32)1U << (Int_Id % 32U);
+	Mask &= XScuGic_DistReadReg(MgrPtr->InstancePtr, EnableReg);
+	XScuGic_Disable(MgrPtr->InstancePtr, Int_Id);
+
+	/*
+	 * Wait for an interrupt already acknowledged on another CPU to reach
+	 * its EOI, so that no CPU is reading the vector table entry while it
+	 * is changed.
+	 */
+	while ((XScuGic_DistReadReg(MgrPtr->InstancePtr,
+			(u32)XSCUGIC_ACTIVE_OFFSET + ((Int_Id / 32U) * 4U)) &
+			((u32)1U << (Int_Id % 32U))) != 0U) {
+		;
+	}
+	EntryPtr->IntId = (u16)Int_Id;
+	EntryPtr->Pinned = (Cpu == XSCUGIC_AFFINITY_ANY) ? 0U : 1U;
+	EntryPtr->Handler = Handler;
+	EntryPtr->CallBackRef = CallBackRef;
+
+	TablePtr = &MgrPtr->InstancePtr->Config->HandlerTable[Int_Id];
+	TablePtr->CallBackRef = (void *)EntryPtr;
+	TablePtr->Handler = (Xil_InterruptHandler)XScuGic_AffinityHandler;
+
+	if (Cpu == XSCUGIC_AFFINITY_ANY) {
+		Cpu = XScuGic_AffinityNextCpu(MgrPtr);
+	}
+	XScuGic_AffinityRoute(MgrPtr, EntryPtr, Cpu);
+
+	dsb();
+
+	if (Mask != 0U) {
+		XScuGic_Enable(MgrPtr->InstancePtr, Int_Id);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Routes a managed SPI to the given CPU and pins it there.
+*
+* @param	MgrPtr is a pointer to the affinity manager.
+* @param	Int_Id is a SPI connected with XScuGic_AffinityConnect().
+* @param	Cpu is the new target CPU, which must be in the manager CPU
+*		mask.
+*
+* @return
+*		- XST_SUCCESS if the SPI was routed to Cpu.
+*		- XST_FAILURE if Int_Id is not managed or Cpu is not usable.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XScuGic_AffinitySetCpu(XScuGic_AffinityMgr *MgrPtr, u32 Int_Id, u32 Cpu)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+
+	if ((Cpu >= XSCUGIC_AFFINITY_MAX_CPUS) ||
+			((MgrPtr->CpuMask & ((u32)1U << Cpu)) == 0U)) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < MgrPtr->NumEntries; Index++) {
+		if (MgrPtr->Entry[Index].IntId == Int_Id) {
+			MgrPtr->Entry[Index].Pinned = 1U;
+			XScuGic_AffinityRoute(MgrPtr, &MgrPtr->Entry[Index], Cpu);
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Spreads the unpinned vectors over the CPUs by the number of interrupts each
+* vector has taken since the previous call. The busiest vectors are placed
+* first, each on the CPU with the least load so far; a vector stays where it
+* is when its current CPU is one of the least loaded.
+*
+* This function only moves vectors with the XSCUGIC_AFFINITY_LOAD policy, but
+* the interval counts are updated for any policy.
+*
+* @param	MgrPtr is a pointer to the affinity manager.
+*
+* @return	The number of vectors that were routed to a different CPU.
+*
+* @note		This function is meant to be called from a periodic timer or
+*		task on one CPU only.
+*
+******************************************************************************/
+u32 XScuGic_AffinityRebalance(XScuGic_AffinityMgr *MgrPtr)
+{
+	u32 Load[XSCUGIC_AFFINITY_MAX_CPUS];
+	u32 Delta[XSCUGIC_AFFINITY_MAX_VECTORS];
+	u32 Placed = 0U;
+	u32 Moved = 0U;
+	u32 Count;
+	u32 Index;
+	u32 Best;
+	u32 Cpu;
+	u32 MinCpu;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+
+	for (Cpu = 0U; Cpu < XSCUGIC_AFFINITY_MAX_CPUS; Cpu++) {
+		Load[Cpu] = 0U;
+	}
+
+	for (Index = 0U; Index < MgrPtr->NumEntries; Index++) {
+		Count = MgrPtr->Entry[Index].Count;
+		Delta[Index] = Count - MgrPtr->Entry[Index].LastCount;
+		MgrPtr->Entry[Index].LastCount = Count;
+		if (MgrPtr->Entry[Index].Pinned != 0U) {
+			Load[MgrPtr->Entry[Index].Cpu] += Delta[Index];
+			Placed |= (u32)1U << Index;
+		}
+	}
+
+	if (MgrPtr->Policy != XSCUGIC_AFFINITY_LOAD) {
+		return 0U;
+	}
+
+	for (;;) {
+		Best = XSCUGIC_AFFINITY_MAX_VECTORS;
+		for (Index = 0U; Index < MgrPtr->NumEntries; Index++) {
+			if (((Placed & ((u32)1U << Index)) == 0U) &&
+			    ((Best == XSCUGIC_AFFINITY_MAX_VECTORS) ||
+			     (Delta[Index] > Delta[Best]))) {
+				Best = Index;
+			}
+		}
+		if (Best == XSCUGIC_AFFINITY_MAX_VECTORS) {
+			break;
+		}
+		Placed |= (u32)1U << Best;
+
+		MinCpu = MgrPtr->Entry[Best].Cpu;
+		for (Cpu = 0U; Cpu < XSCUGIC_AFFINITY_MAX_CPUS; Cpu++) {
+			if (((MgrPtr->CpuMask & ((u32)1U << Cpu)) != 0U) &&
+			    (Load[Cpu] < Load[MinCpu])) {
+				MinCpu = Cpu;
+			}
+		}
+
+		Load[MinCpu] += Delta[Best];
+		if (MinCpu != MgrPtr->Entry[Best].Cpu) {
+			XScuGic_AffinityRoute(MgrPtr, &MgrPtr->Entry[Best],
+						MinCpu);
+			Moved++;
+		}
+	}
+
+	return Moved;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the number of interrupts taken by a managed SPI since it was first
+* connected.
+*
+* @param	MgrPtr is a pointer to the affinity manager.
+* @param	Int_Id is the SPI.
+* @param	CpuPtr, if not NULL, receives the CPU the SPI is routed to.
+*
+* @return	The interrupt count, or 0 if Int_Id is not managed.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XScuGic_AffinityGetCount(XScuGic_AffinityMgr *MgrPtr, u32 Int_Id,
+				u32 *CpuPtr)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(MgrPtr != NULL);
+
+	for (Index = 0U; Index < MgrPtr->NumEntries; Index++) {
+		if (MgrPtr->Entry[Index].IntId == Int_Id) {
+			if (CpuPtr != NULL) {
+				*CpuPtr = MgrPtr->Entry[Index].Cpu;
+			}
+			return MgrPtr->Entry[Index].Count;
+		}
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Vector table wrapper of a managed SPI. Only the CPU the SPI is routed to
+* takes it, so the count is updated by one CPU at a time.
+*
+* @param	CallBackRef is the XScuGic_AffinityEntry of the vector.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XScuGic_AffinityHandler(void *CallBackRef)
+{
+	XScuGic_AffinityEntry *EntryPtr = (XScuGic_AffinityEntry *)CallBackRef;
+
+	EntryPtr->Count++;
+	EntryPtr->Handler(EntryPtr->CallBackRef);
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes the GICD_ITARGETSR byte of a managed SPI so that it targets Cpu only.
+*
+* @param	MgrPtr is a pointer to the affinity manager.
+* @param	EntryPtr is the managed vector.
+* @param	Cpu is the target CPU.
+*
+* @return	None.
+*
+* @note		An interrupt that is already pending on the old CPU is taken
+*		there; later ones go to the new CPU.
+*
+******************************************************************************/
+static void XScuGic_AffinityRoute(XScuGic_AffinityMgr *MgrPtr,
+				XScuGic_AffinityEntry *EntryPtr, u32 Cpu)
+{
+	UINTPTR Addr;
+
+	Addr = (UINTPTR)MgrPtr->InstancePtr->Config->DistBaseAddress +
+		XSCUGIC_SPI_TARGET_OFFSET + EntryPtr->IntId;
+	Xil_Out8(Addr, (u8)((u32)1U << Cpu));
+	EntryPtr->Cpu = (u8)Cpu;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the next CPU of the manager CPU mask in round robin order.
+*
+* @param	MgrPtr is a pointer to the affinity manager.
+*
+* @return	The CPU number.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XScuGic_AffinityNextCpu(XScuGic_AffinityMgr *MgrPtr)
+{
+	u32 Cpu = MgrPtr->NextCpu;
+
+	while ((MgrPtr->CpuMask & ((u32)1U << Cpu)) == 0U) {
+		Cpu = (Cpu + 1U) % XSCUGIC_AFFINITY_MAX_CPUS;
+	}
+	MgrPtr->NextCpu = (Cpu + 1U) % XSCUGIC_AFFINITY_MAX_CPUS;
+
+	return Cpu;
+}
+/** @} */
@@ -0,0 +1,392 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xscugic_deferred.c
+* @addtogroup scugic_v3_8
+* @{
+*
+* This file contains the deferred (bottom-half) interrupt processing for the
+* driver. A vector connected through XScuGic_ConnectDeferred() is serviced in
+* two stages. The top half runs from XScuGic_InterruptHandler(), masks the
+* source in the distributor and queues the vector. The bottom half,
+* XScuGic_DeferredRun(), calls the user handler later from a lower priority
+* context and unmasks the source again once the handler is done.
+*
+* The bottom half may be run in one of two ways:
+*   - From a software generated interrupt set up with
+*     XScuGic_DeferredSetSoftIrq(). The SGI is given the lowest priority and
+*     one queued handler is run per SGI, so any higher priority interrupt
+*     that becomes pending is acknowledged before the next queued handler.
+*   - From a thread, typically an RTOS task. A notify callback registered
+*     with XScuGic_DeferredSetNotify() is called by the top half, for example
+*     to give a task notification, and the task calls XScuGic_DeferredRun().
+*
+* The queue has a single producer (the top half) and a single consumer (the
+* bottom half). Both must run on the same CPU.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------------
+* 3.9   ag   10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xscugic.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XSCUGIC_DEFERRED_RING_MASK	(XSCUGIC_DEFERRED_MAX_VECTORS - 1U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static void XScuGic_DeferredTopHalf(void *CallBackRef);
+static void XScuGic_DeferredSoftIrqHandler(void *CallBackRef);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* Initializes a deferred interrupt queue for the given interrupt controller.
+* No bottom-half context is attached; use XScuGic_DeferredSetSoftIrq() or
+* XScuGic_DeferredSetNotify() before connecting any vector.
+*
+* @param	QueuePtr is a pointer to the queue to initialize.
+* @param	InstancePtr is a pointer to a ready XScuGic instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XScuGic_DeferredInitialize(XScuGic_DeferredQueue *QueuePtr,
+				XScuGic *InstancePtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	QueuePtr->InstancePtr = InstancePtr;
+	QueuePtr->NumEntries = 0U;
+	QueuePtr->Head = 0U;
+	QueuePtr->Tail = 0U;
+	QueuePtr->ReschedMask = 0U;
+	QueuePtr->SoftIntId = XSCUGIC_DEFERRED_NO_SOFTIRQ;
+	QueuePtr->NotifyHandler = NULL;
+	QueuePtr->NotifyRef = NULL;
+
+	for (Index = 0U; Index < XSCUGIC_DEFERRED_MAX_VECTORS; Index++) {
+		QueuePtr->Entry[Index].Handler = NULL;
+		QueuePtr->Entry[Index].CallBackRef = NULL;
+		QueuePtr->Entry[Index].QueuePtr = QueuePtr;
+		QueuePtr->Entry[Index].IntId = 0U;
+		QueuePtr->Entry[Index].RunCount = 0U;
+		QueuePtr->Ring[Index] = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Connects a handler to an interrupt source in threaded mode. The interrupt
+* controller vector table entry for Int_Id is pointed at the driver's top
+* half, and Handler is called from XScuGic_DeferredRun().
+*
+* The handler returns XSCUGIC_DEFERRED_DONE when the device has no more work,
+* in which case the source is unmasked. It returns
+* XSCUGIC_DEFERRED_RESCHEDULE to be called again on a later run with the source
+* still masked, for example when it has processed its budget of packets.
+*
+* Connecting an Int_Id that is already deferred on this queue replaces its
+* handler.
+*
+* @param	QueuePtr is a pointer to the deferred queue.
+* @param	Int_Id is the interrupt source, 0 to
+*		XSCUGIC_MAX_NUM_INTR_INPUTS - 1.
+* @param	Handler is the bottom-half handler.
+* @param	CallBackRef is passed to Handler when it is called.
+*
+* @return
+*		- XST_SUCCESS if the handler was connected.
+*		- XST_FAILURE if all XSCUGIC_DEFERRED_MAX_VECTORS entries are in
+*		use.
+*
+* @note		The source is not enabled by this function; call
+*		XScuGic_Enable() as for a regular handler.
+*
+******************************************************************************/
+s32 XScuGic_ConnectDeferred(XScuGic_DeferredQueue *QueuePtr, u32 Int_Id,
+			XScuGic_DeferredHandler Handler, void *CallBackRef)
+{
+	XScuGic_DeferredEntry *EntryPtr = NULL;
+	u32 Index;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS);
+	Xil_AssertNonvoid(Handler != NULL);
+
+	for (Index = 0U; Index < QueuePtr->NumEntries; Index++) {
+		if (QueuePtr->Entry[Index].IntId == Int_Id) {
+			EntryPtr = &QueuePtr->Entry[Index];
+			break;
+		}
+	}
+
+	if (EntryPtr == NULL) {
+		if (QueuePtr->NumEntries >= XSCUGIC_DEFERRED_MAX_VECTORS) {
+			return XST_FAILURE;
+		}
+		EntryPtr = &QueuePtr->Entry[QueuePtr->NumEntries];
+		EntryPtr->Index = (u16)QueuePtr->NumEntries;
+		QueuePtr->NumEntries++;
+	}
+
+	EntryPtr->IntId = (u16)Int_Id;
+	EntryPtr->CallBackRef = CallBackRef;
+	EntryPtr->Handler = Handler;
+
+	return XScuGic_Connect(QueuePtr->InstancePtr, Int_Id,
+			(Xil_InterruptHandler)XScuGic_DeferredTopHalf,
+			(void *)EntryPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* Runs the bottom half of the deferred interrupt queue from standalone code
+* by means of a software generated interrupt. The SGI is connected to the
+* driver, given the lowest priority, routed to the current CPU and enabled.
+*
+* @param	QueuePtr is a pointer to the deferred queue.
+* @param	SgiId is the software interrupt used to kick the bottom half,
+*		0 to 15. It must not be used for anything else.
+*
+* @return
+*		- XST_SUCCESS if the SGI was set up.
+*		- XST_FAILURE if the SGI could not be connected.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XScuGic_DeferredSetSoftIrq(XScuGic_DeferredQueue *QueuePtr, u32 SgiId)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(SgiId <= 15U);
+
+	Status = XScuGic_Connect(QueuePtr->InstancePtr, SgiId,
+			(Xil_InterruptHandler)XScuGic_DeferredSoftIrqHandler,
+			(void *)QueuePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XScuGic_SetPriorityTriggerType(QueuePtr->InstancePtr, SgiId,
+				(u8)XSCUGIC_MAX_INTR_PRIO_VAL, 0x0U);
+	QueuePtr->SoftIntId = SgiId;
+	XScuGic_Enable(QueuePtr->InstancePtr, SgiId);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Registers a callback that the top half calls after queueing a vector. This
+* is used to wake a thread that runs XScuGic_DeferredRun(), e.g. with
+* vTaskNotifyGiveFromISR() under FreeRTOS. The callback runs in interrupt
+* context. When a callback is set, the soft IRQ (if any) is not triggered.
+*
+* @param	QueuePtr is a pointer to the deferred queue.
+* @param	NotifyHandler is the callback, or NULL to remove it.
+* @param	NotifyRef is passed to NotifyHandler.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XScuGic_DeferredSetNotify(XScuGic_DeferredQueue *QueuePtr,
+			XScuGic_DeferredNotify NotifyHandler, void *NotifyRef)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+
+	QueuePtr->NotifyRef = NotifyRef;
+	QueuePtr->NotifyHandler = NotifyHandler;
+}
+
+/*****************************************************************************/
+/**
+*
+* Runs queued bottom-half handlers. Vectors queued by the top half are run
+* first, in the order their interrupts were taken, followed by vectors whose
+* handler asked to be rescheduled on an earlier call.
+*
+* @param	QueuePtr is a pointer to the deferred queue.
+* @param	Budget is the maximum number of handler calls to make. It must
+*		be non-zero.
+*
+* @return	The number of vectors still waiting for their bottom half. A
+*		thread would normally call this again, or yield and call it
+*		again, until it returns 0 and then wait for the next notify.
+*
+* @note		This function must not be re-entered for the same queue.
+*
+******************************************************************************/
+u32 XScuGic_DeferredRun(XScuGic_DeferredQueue *QueuePtr, u32 Budget)
+{
+	XScuGic_DeferredEntry *EntryPtr;
+	u32 Count = 0U;
+	u32 Index;
+	u32 Pending;
+	u32 Mask;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Budget != 0U);
+
+	while (Count < Budget) {
+		if (QueuePtr->Tail != QueuePtr->Head) {
+			Index = QueuePtr->Ring[QueuePtr->Tail &
+					XSCUGIC_DEFERRED_RING_MASK];
+			QueuePtr->Tail++;
+		} else if (QueuePtr->ReschedMask != 0U) {
+			for (Index = 0U;
+			     (QueuePtr->ReschedMask & ((u32)1U << Index)) == 0U;
+			     Index++) {
+				;
+			}
+			QueuePtr->ReschedMask &= ~((u32)1U << Index);
+		} else {
+			break;
+		}
+
+		EntryPtr = &QueuePtr->Entry[Index];
+		EntryPtr->RunCount++;
+		Count++;
+
+		if (EntryPtr->Handler(EntryPtr->CallBackRef) ==
+					XSCUGIC_DEFERRED_RESCHEDULE) {
+			QueuePtr->ReschedMask |= ((u32)1U << Index);
+		} else {
+			XScuGic_Enable(QueuePtr->InstancePtr, EntryPtr->IntId);
+		}
+	}
+
+	Pending = QueuePtr->Head - QueuePtr->Tail;
+	for (Mask = QueuePtr->ReschedMask; Mask != 0U; Mask &= (Mask - 1U)) {
+		Pending++;
+	}
+
+	return Pending;
+}
+
+/*****************************************************************************/
+/**
+*
+* Top half for a deferred vector. Called from XScuGic_InterruptHandler() after
+* the interrupt has been acknowledged. The source is masked so that a level
+* interrupt does not fire again until the bottom half has serviced the
+* device, then the vector is queued and the bottom half is kicked.
+*
+* @param	CallBackRef is the XScuGic_DeferredEntry of the vector.
+*
+* @return	None.
+*
+* @note		A masked vector cannot be queued twice, so the ring never
+*		holds more than XSCUGIC_DEFERRED_MAX_VECTORS entries.
+*
+******************************************************************************/
+static void XScuGic_DeferredTopHalf(void *CallBackRef)
+{
+	XScuGic_DeferredEntry *EntryPtr = (XScuGic_DeferredEntry *)CallBackRef;
+	XScuGic_DeferredQueue *QueuePtr = EntryPtr->QueuePtr;
+
+	XScuGic_Disable(QueuePtr->InstancePtr, EntryPtr->IntId);
+
+	QueuePtr->Ring[QueuePtr->Head & XSCUGIC_DEFERRED_RING_MASK] =
+							EntryPtr->Index;
+	QueuePtr->Head++;
+
+	if (QueuePtr->NotifyHandler != NULL) {
+		QueuePtr->NotifyHandler(QueuePtr->NotifyRef);
+	} else if (QueuePtr->SoftIntId != XSCUGIC_DEFERRED_NO_SOFTIRQ) {
+		(void)XScuGic_SoftwareIntr(QueuePtr->InstancePtr,
+				QueuePtr->SoftIntId,
+				(u32)1U << XScuGic_GetCpuID());
+	} else {
+		/* Bottom half is polled by the application */
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Soft IRQ handler for the bottom half. Runs one queued handler and triggers
+* the SGI again if more work is left, which lets the GIC present any higher
+* priority interrupt between two bottom-half handlers.
+*
+* @param	CallBackRef is the XScuGic_DeferredQueue.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XScuGic_DeferredSoftIrqHandler(void *CallBackRef)
+{
+	XScuGic_DeferredQueue *QueuePtr = (XScuGic_DeferredQueue *)CallBackRef;
+
+	if (XScuGic_DeferredRun(QueuePtr, 1U) != 0U) {
+		(void)XScuGic_SoftwareIntr(QueuePtr->InstancePtr,
+				QueuePtr->SoftIntId,
+				(u32)1U << XScuGic_GetCpuID());
+	}
+}
+/** @} */
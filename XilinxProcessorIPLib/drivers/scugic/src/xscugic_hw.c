@@ -69,6 +69,7 @@
 *					  and XScuGic_UnmapAllInterruptsFromCpuByDistAddr, These
 *					  API's can be used by applications to unmap specific/all
 *					  interrupts from target CPU. It fixes CR#992490.
+*       ag   10/14/26 XScuGic_DeviceInterruptHandler can be placed in R5 TCM.
 *
 * </pre>
 *
@@ -81,6 +82,7 @@
 #include "xil_assert.h"
 #include "xscugic.h"
 #include "xparameters.h"
+#include "xil_tcm.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -313,7 +315,7 @@ s32 XScuGic_DeviceInitialize(u32 DeviceId)
 * @note		None.
 *
 ******************************************************************************/
-void XScuGic_DeviceInterruptHandler(void *DeviceId)
+void XIL_TCM_ISR XScuGic_DeviceInterruptHandler(void *DeviceId)
 {
 
 	u32 InterruptID;
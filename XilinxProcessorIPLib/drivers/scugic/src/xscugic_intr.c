@@ -62,6 +62,8 @@
 * 1.01a sdm  11/09/11 XScuGic_InterruptHandler has changed correspondingly
 *		      since the HandlerTable has now moved to XScuGic_Config.
 * 3.00  kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
+* 3.9   ag   10/14/26 Time each handler when XSCUGIC_ISR_STATS is defined.
+*       ag   10/14/26 XScuGic_InterruptHandler can be placed in R5 TCM.
 *
 * </pre>
 *
@@ -81,6 +83,10 @@
 #include "xil_types.h"
 #include "xil_assert.h"
 #include "xscugic.h"
+#include "xil_tcm.h"
+#ifdef XSCUGIC_ISR_STATS
+#include "xtime_l.h"
+#endif
 
 /************************** Constant Definitions *****************************/
 
@@ -105,6 +111,10 @@
 * initialized.  It does not verify that entries in the table are valid before
 * calling an interrupt handler.
 *
+* When the driver is built with XSCUGIC_ISR_STATS defined, the time spent in
+* each handler is measured with XTime_GetTime() and accumulated per interrupt
+* ID, see xscugic_stats.c.
+*
 *
 * @param	InstancePtr is a pointer to the XScuGic instance.
 *
@@ -113,12 +123,16 @@
 * @note		None.
 *
 ******************************************************************************/
-void XScuGic_InterruptHandler(XScuGic *InstancePtr)
+void XIL_TCM_ISR XScuGic_InterruptHandler(XScuGic *InstancePtr)
 {
 
 	u32 InterruptID;
 	    u32 IntIDFull;
 	    XScuGic_VectorTableEntry *TablePtr;
+#ifdef XSCUGIC_ISR_STATS
+	    XTime StartTime;
+	    XTime EndTime;
+#endif
 
 	    /* Assert that the pointer to the instance is valid
 	     */
@@ -156,7 +170,14 @@ void XScuGic_InterruptHandler(XScuGic *InstancePtr)
 	     */
 	    TablePtr = &(InstancePtr->Config->HandlerTable[InterruptID]);
 		if(TablePtr != NULL) {
+#ifdef XSCUGIC_ISR_STATS
+		XTime_GetTime(&StartTime);
+	        TablePtr->Handler(TablePtr->CallBackRef);
+		XTime_GetTime(&EndTime);
+		XScuGic_IsrStatsUpdate(InterruptID, (u32)(EndTime - StartTime));
+#else
 	        TablePtr->Handler(TablePtr->CallBackRef);
+#endif
 		}
 
 	IntrExit:
@@ -0,0 +1,228 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xscugic_stats.c
+* @addtogroup scugic_v3_8
+* @{
+*
+* This file contains the optional per-vector handler statistics of the
+* driver. They are compiled in when XSCUGIC_ISR_STATS is defined, e.g. by
+* adding -DXSCUGIC_ISR_STATS to the extra compiler flags of the BSP. In that
+* case XScuGic_InterruptHandler() reads the time with XTime_GetTime() before
+* and after calling each handler, and records the count and the minimum,
+* maximum and total handler time for the interrupt ID. Times are in XTime
+* ticks, COUNTS_PER_SECOND to the second.
+*
+* The GICv2 CPU interface keeps no record of when an interrupt became
+* pending, so the latency from assertion to handler entry is not measured.
+*
+* SGIs and PPIs are banked per CPU but share one record here. On SMP systems
+* the records of such interrupts are only meaningful if one CPU takes them.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------------
+* 3.9   ag   10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xscugic.h"
+
+#ifdef XSCUGIC_ISR_STATS
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+static volatile XScuGic_IsrStats IsrStats[XSCUGIC_MAX_NUM_INTR_INPUTS];
+
+/*****************************************************************************/
+/**
+*
+* Adds one handler run to the statistics of an interrupt ID. This is called
+* by XScuGic_InterruptHandler() and is not normally called by the user.
+*
+* @param	Int_Id is the interrupt ID.
+* @param	Ticks is the time spent in the handler, in XTime ticks.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XScuGic_IsrStatsUpdate(u32 Int_Id, u32 Ticks)
+{
+	volatile XScuGic_IsrStats *StatsPtr;
+
+	if (Int_Id >= XSCUGIC_MAX_NUM_INTR_INPUTS) {
+		return;
+	}
+
+	StatsPtr = &IsrStats[Int_Id];
+	if ((StatsPtr->Count == 0U) || (Ticks < StatsPtr->MinTicks)) {
+		StatsPtr->MinTicks = Ticks;
+	}
+	if (Ticks > StatsPtr->MaxTicks) {
+		StatsPtr->MaxTicks = Ticks;
+	}
+	StatsPtr->TotalTicks += Ticks;
+	StatsPtr->Count++;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns a consistent copy of the statistics of an interrupt ID. The copy is
+* retried if the interrupt was taken while it was being made.
+*
+* @param	Int_Id is the interrupt ID, 0 to
+*		XSCUGIC_MAX_NUM_INTR_INPUTS - 1.
+* @param	StatsPtr receives the statistics.
+*
+* @return	The average handler time in XTime ticks, or 0 if the
+*		interrupt has not been taken.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XScuGic_IsrStatsGet(u32 Int_Id, XScuGic_IsrStats *StatsPtr)
+{
+	u32 Count;
+
+	Xil_AssertNonvoid(Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS);
+	Xil_AssertNonvoid(StatsPtr != NULL);
+
+	do {
+		Count = IsrStats[Int_Id].Count;
+		StatsPtr->MinTicks = IsrStats[Int_Id].MinTicks;
+		StatsPtr->MaxTicks = IsrStats[Int_Id].MaxTicks;
+		StatsPtr->TotalTicks = IsrStats[Int_Id].TotalTicks;
+		StatsPtr->Count = Count;
+	} while (Count != IsrStats[Int_Id].Count);
+
+	if (Count == 0U) {
+		return 0U;
+	}
+
+	return (u32)(StatsPtr->TotalTicks / Count);
+}
+
+/*****************************************************************************/
+/**
+*
+* Clears the statistics of one interrupt ID or of all of them.
+*
+* @param	Int_Id is the interrupt ID, or XSCUGIC_MAX_NUM_INTR_INPUTS to
+*		clear all IDs.
+*
+* @return	None.
+*
+* @note		Should be called with the interrupt disabled, or the next
+*		update may be partially lost.
+*
+******************************************************************************/
+void XScuGic_IsrStatsReset(u32 Int_Id)
+{
+	u32 Index;
+
+	Xil_AssertVoid(Int_Id <= XSCUGIC_MAX_NUM_INTR_INPUTS);
+
+	for (Index = 0U; Index < XSCUGIC_MAX_NUM_INTR_INPUTS; Index++) {
+		if ((Int_Id == XSCUGIC_MAX_NUM_INTR_INPUTS) ||
+				(Int_Id == Index)) {
+			IsrStats[Index].Count = 0U;
+			IsrStats[Index].MinTicks = 0U;
+			IsrStats[Index].MaxTicks = 0U;
+			IsrStats[Index].TotalTicks = 0U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Prints the statistics of every interrupt ID that has been taken, with times
+* in microseconds. IDs whose maximum handler time exceeds BudgetUs are marked
+* with "*".
+*
+* @param	BudgetUs is the handler time budget in microseconds, or 0 to
+*		mark nothing.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XScuGic_IsrStatsPrint(u32 BudgetUs)
+{
+	XScuGic_IsrStats Stats;
+	u32 Index;
+	u32 AvgTicks;
+	u32 MaxUs;
+
+	xil_printf("IntId     Count    Min(us)    Avg(us)    Max(us)\r\n");
+	for (Index = 0U; Index < XSCUGIC_MAX_NUM_INTR_INPUTS; Index++) {
+		AvgTicks = XScuGic_IsrStatsGet(Index, &Stats);
+		if (Stats.Count == 0U) {
+			continue;
+		}
+		MaxUs = (u32)(((u64)Stats.MaxTicks * 1000000U) /
+						COUNTS_PER_SECOND);
+		xil_printf("%5d %9d %10d %10d %10d%s\r\n", (int)Index,
+			(int)Stats.Count,
+			(int)(((u64)Stats.MinTicks * 1000000U) /
+						COUNTS_PER_SECOND),
+			(int)(((u64)AvgTicks * 1000000U) / COUNTS_PER_SECOND),
+			(int)MaxUs,
+			((BudgetUs != 0U) && (MaxUs > BudgetUs)) ? " *" : "");
+	}
+}
+#endif /* XSCUGIC_ISR_STATS */
+/** @} */
@@ -0,0 +1,234 @@
+// (c) Copyright 2016-2018 Xilinx, Inc. All rights reserved.
+//
+// This file contains confidential and proprietary information
+// of Xilinx, Inc. and is protected under U.S. and
+// international copyright and other intellectual property
+// laws.
+//
+// DISCLAIMER
+// This disclaimer is not a license and does not grant any
+// rights to the materials distributed herewith. Except as
+// otherwise provided in a valid license issued to you by
+// Xilinx, and to the maximum extent permitted by applicable
+// law: (1) THESE MATERIALS ARE MADE AVAILABLE "AS IS" AND
+// WITH ALL FAULTS, AND XILINX HEREBY DISCLAIMS ALL WARRANTIES
+// AND CONDITIONS, EXPRESS, IMPLIED, OR STATUTORY, INCLUDING
+// BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, NON-
+// INFRINGEMENT, OR FITNESS FOR ANY PARTICULAR PURPOSE; and
+// (2) Xilinx shall not be liable (whether in contract or tort,
+// including negligence, or under any other theory of
+// liability) for any loss or damage of any kind or nature
+// related to, arising under or in connection with these
+// materials, including for any direct, or any indirect,
+// special, incidental, or consequential loss or damage
+// (including loss of data, profits, goodwill, or any type of
+// loss or damage suffered as a result of any action brought
+// by a third party) even if such damage or loss was
+// reasonably foreseeable or Xilinx had been advised of the
+// possibility of the same.
+//
+// CRITICAL APPLICATIONS
+// Xilinx products are not designed or intended to be fail-
+// safe, or for use in any application requiring fail-safe
+// performance, such as life-support or safety devices or
+// systems, Class III medical devices, nuclear facilities,
+// applications related to the deployment of airbags, or any
+// other applications that could lead to death, personal
+// injury, or severe property or environmental damage
+// (individually and collectively, "Critical
+// Applications"). Customer assumes the sole risk and
+// liability of any use of Xilinx products in Critical
+// Applications, subject only to applicable laws and
+// regulations governing limitations on product liability.
+//
+// THIS COPYRIGHT NOTICE AND DISCLAIMER MUST BE RETAINED AS
+// PART OF THIS FILE AT ALL TIMES.
+
+/**
+ * @file xsdfec_benchmark_example.c
+ *
+ * Decode throughput and latency benchmark for the SD-FEC.
+ *
+ * Blocks are streamed through the core with two AXI DMA cores in simple mode:
+ * - DATA_DMA_DEV_ID: MM2S drives DIN, S2MM receives DOUT.
+ * - CTRL_DMA_DEV_ID: MM2S drives CTRL, S2MM receives STATUS.
+ *
+ * For every code ID in the TestCodes table NUM_BLOCKS blocks are decoded.
+ * The status word of each block gives its code ID, iteration count and
+ * parity check result; together with the time from submitting the control
+ * word to receiving the status word these are recorded with
+ * XSdFecStatsRecord() and reported with XSdFecStatsReport().
+ *
+ * Simple mode DMA transfers one block at a time, so the figures show the
+ * per block latency and a lower bound for the throughput. Keeping several
+ * blocks in flight (scatter gather or MCDMA) is needed to reach the peak
+ * throughput of the core.
+ *
+ * The layout of the control and status words depends on the core
+ * configuration. CTRL_WORD() and the STATUS_* fields below have to be set
+ * to match the control and status descriptions of the SD-FEC product guide
+ * for the configured core, and TestCodes to the codes loaded in the core.
+ */
+
+/***************************** Include Files *********************************/
+#include "xsdfec.h"
+#include "xaxidma.h"
+#include "xparameters.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/************************** Constant Definitions *****************************/
+#define SDFEC_DEV_ID     XPAR_XSDFEC_0_DEVICE_ID
+#define DATA_DMA_DEV_ID  XPAR_AXIDMA_0_DEVICE_ID
+#define CTRL_DMA_DEV_ID  XPAR_AXIDMA_1_DEVICE_ID
+
+#define NUM_BLOCKS       1000    // Blocks decoded per code
+#define MAX_BLOCK_BYTES  0x8000  // Largest DIN/DOUT block
+#define DMA_TIMEOUT      1000000 // Polls before a transfer is abandoned
+
+// Control word of a block, set to match the core configuration
+#define CTRL_WORD(CodeId, Id)  (((Id) << 24) | (CodeId))
+
+// Status word fields, set to match the core configuration
+#define STATUS_CODE_MASK   0x0000007F
+#define STATUS_CODE_LSB    0
+#define STATUS_PASS_MASK   0x00000800
+#define STATUS_PASS_LSB    11
+#define STATUS_ITERS_MASK  0x003F0000
+#define STATUS_ITERS_LSB   16
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+  u32 CodeId;    // Code ID loaded in the core
+  u32 DinBytes;  // DIN block size in bytes
+  u32 DoutBytes; // DOUT block size in bytes
+} BenchCode;
+
+/************************** Variable Definitions *****************************/
+static const BenchCode TestCodes[] = {
+  { 0, 0x2000, 0x400 },
+  { 1, 0x4000, 0x800 },
+};
+
+static XSdFec      SdFec;
+static XAxiDma     DataDma;
+static XAxiDma     CtrlDma;
+static XSdFecStats Stats;
+
+static u8  DinBuf[MAX_BLOCK_BYTES]  __attribute__ ((aligned(64)));
+static u8  DoutBuf[MAX_BLOCK_BYTES] __attribute__ ((aligned(64)));
+static u32 CtrlBuf[16]              __attribute__ ((aligned(64)));
+static u32 StatusBuf[16]            __attribute__ ((aligned(64)));
+
+/************************** Function Prototypes ******************************/
+static int DmaInit(XAxiDma* DmaPtr, u16 DeviceId);
+static int DecodeBlock(const BenchCode* CodePtr, u32 Id, u64* SubmitPtr, u64* DonePtr);
+
+/************************** Function Implementation *************************/
+int main(void) {
+  xil_printf("--- SD-FEC benchmark ---\r\n");
+
+  if (XSdFecInitialize(&SdFec, SDFEC_DEV_ID) != XST_SUCCESS ||
+      DmaInit(&DataDma, DATA_DMA_DEV_ID) != XST_SUCCESS ||
+      DmaInit(&CtrlDma, CTRL_DMA_DEV_ID) != XST_SUCCESS) {
+    xil_printf("SD-FEC benchmark Failed: initialization\r\n");
+    return XST_FAILURE;
+  }
+
+  // Fixed block sizes, no DIN_WORDS/DOUT_WORDS streams
+  XSdFecSet_CORE_AXIS_ENABLE_DIN_WORDS(SdFec.BaseAddress, 0);
+  XSdFecSet_CORE_AXIS_ENABLE_DOUT_WORDS(SdFec.BaseAddress, 0);
+  XSdFecSet_CORE_AXIS_ENABLE_CTRL(SdFec.BaseAddress, 1);
+  XSdFecSet_CORE_AXIS_ENABLE_DIN(SdFec.BaseAddress, 1);
+  XSdFecSet_CORE_AXIS_ENABLE_STATUS(SdFec.BaseAddress, 1);
+  XSdFecSet_CORE_AXIS_ENABLE_DOUT(SdFec.BaseAddress, 1);
+
+  for (u32 i = 0; i < sizeof(DinBuf); i++) {
+    DinBuf[i] = (u8)(i * 13);
+  }
+  Xil_DCacheFlushRange((UINTPTR)DinBuf, sizeof(DinBuf));
+
+  XTime Now;
+  XTime_GetTime(&Now);
+  XSdFecStatsReset(&Stats, Now);
+
+  for (u32 c = 0; c < sizeof(TestCodes)/sizeof(TestCodes[0]); c++) {
+    const BenchCode* CodePtr = &TestCodes[c];
+    if (CodePtr->DinBytes > MAX_BLOCK_BYTES || CodePtr->DoutBytes > MAX_BLOCK_BYTES) {
+      xil_printf("SD-FEC benchmark Failed: code %d block too large\r\n", CodePtr->CodeId);
+      return XST_FAILURE;
+    }
+    for (u32 b = 0; b < NUM_BLOCKS; b++) {
+      u64 Submit, Done;
+      if (DecodeBlock(CodePtr, b & 0xFF, &Submit, &Done) != XST_SUCCESS) {
+        xil_printf("SD-FEC benchmark Failed: code %d block %d timed out\r\n", CodePtr->CodeId, b);
+        return XST_FAILURE;
+      }
+      u32 Status = StatusBuf[0];
+      XSdFecStatsRecord(&Stats,
+                        (Status & STATUS_CODE_MASK)  >> STATUS_CODE_LSB,
+                        (Status & STATUS_ITERS_MASK) >> STATUS_ITERS_LSB,
+                        (Status & STATUS_PASS_MASK)  >> STATUS_PASS_LSB,
+                        Submit, Done);
+    }
+  }
+
+  XSdFecStatsReport(&Stats, COUNTS_PER_SECOND);
+  xil_printf("Successfully ran SD-FEC benchmark\r\n");
+  return XST_SUCCESS;
+}
+
+static int DmaInit(XAxiDma* DmaPtr, u16 DeviceId) {
+  XAxiDma_Config* CfgPtr = XAxiDma_LookupConfig(DeviceId);
+  if (!CfgPtr) {
+    return XST_FAILURE;
+  }
+  if (XAxiDma_CfgInitialize(DmaPtr, CfgPtr) != XST_SUCCESS || XAxiDma_HasSg(DmaPtr)) {
+    return XST_FAILURE;
+  }
+  XAxiDma_IntrDisable(DmaPtr, XAXIDMA_IRQ_ALL_MASK, XAXIDMA_DEVICE_TO_DMA);
+  XAxiDma_IntrDisable(DmaPtr, XAXIDMA_IRQ_ALL_MASK, XAXIDMA_DMA_TO_DEVICE);
+  return XST_SUCCESS;
+}
+
+// Decode one block and return the time its control word was submitted and its status received
+static int DecodeBlock(const BenchCode* CodePtr, u32 Id, u64* SubmitPtr, u64* DonePtr) {
+  XTime Time;
+  u32 Timeout;
+
+  // Receivers first, so no output is back-pressured
+  Xil_DCacheInvalidateRange((UINTPTR)StatusBuf, sizeof(StatusBuf));
+  Xil_DCacheInvalidateRange((UINTPTR)DoutBuf, CodePtr->DoutBytes);
+  if (XAxiDma_SimpleTransfer(&CtrlDma, (UINTPTR)StatusBuf, sizeof(u32), XAXIDMA_DEVICE_TO_DMA) != XST_SUCCESS ||
+      XAxiDma_SimpleTransfer(&DataDma, (UINTPTR)DoutBuf, CodePtr->DoutBytes, XAXIDMA_DEVICE_TO_DMA) != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  CtrlBuf[0] = CTRL_WORD(CodePtr->CodeId, Id);
+  Xil_DCacheFlushRange((UINTPTR)CtrlBuf, sizeof(u32));
+  XTime_GetTime(&Time);
+  *SubmitPtr = Time;
+  if (XAxiDma_SimpleTransfer(&CtrlDma, (UINTPTR)CtrlBuf, sizeof(u32), XAXIDMA_DMA_TO_DEVICE) != XST_SUCCESS ||
+      XAxiDma_SimpleTransfer(&DataDma, (UINTPTR)DinBuf, CodePtr->DinBytes, XAXIDMA_DMA_TO_DEVICE) != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  // The status word is the last output of a block
+  for (Timeout = 0; XAxiDma_Busy(&CtrlDma, XAXIDMA_DEVICE_TO_DMA); Timeout++) {
+    if (Timeout == DMA_TIMEOUT) {
+      return XST_FAILURE;
+    }
+  }
+  XTime_GetTime(&Time);
+  *DonePtr = Time;
+
+  for (Timeout = 0; XAxiDma_Busy(&DataDma, XAXIDMA_DEVICE_TO_DMA) ||
+                    XAxiDma_Busy(&DataDma, XAXIDMA_DMA_TO_DEVICE) ||
+                    XAxiDma_Busy(&CtrlDma, XAXIDMA_DMA_TO_DEVICE); Timeout++) {
+    if (Timeout == DMA_TIMEOUT) {
+      return XST_FAILURE;
+    }
+  }
+  return XST_SUCCESS;
+}
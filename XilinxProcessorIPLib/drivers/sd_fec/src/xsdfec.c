@@ -47,6 +47,7 @@
 
 /***************************** Include Files *********************************/
 #include "xsdfec.h"
+#include "xil_printf.h"
 
 /************************** Function Implementation *************************/
 int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
@@ -66,15 +67,9 @@ int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
     return XST_SUCCESS;
 }
 
-void XSdFecAddLdpcParams(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOffset, u32 QCOffset, const XSdFecLdpcParameters* ParamsPtr) {
-  Xil_AssertVoid(InstancePtr != NULL);
-  Xil_AssertVoid(ParamsPtr   != NULL);
-  Xil_AssertVoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
-  Xil_AssertVoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
-  
-  u32 wr_data = 0;
-  if (CodeId < 128) {
-    wr_data = 0;
+// Write the code parameter registers of a code ID, without touching the share tables
+static void XSdFecSetLdpcCodeRegs(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOffset, u32 QCOffset, const XSdFecLdpcParameters* ParamsPtr) {
+    u32 wr_data = 0;
     wr_data |= (XSDFEC_LDPC_CODE_REG0_N_MASK & (ParamsPtr->N << XSDFEC_LDPC_CODE_REG0_N_LSB));
     wr_data |= (XSDFEC_LDPC_CODE_REG0_K_MASK & (ParamsPtr->K << XSDFEC_LDPC_CODE_REG0_K_LSB));
     XSdFecWrite_LDPC_CODE_REG0_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
@@ -96,15 +91,25 @@ void XSdFecAddLdpcParams(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOf
     wr_data |= (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK & (LAOffset << XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB));
     wr_data |= (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK & (QCOffset << XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB));
     XSdFecWrite_LDPC_CODE_REG3_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
-    
-    XSdFecWrite_LDPC_SC_TABLE_Words(InstancePtr->BaseAddress,SCOffset  , ParamsPtr->SCTable,(ParamsPtr->NLayers+3)>>2); // Scale is packed, 4 per reg
-    XSdFecWrite_LDPC_LA_TABLE_Words(InstancePtr->BaseAddress,LAOffset*4, ParamsPtr->LATable,ParamsPtr->NLayers); // Further 4x applied to offset in function
-    XSdFecWrite_LDPC_QC_TABLE_Words(InstancePtr->BaseAddress,QCOffset*4, ParamsPtr->QCTable,ParamsPtr->NQC);
-    
+
     // Store offsets
     InstancePtr->SCOffset[CodeId] = SCOffset;
     InstancePtr->LAOffset[CodeId] = LAOffset;
     InstancePtr->QCOffset[CodeId] = QCOffset;
+}
+
+void XSdFecAddLdpcParams(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOffset, u32 QCOffset, const XSdFecLdpcParameters* ParamsPtr) {
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(ParamsPtr   != NULL);
+  Xil_AssertVoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
+  Xil_AssertVoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
+
+  if (CodeId < 128) {
+    XSdFecSetLdpcCodeRegs(InstancePtr, CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr);
+
+    XSdFecWrite_LDPC_SC_TABLE_Words(InstancePtr->BaseAddress,SCOffset  , ParamsPtr->SCTable,(ParamsPtr->NLayers+3)>>2); // Scale is packed, 4 per reg
+    XSdFecWrite_LDPC_LA_TABLE_Words(InstancePtr->BaseAddress,LAOffset*4, ParamsPtr->LATable,ParamsPtr->NLayers); // Further 4x applied to offset in function
+    XSdFecWrite_LDPC_QC_TABLE_Words(InstancePtr->BaseAddress,QCOffset*4, ParamsPtr->QCTable,ParamsPtr->NQC);
   }
 }
 
@@ -121,6 +126,229 @@ void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr,
   }
 }
 
+// Find a share table with the same contents already loaded by the library, or allocate space for a new one.
+// Returns the table offset in Unit sized steps, or XSDFEC_CODE_LIB_NO_OFFSET when the table memory is full.
+static u32 XSdFecCodeLibAlloc(XSdFecCodeLibTables* TablesPtr, const u32* DataPtr, u32 NumData, u32 Size, u32 Capacity, u32* IsNewPtr) {
+  u32 hash = 0;
+  for (u32 i = 0; i < NumData; i++) {
+    hash = (hash * 31) + DataPtr[i];
+  }
+  for (u32 t = 0; t < TablesPtr->NumTables; t++) {
+    XSdFecCodeLibTable* TablePtr = &TablesPtr->Table[t];
+    if (TablePtr->NumData != NumData || TablePtr->Hash != hash) {
+      continue;
+    }
+    u32 i = 0;
+    while (i < NumData && TablePtr->DataPtr[i] == DataPtr[i]) {
+      i++;
+    }
+    if (i == NumData) {
+      *IsNewPtr = 0;
+      return TablePtr->Offset;
+    }
+  }
+  if (TablesPtr->NumTables >= XSDFEC_CODE_LIB_MAX_CODES || TablesPtr->NextOffset + Size > Capacity) {
+    return XSDFEC_CODE_LIB_NO_OFFSET;
+  }
+  XSdFecCodeLibTable* TablePtr = &TablesPtr->Table[TablesPtr->NumTables++];
+  TablePtr->DataPtr = DataPtr;
+  TablePtr->NumData = NumData;
+  TablePtr->Hash    = hash;
+  TablePtr->Offset  = TablesPtr->NextOffset;
+  TablesPtr->NextOffset += Size;
+  *IsNewPtr = 1;
+  return TablePtr->Offset;
+}
+
+static u32 XSdFecCodeLibHash(u32 N, u32 K, u32 PSize) {
+  return ((N * 2654435761U) ^ (K * 40503U) ^ PSize) & (XSDFEC_CODE_LIB_HASH_SIZE-1);
+}
+
+void XSdFecCodeLibInit(XSdFecCodeLib* LibPtr, XSdFec *InstancePtr) {
+  Xil_AssertVoid(LibPtr      != NULL);
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
+
+  LibPtr->InstancePtr   = InstancePtr;
+  LibPtr->NumCodes      = 0;
+  LibPtr->SC.NumTables  = 0;
+  LibPtr->SC.NextOffset = 0;
+  LibPtr->LA.NumTables  = 0;
+  LibPtr->LA.NextOffset = 0;
+  LibPtr->QC.NumTables  = 0;
+  LibPtr->QC.NextOffset = 0;
+  for (u32 i = 0; i < XSDFEC_CODE_LIB_HASH_SIZE; i++) {
+    LibPtr->Hash[i] = XSDFEC_CODE_LIB_NO_CODE;
+  }
+}
+
+int XSdFecCodeLibAdd(XSdFecCodeLib* LibPtr, const XSdFecLdpcParameters* ParamsPtr, u32* CodeIdPtr) {
+  Xil_AssertNonvoid(LibPtr    != NULL);
+  Xil_AssertNonvoid(ParamsPtr != NULL);
+  Xil_AssertNonvoid(CodeIdPtr != NULL);
+  Xil_AssertNonvoid(LibPtr->InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
+
+  XSdFec* InstancePtr = LibPtr->InstancePtr;
+
+  // A code with the same N, K and PSize is already loaded
+  if (XSdFecCodeLibLookup(LibPtr, ParamsPtr->N, ParamsPtr->K, ParamsPtr->PSize, CodeIdPtr) == XST_SUCCESS) {
+    return XST_SUCCESS;
+  }
+  if (LibPtr->NumCodes >= XSDFEC_CODE_LIB_MAX_CODES) {
+    return XST_FAILURE;
+  }
+
+  u32 SCSize, LASize, QCSize;
+  u32 SCNew,  LANew,  QCNew;
+  u32 SCTables = LibPtr->SC.NumTables, SCNext = LibPtr->SC.NextOffset;
+  u32 LATables = LibPtr->LA.NumTables, LANext = LibPtr->LA.NextOffset;
+  u32 QCTables = LibPtr->QC.NumTables, QCNext = LibPtr->QC.NextOffset;
+  XSdFecShareTableSize(ParamsPtr, &SCSize, &LASize, &QCSize);
+  u32 SCOffset = XSdFecCodeLibAlloc(&LibPtr->SC, ParamsPtr->SCTable, SCSize, SCSize,
+                                    XSDFEC_LDPC_SC_TABLE_DEPTH>>2, &SCNew);
+  u32 LAOffset = XSdFecCodeLibAlloc(&LibPtr->LA, ParamsPtr->LATable, ParamsPtr->NLayers, LASize,
+                                    XSDFEC_LDPC_LA_TABLE_DEPTH>>4, &LANew);
+  u32 QCOffset = XSdFecCodeLibAlloc(&LibPtr->QC, ParamsPtr->QCTable, ParamsPtr->NQC, QCSize,
+                                    XSDFEC_LDPC_QC_TABLE_DEPTH>>4, &QCNew);
+  if (SCOffset == XSDFEC_CODE_LIB_NO_OFFSET || LAOffset == XSDFEC_CODE_LIB_NO_OFFSET ||
+      QCOffset == XSDFEC_CODE_LIB_NO_OFFSET) {
+    // Release the tables allocated for this code, they were never written
+    LibPtr->SC.NumTables  = SCTables;
+    LibPtr->SC.NextOffset = SCNext;
+    LibPtr->LA.NumTables  = LATables;
+    LibPtr->LA.NextOffset = LANext;
+    LibPtr->QC.NumTables  = QCTables;
+    LibPtr->QC.NextOffset = QCNext;
+    return XST_FAILURE;
+  }
+
+  // Only tables not already in the share table memory are written
+  if (SCNew) {
+    XSdFecWrite_LDPC_SC_TABLE_Words(InstancePtr->BaseAddress,SCOffset  , ParamsPtr->SCTable,SCSize);
+  }
+  if (LANew) {
+    XSdFecWrite_LDPC_LA_TABLE_Words(InstancePtr->BaseAddress,LAOffset*4, ParamsPtr->LATable,ParamsPtr->NLayers);
+  }
+  if (QCNew) {
+    XSdFecWrite_LDPC_QC_TABLE_Words(InstancePtr->BaseAddress,QCOffset*4, ParamsPtr->QCTable,ParamsPtr->NQC);
+  }
+
+  u32 CodeId = LibPtr->NumCodes++;
+  XSdFecSetLdpcCodeRegs(InstancePtr, CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr);
+
+  u32 slot = XSdFecCodeLibHash(ParamsPtr->N, ParamsPtr->K, ParamsPtr->PSize);
+  while (LibPtr->Hash[slot] != XSDFEC_CODE_LIB_NO_CODE) {
+    slot = (slot + 1) & (XSDFEC_CODE_LIB_HASH_SIZE-1);
+  }
+  LibPtr->Hash[slot]         = CodeId;
+  LibPtr->Key[CodeId].N      = ParamsPtr->N;
+  LibPtr->Key[CodeId].K      = ParamsPtr->K;
+  LibPtr->Key[CodeId].PSize  = ParamsPtr->PSize;
+
+  *CodeIdPtr = CodeId;
+  return XST_SUCCESS;
+}
+
+int XSdFecCodeLibLookup(const XSdFecCodeLib* LibPtr, u32 N, u32 K, u32 PSize, u32* CodeIdPtr) {
+  Xil_AssertNonvoid(LibPtr    != NULL);
+  Xil_AssertNonvoid(CodeIdPtr != NULL);
+
+  u32 slot = XSdFecCodeLibHash(N, K, PSize);
+  while (LibPtr->Hash[slot] != XSDFEC_CODE_LIB_NO_CODE) {
+    const XSdFecCodeLibKey* KeyPtr = &LibPtr->Key[LibPtr->Hash[slot]];
+    if (KeyPtr->N == N && KeyPtr->K == K && KeyPtr->PSize == PSize) {
+      *CodeIdPtr = LibPtr->Hash[slot];
+      return XST_SUCCESS;
+    }
+    slot = (slot + 1) & (XSDFEC_CODE_LIB_HASH_SIZE-1);
+  }
+  return XST_FAILURE;
+}
+
+void XSdFecStatsReset(XSdFecStats* StatsPtr, u64 Now) {
+  Xil_AssertVoid(StatsPtr != NULL);
+
+  StatsPtr->StartTime = Now;
+  StatsPtr->LastTime  = Now;
+  for (u32 c = 0; c < 128; c++) {
+    XSdFecCodeStats* CodePtr = &StatsPtr->Code[c];
+    CodePtr->Blocks        = 0;
+    CodePtr->Failed        = 0;
+    CodePtr->Iterations    = 0;
+    CodePtr->MaxIterations = 0;
+    CodePtr->LatencySum    = 0;
+    CodePtr->LatencyMin    = 0xFFFFFFFF;
+    CodePtr->LatencyMax    = 0;
+    for (u32 b = 0; b < XSDFEC_STATS_LATENCY_BINS; b++) {
+      CodePtr->LatencyHist[b] = 0;
+    }
+  }
+}
+
+void XSdFecStatsRecord(XSdFecStats* StatsPtr, u32 CodeId, u32 Iterations, u32 Pass, u64 SubmitTime, u64 DoneTime) {
+  Xil_AssertVoid(StatsPtr != NULL);
+  Xil_AssertVoid(CodeId < 128);
+
+  XSdFecCodeStats* CodePtr = &StatsPtr->Code[CodeId];
+  u64 Latency = DoneTime - SubmitTime;
+  u32 Ticks   = (Latency > 0xFFFFFFFF) ? 0xFFFFFFFF : (u32)Latency;
+
+  CodePtr->Blocks++;
+  if (!Pass) {
+    CodePtr->Failed++;
+  }
+  CodePtr->Iterations += Iterations;
+  if (Iterations > CodePtr->MaxIterations) {
+    CodePtr->MaxIterations = Iterations;
+  }
+  CodePtr->LatencySum += Ticks;
+  if (Ticks < CodePtr->LatencyMin) {
+    CodePtr->LatencyMin = Ticks;
+  }
+  if (Ticks > CodePtr->LatencyMax) {
+    CodePtr->LatencyMax = Ticks;
+  }
+  // Bin by the position of the most significant bit
+  u32 Bin = 0;
+  while ((Ticks >> (Bin + 1)) != 0 && Bin < XSDFEC_STATS_LATENCY_BINS-1) {
+    Bin++;
+  }
+  CodePtr->LatencyHist[Bin]++;
+
+  if (DoneTime > StatsPtr->LastTime) {
+    StatsPtr->LastTime = DoneTime;
+  }
+}
+
+void XSdFecStatsReport(const XSdFecStats* StatsPtr, u64 TicksPerSec) {
+  Xil_AssertVoid(StatsPtr != NULL);
+  Xil_AssertVoid(TicksPerSec != 0);
+
+  u64 Elapsed = StatsPtr->LastTime - StatsPtr->StartTime;
+  xil_printf("SD-FEC statistics over %d us\r\n", (u32)((Elapsed * 1000000) / TicksPerSec));
+  for (u32 c = 0; c < 128; c++) {
+    const XSdFecCodeStats* CodePtr = &StatsPtr->Code[c];
+    if (CodePtr->Blocks == 0) {
+      continue;
+    }
+    u32 BlocksPerSec = (Elapsed == 0) ? 0 : (u32)(((u64)CodePtr->Blocks * TicksPerSec) / Elapsed);
+    xil_printf("Code %3d: %d blocks, %d failed, %d blocks/s, iterations avg %d max %d\r\n",
+               c, CodePtr->Blocks, CodePtr->Failed, BlocksPerSec,
+               (u32)(CodePtr->Iterations / CodePtr->Blocks), CodePtr->MaxIterations);
+    xil_printf("          latency us min %d avg %d max %d\r\n",
+               (u32)(((u64)CodePtr->LatencyMin * 1000000) / TicksPerSec),
+               (u32)(((CodePtr->LatencySum / CodePtr->Blocks) * 1000000) / TicksPerSec),
+               (u32)(((u64)CodePtr->LatencyMax * 1000000) / TicksPerSec));
+    for (u32 b = 0; b < XSDFEC_STATS_LATENCY_BINS; b++) {
+      if (CodePtr->LatencyHist[b] && b == XSDFEC_STATS_LATENCY_BINS-1) {
+        xil_printf("         >= %8d ticks: %d\r\n", 1 << b, CodePtr->LatencyHist[b]);
+      } else if (CodePtr->LatencyHist[b]) {
+        xil_printf("          < %8d ticks: %d\r\n", 2 << b, CodePtr->LatencyHist[b]);
+      }
+    }
+  }
+}
+
 void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* ParamsPtr) {
   Xil_AssertVoid(InstancePtr != NULL);
   Xil_AssertVoid(ParamsPtr   != NULL);
@@ -72,6 +72,12 @@
  * - XSdFecSetTurboParams(InstancePtr, ParamsPtr)                                        - Set Turbo parameters on a device
  * - XSdFecadd_ldpc_params(InstancePtr, CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr) - Add LDPC parameters to a device
  * - XSdFecShareTableSize(ParamsPtr, SCSizePtr, LASizePtr, QCSizePtr)                    - Calculate share table size for a LDPC code
+ * - XSdFecCodeLibInit(LibPtr, InstancePtr)                                              - Initialize an LDPC code library
+ * - XSdFecCodeLibAdd(LibPtr, ParamsPtr, CodeIdPtr)                                      - Add a LDPC code, sharing identical tables
+ * - XSdFecCodeLibLookup(LibPtr, N, K, PSize, CodeIdPtr)                                 - Look up the code ID of a loaded LDPC code
+ * - XSdFecStatsReset(StatsPtr, Now)                                                     - Clear per code throughput statistics
+ * - XSdFecStatsRecord(StatsPtr, CodeId, Iterations, Pass, SubmitTime, DoneTime)         - Record a decoded block
+ * - XSdFecStatsReport(StatsPtr, TicksPerSec)                                            - Print per code throughput statistics
  * - XSdFecInterruptClassifier(InstancePtr)                                              - Classify interrupts
  *
  * In addition, the driver provides set and get functions for all the individual registers defined for the SD-FEC.
@@ -157,6 +163,79 @@ typedef struct {
   u16 Scale;
 } XSdFecTurboParameters;
 
+/// Maximum number of LDPC codes held by a code library, one per code ID
+#define XSDFEC_CODE_LIB_MAX_CODES 128
+/// Size of the code library lookup hash, a power of 2 larger than XSDFEC_CODE_LIB_MAX_CODES
+#define XSDFEC_CODE_LIB_HASH_SIZE 256
+#define XSDFEC_CODE_LIB_NO_CODE   0xFFFF
+#define XSDFEC_CODE_LIB_NO_OFFSET 0xFFFFFFFF
+
+/** \brief Share table loaded by a code library
+ */
+typedef struct {
+  const u32* DataPtr; /**< Table contents, as passed in the LDPC code parameters */
+  u32 NumData;        /**< Number of table words                                */
+  u32 Hash;           /**< Hash of the table contents                           */
+  u32 Offset;         /**< Offset the table is loaded at                        */
+} XSdFecCodeLibTable;
+
+/** \brief Share table memory of one type (SC, LA or QC) managed by a code library
+ */
+typedef struct {
+  u32 NumTables;
+  u32 NextOffset;     /**< First free offset */
+  XSdFecCodeLibTable Table[XSDFEC_CODE_LIB_MAX_CODES];
+} XSdFecCodeLibTables;
+
+/** \brief Lookup key of a code library entry
+ */
+typedef struct {
+  u32 N;
+  u32 K;
+  u32 PSize;
+} XSdFecCodeLibKey;
+
+/** \brief LDPC code library
+ *
+ * Allocates code IDs and share table offsets for LDPC codes loaded at run-time. Identical SC, LA and QC tables are
+ * loaded once and shared between codes.
+ */
+typedef struct {
+  XSdFec* InstancePtr;
+  u32 NumCodes;
+  XSdFecCodeLibTables SC;
+  XSdFecCodeLibTables LA;
+  XSdFecCodeLibTables QC;
+  XSdFecCodeLibKey Key[XSDFEC_CODE_LIB_MAX_CODES];  /**< Key of each code ID             */
+  u16 Hash[XSDFEC_CODE_LIB_HASH_SIZE];              /**< Code ID lookup by N, K and PSize */
+} XSdFecCodeLib;
+
+/// Number of latency histogram bins, bin i counts latencies of 2^i up to 2^(i+1)-1 ticks
+#define XSDFEC_STATS_LATENCY_BINS 16
+
+/** \brief Throughput statistics of one code ID
+ */
+typedef struct {
+  u32 Blocks;                                  /**< Blocks completed                     */
+  u32 Failed;                                  /**< Blocks reported as not passing        */
+  u64 Iterations;                              /**< Iterations used, summed over blocks   */
+  u32 MaxIterations;                           /**< Largest iteration count of a block    */
+  u64 LatencySum;                              /**< Latency in ticks, summed over blocks  */
+  u32 LatencyMin;
+  u32 LatencyMax;
+  u32 LatencyHist[XSDFEC_STATS_LATENCY_BINS];  /**< Latency histogram                     */
+} XSdFecCodeStats;
+
+/** \brief Throughput statistics of a device
+ *
+ * Filled from the status stream by the application, times are in the ticks of any free running timer.
+ */
+typedef struct {
+  u64 StartTime;
+  u64 LastTime;
+  XSdFecCodeStats Code[128];
+} XSdFecStats;
+
 /// Default MaxScale Turbo configuration
 #define XSDFEC_TD_PARAM_MAX_DEFAULT     { 0 , 12 }
 /// Default MaxScale Turbo configuration
@@ -235,6 +314,74 @@ void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* Para
  */
 void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr, u32* LASizePtr, u32* QCSizePtr);
 
+/**\brief Initialize an LDPC code library
+ *
+ * Prepares an empty code library for the given device. The code library owns code IDs and share table memory of the
+ * device from here on, XSdFecAddLdpcParams should not be used on the same device.
+ *
+ * @param LibPtr      Pointer to code library struct
+ * @param InstancePtr Pointer to device instance struct
+ */
+void XSdFecCodeLibInit(XSdFecCodeLib* LibPtr, XSdFec *InstancePtr);
+
+/**\brief Add a LDPC code to a code library
+ *
+ * Allocates the next code ID and loads the specified LDPC code. SC, LA and QC tables identical to a table loaded for an
+ * earlier code are not loaded again, the code uses the existing table offset. The table arrays referenced by ParamsPtr
+ * must remain valid while the library is in use, they are used to detect identical tables.
+ *
+ * @param LibPtr      Pointer to code library struct
+ * @param ParamsPtr   Pointer to parameters struct for the LDPC code to be added
+ * @param CodeIdPtr   Pointer to variable to populate with the code ID of the code
+ *
+ * @returns XST_SUCCESS, also if a code with the same N, K and PSize was already loaded, or XST_FAILURE if code IDs or
+ *          share table memory are exhausted
+ */
+int XSdFecCodeLibAdd(XSdFecCodeLib* LibPtr, const XSdFecLdpcParameters* ParamsPtr, u32* CodeIdPtr);
+
+/**\brief Look up the code ID of a loaded LDPC code
+ *
+ * Constant time lookup of the code ID to select in the per-block control word.
+ *
+ * @param LibPtr      Pointer to code library struct
+ * @param N           Codeword length of the code
+ * @param K           Number of information bits of the code
+ * @param PSize       Sub-matrix (lifting) size of the code
+ * @param CodeIdPtr   Pointer to variable to populate with the code ID
+ *
+ * @returns XST_SUCCESS or XST_FAILURE if the code is not loaded
+ */
+int XSdFecCodeLibLookup(const XSdFecCodeLib* LibPtr, u32 N, u32 K, u32 PSize, u32* CodeIdPtr);
+
+/**\brief Clear per code throughput statistics
+ *
+ * @param StatsPtr    Pointer to statistics struct
+ * @param Now         Current timer value, the start of the measurement
+ */
+void XSdFecStatsReset(XSdFecStats* StatsPtr, u64 Now);
+
+/**\brief Record a decoded block
+ *
+ * Adds one block, as reported on the status stream, to the statistics of its code ID.
+ *
+ * @param StatsPtr    Pointer to statistics struct
+ * @param CodeId      Code ID of the block
+ * @param Iterations  Iterations used for the block
+ * @param Pass        Non-zero if the block passed the parity check
+ * @param SubmitTime  Timer value when the block was submitted
+ * @param DoneTime    Timer value when its status was received
+ */
+void XSdFecStatsRecord(XSdFecStats* StatsPtr, u32 CodeId, u32 Iterations, u32 Pass, u64 SubmitTime, u64 DoneTime);
+
+/**\brief Print per code throughput statistics
+ *
+ * Prints blocks/sec, iteration and latency figures for every code ID with completed blocks.
+ *
+ * @param StatsPtr    Pointer to statistics struct
+ * @param TicksPerSec Timer frequency used for SubmitTime, DoneTime and Now
+ */
+void XSdFecStatsReport(const XSdFecStats* StatsPtr, u64 TicksPerSec);
+
 /**\brief Classify interrupts
  * 
  * Queries interrupt status registers and classifies interrupt and reports recovery action
@@ -90,6 +90,12 @@
 * 3.4   mn     10/17/17 Use different commands for single and multi block
 *                       transfers
 *       mn     03/02/18 Move UHS macro check to SD card initialization routine
+*       ag     10/14/26 Route polled reads/writes through the eMMC command
+*                       queue when it is enabled. Fixed CMD23 being framed
+*                       with the data present flag.
+*       ag     10/14/26 Multi block writes optionally pre-erase with ACMD23
+*                       and use a CMD23 block count instead of auto CMD12.
+*                       Frame ACMD13 with the data present flag.
 * </pre>
 *
 ******************************************************************************/
@@ -193,6 +199,11 @@ s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 	InstancePtr->SectorCount = 0;
 	InstancePtr->Mode = XSDPS_DEFAULT_SPEED_MODE;
 	InstancePtr->Config_TapDelay = NULL;
+	InstancePtr->CmdqDepth = 0U;
+	InstancePtr->MaxPackedWr = 0U;
+	InstancePtr->WriteMode = 0U;
+	InstancePtr->Cmd23Supp = 0U;
+	InstancePtr->TuningCache = NULL;
 
 	/* Disable bus power and issue emmc hw reset */
 	if ((XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
@@ -660,6 +671,10 @@ s32 XSdPs_CardInitialize(XSdPs *InstancePtr)
 			goto RETURN_PATH;
 		}
 
+		/* CMD_SUPPORT is in SCR bits 33:32 */
+		InstancePtr->Cmd23Supp = ((SCR[3] & XSDPS_SCR_CMD23_SUPP) != 0U) ?
+				1U : 0U;
+
 		if ((SCR[1] & WIDTH_4_BIT_SUPPORT) != 0U) {
 			Status = XSdPs_Change_BusWidth(InstancePtr);
 			if (Status != XST_SUCCESS) {
@@ -1255,10 +1270,13 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 		case CMD11:
 		case CMD10:
 		case CMD12:
-		case ACMD13:
+		case CMD13:
 		case CMD16:
 			RetVal |= RESP_R1;
 		break;
+		case ACMD13:
+			RetVal |= RESP_R1 | (u32)XSDPS_DAT_PRESENT_SEL_MASK;
+		break;
 		case CMD17:
 		case CMD18:
 		case CMD19:
@@ -1267,6 +1285,12 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 		break;
 		case CMD23:
 		case ACMD23:
+		case CMD44:
+		case CMD45:
+			RetVal |= RESP_R1;
+		break;
+		case CMD46:
+		case CMD47:
 		case CMD24:
 		case CMD25:
 			RetVal |= RESP_R1 | (u32)XSDPS_DAT_PRESENT_SEL_MASK;
@@ -1340,6 +1364,12 @@ s32 XSdPs_ReadPolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff)
 		}
 	}
 
+	/* Legacy read commands are rejected while the command queue is on */
+	if (InstancePtr->CmdqDepth != 0U) {
+		Status = XSdPs_MmcCmdqTransfer(InstancePtr, Arg, BlkCnt, Buff, 0U);
+		goto RETURN_PATH;
+	}
+
 	XSdPs_SetupADMA2DescTbl(InstancePtr, BlkCnt, Buff);
 	if (InstancePtr->Config.IsCacheCoherent == 0) {
 		Xil_DCacheInvalidateRange((INTPTR)Buff,
@@ -1443,6 +1473,13 @@ s32 XSdPs_WritePolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, const u8 *Buff)
 
 	}
 
+	/* Legacy write commands are rejected while the command queue is on */
+	if (InstancePtr->CmdqDepth != 0U) {
+		Status = XSdPs_MmcCmdqTransfer(InstancePtr, Arg, BlkCnt,
+				(u8 *)Buff, 1U);
+		goto RETURN_PATH;
+	}
+
 	XSdPs_SetupADMA2DescTbl(InstancePtr, BlkCnt, Buff);
 	if (InstancePtr->Config.IsCacheCoherent == 0) {
 		Xil_DCacheFlushRange((INTPTR)Buff,
@@ -1463,6 +1500,29 @@ s32 XSdPs_WritePolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, const u8 *Buff)
 			XSDPS_TM_BLK_CNT_EN_MASK |
 			XSDPS_TM_MUL_SIN_BLK_SEL_MASK | XSDPS_TM_DMA_EN_MASK;
 
+		/* Let the card erase the whole range before it is written */
+		if (((InstancePtr->WriteMode & XSDPS_WRITE_PRE_ERASE) != 0U) &&
+				(InstancePtr->CardType == XSDPS_CARD_SD)) {
+			Status = XSdPs_SetWrBlkEraseCount(InstancePtr, BlkCnt);
+			if (Status != XST_SUCCESS) {
+				Status = XST_FAILURE;
+				goto RETURN_PATH;
+			}
+		}
+
+		/* A predefined block count ends the write without CMD12 */
+		if (((InstancePtr->WriteMode & XSDPS_WRITE_CMD23) != 0U) &&
+				((InstancePtr->CardType != XSDPS_CARD_SD) ||
+				(InstancePtr->Cmd23Supp != 0U))) {
+			Status = XSdPs_CmdTransfer(InstancePtr, CMD23, BlkCnt, 0U);
+			if (Status != XST_SUCCESS) {
+				Status = XST_FAILURE;
+				goto RETURN_PATH;
+			}
+			TransferMode = XSDPS_TM_BLK_CNT_EN_MASK |
+				XSDPS_TM_MUL_SIN_BLK_SEL_MASK | XSDPS_TM_DMA_EN_MASK;
+		}
+
 		/* Send multiple blocks write command */
 		Status = XSdPs_CmdTransfer(InstancePtr, CMD25, Arg, BlkCnt);
 		if (Status != XST_SUCCESS) {
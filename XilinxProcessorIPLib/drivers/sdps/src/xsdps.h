@@ -149,6 +149,15 @@
 *       mn     08/17/17 Enabled CCI support for A53 by adding cache coherency
 *                       information.
 *       mn     09/06/17 Resolved compilation errors with IAR toolchain
+* 3.4   ag     10/14/26 Added interrupt driven queued read/write API's with
+*                       double buffered ADMA2 descriptor tables in
+*                       xsdps_async.c.
+*       ag     10/14/26 Added eMMC command queue and packed write API's in
+*                       xsdps_cmdq.c.
+*       ag     10/14/26 Added the tuning cache, see XSdPs_SetTuningCache.
+*       ag     10/14/26 Added write modes with pre-erase (ACMD23) and CMD23
+*                       block counts, see XSdPs_SetWriteMode, and the
+*                       allocation unit query XSdPs_Get_AuSize.
 *
 * </pre>
 *
@@ -174,6 +183,20 @@ extern "C" {
 #define XSDPS_CT_ERROR	0x2U	/**< Command timeout flag */
 #define MAX_TUNING_COUNT	40U		/**< Maximum Tuning count */
 
+#define XSDPS_ASYNC_DESC_NUM	32U	/**< Descriptors per async table */
+#define XSDPS_ASYNC_MAX_BLKCNT	((XSDPS_ASYNC_DESC_NUM * XSDPS_DESC_MAX_LENGTH) \
+					/ XSDPS_BLK_SIZE_512_MASK)
+					/**< Largest async request */
+#define XSDPS_ASYNC_INTR_MASK	XSDPS_INTR_TC_MASK /**< Async interrupts */
+
+/** @name Write modes
+ * Options of polled multi block writes, see XSdPs_SetWriteMode().
+ * @{
+ */
+#define XSDPS_WRITE_PRE_ERASE	0x1U	/**< ACMD23 pre-erase, SD only */
+#define XSDPS_WRITE_CMD23	0x2U	/**< CMD23 block count, no CMD12 */
+/* @} */
+
 /**************************** Type Definitions *******************************/
 
 typedef void (*XSdPs_ConfigTap) (u32 Bank, u32 DeviceId, u32 CardType);
@@ -210,6 +233,17 @@ typedef struct {
 }  __attribute__((__packed__))XSdPs_Adma2Descriptor;
 #endif
 
+/**
+ * Tuning result kept across card initializations, see
+ * XSdPs_SetTuningCache().
+ */
+typedef struct {
+	u32 CardID[4];		/**< CID of the card the tap was found for */
+	u32 BusSpeed;		/**< Bus clock the tap was found at */
+	u8 ITap;		/**< Input tap delay */
+	u8 Valid;		/**< Non-zero if the entry holds a result */
+} XSdPs_TuningCache;
+
 /**
  * The XSdPs driver instance data. The user is required to allocate a
  * variable of this type for every SD device in the system. A pointer
@@ -234,6 +268,11 @@ typedef struct {
 	u32 SdCardConfig;	/**< Sd Card Configuration Register */
 	u32 Mode;			/**< Bus Speed Mode */
 	XSdPs_ConfigTap Config_TapDelay;	/**< Configuring the tap delays */
+	u8  CmdqDepth;		/**< eMMC command queue depth, 0 if disabled */
+	u8  MaxPackedWr;	/**< eMMC packed write entry limit */
+	u8  WriteMode;		/**< XSDPS_WRITE_* options */
+	u8  Cmd23Supp;		/**< SD card supports CMD23 */
+	XSdPs_TuningCache *TuningCache;	/**< Tuning cache or NULL */
 	/**< ADMA Descriptors */
 #ifdef __ICCARM__
 #pragma data_alignment = 32
@@ -244,6 +283,59 @@ typedef struct {
 #endif
 } XSdPs;
 
+/**
+ * One extent of a list write, see XSdPs_MmcWriteList().
+ */
+typedef struct {
+	u32 Arg;		/**< Card address, as for the polled API */
+	u32 BlkCnt;		/**< Number of 512 byte blocks */
+	const u8 *Buff;		/**< Data buffer */
+} XSdPs_Extent;
+
+struct XSdPs_RequestS;
+
+/**
+ * Completion handler of an asynchronous request. Status is XST_SUCCESS or
+ * XST_FAILURE. It is called from interrupt context.
+ */
+typedef void (*XSdPs_AsyncHandler) (void *CallBackRef,
+			struct XSdPs_RequestS *ReqPtr, s32 Status);
+
+/**
+ * An asynchronous read or write request.
+ */
+typedef struct XSdPs_RequestS {
+	struct XSdPs_RequestS *Next;	/**< Used by the driver */
+	u32 Arg;			/**< Card address, as for the polled API */
+	u32 BlkCnt;			/**< Number of 512 byte blocks */
+	u8 *Buff;			/**< Data buffer */
+	u8 IsWrite;			/**< Write if non-zero, read otherwise */
+	XSdPs_AsyncHandler Handler;	/**< Completion handler */
+	void *CallBackRef;		/**< Argument to Handler */
+	s32 Status;			/**< XST_DEVICE_BUSY until complete */
+} XSdPs_Request;
+
+/**
+ * Asynchronous I/O context. The user allocates one per XSdPs instance.
+ */
+typedef struct {
+	XSdPs *InstancePtr;		/**< Controller instance */
+	XSdPs_Request *Head;		/**< First queued request */
+	XSdPs_Request *Tail;		/**< Last queued request */
+	XSdPs_Request *Active;		/**< Request on the bus */
+	XSdPs_Request *Prepared;	/**< Request with descriptors ready */
+	u32 ActiveTbl;			/**< Table used by Active */
+	/**< ADMA Descriptors, one table per buffer */
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	XSdPs_Adma2Descriptor DescrTbl[2][XSDPS_ASYNC_DESC_NUM];
+#pragma data_alignment = 4
+#else
+	XSdPs_Adma2Descriptor DescrTbl[2][XSDPS_ASYNC_DESC_NUM]
+						__attribute__ ((aligned(32)));
+#endif
+} XSdPs_Async;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
@@ -265,6 +357,27 @@ s32 XSdPs_MmcCardInitialize(XSdPs *InstancePtr);
 s32 XSdPs_CardInitialize(XSdPs *InstancePtr);
 s32 XSdPs_Get_Mmc_ExtCsd(XSdPs *InstancePtr, u8 *ReadBuff);
 s32 XSdPs_Set_Mmc_ExtCsd(XSdPs *InstancePtr, u32 Arg);
+s32 XSdPs_SetWriteMode(XSdPs *InstancePtr, u8 Mode);
+s32 XSdPs_SetWrBlkEraseCount(XSdPs *InstancePtr, u32 BlkCnt);
+s32 XSdPs_Get_AuSize(XSdPs *InstancePtr, u32 *AuBlkCnt);
+s32 XSdPs_AsyncInitialize(XSdPs_Async *AsyncPtr, XSdPs *InstancePtr);
+s32 XSdPs_AsyncSubmit(XSdPs_Async *AsyncPtr, XSdPs_Request *ReqPtr);
+u32 XSdPs_AsyncIsBusy(XSdPs_Async *AsyncPtr);
+void XSdPs_AsyncIntrHandler(void *CallBackRef);
+void XSdPs_SetTuningCache(XSdPs *InstancePtr, XSdPs_TuningCache *CachePtr);
+s32 XSdPs_MmcCmdqEnable(XSdPs *InstancePtr);
+s32 XSdPs_MmcCmdqDisable(XSdPs *InstancePtr);
+s32 XSdPs_MmcCmdqQueue(XSdPs *InstancePtr, u32 TaskId, u32 Arg, u32 BlkCnt,
+			u8 IsWrite);
+s32 XSdPs_MmcCmdqGetReady(XSdPs *InstancePtr, u32 *ReadyMask);
+s32 XSdPs_MmcCmdqExecute(XSdPs *InstancePtr, u32 TaskId, u32 BlkCnt, u8 *Buff,
+			u8 IsWrite);
+s32 XSdPs_MmcCmdqTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff,
+			u8 IsWrite);
+s32 XSdPs_MmcPackedWrite(XSdPs *InstancePtr, const XSdPs_Extent *List,
+			u32 Num, u8 *HdrBuff);
+s32 XSdPs_MmcWriteList(XSdPs *InstancePtr, const XSdPs_Extent *List, u32 Num,
+			u8 *HdrBuff);
 #if defined (ARMR5) || defined (__aarch64__) || defined (ARMA53_32)
 void XSdPs_Identify_UhsMode(XSdPs *InstancePtr, u8 *ReadBuff);
 void XSdPs_ddr50_tapdelay(u32 Bank, u32 DeviceId, u32 CardType);
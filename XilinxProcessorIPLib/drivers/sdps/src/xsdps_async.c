@@ -0,0 +1,422 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsdps_async.c
+* @addtogroup sdps_v3_4
+* @{
+*
+* Contains the interrupt driven, queued block read and write API's.
+*
+* Requests are described by XSdPs_Request and queued on an XSdPs_Async
+* context with XSdPs_AsyncSubmit(). The controller runs one request at a time.
+* While it runs, the ADMA2 descriptors of the next queued request are built in
+* the second of two descriptor tables, so that the next command can be issued
+* from the transfer complete interrupt without building descriptors or doing
+* cache maintenance first. The completion callback of a request is called
+* from the interrupt handler after the next request has been started.
+*
+* XSdPs_AsyncIntrHandler() must be connected to the SD interrupt by the
+* application. The polled read and write API's must not be used while
+* requests are queued.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 3.4   ag     10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+s32 XSdPs_CmdTransfer(XSdPs *InstancePtr, u32 Cmd, u32 Arg, u32 BlkCnt);
+static void XSdPs_AsyncPrepare(XSdPs_Async *AsyncPtr, XSdPs_Request *ReqPtr,
+				u32 Tbl);
+static s32 XSdPs_AsyncStart(XSdPs_Async *AsyncPtr, XSdPs_Request *ReqPtr);
+static void XSdPs_AsyncKick(XSdPs_Async *AsyncPtr);
+
+extern u16 TransferMode;
+
+/*****************************************************************************/
+/**
+* Initializes an asynchronous I/O context for an initialized card. The
+* block size is set to 512 bytes and the transfer complete and error
+* interrupts are routed to the interrupt line.
+*
+* @param	AsyncPtr is a pointer to the context to initialize.
+* @param	InstancePtr is a pointer to an XSdPs instance whose card has
+*		been initialized.
+*
+* @return
+* 		- XST_SUCCESS if successful
+* 		- XST_FAILURE if the block size could not be set
+*
+******************************************************************************/
+s32 XSdPs_AsyncInitialize(XSdPs_Async *AsyncPtr, XSdPs *InstancePtr)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	AsyncPtr->InstancePtr = InstancePtr;
+	AsyncPtr->Head = NULL;
+	AsyncPtr->Tail = NULL;
+	AsyncPtr->Active = NULL;
+	AsyncPtr->Prepared = NULL;
+	AsyncPtr->ActiveTbl = 0U;
+
+	if (XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+			XSDPS_BLK_SIZE_OFFSET) != XSDPS_BLK_SIZE_512_MASK) {
+		Status = XSdPs_SetBlkSize(InstancePtr, XSDPS_BLK_SIZE_512_MASK);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET, XSDPS_ERROR_INTR_ALL_MASK);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET, XSDPS_ASYNC_INTR_MASK);
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Queues a read or write request. The fields Arg, BlkCnt, Buff, IsWrite,
+* Handler and CallBackRef of the request must be set by the caller, and the
+* request must stay allocated until its handler has been called.
+*
+* @param	AsyncPtr is a pointer to the asynchronous I/O context.
+* @param	ReqPtr is the request. Arg is the card address as for
+*		XSdPs_ReadPolled(), BlkCnt is 1 to XSDPS_ASYNC_MAX_BLKCNT.
+*
+* @return
+* 		- XST_SUCCESS if the request was queued
+* 		- XST_FAILURE if the command of the first request could not be
+* 		issued, in which case the request is not queued
+*
+* @note		May be called from the completion handler.
+*
+******************************************************************************/
+s32 XSdPs_AsyncSubmit(XSdPs_Async *AsyncPtr, XSdPs_Request *ReqPtr)
+{
+	XSdPs *InstancePtr;
+	s32 Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr->BlkCnt != 0U);
+	Xil_AssertNonvoid(ReqPtr->BlkCnt <= XSDPS_ASYNC_MAX_BLKCNT);
+
+	InstancePtr = AsyncPtr->InstancePtr;
+	ReqPtr->Next = NULL;
+	ReqPtr->Status = XST_DEVICE_BUSY;
+
+	/* Keep the interrupt handler out while the queue is changed */
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET, 0x0U);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET, 0x0U);
+
+	if (AsyncPtr->Active == NULL) {
+		XSdPs_AsyncPrepare(AsyncPtr, ReqPtr, AsyncPtr->ActiveTbl);
+		Status = XSdPs_AsyncStart(AsyncPtr, ReqPtr);
+	} else {
+		if (AsyncPtr->Tail == NULL) {
+			AsyncPtr->Head = ReqPtr;
+		} else {
+			AsyncPtr->Tail->Next = ReqPtr;
+		}
+		AsyncPtr->Tail = ReqPtr;
+
+		if (AsyncPtr->Prepared == NULL) {
+			XSdPs_AsyncPrepare(AsyncPtr, AsyncPtr->Head,
+					AsyncPtr->ActiveTbl ^ 1U);
+		}
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET, XSDPS_ERROR_INTR_ALL_MASK);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET, XSDPS_ASYNC_INTR_MASK);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Returns whether any request is queued or in progress.
+*
+* @param	AsyncPtr is a pointer to the asynchronous I/O context.
+*
+* @return	TRUE if a request has not completed yet, FALSE otherwise.
+*
+******************************************************************************/
+u32 XSdPs_AsyncIsBusy(XSdPs_Async *AsyncPtr)
+{
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+
+	return (AsyncPtr->Active != NULL) ? (u32)TRUE : (u32)FALSE;
+}
+
+/*****************************************************************************/
+/**
+* Interrupt handler of the asynchronous I/O API's. It completes the active
+* request on transfer complete or error, issues the next queued request and
+* then calls the completion handler of the finished request with XST_SUCCESS
+* or XST_FAILURE.
+*
+* @param	CallBackRef is the XSdPs_Async context.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSdPs_AsyncIntrHandler(void *CallBackRef)
+{
+	XSdPs_Async *AsyncPtr = (XSdPs_Async *)CallBackRef;
+	XSdPs *InstancePtr;
+	XSdPs_Request *DonePtr;
+	u32 StatusReg;
+
+	Xil_AssertVoid(AsyncPtr != NULL);
+
+	InstancePtr = AsyncPtr->InstancePtr;
+	StatusReg = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_STS_OFFSET);
+	DonePtr = AsyncPtr->Active;
+
+	if ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U) {
+		/* Write to clear error bits */
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_ERR_INTR_STS_OFFSET,
+				XSDPS_ERROR_INTR_ALL_MASK);
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_STS_OFFSET, XSDPS_INTR_TC_MASK);
+		if (DonePtr != NULL) {
+			DonePtr->Status = XST_FAILURE;
+		}
+	} else if ((StatusReg & XSDPS_INTR_TC_MASK) != 0U) {
+		/* Write to clear bit */
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_STS_OFFSET, XSDPS_INTR_TC_MASK);
+		if (DonePtr != NULL) {
+			DonePtr->Status = XST_SUCCESS;
+		}
+	} else {
+		return;
+	}
+
+	if (DonePtr == NULL) {
+		return;
+	}
+
+	if ((DonePtr->IsWrite == 0U) &&
+			(InstancePtr->Config.IsCacheCoherent == 0U)) {
+		Xil_DCacheInvalidateRange((INTPTR)DonePtr->Buff,
+			DonePtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+	}
+
+	AsyncPtr->Active = NULL;
+	XSdPs_AsyncKick(AsyncPtr);
+
+	if (DonePtr->Handler != NULL) {
+		DonePtr->Handler(DonePtr->CallBackRef, DonePtr, DonePtr->Status);
+	}
+}
+
+/*****************************************************************************/
+/**
+* Starts queued requests after the active one has finished. The request at
+* the head of the queue normally has its descriptors ready; the one after it
+* is prepared in the descriptor table just released. A request whose
+* command cannot be issued is completed with XST_FAILURE.
+*
+* @param	AsyncPtr is a pointer to the asynchronous I/O context.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XSdPs_AsyncKick(XSdPs_Async *AsyncPtr)
+{
+	XSdPs_Request *ReqPtr;
+
+	while (AsyncPtr->Head != NULL) {
+		ReqPtr = AsyncPtr->Head;
+		AsyncPtr->Head = ReqPtr->Next;
+		if (AsyncPtr->Head == NULL) {
+			AsyncPtr->Tail = NULL;
+		}
+
+		AsyncPtr->ActiveTbl ^= 1U;
+		if (AsyncPtr->Prepared != ReqPtr) {
+			XSdPs_AsyncPrepare(AsyncPtr, ReqPtr, AsyncPtr->ActiveTbl);
+		}
+		AsyncPtr->Prepared = NULL;
+
+		if (XSdPs_AsyncStart(AsyncPtr, ReqPtr) == XST_SUCCESS) {
+			if (AsyncPtr->Head != NULL) {
+				XSdPs_AsyncPrepare(AsyncPtr, AsyncPtr->Head,
+						AsyncPtr->ActiveTbl ^ 1U);
+			}
+			break;
+		}
+
+		ReqPtr->Status = XST_FAILURE;
+		if (ReqPtr->Handler != NULL) {
+			ReqPtr->Handler(ReqPtr->CallBackRef, ReqPtr,
+					ReqPtr->Status);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* Builds the ADMA2 descriptors of a request in one of the two descriptor
+* tables and does the cache maintenance of the data buffer.
+*
+* @param	AsyncPtr is a pointer to the asynchronous I/O context.
+* @param	ReqPtr is the request.
+* @param	Tbl is the descriptor table, 0 or 1.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XSdPs_AsyncPrepare(XSdPs_Async *AsyncPtr, XSdPs_Request *ReqPtr,
+				u32 Tbl)
+{
+	XSdPs_Adma2Descriptor *DescPtr = AsyncPtr->DescrTbl[Tbl];
+	UINTPTR Addr = (UINTPTR)ReqPtr->Buff;
+	u32 Remaining = ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+	u32 DescNum = 0U;
+	u32 Len;
+
+	while (Remaining > 0U) {
+		Len = (Remaining > XSDPS_DESC_MAX_LENGTH) ?
+			XSDPS_DESC_MAX_LENGTH : Remaining;
+#ifdef __aarch64__
+		DescPtr[DescNum].Address = (u64)Addr;
+#else
+		DescPtr[DescNum].Address = (u32)Addr;
+#endif
+		DescPtr[DescNum].Attribute = XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+		/* A length of 65536 is written as '0' */
+		DescPtr[DescNum].Length = (u16)Len;
+		Addr += Len;
+		Remaining -= Len;
+		DescNum++;
+	}
+	DescPtr[DescNum - 1U].Attribute |= XSDPS_DESC_END;
+
+	if (AsyncPtr->InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)DescPtr,
+			sizeof(XSdPs_Adma2Descriptor) * DescNum);
+		if (ReqPtr->IsWrite != 0U) {
+			Xil_DCacheFlushRange((INTPTR)ReqPtr->Buff,
+				ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		} else {
+			Xil_DCacheInvalidateRange((INTPTR)ReqPtr->Buff,
+				ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		}
+	}
+
+	AsyncPtr->Prepared = ReqPtr;
+}
+
+/*****************************************************************************/
+/**
+* Points the ADMA to the active descriptor table and issues the read or
+* write command of a prepared request. Only the command phase is waited for.
+*
+* @param	AsyncPtr is a pointer to the asynchronous I/O context.
+* @param	ReqPtr is the request, prepared in the active table.
+*
+* @return
+* 		- XST_SUCCESS if the command was accepted
+* 		- XST_FAILURE otherwise
+*
+******************************************************************************/
+static s32 XSdPs_AsyncStart(XSdPs_Async *AsyncPtr, XSdPs_Request *ReqPtr)
+{
+	XSdPs *InstancePtr = AsyncPtr->InstancePtr;
+	XSdPs_Adma2Descriptor *DescPtr = AsyncPtr->DescrTbl[AsyncPtr->ActiveTbl];
+	u32 Cmd;
+	s32 Status;
+
+#ifdef __aarch64__
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_EXT_OFFSET,
+			(u32)(((u64)(UINTPTR)DescPtr) >> 32));
+#endif
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
+			(u32)(UINTPTR)DescPtr);
+
+	TransferMode = XSDPS_TM_BLK_CNT_EN_MASK | XSDPS_TM_DMA_EN_MASK;
+	if (ReqPtr->IsWrite == 0U) {
+		TransferMode |= XSDPS_TM_DAT_DIR_SEL_MASK;
+	}
+	if (ReqPtr->BlkCnt == 1U) {
+		Cmd = (ReqPtr->IsWrite != 0U) ? CMD24 : CMD17;
+	} else {
+		TransferMode |= XSDPS_TM_AUTO_CMD12_EN_MASK |
+				XSDPS_TM_MUL_SIN_BLK_SEL_MASK;
+		Cmd = (ReqPtr->IsWrite != 0U) ? CMD25 : CMD18;
+	}
+
+	AsyncPtr->Active = ReqPtr;
+	AsyncPtr->Prepared = NULL;
+	Status = XSdPs_CmdTransfer(InstancePtr, Cmd, ReqPtr->Arg, ReqPtr->BlkCnt);
+	if (Status != XST_SUCCESS) {
+		AsyncPtr->Active = NULL;
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+/** @} */
@@ -0,0 +1,679 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsdps_cmdq.c
+* @addtogroup sdps_v3_4
+* @{
+*
+* Contains the eMMC command queue and packed write API's.
+*
+* The host controller has no command queue engine, so the eMMC 5.1 command
+* queue is driven in software: tasks are queued with CMD44/CMD45, the queue
+* status is read with CMD13 (SQS) and ready tasks are run with CMD46/CMD47.
+* Once XSdPs_MmcCmdqEnable() has turned the queue on, the card no longer
+* accepts the legacy read/write commands; XSdPs_ReadPolled() and
+* XSdPs_WritePolled() then use a single queued task per call.
+*
+* For cards without a command queue, XSdPs_MmcPackedWrite() writes several
+* small, non-contiguous extents with one CMD23/CMD25 pair using the packed
+* command header. XSdPs_MmcWriteList() picks the best available method.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 3.4   ag     10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+s32 XSdPs_CmdTransfer(XSdPs *InstancePtr, u32 Cmd, u32 Arg, u32 BlkCnt);
+void XSdPs_SetupADMA2DescTbl(XSdPs *InstancePtr, u32 BlkCnt, const u8 *Buff);
+static s32 XSdPs_MmcWaitXfer(XSdPs *InstancePtr);
+static u32 XSdPs_MmcDescCount(u32 BlkCnt);
+
+extern u16 TransferMode;
+
+/*****************************************************************************/
+/**
+* Reads the command queue and packed command capabilities of an eMMC and
+* enables the command queue if the card supports it.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance with an
+*		initialized eMMC card.
+*
+* @return
+*		- XST_SUCCESS if the command queue was enabled.
+*		- XST_NO_FEATURE if the card has no command queue. The packed
+*		  write limit is still recorded.
+*		- XST_FAILURE if a command failed.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcCmdqEnable(XSdPs *InstancePtr)
+{
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	static u8 ExtCsd[512];
+#pragma data_alignment = 4
+#else
+	static u8 ExtCsd[512] __attribute__ ((aligned(32)));
+#endif
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->CardType == XSDPS_CARD_SD) {
+		Status = XST_NO_FEATURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->CmdqDepth = 0U;
+	Status = XSdPs_Get_Mmc_ExtCsd(InstancePtr, ExtCsd);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->MaxPackedWr = ExtCsd[EXT_CSD_MAX_PACKED_WRITES_BYTE];
+
+	if ((ExtCsd[EXT_CSD_CMDQ_SUPPORT_BYTE] & EXT_CSD_CMDQ_SUPPORT) == 0U) {
+		Status = XST_NO_FEATURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_EN_ARG);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* Queue depth is reported as N - 1 */
+	InstancePtr->CmdqDepth = (u8)((ExtCsd[EXT_CSD_CMDQ_DEPTH_BYTE] &
+					EXT_CSD_CMDQ_DEPTH_MASK) + 1U);
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Turns the eMMC command queue off. The queue must be empty.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcCmdqDisable(XSdPs *InstancePtr)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_DIS_ARG);
+	if (Status == XST_SUCCESS) {
+		InstancePtr->CmdqDepth = 0U;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Queues a read or write task on the eMMC (CMD44 and CMD45).
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	TaskId is the task number, 0 to CmdqDepth - 1. It must not be
+*		in use.
+* @param	Arg is the card address, as for XSdPs_ReadPolled().
+* @param	BlkCnt is the number of 512 byte blocks.
+* @param	IsWrite is non-zero for a write task.
+*
+* @return
+*		- XST_SUCCESS if the task was queued.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcCmdqQueue(XSdPs *InstancePtr, u32 TaskId, u32 Arg, u32 BlkCnt,
+			u8 IsWrite)
+{
+	s32 Status;
+	u32 TaskArg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TaskId < InstancePtr->CmdqDepth);
+	Xil_AssertNonvoid((BlkCnt != 0U) && (BlkCnt <= 0xFFFFU));
+
+	TaskArg = (TaskId << XSDPS_CMDQ_TASK_ID_SHIFT) | BlkCnt;
+	if (IsWrite == 0U) {
+		TaskArg |= XSDPS_CMDQ_TASK_READ;
+	}
+
+	Status = XSdPs_CmdTransfer(InstancePtr, CMD44, TaskArg, 0U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CmdTransfer(InstancePtr, CMD45, Arg, 0U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Reads the queue status register of the eMMC (CMD13 with SQS set).
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	ReadyMask receives one bit per task that is ready to execute.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcCmdqGetReady(XSdPs *InstancePtr, u32 *ReadyMask)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ReadyMask != NULL);
+
+	Status = XSdPs_CmdTransfer(InstancePtr, CMD13,
+			InstancePtr->RelCardAddr | XSDPS_CMDQ_SQS, 0U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	*ReadyMask = XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+			XSDPS_RESP0_OFFSET);
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Executes a ready task (CMD46 or CMD47) and waits for its data transfer.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	TaskId is a task reported ready by XSdPs_MmcCmdqGetReady().
+* @param	BlkCnt is the block count the task was queued with.
+* @param	Buff is the data buffer.
+* @param	IsWrite is non-zero for a write task.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcCmdqExecute(XSdPs *InstancePtr, u32 TaskId, u32 BlkCnt, u8 *Buff,
+			u8 IsWrite)
+{
+	s32 Status;
+	u32 Cmd;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Buff != NULL);
+
+	if (XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+			XSDPS_BLK_SIZE_OFFSET) != XSDPS_BLK_SIZE_512_MASK) {
+		Status = XSdPs_SetBlkSize(InstancePtr, XSDPS_BLK_SIZE_512_MASK);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	}
+
+	XSdPs_SetupADMA2DescTbl(InstancePtr, BlkCnt, Buff);
+
+	/* The task carries the block count, no CMD12 is needed */
+	TransferMode = XSDPS_TM_BLK_CNT_EN_MASK | XSDPS_TM_DMA_EN_MASK;
+	if (BlkCnt > 1U) {
+		TransferMode |= XSDPS_TM_MUL_SIN_BLK_SEL_MASK;
+	}
+
+	if (IsWrite != 0U) {
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR)Buff,
+				BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		}
+		Cmd = CMD47;
+	} else {
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheInvalidateRange((INTPTR)Buff,
+				BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		}
+		TransferMode |= XSDPS_TM_DAT_DIR_SEL_MASK;
+		Cmd = CMD46;
+	}
+
+	Status = XSdPs_CmdTransfer(InstancePtr, Cmd,
+			TaskId << XSDPS_CMDQ_TASK_ID_SHIFT, BlkCnt);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_MmcWaitXfer(InstancePtr);
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Runs one read or write through the command queue, using task 0. This is
+* used by the polled read and write API's while the queue is enabled.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	Arg is the card address.
+* @param	BlkCnt is the number of 512 byte blocks.
+* @param	Buff is the data buffer.
+* @param	IsWrite is non-zero for a write.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcCmdqTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff,
+			u8 IsWrite)
+{
+	s32 Status;
+	u32 ReadyMask = 0U;
+
+	Status = XSdPs_MmcCmdqQueue(InstancePtr, 0U, Arg, BlkCnt, IsWrite);
+	if (Status != XST_SUCCESS) {
+		goto RETURN_PATH;
+	}
+
+	while ((ReadyMask & 0x1U) == 0U) {
+		Status = XSdPs_MmcCmdqGetReady(InstancePtr, &ReadyMask);
+		if (Status != XST_SUCCESS) {
+			goto RETURN_PATH;
+		}
+	}
+
+	Status = XSdPs_MmcCmdqExecute(InstancePtr, 0U, BlkCnt, Buff, IsWrite);
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Writes several extents with a single packed write command. The packed
+* command header is built in HdrBuff and sent as the first block, followed by
+* the data of each extent.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	List is the array of extents to write.
+* @param	Num is the number of extents, 1 to the MaxPackedWr limit read by
+*		XSdPs_MmcCmdqEnable().
+* @param	HdrBuff is a 512 byte, cache line aligned scratch buffer.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if the extents do not fit one packed command
+*		  or one ADMA2 descriptor table.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcPackedWrite(XSdPs *InstancePtr, const XSdPs_Extent *List,
+			u32 Num, u8 *HdrBuff)
+{
+	s32 Status;
+	u32 Index;
+	u32 DescNum;
+	u32 TotalBlks = 1U;
+	u32 NumDesc = 1U;
+	u32 Remaining;
+	u32 Len;
+	UINTPTR Addr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(List != NULL);
+	Xil_AssertNonvoid(HdrBuff != NULL);
+
+	if ((Num == 0U) || (Num > InstancePtr->MaxPackedWr) ||
+			(((Num + 1U) * 8U) > XSDPS_BLK_SIZE_512_MASK)) {
+		Status = XST_INVALID_PARAM;
+		goto RETURN_PATH;
+	}
+	for (Index = 0U; Index < Num; Index++) {
+		TotalBlks += List[Index].BlkCnt;
+		NumDesc += XSdPs_MmcDescCount(List[Index].BlkCnt);
+	}
+	if ((TotalBlks > 0xFFFFU) || (NumDesc > 32U)) {
+		Status = XST_INVALID_PARAM;
+		goto RETURN_PATH;
+	}
+
+	if (XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+			XSDPS_BLK_SIZE_OFFSET) != XSDPS_BLK_SIZE_512_MASK) {
+		Status = XSdPs_SetBlkSize(InstancePtr, XSDPS_BLK_SIZE_512_MASK);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	}
+
+	/* Packed command header: version, R/W, entry count, then CMD23/CMD25 args */
+	(void)memset(HdrBuff, 0, XSDPS_BLK_SIZE_512_MASK);
+	HdrBuff[0] = XSDPS_PACKED_HDR_VERSION;
+	HdrBuff[1] = XSDPS_PACKED_HDR_WRITE;
+	HdrBuff[2] = (u8)Num;
+	for (Index = 0U; Index < Num; Index++) {
+		HdrBuff[((Index + 1U) * 8U)] = (u8)List[Index].BlkCnt;
+		HdrBuff[((Index + 1U) * 8U) + 1U] = (u8)(List[Index].BlkCnt >> 8);
+		HdrBuff[((Index + 1U) * 8U) + 4U] = (u8)List[Index].Arg;
+		HdrBuff[((Index + 1U) * 8U) + 5U] = (u8)(List[Index].Arg >> 8);
+		HdrBuff[((Index + 1U) * 8U) + 6U] = (u8)(List[Index].Arg >> 16);
+		HdrBuff[((Index + 1U) * 8U) + 7U] = (u8)(List[Index].Arg >> 24);
+	}
+
+	/* One descriptor for the header, then the extents */
+#ifdef __aarch64__
+	InstancePtr->Adma2_DescrTbl[0].Address = (u64)(UINTPTR)HdrBuff;
+#else
+	InstancePtr->Adma2_DescrTbl[0].Address = (u32)(UINTPTR)HdrBuff;
+#endif
+	InstancePtr->Adma2_DescrTbl[0].Attribute =
+			XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+	InstancePtr->Adma2_DescrTbl[0].Length = (u16)XSDPS_BLK_SIZE_512_MASK;
+	DescNum = 1U;
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)HdrBuff, XSDPS_BLK_SIZE_512_MASK);
+	}
+
+	for (Index = 0U; Index < Num; Index++) {
+		Addr = (UINTPTR)List[Index].Buff;
+		Remaining = List[Index].BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR)Addr, Remaining);
+		}
+		while (Remaining > 0U) {
+			Len = (Remaining > XSDPS_DESC_MAX_LENGTH) ?
+				XSDPS_DESC_MAX_LENGTH : Remaining;
+#ifdef __aarch64__
+			InstancePtr->Adma2_DescrTbl[DescNum].Address = (u64)Addr;
+#else
+			InstancePtr->Adma2_DescrTbl[DescNum].Address = (u32)Addr;
+#endif
+			InstancePtr->Adma2_DescrTbl[DescNum].Attribute =
+					XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+			/* This will write '0' to length field which indicates 65536 */
+			InstancePtr->Adma2_DescrTbl[DescNum].Length = (u16)Len;
+			Addr += Len;
+			Remaining -= Len;
+			DescNum++;
+		}
+	}
+	InstancePtr->Adma2_DescrTbl[DescNum - 1U].Attribute |= XSDPS_DESC_END;
+
+#ifdef __aarch64__
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_EXT_OFFSET,
+			(u32)(((u64)&(InstancePtr->Adma2_DescrTbl[0]))>>32));
+#endif
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
+			(u32)(UINTPTR)&(InstancePtr->Adma2_DescrTbl[0]));
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)&(InstancePtr->Adma2_DescrTbl[0]),
+			sizeof(XSdPs_Adma2Descriptor) * 32U);
+	}
+
+	/* CMD23 carries the total block count, so no CMD12 is sent */
+	Status = XSdPs_CmdTransfer(InstancePtr, CMD23,
+			XSDPS_PACKED_CMD_ARG | TotalBlks, 0U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	TransferMode = XSDPS_TM_BLK_CNT_EN_MASK |
+		XSDPS_TM_MUL_SIN_BLK_SEL_MASK | XSDPS_TM_DMA_EN_MASK;
+	Status = XSdPs_CmdTransfer(InstancePtr, CMD25, List[0].Arg, TotalBlks);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_MmcWaitXfer(InstancePtr);
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Writes a list of extents using the fastest method the card supports: the
+* command queue when enabled, packed writes otherwise, and single
+* XSdPs_WritePolled() calls as a last resort.
+*
+* With the command queue, up to CmdqDepth tasks are queued at once and run in
+* the order the card marks them ready. With packed writes, consecutive
+* extents are grouped as long as they fit one packed command.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	List is the array of extents to write.
+* @param	Num is the number of extents.
+* @param	HdrBuff is a 512 byte, cache line aligned scratch buffer for the
+*		packed command header. It is not used with the command queue.
+*
+* @return
+*		- XST_SUCCESS if all extents were written.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_MmcWriteList(XSdPs *InstancePtr, const XSdPs_Extent *List, u32 Num,
+			u8 *HdrBuff)
+{
+	s32 Status = XST_SUCCESS;
+	u32 Done = 0U;
+	u32 Count;
+	u32 Index;
+	u32 Blks;
+	u32 Desc;
+	u32 Pending;
+	u32 ReadyMask;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(List != NULL);
+
+	while ((Done < Num) && (Status == XST_SUCCESS)) {
+		Count = Num - Done;
+
+		if (InstancePtr->CmdqDepth != 0U) {
+			if (Count > InstancePtr->CmdqDepth) {
+				Count = InstancePtr->CmdqDepth;
+			}
+			for (Index = 0U; Index < Count; Index++) {
+				Status = XSdPs_MmcCmdqQueue(InstancePtr, Index,
+					List[Done + Index].Arg,
+					List[Done + Index].BlkCnt, 1U);
+				if (Status != XST_SUCCESS) {
+					goto RETURN_PATH;
+				}
+			}
+			Pending = (Count == 32U) ? 0xFFFFFFFFU :
+					(((u32)1U << Count) - 1U);
+			while (Pending != 0U) {
+				Status = XSdPs_MmcCmdqGetReady(InstancePtr,
+							&ReadyMask);
+				if (Status != XST_SUCCESS) {
+					goto RETURN_PATH;
+				}
+				ReadyMask &= Pending;
+				for (Index = 0U; ReadyMask != 0U; Index++) {
+					if ((ReadyMask & ((u32)1U << Index)) == 0U) {
+						continue;
+					}
+					ReadyMask &= ~((u32)1U << Index);
+					Pending &= ~((u32)1U << Index);
+					Status = XSdPs_MmcCmdqExecute(InstancePtr,
+						Index, List[Done + Index].BlkCnt,
+						(u8 *)List[Done + Index].Buff, 1U);
+					if (Status != XST_SUCCESS) {
+						goto RETURN_PATH;
+					}
+				}
+			}
+		} else if ((InstancePtr->MaxPackedWr > 1U) && (Count > 1U) &&
+				(HdrBuff != NULL)) {
+			Blks = 1U;
+			Desc = 1U;
+			for (Index = 0U; (Index < Count) &&
+					(Index < InstancePtr->MaxPackedWr); Index++) {
+				Blks += List[Done + Index].BlkCnt;
+				Desc += XSdPs_MmcDescCount(List[Done + Index].BlkCnt);
+				if ((Blks > 0xFFFFU) || (Desc > 32U)) {
+					break;
+				}
+			}
+			Count = (Index == 0U) ? 1U : Index;
+			if (Count == 1U) {
+				Status = XSdPs_WritePolled(InstancePtr,
+						List[Done].Arg, List[Done].BlkCnt,
+						List[Done].Buff);
+			} else {
+				Status = XSdPs_MmcPackedWrite(InstancePtr,
+						&List[Done], Count, HdrBuff);
+			}
+		} else {
+			Count = 1U;
+			Status = XSdPs_WritePolled(InstancePtr, List[Done].Arg,
+					List[Done].BlkCnt, List[Done].Buff);
+		}
+
+		Done += Count;
+	}
+
+RETURN_PATH:
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Waits for the data phase of a transfer to complete.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the controller reported an error.
+*
+******************************************************************************/
+static s32 XSdPs_MmcWaitXfer(XSdPs *InstancePtr)
+{
+	u32 StatusReg;
+
+	do {
+		StatusReg = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_NORM_INTR_STS_OFFSET);
+		if ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U) {
+			/* Write to clear error bits */
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_ERR_INTR_STS_OFFSET,
+					XSDPS_ERROR_INTR_ALL_MASK);
+			return XST_FAILURE;
+		}
+	} while ((StatusReg & XSDPS_INTR_TC_MASK) == 0U);
+
+	/* Write to clear bit */
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_STS_OFFSET, XSDPS_INTR_TC_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Returns the number of ADMA2 descriptors needed for BlkCnt blocks.
+*
+* @param	BlkCnt is the number of 512 byte blocks.
+*
+* @return	The descriptor count.
+*
+******************************************************************************/
+static u32 XSdPs_MmcDescCount(u32 BlkCnt)
+{
+	u32 Len = BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+
+	return (Len + XSDPS_DESC_MAX_LENGTH - 1U) / XSDPS_DESC_MAX_LENGTH;
+}
+/** @} */
@@ -60,6 +60,8 @@
 * 3.3   mn     08/22/17 Updated for Word Access System support
 *       mn     09/06/17 Added support for ARMCC toolchain
 * 3.4   mn     01/22/18 Separated out SDR104 and HS200 clock defines
+*       ag     10/14/26 Added eMMC command queue and packed command defines
+*       ag     10/14/26 Added defines for the tap delay sweep
 *
 * </pre>
 *
@@ -663,6 +665,7 @@ extern "C" {
 #define CMD10	 0x0A00U
 #define CMD11	 0x0B00U
 #define CMD12	 0x0C00U
+#define CMD13	 0x0D00U
 #define ACMD13	 (XSDPS_APP_CMD_PREFIX + 0x0D00U)
 #define CMD16	 0x1000U
 #define CMD17	 0x1100U
@@ -674,6 +677,10 @@ extern "C" {
 #define CMD24	 0x1800U
 #define CMD25	 0x1900U
 #define CMD41	 0x2900U
+#define CMD44	 0x2C00U
+#define CMD45	 0x2D00U
+#define CMD46	 0x2E00U
+#define CMD47	 0x2F00U
 #define ACMD41	 (XSDPS_APP_CMD_PREFIX + 0x2900U)
 #define ACMD42	 (XSDPS_APP_CMD_PREFIX + 0x2A00U)
 #define ACMD51	 (XSDPS_APP_CMD_PREFIX + 0x3300U)
@@ -859,6 +866,14 @@ extern "C" {
 #define EXT_CSD_HS_TIMING_HIGH		1U	/* Card is in high speed mode */
 #define EXT_CSD_HS_TIMING_HS200		2U	/* Card is in HS200 mode */
 
+#define EXT_CSD_CMDQ_MODE_EN_BYTE	15U
+#define EXT_CSD_CMDQ_DEPTH_BYTE		307U
+#define EXT_CSD_CMDQ_SUPPORT_BYTE	308U
+#define EXT_CSD_CMDQ_SUPPORT		(1U<<0)	/* Command queue supported */
+#define EXT_CSD_CMDQ_DEPTH_MASK		0x1FU
+#define EXT_CSD_MAX_PACKED_WRITES_BYTE	500U
+#define EXT_CSD_MAX_PACKED_READS_BYTE	501U
+
 #define EXT_CSD_RST_N_FUN_BYTE		162U
 #define EXT_CSD_RST_N_FUN_TEMP_DIS	0U	/* RST_n signal is temporarily disabled */
 #define EXT_CSD_RST_N_FUN_PERM_EN	1U	/* RST_n signal is permanently enabled */
@@ -873,6 +888,23 @@ extern "C" {
 					| ((u32)EXT_CSD_HS_TIMING_BYTE << 16) \
 					| ((u32)EXT_CSD_HS_TIMING_DEF << 8))
 
+#define XSDPS_MMC_CMDQ_EN_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+					 | ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16) \
+					 | ((u32)1U << 8))
+
+#define XSDPS_MMC_CMDQ_DIS_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+					 | ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16))
+
+/* Command queue task and status arguments */
+#define XSDPS_CMDQ_TASK_READ		(1U<<30) /* CMD44 data direction */
+#define XSDPS_CMDQ_TASK_ID_SHIFT	16U
+#define XSDPS_CMDQ_SQS			(1U<<15) /* CMD13 queue status */
+
+/* Packed command header and CMD23 argument */
+#define XSDPS_PACKED_CMD_ARG		(1U<<30) /* CMD23 packed flag */
+#define XSDPS_PACKED_HDR_VERSION	0x01U
+#define XSDPS_PACKED_HDR_WRITE		0x02U
+
 #define XSDPS_MMC_HIGH_SPEED_ARG	(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
 					 | ((u32)EXT_CSD_HS_TIMING_BYTE << 16) \
 					 | ((u32)EXT_CSD_HS_TIMING_HIGH << 8))
@@ -947,6 +979,10 @@ extern "C" {
 #define XSDPS_SD_VER_2_0		0x2U		/**< SD ver 2 */
 #define XSDPS_SCR_BLKCNT	1U
 #define XSDPS_SCR_BLKSIZE	8U
+#define XSDPS_SD_STATUS_BLKCNT	1U
+#define XSDPS_SD_STATUS_BLKSIZE	64U
+#define XSDPS_SD_STATUS_AU_BYTE	10U	/* AU_SIZE in bits 7:4 */
+#define XSDPS_ACMD23_BLKCNT_MASK	0x007FFFFFU
 #define XSDPS_1_BIT_WIDTH	0x1U
 #define XSDPS_4_BIT_WIDTH	0x2U
 #define XSDPS_8_BIT_WIDTH	0x3U
@@ -1034,6 +1070,8 @@ extern "C" {
 #define SD0_OTAPDLY_SEL_MASK		0x0000003FU
 #define SD1_ITAPDLY_SEL_MASK		0x00FF0000U
 #define SD1_OTAPDLY_SEL_MASK		0x003F0000U
+#define XSDPS_ITAP_HS200_TAPS		30U	/* Input taps per 200 MHz clock */
+#define XSDPS_TUNING_PROBE_TIMEOUT	100000U
 #define SD_DLL_CTRL 				0x00000358U
 #define SD_ITAPDLY					0x00000314U
 #define SD_OTAPDLY					0x00000318U
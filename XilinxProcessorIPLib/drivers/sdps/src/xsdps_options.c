@@ -75,6 +75,11 @@
 *                       operations when it is enabled.
 *       mn     08/22/17 Updated for Word Access System support
 * 3.4   mn     01/22/18 Separated out SDR104 and HS200 clock defines
+*       ag     10/14/26 Added the tuning cache. HS200/SDR104/SDR50 tuning
+*                       sweeps the input tap delay when a cache is set and
+*                       re-applies a cached tap on later initializations.
+*       ag     10/14/26 Added XSdPs_SetWriteMode, XSdPs_SetWrBlkEraseCount
+*                       and XSdPs_Get_AuSize.
 *
 * </pre>
 *
@@ -100,6 +105,12 @@
 s32 XSdPs_CmdTransfer(XSdPs *InstancePtr, u32 Cmd, u32 Arg, u32 BlkCnt);
 void XSdPs_SetupADMA2DescTbl(XSdPs *InstancePtr, u32 BlkCnt, const u8 *Buff);
 static s32 XSdPs_Execute_Tuning(XSdPs *InstancePtr);
+static s32 XSdPs_Tune(XSdPs *InstancePtr);
+#if defined (ARMR5) || defined (__aarch64__) || defined (ARMA53_32)
+static s32 XSdPs_Sweep_Tuning(XSdPs *InstancePtr, u8 *TapPtr);
+static s32 XSdPs_TuningProbe(XSdPs *InstancePtr);
+static void XSdPs_SetITap(XSdPs *InstancePtr, u8 Tap);
+#endif
 #if defined (ARMR5) || defined (__aarch64__) || defined (ARMA53_32)
 s32 XSdPs_Uhs_ModeInit(XSdPs *InstancePtr, u8 Mode);
 static void XSdPs_sdr50_tapdelay(u32 Bank, u32 DeviceId, u32 CardType);
@@ -641,7 +652,7 @@ s32 XSdPs_Change_BusSpeed(XSdPs *InstancePtr)
 		}
 
 		if (InstancePtr->Mode == XSDPS_HS200_MODE) {
-			Status = XSdPs_Execute_Tuning(InstancePtr);
+			Status = XSdPs_Tune(InstancePtr);
 			if (Status != XST_SUCCESS) {
 				Status = XST_FAILURE;
 				goto RETURN_PATH;
@@ -975,6 +986,191 @@ s32 XSdPs_Set_Mmc_ExtCsd(XSdPs *InstancePtr, u32 Arg)
 
 }
 
+/*****************************************************************************/
+/**
+*
+* API to select how XSdPs_WritePolled() issues multi block writes.
+*
+* With XSDPS_WRITE_PRE_ERASE, SD cards are told with ACMD23 how many blocks
+* the following write covers, so they can erase them up front. With
+* XSDPS_WRITE_CMD23, the block count is set with CMD23 and the write ends
+* without CMD12; SD cards that do not report CMD23 support in their SCR keep
+* using auto CMD12.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	Mode is an OR of XSDPS_WRITE_PRE_ERASE and XSDPS_WRITE_CMD23,
+*		or 0 for open ended writes.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if Mode has unknown bits set.
+*
+* @note		The mode is reset by XSdPs_CfgInitialize().
+*
+******************************************************************************/
+s32 XSdPs_SetWriteMode(XSdPs *InstancePtr, u8 Mode)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((Mode & ~(XSDPS_WRITE_PRE_ERASE | XSDPS_WRITE_CMD23)) != 0U) {
+		return XST_INVALID_PARAM;
+	}
+
+	InstancePtr->WriteMode = Mode;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* API to send SET_WR_BLK_ERASE_COUNT (ACMD23) to an SD card, announcing the
+* number of blocks the next multi block write will cover.
+*
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	BlkCnt is the number of blocks, up to 0x7FFFFF.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if fail.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSdPs_SetWrBlkEraseCount(XSdPs *InstancePtr, u32 BlkCnt)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Status = XSdPs_CmdTransfer(InstancePtr, CMD55,
+			InstancePtr->RelCardAddr, 0U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CmdTransfer(InstancePtr, ACMD23,
+			BlkCnt & XSDPS_ACMD23_BLKCNT_MASK, 0U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+	RETURN_PATH:
+		return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* API to read the allocation unit size of an SD card from its SD status
+* (ACMD13). Writes that start on an allocation unit boundary and cover whole
+* units are the fastest the card can do.
+*
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	AuBlkCnt returns the allocation unit size in 512 byte blocks,
+*		or 0 if the card does not define it.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if fail, or for MMC/eMMC cards.
+*
+* @note		The block size is left at 64 bytes, the read and write API's
+*		restore it.
+*
+******************************************************************************/
+s32 XSdPs_Get_AuSize(XSdPs *InstancePtr, u32 *AuBlkCnt)
+{
+	/* AU_SIZE codes 0x1 to 0xF in units of 512 byte blocks */
+	static const u32 AuBlocks[16] = {
+		0U, 32U, 64U, 128U, 256U, 512U, 1024U, 2048U, 4096U, 8192U,
+		16384U, 24576U, 32768U, 49152U, 65536U, 131072U
+	};
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	u8 SdStatus[XSDPS_SD_STATUS_BLKSIZE];
+#pragma data_alignment = 4
+#else
+	u8 SdStatus[XSDPS_SD_STATUS_BLKSIZE] __attribute__ ((aligned(32)));
+#endif
+	s32 Status;
+	u32 StatusReg;
+	u16 BlkSize;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(AuBlkCnt != NULL);
+
+	*AuBlkCnt = 0U;
+	if (InstancePtr->CardType != XSDPS_CARD_SD) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CmdTransfer(InstancePtr, CMD55,
+			InstancePtr->RelCardAddr, 0U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	BlkSize = XSDPS_SD_STATUS_BLKSIZE & XSDPS_BLK_SIZE_MASK;
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_BLK_SIZE_OFFSET, BlkSize);
+
+	XSdPs_SetupADMA2DescTbl(InstancePtr, XSDPS_SD_STATUS_BLKCNT, SdStatus);
+
+	TransferMode = XSDPS_TM_DAT_DIR_SEL_MASK | XSDPS_TM_DMA_EN_MASK;
+
+	if (InstancePtr->Config.IsCacheCoherent == 0) {
+		Xil_DCacheInvalidateRange((INTPTR)SdStatus,
+				XSDPS_SD_STATUS_BLKSIZE);
+	}
+
+	Status = XSdPs_CmdTransfer(InstancePtr, ACMD13,
+			InstancePtr->RelCardAddr, XSDPS_SD_STATUS_BLKCNT);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/*
+	 * Check for transfer complete
+	 * Polling for response for now
+	 */
+	do {
+		StatusReg = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_NORM_INTR_STS_OFFSET);
+		if ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U) {
+			/* Write to clear error bits */
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_ERR_INTR_STS_OFFSET,
+					XSDPS_ERROR_INTR_ALL_MASK);
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	} while ((StatusReg & XSDPS_INTR_TC_MASK) == 0U);
+
+	/* Write to clear bit */
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_STS_OFFSET, XSDPS_INTR_TC_MASK);
+
+	if (InstancePtr->Config.IsCacheCoherent == 0) {
+		Xil_DCacheInvalidateRange((INTPTR)SdStatus,
+				XSDPS_SD_STATUS_BLKSIZE);
+	}
+
+	*AuBlkCnt = AuBlocks[SdStatus[XSDPS_SD_STATUS_AU_BYTE] >> 4];
+	Status = XST_SUCCESS;
+
+	RETURN_PATH:
+		return Status;
+}
+
 #if defined (ARMR5) || defined (__aarch64__) || defined (ARMA53_32)
 /*****************************************************************************/
 /**
@@ -1141,7 +1337,7 @@ s32 XSdPs_Uhs_ModeInit(XSdPs *InstancePtr, u8 Mode)
 	if((Mode == XSDPS_UHS_SPEED_MODE_SDR104) ||
 			(Mode == XSDPS_UHS_SPEED_MODE_SDR50)) {
 		/* Send tuning pattern */
-		Status = XSdPs_Execute_Tuning(InstancePtr);
+		Status = XSdPs_Tune(InstancePtr);
 		if (Status != XST_SUCCESS) {
 				Status = XST_FAILURE;
 				goto RETURN_PATH;
@@ -1155,6 +1351,89 @@ s32 XSdPs_Uhs_ModeInit(XSdPs *InstancePtr, u8 Mode)
 }
 #endif
 
+/*****************************************************************************/
+/**
+*
+* API to set the tuning cache used by later card initializations.
+*
+* When a cache is set, tuning is done by sweeping the input tap delay and the
+* tap in the middle of the widest passing window is stored in the cache
+* together with the card CID and bus clock. If the cache already holds a tap
+* for the same card and clock, that tap is programmed and checked with one
+* tuning block, and the sweep is skipped when it passes. The application can
+* keep the cache in memory that survives a warm reset, or save it to flash.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	CachePtr is the tuning cache, or NULL to use the controller
+*		auto tuning without a cache.
+*
+* @return	None
+*
+* @note		The cache is only used on Zynq UltraScale+ MPSoC, where the
+*		input tap delay is programmable. Call this before
+*		XSdPs_CardInitialize().
+*
+******************************************************************************/
+void XSdPs_SetTuningCache(XSdPs *InstancePtr, XSdPs_TuningCache *CachePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->TuningCache = CachePtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* Tunes the sampling point for the current bus mode, using the tuning cache
+* if one is set.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if no working sampling point was found.
+*
+******************************************************************************/
+static s32 XSdPs_Tune(XSdPs *InstancePtr)
+{
+#if defined (ARMR5) || defined (__aarch64__) || defined (ARMA53_32)
+	XSdPs_TuningCache *CachePtr = InstancePtr->TuningCache;
+	s32 Status;
+	u8 Tap;
+
+	if (CachePtr != NULL) {
+		if ((CachePtr->Valid != 0U) &&
+				(CachePtr->BusSpeed == InstancePtr->BusSpeed) &&
+				(memcmp(CachePtr->CardID, InstancePtr->CardID,
+					sizeof(CachePtr->CardID)) == 0)) {
+			XSdPs_SetITap(InstancePtr, CachePtr->ITap);
+			if (XSdPs_TuningProbe(InstancePtr) == XST_SUCCESS) {
+				Status = XST_SUCCESS;
+				goto RETURN_PATH;
+			}
+		}
+
+		CachePtr->Valid = 0U;
+		Status = XSdPs_Sweep_Tuning(InstancePtr, &Tap);
+		if (Status == XST_SUCCESS) {
+			(void)memcpy(CachePtr->CardID, InstancePtr->CardID,
+					sizeof(CachePtr->CardID));
+			CachePtr->BusSpeed = InstancePtr->BusSpeed;
+			CachePtr->ITap = Tap;
+			CachePtr->Valid = 1U;
+		}
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_Execute_Tuning(InstancePtr);
+
+RETURN_PATH:
+	return Status;
+#else
+	return XSdPs_Execute_Tuning(InstancePtr);
+#endif
+}
+
 static s32 XSdPs_Execute_Tuning(XSdPs *InstancePtr)
 {
 	s32 Status;
@@ -1666,6 +1945,189 @@ void XSdPs_SetTapDelay(XSdPs *InstancePtr)
 #endif
 }
 
+/*****************************************************************************/
+/**
+*
+* API to find the input tap delay by sweeping all taps of one clock period.
+* Each tap is checked with one tuning block and the tap in the middle of the
+* longest run of passing taps is programmed.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	TapPtr receives the selected tap.
+*
+* @return
+*		- XST_SUCCESS if a passing tap was found.
+*		- XST_FAILURE if no tap passed.
+*
+******************************************************************************/
+static s32 XSdPs_Sweep_Tuning(XSdPs *InstancePtr, u8 *TapPtr)
+{
+	u32 TapMax;
+	u32 Tap;
+	u32 RunStart = 0U;
+	u32 RunLen = 0U;
+	u32 BestStart = 0U;
+	u32 BestLen = 0U;
+
+	/* XSDPS_ITAP_HS200_TAPS taps span one 200 MHz clock period */
+	TapMax = (XSDPS_ITAP_HS200_TAPS * 200U) /
+			(InstancePtr->BusSpeed / 1000000U);
+	if (TapMax > (SD0_ITAPDLY_SEL_MASK + 1U)) {
+		TapMax = SD0_ITAPDLY_SEL_MASK + 1U;
+	}
+
+	for (Tap = 0U; Tap < TapMax; Tap++) {
+		XSdPs_SetITap(InstancePtr, (u8)Tap);
+		if (XSdPs_TuningProbe(InstancePtr) == XST_SUCCESS) {
+			if (RunLen == 0U) {
+				RunStart = Tap;
+			}
+			RunLen++;
+			if (RunLen > BestLen) {
+				BestStart = RunStart;
+				BestLen = RunLen;
+			}
+		} else {
+			RunLen = 0U;
+		}
+	}
+
+	if (BestLen == 0U) {
+		return XST_FAILURE;
+	}
+
+	*TapPtr = (u8)(BestStart + (BestLen / 2U));
+	XSdPs_SetITap(InstancePtr, *TapPtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* API to read one tuning block (CMD19 or CMD21) in PIO mode and report
+* whether it was received without error.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+*
+* @return
+*		- XST_SUCCESS if the block was received without error.
+*		- XST_FAILURE otherwise.
+*
+******************************************************************************/
+static s32 XSdPs_TuningProbe(XSdPs *InstancePtr)
+{
+	s32 Status;
+	u32 StatusReg;
+	u32 Count;
+	u16 BlkSize;
+
+	BlkSize = XSDPS_TUNING_CMD_BLKSIZE;
+	if (InstancePtr->BusWidth == XSDPS_8_BIT_WIDTH) {
+		BlkSize = BlkSize * 2U;
+	}
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress, XSDPS_BLK_SIZE_OFFSET,
+			BlkSize & XSDPS_BLK_SIZE_MASK);
+
+	TransferMode = XSDPS_TM_DAT_DIR_SEL_MASK;
+
+	if (InstancePtr->CardType == XSDPS_CARD_SD) {
+		Status = XSdPs_CmdTransfer(InstancePtr, CMD19, 0U, 1U);
+	} else {
+		Status = XSdPs_CmdTransfer(InstancePtr, CMD21, 0U, 1U);
+	}
+
+	if (Status == XST_SUCCESS) {
+		for (Count = 0U; Count < ((u32)BlkSize / 4U); Count++) {
+			(void)XSdPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XSDPS_BUF_DAT_PORT_OFFSET);
+		}
+
+		Status = XST_FAILURE;
+		for (Count = 0U; Count < XSDPS_TUNING_PROBE_TIMEOUT; Count++) {
+			StatusReg = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_NORM_INTR_STS_OFFSET);
+			if ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U) {
+				break;
+			}
+			if ((StatusReg & XSDPS_INTR_TC_MASK) != 0U) {
+				Status = XST_SUCCESS;
+				break;
+			}
+		}
+	}
+
+	if (Status != XST_SUCCESS) {
+		/* Clear errors and the data line for the next tap */
+		XSdPs_WriteReg8(InstancePtr->Config.BaseAddress,
+				XSDPS_SW_RST_OFFSET, XSDPS_SWRST_CMD_LINE_MASK |
+				XSDPS_SWRST_DAT_LINE_MASK);
+		while ((XSdPs_ReadReg8(InstancePtr->Config.BaseAddress,
+				XSDPS_SW_RST_OFFSET) & (XSDPS_SWRST_CMD_LINE_MASK |
+				XSDPS_SWRST_DAT_LINE_MASK)) != 0U) {
+			;
+		}
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_ERR_INTR_STS_OFFSET, XSDPS_ERROR_INTR_ALL_MASK);
+	}
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_STS_OFFSET, XSDPS_NORM_INTR_ALL_MASK);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* API to program the input tap delay of the controller.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	Tap is the input tap delay.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_SetITap(XSdPs *InstancePtr, u8 Tap)
+{
+	u32 TapDelay;
+	u32 ChgWin;
+	u32 Enable;
+	u32 SelMask;
+	u32 Shift;
+
+	if (InstancePtr->Config.DeviceId == 0U) {
+		ChgWin = SD0_ITAPCHGWIN;
+		Enable = SD0_ITAPDLYENA;
+		SelMask = SD0_ITAPDLY_SEL_MASK;
+		Shift = 0U;
+	} else {
+		ChgWin = SD1_ITAPCHGWIN;
+		Enable = SD1_ITAPDLYENA;
+		SelMask = SD1_ITAPDLY_SEL_MASK;
+		Shift = 16U;
+	}
+
+#if EL1_NONSECURE && defined (__aarch64__)
+	(void)TapDelay;
+	Xil_Smc(MMIO_WRITE_SMC_FID, (u64)(XPS_SYS_CTRL_BASEADDR + SD_ITAPDLY) |
+			((u64)ChgWin << 32), (u64)ChgWin, 0, 0, 0, 0, 0);
+	Xil_Smc(MMIO_WRITE_SMC_FID, (u64)(XPS_SYS_CTRL_BASEADDR + SD_ITAPDLY) |
+			((u64)(Enable | SelMask) << 32),
+			(u64)(Enable | ((u32)Tap << Shift)), 0, 0, 0, 0, 0);
+	Xil_Smc(MMIO_WRITE_SMC_FID, (u64)(XPS_SYS_CTRL_BASEADDR + SD_ITAPDLY) |
+			((u64)ChgWin << 32), (u64)0x0, 0, 0, 0, 0, 0);
+#else
+	TapDelay = XSdPs_ReadReg(XPS_SYS_CTRL_BASEADDR, SD_ITAPDLY);
+	TapDelay |= ChgWin;
+	XSdPs_WriteReg(XPS_SYS_CTRL_BASEADDR, SD_ITAPDLY, TapDelay);
+	TapDelay &= ~SelMask;
+	TapDelay |= Enable | ((u32)Tap << Shift);
+	XSdPs_WriteReg(XPS_SYS_CTRL_BASEADDR, SD_ITAPDLY, TapDelay);
+	TapDelay &= ~ChgWin;
+	XSdPs_WriteReg(XPS_SYS_CTRL_BASEADDR, SD_ITAPDLY, TapDelay);
+#endif
+}
+
 /*****************************************************************************/
 /**
 *
@@ -100,6 +100,8 @@
 * 4.4	tjs  11/28/17 When receive fifo exists, we need to check for status
 *                     register rx fifo empty flag. If clear we can proceed for
 *                     read. Otherwise we will hit execption. CR# 989938
+*       ag   10/14/26 Added the FIFO burst mode for large interrupt driven
+*                     transfers, see XSpi_SetLargeXferThreshold().
 * </pre>
 *
 ******************************************************************************/
@@ -125,6 +127,10 @@ static void StubStatusHandler(void *CallBackRef, u32 StatusEvent,
 
 void XSpi_Abort(XSpi *InstancePtr);
 
+static void XSpi_BurstSend(XSpi *InstancePtr);
+static void XSpi_BurstRecv(XSpi *InstancePtr);
+static void XSpi_BurstService(XSpi *InstancePtr, u32 IntrStatus);
+
 /************************** Variable Definitions *****************************/
 
 
@@ -209,6 +215,11 @@ int XSpi_CfgInitialize(XSpi *InstancePtr, XSpi_Config *Config,
 	InstancePtr->FlashBaseAddr = Config->AxiFullBaseAddress;
 	InstancePtr->XipMode = Config->XipMode;
 
+	InstancePtr->LargeXferThreshold = 0;
+	InstancePtr->FifoDepth = 0;
+	InstancePtr->LargeXfer = FALSE;
+	InstancePtr->InFlightBytes = 0;
+
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
 	/*
@@ -628,31 +639,44 @@ int XSpi_Transfer(XSpi *InstancePtr, u8 *SendBufPtr,
 	 * the size of the FIFO or that there even is a FIFO. The downside is
 	 * that the status register must be read each loop iteration.
 	 */
-	StatusReg = XSpi_GetStatusReg(InstancePtr);
+	InstancePtr->LargeXfer = FALSE;
+	if ((GlobalIntrReg == TRUE) && (InstancePtr->LargeXferThreshold != 0) &&
+		(ByteCount >= InstancePtr->LargeXferThreshold)) {
+		/*
+		 * Large transfer in interrupt mode, fill the FIFO from the
+		 * count of words in flight rather than the full status bit.
+		 */
+		InstancePtr->LargeXfer = TRUE;
+		InstancePtr->InFlightBytes = 0;
+		XSpi_BurstSend(InstancePtr);
+	} else {
+		StatusReg = XSpi_GetStatusReg(InstancePtr);
 
-	while (((StatusReg & XSP_SR_TX_FULL_MASK) == 0) &&
-		(InstancePtr->RemainingBytes > 0)) {
-		if (DataWidth == XSP_DATAWIDTH_BYTE) {
-			/*
-			 * Data Transfer Width is Byte (8 bit).
-			 */
-			Data = *InstancePtr->SendBufferPtr;
-		} else if (DataWidth == XSP_DATAWIDTH_HALF_WORD) {
-			/*
-			 * Data Transfer Width is Half Word (16 bit).
-			 */
-			Data = *(u16 *)InstancePtr->SendBufferPtr;
-		} else if (DataWidth == XSP_DATAWIDTH_WORD){
-			/*
-			 * Data Transfer Width is Word (32 bit).
-			 */
-			Data = *(u32 *)InstancePtr->SendBufferPtr;
-		}
+		while (((StatusReg & XSP_SR_TX_FULL_MASK) == 0) &&
+			(InstancePtr->RemainingBytes > 0)) {
+			if (DataWidth == XSP_DATAWIDTH_BYTE) {
+				/*
+				 * Data Transfer Width is Byte (8 bit).
+				 */
+				Data = *InstancePtr->SendBufferPtr;
+			} else if (DataWidth == XSP_DATAWIDTH_HALF_WORD) {
+				/*
+				 * Data Transfer Width is Half Word (16 bit).
+				 */
+				Data = *(u16 *)InstancePtr->SendBufferPtr;
+			} else if (DataWidth == XSP_DATAWIDTH_WORD){
+				/*
+				 * Data Transfer Width is Word (32 bit).
+				 */
+				Data = *(u32 *)InstancePtr->SendBufferPtr;
+			}
 
-		XSpi_WriteReg(InstancePtr->BaseAddr, XSP_DTR_OFFSET, Data);
-		InstancePtr->SendBufferPtr += (DataWidth >> 3);
-		InstancePtr->RemainingBytes -= (DataWidth >> 3);
-		StatusReg = XSpi_GetStatusReg(InstancePtr);
+			XSpi_WriteReg(InstancePtr->BaseAddr, XSP_DTR_OFFSET,
+					Data);
+			InstancePtr->SendBufferPtr += (DataWidth >> 3);
+			InstancePtr->RemainingBytes -= (DataWidth >> 3);
+			StatusReg = XSpi_GetStatusReg(InstancePtr);
+		}
 	}
 
 	
@@ -682,9 +706,16 @@ int XSpi_Transfer(XSpi *InstancePtr, u8 *SendBufPtr,
 
 		/*
 		 * Enable the transmit empty interrupt, which we use to
-		 * determine progress on the transmission.
+		 * determine progress on the transmission. The burst mode
+		 * also refills the FIFO when it is half empty so that the
+		 * transmitter does not stall.
 		 */
-		XSpi_IntrEnable(InstancePtr, XSP_INTR_TX_EMPTY_MASK);
+		if (InstancePtr->LargeXfer == TRUE) {
+			XSpi_IntrEnable(InstancePtr, XSP_INTR_TX_EMPTY_MASK |
+					XSP_INTR_TX_HALF_EMPTY_MASK);
+		} else {
+			XSpi_IntrEnable(InstancePtr, XSP_INTR_TX_EMPTY_MASK);
+		}
 
 		/*
 		 * End critical section.
@@ -1157,7 +1188,15 @@ void XSpi_InterruptHandler(void *InstancePtr)
 	}
 
 	DataWidth = SpiPtr->DataWidth;
-	if ((IntrStatus & XSP_INTR_TX_EMPTY_MASK) ||
+	if ((SpiPtr->LargeXfer == TRUE) &&
+	    (IntrStatus & (XSP_INTR_TX_EMPTY_MASK |
+			   XSP_INTR_TX_HALF_EMPTY_MASK))) {
+		/*
+		 * Large transfer, service the FIFOs in bursts.
+		 */
+		XSpi_BurstService(SpiPtr, IntrStatus);
+
+	} else if ((IntrStatus & XSP_INTR_TX_EMPTY_MASK) ||
 	    (IntrStatus & XSP_INTR_TX_HALF_EMPTY_MASK)) {
 
 		/*
@@ -1398,6 +1437,176 @@ void XSpi_Abort(XSpi *InstancePtr)
 	InstancePtr->RemainingBytes = 0;
 	InstancePtr->RequestedBytes = 0;
 	InstancePtr->IsBusy = FALSE;
+	InstancePtr->LargeXfer = FALSE;
+	InstancePtr->InFlightBytes = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes as many words of the current transfer to the Tx FIFO as fit, based
+* on the number of bytes in flight rather than the Tx full status bit. Keeping
+* the words in flight within the FIFO depth also bounds the Rx FIFO level, so
+* neither FIFO can overflow.
+*
+* @param	InstancePtr is a pointer to the XSpi instance to be worked on.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XSpi_BurstSend(XSpi *InstancePtr)
+{
+	unsigned int WordBytes = (unsigned int)InstancePtr->DataWidth >> 3;
+	unsigned int Space;
+	unsigned int Count;
+	u8 *BufPtr = InstancePtr->SendBufferPtr;
+	u32 Data;
+
+	Space = (InstancePtr->FifoDepth * WordBytes) -
+			InstancePtr->InFlightBytes;
+	Count = InstancePtr->RemainingBytes;
+	if (Count > Space) {
+		Count = Space;
+	}
+	Count -= Count % WordBytes;
+
+	InstancePtr->SendBufferPtr += Count;
+	InstancePtr->RemainingBytes -= Count;
+	InstancePtr->InFlightBytes += Count;
+
+	while (Count > 0) {
+		if (WordBytes == 1) {
+			Data = *BufPtr;
+		} else if (WordBytes == 2) {
+			Data = *(u16 *)BufPtr;
+		} else {
+			Data = *(u32 *)BufPtr;
+		}
+
+		XSpi_WriteReg(InstancePtr->BaseAddr, XSP_DTR_OFFSET, Data);
+		BufPtr += WordBytes;
+		Count -= WordBytes;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads all the words present in the Rx FIFO. The status register and the Rx
+* FIFO occupancy register are read once, then the data register is read the
+* indicated number of times.
+*
+* @param	InstancePtr is a pointer to the XSpi instance to be worked on.
+*
+* @return	None.
+*
+* @note		The occupancy register holds the number of words in the FIFO
+*		minus one, so the empty status bit is checked first.
+*
+******************************************************************************/
+static void XSpi_BurstRecv(XSpi *InstancePtr)
+{
+	unsigned int WordBytes = (unsigned int)InstancePtr->DataWidth >> 3;
+	unsigned int Words;
+	unsigned int Bytes;
+	u8 *BufPtr = InstancePtr->RecvBufferPtr;
+	u32 Data;
+
+	if (XSpi_GetStatusReg(InstancePtr) & XSP_SR_RX_EMPTY_MASK) {
+		return;
+	}
+
+	Words = XSpi_ReadReg(InstancePtr->BaseAddr, XSP_RFO_OFFSET) + 1;
+	Bytes = Words * WordBytes;
+	if (Bytes > InstancePtr->InFlightBytes) {
+		Bytes = InstancePtr->InFlightBytes;
+		Words = Bytes / WordBytes;
+	}
+
+	InstancePtr->InFlightBytes -= Bytes;
+	InstancePtr->Stats.BytesTransferred += Bytes;
+
+	if (BufPtr == NULL) {
+		while (Words-- > 0) {
+			(void)XSpi_ReadReg(InstancePtr->BaseAddr,
+						XSP_DRR_OFFSET);
+		}
+		return;
+	}
+
+	InstancePtr->RecvBufferPtr += Bytes;
+
+	while (Words-- > 0) {
+		Data = XSpi_ReadReg(InstancePtr->BaseAddr, XSP_DRR_OFFSET);
+		if (WordBytes == 1) {
+			*BufPtr = (u8)Data;
+		} else if (WordBytes == 2) {
+			*(u16 *)BufPtr = (u16)Data;
+		} else {
+			*(u32 *)BufPtr = Data;
+		}
+		BufPtr += WordBytes;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Services a Tx FIFO empty or half empty interrupt for a transfer in the FIFO
+* burst mode. The received words are drained and the Tx FIFO is refilled
+* without inhibiting the transmitter. The transfer is complete once all the
+* data has been sent and the Tx FIFO empty interrupt has been seen, at which
+* point all the received data is in the Rx FIFO.
+*
+* @param	InstancePtr is a pointer to the XSpi instance to be worked on.
+* @param	IntrStatus is the interrupt status read by the interrupt
+*		handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XSpi_BurstService(XSpi *InstancePtr, u32 IntrStatus)
+{
+	u32 ControlReg;
+
+	XSpi_BurstRecv(InstancePtr);
+
+	if (InstancePtr->RemainingBytes > 0) {
+		XSpi_BurstSend(InstancePtr);
+		return;
+	}
+
+	if ((InstancePtr->InFlightBytes != 0) &&
+		((IntrStatus & XSP_INTR_TX_EMPTY_MASK) == 0)) {
+		/*
+		 * Wait for the last words to be shifted out.
+		 */
+		return;
+	}
+
+	/*
+	 * Inhibit the transmitter as the non burst path does, so the next
+	 * transfer can fill the FIFO before starting.
+	 */
+	ControlReg = XSpi_GetControlReg(InstancePtr);
+	XSpi_SetControlReg(InstancePtr, ControlReg |
+				XSP_CR_TRANS_INHIBIT_MASK);
+
+	XSpi_SetSlaveSelectReg(InstancePtr, InstancePtr->SlaveSelectMask);
+	XSpi_IntrDisable(InstancePtr, XSP_INTR_TX_EMPTY_MASK |
+				XSP_INTR_TX_HALF_EMPTY_MASK);
+
+	InstancePtr->LargeXfer = FALSE;
+	InstancePtr->InFlightBytes = 0;
+	InstancePtr->IsBusy = FALSE;
+
+	InstancePtr->StatusHandler(InstancePtr->StatusRef,
+				XST_SPI_TRANSFER_DONE,
+				InstancePtr->RequestedBytes);
 }
 
 /** @} */
@@ -165,6 +165,18 @@
 * started a transfer. The driver reports this condition to the upper layer
 * software through the status handler.
 *
+* <b>Large Transfers</b>
+*
+* When the device has FIFOs, XSpi_SetLargeXferThreshold() selects a burst
+* mode for interrupt driven transfers of at least the given number of bytes.
+* In this mode the driver reads the Rx FIFO occupancy register once per
+* interrupt and copies that many words without polling the status register,
+* refills the Tx FIFO up to its depth from a count of words in flight, and
+* keeps the transmitter running between refills using the Tx FIFO Half Empty
+* interrupt. Long continuous streams then cost about two interrupts per FIFO
+* of data rather than a status register read per word. The core has no DMA
+* request interface in legacy mode, so the data is still moved by the CPU.
+*
 * <b>Polled Operation</b>
 *
 * This driver operates in polled mode operation too. To put the driver in polled
@@ -299,6 +311,8 @@
 * 4.4	tjs  11/28/17 When receive fifo exists, we need to check for status
 *                     register rx fifo empty flag. If clear we can proceed for
 *                     read. Otherwise we will hit execption. CR# 989938
+*       ag   10/14/26 Added XSpi_SetLargeXferThreshold() and the FIFO burst
+*                     mode for large interrupt driven transfers.
 * </pre>
 *
 ******************************************************************************/
@@ -443,6 +457,13 @@ typedef struct {
 	void *StatusRef;	/**< Callback reference for status handler */
 	u32 FlashBaseAddr;    	/**< Used in XIP Mode */
 	u8 XipMode;             /**< 0 if Non-XIP, 1 if XIP Mode */
+
+	unsigned int LargeXferThreshold; /**< Min bytes for burst mode,
+					   *  0 if disabled */
+	unsigned int FifoDepth;	/**< FIFO depth in words for burst mode */
+	int LargeXfer;		/**< Transfer uses burst mode (state) */
+	unsigned int InFlightBytes; /**< Bytes written to the Tx FIFO and not
+				      *  yet read back (state) */
 } XSpi;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -847,6 +868,8 @@ void XSpi_ClearStats(XSpi *InstancePtr);
  */
 int XSpi_SetOptions(XSpi *InstancePtr, u32 Options);
 u32 XSpi_GetOptions(XSpi *InstancePtr);
+int XSpi_SetLargeXferThreshold(XSpi *InstancePtr, unsigned int Threshold,
+				unsigned int FifoDepth);
 
 #ifdef __cplusplus
 }
@@ -48,6 +48,7 @@
 * 1.11a wgr  03/22/07 Converted to new coding style.
 * 3.00a ktn  10/28/09 Updated all the register accesses as 32 bit access.
 *		      Updated driver to use the HAL APIs/macros.
+* 4.4   ag   10/14/26 Added XSpi_SetLargeXferThreshold().
 *
 * </pre>
 *
@@ -222,4 +223,54 @@ u32 XSpi_GetOptions(XSpi *InstancePtr)
 
 	return OptionsFlag;
 }
+
+/*****************************************************************************/
+/**
+*
+* This function enables the FIFO burst mode for large interrupt driven
+* transfers. Transfers of at least Threshold bytes started with
+* XSpi_Transfer() while the global interrupt is enabled are serviced from the
+* FIFO occupancy instead of polling the status register for every word, and
+* the Tx FIFO is refilled on the half empty interrupt so that the transmitter
+* is kept busy. Smaller transfers and polled transfers are not affected.
+*
+* @param	InstancePtr is a pointer to the XSpi instance to be worked on.
+* @param	Threshold is the minimum transfer size in bytes which uses the
+*		burst mode. A value of 0 disables the burst mode.
+* @param	FifoDepth is the depth of the Tx and Rx FIFOs in words, as
+*		configured in the hardware (C_FIFO_DEPTH).
+*
+* @return
+*		- XST_SUCCESS if the threshold was set.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_NO_FEATURE if the device is built without FIFOs.
+*		- XST_INVALID_PARAM if FifoDepth is 0 for a non zero Threshold.
+*
+* @note		None.
+*
+******************************************************************************/
+int XSpi_SetLargeXferThreshold(XSpi *InstancePtr, unsigned int Threshold,
+				unsigned int FifoDepth)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->IsBusy) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (Threshold != 0) {
+		if (!InstancePtr->HasFifos) {
+			return XST_NO_FEATURE;
+		}
+		if (FifoDepth == 0) {
+			return XST_INVALID_PARAM;
+		}
+	}
+
+	InstancePtr->LargeXferThreshold = Threshold;
+	InstancePtr->FifoDepth = FifoDepth;
+
+	return XST_SUCCESS;
+}
 /** @} */
@@ -68,6 +68,8 @@
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.02  raw    11/23/15 Updated XSpiPs_Abort() to read all RXFIFO entries.
 * 			This change is to tackle CR#910231.
+*       ag     10/14/26 Added the streaming mode for large interrupt driven
+*                       transfers, see XSpiPs_SetLargeXferThreshold().
 *
 * </pre>
 *
@@ -190,6 +192,8 @@ s32 XSpiPs_CfgInitialize(XSpiPs *InstancePtr, XSpiPs_Config *ConfigPtr,
 		InstancePtr->RecvBufferPtr = NULL;
 		InstancePtr->RequestedBytes = 0U;
 		InstancePtr->RemainingBytes = 0U;
+		InstancePtr->LargeXferThreshold = 0U;
+		InstancePtr->IsLargeXfer = FALSE;
 		InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
 		/*
@@ -386,6 +390,19 @@ s32 XSpiPs_Transfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 			TransCount++;
 		}
 
+		/*
+		 * Large transfers refill the TXFIFO before it runs empty, the
+		 * watermark is restored by the ISR for the last FIFO of data.
+		 */
+		if ((InstancePtr->LargeXferThreshold != 0U) &&
+			(ByteCount >= InstancePtr->LargeXferThreshold)) {
+			InstancePtr->IsLargeXfer = TRUE;
+			XSpiPs_SetTXWatermark(InstancePtr,
+					XSPIPS_LARGE_XFER_TXWR);
+		} else {
+			InstancePtr->IsLargeXfer = FALSE;
+		}
+
 		/*
 		 * Enable interrupts (connecting to the interrupt controller and
 		 * enabling interrupts should have been done by the caller).
@@ -932,6 +949,7 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 	if ((IntrStatus & XSPIPS_IXR_TXOW_MASK) != 0U) {
 		u8 TempData;
 		u32 TransCount;
+		u32 Pending = 0U;
 		/*
 		 * A transmit has just completed. Process received data and
 		 * check for more data to transmit.
@@ -944,7 +962,18 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 		 */
 		TransCount = SpiPtr->RequestedBytes - SpiPtr->RemainingBytes;
 
-		while (TransCount != 0U) {
+		/*
+		 * In streaming mode the TXFIFO level is below the watermark,
+		 * only the bytes ahead of it are known to have been received.
+		 * Those left pending are read on a later interrupt.
+		 */
+		if ((SpiPtr->IsLargeXfer == TRUE) &&
+			(SpiPtr->RemainingBytes > 0U) &&
+			(TransCount > XSPIPS_LARGE_XFER_TXWR)) {
+			Pending = XSPIPS_LARGE_XFER_TXWR;
+		}
+
+		while (TransCount != Pending) {
 			TempData = (u8)XSpiPs_RecvByte(SpiPtr->Config.BaseAddress);
 			if (SpiPtr->RecvBufferPtr != NULL) {
 				*SpiPtr->RecvBufferPtr = TempData;
@@ -967,6 +996,16 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 			++TransCount;
 		}
 
+		/*
+		 * Once the last data is in the TXFIFO, restore the watermark
+		 * so that the next interrupt indicates it has been sent.
+		 */
+		if ((SpiPtr->IsLargeXfer == TRUE) &&
+			(SpiPtr->RemainingBytes == 0U)) {
+			SpiPtr->IsLargeXfer = FALSE;
+			XSpiPs_SetTXWatermark(SpiPtr, XSPIPS_TXWR_RESET_VALUE);
+		}
+
 		if ((SpiPtr->RemainingBytes == 0U) &&
 			(SpiPtr->RequestedBytes == 0U)) {
 			/*
@@ -1133,6 +1172,14 @@ void XSpiPs_Abort(XSpiPs *InstancePtr)
 			XSPIPS_SR_OFFSET,
 			XSPIPS_IXR_MODF_MASK);
 
+	/*
+	 * Restore the TXFIFO watermark if a large transfer was aborted.
+	 */
+	if (InstancePtr->IsLargeXfer == TRUE) {
+		InstancePtr->IsLargeXfer = FALSE;
+		XSpiPs_SetTXWatermark(InstancePtr, XSPIPS_TXWR_RESET_VALUE);
+	}
+
 	InstancePtr->RemainingBytes = 0U;
 	InstancePtr->RequestedBytes = 0U;
 	InstancePtr->IsBusy = FALSE;
@@ -165,6 +165,17 @@
 * that another SPI device is acting as a master on the bus.
 *
 *
+* <b>Large Transfers</b>
+*
+* XSpiPs_SetLargeXferThreshold() selects a streaming mode for interrupt
+* driven transfers of at least the given number of bytes. The Tx FIFO
+* watermark is raised to XSPIPS_LARGE_XFER_TXWR for the body of the transfer,
+* so the FIFO is refilled while it still holds data and the bus does not idle
+* waiting for the interrupt to be serviced. The controller has no DMA request
+* interface, so the data is still moved by the CPU, one interrupt per
+* (XSPIPS_FIFO_DEPTH - XSPIPS_LARGE_XFER_TXWR) bytes. The watermark is
+* restored to its reset value for the last FIFO of the transfer.
+*
 * <b>Polled Operation</b>
 *
 * Transfer in polled mode is supported through a separate interface function
@@ -250,6 +261,8 @@
 *                       for doxygen generation and also modified filename tag
 *                       in eeprom interrupt, eeprom polled and flash polled
 *                       files to include them in doxygen examples.
+*       ag     10/14/26 Added XSpiPs_SetLargeXferThreshold() and the
+*                       streaming mode for large interrupt driven transfers.
 * </pre>
 *
 ******************************************************************************/
@@ -333,6 +346,16 @@ extern "C" {
 #define XSPIPS_MANUAL_START_OPTION			0x00000020U /**< Manual Start mode option */
 /*@}*/
 
+/** @name Large transfer streaming mode
+ *
+ * Tx FIFO watermark used for the body of a transfer in the streaming mode,
+ * see XSpiPs_SetLargeXferThreshold(). The interrupt handler is given the time
+ * to shift out this many bytes to refill the FIFO before the bus idles.
+ * @{
+ */
+#define XSPIPS_LARGE_XFER_TXWR		32U /**< Streaming Tx watermark */
+/*@}*/
+
 
 /** @name SPI Clock Prescaler options
  * The SPI Clock Prescaler Configuration bits are used to program master mode
@@ -419,6 +442,10 @@ typedef struct {
 	XSpiPs_StatusHandler StatusHandler;
 	void *StatusRef;  	 /**< Callback reference for status handler */
 
+	u32 LargeXferThreshold;	 /**< Min bytes for the streaming mode,
+					 0 if disabled */
+	u32 IsLargeXfer;	 /**< Transfer uses streaming mode (state) */
+
 } XSpiPs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -689,6 +716,8 @@ u32 XSpiPs_GetOptions(XSpiPs *InstancePtr);
 s32 XSpiPs_SetClkPrescaler(XSpiPs *InstancePtr, u8 Prescaler);
 u8 XSpiPs_GetClkPrescaler(XSpiPs *InstancePtr);
 
+s32 XSpiPs_SetLargeXferThreshold(XSpiPs *InstancePtr, u32 Threshold);
+
 s32 XSpiPs_SetDelays(XSpiPs *InstancePtr, u8 DelayNss, u8 DelayBtwn,
 			u8 DelayAfter, u8 DelayInit);
 void XSpiPs_GetDelays(XSpiPs *InstancePtr, u8 *DelayNss, u8 *DelayBtwn,
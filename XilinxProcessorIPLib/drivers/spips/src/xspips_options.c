@@ -51,6 +51,7 @@
 * 1.05a hk 	   26/04/13 Added disable and enable in XSpiPs_SetOptions when
 *				CPOL/CPHA bits are set/reset. Fix for CR#707669.
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
+*       ag     10/14/26 Added XSpiPs_SetLargeXferThreshold().
 *
 * </pre>
 *
@@ -430,4 +431,44 @@ void XSpiPs_GetDelays(XSpiPs *InstancePtr,u8 *DelayNss, u8 *DelayBtwn,
 				XSPIPS_DR_NSS_SHIFT);
 
 }
+
+/*****************************************************************************/
+/**
+*
+* This function sets the size from which interrupt driven transfers started
+* with XSpiPs_Transfer() use the streaming mode. In this mode the Tx FIFO is
+* refilled when its level drops below XSPIPS_LARGE_XFER_TXWR instead of when
+* it is empty, which keeps the bus busy for long continuous transfers.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+* @param	Threshold is the minimum transfer size in bytes. It must be
+*		larger than XSPIPS_FIFO_DEPTH, or 0 to disable the mode.
+*
+* @return
+*		- XST_SUCCESS if the threshold was set.
+*		- XST_DEVICE_BUSY if a transfer is in progress.
+*		- XST_INVALID_PARAM if Threshold is not larger than the FIFO
+*		depth.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XSpiPs_SetLargeXferThreshold(XSpiPs *InstancePtr, u32 Threshold)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->IsBusy == TRUE) {
+		Status = (s32)XST_DEVICE_BUSY;
+	} else if ((Threshold != 0U) && (Threshold <= XSPIPS_FIFO_DEPTH)) {
+		Status = (s32)XST_INVALID_PARAM;
+	} else {
+		InstancePtr->LargeXferThreshold = Threshold;
+		Status = (s32)XST_SUCCESS;
+	}
+
+	return Status;
+}
 /** @} */
@@ -72,6 +72,31 @@
 * <b>Interrupts</b>
 * There are no interrupts available for the SRIO Gen2 Core.
 *
+* <b>Messaging</b>
+*
+* The functions in xsrio_msg.c build HELLO format packets for the initiator
+* and target AXI4-Stream ports so that I/O and doorbell traffic can be moved
+* by a DMA engine instead of being framed one packet at a time:
+*
+* - XSrio_MsgBatch packs NWRITE, SWRITE and DOORBELL packets back to back in
+*   a caller supplied buffer. XSrio_MsgBatchSubmit() hands every packet of
+*   the batch to the DMA in a single XSrio_DmaSubmit call, one segment per
+*   packet, so that the DMA (typically AXI DMA in scatter gather mode) can
+*   mark each packet boundary with TLAST. The batch stays busy until
+*   XSrio_MsgBatchComplete() is called from the DMA transmit completion.
+* - XSrio_DbQueue coalesces doorbells: posting an info value that is already
+*   pending is merged with the pending one, and the queue is flushed as one
+*   batch once the threshold is reached.
+* - XSrio_RxRing manages a ring of receive buffers for the target port. The
+*   buffers are posted to the DMA up front, completions are queued with
+*   XSrio_RxRingComplete() and the application parses and returns them with
+*   XSrio_RxRingGet() / XSrio_RxRingRelease(). Doorbells can be dispatched
+*   directly from the completion path through a doorbell handler.
+*
+* The driver does not program the DMA itself; the submit callback maps the
+* segments onto the DMA engine in use. Cache maintenance of the packet
+* buffers is left to the callback as well.
+*
 * <b> Examples </b>
 *
 * There is an example provided to show the usage of the APIs
@@ -108,6 +133,9 @@
 *       ms   04/05/17 Added tabspace for return statements in functions of
 *                     srio examples for proper documentation while
 *                     generating doxygen.
+*       ag   10/14/26 Added the messaging layer in xsrio_msg.c: batched
+*                     NWRITE/SWRITE/DOORBELL submission, doorbell
+*                     coalescing and target receive descriptor rings.
 * </pre>
 ******************************************************************************/
 
@@ -166,6 +194,11 @@ extern "C" {
 #define XSRIO_DIR_TX		1 /**< Transmit Direction Flag */ 
 #define XSRIO_DIR_RX		2 /**< Receive Direction Flag */
 
+/* Messaging layer limits */
+#define XSRIO_MSG_MAX_PKTS	32 /**< Max packets in one message batch
+				    * and max pending doorbells
+				    */
+
 /************************** Type Definitions *****************************/
 
 /**
@@ -185,6 +218,91 @@ typedef struct XSrio {
 	int IsReady;	       /**< Device is initialized and ready */	
 	int PortWidth;	       /**< Serial lane Port width (1x or 2x or 4x) */
 } XSrio;
+
+/**
+ * A contiguous piece of memory handed to or returned by the DMA engine.
+ * For transmit each segment is one complete HELLO packet, for receive it is
+ * one receive buffer.
+ */
+typedef struct XSrio_DmaSeg {
+	UINTPTR Addr;		/**< Physical address of the segment */
+	u32 Length;		/**< Length of the segment in bytes */
+} XSrio_DmaSeg;
+
+/**
+ * Callback used to hand segments to the DMA engine. It must queue all
+ * NumSegs segments, each as a separate packet with TLAST on its last beat,
+ * and return XST_SUCCESS, or queue none of them and return an error.
+ */
+typedef int (*XSrio_DmaSubmit)(void *CallBackRef, const XSrio_DmaSeg *SegPtr,
+					u32 NumSegs);
+
+/**
+ * Callback invoked for each doorbell received on the target port when a
+ * doorbell handler is registered with the receive ring.
+ */
+typedef void (*XSrio_DoorbellHandler)(void *CallBackRef, u16 Info);
+
+/**
+ * Batch of outbound HELLO packets packed in a caller supplied buffer.
+ */
+typedef struct XSrio_MsgBatch {
+	UINTPTR BufferAddr;	/**< Packet buffer, 8 byte aligned */
+	u32 BufferSize;		/**< Size of the packet buffer in bytes */
+	u32 Used;		/**< Bytes of the buffer in use */
+	XSrio_DmaSeg Seg[XSRIO_MSG_MAX_PKTS]; /**< One segment per packet */
+	u32 NumPkts;		/**< Packets in the batch */
+	int IsBusy;		/**< Batch submitted, DMA not complete */
+	u8 Tid;			/**< Next transaction ID */
+	u8 Priority;		/**< Priority of the packets built */
+	XSrio_DmaSubmit SubmitFn; /**< Transmit DMA submit callback */
+	void *SubmitRef;	/**< Callback reference for SubmitFn */
+} XSrio_MsgBatch;
+
+/**
+ * Doorbell coalescing queue feeding a message batch.
+ */
+typedef struct XSrio_DbQueue {
+	XSrio_MsgBatch *BatchPtr; /**< Batch the doorbells are sent with */
+	u16 Info[XSRIO_MSG_MAX_PKTS]; /**< Pending doorbell info values */
+	u32 NumPending;		/**< Number of pending doorbells */
+	u32 Threshold;		/**< Pending count that triggers a flush */
+	u32 Coalesced;		/**< Doorbells merged with a pending one */
+} XSrio_DbQueue;
+
+/**
+ * Packet returned by XSrio_RxRingGet(), decoded from the HELLO header.
+ */
+typedef struct XSrio_RxPacket {
+	u8 Ftype;		/**< Format type (XSRIO_FTYPE_*) */
+	u8 Ttype;		/**< Transaction type */
+	u8 Tid;			/**< Transaction ID */
+	u8 Priority;		/**< Packet priority */
+	u64 Address;		/**< Target address (I/O packets) */
+	u16 Info;		/**< Info field (doorbells) */
+	u8 *PayloadPtr;		/**< Payload following the header */
+	u32 PayloadLen;		/**< Payload length in bytes */
+} XSrio_RxPacket;
+
+/**
+ * Target side receive descriptor ring. Each slot holds a completed buffer
+ * until the application releases it, at which point the buffer is posted
+ * back to the DMA.
+ */
+typedef struct XSrio_RxRing {
+	XSrio_DmaSeg *DescPtr;	/**< Caller supplied descriptor array */
+	u32 Mask;		/**< Number of descriptors - 1 */
+	u32 BufSize;		/**< Size of each receive buffer */
+	UINTPTR BufferAddr;	/**< Start of the receive buffer memory */
+	volatile u32 Head;	/**< Completed count, written by the ISR */
+	volatile u32 Tail;	/**< Released count, written by the reader */
+	XSrio_DmaSubmit PostFn;	/**< Receive DMA post callback */
+	void *PostRef;		/**< Callback reference for PostFn */
+	XSrio_DoorbellHandler DbHandler; /**< Optional doorbell handler */
+	void *DbRef;		/**< Callback reference for DbHandler */
+	u32 Doorbells;		/**< Doorbells dispatched to DbHandler */
+	u32 Errors;		/**< Runt packets and failed reposts */
+} XSrio_RxRing;
 	
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -1550,6 +1668,32 @@ void XSrio_SetWaterMark(XSrio *InstancePtr, u8 WaterMark0, u8 WaterMark1,
 					u8 WaterMark2);
 void XSrio_GetWaterMark(XSrio *InstancePtr, u8 *WaterMark0, u8 *WaterMark1,
 					u8 *WaterMark2);
+
+/**
+ * Messaging functions in xsrio_msg.c
+ */
+int XSrio_MsgBatchInitialize(XSrio_MsgBatch *BatchPtr, UINTPTR BufferAddr,
+			u32 BufferSize, XSrio_DmaSubmit SubmitFn,
+			void *SubmitRef);
+int XSrio_MsgBatchAddWrite(XSrio_MsgBatch *BatchPtr, u8 Ftype, u64 Address,
+			const u8 *DataPtr, u32 Length);
+int XSrio_MsgBatchAddDoorbell(XSrio_MsgBatch *BatchPtr, u16 Info);
+int XSrio_MsgBatchSubmit(XSrio_MsgBatch *BatchPtr);
+void XSrio_MsgBatchComplete(XSrio_MsgBatch *BatchPtr);
+int XSrio_DbQueueInitialize(XSrio_DbQueue *QueuePtr,
+			XSrio_MsgBatch *BatchPtr, u32 Threshold);
+int XSrio_DbQueuePost(XSrio_DbQueue *QueuePtr, u16 Info);
+int XSrio_DbQueueFlush(XSrio_DbQueue *QueuePtr);
+int XSrio_RxRingInitialize(XSrio_RxRing *RingPtr, XSrio_DmaSeg *DescPtr,
+			u32 NumDesc, UINTPTR BufferAddr, u32 BufSize,
+			XSrio_DmaSubmit PostFn, void *PostRef);
+void XSrio_RxRingSetDoorbellHandler(XSrio_RxRing *RingPtr,
+			XSrio_DoorbellHandler FuncPtr, void *CallBackRef);
+int XSrio_RxRingStart(XSrio_RxRing *RingPtr);
+void XSrio_RxRingComplete(XSrio_RxRing *RingPtr, UINTPTR BufAddr,
+			u32 Length);
+int XSrio_RxRingGet(XSrio_RxRing *RingPtr, XSrio_RxPacket *PacketPtr);
+void XSrio_RxRingRelease(XSrio_RxRing *RingPtr);
 			
 #ifdef __cplusplus
 }
@@ -47,6 +47,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- --------------------------------------------------------- 
 * 1.0   adk  16/04/14 Initial release.
+* 1.1   ag   10/14/26 Added HELLO packet header field definitions used by
+*                     the messaging layer.
 * 
 ******************************************************************************/
 
@@ -629,6 +631,47 @@ extern "C" {
 
 /*@}*/
 
+/** @name HELLO packet header field definitions.
+ *
+ * The initiator and target AXI4-Stream ports carry packets in the HELLO
+ * (Header Encoded Logical Layer Optimized) format: a 64-bit header beat
+ * followed by the payload. The low word of the header is transferred first.
+ * @{
+ */
+#define XSRIO_HELLO_HDR_SIZE		8	/**< Header size in bytes */
+#define XSRIO_HELLO_MAX_PAYLOAD		256	/**< Max payload bytes */
+
+#define XSRIO_HELLO_TID_SHIFT		56	/**< Transaction ID shift */
+#define XSRIO_HELLO_FTYPE_SHIFT		52	/**< Format type shift */
+#define XSRIO_HELLO_TTYPE_SHIFT		48	/**< Transaction type shift */
+#define XSRIO_HELLO_PRIO_SHIFT		45	/**< Priority shift */
+#define XSRIO_HELLO_CRF_SHIFT		44	/**< Critical request flow
+						  *  shift
+						  */
+#define XSRIO_HELLO_SIZE_SHIFT		36	/**< Size (bytes - 1) shift */
+#define XSRIO_HELLO_INFO_SHIFT		16	/**< Doorbell info shift */
+
+#define XSRIO_HELLO_TID_MASK		0xFFULL	/**< Transaction ID mask */
+#define XSRIO_HELLO_FTYPE_MASK		0xFULL	/**< Format type mask */
+#define XSRIO_HELLO_TTYPE_MASK		0xFULL	/**< Transaction type mask */
+#define XSRIO_HELLO_PRIO_MASK		0x3ULL	/**< Priority mask */
+#define XSRIO_HELLO_SIZE_MASK		0xFFULL	/**< Size mask */
+#define XSRIO_HELLO_INFO_MASK		0xFFFFULL /**< Doorbell info mask */
+#define XSRIO_HELLO_ADDR_MASK		0x3FFFFFFFFULL /**< 34-bit address
+							 *  mask
+							 */
+
+#define XSRIO_FTYPE_NREAD		2	/**< NREAD / atomic requests */
+#define XSRIO_FTYPE_NWRITE		5	/**< NWRITE / NWRITE_R */
+#define XSRIO_FTYPE_SWRITE		6	/**< Streaming write */
+#define XSRIO_FTYPE_DOORBELL		10	/**< Doorbell */
+#define XSRIO_FTYPE_MESSAGE		11	/**< Data message */
+#define XSRIO_FTYPE_RESPONSE		13	/**< Response */
+
+#define XSRIO_TTYPE_NWRITE		4	/**< NWRITE transaction type */
+#define XSRIO_TTYPE_NWRITE_R		5	/**< NWRITE_R transaction type */
+/*@}*/
+
 /****************** Macros (Inline Functions) Definitions ********************/
 /*****************************************************************************/
 /**
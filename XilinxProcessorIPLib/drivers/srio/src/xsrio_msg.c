@@ -0,0 +1,744 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsrio_msg.c
+* @addtogroup srio_v1_1
+* @{
+*
+* This file contains the messaging layer of the XSrio driver: batched
+* NWRITE/SWRITE/DOORBELL submission through a DMA engine, doorbell
+* coalescing and target side receive descriptor rings. See xsrio.h for an
+* overview.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.1   ag   10/14/26 First release
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xsrio.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* Round a byte count up to the 8 byte beat of the AXI4-Stream port */
+#define XSrio_MsgAlign(Length)	(((Length) + 7) & ~7U)
+
+/************************** Function Prototypes ******************************/
+
+static void XSrio_MsgPutHeader(XSrio_MsgBatch *BatchPtr, u64 Header,
+				u32 PktLen);
+
+/****************************************************************************/
+/**
+* Initialize a message batch on the given packet buffer.
+*
+* @param	BatchPtr is the batch to initialize.
+* @param	BufferAddr is the physical address of the packet buffer. It
+*		must be 8 byte aligned and reachable by the DMA.
+* @param	BufferSize is the size of the packet buffer in bytes.
+* @param	SubmitFn is called by XSrio_MsgBatchSubmit() to queue the
+*		packets on the transmit DMA.
+* @param	SubmitRef is passed to SubmitFn.
+*
+* @return
+*		- XST_SUCCESS if the batch was initialized.
+*		- XST_INVALID_PARAM if the buffer is misaligned or too small
+*		  for a single packet.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_MsgBatchInitialize(XSrio_MsgBatch *BatchPtr, UINTPTR BufferAddr,
+			u32 BufferSize, XSrio_DmaSubmit SubmitFn,
+			void *SubmitRef)
+{
+	Xil_AssertNonvoid(BatchPtr != NULL);
+	Xil_AssertNonvoid(SubmitFn != NULL);
+
+	if (((BufferAddr & 7) != 0) || (BufferSize < XSRIO_HELLO_HDR_SIZE)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(BatchPtr, 0, sizeof(XSrio_MsgBatch));
+	BatchPtr->BufferAddr = BufferAddr;
+	BatchPtr->BufferSize = BufferSize;
+	BatchPtr->SubmitFn = SubmitFn;
+	BatchPtr->SubmitRef = SubmitRef;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Append an NWRITE or SWRITE to the batch. Transfers longer than the
+* maximum SRIO payload are split into several packets with consecutive
+* addresses. Either all packets of the transfer are added or none.
+*
+* @param	BatchPtr is the batch to add to.
+* @param	Ftype is XSRIO_FTYPE_NWRITE or XSRIO_FTYPE_SWRITE.
+* @param	Address is the 34-bit target address.
+* @param	DataPtr points to the payload.
+* @param	Length is the payload length in bytes.
+*
+* @return
+*		- XST_SUCCESS if the transfer was added.
+*		- XST_DEVICE_BUSY if the batch is waiting for the DMA.
+*		- XST_INVALID_PARAM if the length is zero, the address does
+*		  not fit or an SWRITE is not double word aligned.
+*		- XST_BUFFER_TOO_SMALL if the batch has no room left.
+*
+* @note		SWRITE requires both the address and the length to be
+*		multiples of 8 bytes.
+*
+*****************************************************************************/
+int XSrio_MsgBatchAddWrite(XSrio_MsgBatch *BatchPtr, u8 Ftype, u64 Address,
+			const u8 *DataPtr, u32 Length)
+{
+	u32 NumPkts;
+	u32 Needed;
+	u32 Chunk;
+	u64 Header;
+
+	Xil_AssertNonvoid(BatchPtr != NULL);
+	Xil_AssertNonvoid(DataPtr != NULL);
+	Xil_AssertNonvoid((Ftype == XSRIO_FTYPE_NWRITE) ||
+				(Ftype == XSRIO_FTYPE_SWRITE));
+
+	if (BatchPtr->IsBusy) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if ((Length == 0) ||
+	    ((Address + Length - 1) > XSRIO_HELLO_ADDR_MASK)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((Ftype == XSRIO_FTYPE_SWRITE) &&
+	    (((Address & 7) != 0) || ((Length & 7) != 0))) {
+		return XST_INVALID_PARAM;
+	}
+
+	/* Check the whole transfer fits before touching the buffer */
+	NumPkts = (Length + XSRIO_HELLO_MAX_PAYLOAD - 1) /
+					XSRIO_HELLO_MAX_PAYLOAD;
+	Needed = (NumPkts * XSRIO_HELLO_HDR_SIZE) + XSrio_MsgAlign(Length);
+	if (((BatchPtr->NumPkts + NumPkts) > XSRIO_MSG_MAX_PKTS) ||
+	    (Needed > (BatchPtr->BufferSize - BatchPtr->Used))) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+
+	while (Length > 0) {
+		Chunk = (Length > XSRIO_HELLO_MAX_PAYLOAD) ?
+				XSRIO_HELLO_MAX_PAYLOAD : Length;
+
+		Header = ((u64)BatchPtr->Tid << XSRIO_HELLO_TID_SHIFT) |
+			((u64)Ftype << XSRIO_HELLO_FTYPE_SHIFT) |
+			((u64)(BatchPtr->Priority & XSRIO_HELLO_PRIO_MASK) <<
+					XSRIO_HELLO_PRIO_SHIFT) |
+			((u64)(Chunk - 1) << XSRIO_HELLO_SIZE_SHIFT) |
+			(Address & XSRIO_HELLO_ADDR_MASK);
+		if (Ftype == XSRIO_FTYPE_NWRITE) {
+			Header |= (u64)XSRIO_TTYPE_NWRITE <<
+					XSRIO_HELLO_TTYPE_SHIFT;
+		}
+
+		XSrio_MsgPutHeader(BatchPtr, Header,
+				XSRIO_HELLO_HDR_SIZE + XSrio_MsgAlign(Chunk));
+		memcpy((void *)(BatchPtr->BufferAddr + BatchPtr->Used +
+				XSRIO_HELLO_HDR_SIZE), DataPtr, Chunk);
+		BatchPtr->Used += XSRIO_HELLO_HDR_SIZE + XSrio_MsgAlign(Chunk);
+
+		Address += Chunk;
+		DataPtr += Chunk;
+		Length -= Chunk;
+	}
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Append a DOORBELL to the batch.
+*
+* @param	BatchPtr is the batch to add to.
+* @param	Info is the 16-bit doorbell info value.
+*
+* @return
+*		- XST_SUCCESS if the doorbell was added.
+*		- XST_DEVICE_BUSY if the batch is waiting for the DMA.
+*		- XST_BUFFER_TOO_SMALL if the batch has no room left.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_MsgBatchAddDoorbell(XSrio_MsgBatch *BatchPtr, u16 Info)
+{
+	u64 Header;
+
+	Xil_AssertNonvoid(BatchPtr != NULL);
+
+	if (BatchPtr->IsBusy) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if ((BatchPtr->NumPkts >= XSRIO_MSG_MAX_PKTS) ||
+	    ((BatchPtr->BufferSize - BatchPtr->Used) < XSRIO_HELLO_HDR_SIZE)) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+
+	Header = ((u64)BatchPtr->Tid << XSRIO_HELLO_TID_SHIFT) |
+		((u64)XSRIO_FTYPE_DOORBELL << XSRIO_HELLO_FTYPE_SHIFT) |
+		((u64)(BatchPtr->Priority & XSRIO_HELLO_PRIO_MASK) <<
+				XSRIO_HELLO_PRIO_SHIFT) |
+		((u64)Info << XSRIO_HELLO_INFO_SHIFT);
+
+	XSrio_MsgPutHeader(BatchPtr, Header, XSRIO_HELLO_HDR_SIZE);
+	BatchPtr->Used += XSRIO_HELLO_HDR_SIZE;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Hand all packets of the batch to the transmit DMA in one call. On success
+* the batch is busy until XSrio_MsgBatchComplete() is called; on failure it
+* is left unchanged so that the submit can be retried.
+*
+* @param	BatchPtr is the batch to submit.
+*
+* @return
+*		- XST_SUCCESS if the packets were queued or the batch was
+*		  empty.
+*		- XST_DEVICE_BUSY if a previous submit has not completed.
+*		- The error returned by the submit callback otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_MsgBatchSubmit(XSrio_MsgBatch *BatchPtr)
+{
+	int Status;
+
+	Xil_AssertNonvoid(BatchPtr != NULL);
+
+	if (BatchPtr->IsBusy) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (BatchPtr->NumPkts == 0) {
+		return XST_SUCCESS;
+	}
+
+	Status = BatchPtr->SubmitFn(BatchPtr->SubmitRef, BatchPtr->Seg,
+					BatchPtr->NumPkts);
+	if (Status == XST_SUCCESS) {
+		BatchPtr->IsBusy = 1;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+* Release a submitted batch once the transmit DMA has finished with it. This
+* is typically called from the DMA completion interrupt for the last packet
+* of the batch.
+*
+* @param	BatchPtr is the batch that completed.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XSrio_MsgBatchComplete(XSrio_MsgBatch *BatchPtr)
+{
+	Xil_AssertVoid(BatchPtr != NULL);
+
+	BatchPtr->Used = 0;
+	BatchPtr->NumPkts = 0;
+	BatchPtr->IsBusy = 0;
+}
+
+/****************************************************************************/
+/**
+* Initialize a doorbell coalescing queue.
+*
+* @param	QueuePtr is the queue to initialize.
+* @param	BatchPtr is the batch the doorbells are sent with. Writes
+*		already in the batch go out ahead of the doorbells.
+* @param	Threshold is the number of pending doorbells that triggers a
+*		flush, 1 to XSRIO_MSG_MAX_PKTS.
+*
+* @return
+*		- XST_SUCCESS if the queue was initialized.
+*		- XST_INVALID_PARAM if the threshold is out of range.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_DbQueueInitialize(XSrio_DbQueue *QueuePtr,
+			XSrio_MsgBatch *BatchPtr, u32 Threshold)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(BatchPtr != NULL);
+
+	if ((Threshold == 0) || (Threshold > XSRIO_MSG_MAX_PKTS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(QueuePtr, 0, sizeof(XSrio_DbQueue));
+	QueuePtr->BatchPtr = BatchPtr;
+	QueuePtr->Threshold = Threshold;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Queue a doorbell. A doorbell whose info value is already pending is merged
+* with the pending one. The queue is flushed once Threshold doorbells are
+* pending.
+*
+* @param	QueuePtr is the queue to post to.
+* @param	Info is the 16-bit doorbell info value.
+*
+* @return
+*		- XST_SUCCESS if the doorbell was queued or merged.
+*		- XST_DEVICE_BUSY if the queue is full and the batch is still
+*		  waiting for the DMA.
+*		- The error returned by XSrio_DbQueueFlush() otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_DbQueuePost(XSrio_DbQueue *QueuePtr, u16 Info)
+{
+	u32 Index;
+	int Status;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	for (Index = 0; Index < QueuePtr->NumPending; Index++) {
+		if (QueuePtr->Info[Index] == Info) {
+			QueuePtr->Coalesced++;
+			return XST_SUCCESS;
+		}
+	}
+
+	if (QueuePtr->NumPending >= QueuePtr->Threshold) {
+		Status = XSrio_DbQueueFlush(QueuePtr);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+	}
+
+	QueuePtr->Info[QueuePtr->NumPending++] = Info;
+
+	if (QueuePtr->NumPending >= QueuePtr->Threshold) {
+		/*
+		 * The doorbell is queued either way; a busy batch is
+		 * retried on the next post or flush.
+		 */
+		(void)XSrio_DbQueueFlush(QueuePtr);
+	}
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Send all pending doorbells, together with anything already in the batch.
+*
+* @param	QueuePtr is the queue to flush.
+*
+* @return
+*		- XST_SUCCESS if the doorbells were submitted or none were
+*		  pending.
+*		- XST_DEVICE_BUSY if the batch is still waiting for the DMA.
+*		- XST_BUFFER_TOO_SMALL if the batch has no room for the
+*		  doorbells.
+*		- The error returned by the submit callback otherwise.
+*
+* @note		On any error the pending doorbells are kept.
+*
+*****************************************************************************/
+int XSrio_DbQueueFlush(XSrio_DbQueue *QueuePtr)
+{
+	XSrio_MsgBatch *BatchPtr;
+	u32 SavedUsed;
+	u32 SavedPkts;
+	u8 SavedTid;
+	u32 Index;
+	int Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	BatchPtr = QueuePtr->BatchPtr;
+	if (QueuePtr->NumPending == 0) {
+		return XST_SUCCESS;
+	}
+
+	if (BatchPtr->IsBusy) {
+		return XST_DEVICE_BUSY;
+	}
+
+	SavedUsed = BatchPtr->Used;
+	SavedPkts = BatchPtr->NumPkts;
+	SavedTid = BatchPtr->Tid;
+
+	for (Index = 0; Index < QueuePtr->NumPending; Index++) {
+		Status = XSrio_MsgBatchAddDoorbell(BatchPtr,
+					QueuePtr->Info[Index]);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	if (Status == XST_SUCCESS) {
+		Status = XSrio_MsgBatchSubmit(BatchPtr);
+	}
+
+	if (Status != XST_SUCCESS) {
+		/* Take the doorbells back out of the batch */
+		BatchPtr->Used = SavedUsed;
+		BatchPtr->NumPkts = SavedPkts;
+		BatchPtr->Tid = SavedTid;
+		return Status;
+	}
+
+	QueuePtr->NumPending = 0;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Initialize a target side receive ring. The buffer memory is carved into
+* NumDesc buffers of BufSize bytes each.
+*
+* @param	RingPtr is the ring to initialize.
+* @param	DescPtr is an array of NumDesc descriptors owned by the ring.
+* @param	NumDesc is the number of descriptors, a power of two.
+* @param	BufferAddr is the physical address of the buffer memory,
+*		8 byte aligned and NumDesc * BufSize bytes long.
+* @param	BufSize is the size of each buffer, a multiple of 8 large
+*		enough for the header and the largest expected payload.
+* @param	PostFn is called to post receive buffers to the DMA.
+* @param	PostRef is passed to PostFn.
+*
+* @return
+*		- XST_SUCCESS if the ring was initialized.
+*		- XST_INVALID_PARAM if a parameter is out of range.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_RxRingInitialize(XSrio_RxRing *RingPtr, XSrio_DmaSeg *DescPtr,
+			u32 NumDesc, UINTPTR BufferAddr, u32 BufSize,
+			XSrio_DmaSubmit PostFn, void *PostRef)
+{
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(DescPtr != NULL);
+	Xil_AssertNonvoid(PostFn != NULL);
+
+	if ((NumDesc == 0) || ((NumDesc & (NumDesc - 1)) != 0) ||
+	    ((BufferAddr & 7) != 0) || ((BufSize & 7) != 0) ||
+	    (BufSize < XSRIO_HELLO_HDR_SIZE)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(RingPtr, 0, sizeof(XSrio_RxRing));
+	RingPtr->DescPtr = DescPtr;
+	RingPtr->Mask = NumDesc - 1;
+	RingPtr->BufferAddr = BufferAddr;
+	RingPtr->BufSize = BufSize;
+	RingPtr->PostFn = PostFn;
+	RingPtr->PostRef = PostRef;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Register a handler for doorbells received on the ring. Doorbells are then
+* delivered from XSrio_RxRingComplete() and never show up in
+* XSrio_RxRingGet(). Passing NULL queues doorbells like any other packet.
+*
+* @param	RingPtr is the receive ring.
+* @param	FuncPtr is the doorbell handler, or NULL.
+* @param	CallBackRef is passed to the handler.
+*
+* @return	None.
+*
+* @note		The handler runs in the context of XSrio_RxRingComplete(),
+*		normally the DMA receive interrupt.
+*
+*****************************************************************************/
+void XSrio_RxRingSetDoorbellHandler(XSrio_RxRing *RingPtr,
+			XSrio_DoorbellHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+
+	RingPtr->DbHandler = FuncPtr;
+	RingPtr->DbRef = CallBackRef;
+}
+
+/****************************************************************************/
+/**
+* Post every receive buffer of the ring to the DMA in one call.
+*
+* @param	RingPtr is the receive ring.
+*
+* @return
+*		- XST_SUCCESS if the buffers were posted.
+*		- The error returned by the post callback otherwise.
+*
+* @note		Call once after XSrio_RxRingInitialize(), before the DMA
+*		receive channel is started.
+*
+*****************************************************************************/
+int XSrio_RxRingStart(XSrio_RxRing *RingPtr)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(RingPtr != NULL);
+
+	RingPtr->Head = 0;
+	RingPtr->Tail = 0;
+	for (Index = 0; Index <= RingPtr->Mask; Index++) {
+		RingPtr->DescPtr[Index].Addr = RingPtr->BufferAddr +
+					((UINTPTR)Index * RingPtr->BufSize);
+		RingPtr->DescPtr[Index].Length = RingPtr->BufSize;
+	}
+
+	return RingPtr->PostFn(RingPtr->PostRef, RingPtr->DescPtr,
+				RingPtr->Mask + 1);
+}
+
+/****************************************************************************/
+/**
+* Record a buffer completed by the receive DMA. Runt packets are reposted
+* and counted as errors; doorbells are dispatched to the doorbell handler
+* and reposted when one is registered. Anything else is queued for
+* XSrio_RxRingGet().
+*
+* @param	RingPtr is the receive ring.
+* @param	BufAddr is the address of the buffer the DMA filled.
+* @param	Length is the number of bytes received, header included.
+*
+* @return	None.
+*
+* @note		The ring never holds more completions than it has buffers,
+*		so this cannot overflow.
+*
+*****************************************************************************/
+void XSrio_RxRingComplete(XSrio_RxRing *RingPtr, UINTPTR BufAddr,
+			u32 Length)
+{
+	volatile XSrio_DmaSeg *SlotPtr;
+	XSrio_DmaSeg Seg;
+	u32 HeaderHi;
+	u32 HeaderLo;
+
+	Xil_AssertVoid(RingPtr != NULL);
+
+	Seg.Addr = BufAddr;
+	Seg.Length = RingPtr->BufSize;
+
+	if (Length < XSRIO_HELLO_HDR_SIZE) {
+		RingPtr->Errors++;
+		if (RingPtr->PostFn(RingPtr->PostRef, &Seg, 1) !=
+							XST_SUCCESS) {
+			RingPtr->Errors++;
+		}
+		return;
+	}
+
+	if (RingPtr->DbHandler != NULL) {
+		HeaderLo = *(volatile u32 *)BufAddr;
+		HeaderHi = *(volatile u32 *)(BufAddr + 4);
+		if (((HeaderHi >> (XSRIO_HELLO_FTYPE_SHIFT - 32)) &
+				XSRIO_HELLO_FTYPE_MASK) ==
+				XSRIO_FTYPE_DOORBELL) {
+			RingPtr->Doorbells++;
+			RingPtr->DbHandler(RingPtr->DbRef,
+				(u16)((HeaderLo >> XSRIO_HELLO_INFO_SHIFT) &
+					XSRIO_HELLO_INFO_MASK));
+			if (RingPtr->PostFn(RingPtr->PostRef, &Seg, 1) !=
+							XST_SUCCESS) {
+				RingPtr->Errors++;
+			}
+			return;
+		}
+	}
+
+	SlotPtr = &RingPtr->DescPtr[RingPtr->Head & RingPtr->Mask];
+	SlotPtr->Addr = BufAddr;
+	SlotPtr->Length = Length;
+	RingPtr->Head++;
+}
+
+/****************************************************************************/
+/**
+* Decode the oldest completed packet of the ring. The packet and its buffer
+* stay owned by the application until XSrio_RxRingRelease() is called.
+*
+* @param	RingPtr is the receive ring.
+* @param	PacketPtr is filled with the decoded packet.
+*
+* @return
+*		- XST_SUCCESS if a packet was returned.
+*		- XST_NO_DATA if the ring is empty.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XSrio_RxRingGet(XSrio_RxRing *RingPtr, XSrio_RxPacket *PacketPtr)
+{
+	volatile XSrio_DmaSeg *SlotPtr;
+	u64 Header;
+	u32 Size;
+
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(PacketPtr != NULL);
+
+	if (RingPtr->Tail == RingPtr->Head) {
+		return XST_NO_DATA;
+	}
+
+	SlotPtr = &RingPtr->DescPtr[RingPtr->Tail & RingPtr->Mask];
+	Header = ((u64)*(volatile u32 *)(SlotPtr->Addr + 4) << 32) |
+			*(volatile u32 *)SlotPtr->Addr;
+
+	PacketPtr->Ftype = (u8)((Header >> XSRIO_HELLO_FTYPE_SHIFT) &
+					XSRIO_HELLO_FTYPE_MASK);
+	PacketPtr->Ttype = (u8)((Header >> XSRIO_HELLO_TTYPE_SHIFT) &
+					XSRIO_HELLO_TTYPE_MASK);
+	PacketPtr->Tid = (u8)((Header >> XSRIO_HELLO_TID_SHIFT) &
+					XSRIO_HELLO_TID_MASK);
+	PacketPtr->Priority = (u8)((Header >> XSRIO_HELLO_PRIO_SHIFT) &
+					XSRIO_HELLO_PRIO_MASK);
+	PacketPtr->Address = Header & XSRIO_HELLO_ADDR_MASK;
+	PacketPtr->Info = (u16)((Header >> XSRIO_HELLO_INFO_SHIFT) &
+					XSRIO_HELLO_INFO_MASK);
+	PacketPtr->PayloadPtr = (u8 *)(SlotPtr->Addr + XSRIO_HELLO_HDR_SIZE);
+
+	/* The size field is exact; the DMA length includes beat padding */
+	PacketPtr->PayloadLen = SlotPtr->Length - XSRIO_HELLO_HDR_SIZE;
+	if ((PacketPtr->Ftype == XSRIO_FTYPE_NWRITE) ||
+	    (PacketPtr->Ftype == XSRIO_FTYPE_SWRITE) ||
+	    (PacketPtr->Ftype == XSRIO_FTYPE_MESSAGE)) {
+		Size = (u32)((Header >> XSRIO_HELLO_SIZE_SHIFT) &
+					XSRIO_HELLO_SIZE_MASK) + 1;
+		if (Size < PacketPtr->PayloadLen) {
+			PacketPtr->PayloadLen = Size;
+		}
+	} else if (PacketPtr->Ftype == XSRIO_FTYPE_DOORBELL) {
+		PacketPtr->PayloadLen = 0;
+	}
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Return the packet obtained with XSrio_RxRingGet() to the ring and post its
+* buffer back to the receive DMA.
+*
+* @param	RingPtr is the receive ring.
+*
+* @return	None.
+*
+* @note		A repost failure is counted in the ring Errors field; the
+*		buffer is then lost to the DMA until the ring is restarted.
+*
+*****************************************************************************/
+void XSrio_RxRingRelease(XSrio_RxRing *RingPtr)
+{
+	XSrio_DmaSeg Seg;
+
+	Xil_AssertVoid(RingPtr != NULL);
+
+	if (RingPtr->Tail == RingPtr->Head) {
+		return;
+	}
+
+	Seg.Addr = RingPtr->DescPtr[RingPtr->Tail & RingPtr->Mask].Addr;
+	Seg.Length = RingPtr->BufSize;
+	RingPtr->Tail++;
+
+	if (RingPtr->PostFn(RingPtr->PostRef, &Seg, 1) != XST_SUCCESS) {
+		RingPtr->Errors++;
+	}
+}
+
+/****************************************************************************/
+/**
+* Write a HELLO header at the current end of the batch buffer and record the
+* packet segment. The Used count is advanced by the caller.
+*
+* @param	BatchPtr is the batch.
+* @param	Header is the 64-bit HELLO header.
+* @param	PktLen is the length of the packet, header included.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XSrio_MsgPutHeader(XSrio_MsgBatch *BatchPtr, u64 Header,
+				u32 PktLen)
+{
+	UINTPTR Addr = BatchPtr->BufferAddr + BatchPtr->Used;
+
+	/* Low word of the header goes out first on the stream */
+	*(u32 *)Addr = (u32)Header;
+	*(u32 *)(Addr + 4) = (u32)(Header >> 32);
+
+	BatchPtr->Seg[BatchPtr->NumPkts].Addr = Addr;
+	BatchPtr->Seg[BatchPtr->NumPkts].Length = PktLen;
+	BatchPtr->NumPkts++;
+	BatchPtr->Tid++;
+}
+/** @} */
@@ -115,6 +115,15 @@
 * device in interrupt mode.
 *
 *
+* <b> Batched and Alarm Driven Sampling </b>
+*
+* XSysMon_GetAdcDataBatch() reads several channels in one call. The alarm
+* sampler (XSysMon_AlarmSamplerInitialize()) reads a set of channels from
+* XSysMon_AlarmSamplerIntrHandler() only when an enabled alarm interrupt is
+* raised, so software is not woken while the monitored values stay within
+* the limits set with XSysMon_SetAlarmThreshold().
+*
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -224,6 +233,8 @@
 *                    for doxygen generation.
 * 7.4  ms   04/18/17 Modified tcl file to add suffix U for all macros
 *                    definitions of sysmon in xparameters.h
+*      ag   10/14/26 Added XSysMon_GetAdcDataBatch and the alarm driven
+*                    sampler in xsysmon_batch.c.
 * </pre>
 *
 *****************************************************************************/
@@ -407,6 +418,31 @@ typedef struct {
 					in CONVST register */
 } XSysMon;
 
+#define XSM_BATCH_MAX_CHANNELS	36 /**< Max channels of a sampler */
+
+/**
+ * Handler called by XSysMon_AlarmSamplerIntrHandler() when alarms are
+ * raised. Status holds the XSM_IPIXR_* bits that were raised and DataPtr the
+ * channels read, in the order given to XSysMon_AlarmSamplerInitialize().
+ */
+typedef void (*XSysMon_AlarmHandler)(void *CallBackRef, u32 Status,
+					const u16 *DataPtr);
+
+/**
+ * Alarm driven sampler. The user allocates a variable of this type and
+ * passes it to the XSysMon_AlarmSampler* functions and, as the callback
+ * reference, to XSysMon_AlarmSamplerIntrHandler().
+ */
+typedef struct {
+	XSysMon *InstancePtr;	/**< Instance being sampled */
+	u32 IntrMask;		/**< Interrupts that trigger a sample */
+	u32 NumChannels;	/**< Channels read on an alarm */
+	u8 Channel[XSM_BATCH_MAX_CHANNELS];	/**< Channels to read */
+	u16 Data[XSM_BATCH_MAX_CHANNELS];	/**< Last data read */
+	XSysMon_AlarmHandler Handler;	/**< Alarm handler */
+	void *CallBackRef;		/**< Callback reference for Handler */
+} XSysMon_AlarmSampler;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 /****************************************************************************/
@@ -631,6 +667,22 @@ void XSysMon_DisableTempUpdate(XSysMon *InstancePtr);
 void XSysMon_SetTempWaitCycles(XSysMon *InstancePtr, u16 WaitCycles);
 
 
+/**
+ * Functions in xsysmon_batch.c
+ */
+void XSysMon_GetAdcDataBatch(XSysMon *InstancePtr, const u8 *ChannelPtr,
+				u16 *DataPtr, u32 NumChannels);
+
+int XSysMon_AlarmSamplerInitialize(XSysMon_AlarmSampler *SamplerPtr,
+					XSysMon *InstancePtr,
+					const u8 *ChannelPtr, u32 NumChannels,
+					XSysMon_AlarmHandler FuncPtr,
+					void *CallBackRef);
+void XSysMon_AlarmSamplerStart(XSysMon_AlarmSampler *SamplerPtr,
+				u32 IntrMask);
+void XSysMon_AlarmSamplerStop(XSysMon_AlarmSampler *SamplerPtr);
+void XSysMon_AlarmSamplerIntrHandler(void *CallBackRef);
+
 /**
  * Functions in xsysmon_selftest.c
  */
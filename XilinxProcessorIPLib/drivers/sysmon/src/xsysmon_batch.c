@@ -0,0 +1,299 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsysmon_batch.c
+* @addtogroup sysmon_v7_4
+* @{
+*
+* This file contains the batched channel read and the alarm driven sampler of
+* the System Monitor/ADC driver.
+*
+* The ADC data registers are memory mapped, so a batch is a run of register
+* reads with the arguments checked once per call rather than once per
+* channel.
+*
+* The alarm interrupts of the device are raised when an alarm becomes active
+* (and, for the temperature and over temperature alarms, optionally when it
+* becomes inactive), so the sampler runs once per threshold crossing.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 7.4   ag     10/14/26 First release
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xsysmon.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Interrupts that are not alarm crossings */
+#define XSM_SAMPLER_NON_ALARM_MASK	(XSM_IPIXR_JTAG_MODIFIED_MASK | \
+					 XSM_IPIXR_JTAG_LOCKED_MASK | \
+					 XSM_IPIXR_EOC_MASK | \
+					 XSM_IPIXR_EOS_MASK)
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+/************************** Variable Definitions ****************************/
+
+
+/****************************************************************************/
+/**
+*
+* This function reads the ADC data of several channels.
+*
+* @param	InstancePtr is a pointer to the XSysMon instance.
+* @param	ChannelPtr is the array of channels to read. Use XSM_CH_*
+*		defined in xsysmon.h.
+* @param	DataPtr is the array receiving the 16-bit ADC data of each
+*		channel, in the order of ChannelPtr.
+* @param	NumChannels is the number of channels to read.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XSysMon_GetAdcDataBatch(XSysMon *InstancePtr, const u8 *ChannelPtr,
+				u16 *DataPtr, u32 NumChannels)
+{
+	UINTPTR BaseAddress;
+	u32 Index;
+	u8 Channel;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(ChannelPtr != NULL);
+	Xil_AssertVoid(DataPtr != NULL);
+
+	BaseAddress = InstancePtr->Config.BaseAddress;
+
+	for (Index = 0U; Index < NumChannels; Index++) {
+		Channel = ChannelPtr[Index];
+		Xil_AssertVoid((Channel <= XSM_CH_VBRAM) ||
+			       ((Channel >= XSM_CH_VCCPINT) &&
+			       (Channel <= XSM_CH_AUX_MAX)) ||
+			       ((Channel >= XSM_CH_VUSR0) &&
+			       (Channel <= XSM_CH_VUSR3)));
+
+		if (Channel <= XSM_CH_AUX_MAX) {
+			DataPtr[Index] = (u16)XSysMon_ReadReg(BaseAddress,
+					XSM_TEMP_OFFSET + ((u32)Channel << 2));
+		} else {
+			DataPtr[Index] = (u16)XSysMon_ReadReg(BaseAddress,
+					XSM_VUSR0_OFFSET +
+					(((u32)Channel - XSM_CH_VUSR0) << 2));
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function initializes an alarm driven sampler. The sampler is left
+* stopped.
+*
+* @param	SamplerPtr is a pointer to the XSysMon_AlarmSampler.
+* @param	InstancePtr is a pointer to the XSysMon instance.
+* @param	ChannelPtr is the array of channels read when an alarm is
+*		raised.
+* @param	NumChannels is the number of channels, at most
+*		XSM_BATCH_MAX_CHANNELS.
+* @param	FuncPtr is the handler called with the channel data.
+* @param	CallBackRef is passed back to the handler.
+*
+* @return
+*		- XST_SUCCESS if the sampler was initialized.
+*		- XST_INVALID_PARAM if NumChannels is out of range.
+*
+* @note		The alarm thresholds and alarm enables are configured by the
+*		application with XSysMon_SetAlarmThreshold() and
+*		XSysMon_SetAlarmEnables().
+*
+*****************************************************************************/
+int XSysMon_AlarmSamplerInitialize(XSysMon_AlarmSampler *SamplerPtr,
+					XSysMon *InstancePtr,
+					const u8 *ChannelPtr, u32 NumChannels,
+					XSysMon_AlarmHandler FuncPtr,
+					void *CallBackRef)
+{
+	u32 Index;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->Config.IncludeInterrupt == TRUE);
+	Xil_AssertNonvoid(ChannelPtr != NULL);
+	Xil_AssertNonvoid(FuncPtr != NULL);
+
+	if ((NumChannels == 0U) || (NumChannels > XSM_BATCH_MAX_CHANNELS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	SamplerPtr->InstancePtr = InstancePtr;
+	SamplerPtr->IntrMask = 0U;
+	SamplerPtr->NumChannels = NumChannels;
+	for (Index = 0U; Index < NumChannels; Index++) {
+		SamplerPtr->Channel[Index] = ChannelPtr[Index];
+		SamplerPtr->Data[Index] = 0U;
+	}
+	SamplerPtr->Handler = FuncPtr;
+	SamplerPtr->CallBackRef = CallBackRef;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function starts the sampler on a set of alarm interrupts. Stale
+* status of the interrupts is cleared, then the interrupts and the global
+* interrupt are enabled.
+*
+* @param	SamplerPtr is a pointer to the XSysMon_AlarmSampler.
+* @param	IntrMask is the bit-mask of the alarm interrupts to sample on,
+*		formed by OR'ing the alarm and DEACTIVE XSM_IPIXR_* bits.
+*
+* @return	None.
+*
+* @note		XSysMon_AlarmSamplerIntrHandler() must be connected to the
+*		System Monitor interrupt before the sampler is started.
+*
+*****************************************************************************/
+void XSysMon_AlarmSamplerStart(XSysMon_AlarmSampler *SamplerPtr,
+				u32 IntrMask)
+{
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+	Xil_AssertVoid((IntrMask & ~XSM_IPIXR_ALL_MASK) == 0U);
+	Xil_AssertVoid((IntrMask & XSM_SAMPLER_NON_ALARM_MASK) == 0U);
+
+	SamplerPtr->IntrMask = IntrMask;
+
+	XSysMon_IntrClear(SamplerPtr->InstancePtr, IntrMask);
+	XSysMon_IntrEnable(SamplerPtr->InstancePtr, IntrMask);
+	XSysMon_IntrGlobalEnable(SamplerPtr->InstancePtr);
+}
+
+/****************************************************************************/
+/**
+*
+* This function stops the sampler and disables its alarm interrupts. The
+* global interrupt enable is left as is.
+*
+* @param	SamplerPtr is a pointer to the XSysMon_AlarmSampler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XSysMon_AlarmSamplerStop(XSysMon_AlarmSampler *SamplerPtr)
+{
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+
+	XSysMon_IntrDisable(SamplerPtr->InstancePtr, SamplerPtr->IntrMask);
+	XSysMon_IntrClear(SamplerPtr->InstancePtr, SamplerPtr->IntrMask);
+
+	SamplerPtr->IntrMask = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the alarm sampler. It must be
+* connected to the System Monitor interrupt with the XSysMon_AlarmSampler as
+* the callback reference.
+*
+* The raised alarm interrupts are cleared, the sampler channels are read and
+* the handler is called with the interrupts and the data.
+*
+* @param	CallBackRef is a pointer to the XSysMon_AlarmSampler.
+*
+* @return	None.
+*
+* @note		Other System Monitor interrupts are left pending for the
+*		application.
+*
+*****************************************************************************/
+void XSysMon_AlarmSamplerIntrHandler(void *CallBackRef)
+{
+	XSysMon_AlarmSampler *SamplerPtr = (XSysMon_AlarmSampler *)CallBackRef;
+	u32 Status;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+
+	Status = XSysMon_IntrGetStatus(SamplerPtr->InstancePtr) &
+			SamplerPtr->IntrMask;
+	if (Status == 0U) {
+		return;
+	}
+
+	XSysMon_IntrClear(SamplerPtr->InstancePtr, Status);
+
+	XSysMon_GetAdcDataBatch(SamplerPtr->InstancePtr, SamplerPtr->Channel,
+				SamplerPtr->Data, SamplerPtr->NumChannels);
+
+	SamplerPtr->Handler(SamplerPtr->CallBackRef, Status, SamplerPtr->Data);
+}
+/** @} */
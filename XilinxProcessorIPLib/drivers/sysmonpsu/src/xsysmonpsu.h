@@ -102,6 +102,19 @@
 * device in interrupt mode.
 *
 *
+* <b> Streaming </b>
+*
+* XSysMonPsu_StreamInitialize() and XSysMonPsu_StreamStart() put the channel
+* sequencer in continuous mode over a set of channels and capture the results
+* at every end of sequence interrupt. XSysMonPsu_StreamIntrHandler() must be
+* connected to the SYSMON interrupt by the application. It reads all enabled
+* channels, keeps the minimum, maximum and sum of each channel over a
+* programmable number of sequences and then stores a time stamped
+* XSysMonPsu_Snapshot in an application provided power-of-two ring. The
+* snapshots are fetched with XSysMonPsu_StreamRead(). Snapshots that find
+* the ring full are dropped and counted.
+*
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -178,6 +191,8 @@
 *       ms     01/04/18 Provided conditional checks for interrupt example
 *                       in sysmonpsu_header.h
 *       mn     03/08/18 Update Clock Divisor to the proper value
+*       ag     10/14/26 Added continuous sequencer streaming of decimated
+*                       channel snapshots into a ring buffer.
 *
 * </pre>
 *
@@ -414,6 +429,48 @@ typedef struct {
 #define XSM_AMS_CH_OFFSET 0x00000060U
 #define XSM_MIN_MAX_CH_OFFSET 0x00000080U
 
+/* Streaming limits */
+#define XSM_STREAM_MAX_CHANNELS		32U	/**< Max channels in a snapshot */
+#define XSM_STREAM_MAX_DECIMATION	65536U	/**< Max sequences per snapshot */
+
+/**
+ * One decimated record of all streamed channels. Values are raw ADC codes in
+ * the order reported by XSysMonPsu_StreamGetChannel().
+ */
+typedef struct {
+	u64 Timestamp;		/**< XTime_GetTime() at the first sequence */
+	u32 Sequence;		/**< Number of the first sequence */
+	u32 NumSequences;	/**< Sequences decimated into the snapshot */
+	u16 Avg[XSM_STREAM_MAX_CHANNELS];	/**< Average code */
+	u16 Min[XSM_STREAM_MAX_CHANNELS];	/**< Minimum code */
+	u16 Max[XSM_STREAM_MAX_CHANNELS];	/**< Maximum code */
+} XSysMonPsu_Snapshot;
+
+/**
+ * State of the streaming mode. The user allocates a variable of this type
+ * and passes it to the XSysMonPsu_Stream* functions and, as the callback
+ * reference, to XSysMonPsu_StreamIntrHandler(). Head and Tail are free
+ * running indices, the number of snapshots held is Tail - Head.
+ */
+typedef struct {
+	XSysMonPsu *InstancePtr;	/**< Instance being streamed */
+	XSysMonPsu_Snapshot *BufferPtr;	/**< Snapshot ring */
+	u32 Mask;			/**< Ring size - 1 */
+	volatile u32 Head;		/**< Next snapshot to be read */
+	volatile u32 Tail;		/**< Next snapshot to be written */
+	u32 Decimation;			/**< Sequences per snapshot */
+	u32 SysmonBlk;			/**< Sysmon block being streamed */
+	u32 NumChannels;		/**< Channels in a snapshot */
+	u8 Channel[XSM_STREAM_MAX_CHANNELS];	/**< Channel numbers */
+	u32 RegAddr[XSM_STREAM_MAX_CHANNELS];	/**< Data register addresses */
+	u32 Sum[XSM_STREAM_MAX_CHANNELS];	/**< Running sums */
+	XSysMonPsu_Snapshot Pending;	/**< Snapshot being accumulated */
+	u32 SeqCount;			/**< Sequences since start */
+	u32 Dropped;			/**< Snapshots lost to a full ring */
+	XSysMonPsu_Handler Handler;	/**< Called for each new snapshot */
+	void *CallBackRef;		/**< Callback reference for Handler */
+} XSysMonPsu_Stream;
+
 /************************* Variable Definitions ******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -605,6 +662,41 @@ static inline u32 XSysMonPsu_GetEffBaseAddress(u32 BaseAddress, u32 SysmonBlk)
 		return EffBaseAddr;
 	}
 
+/****************************************************************************/
+/**
+*
+* This macro returns the number of snapshots waiting in the stream ring.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream.
+*
+* @return	Number of snapshots that XSysMonPsu_StreamRead() can return.
+*
+* @note		C-Style signature:
+*		u32 XSysMonPsu_StreamGetCount(XSysMonPsu_Stream *StreamPtr)
+*
+*****************************************************************************/
+#define XSysMonPsu_StreamGetCount(StreamPtr) \
+	((StreamPtr)->Tail - (StreamPtr)->Head)
+
+/****************************************************************************/
+/**
+*
+* This macro returns the channel number held at an index of the Avg, Min
+* and Max arrays of the stream snapshots.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream.
+* @param	Index is the snapshot array index, below NumChannels.
+*
+* @return	Channel number (XSM_CH_*).
+*
+* @note		C-Style signature:
+*		u8 XSysMonPsu_StreamGetChannel(XSysMonPsu_Stream *StreamPtr,
+*		u32 Index)
+*
+*****************************************************************************/
+#define XSysMonPsu_StreamGetChannel(StreamPtr, Index) \
+	((StreamPtr)->Channel[(Index)])
+
 /************************** Function Prototypes ******************************/
 
 /* Functions in xsysmonpsu.c */
@@ -663,6 +755,19 @@ u64 XSysMonPsu_IntrGetEnabled(XSysMonPsu *InstancePtr);
 u64 XSysMonPsu_IntrGetStatus(XSysMonPsu *InstancePtr);
 void XSysMonPsu_IntrClear(XSysMonPsu *InstancePtr, u64 Mask);
 
+/* Functions in xsysmonpsu_stream.c */
+s32 XSysMonPsu_StreamInitialize(XSysMonPsu_Stream *StreamPtr,
+		XSysMonPsu *InstancePtr, XSysMonPsu_Snapshot *BufferPtr,
+		u32 NumSnapshots, u32 Decimation);
+void XSysMonPsu_StreamSetHandler(XSysMonPsu_Stream *StreamPtr,
+		XSysMonPsu_Handler FuncPtr, void *CallBackRef);
+s32 XSysMonPsu_StreamStart(XSysMonPsu_Stream *StreamPtr, u64 ChEnableMask,
+		u32 SysmonBlk);
+void XSysMonPsu_StreamStop(XSysMonPsu_Stream *StreamPtr);
+u32 XSysMonPsu_StreamRead(XSysMonPsu_Stream *StreamPtr,
+		XSysMonPsu_Snapshot *SnapshotPtr, u32 NumSnapshots);
+void XSysMonPsu_StreamIntrHandler(void *CallBackRef);
+
 /* Functions in xsysmonpsu_selftest.c */
 s32 XSysMonPsu_SelfTest(XSysMonPsu *InstancePtr);
 
@@ -0,0 +1,494 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsysmonpsu_stream.c
+*
+* This file contains the streaming mode of the XSysMonPsu driver. The channel
+* sequencer runs in continuous mode and XSysMonPsu_StreamIntrHandler() reads
+* every enabled channel at the end of each sequence. The readings are folded
+* into a pending snapshot that keeps the minimum, maximum and sum per channel,
+* and after the programmed number of sequences the snapshot is stored in the
+* ring with the average in place of the sum.
+*
+* The ring is written only by the interrupt handler and read only by
+* XSysMonPsu_StreamRead(), so no locking is needed between the two.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date	Changes
+* ----- -----  -------- -----------------------------------------------
+* 2.3   ag     10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xsysmonpsu.h"
+#include "xtime_l.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XSM_STREAM_NO_CHANNEL	0xFFU	/* Sequence bit without ADC data */
+#define XSM_STREAM_EOS_MASK	((u64)XSYSMONPSU_IER_1_EOS_MASK << \
+					XSYSMONPSU_IXR_1_SHIFT)
+#define XSM_STREAM_SEQ_BITS	38U	/* Bits used in ChEnableMask */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u8 XSysMonPsu_StreamBitToChannel(u32 Bit);
+static void XSysMonPsu_StreamCommit(XSysMonPsu_Stream *StreamPtr);
+
+/************************** Variable Definitions ****************************/
+
+/****************************************************************************/
+/**
+*
+* This function initializes a stream over a SYSMON instance. The stream is
+* left stopped.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream to initialize.
+* @param	InstancePtr is a pointer to the XSysMonPsu instance.
+* @param	BufferPtr is the snapshot ring.
+* @param	NumSnapshots is the number of entries in BufferPtr. It must be
+*		a power of two.
+* @param	Decimation is the number of sequences folded into each
+*		snapshot, 1 to XSM_STREAM_MAX_DECIMATION.
+*
+* @return
+*		- XST_SUCCESS if the stream was initialized.
+*		- XST_INVALID_PARAM if NumSnapshots is not a power of two.
+*
+* @note		None.
+*
+*****************************************************************************/
+s32 XSysMonPsu_StreamInitialize(XSysMonPsu_Stream *StreamPtr,
+		XSysMonPsu *InstancePtr, XSysMonPsu_Snapshot *BufferPtr,
+		u32 NumSnapshots, u32 Decimation)
+{
+	s32 Status;
+
+	/* Assert the arguments. */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid((Decimation != 0U) &&
+			  (Decimation <= XSM_STREAM_MAX_DECIMATION));
+
+	if ((NumSnapshots == 0U) ||
+	    ((NumSnapshots & (NumSnapshots - 1U)) != 0U)) {
+		Status = (s32)XST_INVALID_PARAM;
+	} else {
+		StreamPtr->InstancePtr = InstancePtr;
+		StreamPtr->BufferPtr = BufferPtr;
+		StreamPtr->Mask = NumSnapshots - 1U;
+		StreamPtr->Head = 0U;
+		StreamPtr->Tail = 0U;
+		StreamPtr->Decimation = Decimation;
+		StreamPtr->SysmonBlk = XSYSMON_PS;
+		StreamPtr->NumChannels = 0U;
+		StreamPtr->Pending.NumSequences = 0U;
+		StreamPtr->SeqCount = 0U;
+		StreamPtr->Dropped = 0U;
+		StreamPtr->Handler = NULL;
+		StreamPtr->CallBackRef = NULL;
+		Status = (s32)XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets the handler called by XSysMonPsu_StreamIntrHandler()
+* each time a snapshot has been stored in the ring.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream.
+* @param	FuncPtr is the handler, or NULL for none.
+* @param	CallBackRef is passed back to the handler.
+*
+* @return	None.
+*
+* @note		The handler runs in interrupt context.
+*
+*****************************************************************************/
+void XSysMonPsu_StreamSetHandler(XSysMonPsu_Stream *StreamPtr,
+		XSysMonPsu_Handler FuncPtr, void *CallBackRef)
+{
+	/* Assert the arguments. */
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	StreamPtr->Handler = FuncPtr;
+	StreamPtr->CallBackRef = CallBackRef;
+}
+
+/****************************************************************************/
+/**
+*
+* This function programs the channel sequencer for the given channels, puts
+* it in continuous mode and enables the end of sequence interrupt.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream.
+* @param	ChEnableMask is the 64 bit channel enable mask as taken by
+*		XSysMonPsu_SetSeqChEnables(). Bits without ADC data (the
+*		calibration, test and current monitor bits) are sequenced but
+*		not streamed.
+* @param	SysmonBlk is the value that tells whether it is for PS Sysmon
+*		block or PL Sysmon block register region.
+*
+* @return
+*		- XST_SUCCESS if the stream was started.
+*		- XST_INVALID_PARAM if the mask selects no channel with data.
+*		- XST_FAILURE if the sequencer could not be programmed.
+*
+* @note		Any previous sequencer configuration of the block is replaced.
+*		The data is reported in the order of the mask bits; use
+*		XSysMonPsu_StreamGetChannel() to map an index to a channel.
+*
+*****************************************************************************/
+s32 XSysMonPsu_StreamStart(XSysMonPsu_Stream *StreamPtr, u64 ChEnableMask,
+		u32 SysmonBlk)
+{
+	XSysMonPsu *InstancePtr;
+	u32 EffectiveBaseAddress;
+	u32 NumChannels = 0U;
+	u32 Bit;
+	u8 Channel;
+	s32 Status;
+
+	/* Assert the arguments. */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid((SysmonBlk == XSYSMON_PS)||(SysmonBlk == XSYSMON_PL));
+
+	InstancePtr = StreamPtr->InstancePtr;
+
+	/* Calculate the effective baseaddress based on the Sysmon instance. */
+	EffectiveBaseAddress =
+			XSysMonPsu_GetEffBaseAddress(InstancePtr->Config.BaseAddress,
+					SysmonBlk);
+
+	/* Resolve the data register of every streamed channel once. */
+	for (Bit = 0U; Bit < XSM_STREAM_SEQ_BITS; Bit++) {
+		if ((ChEnableMask & ((u64)1U << Bit)) == 0U) {
+			continue;
+		}
+		Channel = XSysMonPsu_StreamBitToChannel(Bit);
+		if (Channel == XSM_STREAM_NO_CHANNEL) {
+			continue;
+		}
+		StreamPtr->Channel[NumChannels] = Channel;
+		if (Channel <= XSM_CH_AUX_MAX) {
+			StreamPtr->RegAddr[NumChannels] = EffectiveBaseAddress +
+					((u32)Channel << 2U);
+		} else {
+			StreamPtr->RegAddr[NumChannels] = EffectiveBaseAddress +
+					XSM_ADC_CH_OFFSET +
+					(((u32)Channel - XSM_CH_SUPPLY7) << 2U);
+		}
+		NumChannels++;
+	}
+
+	if (NumChannels == 0U) {
+		Status = (s32)XST_INVALID_PARAM;
+		goto End;
+	}
+
+	/* Stop the current sequence before touching the channel enables. */
+	XSysMonPsu_IntrDisable(InstancePtr, XSM_STREAM_EOS_MASK);
+	XSysMonPsu_SetSequencerMode(InstancePtr, XSM_SEQ_MODE_SAFE, SysmonBlk);
+
+	Status = XSysMonPsu_SetSeqChEnables(InstancePtr, ChEnableMask,
+			SysmonBlk);
+	if (Status != (s32)XST_SUCCESS) {
+		goto End;
+	}
+
+	StreamPtr->SysmonBlk = SysmonBlk;
+	StreamPtr->NumChannels = NumChannels;
+	StreamPtr->Pending.NumSequences = 0U;
+	StreamPtr->SeqCount = 0U;
+
+	XSysMonPsu_IntrClear(InstancePtr, XSM_STREAM_EOS_MASK);
+	XSysMonPsu_SetSequencerMode(InstancePtr, XSM_SEQ_MODE_CONTINPASS,
+			SysmonBlk);
+	XSysMonPsu_IntrEnable(InstancePtr, XSM_STREAM_EOS_MASK);
+
+End:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function stops a stream. The end of sequence interrupt is disabled
+* and the sequencer is returned to the safe mode. Snapshots already in the
+* ring can still be read, the partially accumulated one is discarded.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XSysMonPsu_StreamStop(XSysMonPsu_Stream *StreamPtr)
+{
+	/* Assert the arguments. */
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(StreamPtr->InstancePtr != NULL);
+
+	XSysMonPsu_IntrDisable(StreamPtr->InstancePtr, XSM_STREAM_EOS_MASK);
+	XSysMonPsu_SetSequencerMode(StreamPtr->InstancePtr, XSM_SEQ_MODE_SAFE,
+			StreamPtr->SysmonBlk);
+	XSysMonPsu_IntrClear(StreamPtr->InstancePtr, XSM_STREAM_EOS_MASK);
+
+	StreamPtr->Pending.NumSequences = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function copies the oldest snapshots out of the stream ring. It does
+* not block.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream.
+* @param	SnapshotPtr is the destination array.
+* @param	NumSnapshots is the number of entries in SnapshotPtr.
+*
+* @return	The number of snapshots copied.
+*
+* @note		Only the first NumChannels entries of the Avg, Min and Max
+*		arrays are meaningful.
+*
+*****************************************************************************/
+u32 XSysMonPsu_StreamRead(XSysMonPsu_Stream *StreamPtr,
+		XSysMonPsu_Snapshot *SnapshotPtr, u32 NumSnapshots)
+{
+	u32 Head;
+	u32 Count;
+	u32 Index;
+
+	/* Assert the arguments. */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(SnapshotPtr != NULL);
+
+	Head = StreamPtr->Head;
+	Count = StreamPtr->Tail - Head;
+	if (Count > NumSnapshots) {
+		Count = NumSnapshots;
+	}
+
+	/* Order the snapshot reads after the read of Tail */
+	dmb();
+
+	for (Index = 0U; Index < Count; Index++) {
+		SnapshotPtr[Index] =
+			StreamPtr->BufferPtr[(Head + Index) & StreamPtr->Mask];
+	}
+
+	/* Release the entries only after they have been read */
+	dmb();
+	StreamPtr->Head = Head + Count;
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the streaming mode. It must be
+* connected to the SYSMON interrupt with the XSysMonPsu_Stream as the
+* callback reference.
+*
+* At the end of each sequence all streamed channels are read and folded into
+* the pending snapshot. Once the snapshot holds Decimation sequences it is
+* stored in the ring, or counted in Dropped if the ring is full.
+*
+* @param	CallBackRef is a pointer to the XSysMonPsu_Stream.
+*
+* @return	None.
+*
+* @note		Other SYSMON interrupts are left pending for the application.
+*
+*****************************************************************************/
+void XSysMonPsu_StreamIntrHandler(void *CallBackRef)
+{
+	XSysMonPsu_Stream *StreamPtr = (XSysMonPsu_Stream *)CallBackRef;
+	XSysMonPsu_Snapshot *PendingPtr;
+	u32 BaseAddress;
+	u32 Index;
+	u16 Data;
+	XTime Now;
+
+	/* Assert the arguments. */
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(StreamPtr->InstancePtr != NULL);
+
+	BaseAddress = StreamPtr->InstancePtr->Config.BaseAddress;
+
+	if ((XSysmonPsu_ReadReg(BaseAddress + XSYSMONPSU_ISR_1_OFFSET) &
+	     XSYSMONPSU_ISR_1_EOS_MASK) == 0U) {
+		return;
+	}
+	XSysmonPsu_WriteReg(BaseAddress + XSYSMONPSU_ISR_1_OFFSET,
+			XSYSMONPSU_ISR_1_EOS_MASK);
+
+	PendingPtr = &StreamPtr->Pending;
+
+	if (PendingPtr->NumSequences == 0U) {
+		XTime_GetTime(&Now);
+		PendingPtr->Timestamp = (u64)Now;
+		PendingPtr->Sequence = StreamPtr->SeqCount;
+		for (Index = 0U; Index < StreamPtr->NumChannels; Index++) {
+			Data = (u16)XSysmonPsu_ReadReg(StreamPtr->RegAddr[Index]);
+			PendingPtr->Min[Index] = Data;
+			PendingPtr->Max[Index] = Data;
+			StreamPtr->Sum[Index] = (u32)Data;
+		}
+	} else {
+		for (Index = 0U; Index < StreamPtr->NumChannels; Index++) {
+			Data = (u16)XSysmonPsu_ReadReg(StreamPtr->RegAddr[Index]);
+			if (Data < PendingPtr->Min[Index]) {
+				PendingPtr->Min[Index] = Data;
+			}
+			if (Data > PendingPtr->Max[Index]) {
+				PendingPtr->Max[Index] = Data;
+			}
+			StreamPtr->Sum[Index] += (u32)Data;
+		}
+	}
+
+	StreamPtr->SeqCount++;
+	PendingPtr->NumSequences++;
+
+	if (PendingPtr->NumSequences >= StreamPtr->Decimation) {
+		XSysMonPsu_StreamCommit(StreamPtr);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function stores the pending snapshot in the ring with the rounded
+* average of each channel, then starts a new pending snapshot.
+*
+* @param	StreamPtr is a pointer to the XSysMonPsu_Stream.
+*
+* @return	None.
+*
+* @note		Called from XSysMonPsu_StreamIntrHandler() only.
+*
+*****************************************************************************/
+static void XSysMonPsu_StreamCommit(XSysMonPsu_Stream *StreamPtr)
+{
+	XSysMonPsu_Snapshot *PendingPtr = &StreamPtr->Pending;
+	XSysMonPsu_Snapshot *SlotPtr;
+	u32 NumSequences = PendingPtr->NumSequences;
+	u32 Tail = StreamPtr->Tail;
+	u32 Index;
+
+	PendingPtr->NumSequences = 0U;
+
+	if ((Tail - StreamPtr->Head) > StreamPtr->Mask) {
+		StreamPtr->Dropped++;
+		return;
+	}
+
+	/* Order the snapshot writes after the read of Head */
+	dmb();
+
+	SlotPtr = &StreamPtr->BufferPtr[Tail & StreamPtr->Mask];
+	SlotPtr->Timestamp = PendingPtr->Timestamp;
+	SlotPtr->Sequence = PendingPtr->Sequence;
+	SlotPtr->NumSequences = NumSequences;
+	for (Index = 0U; Index < StreamPtr->NumChannels; Index++) {
+		SlotPtr->Avg[Index] = (u16)((StreamPtr->Sum[Index] +
+				(NumSequences >> 1U)) / NumSequences);
+		SlotPtr->Min[Index] = PendingPtr->Min[Index];
+		SlotPtr->Max[Index] = PendingPtr->Max[Index];
+	}
+
+	/* Publish the snapshot before the new Tail */
+	dmb();
+	StreamPtr->Tail = Tail + 1U;
+
+	if (StreamPtr->Handler != NULL) {
+		StreamPtr->Handler(StreamPtr->CallBackRef);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function maps a bit of the sequencer channel enable mask to the
+* channel number of its data register.
+*
+* @param	Bit is the bit position in the 64 bit channel enable mask.
+*
+* @return	The channel number, or XSM_STREAM_NO_CHANNEL if the bit has
+*		no converted data.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u8 XSysMonPsu_StreamBitToChannel(u32 Bit)
+{
+	u8 Channel;
+
+	if ((Bit >= XSYSMONPSU_SEQ_CH0_SUP4_SHIFT) &&
+	    (Bit <= XSYSMONPSU_SEQ_CH0_SUP6_SHIFT)) {
+		/* SUPPLY4..SUPPLY6 */
+		Channel = (u8)(Bit - XSYSMONPSU_SEQ_CH0_SUP4_SHIFT +
+				XSM_CH_SUPPLY4);
+	} else if ((Bit >= XSYSMONPSU_SEQ_CH0_TEMP_SHIFT) &&
+		   (Bit <= XSYSMONPSU_SEQ_CH0_SUP3_SHIFT)) {
+		/* Temperature, SUPPLY1..3, VP/VN, VREFP and VREFN */
+		Channel = (u8)(Bit - XSYSMONPSU_SEQ_CH0_TEMP_SHIFT);
+	} else if (Bit >= XSM_SEQ_CH_SHIFT) {
+		/* Auxiliary channels and SUPPLY7..Temperature Remote */
+		Channel = (u8)Bit;
+	} else {
+		Channel = XSM_STREAM_NO_CHANNEL;
+	}
+
+	return Channel;
+}
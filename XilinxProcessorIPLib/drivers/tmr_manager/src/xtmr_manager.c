@@ -45,6 +45,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.0   sa   04/05/17 First release
+* 1.1   ag   10/14/26 Initialize checkpoint region state.
 * </pre>
 *
 *****************************************************************************/
@@ -143,6 +144,11 @@ int XTMR_Manager_CfgInitialize(XTMR_Manager *InstancePtr, XTMR_Manager_Config *C
 	InstancePtr->RecoveryHandler = NULL;
 	InstancePtr->PostResetHandler = NULL;
 
+	InstancePtr->RegionCount = 0;
+	InstancePtr->DirtyMask = 0;
+	InstancePtr->ValidMask = 0;
+	InstancePtr->RestoredMask = 0;
+
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
 	InstancePtr->RegBaseAddress = EffectiveAddr;
@@ -65,6 +65,20 @@
 *     with address translation, the provided virtual memory base address
 *     replaces the physical address present in the configuration structure.
 *
+* <b>Incremental Checkpoint</b>
+*
+* Application data regions can be registered with a checkpoint buffer in
+* BRAM using XTMR_Manager_RegisterRegion(). The application marks a region
+* dirty with XTMR_Manager_MarkDirty() after modifying it, and periodically
+* calls XTMR_Manager_Checkpoint(), which copies only the dirty regions.
+* When fast resynchronize is enabled with XTMR_Manager_SetFastResync(), the
+* recovery break writes back only the saved context and driver state, and
+* invalidates the rest of a write-back data cache instead of flushing it.
+* Regions modified since their last checkpoint are restored from BRAM after
+* the recovery reset, and the post-reset handler can query them with
+* XTMR_Manager_GetRestoredRegions(). Data outside the registered regions
+* that is only held in the data cache is lost in this mode.
+*
 * <b>RTOS Independence</b>
 *
 * This driver is intended to be RTOS and processor independent.  It works
@@ -85,6 +99,8 @@
 * 1.0   sa   04/05/17 First release
 *       ms   03/17/17 Added readme.txt file in examples folder for doxygen
 *                     generation.
+* 1.1   ag   10/14/26 Added incremental checkpoint of registered regions
+*                     and fast resynchronize recovery.
 * </pre>
 *
 *****************************************************************************/
@@ -104,6 +120,11 @@ extern "C" {
 
 /************************** Constant Definitions ****************************/
 
+/**
+ * Maximum number of regions that can be registered for checkpointing
+ */
+#define XTM_MAX_CHECKPOINT_REGIONS	8U
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -119,8 +140,19 @@ typedef void (*XTMR_Manager_Handler)(void *CallBackRef);
 typedef struct {
 	u32 InterruptCount;		/**< Number of SEM interrupts */
 	u32 RecoveryCount;		/**< Number of recoveries performed */
+	u32 CheckpointCount;		/**< Number of regions checkpointed */
+	u32 RestoreCount;		/**< Number of regions restored */
 } XTMR_Manager_Stats;
 
+/**
+ * Application data region registered for checkpointing
+ */
+typedef struct {
+	UINTPTR Addr;			/**< Start of the region */
+	u32 Size;			/**< Size of the region in bytes */
+	UINTPTR CheckpointAddr;		/**< Checkpoint buffer in BRAM */
+} XTMR_Manager_Region;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -176,6 +208,12 @@ typedef struct {
 
 	XTMR_Manager_Handler Handler;
 	void *CallBackRef;		/* Callback ref for handler */
+
+	XTMR_Manager_Region Regions[XTM_MAX_CHECKPOINT_REGIONS];
+	u32 RegionCount;		/* Number of registered regions */
+	u32 DirtyMask;			/* Regions modified since checkpoint */
+	u32 ValidMask;			/* Regions with a valid checkpoint */
+	u32 RestoredMask;		/* Regions restored by last recovery */
 } XTMR_Manager;
 
 
@@ -212,6 +250,17 @@ void XTMR_Manager_SetPostResetHandler(XTMR_Manager *InstancePtr,
 				      XTMR_Manager_Handler FuncPtr,
 				      void *CallBackRef);
 
+/*
+ * Functions for incremental checkpoint, in file xtmr_manager_checkpoint.c
+ */
+int XTMR_Manager_RegisterRegion(XTMR_Manager *InstancePtr, UINTPTR Addr,
+				u32 Size, UINTPTR CheckpointAddr,
+				u32 *RegionIdPtr);
+void XTMR_Manager_MarkDirty(XTMR_Manager *InstancePtr, u32 RegionId);
+u32 XTMR_Manager_Checkpoint(XTMR_Manager *InstancePtr);
+void XTMR_Manager_SetFastResync(XTMR_Manager *InstancePtr, u32 Enable);
+u32 XTMR_Manager_GetRestoredRegions(XTMR_Manager *InstancePtr);
+
 /*
  * Functions for internal watchdog, in file xtmr_manager_wdog.c
  */
@@ -0,0 +1,336 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xtmr_manager_checkpoint.c
+* @addtogroup tmr_manager_v1_0
+* @{
+*
+* This file contains the incremental checkpoint and fast resynchronize
+* functions for the TMR Manager component (XTMR_Manager).
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.1   ag   10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <string.h>
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+#include "xtmr_manager.h"
+#include "xtmr_manager_i.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Size of the reset and break vectors patched by _xtmr_manager_initialize */
+#define XTM_VECTORS_SIZE	0x1C
+
+/**************************** Type Definitions ******************************/
+
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+
+/************************** Variable Definitions ****************************/
+
+extern u32 XTMR_Manager_ColdResetVector[2];
+extern u32 XTMR_Manager_StackPointer;
+extern XTMR_Manager *XTMR_Manager_InstancePtr;
+
+/* Top of stack, defined by the linker script */
+extern char _stack[];
+
+/************************** Function Prototypes *****************************/
+
+
+/****************************************************************************/
+/**
+*
+* Register an application data region for incremental checkpointing. The
+* checkpoint buffer must be at least Size bytes, and should be located in
+* BRAM so that it is not affected by a recovery.
+*
+* @param	InstancePtr is a pointer to the XTMR_Manager instance.
+* @param	Addr is the start address of the region.
+* @param	Size is the size of the region in bytes.
+* @param	CheckpointAddr is the start address of the checkpoint buffer.
+* @param	RegionIdPtr is a pointer to where the region identifier is
+*		returned, to be used with XTMR_Manager_MarkDirty().
+*
+* @return
+*		- XST_SUCCESS if the region was registered.
+*		- XST_FAILURE if all regions are already in use.
+*
+* @note		The region is initially dirty without a valid checkpoint,
+*		so it is not restored until XTMR_Manager_Checkpoint() has
+*		been called.
+*
+****************************************************************************/
+int XTMR_Manager_RegisterRegion(XTMR_Manager *InstancePtr, UINTPTR Addr,
+				u32 Size, UINTPTR CheckpointAddr,
+				u32 *RegionIdPtr)
+{
+	XTMR_Manager_Region *RegionPtr;
+	u32 RegionId;
+
+	/*
+	 * Assert validates the input arguments
+	 */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Size != 0);
+	Xil_AssertNonvoid(RegionIdPtr != NULL);
+
+	if (InstancePtr->RegionCount >= XTM_MAX_CHECKPOINT_REGIONS)
+		return XST_FAILURE;
+
+	RegionId = InstancePtr->RegionCount;
+	RegionPtr = &InstancePtr->Regions[RegionId];
+	RegionPtr->Addr = Addr;
+	RegionPtr->Size = Size;
+	RegionPtr->CheckpointAddr = CheckpointAddr;
+
+	InstancePtr->DirtyMask |= (1 << RegionId);
+	InstancePtr->ValidMask &= ~(1 << RegionId);
+	InstancePtr->RegionCount++;
+
+	*RegionIdPtr = RegionId;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Mark a registered region as modified since the last checkpoint.
+*
+* @param	InstancePtr is a pointer to the XTMR_Manager instance.
+* @param	RegionId is the identifier returned when registering.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void XTMR_Manager_MarkDirty(XTMR_Manager *InstancePtr, u32 RegionId)
+{
+	/*
+	 * Assert validates the input arguments
+	 */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(RegionId < InstancePtr->RegionCount);
+
+	InstancePtr->DirtyMask |= (1 << RegionId);
+}
+
+/****************************************************************************/
+/**
+*
+* Checkpoint all dirty regions to their checkpoint buffers. Regions that
+* have not been marked dirty since their last checkpoint are skipped.
+*
+* @param	InstancePtr is a pointer to the XTMR_Manager instance.
+*
+* @return	The number of regions that were checkpointed.
+*
+* @note		The region is written back to memory before its previous
+*		checkpoint is invalidated, so that a recovery at any point
+*		leaves either the region or its checkpoint consistent.
+*		The application must not modify the regions while this
+*		function is running.
+*
+****************************************************************************/
+u32 XTMR_Manager_Checkpoint(XTMR_Manager *InstancePtr)
+{
+	XTMR_Manager_Region *RegionPtr;
+	u32 RegionId;
+	u32 Count = 0;
+
+	/*
+	 * Assert validates the input arguments
+	 */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	for (RegionId = 0; RegionId < InstancePtr->RegionCount; RegionId++) {
+		if ((InstancePtr->DirtyMask & (1 << RegionId)) == 0)
+			continue;
+
+		RegionPtr = &InstancePtr->Regions[RegionId];
+		Xil_DCacheFlushRange(RegionPtr->Addr, RegionPtr->Size);
+
+		InstancePtr->ValidMask &= ~(1 << RegionId);
+		memcpy((void *)RegionPtr->CheckpointAddr,
+		       (void *)RegionPtr->Addr, RegionPtr->Size);
+		Xil_DCacheFlushRange(RegionPtr->CheckpointAddr,
+				     RegionPtr->Size);
+		InstancePtr->ValidMask |= (1 << RegionId);
+		InstancePtr->DirtyMask &= ~(1 << RegionId);
+
+		InstancePtr->Stats.CheckpointCount++;
+		Count++;
+	}
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* Enable or disable fast resynchronize. When enabled, a recovery does not
+* flush the data cache, and regions modified since their last checkpoint
+* are restored after the recovery reset.
+*
+* @param	InstancePtr is a pointer to the XTMR_Manager instance.
+* @param	Enable is 1 to enable fast resynchronize and 0 to disable it.
+*
+* @return	None.
+*
+* @note		Only has an effect with a write-back data cache. All data
+*		that must survive a recovery has to be inside registered
+*		regions, or be written back by the pre-reset handler.
+*
+****************************************************************************/
+void XTMR_Manager_SetFastResync(XTMR_Manager *InstancePtr, u32 Enable)
+{
+	/*
+	 * Assert validates the input arguments
+	 */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	XTMR_Manager_FastResync = (Enable != 0) ? 1 : 0;
+}
+
+/****************************************************************************/
+/**
+*
+* Get the regions restored from their checkpoint by the last recovery.
+*
+* @param	InstancePtr is a pointer to the XTMR_Manager instance.
+*
+* @return	Mask with bit n set if region n was restored.
+*
+* @note		Intended to be called from the post-reset handler, to redo
+*		work done on the restored regions after their checkpoint.
+*
+****************************************************************************/
+u32 XTMR_Manager_GetRestoredRegions(XTMR_Manager *InstancePtr)
+{
+	/*
+	 * Assert validates the input arguments
+	 */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	return InstancePtr->RestoredMask;
+}
+
+/****************************************************************************/
+/**
+*
+* Write back the state needed to resume after a recovery reset: the driver
+* variables, the instance, the reset and break vectors, and the stack from
+* the saved context to the top of the stack.
+*
+* @param	InstancePtr is a pointer to the XTMR_Manager instance.
+*
+* @return	None.
+*
+* @note		Called from break vector with fast resynchronize enabled,
+*		before the data cache is invalidated.
+*
+****************************************************************************/
+void XTMR_Manager_FastResyncBreak(XTMR_Manager *InstancePtr)
+{
+	Xil_DCacheFlushRange((UINTPTR)XTMR_Manager_ColdResetVector,
+			     sizeof(XTMR_Manager_ColdResetVector));
+	Xil_DCacheFlushRange((UINTPTR)&XTMR_Manager_StackPointer, sizeof(u32));
+	Xil_DCacheFlushRange((UINTPTR)&XTMR_Manager_InstancePtr,
+			     sizeof(XTMR_Manager *));
+	Xil_DCacheFlushRange((UINTPTR)&XTMR_Manager_FastResync, sizeof(u32));
+	Xil_DCacheFlushRange((UINTPTR)InstancePtr, sizeof(XTMR_Manager));
+	Xil_DCacheFlushRange(XPAR_MICROBLAZE_BASE_VECTORS, XTM_VECTORS_SIZE);
+	Xil_DCacheFlushRange(XTMR_Manager_StackPointer,
+			     (UINTPTR)_stack - XTMR_Manager_StackPointer);
+}
+
+/****************************************************************************/
+/**
+*
+* Restore the regions modified since their last checkpoint, and record them
+* for XTMR_Manager_GetRestoredRegions().
+*
+* @param	InstancePtr is a pointer to the XTMR_Manager instance.
+*
+* @return	None.
+*
+* @note		Called from the reset handler with fast resynchronize enabled.
+*		Dirty regions without a valid checkpoint are left dirty.
+*
+****************************************************************************/
+void XTMR_Manager_RestoreRegions(XTMR_Manager *InstancePtr)
+{
+	XTMR_Manager_Region *RegionPtr;
+	u32 RestoreMask;
+	u32 RegionId;
+
+	RestoreMask = InstancePtr->DirtyMask & InstancePtr->ValidMask;
+
+	for (RegionId = 0; RegionId < InstancePtr->RegionCount; RegionId++) {
+		if ((RestoreMask & (1 << RegionId)) == 0)
+			continue;
+
+		RegionPtr = &InstancePtr->Regions[RegionId];
+		memcpy((void *)RegionPtr->Addr,
+		       (void *)RegionPtr->CheckpointAddr, RegionPtr->Size);
+		InstancePtr->Stats.RestoreCount++;
+	}
+
+	InstancePtr->DirtyMask &= ~RestoreMask;
+	InstancePtr->RestoredMask = RestoreMask;
+}
+
+
+/** @} */
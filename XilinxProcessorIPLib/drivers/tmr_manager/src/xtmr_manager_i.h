@@ -45,6 +45,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.0   sa   04/05/17 First release
+* 1.1   ag   10/14/26 Added fast resynchronize recovery functions.
 * </pre>
 *
 *****************************************************************************/
@@ -96,8 +97,14 @@ extern "C" {
 /* the configuration table */
 extern XTMR_Manager_Config XTMR_Manager_ConfigTable[];
 
+/* Fast resynchronize flag, read by the break handler in assembler */
+extern u32 XTMR_Manager_FastResync;
+
 /************************** Function Prototypes *****************************/
 
+void XTMR_Manager_FastResyncBreak(XTMR_Manager *InstancePtr);
+void XTMR_Manager_RestoreRegions(XTMR_Manager *InstancePtr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,6 +45,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.0   sa   04/05/17 First release
+* 1.1   ag   10/14/26 Added fast resynchronize recovery.
 * </pre>
 *
 *****************************************************************************/
@@ -55,7 +56,7 @@
 #include "xil_assert.h"
 #include "xstatus.h"
 #include "xtmr_manager.h"
-#include "xtmr_manager_l.h"
+#include "xtmr_manager_i.h"
 #include "xil_io.h"
 #include "xparameters.h"
 
@@ -82,7 +83,6 @@ extern XTMR_Manager *XTMR_Manager_InstancePtr;
 * Break occurred signalling that a recovery should be performed. Call the
 * prerecovery user handler, and then suspend the processor, to signal to
 * the TMR Manager hardware that it should reset the TMR sub-system.
-*
 * @param	InstancePtr is a pointer to the XTMR_Manager instance.
 *
 * @return	None.
@@ -151,6 +151,10 @@ int XTMR_Manager_ResetHandler (XTMR_Manager *InstancePtr)
 	if (rec_reset) {
 		/* Treat as recovery reset: Handle recovery */
 
+		/* Roll back regions modified since the last checkpoint */
+		if (XTMR_Manager_FastResync)
+			XTMR_Manager_RestoreRegions(InstancePtr);
+
 		/* Call user defined postrecovery handler, if any */
 		if (InstancePtr->PostResetHandler != NULL)
 			InstancePtr->PostResetHandler(
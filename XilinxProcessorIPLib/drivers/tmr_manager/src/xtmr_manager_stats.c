@@ -45,6 +45,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.0   sa   04/05/17 First release
+* 1.1   ag   10/14/26 Added checkpoint and restore counts.
 * </pre>
 *
 *****************************************************************************/
@@ -98,6 +99,8 @@ void XTMR_Manager_GetStats(XTMR_Manager *InstancePtr, XTMR_Manager_Stats *StatsP
 
 	StatsPtr->InterruptCount = InstancePtr->Stats.InterruptCount;
 	StatsPtr->RecoveryCount = InstancePtr->Stats.RecoveryCount;
+	StatsPtr->CheckpointCount = InstancePtr->Stats.CheckpointCount;
+	StatsPtr->RestoreCount = InstancePtr->Stats.RestoreCount;
 }
 
 /****************************************************************************/
@@ -122,6 +125,8 @@ void XTMR_Manager_ClearStats(XTMR_Manager *InstancePtr)
 
 	InstancePtr->Stats.InterruptCount = 0;
 	InstancePtr->Stats.RecoveryCount = 0;
+	InstancePtr->Stats.CheckpointCount = 0;
+	InstancePtr->Stats.RestoreCount = 0;
 }
 
 /** @} */
@@ -0,0 +1,636 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xtrafgen_pmon_benchmark_example.c
+ *
+ * This file contains a memory subsystem benchmark built from the AXI Traffic
+ * Generator and the AXI Performance Monitor drivers.
+ *
+ * For each entry of the test table the traffic generator command RAM is
+ * programmed with a list of read, write or mixed (read and write queues
+ * running concurrently) bursts of a given length, spaced by a given stride
+ * and driven with a given QoS value. The list is run several times against
+ * the target memory while the performance monitor slot attached to that
+ * memory counts bytes, transactions and latencies. The results of all tests
+ * are printed as one table:
+ *
+ * <pre>
+ * Memory Pattern Burst Stride Cmds QoS WrMB/s RdMB/s WrLat(avg/max) ...
+ * </pre>
+ *
+ * Bandwidth is derived from the performance monitor global clock counter,
+ * so APM_CLOCK_FREQ_HZ must be set to the frequency of the monitor clock.
+ * Latencies are reported in monitor clock cycles.
+ *
+ * @note
+ *
+ * The performance monitor must be built in Advanced mode with at least eight
+ * metric counters, and the slots listed in the memory table must monitor
+ * the traffic generator path to each memory.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 4.2   ag   10/14/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+
+/***************************** Include Files *********************************/
+#include "xtrafgen.h"
+#include "xaxipmon.h"
+#include "xparameters.h"
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * Memory under test and the performance monitor slot watching it
+ */
+typedef struct {
+	const char *Name;	/* Name printed in the result table */
+	UINTPTR BaseAddr;	/* Start of the region used by the tests */
+	u32 Size;		/* Size of the region in bytes */
+	u8 Slot;		/* APM slot monitoring this memory */
+} BenchMemory;
+
+/*
+ * One benchmark run
+ */
+typedef struct {
+	u8 Memory;		/* Index into the memory table */
+	u8 Pattern;		/* BENCH_READ, BENCH_WRITE or BENCH_MIXED */
+	u16 BurstLen;		/* Beats per burst, 1 to 256 */
+	u32 Stride;		/* Address increment between bursts */
+	u16 NumCmds;		/* Bursts per queue per iteration */
+	u8 Qos;			/* Value driven on the a*_qos lines */
+} BenchTest;
+
+/*
+ * Counters collected for one benchmark run
+ */
+typedef struct {
+	u64 Cycles;		/* APM clock cycles of the measurement */
+	u32 WrBytes;		/* Write byte count */
+	u32 RdBytes;		/* Read byte count */
+	u32 WrTrans;		/* Write transaction count */
+	u32 RdTrans;		/* Read transaction count */
+	u32 WrLatTotal;		/* Total write latency */
+	u32 RdLatTotal;		/* Total read latency */
+	u32 WrLatMax;		/* Maximum write latency */
+	u32 RdLatMax;		/* Maximum read latency */
+} BenchResult;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define TRAFGEN_DEV_ID	XPAR_XTRAFGEN_0_DEVICE_ID
+#define AXIPMON_DEV_ID	XPAR_AXIPMON_0_DEVICE_ID
+
+#ifdef XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#elif XPAR_PS7_DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_PS7_DDR_0_S_AXI_BASEADDR
+#elif XPAR_MIG7SERIES_0_BASEADDR
+#define DDR_BASE_ADDR	XPAR_MIG7SERIES_0_BASEADDR
+#endif
+
+#ifndef DDR_BASE_ADDR
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define MEM_BASE_ADDR	0x01000000
+#else
+#define MEM_BASE_ADDR	(DDR_BASE_ADDR + 0x1000000)
+#endif
+
+#ifndef APM_CLOCK_FREQ_HZ
+#define APM_CLOCK_FREQ_HZ	100000000	/* Monitor clock, in Hz */
+#endif
+
+#define DDR_APM_SLOT		0	/* APM slot monitoring DDR */
+#define PL_APM_SLOT		1	/* APM slot monitoring PL memory */
+
+#define BENCH_READ		0x1	/* Read queue only */
+#define BENCH_WRITE		0x2	/* Write queue only */
+#define BENCH_MIXED		(BENCH_READ | BENCH_WRITE)
+
+#define BENCH_ITERATIONS	16	/* Command list runs per test */
+#define BENCH_TIMEOUT		0x1000000 /* Polls per command list run */
+
+#define BENCH_WR_MSTRAM_INDEX	0x0	/* Master RAM source of writes */
+#define BENCH_RD_MSTRAM_INDEX	0x1000	/* Master RAM sink of reads */
+
+#define BENCH_NUM_COUNTERS	8	/* Metric counters used */
+
+/************************** Function Prototypes ******************************/
+int XTrafGenPmonBenchmark(XTrafGen *TrafGenPtr, u16 TrafGenDeviceId,
+			XAxiPmon *AxiPmonPtr, u16 AxiPmonDeviceId);
+static int BenchProgram(XTrafGen *TrafGenPtr, const BenchTest *TestPtr);
+static int BenchRun(XTrafGen *TrafGenPtr, XAxiPmon *AxiPmonPtr,
+			const BenchTest *TestPtr, BenchResult *ResultPtr);
+static void BenchPrintHeader(void);
+static void BenchPrintResult(const BenchTest *TestPtr,
+			const BenchResult *ResultPtr);
+static u32 BenchMBps(u32 Bytes, u64 Cycles);
+static void InitDefaultCommands(XTrafGen_Cmd *CmdPtr);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device instance definitions
+ */
+XTrafGen XTrafGenInstance;
+XAxiPmon AxiPmonInstance;
+
+/*
+ * Memories under test
+ */
+static const BenchMemory BenchMemories[] = {
+	{"DDR", MEM_BASE_ADDR, 0x100000, DDR_APM_SLOT},
+#ifdef XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR
+	{"PL-BRAM", XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR,
+		XPAR_AXI_BRAM_CTRL_0_S_AXI_HIGHADDR -
+		XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR + 1, PL_APM_SLOT},
+#endif
+};
+
+/*
+ * Test table: Memory, Pattern, BurstLen, Stride, NumCmds, Qos
+ */
+static const BenchTest BenchTests[] = {
+	{0, BENCH_WRITE,   1,    8, 255, 0x0},
+	{0, BENCH_WRITE,  16,  128, 255, 0x0},
+	{0, BENCH_WRITE, 256, 2048, 255, 0x0},
+	{0, BENCH_READ,    1,    8, 255, 0x0},
+	{0, BENCH_READ,   16,  128, 255, 0x0},
+	{0, BENCH_READ,  256, 2048, 255, 0x0},
+	{0, BENCH_READ,   16, 4096, 255, 0x0},
+	{0, BENCH_MIXED,  16,  128, 255, 0x0},
+	{0, BENCH_MIXED,  16,  128, 255, 0xF},
+	{0, BENCH_MIXED, 256, 2048, 255, 0xF},
+#ifdef XPAR_AXI_BRAM_CTRL_0_S_AXI_BASEADDR
+	{1, BENCH_WRITE,  16,  128,  64, 0x0},
+	{1, BENCH_READ,   16,  128,  64, 0x0},
+	{1, BENCH_MIXED,  16,  128,  64, 0x0},
+#endif
+};
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry of the memory subsystem benchmark.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if all tests ran
+*		- XST_FAILURE if a test failed to run.
+*
+* @note		None.
+*
+******************************************************************************/
+int main()
+{
+	int Status;
+
+	xil_printf("Entering main\n\r");
+
+	Status = XTrafGenPmonBenchmark(&XTrafGenInstance, TRAFGEN_DEV_ID,
+					&AxiPmonInstance, AXIPMON_DEV_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Traffic Generator Benchmark Example Failed\n\r");
+		xil_printf("--- Exiting main() ---\n\r");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran Traffic Generator Benchmark Example\n\r");
+	xil_printf("--- Exiting main() ---\n\r");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs every entry of the test table and prints the results.
+* It does the following:
+*	- Initialize the AXI Traffic Generator and AXI Performance Monitor
+*	- For each test, program the command list and assign the metric
+*	  counters to the slot of the memory under test
+*	- Run the command list BENCH_ITERATIONS times while counting
+*	- Print one row of the result table
+*
+* @param	TrafGenPtr is a pointer to the XTrafGen instance.
+* @param	TrafGenDeviceId is the XPAR_<TRAFGEN_instance>_DEVICE_ID
+*		value from xparameters.h.
+* @param	AxiPmonPtr is a pointer to the XAxiPmon instance.
+* @param	AxiPmonDeviceId is the XPAR_<AXIPMON_instance>_DEVICE_ID
+*		value from xparameters.h.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+******************************************************************************/
+int XTrafGenPmonBenchmark(XTrafGen *TrafGenPtr, u16 TrafGenDeviceId,
+			XAxiPmon *AxiPmonPtr, u16 AxiPmonDeviceId)
+{
+	XTrafGen_Config *TrafGenConfig;
+	XAxiPmon_Config *AxiPmonConfig;
+	BenchResult Result;
+	u32 Index;
+	int Status;
+
+	TrafGenConfig = XTrafGen_LookupConfig(TrafGenDeviceId);
+	if (!TrafGenConfig) {
+		xil_printf("No config found for %d\r\n", TrafGenDeviceId);
+		return XST_FAILURE;
+	}
+
+	Status = XTrafGen_CfgInitialize(TrafGenPtr, TrafGenConfig,
+					TrafGenConfig->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Traffic Generator initialization failed\n\r");
+		return Status;
+	}
+
+	if (TrafGenPtr->OperatingMode != XTG_MODE_FULL) {
+		xil_printf("Traffic Generator is not in Full (Advanced) mode\n\r");
+		return XST_FAILURE;
+	}
+
+	AxiPmonConfig = XAxiPmon_LookupConfig(AxiPmonDeviceId);
+	if (AxiPmonConfig == NULL) {
+		xil_printf("No config found for %d\r\n", AxiPmonDeviceId);
+		return XST_FAILURE;
+	}
+
+	XAxiPmon_CfgInitialize(AxiPmonPtr, AxiPmonConfig,
+				AxiPmonConfig->BaseAddress);
+
+	if ((AxiPmonConfig->ModeAdvanced != 1) ||
+	    (AxiPmonConfig->NumberofCounters < BENCH_NUM_COUNTERS)) {
+		xil_printf("Performance Monitor needs Advanced mode with "
+			"%d counters\n\r", BENCH_NUM_COUNTERS);
+		return XST_FAILURE;
+	}
+
+	/* Known data for the write bursts to carry */
+	for (Index = 0; Index < BENCH_RD_MSTRAM_INDEX; Index += 4) {
+		u32 Data = 0xA5A50000 | Index;
+
+		XTrafGen_AccessMasterRam(TrafGenPtr, BENCH_WR_MSTRAM_INDEX +
+					Index, 4, XTG_WRITE, &Data);
+	}
+
+	BenchPrintHeader();
+
+	for (Index = 0; Index < sizeof(BenchTests) / sizeof(BenchTests[0]);
+								Index++) {
+		Status = BenchRun(TrafGenPtr, AxiPmonPtr, &BenchTests[Index],
+					&Result);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Test %d failed\n\r", Index);
+			return XST_FAILURE;
+		}
+
+		BenchPrintResult(&BenchTests[Index], &Result);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Program the traffic generator command RAM for one test. Each queue used by
+* the pattern gets NumCmds bursts at BaseAddr, BaseAddr + Stride, ...
+* followed by an invalid command ending the queue. The commands carry no
+* dependencies, so read and write queues of a mixed test run concurrently.
+*
+* @param	TrafGenPtr is a pointer to the XTrafGen instance.
+* @param	TestPtr is the test to program.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE if the test does not fit the memory or the
+*		 command RAM
+*
+******************************************************************************/
+static int BenchProgram(XTrafGen *TrafGenPtr, const BenchTest *TestPtr)
+{
+	const BenchMemory *MemPtr = &BenchMemories[TestPtr->Memory];
+	XTrafGen_Cmd Cmd;
+	u32 BeatSize;
+	u32 BurstBytes;
+	u32 Pass;
+	u32 Index;
+	int Status;
+
+	BeatSize = (TrafGenPtr->MasterWidth == XTG_MWIDTH_64) ? 3 : 2;
+	BurstBytes = (u32)TestPtr->BurstLen << BeatSize;
+
+	/* Bursts must not overlap, cross 4KB or leave the memory */
+	if ((TestPtr->BurstLen == 0) || (TestPtr->BurstLen > 256) ||
+	    (TestPtr->NumCmds == 0) ||
+	    (TestPtr->NumCmds >= MAX_NUM_ENTRIES) ||
+	    (TestPtr->Stride < BurstBytes) ||
+	    ((TestPtr->Stride % BurstBytes) != 0) ||
+	    (BurstBytes > 4096) ||
+	    ((u64)TestPtr->Stride * TestPtr->NumCmds > MemPtr->Size) ||
+	    (BurstBytes > (XTG_MASTER_RAM_SIZE - BENCH_RD_MSTRAM_INDEX))) {
+		return XST_FAILURE;
+	}
+
+	Status = XTrafGen_EraseAllCommands(TrafGenPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	InitDefaultCommands(&Cmd);
+	Cmd.CRamCmd.Size = BeatSize;
+	Cmd.CRamCmd.Length = TestPtr->BurstLen - 1;
+	Cmd.CRamCmd.Qos = TestPtr->Qos;
+
+	for (Pass = 0; Pass < 2; Pass++) {
+		u8 RdWrFlag = (Pass == 0) ? XTG_WRITE : XTG_READ;
+		u8 Used = (Pass == 0) ? (TestPtr->Pattern & BENCH_WRITE) :
+					(TestPtr->Pattern & BENCH_READ);
+
+		Cmd.RdWrFlag = RdWrFlag;
+		Cmd.CRamCmd.MasterRamIndex = (RdWrFlag == XTG_WRITE) ?
+				BENCH_WR_MSTRAM_INDEX : BENCH_RD_MSTRAM_INDEX;
+
+		for (Index = 0; Used && (Index < TestPtr->NumCmds); Index++) {
+			Cmd.CRamCmd.Address = MemPtr->BaseAddr +
+					(Index * TestPtr->Stride);
+			Cmd.CRamCmd.ValidCmd = 1;
+			Status = XTrafGen_AddCommand(TrafGenPtr, &Cmd);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+
+		/* Invalid command ends the queue */
+		Cmd.CRamCmd.Address = MemPtr->BaseAddr;
+		Cmd.CRamCmd.ValidCmd = 0;
+		Status = XTrafGen_AddCommand(TrafGenPtr, &Cmd);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XTrafGen_WriteCmdsToHw(TrafGenPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* Run one test and collect its counters. The metric counters are assigned
+* to the slot of the memory under test, reset, and left running across all
+* BENCH_ITERATIONS runs of the command list.
+*
+* @param	TrafGenPtr is a pointer to the XTrafGen instance.
+* @param	AxiPmonPtr is a pointer to the XAxiPmon instance.
+* @param	TestPtr is the test to run.
+* @param	ResultPtr is filled with the collected counters.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE if programming failed, the traffic generator
+*		 reported an error or did not finish
+*
+******************************************************************************/
+static int BenchRun(XTrafGen *TrafGenPtr, XAxiPmon *AxiPmonPtr,
+			const BenchTest *TestPtr, BenchResult *ResultPtr)
+{
+	static const u8 Metrics[BENCH_NUM_COUNTERS] = {
+		XAPM_METRIC_SET_2,	/* Counter 0: write byte count */
+		XAPM_METRIC_SET_3,	/* Counter 1: read byte count */
+		XAPM_METRIC_SET_0,	/* Counter 2: write transactions */
+		XAPM_METRIC_SET_1,	/* Counter 3: read transactions */
+		XAPM_METRIC_SET_6,	/* Counter 4: total write latency */
+		XAPM_METRIC_SET_5,	/* Counter 5: total read latency */
+		XAPM_METRIC_SET_13,	/* Counter 6: max write latency */
+		XAPM_METRIC_SET_15,	/* Counter 7: max read latency */
+	};
+	u8 Slot = BenchMemories[TestPtr->Memory].Slot;
+	u32 ClkCntHigh;
+	u32 ClkCntLow;
+	u32 Iteration;
+	u32 Timeout;
+	u32 Error;
+	u8 Counter;
+	int Status;
+
+	Status = BenchProgram(TrafGenPtr, TestPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Counter = 0; Counter < BENCH_NUM_COUNTERS; Counter++) {
+		Status = XAxiPmon_SetMetrics(AxiPmonPtr, Slot, Metrics[Counter],
+						Counter);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	XAxiPmon_ResetMetricCounter(AxiPmonPtr);
+	XAxiPmon_ResetGlobalClkCounter(AxiPmonPtr);
+	XAxiPmon_EnableMetricsCounter(AxiPmonPtr);
+	XAxiPmon_EnableGlobalClkCounter(AxiPmonPtr);
+
+	for (Iteration = 0; Iteration < BENCH_ITERATIONS; Iteration++) {
+		XTrafGen_StartMasterLogic(TrafGenPtr);
+
+		Timeout = BENCH_TIMEOUT;
+		while (!XTrafGen_IsMasterLogicDone(TrafGenPtr)) {
+			Error = XTrafGen_ReadErrors(TrafGenPtr);
+			if (Error || (--Timeout == 0)) {
+				XTrafGen_ClearErrors(TrafGenPtr, Error);
+				Status = XST_FAILURE;
+				break;
+			}
+		}
+
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	XAxiPmon_DisableGlobalClkCounter(AxiPmonPtr);
+	XAxiPmon_DisableMetricsCounter(AxiPmonPtr);
+
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XAxiPmon_GetGlobalClkCounter(AxiPmonPtr, &ClkCntHigh, &ClkCntLow);
+	ResultPtr->Cycles = ((u64)ClkCntHigh << 32) | ClkCntLow;
+	ResultPtr->WrBytes = XAxiPmon_GetMetricCounter(AxiPmonPtr, 0);
+	ResultPtr->RdBytes = XAxiPmon_GetMetricCounter(AxiPmonPtr, 1);
+	ResultPtr->WrTrans = XAxiPmon_GetMetricCounter(AxiPmonPtr, 2);
+	ResultPtr->RdTrans = XAxiPmon_GetMetricCounter(AxiPmonPtr, 3);
+	ResultPtr->WrLatTotal = XAxiPmon_GetMetricCounter(AxiPmonPtr, 4);
+	ResultPtr->RdLatTotal = XAxiPmon_GetMetricCounter(AxiPmonPtr, 5);
+	ResultPtr->WrLatMax = XAxiPmon_GetMetricCounter(AxiPmonPtr, 6);
+	ResultPtr->RdLatMax = XAxiPmon_GetMetricCounter(AxiPmonPtr, 7);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Print the heading of the result table.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void BenchPrintHeader(void)
+{
+	xil_printf("\r\nMemory   Pattern Burst Stride Cmds QoS "
+		"  WrMB/s   RdMB/s WrLatAvg WrLatMax RdLatAvg RdLatMax\r\n");
+	xil_printf("-------- ------- ----- ------ ---- --- "
+		"-------- -------- -------- -------- -------- --------\r\n");
+}
+
+/*****************************************************************************/
+/**
+*
+* Print one row of the result table.
+*
+* @param	TestPtr is the test that was run.
+* @param	ResultPtr holds the counters collected for it.
+*
+* @return	None.
+*
+* @note		Average latencies are per transaction, in monitor clock
+*		cycles.
+*
+******************************************************************************/
+static void BenchPrintResult(const BenchTest *TestPtr,
+			const BenchResult *ResultPtr)
+{
+	static const char *Patterns[] = {"-", "read", "write", "mixed"};
+	u32 WrLatAvg = 0;
+	u32 RdLatAvg = 0;
+
+	if (ResultPtr->WrTrans != 0) {
+		WrLatAvg = ResultPtr->WrLatTotal / ResultPtr->WrTrans;
+	}
+	if (ResultPtr->RdTrans != 0) {
+		RdLatAvg = ResultPtr->RdLatTotal / ResultPtr->RdTrans;
+	}
+
+	xil_printf("%8s %7s %5d %6d %4d %3d %8d %8d %8d %8d %8d %8d\r\n",
+		BenchMemories[TestPtr->Memory].Name,
+		Patterns[TestPtr->Pattern & BENCH_MIXED],
+		TestPtr->BurstLen, TestPtr->Stride, TestPtr->NumCmds,
+		TestPtr->Qos,
+		BenchMBps(ResultPtr->WrBytes, ResultPtr->Cycles),
+		BenchMBps(ResultPtr->RdBytes, ResultPtr->Cycles),
+		WrLatAvg, ResultPtr->WrLatMax, RdLatAvg, ResultPtr->RdLatMax);
+}
+
+/*****************************************************************************/
+/**
+*
+* Convert a byte count measured over a number of monitor clock cycles to
+* megabytes (10^6 bytes) per second.
+*
+* @param	Bytes is the number of bytes transferred.
+* @param	Cycles is the number of monitor clock cycles.
+*
+* @return	Bandwidth in MB/s, 0 if no cycles were counted.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 BenchMBps(u32 Bytes, u64 Cycles)
+{
+	if (Cycles == 0) {
+		return 0;
+	}
+
+	return (u32)(((u64)Bytes * (APM_CLOCK_FREQ_HZ / 1000)) /
+					(Cycles * 1000));
+}
+
+/*****************************************************************************/
+/*
+*
+* Initialize default command fields
+*
+* @param        XTrafGen_Cmd is a pointer to command structure
+*
+* @return       None.
+*
+* @note         None.
+*
+******************************************************************************/
+static void InitDefaultCommands(XTrafGen_Cmd *CmdPtr)
+{
+	/* Command RAM default command values */
+	CmdPtr->CRamCmd.LastAddress = 0;
+	CmdPtr->CRamCmd.Prot = 0;
+	CmdPtr->CRamCmd.Id = 0;
+	CmdPtr->CRamCmd.Size = 0x2;
+	CmdPtr->CRamCmd.Burst = 0x1;
+	CmdPtr->CRamCmd.Lock = 0;
+	CmdPtr->CRamCmd.Length = 0;
+	CmdPtr->CRamCmd.MyDepend = 0;
+	CmdPtr->CRamCmd.OtherDepend = 0;
+	CmdPtr->CRamCmd.MasterRamIndex = 0;
+	CmdPtr->CRamCmd.Qos = 0;
+	CmdPtr->CRamCmd.User = 0;
+	CmdPtr->CRamCmd.Cache = 0;
+	CmdPtr->CRamCmd.ExpectedResp = 0x7;
+
+	/* Parameter RAM default command values */
+	CmdPtr->PRamCmd.AddrMode = 0;
+	CmdPtr->PRamCmd.IdMode = 0;
+	CmdPtr->PRamCmd.IntervalMode = 0;
+	CmdPtr->PRamCmd.OpCntl0 = 0;
+	CmdPtr->PRamCmd.OpCntl1 = 0;
+	CmdPtr->PRamCmd.OpCntl2 = 0;
+	CmdPtr->PRamCmd.Opcode = 0;
+}
@@ -50,6 +50,10 @@
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1	kvn    04/10/15 Modified code for latest RTL changes.
 * 3.5	NK     09/26/17 Fix the RX Buffer Overflow issue.
+*       ag     10/14/26 XUartPs_SendBuffer and XUartPs_ReceiveBuffer move
+*			as many bytes as the FIFO status guarantees per
+*			status register read instead of one byte per read.
+*			Added XUartPs_RxFifoLevel and XUartPs_TxFifoSpace.
 * </pre>
 *
 *****************************************************************************/
@@ -84,6 +88,10 @@ u32  XUartPs_SendBuffer(XUartPs *InstancePtr);
 
 u32  XUartPs_ReceiveBuffer(XUartPs *InstancePtr);
 
+u32 XUartPs_RxFifoLevel(u32 StatusRegister, u32 RxTrigger);
+
+u32 XUartPs_TxFifoSpace(u32 StatusRegister, u32 TxTrigger);
+
 /************************** Variable Definitions ****************************/
 
 /****************************************************************************/
@@ -160,6 +168,11 @@ s32 XUartPs_CfgInitialize(XUartPs *InstancePtr,
 
 	InstancePtr->is_rxbs_error = 0U;
 
+	InstancePtr->StreamRx.DataPtr = NULL;
+	InstancePtr->StreamTx.DataPtr = NULL;
+	InstancePtr->StreamRxDropped = 0U;
+	InstancePtr->StreamRxThrottled = 0U;
+
 	/* Flag that the driver instance is ready to use */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
@@ -374,23 +387,45 @@ u32 XUartPs_SendBuffer(XUartPs *InstancePtr)
 {
 	u32 SentCount = 0U;
 	u32 ImrRegister;
+	u32 CsrRegister;
+	u32 TxTrigger;
+	u32 Space;
+
+	TxTrigger = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_TXWM_OFFSET) & (u32)XUARTPS_TXWM_MASK;
+	CsrRegister = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_SR_OFFSET);
 
 	/*
 	 * If the TX FIFO is full, send nothing.
 	 * Otherwise put bytes into the TX FIFO unil it is full, or all of the
-	 * data has been put into the FIFO.
+	 * data has been put into the FIFO. The status register is only read
+	 * again once the space it guaranteed has been used up.
 	 */
-	while ((!XUartPs_IsTransmitFull(InstancePtr->Config.BaseAddress)) &&
+	while (((CsrRegister & (u32)XUARTPS_SR_TXFULL) == (u32)0) &&
 		   (InstancePtr->SendBuffer.RemainingBytes > SentCount)) {
 
+		Space = XUartPs_TxFifoSpace(CsrRegister, TxTrigger);
+		if (Space > (InstancePtr->SendBuffer.RemainingBytes -
+				SentCount)) {
+			Space = InstancePtr->SendBuffer.RemainingBytes -
+				SentCount;
+		}
+
 		/* Fill the FIFO from the buffer */
-		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
-				   XUARTPS_FIFO_OFFSET,
-				   ((u32)InstancePtr->SendBuffer.
-				   NextBytePtr[SentCount]));
+		while (Space > (u32)0) {
+			XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+					   XUARTPS_FIFO_OFFSET,
+					   ((u32)InstancePtr->SendBuffer.
+					   NextBytePtr[SentCount]));
+
+			/* Increment the send count. */
+			SentCount++;
+			Space--;
+		}
 
-		/* Increment the send count. */
-		SentCount++;
+		CsrRegister = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XUARTPS_SR_OFFSET);
 	}
 
 	/* Update the buffer to reflect the bytes that were sent from it */
@@ -452,6 +487,11 @@ u32 XUartPs_ReceiveBuffer(XUartPs *InstancePtr)
 	u32 ReceivedCount = 0U;
 	u32 ByteStatusValue, EventData;
 	u32 Event;
+	u32 RxTrigger;
+	u32 Level;
+
+	RxTrigger = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_RXWM_OFFSET) & (u32)XUARTPS_RXWM_MASK;
 
 	/*
 	 * Read the Channel Status Register to determine if there is any data in
@@ -484,12 +524,30 @@ u32 XUartPs_ReceiveBuffer(XUartPs *InstancePtr)
 			}
 		}
 
-		InstancePtr->ReceiveBuffer.NextBytePtr[ReceivedCount] =
-			XUartPs_ReadReg(InstancePtr->Config.
-				  BaseAddress,
-				  XUARTPS_FIFO_OFFSET);
+		/*
+		 * Without per byte error status, read as many bytes as the
+		 * trigger/full status guarantees before checking it again.
+		 */
+		if (InstancePtr->is_rxbs_error) {
+			Level = 1U;
+		} else {
+			Level = XUartPs_RxFifoLevel(CsrRegister, RxTrigger);
+			if (Level > (InstancePtr->ReceiveBuffer.RemainingBytes -
+					ReceivedCount)) {
+				Level = InstancePtr->ReceiveBuffer.RemainingBytes -
+					ReceivedCount;
+			}
+		}
+
+		while (Level > (u32)0) {
+			InstancePtr->ReceiveBuffer.NextBytePtr[ReceivedCount] =
+				XUartPs_ReadReg(InstancePtr->Config.
+					  BaseAddress,
+					  XUARTPS_FIFO_OFFSET);
 
-		ReceivedCount++;
+			ReceivedCount++;
+			Level--;
+		}
 
 		CsrRegister = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
 								XUARTPS_SR_OFFSET);
@@ -109,7 +109,26 @@
 *
 * The functions, XUartPs_Send() and XUartPs_Recv(), are provided in the
 * driver to allow data to be sent and received. They can be used in either
-* polled or interrupt mode.
+* polled or interrupt mode. Both move as many bytes per channel status read
+* as the FIFO empty/full and trigger level status bits guarantee.
+*
+* <b>Streaming</b>
+*
+* For continuous high baud rate links the driver provides a ring buffer
+* backed streaming mode in xuartps_stream.c. The application supplies a
+* receive and a transmit ring with XUartPs_StreamInitialize(), connects
+* XUartPs_StreamInterruptHandler() instead of XUartPs_InterruptHandler() and
+* calls XUartPs_StreamStart(). The RX FIFO trigger and receive timeout
+* interrupts drain the FIFO into the receive ring, XUartPs_StreamRead() and
+* XUartPs_StreamWrite() copy data out of and into the rings without blocking,
+* and the TX FIFO empty interrupt refills the FIFO from the transmit ring.
+* The receive timeout should be set with XUartPs_SetRecvTimeout() so that
+* bytes below the trigger level are delivered when the line goes idle.
+*
+* When hardware flow control is enabled (XUARTPS_OPTION_SET_FCM) and the
+* receive ring is full, the FIFO is left to fill so that the UART deasserts
+* RTS, and draining resumes once XUartPs_StreamRead() makes room. Without flow
+* control the bytes are dropped and counted in StreamRxDropped.
 *
 * @note
 *
@@ -170,6 +189,8 @@
 *                       generation.
 * 3.6   ms     02/16/18 Updates the flow control mode offset value in modem
 *                       control register.
+*       ag     10/14/26 Added the ring buffer backed streaming mode and bulk
+*                       FIFO transfers in XUartPs_Send/XUartPs_Recv.
 *
 * </pre>
 *
@@ -301,6 +322,17 @@ typedef struct {
 	u32 RemainingBytes;
 } XUartPsBuffer;
 
+/**
+ * Ring buffer used by the streaming mode. Head and Tail are free running
+ * indices, the number of bytes held is Tail - Head.
+ */
+typedef struct {
+	u8 *DataPtr;		/**< Application provided storage */
+	u32 Mask;		/**< Size of the storage minus one */
+	volatile u32 Head;	/**< Index of the next byte to be consumed */
+	volatile u32 Tail;	/**< Index of the next byte to be produced */
+} XUartPsRing;
+
 /**
  * Keep track of data format setting of a device.
  */
@@ -348,6 +380,11 @@ typedef struct {
 	void *CallBackRef;	/* Callback reference for event handler */
 	u32 Platform;
 	u8 is_rxbs_error;
+
+	XUartPsRing StreamRx;	/* Streaming mode receive ring */
+	XUartPsRing StreamTx;	/* Streaming mode transmit ring */
+	u32 StreamRxDropped;	/* Bytes dropped because StreamRx was full */
+	u8 StreamRxThrottled;	/* RX draining paused for flow control */
 } XUartPs;
 
 
@@ -453,6 +490,37 @@ typedef struct {
 	 (u32)XUARTPS_SR_TXEMPTY) == (u32)XUARTPS_SR_TXEMPTY)
 
 
+/****************************************************************************/
+/**
+* Get the number of bytes waiting in the streaming mode receive ring.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes XUartPs_StreamRead() can return.
+*
+* @note		C-Style signature:
+*		u32 XUartPs_StreamRxCount(XUartPs *InstancePtr)
+*
+******************************************************************************/
+#define XUartPs_StreamRxCount(InstancePtr)				\
+	((InstancePtr)->StreamRx.Tail - (InstancePtr)->StreamRx.Head)
+
+/****************************************************************************/
+/**
+* Get the number of free bytes in the streaming mode transmit ring.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes XUartPs_StreamWrite() can accept.
+*
+* @note		C-Style signature:
+*		u32 XUartPs_StreamTxSpace(XUartPs *InstancePtr)
+*
+******************************************************************************/
+#define XUartPs_StreamTxSpace(InstancePtr)				\
+	(((InstancePtr)->StreamTx.Mask + 1U) -				\
+	 ((InstancePtr)->StreamTx.Tail - (InstancePtr)->StreamTx.Head))
+
 /************************** Function Prototypes *****************************/
 
 /* Static lookup function implemented in xuartps_sinit.c */
@@ -509,6 +577,20 @@ void XUartPs_InterruptHandler(XUartPs *InstancePtr);
 void XUartPs_SetHandler(XUartPs *InstancePtr, XUartPs_Handler FuncPtr,
 			 void *CallBackRef);
 
+/* streaming functions in xuartps_stream.c */
+s32 XUartPs_StreamInitialize(XUartPs *InstancePtr, u8 *RxBufPtr,
+			u32 RxSize, u8 *TxBufPtr, u32 TxSize);
+
+void XUartPs_StreamStart(XUartPs *InstancePtr);
+
+void XUartPs_StreamStop(XUartPs *InstancePtr);
+
+u32 XUartPs_StreamRead(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes);
+
+u32 XUartPs_StreamWrite(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes);
+
+void XUartPs_StreamInterruptHandler(XUartPs *InstancePtr);
+
 /* self-test functions in xuartps_selftest.c */
 s32 XUartPs_SelfTest(XUartPs *InstancePtr);
 
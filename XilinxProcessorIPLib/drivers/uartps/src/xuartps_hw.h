@@ -57,6 +57,7 @@
 * 3.1	kvn    04/10/15 Modified code for latest RTL changes.
 * 3.6   ms     02/16/18 Updates flow control mode offset value in
 *			modem control register.
+*       ag     10/14/26 Added XUARTPS_FIFO_DEPTH.
 *
 * </pre>
 *
@@ -251,6 +252,8 @@ extern "C" {
 #define XUARTPS_TXWM_RESET_VAL	0x00000020U  /**< Reset value */
 /* @} */
 
+#define XUARTPS_FIFO_DEPTH		64U  /**< Depth of the RX and TX FIFOs */
+
 /** @name Modem Control Register
  *
  * This register (MODEMCR) controls the interface with the modem or data set,
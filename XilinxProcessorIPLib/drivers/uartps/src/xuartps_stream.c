@@ -0,0 +1,566 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xuartps_stream.c
+* @addtogroup uartps_v3_5
+* @{
+*
+* This file contains the ring buffer backed streaming mode of the XUartPs
+* driver. It is intended for continuous, high baud rate links where servicing
+* the FIFO one byte per status read in the interrupt handler is too slow.
+*
+* The receive path is driven by the RX FIFO trigger and receive timeout
+* interrupts. Each interrupt drains the FIFO into the receive ring, reading
+* the channel status register once per block of bytes it guarantees (a full
+* FIFO or the trigger level) instead of once per byte. The transmit path is
+* refilled from the TX FIFO empty interrupt, with the TX trigger status used
+* to size the blocks written.
+*
+* The callback installed with XUartPs_SetHandler() receives:
+* - XUARTPS_EVENT_RECV_DATA after bytes were added to the receive ring.
+* - XUARTPS_EVENT_RECV_TOUT on a receive timeout, the line went idle.
+* - XUARTPS_EVENT_SENT_DATA when the transmit ring has been emptied.
+* - XUARTPS_EVENT_RECV_ORERR on a receive FIFO overrun.
+* - XUARTPS_EVENT_RECV_ERROR on parity, framing or break errors.
+* - XUARTPS_EVENT_MODEM on a modem status change, if enabled.
+*
+* For the receive events EventData is the number of bytes in the receive ring,
+* for XUARTPS_EVENT_SENT_DATA it is the number of bytes written to the FIFO by
+* the last refill, for XUARTPS_EVENT_RECV_ERROR it is the interrupt status and
+* for XUARTPS_EVENT_MODEM it is the modem status.
+*
+* The rings are single producer, single consumer: the interrupt handler
+* produces into the receive ring and consumes from the transmit ring, and a
+* single thread calls XUartPs_StreamRead() and XUartPs_StreamWrite().
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date	Changes
+* ----- ------ -------- -----------------------------------------------
+* 3.5   ag     10/14/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xuartps.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Interrupts that move data from the RX FIFO into the receive ring */
+#define XUARTPS_STREAM_RX_DATA	((u32)XUARTPS_IXR_RXOVR |		\
+				 (u32)XUARTPS_IXR_RXFULL |		\
+				 (u32)XUARTPS_IXR_TOUT)
+
+/* Receive error interrupts */
+#define XUARTPS_STREAM_RX_ERROR	((u32)XUARTPS_IXR_OVER |		\
+				 (u32)XUARTPS_IXR_FRAMING |		\
+				 (u32)XUARTPS_IXR_PARITY |		\
+				 (u32)XUARTPS_IXR_RBRK)
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static u32 StreamDrainRx(XUartPs *InstancePtr);
+static u32 StreamFillTx(XUartPs *InstancePtr);
+
+/* Internal function prototypes implemented in xuartps.c */
+extern u32 XUartPs_RxFifoLevel(u32 StatusRegister, u32 RxTrigger);
+extern u32 XUartPs_TxFifoSpace(u32 StatusRegister, u32 TxTrigger);
+
+/************************** Variable Definitions ****************************/
+
+/****************************************************************************/
+/**
+*
+* This function sets up the streaming mode rings. It must be called before
+* XUartPs_StreamStart(), while the streaming interrupts are disabled.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	RxBufPtr is the storage for the receive ring.
+* @param	RxSize is the size of the receive ring in bytes, a power of 2.
+* @param	TxBufPtr is the storage for the transmit ring.
+* @param	TxSize is the size of the transmit ring in bytes, a power of 2.
+*
+* @return
+*		- XST_SUCCESS if the rings were set up.
+*		- XST_INVALID_PARAM if a size is not a power of 2.
+*
+* @note		None.
+*
+*****************************************************************************/
+s32 XUartPs_StreamInitialize(XUartPs *InstancePtr, u8 *RxBufPtr,
+			u32 RxSize, u8 *TxBufPtr, u32 TxSize)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(RxBufPtr != NULL);
+	Xil_AssertNonvoid(TxBufPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((RxSize == (u32)0) || ((RxSize & (RxSize - 1U)) != (u32)0) ||
+		(TxSize == (u32)0) || ((TxSize & (TxSize - 1U)) != (u32)0)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	InstancePtr->StreamRx.DataPtr = RxBufPtr;
+	InstancePtr->StreamRx.Mask = RxSize - 1U;
+	InstancePtr->StreamRx.Head = 0U;
+	InstancePtr->StreamRx.Tail = 0U;
+
+	InstancePtr->StreamTx.DataPtr = TxBufPtr;
+	InstancePtr->StreamTx.Mask = TxSize - 1U;
+	InstancePtr->StreamTx.Head = 0U;
+	InstancePtr->StreamTx.Tail = 0U;
+
+	InstancePtr->StreamRxDropped = 0U;
+	InstancePtr->StreamRxThrottled = 0U;
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function enables the receive interrupts used by the streaming mode.
+* The transmit interrupt is enabled on demand by XUartPs_StreamWrite().
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	None.
+*
+* @note		XUartPs_StreamInterruptHandler() must be connected to the
+*		interrupt system before this function is called.
+*
+*****************************************************************************/
+void XUartPs_StreamStart(XUartPs *InstancePtr)
+{
+	u32 Mask = XUARTPS_STREAM_RX_DATA | XUARTPS_STREAM_RX_ERROR;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->StreamRx.DataPtr != NULL);
+
+	/* XUARTPS_IXR_RBRK is applicable only for Zynq Ultrascale+ MP */
+	if (InstancePtr->Platform != XPLAT_ZYNQ_ULTRA_MP) {
+		Mask &= ~(u32)XUARTPS_IXR_RBRK;
+	}
+
+	InstancePtr->StreamRxThrottled = 0U;
+
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
+			XUARTPS_IXR_MASK);
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IER_OFFSET,
+			Mask);
+
+	if (XUartPs_StreamTxSpace(InstancePtr) !=
+			(InstancePtr->StreamTx.Mask + 1U)) {
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_IER_OFFSET, XUARTPS_IXR_TXEMPTY);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function disables the interrupts used by the streaming mode. Data in
+* the rings is kept.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_StreamStop(XUartPs *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IDR_OFFSET,
+			XUARTPS_STREAM_RX_DATA | XUARTPS_STREAM_RX_ERROR |
+			(u32)XUARTPS_IXR_TXEMPTY);
+}
+
+/****************************************************************************/
+/**
+*
+* This function copies up to NumBytes received bytes out of the receive ring.
+* It does not block.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	BufferPtr is the buffer the data is copied to.
+* @param	NumBytes is the size of BufferPtr.
+*
+* @return	The number of bytes copied, zero if the ring is empty.
+*
+* @note		If receive draining was paused for flow control it is resumed
+*		once room has been made in the ring.
+*
+*****************************************************************************/
+u32 XUartPs_StreamRead(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes)
+{
+	XUartPsRing *RingPtr;
+	u32 Head;
+	u32 Count;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->StreamRx.DataPtr != NULL);
+
+	RingPtr = &InstancePtr->StreamRx;
+	Head = RingPtr->Head;
+	Count = RingPtr->Tail - Head;
+	if (Count > NumBytes) {
+		Count = NumBytes;
+	}
+
+	/* Order the data reads after the read of Tail */
+	dmb();
+
+	for (Index = 0U; Index < Count; Index++) {
+		BufferPtr[Index] = RingPtr->DataPtr[(Head + Index) &
+						RingPtr->Mask];
+	}
+
+	/* Release the space only after the data has been read */
+	dmb();
+	RingPtr->Head = Head + Count;
+
+	if ((InstancePtr->StreamRxThrottled != 0U) && (Count != (u32)0)) {
+		InstancePtr->StreamRxThrottled = 0U;
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_IER_OFFSET, XUARTPS_STREAM_RX_DATA);
+	}
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function copies up to NumBytes into the transmit ring and makes sure
+* the TX FIFO empty interrupt is enabled to move them to the FIFO. It does
+* not block.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	BufferPtr is the data to be sent.
+* @param	NumBytes is the number of bytes to be sent.
+*
+* @return	The number of bytes accepted, less than NumBytes if the ring
+*		is full.
+*
+* @note		All writes to the TX FIFO are done by the interrupt handler,
+*		so the data is never reordered with a refill in progress.
+*
+*****************************************************************************/
+u32 XUartPs_StreamWrite(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes)
+{
+	XUartPsRing *RingPtr;
+	u32 Tail;
+	u32 Count;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->StreamTx.DataPtr != NULL);
+
+	RingPtr = &InstancePtr->StreamTx;
+	Tail = RingPtr->Tail;
+	Count = XUartPs_StreamTxSpace(InstancePtr);
+	if (Count > NumBytes) {
+		Count = NumBytes;
+	}
+
+	/* Order the data writes after the read of Head */
+	dmb();
+
+	for (Index = 0U; Index < Count; Index++) {
+		RingPtr->DataPtr[(Tail + Index) & RingPtr->Mask] =
+							BufferPtr[Index];
+	}
+
+	/* Publish the data before the new Tail */
+	dmb();
+	RingPtr->Tail = Tail + Count;
+
+	if (Count != (u32)0) {
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XUARTPS_IER_OFFSET, XUARTPS_IXR_TXEMPTY);
+	}
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the interrupt handler for the streaming mode. It must be
+* connected to the interrupt system by the application in place of
+* XUartPs_InterruptHandler().
+*
+* @param	InstancePtr contains a pointer to the driver instance
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XUartPs_StreamInterruptHandler(XUartPs *InstancePtr)
+{
+	u32 IsrStatus;
+	u32 Received = 0U;
+	u32 Sent;
+	u32 MsrRegister;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	IsrStatus = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				   XUARTPS_IMR_OFFSET);
+	IsrStatus &= XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				   XUARTPS_ISR_OFFSET);
+
+	/*
+	 * Clear the status before servicing the FIFOs so that an event raised
+	 * while they are serviced is not lost.
+	 */
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
+		IsrStatus);
+
+	if (((IsrStatus & (XUARTPS_STREAM_RX_DATA |
+			XUARTPS_STREAM_RX_ERROR)) != (u32)0) &&
+		(InstancePtr->StreamRxThrottled == 0U)) {
+		Received = StreamDrainRx(InstancePtr);
+	}
+
+	if ((IsrStatus & (u32)XUARTPS_IXR_OVER) != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				XUARTPS_EVENT_RECV_ORERR,
+				XUartPs_StreamRxCount(InstancePtr));
+	}
+
+	if ((IsrStatus & ((u32)XUARTPS_IXR_FRAMING | (u32)XUARTPS_IXR_PARITY |
+			(u32)XUARTPS_IXR_RBRK)) != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				XUARTPS_EVENT_RECV_ERROR,
+				IsrStatus & XUARTPS_STREAM_RX_ERROR);
+	}
+
+	if ((IsrStatus & (u32)XUARTPS_IXR_TOUT) != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				XUARTPS_EVENT_RECV_TOUT,
+				XUartPs_StreamRxCount(InstancePtr));
+	} else if (Received != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				XUARTPS_EVENT_RECV_DATA,
+				XUartPs_StreamRxCount(InstancePtr));
+	} else {
+		/* Else with dummy entry for MISRA-C Compliance.*/
+		;
+	}
+
+	if ((IsrStatus & (u32)XUARTPS_IXR_TXEMPTY) != (u32)0) {
+		Sent = StreamFillTx(InstancePtr);
+
+		/*
+		 * Once the ring is empty stop the TX FIFO empty interrupt, it is
+		 * enabled again by the next XUartPs_StreamWrite().
+		 */
+		if (InstancePtr->StreamTx.Tail == InstancePtr->StreamTx.Head) {
+			XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+					XUARTPS_IDR_OFFSET, XUARTPS_IXR_TXEMPTY);
+			InstancePtr->Handler(InstancePtr->CallBackRef,
+					XUARTPS_EVENT_SENT_DATA, Sent);
+		}
+	}
+
+	if ((IsrStatus & (u32)XUARTPS_IXR_DMS) != (u32)0) {
+		MsrRegister = XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
+				  XUARTPS_MODEMSR_OFFSET);
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				  XUARTPS_EVENT_MODEM, MsrRegister);
+	}
+}
+
+/****************************************************************************/
+/*
+*
+* This function drains the RX FIFO into the receive ring. The channel status
+* register is read once per block of bytes that it guarantees to be in the
+* FIFO.
+*
+* If the ring is full and hardware flow control is enabled the remaining
+* bytes are left in the FIFO, so that RTS is deasserted, and the RX data
+* interrupts are disabled until XUartPs_StreamRead() makes room. Without flow
+* control the bytes are dropped and counted.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes added to the ring.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 StreamDrainRx(XUartPs *InstancePtr)
+{
+	XUartPsRing *RingPtr = &InstancePtr->StreamRx;
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 RxTrigger;
+	u32 CsrRegister;
+	u32 Level;
+	u32 Space;
+	u32 Tail;
+	u32 Received = 0U;
+
+	RxTrigger = XUartPs_ReadReg(BaseAddress, XUARTPS_RXWM_OFFSET) &
+			(u32)XUARTPS_RXWM_MASK;
+	CsrRegister = XUartPs_ReadReg(BaseAddress, XUARTPS_SR_OFFSET);
+	Tail = RingPtr->Tail;
+
+	Level = XUartPs_RxFifoLevel(CsrRegister, RxTrigger);
+	while (Level != (u32)0) {
+		Space = (RingPtr->Mask + 1U) - (Tail - RingPtr->Head);
+
+		if (Space == (u32)0) {
+			if ((XUartPs_ReadReg(BaseAddress, XUARTPS_MODEMCR_OFFSET) &
+					(u32)XUARTPS_MODEMCR_FCM) != (u32)0) {
+				InstancePtr->StreamRxThrottled = 1U;
+				XUartPs_WriteReg(BaseAddress, XUARTPS_IDR_OFFSET,
+						XUARTPS_STREAM_RX_DATA);
+				break;
+			}
+
+			InstancePtr->StreamRxDropped += Level;
+			while (Level != (u32)0) {
+				(void)XUartPs_ReadReg(BaseAddress,
+						XUARTPS_FIFO_OFFSET);
+				Level--;
+			}
+		} else {
+			if (Level > Space) {
+				Level = Space;
+			}
+
+			Received += Level;
+			while (Level != (u32)0) {
+				RingPtr->DataPtr[Tail & RingPtr->Mask] =
+					(u8)XUartPs_ReadReg(BaseAddress,
+						XUARTPS_FIFO_OFFSET);
+				Tail++;
+				Level--;
+			}
+		}
+
+		CsrRegister = XUartPs_ReadReg(BaseAddress, XUARTPS_SR_OFFSET);
+		Level = XUartPs_RxFifoLevel(CsrRegister, RxTrigger);
+	}
+
+	/* Publish the data before the new Tail */
+	dmb();
+	RingPtr->Tail = Tail;
+
+	return Received;
+}
+
+/****************************************************************************/
+/*
+*
+* This function refills the TX FIFO from the transmit ring. The channel
+* status register is read once per block of bytes that it guarantees to fit
+* in the FIFO. With hardware flow control a transmitter held off by CTS simply
+* stops draining the FIFO, the remaining bytes stay in the ring until the next
+* TX FIFO empty interrupt.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes written to the FIFO.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 StreamFillTx(XUartPs *InstancePtr)
+{
+	XUartPsRing *RingPtr = &InstancePtr->StreamTx;
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 TxTrigger;
+	u32 CsrRegister;
+	u32 Space;
+	u32 Head;
+	u32 Count;
+	u32 Sent = 0U;
+
+	Head = RingPtr->Head;
+	Count = RingPtr->Tail - Head;
+
+	/* Order the data reads after the read of Tail */
+	dmb();
+
+	TxTrigger = XUartPs_ReadReg(BaseAddress, XUARTPS_TXWM_OFFSET) &
+			(u32)XUARTPS_TXWM_MASK;
+	CsrRegister = XUartPs_ReadReg(BaseAddress, XUARTPS_SR_OFFSET);
+
+	Space = XUartPs_TxFifoSpace(CsrRegister, TxTrigger);
+	while ((Count != (u32)0) && (Space != (u32)0)) {
+		if (Space > Count) {
+			Space = Count;
+		}
+
+		Count -= Space;
+		Sent += Space;
+		while (Space != (u32)0) {
+			XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET,
+				(u32)RingPtr->DataPtr[Head & RingPtr->Mask]);
+			Head++;
+			Space--;
+		}
+
+		if (Count != (u32)0) {
+			CsrRegister = XUartPs_ReadReg(BaseAddress,
+						XUARTPS_SR_OFFSET);
+			Space = XUartPs_TxFifoSpace(CsrRegister, TxTrigger);
+		}
+	}
+
+	/* Release the space only after the data has been read */
+	dmb();
+	RingPtr->Head = Head;
+
+	return Sent;
+}
+/** @} */
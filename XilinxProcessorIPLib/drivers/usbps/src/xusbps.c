@@ -48,6 +48,7 @@
  * ----- ---- -------- --------------------------------------------------------
  * 1.00a jz  10/10/10 First release
  * 2.1   kpc 04/28/14 Removed ununsed functions
+* 2.4   ag  10/14/26 Initialize the dTD pool to empty
  * </pre>
  ******************************************************************************/
 
@@ -119,6 +120,10 @@ int XUsbPs_CfgInitialize(XUsbPs *InstancePtr,
 
 	InstancePtr->HandlerFunc	= NULL;
 
+	InstancePtr->dTDPoolFree	= NULL;
+	InstancePtr->dTDPoolNumFree	= 0;
+	InstancePtr->dTDPoolSize	= 0;
+
 	return XST_SUCCESS;
 }
 
@@ -155,6 +155,25 @@
  * function by sending a XUSBPS_EP_EVENT_DATA_TX event.
  *
  *
+ * <h3>Transfer requests</h3>
+ *
+ * Endpoints configured with NumBufs set to 0 do not get their own
+ * descriptors and buffers. Transfers are queued on them with
+ *    XUsbPs_EpRequestQueue()
+ * which receives into or sends from the buffers of a XUsbPs_Request
+ * directly. A request is a list of buffers, each buffer takes one dTD per
+ * 16 Kbytes and the dTDs of all the buffers are chained into one transfer.
+ * The dTDs are taken from a pool which is shared by all the endpoints and
+ * which is set up with XUsbPs_dTDPoolInit(). Several requests can be queued
+ * on an endpoint, the controller moves from one request to the next without
+ * waiting for software. The complete handler of a request is called from
+ * the interrupt handler when all of its dTDs are retired.
+ *
+ * On OUT endpoints a short packet only retires the dTD it is received in,
+ * the following data goes to the next dTD of the request. Buffers of OUT
+ * requests should therefore be a multiple of the max packet size.
+ *
+ *
  * <h2>DMA</h2>
  *
  * The driver uses DMA internally to move data from/to memory. This behaviour
@@ -187,6 +206,9 @@
  *                    generation.
  *       ms  04/10/17 Modified filename tag to include the file in doxygen
  *                    examples.
+ *       ag  10/14/26 Added transfer requests with a shared dTD pool,
+ *                    XUsbPs_dTDPoolInit, XUsbPs_EpRequestQueue and
+ *                    XUsbPs_EpRequestCancel.
  * </pre>
  *
  ******************************************************************************/
@@ -355,6 +377,68 @@ typedef u8	XUsbPs_dQH[XUSBPS_dQH_ALIGN];
 typedef u8	XUsbPs_dTD[XUSBPS_dTD_ALIGN];
 
 
+/**
+ * Buffer of a transfer request. Buffers bigger than 16 Kbytes take more
+ * than one dTD.
+ */
+typedef struct {
+	u8	*BufferPtr;	/**< Buffer location */
+	u32	Length;		/**< Length of the buffer */
+} XUsbPs_SgEntry;
+
+typedef struct XUsbPs_Request XUsbPs_Request;
+
+/******************************************************************************
+ * This data type defines the callback function called when a transfer
+ * request completes.
+ *
+ * @param	CallBackRef is the CompleteRef member of the request.
+ * @param	EpNum is the Number of the endpoint of the request.
+ * @param	ReqPtr is a pointer to the completed request. Its Actual and
+ *		Status members are valid.
+ */
+typedef void (*XUsbPs_ReqHandlerFunc)(void *CallBackRef, u8 EpNum,
+				      XUsbPs_Request *ReqPtr);
+
+/**
+ * Transfer request queued with XUsbPs_EpRequestQueue(). The user owns the
+ * request and its buffers until the complete handler is called.
+ */
+struct XUsbPs_Request {
+	u8	*BufferPtr;		/**< Buffer location, when SgList is NULL */
+	u32	Length;			/**< Length of the buffer */
+	const XUsbPs_SgEntry	*SgList;
+			/**< List of buffers, or NULL for a single buffer */
+	u32	SgCount;		/**< Number of entries in SgList */
+	u8	Zero;
+		/**< Send a zero length packet after an IN transfer which is
+		 * a multiple of the max packet size. */
+	XUsbPs_ReqHandlerFunc	Complete;
+		/**< Handler called when the request completes. May be NULL. */
+	void			*CompleteRef;
+		/**< User data reference for the handler. */
+
+	/* The following members are set by the driver. */
+	u32	Actual;		/**< Bytes transferred, set on completion */
+	int	Status;		/**< XST_SUCCESS, or XST_FAILURE if the
+				  transfer failed or was cancelled */
+	u32	XferLen;	/**< Bytes requested */
+	u32	NumdTDs;	/**< Number of dTDs used by the request */
+	XUsbPs_dTD	*dTDFirst;	/**< First dTD of the request */
+	XUsbPs_dTD	*dTDLast;	/**< Last dTD of the request */
+	XUsbPs_Request	*Next;	/**< Next request queued on the endpoint */
+};
+
+
+/**
+ * Requests queued on one direction of an endpoint, oldest first.
+ */
+typedef struct {
+	XUsbPs_Request	*Head;	/**< Oldest queued request */
+	XUsbPs_Request	*Tail;	/**< Newest queued request */
+} XUsbPs_ReqQueue;
+
+
 /**
  * The following data structures are used internally by the L0/L1 driver.
  * Their contents MUST NOT be changed by the upper layers.
@@ -378,6 +462,9 @@ typedef struct {
 		/**< Pointer to the first buffer of the buffer list for this
 		 * endpoint. */
 
+	XUsbPs_ReqQueue	Req;
+		/**< Requests queued when the endpoint has no buffers. */
+
 	XUsbPs_EpHandlerFunc	HandlerFunc;
 		/**< Handler function for this endpoint. */
 	void			*HandlerRef;
@@ -402,6 +489,9 @@ typedef struct {
 	XUsbPs_dTD	*dTDTail;
 		/**< Buffer to the last unsent descriptor in the list*/
 
+	XUsbPs_ReqQueue	Req;
+		/**< Requests queued when the endpoint has no descriptors. */
+
 	XUsbPs_EpHandlerFunc	HandlerFunc;
 		/**< Handler function for this endpoint. */
 	void			*HandlerRef;
@@ -454,7 +544,9 @@ typedef struct {
 			- XUSBPS_EP_TYPE_INTERRUPT */
 
 	u32	NumBufs;
-		/**< Number of buffers to be handled by this endpoint. */
+		/**< Number of buffers to be handled by this endpoint. 0 makes
+		 * the endpoint take transfer requests instead, see
+		 * XUsbPs_EpRequestQueue(). */
 	u32	BufSize;
 		/**< Buffer size. Only relevant for OUT (receive) Endpoints. */
 
@@ -557,6 +649,11 @@ typedef struct {
 	u32			HandlerMask;
 		/**< User interrupt mask. Defines which interrupts will cause
 		 * the callback to be called. */
+
+	XUsbPs_dTD	*dTDPoolFree;
+		/**< First free dTD of the pool shared by request endpoints. */
+	u32		dTDPoolNumFree;	/**< Number of free dTDs in the pool */
+	u32		dTDPoolSize;	/**< Number of dTDs in the pool */
 } XUsbPs;
 
 
@@ -1063,6 +1160,11 @@ int XUsbPs_EpBufferReceive(XUsbPs *InstancePtr, u8 EpNum,
 			u8 **BufferPtr, u32 *BufferLenPtr, u32 *Handle);
 void XUsbPs_EpBufferRelease(u32 Handle);
 
+int XUsbPs_dTDPoolInit(XUsbPs *InstancePtr, u8 *MemPtr, u32 NumdTDs);
+int XUsbPs_EpRequestQueue(XUsbPs *InstancePtr, u8 EpNum, u8 Direction,
+			XUsbPs_Request *ReqPtr);
+void XUsbPs_EpRequestCancel(XUsbPs *InstancePtr, u8 EpNum, u8 Direction);
+
 int XUsbPs_EpSetHandler(XUsbPs *InstancePtr, u8 EpNum, u8 Direction,
 			XUsbPs_EpHandlerFunc CallBackFunc,
 			void *CallBackRef);
@@ -54,6 +54,9 @@
  * 2.3   bss 01/19/16 Modified XUsbPs_EpQueueRequest function to fix CR#873972
  *            (moving of dTD Head/Tail Pointers)and CR#873974(invalidate
  *            Caches After Buffer Receive in Endpoint Buffer Handler...)
+ * 2.4   ag  10/14/26 Added transfer requests which chain dTDs from a pool
+ *		      shared by the endpoints, XUsbPs_dTDPoolInit,
+ *		      XUsbPs_EpRequestQueue and XUsbPs_EpRequestCancel.
  * </pre>
  ******************************************************************************/
 
@@ -91,6 +94,17 @@ static int XUsbPs_dTDReinitEp(XUsbPs_DeviceConfig *DevCfgPtr,
 static int XUsbPs_EpQueueRequest(XUsbPs *InstancePtr, u8 EpNum,
 				const u8 *BufferPtr, u32 BufferLen, u8 ReqZero);
 
+/* Functions for transfer requests on endpoints without buffers. */
+static void XUsbPs_dTDPoolPut(XUsbPs *InstancePtr, XUsbPs_dTD *dTDPtr);
+static XUsbPs_dTD *XUsbPs_dTDPoolGet(XUsbPs *InstancePtr);
+static XUsbPs_ReqQueue *XUsbPs_EpReqQueue(XUsbPs *InstancePtr, u8 EpNum,
+				u8 Direction, XUsbPs_dQH **dQHPtr);
+static int XUsbPs_EpRequestStart(XUsbPs *InstancePtr, u8 EpNum,
+				u8 Direction, XUsbPs_dQH *dQHPtr,
+				XUsbPs_Request *TailPtr, XUsbPs_Request *ReqPtr);
+static void XUsbPs_EpRequestRetire(XUsbPs *InstancePtr, u8 EpNum,
+				u8 Direction, XUsbPs_Request *ReqPtr, int Status);
+
 /******************************* Functions ************************************/
 
 /*****************************************************************************/
@@ -498,6 +512,587 @@ void XUsbPs_EpBufferRelease(u32 Handle)
 }
 
 
+/*****************************************************************************/
+/**
+* This function sets up the pool of Transfer Descriptors which is shared by
+* the endpoints that take transfer requests.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	MemPtr is a pointer to DMAable memory of NumdTDs times
+*		XUSBPS_dTD_ALIGN bytes, aligned to XUSBPS_dTD_ALIGN.
+* @param	NumdTDs is the number of descriptors in the pool.
+*
+* @return
+*		- XST_SUCCESS: The operation completed successfully.
+*		- XST_DEVICE_BUSY: Queued requests are using the current pool.
+*
+* @note		Each queued request takes one descriptor per 16 Kbytes of
+*		each of its buffers.
+*
+******************************************************************************/
+int XUsbPs_dTDPoolInit(XUsbPs *InstancePtr, u8 *MemPtr, u32 NumdTDs)
+{
+	u32	Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((MemPtr != NULL) || (0 == NumdTDs));
+	Xil_AssertNonvoid(0 == ((u32) MemPtr % XUSBPS_dTD_ALIGN));
+
+	if (InstancePtr->dTDPoolNumFree != InstancePtr->dTDPoolSize) {
+		return XST_DEVICE_BUSY;
+	}
+
+	InstancePtr->dTDPoolFree	= NULL;
+	InstancePtr->dTDPoolNumFree	= 0;
+
+	for (Index = 0; Index < NumdTDs; Index++) {
+		XUsbPs_dTDPoolPut(InstancePtr,
+			(XUsbPs_dTD *) (MemPtr + (Index * XUSBPS_dTD_ALIGN)));
+	}
+
+	InstancePtr->dTDPoolSize = NumdTDs;
+
+	return XST_SUCCESS;
+}
+
+
+/*****************************************************************************/
+/**
+* This function queues a transfer request on an endpoint which has been
+* configured with no buffers (NumBufs is 0). The buffers of the request are
+* used for the transfer directly. Each buffer is split into dTDs of up to 16
+* Kbytes which are taken from the shared pool and chained, and the chain is
+* linked behind the requests already queued on the endpoint.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	EpNum is the number of the endpoint.
+* @param	Direction is the direction of the endpoint:
+* 			- XUSBPS_EP_DIRECTION_OUT
+* 			- XUSBPS_EP_DIRECTION_IN
+* @param	ReqPtr is a pointer to the request.
+*
+* @return
+*		- XST_SUCCESS: The request has been queued.
+*		- XST_INVALID_PARAM: The endpoint does not take requests.
+*		- XST_USB_NO_DESC_AVAILABLE: Not enough free dTDs in the pool.
+*
+* @note
+*		The complete handler of the request is called from the
+*		interrupt handler. If the buffers are in cached memory they
+*		should be cache line aligned. If requests are queued from
+*		both the interrupt handler and task context, the USB
+*		interrupt should be disabled around the call.
+*
+******************************************************************************/
+int XUsbPs_EpRequestQueue(XUsbPs *InstancePtr, u8 EpNum, u8 Direction,
+				XUsbPs_Request *ReqPtr)
+{
+	XUsbPs_EpSetup	*EpSetup;
+	XUsbPs_ReqQueue	*Queue;
+	XUsbPs_dQH	*dQHPtr;
+	XUsbPs_Request	*TailPtr;
+	XUsbPs_SgEntry	Single;
+	const XUsbPs_SgEntry	*SgList;
+	XUsbPs_dTD	*dTDPtr;
+	XUsbPs_dTD	*PrevPtr = NULL;
+	u8		*BufPtr;
+	u32		SgCount;
+	u32		Index;
+	u32		Count;
+	u32		Offset;
+	u32		Length;
+	u32		NumdTDs = 0;
+	u32		XferLen = 0;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ReqPtr      != NULL);
+	Xil_AssertNonvoid(EpNum < InstancePtr->DeviceConfig.NumEndpoints);
+	Xil_AssertNonvoid((XUSBPS_EP_DIRECTION_OUT == Direction) ||
+			(XUSBPS_EP_DIRECTION_IN == Direction));
+
+	if (XUSBPS_EP_DIRECTION_OUT == Direction) {
+		EpSetup = &InstancePtr->DeviceConfig.EpCfg[EpNum].Out;
+	} else {
+		EpSetup = &InstancePtr->DeviceConfig.EpCfg[EpNum].In;
+	}
+
+	if ((XUSBPS_EP_TYPE_NONE == EpSetup->Type) || (0 != EpSetup->NumBufs)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (NULL == ReqPtr->SgList) {
+		Single.BufferPtr	= ReqPtr->BufferPtr;
+		Single.Length		= ReqPtr->Length;
+		SgList	= &Single;
+		SgCount	= 1;
+	} else {
+		SgList	= ReqPtr->SgList;
+		SgCount	= ReqPtr->SgCount;
+	}
+
+	/* Count the descriptors needed. A transfer without data still takes
+	 * one descriptor for the zero length packet, and so does the ZLP
+	 * requested after a multiple of the max packet size.
+	 */
+	for (Index = 0; Index < SgCount; Index++) {
+		NumdTDs += (SgList[Index].Length + XUSBPS_dTD_BUF_MAX_SIZE - 1) /
+						XUSBPS_dTD_BUF_MAX_SIZE;
+		XferLen += SgList[Index].Length;
+	}
+	if (0 == XferLen) {
+		NumdTDs = 1;
+	} else if ((XUSBPS_EP_DIRECTION_IN == Direction) && ReqPtr->Zero &&
+			(0 == (XferLen % EpSetup->MaxPacketSize))) {
+		NumdTDs++;
+	}
+
+	if (NumdTDs > InstancePtr->dTDPoolNumFree) {
+		return XST_USB_NO_DESC_AVAILABLE;
+	}
+
+	/* Hand the buffers over to the DMA engine. */
+	for (Index = 0; Index < SgCount; Index++) {
+		if (XUSBPS_EP_DIRECTION_IN == Direction) {
+			Xil_DCacheFlushRange((unsigned int) SgList[Index].BufferPtr,
+						SgList[Index].Length);
+		} else {
+			Xil_DCacheInvalidateRange(
+				(unsigned int) SgList[Index].BufferPtr,
+				SgList[Index].Length);
+		}
+	}
+
+	ReqPtr->Actual	= 0;
+	ReqPtr->Status	= XST_SUCCESS;
+	ReqPtr->XferLen	= XferLen;
+	ReqPtr->NumdTDs	= NumdTDs;
+	ReqPtr->Next	= NULL;
+
+	/* Chain the descriptors. Only the last one interrupts on completion,
+	 * any descriptors left after the buffers are zero length.
+	 */
+	Index	= 0;
+	Offset	= 0;
+	for (Count = 0; Count < NumdTDs; Count++) {
+		while ((Index < SgCount) && (Offset == SgList[Index].Length)) {
+			Index++;
+			Offset = 0;
+		}
+
+		if (Index < SgCount) {
+			BufPtr = SgList[Index].BufferPtr + Offset;
+			Length = SgList[Index].Length - Offset;
+			if (Length > XUSBPS_dTD_BUF_MAX_SIZE) {
+				Length = XUSBPS_dTD_BUF_MAX_SIZE;
+			}
+			Offset += Length;
+		} else {
+			BufPtr = NULL;
+			Length = 0;
+		}
+
+		dTDPtr = XUsbPs_dTDPoolGet(InstancePtr);
+
+		XUsbPs_WritedTD(dTDPtr, XUSBPS_dTDTOKEN, 0);
+		XUsbPs_WritedTD(dTDPtr, XUSBPS_dTDNLP, XUSBPS_dTDNLP_T_MASK);
+		(void) XUsbPs_dTDAttachBuffer(dTDPtr, BufPtr, Length);
+		XUsbPs_dTDSetActive(dTDPtr);
+
+		if (NULL == PrevPtr) {
+			ReqPtr->dTDFirst = dTDPtr;
+		} else {
+			XUsbPs_WritedTD(PrevPtr, XUSBPS_dTDNLP, dTDPtr);
+			XUsbPs_dTDFlushCache(PrevPtr);
+		}
+		PrevPtr = dTDPtr;
+	}
+
+	XUsbPs_dTDSetIOC(PrevPtr);
+	XUsbPs_dTDFlushCache(PrevPtr);
+	ReqPtr->dTDLast = PrevPtr;
+
+	/* Add the request to the endpoint queue and to the controller. */
+	Queue	= XUsbPs_EpReqQueue(InstancePtr, EpNum, Direction, &dQHPtr);
+	TailPtr	= Queue->Tail;
+	if (NULL == TailPtr) {
+		Queue->Head = ReqPtr;
+	} else {
+		TailPtr->Next = ReqPtr;
+	}
+	Queue->Tail = ReqPtr;
+
+	return XUsbPs_EpRequestStart(InstancePtr, EpNum, Direction, dQHPtr,
+					TailPtr, ReqPtr);
+}
+
+
+/*****************************************************************************/
+/**
+* This function cancels all requests queued on an endpoint. The endpoint is
+* flushed and the complete handlers are called with XST_FAILURE status and
+* the number of bytes transferred up to the cancel.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	EpNum is the number of the endpoint.
+* @param	Direction is the direction of the endpoint:
+* 			- XUSBPS_EP_DIRECTION_OUT
+* 			- XUSBPS_EP_DIRECTION_IN
+*
+* @return	None.
+*
+* @note		The driver cancels the requests itself on a bus reset and
+*		when the endpoint is reconfigured.
+*
+******************************************************************************/
+void XUsbPs_EpRequestCancel(XUsbPs *InstancePtr, u8 EpNum, u8 Direction)
+{
+	XUsbPs_ReqQueue	*Queue;
+	XUsbPs_dQH	*dQHPtr;
+	XUsbPs_Request	*ReqPtr;
+	XUsbPs_Request	*NextPtr;
+	u32		BitMask;
+	u32		Token;
+	int		Timeout;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(EpNum < InstancePtr->DeviceConfig.NumEndpoints);
+	Xil_AssertVoid((XUSBPS_EP_DIRECTION_OUT == Direction) ||
+			(XUSBPS_EP_DIRECTION_IN == Direction));
+
+	Queue = XUsbPs_EpReqQueue(InstancePtr, EpNum, Direction, &dQHPtr);
+	if (NULL == Queue->Head) {
+		return;
+	}
+
+	if (XUSBPS_EP_DIRECTION_OUT == Direction) {
+		BitMask = 0x00000001 << EpNum;
+	} else {
+		BitMask = 0x00010000 << EpNum;
+	}
+
+	/* Stop the DMA engine on the endpoint before the descriptors are
+	 * taken back. The flush has to be repeated if the endpoint got primed
+	 * again while flushing.
+	 */
+	Timeout = XUSBPS_TIMEOUT_COUNTER;
+	do {
+		XUsbPs_WriteReg(InstancePtr->Config.BaseAddress,
+					XUSBPS_EPFLUSH_OFFSET, BitMask);
+		while ((XUsbPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XUSBPS_EPFLUSH_OFFSET) & BitMask) &&
+					--Timeout) {
+			/* NOP */
+		}
+	} while ((XUsbPs_ReadReg(InstancePtr->Config.BaseAddress,
+				XUSBPS_EPRDY_OFFSET) & BitMask) && (Timeout > 0));
+
+	XUsbPs_dQHInvalidateCache(dQHPtr);
+	XUsbPs_WritedQH(dQHPtr, XUSBPS_dQHdTDNLP, XUSBPS_dTDNLP_T_MASK);
+	Token = XUsbPs_ReaddQH(dQHPtr, XUSBPS_dQHdTDTOKEN);
+	Token &= ~(XUSBPS_dTDTOKEN_ACTIVE_MASK | XUSBPS_dTDTOKEN_HALT_MASK);
+	XUsbPs_WritedQH(dQHPtr, XUSBPS_dQHdTDTOKEN, Token);
+	XUsbPs_dQHFlushCache(dQHPtr);
+
+	/* Detach the list first, complete handlers may queue new requests. */
+	ReqPtr		= Queue->Head;
+	Queue->Head	= NULL;
+	Queue->Tail	= NULL;
+
+	while (NULL != ReqPtr) {
+		NextPtr = ReqPtr->Next;
+		XUsbPs_EpRequestRetire(InstancePtr, EpNum, Direction, ReqPtr,
+					XST_FAILURE);
+		ReqPtr = NextPtr;
+	}
+}
+
+
+/*****************************************************************************/
+/**
+* This function completes the requests of an endpoint whose dTDs have all
+* been retired. It is called by the interrupt handler on a transfer complete
+* interrupt of an endpoint which takes requests. A request which ended with
+* a transfer error is completed with XST_FAILURE and cancels the requests
+* queued behind it.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	EpNum is the number of the endpoint.
+* @param	Direction is the direction of the endpoint:
+* 			- XUSBPS_EP_DIRECTION_OUT
+* 			- XUSBPS_EP_DIRECTION_IN
+*
+* @return	None.
+*
+******************************************************************************/
+void XUsbPs_EpRequestHandler(XUsbPs *InstancePtr, u8 EpNum, u8 Direction)
+{
+	XUsbPs_ReqQueue	*Queue;
+	XUsbPs_dQH	*dQHPtr;
+	XUsbPs_Request	*ReqPtr;
+	XUsbPs_dTD	*dTDPtr;
+	u32		Token;
+	u32		Index;
+
+	Queue = XUsbPs_EpReqQueue(InstancePtr, EpNum, Direction, &dQHPtr);
+
+	while (NULL != (ReqPtr = Queue->Head)) {
+		dTDPtr = ReqPtr->dTDFirst;
+		for (Index = 0; Index < ReqPtr->NumdTDs; Index++) {
+			XUsbPs_dTDInvalidateCache(dTDPtr);
+			Token = XUsbPs_ReaddTD(dTDPtr, XUSBPS_dTDTOKEN);
+
+			if (Token & XUSBPS_dTDTOKEN_ACTIVE_MASK) {
+				/* Still in progress. */
+				return;
+			}
+
+			if (Token & (XUSBPS_dTDTOKEN_HALT_MASK |
+					XUSBPS_dTDTOKEN_BUFERR_MASK |
+					XUSBPS_dTDTOKEN_XERR_MASK)) {
+				XUsbPs_EpRequestCancel(InstancePtr, EpNum,
+							Direction);
+				return;
+			}
+
+			dTDPtr = XUsbPs_dTDGetNLP(dTDPtr);
+		}
+
+		Queue->Head = ReqPtr->Next;
+		if (NULL == Queue->Head) {
+			Queue->Tail = NULL;
+		}
+
+		XUsbPs_EpRequestRetire(InstancePtr, EpNum, Direction, ReqPtr,
+					XST_SUCCESS);
+	}
+}
+
+
+/*****************************************************************************/
+/**
+* This function links the dTDs of a request to the transfer running on the
+* endpoint, or primes the endpoint with them if it has run out of dTDs. The
+* sequence follows the one used for XUsbPs_EpBufferSend().
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	EpNum is the number of the endpoint.
+* @param	Direction is the direction of the endpoint.
+* @param	dQHPtr is a pointer to the Queue Head of the endpoint.
+* @param	TailPtr is a pointer to the request queued before, or NULL.
+* @param	ReqPtr is a pointer to the request to start.
+*
+* @return
+*		- XST_SUCCESS: The operation completed successfully.
+*		- XST_INVALID_PARAM: Invalid parameter passed.
+*
+******************************************************************************/
+static int XUsbPs_EpRequestStart(XUsbPs *InstancePtr, u8 EpNum,
+				u8 Direction, XUsbPs_dQH *dQHPtr,
+				XUsbPs_Request *TailPtr, XUsbPs_Request *ReqPtr)
+{
+	u32	BitMask;
+	u32	RegValue;
+	u32	Token;
+	u32	Temp;
+
+	if (XUSBPS_EP_DIRECTION_OUT == Direction) {
+		BitMask = 0x00000001 << EpNum;
+	} else {
+		BitMask = 0x00010000 << EpNum;
+	}
+
+	if (NULL != TailPtr) {
+		/* Link the request behind the last one. If the DMA engine
+		 * has not reached the end of the list it will pick the new
+		 * dTDs up by itself.
+		 */
+		XUsbPs_WritedTD(TailPtr->dTDLast, XUSBPS_dTDNLP,
+						ReqPtr->dTDFirst);
+		XUsbPs_dTDFlushCache(TailPtr->dTDLast);
+
+		RegValue = XUsbPs_ReadReg(InstancePtr->Config.BaseAddress,
+						XUSBPS_EPPRIME_OFFSET);
+		if (RegValue & BitMask) {
+			return XST_SUCCESS;
+		}
+
+		do {
+			RegValue = XUsbPs_ReadReg(InstancePtr->Config.BaseAddress,
+						XUSBPS_CMD_OFFSET);
+			XUsbPs_WriteReg(InstancePtr->Config.BaseAddress,
+					XUSBPS_CMD_OFFSET,
+					RegValue | XUSBPS_CMD_ATDTW_MASK);
+			Temp = XUsbPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XUSBPS_EPRDY_OFFSET) & BitMask;
+		} while (!(XUsbPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XUSBPS_CMD_OFFSET) &
+					XUSBPS_CMD_ATDTW_MASK));
+
+		RegValue = XUsbPs_ReadReg(InstancePtr->Config.BaseAddress,
+						XUSBPS_CMD_OFFSET);
+		XUsbPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XUSBPS_CMD_OFFSET,
+				RegValue & ~XUSBPS_CMD_ATDTW_MASK);
+
+		if (Temp) {
+			return XST_SUCCESS;
+		}
+	}
+
+	/* The endpoint is idle, start it with the first dTD of the request. */
+	XUsbPs_dQHInvalidateCache(dQHPtr);
+	XUsbPs_WritedQH(dQHPtr, XUSBPS_dQHdTDNLP, ReqPtr->dTDFirst);
+	Token = XUsbPs_ReaddQH(dQHPtr, XUSBPS_dQHdTDTOKEN);
+	Token &= ~(XUSBPS_dTDTOKEN_ACTIVE_MASK | XUSBPS_dTDTOKEN_HALT_MASK);
+	XUsbPs_WritedQH(dQHPtr, XUSBPS_dQHdTDTOKEN, Token);
+	XUsbPs_dQHFlushCache(dQHPtr);
+
+	return XUsbPs_EpPrime(InstancePtr, EpNum, Direction);
+}
+
+
+/*****************************************************************************/
+/**
+* This function returns the dTDs of a request to the pool, sets the number
+* of bytes transferred and the status of the request and calls its complete
+* handler. The request must have been removed from the endpoint queue.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	EpNum is the number of the endpoint.
+* @param	Direction is the direction of the endpoint.
+* @param	ReqPtr is a pointer to the request.
+* @param	Status is the completion status of the request.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XUsbPs_EpRequestRetire(XUsbPs *InstancePtr, u8 EpNum,
+				u8 Direction, XUsbPs_Request *ReqPtr, int Status)
+{
+	XUsbPs_dTD	*dTDPtr;
+	XUsbPs_dTD	*NextPtr;
+	u32		Remaining = 0;
+	u32		Index;
+
+	/* The transfer length field of each dTD holds the bytes it has not
+	 * transferred.
+	 */
+	dTDPtr = ReqPtr->dTDFirst;
+	for (Index = 0; Index < ReqPtr->NumdTDs; Index++) {
+		XUsbPs_dTDInvalidateCache(dTDPtr);
+		Remaining += XUsbPs_dTDGetTransferLen(dTDPtr);
+		NextPtr = XUsbPs_dTDGetNLP(dTDPtr);
+		XUsbPs_dTDPoolPut(InstancePtr, dTDPtr);
+		dTDPtr = NextPtr;
+	}
+
+	ReqPtr->Actual = (Remaining < ReqPtr->XferLen) ?
+				(ReqPtr->XferLen - Remaining) : 0;
+	ReqPtr->Status = Status;
+
+	/* Drop the lines which were fetched while the DMA engine wrote the
+	 * buffers.
+	 */
+	if (XUSBPS_EP_DIRECTION_OUT == Direction) {
+		if (NULL == ReqPtr->SgList) {
+			Xil_DCacheInvalidateRange((unsigned int) ReqPtr->BufferPtr,
+							ReqPtr->Length);
+		} else {
+			for (Index = 0; Index < ReqPtr->SgCount; Index++) {
+				Xil_DCacheInvalidateRange(
+					(unsigned int) ReqPtr->SgList[Index].BufferPtr,
+					ReqPtr->SgList[Index].Length);
+			}
+		}
+	}
+
+	if (NULL != ReqPtr->Complete) {
+		ReqPtr->Complete(ReqPtr->CompleteRef, EpNum, ReqPtr);
+	}
+}
+
+
+/*****************************************************************************/
+/**
+* This function returns a Transfer Descriptor to the shared pool. Free
+* descriptors are linked through their user data field.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	dTDPtr is a pointer to the descriptor.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XUsbPs_dTDPoolPut(XUsbPs *InstancePtr, XUsbPs_dTD *dTDPtr)
+{
+	XUsbPs_WritedTD(dTDPtr, XUSBPS_dTDUSERDATA, InstancePtr->dTDPoolFree);
+	InstancePtr->dTDPoolFree = dTDPtr;
+	InstancePtr->dTDPoolNumFree++;
+}
+
+
+/*****************************************************************************/
+/**
+* This function takes a Transfer Descriptor from the shared pool. The caller
+* has to check that the pool is not empty.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+*
+* @return	Pointer to the descriptor.
+*
+******************************************************************************/
+static XUsbPs_dTD *XUsbPs_dTDPoolGet(XUsbPs *InstancePtr)
+{
+	XUsbPs_dTD	*dTDPtr;
+
+	dTDPtr = InstancePtr->dTDPoolFree;
+	InstancePtr->dTDPoolFree = (XUsbPs_dTD *) XUsbPs_ReaddTD(dTDPtr,
+							XUSBPS_dTDUSERDATA);
+	InstancePtr->dTDPoolNumFree--;
+
+	return dTDPtr;
+}
+
+
+/*****************************************************************************/
+/**
+* This function returns the request queue and the Queue Head of one
+* direction of an endpoint.
+*
+* @param	InstancePtr is a pointer to the XUsbPs instance of the
+*		controller.
+* @param	EpNum is the number of the endpoint.
+* @param	Direction is the direction of the endpoint.
+* @param	dQHPtr (OUT param) is set to the Queue Head of the endpoint.
+*
+* @return	Pointer to the request queue.
+*
+******************************************************************************/
+static XUsbPs_ReqQueue *XUsbPs_EpReqQueue(XUsbPs *InstancePtr, u8 EpNum,
+				u8 Direction, XUsbPs_dQH **dQHPtr)
+{
+	XUsbPs_Endpoint	*Ep;
+
+	Ep = &InstancePtr->DeviceConfig.Ep[EpNum];
+
+	if (XUSBPS_EP_DIRECTION_OUT == Direction) {
+		*dQHPtr = Ep->Out.dQH;
+		return &Ep->Out.Req;
+	}
+
+	*dQHPtr = Ep->In.dQH;
+	return &Ep->In.Req;
+}
+
+
 /*****************************************************************************/
 /**
  * This function sets the handler for endpoint events.
@@ -815,11 +1410,17 @@ static void XUsbPs_EpListInit(XUsbPs_DeviceConfig *DevCfgPtr)
 	}
 
 
-	/* Initialize the endpoint event handlers to NULL.
+	/* Initialize the endpoint event handlers to NULL and the request
+	 * queues to empty.
 	 */
 	for (EpNum = 0; EpNum < DevCfgPtr->NumEndpoints; ++EpNum) {
 		Ep[EpNum].Out.HandlerFunc = NULL;
 		Ep[EpNum].In.HandlerFunc  = NULL;
+
+		Ep[EpNum].Out.Req.Head	= NULL;
+		Ep[EpNum].Out.Req.Tail	= NULL;
+		Ep[EpNum].In.Req.Head	= NULL;
+		Ep[EpNum].In.Req.Tail	= NULL;
 	}
 }
 
@@ -883,9 +1484,16 @@ static void XUsbPs_dQHInit(XUsbPs_DeviceConfig *DevCfgPtr)
 				XUsbPs_dQHSetIOS(Ep[EpNum].Out.dQH);
 			}
 
-			/* Set up the overlay next dTD pointer. */
-			XUsbPs_WritedQH(Ep[EpNum].Out.dQH,
+			/* Set up the overlay next dTD pointer. Endpoints
+			 * taking requests have no dTDs until one is queued.
+			 */
+			if (0 == EpCfg[EpNum].Out.NumBufs) {
+				XUsbPs_WritedQH(Ep[EpNum].Out.dQH,
+					XUSBPS_dQHdTDNLP, XUSBPS_dTDNLP_T_MASK);
+			} else {
+				XUsbPs_WritedQH(Ep[EpNum].Out.dQH,
 					XUSBPS_dQHdTDNLP, Ep[EpNum].Out.dTDs);
+			}
 
 			XUsbPs_dQHFlushCache(Ep[EpNum].Out.dQH);
 		}
@@ -1200,6 +1808,10 @@ int XUsbPs_ReconfigureEp(XUsbPs *InstancePtr, XUsbPs_DeviceConfig *CfgPtr,
 	Ep = CfgPtr->Ep;
 	EpCfg = CfgPtr->EpCfg;
 
+	/* Give back the requests queued for the old setting. */
+	XUsbPs_EpRequestCancel(InstancePtr, EpNum, XUSBPS_EP_DIRECTION_OUT);
+	XUsbPs_EpRequestCancel(InstancePtr, EpNum, XUSBPS_EP_DIRECTION_IN);
+
 	/* If transfer direction changes, dTDs has to be reset
 	 * Number of buffers are preset and should not to be changed.
 	 */
@@ -1306,8 +1918,13 @@ int EpNum, unsigned short NewDirection)
 
 		/* Set up the overlay next dTD pointer.
 		 */
-		XUsbPs_WritedQH(Ep[EpNum].Out.dQH,
+		if (0 == EpCfg[EpNum].Out.NumBufs) {
+			XUsbPs_WritedQH(Ep[EpNum].Out.dQH,
+				XUSBPS_dQHdTDNLP, XUSBPS_dTDNLP_T_MASK);
+		} else {
+			XUsbPs_WritedQH(Ep[EpNum].Out.dQH,
 				XUSBPS_dQHdTDNLP, Ep[EpNum].Out.dTDs);
+		}
 
 		XUsbPs_dQHFlushCache(Ep[EpNum].Out.dQH);
 
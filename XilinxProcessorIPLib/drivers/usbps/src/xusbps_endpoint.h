@@ -46,6 +46,7 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- --------------------------------------------------------
  * 1.00a wgr  10/10/10 First release
+ * 2.4   ag   10/14/26 Added XUsbPs_EpRequestHandler
  * </pre>
  *
  ******************************************************************************/
@@ -505,6 +506,14 @@ extern "C" {
 #define XUsbPs_WritedQH(dQHPtr, Id, Val)	\
 			(*(u32 *) ((u32)(dQHPtr) + (u32)(Id)) = (u32)(Val))
 
+/************************** Function Prototypes ******************************/
+
+/*
+ * Completion of transfer requests, called by the interrupt handler.
+ *
+ * Implemented in file xusbps_endpoint.c
+ */
+void XUsbPs_EpRequestHandler(XUsbPs *InstancePtr, u8 EpNum, u8 Direction);
 
 
 #ifdef __cplusplus
@@ -48,6 +48,8 @@
  *                    handling.
  * 2.3   bss 01/19/16 Modified XUsbPs_EpQueueRequest function to fix CR#873972
  *            (moving of dTD Head/Tail Pointers properly).
+ * 2.4   ag  10/14/26 Complete transfer requests on endpoints without buffers
+ *		      and cancel them on a bus reset.
  * </pre>
  ******************************************************************************/
 
@@ -263,6 +265,14 @@ static void XUsbPs_IntrHandleTX(XUsbPs *InstancePtr, u32 EpCompl)
 		if (!(EpCompl & Mask)) {
 			continue;
 		}
+
+		/* Endpoints without buffers complete transfer requests. */
+		if (0 == InstancePtr->DeviceConfig.EpCfg[Index].In.NumBufs) {
+			XUsbPs_EpRequestHandler(InstancePtr, Index,
+						XUSBPS_EP_DIRECTION_IN);
+			continue;
+		}
+
 		/* The TX complete bit for this endpoint is
 		 * set. Walk the list of descriptors to see
 		 * which ones are completed.
@@ -331,6 +341,16 @@ static void XUsbPs_IntrHandleRX(XUsbPs *InstancePtr, u32 EpCompl)
 		if (!(EpCompl & Mask)) {
 			continue;
 		}
+
+		/* Endpoints without buffers complete transfer requests, the
+		 * endpoint is primed again when the next request is queued.
+		 */
+		if (0 == InstancePtr->DeviceConfig.EpCfg[Index].Out.NumBufs) {
+			XUsbPs_EpRequestHandler(InstancePtr, Index,
+						XUSBPS_EP_DIRECTION_OUT);
+			continue;
+		}
+
 		Ep = &InstancePtr->DeviceConfig.Ep[Index].Out;
 
 		XUsbPs_dTDInvalidateCache(Ep->dTDCurr);
@@ -369,6 +389,7 @@ static void XUsbPs_IntrHandleRX(XUsbPs *InstancePtr, u32 EpCompl)
 static void XUsbPs_IntrHandleReset(XUsbPs *InstancePtr, u32 IrqSts)
 {
 	int Timeout;
+	u8  Index;
 
 	/* Clear all setup token semaphores by reading the
 	 * XUSBPS_EPSTAT_OFFSET register and writing its value back to
@@ -402,6 +423,15 @@ static void XUsbPs_IntrHandleReset(XUsbPs *InstancePtr, u32 IrqSts)
 	XUsbPs_WriteReg(InstancePtr->Config.BaseAddress,
 				XUSBPS_EPFLUSH_OFFSET, 0xFFFFFFFF);
 
+	/* Give the queued transfer requests back to their owners. */
+	for (Index = 0; Index < InstancePtr->DeviceConfig.NumEndpoints;
+								Index++) {
+		XUsbPs_EpRequestCancel(InstancePtr, Index,
+					XUSBPS_EP_DIRECTION_OUT);
+		XUsbPs_EpRequestCancel(InstancePtr, Index,
+					XUSBPS_EP_DIRECTION_IN);
+	}
+
 	/* Make sure that the reset bit in XUSBPS_PORTSCR1_OFFSET is
 	 * still set at this point. If the code gets to this point and
 	 * the reset bit has already been cleared we are in trouble and
@@ -46,6 +46,8 @@
  * 1.1	vak  30/11/16  Addded DFU support
  * 1.4   BK  12/01/18  Renamed the file and added changes to have a common
  *		       example for all USB IPs.
+ *       ag  10/14/26  Vendor requests are passed to the Usb_VendorReq
+ *		       hook when it is set.
  *
  * </pre>
  *
@@ -105,6 +107,9 @@ void Ch9Handler(struct Usb_DevData *InstancePtr,
 #ifdef CH9_DEBUG
 		printf("vendor request %x\n", SetupData->bRequest);
 #endif
+		if (ch9_ptr->ch9_func.Usb_VendorReq != NULL) {
+			ch9_ptr->ch9_func.Usb_VendorReq(InstancePtr, SetupData);
+		}
 		break;
 
 	default:
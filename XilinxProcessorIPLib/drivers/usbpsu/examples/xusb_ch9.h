@@ -46,6 +46,7 @@
  * 1.2   mn  01/20/17  fix to assign EP number and direction from wIndex field
  * 1.4   BK  12/01/18  Renamed the file and added changes to have a common
  *		       example for all USB IPs.
+ *       ag  10/14/26  Added the vendor request hook
  *
  * </pre>
  *
@@ -184,6 +185,7 @@ typedef struct {
 	void (*Usb_SetInterfaceHandler)(struct Usb_DevData *, SetupPacket *);
 	void (*Usb_ClassReq)(struct Usb_DevData *, SetupPacket *);
 	u32 (*Usb_GetDescReply)(struct Usb_DevData *, SetupPacket *,u8 *);
+	void (*Usb_VendorReq)(struct Usb_DevData *, SetupPacket *);
 } __attribute__((__packed__))CH9FUNC_CONTAINER;
 
 typedef struct {
@@ -0,0 +1,551 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+ ******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xusb_ch9_bench.c
+ *
+ * This file contains the implementation of the benchmark specific chapter 9
+ * code for the example.
+ *
+ * The configuration descriptor is built from BENCH_NUM_BULK and BENCH_ISO:
+ * one vendor specific interface whose alternate setting 0 has the bulk
+ * endpoint pairs, and alternate setting 1 the bulk pairs and the
+ * isochronous pair.
+ *
+ *<pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ---------------------------------------------------------
+ * 1.4   ag  10/14/26  First release
+ *
+ *</pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xparameters.h"		/* XPAR parameters */
+#include "xusb_ch9_bench.h"
+#include "xusb_class_bench.h"
+
+/************************** Constant Definitions *****************************/
+#define BENCH_SS_COMP_DESC		0x30U
+
+/* Largest configuration descriptor, with SuperSpeed companions */
+#define BENCH_CFG_DESC_MAX	(sizeof(USB_STD_CFG_DESC) + \
+				 (2U * sizeof(USB_STD_IF_DESC)) + \
+				 ((BENCH_NUM_BULK * 4U) + (BENCH_ISO * 2U)) * \
+				 (sizeof(USB_STD_EP_DESC) + \
+				  sizeof(USB_STD_EP_SS_COMP_DESC)))
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**************************** Type Definitions *******************************/
+
+/************************** Function Prototypes ******************************/
+static u8 *BenchAddIf(u8 *Ptr, u8 AltSetting, u8 NumEps);
+static u8 *BenchAddEp(u8 *Ptr, u8 Address, u8 Type, u16 MaxPktSize,
+		u8 IsSuper, u8 Burst, u16 BytesPerInterval);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device Descriptors
+ */
+USB_STD_DEV_DESC __attribute__ ((aligned(16))) deviceDesc[] = {
+	{/*
+	  * USB 2.0
+	  */
+		sizeof(USB_STD_DEV_DESC),	/* bLength */
+		USB_TYPE_DEVICE_DESC,	/* bDescriptorType */
+		0x0200,					/* bcdUSB 2.0 */
+		0x00,					/* bDeviceClass */
+		0x00,					/* bDeviceSubClass */
+		0x00,					/* bDeviceProtocol */
+		0x40,					/* bMaxPackedSize0 */
+		BENCH_VENDOR_ID,		/* idVendor */
+		BENCH_PRODUCT_ID,		/* idProduct */
+		0x0100,					/* bcdDevice */
+		0x01,					/* iManufacturer */
+		0x02,					/* iProduct */
+		0x03,					/* iSerialNumber */
+		0x01					/* bNumConfigurations */
+	},
+	{/*
+	  * USB 3.0
+	  */
+		sizeof(USB_STD_DEV_DESC),	/* bLength */
+		USB_TYPE_DEVICE_DESC,	/* bDescriptorType */
+		0x0300,					/* bcdUSB 3.0 */
+		0x00,					/* bDeviceClass */
+		0x00,					/* bDeviceSubClass */
+		0x00,					/* bDeviceProtocol */
+		0x09,					/* bMaxPackedSize0 */
+		BENCH_VENDOR_ID,		/* idVendor */
+		BENCH_PRODUCT_ID,		/* idProduct */
+		0x0100,					/* bcdDevice */
+		0x01,					/* iManufacturer */
+		0x02,					/* iProduct */
+		0x03,					/* iSerialNumber */
+		0x01					/* bNumConfigurations */
+	}
+};
+
+/*
+ * String Descriptors
+ */
+static u8 StringList[5][128] = {
+	"Xilinx standalone",
+	"Xilinx standalone",
+	"USB Benchmark",
+	"2A49876D9CC1AA4",
+	"Bench Source/Sink"
+};
+
+/*****************************************************************************/
+/**
+*
+* This function returns the device descriptor for the device.
+*
+* @param	InstancePtr is a pointer to the Usb_DevData instance.
+* @param	BufPtr is pointer to the buffer that is to be filled
+*			with the descriptor.
+* @param	BufLen is the size of the provided buffer.
+*
+* @return 	Length of the descriptor in the buffer on success.
+*			0 on error.
+*
+******************************************************************************/
+u32 Usb_Ch9SetupDevDescReply(struct Usb_DevData *InstancePtr,
+		u8 *BufPtr, u32 BufLen)
+{
+	u8 Index;
+
+	if (IsSuperSpeed(InstancePtr) != XST_SUCCESS) {
+		/* USB 2.0 */
+		Index = 0;
+	} else {
+		/* USB 3.0 */
+		Index = 1;
+	}
+
+	/* Check buffer pointer is there and buffer is big enough. */
+	if ((BufPtr == NULL) || (BufLen < sizeof(USB_STD_DEV_DESC))) {
+		return 0;
+	}
+
+	memcpy(BufPtr, &deviceDesc[Index], sizeof(USB_STD_DEV_DESC));
+
+	return sizeof(USB_STD_DEV_DESC);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the configuration descriptor for the device, built
+* for the current speed.
+*
+* @param	InstancePtr is a pointer to the Usb_DevData instance.
+* @param	BufPtr is the pointer to the buffer that is to be filled with
+*			the descriptor.
+* @param	BufLen is the size of the provided buffer.
+*
+* @return 	Length of the descriptor in the buffer on success.
+*			0 on error.
+*
+******************************************************************************/
+u32 Usb_Ch9SetupCfgDescReply(struct Usb_DevData *InstancePtr,
+		u8 *BufPtr, u32 BufLen)
+{
+	USB_STD_CFG_DESC Cfg;
+	u8 Config[BENCH_CFG_DESC_MAX];
+	u8 *Ptr = Config;
+	u8 IsSuper;
+	u16 MaxPktSize;
+	u8 NumAlt;
+	u8 Alt;
+	u8 Ep;
+	u32 CfgDescLen;
+
+	if (IsSuperSpeed(InstancePtr) != XST_SUCCESS) {
+		/* USB 2.0 */
+		IsSuper = 0U;
+		MaxPktSize = 512U;
+	} else {
+		/* USB 3.0 */
+		IsSuper = 1U;
+		MaxPktSize = 1024U;
+	}
+
+	/* Check buffer pointer is OK and buffer is big enough. */
+	if ((BufPtr == NULL) || (BufLen < BENCH_CFG_DESC_MAX)) {
+		return 0;
+	}
+
+	Ptr += sizeof(USB_STD_CFG_DESC);
+
+	NumAlt = (BENCH_ISO != 0U) ? 2U : 1U;
+	for (Alt = 0U; Alt < NumAlt; Alt++) {
+		Ptr = BenchAddIf(Ptr, Alt, (u8)((BENCH_NUM_BULK + Alt) * 2U));
+		for (Ep = 1U; Ep <= BENCH_NUM_BULK; Ep++) {
+			Ptr = BenchAddEp(Ptr, Ep | USB_ENDPOINT_DIR_MASK,
+					USB_EP_BULK, MaxPktSize, IsSuper,
+					0x0FU, 0U);
+			Ptr = BenchAddEp(Ptr, Ep, USB_EP_BULK, MaxPktSize,
+					IsSuper, 0x0FU, 0U);
+		}
+		if (Alt != 0U) {
+			Ptr = BenchAddEp(Ptr, BENCH_ISO_EP | USB_ENDPOINT_DIR_MASK,
+					USB_EP_ISOCHRONOUS, BENCH_ISO_MAX_PKT,
+					IsSuper, BENCH_ISO_SS_BURST,
+					BENCH_ISO_BUF_SIZE);
+			Ptr = BenchAddEp(Ptr, BENCH_ISO_EP,
+					USB_EP_ISOCHRONOUS, BENCH_ISO_MAX_PKT,
+					IsSuper, BENCH_ISO_SS_BURST,
+					BENCH_ISO_BUF_SIZE);
+		}
+	}
+	CfgDescLen = (u32)(Ptr - Config);
+
+	Cfg.bLength = sizeof(USB_STD_CFG_DESC);
+	Cfg.bType = USB_TYPE_CONFIG_DESC;
+	Cfg.wTotalLength = (u16)CfgDescLen;
+	Cfg.bNumberInterfaces = 0x01;
+	Cfg.bConfigValue = 0x01;
+	Cfg.bIConfigString = 0x00;
+	Cfg.bAttributes = 0xc0;
+	Cfg.bMaxPower = 0x00;
+	memcpy(Config, &Cfg, sizeof(Cfg));
+
+	memcpy(BufPtr, Config, CfgDescLen);
+
+	return CfgDescLen;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns a string descriptor for the given index.
+*
+* @param	InstancePtr is a pointer to the Usb_DevData instance.
+* @param	BufPtr is a  pointer to the buffer that is to be filled with
+*			the descriptor.
+* @param	BufLen is the size of the provided buffer.
+* @param	Index is the index of the string for which the descriptor
+*			is requested.
+*
+* @return 	Length of the descriptor in the buffer on success.
+*			0 on error.
+*
+******************************************************************************/
+u32 Usb_Ch9SetupStrDescReply(struct Usb_DevData *InstancePtr,
+		u8 *BufPtr,	u32 BufLen, u8 Index)
+{
+	u32 i;
+	char *String;
+	u32 StringLen;
+	u32 DescLen;
+	u8 TmpBuf[256];
+	USB_STD_STRING_DESC *StringDesc;
+
+	(void)InstancePtr;
+
+	if ((BufPtr == NULL) ||
+		(Index >= (sizeof(StringList) / sizeof(StringList[0])))) {
+		return 0;
+	}
+
+	String = (char *)&StringList[Index];
+	StringLen = strlen(String);
+
+	StringDesc = (USB_STD_STRING_DESC *) TmpBuf;
+
+	/* Index 0 is special as we can not represent the string required in
+	 * the table above. Therefore we handle index 0 as a special case.
+	 */
+	if (0 == Index) {
+		StringDesc->bLength = 4;
+		StringDesc->bDescriptorType = 0x03;
+		StringDesc->wLANGID[0] = 0x0409;
+	}
+	/* All other strings can be pulled from the table above. */
+	else {
+		StringDesc->bLength = StringLen * 2 + 2;
+		StringDesc->bDescriptorType = 0x03;
+
+		for (i = 0; i < StringLen; i++) {
+			StringDesc->wLANGID[i] = (u16) String[i];
+		}
+	}
+	DescLen = StringDesc->bLength;
+
+	/* Check if the provided buffer is big enough to hold the descriptor. */
+	if (DescLen > BufLen) {
+		return 0;
+	}
+
+	memcpy(BufPtr, StringDesc, DescLen);
+
+	return DescLen;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the BOS descriptor for the device.
+*
+* @param	BufPtr is the pointer to the buffer that is to be filled with
+*			the descriptor.
+* @param	BufLen is the size of the provided buffer.
+*
+* @return 	Length of the descriptor in the buffer on success.
+*			0 on error.
+*
+******************************************************************************/
+u32 Usb_Ch9SetupBosDescReply(u8 *BufPtr, u32 BufLen)
+{
+
+	USB_BOS_DESC __attribute__ ((aligned(16))) bosDesc = {
+		/* BOS descriptor */
+		{sizeof(USB_STD_BOS_DESC), /* bLength */
+		USB_TYPE_BOS_DESC, /* DescriptorType */
+		sizeof(USB_BOS_DESC), /* wTotalLength */
+		0x02}, /* bNumDeviceCaps */
+
+		{sizeof(USB_STD_DEVICE_CAP_7BYTE), /* bLength */
+		0x10, /* bDescriptorType */
+		0x02, /* bDevCapabiltyType */
+		0x06}, /* bmAttributes */
+
+		{sizeof(USB_STD_DEVICE_CAP_10BYTE), /* bLength */
+		0x10, /* bDescriptorType */
+		0x03, /* bDevCapabiltyType */
+		0x00, /* bmAttributes */
+		(0x000F), /* wSpeedsSupported */
+		0x01, /* bFunctionalitySupport */
+		0x01, /* bU1DevExitLat */
+		(0x01F4)} /* wU2DevExitLat */
+	};
+
+	/* Check buffer pointer is OK and buffer is big enough. */
+	if ((BufPtr == NULL) || (BufLen < sizeof(USB_BOS_DESC))) {
+		return 0;
+	}
+
+	memcpy(BufPtr, &bosDesc, sizeof(USB_BOS_DESC));
+
+	return sizeof(USB_BOS_DESC);
+}
+
+/****************************************************************************/
+/**
+* Changes State of Core to USB configured State.
+*
+* @param	InstancePtr is a pointer to the Usb_DevData instance.
+* @param	Ctrl is a pointer to the Setup packet data.
+*
+* @return	XST_SUCCESS else XST_FAILURE
+*
+* @note		None.
+*
+*****************************************************************************/
+s32 Usb_SetConfiguration(struct Usb_DevData *InstancePtr, SetupPacket *Ctrl)
+{
+	u8 State;
+	s32 Ret = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Ctrl != NULL);
+
+	State = InstancePtr->State;
+	SetConfigDone(InstancePtr->PrivateData, 0U);
+
+	switch (State) {
+		case USB_STATE_DEFAULT:
+			Ret = XST_FAILURE;
+			break;
+
+		case USB_STATE_ADDRESS:
+			InstancePtr->State = USB_STATE_CONFIGURED;
+			break;
+
+		case USB_STATE_CONFIGURED:
+			break;
+
+		default:
+			Ret = XST_FAILURE;
+			break;
+	}
+
+	return Ret;
+}
+
+/****************************************************************************/
+/**
+* This function is called by Chapter9 handler when SET_CONFIGURATION command
+* is received from Host. It enables the bulk endpoints, the isochronous
+* endpoints are enabled by alternate setting 1.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+* @param	SetupData is the setup packet received from Host.
+*
+* @return
+*		- XST_SUCCESS if successful,
+*		- XST_FAILURE if unsuccessful.
+*
+* @note		A running benchmark is stopped.
+*
+*****************************************************************************/
+s32 Usb_SetConfigurationApp(struct Usb_DevData *InstancePtr,
+								 SetupPacket *SetupData)
+{
+	s32 RetVal;
+	u16 MaxPktSize;
+	u8 Ep;
+
+	if(InstancePtr->Speed == USB_SPEED_SUPER) {
+		MaxPktSize = 1024;
+	} else {
+		MaxPktSize = 512;
+	}
+
+	BenchStop(InstancePtr);
+
+	for (Ep = 1U; Ep <= BENCH_NUM_BULK; Ep++) {
+		if ((SetupData->wValue & 0xff) ==  1) {
+			/* SET_CONFIGURATION with value 1 */
+			RetVal = EpEnable(InstancePtr->PrivateData, Ep,
+					USB_EP_DIR_IN, MaxPktSize,
+					USB_EP_TYPE_BULK);
+			if (RetVal == XST_SUCCESS) {
+				RetVal = EpEnable(InstancePtr->PrivateData,
+						Ep, USB_EP_DIR_OUT,
+						MaxPktSize, USB_EP_TYPE_BULK);
+			}
+		} else {
+			/* SET_CONFIGURATION with value 0 */
+			RetVal = EpDisable(InstancePtr->PrivateData, Ep,
+					USB_EP_DIR_IN);
+			if (RetVal == XST_SUCCESS) {
+				RetVal = EpDisable(InstancePtr->PrivateData,
+						Ep, USB_EP_DIR_OUT);
+			}
+		}
+		if (RetVal != XST_SUCCESS) {
+			xil_printf("failed to configure BULK Ep %d\r\n", Ep);
+			return XST_FAILURE;
+		}
+	}
+
+	SetConfigDone(InstancePtr->PrivateData,
+			((SetupData->wValue & 0xff) == 1) ? 1U : 0U);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends an interface descriptor to the configuration.
+*
+* @param	Ptr is where the descriptor goes.
+* @param	AltSetting is the alternate setting.
+* @param	NumEps is the number of endpoints.
+*
+* @return	Pointer past the descriptor.
+*
+******************************************************************************/
+static u8 *BenchAddIf(u8 *Ptr, u8 AltSetting, u8 NumEps)
+{
+	USB_STD_IF_DESC If;
+
+	If.bLength = sizeof(USB_STD_IF_DESC);
+	If.bDescriptorType = USB_TYPE_INTERFACE_DESC;
+	If.bInterfaceNumber = 0x00;
+	If.bAlternateSetting = AltSetting;
+	If.bNumEndPoints = NumEps;
+	If.bInterfaceClass = USB_CLASS_VENDOR;
+	If.bInterfaceSubClass = 0x00;
+	If.bInterfaceProtocol = 0x00;
+	If.iInterface = 0x04;
+	memcpy(Ptr, &If, sizeof(If));
+
+	return Ptr + sizeof(If);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends an endpoint descriptor, and its SuperSpeed companion
+* at SuperSpeed, to the configuration.
+*
+* @param	Ptr is where the descriptor goes.
+* @param	Address is the endpoint address.
+* @param	Type is USB_EP_BULK or USB_EP_ISOCHRONOUS.
+* @param	MaxPktSize is wMaxPacketSize.
+* @param	IsSuper is 1 at SuperSpeed.
+* @param	Burst is bMaxBurst of the companion.
+* @param	BytesPerInterval is wBytesPerInterval of the companion.
+*
+* @return	Pointer past the descriptors.
+*
+******************************************************************************/
+static u8 *BenchAddEp(u8 *Ptr, u8 Address, u8 Type, u16 MaxPktSize,
+		u8 IsSuper, u8 Burst, u16 BytesPerInterval)
+{
+	USB_STD_EP_DESC Ep;
+	USB_STD_EP_SS_COMP_DESC Comp;
+
+	Ep.bLength = sizeof(USB_STD_EP_DESC);
+	Ep.bDescriptorType = USB_TYPE_ENDPOINT_CFG_DESC;
+	Ep.bEndpointAddress = Address;
+	Ep.bmAttributes = Type;
+	Ep.bMaxPacketSizeL = (u8)MaxPktSize;
+	Ep.bMaxPacketSizeH = (u8)(MaxPktSize >> 8);
+	/* Isochronous endpoints are serviced every (micro)frame */
+	Ep.bInterval = (Type == USB_EP_ISOCHRONOUS) ? 0x01 : 0x00;
+	memcpy(Ptr, &Ep, sizeof(Ep));
+	Ptr += sizeof(Ep);
+
+	if (IsSuper != 0U) {
+		Comp.bLength = sizeof(USB_STD_EP_SS_COMP_DESC);
+		Comp.bDescriptorType = BENCH_SS_COMP_DESC;
+		Comp.bMaxBurst = Burst;
+		Comp.bmAttributes = 0x00;
+		Comp.wBytesPerInterval = BytesPerInterval;
+		memcpy(Ptr, &Comp, sizeof(Comp));
+		Ptr += sizeof(Comp);
+	}
+
+	return Ptr;
+}
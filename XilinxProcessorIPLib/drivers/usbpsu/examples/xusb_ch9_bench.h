@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+ ******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xusb_ch9_bench.h
+ *
+ * This file contains definitions used in the benchmark specific chapter 9
+ * code.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.4   ag  10/14/26  First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#ifndef XUSB_CH9_BENCH_H
+#define XUSB_CH9_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xusb_ch9.h"
+
+/************************** Constant Definitions *****************************/
+#ifndef BENCH_VENDOR_ID
+#define BENCH_VENDOR_ID			0x03FDU
+#endif
+#ifndef BENCH_PRODUCT_ID
+#define BENCH_PRODUCT_ID		0x0510U
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+u32 Usb_Ch9SetupDevDescReply(struct Usb_DevData *InstancePtr,
+                                 u8 *BufPtr, u32 BufLen);
+u32 Usb_Ch9SetupCfgDescReply(struct Usb_DevData *InstancePtr,
+                                 u8 *BufPtr, u32 BufLen);
+u32 Usb_Ch9SetupBosDescReply(u8 *BufPtr, u32 BufLen);
+u32 Usb_Ch9SetupStrDescReply(struct Usb_DevData *InstancePtr,
+                                 u8 *BufPtr, u32 BufLen, u8 Index);
+s32 Usb_SetConfiguration(struct Usb_DevData *InstancePtr, SetupPacket *Ctrl);
+s32 Usb_SetConfigurationApp(struct Usb_DevData *InstancePtr, SetupPacket *Ctrl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XUSB_CH9_BENCH_H */
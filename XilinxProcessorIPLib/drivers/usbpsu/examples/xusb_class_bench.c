@@ -0,0 +1,760 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+ ******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xusb_class_bench.c
+ *
+ * This file contains the implementation of a vendor class source/sink and
+ * loopback function, used to measure the throughput and the latency of the
+ * usbpsu driver.
+ *
+ * Each bulk endpoint has Depth requests of ReqSize bytes which are queued
+ * with XUsbPsu_EpQueueRequest() in batches of Batch requests. A completed
+ * request is queued again, on the same endpoint for the source and sink
+ * modes, or on the other endpoint of the pair in loopback mode, as soon as
+ * Batch completed requests are waiting or nothing is left on the ring. As
+ * only the last TRB of a batch interrupts, Batch is the interrupt
+ * moderation of the benchmark.
+ *
+ * The isochronous endpoints use XUsbPsu_EpBufferSend() and
+ * XUsbPsu_EpBufferRecv(), one interval per call, from the endpoint
+ * handlers.
+ *
+ * The counters are taken with Xil_TimelineNow(). Everything runs from the
+ * USB interrupt.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.4   ag  10/14/26  First release
+ *
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xusb_class_bench.h"
+#include "xparameters.h"
+#include "xil_timeline.h"
+
+/************************** Constant Definitions *****************************/
+#define BENCH_REPLY_LEN			64U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**************************** Type Definitions *******************************/
+/*
+ * A bulk request and its buffer. Ep is the endpoint the buffer is on.
+ */
+typedef struct {
+	struct XUsbPsu_Request Req;
+	u8 *Data;
+	u64 QueuedAt;
+	u32 Length;
+	u8 Ep;
+} BENCH_BUF;
+
+/*
+ * An endpoint. Pending holds the buffers waiting to be queued.
+ */
+typedef struct {
+	u8 EpNum;
+	u8 Dir;
+	u32 NumPending;
+	u32 InFlight;
+	BENCH_BUF *Pending[BENCH_MAX_DEPTH];
+	BENCH_STATS Stats;
+} BENCH_EP;
+
+/************************** Function Prototypes ******************************/
+static s32 BenchStart(void);
+static void BenchReset(BENCH_EP *Ep);
+static void BenchPush(u8 Index, BENCH_BUF *BufPtr);
+static void BenchFlush(BENCH_EP *Ep);
+static void BenchDone(void *CallBackRef, struct XUsbPsu_Request *Req);
+static void BenchAccount(BENCH_EP *Ep, u32 Length, u32 Actual, s32 Status,
+		u64 Now);
+static u32 BenchCheck(const u8 *Data, u32 Length);
+static void BenchReply(const void *Data, u32 Length, u16 wLength);
+
+/************************** Variable Definitions *****************************/
+static u8 BenchData[BENCH_NUM_BULK * 2U][BENCH_MAX_DEPTH][BENCH_BUF_SIZE]
+							ALIGNMENT_CACHELINE;
+static BENCH_BUF BenchBuf[BENCH_NUM_BULK * 2U][BENCH_MAX_DEPTH];
+
+#if BENCH_ISO != 0U
+/* The start of an isochronous transfer takes two intervals of the buffer */
+static u8 BenchIsoData[2][2U * BENCH_ISO_BUF_SIZE] ALIGNMENT_CACHELINE;
+static u8 BenchIsoAlt;
+#endif
+
+static BENCH_EP BenchEp[BENCH_NUM_EPS];
+static BENCH_PARAMS Params;
+
+/* Received by BENCH_REQ_SET_PARAMS, used by BENCH_REQ_START */
+static u8 ParamBuffer[BENCH_REPLY_LEN] ALIGNMENT_CACHELINE;
+static u8 Reply[BENCH_REPLY_LEN] ALIGNMENT_CACHELINE;
+
+static struct Usb_DevData *UsbDev;
+static u64 BenchStartedAt;
+static u8 BenchRunning;
+
+/*****************************************************************************/
+/**
+* This function initializes the benchmark with its default parameters: bulk
+* source and sink, 4 requests of BENCH_BUF_SIZE bytes per endpoint queued
+* one at a time.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void BenchInit(void)
+{
+	BENCH_PARAMS Default;
+	u32 Pair;
+	u32 Index;
+	u8 Ep;
+
+	for (Ep = 0U; Ep < BENCH_NUM_EPS; Ep++) {
+		BenchEp[Ep].EpNum = (u8)((Ep / 2U) + 1U);
+		BenchEp[Ep].Dir = ((Ep & 1U) != 0U) ? USB_EP_DIR_IN :
+							USB_EP_DIR_OUT;
+		BenchReset(&BenchEp[Ep]);
+	}
+
+	for (Pair = 0U; Pair < (BENCH_NUM_BULK * 2U); Pair++) {
+		for (Index = 0U; Index < BENCH_MAX_DEPTH; Index++) {
+			BenchBuf[Pair][Index].Data = BenchData[Pair][Index];
+			BenchBuf[Pair][Index].Req.Context =
+						&BenchBuf[Pair][Index];
+		}
+	}
+
+	memset(&Default, 0, sizeof(Default));
+	Default.BulkMode = BENCH_MODE_SINK | BENCH_MODE_SOURCE;
+	Default.Depth = (BENCH_MAX_DEPTH < 4U) ? BENCH_MAX_DEPTH : 4U;
+	Default.Batch = 1U;
+	Default.ReqSize = BENCH_BUF_SIZE;
+	Default.IsoSize = BENCH_ISO_BUF_SIZE;
+	memcpy(ParamBuffer, &Default, sizeof(Default));
+	Params = Default;
+	BenchRunning = 0U;
+}
+
+/*****************************************************************************/
+/**
+* This function handles the vendor requests of the benchmark protocol.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+* @param	SetupData is pointer to SetupPacket received.
+*
+* @return	None
+*
+* @note		Unknown or invalid requests stall the control endpoint.
+*
+******************************************************************************/
+void BenchVendorReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData)
+{
+	BENCH_INFO Info;
+	u8 Stall = 0U;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(SetupData   != NULL);
+
+	UsbDev = InstancePtr;
+
+	switch(SetupData->bRequest) {
+	case BENCH_REQ_GET_INFO:
+		Info.Version = BENCH_VERSION;
+		Info.NumBulk = (u8)BENCH_NUM_BULK;
+		Info.NumIso = (u8)BENCH_ISO;
+		Info.MaxDepth = (u8)BENCH_MAX_DEPTH;
+		Info.TrbPerEp = (u8)NO_OF_TRB_PER_EP;
+		Info.IsoBufSize = (u16)BENCH_ISO_BUF_SIZE;
+		Info.BufSize = BENCH_BUF_SIZE;
+		Info.CountsPerSecond = (u32)XIL_TIMELINE_COUNTS_PER_SECOND;
+		BenchReply(&Info, sizeof(Info), SetupData->wLength);
+		break;
+
+	case BENCH_REQ_SET_PARAMS:
+		if (SetupData->wLength != sizeof(BENCH_PARAMS)) {
+			Stall = 1U;
+			break;
+		}
+		EpBufferRecv(InstancePtr->PrivateData, 0, ParamBuffer,
+				sizeof(BENCH_PARAMS));
+		break;
+
+	case BENCH_REQ_START:
+		if (BenchStart() != XST_SUCCESS) {
+			Stall = 1U;
+			break;
+		}
+		/* For Control transfers, Status Phase is handled by driver */
+		EpBufferSend(InstancePtr->PrivateData, 0, NULL, 0);
+		break;
+
+	case BENCH_REQ_STOP:
+		BenchStop(InstancePtr);
+		EpBufferSend(InstancePtr->PrivateData, 0, NULL, 0);
+		break;
+
+	case BENCH_REQ_GET_STATS:
+		if (SetupData->wValue >= BENCH_NUM_EPS) {
+			Stall = 1U;
+			break;
+		}
+		BenchReply(&BenchEp[SetupData->wValue].Stats,
+				sizeof(BENCH_STATS), SetupData->wLength);
+		break;
+
+	default:
+		Stall = 1U;
+		break;
+	}
+
+	if (Stall != 0U) {
+		EpSetStall(InstancePtr->PrivateData, 0, USB_EP_DIR_OUT);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function is the set interface handler. Alternate setting 1 enables
+* the isochronous endpoints, alternate setting 0 disables them.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+* @param	SetupData is pointer to SetupPacket received.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+void BenchSetInterface(struct Usb_DevData *InstancePtr, SetupPacket *SetupData)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(SetupData   != NULL);
+
+	UsbDev = InstancePtr;
+
+#if BENCH_ISO != 0U
+	if ((SetupData->wValue == 1U) && (BenchIsoAlt == 0U)) {
+		SetEpInterval(InstancePtr->PrivateData, BENCH_ISO_EP,
+				USB_EP_DIR_IN, 1);
+		SetEpInterval(InstancePtr->PrivateData, BENCH_ISO_EP,
+				USB_EP_DIR_OUT, 1);
+		EpEnable(InstancePtr->PrivateData, BENCH_ISO_EP, USB_EP_DIR_IN,
+				BENCH_ISO_MAX_PKT, USB_EP_TYPE_ISOCHRONOUS);
+		EpEnable(InstancePtr->PrivateData, BENCH_ISO_EP, USB_EP_DIR_OUT,
+				BENCH_ISO_MAX_PKT, USB_EP_TYPE_ISOCHRONOUS);
+		BenchIsoAlt = 1U;
+	} else if ((SetupData->wValue == 0U) && (BenchIsoAlt != 0U)) {
+		BenchIsoAlt = 0U;
+		EpDisable(InstancePtr->PrivateData, BENCH_ISO_EP,
+				USB_EP_DIR_IN);
+		EpDisable(InstancePtr->PrivateData, BENCH_ISO_EP,
+				USB_EP_DIR_OUT);
+	}
+#else
+	(void)SetupData;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This function stops a running benchmark. The endpoints with queued
+* requests are disabled, which drops the requests, and enabled again.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+*
+* @return	None
+*
+* @note		The counters are kept until the next start.
+*
+******************************************************************************/
+void BenchStop(struct Usb_DevData *InstancePtr)
+{
+	u16 MaxPktSize;
+	u8 Ep;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	BenchRunning = 0U;
+
+	if (InstancePtr->Speed == USB_SPEED_SUPER) {
+		MaxPktSize = 1024;
+	} else {
+		MaxPktSize = 512;
+	}
+
+	for (Ep = 0U; Ep < (BENCH_NUM_BULK * 2U); Ep++) {
+		if (BenchEp[Ep].InFlight != 0U) {
+			EpDisable(InstancePtr->PrivateData, BenchEp[Ep].EpNum,
+					BenchEp[Ep].Dir);
+			EpEnable(InstancePtr->PrivateData, BenchEp[Ep].EpNum,
+					BenchEp[Ep].Dir, MaxPktSize,
+					USB_EP_TYPE_BULK);
+		}
+		BenchEp[Ep].InFlight = 0U;
+		BenchEp[Ep].NumPending = 0U;
+	}
+}
+
+/****************************************************************************/
+/**
+* This function is the handler of the isochronous IN endpoint. It is called
+* when the host polls an idle endpoint and when an interval has been sent,
+* and sends the next interval of the source.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	RequestedBytes is number of bytes requested to send, 0 when the
+*		host polls an idle endpoint.
+* @param	BytesTxed is actual number of bytes sent.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+void BenchIsoInHandler(void *CallBackRef, u32 RequestedBytes, u32 BytesTxed)
+{
+#if BENCH_ISO != 0U
+	BENCH_EP *Ep = &BenchEp[BENCH_STATS_INDEX(BENCH_NUM_BULK,
+						USB_EP_DIR_IN)];
+	u64 Now = Xil_TimelineNow();
+
+	(void)CallBackRef;
+
+	if ((BenchRunning == 0U) || (BenchIsoAlt == 0U) ||
+			((Params.IsoMode & BENCH_MODE_SOURCE) == 0U)) {
+		return;
+	}
+
+	if (RequestedBytes != 0U) {
+		BenchAccount(Ep, RequestedBytes, BytesTxed, XST_SUCCESS, Now);
+	}
+	if (EpBufferSend(UsbDev->PrivateData, BENCH_ISO_EP, BenchIsoData[1],
+				Params.IsoSize) != XST_SUCCESS) {
+		Ep->Stats.Errors++;
+	}
+	Ep->Stats.Busy += Xil_TimelineNow() - Now;
+#else
+	(void)CallBackRef;
+	(void)RequestedBytes;
+	(void)BytesTxed;
+#endif
+}
+
+/****************************************************************************/
+/**
+* This function is the handler of the isochronous OUT endpoint. It is called
+* when the host polls an idle endpoint and when an interval has been
+* received, and receives the next interval of the sink.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	RequestedBytes is number of bytes requested for reception, 0
+*		when the host polls an idle endpoint.
+* @param	BytesTxed is actual number of bytes received from Host.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+void BenchIsoOutHandler(void *CallBackRef, u32 RequestedBytes, u32 BytesTxed)
+{
+#if BENCH_ISO != 0U
+	BENCH_EP *Ep = &BenchEp[BENCH_STATS_INDEX(BENCH_NUM_BULK,
+						USB_EP_DIR_OUT)];
+	u64 Now = Xil_TimelineNow();
+
+	(void)CallBackRef;
+
+	if ((BenchRunning == 0U) || (BenchIsoAlt == 0U) ||
+			((Params.IsoMode & BENCH_MODE_SINK) == 0U)) {
+		return;
+	}
+
+	if (RequestedBytes != 0U) {
+		BenchAccount(Ep, RequestedBytes, BytesTxed, XST_SUCCESS, Now);
+	}
+	if (EpBufferRecv(UsbDev->PrivateData, BENCH_ISO_EP, BenchIsoData[0],
+				Params.IsoSize) != XST_SUCCESS) {
+		Ep->Stats.Errors++;
+	}
+	Ep->Stats.Busy += Xil_TimelineNow() - Now;
+#else
+	(void)CallBackRef;
+	(void)RequestedBytes;
+	(void)BytesTxed;
+#endif
+}
+
+/****************************************************************************/
+/**
+* This function starts a benchmark run with the parameters received by the
+* last BENCH_REQ_SET_PARAMS. The counters are cleared and the requests of
+* the bulk endpoints are queued. The isochronous endpoints start when the
+* host polls them.
+*
+* @param	None.
+*
+* @return	XST_SUCCESS, or XST_FAILURE if the device is not configured or
+*		the parameters are invalid.
+*
+* @note		None.
+*
+*****************************************************************************/
+static s32 BenchStart(void)
+{
+	BENCH_PARAMS New;
+	u32 Pair;
+	u32 Index;
+	u32 Byte;
+	u8 Ep;
+
+	memcpy(&New, ParamBuffer, sizeof(New));
+	if ((New.Depth == 0U) || (New.Depth > BENCH_MAX_DEPTH) ||
+			(New.Batch == 0U) || (New.Batch > New.Depth) ||
+			(New.ReqSize == 0U) || (New.ReqSize > BENCH_BUF_SIZE) ||
+			(New.IsoSize > BENCH_ISO_BUF_SIZE) ||
+			((New.IsoMode != 0U) && (New.IsoSize == 0U)) ||
+			((New.IsoMode & BENCH_MODE_LOOPBACK) != 0U) ||
+			(((New.BulkMode & BENCH_MODE_LOOPBACK) != 0U) &&
+			 (New.BulkMode != BENCH_MODE_LOOPBACK))) {
+		return XST_FAILURE;
+	}
+
+	if (GetConfigDone(UsbDev->PrivateData) == 0U) {
+		return XST_FAILURE;
+	}
+
+	BenchStop(UsbDev);
+	Params = New;
+
+	for (Ep = 0U; Ep < BENCH_NUM_EPS; Ep++) {
+		BenchReset(&BenchEp[Ep]);
+	}
+
+#if BENCH_ISO != 0U
+	if ((Params.IsoMode & BENCH_MODE_SOURCE) != 0U) {
+		for (Byte = 0U; Byte < (2U * BENCH_ISO_BUF_SIZE); Byte++) {
+			BenchIsoData[1][Byte] = (u8)(Byte % Params.IsoSize);
+		}
+	}
+#endif
+
+	BenchStartedAt = Xil_TimelineNow();
+	BenchRunning = 1U;
+
+	for (Pair = 0U; Pair < BENCH_NUM_BULK; Pair++) {
+		for (Index = 0U; Index < Params.Depth; Index++) {
+			if ((Params.BulkMode & (BENCH_MODE_SINK |
+					BENCH_MODE_LOOPBACK)) != 0U) {
+				Ep = (u8)BENCH_STATS_INDEX(Pair, USB_EP_DIR_OUT);
+				BenchBuf[Ep][Index].Length = Params.ReqSize;
+				BenchPush(Ep, &BenchBuf[Ep][Index]);
+			}
+			if ((Params.BulkMode & BENCH_MODE_SOURCE) != 0U) {
+				Ep = (u8)BENCH_STATS_INDEX(Pair, USB_EP_DIR_IN);
+				for (Byte = 0U; Byte < Params.ReqSize; Byte++) {
+					BenchBuf[Ep][Index].Data[Byte] =
+								(u8)Byte;
+				}
+				BenchBuf[Ep][Index].Length = Params.ReqSize;
+				BenchPush(Ep, &BenchBuf[Ep][Index]);
+			}
+		}
+		BenchFlush(&BenchEp[BENCH_STATS_INDEX(Pair, USB_EP_DIR_OUT)]);
+		BenchFlush(&BenchEp[BENCH_STATS_INDEX(Pair, USB_EP_DIR_IN)]);
+	}
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* This function clears the queue state and the counters of an endpoint.
+*
+* @param	Ep is the endpoint.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void BenchReset(BENCH_EP *Ep)
+{
+	Ep->NumPending = 0U;
+	Ep->InFlight = 0U;
+	memset(&Ep->Stats, 0, sizeof(Ep->Stats));
+	Ep->Stats.LatencyMin = 0xFFFFFFFFU;
+}
+
+/****************************************************************************/
+/**
+* This function adds a buffer to the buffers waiting to be queued on an
+* endpoint.
+*
+* @param	Index is the index of the endpoint in BenchEp.
+* @param	BufPtr is the buffer.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void BenchPush(u8 Index, BENCH_BUF *BufPtr)
+{
+	BENCH_EP *Ep = &BenchEp[Index];
+
+	BufPtr->Ep = Index;
+	Ep->Pending[Ep->NumPending] = BufPtr;
+	Ep->NumPending++;
+}
+
+/****************************************************************************/
+/**
+* This function queues the waiting buffers of an endpoint in batches of
+* Batch requests. Fewer requests are only queued when the endpoint has
+* nothing left on its ring, so that it never runs dry.
+*
+* @param	Ep is the endpoint.
+*
+* @return	None
+*
+* @note		A batch that does not fit the TRB ring waits for the next
+*		completion.
+*
+*****************************************************************************/
+static void BenchFlush(BENCH_EP *Ep)
+{
+	BENCH_BUF *BufPtr;
+	u32 Count;
+	u32 Index;
+	u64 Now;
+	s32 Status;
+
+	while ((Ep->NumPending != 0U) && ((Ep->NumPending >= Params.Batch) ||
+			(Ep->InFlight == 0U))) {
+		Count = (Ep->NumPending < Params.Batch) ? Ep->NumPending :
+							Params.Batch;
+		Now = Xil_TimelineNow();
+
+		/* The last Count waiting buffers, linked oldest first */
+		for (Index = 0U; Index < Count; Index++) {
+			BufPtr = Ep->Pending[Ep->NumPending - Count + Index];
+			BufPtr->Req.BufferPtr = BufPtr->Data;
+			BufPtr->Req.Length = BufPtr->Length;
+			BufPtr->Req.SgList = NULL;
+			BufPtr->Req.SgCount = 0U;
+			BufPtr->Req.Complete = BenchDone;
+			BufPtr->Req.Next = NULL;
+			BufPtr->QueuedAt = Now;
+			if (Index != 0U) {
+				Ep->Pending[Ep->NumPending - Count + Index - 1U]->
+						Req.Next = &BufPtr->Req;
+			}
+		}
+
+		Status = XUsbPsu_EpQueueRequest(
+				(struct XUsbPsu *)UsbDev->PrivateData, Ep->EpNum,
+				Ep->Dir,
+				&Ep->Pending[Ep->NumPending - Count]->Req);
+		if (Status != XST_SUCCESS) {
+			if ((Status != XST_DEVICE_BUSY) || (Ep->InFlight == 0U)) {
+				Ep->Stats.Errors++;
+			}
+			break;
+		}
+
+		Ep->NumPending -= Count;
+		Ep->InFlight += Count;
+		Ep->Stats.Batches++;
+	}
+}
+
+/****************************************************************************/
+/**
+* This function is the completion handler of the bulk requests. The buffer
+* is accounted for and queued again, on the other endpoint of the pair in
+* loopback mode.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	Req is the completed request.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void BenchDone(void *CallBackRef, struct XUsbPsu_Request *Req)
+{
+	BENCH_BUF *BufPtr = (BENCH_BUF *)Req->Context;
+	BENCH_EP *Ep = &BenchEp[BufPtr->Ep];
+	u64 Now = Xil_TimelineNow();
+	u64 Latency;
+	u8 Next = BufPtr->Ep;
+
+	(void)CallBackRef;
+
+	Ep->InFlight--;
+	if (BenchRunning == 0U) {
+		return;
+	}
+
+	BenchAccount(Ep, BufPtr->Length, Req->Actual, Req->Status, Now);
+
+	Latency = Now - BufPtr->QueuedAt;
+	if (Latency > 0xFFFFFFFFU) {
+		Latency = 0xFFFFFFFFU;
+	}
+	if ((u32)Latency < Ep->Stats.LatencyMin) {
+		Ep->Stats.LatencyMin = (u32)Latency;
+	}
+	if ((u32)Latency > Ep->Stats.LatencyMax) {
+		Ep->Stats.LatencyMax = (u32)Latency;
+	}
+	Ep->Stats.LatencySum += Latency;
+
+	if ((Ep->Dir == USB_EP_DIR_OUT) && (Params.Verify != 0U) &&
+			(Req->Status == XST_SUCCESS) &&
+			(BenchCheck(BufPtr->Data, Req->Actual) != 0U)) {
+		Ep->Stats.Errors++;
+	}
+
+	if ((Params.BulkMode & BENCH_MODE_LOOPBACK) != 0U) {
+		if ((Ep->Dir == USB_EP_DIR_OUT) &&
+				(Req->Status == XST_SUCCESS) &&
+				(Req->Actual != 0U)) {
+			/* Send back what has been received */
+			Next = BufPtr->Ep + 1U;
+			BufPtr->Length = Req->Actual;
+		} else {
+			Next = BufPtr->Ep & ~1U;
+			BufPtr->Length = Params.ReqSize;
+		}
+	}
+
+	BenchPush(Next, BufPtr);
+	BenchFlush(&BenchEp[Next]);
+
+	Ep->Stats.Busy += Xil_TimelineNow() - Now;
+}
+
+/****************************************************************************/
+/**
+* This function updates the byte and request counters of an endpoint.
+*
+* @param	Ep is the endpoint.
+* @param	Length is the size of the transfer.
+* @param	Actual is the number of bytes transferred.
+* @param	Status is the status of the transfer.
+* @param	Now is the time of the completion.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void BenchAccount(BENCH_EP *Ep, u32 Length, u32 Actual, s32 Status,
+		u64 Now)
+{
+	Ep->Stats.Requests++;
+	if (Status != XST_SUCCESS) {
+		Ep->Stats.Errors++;
+	} else {
+		Ep->Stats.Bytes += Actual;
+		if (Actual < Length) {
+			Ep->Stats.Short++;
+		}
+	}
+	Ep->Stats.Elapsed = Now - BenchStartedAt;
+}
+
+/****************************************************************************/
+/**
+* This function checks received data against the pattern of the source,
+* byte n of each transfer being n modulo 256.
+*
+* @param	Data is the received data.
+* @param	Length is the number of bytes received.
+*
+* @return	0 if the data matches, 1 otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 BenchCheck(const u8 *Data, u32 Length)
+{
+	u32 Byte;
+
+	for (Byte = 0U; Byte < Length; Byte++) {
+		if (Data[Byte] != (u8)Byte) {
+			return 1U;
+		}
+	}
+
+	return 0U;
+}
+
+/****************************************************************************/
+/**
+* This function sends the data stage of an IN vendor request.
+*
+* @param	Data is the reply.
+* @param	Length is the size of the reply.
+* @param	wLength is the number of bytes requested by the host.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void BenchReply(const void *Data, u32 Length, u16 wLength)
+{
+	if (Length > wLength) {
+		Length = wLength;
+	}
+
+	memcpy(Reply, Data, Length);
+	EpBufferSend(UsbDev->PrivateData, 0, Reply, Length);
+}
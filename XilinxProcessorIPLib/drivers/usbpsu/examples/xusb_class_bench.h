@@ -0,0 +1,210 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+ ******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xusb_class_bench.h
+ *
+ * This file contains definitions used in the vendor class throughput and
+ * latency benchmark.
+ *
+ * The host drives the benchmark with vendor requests to the interface
+ * (bmRequestType 0x41 for OUT, 0xC1 for IN, wIndex 0):
+ *
+ * - BENCH_REQ_GET_INFO (IN, BENCH_INFO): endpoint counts, limits and the
+ *   rate of the device counters.
+ * - BENCH_REQ_SET_PARAMS (OUT, BENCH_PARAMS): parameters of the next run,
+ *   taken into account by BENCH_REQ_START.
+ * - BENCH_REQ_START: clears the counters and queues the requests.
+ * - BENCH_REQ_STOP: drops the queued requests. The counters are kept.
+ * - BENCH_REQ_GET_STATS (IN, BENCH_STATS): counters of the endpoint with
+ *   index wValue, see BENCH_STATS_INDEX().
+ *
+ * A sweep repeats SET_PARAMS, START, a timed run of bulk (or isochronous)
+ * transfers from the host, STOP and GET_STATS for each endpoint, over the
+ * request sizes, queue depths and batch sizes to measure. The isochronous
+ * endpoints only exist in alternate setting 1 of the interface. All words
+ * are little endian.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.4   ag  10/14/26  First release
+ *
+ * </pre>
+ *
+ *****************************************************************************/
+
+#ifndef XUSB_CLASS_BENCH_H
+#define XUSB_CLASS_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xusb_ch9.h"
+
+/************************** Constant Definitions *****************************/
+/*
+ * Number of bulk IN/OUT endpoint pairs, on endpoints 1 to BENCH_NUM_BULK.
+ * The isochronous pair, if BENCH_ISO is not 0, is on endpoint
+ * BENCH_NUM_BULK + 1.
+ */
+#ifndef BENCH_NUM_BULK
+#define BENCH_NUM_BULK			1U
+#endif
+#ifndef BENCH_ISO
+#define BENCH_ISO			1U
+#endif
+#define BENCH_ISO_EP			(BENCH_NUM_BULK + 1U)
+#define BENCH_NUM_EPS			((BENCH_NUM_BULK + BENCH_ISO) * 2U)
+
+/*
+ * Isochronous packet size and SuperSpeed burst. One service interval
+ * carries BENCH_ISO_MAX_PKT * (BENCH_ISO_SS_BURST + 1) bytes at
+ * SuperSpeed and BENCH_ISO_MAX_PKT bytes at high speed.
+ */
+#ifndef BENCH_ISO_MAX_PKT
+#define BENCH_ISO_MAX_PKT		1024U
+#endif
+#ifndef BENCH_ISO_SS_BURST
+#define BENCH_ISO_SS_BURST		0U
+#endif
+#define BENCH_ISO_BUF_SIZE		(BENCH_ISO_MAX_PKT * \
+					 (BENCH_ISO_SS_BURST + 1U))
+
+/*
+ * Requests per bulk endpoint and their largest size. When the TRBs are
+ * not cache coherent each batch is padded to a cache line of TRBs, so
+ * deep queues with small batches need a larger NO_OF_TRB_PER_EP.
+ */
+#ifndef BENCH_MAX_DEPTH
+#define BENCH_MAX_DEPTH			8U
+#endif
+#ifndef BENCH_BUF_SIZE
+#define BENCH_BUF_SIZE			(16U * 1024U)
+#endif
+
+/* Vendor requests
+ */
+#define BENCH_REQ_GET_INFO		0x00U
+#define BENCH_REQ_SET_PARAMS		0x01U
+#define BENCH_REQ_START			0x02U
+#define BENCH_REQ_STOP			0x03U
+#define BENCH_REQ_GET_STATS		0x04U
+
+#define BENCH_VERSION			0x0100U
+
+/* Mode flags of BENCH_PARAMS
+ */
+#define BENCH_MODE_SINK			0x01U	/* OUT data is discarded */
+#define BENCH_MODE_SOURCE		0x02U	/* IN data is sent */
+#define BENCH_MODE_LOOPBACK		0x04U	/* OUT data is sent back, bulk
+						 * only */
+
+/* Index of the counters of an endpoint for BENCH_REQ_GET_STATS. Pair is
+ * 0 to BENCH_NUM_BULK - 1 for the bulk pairs, BENCH_NUM_BULK for the
+ * isochronous pair.
+ */
+#define BENCH_STATS_INDEX(Pair, Dir)	(((Pair) * 2U) + \
+					 (((Dir) == USB_EP_DIR_IN) ? 1U : 0U))
+
+/**************************** Type Definitions ******************************/
+/*
+ * Reply of BENCH_REQ_GET_INFO. Counts are in ticks of CountsPerSecond.
+ */
+typedef struct {
+	u16 Version;
+	u8 NumBulk;
+	u8 NumIso;
+	u8 MaxDepth;
+	u8 TrbPerEp;			/* NO_OF_TRB_PER_EP */
+	u16 IsoBufSize;
+	u32 BufSize;
+	u32 CountsPerSecond;
+} __attribute__((__packed__))BENCH_INFO;
+
+/*
+ * Data of BENCH_REQ_SET_PARAMS. Batch requests are queued together and
+ * only the last one interrupts on completion, so Batch trades interrupt
+ * rate against latency. ReqSize of a request larger than wMaxPacketSize
+ * that is not a multiple of it ends with a short packet.
+ */
+typedef struct {
+	u8 BulkMode;			/* BENCH_MODE_* */
+	u8 IsoMode;			/* BENCH_MODE_SINK/SOURCE */
+	u8 Depth;			/* Requests per endpoint, 1 to
+					 * BENCH_MAX_DEPTH */
+	u8 Batch;			/* Requests per queue call, 1 to Depth */
+	u32 ReqSize;			/* Bulk request size, up to BufSize */
+	u16 IsoSize;			/* Bytes per interval, up to
+					 * IsoBufSize */
+	u8 Verify;			/* OUT data is checked against the
+					 * pattern if not 0 */
+	u8 Reserved[5];
+} __attribute__((__packed__))BENCH_PARAMS;
+
+/*
+ * Reply of BENCH_REQ_GET_STATS. Elapsed runs from START to the last
+ * completion. Latency is from queueing a request to its completion and
+ * Busy is the time spent in the completion handlers.
+ */
+typedef struct {
+	u64 Bytes;
+	u32 Requests;
+	u32 Batches;			/* Queue calls */
+	u32 Short;			/* Requests shorter than queued */
+	u32 Errors;			/* Failed requests and bad data */
+	u64 Elapsed;
+	u64 Busy;
+	u32 LatencyMin;
+	u32 LatencyMax;
+	u64 LatencySum;
+} __attribute__((__packed__))BENCH_STATS;
+
+/************************** Function Prototypes ******************************/
+void BenchInit(void);
+void BenchVendorReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData);
+void BenchSetInterface(struct Usb_DevData *InstancePtr, SetupPacket *SetupData);
+void BenchStop(struct Usb_DevData *InstancePtr);
+void BenchIsoInHandler(void *CallBackRef, u32 RequestedBytes, u32 BytesTxed);
+void BenchIsoOutHandler(void *CallBackRef, u32 RequestedBytes, u32 BytesTxed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XUSB_CLASS_BENCH_H */
@@ -0,0 +1,958 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+ ******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xusb_class_storage_pipe.c
+ *
+ * This file contains the implementation of a pipelined Mass Storage class
+ * for the usbpsu driver.
+ *
+ * The data phase of READ(10) and WRITE(10) is split in STORAGE_BUF_SIZE
+ * chunks which go through STORAGE_NUM_BUFS buffers. A buffer read from the
+ * block device is queued on the bulk IN endpoint with
+ * XUsbPsu_EpQueueRequest() behind the buffers already on the bus, and is
+ * refilled from the block device as soon as it has been sent. For writes
+ * all free buffers are queued on the bulk OUT endpoint and each one is
+ * written to the block device when it has been received, then queued
+ * again. The USB and the block device transfers of a command thus overlap,
+ * and the TRB ring of the endpoint does not run dry between two chunks.
+ *
+ * CBW, data and CSW all go through queued requests, except the first CBW
+ * after SET_CONFIGURATION which is received by xusb_ch9_storage.c.
+ *
+ * The handlers run from the USB interrupt and from the interrupt of the
+ * block device, which must not preempt each other.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.4   ag  10/14/26  First release
+ *
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xusb_class_storage_pipe.h"
+#include "xparameters.h"
+#include "xusb_ch9_storage.h"
+
+/************************** Constant Definitions *****************************/
+#define STORAGE_CBW_SIGNATURE		0x43425355U
+#define STORAGE_CSW_SIGNATURE		0x53425355U
+#define STORAGE_CBW_LEN			31U
+#define STORAGE_CSW_LEN			13U
+#define STORAGE_SENSE_LEN		18U
+#define STORAGE_MAX_PKT_SIZE		1024U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**************************** Type Definitions *******************************/
+/*
+ * State of the command being processed.
+ */
+typedef struct {
+	u32 Length;		/* dCBWDataTransferLength */
+	u32 XferLeft;		/* Bytes of the data phase not queued yet */
+	u32 XferDone;		/* Bytes of the data phase transferred */
+	u32 IoBytes;		/* Bytes written to the block device */
+	u32 NextBlock;		/* Next block to transfer */
+	u32 DevBlocksLeft;	/* Blocks not submitted to the block device */
+	u8 DataIn;
+	u8 Failed;
+	u8 Active;
+} STORAGE_CMD;
+
+/************************** Function Prototypes ******************************/
+static void StorageParseCBW(u32 Length);
+static void StorageStartRW(u32 Block, u32 Count, u8 IsWrite);
+static void StorageStartData(void);
+static void StorageReadFill(STORAGE_BUF *BufPtr);
+static void StorageWriteFill(STORAGE_BUF *BufPtr);
+static void StorageReply(const u8 *Data, u32 Length);
+static void StorageFail(u8 Key, u8 Asc);
+static void StorageCheckDone(void);
+static void StorageSendCSW(void);
+static void StorageRecvCBW(void);
+static void StorageAbort(void);
+static s32 StorageQueue(u8 Dir, struct XUsbPsu_Request *Req, u8 *BufferPtr,
+		u32 Length, void (*Complete)(void *, struct XUsbPsu_Request *));
+static void StorageDataDone(void *CallBackRef, struct XUsbPsu_Request *Req);
+static void StorageReplyDone(void *CallBackRef, struct XUsbPsu_Request *Req);
+static void StorageZlpDone(void *CallBackRef, struct XUsbPsu_Request *Req);
+static void StorageCSWDone(void *CallBackRef, struct XUsbPsu_Request *Req);
+static void StorageCBWDone(void *CallBackRef, struct XUsbPsu_Request *Req);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Pre-manufactured response to the SCSI Inquiry command.
+ */
+const static SCSI_INQUIRY scsiInquiry ALIGNMENT_CACHELINE = {
+	0x00,
+	0x80,
+	0x00,
+	0x01,
+	0x1f,
+	0x00,
+	0x00,
+	0x00,
+	{"Xilinx  "},			/* Vendor ID:  must be  8 characters long. */
+	{"PS USB Disk     "},	/* Product ID: must be 16 characters long. */
+	{"1.00"}				/* Revision:   must be  4 characters long. */
+};
+
+static u8 MaxLUN ALIGNMENT_CACHELINE = 0;
+
+/* The first CBW is received here by xusb_ch9_storage.c */
+USB_CBW CBW ALIGNMENT_CACHELINE;
+static USB_CSW CSW ALIGNMENT_CACHELINE;
+
+/*
+ * CBWs are received in a buffer of a full packet, as the OUT request of a
+ * CBW is rounded up to the endpoint size.
+ */
+static u8 CbwBuffer[STORAGE_MAX_PKT_SIZE] ALIGNMENT_CACHELINE;
+
+/* Local transmit buffer for simple replies. */
+static u8 txBuffer[128] ALIGNMENT_CACHELINE;
+
+static u8 DataBuffer[STORAGE_NUM_BUFS][STORAGE_BUF_SIZE] ALIGNMENT_CACHELINE;
+static STORAGE_BUF StorageBuf[STORAGE_NUM_BUFS];
+
+static struct XUsbPsu_Request CbwReq;
+static struct XUsbPsu_Request CswReq;
+static struct XUsbPsu_Request ReplyReq;
+
+static STORAGE_DEV *StorageDev;
+static struct Usb_DevData *UsbDev;
+static STORAGE_CMD Cmd;
+static u32 CmdGen;
+static u8 SenseKey;
+static u8 SenseAsc;
+
+/*****************************************************************************/
+/**
+* This function initializes the Mass Storage class with its block device.
+*
+* @param	DevPtr is a pointer to the block device.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void StorageInit(STORAGE_DEV *DevPtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(DevPtr != NULL);
+	Xil_AssertVoid(DevPtr->Submit != NULL);
+
+	StorageDev = DevPtr;
+	for (Index = 0U; Index < STORAGE_NUM_BUFS; Index++) {
+		StorageBuf[Index].Data = DataBuffer[Index];
+		StorageBuf[Index].Index = (u8)Index;
+		StorageBuf[Index].State = STORAGE_BUF_FREE;
+		StorageBuf[Index].UsbReq.Context = &StorageBuf[Index];
+	}
+	Cmd.Active = 0U;
+}
+
+/*****************************************************************************/
+/**
+* This function is class handler for Mass storage and is called when
+* Setup packet received is for Class request(not Standard Device request)
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+* @param	SetupData is pointer to SetupPacket received.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+void StorageClassReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData)
+{
+	u16 MaxPktSize;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(SetupData   != NULL);
+
+	switch(SetupData->bRequest) {
+	case USB_CLASSREQ_MASS_STORAGE_RESET:
+		/*
+		 * Disabling the endpoints drops the queued requests, then
+		 * wait for the next CBW.
+		 */
+		UsbDev = InstancePtr;
+		if (InstancePtr->Speed == USB_SPEED_SUPER) {
+			MaxPktSize = 1024;
+		} else {
+			MaxPktSize = 512;
+		}
+		EpDisable(InstancePtr->PrivateData, 1, USB_EP_DIR_IN);
+		EpDisable(InstancePtr->PrivateData, 1, USB_EP_DIR_OUT);
+		EpEnable(InstancePtr->PrivateData, 1, USB_EP_DIR_IN,
+				MaxPktSize, USB_EP_TYPE_BULK);
+		EpEnable(InstancePtr->PrivateData, 1, USB_EP_DIR_OUT,
+				MaxPktSize, USB_EP_TYPE_BULK);
+		StorageAbort();
+		StorageRecvCBW();
+
+		/* For Control transfers, Status Phase is handled by driver */
+		EpBufferSend(InstancePtr->PrivateData, 0, NULL, 0);
+		break;
+
+	case USB_CLASSREQ_GET_MAX_LUN:
+		EpBufferSend(InstancePtr->PrivateData, 0, &MaxLUN, 1);
+		break;
+
+	default:
+		/*
+		 * Unsupported command. Stall the end point.
+		 */
+		EpSetStall(InstancePtr->PrivateData, 0, USB_EP_DIR_OUT);
+		break;
+	}
+}
+
+/****************************************************************************/
+/**
+* This function is the Bulk Out Endpoint handler for the CBW received after
+* SET_CONFIGURATION. The endpoints have been enabled again, so the state of
+* the previous configuration is dropped.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	RequestedBytes is number of bytes requested for reception.
+* @param	BytesTxed is actual number of bytes received from Host.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+void StorageBulkOutHandler(void *CallBackRef, u32 RequestedBytes,
+							u32 BytesTxed)
+{
+	(void)RequestedBytes;
+
+	UsbDev = (struct Usb_DevData *)CallBackRef;
+	StorageAbort();
+	StorageParseCBW(BytesTxed);
+}
+
+/****************************************************************************/
+/**
+* This function is called by the block device when the transfer of a buffer
+* has finished. A buffer that has been read is queued on the bulk IN
+* endpoint, a buffer that has been written is used to receive the next chunk
+* of the data phase.
+*
+* @param	BufPtr is a pointer to the buffer.
+* @param	Status is XST_SUCCESS or XST_FAILURE.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+void StorageDevDone(STORAGE_BUF *BufPtr, s32 Status)
+{
+	Xil_AssertVoid(BufPtr != NULL);
+
+	BufPtr->State = STORAGE_BUF_FREE;
+
+	/* Left over from a command that has been aborted */
+	if (BufPtr->Gen != CmdGen) {
+		return;
+	}
+
+	if (Status != XST_SUCCESS) {
+		StorageFail(SCSI_SENSE_MEDIUM_ERROR, (BufPtr->IsWrite != 0U) ?
+				SCSI_ASC_WRITE_ERROR : SCSI_ASC_READ_ERROR);
+	}
+
+	if (BufPtr->IsWrite != 0U) {
+		if (Status == XST_SUCCESS) {
+			Cmd.IoBytes += BufPtr->BlkCnt * STORAGE_BLOCK_SIZE;
+		}
+		StorageWriteFill(BufPtr);
+	} else if (Cmd.Failed == 0U) {
+		/*
+		 * Buffers complete in order, so nothing is sent after a
+		 * buffer which failed.
+		 */
+		if (StorageQueue(USB_EP_DIR_IN, &BufPtr->UsbReq, BufPtr->Data,
+				BufPtr->BlkCnt * STORAGE_BLOCK_SIZE,
+				StorageDataDone) == XST_SUCCESS) {
+			BufPtr->State = STORAGE_BUF_USB;
+		} else {
+			StorageFail(SCSI_SENSE_MEDIUM_ERROR, SCSI_ASC_READ_ERROR);
+		}
+	}
+
+	StorageCheckDone();
+}
+
+/*****************************************************************************/
+/**
+* This function handles Reduced Block Command (RBC) requests from the host.
+*
+* @param	Length is the number of bytes received in CBW.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void StorageParseCBW(u32 Length)
+{
+	SCSI_CAP_LIST *CapList;
+	SCSI_READ_CAPACITY *Cap;
+	SCSI_READ_WRITE *Rw;
+
+	if ((Length != STORAGE_CBW_LEN) ||
+	    (CBW.dCBWSignature != STORAGE_CBW_SIGNATURE)) {
+		/* Not a CBW, wait for the next one */
+		StorageRecvCBW();
+		return;
+	}
+
+	Cmd.Length = CBW.dCBWDataTransferLength;
+	Cmd.XferLeft = 0U;
+	Cmd.XferDone = 0U;
+	Cmd.IoBytes = 0U;
+	Cmd.DevBlocksLeft = 0U;
+	Cmd.DataIn = ((CBW.bmCBWFlags & 0x80U) != 0U) ? 1U : 0U;
+	Cmd.Failed = 0U;
+	Cmd.Active = 1U;
+
+	switch (CBW.CBWCB[0]) {
+	case USB_RBC_INQUIRY:
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: INQUIRY\r\n");
+#endif
+		StorageReply((const u8 *)&scsiInquiry, sizeof(scsiInquiry));
+		break;
+
+	case USB_UFI_GET_CAP_LIST:
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: CAPLIST\r\n");
+#endif
+		CapList = (SCSI_CAP_LIST *)txBuffer;
+		memset(CapList, 0, sizeof(SCSI_CAP_LIST));
+		CapList->listLength	= 8;
+		CapList->descCode	= 3;
+		CapList->numBlocks	= htonl(StorageDev->NumBlocks);
+		CapList->blockLength = htons(STORAGE_BLOCK_SIZE);
+		StorageReply(txBuffer, sizeof(SCSI_CAP_LIST));
+		break;
+
+	case USB_RBC_READ_CAP:
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: READCAP\r\n");
+#endif
+		Cap = (SCSI_READ_CAPACITY *)txBuffer;
+		Cap->numBlocks = htonl(StorageDev->NumBlocks - 1U);
+		Cap->blockSize = htonl(STORAGE_BLOCK_SIZE);
+		StorageReply(txBuffer, sizeof(SCSI_READ_CAPACITY));
+		break;
+
+	case USB_RBC_READ:
+	case USB_RBC_WRITE:
+		Rw = (SCSI_READ_WRITE *)&CBW.CBWCB;
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: %s Block 0x%08x Count %d\r\n",
+			(CBW.CBWCB[0] == USB_RBC_READ) ? "READ" : "WRITE",
+			htonl(Rw->block), htons(Rw->length));
+#endif
+		StorageStartRW(htonl(Rw->block), htons(Rw->length),
+				(CBW.CBWCB[0] == USB_RBC_WRITE) ? 1U : 0U);
+		break;
+
+	case USB_RBC_MODE_SENSE:
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: MODE SENSE\r\n");
+#endif
+		memcpy(txBuffer, "\003\000\000\000", 4);
+		StorageReply(txBuffer, 4);
+		break;
+
+	case USB_RBC_REQUEST_SENSE:
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: REQUEST_SENSE\r\n");
+#endif
+		memset(txBuffer, 0, STORAGE_SENSE_LEN);
+		txBuffer[0] = 0x70;		/* Current error, fixed format */
+		txBuffer[2] = SenseKey;
+		txBuffer[7] = STORAGE_SENSE_LEN - 8U;
+		txBuffer[12] = SenseAsc;
+		SenseKey = SCSI_SENSE_NONE;
+		SenseAsc = 0U;
+		StorageReply(txBuffer, STORAGE_SENSE_LEN);
+		break;
+
+	case USB_RBC_MODE_SELECT:
+	case USB_RBC_TEST_UNIT_READY:
+	case USB_RBC_MEDIUM_REMOVAL:
+	case USB_RBC_VERIFY:
+	case USB_RBC_STARTSTOP_UNIT:
+	case USB_SYNC_SCSI:
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: 0x%02x\r\n", CBW.CBWCB[0]);
+#endif
+		/* Nothing to do, MODE SELECT parameters are dropped */
+		StorageStartData();
+		break;
+
+	default:
+#ifdef CLASS_STORAGE_DEBUG
+		printf("SCSI: unsupported 0x%02x\r\n", CBW.CBWCB[0]);
+#endif
+		StorageFail(SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_INVALID_OPCODE);
+		StorageStartData();
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function starts the data phase of READ(10) or WRITE(10).
+*
+* @param	Block is the first block.
+* @param	Count is the number of blocks.
+* @param	IsWrite is 1 for WRITE(10), 0 for READ(10).
+*
+* @return	None.
+*
+* @note		A command that cannot be executed still goes through the
+*		data phase expected by the host, reads end with a short
+*		packet and written data is dropped.
+*
+******************************************************************************/
+static void StorageStartRW(u32 Block, u32 Count, u8 IsWrite)
+{
+	if ((Cmd.DataIn == IsWrite) ||
+	    (Cmd.Length != (Count * STORAGE_BLOCK_SIZE))) {
+		StorageFail(SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_INVALID_FIELD);
+	} else if ((Block >= StorageDev->NumBlocks) ||
+		   (Count > (StorageDev->NumBlocks - Block))) {
+		StorageFail(SCSI_SENSE_ILLEGAL_REQUEST,
+				SCSI_ASC_LBA_OUT_OF_RANGE);
+	} else {
+		Cmd.NextBlock = Block;
+		Cmd.DevBlocksLeft = Count;
+	}
+
+	StorageStartData();
+}
+
+/*****************************************************************************/
+/**
+* This function starts the data phase on all free buffers. For IN commands
+* the buffers are filled from the block device, for OUT commands they are
+* queued to receive the data of the host.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void StorageStartData(void)
+{
+	u32 Index;
+
+	if (Cmd.DataIn == 0U) {
+		Cmd.XferLeft = Cmd.Length;
+	}
+
+	for (Index = 0U; Index < STORAGE_NUM_BUFS; Index++) {
+		if (StorageBuf[Index].State != STORAGE_BUF_FREE) {
+			continue;
+		}
+		if (Cmd.DataIn != 0U) {
+			StorageReadFill(&StorageBuf[Index]);
+		} else {
+			StorageWriteFill(&StorageBuf[Index]);
+		}
+	}
+
+	StorageCheckDone();
+}
+
+/*****************************************************************************/
+/**
+* This function reads the next chunk of a READ(10) command from the block
+* device into a free buffer.
+*
+* @param	BufPtr is a pointer to the buffer.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void StorageReadFill(STORAGE_BUF *BufPtr)
+{
+	u32 Count;
+
+	if ((Cmd.Failed != 0U) || (Cmd.DevBlocksLeft == 0U)) {
+		return;
+	}
+
+	Count = Cmd.DevBlocksLeft;
+	if (Count > STORAGE_BUF_BLOCKS) {
+		Count = STORAGE_BUF_BLOCKS;
+	}
+
+	BufPtr->Block = Cmd.NextBlock;
+	BufPtr->BlkCnt = Count;
+	BufPtr->IsWrite = 0U;
+	BufPtr->Gen = CmdGen;
+	BufPtr->State = STORAGE_BUF_DEV;
+	Cmd.NextBlock += Count;
+	Cmd.DevBlocksLeft -= Count;
+
+	if (StorageDev->Submit(StorageDev->DevPtr, BufPtr) != XST_SUCCESS) {
+		StorageDevDone(BufPtr, XST_FAILURE);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function queues a free buffer on the bulk OUT endpoint to receive the
+* next chunk of the data phase.
+*
+* @param	BufPtr is a pointer to the buffer.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void StorageWriteFill(STORAGE_BUF *BufPtr)
+{
+	u32 Length;
+
+	if (Cmd.XferLeft == 0U) {
+		return;
+	}
+
+	Length = Cmd.XferLeft;
+	if (Length > STORAGE_BUF_SIZE) {
+		Length = STORAGE_BUF_SIZE;
+	}
+
+	BufPtr->IsWrite = 1U;
+	BufPtr->Gen = CmdGen;
+	if (StorageQueue(USB_EP_DIR_OUT, &BufPtr->UsbReq, BufPtr->Data, Length,
+				StorageDataDone) != XST_SUCCESS) {
+		StorageFail(SCSI_SENSE_MEDIUM_ERROR, SCSI_ASC_WRITE_ERROR);
+		Cmd.XferLeft = 0U;
+		return;
+	}
+
+	BufPtr->State = STORAGE_BUF_USB;
+	Cmd.XferLeft -= Length;
+}
+
+/*****************************************************************************/
+/**
+* This function is called when the USB transfer of a data buffer has
+* completed. A buffer that has been sent is refilled from the block device,
+* a buffer that has been received is written to it.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	Req is the request of the buffer.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void StorageDataDone(void *CallBackRef, struct XUsbPsu_Request *Req)
+{
+	STORAGE_BUF *BufPtr = (STORAGE_BUF *)Req->Context;
+
+	(void)CallBackRef;
+
+	BufPtr->State = STORAGE_BUF_FREE;
+	if ((Req->Status != XST_SUCCESS) || (BufPtr->Gen != CmdGen)) {
+		return;
+	}
+
+	Cmd.XferDone += Req->Actual;
+
+	if (BufPtr->IsWrite == 0U) {
+		StorageReadFill(BufPtr);
+	} else {
+		if (Req->Actual != Req->Length) {
+			/* Short packet, the host has ended the data phase */
+			Cmd.XferLeft = 0U;
+			if (Cmd.DevBlocksLeft != 0U) {
+				StorageFail(SCSI_SENSE_ILLEGAL_REQUEST,
+						SCSI_ASC_INVALID_FIELD);
+			}
+		}
+
+		if ((Cmd.Failed == 0U) && (Cmd.DevBlocksLeft != 0U)) {
+			BufPtr->Block = Cmd.NextBlock;
+			BufPtr->BlkCnt = Req->Length / STORAGE_BLOCK_SIZE;
+			BufPtr->State = STORAGE_BUF_DEV;
+			Cmd.NextBlock += BufPtr->BlkCnt;
+			Cmd.DevBlocksLeft -= BufPtr->BlkCnt;
+
+			if (StorageDev->Submit(StorageDev->DevPtr, BufPtr) !=
+							XST_SUCCESS) {
+				StorageDevDone(BufPtr, XST_FAILURE);
+			}
+		} else {
+			/* Drop the data */
+			StorageWriteFill(BufPtr);
+		}
+	}
+
+	StorageCheckDone();
+}
+
+/*****************************************************************************/
+/**
+* This function sends a short reply in the data phase.
+*
+* @param	Data is the reply.
+* @param	Length is the length of the reply.
+*
+* @return	None.
+*
+* @note		The reply is cut to the length expected by the host.
+*
+******************************************************************************/
+static void StorageReply(const u8 *Data, u32 Length)
+{
+	if (Cmd.DataIn == 0U) {
+		StorageFail(SCSI_SENSE_ILLEGAL_REQUEST, SCSI_ASC_INVALID_FIELD);
+		StorageStartData();
+		return;
+	}
+
+	if (Length > Cmd.Length) {
+		Length = Cmd.Length;
+	}
+
+	if ((Length == 0U) || (StorageQueue(USB_EP_DIR_IN, &ReplyReq,
+				(u8 *)Data, Length, StorageReplyDone) !=
+							XST_SUCCESS)) {
+		StorageCheckDone();
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function is called when a short reply has been sent.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	Req is the request of the reply.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void StorageReplyDone(void *CallBackRef, struct XUsbPsu_Request *Req)
+{
+	(void)CallBackRef;
+
+	if (Req->Status != XST_SUCCESS) {
+		return;
+	}
+
+	Cmd.XferDone = Req->Actual;
+	StorageCheckDone();
+}
+
+/*****************************************************************************/
+/**
+* This function marks the command as failed, and sets the sense data
+* returned by the next REQUEST SENSE.
+*
+* @param	Key is the sense key.
+* @param	Asc is the additional sense code.
+*
+* @return	None.
+*
+* @note		The first error of a command is reported.
+*
+******************************************************************************/
+static void StorageFail(u8 Key, u8 Asc)
+{
+	if (Cmd.Failed == 0U) {
+		Cmd.Failed = 1U;
+		SenseKey = Key;
+		SenseAsc = Asc;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function ends the data phase once no buffer is in use any more. An IN
+* data phase shorter than expected by the host is ended with a zero length
+* packet when needed, then the CSW is sent.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void StorageCheckDone(void)
+{
+	u32 Index;
+	u32 MaxPktSize;
+
+	if (Cmd.Active == 0U) {
+		return;
+	}
+
+	for (Index = 0U; Index < STORAGE_NUM_BUFS; Index++) {
+		if (StorageBuf[Index].State != STORAGE_BUF_FREE) {
+			return;
+		}
+	}
+	if (Cmd.XferLeft != 0U) {
+		return;
+	}
+
+	Cmd.Active = 0U;
+
+	if (UsbDev->Speed == USB_SPEED_SUPER) {
+		MaxPktSize = 1024U;
+	} else {
+		MaxPktSize = 512U;
+	}
+
+	if ((Cmd.DataIn != 0U) && (Cmd.XferDone < Cmd.Length) &&
+	    ((Cmd.XferDone % MaxPktSize) == 0U)) {
+		if (StorageQueue(USB_EP_DIR_IN, &ReplyReq, txBuffer, 0U,
+				StorageZlpDone) == XST_SUCCESS) {
+			/* The CSW is sent after the zero length packet */
+			return;
+		}
+	}
+
+	StorageSendCSW();
+}
+
+/****************************************************************************/
+/**
+* This function is called when the zero length packet ending an IN data
+* phase has been sent.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	Req is the request of the packet.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void StorageZlpDone(void *CallBackRef, struct XUsbPsu_Request *Req)
+{
+	(void)CallBackRef;
+
+	if (Req->Status == XST_SUCCESS) {
+		StorageSendCSW();
+	}
+}
+
+/****************************************************************************/
+/**
+* This function is used to send SCSI Command Status Wrapper to Host.
+*
+* @param	None.
+*
+* @return	None
+*
+* @note		The residue of a failed OUT command counts the data that has
+*		not been written to the block device.
+*
+*****************************************************************************/
+static void StorageSendCSW(void)
+{
+	u32 Done;
+
+	if ((Cmd.Failed != 0U) && (Cmd.DataIn == 0U)) {
+		Done = Cmd.IoBytes;
+	} else {
+		Done = Cmd.XferDone;
+	}
+
+	CSW.dCSWSignature = STORAGE_CSW_SIGNATURE;
+	CSW.dCSWTag = CBW.dCBWTag;
+	CSW.dCSWDataResidue = Cmd.Length - Done;
+	CSW.bCSWStatus = Cmd.Failed;
+
+	if (StorageQueue(USB_EP_DIR_IN, &CswReq, (u8 *)&CSW, STORAGE_CSW_LEN,
+				StorageCSWDone) != XST_SUCCESS) {
+		xil_printf("Failed: CSW Tag 0x%08x\r\n", CSW.dCSWTag);
+	}
+}
+
+/****************************************************************************/
+/**
+* This function is called when the CSW has been sent, and waits for the
+* next CBW.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	Req is the request of the CSW.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void StorageCSWDone(void *CallBackRef, struct XUsbPsu_Request *Req)
+{
+	(void)CallBackRef;
+
+	if (Req->Status == XST_SUCCESS) {
+		StorageRecvCBW();
+	}
+}
+
+/****************************************************************************/
+/**
+* This function queues the reception of the next CBW.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void StorageRecvCBW(void)
+{
+	if (StorageQueue(USB_EP_DIR_OUT, &CbwReq, CbwBuffer, STORAGE_CBW_LEN,
+				StorageCBWDone) != XST_SUCCESS) {
+		xil_printf("Failed: CBW receive\r\n");
+	}
+}
+
+/****************************************************************************/
+/**
+* This function is called when a CBW has been received.
+*
+* @param	CallBackRef is pointer to Usb_DevData instance.
+* @param	Req is the request of the CBW.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void StorageCBWDone(void *CallBackRef, struct XUsbPsu_Request *Req)
+{
+	(void)CallBackRef;
+
+	if (Req->Status != XST_SUCCESS) {
+		return;
+	}
+
+	memcpy(&CBW, CbwBuffer, sizeof(CBW));
+	StorageParseCBW(Req->Actual);
+}
+
+/****************************************************************************/
+/**
+* This function drops the command in progress. Buffers still on the bus
+* have been dropped with the endpoint requests, buffers still on the block
+* device are released when their transfer completes.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void StorageAbort(void)
+{
+	u32 Index;
+
+	CmdGen++;
+	Cmd.Active = 0U;
+	Cmd.XferLeft = 0U;
+
+	for (Index = 0U; Index < STORAGE_NUM_BUFS; Index++) {
+		if (StorageBuf[Index].State == STORAGE_BUF_USB) {
+			StorageBuf[Index].State = STORAGE_BUF_FREE;
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+* This function queues a single buffer request on bulk endpoint 1.
+*
+* @param	Dir is direction of endpoint - USB_EP_DIR_IN/USB_EP_DIR_OUT.
+* @param	Req is the request. The Context of a data buffer request is
+*		the buffer.
+* @param	BufferPtr is the buffer.
+* @param	Length is the length of the buffer.
+* @param	Complete is the completion handler of the request.
+*
+* @return	XST_SUCCESS if the request is queued, or the error returned
+*		by XUsbPsu_EpQueueRequest().
+*
+* @note		None.
+*
+*****************************************************************************/
+static s32 StorageQueue(u8 Dir, struct XUsbPsu_Request *Req, u8 *BufferPtr,
+		u32 Length, void (*Complete)(void *, struct XUsbPsu_Request *))
+{
+	Req->BufferPtr = BufferPtr;
+	Req->Length = Length;
+	Req->SgList = NULL;
+	Req->SgCount = 0U;
+	Req->Complete = Complete;
+	Req->Next = NULL;
+
+	return XUsbPsu_EpQueueRequest((struct XUsbPsu *)UsbDev->PrivateData,
+					1U, Dir, Req);
+}
@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+ ******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xusb_class_storage_pipe.h
+ *
+ * This file contains definitions used in the pipelined Mass Storage class
+ * code.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.4   ag  10/14/26  First release
+ *
+ * </pre>
+ *
+ *****************************************************************************/
+
+#ifndef XUSB_CLASS_STORAGE_PIPE_H
+#define XUSB_CLASS_STORAGE_PIPE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xusb_ch9.h"
+#include "xusb_class_storage.h"
+
+/************************** Constant Definitions *****************************/
+#define STORAGE_BLOCK_SIZE		512U
+
+/*
+ * Number of data buffers and their size in blocks. While the data of one
+ * buffer is on the bus, the next buffer is read from or written to the
+ * block device. When the TRBs are not cache coherent each queued request
+ * takes XUSBPSU_TRBS_PER_CACHELINE ring entries, so STORAGE_NUM_BUFS must
+ * not be more than NO_OF_TRB_PER_EP / XUSBPSU_TRBS_PER_CACHELINE.
+ */
+#ifndef STORAGE_NUM_BUFS
+#define STORAGE_NUM_BUFS		2U
+#endif
+#ifndef STORAGE_BUF_BLOCKS
+#define STORAGE_BUF_BLOCKS		128U
+#endif
+#define STORAGE_BUF_SIZE		(STORAGE_BUF_BLOCKS * STORAGE_BLOCK_SIZE)
+
+/* Data buffer states
+ */
+#define STORAGE_BUF_FREE		0U
+#define STORAGE_BUF_DEV			1U	/* Block device transfer */
+#define STORAGE_BUF_USB			2U	/* USB transfer */
+
+/* SCSI sense keys and additional sense codes
+ */
+#define SCSI_SENSE_NONE			0x00U
+#define SCSI_SENSE_MEDIUM_ERROR		0x03U
+#define SCSI_SENSE_ILLEGAL_REQUEST	0x05U
+
+#define SCSI_ASC_WRITE_ERROR		0x0CU
+#define SCSI_ASC_READ_ERROR		0x11U
+#define SCSI_ASC_INVALID_OPCODE		0x20U
+#define SCSI_ASC_LBA_OUT_OF_RANGE	0x21U
+#define SCSI_ASC_INVALID_FIELD		0x24U
+
+/**************************** Type Definitions ******************************/
+/*
+ * A data buffer. Block and BlkCnt describe the block device transfer.
+ */
+typedef struct {
+	u8 *Data;
+	u32 Block;
+	u32 BlkCnt;
+	u32 Gen;			/* Command generation of the transfer */
+	u8 IsWrite;
+	u8 State;
+	u8 Index;
+	struct XUsbPsu_Request UsbReq;
+} STORAGE_BUF;
+
+/*
+ * Backing block device. Submit starts the transfer described by the buffer
+ * and StorageDevDone() is called when it has finished, either from Submit
+ * itself or later from an interrupt handler. Transfers must complete in
+ * the order they are submitted.
+ */
+typedef struct {
+	u32 NumBlocks;
+	s32 (*Submit)(void *DevPtr, STORAGE_BUF *BufPtr);
+	void *DevPtr;
+} STORAGE_DEV;
+
+/************************** Function Prototypes ******************************/
+void StorageInit(STORAGE_DEV *DevPtr);
+void StorageClassReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData);
+void StorageBulkOutHandler(void *CallBackRef, u32 RequestedBytes,
+							u32 BytesTxed);
+void StorageDevDone(STORAGE_BUF *BufPtr, s32 Status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XUSB_CLASS_STORAGE_PIPE_H */
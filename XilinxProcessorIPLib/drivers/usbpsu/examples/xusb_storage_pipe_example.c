@@ -0,0 +1,581 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+ ******************************************************************************/
+/****************************************************************************/
+/**
+ *
+ * @file xusb_storage_pipe_example.c
+ *
+ * This file implements the pipelined mass storage class example. The disk
+ * is the SD/eMMC card of STORAGE_SD_DEVICE_ID, accessed with the
+ * asynchronous API of the sdps driver, or a RAM disk when there is no SD
+ * controller or STORAGE_RAMDISK is defined.
+ *
+ * Unlike xusb_intr_example.c this example uses the request queue of the
+ * usbpsu driver and does not build for other USB controllers.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.4   ag  10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include <string.h>
+#include "xparameters.h"
+#include "xil_printf.h"
+#include "xusb_ch9_storage.h"
+#include "xusb_class_storage_pipe.h"
+#include "xusb_wrapper.h"
+#include "xil_exception.h"
+
+#ifdef __MICROBLAZE__
+#ifdef XPAR_INTC_0_DEVICE_ID
+#include "xintc.h"
+#endif /* XPAR_INTC_0_DEVICE_ID */
+#elif defined PLATFORM_ZYNQMP
+#include "xscugic.h"
+#endif
+
+#if defined(PLATFORM_ZYNQMP) && defined(XPAR_XSDPS_0_DEVICE_ID) && \
+	!defined(STORAGE_RAMDISK)
+#define STORAGE_SD
+#include "xsdps.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+#define MEMORY_SIZE (64 * 1024)
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+u8 Buffer[MEMORY_SIZE];
+#pragma data_alignment = 4
+#else
+u8 Buffer[MEMORY_SIZE] ALIGNMENT_CACHELINE;
+#endif
+
+#ifdef STORAGE_SD
+#ifndef STORAGE_SD_DEVICE_ID
+#define STORAGE_SD_DEVICE_ID	XPAR_XSDPS_0_DEVICE_ID
+#endif
+#ifndef STORAGE_SD_INTR_ID
+#define STORAGE_SD_INTR_ID	XPAR_XSDPS_0_INTR
+#endif
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static s32 SetupInterruptSystem(struct XUsbPsu *InstancePtr, u16 IntcDeviceID,
+		u16 USB_INTR_ID, void *IntcPtr);
+#ifdef STORAGE_SD
+static s32 SdInit(void);
+static s32 SdSubmit(void *DevPtr, STORAGE_BUF *BufPtr);
+static void SdDone(void *CallBackRef, XSdPs_Request *ReqPtr, s32 Status);
+#else
+static s32 RamSubmit(void *DevPtr, STORAGE_BUF *BufPtr);
+#endif
+
+/************************** Variable Definitions *****************************/
+struct Usb_DevData UsbInstance;
+
+Usb_Config *UsbConfigPtr;
+
+#ifdef __MICROBLAZE__
+#ifdef XPAR_INTC_0_DEVICE_ID
+XIntc	InterruptController;	/*XIntc interrupt controller instance */
+#endif /* XPAR_INTC_0_DEVICE_ID */
+#else
+XScuGic	InterruptController;	/* Interrupt controller instance */
+#endif
+
+#ifdef __MICROBLAZE__		/* MICROBLAZE */
+#ifdef	XPAR_INTC_0_DEVICE_ID
+#define	INTC_DEVICE_ID		XPAR_INTC_0_DEVICE_ID
+#define	USB_INT_ID		XPAR_AXI_INTC_0_ZYNQ_ULTRA_PS_E_0_PS_PL_IRQ_USB3_0_ENDPOINT_0_INTR
+#endif /* MICROBLAZE */
+#elif	defined	PLATFORM_ZYNQMP	/* ZYNQMP */
+#define	INTC_DEVICE_ID		XPAR_SCUGIC_SINGLE_DEVICE_ID
+#define	USB_INT_ID		XPAR_XUSBPS_0_INTR
+#define	USB_WAKEUP_INTR_ID	XPAR_XUSBPS_0_WAKE_INTR
+#else	/* OTHERS */
+#define	INTC_DEVICE_ID		0
+#define	USB_INT_ID		0
+#endif
+
+#ifdef STORAGE_SD
+static XSdPs SdInstance;
+static XSdPs_Async SdAsync;
+static XSdPs_Request SdReq[STORAGE_NUM_BUFS];
+#else
+/* Buffer for RAM disk space. */
+static u8 RamDisk[VFLASH_SIZE] ALIGNMENT_CACHELINE;
+#endif
+
+static STORAGE_DEV StorageDisk;
+
+/* Initialize a storage data structure */
+static USBCH9_DATA storage_data = {
+		.ch9_func = {
+				/* Set the chapter9 hooks */
+				.Usb_Ch9SetupDevDescReply =
+						Usb_Ch9SetupDevDescReply,
+				.Usb_Ch9SetupCfgDescReply =
+						Usb_Ch9SetupCfgDescReply,
+				.Usb_Ch9SetupBosDescReply =
+						Usb_Ch9SetupBosDescReply,
+				.Usb_Ch9SetupStrDescReply =
+						Usb_Ch9SetupStrDescReply,
+				.Usb_SetConfiguration =
+						Usb_SetConfiguration,
+				.Usb_SetConfigurationApp =
+						Usb_SetConfigurationApp,
+				/* hook the set interface handler */
+				.Usb_SetInterfaceHandler = NULL,
+				/* hook up storage class handler */
+				.Usb_ClassReq = StorageClassReq,
+				.Usb_GetDescReply = NULL,
+		},
+		.data_ptr = (void *)NULL,
+};
+
+/****************************************************************************/
+/**
+* This function is the main function of the USB pipelined mass storage
+* example.
+*
+* @param	None.
+*
+* @return
+*		- XST_SUCCESS if successful,
+*		- XST_FAILURE if unsuccessful.
+*
+* @note		None.
+*
+*
+*****************************************************************************/
+int main(void)
+{
+	s32 Status;
+
+	xil_printf("Pipelined Mass Storage Gadget Start...\r\n");
+
+#ifdef STORAGE_SD
+	Status = SdInit();
+	if (XST_SUCCESS != Status) {
+		xil_printf("SD card initialization failed\r\n");
+		return XST_FAILURE;
+	}
+#else
+	StorageDisk.NumBlocks = VFLASH_SIZE / STORAGE_BLOCK_SIZE;
+	StorageDisk.Submit = RamSubmit;
+	StorageDisk.DevPtr = RamDisk;
+#endif
+	StorageInit(&StorageDisk);
+
+	/* Initialize the USB driver so that it's ready to use,
+	 * specify the controller ID that is generated in xparameters.h
+	 */
+	UsbConfigPtr = LookupConfig(USB_DEVICE_ID);
+	if (NULL == UsbConfigPtr) {
+		return XST_FAILURE;
+	}
+
+	CacheInit();
+
+	/* We are passing the physical base address as the third argument
+	 * because the physical and virtual base address are the same in our
+	 * example.  For systems that support virtual memory, the third
+	 * argument needs to be the virtual base address.
+	 */
+	Status = CfgInitialize(&UsbInstance, UsbConfigPtr,
+					UsbConfigPtr->BaseAddress);
+	if (XST_SUCCESS != Status) {
+		return XST_FAILURE;
+	}
+
+	/* hook up chapter9 handler */
+	Set_Ch9Handler(UsbInstance.PrivateData, Ch9Handler);
+
+	/* Assign the data to usb driver */
+	Set_DrvData(UsbInstance.PrivateData, &storage_data);
+
+	EpConfigure(UsbInstance.PrivateData, 1, USB_EP_DIR_OUT,
+				USB_EP_TYPE_BULK);
+	EpConfigure(UsbInstance.PrivateData, 1, USB_EP_DIR_IN,
+				USB_EP_TYPE_BULK);
+
+	Status = ConfigureDevice(UsbInstance.PrivateData, &Buffer[0], MEMORY_SIZE);
+	if (XST_SUCCESS != Status) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * The first CBW after SET_CONFIGURATION is received with
+	 * EpBufferRecv(), everything else goes through queued requests.
+	 */
+	SetEpHandler(UsbInstance.PrivateData, 1, USB_EP_DIR_OUT,
+					StorageBulkOutHandler);
+
+	/* setup interrupts */
+	Status = SetupInterruptSystem(UsbInstance.PrivateData, INTC_DEVICE_ID,
+					USB_INT_ID, (void *)&InterruptController);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+#ifdef STORAGE_SD
+	/*
+	 * The SD interrupt keeps the priority of the USB interrupt, so that
+	 * the class handlers do not preempt each other.
+	 */
+	Status = XScuGic_Connect(&InterruptController, STORAGE_SD_INTR_ID,
+				(Xil_ExceptionHandler)XSdPs_AsyncIntrHandler,
+				(void *)&SdAsync);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	XScuGic_Enable(&InterruptController, STORAGE_SD_INTR_ID);
+#endif
+
+	/* Start the controller so that Host can see our device */
+	Usb_Start(UsbInstance.PrivateData);
+
+	while(1) {
+		/* Rest is taken care by interrupts */
+	}
+
+	return XST_SUCCESS;
+}
+
+#ifdef STORAGE_SD
+/****************************************************************************/
+/**
+* This function initializes the SD/eMMC card and its asynchronous I/O
+* context, and sets the size of the disk.
+*
+* @param	None.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static s32 SdInit(void)
+{
+	XSdPs_Config *SdConfig;
+	s32 Status;
+
+	SdConfig = XSdPs_LookupConfig(STORAGE_SD_DEVICE_ID);
+	if (NULL == SdConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XSdPs_CfgInitialize(&SdInstance, SdConfig,
+					SdConfig->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XSdPs_CardInitialize(&SdInstance);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XSdPs_AsyncInitialize(&SdAsync, &SdInstance);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	StorageDisk.NumBlocks = SdInstance.SectorCount;
+	StorageDisk.Submit = SdSubmit;
+	StorageDisk.DevPtr = &SdAsync;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* This function queues the read or write of a buffer on the SD/eMMC card.
+*
+* @param	DevPtr is a pointer to the asynchronous I/O context.
+* @param	BufPtr is a pointer to the buffer.
+*
+* @return	XST_SUCCESS if the request is queued, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static s32 SdSubmit(void *DevPtr, STORAGE_BUF *BufPtr)
+{
+	XSdPs_Request *ReqPtr = &SdReq[BufPtr->Index];
+
+	/* Standard capacity cards are byte addressed */
+	ReqPtr->Arg = BufPtr->Block;
+	if (SdInstance.HCS == 0U) {
+		ReqPtr->Arg *= XSDPS_BLK_SIZE_512_MASK;
+	}
+	ReqPtr->BlkCnt = BufPtr->BlkCnt;
+	ReqPtr->Buff = BufPtr->Data;
+	ReqPtr->IsWrite = BufPtr->IsWrite;
+	ReqPtr->Handler = SdDone;
+	ReqPtr->CallBackRef = BufPtr;
+
+	return XSdPs_AsyncSubmit((XSdPs_Async *)DevPtr, ReqPtr);
+}
+
+/****************************************************************************/
+/**
+* This function is the completion handler of the SD/eMMC requests.
+*
+* @param	CallBackRef is the buffer of the request.
+* @param	ReqPtr is the request.
+* @param	Status is XST_SUCCESS or XST_FAILURE.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void SdDone(void *CallBackRef, XSdPs_Request *ReqPtr, s32 Status)
+{
+	(void)ReqPtr;
+
+	StorageDevDone((STORAGE_BUF *)CallBackRef, Status);
+}
+#else
+/****************************************************************************/
+/**
+* This function copies a buffer from or to the RAM disk.
+*
+* @param	DevPtr is a pointer to the RAM disk.
+* @param	BufPtr is a pointer to the buffer.
+*
+* @return	XST_SUCCESS.
+*
+* @note		The transfer completes before the function returns.
+*
+*****************************************************************************/
+static s32 RamSubmit(void *DevPtr, STORAGE_BUF *BufPtr)
+{
+	u8 *DiskPtr = (u8 *)DevPtr + (BufPtr->Block * STORAGE_BLOCK_SIZE);
+
+	if (BufPtr->IsWrite != 0U) {
+		memcpy(DiskPtr, BufPtr->Data, BufPtr->BlkCnt * STORAGE_BLOCK_SIZE);
+	} else {
+		memcpy(BufPtr->Data, DiskPtr, BufPtr->BlkCnt * STORAGE_BLOCK_SIZE);
+	}
+
+	StorageDevDone(BufPtr, XST_SUCCESS);
+
+	return XST_SUCCESS;
+}
+#endif
+
+/**
+* This function setups the interrupt system such that interrupts can occur.
+* This function is application specific since the actual system may or may not
+* have an interrupt controller.  The USB controller could be
+* directly connected to a processor without an interrupt controller.
+* The user should modify this function to fit the application.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	IntcDeviceID is the unique ID of the interrupt controller
+* @param	USB_INTR_ID is the interrupt ID of the USB controller
+* @param	IntcPtr is a pointer to the interrupt controller
+*			instance.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static s32 SetupInterruptSystem(struct XUsbPsu *InstancePtr, u16 IntcDeviceID,
+		u16 USB_INTR_ID, void *IntcPtr)
+{
+	/*
+	 * This below is done to remove warnings which occur when usbpsu
+	 * driver is compiled for platforms other than MICROBLAZE or ZYNQMP
+	 */
+	(void)InstancePtr;
+	(void)IntcDeviceID;
+	(void)IntcPtr;
+
+#ifdef __MICROBLAZE__
+#ifdef XPAR_INTC_0_DEVICE_ID
+	s32 Status;
+
+	XIntc *IntcInstancePtr = (XIntc *)IntcPtr;
+
+	/*
+	 * Initialize the interrupt controller driver.
+	 */
+	Status = XIntc_Initialize(IntcInstancePtr, IntcDeviceID);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+
+	/*
+	 * Connect a device driver handler that will be called when an interrupt
+	 * for the USB device occurs.
+	 */
+	Status = XIntc_Connect(IntcInstancePtr, USB_INTR_ID,
+			       (Xil_ExceptionHandler)XUsbPsu_IntrHandler,
+			       (void *) InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Start the interrupt controller such that interrupts are enabled for
+	 * all devices that cause interrupts, specific real mode so that
+	 * the USB can cause interrupts through the interrupt controller.
+	 */
+	Status = XIntc_Start(IntcInstancePtr, XIN_REAL_MODE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Enable the interrupt for the USB.
+	 */
+	XIntc_Enable(IntcInstancePtr, USB_INTR_ID);
+
+	/*
+	 * Initialize the exception table
+	 */
+	Xil_ExceptionInit();
+
+	/*
+	 * Enable interrupts for Reset, Disconnect, ConnectionDone, Link State
+	 * Wakeup and Overflow events.
+	 */
+	XUsbPsu_EnableIntr(InstancePtr, XUSBPSU_DEVTEN_EVNTOVERFLOWEN |
+                        XUSBPSU_DEVTEN_WKUPEVTEN |
+                        XUSBPSU_DEVTEN_ULSTCNGEN |
+                        XUSBPSU_DEVTEN_CONNECTDONEEN |
+                        XUSBPSU_DEVTEN_USBRSTEN |
+                        XUSBPSU_DEVTEN_DISCONNEVTEN);
+
+	/*
+	 * Register the interrupt controller handler with the exception table
+	 */
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				(Xil_ExceptionHandler)XIntc_InterruptHandler,
+				IntcInstancePtr);
+#endif /* XPAR_INTC_0_DEVICE_ID */
+#elif defined PLATFORM_ZYNQMP
+	s32 Status;
+
+	XScuGic_Config *IntcConfig; /* The configuration parameters of the
+					interrupt controller */
+
+	XScuGic *IntcInstancePtr = (XScuGic *)IntcPtr;
+
+	/*
+	 * Initialize the interrupt controller driver
+	 */
+	IntcConfig = XScuGic_LookupConfig(IntcDeviceID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+								   IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Connect to the interrupt controller
+	 */
+	Status = XScuGic_Connect(IntcInstancePtr, USB_INTR_ID,
+							(Xil_ExceptionHandler)XUsbPsu_IntrHandler,
+							(void *)InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+#ifdef XUSBPSU_HIBERNATION_ENABLE
+	Status = XScuGic_Connect(IntcInstancePtr, USB_WAKEUP_INTR_ID,
+							(Xil_ExceptionHandler)XUsbPsu_WakeUpIntrHandler,
+							(void *)InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+#endif
+
+	/*
+	 * Enable the interrupt for the USB
+	 */
+	XScuGic_Enable(IntcInstancePtr, USB_INTR_ID);
+#ifdef XUSBPSU_HIBERNATION_ENABLE
+	XScuGic_Enable(IntcInstancePtr, USB_WAKEUP_INTR_ID);
+#endif
+
+	/*
+	 * Enable interrupts for Reset, Disconnect, ConnectionDone, Link State
+	 * Wakeup and Overflow events.
+	 */
+	XUsbPsu_EnableIntr(InstancePtr, XUSBPSU_DEVTEN_EVNTOVERFLOWEN |
+                        XUSBPSU_DEVTEN_WKUPEVTEN |
+                        XUSBPSU_DEVTEN_ULSTCNGEN |
+                        XUSBPSU_DEVTEN_CONNECTDONEEN |
+                        XUSBPSU_DEVTEN_USBRSTEN |
+                        XUSBPSU_DEVTEN_DISCONNEVTEN);
+
+#ifdef XUSBPSU_HIBERNATION_ENABLE
+	if (InstancePtr->HasHibernation)
+		XUsbPsu_EnableIntr(InstancePtr,
+				XUSBPSU_DEVTEN_HIBERNATIONREQEVTEN);
+#endif
+
+	/*
+	 * Connect the interrupt controller interrupt handler to the hardware
+	 * interrupt handling logic in the ARM processor.
+	 */
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+								(Xil_ExceptionHandler)XScuGic_InterruptHandler,
+								IntcInstancePtr);
+#endif /* PLATFORM_ZYNQMP */
+
+	/*
+	 * Enable interrupts in the ARM
+	 */
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
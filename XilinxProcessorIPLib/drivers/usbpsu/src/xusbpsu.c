@@ -47,6 +47,7 @@
 * 1.4	bk    12/01/18 Modify USBPSU driver code to fit USB common example code
 *		       for all USB IPs.
 *	myk   12/01/18 Added hibernation support for device mode
+*	ag    14/10/26 Added XUsbPsu_SetIntrModeration
 * </pre>
 *
 *****************************************************************************/
@@ -65,7 +66,7 @@
 
 
 /************************** Function Prototypes ******************************/
-
+static u32 XUsbPsu_HasImod(struct XUsbPsu *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -243,6 +244,15 @@ void XUsbPsu_EventBuffersSetup(struct XUsbPsu *InstancePtr)
 	XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTSIZ(0),
 			XUSBPSU_GEVNTSIZ_SIZE(sizeof(InstancePtr->EventBuffer)));
 	XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0), 0);
+
+	if (InstancePtr->ImodInterval != 0U) {
+		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_DEV_IMOD(0),
+			XUSBPSU_DEV_IMOD_INTERVAL(InstancePtr->ImodInterval));
+		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0),
+			XUSBPSU_GEVNTCOUNT_EHB);
+	} else if (XUsbPsu_HasImod(InstancePtr) != 0U) {
+		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_DEV_IMOD(0), 0U);
+	}
 }
 
 /*****************************************************************************/
@@ -266,6 +276,65 @@ void XUsbPsu_EventBuffersReset(struct XUsbPsu *InstancePtr)
 	XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0U), 0U);
 }
 
+/*****************************************************************************/
+/**
+* Checks whether the core has the device interrupt moderation register,
+* which is present from revision 3.00a.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance to be worked on.
+*
+* @return	1 if the register is present, otherwise 0.
+*
+******************************************************************************/
+static u32 XUsbPsu_HasImod(struct XUsbPsu *InstancePtr)
+{
+	u32 RegVal;
+
+	RegVal = XUsbPsu_ReadReg(InstancePtr, XUSBPSU_GSNPSID);
+	if (XUSBPSU_GSNPSID_REVISION(RegVal) < XUSBPSU_GSNPSID_REVISION_300A) {
+		return 0U;
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+* Sets the interrupt moderation interval. Once an interrupt has been handled
+* the core holds the next one back for at least the interval, the events
+* written meanwhile are then handled together.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance to be worked on.
+* @param	Interval is the minimum time between two interrupts, in 250 ns
+*		units. 0 disables the moderation.
+*
+* @return	XST_SUCCESS, or XST_NO_FEATURE if the core has no moderation
+*		register.
+*
+* @note		The event buffer has to be large enough for the events of an
+*		interval, see XUSBPSU_EVENT_MAX_NUM.
+*
+******************************************************************************/
+s32 XUsbPsu_SetIntrModeration(struct XUsbPsu *InstancePtr, u16 Interval)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (XUsbPsu_HasImod(InstancePtr) == 0U) {
+		return XST_NO_FEATURE;
+	}
+
+	InstancePtr->ImodInterval = Interval;
+	XUsbPsu_WriteReg(InstancePtr, XUSBPSU_DEV_IMOD(0),
+			XUSBPSU_DEV_IMOD_INTERVAL(Interval));
+	if (Interval == 0U) {
+		/* Nothing clears the busy flag once moderation is off */
+		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0),
+				XUSBPSU_GEVNTCOUNT_EHB);
+	}
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 * Reads data from Hardware Params Registers of Core.
@@ -479,6 +548,11 @@ s32 XUsbPsu_CfgInitialize(struct XUsbPsu *InstancePtr,
 	/* Map USB and Physical Endpoints */
 	XUsbPsu_InitializeEps(InstancePtr);
 
+	InstancePtr->ImodInterval = 0U;
+	if (XUsbPsu_HasImod(InstancePtr) != 0U) {
+		InstancePtr->ImodInterval = (u16)XUSBPSU_IMOD_INTERVAL;
+	}
+
 	XUsbPsu_EventBuffersSetup(InstancePtr);
 
 	XUsbPsu_SetMode(InstancePtr, XUSBPSU_GCTL_PRTCAP_DEVICE);
@@ -62,6 +62,10 @@
 *	vak   22/01/18 Added changes for supporting microblaze platform
 *	vak   13/03/18 Moved the setup interrupt system calls from driver to
 *		       example.
+*	ag    14/10/26 Made NO_OF_TRB_PER_EP configurable and added
+*		       XUsbPsu_EpQueueRequest for queued bulk transfers.
+*	ag    14/10/26 Made the event buffer size configurable and added
+*		       XUsbPsu_SetIntrModeration.
 *
 * </pre>
 *
@@ -100,12 +104,30 @@ extern "C" {
 
 /************************** Constant Definitions ****************************/
 
-#define NO_OF_TRB_PER_EP		2
+/*
+ * Depth of the TRB ring of each endpoint, which limits the number of TRBs
+ * queued with XUsbPsu_EpQueueRequest(). It can be overridden at compile time.
+ */
+#ifndef NO_OF_TRB_PER_EP
+#define NO_OF_TRB_PER_EP		8
+#endif
+
+/*
+ * Default interrupt moderation interval, in 250 ns units, applied by
+ * XUsbPsu_CfgInitialize() on cores which have the moderation register.
+ * 0 interrupts for every batch of events. It can be overridden at compile
+ * time.
+ */
+#ifndef XUSBPSU_IMOD_INTERVAL
+#define XUSBPSU_IMOD_INTERVAL		0U
+#endif
 
 #ifdef PLATFORM_ZYNQMP
 #define ALIGNMENT_CACHELINE		__attribute__ ((aligned(64)))
+#define XUSBPSU_TRBS_PER_CACHELINE	4U
 #else
 #define ALIGNMENT_CACHELINE		__attribute__ ((aligned(32)))
+#define XUSBPSU_TRBS_PER_CACHELINE	2U
 #endif
 
 #define	XUSBPSU_PHY_TIMEOUT		5000U /* in micro seconds */
@@ -191,8 +213,19 @@ extern "C" {
 
 #define XUSBPSU_ENDPOINTS_NUM			12U
 
+/*
+ * Number of events of the event buffer. Moderated interrupts let more events
+ * pile up between two interrupts, the buffer has to hold all of them. It can
+ * be overridden at compile time with a power of 2 up to 8192.
+ */
 #define XUSBPSU_EVENT_SIZE				4U       /* bytes */
+#ifndef XUSBPSU_EVENT_MAX_NUM
 #define XUSBPSU_EVENT_MAX_NUM			64U      /* 2 events/endpoint */
+#endif
+#if ((XUSBPSU_EVENT_MAX_NUM & (XUSBPSU_EVENT_MAX_NUM - 1U)) != 0U) || \
+	(XUSBPSU_EVENT_MAX_NUM > 8192U)
+#error "XUSBPSU_EVENT_MAX_NUM must be a power of 2 up to 8192"
+#endif
 #define XUSBPSU_EVENT_BUFFERS_SIZE		(XUSBPSU_EVENT_SIZE * \
 										XUSBPSU_EVENT_MAX_NUM)
 
@@ -333,6 +366,41 @@ typedef struct {
 } __attribute__ ((packed)) SetupPacket;
 #endif
 
+/**
+ * Scatter list entry of a queued transfer request
+ */
+struct XUsbPsu_SgEntry {
+	u8	*BufferPtr;		/**< Buffer location */
+	u32	Length;			/**< Length of the buffer */
+};
+
+/**
+ * Transfer request queued with XUsbPsu_EpQueueRequest
+ */
+struct XUsbPsu_Request {
+	u8	*BufferPtr;		/**< Buffer location, when SgList is NULL */
+	u32	Length;			/**< Length of the buffer */
+	const struct XUsbPsu_SgEntry *SgList;
+						/**< Scatter list, or NULL for a single
+						 *   buffer
+						 */
+	u32	SgCount;		/**< Number of entries in SgList */
+	void (*Complete)(void *, struct XUsbPsu_Request *);
+						/**< User handler called with AppData
+						 *   when the request completes
+						 */
+	void	*Context;		/**< User data of the request */
+	struct XUsbPsu_Request *Next;
+						/**< Next request of the same batch,
+						 *   used by the driver once queued
+						 */
+	u32	Actual;			/**< Bytes transferred, set on completion */
+	s32	Status;			/**< Status, set on completion */
+	u32	FirstTrb;		/**< First TRB used by the request */
+	u32	NumTrbs;		/**< Number of data TRBs */
+	u32	UsedTrbs;		/**< Number of ring entries used */
+};
+
 /**
  * Endpoint representation
  */
@@ -356,6 +424,9 @@ struct XUsbPsu_Ep {
 	u32	Interval;		/**< Data transfer service interval */
 	u32	TrbEnqueue;
 	u32	TrbDequeue;
+	u32	TrbsInUse;		/**< Ring entries used by queued requests */
+	struct XUsbPsu_Request *ReqHead;	/**< Oldest queued request */
+	struct XUsbPsu_Request *ReqTail;	/**< Newest queued request */
 	u16	MaxSize;		/**< Size of endpoint */
 	u16	CurUf;			/**< current microframe */
 	u8	*BufferPtr;		/**< Buffer location */
@@ -438,6 +509,7 @@ struct XUsbPsu {
 	u8 IsThreeStage;
 	u8 IsHibernated;                /**< Hibernated state */
 	u8 HasHibernation;              /**< Has hibernation support */
+	u16 ImodInterval;		/**< Interrupt moderation interval */
 	void *data_ptr;		/* pointer for storing applications data */
 };
 
@@ -628,6 +700,7 @@ void XUsbPsu_SetMode(struct XUsbPsu *InstancePtr, u32 Mode);
 void XUsbPsu_PhyReset(struct XUsbPsu *InstancePtr);
 void XUsbPsu_EventBuffersSetup(struct XUsbPsu *InstancePtr);
 void XUsbPsu_EventBuffersReset(struct XUsbPsu *InstancePtr);
+s32 XUsbPsu_SetIntrModeration(struct XUsbPsu *InstancePtr, u16 Interval);
 void XUsbPsu_CoreNumEps(struct XUsbPsu *InstancePtr);
 void XUsbPsu_cache_hwparams(struct XUsbPsu *InstancePtr);
 u32 XUsbPsu_ReadHwParams(struct XUsbPsu *InstancePtr, u8 RegIndex);
@@ -681,6 +754,8 @@ s32 XUsbPsu_EpBufferSend(struct XUsbPsu *InstancePtr, u8 UsbEp,
 				u8 *BufferPtr, u32 BufferLen);
 s32 XUsbPsu_EpBufferRecv(struct XUsbPsu *InstancePtr, u8 UsbEp,
 				u8 *BufferPtr, u32 Length);
+s32 XUsbPsu_EpQueueRequest(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir,
+				struct XUsbPsu_Request *Req);
 void XUsbPsu_EpSetStall(struct XUsbPsu *InstancePtr, u8 Epnum, u8 Dir);
 void XUsbPsu_EpClearStall(struct XUsbPsu *InstancePtr, u8 Epnum, u8 Dir);
 void XUsbPsu_SetEpHandler(struct XUsbPsu *InstancePtr, u8 Epnum,
@@ -47,6 +47,8 @@
 * 1.4	bk  12/01/18 Modify USBPSU driver code to fit USB common example code
 *		       for all USB IPs
 *	myk 12/01/18 Added hibernation support for device mode
+*	ag  14/10/26 Added XUsbPsu_EpQueueRequest to queue transfer requests
+*		     on the TRB ring of an endpoint
 * </pre>
 *
 *****************************************************************************/
@@ -62,6 +64,13 @@
 
 /************************** Function Prototypes ******************************/
 
+static u32 XUsbPsu_ReqTrbLength(const struct XUsbPsu_Ep *Ept,
+				const struct XUsbPsu_Request *Req, u32 Index);
+static void XUsbPsu_EpReqComplete(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept);
+static void XUsbPsu_EpReqFlush(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept);
+
 /************************** Variable Definitions *****************************/
 
 /****************************************************************************/
@@ -371,6 +380,9 @@ s32 XUsbPsu_EpEnable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
 	if (!InstancePtr->IsHibernated) {
 		Ept->TrbEnqueue	= 0;
 		Ept->TrbDequeue	= 0;
+		Ept->TrbsInUse	= 0U;
+		Ept->ReqHead	= NULL;
+		Ept->ReqTail	= NULL;
 	}
 
 	if (((Ept->EpStatus & XUSBPSU_EP_ENABLED) == 0U)
@@ -452,6 +464,9 @@ s32 XUsbPsu_EpDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir)
 	RegVal &= ~XUSBPSU_DALEPENA_EP(PhyEpNum);
 	XUsbPsu_WriteReg(InstancePtr, XUSBPSU_DALEPENA, RegVal);
 
+	/* Queued requests will not complete any more */
+	XUsbPsu_EpReqFlush(InstancePtr, Ept);
+
 	Ept->Type = 0U;
 	Ept->EpStatus = 0U;
 	Ept->MaxSize = 0U;
@@ -1089,6 +1104,17 @@ void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
 
 	Epnum = Event->Epnumber;
 	Ept = &InstancePtr->eps[Epnum];
+
+	/* Requests queued with XUsbPsu_EpQueueRequest */
+	if (Ept->ReqHead != NULL) {
+		if (Event->Endpoint_Event == XUSBPSU_DEPEVT_XFERCOMPLETE) {
+			Ept->EpStatus &= ~(XUSBPSU_EP_BUSY);
+			Ept->ResourceIndex = 0;
+		}
+		XUsbPsu_EpReqComplete(InstancePtr, Ept);
+		return;
+	}
+
 	Dir = Ept->Direction;
 	TrbPtr = &Ept->EpTrb[Ept->TrbDequeue];
 	Xil_AssertVoid(TrbPtr != NULL);
@@ -1174,4 +1200,424 @@ void XUsbPsu_EpXferNotReady(struct XUsbPsu *InstancePtr,
 		}
 	}
 }
+/****************************************************************************/
+/**
+* Queues a batch of transfer requests on a bulk or interrupt endpoint. The
+* requests are linked through their Next field and are added to the TRB ring
+* of the endpoint behind the requests already queued, so that the core moves
+* from one request to the next without waiting for software. Each request
+* is a single buffer or a scatter list, which is sent or received as one
+* transfer using chained TRBs. Only the last TRB of the batch interrupts on
+* completion, and the Complete handler of every request of the batch is
+* called from the interrupt handler once the core has released its TRBs.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEp is USB endpoint number.
+* @param	Dir is direction of endpoint - XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+* @param	Req is a pointer to the first request of the batch. The requests
+*		must not be modified until they complete.
+*
+* @return	XST_SUCCESS if the batch is queued,
+*		XST_DEVICE_BUSY if the ring has no room for the batch,
+*		XST_INVALID_PARAM if the endpoint or a request is invalid,
+*		XST_FAILURE if the endpoint command failed.
+*
+* @note		OUT buffers must have room for the length rounded up to the
+*		endpoint size, as for XUsbPsu_EpBufferRecv().
+*		The USB interrupt must not be serviced while this function
+*		runs, so it should be called from a Complete handler or with
+*		the interrupt disabled. XUsbPsu_EpBufferSend() and
+*		XUsbPsu_EpBufferRecv() must not be used on the same endpoint
+*		while requests are queued.
+*		When the TRBs are not cache coherent, each batch ends on a
+*		cache line boundary, padded with a link TRB, so that the core
+*		does not update TRBs in a cache line written by software.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpQueueRequest(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir,
+				struct XUsbPsu_Request *Req)
+{
+	u8	PhyEpNum;
+	u32	cmd;
+	u32	Count = 0U;
+	u32	Pad = 0U;
+	u32	End;
+	u32	First;
+	u32	Index;
+	u32	Length;
+	u32	Ctrl;
+	s32	RetVal;
+	u8	*BufferPtr;
+	struct XUsbPsu_Request *ReqPtr;
+	struct XUsbPsu_Request *LastReq = NULL;
+	struct XUsbPsu_Trb	*TrbPtr;
+	struct XUsbPsu_Ep *Ept;
+	struct XUsbPsu_EpParams *Params;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(UsbEp <= (u8)16U);
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+					  (Dir == XUSBPSU_EP_DIR_OUT));
+	Xil_AssertNonvoid(Req != NULL);
+
+	PhyEpNum = PhysicalEp(UsbEp, Dir);
+	if (PhyEpNum < 2U) {
+		return XST_INVALID_PARAM;
+	}
+
+	Ept = &InstancePtr->eps[PhyEpNum];
+	if (((Ept->EpStatus & XUSBPSU_EP_ENABLED) == 0U) ||
+	    ((Ept->Type != XUSBPSU_ENDPOINT_XFER_BULK) &&
+	     (Ept->Type != XUSBPSU_ENDPOINT_XFER_INT))) {
+		return XST_INVALID_PARAM;
+	}
+
+	/* Count the TRBs needed by the batch */
+	for (ReqPtr = Req; ReqPtr != NULL; ReqPtr = ReqPtr->Next) {
+		if (ReqPtr->SgList != NULL) {
+			if (ReqPtr->SgCount == 0U) {
+				return XST_INVALID_PARAM;
+			}
+			for (Index = 0U; Index < ReqPtr->SgCount; Index++) {
+				if ((ReqPtr->SgList[Index].BufferPtr == NULL) ||
+				    (ReqPtr->SgList[Index].Length >
+						XUSBPSU_TRB_SIZE_MASK)) {
+					return XST_INVALID_PARAM;
+				}
+			}
+			ReqPtr->NumTrbs = ReqPtr->SgCount;
+		} else {
+			if ((ReqPtr->BufferPtr == NULL) ||
+			    (ReqPtr->Length > XUSBPSU_TRB_SIZE_MASK)) {
+				return XST_INVALID_PARAM;
+			}
+			ReqPtr->NumTrbs = 1U;
+		}
+		Count += ReqPtr->NumTrbs;
+		LastReq = ReqPtr;
+	}
+
+	/* Keep the next batch out of the cache lines of this one */
+	End = (Ept->TrbEnqueue + Count) % NO_OF_TRB_PER_EP;
+	if ((InstancePtr->ConfigPtr->IsCacheCoherent == 0) &&
+	    ((End % XUSBPSU_TRBS_PER_CACHELINE) != 0U)) {
+		Pad = XUSBPSU_TRBS_PER_CACHELINE -
+				(End % XUSBPSU_TRBS_PER_CACHELINE);
+		if ((End + Pad) > NO_OF_TRB_PER_EP) {
+			Pad = NO_OF_TRB_PER_EP - End;
+		}
+	}
+
+	if ((Count + Pad) > (NO_OF_TRB_PER_EP - Ept->TrbsInUse)) {
+		return XST_DEVICE_BUSY;
+	}
+
+	First = Ept->TrbEnqueue;
+	for (ReqPtr = Req; ReqPtr != NULL; ReqPtr = ReqPtr->Next) {
+		ReqPtr->FirstTrb = Ept->TrbEnqueue;
+		ReqPtr->UsedTrbs = ReqPtr->NumTrbs;
+		ReqPtr->Actual = 0U;
+		ReqPtr->Status = XST_FAILURE;
+
+		for (Index = 0U; Index < ReqPtr->NumTrbs; Index++) {
+			if (ReqPtr->SgList != NULL) {
+				BufferPtr = ReqPtr->SgList[Index].BufferPtr;
+				Length = ReqPtr->SgList[Index].Length;
+			} else {
+				BufferPtr = ReqPtr->BufferPtr;
+				Length = ReqPtr->Length;
+			}
+
+			TrbPtr = &Ept->EpTrb[Ept->TrbEnqueue];
+			Ept->TrbEnqueue++;
+			if (Ept->TrbEnqueue == NO_OF_TRB_PER_EP)
+				Ept->TrbEnqueue = 0;
+
+			TrbPtr->BufferPtrLow  = (UINTPTR)BufferPtr;
+			TrbPtr->BufferPtrHigh  = ((UINTPTR)BufferPtr >> 16) >> 16;
+			TrbPtr->Size = XUsbPsu_ReqTrbLength(Ept, ReqPtr, Index);
+
+			Ctrl = XUSBPSU_TRBCTL_NORMAL | XUSBPSU_TRB_CTRL_HWO;
+			if (Index < (ReqPtr->NumTrbs - 1U)) {
+				Ctrl |= XUSBPSU_TRB_CTRL_CHN;
+			}
+			if (Dir == XUSBPSU_EP_DIR_OUT) {
+				/* Complete the request on a short packet */
+				Ctrl |= XUSBPSU_TRB_CTRL_ISP_IMI;
+			}
+			if ((ReqPtr == LastReq) &&
+			    (Index == (ReqPtr->NumTrbs - 1U))) {
+				Ctrl |= XUSBPSU_TRB_CTRL_IOC;
+			}
+			TrbPtr->Ctrl = Ctrl;
+
+			if (InstancePtr->ConfigPtr->IsCacheCoherent == 0) {
+				if (Dir == XUSBPSU_EP_DIR_IN) {
+					Xil_DCacheFlushRange((INTPTR)BufferPtr,
+								Length);
+				} else {
+					Xil_DCacheInvalidateRange(
+						(INTPTR)BufferPtr,
+						TrbPtr->Size);
+				}
+				Xil_DCacheFlushRange((INTPTR)TrbPtr,
+						sizeof(struct XUsbPsu_Trb));
+			}
+		}
+	}
+
+	if (Pad != 0U) {
+		/* Link over the rest of the cache line */
+		TrbPtr = &Ept->EpTrb[Ept->TrbEnqueue];
+		Ept->TrbEnqueue = (Ept->TrbEnqueue + Pad) % NO_OF_TRB_PER_EP;
+
+		memset(TrbPtr, 0x00, sizeof(struct XUsbPsu_Trb));
+		TrbPtr->BufferPtrLow = (UINTPTR)&Ept->EpTrb[Ept->TrbEnqueue];
+		TrbPtr->BufferPtrHigh =
+			((UINTPTR)&Ept->EpTrb[Ept->TrbEnqueue] >> 16) >> 16;
+		TrbPtr->Ctrl = XUSBPSU_TRBCTL_LINK_TRB | XUSBPSU_TRB_CTRL_HWO;
+
+		Xil_DCacheFlushRange((INTPTR)TrbPtr, sizeof(struct XUsbPsu_Trb));
+		LastReq->UsedTrbs += Pad;
+	}
+
+	Params = XUsbPsu_GetEpParams(InstancePtr);
+	Xil_AssertNonvoid(Params != NULL);
+	Params->Param0 = 0U;
+	Params->Param1 = (UINTPTR)&Ept->EpTrb[First];
+
+	if (Ept->EpStatus & XUSBPSU_EP_BUSY) {
+		cmd = XUSBPSU_DEPCMD_UPDATETRANSFER;
+		cmd |= XUSBPSU_DEPCMD_PARAM(Ept->ResourceIndex);
+	} else {
+		cmd = XUSBPSU_DEPCMD_STARTTRANSFER;
+		cmd |= XUSBPSU_DEPCMD_PARAM(Ept->CurUf);
+	}
+
+	RetVal = XUsbPsu_SendEpCmd(InstancePtr, UsbEp, Ept->Direction,
+								cmd, Params);
+	if (RetVal != XST_SUCCESS) {
+		/* Take the batch back from the ring */
+		Ept->TrbEnqueue = First;
+		for (Index = 0U; Index < (Count + Pad); Index++) {
+			TrbPtr = &Ept->EpTrb[(First + Index) % NO_OF_TRB_PER_EP];
+			TrbPtr->Ctrl &= ~XUSBPSU_TRB_CTRL_HWO;
+			if (InstancePtr->ConfigPtr->IsCacheCoherent == 0)
+				Xil_DCacheFlushRange((INTPTR)TrbPtr,
+						sizeof(struct XUsbPsu_Trb));
+		}
+		return XST_FAILURE;
+	}
+
+	if (!(Ept->EpStatus & XUSBPSU_EP_BUSY)) {
+		Ept->ResourceIndex = (u8)XUsbPsu_EpGetTransferIndex(InstancePtr,
+				Ept->UsbEpNum,
+				Ept->Direction);
+
+		Ept->EpStatus |= XUSBPSU_EP_BUSY;
+	}
+
+	/* Add the batch behind the queued requests */
+	if (Ept->ReqTail != NULL) {
+		Ept->ReqTail->Next = Req;
+	} else {
+		Ept->ReqHead = Req;
+	}
+	Ept->ReqTail = LastReq;
+	Ept->TrbsInUse += Count + Pad;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Returns the length programmed in a data TRB of a queued request. The last
+* TRB of an OUT request is rounded up so that the request is a multiple of
+* the endpoint size.
+*
+* @param	Ept is a pointer to the endpoint.
+* @param	Req is a pointer to the request.
+* @param	Index is the index of the TRB in the request.
+*
+* @return	Length of the TRB in bytes.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 XUsbPsu_ReqTrbLength(const struct XUsbPsu_Ep *Ept,
+				const struct XUsbPsu_Request *Req, u32 Index)
+{
+	u32 Total = 0U;
+	u32 Length;
+	u32 Entry;
+
+	if (Req->SgList == NULL) {
+		Length = Req->Length;
+		Total = Length;
+	} else {
+		Length = Req->SgList[Index].Length;
+		for (Entry = 0U; Entry < Req->SgCount; Entry++) {
+			Total += Req->SgList[Entry].Length;
+		}
+	}
+
+	/*
+	 * 8.2.5 - An OUT transfer size (Total TRB buffer allocation)
+	 * must be a multiple of MaxPacketSize.
+	 */
+	if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+	    (Index == (Req->NumTrbs - 1U)) &&
+	    ((Total == 0U) || (!IS_ALIGNED(Total, Ept->MaxSize)))) {
+		Length += (u32)roundup(Total, Ept->MaxSize) - Total;
+		if (Total == 0U) {
+			Length = Ept->MaxSize;
+		}
+	}
+
+	return Length;
+}
+
+/****************************************************************************/
+/**
+* Completes the queued requests whose TRBs have been released by the core,
+* in the order they were queued, and calls their Complete handlers.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the endpoint.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XUsbPsu_EpReqComplete(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept)
+{
+	struct XUsbPsu_Request *ReqPtr;
+	struct XUsbPsu_Trb *TrbPtr;
+	u32 Index;
+	u32 Trb;
+	u32 Length;
+	u32 Remaining;
+	u8 Done;
+
+	while (Ept->ReqHead != NULL) {
+		ReqPtr = Ept->ReqHead;
+		Trb = ReqPtr->FirstTrb;
+		Done = FALSE;
+		ReqPtr->Actual = 0U;
+
+		for (Index = 0U; Index < ReqPtr->NumTrbs; Index++) {
+			TrbPtr = &Ept->EpTrb[Trb];
+			if (InstancePtr->ConfigPtr->IsCacheCoherent == 0)
+				Xil_DCacheInvalidateRange((INTPTR)TrbPtr,
+						sizeof(struct XUsbPsu_Trb));
+
+			if ((TrbPtr->Ctrl & XUSBPSU_TRB_CTRL_HWO) != 0U)
+				break;
+
+			Length = XUsbPsu_ReqTrbLength(Ept, ReqPtr, Index);
+			Remaining = TrbPtr->Size & XUSBPSU_TRB_SIZE_MASK;
+			ReqPtr->Actual += Length - Remaining;
+
+			/*
+			 * The core skips the rest of the chain after a
+			 * short packet
+			 */
+			if ((Index == (ReqPtr->NumTrbs - 1U)) ||
+			    ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+			     (Remaining != 0U))) {
+				Done = TRUE;
+				break;
+			}
+
+			Trb++;
+			if (Trb == NO_OF_TRB_PER_EP)
+				Trb = 0U;
+		}
+
+		if (Done == FALSE)
+			break;
+
+		Ept->TrbsInUse -= ReqPtr->UsedTrbs;
+		Ept->TrbDequeue = (ReqPtr->FirstTrb + ReqPtr->UsedTrbs) %
+						NO_OF_TRB_PER_EP;
+		Ept->ReqHead = ReqPtr->Next;
+		if (Ept->ReqHead == NULL)
+			Ept->ReqTail = NULL;
+		ReqPtr->Next = NULL;
+
+		if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+		    (InstancePtr->ConfigPtr->IsCacheCoherent == 0)) {
+			if (ReqPtr->SgList == NULL) {
+				Xil_DCacheInvalidateRange(
+					(INTPTR)ReqPtr->BufferPtr,
+					ReqPtr->Actual);
+			} else {
+				for (Index = 0U; Index < ReqPtr->SgCount; Index++)
+					Xil_DCacheInvalidateRange(
+					(INTPTR)ReqPtr->SgList[Index].BufferPtr,
+					ReqPtr->SgList[Index].Length);
+			}
+		}
+
+		ReqPtr->Status = XST_SUCCESS;
+		if (ReqPtr->Complete != NULL) {
+			ReqPtr->Complete(InstancePtr->AppData, ReqPtr);
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+* Removes all the requests queued on an endpoint and calls their Complete
+* handlers with XST_FAILURE status.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the endpoint.
+*
+* @return	None.
+*
+* @note		The core must not be processing the TRBs of the endpoint.
+*
+*****************************************************************************/
+static void XUsbPsu_EpReqFlush(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept)
+{
+	struct XUsbPsu_Request *ReqPtr;
+	u32 Index;
+	u32 Trb;
+
+	if (Ept->ReqHead == NULL) {
+		return;
+	}
+
+	/* Release the TRBs so that the core does not process them later */
+	Trb = Ept->ReqHead->FirstTrb;
+	for (Index = 0U; Index < Ept->TrbsInUse; Index++) {
+		Ept->EpTrb[Trb].Ctrl &= ~XUSBPSU_TRB_CTRL_HWO;
+		if (InstancePtr->ConfigPtr->IsCacheCoherent == 0)
+			Xil_DCacheFlushRange((INTPTR)&Ept->EpTrb[Trb],
+					sizeof(struct XUsbPsu_Trb));
+		Trb++;
+		if (Trb == NO_OF_TRB_PER_EP)
+			Trb = 0U;
+	}
+
+	Ept->TrbEnqueue = Ept->ReqHead->FirstTrb;
+	Ept->TrbDequeue = Ept->ReqHead->FirstTrb;
+	Ept->TrbsInUse = 0U;
+
+	while (Ept->ReqHead != NULL) {
+		ReqPtr = Ept->ReqHead;
+		Ept->ReqHead = ReqPtr->Next;
+		ReqPtr->Next = NULL;
+		ReqPtr->Actual = 0U;
+		ReqPtr->Status = XST_FAILURE;
+		if (ReqPtr->Complete != NULL) {
+			ReqPtr->Complete(InstancePtr->AppData, ReqPtr);
+		}
+	}
+	Ept->ReqTail = NULL;
+}
 /** @} */
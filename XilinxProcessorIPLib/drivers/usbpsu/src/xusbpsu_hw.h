@@ -44,6 +44,7 @@
 * ----- -----  -------- -----------------------------------------------------
 * 1.0   sg    06/06/16 First release
 * 1.4   myk   12/01/18 Added support of hibernation
+*       ag    14/10/26 Added the interrupt moderation register
 *
 * </pre>
 *
@@ -139,6 +140,7 @@ extern "C" {
 #define XUSBPSU_DEPCMDPAR1(n)                   ((u32)0xc804 + ((u32)n * (u32)0x10))
 #define XUSBPSU_DEPCMDPAR0(n)                   ((u32)0xc808 + ((u32)n * (u32)0x10))
 #define XUSBPSU_DEPCMD(n)                       ((u32)0xc80c + ((u32)n * (u32)0x10))
+#define XUSBPSU_DEV_IMOD(n)                     ((u32)0xca00 + ((u32)(n) * (u32)0x04))
 
 /* OTG Registers */
 #define XUSBPSU_OCFG                            0x0000cc00U
@@ -193,6 +195,16 @@ extern "C" {
 #define XUSBPSU_GEVNTSIZ_INTMASK                ((u32)0x00000001U << 31U)
 #define XUSBPSU_GEVNTSIZ_SIZE(n)                ((u32)(n) & (u32)0xffffU)
 
+/* Global Event Count Registers, Event Handler Busy */
+#define XUSBPSU_GEVNTCOUNT_EHB                  ((u32)0x00000001U << 31U)
+
+/* Global Synopsys ID Register */
+#define XUSBPSU_GSNPSID_REVISION(n)             ((u32)(n) & (u32)0xffffU)
+#define XUSBPSU_GSNPSID_REVISION_300A           0x300aU
+
+/* Device Interrupt Moderation Registers */
+#define XUSBPSU_DEV_IMOD_INTERVAL(n)            ((u32)(n) & (u32)0xffffU)
+
 /* Global HWPARAMS1 Register */
 #define XUSBPSU_GHWPARAMS1_EN_PWROPT(n)         (((u32)(n) & ((u32)3 << 24)) >> 24)
 #define XUSBPSU_GHWPARAMS1_EN_PWROPT_NO         0U
@@ -50,6 +50,8 @@
 *	vak 22/01/18 Added changes for supporting microblaze platform
 *	vak 13/03/18 Moved the setup interrupt system calls from driver to
 *		     example.
+*	ag  14/10/26 Events are acknowledged per batch, with interrupt
+*		     moderation when enabled.
 *
 * </pre>
 *
@@ -66,6 +68,7 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static void XUsbPsu_EventBufferInvalidate(struct XUsbPsu *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -466,10 +469,40 @@ void XUsbPsu_EventHandler(struct XUsbPsu *InstancePtr,
 	}
 }
 
+/****************************************************************************/
+/**
+* Invalidates the part of the Event Buffer holding the pending events.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XUsbPsu_EventBufferInvalidate(struct XUsbPsu *InstancePtr)
+{
+	struct XUsbPsu_EvtBuffer *Evt = &InstancePtr->Evt;
+	u32 Len = Evt->Count;
+
+	if ((Evt->Offset + Len) > XUSBPSU_EVENT_BUFFERS_SIZE) {
+		/* The events wrap around the end of the buffer */
+		Len = XUSBPSU_EVENT_BUFFERS_SIZE - Evt->Offset;
+		Xil_DCacheInvalidateRange((INTPTR)Evt->BuffAddr,
+				Evt->Count - Len);
+	}
+
+	Xil_DCacheInvalidateRange((INTPTR)Evt->BuffAddr + Evt->Offset, Len);
+}
+
 /****************************************************************************/
 /**
 * Processes events in an Event Buffer.
 *
+* The events are acknowledged with a single write of GEVNTCOUNT per batch.
+* Events written by the core meanwhile are processed before the event
+* interrupt is unmasked.
+*
 * @param	InstancePtr is a pointer to the XUsbPsu instance.
 * @bus		Event buffer number.
 *
@@ -482,35 +515,55 @@ void XUsbPsu_EventBufferHandler(struct XUsbPsu *InstancePtr)
 {
 	struct XUsbPsu_EvtBuffer *Evt;
 	union XUsbPsu_Event Event = {0};
+	u32 Processed;
 	u32 RegVal;
 
 	Evt = &InstancePtr->Evt;
 
-	if (InstancePtr->ConfigPtr->IsCacheCoherent == 0) {
-		Xil_DCacheInvalidateRange((INTPTR)Evt->BuffAddr,
-                              (u32)XUSBPSU_EVENT_BUFFERS_SIZE);
-	}
-
-	while (Evt->Count > 0) {
-		Event.Raw = *(UINTPTR *)((UINTPTR)Evt->BuffAddr + Evt->Offset);
+	while (Evt->Count > 0U) {
+		if (InstancePtr->ConfigPtr->IsCacheCoherent == 0) {
+			XUsbPsu_EventBufferInvalidate(InstancePtr);
+		}
 
-		/*
-		 * Process the event received
-		 */
-		XUsbPsu_EventHandler(InstancePtr, &Event);
+		Processed = 0U;
+		while (Evt->Count > 0U) {
+			Event.Raw = *(UINTPTR *)((UINTPTR)Evt->BuffAddr +
+							Evt->Offset);
+
+			/*
+			 * Process the event received
+			 */
+			XUsbPsu_EventHandler(InstancePtr, &Event);
+
+			/*
+			 * don't process anymore events if core is hibernated,
+			 * the hibernation has acknowledged all of them
+			 */
+			if (InstancePtr->IsHibernated)
+				return;
+
+			Evt->Offset = (Evt->Offset + 4U) %
+					XUSBPSU_EVENT_BUFFERS_SIZE;
+			Evt->Count -= 4U;
+			Processed += 4U;
+		}
 
-		/* don't process anymore events if core is hibernated */
-		if (InstancePtr->IsHibernated)
-			return;
+		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0), Processed);
 
-		Evt->Offset = (Evt->Offset + 4U) % XUSBPSU_EVENT_BUFFERS_SIZE;
-		Evt->Count -= 4;
-		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0), 4U);
+		Evt->Count = XUsbPsu_ReadReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0));
+		Evt->Count &= XUSBPSU_GEVNTCOUNT_MASK;
 	}
 
-	Evt->Count = 0;
 	Evt->Flags &= ~XUSBPSU_EVENT_PENDING;
 
+	if (InstancePtr->ImodInterval != 0U) {
+		/* Clear Event Handler Busy and restart the interval */
+		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_GEVNTCOUNT(0),
+				XUSBPSU_GEVNTCOUNT_EHB);
+		XUsbPsu_WriteReg(InstancePtr, XUSBPSU_DEV_IMOD(0),
+			XUSBPSU_DEV_IMOD_INTERVAL(InstancePtr->ImodInterval));
+	}
+
 	/* Unmask event interrupt */
 	RegVal = XUsbPsu_ReadReg(InstancePtr, XUSBPSU_GEVNTSIZ(0));
 	RegVal &= ~XUSBPSU_GEVNTSIZ_INTMASK;
@@ -50,6 +50,7 @@
 * 5.00  rco   07/21/15   Initial Release
 * 6.00  rco   11/05/15   Integrate layer-1 with layer-2
 *       dmc   02/25/16   add public routine XV_DeintWaitForIdle()
+*       ag    10/14/26   add field buffer pool and XV_DeintConfigFieldBuffers()
 *
 * </pre>
 *
@@ -67,6 +68,9 @@
 /**************************** Local Global *******************************/
 
 /************************** Function Prototypes ******************************/
+static UINTPTR PoolAlloc(XV_DeintFieldBufPool *PoolPtr, u32 Size);
+static void PoolFree(XV_DeintFieldBufPool *PoolPtr, UINTPTR Addr);
+static void PoolRemoveSeg(XV_DeintFieldBufPool *PoolPtr, u32 Index);
 
 /*****************************************************************************/
 /**
@@ -175,6 +179,293 @@ void XV_DeintSetFieldBuffers(XV_Deint_l2   *InstancePtr,
   XV_deinterlacer_Set_colorFormat(&InstancePtr->Deint, cformat);
 }
 
+/*****************************************************************************/
+/**
+* This function initializes a field buffer pool over a DDR region. The region
+* start is aligned to XV_DEINT_FIELDBUF_ALIGN.
+*
+* @param  PoolPtr is a pointer to the pool to be initialized
+* @param  BaseAddr is the start address of the DDR region
+* @param  Size is the size of the DDR region in bytes
+*
+* @return None
+*
+* @note   The core field buffer registers are 32 bit wide, the region must
+*         be located below 4GB
+*
+******************************************************************************/
+void XV_DeintFieldBufPoolInit(XV_DeintFieldBufPool *PoolPtr,
+                              UINTPTR BaseAddr,
+                              u32 Size)
+{
+  u32 Pad;
+
+  Xil_AssertVoid(PoolPtr != NULL);
+  Xil_AssertVoid(((u64)BaseAddr + Size) <= 0x100000000ULL);
+
+  memset(PoolPtr, 0, sizeof(XV_DeintFieldBufPool));
+
+  Pad  = (u32)((XV_DEINT_FIELDBUF_ALIGN - (BaseAddr % XV_DEINT_FIELDBUF_ALIGN))
+               % XV_DEINT_FIELDBUF_ALIGN);
+  Size = (Size > Pad) ? (Size - Pad) : 0;
+  Size -= (Size % XV_DEINT_FIELDBUF_ALIGN);
+
+  PoolPtr->BaseAddr = BaseAddr + Pad;
+  PoolPtr->Size     = Size;
+  if (Size) {
+    PoolPtr->Seg[0].Addr  = PoolPtr->BaseAddr;
+    PoolPtr->Seg[0].Size  = Size;
+    PoolPtr->Seg[0].InUse = FALSE;
+    PoolPtr->NumSegs      = 1;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function attaches a field buffer pool to the deinterlacer instance.
+* Any field store the instance holds from a previous pool is released first.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on
+* @param  PoolPtr is a pointer to an initialized pool, may be shared by
+*         several instances
+*
+* @return None
+*
+******************************************************************************/
+void XV_DeintAttachFieldBufPool(XV_Deint_l2 *InstancePtr,
+                                XV_DeintFieldBufPool *PoolPtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(PoolPtr != NULL);
+
+  XV_DeintReleaseFieldBuffers(InstancePtr);
+  InstancePtr->PoolPtr = PoolPtr;
+}
+
+/*****************************************************************************/
+/**
+* This function returns the field store size the core needs for a stream.
+* 4:2:2 and 4:2:0 streams are stored with 2 samples per pixel, other formats
+* with 3. Each sample takes the core maximum data width rounded up to bytes.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on
+* @param  Width is the active width
+* @param  FieldHeight is the active height of one field
+* @param  cformat is the input stream color format
+*
+* @return Field store size in bytes, multiple of XV_DEINT_FIELDBUF_ALIGN
+*
+******************************************************************************/
+u32 XV_DeintGetFieldBufSize(XV_Deint_l2 *InstancePtr,
+                            u16 Width,
+                            u16 FieldHeight,
+                            XVidC_ColorFormat cformat)
+{
+  u32 Bpc, Spp, Size;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  Bpc = (InstancePtr->Deint.Config.MaxDataWidth + 7)/8;
+  Spp = ((cformat == XVIDC_CSF_YCRCB_422) ||
+         (cformat == XVIDC_CSF_YCRCB_420)) ? 2 : 3;
+
+  Size = (u32)Width * FieldHeight * Spp * Bpc * XV_DEINT_NUM_FIELDS;
+  Size = (Size + XV_DEINT_FIELDBUF_ALIGN - 1) & ~(XV_DEINT_FIELDBUF_ALIGN - 1);
+
+  return(Size);
+}
+
+/*****************************************************************************/
+/**
+* This function sizes the instance field store from its pool for the given
+* stream and programs the core field buffers, color format, width and height.
+* The current store is kept if it is large enough, otherwise it is returned to
+* the pool and a new one allocated. The core does not need to be stopped.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on
+* @param  Width is the active width
+* @param  FieldHeight is the active height of one field
+* @param  cformat is the input stream color format
+*
+* @return XST_SUCCESS if the core is programmed
+*         XST_FAILURE if no pool is attached or the pool is exhausted. The
+*         core keeps its current configuration
+*
+* @note   A running core picks up the new settings at its next frame. The
+*         first frame after a change has no valid motion history. Because a
+*         released store may be handed to another instance right away, the
+*         call should be made at a frame boundary of this instance.
+*
+******************************************************************************/
+int XV_DeintConfigFieldBuffers(XV_Deint_l2 *InstancePtr,
+                               u16 Width,
+                               u16 FieldHeight,
+                               XVidC_ColorFormat cformat)
+{
+  u32 Need, PrevSize;
+  UINTPTR Addr;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((Width != 0) && (FieldHeight != 0));
+
+  if (InstancePtr->PoolPtr == NULL) {
+    return(XST_FAILURE);
+  }
+
+  Need = XV_DeintGetFieldBufSize(InstancePtr, Width, FieldHeight, cformat);
+
+  if (InstancePtr->FieldBufSize < Need) {
+    PrevSize = InstancePtr->FieldBufSize;
+
+    /* Return the store first so it can grow in place into free neighbours */
+    XV_DeintReleaseFieldBuffers(InstancePtr);
+    Addr = PoolAlloc(InstancePtr->PoolPtr, Need);
+    if (Addr == 0) {
+      /* Take the previous store back, the freed space is still available */
+      if (PrevSize) {
+        InstancePtr->FieldBufAddr = PoolAlloc(InstancePtr->PoolPtr, PrevSize);
+        InstancePtr->FieldBufSize = PrevSize;
+        XV_deinterlacer_Set_read_fb(&InstancePtr->Deint,
+                                    (u32)InstancePtr->FieldBufAddr);
+        XV_deinterlacer_Set_write_fb(&InstancePtr->Deint,
+                                     (u32)InstancePtr->FieldBufAddr);
+      }
+      return(XST_FAILURE);
+    }
+    InstancePtr->FieldBufAddr = Addr;
+    InstancePtr->FieldBufSize = Need;
+  }
+
+  XV_DeintSetFieldBuffers(InstancePtr, (u32)InstancePtr->FieldBufAddr, cformat);
+  XV_deinterlacer_Set_width(&InstancePtr->Deint, Width);
+  XV_deinterlacer_Set_height(&InstancePtr->Deint, FieldHeight);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the instance field store to its pool
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on
+*
+* @return None
+*
+* @note   The core must be stopped and idle, or be reprogrammed, before the
+*         store is used by another instance
+*
+******************************************************************************/
+void XV_DeintReleaseFieldBuffers(XV_Deint_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  if ((InstancePtr->PoolPtr != NULL) && (InstancePtr->FieldBufSize != 0)) {
+    PoolFree(InstancePtr->PoolPtr, InstancePtr->FieldBufAddr);
+  }
+  InstancePtr->FieldBufAddr = 0;
+  InstancePtr->FieldBufSize = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function allocates a segment from the pool, first fit. The remainder
+* of the free segment is split off if a segment entry is available.
+*
+* @param  PoolPtr is a pointer to the pool
+* @param  Size is the requested size, multiple of XV_DEINT_FIELDBUF_ALIGN
+*
+* @return Segment address, 0 if the pool is exhausted
+*
+******************************************************************************/
+static UINTPTR PoolAlloc(XV_DeintFieldBufPool *PoolPtr, u32 Size)
+{
+  XV_DeintFieldBufSeg *Seg = PoolPtr->Seg;
+  u32 Index, Move;
+
+  for (Index = 0; Index < PoolPtr->NumSegs; ++Index) {
+    if (!Seg[Index].InUse && (Seg[Index].Size >= Size)) {
+      break;
+    }
+  }
+  if (Index == PoolPtr->NumSegs) {
+    return(0);
+  }
+
+  if ((Seg[Index].Size > Size) &&
+      (PoolPtr->NumSegs < XV_DEINT_POOL_MAX_SEGMENTS)) {
+    /* Insert the free remainder after the allocated segment */
+    for (Move = PoolPtr->NumSegs; Move > Index + 1; --Move) {
+      Seg[Move] = Seg[Move - 1];
+    }
+    Seg[Index + 1].Addr  = Seg[Index].Addr + Size;
+    Seg[Index + 1].Size  = Seg[Index].Size - Size;
+    Seg[Index + 1].InUse = FALSE;
+    Seg[Index].Size      = Size;
+    PoolPtr->NumSegs++;
+  }
+
+  Seg[Index].InUse     = TRUE;
+  PoolPtr->BytesInUse += Seg[Index].Size;
+
+  return(Seg[Index].Addr);
+}
+
+/*****************************************************************************/
+/**
+* This function returns a segment to the pool and merges it with the free
+* neighbouring segments
+*
+* @param  PoolPtr is a pointer to the pool
+* @param  Addr is the segment address returned by PoolAlloc()
+*
+* @return None
+*
+******************************************************************************/
+static void PoolFree(XV_DeintFieldBufPool *PoolPtr, UINTPTR Addr)
+{
+  XV_DeintFieldBufSeg *Seg = PoolPtr->Seg;
+  u32 Index;
+
+  for (Index = 0; Index < PoolPtr->NumSegs; ++Index) {
+    if (Seg[Index].InUse && (Seg[Index].Addr == Addr)) {
+      break;
+    }
+  }
+  if (Index == PoolPtr->NumSegs) {
+    return;
+  }
+
+  Seg[Index].InUse     = FALSE;
+  PoolPtr->BytesInUse -= Seg[Index].Size;
+
+  if ((Index + 1 < PoolPtr->NumSegs) && !Seg[Index + 1].InUse) {
+    Seg[Index].Size += Seg[Index + 1].Size;
+    PoolRemoveSeg(PoolPtr, Index + 1);
+  }
+  if ((Index > 0) && !Seg[Index - 1].InUse) {
+    Seg[Index - 1].Size += Seg[Index].Size;
+    PoolRemoveSeg(PoolPtr, Index);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function removes a segment entry from the pool segment list
+*
+* @param  PoolPtr is a pointer to the pool
+* @param  Index is the entry to remove
+*
+* @return None
+*
+******************************************************************************/
+static void PoolRemoveSeg(XV_DeintFieldBufPool *PoolPtr, u32 Index)
+{
+  for (; Index + 1 < PoolPtr->NumSegs; ++Index) {
+    PoolPtr->Seg[Index] = PoolPtr->Seg[Index + 1];
+  }
+  PoolPtr->NumSegs--;
+}
+
 /*****************************************************************************/
 /**
 *
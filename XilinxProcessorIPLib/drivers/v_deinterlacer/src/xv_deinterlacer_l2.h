@@ -46,6 +46,24 @@
 *
 * Currently only 1080i input is supported
 *
+* <b>Field Buffer Management</b>
+*
+* The core keeps the previous fields it needs for motion detection in a field
+* store in DDR. The store can either be set once with XV_DeintSetFieldBuffers()
+* or be managed by the driver: XV_DeintFieldBufPoolInit() hands a DDR region to
+* a pool, XV_DeintAttachFieldBufPool() attaches the pool to a deinterlacer
+* instance and XV_DeintConfigFieldBuffers() sizes the store for the active
+* resolution and color format and programs the core. Several instances, e.g. one
+* per ingest channel, can share a single pool.
+*
+* On a resolution or color format change XV_DeintConfigFieldBuffers() keeps the
+* current store if it is large enough, otherwise the store is returned to the
+* pool and a new one allocated; neither the core nor the other channels sharing
+* the pool are torn down. Stores are sized for the actual stream rather than the
+* maximum resolution, and for 4:2:2/4:2:0 formats are sized for 2 samples per
+* pixel. The sample width is fixed by the core (MaxDataWidth); the core has no
+* compressed or reduced bit depth field storage mode.
+*
 * <b>Dependency</b>
 *
 * This driver makes use of the video enumerations and data types defined in the
@@ -90,6 +108,7 @@
 * 6.00  rco   11/05/15   Integrate layer-1 with layer-2
 *       dmc   02/25/16   add public routine XV_DeintWaitForIdle()
 * 6.1   rco   11/07/16   Fix for c++ compile
+*       ag    10/14/26   Add field buffer pool and XV_DeintConfigFieldBuffers()
 *
 * </pre>
 *
@@ -105,9 +124,36 @@ extern "C" {
 #include "xv_deinterlacer.h"
 
 /************************** Constant Definitions *****************************/
+#define XV_DEINT_NUM_FIELDS         (3)    /**< Fields held in the field store */
+#define XV_DEINT_FIELDBUF_ALIGN     (4096) /**< Field store alignment (bytes) */
+#define XV_DEINT_POOL_MAX_SEGMENTS  (16)   /**< Max free + allocated segments */
 
 /**************************** Type Definitions *******************************/
 
+/**
+ * Field buffer pool segment
+ */
+typedef struct
+{
+  UINTPTR Addr; /**< Segment start address */
+  u32 Size;     /**< Segment size in bytes */
+  u8 InUse;     /**< TRUE if the segment is allocated to an instance */
+}XV_DeintFieldBufSeg;
+
+/**
+ * Field buffer pool. One DDR region carved into field stores for one or more
+ * deinterlacer instances. Allocation is first fit, freed segments are merged
+ * with their free neighbours.
+ */
+typedef struct
+{
+  UINTPTR BaseAddr;  /**< Pool start address */
+  u32 Size;          /**< Pool size in bytes */
+  u32 BytesInUse;    /**< Bytes currently allocated */
+  u32 NumSegs;       /**< Number of valid entries in Seg[] */
+  XV_DeintFieldBufSeg Seg[XV_DEINT_POOL_MAX_SEGMENTS]; /**< Segments, address ordered */
+}XV_DeintFieldBufPool;
+
 /**
  * Deinterlacer Layer 2 data. The user is required to allocate a variable
  * of this type for every V Scaler device in the system. A pointer to a
@@ -116,6 +162,9 @@ extern "C" {
 typedef struct
 {
   XV_deinterlacer Deint; /*<< Layer 1 instance */
+  XV_DeintFieldBufPool *PoolPtr; /*<< Field buffer pool, NULL if not used */
+  UINTPTR FieldBufAddr;  /*<< Field store allocated from the pool */
+  u32 FieldBufSize;      /*<< Size of the allocated field store, 0 if none */
 
 }XV_Deint_l2;
 
@@ -128,6 +177,21 @@ void XV_DeintSetFieldBuffers(XV_Deint_l2   *InstancePtr,
 							 u32 memAddr,
 							 XVidC_ColorFormat cformat);
 
+void XV_DeintFieldBufPoolInit(XV_DeintFieldBufPool *PoolPtr,
+                              UINTPTR BaseAddr,
+                              u32 Size);
+void XV_DeintAttachFieldBufPool(XV_Deint_l2 *InstancePtr,
+                                XV_DeintFieldBufPool *PoolPtr);
+u32 XV_DeintGetFieldBufSize(XV_Deint_l2 *InstancePtr,
+                            u16 Width,
+                            u16 FieldHeight,
+                            XVidC_ColorFormat cformat);
+int XV_DeintConfigFieldBuffers(XV_Deint_l2 *InstancePtr,
+                               u16 Width,
+                               u16 FieldHeight,
+                               XVidC_ColorFormat cformat);
+void XV_DeintReleaseFieldBuffers(XV_Deint_l2 *InstancePtr);
+
 void XV_DeintDbgReportStatus(XV_Deint_l2 *InstancePtr);
 
 #ifdef __cplusplus
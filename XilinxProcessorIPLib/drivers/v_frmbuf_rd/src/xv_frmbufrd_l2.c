@@ -52,6 +52,7 @@
 * 3.00  vyc   04/04/18   Add interlaced support
                          Add new memory format BGR8
                          Add interrupt handler for ap_ready
+*       ag    10/14/26   Add frame buffer ring support
 * </pre>
 *
 ******************************************************************************/
@@ -603,6 +604,63 @@ UINTPTR XVFrmbufRd_GetChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr)
   return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function programs the address of a ring buffer into the core
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  BufPtr is a pointer to the ring buffer
+*
+* @return XST_SUCCESS or XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED
+*
+******************************************************************************/
+int XVFrmbufRd_RingProgram(XV_FrmbufRd_l2 *InstancePtr,
+                            const XVidC_FbRingBuf *BufPtr)
+{
+  int Status;
+
+  Status = XVFrmbufRd_SetBufferAddr(InstancePtr, BufPtr->Addr);
+  if((Status == XST_SUCCESS) && (BufPtr->ChromaAddr != 0)) {
+    Status = XVFrmbufRd_SetChromaBufferAddr(InstancePtr, BufPtr->ChromaAddr);
+  }
+  return(Status);
+}
+
+/*****************************************************************************/
+/**
+* This function attaches a frame buffer ring to the core. The newest complete
+* frame is acquired from the ring and programmed, after which the ISR rotates
+* the buffers. Call it before the core is started, with the ap_ready interrupt
+* enabled.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  RingPtr is a pointer to the initialized ring
+*
+* @return XST_SUCCESS, XST_NO_DATA if no frame has been completed yet, or the
+*         error of XVFrmbufRd_SetBufferAddr()
+*
+******************************************************************************/
+int XVFrmbufRd_SetRing(XV_FrmbufRd_l2 *InstancePtr, XVidC_FbRing *RingPtr)
+{
+  u32 Index;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(RingPtr != NULL);
+
+  Status = XVidC_FbRingRdAcquire(RingPtr, &Index);
+  if(Status == XST_SUCCESS) {
+    Status = XVFrmbufRd_RingProgram(InstancePtr, &RingPtr->Buf[Index]);
+  }
+
+  if(Status == XST_SUCCESS) {
+    InstancePtr->RingPtr     = RingPtr;
+    InstancePtr->RingActive  = XVIDC_FBRING_NO_BUF;
+    InstancePtr->RingPending = Index;
+  }
+  return(Status);
+}
+
 /*****************************************************************************/
 /**
 * This function sets the field ID
@@ -100,6 +100,16 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Frame Buffer Ring </b>
+*
+* Instead of setting the buffer address by hand the application can attach a
+* frame buffer ring (see xvidc_fbring.h) shared with a frame buffer write core
+* using XVFrmbufRd_SetRing(). The ap_ready interrupt must be enabled. On
+* ap_ready the core has latched the address of the frame it is reading, so the
+* buffer of the previous frame goes back to the ring, and the ISR acquires the
+* next complete frame from the ring and programs its address ahead of time. If
+* no new frame is complete the current one is read again.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -121,6 +131,7 @@
 * 3.00  vyc   04/04/18   Add interlaced support
 *                        Add new memory format BGR8
 *                        Add interrupt handler for ap_ready
+*       ag    10/14/26   Add frame buffer ring support
 * </pre>
 *
 ******************************************************************************/
@@ -132,6 +143,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_fbring.h"
 #include "xv_frmbufrd.h"
 
 /************************** Constant Definitions *****************************/
@@ -193,6 +205,11 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Output AXIS */
+
+    /* Frame buffer ring */
+    XVidC_FbRing *RingPtr;     /**< Ring the buffers come from, or NULL */
+    u32 RingActive;            /**< Buffer the core is reading */
+    u32 RingPending;           /**< Buffer programmed for the next frame */
 }XV_FrmbufRd_l2;
 
 /************************** Macros Definitions *******************************/
@@ -511,11 +528,16 @@ UINTPTR XVFrmbufRd_GetBufferAddr(XV_FrmbufRd_l2 *InstancePtr);
 int XVFrmbufRd_SetChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr,
                               UINTPTR Addr);
 UINTPTR XVFrmbufRd_GetChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr);
+int XVFrmbufRd_SetRing(XV_FrmbufRd_l2 *InstancePtr, XVidC_FbRing *RingPtr);
 int XVFrmbufRd_SetFieldID(XV_FrmbufRd_l2 *InstancePtr,
                           u32 FieldID);
 u32 XVFrmbufRd_GetFieldID(XV_FrmbufRd_l2 *InstancePtr);
 void XVFrmbufRd_DbgReportStatus(XV_FrmbufRd_l2 *InstancePtr);
 
+/* Frame buffer ring helper, used by the ISR */
+int XVFrmbufRd_RingProgram(XV_FrmbufRd_l2 *InstancePtr,
+                            const XVidC_FbRingBuf *BufPtr);
+
 /* Interrupt related function */
 void XVFrmbufRd_InterruptHandler(void *InstancePtr);
 int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr,
@@ -46,6 +46,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  vyc   04/05/17   Initial Release
 * 3.00  vyc   04/04/18   Add interrupt handler for ap_ready
+*       ag    10/14/26   Rotate frame buffer ring buffers in the ISR
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +54,9 @@
 /***************************** Include Files *********************************/
 #include "xv_frmbufrd_l2.h"
 
+/************************** Function Prototypes ******************************/
+static void XVFrmbufRd_RingReady(XV_FrmbufRd_l2 *InstancePtr);
+
 
 /*****************************************************************************/
 /**
@@ -158,6 +162,9 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFRD_IRQ_READY_MASK) {
     /* Clear the interrupt */
     XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_READY_MASK);
+    if(FrmbufRdPtr->RingPtr) {
+      XVFrmbufRd_RingReady(FrmbufRdPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufRdPtr->FrameReadyCallback) {
           FrmbufRdPtr->FrameReadyCallback(FrmbufRdPtr->CallbackReadyRef);
@@ -165,4 +172,37 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
     XV_frmbufrd_Start(&FrmbufRdPtr->FrmbufRd);
   }
 }
+
+/*****************************************************************************/
+/**
+*
+* This function is called once the core has latched the buffer address of the
+* frame it is reading. The buffer of the previous frame is released to the
+* frame buffer ring, and the next complete frame is acquired and programmed
+* for the frame after. If no new frame is complete the address is left as is
+* and the current frame is read again.
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   None.
+*
+******************************************************************************/
+static void XVFrmbufRd_RingReady(XV_FrmbufRd_l2 *InstancePtr)
+{
+  u32 Previous;
+  u32 Index;
+
+  Previous = InstancePtr->RingActive;
+  InstancePtr->RingActive = InstancePtr->RingPending;
+
+  if(XVidC_FbRingRdAcquire(InstancePtr->RingPtr, &Index) == XST_SUCCESS) {
+    XVFrmbufRd_RingProgram(InstancePtr, &InstancePtr->RingPtr->Buf[Index]);
+    InstancePtr->RingPending = Index;
+  }
+
+  if((Previous != XVIDC_FBRING_NO_BUF) &&
+     (Previous != InstancePtr->RingActive)) {
+    XVidC_FbRingRdRelease(InstancePtr->RingPtr, Previous);
+  }
+}
 /** @} */
@@ -52,6 +52,8 @@
 * 3.00  vyc   04/04/18   Add interlaced support
 *                        Add new memory format BGR8
 *                        Add interrupt handler for ap_ready
+*       ag    10/14/26   Add frame buffer ring support
+*                        Arm slice monitor when buffer address is set
 * </pre>
 *
 ******************************************************************************/
@@ -476,6 +478,9 @@ XVidC_VideoStream *XVFrmbufWr_GetVideoStream(XV_FrmbufWr_l2 *InstancePtr)
 *
 * @return XST_SUCCESS or XST_FAILURE
 *
+* @note   If a slice monitor is attached the buffer is armed. Slices of the
+*         frame are not reported if the core is still writing the buffer.
+*
 ******************************************************************************/
 int XVFrmbufWr_SetBufferAddr(XV_FrmbufWr_l2 *InstancePtr,
                              UINTPTR Addr)
@@ -497,6 +502,9 @@ int XVFrmbufWr_SetBufferAddr(XV_FrmbufWr_l2 *InstancePtr,
   }
 
   if(AddrValid) {
+    if(InstancePtr->SliceMonPtr) {
+      XVidC_SliceMonArm(InstancePtr->SliceMonPtr, Addr);
+    }
     XV_frmbufwr_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufWr, Addr);
     Status = XST_SUCCESS;
   }
@@ -577,6 +585,87 @@ UINTPTR XVFrmbufWr_GetChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr)
   return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function programs the address of a ring buffer into the core
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  BufPtr is a pointer to the ring buffer
+*
+* @return XST_SUCCESS or XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED
+*
+******************************************************************************/
+int XVFrmbufWr_RingProgram(XV_FrmbufWr_l2 *InstancePtr,
+                            const XVidC_FbRingBuf *BufPtr)
+{
+  int Status;
+
+  Status = XVFrmbufWr_SetBufferAddr(InstancePtr, BufPtr->Addr);
+  if((Status == XST_SUCCESS) && (BufPtr->ChromaAddr != 0)) {
+    Status = XVFrmbufWr_SetChromaBufferAddr(InstancePtr, BufPtr->ChromaAddr);
+  }
+  return(Status);
+}
+
+/*****************************************************************************/
+/**
+* This function attaches a frame buffer ring to the core. The first buffer is
+* acquired from the ring and programmed, after which the ISR rotates the
+* buffers. Call it before the core is started, with the ap_done and ap_ready
+* interrupts enabled.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  RingPtr is a pointer to the initialized ring
+*
+* @return XST_SUCCESS, XST_NO_DATA if the ring has no free buffer, or the
+*         error of XVFrmbufWr_SetBufferAddr()
+*
+******************************************************************************/
+int XVFrmbufWr_SetRing(XV_FrmbufWr_l2 *InstancePtr, XVidC_FbRing *RingPtr)
+{
+  u32 Index;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(RingPtr != NULL);
+
+  Status = XVidC_FbRingWrAcquire(RingPtr, &Index);
+  if(Status == XST_SUCCESS) {
+    Status = XVFrmbufWr_RingProgram(InstancePtr, &RingPtr->Buf[Index]);
+  }
+
+  if(Status == XST_SUCCESS) {
+    InstancePtr->RingPtr     = RingPtr;
+    InstancePtr->RingActive  = XVIDC_FBRING_NO_BUF;
+    InstancePtr->RingPending = Index;
+  }
+  return(Status);
+}
+
+/*****************************************************************************/
+/**
+* This function attaches a slice monitor to the core. Buffers programmed
+* afterwards are armed and the frames written into them are tracked by the
+* interrupt handler.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  MonPtr is a pointer to the initialized slice monitor, or NULL to
+*         detach it
+*
+* @return None
+*
+* @note   The slice lines and line size of the monitor must match the
+*         stream and memory format the core is configured for.
+*
+******************************************************************************/
+void XVFrmbufWr_SetSliceMonitor(XV_FrmbufWr_l2 *InstancePtr,
+                                XVidC_SliceMon *MonPtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->SliceMonPtr = MonPtr;
+}
+
 /*****************************************************************************/
 /**
 * This function reads the field ID
@@ -100,6 +100,28 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Frame Buffer Ring </b>
+*
+* Instead of setting the buffer address by hand the application can attach a
+* frame buffer ring (see xvidc_fbring.h) shared with a frame buffer read core
+* using XVFrmbufWr_SetRing(). The ap_done and ap_ready interrupts must both be
+* enabled. On ap_ready the core has latched the address of the frame it is
+* writing, and the ISR acquires the next buffer from the ring and programs its
+* address ahead of time. On ap_done the frame just written is released to the
+* ring, stamped with its frame sequence number. If the ring has no buffer
+* available the next frame is written into the same buffer and dropped.
+*
+* <b> Slice Notification </b>
+*
+* To process a frame before it is complete, attach a slice monitor (see
+* xvidc_slice.h) using XVFrmbufWr_SetSliceMonitor() before the buffer address
+* is set. Each buffer programmed with XVFrmbufWr_SetBufferAddr(), directly or
+* through the ring, is armed, and the ISR tracks the frame being written on
+* ap_ready and ap_done, so both interrupts must be enabled. The application
+* polls the monitor with XVidC_SliceMonPoll() to get "first N lines ready"
+* callbacks. The buffer address must be programmed for every frame, and a
+* buffer must not be programmed again while the core is writing it.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -121,6 +143,8 @@
 * 3.00  vyc   04/04/18   Add interlaced support
 *                        Add new memory format BGR8
 *                        Add interrupt handler for ap_ready
+*       ag    10/14/26   Add frame buffer ring support
+*                        Add slice notification support
 * </pre>
 *
 ******************************************************************************/
@@ -132,6 +156,8 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_fbring.h"
+#include "xvidc_slice.h"
 #include "xv_frmbufwr.h"
 
 /************************** Constant Definitions *****************************/
@@ -193,6 +219,13 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    /* Frame buffer ring */
+    XVidC_FbRing *RingPtr;     /**< Ring the buffers come from, or NULL */
+    u32 RingActive;            /**< Buffer the core is writing */
+    u32 RingPending;           /**< Buffer programmed for the next frame */
+
+    XVidC_SliceMon *SliceMonPtr; /**< Slice monitor, or NULL */
 }XV_FrmbufWr_l2;
 
 /************************** Macros Definitions *******************************/
@@ -466,9 +499,16 @@ UINTPTR XVFrmbufWr_GetBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
 int XVFrmbufWr_SetChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr,
                               UINTPTR Addr);
 UINTPTR XVFrmbufWr_GetChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
+int XVFrmbufWr_SetRing(XV_FrmbufWr_l2 *InstancePtr, XVidC_FbRing *RingPtr);
+void XVFrmbufWr_SetSliceMonitor(XV_FrmbufWr_l2 *InstancePtr,
+                                XVidC_SliceMon *MonPtr);
 u32 XVFrmbufWr_GetFieldID(XV_FrmbufWr_l2 *InstancePtr);
 void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr);
 
+/* Frame buffer ring helper, used by the ISR */
+int XVFrmbufWr_RingProgram(XV_FrmbufWr_l2 *InstancePtr,
+                            const XVidC_FbRingBuf *BufPtr);
+
 /* Interrupt related function */
 void XVFrmbufWr_InterruptHandler(void *InstancePtr);
 int XVFrmbufWr_SetCallback(XV_FrmbufWr_l2 *InstancePtr,
@@ -46,6 +46,8 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  vyc   04/05/17   Initial Release
 * 3.00  vyc   04/04/18   Add interrupt handler for ap_ready
+*       ag    10/14/26   Rotate frame buffer ring buffers in the ISR
+*                        Track frames of the slice monitor in the ISR
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +55,10 @@
 /***************************** Include Files *********************************/
 #include "xv_frmbufwr_l2.h"
 
+/************************** Function Prototypes ******************************/
+static void XVFrmbufWr_RingDone(XV_FrmbufWr_l2 *InstancePtr);
+static void XVFrmbufWr_RingReady(XV_FrmbufWr_l2 *InstancePtr);
+
 
 /*****************************************************************************/
 /**
@@ -148,6 +154,12 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_DONE_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_DONE_MASK);
+    if(FrmbufWrPtr->SliceMonPtr) {
+      XVidC_SliceMonDone(FrmbufWrPtr->SliceMonPtr);
+    }
+    if(FrmbufWrPtr->RingPtr) {
+      XVFrmbufWr_RingDone(FrmbufWrPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameDoneCallback) {
           FrmbufWrPtr->FrameDoneCallback(FrmbufWrPtr->CallbackDoneRef);
@@ -159,6 +171,14 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_READY_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_READY_MASK);
+    /* Buffer just taken by the core must be started before the next one
+     * is armed */
+    if(FrmbufWrPtr->SliceMonPtr) {
+      XVidC_SliceMonStart(FrmbufWrPtr->SliceMonPtr);
+    }
+    if(FrmbufWrPtr->RingPtr) {
+      XVFrmbufWr_RingReady(FrmbufWrPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameReadyCallback) {
           FrmbufWrPtr->FrameReadyCallback(FrmbufWrPtr->CallbackReadyRef);
@@ -166,4 +186,55 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
     XV_frmbufwr_Start(&FrmbufWrPtr->FrmbufWr);
   }
 }
+
+/*****************************************************************************/
+/**
+*
+* This function releases the frame the core has just written to the frame
+* buffer ring. If the next frame goes to the same buffer, because the ring had
+* no buffer available, the frame is dropped instead.
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   None.
+*
+******************************************************************************/
+static void XVFrmbufWr_RingDone(XV_FrmbufWr_l2 *InstancePtr)
+{
+  if(InstancePtr->RingActive == XVIDC_FBRING_NO_BUF) {
+    return;
+  }
+
+  if(InstancePtr->RingActive != InstancePtr->RingPending) {
+    XVidC_FbRingWrRelease(InstancePtr->RingPtr, InstancePtr->RingActive);
+  } else {
+    InstancePtr->RingPtr->Dropped++;
+  }
+  InstancePtr->RingActive = XVIDC_FBRING_NO_BUF;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is called once the core has latched the buffer address of the
+* frame it is writing. The next buffer is acquired from the frame buffer ring
+* and programmed for the frame after. If the ring has no buffer available the
+* address is left as is.
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   None.
+*
+******************************************************************************/
+static void XVFrmbufWr_RingReady(XV_FrmbufWr_l2 *InstancePtr)
+{
+  u32 Index;
+
+  InstancePtr->RingActive = InstancePtr->RingPending;
+
+  if(XVidC_FbRingWrAcquire(InstancePtr->RingPtr, &Index) == XST_SUCCESS) {
+    XVFrmbufWr_RingProgram(InstancePtr, &InstancePtr->RingPtr->Buf[Index]);
+    InstancePtr->RingPending = Index;
+  }
+}
 /** @} */
@@ -0,0 +1,223 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xv_gamma_lut_table.c
+* @addtogroup v_gamma_lut_v1_0
+* @{
+* @details
+*
+* Gamma lut table loader. See xv_gamma_lut_table.h for a detailed description
+* of the loader.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag    10/14/26   Initial Release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xv_gamma_lut_table.h"
+
+/************************** Constant Definitions *****************************/
+/* Address offset between the channel memories */
+#define XV_GAMMA_LUT_CH_STRIDE  (XV_GAMMA_LUT_CTRL_ADDR_HWREG_GAMMA_LUT_1_BASE - \
+                                 XV_GAMMA_LUT_CTRL_ADDR_HWREG_GAMMA_LUT_0_BASE)
+
+/**************************** Type Definitions *******************************/
+
+/************************** Function Prototypes ******************************/
+
+/*****************************************************************************/
+/**
+* This function packs one channel of a lookup table into a table image
+*
+* @param  TablePtr is a pointer to the table image
+* @param  Channel is the channel (0..2) to set
+* @param  LutPtr is a pointer to the lookup table entries
+* @param  NumEntries is the number of entries, 2^MaxDataWidth of the core.
+*         Must be even
+*
+* @return None
+*
+******************************************************************************/
+void XV_gamma_lut_TableSetChannel(XV_gamma_lut_Table *TablePtr,
+                                  u32 Channel,
+                                  const u16 *LutPtr,
+                                  u32 NumEntries)
+{
+  u32 Index;
+
+  Xil_AssertVoid(TablePtr != NULL);
+  Xil_AssertVoid(LutPtr != NULL);
+  Xil_AssertVoid(Channel < XV_GAMMA_LUT_NUM_CHANNELS);
+  Xil_AssertVoid((NumEntries % 2) == 0);
+  Xil_AssertVoid(NumEntries <= (2 * XV_GAMMA_LUT_TABLE_WORDS));
+
+  for (Index = 0; Index < NumEntries/2; ++Index) {
+    TablePtr->Word[Channel][Index] = (u32)LutPtr[2*Index] |
+                                     ((u32)LutPtr[2*Index + 1] << 16);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function initializes the table loader of a gamma lut core. The tables
+* currently held by the core are read back once so that later uploads only
+* write the words that change.
+*
+* @param  LoaderPtr is a pointer to the loader to be initialized
+* @param  GammaPtr is a pointer to the initialized layer 1 instance
+* @param  ChunkWords is the maximum number of words written per call to
+*         XV_gamma_lut_LoaderService(), 0 to write the whole change at once
+*
+* @return XST_SUCCESS if the loader is initialized
+*         XST_FAILURE if the core data width is not supported
+*
+******************************************************************************/
+int XV_gamma_lut_LoaderInitialize(XV_gamma_lut_Loader *LoaderPtr,
+                                  XV_gamma_lut *GammaPtr,
+                                  u32 ChunkWords)
+{
+  u32 Channel, Index;
+  UINTPTR Addr;
+
+  Xil_AssertNonvoid(LoaderPtr != NULL);
+  Xil_AssertNonvoid(GammaPtr != NULL);
+  Xil_AssertNonvoid(GammaPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+  if ((GammaPtr->Config.MaxDataWidth == 0) ||
+      (((u32)1 << GammaPtr->Config.MaxDataWidth) > (2 * XV_GAMMA_LUT_TABLE_WORDS))) {
+    return(XST_FAILURE);
+  }
+
+  memset(LoaderPtr, 0, sizeof(XV_gamma_lut_Loader));
+  LoaderPtr->GammaPtr   = GammaPtr;
+  LoaderPtr->NumWords   = ((u32)1 << GammaPtr->Config.MaxDataWidth)/2;
+  LoaderPtr->ChunkWords = ChunkWords;
+
+  for (Channel = 0; Channel < XV_GAMMA_LUT_NUM_CHANNELS; ++Channel) {
+    Addr = XV_GAMMA_LUT_CTRL_ADDR_HWREG_GAMMA_LUT_0_BASE +
+           (Channel * XV_GAMMA_LUT_CH_STRIDE);
+    for (Index = 0; Index < LoaderPtr->NumWords; ++Index) {
+      LoaderPtr->Core[Channel][Index] =
+        XV_gamma_lut_ReadReg(GammaPtr->Config.BaseAddress, Addr + (Index * 4));
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function queues a table image for upload. An upload in progress is
+* replaced and the new one starts over from the first word; words already
+* written are not written again unless they differ.
+*
+* @param  LoaderPtr is a pointer to the loader
+* @param  TablePtr is a pointer to the table image, owned by the loader until
+*         the upload completes
+*
+* @return None
+*
+******************************************************************************/
+void XV_gamma_lut_LoaderCommit(XV_gamma_lut_Loader *LoaderPtr,
+                               const XV_gamma_lut_Table *TablePtr)
+{
+  Xil_AssertVoid(LoaderPtr != NULL);
+  Xil_AssertVoid(TablePtr != NULL);
+
+  LoaderPtr->ImagePtr     = TablePtr;
+  LoaderPtr->Cursor       = 0;
+  LoaderPtr->WordsWritten = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function advances the upload in progress, writing the words of the
+* committed image that differ from the core tables
+*
+* @param  LoaderPtr is a pointer to the loader
+*
+* @return Number of words written by this call
+*
+* @note   Meant to be called from the frame done (vblank) interrupt handler.
+*         Does nothing if no upload is in progress.
+*
+******************************************************************************/
+u32 XV_gamma_lut_LoaderService(XV_gamma_lut_Loader *LoaderPtr)
+{
+  const XV_gamma_lut_Table *ImagePtr;
+  u32 Total, Budget, Written;
+  u32 Channel, Index;
+
+  Xil_AssertNonvoid(LoaderPtr != NULL);
+
+  ImagePtr = LoaderPtr->ImagePtr;
+  if (ImagePtr == NULL) {
+    return(0);
+  }
+
+  Total   = XV_GAMMA_LUT_NUM_CHANNELS * LoaderPtr->NumWords;
+  Budget  = (LoaderPtr->ChunkWords) ? LoaderPtr->ChunkWords : Total;
+  Written = 0;
+
+  while ((LoaderPtr->Cursor < Total) && (Written < Budget)) {
+    Channel = LoaderPtr->Cursor / LoaderPtr->NumWords;
+    Index   = LoaderPtr->Cursor % LoaderPtr->NumWords;
+
+    if (ImagePtr->Word[Channel][Index] != LoaderPtr->Core[Channel][Index]) {
+      XV_gamma_lut_WriteReg(LoaderPtr->GammaPtr->Config.BaseAddress,
+                            XV_GAMMA_LUT_CTRL_ADDR_HWREG_GAMMA_LUT_0_BASE +
+                            (Channel * XV_GAMMA_LUT_CH_STRIDE) + (Index * 4),
+                            ImagePtr->Word[Channel][Index]);
+      LoaderPtr->Core[Channel][Index] = ImagePtr->Word[Channel][Index];
+      ++Written;
+    }
+    ++LoaderPtr->Cursor;
+  }
+
+  LoaderPtr->WordsWritten += Written;
+  if (LoaderPtr->Cursor == Total) {
+    LoaderPtr->ImagePtr = NULL;
+  }
+
+  return(Written);
+}
+/** @} */
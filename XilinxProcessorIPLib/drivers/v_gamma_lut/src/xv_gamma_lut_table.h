@@ -0,0 +1,148 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xv_gamma_lut_table.h
+* @addtogroup v_gamma_lut_v1_0
+* @{
+* @details
+*
+* This header file contains the table loader of the gamma lut driver. The
+* loader removes the AXI-Lite burden of updating the lookup tables while the
+* core is processing video.
+*
+* <b>Table images</b>
+*
+* The application prepares a complete table image in memory with
+* XV_gamma_lut_TableSetChannel(), in the packed layout of the core (two 16 bit
+* entries per 32 bit word), and hands it to the loader with
+* XV_gamma_lut_LoaderCommit(). Committing while an upload is in progress
+* replaces it, the latest image wins. The image must be left untouched until
+* XV_gamma_lut_LoaderIsBusy() reports the upload as complete; keeping two
+* images and preparing the next grade in the idle one gives double buffered
+* tables without any copy.
+*
+* <b>Uploads</b>
+*
+* The loader keeps a copy of the words held by the core and only writes the
+* words that differ from the committed image, so small grading adjustments
+* turn into a few register writes. XV_gamma_lut_LoaderService() performs the
+* upload and is meant to be called from the frame done (vblank) interrupt:
+*   - with a chunk size of 0 the whole change is written in one call
+*   - otherwise at most the chunk size words are written per call and the
+*     upload is spread across several frames
+*
+* <b>Limitations</b>
+*
+* The core has a single bank per channel, read by the video path while it is
+* written, and no AXI-MM master. Words written while a frame is processed take
+* effect immediately; all-in-one uploads should therefore be serviced during
+* vertical blanking, and a chunked upload shows a partially updated table for
+* the frames it spans.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag    10/14/26   Initial Release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XV_GAMMA_LUT_TABLE_H       /* prevent circular inclusions */
+#define XV_GAMMA_LUT_TABLE_H       /* by using protection macros  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xv_gamma_lut.h"
+
+/************************** Constant Definitions *****************************/
+#define XV_GAMMA_LUT_NUM_CHANNELS  (3)
+#define XV_GAMMA_LUT_TABLE_WORDS   (XV_GAMMA_LUT_CTRL_DEPTH_HWREG_GAMMA_LUT_0/2)
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Table image, packed as in the core memory: word n holds entry 2n in
+ * bits [15:0] and entry 2n+1 in bits [31:16]
+ */
+typedef struct
+{
+  u32 Word[XV_GAMMA_LUT_NUM_CHANNELS][XV_GAMMA_LUT_TABLE_WORDS];
+}XV_gamma_lut_Table;
+
+/**
+ * Table loader. The user is required to allocate a variable of this type for
+ * every gamma lut core whose tables are updated on the fly.
+ */
+typedef struct
+{
+  XV_gamma_lut *GammaPtr;             /**< Layer 1 instance */
+  const XV_gamma_lut_Table *ImagePtr; /**< Image being uploaded, NULL if idle */
+  u32 NumWords;                       /**< Words per channel used by the core */
+  u32 ChunkWords;                     /**< Max words written per service, 0 = all */
+  u32 Cursor;                         /**< Next word to compare, over all channels */
+  u32 WordsWritten;                   /**< Words written by the current upload */
+  u32 Core[XV_GAMMA_LUT_NUM_CHANNELS][XV_GAMMA_LUT_TABLE_WORDS]; /**< Words held by the core */
+}XV_gamma_lut_Loader;
+
+/************************** Macros Definitions *******************************/
+/*****************************************************************************/
+/**
+* This macro returns TRUE while an upload is in progress
+*
+* @param  pLoader is pointer to the table loader
+*
+******************************************************************************/
+#define XV_gamma_lut_LoaderIsBusy(pLoader)  ((pLoader)->ImagePtr != NULL)
+
+/************************** Function Prototypes ******************************/
+void XV_gamma_lut_TableSetChannel(XV_gamma_lut_Table *TablePtr,
+                                  u32 Channel,
+                                  const u16 *LutPtr,
+                                  u32 NumEntries);
+int XV_gamma_lut_LoaderInitialize(XV_gamma_lut_Loader *LoaderPtr,
+                                  XV_gamma_lut *GammaPtr,
+                                  u32 ChunkWords);
+void XV_gamma_lut_LoaderCommit(XV_gamma_lut_Loader *LoaderPtr,
+                               const XV_gamma_lut_Table *TablePtr);
+u32 XV_gamma_lut_LoaderService(XV_gamma_lut_Loader *LoaderPtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+/** @} */
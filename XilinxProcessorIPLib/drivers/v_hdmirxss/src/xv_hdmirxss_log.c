@@ -49,6 +49,7 @@
  * 5.0   EB   16/01/18 Added new log XV_HDMIRXSS_LOG_EVT_PIX_REPEAT_ERR
  *            23/01/18 Minor cleanup
  *       MMO  05/02/18 Added new log XV_HDMIRXSS_LOG_EVT_SYNCEST
+ *       ag   10/14/26 Mirror log events into the BSP binary trace
  * </pre>
  *
 *******************************************************************************/
@@ -56,6 +57,7 @@
 /******************************* Include Files ********************************/
 
 #include "xv_hdmirxss.h"
+#include "xil_trace.h"
 
 /**************************** Function Prototypes *****************************/
 
@@ -101,6 +103,10 @@ void XV_HdmiRxSs_LogWrite(XV_HdmiRxSs *InstancePtr, XV_HdmiRxSs_LogEvent Evt, u8
     Xil_AssertVoid(Evt <= (XV_HDMIRXSS_LOG_EVT_DUMMY));
     Xil_AssertVoid(Data < 0xFF);
 
+    /* Mirror the event into the shared binary trace */
+    XIL_TRACE2(XIL_TRACE_ID(XIL_TRACE_MOD_HDMIRXSS, Evt),
+            InstancePtr->Config.DeviceId, Data);
+
     /* Write data and event into log buffer */
     InstancePtr->Log.DataBuffer[InstancePtr->Log.HeadIndex] =
             (Data << 8) | Evt;
@@ -46,6 +46,7 @@
  * 1.01  MMO  03/01/17 Add compiler option(XV_HDMITXSS_LOG_ENABLE) to enable Log
  * 5.0   EB   16/01/18 Added new log XV_HDMITXSS_LOG_EVT_PIX_REPEAT_ERR
  *            23/01/18 Minor cleanup
+ *       ag   10/14/26 Mirror log events into the BSP binary trace
  * </pre>
  *
 *******************************************************************************/
@@ -53,6 +54,7 @@
 /******************************* Include Files ********************************/
 
 #include "xv_hdmitxss.h"
+#include "xil_trace.h"
 
 /**************************** Function Prototypes *****************************/
 
@@ -99,6 +101,10 @@ void XV_HdmiTxSs_LogWrite(XV_HdmiTxSs *InstancePtr, XV_HdmiTxSs_LogEvent Evt, u8
 	Xil_AssertVoid(Evt <= (XV_HDMITXSS_LOG_EVT_DUMMY));
 	Xil_AssertVoid(Data < 0xFF);
 
+	/* Mirror the event into the shared binary trace */
+	XIL_TRACE2(XIL_TRACE_ID(XIL_TRACE_MOD_HDMITXSS, Evt),
+			InstancePtr->Config.DeviceId, Data);
+
 	/* Write data and event into log buffer */
 	InstancePtr->Log.DataBuffer[InstancePtr->Log.HeadIndex] =
 			(Data << 8) | Evt;
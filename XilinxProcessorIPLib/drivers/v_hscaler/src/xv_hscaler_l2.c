@@ -54,6 +54,8 @@
 * 3.1   rco   11/01/16   Fixed bug in config validation API, wherein hi/lo
 *                        check should be made only if input is not RGB
 *       rco   02/09/17   Fix c++ compilation warnings
+*       ag    10/14/26   Pack coefficients on load, skip reloading the same
+*                        internal table and add a phase cache
 * </pre>
 *
 ******************************************************************************/
@@ -91,7 +93,11 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
                             u32 PixelRate);
 
 static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr);
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr);
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, u32 *Image);
+static XV_HscalerPhaseCache *XV_HScalerGetPhases(XV_Hscaler_l2 *InstancePtr,
+                                                 u32 WidthIn,
+                                                 u32 WidthOut);
+static void XV_HScalerWriteImage(u32 BaseAddr, const u32 *Image, u32 NumWords);
 
 /*****************************************************************************/
 /**
@@ -243,10 +249,15 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
     numTaps = XV_HSCALER_TAPS_6;
   }
 
-  XV_HScalerLoadExtCoeff(InstancePtr,
-                         numPhases,
-                         numTaps,
-                         coeff);
+  /* Table already loaded, nothing to repack */
+  if(coeff != InstancePtr->CoeffSel)
+  {
+    XV_HScalerLoadExtCoeff(InstancePtr,
+                           numPhases,
+                           numTaps,
+                           coeff);
+    InstancePtr->CoeffSel = coeff;
+  }
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
@@ -271,6 +282,7 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
                             const short *Coeff)
 {
   int i,j, pad, offset;
+  int core_taps, rdIndx;
 
   /*
    * validate input arguments
@@ -322,10 +334,151 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
     }
   }
 
+  /* Pack the coefficients as they are written into the core registers */
+  core_taps = InstancePtr->Hsc.Config.NumTaps/2;
+  offset = (XV_HSCALER_MAX_H_TAPS - InstancePtr->Hsc.Config.NumTaps)/2;
+  for (i = 0; i < num_phases; i++)
+  {
+    for (j = 0; j < core_taps; j++)
+    {
+      rdIndx = j*2+offset;
+      InstancePtr->CoeffImage[i*core_taps+j] =
+              ((u32)InstancePtr->coeff[i][rdIndx+1] << 16) |
+              ((u32)InstancePtr->coeff[i][rdIndx] & XHSC_MASK_LOW_16BITS);
+    }
+  }
+  InstancePtr->CoeffSel = NULL;
+
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
 }
 
+/*****************************************************************************/
+/**
+* This function attaches a phase cache to the core instance. All entries are
+* marked unused.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  CachePtr is a pointer to the cache entries, or NULL to detach the
+*         cache
+* @param  NumEntries is the number of entries
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerSetPhaseCache(XV_Hscaler_l2 *InstancePtr,
+                             XV_HscalerPhaseCache *CachePtr,
+                             u16 NumEntries)
+{
+  u16 i;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid((CachePtr != NULL) || (NumEntries == 0));
+
+  for (i = 0; i < NumEntries; i++)
+  {
+    CachePtr[i].WidthIn  = 0;
+    CachePtr[i].WidthOut = 0;
+  }
+
+  InstancePtr->PhaseCache     = ((NumEntries) ? CachePtr : NULL);
+  InstancePtr->PhaseCacheSize = NumEntries;
+  InstancePtr->PhaseCacheNext = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function computes the phases for a scaling ratio into the phase cache
+* ahead of time, e.g. during initialization for the zoom steps used later.
+* The core registers are not changed.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input stream width
+* @param  WidthOut is the output stream width
+*
+* @return XST_SUCCESS if the phases are in the cache
+*         XST_FAILURE if no phase cache is attached
+*
+******************************************************************************/
+int XV_HScalerCachePhases(XV_Hscaler_l2 *InstancePtr,
+                          u32 WidthIn,
+                          u32 WidthOut)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((WidthIn>0) && (WidthIn<=InstancePtr->Hsc.Config.MaxWidth));
+  Xil_AssertNonvoid((WidthOut>0) && (WidthOut<=InstancePtr->Hsc.Config.MaxWidth));
+
+  if(InstancePtr->PhaseCache == NULL)
+  {
+    return XST_FAILURE;
+  }
+
+  XV_HScalerGetPhases(InstancePtr, WidthIn, WidthOut);
+  return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function looks up the phases for a scaling ratio in the phase cache.
+* On a miss the phases are computed into the next entry.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input stream width
+* @param  WidthOut is the output stream width
+*
+* @return Pointer to the cache entry
+*
+******************************************************************************/
+static XV_HscalerPhaseCache *XV_HScalerGetPhases(XV_Hscaler_l2 *InstancePtr,
+                                                 u32 WidthIn,
+                                                 u32 WidthOut)
+{
+  XV_HscalerPhaseCache *Entry;
+  u16 i;
+
+  for (i = 0; i < InstancePtr->PhaseCacheSize; i++)
+  {
+    Entry = &InstancePtr->PhaseCache[i];
+    if((Entry->WidthIn == WidthIn) && (Entry->WidthOut == WidthOut))
+    {
+      return Entry;
+    }
+  }
+
+  Entry = &InstancePtr->PhaseCache[InstancePtr->PhaseCacheNext];
+  InstancePtr->PhaseCacheNext = (InstancePtr->PhaseCacheNext + 1) %
+                                InstancePtr->PhaseCacheSize;
+
+  CalculatePhases(InstancePtr, WidthIn, WidthOut,
+                  (WidthIn * STEP_PRECISION)/WidthOut);
+  XV_HScalerSetPhase(InstancePtr, Entry->Image);
+  Entry->WidthIn  = WidthIn;
+  Entry->WidthOut = WidthOut;
+
+  return Entry;
+}
+
+/*****************************************************************************/
+/**
+* This function copies packed words into consecutive core registers
+*
+* @param  BaseAddr is the address of the first register
+* @param  Image is a pointer to the packed words
+* @param  NumWords is the number of words
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerWriteImage(u32 BaseAddr, const u32 *Image, u32 NumWords)
+{
+  u32 i;
+
+  for (i = 0; i < NumWords; i++)
+  {
+    Xil_Out32(BaseAddr+(i*4), Image[i]);
+  }
+}
+
 /*****************************************************************************/
 /**
 * This function calculates the phases for 1 line. Same phase info is used for
@@ -414,9 +567,12 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 
 /*****************************************************************************/
 /**
-* This function programs the phase data into core registers
+* This function programs the phase data into core registers, or packs it into
+* a phase cache entry
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  Image is a pointer to the packed phases of a cache entry, or NULL to
+*         write the core registers
 *
 * @return None
 *
@@ -424,7 +580,17 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 *        User must load the coefficients, using the provided API, before
 *        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
+/* Stores a packed phase word in the cache entry or in the core register */
+#define XHSC_PUT_PHASE(Idx, Val)                          \
+  do {                                                    \
+    if(Image) {                                           \
+      Image[(Idx)] = (Val);                               \
+    } else {                                              \
+      Xil_Out32(baseAddr+((Idx)*4), (Val));               \
+    }                                                     \
+  } while(0)
+
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, u32 *Image)
 {
   u32 baseAddr, loopWidth;
 
@@ -448,7 +614,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 lsb = (u32)(HscPtr->phasesH[i]   & (u64)XHSC_MASK_LOW_16BITS);
                 msb = (u32)(HscPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
                 val = (msb<<16 | lsb);
-                Xil_Out32(baseAddr+(index*4), val);
+                XHSC_PUT_PHASE(index, val);
                 ++index;
               }
             }
@@ -464,7 +630,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
               for(i=0; i < loopWidth; ++i)
               {
                 val = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(i*4), val);
+                XHSC_PUT_PHASE(i, val);
               }
             }
             break;
@@ -485,8 +651,8 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 phaseHData = HscPtr->phasesH[index];
                 lsb = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
                 msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(offset*4), lsb);
-                Xil_Out32(baseAddr+((offset+1)*4), msb);
+                XHSC_PUT_PHASE(offset, lsb);
+                XHSC_PUT_PHASE((offset+1), msb);
                 ++index;
                 offset += 2;
               }
@@ -497,6 +663,7 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
            break;
   }
 }
+#undef XHSC_PUT_PHASE
 
 
 /*****************************************************************************/
@@ -516,20 +683,11 @@ static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr)
 {
   int num_phases = 1<<HscPtr->Hsc.Config.PhaseShift;
   int num_taps   = HscPtr->Hsc.Config.NumTaps/2;
-  int val,i,j,offset,rdIndx;
   u32 baseAddr;
 
-  offset = (XV_HSCALER_MAX_H_TAPS - HscPtr->Hsc.Config.NumTaps)/2;
+  /* Coefficients were packed when loaded */
   baseAddr = XV_hscaler_Get_HwReg_hfltCoeff_BaseAddress(&HscPtr->Hsc);
-  for (i = 0; i < num_phases; i++)
-  {
-    for(j=0; j < num_taps; j++)
-    {
-       rdIndx = j*2+offset;
-       val = (HscPtr->coeff[i][rdIndx+1] << 16) | (HscPtr->coeff[i][rdIndx] & XHSC_MASK_LOW_16BITS);
-       Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
-    }
-  }
+  XV_HScalerWriteImage(baseAddr, HscPtr->CoeffImage, num_phases*num_taps);
 }
 
 /*****************************************************************************/
@@ -585,11 +743,21 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
     XV_HScalerSetCoeff(InstancePtr);
   }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
+  if(InstancePtr->PhaseCache)
+  {
+    /* Program cached Phase into the IP register bank */
+    XV_HScalerWriteImage(XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&InstancePtr->Hsc),
+                         XV_HScalerGetPhases(InstancePtr, WidthIn, WidthOut)->Image,
+                         InstancePtr->Hsc.Config.MaxWidth/2);
+  }
+  else
+  {
+    /* Compute Phase for 1 line */
+    CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
 
-  /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr);
+    /* Program computed Phase into the IP register bank */
+    XV_HScalerSetPhase(InstancePtr, NULL);
+  }
 
   XV_hscaler_Set_HwReg_Height(&InstancePtr->Hsc,        HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(&InstancePtr->Hsc,       WidthIn);
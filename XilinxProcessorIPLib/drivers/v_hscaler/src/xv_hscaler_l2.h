@@ -70,6 +70,20 @@
 * Advanced users always have the capability to directly interact with the IP
 * core using Layer-1 API's that perform low level register peek/poke.
 *
+* <b> Coefficient And Phase Caching </b>
+*
+* The filter coefficients are packed into the register layout of the core when
+* they are loaded, and the internal table selected for a scaling ratio is only
+* reloaded when the selection changes. Setting up the core then is a plain
+* copy of the packed words into the core.
+*
+* The phase table of a line depends on the input and output width. To avoid
+* computing it again on every resolution change, e.g. for dynamic zoom or PIP,
+* the application can attach a phase cache with XV_HScalerSetPhaseCache().
+* Each entry holds the packed phase words for one (WidthIn, WidthOut) pair;
+* entries are filled on first use or ahead of time with XV_HScalerCachePhases()
+* and are replaced round robin when the cache is full.
+*
 * <b> Interrupts </b>
 *
 * This driver does not have any interrupts
@@ -96,6 +110,7 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.1   ag    10/14/26   Added packed coefficients and phase cache
 * </pre>
 *
 ******************************************************************************/
@@ -117,6 +132,13 @@ extern "C" {
 #define XV_HSCALER_MAX_H_TAPS           (12)
 #define XV_HSCALER_MAX_H_PHASES         (64)
 #define XV_HSCALER_MAX_LINE_WIDTH       (3840)
+/*@}*/
+
+/** Number of 32 bit words of the packed coefficients */
+#define XV_HSCALER_COEFF_IMAGE_WORDS    (XV_HSCALER_MAX_H_PHASES * \
+                                         XV_HSCALER_MAX_H_TAPS / 2)
+/** Number of 32 bit words of the packed phases of a line */
+#define XV_HSCALER_PHASE_IMAGE_WORDS    (XV_HSCALER_MAX_LINE_WIDTH / 2)
 
 /**************************** Type Definitions *******************************/
 /**
@@ -140,6 +162,17 @@ typedef enum
   XV_HSCALER_TAPS_12 = 12
 }XV_HSCALER_TAPS;
 
+/**
+ * Phase cache entry. The phases are kept packed as they are written into the
+ * core registers.
+ */
+typedef struct
+{
+  u32 WidthIn;   /**< Input width of the entry, 0 if unused */
+  u32 WidthOut;  /**< Output width of the entry */
+  u32 Image[XV_HSCALER_PHASE_IMAGE_WORDS]; /**< Packed phases */
+}XV_HscalerPhaseCache;
+
 /**
  * H Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every H Scaler device in the system. A pointer to a
@@ -151,6 +184,11 @@ typedef struct
   u8 UseExtCoeff;
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
+  const short *CoeffSel;           /*<< Internal table in coeff, or NULL */
+  u32 CoeffImage[XV_HSCALER_COEFF_IMAGE_WORDS]; /*<< Packed coeff */
+  XV_HscalerPhaseCache *PhaseCache;  /*<< Phase cache, or NULL */
+  u16 PhaseCacheSize;              /*<< Number of phase cache entries */
+  u16 PhaseCacheNext;              /*<< Next entry to replace */
 }XV_Hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -199,6 +237,12 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
                             u16 num_phases,
                             u16 num_taps,
                             const short *Coeff);
+void XV_HScalerSetPhaseCache(XV_Hscaler_l2 *InstancePtr,
+                             XV_HscalerPhaseCache *CachePtr,
+                             u16 NumEntries);
+int XV_HScalerCachePhases(XV_Hscaler_l2 *InstancePtr,
+                          u32 WidthIn,
+                          u32 WidthOut);
 int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
                      u32 HeightIn,
                      u32 WidthIn,
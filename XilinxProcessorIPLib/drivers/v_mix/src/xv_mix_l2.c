@@ -66,6 +66,9 @@
 * 3.00  vyc   10/04/17   Add second buffer pointer for semi-planar formats
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable fromb bit 8 to bit 15
+*       ag    10/14/26   Add layer update transactions. Changes are staged in
+*                        shadow registers and only modified registers are
+*                        written at commit
 * </pre>
 *
 ******************************************************************************/
@@ -373,6 +376,7 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
     XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
     Status = XST_SUCCESS;
   }
+  InstancePtr->Txn.EnableValid = FALSE;
   return(Status);
 }
 
@@ -414,6 +418,7 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
     XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
     Status = XST_SUCCESS;
   }
+  InstancePtr->Txn.EnableValid = FALSE;
   return(Status);
 }
 
@@ -622,6 +627,8 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
        break;
   }//switch
 
+  /* Register written outside a transaction, shadow copy is stale */
+  InstancePtr->Txn.Layer[LayerId].Valid = 0;
   return(Status);
 }
 
@@ -783,6 +790,8 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
       }
       break;
   }
+  /* Register written outside a transaction, shadow copy is stale */
+  InstancePtr->Txn.Layer[LayerId].Valid = 0;
   return(Status);
 }
 
@@ -848,6 +857,8 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
       }
       break;
   }
+  /* Register written outside a transaction, shadow copy is stale */
+  InstancePtr->Txn.Layer[LayerId].Valid = 0;
   return(Status);
 }
 
@@ -946,6 +957,8 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
       }
       break;
   }
+  /* Register written outside a transaction, shadow copy is stale */
+  InstancePtr->Txn.Layer[LayerId].Valid = 0;
   return(Status);
 }
 
@@ -1140,6 +1153,8 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
         Status = XST_SUCCESS;
       }
   }
+  /* Register written outside a transaction, shadow copy is stale */
+  InstancePtr->Txn.Layer[LayerId].Valid = 0;
   return(Status);
 }
 
@@ -1226,6 +1241,8 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
         Status = XST_SUCCESS;
       }
   }
+  /* Register written outside a transaction, shadow copy is stale */
+  InstancePtr->Txn.Layer[LayerId].Valid = 0;
   return(Status);
 }
 
@@ -1264,6 +1281,733 @@ UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
   return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function returns the register offset backing a transaction register
+*
+* @param  LayerId is the layer to be updated
+* @param  Reg is the transaction register
+*
+* @return Register offset or 0 if the layer has no such register
+*
+******************************************************************************/
+static u32 TxnRegOffset(XVMix_LayerId LayerId, XVMix_TxnReg Reg)
+{
+  static const u32 LayerReg[XVMIX_TXN_REG_NUM] = {
+    XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA,
+    /* Buffer registers start at layer 1 */
+    (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA - XVMIX_REG_OFFSET),
+    (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA - XVMIX_REG_OFFSET)
+  };
+  static const u32 LogoReg[XVMIX_TXN_REG_NUM] = {
+    XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA,
+    0,
+    XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA,
+    XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA,
+    0,
+    0
+  };
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+    return(LogoReg[Reg]);
+  }
+  return(LayerReg[Reg] + (LayerId*XVMIX_REG_OFFSET));
+}
+
+/*****************************************************************************/
+/**
+* This function returns the value a layer register will have once the open
+* transaction is applied
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which information is requested
+* @param  Reg is the transaction register
+*
+* @return Staged value if any, else the current register value
+*
+******************************************************************************/
+static u32 TxnGetReg(XV_Mix_l2 *InstancePtr,
+                     XVMix_LayerId LayerId,
+                     XVMix_TxnReg Reg)
+{
+  XVMix_LayerShadow *Shadow = &InstancePtr->Txn.Layer[LayerId];
+  u16 Mask = (1<<Reg);
+
+  if(Shadow->Dirty & Mask) {
+    return(Shadow->Stage[Reg]);
+  }
+
+  if(!(Shadow->Valid & Mask)) {
+    Shadow->Hw[Reg] = XV_mix_ReadReg(InstancePtr->Mix.Config.BaseAddress,
+                                     TxnRegOffset(LayerId, Reg));
+    Shadow->Valid |= Mask;
+  }
+  return(Shadow->Hw[Reg]);
+}
+
+/*****************************************************************************/
+/**
+* This function records a layer register value in the open transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Reg is the transaction register
+* @param  Value is the value to be written at commit
+*
+* @return None
+*
+******************************************************************************/
+static void TxnSetReg(XV_Mix_l2 *InstancePtr,
+                      XVMix_LayerId LayerId,
+                      XVMix_TxnReg Reg,
+                      u32 Value)
+{
+  XVMix_LayerShadow *Shadow = &InstancePtr->Txn.Layer[LayerId];
+
+  Shadow->Stage[Reg] = Value;
+  Shadow->Dirty |= (1<<Reg);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the scale factor the layer will have once the open
+* transaction is applied
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which information is requested
+*
+* @return Scale factor (1X if scaling is not available for the layer)
+*
+******************************************************************************/
+static XVMix_Scalefactor TxnGetScale(XV_Mix_l2 *InstancePtr,
+                                     XVMix_LayerId LayerId)
+{
+  if((LayerId == XVMIX_LAYER_LOGO) ||
+     (XVMix_IsScalingEnabled(InstancePtr, LayerId))) {
+    return((XVMix_Scalefactor)TxnGetReg(InstancePtr, LayerId,
+                                        XVMIX_TXN_REG_SCALE));
+  }
+  return(XVMIX_SCALE_FACTOR_1X);
+}
+
+/*****************************************************************************/
+/**
+* This function checks the window of a layer against the frame and the layer
+* limits configured in the IP
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Win is the window to be validated
+* @param  Scale is the scale factor of the window
+*
+* @return XST_SUCCESS if window is valid else error code with reason
+*
+******************************************************************************/
+static int TxnCheckWindow(XV_Mix_l2 *InstancePtr,
+                          XVMix_LayerId LayerId,
+                          XVidC_VideoWindow *Win,
+                          XVMix_Scalefactor Scale)
+{
+  XV_mix *MixPtr = &InstancePtr->Mix;
+  u32 WinResInRange;
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+    WinResInRange = ((Win->Width  > (XVMIX_MIN_LOGO_WIDTH-1))  &&
+                     (Win->Height > (XVMIX_MIN_LOGO_HEIGHT-1)) &&
+                     (Win->Width  <= MixPtr->Config.MaxLogoWidth) &&
+                     (Win->Height <= MixPtr->Config.MaxLogoHeight));
+  } else {
+    WinResInRange = ((Win->Width  > (XVMIX_MIN_STRM_WIDTH-1))  &&
+                     (Win->Height > (XVMIX_MIN_STRM_HEIGHT-1)) &&
+                     (Win->Width  < MixPtr->Config.LayerMaxWidth[LayerId-1]) &&
+                     (Win->Height <= MixPtr->Config.MaxHeight));
+  }
+
+  if(!WinResInRange || !IsWindowValid(&InstancePtr->Stream, Win, Scale)) {
+    return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function checks if a layer can be staged in the open transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+*
+* @return XST_SUCCESS if layer can be staged else error code with reason
+*
+******************************************************************************/
+static int TxnCheckLayer(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
+{
+  if(InstancePtr->Txn.State != XVMIX_TXN_OPEN) {
+    return(XST_FAILURE);
+  }
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+    return(XVMix_IsLogoEnabled(InstancePtr) ? XST_SUCCESS :
+                                              XVMIX_ERR_DISABLED_IN_HW);
+  }
+  return((LayerId < XVMix_GetNumLayers(InstancePtr)) ? XST_SUCCESS :
+                                                       XVMIX_ERR_DISABLED_IN_HW);
+}
+
+/*****************************************************************************/
+/**
+* This function opens a layer update transaction. Subsequent XVMix_Txn*()
+* calls are staged in the driver and reach the core only when the transaction
+* is committed
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if transaction is opened
+*         XST_DEVICE_BUSY if previous commit is still waiting for frame done
+*
+* @note   Opening a transaction while another is open discards the changes
+*         staged so far
+*
+******************************************************************************/
+int XVMix_TxnBegin(XV_Mix_l2 *InstancePtr)
+{
+  XVMix_Txn *TxnPtr;
+  u32 index;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  TxnPtr = &InstancePtr->Txn;
+  if(TxnPtr->State == XVMIX_TXN_PENDING) {
+    return(XST_DEVICE_BUSY);
+  }
+
+  for(index=0; index<XVMIX_MAX_SUPPORTED_LAYERS; ++index) {
+    TxnPtr->Layer[index].Dirty = 0;
+  }
+  TxnPtr->EnableDirty = FALSE;
+  TxnPtr->State = XVMIX_TXN_OPEN;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function commits the open transaction. If the frame done interrupt is
+* enabled the staged changes are applied by the interrupt handler before the
+* next frame is started, otherwise they are applied immediately
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if transaction is committed
+*         XST_FAILURE if no transaction is open
+*
+******************************************************************************/
+int XVMix_TxnCommit(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->Txn.State != XVMIX_TXN_OPEN) {
+    return(XST_FAILURE);
+  }
+
+  if(XV_mix_InterruptGetEnabled(&InstancePtr->Mix) & XVMIX_IRQ_DONE_MASK) {
+    InstancePtr->Txn.State = XVMIX_TXN_PENDING;
+  } else {
+    XVMix_TxnApply(InstancePtr);
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function discards the open or pending transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_TxnAbort(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->Txn.State = XVMIX_TXN_IDLE;
+}
+
+/*****************************************************************************/
+/**
+* This function writes the staged changes of the committed transaction to the
+* core. Registers whose staged value matches the one last written are skipped.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+* @note   Called by the interrupt handler at frame done. Application needs to
+*         call it only if the done interrupt is serviced outside the driver.
+*
+******************************************************************************/
+void XVMix_TxnApply(XV_Mix_l2 *InstancePtr)
+{
+  XV_mix *MixPtr;
+  XVMix_Txn *TxnPtr;
+  XVMix_LayerShadow *Shadow;
+  XVMix_Layer *LayerPtr;
+  u32 LayerId, Reg, Writes = 0;
+  u16 Mask;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  MixPtr = &InstancePtr->Mix;
+  TxnPtr = &InstancePtr->Txn;
+
+  for(LayerId=XVMIX_LAYER_1; LayerId<XVMIX_MAX_SUPPORTED_LAYERS; ++LayerId) {
+    Shadow = &TxnPtr->Layer[LayerId];
+    if(!Shadow->Dirty) {
+      continue;
+    }
+
+    for(Reg=0; Reg<XVMIX_TXN_REG_NUM; ++Reg) {
+      Mask = (1<<Reg);
+      if(!(Shadow->Dirty & Mask)) {
+        continue;
+      }
+      if((Shadow->Valid & Mask) && (Shadow->Hw[Reg] == Shadow->Stage[Reg])) {
+        continue;
+      }
+      XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                      TxnRegOffset((XVMix_LayerId)LayerId, (XVMix_TxnReg)Reg),
+                      Shadow->Stage[Reg]);
+      Shadow->Hw[Reg] = Shadow->Stage[Reg];
+      Shadow->Valid |= Mask;
+      ++Writes;
+    }
+
+    /* Keep layer configuration in sync with the core */
+    LayerPtr = &InstancePtr->Layer[LayerId];
+    if(Shadow->Dirty & (1<<XVMIX_TXN_REG_STARTX)) {
+      LayerPtr->Win.StartX = Shadow->Hw[XVMIX_TXN_REG_STARTX];
+    }
+    if(Shadow->Dirty & (1<<XVMIX_TXN_REG_STARTY)) {
+      LayerPtr->Win.StartY = Shadow->Hw[XVMIX_TXN_REG_STARTY];
+    }
+    if(Shadow->Dirty & (1<<XVMIX_TXN_REG_WIDTH)) {
+      LayerPtr->Win.Width  = Shadow->Hw[XVMIX_TXN_REG_WIDTH];
+    }
+    if(Shadow->Dirty & (1<<XVMIX_TXN_REG_HEIGHT)) {
+      LayerPtr->Win.Height = Shadow->Hw[XVMIX_TXN_REG_HEIGHT];
+    }
+    if(Shadow->Dirty & (1<<XVMIX_TXN_REG_BUF1)) {
+      LayerPtr->BufAddr = Shadow->Hw[XVMIX_TXN_REG_BUF1];
+    }
+    if(Shadow->Dirty & (1<<XVMIX_TXN_REG_BUF2)) {
+      LayerPtr->ChromaBufAddr = Shadow->Hw[XVMIX_TXN_REG_BUF2];
+    }
+    Shadow->Dirty = 0;
+  }
+
+  if(TxnPtr->EnableDirty) {
+    if(!TxnPtr->EnableValid || (TxnPtr->EnableHw != TxnPtr->EnableStage)) {
+      XV_mix_Set_HwReg_layerEnable(MixPtr, TxnPtr->EnableStage);
+      TxnPtr->EnableHw = TxnPtr->EnableStage;
+      TxnPtr->EnableValid = TRUE;
+      ++Writes;
+    }
+    TxnPtr->EnableDirty = FALSE;
+  }
+
+  TxnPtr->RegWrites = Writes;
+  TxnPtr->State = XVMIX_TXN_IDLE;
+}
+
+/*****************************************************************************/
+/**
+* This function stages the enable of the specified layer in the open
+* transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is layer number to be enabled
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+* @note   To enable all layers use layer id  XVMIX_LAYER_ALL
+*
+******************************************************************************/
+int XVMix_TxnLayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
+{
+  XVMix_Txn *TxnPtr;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LAST));
+
+  TxnPtr = &InstancePtr->Txn;
+  if(TxnPtr->State != XVMIX_TXN_OPEN) {
+    return(XST_FAILURE);
+  }
+
+  if(!TxnPtr->EnableDirty) {
+    if(!TxnPtr->EnableValid) {
+      TxnPtr->EnableHw = XV_mix_Get_HwReg_layerEnable(&InstancePtr->Mix);
+      TxnPtr->EnableValid = TRUE;
+    }
+    TxnPtr->EnableStage = TxnPtr->EnableHw;
+  }
+
+  if(LayerId == XVMIX_LAYER_ALL) {
+    TxnPtr->EnableStage = XVMIX_MASK_ENABLE_ALL_LAYERS;
+  } else if((LayerId < XVMix_GetNumLayers(InstancePtr)) ||
+            ((LayerId == XVMIX_LAYER_LOGO) &&
+             (XVMix_IsLogoEnabled(InstancePtr)))) {
+    TxnPtr->EnableStage |= (1<<LayerId);
+  } else {
+    return(XST_FAILURE);
+  }
+  TxnPtr->EnableDirty = TRUE;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the disable of the specified layer in the open
+* transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is layer number to be disabled
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+* @note   To disable all layers use layer id  XVMIX_LAYER_ALL
+*
+******************************************************************************/
+int XVMix_TxnLayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
+{
+  XVMix_Txn *TxnPtr;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LAST));
+
+  TxnPtr = &InstancePtr->Txn;
+  if(TxnPtr->State != XVMIX_TXN_OPEN) {
+    return(XST_FAILURE);
+  }
+
+  if(!TxnPtr->EnableDirty) {
+    if(!TxnPtr->EnableValid) {
+      TxnPtr->EnableHw = XV_mix_Get_HwReg_layerEnable(&InstancePtr->Mix);
+      TxnPtr->EnableValid = TRUE;
+    }
+    TxnPtr->EnableStage = TxnPtr->EnableHw;
+  }
+
+  if(LayerId == XVMIX_LAYER_ALL) {
+    TxnPtr->EnableStage = XVMIX_MASK_DISABLE_ALL_LAYERS;
+  } else if((LayerId < XVMix_GetNumLayers(InstancePtr)) ||
+            ((LayerId == XVMIX_LAYER_LOGO) &&
+             (XVMix_IsLogoEnabled(InstancePtr)))) {
+    TxnPtr->EnableStage &= ~(1<<LayerId);
+  } else {
+    return(XST_FAILURE);
+  }
+  TxnPtr->EnableDirty = TRUE;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the window coordinates of the specified layer in the
+* open transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which window coordinates are to be set
+* @param  Win is the window coordinates in pixels
+* @param  StrideInBytes is the stride of the requested window
+*           (Applicable only when layer type is Memory)
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-8 and Logo Layer. Window is validated
+*         against the scale factor staged in the same transaction, if any
+*
+******************************************************************************/
+int XVMix_TxnSetLayerWindow(XV_Mix_l2 *InstancePtr,
+                            XVMix_LayerId LayerId,
+                            XVidC_VideoWindow *Win,
+                            u32 StrideInBytes)
+{
+  u32 Align;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId <= XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Win != NULL);
+  Xil_AssertNonvoid((Win->StartX % InstancePtr->Mix.Config.PixPerClk) == 0);
+  Xil_AssertNonvoid((Win->Width  % InstancePtr->Mix.Config.PixPerClk) == 0);
+
+  Status = TxnCheckLayer(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  Status = TxnCheckWindow(InstancePtr, LayerId, Win,
+                          TxnGetScale(InstancePtr, LayerId));
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  if((LayerId != XVMIX_LAYER_LOGO) &&
+     (!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId))) {
+    /* Check if stride is aligned to aximm width (2*PPC*32-bits) */
+    Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
+    if((StrideInBytes % Align) != 0) {
+      return(XVMIX_ERR_WIN_STRIDE_MISALIGNED);
+    }
+    TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_STRIDE, StrideInBytes);
+  }
+
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_STARTX, Win->StartX);
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_STARTY, Win->StartY);
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_WIDTH,  Win->Width);
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_HEIGHT, Win->Height);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages a new window position of the specified layer in the
+* open transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which window position is to be set
+* @param  StartX is the new X position
+* @param  StartY is the new Y position
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-8 and Logo Layer
+*
+******************************************************************************/
+int XVMix_TxnMoveLayerWindow(XV_Mix_l2 *InstancePtr,
+                             XVMix_LayerId LayerId,
+                             u16 StartX,
+                             u16 StartY)
+{
+  XVidC_VideoWindow Win;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId <= XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid((StartX % InstancePtr->Mix.Config.PixPerClk) == 0);
+
+  Status = TxnCheckLayer(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  Win.StartX = StartX;
+  Win.StartY = StartY;
+  Win.Width  = TxnGetReg(InstancePtr, LayerId, XVMIX_TXN_REG_WIDTH);
+  Win.Height = TxnGetReg(InstancePtr, LayerId, XVMIX_TXN_REG_HEIGHT);
+
+  if(!IsWindowValid(&InstancePtr->Stream, &Win,
+                    TxnGetScale(InstancePtr, LayerId))) {
+    return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  }
+
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_STARTX, StartX);
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_STARTY, StartY);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the scaling factor of the specified layer in the open
+* transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Scale is the scale factor
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-8 and Logo Layer
+*
+******************************************************************************/
+int XVMix_TxnSetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
+                                 XVMix_LayerId LayerId,
+                                 XVMix_Scalefactor Scale)
+{
+  XVidC_VideoWindow Win;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId <= XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid((Scale >= XVMIX_SCALE_FACTOR_1X) &&
+                    (Scale <= XVMIX_SCALE_FACTOR_4X));
+
+  Status = TxnCheckLayer(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  if((LayerId != XVMIX_LAYER_LOGO) &&
+     (!XVMix_IsScalingEnabled(InstancePtr, LayerId))) {
+    return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  /* Validate if scaling will cause the layer window to go out of scope */
+  Win.StartX = TxnGetReg(InstancePtr, LayerId, XVMIX_TXN_REG_STARTX);
+  Win.StartY = TxnGetReg(InstancePtr, LayerId, XVMIX_TXN_REG_STARTY);
+  Win.Width  = TxnGetReg(InstancePtr, LayerId, XVMIX_TXN_REG_WIDTH);
+  Win.Height = TxnGetReg(InstancePtr, LayerId, XVMIX_TXN_REG_HEIGHT);
+
+  if(!IsWindowValid(&InstancePtr->Stream, &Win, Scale)) {
+    return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  }
+
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_SCALE, Scale);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the Alpha level of the specified layer in the open
+* transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Alpha is the new value
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-8 and Logo Layer
+*
+******************************************************************************/
+int XVMix_TxnSetLayerAlpha(XV_Mix_l2 *InstancePtr,
+                           XVMix_LayerId LayerId,
+                           u16 Alpha)
+{
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId <= XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Alpha <= XVMIX_ALPHA_MAX);
+
+  Status = TxnCheckLayer(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  if((LayerId != XVMIX_LAYER_LOGO) &&
+     (!XVMix_IsAlphaEnabled(InstancePtr, LayerId))) {
+    return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_ALPHA, Alpha);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the specified layer in the open
+* transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of buffer in memory
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-8
+*
+******************************************************************************/
+int XVMix_TxnSetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
+                                XVMix_LayerId LayerId,
+                                UINTPTR Addr)
+{
+  UINTPTR Align;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Addr != 0);
+
+  Status = TxnCheckLayer(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+  Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
+  if((Addr % Align) != 0) {
+    return(XVMIX_ERR_MEM_ADDR_MISALIGNED);
+  }
+
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_BUF1, (u32)Addr);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the UV plane of the specified
+* layer in the open transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of second buffer in memory
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-8
+*
+******************************************************************************/
+int XVMix_TxnSetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
+                                      XVMix_LayerId LayerId,
+                                      UINTPTR Addr)
+{
+  UINTPTR Align;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Addr != 0);
+
+  Status = TxnCheckLayer(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+    return(Status);
+  }
+
+  /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+  Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
+  if((Addr % Align) != 0) {
+    return(XVMIX_ERR_MEM_ADDR_MISALIGNED);
+  }
+
+  TxnSetReg(InstancePtr, LayerId, XVMIX_TXN_REG_BUF2, (u32)Addr);
+
+  return(XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 * This function sets the logo layer color key data
@@ -105,6 +105,15 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Transactions </b>
+*
+* Layer updates can be batched with XVMix_TxnBegin(), the XVMix_Txn*() setters
+* and XVMix_TxnCommit(). The setters validate the request and record it in a
+* shadow copy of the layer registers without touching the core. In interrupt
+* mode the commit is deferred to the next frame done interrupt, where only the
+* registers whose value changed are written before the next frame is started.
+* In polling mode the commit is applied immediately.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -131,6 +140,7 @@
 * 3.00  vyc   10/04/17   Add second buffer pointer for semi-planar formats
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
+*       ag    10/14/26   Add layer update transactions with shadow registers
 * </pre>
 *
 ******************************************************************************/
@@ -237,6 +247,54 @@ typedef struct {
     };
 }XVMix_Layer;
 
+/**
+ * This typedef enumerates the layer registers tracked by a transaction
+ */
+typedef enum {
+  XVMIX_TXN_REG_STARTX = 0,
+  XVMIX_TXN_REG_STARTY,
+  XVMIX_TXN_REG_WIDTH,
+  XVMIX_TXN_REG_HEIGHT,
+  XVMIX_TXN_REG_STRIDE,
+  XVMIX_TXN_REG_SCALE,
+  XVMIX_TXN_REG_ALPHA,
+  XVMIX_TXN_REG_BUF1,
+  XVMIX_TXN_REG_BUF2,
+  XVMIX_TXN_REG_NUM
+}XVMix_TxnReg;
+
+/**
+ * This typedef enumerates the states of a layer update transaction
+ */
+typedef enum {
+  XVMIX_TXN_IDLE = 0,
+  XVMIX_TXN_OPEN,
+  XVMIX_TXN_PENDING
+}XVMix_TxnState;
+
+/**
+ * This typedef contains the shadow registers of a layer
+ */
+typedef struct {
+  u32 Stage[XVMIX_TXN_REG_NUM]; /**< Values requested by the transaction */
+  u32 Hw[XVMIX_TXN_REG_NUM];    /**< Values last written to the core */
+  u16 Dirty;                    /**< Registers staged in the transaction */
+  u16 Valid;                    /**< Registers for which Hw is up to date */
+}XVMix_LayerShadow;
+
+/**
+ * This typedef contains the state of a layer update transaction
+ */
+typedef struct {
+  XVMix_LayerShadow Layer[XVMIX_MAX_SUPPORTED_LAYERS]; /**< Per layer shadow */
+  u32 EnableStage;             /**< Layer enable mask requested */
+  u32 EnableHw;                /**< Layer enable mask last written */
+  u8 EnableDirty;              /**< Layer enable mask staged */
+  u8 EnableValid;              /**< EnableHw is up to date */
+  volatile XVMix_TxnState State; /**< Transaction state */
+  u32 RegWrites;               /**< Registers written by last commit */
+}XVMix_Txn;
+
 /**
 * Callback type for interrupt.
 *
@@ -269,6 +327,8 @@ typedef struct {
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVMix_Txn Txn;               /**< Layer update transaction */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -410,6 +470,20 @@ typedef struct {
 #define XVMix_IsLayerInterfaceStream(InstancePtr, LayerId) \
  ((InstancePtr)->Mix.Config.LayerIntrfType[LayerId-1] == XVMIX_LAYER_TYPE_STREAM)
 
+/*****************************************************************************/
+/**
+*
+* This macro checks if a committed transaction is waiting for the frame done
+* interrupt to be applied
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   TRUE(1)/FALSE(0)
+*
+******************************************************************************/
+#define XVMix_TxnIsPending(InstancePtr) \
+ ((InstancePtr)->Txn.State == XVMIX_TXN_PENDING)
+
 /**************************** Function Prototypes *****************************/
 int XVMix_Initialize(XV_Mix_l2 *InstancePtr, u16 DeviceId);
 void XVMix_Start(XV_Mix_l2 *InstancePtr);
@@ -475,6 +549,34 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
 void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr);
 void XVMix_DbgLayerInfo(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 
+/* Layer update transaction functions */
+int XVMix_TxnBegin(XV_Mix_l2 *InstancePtr);
+int XVMix_TxnCommit(XV_Mix_l2 *InstancePtr);
+void XVMix_TxnAbort(XV_Mix_l2 *InstancePtr);
+void XVMix_TxnApply(XV_Mix_l2 *InstancePtr);
+int XVMix_TxnLayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
+int XVMix_TxnLayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
+int XVMix_TxnSetLayerWindow(XV_Mix_l2 *InstancePtr,
+                            XVMix_LayerId LayerId,
+                            XVidC_VideoWindow *Win,
+                            u32 StrideInBytes);
+int XVMix_TxnMoveLayerWindow(XV_Mix_l2 *InstancePtr,
+                             XVMix_LayerId LayerId,
+                             u16 StartX,
+                             u16 StartY);
+int XVMix_TxnSetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
+                                 XVMix_LayerId LayerId,
+                                 XVMix_Scalefactor Scale);
+int XVMix_TxnSetLayerAlpha(XV_Mix_l2 *InstancePtr,
+                           XVMix_LayerId LayerId,
+                           u16 Alpha);
+int XVMix_TxnSetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
+                                XVMix_LayerId LayerId,
+                                UINTPTR Addr);
+int XVMix_TxnSetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
+                                      XVMix_LayerId LayerId,
+                                      UINTPTR Addr);
+
 /* Interrupt related function */
 void XVMix_InterruptHandler(void *InstancePtr);
 int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *CallbackRef);
@@ -46,6 +46,8 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   12/14/15   Initial Release
 *             02/12/16   Move user call back before frame start trigger
+*       ag    10/14/26   Apply committed layer update transaction at frame
+*                        done
 *
 * </pre>
 *
@@ -91,8 +93,9 @@ int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *Callback
 * This function is the interrupt handler for the mixer core driver.
 *
 * This handler clears the pending interrupt and determined if the source is
-* frame done signal. If yes, starts the next frame processing and calls the
-* registered callback function
+* frame done signal. If yes, applies the committed layer update transaction,
+* if any, calls the registered callback function and starts the next frame
+* processing
 *
 * The application is responsible for connecting this function to the interrupt
 * system. Application beyond this driver is also responsible for providing
@@ -124,6 +127,10 @@ void XVMix_InterruptHandler(void *InstancePtr)
 
   /* Check for Done Signal */
   if(Status & XVMIX_IRQ_DONE_MASK) {
+    //Apply committed layer updates before next frame is started
+    if(MixPtr->Txn.State == XVMIX_TXN_PENDING) {
+      XVMix_TxnApply(MixPtr);
+    }
     //Call user registered callback function, if any
     if(MixPtr->FrameDoneCallback) {
 	      MixPtr->FrameDoneCallback(MixPtr->CallbackRef);
@@ -43,6 +43,7 @@
 * Ver	Who	   Date		Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.0	jsr    07/17/17 Initial release.
+*       ag     10/14/26 Added XV_SdiRx_StartFastSearch.
 * </pre>
 *
 ******************************************************************************/
@@ -65,6 +66,7 @@
 /************************** Function Prototypes ******************************/
 
 static void StubCallback(void *CallbackRef);
+static u8 XV_SdiRx_SearchModeToSupportMask(XV_SdiRx_SearchMode Mode);
 
 /************************** Variable Definitions *****************************/
 
@@ -540,6 +542,42 @@ void XV_SdiRx_Start(XV_SdiRx *InstancePtr, XV_SdiRx_SearchMode Mode)
 				(XV_SDIRX_RST_CTRL_OFFSET), (Data));
 }
 
+/*****************************************************************************/
+/**
+*
+* This function starts the SDI RX core searching for the mode it was last
+* locked to. Forcing the detection logic to a single mode avoids stepping
+* through all the supported modes when the same source reconnects. If no
+* mode has been locked yet or the last locked mode is no longer enabled,
+* the core is started in XV_SDIRX_MULTISEARCHMODE.
+*
+* @param	InstancePtr is a pointer to the XV_SdiRx core instance.
+*
+* @return	The search mode the core was started with.
+*
+* @note		If the core does not lock within the time expected for the
+*		returned single search mode, the caller should restart it with
+*		XV_SdiRx_Start(InstancePtr, XV_SDIRX_MULTISEARCHMODE).
+*
+******************************************************************************/
+XV_SdiRx_SearchMode XV_SdiRx_StartFastSearch(XV_SdiRx *InstancePtr)
+{
+	XV_SdiRx_SearchMode Mode = XV_SDIRX_MULTISEARCHMODE;
+
+	/* Verify argument. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (InstancePtr->IsLastLockedModeValid &&
+		(InstancePtr->SupportedModes &
+		XV_SdiRx_SearchModeToSupportMask(InstancePtr->LastLockedMode))) {
+		Mode = InstancePtr->LastLockedMode;
+	}
+
+	XV_SdiRx_Start(InstancePtr, Mode);
+
+	return Mode;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -939,6 +977,39 @@ void XV_SdiRx_DisableMode(XV_SdiRx *InstancePtr,
 	InstancePtr->SupportedModes &= ~RemoveModes;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function returns the XV_SdiRx_SupportedModes bit matching a single
+* search mode.
+*
+* @param	Mode is the single search mode.
+*
+* @return	The supported mode bit or 0 for XV_SDIRX_MULTISEARCHMODE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u8 XV_SdiRx_SearchModeToSupportMask(XV_SdiRx_SearchMode Mode)
+{
+	switch (Mode) {
+	case XV_SDIRX_SINGLESEARCHMODE_HD:
+		return XV_SDIRX_SUPPORT_HD;
+	case XV_SDIRX_SINGLESEARCHMODE_SD:
+		return XV_SDIRX_SUPPORT_SD;
+	case XV_SDIRX_SINGLESEARCHMODE_3G:
+		return XV_SDIRX_SUPPORT_3G;
+	case XV_SDIRX_SINGLESEARCHMODE_6G:
+		return XV_SDIRX_SUPPORT_6G;
+	case XV_SDIRX_SINGLESEARCHMODE_12GI:
+		return XV_SDIRX_SUPPORT_12GI;
+	case XV_SDIRX_SINGLESEARCHMODE_12GF:
+		return XV_SDIRX_SUPPORT_12GF;
+	default:
+		return 0;
+	}
+}
+
 /*****************************************************************************/
 /**
 *
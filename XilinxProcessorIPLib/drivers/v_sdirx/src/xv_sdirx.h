@@ -40,6 +40,8 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.0   jsr    07/17/17 Initial release.
+*       ag     10/14/26 Added XV_SdiRx_StartFastSearch and last locked mode
+*                       tracking.
 * </pre>
 *
 ******************************************************************************/
@@ -228,6 +230,9 @@ typedef struct {
 	XSdiVid_Transport	Transport;
 	u8					SupportedModes;
 	u8					VideoStreamNum;
+
+	XV_SdiRx_SearchMode	LastLockedMode;	/**< Search mode matching the last lock */
+	u8					IsLastLockedModeValid;	/**< LastLockedMode is set */
 } XV_SdiRx;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -279,6 +284,7 @@ void XV_SdiRx_EnableMode(XV_SdiRx *InstancePtr,
 void XV_SdiRx_DisableMode(XV_SdiRx *InstancePtr,
 		XV_SdiRx_SupportedModes RemoveModes);
 void XV_SdiRx_Start(XV_SdiRx *InstancePtr, XV_SdiRx_SearchMode Mode);
+XV_SdiRx_SearchMode XV_SdiRx_StartFastSearch(XV_SdiRx *InstancePtr);
 int XV_SdiRx_Stop(XV_SdiRx *InstancePtr);
 u32 XV_SdiRx_ReportDetectedError(XV_SdiRx *InstancePtr);
 void XV_SdiRx_SetVidLckWindow(XV_SdiRx *InstancePtr, u32 Data);
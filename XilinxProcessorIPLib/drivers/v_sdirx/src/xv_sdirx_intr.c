@@ -43,6 +43,7 @@
 * Ver	Who	   Date		Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.0	jsr    07/17/17 Initial release.
+*       ag     10/14/26 Record the search mode matching the locked transport.
 * </pre>
 *
 ******************************************************************************/
@@ -66,6 +67,7 @@ static void SdiRx_VidLckIntrHandler(XV_SdiRx *InstancePtr);
 static void SdiRx_VidUnLckIntrHandler(XV_SdiRx *InstancePtr);
 static void SdiRx_OverFlowIntrHandler(XV_SdiRx *InstancePtr);
 static void SdiRx_UnderFlowIntrHandler(XV_SdiRx *InstancePtr);
+static void SdiRx_SaveLockedMode(XV_SdiRx *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -425,6 +427,9 @@ static void SdiRx_VidLckIntrHandler(XV_SdiRx *InstancePtr)
 			= (Data0 & XV_SDIRX_STS_SB_RX_TDATA_SDICTRL_BIT_RATE_MASK)
 				>> XV_SDIRX_STS_SB_RX_TDATA_SDICTRL_BIT_RATE_SHIFT;
 
+		/* Remember the mode so the next search can start with it */
+		SdiRx_SaveLockedMode(InstancePtr);
+
 		/* Toggle the CRC and EDH error count bits */
 		Data2 = XV_SdiRx_ReadReg(InstancePtr->Config.BaseAddress,
 						(XV_SDIRX_RST_CTRL_OFFSET));
@@ -832,3 +837,47 @@ static void SdiRx_UnderFlowIntrHandler(XV_SdiRx *InstancePtr)
 		InstancePtr->UnderFlowCallback(InstancePtr->UnderFlowRef);
 	}
 }
+
+/*****************************************************************************/
+/**
+*
+* This function saves the single search mode matching the transport the core
+* has locked to, for use by XV_SdiRx_StartFastSearch.
+*
+* @param	InstancePtr is a pointer to the XV_SdiRx core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void SdiRx_SaveLockedMode(XV_SdiRx *InstancePtr)
+{
+	InstancePtr->IsLastLockedModeValid = TRUE;
+
+	switch (InstancePtr->Transport.TMode) {
+	case XSDIVID_MODE_HD:
+		InstancePtr->LastLockedMode = XV_SDIRX_SINGLESEARCHMODE_HD;
+		break;
+	case XSDIVID_MODE_SD:
+		InstancePtr->LastLockedMode = XV_SDIRX_SINGLESEARCHMODE_SD;
+		break;
+	case XSDIVID_MODE_3GA:
+	case XSDIVID_MODE_3GB:
+		InstancePtr->LastLockedMode = XV_SDIRX_SINGLESEARCHMODE_3G;
+		break;
+	case XSDIVID_MODE_6G:
+		InstancePtr->LastLockedMode = XV_SDIRX_SINGLESEARCHMODE_6G;
+		break;
+	case XSDIVID_MODE_12G:
+		if (InstancePtr->Transport.IsFractional) {
+			InstancePtr->LastLockedMode = XV_SDIRX_SINGLESEARCHMODE_12GF;
+		} else {
+			InstancePtr->LastLockedMode = XV_SDIRX_SINGLESEARCHMODE_12GI;
+		}
+		break;
+	default:
+		InstancePtr->IsLastLockedModeValid = FALSE;
+		break;
+	}
+}
@@ -44,6 +44,7 @@
  * ----- ------ -------- -------------------------------------------------------
  * 1.00  jsr    07/17/17  Initial release.
  * 2.00  kar    01/25/18  Second release.
+ *       ag     10/14/26  Added XV_SdiRxSs_StartFastSearch.
  * </pre>
  *
  ******************************************************************************/
@@ -412,6 +413,33 @@ void XV_SdiRxSs_Start(XV_SdiRxSs *InstancePtr, XV_SdiRx_SearchMode Mode)
 	XV_SdiRxSs_LogWrite(InstancePtr, XV_SDIRXSS_LOG_EVT_START, 0);
 }
 
+/*****************************************************************************/
+/**
+*
+* This function starts the SDI RX stream detection with the mode the
+* subsystem was last locked to, falling back to XV_SDIRX_MULTISEARCHMODE
+* when there is none. See XV_SdiRx_StartFastSearch.
+*
+* @param	InstancePtr pointer to XV_SdiRxSs instance
+*
+* @return	The search mode the SDI RX core was started with.
+*
+* @note   None.
+*
+******************************************************************************/
+XV_SdiRx_SearchMode XV_SdiRxSs_StartFastSearch(XV_SdiRxSs *InstancePtr)
+{
+	XV_SdiRx_SearchMode Mode;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Mode = XV_SdiRx_StartFastSearch(InstancePtr->SdiRxPtr);
+
+	XV_SdiRxSs_LogWrite(InstancePtr, XV_SDIRXSS_LOG_EVT_START, Mode);
+
+	return Mode;
+}
+
 /*****************************************************************************/
 /**
 * This function stops the SDI RX stream detection.
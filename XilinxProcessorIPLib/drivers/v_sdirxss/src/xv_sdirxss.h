@@ -58,6 +58,7 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.00  jsr    07/17/17 Initial release.
+*       ag     10/14/26 Added XV_SdiRxSs_StartFastSearch.
 * </pre>
 *
 ******************************************************************************/
@@ -224,6 +225,7 @@ void XV_SdiRxSS_SdiRxIntrHandler(XV_SdiRxSs *InstancePtr);
 void XV_SdiRxSs_StreamFlowEnable(XV_SdiRxSs *InstancePtr);
 void XV_SdiRxSs_StreamFlowDisable(XV_SdiRxSs *InstancePtr);
 void XV_SdiRxSs_Start(XV_SdiRxSs *InstancePtr, XV_SdiRx_SearchMode Mode);
+XV_SdiRx_SearchMode XV_SdiRxSs_StartFastSearch(XV_SdiRxSs *InstancePtr);
 void XV_SdiRxSs_Stop(XV_SdiRxSs *InstancePtr);
 void XV_SdiRxSs_ReportDetectedError(XV_SdiRxSs *InstancePtr);
 int XV_SdiRxSs_SetCallback(XV_SdiRxSs *InstancePtr, u32 HandlerType,
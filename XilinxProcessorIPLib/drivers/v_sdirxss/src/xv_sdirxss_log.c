@@ -43,6 +43,7 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   jsr  07/17/17 Initial release.
+ *       ag   10/14/26 Mirror log events into the BSP binary trace
  * </pre>
  *
 *******************************************************************************/
@@ -50,6 +51,7 @@
 /******************************* Include Files ********************************/
 
 #include "xv_sdirxss.h"
+#include "xil_trace.h"
 
 /**************************** Function Prototypes *****************************/
 
@@ -95,6 +97,10 @@ void XV_SdiRxSs_LogWrite(XV_SdiRxSs *InstancePtr, XV_SdiRxSs_LogEvent Evt, u8 Da
 	Xil_AssertVoid(Evt <= (XV_SDIRXSS_LOG_EVT_DUMMY));
 	Xil_AssertVoid(Data < 0xFF);
 
+	/* Mirror the event into the shared binary trace */
+	XIL_TRACE2(XIL_TRACE_ID(XIL_TRACE_MOD_SDIRXSS, Evt),
+			InstancePtr->Config.DeviceId, Data);
+
 	/* Write data and event into log buffer */
 	InstancePtr->Log.DataBuffer[InstancePtr->Log.HeadIndex] =
 			(Data << 8) | Evt;
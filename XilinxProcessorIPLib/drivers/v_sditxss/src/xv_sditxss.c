@@ -46,6 +46,8 @@
  * 2.00  kar    01/25/18 Second  release.
  *       jsr    02/23/2018 Added YUV420 color format support
  *       jsr	03/02/2018 Added core settings API
+ *       ag     10/14/26 Skip VTC setup in XV_SdiTxSs_StreamStart when the
+ *                       stream timing is unchanged.
  * </pre>
  *
  ******************************************************************************/
@@ -86,6 +88,7 @@ XV_SdiTxSs_SubCores XV_SdiTxSs_SubCoreRepo[XPAR_XV_SDITXSS_NUM_INSTANCES];
 
 /************************** Function Prototypes ******************************/
 static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr);
+static u8 XV_SdiTxSs_IsVtcStreamSame(XV_SdiTxSs *InstancePtr);
 static void XV_SdiTxSs_ReportCoreInfo(XV_SdiTxSs *InstancePtr);
 static void XV_SdiTxSs_ReportSubcoreVersion(XV_SdiTxSs *InstancePtr);
 static void XV_SdiTxSs_ReportTiming(XV_SdiTxSs *InstancePtr);
@@ -733,6 +736,36 @@ static int XV_SdiTxSs_VtcSetup(XVtc *XVtcPtr, XV_SdiTx *SdiTxPtr)
 
 
 
+/*****************************************************************************/
+/**
+*
+* This function checks if the VTC has already been set up for the current
+* SDI TX stream. Only the fields used by XV_SdiTxSs_VtcSetup are compared.
+*
+* @param	InstancePtr is a pointer to the XV_SdiTxSs core instance.
+*
+* @return	TRUE if the VTC setup can be skipped, FALSE otherwise.
+*
+* @note   None.
+*
+******************************************************************************/
+static u8 XV_SdiTxSs_IsVtcStreamSame(XV_SdiTxSs *InstancePtr)
+{
+	const XVidC_VideoStream *NewPtr = &InstancePtr->SdiTxPtr->Stream[0].Video;
+	const XVidC_VideoStream *OldPtr = &InstancePtr->VtcStream;
+
+	if (!InstancePtr->IsVtcStreamValid) {
+		return FALSE;
+	}
+
+	return (NewPtr->VmId == OldPtr->VmId) &&
+		(NewPtr->PixPerClk == OldPtr->PixPerClk) &&
+		(NewPtr->ColorFormatId == OldPtr->ColorFormatId) &&
+		(NewPtr->IsInterlaced == OldPtr->IsInterlaced) &&
+		(memcmp(&NewPtr->Timing, &OldPtr->Timing,
+			sizeof(XVidC_VideoTiming)) == 0);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -765,10 +798,16 @@ void XV_SdiTxSs_StreamStart(XV_SdiTxSs *InstancePtr)
 
 	XV_SdiTx_VidBridgeEnable(InstancePtr->SdiTxPtr);
 
-	/* Configure VTC */
-	if (InstancePtr->VtcPtr) {
+	/* Configure VTC, unless it is already running with this timing */
+	if (InstancePtr->VtcPtr && !XV_SdiTxSs_IsVtcStreamSame(InstancePtr)) {
 		/* Setup VTC */
-		XV_SdiTxSs_VtcSetup(InstancePtr->VtcPtr, InstancePtr->SdiTxPtr);
+		if (XV_SdiTxSs_VtcSetup(InstancePtr->VtcPtr,
+					InstancePtr->SdiTxPtr) == XST_SUCCESS) {
+			InstancePtr->VtcStream = InstancePtr->SdiTxPtr->Stream[0].Video;
+			InstancePtr->IsVtcStreamValid = TRUE;
+		} else {
+			InstancePtr->IsVtcStreamValid = FALSE;
+		}
 	}
 
 	XV_SdiTx_Axi4sBridgeVtcEnable(InstancePtr->SdiTxPtr);
@@ -60,6 +60,7 @@
 * 1.00  jsr  07/17/17 Initial release.
 * 2.00  kar  01/25/18 Second  release.
 *       jsr  03/02/2018 Added core settings API
+*       ag   10/14/26 Skip VTC setup when the stream timing is unchanged.
 * </pre>
 *
 ******************************************************************************/
@@ -204,6 +205,9 @@ typedef struct {
 	void *Axi4sVidLockRef;  /**< To be passed to the Axi4s video lock callback */
 
 	u8 IsStreamUp;                /**< SDI TX Stream Up */
+
+	XVidC_VideoStream VtcStream;  /**< Stream the VTC was last set up for */
+	u8 IsVtcStreamValid;          /**< VtcStream holds a valid setup */
 } XV_SdiTxSs;
 
 /** @name SDITxSs Core Configurable Settings
@@ -45,6 +45,7 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   jsr  07/17/17 Initial release.
+ *       ag   10/14/26 Mirror log events into the BSP binary trace
  * </pre>
  *
 *******************************************************************************/
@@ -52,6 +53,7 @@
 /******************************* Include Files ********************************/
 
 #include "xv_sditxss.h"
+#include "xil_trace.h"
 
 /**************************** Function Prototypes *****************************/
 
@@ -98,6 +100,10 @@ void XV_SdiTxSs_LogWrite(XV_SdiTxSs *InstancePtr, XV_SdiTxSs_LogEvent Evt,
 	Xil_AssertVoid(Evt <= (XV_SDITXSS_LOG_EVT_DUMMY));
 	Xil_AssertVoid(Data < 0xFF);
 
+	/* Mirror the event into the shared binary trace */
+	XIL_TRACE2(XIL_TRACE_ID(XIL_TRACE_MOD_SDITXSS, Evt),
+			InstancePtr->Config.DeviceId, Data);
+
 	/* Write data and event into log buffer */
 	InstancePtr->Log.DataBuffer[InstancePtr->Log.HeadIndex] =
 			(Data << 8) | Evt;
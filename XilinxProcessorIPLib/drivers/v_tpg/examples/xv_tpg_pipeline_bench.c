@@ -0,0 +1,699 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xv_tpg_pipeline_bench.c
+*
+* This file contains a benchmark for the TPG -> VPSS -> Frame Buffer Write
+* video pipeline. It sweeps a table of use cases (input/output resolution and
+* frame rate, TPG color format, frame buffer memory format) and, for each of
+* them, reports on the UART
+*	- the achieved output frame rate,
+*	- the number of frames dropped by the pipeline,
+*	- the minimum, average and maximum frame latency, from the start of a
+*	  TPG frame to the done interrupt of the frame buffer write,
+*	- the AXI4 write and read bandwidth seen by the AXI Performance
+*	  Monitor, if the design has one.
+*
+* The TPG is started once per frame period of the input mode, from the
+* global timer, so the pipeline is loaded at the rate of the use case. A
+* frame period in which the TPG is still busy with the previous frame is
+* counted as dropped. The results are printed as one CSV line per use case
+* so that runs on different pipeline configurations can be compared.
+*
+* The example targets a Zynq UltraScale+ MPSoC design with one TPG, one
+* VPSS and one frame buffer write. The AXI Performance Monitor slot is to be
+* connected to the memory port used by the frame buffer write (and, for the
+* full fledged VPSS topology, its frame buffer); see BENCH_APM_SLOT.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 8.0   ag    10/14/26   Initial Release
+* </pre>
+*
+******************************************************************************/
+
+#include <string.h>
+#include "xparameters.h"
+#include "sleep.h"
+#include "xtime_l.h"
+#include "xscugic.h"
+#include "xil_exception.h"
+#include "xv_tpg.h"
+#include "xvprocss.h"
+#include "xv_frmbufwr_l2.h"
+#include "xvidc.h"
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+#include "xaxipmon.h"
+#endif
+
+#define DDR_BASEADDR XPAR_DDR_MEM_BASEADDR
+
+#define BENCH_VPSS_BUFFER_BASEADDR (DDR_BASEADDR + (0x20000000))
+#define BENCH_FRMBUF_BUFFER_BASEADDR (DDR_BASEADDR + (0x30000000))
+#define BENCH_CHROMA_ADDR_OFFSET (0x01000000U)
+
+#define BENCH_FRAMES_PER_CASE (600)  //frames measured per use case
+#define BENCH_SETTLE_FRAMES   (10)   //frames run before measuring
+#define BENCH_APM_SLOT        (0)    //APM slot on the frame buffer port
+#define BENCH_IDLE_TIMEOUT    (1000000)
+
+//one benchmark use case
+typedef struct {
+  XVidC_VideoMode   VmIn;        //TPG and VPSS input mode
+  XVidC_VideoMode   VmOut;       //VPSS output and frame buffer mode
+  XVidC_ColorFormat CfmtIn;      //TPG and VPSS input format
+  XVidC_ColorFormat MemFormat;   //frame buffer memory format
+  XVidC_ColorFormat CfmtOut;     //VPSS output format
+  u16 FormatBits;                //bits per component in memory
+} BenchCase;
+
+//results of one use case
+typedef struct {
+  u32 Frames;        //frames written by the frame buffer
+  u32 Dropped;       //frame periods the TPG could not be started in
+  u64 ElapsedTicks;  //measurement window
+  u64 LatSumTicks;
+  u64 LatMinTicks;
+  u64 LatMaxTicks;
+  u64 WrBytes;
+  u64 RdBytes;
+} BenchResult;
+
+static const BenchCase BenchCases[] =
+{
+  //input                output               TPG format           memory format            output format        bits
+  {XVIDC_VM_720_60_P,  XVIDC_VM_720_60_P,  XVIDC_CSF_RGB,       XVIDC_CSF_MEM_RGBX8,     XVIDC_CSF_RGB,       8},
+  {XVIDC_VM_720_60_P,  XVIDC_VM_720_60_P,  XVIDC_CSF_RGB,       XVIDC_CSF_MEM_Y_UV8,     XVIDC_CSF_YCRCB_422, 8},
+  {XVIDC_VM_1080_30_P, XVIDC_VM_1080_30_P, XVIDC_CSF_RGB,       XVIDC_CSF_MEM_RGBX8,     XVIDC_CSF_RGB,       8},
+  {XVIDC_VM_1080_60_P, XVIDC_VM_1080_60_P, XVIDC_CSF_RGB,       XVIDC_CSF_MEM_RGBX8,     XVIDC_CSF_RGB,       8},
+  {XVIDC_VM_1080_60_P, XVIDC_VM_1080_60_P, XVIDC_CSF_RGB,       XVIDC_CSF_MEM_YUYV8,     XVIDC_CSF_YCRCB_422, 8},
+  {XVIDC_VM_1080_60_P, XVIDC_VM_1080_60_P, XVIDC_CSF_YCRCB_444, XVIDC_CSF_MEM_Y_UV8_420, XVIDC_CSF_YCRCB_420, 8},
+  {XVIDC_VM_1080_60_P, XVIDC_VM_1080_60_P, XVIDC_CSF_RGB,       XVIDC_CSF_MEM_Y_UV10,    XVIDC_CSF_YCRCB_422, 10},
+  {XVIDC_VM_720_60_P,  XVIDC_VM_1080_60_P, XVIDC_CSF_RGB,       XVIDC_CSF_MEM_RGBX8,     XVIDC_CSF_RGB,       8},
+  {XVIDC_VM_1080_60_P, XVIDC_VM_720_60_P,  XVIDC_CSF_RGB,       XVIDC_CSF_MEM_RGBX8,     XVIDC_CSF_RGB,       8},
+  {XVIDC_VM_UHD_30_P,  XVIDC_VM_UHD_30_P,  XVIDC_CSF_RGB,       XVIDC_CSF_MEM_RGBX8,     XVIDC_CSF_RGB,       8},
+  {XVIDC_VM_UHD_60_P,  XVIDC_VM_UHD_60_P,  XVIDC_CSF_RGB,       XVIDC_CSF_MEM_YUYV8,     XVIDC_CSF_YCRCB_422, 8},
+  {XVIDC_VM_1080_60_P, XVIDC_VM_UHD_60_P,  XVIDC_CSF_RGB,       XVIDC_CSF_MEM_Y_UV8,     XVIDC_CSF_YCRCB_422, 8}
+};
+
+#define NUM_BENCH_CASES (sizeof(BenchCases)/sizeof(BenchCases[0]))
+
+XV_tpg         tpg;
+XVprocSs       vpss;
+XV_FrmbufWr_l2 frmbufwr;
+XScuGic        intc;
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+XAxiPmon       apm;
+#endif
+
+/* Start times of the frames in flight, indexed by frame number */
+#define BENCH_START_RING (8)
+static XTime FrameStart[BENCH_START_RING];
+static volatile u32 FramesStarted;
+static volatile u32 FramesDone;
+static volatile u8  Measuring;
+static BenchResult  Result;
+
+static int DriverInit(void);
+static int SetupInterrupts(void);
+static void FrameDoneCallback(void *CallbackRef);
+static u32 CalcStride(XVidC_ColorFormat Cfmt,
+                      u16 AXIMMDataWidth,
+                      u16 Width);
+static void SetStream(XVidC_VideoStream *StreamPtr,
+                      XVidC_VideoMode VmId,
+                      XVidC_ColorFormat Cfmt);
+static int ValidateCase(const BenchCase *CasePtr);
+static int ConfigPipeline(const BenchCase *CasePtr);
+static void StopPipeline(void);
+static void RunCase(const BenchCase *CasePtr);
+static void ReportCase(const BenchCase *CasePtr);
+
+/*****************************************************************************/
+/**
+ * This function initializes and configures the system interrupt controller
+ *
+ * @return XST_SUCCESS if init is OK else XST_FAILURE
+ *
+ *****************************************************************************/
+static int SetupInterrupts(void)
+{
+  int Status;
+  XScuGic *IntcPtr = &intc;
+  XScuGic_Config *IntcCfgPtr;
+
+  IntcCfgPtr = XScuGic_LookupConfig(XPAR_PSU_ACPU_GIC_DEVICE_ID);
+  if(IntcCfgPtr == NULL) {
+    xil_printf("ERROR:: Interrupt Controller not found\r\n");
+    return(XST_DEVICE_NOT_FOUND);
+  }
+  Status = XScuGic_CfgInitialize(IntcPtr,
+                                 IntcCfgPtr,
+                                 IntcCfgPtr->CpuBaseAddress);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: Intc initialization failed\r\n");
+    return(XST_FAILURE);
+  }
+
+  Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+                               (Xil_ExceptionHandler)XScuGic_InterruptHandler,
+                               IntcPtr);
+
+  Status = XScuGic_Connect(IntcPtr,
+                           XPAR_FABRIC_V_FRMBUF_WR_0_INTERRUPT_INTR,
+                           (XInterruptHandler)XVFrmbufWr_InterruptHandler,
+                           (void *)&frmbufwr);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: Frame Buffer Write interrupt connect failed\r\n");
+    return(XST_FAILURE);
+  }
+  XScuGic_Enable(IntcPtr, XPAR_FABRIC_V_FRMBUF_WR_0_INTERRUPT_INTR);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * This function initializes the TPG, VPSS, frame buffer write and APM.
+ *
+ * @return XST_SUCCESS if init is OK else XST_FAILURE
+ *
+ *****************************************************************************/
+static int DriverInit(void)
+{
+  int Status;
+  XV_tpg_Config *TpgCfgPtr;
+  XVprocSs_Config *VpssCfgPtr;
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+  XAxiPmon_Config *ApmCfgPtr;
+#endif
+
+  TpgCfgPtr = XV_tpg_LookupConfig(XPAR_V_TPG_0_DEVICE_ID);
+  if(TpgCfgPtr == NULL) {
+    xil_printf("ERROR:: TPG device not found\r\n");
+    return(XST_DEVICE_NOT_FOUND);
+  }
+  Status = XV_tpg_CfgInitialize(&tpg, TpgCfgPtr, TpgCfgPtr->BaseAddress);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: TPG Initialization failed %d\r\n", Status);
+    return(XST_FAILURE);
+  }
+
+  VpssCfgPtr = XVprocSs_LookupConfig(XPAR_V_PROC_SS_0_DEVICE_ID);
+  if(VpssCfgPtr == NULL) {
+    xil_printf("ERROR:: VPSS device not found\r\n");
+    return(XST_DEVICE_NOT_FOUND);
+  }
+  memset(&vpss, 0, sizeof(XVprocSs));
+  if((VpssCfgPtr->Topology == XVPROCSS_TOPOLOGY_FULL_FLEDGED) ||
+     (VpssCfgPtr->Topology == XVPROCSS_TOPOLOGY_DEINTERLACE_ONLY)) {
+    XVprocSs_SetFrameBufBaseaddr(&vpss, BENCH_VPSS_BUFFER_BASEADDR);
+  }
+  Status = XVprocSs_CfgInitialize(&vpss, VpssCfgPtr, VpssCfgPtr->BaseAddress);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: VPSS Initialization failed %d\r\n", Status);
+    return(XST_FAILURE);
+  }
+
+  Status = XVFrmbufWr_Initialize(&frmbufwr, XPAR_V_FRMBUF_WR_0_DEVICE_ID);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: Frame Buffer Write initialization failed\r\n");
+    return(XST_FAILURE);
+  }
+  XVFrmbufWr_SetCallback(&frmbufwr, XVFRMBUFWR_HANDLER_DONE,
+                         (void *)FrameDoneCallback, (void *)&frmbufwr);
+
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+  ApmCfgPtr = XAxiPmon_LookupConfig(XPAR_AXIPMON_0_DEVICE_ID);
+  if(ApmCfgPtr == NULL) {
+    xil_printf("ERROR:: APM device not found\r\n");
+    return(XST_DEVICE_NOT_FOUND);
+  }
+  Status = XAxiPmon_CfgInitialize(&apm, ApmCfgPtr, ApmCfgPtr->BaseAddress);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: APM Initialization failed %d\r\n", Status);
+    return(XST_FAILURE);
+  }
+  XAxiPmon_SetMetrics(&apm, BENCH_APM_SLOT, XAPM_METRIC_SET_2,
+                      XAPM_METRIC_COUNTER_0);
+  XAxiPmon_SetMetrics(&apm, BENCH_APM_SLOT, XAPM_METRIC_SET_3,
+                      XAPM_METRIC_COUNTER_1);
+#endif
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * This function is called by the frame buffer write driver when a frame has
+ * been written to memory. It accounts for the frame latency.
+ *
+ * @param  CallbackRef is the frame buffer write instance
+ *
+ * @return None
+ *
+ *****************************************************************************/
+static void FrameDoneCallback(void *CallbackRef)
+{
+  XTime Now;
+  XTime Latency;
+  u32 Frame;
+
+  (void)CallbackRef;
+
+  XTime_GetTime(&Now);
+
+  Frame = FramesDone++;
+  if(!Measuring || (Frame >= FramesStarted)) {
+    //frame started before the window, or repeated by the VPSS
+    return;
+  }
+
+  Latency = Now - FrameStart[Frame % BENCH_START_RING];
+  Result.Frames++;
+  Result.LatSumTicks += Latency;
+  if(Latency < Result.LatMinTicks) {
+    Result.LatMinTicks = Latency;
+  }
+  if(Latency > Result.LatMaxTicks) {
+    Result.LatMaxTicks = Latency;
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function calculates the stride
+ *
+ * @returns stride in bytes
+ *
+ *****************************************************************************/
+static u32 CalcStride(XVidC_ColorFormat Cfmt,
+                      u16 AXIMMDataWidth,
+                      u16 Width)
+{
+  u32 stride;
+  u16 MMWidthBytes = AXIMMDataWidth/8;
+
+  if ((Cfmt == XVIDC_CSF_MEM_Y_UV10) || (Cfmt == XVIDC_CSF_MEM_Y_UV10_420)
+      || (Cfmt == XVIDC_CSF_MEM_Y10)) {
+    // 4 bytes per 3 pixels (Y_UV10, Y_UV10_420, Y10)
+    stride = ((((Width*4)/3)+MMWidthBytes-1)/MMWidthBytes)*MMWidthBytes;
+  }
+  else if ((Cfmt == XVIDC_CSF_MEM_Y_UV8) || (Cfmt == XVIDC_CSF_MEM_Y_UV8_420)
+           || (Cfmt == XVIDC_CSF_MEM_Y8)) {
+    // 1 byte per pixel (Y_UV8, Y_UV8_420, Y8)
+    stride = ((Width+MMWidthBytes-1)/MMWidthBytes)*MMWidthBytes;
+  }
+  else if ((Cfmt == XVIDC_CSF_MEM_RGB8) || (Cfmt == XVIDC_CSF_MEM_YUV8)
+           || (Cfmt == XVIDC_CSF_MEM_BGR8)) {
+    // 3 bytes per pixel (RGB8, YUV8, BGR8)
+    stride = (((Width*3)+MMWidthBytes-1)/MMWidthBytes)*MMWidthBytes;
+  }
+  else if ((Cfmt == XVIDC_CSF_MEM_YUYV8) || (Cfmt == XVIDC_CSF_MEM_UYVY8)) {
+    // 2 bytes per pixel (YUYV8, UYVY8)
+    stride = (((Width*2)+MMWidthBytes-1)/MMWidthBytes)*MMWidthBytes;
+  }
+  else {
+    // 4 bytes per pixel
+    stride = (((Width*4)+MMWidthBytes-1)/MMWidthBytes)*MMWidthBytes;
+  }
+
+  return(stride);
+}
+
+/*****************************************************************************/
+/**
+ * This function fills a video stream for a mode and color format
+ *
+ * @return None
+ *
+ *****************************************************************************/
+static void SetStream(XVidC_VideoStream *StreamPtr,
+                      XVidC_VideoMode VmId,
+                      XVidC_ColorFormat Cfmt)
+{
+  StreamPtr->VmId          = VmId;
+  StreamPtr->Timing        = *XVidC_GetTimingInfo(VmId);
+  StreamPtr->FrameRate     = XVidC_GetFrameRate(VmId);
+  StreamPtr->IsInterlaced  = FALSE;
+  StreamPtr->ColorFormatId = Cfmt;
+  StreamPtr->ColorDepth    = (XVidC_ColorDepth)vpss.Config.ColorDepth;
+  StreamPtr->PixPerClk     = (XVidC_PixelsPerClock)vpss.Config.PixPerClock;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks if a use case is supported by the HW
+ *
+ * @return TRUE if the use case is valid else FALSE
+ *
+ *****************************************************************************/
+static int ValidateCase(const BenchCase *CasePtr)
+{
+  XVidC_VideoTiming const *InPtr = XVidC_GetTimingInfo(CasePtr->VmIn);
+  XVidC_VideoTiming const *OutPtr = XVidC_GetTimingInfo(CasePtr->VmOut);
+
+  if(XVidC_GetFrameRate(CasePtr->VmIn) !=
+     XVidC_GetFrameRate(CasePtr->VmOut)) {
+    xil_printf("Frame rate conversion is not benchmarked\r\n");
+    return(FALSE);
+  }
+
+  if((InPtr->HActive > vpss.Config.MaxWidth) ||
+     (InPtr->VActive > vpss.Config.MaxHeight) ||
+     (OutPtr->HActive > vpss.Config.MaxWidth) ||
+     (OutPtr->VActive > vpss.Config.MaxHeight)) {
+    xil_printf("Resolution not supported by the VPSS\r\n");
+    return(FALSE);
+  }
+
+  if((vpss.Config.PixPerClock == XVIDC_PPC_1) &&
+     ((CasePtr->VmIn == XVIDC_VM_UHD_60_P) ||
+      (CasePtr->VmOut == XVIDC_VM_UHD_60_P))) {
+    xil_printf("%s not supported for 1 pixel/clock\r\n",
+               XVidC_GetVideoModeStr(XVIDC_VM_UHD_60_P));
+    return(FALSE);
+  }
+
+  if(CasePtr->FormatBits > frmbufwr.FrmbufWr.Config.MaxDataWidth) {
+    xil_printf("Video Format %s is not supported in hardware\r\n",
+               XVidC_GetColorFormatStr(CasePtr->MemFormat));
+    return(FALSE);
+  }
+
+  return(TRUE);
+}
+
+/*****************************************************************************/
+/**
+ * This function configures the frame buffer write, VPSS and TPG for a use
+ * case. The TPG is left stopped.
+ *
+ * @return XST_SUCCESS if configuration is OK else XST_FAILURE
+ *
+ *****************************************************************************/
+static int ConfigPipeline(const BenchCase *CasePtr)
+{
+  XVidC_VideoStream StreamIn;
+  XVidC_VideoStream StreamOut;
+  UINTPTR ChromaAddr;
+  u32 Stride;
+  int Status;
+
+  SetStream(&StreamIn, CasePtr->VmIn, CasePtr->CfmtIn);
+  SetStream(&StreamOut, CasePtr->VmOut, CasePtr->CfmtOut);
+
+  /* Frame buffer write */
+  Stride = CalcStride(CasePtr->MemFormat,
+                      frmbufwr.FrmbufWr.Config.AXIMMDataWidth,
+                      StreamOut.Timing.HActive);
+
+  Status = XVFrmbufWr_SetMemFormat(&frmbufwr, Stride, CasePtr->MemFormat,
+                                   &StreamOut);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: Unable to configure Frame Buffer Write\r\n");
+    return(XST_FAILURE);
+  }
+
+  Status = XVFrmbufWr_SetBufferAddr(&frmbufwr, BENCH_FRMBUF_BUFFER_BASEADDR);
+  if((Status == XST_SUCCESS) &&
+     ((CasePtr->MemFormat == XVIDC_CSF_MEM_Y_UV8) ||
+      (CasePtr->MemFormat == XVIDC_CSF_MEM_Y_UV8_420) ||
+      (CasePtr->MemFormat == XVIDC_CSF_MEM_Y_UV10) ||
+      (CasePtr->MemFormat == XVIDC_CSF_MEM_Y_UV10_420))) {
+    ChromaAddr = BENCH_FRMBUF_BUFFER_BASEADDR + BENCH_CHROMA_ADDR_OFFSET;
+    Status = XVFrmbufWr_SetChromaBufferAddr(&frmbufwr, ChromaAddr);
+  }
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: Unable to configure Frame Buffer Write address\r\n");
+    return(XST_FAILURE);
+  }
+
+  XVFrmbufWr_InterruptEnable(&frmbufwr, XVFRMBUFWR_IRQ_DONE_MASK);
+  XVFrmbufWr_Start(&frmbufwr);
+
+  /* VPSS */
+  XVprocSs_SetVidStreamIn(&vpss, &StreamIn);
+  XVprocSs_SetVidStreamOut(&vpss, &StreamOut);
+  Status = XVprocSs_SetSubsystemConfig(&vpss);
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: VPSS configuration failed\r\n");
+    return(XST_FAILURE);
+  }
+
+  /* TPG, one frame per XV_tpg_Start() */
+  XV_tpg_DisableAutoRestart(&tpg);
+  XV_tpg_Set_height(&tpg, StreamIn.Timing.VActive);
+  XV_tpg_Set_width(&tpg, StreamIn.Timing.HActive);
+  XV_tpg_Set_colorFormat(&tpg, CasePtr->CfmtIn);
+  XV_tpg_Set_bckgndId(&tpg, XTPG_BKGND_COLOR_BARS);
+  XV_tpg_Set_ovrlayId(&tpg, 0);
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * This function lets the last frame drain and stops the pipeline
+ *
+ * @return None
+ *
+ *****************************************************************************/
+static void StopPipeline(void)
+{
+  u32 Timeout = BENCH_IDLE_TIMEOUT;
+
+  while(!XV_tpg_IsIdle(&tpg) && Timeout) {
+    --Timeout;
+  }
+  usleep(100000);
+
+  XVprocSs_Stop(&vpss);
+  XVFrmbufWr_InterruptDisable(&frmbufwr, XVFRMBUFWR_IRQ_DONE_MASK);
+  XVFrmbufWr_Stop(&frmbufwr);
+}
+
+/*****************************************************************************/
+/**
+ * This function runs the TPG at the frame rate of a use case and collects
+ * the results in Result.
+ *
+ * @return None
+ *
+ *****************************************************************************/
+static void RunCase(const BenchCase *CasePtr)
+{
+  XTime Period;
+  XTime Next;
+  XTime Now;
+  XTime WinStart;
+  u32 Frame;
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+  u32 WrLast = 0;
+  u32 RdLast = 0;
+  u32 Count;
+#endif
+
+  Period = COUNTS_PER_SECOND / XVidC_GetFrameRate(CasePtr->VmIn);
+
+  memset(&Result, 0, sizeof(Result));
+  Result.LatMinTicks = ~(u64)0;
+  Measuring = FALSE;
+  FramesStarted = 0;
+  FramesDone = 0;
+
+  XTime_GetTime(&Next);
+  for(Frame = 0; Frame < (BENCH_SETTLE_FRAMES + BENCH_FRAMES_PER_CASE);
+      ++Frame) {
+    do {
+      XTime_GetTime(&Now);
+    } while(Now < Next);
+    Next += Period;
+
+    if(Frame == BENCH_SETTLE_FRAMES) {
+      /* Open the measurement window on the next frame started */
+      Xil_ExceptionDisable();
+      FramesDone = FramesStarted;
+      Measuring = TRUE;
+      Xil_ExceptionEnable();
+      WinStart = Now;
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+      XAxiPmon_ResetMetricCounter(&apm);
+      XAxiPmon_EnableMetricsCounter(&apm);
+#endif
+    }
+
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+    /* Accumulate often enough for the 32 bit counters not to wrap twice */
+    if(Measuring) {
+      Count = XAxiPmon_GetMetricCounter(&apm, XAPM_METRIC_COUNTER_0);
+      Result.WrBytes += (u32)(Count - WrLast);
+      WrLast = Count;
+      Count = XAxiPmon_GetMetricCounter(&apm, XAPM_METRIC_COUNTER_1);
+      Result.RdBytes += (u32)(Count - RdLast);
+      RdLast = Count;
+    }
+#endif
+
+    if(!XV_tpg_IsIdle(&tpg)) {
+      /* The pipeline did not take the previous frame in time */
+      if(Measuring) {
+        Result.Dropped++;
+      }
+      continue;
+    }
+
+    FrameStart[FramesStarted % BENCH_START_RING] = Now;
+    FramesStarted++;
+    XV_tpg_Start(&tpg);
+  }
+
+  /* Close the window; late frames still count until the pipeline drains */
+  do {
+    XTime_GetTime(&Now);
+  } while(Now < Next);
+  Result.ElapsedTicks = Now - WinStart;
+
+#ifdef XPAR_XAXIPMON_NUM_INSTANCES
+  XAxiPmon_DisableMetricsCounter(&apm);
+  Count = XAxiPmon_GetMetricCounter(&apm, XAPM_METRIC_COUNTER_0);
+  Result.WrBytes += (u32)(Count - WrLast);
+  Count = XAxiPmon_GetMetricCounter(&apm, XAPM_METRIC_COUNTER_1);
+  Result.RdBytes += (u32)(Count - RdLast);
+#endif
+
+  Xil_ExceptionDisable();
+  Measuring = FALSE;
+  Xil_ExceptionEnable();
+}
+
+/*****************************************************************************/
+/**
+ * This function prints the results of a use case as a CSV line:
+ * input, output, memory format, target fps, achieved fps x100, frames,
+ * dropped, latency min/avg/max in us, write/read bandwidth in MB/s.
+ *
+ * @return None
+ *
+ *****************************************************************************/
+static void ReportCase(const BenchCase *CasePtr)
+{
+  u64 TicksPerUs = COUNTS_PER_SECOND / 1000000;
+  u32 Fps100 = 0;
+  u32 LatAvg = 0;
+  u32 LatMin = 0;
+  u32 LatMax = 0;
+  u32 WrMBps = 0;
+  u32 RdMBps = 0;
+
+  if(Result.ElapsedTicks) {
+    Fps100 = (u32)(((u64)Result.Frames * 100 * COUNTS_PER_SECOND) /
+                   Result.ElapsedTicks);
+    WrMBps = (u32)((Result.WrBytes * COUNTS_PER_SECOND) /
+                   (Result.ElapsedTicks * 1000000));
+    RdMBps = (u32)((Result.RdBytes * COUNTS_PER_SECOND) /
+                   (Result.ElapsedTicks * 1000000));
+  }
+  if(Result.Frames) {
+    LatAvg = (u32)((Result.LatSumTicks / Result.Frames) / TicksPerUs);
+    LatMin = (u32)(Result.LatMinTicks / TicksPerUs);
+    LatMax = (u32)(Result.LatMaxTicks / TicksPerUs);
+  }
+
+  xil_printf("BENCH,%s,%s,%s,%d,%d.%02d,%d,%d,%d,%d,%d,%d,%d\r\n",
+             XVidC_GetVideoModeStr(CasePtr->VmIn),
+             XVidC_GetVideoModeStr(CasePtr->VmOut),
+             XVidC_GetColorFormatStr(CasePtr->MemFormat),
+             XVidC_GetFrameRate(CasePtr->VmOut),
+             Fps100 / 100, Fps100 % 100,
+             Result.Frames, Result.Dropped,
+             LatMin, LatAvg, LatMax,
+             WrMBps, RdMBps);
+}
+
+/***************************************************************************
+*  This is the main loop of the application
+***************************************************************************/
+int main(void)
+{
+  int Status;
+  u32 Index;
+
+  xil_printf("Start Video Pipeline Benchmark\r\n");
+
+  Status = DriverInit();
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: Driver Initialization Failed\r\n");
+    return(XST_FAILURE);
+  }
+
+  Status = SetupInterrupts();
+  if(Status != XST_SUCCESS) {
+    xil_printf("ERROR:: Interrupt Setup Failed\r\n");
+    return(XST_FAILURE);
+  }
+  Xil_ExceptionEnable();
+
+  XVprocSs_ReportSubsystemConfig(&vpss);
+
+  xil_printf("BENCH,in,out,format,target_fps,fps,frames,dropped,"
+             "lat_min_us,lat_avg_us,lat_max_us,wr_MBps,rd_MBps\r\n");
+
+  for(Index = 0; Index < NUM_BENCH_CASES; ++Index) {
+    xil_printf("\r\nCase %d: %s -> %s (%s)\r\n", Index,
+               XVidC_GetVideoModeStr(BenchCases[Index].VmIn),
+               XVidC_GetVideoModeStr(BenchCases[Index].VmOut),
+               XVidC_GetColorFormatStr(BenchCases[Index].MemFormat));
+
+    if(!ValidateCase(&BenchCases[Index])) {
+      continue;
+    }
+
+    if(ConfigPipeline(&BenchCases[Index]) != XST_SUCCESS) {
+      StopPipeline();
+      continue;
+    }
+
+    RunCase(&BenchCases[Index]);
+    StopPipeline();
+    ReportCase(&BenchCases[Index]);
+  }
+
+  xil_printf("\r\nSuccessfully ran Video Pipeline Benchmark\r\n");
+
+  return(XST_SUCCESS);
+}
@@ -43,6 +43,8 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- -------------------------------------------------------
 * 1.00   mmo   02/12/16 Initial release.
+*        ag    10/14/26 Added stream table programming and per stream
+*                       statistics.
 
 * </pre>
 *
@@ -62,6 +64,10 @@
 /************************** Function Prototypes ******************************/
 
 static void StubCallback(void *CallbackRef);
+static u8 XDecap_StreamCfgDiffers(const XDecap_ChannelCfg *ProgrammedPtr,
+    const XDecap_ChannelCfg *CfgPtr);
+static void XDecap_StreamWrite(XDecap *InstancePtr, u16 Channels,
+    const XDecap_ChannelCfg *CfgPtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -1756,6 +1762,306 @@ void XDecap_PacketStopTimer(XDecap *InstancePtr, u16 Channels)
     XDecap_ChannelUpdate(InstancePtr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This function programs a batch of entries of the stream table. Each channel
+* whose configuration differs from the one last programmed is written with all
+* its registers staged and a single channel update, the other channels are not
+* accessed, so the streams they carry keep running undisturbed.
+*
+* @param    InstancePtr is a pointer to the XDecap core instance.
+*
+* @param    EntryPtr is a pointer to the array of stream table entries
+*
+* @param    NumEntries is the number of entries in the array
+*
+* @return   Number of channels that have been programmed.
+*
+* @note     InstancePtr->ChannelCfg holds the configuration last programmed
+*           and is updated with the entries.
+*
+******************************************************************************/
+u16 XDecap_StreamTableProgram(XDecap *InstancePtr,
+    const XDecap_StreamEntry *EntryPtr, u16 NumEntries)
+{
+    u16 Index;
+    u16 Channels;
+    u16 Programmed = 0;
+
+    /* Verify arguments. */
+    Xil_AssertNonvoid(InstancePtr != NULL);
+    Xil_AssertNonvoid((EntryPtr != NULL) || (NumEntries == 0));
+
+    for (Index = 0; Index < NumEntries; Index++) {
+        Channels = EntryPtr[Index].Channel;
+        Xil_AssertNonvoid(Channels < XDECAP_MAX_CHANNEL);
+
+        if (!XDecap_StreamCfgDiffers(&InstancePtr->ChannelCfg[Channels],
+                 &EntryPtr[Index].Cfg)) {
+            continue;
+        }
+
+        XDecap_StreamWrite(InstancePtr, Channels, &EntryPtr[Index].Cfg);
+        Programmed++;
+    }
+
+    return (Programmed);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a stream on a channel, or changes the stream it matches,
+* and enables the channel. The other channels are not accessed.
+*
+* @param    InstancePtr is a pointer to the XDecap core instance.
+*
+* @param    Channels is the channel of the stream
+*
+* @param    CfgPtr is a pointer to the configuration of the channel,
+*           Channel_Enable is ignored
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XDecap_StreamAdd(XDecap *InstancePtr, u16 Channels,
+    const XDecap_ChannelCfg *CfgPtr)
+{
+    XDecap_StreamEntry Entry;
+
+    /* Verify arguments. */
+    Xil_AssertVoid(InstancePtr != NULL);
+    Xil_AssertVoid(CfgPtr != NULL);
+    Xil_AssertVoid(Channels < XDECAP_MAX_CHANNEL);
+
+    Entry.Channel = Channels;
+    Entry.Cfg = *CfgPtr;
+    Entry.Cfg.Channel_Enable = XDECAP_CHANNEL_ENABLE;
+
+    (void)XDecap_StreamTableProgram(InstancePtr, &Entry, 1);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes the stream of a channel by disabling the channel.
+* The other channels are not accessed.
+*
+* @param    InstancePtr is a pointer to the XDecap core instance.
+*
+* @param    Channels is the channel of the stream
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XDecap_StreamRemove(XDecap *InstancePtr, u16 Channels)
+{
+    /* Verify arguments. */
+    Xil_AssertVoid(InstancePtr != NULL);
+    Xil_AssertVoid(Channels < XDECAP_MAX_CHANNEL);
+
+    if (InstancePtr->ChannelCfg[Channels].Channel_Enable ==
+            XDECAP_CHANNEL_DISABLE) {
+        return;
+    }
+
+    InstancePtr->ChannelCfg[Channels].Channel_Enable = XDECAP_CHANNEL_DISABLE;
+    XDecap_ControlChannelEn(InstancePtr, Channels);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the packet counters of the channels given in
+* ChannelMask into the channel statistic of the instance
+* (MediaValid_pkt_cnt, FECValid_pkt_cnt, ReOrdered_pkt_cnt, Drop_pkt_cnt).
+*
+* @param    InstancePtr is a pointer to the XDecap core instance.
+*
+* @param    ChannelMask has bit n set for each channel n to be read
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XDecap_StreamStatistic(XDecap *InstancePtr, u32 ChannelMask)
+{
+    u16 Channels;
+    UINTPTR BaseAddress;
+
+    /* Verify arguments. */
+    Xil_AssertVoid(InstancePtr != NULL);
+
+    BaseAddress = InstancePtr->Config.BaseAddress;
+
+    for (Channels = 0; Channels < XDECAP_MAX_CHANNEL; Channels++) {
+        if ((ChannelMask & ((u32)1 << Channels)) == 0) {
+            continue;
+        }
+
+        /* Select the Channel once for all its counters */
+        XDecap_ChannelAccess(InstancePtr, Channels);
+
+        InstancePtr->MediaValid_pkt_cnt[Channels] =
+            XDecap_ReadReg(BaseAddress, XDECAP_MEDIA_VALID_PACKET_COUNT_OFFSET);
+        InstancePtr->FECValid_pkt_cnt[Channels] =
+            XDecap_ReadReg(BaseAddress, XDECAP_FEC_VALID_PACKET_COUNT_OFFSET);
+        InstancePtr->ReOrdered_pkt_cnt[Channels] =
+            XDecap_ReadReg(BaseAddress,
+                XDECAP_FEC_REORDERED_PACKET_COUNT_OFFSET);
+        InstancePtr->Drop_pkt_cnt[Channels] =
+            XDecap_ReadReg(BaseAddress, XDECAP_DROP_PACKET_COUNT_OFFSET);
+    }
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks if a channel configuration differs from the one last
+* programmed. The stream status is not compared.
+*
+* @param    ProgrammedPtr is a pointer to the configuration last programmed
+*
+* @param    CfgPtr is a pointer to the new configuration
+*
+* @return   TRUE if the configurations differ, FALSE otherwise.
+*
+* @note     None.
+*
+******************************************************************************/
+static u8 XDecap_StreamCfgDiffers(const XDecap_ChannelCfg *ProgrammedPtr,
+    const XDecap_ChannelCfg *CfgPtr)
+{
+    const XDecap_Header *Old = &ProgrammedPtr->MatchHeader;
+    const XDecap_Header *New = &CfgPtr->MatchHeader;
+    const XDecap_MatchSelect *OldSel = &ProgrammedPtr->MatchSelect;
+    const XDecap_MatchSelect *NewSel = &CfgPtr->MatchSelect;
+
+    if ((ProgrammedPtr->Channel_Enable != CfgPtr->Channel_Enable) ||
+        (ProgrammedPtr->LosslessMode != CfgPtr->LosslessMode) ||
+        (ProgrammedPtr->MPkt_DetEn != CfgPtr->MPkt_DetEn) ||
+        (ProgrammedPtr->MPkt_DropEn != CfgPtr->MPkt_DropEn) ||
+        (ProgrammedPtr->is_MatchVlanPckt != CfgPtr->is_MatchVlanPckt) ||
+        (ProgrammedPtr->PacketStopTimer != CfgPtr->PacketStopTimer) ||
+        (OldSel->match_ssrc != NewSel->match_ssrc) ||
+        (OldSel->match_udp_dst != NewSel->match_udp_dst) ||
+        (OldSel->match_udp_src != NewSel->match_udp_src) ||
+        (OldSel->match_ip_dst != NewSel->match_ip_dst) ||
+        (OldSel->match_ip_src != NewSel->match_ip_src) ||
+        (OldSel->match_vlan_reg != NewSel->match_vlan_reg) ||
+        (Old->vlan_pcp_cfi_vid != New->vlan_pcp_cfi_vid) ||
+        (Old->ipv4_src_address != New->ipv4_src_address) ||
+        (Old->ipv4_dest_address != New->ipv4_dest_address) ||
+        (Old->udp_src_port != New->udp_src_port) ||
+        (Old->udp_dest_port != New->udp_dest_port) ||
+        (Old->ssrc != New->ssrc)) {
+        return (TRUE);
+    }
+
+    return (FALSE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stages all the registers of a channel and applies them with
+* a single channel update.
+*
+* @param    InstancePtr is a pointer to the XDecap core instance.
+*
+* @param    Channels is current configured channel
+*
+* @param    CfgPtr is a pointer to the configuration of the channel
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XDecap_StreamWrite(XDecap *InstancePtr, u16 Channels,
+    const XDecap_ChannelCfg *CfgPtr)
+{
+    UINTPTR BaseAddress = InstancePtr->Config.BaseAddress;
+    const XDecap_Header *Header = &CfgPtr->MatchHeader;
+    const XDecap_MatchSelect *Select = &CfgPtr->MatchSelect;
+    u32 RegValue;
+
+    /* Select the Channel */
+    XDecap_ChannelAccess(InstancePtr, Channels);
+
+    /* Match Parameters */
+    RegValue = XDecap_ReadReg(BaseAddress, XDECAP_MATCH_SELECT_OFFSET) &
+        ~(XDECAP_MATCH_SELECT_FILTER_ALL);
+    XDecap_WriteReg(BaseAddress, XDECAP_MATCH_SELECT_OFFSET, RegValue |
+        Select->match_ssrc | Select->match_udp_dst | Select->match_udp_src |
+        Select->match_ip_dst | Select->match_ip_src | Select->match_vlan_reg);
+
+    XDecap_WriteReg(BaseAddress, XDECAP_MATCH_DEST_IP0_OFFSET,
+        Header->ipv4_dest_address);
+    XDecap_WriteReg(BaseAddress, XDECAP_MATCH_SRC_IP0_OFFSET,
+        Header->ipv4_src_address);
+
+    RegValue = XDecap_ReadReg(BaseAddress, XDECAP_MATCH_UDP_DEST_PORT_OFFSET) &
+        ~(XDECAP_MATCH_UDP_DEST_PORT_MASK);
+    XDecap_WriteReg(BaseAddress, XDECAP_MATCH_UDP_DEST_PORT_OFFSET,
+        RegValue | (Header->udp_dest_port & XDECAP_MATCH_UDP_DEST_PORT_MASK));
+
+    RegValue = XDecap_ReadReg(BaseAddress, XDECAP_MATCH_UDP_SRC_PORT_OFFSET) &
+        ~(XDECAP_MATCH_UDP_SRC_PORT_MASK);
+    XDecap_WriteReg(BaseAddress, XDECAP_MATCH_UDP_SRC_PORT_OFFSET,
+        RegValue | (Header->udp_src_port & XDECAP_MATCH_UDP_SRC_PORT_MASK));
+
+    RegValue = XDecap_ReadReg(BaseAddress, XDECAP_MATCH_VLAN_ID_OFFSET) &
+        ~(XDECAP_MATCH_VLAN_ID_VLAN_TAG_MASK |
+          XDECAP_MATCH_VLAN_ID_VLAN_FILTER_ENABLE_MASK);
+    XDecap_WriteReg(BaseAddress, XDECAP_MATCH_VLAN_ID_OFFSET, RegValue |
+        (Header->vlan_pcp_cfi_vid & XDECAP_MATCH_VLAN_ID_VLAN_TAG_MASK) |
+        (((u32)CfgPtr->is_MatchVlanPckt <<
+            XDECAP_MATCH_VLAN_ID_VLAN_FILTER_ENABLE_SHIFT) &
+                XDECAP_MATCH_VLAN_ID_VLAN_FILTER_ENABLE_MASK));
+
+    XDecap_WriteReg(BaseAddress, XDECAP_MATCH_SSRC_OFFSET, Header->ssrc);
+
+    /* Packet Stop Timer (Only for Incoming ST2022-6 Packets) */
+    XDecap_WriteReg(BaseAddress, XDECAP_VIDEO_STOP_TIMER_OFFSET,
+        CfgPtr->PacketStopTimer);
+
+    /* Channel Control */
+    RegValue = XDecap_ReadReg(BaseAddress, XDECAP_CHANNEL_CONTROL_OFFSET) &
+        ~(XDECAP_CHANNEL_CONTROL_LOSSLESS_MODE_MASK |
+          XDECAP_CHANNEL_CONTROL_M_PKT_DET_EN_MASK |
+          XDECAP_CHANNEL_CONTROL_DROP_M_PKT_EN_MASK |
+          XDECAP_CHANNEL_CONTROL_CHANNEL_ENABLE_MASK);
+    XDecap_WriteReg(BaseAddress, XDECAP_CHANNEL_CONTROL_OFFSET, RegValue |
+        (CfgPtr->LosslessMode & XDECAP_CHANNEL_CONTROL_LOSSLESS_MODE_MASK) |
+        (((u32)CfgPtr->MPkt_DetEn << XDECAP_CHANNEL_CONTROL_M_PKT_DET_EN_SHIFT) &
+            XDECAP_CHANNEL_CONTROL_M_PKT_DET_EN_MASK) |
+        (((u32)CfgPtr->MPkt_DropEn <<
+            XDECAP_CHANNEL_CONTROL_DROP_M_PKT_EN_SHIFT) &
+                XDECAP_CHANNEL_CONTROL_DROP_M_PKT_EN_MASK) |
+        (CfgPtr->Channel_Enable & XDECAP_CHANNEL_CONTROL_CHANNEL_ENABLE_MASK));
+
+    /* Apply the Channel at once */
+    XDecap_ChannelUpdate(InstancePtr);
+
+    InstancePtr->ChannelCfg[Channels].Channel_Enable = CfgPtr->Channel_Enable;
+    InstancePtr->ChannelCfg[Channels].LosslessMode = CfgPtr->LosslessMode;
+    InstancePtr->ChannelCfg[Channels].MPkt_DetEn = CfgPtr->MPkt_DetEn;
+    InstancePtr->ChannelCfg[Channels].MPkt_DropEn = CfgPtr->MPkt_DropEn;
+    InstancePtr->ChannelCfg[Channels].is_MatchVlanPckt =
+        CfgPtr->is_MatchVlanPckt;
+    InstancePtr->ChannelCfg[Channels].MatchHeader = *Header;
+    InstancePtr->ChannelCfg[Channels].MatchSelect = *Select;
+    InstancePtr->ChannelCfg[Channels].PacketStopTimer =
+        CfgPtr->PacketStopTimer;
+}
+
 /*****************************************************************************/
 /**
 *
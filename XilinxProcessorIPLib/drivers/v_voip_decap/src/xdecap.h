@@ -70,6 +70,16 @@
 * This driver provides XDecap_SetCallback API to register functions with
 * Generic Decap core instance.
 *
+* <b>Stream Table</b>
+*
+* Streams can be added, changed and removed while the other channels keep
+* receiving with XDecap_StreamTableProgram(), XDecap_StreamAdd() and
+* XDecap_StreamRemove(). Each channel of the table is written with a single
+* channel update, so a new match takes effect atomically, and channels whose
+* configuration matches the one last programmed are not touched at all. The
+* module enable and the other channels are left as they are. The per channel
+* packet counters are read with XDecap_StreamStatistic().
+*
 * <b> Virtual Memory </b>
 *
 *
@@ -91,6 +101,8 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.00   mmo   02/12/16 Initial release.
+*        ag    10/14/26 Added stream table programming with a single channel
+*                       update per stream and per stream statistics.
 
 * </pre>
 *
@@ -389,6 +401,14 @@ typedef struct {
                                            Domain)*/
 } XDecap_ChannelCfg;
 
+/**
+* This typedef contains an entry of the VoIP Decapsulator Stream Table
+*/
+typedef struct {
+    u16                 Channel;    /**< Channel of the stream */
+    XDecap_ChannelCfg   Cfg;        /**< Configuration of the channel */
+} XDecap_StreamEntry;
+
 /**
 * Callback type for VoIP Decapsulator event interrupt.
 *
@@ -586,6 +606,14 @@ void XDecap_DisablePacketStopIntr(XDecap *InstancePtr, u16 Channels);
 void XDecap_IntrClear(XDecap *InstancePtr, u16 Channels);
 void XDecap_PacketStopTimer(XDecap *InstancePtr, u16 Channels);
 
+/* Stream Table */
+u16 XDecap_StreamTableProgram(XDecap *InstancePtr,
+    const XDecap_StreamEntry *EntryPtr, u16 NumEntries);
+void XDecap_StreamAdd(XDecap *InstancePtr, u16 Channels,
+    const XDecap_ChannelCfg *CfgPtr);
+void XDecap_StreamRemove(XDecap *InstancePtr, u16 Channels);
+void XDecap_StreamStatistic(XDecap *InstancePtr, u32 ChannelMask);
+
 
 /*  Interrupt Functions */
 void XDecap_IntrHandler(void *InstancePtr);
@@ -43,6 +43,8 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- -------------------------------------------------------
 * 1.00   mmo   02/12/16 Initial release.
+*        ag    10/14/26 Added stream table programming and per stream
+*                       statistics.
 
 * </pre>
 *
@@ -62,6 +64,11 @@
 
 /************************** Function Prototypes ******************************/
 
+static u8 XFramer_StreamCfgDiffers(const XFramer_ChannelCfg *ProgrammedPtr,
+                   const XFramer_ChannelCfg *CfgPtr);
+static void XFramer_StreamWrite(XFramer *InstancePtr, u16 Channels,
+                   const XFramer_ChannelCfg *CfgPtr);
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Definitions *****************************/
@@ -1180,3 +1187,274 @@ void XFramer_ClearTXPcktCnt(XFramer *InstancePtr, u16 Channels)
     XFramer_ChannelUpdate(InstancePtr);
 
 }
+
+/*****************************************************************************/
+/**
+*
+* This function programs a batch of entries of the stream table. Each channel
+* whose configuration differs from the one last programmed is written with all
+* its registers staged and a single channel update, the other channels are not
+* accessed, so the streams they carry keep running undisturbed.
+*
+* @param    InstancePtr is a pointer to the XFramer core instance.
+*
+* @param    EntryPtr is a pointer to the array of stream table entries
+*
+* @param    NumEntries is the number of entries in the array
+*
+* @return   Number of channels that have been programmed.
+*
+* @note     InstancePtr->ChannelCfg holds the configuration last programmed
+*           and is updated with the entries.
+*
+******************************************************************************/
+u16 XFramer_StreamTableProgram(XFramer *InstancePtr,
+                   const XFramer_StreamEntry *EntryPtr, u16 NumEntries)
+{
+    u16 Index;
+    u16 Channels;
+    u16 Programmed = 0;
+
+    /* Verify arguments. */
+    Xil_AssertNonvoid(InstancePtr != NULL);
+    Xil_AssertNonvoid((EntryPtr != NULL) || (NumEntries == 0));
+
+    for (Index = 0; Index < NumEntries; Index++) {
+        Channels = EntryPtr[Index].Channel;
+        Xil_AssertNonvoid(Channels < XFRAMER_MAX_CHANNEL);
+
+        if (!XFramer_StreamCfgDiffers(&InstancePtr->ChannelCfg[Channels],
+                         &EntryPtr[Index].Cfg)) {
+            continue;
+        }
+
+        XFramer_StreamWrite(InstancePtr, Channels, &EntryPtr[Index].Cfg);
+        Programmed++;
+    }
+
+    return (Programmed);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a stream on a channel, or changes the stream it carries,
+* and enables its transmission. The other channels are not accessed.
+*
+* @param    InstancePtr is a pointer to the XFramer core instance.
+*
+* @param    Channels is the channel of the stream
+*
+* @param    CfgPtr is a pointer to the configuration of the channel,
+*           Transmit_Enable is ignored
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XFramer_StreamAdd(XFramer *InstancePtr, u16 Channels,
+                   const XFramer_ChannelCfg *CfgPtr)
+{
+    XFramer_StreamEntry Entry;
+
+    /* Verify arguments. */
+    Xil_AssertVoid(InstancePtr != NULL);
+    Xil_AssertVoid(CfgPtr != NULL);
+    Xil_AssertVoid(Channels < XFRAMER_MAX_CHANNEL);
+
+    Entry.Channel = Channels;
+    Entry.Cfg = *CfgPtr;
+    Entry.Cfg.Transmit_Enable = XFRAMER_MODULE_TRANSMIT_ENABLE;
+
+    (void)XFramer_StreamTableProgram(InstancePtr, &Entry, 1);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes the stream of a channel by disabling its
+* transmission. The other channels are not accessed.
+*
+* @param    InstancePtr is a pointer to the XFramer core instance.
+*
+* @param    Channels is the channel of the stream
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XFramer_StreamRemove(XFramer *InstancePtr, u16 Channels)
+{
+    /* Verify arguments. */
+    Xil_AssertVoid(InstancePtr != NULL);
+    Xil_AssertVoid(Channels < XFRAMER_MAX_CHANNEL);
+
+    if (InstancePtr->ChannelCfg[Channels].Transmit_Enable ==
+                   XFRAMER_MODULE_TRANSMIT_DISABLE) {
+        return;
+    }
+
+    InstancePtr->ChannelCfg[Channels].Transmit_Enable =
+                   XFRAMER_MODULE_TRANSMIT_DISABLE;
+    XFramer_TransmitEnable(InstancePtr, Channels);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the transmitted packet count of the channels given in
+* ChannelMask into InstancePtr->ChannelCfg[].TX_PcktCnt.
+*
+* @param    InstancePtr is a pointer to the XFramer core instance.
+*
+* @param    ChannelMask has bit n set for each channel n to be read
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XFramer_StreamStatistic(XFramer *InstancePtr, u32 ChannelMask)
+{
+    u16 Channels;
+
+    /* Verify arguments. */
+    Xil_AssertVoid(InstancePtr != NULL);
+
+    for (Channels = 0; Channels < XFRAMER_MAX_CHANNEL; Channels++) {
+        if ((ChannelMask & ((u32)1 << Channels)) == 0) {
+            continue;
+        }
+        InstancePtr->ChannelCfg[Channels].TX_PcktCnt =
+                   XFramer_GetTXPcktCnt(InstancePtr, Channels);
+    }
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks if a channel configuration differs from the one last
+* programmed. The statistic is not compared.
+*
+* @param    ProgrammedPtr is a pointer to the configuration last programmed
+*
+* @param    CfgPtr is a pointer to the new configuration
+*
+* @return   TRUE if the configurations differ, FALSE otherwise.
+*
+* @note     None.
+*
+******************************************************************************/
+static u8 XFramer_StreamCfgDiffers(const XFramer_ChannelCfg *ProgrammedPtr,
+                   const XFramer_ChannelCfg *CfgPtr)
+{
+    const XFramer_Header *Old = &ProgrammedPtr->PcktHeader;
+    const XFramer_Header *New = &CfgPtr->PcktHeader;
+
+    if ((ProgrammedPtr->Transmit_Enable != CfgPtr->Transmit_Enable) ||
+        (ProgrammedPtr->is_vlan != CfgPtr->is_vlan) ||
+        (ProgrammedPtr->ipv6 != CfgPtr->ipv6) ||
+        (Old->Dest_MACAddr_Low != New->Dest_MACAddr_Low) ||
+        (Old->Dest_MACAddr_High != New->Dest_MACAddr_High) ||
+        (Old->vlan_pcp_cfi_vid != New->vlan_pcp_cfi_vid) ||
+        (Old->media_ttl != New->media_ttl) ||
+        (Old->media_tos != New->media_tos) ||
+        (Old->fec_ttl != New->fec_ttl) ||
+        (Old->fec_tos != New->fec_tos) ||
+        (Old->ip_src_address != New->ip_src_address) ||
+        (Old->ip_dest_address != New->ip_dest_address) ||
+        (Old->udp_src_port != New->udp_src_port) ||
+        (Old->udp_dest_port != New->udp_dest_port)) {
+        return (TRUE);
+    }
+
+    return (FALSE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stages all the registers of a channel and applies them with
+* a single channel update.
+*
+* @param    InstancePtr is a pointer to the XFramer core instance.
+*
+* @param    Channels is current configured channel
+*
+* @param    CfgPtr is a pointer to the configuration of the channel
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XFramer_StreamWrite(XFramer *InstancePtr, u16 Channels,
+                   const XFramer_ChannelCfg *CfgPtr)
+{
+    UINTPTR BaseAddress = InstancePtr->Config.BaseAddress;
+    const XFramer_Header *Header = &CfgPtr->PcktHeader;
+    u32 RegValue;
+
+    /* Select the Channel */
+    XFramer_ChannelAccess(InstancePtr, Channels);
+
+    XFramer_WriteReg(BaseAddress, XFRAMER_ETH_DEST_ADDR_LOW,
+            Header->Dest_MACAddr_Low);
+
+    RegValue = XFramer_ReadReg(BaseAddress, XFRAMER_ETH_DEST_ADDR_HIGH) &
+            ~(XFRAMER_ETH_DEST_ADDR_HIGH_MASK);
+    XFramer_WriteReg(BaseAddress, XFRAMER_ETH_DEST_ADDR_HIGH, RegValue |
+            (Header->Dest_MACAddr_High & XFRAMER_ETH_DEST_ADDR_HIGH_MASK));
+
+    RegValue = XFramer_ReadReg(BaseAddress, XFRAMER_VLAN_TAG_INFO) &
+            ~(XFRAMER_VLAN_TAG_INFO_WITH_VLAN_MASK);
+    if (CfgPtr->is_vlan == XFRAMER_VLAN_ENABLE) {
+        RegValue = (RegValue & ~(XFRAMER_VLAN_TAG_INFO_VLAN_ID_MASK)) |
+            (Header->vlan_pcp_cfi_vid & XFRAMER_VLAN_TAG_INFO_VLAN_ID_MASK);
+    }
+    XFramer_WriteReg(BaseAddress, XFRAMER_VLAN_TAG_INFO, RegValue |
+            (((u32)CfgPtr->is_vlan << XFRAMER_VLAN_TAG_INFO_WITH_VLAN_SHIFT) &
+                   XFRAMER_VLAN_TAG_INFO_WITH_VLAN_MASK));
+
+    RegValue = XFramer_ReadReg(BaseAddress, XFRAMER_MEDIA_IP_VER_TOS_TTL) &
+            ~(XFRAMER_IP_VER_TOS_TTL_TOS_MASK | XFRAMER_IP_VER_TOS_TTL_TTL_MASK);
+    XFramer_WriteReg(BaseAddress, XFRAMER_MEDIA_IP_VER_TOS_TTL, RegValue |
+            (((u32)Header->media_tos << XFRAMER_IP_VER_TOS_TTL_TOS_SHIFT) &
+                   XFRAMER_IP_VER_TOS_TTL_TOS_MASK) |
+            (Header->media_ttl & XFRAMER_IP_VER_TOS_TTL_TTL_MASK));
+
+    RegValue = XFramer_ReadReg(BaseAddress, XFRAMER_FEC_IP_VER_TOS_TTL) &
+            ~(XFRAMER_IP_VER_TOS_TTL_TOS_MASK | XFRAMER_IP_VER_TOS_TTL_TTL_MASK);
+    XFramer_WriteReg(BaseAddress, XFRAMER_FEC_IP_VER_TOS_TTL, RegValue |
+            (((u32)Header->fec_tos << XFRAMER_IP_VER_TOS_TTL_TOS_SHIFT) &
+                   XFRAMER_IP_VER_TOS_TTL_TOS_MASK) |
+            (Header->fec_ttl & XFRAMER_IP_VER_TOS_TTL_TTL_MASK));
+
+    XFramer_WriteReg(BaseAddress, XFRAMER_DEST_IP0, Header->ip_dest_address);
+    XFramer_WriteReg(BaseAddress, XFRAMER_SRC_IP0, Header->ip_src_address);
+
+    RegValue = XFramer_ReadReg(BaseAddress, XFRAMER_DEST_UDP_PORT) &
+            ~(XFRAMER_DEST_UDP_PORT_MASK);
+    XFramer_WriteReg(BaseAddress, XFRAMER_DEST_UDP_PORT, RegValue |
+            (Header->udp_dest_port & XFRAMER_DEST_UDP_PORT_MASK));
+
+    RegValue = XFramer_ReadReg(BaseAddress, XFRAMER_SOURCE_UDP_PORT) &
+            ~(XFRAMER_SOURCE_UDP_PORT_MASK);
+    XFramer_WriteReg(BaseAddress, XFRAMER_SOURCE_UDP_PORT, RegValue |
+            (Header->udp_src_port & XFRAMER_SOURCE_UDP_PORT_MASK));
+
+    XFramer_WriteReg(BaseAddress, XFRAMER_CHANNEL_CTRL,
+            (CfgPtr->Transmit_Enable &
+                   XFRAMER_CHANNEL_CTRL_TRANSMIT_ENABLE_MASK));
+
+    /* Apply the Channel at once */
+    XFramer_ChannelUpdate(InstancePtr);
+
+    InstancePtr->ChannelCfg[Channels].Transmit_Enable =
+            CfgPtr->Transmit_Enable;
+    InstancePtr->ChannelCfg[Channels].is_vlan = CfgPtr->is_vlan;
+    InstancePtr->ChannelCfg[Channels].ipv6 = CfgPtr->ipv6;
+    InstancePtr->ChannelCfg[Channels].PcktHeader = *Header;
+}
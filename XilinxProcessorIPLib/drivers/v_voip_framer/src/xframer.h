@@ -56,6 +56,16 @@
 * - Call XFramer_CfgInitialize to initialize the device and the driver
 *   instance associated with it.
 *
+* <b>Stream Table</b>
+*
+* Streams can be added, changed and removed while the other channels keep
+* transmitting with XFramer_StreamTableProgram(), XFramer_StreamAdd() and
+* XFramer_StreamRemove(). Each channel of the table is written with a single
+* channel update, so a header change takes effect atomically, and channels
+* whose configuration matches the one last programmed are not touched at all.
+* The per channel transmitted packet count is read with
+* XFramer_StreamStatistic().
+*
 * <b> Virtual Memory </b>
 *
 *
@@ -77,6 +87,8 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.00   mmo   02/12/16 Initial release.
+*        ag    10/14/26 Added stream table programming with a single channel
+*                       update per stream and per stream statistics.
 
 * </pre>
 *
@@ -167,6 +179,14 @@ typedef struct {
     XFramer_Header      PcktHeader;
 } XFramer_ChannelCfg;
 
+/**
+* This typedef contains an entry of the VoIP Framer Stream Table
+*/
+typedef struct {
+    u16                 Channel;    /**< Channel of the stream */
+    XFramer_ChannelCfg  Cfg;        /**< Configuration of the channel */
+} XFramer_StreamEntry;
+
 /**
 * This typedef contains configuration information for the VoIP Framer core.
 * Each VoIP Framer device should have a configuration structure associated.
@@ -272,6 +292,14 @@ void XFramer_UDPSrc(XFramer *InstancePtr, u16 Channels);
 u32 XFramer_GetTXPcktCnt(XFramer *InstancePtr, u16 Channels);
 void XFramer_ClearTXPcktCnt(XFramer *InstancePtr, u16 Channels);
 
+/* Stream Table */
+u16 XFramer_StreamTableProgram(XFramer *InstancePtr,
+                   const XFramer_StreamEntry *EntryPtr, u16 NumEntries);
+void XFramer_StreamAdd(XFramer *InstancePtr, u16 Channels,
+                   const XFramer_ChannelCfg *CfgPtr);
+void XFramer_StreamRemove(XFramer *InstancePtr, u16 Channels);
+void XFramer_StreamStatistic(XFramer *InstancePtr, u32 ChannelMask);
+
 
 /************************** Variable Declarations ****************************/
 
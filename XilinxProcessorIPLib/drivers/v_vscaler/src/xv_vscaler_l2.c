@@ -51,6 +51,8 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 *       rco   02/09/17   Fix c++ compilation warnings
+*       ag    10/14/26   Pack coefficients on load and skip reloading the same
+*                        internal table
 * </pre>
 *
 ******************************************************************************/
@@ -229,10 +231,15 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
     numTaps = XV_VSCALER_TAPS_6;
   }
 
-  XV_VScalerLoadExtCoeff(InstancePtr,
-		                 numPhases,
-		                 numTaps,
-		                 coeff);
+  /* Table already loaded, nothing to repack */
+  if(coeff != InstancePtr->CoeffSel)
+  {
+    XV_VScalerLoadExtCoeff(InstancePtr,
+		                   numPhases,
+		                   numTaps,
+		                   coeff);
+    InstancePtr->CoeffSel = coeff;
+  }
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
@@ -257,6 +264,7 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
                             const short *Coeff)
 {
   int i,j, pad, offset;
+  int core_taps, rdIndx;
 
   /*
    * validate input arguments
@@ -308,6 +316,21 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
     }
   }
 
+  /* Pack the coefficients as they are written into the core registers */
+  core_taps = InstancePtr->Vsc.Config.NumTaps/2;
+  offset = (XV_VSCALER_MAX_V_TAPS - InstancePtr->Vsc.Config.NumTaps)/2;
+  for (i = 0; i < num_phases; i++)
+  {
+    for (j = 0; j < core_taps; j++)
+    {
+      rdIndx = j*2+offset;
+      InstancePtr->CoeffImage[i*core_taps+j] =
+              ((u32)InstancePtr->coeff[i][rdIndx+1] << 16) |
+              ((u32)InstancePtr->coeff[i][rdIndx] & XVSC_MASK_LOW_16BITS);
+    }
+  }
+  InstancePtr->CoeffSel = NULL;
+
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
 }
@@ -331,21 +354,16 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 ******************************************************************************/
 static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr)
 {
-  int num_phases = 1<<VscPtr->Vsc.Config.PhaseShift;
-  int num_taps   = VscPtr->Vsc.Config.NumTaps/2;
-  int val,i,j,offset,rdIndx;
+  int num_words = (1<<VscPtr->Vsc.Config.PhaseShift) *
+                  (VscPtr->Vsc.Config.NumTaps/2);
+  int i;
   u32 baseAddr;
 
-  offset = (XV_VSCALER_MAX_V_TAPS - VscPtr->Vsc.Config.NumTaps)/2;
+  /* Coefficients were packed when loaded */
   baseAddr = XV_vscaler_Get_HwReg_vfltCoeff_BaseAddress(&VscPtr->Vsc);
-  for (i=0; i < num_phases; i++)
+  for (i=0; i < num_words; i++)
   {
-    for(j=0; j < num_taps; j++)
-    {
-       rdIndx = j*2+offset;
-       val = (VscPtr->coeff[i][rdIndx+1] << 16) | (VscPtr->coeff[i][rdIndx] & XVSC_MASK_LOW_16BITS);
-       Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
-    }
+    Xil_Out32(baseAddr+(i*4), VscPtr->CoeffImage[i]);
   }
 }
 
@@ -70,6 +70,13 @@
 * Advanced users always have the capability to directly interact with the IP
 * core using Layer-1 API's that perform low level register peek/poke.
 *
+* <b> Coefficients </b>
+*
+* The filter coefficients are packed into the register layout of the core when
+* they are loaded, and the internal table selected for a scaling ratio is only
+* reloaded when the selection changes. Setting up the core then is a plain
+* copy of the packed words into the core.
+*
 * <b> Interrupts </b>
 *
 * This driver does not have any interrupts
@@ -94,7 +101,7 @@
 * 1.00  rco   07/21/15   Initial Release
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
-*
+*       ag    10/14/26   Added packed coefficients
 * </pre>
 *
 ******************************************************************************/
@@ -116,6 +123,11 @@ extern "C" {
   */
  #define XV_VSCALER_MAX_V_TAPS           (12)
  #define XV_VSCALER_MAX_V_PHASES         (64)
+/*@}*/
+
+/** Number of 32 bit words of the packed coefficients */
+#define XV_VSCALER_COEFF_IMAGE_WORDS    (XV_VSCALER_MAX_V_PHASES * \
+                                         XV_VSCALER_MAX_V_TAPS / 2)
 
 /**************************** Type Definitions *******************************/
 /**
@@ -149,6 +161,8 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  const short *CoeffSel;           /*<< Internal table in coeff, or NULL */
+  u32 CoeffImage[XV_VSCALER_COEFF_IMAGE_WORDS]; /*<< Packed coeff */
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -67,6 +67,8 @@
  * 4.3   eb   26/01/18 Added API XVidC_GetVideoModeIdExtensive
  *       jsr  02/22/18 Added XVIDC_CSF_YCBCR_420 color space format
  *       vyc  04/04/18 Added BGR8 memory format
+ *       ag   10/14/26 XVidC_GetVideoModeId looks up the default timing table
+ *                     through a hash index instead of a binary search
  * </pre>
  *
 *******************************************************************************/
@@ -77,17 +79,32 @@
 #include "xstatus.h"
 #include "xvidc.h"
 
+/************************** Constant Definitions *****************************/
+
+/* Number of slots in the video mode hash index; a power of 2 at least twice
+ * the size of the default timing table. */
+#define XVIDC_VM_INDEX_SIZE	512
+#define XVIDC_VM_INDEX_EMPTY	0xFFFF
+
 /*************************** Variable Declarations ****************************/
 extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
 
 const XVidC_VideoTimingMode *XVidC_CustomTimingModes = NULL;
 int XVidC_NumCustomModes = 0;
 
+/* Open-addressed hash index of XVidC_VideoTimingModes, keyed by active
+ * width, active height, frame rate and scan type. Built on first use. */
+static u16 XVidC_VmIndex[XVIDC_VM_INDEX_SIZE];
+static u8 XVidC_VmIndexReady = 0;
+
 /**************************** Function Prototypes *****************************/
 
 static const XVidC_VideoTimingMode *XVidC_GetCustomVideoModeData(
 		XVidC_VideoMode VmId);
 static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN);
+static u32 XVidC_VmIndexHash(u32 Width, u32 Height, u32 FrameRate,
+		u8 IsInterlaced);
+static void XVidC_VmIndexBuild(void);
 
 /*************************** Function Definitions *****************************/
 
@@ -340,15 +357,12 @@ XVidC_VideoMode XVidC_GetVideoModeIdWBlanking(const XVidC_VideoTiming *Timing,
 XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 					u8 IsInterlaced)
 {
-	u32 Low;
-	u32 High;
-	u32 Mid;
 	u32 HActive;
 	u32 VActive;
 	u32 Rate;
-	u32 ResFound = (FALSE);
-	XVidC_VideoMode Mode;
+	u32 Slot;
 	u16 Index;
+	const XVidC_VideoTimingMode *VtmPtr;
 
 	/* First, attempt a linear search on the custom video timing table. */
 	if(XVidC_CustomTimingModes) {
@@ -364,82 +378,28 @@ XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 	  }
 	}
 
-	if (IsInterlaced) {
-		Low = (XVIDC_VM_INTL_START);
-		High = (XVIDC_VM_INTL_END);
+	if (!XVidC_VmIndexReady) {
+		XVidC_VmIndexBuild();
 	}
-	else {
-		Low = (XVIDC_VM_PROG_START);
-		High = (XVIDC_VM_PROG_END);
-	}
-
-	HActive = VActive = Rate = 0;
 
-	/* Binary search finds item in sorted array.
-	 * And returns index (zero based) of item
-	 * If item is not found returns flag remains
-	 * FALSE. Search key is "width or HActive"
-	 */
-	while (Low <= High) {
-		Mid = (Low + High) / 2;
-		HActive = XVidC_VideoTimingModes[Mid].Timing.HActive;
-		if (Width == HActive) {
-			ResFound = (TRUE);
-			break;
-		}
-		else if (Width < HActive) {
-			if (Mid == 0) {
-				break;
-			}
-			else {
-				High = Mid - 1;
-			}
-		}
-		else {
-			Low = Mid + 1;
-		}
-	}
-
-	 /* HActive matched at middle */
-	if (ResFound) {
-		/* Rewind to start index of mode with matching width */
-		while ((Mid > 0) &&
-			(XVidC_VideoTimingModes[Mid - 1].Timing.HActive ==
-								Width)) {
-			--Mid;
-		}
-
-		ResFound = (FALSE);
-		VActive = XVidC_VideoTimingModes[Mid].Timing.VActive;
-		Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-
-		/* Now do a linear search for matching VActive and Frame
-		 * Rate
-		 */
-		while (HActive == Width) {
-			/* check current entry */
-			if ((VActive == Height) && (Rate == FrameRate)) {
-				ResFound = (TRUE);
-				break;
-			}
-			/* Check next entry */
-			else {
-				Mid = Mid + 1;
-				HActive =
-				XVidC_VideoTimingModes[Mid].Timing.HActive;
-				VActive =
-				XVidC_VideoTimingModes[Mid].Timing.VActive;
-				Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-			}
+	IsInterlaced = (IsInterlaced) ? 1 : 0;
+
+	/* Probe the hash index. The index holds the first entry of the table
+	 * for each key, which is what XVidC_GetVideoModeIdRb relies on. */
+	Slot = XVidC_VmIndexHash(Width, Height, FrameRate, IsInterlaced);
+	while (XVidC_VmIndex[Slot] != XVIDC_VM_INDEX_EMPTY) {
+		Index = XVidC_VmIndex[Slot];
+		VtmPtr = &XVidC_VideoTimingModes[Index];
+		if ((VtmPtr->Timing.HActive == Width) &&
+			(VtmPtr->Timing.VActive == Height) &&
+			(VtmPtr->FrameRate == FrameRate) &&
+			((Index <= XVIDC_VM_INTL_END) == IsInterlaced)) {
+			return ((XVidC_VideoMode)Index);
 		}
-		Mode =
-		(ResFound) ? (XVidC_VideoMode)Mid : (XVIDC_VM_NOT_SUPPORTED);
-	}
-	else {
-		Mode = (XVIDC_VM_NOT_SUPPORTED);
+		Slot = (Slot + 1) & (XVIDC_VM_INDEX_SIZE - 1);
 	}
 
-	return (Mode);
+	return (XVIDC_VM_NOT_SUPPORTED);
 }
 
 /******************************************************************************/
@@ -1201,4 +1161,66 @@ static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN)
 	}
 	return 0;
 }
+/******************************************************************************/
+/**
+ * This function returns the slot at which the video mode hash index probe for
+ * the given key starts.
+ *
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced is 1 for interlaced and 0 for progressive modes.
+ *
+ * @return	A slot in XVidC_VmIndex.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_VmIndexHash(u32 Width, u32 Height, u32 FrameRate,
+		u8 IsInterlaced)
+{
+	u32 Hash;
+
+	Hash = (Width << 16) ^ Height;
+	Hash = (Hash * 0x9E3779B1) ^ (FrameRate << 1) ^ IsInterlaced;
+	Hash = Hash * 0x85EBCA6B;
+
+	return (Hash >> 23) & (XVIDC_VM_INDEX_SIZE - 1);
+}
+
+/******************************************************************************/
+/**
+ * This function builds the hash index of the default video timing table. The
+ * table is inserted in order so that for duplicate keys the entry with the
+ * lowest video mode ID is found first. As with the table's range markers,
+ * entries up to XVIDC_VM_INTL_END are interlaced.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_VmIndexBuild(void)
+{
+	u16 Index;
+	u32 Slot;
+	const XVidC_VideoTimingMode *VtmPtr;
+
+	for (Slot = 0; Slot < XVIDC_VM_INDEX_SIZE; Slot++) {
+		XVidC_VmIndex[Slot] = XVIDC_VM_INDEX_EMPTY;
+	}
+
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		VtmPtr = &XVidC_VideoTimingModes[Index];
+		Slot = XVidC_VmIndexHash(VtmPtr->Timing.HActive,
+				VtmPtr->Timing.VActive, VtmPtr->FrameRate,
+				(Index <= XVIDC_VM_INTL_END));
+		while (XVidC_VmIndex[Slot] != XVIDC_VM_INDEX_EMPTY) {
+			Slot = (Slot + 1) & (XVIDC_VM_INDEX_SIZE - 1);
+		}
+		XVidC_VmIndex[Slot] = Index;
+	}
+
+	XVidC_VmIndexReady = 1;
+}
 /** @} */
@@ -0,0 +1,344 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_fbring.c
+ * @addtogroup video_common_v4_3
+ * @{
+ *
+ * Contains the frame buffer ring which hands video frames in memory from a
+ * producer to a consumer. See xvidc_fbring.h for a description.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.3   ag   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc_fbring.h"
+
+/**************************** Function Prototypes *****************************/
+
+static u32 XVidC_FbRingFindReady(const XVidC_FbRing *RingPtr, u8 Newest);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a frame buffer ring. All buffers are free and
+ * their addresses have to be set with XVidC_FbRingSetBuffer() before the ring
+ * is used.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	NumBufs is the number of buffers, XVIDC_FBRING_MIN_BUFS to
+ *		XVIDC_FBRING_MAX_BUFS. With 4 or more buffers neither side
+ *		has to wait for the other.
+ * @param	Policy is the drop/repeat policy of the ring.
+ *
+ * @return
+ *		- XST_SUCCESS if the ring was initialized.
+ *		- XST_INVALID_PARAM if the number of buffers is out of range.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_FbRingInit(XVidC_FbRing *RingPtr, u32 NumBufs,
+		XVidC_FbRingPolicy Policy)
+{
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid((Policy == XVIDC_FBRING_POLICY_LATEST) ||
+			(Policy == XVIDC_FBRING_POLICY_ORDERED));
+
+	if ((NumBufs < XVIDC_FBRING_MIN_BUFS) ||
+			(NumBufs > XVIDC_FBRING_MAX_BUFS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (Index = 0; Index < XVIDC_FBRING_MAX_BUFS; Index++) {
+		RingPtr->Buf[Index].Addr       = 0;
+		RingPtr->Buf[Index].ChromaAddr = 0;
+		RingPtr->Buf[Index].State      = XVIDC_FBRING_FREE;
+		RingPtr->Buf[Index].FrameSeq   = 0;
+	}
+
+	RingPtr->NumBufs  = NumBufs;
+	RingPtr->Policy   = Policy;
+	RingPtr->WrSeq    = 0;
+	RingPtr->RdSeq    = 0;
+	RingPtr->Dropped  = 0;
+	RingPtr->Repeated = 0;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function sets the memory of a buffer in the ring.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	Index is the index of the buffer.
+ * @param	Addr is the address of the buffer, or of its luma plane for
+ *		semi-planar formats.
+ * @param	ChromaAddr is the address of the chroma plane for semi-planar
+ *		formats, 0 otherwise.
+ *
+ * @return
+ *		- XST_SUCCESS if the buffer was set.
+ *		- XST_DEVICE_BUSY if the buffer is in use.
+ *
+ * @note	The addresses must meet the alignment required by the cores
+ *		which access the buffers.
+ *
+*******************************************************************************/
+u32 XVidC_FbRingSetBuffer(XVidC_FbRing *RingPtr, u32 Index, UINTPTR Addr,
+		UINTPTR ChromaAddr)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(Index < RingPtr->NumBufs);
+	Xil_AssertNonvoid(Addr != 0);
+
+	if (RingPtr->Buf[Index].State != XVIDC_FBRING_FREE) {
+		return XST_DEVICE_BUSY;
+	}
+
+	RingPtr->Buf[Index].Addr       = Addr;
+	RingPtr->Buf[Index].ChromaAddr = ChromaAddr;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function acquires a buffer for the producer to write the next frame
+ * into. A free buffer is used if there is one. Otherwise, with the
+ * XVIDC_FBRING_POLICY_LATEST policy, the oldest complete frame which the
+ * consumer has not acquired is dropped and its buffer is used.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	IndexPtr is a pointer to the index of the acquired buffer.
+ *
+ * @return
+ *		- XST_SUCCESS if a buffer was acquired.
+ *		- XST_NO_DATA if no buffer is available.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_FbRingWrAcquire(XVidC_FbRing *RingPtr, u32 *IndexPtr)
+{
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(IndexPtr != NULL);
+
+	for (Index = 0; Index < RingPtr->NumBufs; Index++) {
+		if (RingPtr->Buf[Index].State == XVIDC_FBRING_FREE) {
+			break;
+		}
+	}
+
+	if ((Index == RingPtr->NumBufs) &&
+			(RingPtr->Policy == XVIDC_FBRING_POLICY_LATEST)) {
+		Index = XVidC_FbRingFindReady(RingPtr, FALSE);
+		if (Index != XVIDC_FBRING_NO_BUF) {
+			RingPtr->Dropped++;
+		}
+	}
+
+	if ((Index == RingPtr->NumBufs) || (Index == XVIDC_FBRING_NO_BUF)) {
+		return XST_NO_DATA;
+	}
+
+	RingPtr->Buf[Index].State = XVIDC_FBRING_WRITING;
+	*IndexPtr = Index;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function releases a buffer written by the producer. The frame in the
+ * buffer is complete and gets the next frame sequence number; from now on the
+ * consumer may acquire it.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	Index is the index of the buffer.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbRingWrRelease(XVidC_FbRing *RingPtr, u32 Index)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(RingPtr != NULL);
+	Xil_AssertVoid(Index < RingPtr->NumBufs);
+	Xil_AssertVoid(RingPtr->Buf[Index].State == XVIDC_FBRING_WRITING);
+
+	RingPtr->WrSeq++;
+	RingPtr->Buf[Index].FrameSeq = RingPtr->WrSeq;
+	RingPtr->Buf[Index].State    = XVIDC_FBRING_READY;
+}
+
+/******************************************************************************/
+/**
+ * This function acquires the next complete frame for the consumer. With the
+ * XVIDC_FBRING_POLICY_LATEST policy this is the newest complete frame and the
+ * older ones are dropped, with XVIDC_FBRING_POLICY_ORDERED it is the oldest.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	IndexPtr is a pointer to the index of the acquired buffer.
+ *
+ * @return
+ *		- XST_SUCCESS if a frame was acquired.
+ *		- XST_NO_DATA if there is no new complete frame. The consumer
+ *		  should read its current frame again.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_FbRingRdAcquire(XVidC_FbRing *RingPtr, u32 *IndexPtr)
+{
+	u32 Index;
+	u32 Older;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(IndexPtr != NULL);
+
+	Index = XVidC_FbRingFindReady(RingPtr,
+			(RingPtr->Policy == XVIDC_FBRING_POLICY_LATEST));
+	if (Index == XVIDC_FBRING_NO_BUF) {
+		if (RingPtr->RdSeq != 0) {
+			RingPtr->Repeated++;
+		}
+		return XST_NO_DATA;
+	}
+
+	RingPtr->Buf[Index].State = XVIDC_FBRING_READING;
+	RingPtr->RdSeq = RingPtr->Buf[Index].FrameSeq;
+
+	/* Drop the frames which were skipped. */
+	for (Older = 0; Older < RingPtr->NumBufs; Older++) {
+		if ((RingPtr->Buf[Older].State == XVIDC_FBRING_READY) &&
+			((s32)(RingPtr->Buf[Older].FrameSeq - RingPtr->RdSeq) < 0)) {
+			RingPtr->Buf[Older].State = XVIDC_FBRING_FREE;
+			RingPtr->Dropped++;
+		}
+	}
+
+	*IndexPtr = Index;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function releases a buffer held by the consumer once the hardware no
+ * longer reads from it.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	Index is the index of the buffer.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbRingRdRelease(XVidC_FbRing *RingPtr, u32 Index)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(RingPtr != NULL);
+	Xil_AssertVoid(Index < RingPtr->NumBufs);
+	Xil_AssertVoid(RingPtr->Buf[Index].State == XVIDC_FBRING_READING);
+
+	RingPtr->Buf[Index].State = XVIDC_FBRING_FREE;
+}
+
+/******************************************************************************/
+/**
+ * This function finds the complete frame with the highest or the lowest
+ * sequence number. Sequence numbers are compared with wrap around.
+ *
+ * @param	RingPtr is a pointer to the ring.
+ * @param	Newest selects the highest (TRUE) or lowest (FALSE) sequence
+ *		number.
+ *
+ * @return	The index of the buffer, or XVIDC_FBRING_NO_BUF if there is no
+ *		complete frame.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_FbRingFindReady(const XVidC_FbRing *RingPtr, u8 Newest)
+{
+	u32 Index;
+	u32 Found = XVIDC_FBRING_NO_BUF;
+	s32 Diff;
+
+	for (Index = 0; Index < RingPtr->NumBufs; Index++) {
+		if (RingPtr->Buf[Index].State != XVIDC_FBRING_READY) {
+			continue;
+		}
+
+		if (Found == XVIDC_FBRING_NO_BUF) {
+			Found = Index;
+			continue;
+		}
+
+		Diff = (s32)(RingPtr->Buf[Index].FrameSeq -
+				RingPtr->Buf[Found].FrameSeq);
+		if ((Newest && (Diff > 0)) || (!Newest && (Diff < 0))) {
+			Found = Index;
+		}
+	}
+
+	return Found;
+}
+/** @} */
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_fbring.h
+ * @addtogroup video_common_v4_3
+ * @{
+ * @details
+ *
+ * Contains the frame buffer ring used to hand video frames in memory from a
+ * producer (e.g. frame buffer write) to a consumer (e.g. frame buffer read).
+ *
+ * The ring holds up to XVIDC_FBRING_MAX_BUFS buffers. The producer acquires a
+ * buffer to write, and releases it once the frame is complete; this is the
+ * fence after which the frame is visible to the consumer and it is stamped
+ * with the next frame sequence number. The consumer acquires the frame it is
+ * going to read and releases it once the hardware has moved on to another
+ * buffer. A buffer is never written while it is held by the consumer, so
+ * frames do not tear.
+ *
+ * When the producer and consumer run at different rates the ring drops or
+ * repeats frames according to its policy:
+ *   - XVIDC_FBRING_POLICY_LATEST: the consumer takes the newest complete
+ *     frame and older complete frames are dropped. If no buffer is free the
+ *     producer takes back the oldest complete frame. This gives the lowest
+ *     latency.
+ *   - XVIDC_FBRING_POLICY_ORDERED: the consumer takes complete frames in
+ *     sequence. If no buffer is free the acquire fails and the producer has
+ *     to write the frame into the buffer it already holds, dropping it.
+ * In both cases the consumer repeats its current frame when no new frame is
+ * complete.
+ *
+ * The ring does no locking. Producer and consumer calls must not preempt each
+ * other, e.g. both are made from interrupt handlers of the same priority.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.3   ag   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_FBRING_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_FBRING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_FBRING_MIN_BUFS	3	/**< A buffer for each side plus one in
+					  *  between. */
+#define XVIDC_FBRING_MAX_BUFS	8	/**< Maximum number of buffers. */
+#define XVIDC_FBRING_NO_BUF	0xFFFFFFFF	/**< No buffer. */
+
+/**
+ * This typedef enumerates what the ring does when the producer and consumer
+ * rates differ.
+ */
+typedef enum {
+	XVIDC_FBRING_POLICY_LATEST = 0,	/**< Drop older frames. */
+	XVIDC_FBRING_POLICY_ORDERED	/**< Keep frames in sequence. */
+} XVidC_FbRingPolicy;
+
+/**
+ * This typedef enumerates the states of a buffer in the ring.
+ */
+typedef enum {
+	XVIDC_FBRING_FREE = 0,		/**< Not in use. */
+	XVIDC_FBRING_WRITING,		/**< Held by the producer. */
+	XVIDC_FBRING_READY,		/**< Frame complete. */
+	XVIDC_FBRING_READING		/**< Held by the consumer. */
+} XVidC_FbRingState;
+
+/****************************** Type Definitions ******************************/
+
+/**
+ * A buffer of the ring.
+ */
+typedef struct {
+	UINTPTR			Addr;		/**< Address of the (luma) plane. */
+	UINTPTR			ChromaAddr;	/**< Address of the chroma plane
+						  *  for semi-planar formats,
+						  *  or 0. */
+	XVidC_FbRingState	State;		/**< State of the buffer. */
+	u32			FrameSeq;	/**< Sequence number of the frame
+						  *  in the buffer. */
+} XVidC_FbRingBuf;
+
+/**
+ * The frame buffer ring. The user allocates one for each producer/consumer
+ * pair and passes it to both drivers.
+ */
+typedef struct {
+	XVidC_FbRingBuf		Buf[XVIDC_FBRING_MAX_BUFS];	/**< Buffers. */
+	u32			NumBufs;	/**< Number of buffers in use. */
+	XVidC_FbRingPolicy	Policy;		/**< Drop/repeat policy. */
+	u32			WrSeq;		/**< Sequence number of the last
+						  *  complete frame. */
+	u32			RdSeq;		/**< Sequence number of the last
+						  *  frame acquired by the
+						  *  consumer. */
+	u32			Dropped;	/**< Frames never read. */
+	u32			Repeated;	/**< Frames read again. */
+} XVidC_FbRing;
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_FbRingInit(XVidC_FbRing *RingPtr, u32 NumBufs,
+		XVidC_FbRingPolicy Policy);
+u32 XVidC_FbRingSetBuffer(XVidC_FbRing *RingPtr, u32 Index, UINTPTR Addr,
+		UINTPTR ChromaAddr);
+u32 XVidC_FbRingWrAcquire(XVidC_FbRing *RingPtr, u32 *IndexPtr);
+void XVidC_FbRingWrRelease(XVidC_FbRing *RingPtr, u32 Index);
+u32 XVidC_FbRingRdAcquire(XVidC_FbRing *RingPtr, u32 *IndexPtr);
+void XVidC_FbRingRdRelease(XVidC_FbRing *RingPtr, u32 Index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_FBRING_H_ */
+/** @} */
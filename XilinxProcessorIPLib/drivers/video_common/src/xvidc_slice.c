@@ -0,0 +1,345 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_slice.c
+ * @addtogroup video_common_v4_3
+ * @{
+ *
+ * Contains the slice monitor which reports the lines of a frame already
+ * written to memory by a video DMA. See xvidc_slice.h for a description.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.3   ag   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xil_cache.h"
+#include "xil_io.h"
+#include "xstatus.h"
+#include "xvidc_slice.h"
+
+/**************************** Function Prototypes *****************************/
+
+static UINTPTR XVidC_SliceMonMarkerAddr(const XVidC_SliceMon *MonPtr,
+		UINTPTR FrameAddr, u32 Slice);
+static u32 XVidC_SliceMonLines(const XVidC_SliceMon *MonPtr, u32 Slices);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a slice monitor for frames of the given geometry.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ * @param	Stride is the number of bytes between the start of two lines.
+ * @param	LineBytes is the number of bytes the DMA writes per line.
+ * @param	Height is the number of lines per frame.
+ * @param	SliceLines is the number of lines per slice. The last slice of
+ *		the frame may be shorter.
+ *
+ * @return
+ *		- XST_SUCCESS if the monitor was initialized.
+ *		- XST_INVALID_PARAM if the geometry is not valid.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_SliceMonInit(XVidC_SliceMon *MonPtr, u32 Stride, u32 LineBytes,
+		u32 Height, u32 SliceLines)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(MonPtr != NULL);
+
+	if ((LineBytes < 4) || (LineBytes > Stride) || (Height == 0) ||
+			(SliceLines == 0) || (SliceLines > Height)) {
+		return XST_INVALID_PARAM;
+	}
+
+	MonPtr->Stride       = Stride;
+	MonPtr->LineBytes    = LineBytes;
+	MonPtr->Height       = Height;
+	MonPtr->SliceLines   = SliceLines;
+	MonPtr->NumSlices    = (Height + SliceLines - 1) / SliceLines;
+	MonPtr->FrameCount   = 0;
+	MonPtr->Armed.Addr   = 0;
+	MonPtr->Cur.Addr     = 0;
+	MonPtr->Queued.Addr  = 0;
+	MonPtr->Callback     = NULL;
+	MonPtr->CallbackRef  = NULL;
+	MonPtr->Late         = 0;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function sets the callback invoked for each slice written to memory.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ * @param	CallbackFunc is the callback, or NULL to only poll.
+ * @param	CallbackRef is passed back to the callback.
+ *
+ * @return	None.
+ *
+ * @note	The callback is invoked from XVidC_SliceMonPoll() and
+ *		XVidC_SliceMonDone(), i.e. possibly in interrupt context.
+ *
+*******************************************************************************/
+void XVidC_SliceMonSetCallback(XVidC_SliceMon *MonPtr,
+		XVidC_SliceCallback CallbackFunc, void *CallbackRef)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(MonPtr != NULL);
+
+	MonPtr->Callback    = CallbackFunc;
+	MonPtr->CallbackRef = CallbackRef;
+}
+
+/******************************************************************************/
+/**
+ * This function arms a frame buffer before the DMA writes the next frame into
+ * it. A marker is written at the end of each slice and flushed to memory.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ * @param	Addr is the address of the frame buffer.
+ *
+ * @return
+ *		- XST_SUCCESS if the buffer was armed.
+ *		- XST_DEVICE_BUSY if a frame is being written to the buffer.
+ *
+ * @note	A buffer armed earlier and not started yet is replaced.
+ *
+*******************************************************************************/
+u32 XVidC_SliceMonArm(XVidC_SliceMon *MonPtr, UINTPTR Addr)
+{
+	UINTPTR MarkerAddr;
+	u32 Marker;
+	u32 Slice;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(MonPtr != NULL);
+	Xil_AssertNonvoid(Addr != 0);
+
+	/* Writing the markers would corrupt lines already written. */
+	if ((Addr == MonPtr->Cur.Addr) || (Addr == MonPtr->Queued.Addr)) {
+		return XST_DEVICE_BUSY;
+	}
+
+	/* Vary the marker per frame so a stale one is never mistaken for a
+	 * fresh one. */
+	MonPtr->FrameCount++;
+	Marker = XVIDC_SLICEMON_MARKER ^ (MonPtr->FrameCount << 8);
+
+	for (Slice = 0; Slice < MonPtr->NumSlices; Slice++) {
+		MarkerAddr = XVidC_SliceMonMarkerAddr(MonPtr, Addr, Slice);
+		Xil_Out32(MarkerAddr, Marker);
+		Xil_DCacheFlushRange(MarkerAddr, 4);
+	}
+
+	MonPtr->Armed.Addr      = Addr;
+	MonPtr->Armed.Marker    = Marker;
+	MonPtr->Armed.NextSlice = 0;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function tells the monitor that the DMA has started the frame in the
+ * armed buffer. It does nothing if no buffer is armed.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_SliceMonStart(XVidC_SliceMon *MonPtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(MonPtr != NULL);
+
+	if (MonPtr->Armed.Addr == 0) {
+		return;
+	}
+
+	if (MonPtr->Cur.Addr == 0) {
+		MonPtr->Cur = MonPtr->Armed;
+	} else {
+		MonPtr->Queued = MonPtr->Armed;
+	}
+	MonPtr->Armed.Addr = 0;
+}
+
+/******************************************************************************/
+/**
+ * This function checks which slices of the frame being written are in memory
+ * and invokes the callback for each new one.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ *
+ * @return	Number of lines of the frame being written that are in memory,
+ *		0 if no frame is being written.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_SliceMonPoll(XVidC_SliceMon *MonPtr)
+{
+	XVidC_SliceFrame *FramePtr;
+	UINTPTR MarkerAddr;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(MonPtr != NULL);
+
+	FramePtr = &MonPtr->Cur;
+	if (FramePtr->Addr == 0) {
+		return 0;
+	}
+
+	while (FramePtr->NextSlice < MonPtr->NumSlices) {
+		MarkerAddr = XVidC_SliceMonMarkerAddr(MonPtr, FramePtr->Addr,
+				FramePtr->NextSlice);
+		Xil_DCacheInvalidateRange(MarkerAddr, 4);
+		if (Xil_In32(MarkerAddr) == FramePtr->Marker) {
+			break;
+		}
+
+		FramePtr->NextSlice++;
+		if (MonPtr->Callback != NULL) {
+			MonPtr->Callback(MonPtr->CallbackRef, FramePtr->Addr,
+				XVidC_SliceMonLines(MonPtr,
+					FramePtr->NextSlice));
+		}
+	}
+
+	return XVidC_SliceMonLines(MonPtr, FramePtr->NextSlice);
+}
+
+/******************************************************************************/
+/**
+ * This function tells the monitor that the DMA has finished the frame being
+ * written. Slices not reported yet are reported at once and the next started
+ * frame, if any, becomes the frame being written.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_SliceMonDone(XVidC_SliceMon *MonPtr)
+{
+	XVidC_SliceFrame *FramePtr;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(MonPtr != NULL);
+
+	FramePtr = &MonPtr->Cur;
+	if (FramePtr->Addr == 0) {
+		return;
+	}
+
+	if (FramePtr->NextSlice < MonPtr->NumSlices) {
+		MonPtr->Late += MonPtr->NumSlices - FramePtr->NextSlice;
+		FramePtr->NextSlice = MonPtr->NumSlices;
+		if (MonPtr->Callback != NULL) {
+			MonPtr->Callback(MonPtr->CallbackRef, FramePtr->Addr,
+				MonPtr->Height);
+		}
+	}
+
+	MonPtr->Cur = MonPtr->Queued;
+	MonPtr->Queued.Addr = 0;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the address of the marker of a slice, which is the
+ * last word written in the last line of the slice.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ * @param	FrameAddr is the address of the frame buffer.
+ * @param	Slice is the index of the slice.
+ *
+ * @return	Address of the marker.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static UINTPTR XVidC_SliceMonMarkerAddr(const XVidC_SliceMon *MonPtr,
+		UINTPTR FrameAddr, u32 Slice)
+{
+	u32 LastLine;
+
+	LastLine = XVidC_SliceMonLines(MonPtr, Slice + 1) - 1;
+
+	return (FrameAddr + ((UINTPTR)LastLine * MonPtr->Stride) +
+			((MonPtr->LineBytes - 4) & ~(UINTPTR)3));
+}
+
+/******************************************************************************/
+/**
+ * This function returns the number of lines in the given number of slices
+ * from the top of the frame.
+ *
+ * @param	MonPtr is a pointer to the slice monitor.
+ * @param	Slices is the number of slices.
+ *
+ * @return	Number of lines.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_SliceMonLines(const XVidC_SliceMon *MonPtr, u32 Slices)
+{
+	u32 Lines;
+
+	Lines = Slices * MonPtr->SliceLines;
+
+	return (Lines > MonPtr->Height) ? MonPtr->Height : Lines;
+}
+/** @} */
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ *
+*******************************************************************************/
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_slice.h
+ * @addtogroup video_common_v4_3
+ * @{
+ * @details
+ *
+ * Contains the slice monitor which reports the lines of a frame that a video
+ * DMA (e.g. VDMA S2MM or frame buffer write) has already written to memory,
+ * so processing can start on the first slices before the frame is complete.
+ *
+ * The video DMAs have no line count interrupt or write pointer register, so
+ * progress is found from memory. When a buffer is armed, a marker word is
+ * written at the end of the last line of each slice. The DMA writes each frame
+ * from top to bottom, so once the marker of a slice has been overwritten all
+ * lines up to the end of that slice are in memory. XVidC_SliceMonPoll()
+ * checks the markers of the frame being written and reports each new slice
+ * through the callback. XVidC_SliceMonDone() reports the rest of the frame
+ * when the DMA signals the end of the frame, so a slice whose last pixel
+ * happens to equal the marker is reported late but never early.
+ *
+ * The driver of the DMA calls:
+ *   - XVidC_SliceMonArm() when it programs the buffer of a frame, before the
+ *     DMA may write to it.
+ *   - XVidC_SliceMonStart() when the DMA has taken the armed buffer.
+ *   - XVidC_SliceMonDone() at the end of each frame.
+ * The application calls XVidC_SliceMonPoll(), e.g. from a timer interrupt,
+ * at the line rate it needs. Consumers have to invalidate the data cache for
+ * the lines they read.
+ *
+ * The monitor does no locking. Polling must not preempt, or be preempted by,
+ * the DMA interrupt handler. A buffer must not be armed while it is being
+ * written; arming it again requires the previous frame in it to be done.
+ *
+ * @note	For semi-planar formats only the luma plane is monitored.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.3   ag   10/14/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_SLICE_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_SLICE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_SLICEMON_MARKER	0x5A1CE5EDU	/**< Marker base value, mixed
+						  *  with the frame count. */
+
+/****************************** Type Definitions ******************************/
+
+/**
+ * Callback type for slice notifications.
+ *
+ * @param	CallbackRef is the reference set with
+ *		XVidC_SliceMonSetCallback().
+ * @param	FrameAddr is the address of the frame buffer.
+ * @param	Lines is the number of lines from the top of the frame that are
+ *		in memory.
+ */
+typedef void (*XVidC_SliceCallback)(void *CallbackRef, UINTPTR FrameAddr,
+		u32 Lines);
+
+/**
+ * A frame tracked by the slice monitor.
+ */
+typedef struct {
+	UINTPTR	Addr;		/**< Address of the frame buffer, 0 if none. */
+	u32	Marker;		/**< Marker written in the frame buffer. */
+	u32	NextSlice;	/**< First slice not yet reported. */
+} XVidC_SliceFrame;
+
+/**
+ * The slice monitor. The user allocates one for each video DMA write channel
+ * and attaches it to the driver.
+ */
+typedef struct {
+	u32			Stride;		/**< Bytes between lines. */
+	u32			LineBytes;	/**< Bytes written per line. */
+	u32			Height;		/**< Lines per frame. */
+	u32			SliceLines;	/**< Lines per slice. */
+	u32			NumSlices;	/**< Slices per frame. */
+	u32			FrameCount;	/**< Buffers armed so far. */
+	XVidC_SliceFrame	Armed;		/**< Programmed, not started. */
+	XVidC_SliceFrame	Cur;		/**< Being written. */
+	XVidC_SliceFrame	Queued;		/**< Started before Cur was
+						  *  done. */
+	XVidC_SliceCallback	Callback;	/**< Slice callback. */
+	void			*CallbackRef;	/**< Slice callback reference. */
+	u32			Late;		/**< Slices only reported at the
+						  *  end of the frame. */
+} XVidC_SliceMon;
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_SliceMonInit(XVidC_SliceMon *MonPtr, u32 Stride, u32 LineBytes,
+		u32 Height, u32 SliceLines);
+void XVidC_SliceMonSetCallback(XVidC_SliceMon *MonPtr,
+		XVidC_SliceCallback CallbackFunc, void *CallbackRef);
+u32 XVidC_SliceMonArm(XVidC_SliceMon *MonPtr, UINTPTR Addr);
+void XVidC_SliceMonStart(XVidC_SliceMon *MonPtr);
+u32 XVidC_SliceMonPoll(XVidC_SliceMon *MonPtr);
+void XVidC_SliceMonDone(XVidC_SliceMon *MonPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_SLICE_H_ */
+/** @} */
@@ -77,6 +77,10 @@
  *                     Moved XVphy_MmcmWriteParameters to xvphy_mmcme2/3/4.c
  *                     Added XVphy_SetPolarity, XVphy_SetPrbsSel and
  *                        XVphy_TxPrbsForceError APIs
+ *       ag   10/14/26 Added a shadow of the GT DRP registers to XVphy_DrpRd
+ *                        and XVphy_DrpWr
+ *                     Added XVphy_DrpBatchStart, XVphy_DrpBatchEnd and
+ *                        XVphy_DrpShadowInvalidate APIs
  * </pre>
  *
 *******************************************************************************/
@@ -92,7 +96,10 @@
 
 /**************************** Function Prototypes *****************************/
 static u32 XVphy_DrpAccess(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
-		XVphy_DirectionType Dir, u16 Addr, u16 *Val);
+		XVphy_DirectionType Dir, u16 Addr, u16 *Val, u8 WaitIdle);
+static XVphy_DrpEntry *XVphy_DrpShadowGet(XVphy *InstancePtr,
+		XVphy_ChannelId ChId, u16 Addr);
+static u32 XVphy_DrpBatchFlush(XVphy *InstancePtr);
 
 /**************************** Function Definitions ****************************/
 
@@ -985,9 +992,7 @@ u32 XVphy_TxPrbsForceError(XVphy *InstancePtr, u8 QuadId,
 u32 XVphy_DrpWrite(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 		u16 Addr, u16 Val)
 {
-	return XVphy_DrpAccess(InstancePtr, QuadId, ChId,
-			XVPHY_DIR_TX, /* Write. */
-			Addr, &Val);
+	return XVphy_DrpWr(InstancePtr, QuadId, ChId, Addr, Val);
 }
 
 /*****************************************************************************/
@@ -1020,9 +1025,7 @@ u16 XVphy_DrpRead(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId, u16 Addr)
 	u32 Status;
 	u16 Val;
 
-	Status = XVphy_DrpAccess(InstancePtr, QuadId, ChId,
-			XVPHY_DIR_RX, /* Read. */
-			Addr, &Val);
+	Status = XVphy_DrpRd(InstancePtr, QuadId, ChId, Addr, &Val);
 
 	return (Status == XST_SUCCESS) ? Val : 0xDEAD;
 }
@@ -1043,15 +1046,73 @@ u16 XVphy_DrpRead(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId, u16 Addr)
 *		- XST_FAILURE otherwise, if the busy bit did not go low, or if
 *		  the ready bit did not go high.
 *
-* @note		None.
+* @note		For GT channel and common DRP ports the write is skipped when
+*		the DRP shadow shows the register already holds Val. Inside a
+*		DRP batch (see XVphy_DrpBatchStart) the write is queued and
+*		XST_SUCCESS is returned, the outcome of the access is reported
+*		by XVphy_DrpBatchEnd.
 *
 ******************************************************************************/
 u32 XVphy_DrpWr(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 		u16 Addr, u16 Val)
 {
-	return XVphy_DrpAccess(InstancePtr, QuadId, ChId,
-			XVPHY_DIR_TX, /* Write. */
-			Addr, &Val);
+	XVphy_DrpEntry *EntryPtr;
+	XVphy_DrpEntry *QueuedPtr;
+	u32 Status;
+	u8 Index;
+
+	EntryPtr = XVphy_DrpShadowGet(InstancePtr, ChId, Addr);
+
+	/* MMCM and non-shadowed DRP ports are always accessed directly. */
+	if (EntryPtr == NULL) {
+		return XVphy_DrpAccess(InstancePtr, QuadId, ChId,
+				XVPHY_DIR_TX, /* Write. */
+				Addr, &Val, TRUE);
+	}
+
+	/* The register already holds the value. */
+	if (EntryPtr->Valid && (EntryPtr->ChId == ChId) &&
+			(EntryPtr->Addr == Addr) && (EntryPtr->Val == Val)) {
+		return XST_SUCCESS;
+	}
+
+	if (InstancePtr->DrpBatchDepth > 0) {
+		/* Coalesce with a queued write to the same register. */
+		for (Index = 0; Index < InstancePtr->DrpBatchCount; Index++) {
+			QueuedPtr = &InstancePtr->DrpBatch[Index];
+			if ((QueuedPtr->ChId == ChId) &&
+					(QueuedPtr->Addr == Addr)) {
+				break;
+			}
+		}
+
+		if (Index == InstancePtr->DrpBatchCount) {
+			if (InstancePtr->DrpBatchCount ==
+					XVPHY_DRP_BATCH_ENTRIES) {
+				InstancePtr->DrpBatchStatus |=
+					XVphy_DrpBatchFlush(InstancePtr);
+			}
+			QueuedPtr = &InstancePtr->DrpBatch[
+					InstancePtr->DrpBatchCount++];
+			QueuedPtr->ChId = ChId;
+			QueuedPtr->Addr = Addr;
+		}
+		QueuedPtr->Val = Val;
+		Status = XST_SUCCESS;
+	}
+	else {
+		Status = XVphy_DrpAccess(InstancePtr, QuadId, ChId,
+				XVPHY_DIR_TX, /* Write. */
+				Addr, &Val, TRUE);
+	}
+
+	/* The shadow includes the writes still queued in the batch. */
+	EntryPtr->ChId = ChId;
+	EntryPtr->Addr = Addr;
+	EntryPtr->Val = Val;
+	EntryPtr->Valid = (Status == XST_SUCCESS);
+
+	return Status;
 }
 
 /*****************************************************************************/
@@ -1070,24 +1131,137 @@ u32 XVphy_DrpWr(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 *		- XST_FAILURE otherwise, if the busy bit did not go low, or if
 *		  the ready bit did not go high.
 *
-* @note		None.
+* @note		For GT channel and common DRP ports the value is returned
+*		from the DRP shadow when the register was accessed before, no
+*		DRP transaction is issued in that case.
 *
 ******************************************************************************/
 u16 XVphy_DrpRd(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
         u16 Addr, u16 *RetVal)
 {
+	XVphy_DrpEntry *EntryPtr;
 	u32 Status;
 	u16 Val;
+	u8 Index;
+
+	EntryPtr = XVphy_DrpShadowGet(InstancePtr, ChId, Addr);
+
+	if (EntryPtr != NULL) {
+		if (EntryPtr->Valid && (EntryPtr->ChId == ChId) &&
+				(EntryPtr->Addr == Addr)) {
+			*RetVal = EntryPtr->Val;
+			return XST_SUCCESS;
+		}
+
+		/* The shadow entry of a queued write may have been evicted, the
+		 * queued value has to win over the hardware content. */
+		for (Index = 0; Index < InstancePtr->DrpBatchCount; Index++) {
+			if ((InstancePtr->DrpBatch[Index].ChId == ChId) &&
+				(InstancePtr->DrpBatch[Index].Addr == Addr)) {
+				*RetVal = InstancePtr->DrpBatch[Index].Val;
+				return XST_SUCCESS;
+			}
+		}
+	}
 
 	Status = XVphy_DrpAccess(InstancePtr, QuadId, ChId,
 			XVPHY_DIR_RX, /* Read. */
-			Addr, &Val);
+			Addr, &Val, TRUE);
 
     *RetVal = Val;
 
+	if ((EntryPtr != NULL) && (Status == XST_SUCCESS)) {
+		EntryPtr->ChId = ChId;
+		EntryPtr->Addr = Addr;
+		EntryPtr->Val = Val;
+		EntryPtr->Valid = TRUE;
+	}
+
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* This function starts a DRP batch. Until the matching XVphy_DrpBatchEnd,
+* writes to GT channel and common DRP ports are queued instead of being
+* issued, with multiple writes to the same register coalesced into one.
+* Batches may be nested, the queue is flushed by the outermost
+* XVphy_DrpBatchEnd.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XVphy_DrpBatchStart(XVphy *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->DrpBatchDepth++;
+}
+
+/*****************************************************************************/
+/**
+* This function ends a DRP batch started by XVphy_DrpBatchStart. When it ends
+* the outermost batch, the queued DRP writes are issued back-to-back.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+*
+* @return
+*		- XST_SUCCESS if all queued DRP writes were successful, or if
+*		  the batch is nested.
+*		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XVphy_DrpBatchEnd(XVphy *InstancePtr)
+{
+	u32 Status;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->DrpBatchDepth > 0);
+
+	InstancePtr->DrpBatchDepth--;
+	if (InstancePtr->DrpBatchDepth > 0) {
+		return XST_SUCCESS;
+	}
+
+	Status = InstancePtr->DrpBatchStatus | XVphy_DrpBatchFlush(InstancePtr);
+	InstancePtr->DrpBatchStatus = XST_SUCCESS;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This function invalidates the DRP shadow so that subsequent DRP reads are
+* issued to the hardware. It has to be called when GT DRP registers may have
+* been changed behind the driver's back, e.g. by another DRP master.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XVphy_DrpShadowInvalidate(XVphy *InstancePtr)
+{
+	u16 Index;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (Index = 0; Index < XVPHY_DRP_SHADOW_ENTRIES; Index++) {
+		InstancePtr->DrpShadow[Index].Valid = FALSE;
+	}
+}
+
 /*****************************************************************************/
 /**
 * This function will power down the mixed-mode clock manager (MMCM) core.
@@ -1464,12 +1638,16 @@ u32 XVphy_IsBonded(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId)
 *		- XST_FAILURE otherwise, if the busy bit did not go low, or if
 *		  the ready bit did not go high.
 *
+* @param	WaitIdle is TRUE to wait for the DRP port to be idle before
+*		issuing the access. It can be FALSE when the previous access
+*		to the same port completed, i.e. its ready bit was seen.
+*
 * @note		In read mode (Dir == XVPHY_DIR_RX), the data pointed to by Val
 *		will be populated with the u16 value that was read._
 *
 ******************************************************************************/
 static u32 XVphy_DrpAccess(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
-		XVphy_DirectionType Dir, u16 Addr, u16 *Val)
+		XVphy_DirectionType Dir, u16 Addr, u16 *Val, u8 WaitIdle)
 {
 	u32 RegOffsetCtrl;
 	u32 RegOffsetSts;
@@ -1508,14 +1686,17 @@ static u32 XVphy_DrpAccess(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 
 	/* Wait until the DRP status indicates that it is not busy.*/
 	Retry = 0;
-	do {
+	while (WaitIdle) {
 		RegVal = XVphy_ReadReg(InstancePtr->Config.BaseAddr,
 								RegOffsetSts);
+		if (!(RegVal & XVPHY_DRP_STATUS_DRPBUSY_MASK)) {
+			break;
+		}
 		if (Retry > 150) {
 			return XST_FAILURE;
 		}
 		Retry++;
-	} while (RegVal & XVPHY_DRP_STATUS_DRPBUSY_MASK);
+	}
 
 	/* Write the command to the channel's DRP. */
 	RegVal = (Addr & XVPHY_DRP_CONTROL_DRPADDR_MASK);
@@ -1548,6 +1729,77 @@ static u32 XVphy_DrpAccess(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* This function returns the DRP shadow entry a GT DRP register maps to. The
+* entry may currently hold a different register.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+* @param	ChId is the channel ID of the DRP port.
+* @param	Addr is the DRP address.
+*
+* @return	A pointer to the shadow entry, or NULL if the DRP port isn't
+*		shadowed.
+*
+* @note		MMCM DRP ports aren't shadowed. Neither are GTPE2 ports since
+*		the GTP wizard reset sequence accesses the DRP on its own.
+*
+******************************************************************************/
+static XVphy_DrpEntry *XVphy_DrpShadowGet(XVphy *InstancePtr,
+		XVphy_ChannelId ChId, u16 Addr)
+{
+	if ((InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTPE2) ||
+			(!XVPHY_ISCH(ChId) && !XVPHY_ISCMN(ChId))) {
+		return NULL;
+	}
+
+	return &InstancePtr->DrpShadow[(Addr + (ChId * 37)) &
+			(XVPHY_DRP_SHADOW_ENTRIES - 1)];
+}
+
+/*****************************************************************************/
+/**
+* This function issues the DRP writes queued in the current DRP batch. An
+* access that directly follows a completed access to the same DRP port skips
+* the wait for the port to be idle, leaving a single wait for ready.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+*
+* @return
+*		- XST_SUCCESS if all queued DRP writes were successful.
+*		- XST_FAILURE otherwise.
+*
+* @note		On failure the DRP shadow is invalidated since it is not known
+*		which of the writes reached the GT.
+*
+******************************************************************************/
+static u32 XVphy_DrpBatchFlush(XVphy *InstancePtr)
+{
+	XVphy_DrpEntry *QueuedPtr;
+	u32 Status = XST_SUCCESS;
+	u8 WaitIdle = TRUE;
+	u8 Index;
+
+	for (Index = 0; Index < InstancePtr->DrpBatchCount; Index++) {
+		QueuedPtr = &InstancePtr->DrpBatch[Index];
+		if (Index > 0) {
+			WaitIdle = (QueuedPtr->ChId !=
+					InstancePtr->DrpBatch[Index - 1].ChId);
+		}
+		Status |= XVphy_DrpAccess(InstancePtr, 0,
+				(XVphy_ChannelId)QueuedPtr->ChId,
+				XVPHY_DIR_TX, /* Write. */
+				QueuedPtr->Addr, &QueuedPtr->Val, WaitIdle);
+	}
+	InstancePtr->DrpBatchCount = 0;
+
+	if (Status != XST_SUCCESS) {
+		XVphy_DrpShadowInvalidate(InstancePtr);
+	}
+
+	return Status;
+}
+
 /******************************************************************************/
 /**
 * This function installs a callback function for the VPHY error conditions
@@ -1632,6 +1884,9 @@ void XVphy_RegisterDebug(XVphy *InstancePtr)
 	u16 DrpVal, ChId;
 	u8  MaxChannels;
 
+	/* Dump the DRP registers as read from the hardware. */
+	XVphy_DrpShadowInvalidate(InstancePtr);
+
 	xil_printf("\r\nVPHY Registers\r\n");
 	xil_printf("-----------------\r\n");
 	xil_printf("Offset   |  Value\r\n");
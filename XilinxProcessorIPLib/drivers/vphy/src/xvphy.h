@@ -96,6 +96,11 @@
  * 1.7   gm   13/09/17 Added GTYE4 support
  *                     Added XVphy_SetPolarity, XVphy_SetPrbsSel and
  *                        XVphy_TxPrbsForceError APIs
+ *       ag   10/14/26 Added HDMI PLL configuration cache and the active
+ *                        GT configuration used for fast mode switching
+ *                     Added GT DRP register shadow and DRP write batching,
+ *                        XVphy_DrpBatchStart, XVphy_DrpBatchEnd and
+ *                        XVphy_DrpShadowInvalidate APIs
  * </pre>
  *
 *******************************************************************************/
@@ -361,6 +366,8 @@ typedef enum {
 	XVPHY_LOG_EVT_NO_QPLL_ERR,	/**< Log event QPLL not present. */
 	XVPHY_LOG_EVT_DRU_CLK_ERR,	/**< Log event DRU clk wrong freq. */
 	XVPHY_LOG_EVT_USRCLK_ERR,	/**< Log event usrclk more than 297 MHz. */
+	XVPHY_LOG_EVT_TX_FAST_SWITCH,	/**< Log event TX GT reconfig skipped. */
+	XVPHY_LOG_EVT_RX_FAST_SWITCH,	/**< Log event RX GT reconfig skipped. */
 	XVPHY_LOG_EVT_DUMMY,		/**< Dummy Event should be last */
 } XVphy_LogEvent;
 #endif
@@ -595,6 +602,58 @@ typedef struct {
 	u8 TxIntDataWidth;			/**< In bytes. */
 } XVphy_Channel;
 
+/**
+ * Number of GT DRP registers held in the DRP shadow (power of 2) and maximum
+ * number of DRP writes queued in a DRP batch.
+ */
+#define XVPHY_DRP_SHADOW_ENTRIES	128
+#define XVPHY_DRP_BATCH_ENTRIES		32
+
+/**
+ * This typedef contains a GT DRP register value, either as a DRP shadow
+ * entry or as a write queued in a DRP batch.
+ */
+typedef struct {
+	u16 Addr;				/**< DRP address. */
+	u16 Val;				/**< Register value. */
+	u8 ChId;				/**< DRP port (channel ID). */
+	u8 Valid;				/**< Shadow entry holds the
+							register value. */
+} XVphy_DrpEntry;
+
+/**
+ * Number of HDMI PLL configurations cached per direction.
+ */
+#define XVPHY_HDMI_PLL_CACHE_ENTRIES	4
+
+/**
+ * This typedef contains a PLL configuration as calculated for an HDMI line
+ * rate. It is used both as an entry of the PLL configuration cache and to
+ * describe the configuration currently programmed into the GT over DRP.
+ */
+typedef struct {
+	u64 LineRateHz;				/**< Line rate of the PLL. A value
+							of 0 marks the entry as
+							invalid. */
+	u32 RefClkHz;				/**< PLL input frequency. */
+	XVphy_ChannelId ChId;			/**< The PLL (CPLL channels or
+							QPLL common) the
+							entry applies to. */
+	u8 MRefClkDiv;				/**< M divider. */
+	u8 NFbDiv;				/**< N (QPLL) or N1 (CPLL). */
+	u8 N2FbDiv;				/**< N2 (CPLL). */
+	u8 OutDiv;				/**< Output divider D. A value of
+							0 caches a failed
+							calculation. */
+	u8 DataWidth;				/**< Data width in bits. Only
+							used for the active GT
+							configuration. */
+	u8 IntDataWidth;			/**< Internal data width in bytes.
+							Only used for the
+							active GT
+							configuration. */
+} XVphy_HdmiPllCfg;
+
 /**
  * This typedef contains configuration information for MMCM programming.
  */
@@ -716,6 +775,30 @@ typedef struct {
 	u8 HdmiTxSampleRate;			/**< HDMI TX sample rate. */
 	u8 HdmiRxDruIsEnabled;			/**< The DRU is enabled. */
 	u8 HdmiIsQpllPresent;           /**< QPLL is present in HW */
+	XVphy_HdmiPllCfg HdmiPllCache[2][XVPHY_HDMI_PLL_CACHE_ENTRIES];
+						/**< Previously calculated PLL
+							configurations, per
+							direction. */
+	u8 HdmiPllCacheNext[2];			/**< Next cache entry to be
+							replaced, per
+							direction. */
+	XVphy_HdmiPllCfg HdmiPllPending[2];	/**< PLL configuration calculated
+							for the next GT
+							reconfiguration. */
+	XVphy_HdmiPllCfg HdmiPllActive[2];	/**< PLL configuration currently
+							programmed into the
+							GT. */
+	XVphy_DrpEntry DrpShadow[XVPHY_DRP_SHADOW_ENTRIES];
+						/**< Last known values of GT
+							DRP registers. */
+	XVphy_DrpEntry DrpBatch[XVPHY_DRP_BATCH_ENTRIES];
+						/**< DRP writes queued in the
+							current batch. */
+	u8 DrpBatchCount;			/**< Number of queued writes. */
+	u8 DrpBatchDepth;			/**< Nesting depth of
+							XVphy_DrpBatchStart. */
+	u32 DrpBatchStatus;			/**< Status of the queued writes
+							flushed so far. */
 	XVphy_IntrHandler IntrCpllLockHandler;	/**< Callback function for CPLL
 							lock interrupts. */
 	void *IntrCpllLockCallbackRef;		/**< A pointer to the user data
@@ -885,6 +968,9 @@ u32 XVphy_DrpWr(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 		u16 Addr, u16 Val);
 u16 XVphy_DrpRd(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
         u16 Addr, u16 *RetVal);
+void XVphy_DrpBatchStart(XVphy *InstancePtr);
+u32 XVphy_DrpBatchEnd(XVphy *InstancePtr);
+void XVphy_DrpShadowInvalidate(XVphy *InstancePtr);
 void XVphy_MmcmPowerDown(XVphy *InstancePtr, u8 QuadId, XVphy_DirectionType Dir,
 		u8 Hold);
 void XVphy_MmcmStart(XVphy *InstancePtr, u8 QuadId, XVphy_DirectionType Dir);
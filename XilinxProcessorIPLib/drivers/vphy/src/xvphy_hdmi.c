@@ -86,6 +86,10 @@
  *                     Added userclk freq checking in XVphy_HdmiCpllParam &
  *                        XVphy_HdmiQpllParam API
  *                     Removed XVphy_DruSetGain API
+ *       ag   10/14/26 Cached the calculated QPLL/CPLL parameters per line
+ *                        rate and PLL input frequency
+ *                     Added XVphy_HdmiPllCfgIsActive and
+ *                        XVphy_HdmiPllCfgSetActive APIs
  *
  * </pre>
  *
@@ -99,6 +103,7 @@
 #include "xvphy.h"
 #include "xvphy_i.h"
 #include "xvphy_hdmi.h"
+#include "xvphy_gt.h"
 
 /****************************** Type Definitions ******************************/
 
@@ -122,6 +127,9 @@ extern void XVphy_Ch2Ids(XVphy *InstancePtr, XVphy_ChannelId ChId,
 		u8 *Id0, u8 *Id1);
 static const XVphy_GtHdmiChars *GetGtHdmiPtr(XVphy *InstancePtr);
 static void XVphy_HdmiSetSystemClockSelection(XVphy *InstancePtr, u8 QuadId);
+static u32 XVphy_HdmiClkCalcParams(XVphy *InstancePtr, u8 QuadId,
+		XVphy_ChannelId ChId, XVphy_DirectionType Dir,
+		u32 PllClkInFreqHz);
 
 /**************************** Function Definitions ****************************/
 
@@ -1895,8 +1903,8 @@ u32 XVphy_HdmiQpllParam(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 			SRValue = 1;
 		}
 
-		Status = XVphy_ClkCalcParams(InstancePtr, QuadId, ActiveCmnId,
-						Dir, RefClk);
+		Status = XVphy_HdmiClkCalcParams(InstancePtr, QuadId,
+						ActiveCmnId, Dir, RefClk);
 		if (Status == (XST_SUCCESS)) {
 			/* Only execute when the TX is using the QPLL. */
 			if (Dir == XVPHY_DIR_TX) {
@@ -1962,6 +1970,201 @@ u32 XVphy_HdmiQpllParam(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 	return (XST_FAILURE);
 }
 
+/*****************************************************************************/
+/**
+* This function calculates the PLL parameters for the configured line rate,
+* reusing the result of a previous calculation for the same PLL, line rate
+* and PLL input frequency when available. Failed calculations are cached as
+* well so the oversampling search in XVphy_HdmiQpllParam and
+* XVphy_HdmiCpllParam doesn't repeat the full divider search either.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+* @param	QuadId is the GT quad ID to operate on.
+* @param	ChId is the PLL channel ID to calculate the parameters for.
+* @param	Dir is an indicator for TX or RX.
+* @param	PllClkInFreqHz is the PLL input frequency.
+*
+* @return
+*		- XST_SUCCESS if valid PLL values were found.
+*		- XST_FAILURE otherwise.
+*
+* @note		On success, the resulting configuration is also stored as the
+*		pending configuration of the direction, see
+*		XVphy_HdmiPllCfgIsActive.
+*
+******************************************************************************/
+static u32 XVphy_HdmiClkCalcParams(XVphy *InstancePtr, u8 QuadId,
+		XVphy_ChannelId ChId, XVphy_DirectionType Dir,
+		u32 PllClkInFreqHz)
+{
+	u32 Status;
+	XVphy_HdmiPllCfg *CfgPtr;
+	XVphy_Channel *PllPtr;
+	u8 Index;
+	u8 Id, Id0, Id1;
+
+	/* Without an explicit input frequency the result depends on the
+	 * configured quad reference clock, which isn't part of the key. */
+	if (PllClkInFreqHz == 0) {
+		return XVphy_ClkCalcParams(InstancePtr, QuadId, ChId, Dir, 0);
+	}
+
+	XVphy_Ch2Ids(InstancePtr, ChId, &Id0, &Id1);
+	PllPtr = &InstancePtr->Quads[QuadId].Plls[XVPHY_CH2IDX(Id0)];
+
+	for (Index = 0; Index < XVPHY_HDMI_PLL_CACHE_ENTRIES; Index++) {
+		CfgPtr = &InstancePtr->HdmiPllCache[Dir][Index];
+		if ((CfgPtr->LineRateHz == PllPtr->LineRateHz) &&
+				(CfgPtr->RefClkHz == PllClkInFreqHz) &&
+				(CfgPtr->ChId == ChId)) {
+			break;
+		}
+	}
+
+	/* Cache miss, run the divider search and store its outcome. */
+	if (Index == XVPHY_HDMI_PLL_CACHE_ENTRIES) {
+		Status = XVphy_ClkCalcParams(InstancePtr, QuadId, ChId, Dir,
+				PllClkInFreqHz);
+
+		CfgPtr = &InstancePtr->HdmiPllCache[Dir][
+				InstancePtr->HdmiPllCacheNext[Dir]];
+		InstancePtr->HdmiPllCacheNext[Dir] =
+			(InstancePtr->HdmiPllCacheNext[Dir] + 1) %
+			XVPHY_HDMI_PLL_CACHE_ENTRIES;
+
+		CfgPtr->LineRateHz = PllPtr->LineRateHz;
+		CfgPtr->RefClkHz = PllClkInFreqHz;
+		CfgPtr->ChId = ChId;
+		CfgPtr->MRefClkDiv = PllPtr->PllParams.MRefClkDiv;
+		CfgPtr->NFbDiv = PllPtr->PllParams.NFbDiv;
+		CfgPtr->N2FbDiv = PllPtr->PllParams.N2FbDiv;
+		CfgPtr->OutDiv = (Status == XST_SUCCESS) ?
+			InstancePtr->Quads[QuadId].Plls[
+				XVPHY_CH2IDX(XVPHY_CHANNEL_ID_CH1)].OutDiv[Dir] : 0;
+	}
+	/* Cache hit, restore the dividers as XVphy_PllCalculator would. */
+	else if (CfgPtr->OutDiv != 0) {
+		for (Id = Id0; Id <= Id1; Id++) {
+			PllPtr = &InstancePtr->Quads[QuadId].Plls[XVPHY_CH2IDX(Id)];
+			PllPtr->PllParams.MRefClkDiv = CfgPtr->MRefClkDiv;
+			PllPtr->PllParams.NFbDiv = CfgPtr->NFbDiv;
+			PllPtr->PllParams.N2FbDiv = CfgPtr->N2FbDiv;
+			PllPtr->PllParams.IsLowerBand = 1;
+		}
+
+		XVphy_Ch2Ids(InstancePtr, XVPHY_ISCMN(ChId) ?
+				XVPHY_CHANNEL_ID_CHA : ChId, &Id0, &Id1);
+		for (Id = Id0; Id <= Id1; Id++) {
+			InstancePtr->Quads[QuadId].Plls[XVPHY_CH2IDX(Id)].
+				OutDiv[Dir] = CfgPtr->OutDiv;
+			if (Dir == XVPHY_DIR_RX) {
+				XVphy_CfgSetCdr(InstancePtr, QuadId,
+						(XVphy_ChannelId)Id);
+			}
+		}
+	}
+
+	if (CfgPtr->OutDiv == 0) {
+		return XST_FAILURE;
+	}
+
+	InstancePtr->HdmiPllPending[Dir] = *CfgPtr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function checks whether the PLL configuration pending for the next GT
+* reconfiguration of a direction is the one already programmed into the GT.
+* In that case the DRP reconfiguration can be skipped since DRP attributes
+* are retained across PLL power down and GT/PLL resets, e.g. when the video
+* timing changed but the TMDS line rate did not, or when the RX is running
+* off the DRU at its fixed line rate.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+* @param	Dir is an indicator for TX or RX.
+*
+* @return
+*		- TRUE if the pending configuration is already programmed.
+*		- FALSE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+u8 XVphy_HdmiPllCfgIsActive(XVphy *InstancePtr, XVphy_DirectionType Dir)
+{
+	XVphy_HdmiPllCfg *PendingPtr;
+	XVphy_HdmiPllCfg *ActivePtr;
+	XVphy_Channel *ChPtr;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	PendingPtr = &InstancePtr->HdmiPllPending[Dir];
+	ActivePtr = &InstancePtr->HdmiPllActive[Dir];
+	ChPtr = &InstancePtr->Quads[0].Plls[XVPHY_CH2IDX(XVPHY_CHANNEL_ID_CH1)];
+
+	/* Capture the data width the datapath will be programmed with. */
+	PendingPtr->DataWidth = (Dir == XVPHY_DIR_TX) ?
+		ChPtr->TxDataWidth : ChPtr->RxDataWidth;
+	PendingPtr->IntDataWidth = (Dir == XVPHY_DIR_TX) ?
+		ChPtr->TxIntDataWidth : ChPtr->RxIntDataWidth;
+
+	if ((PendingPtr->LineRateHz == 0) ||
+			(PendingPtr->LineRateHz != ActivePtr->LineRateHz) ||
+			(PendingPtr->RefClkHz != ActivePtr->RefClkHz) ||
+			(PendingPtr->ChId != ActivePtr->ChId) ||
+			(PendingPtr->MRefClkDiv != ActivePtr->MRefClkDiv) ||
+			(PendingPtr->NFbDiv != ActivePtr->NFbDiv) ||
+			(PendingPtr->N2FbDiv != ActivePtr->N2FbDiv) ||
+			(PendingPtr->OutDiv != ActivePtr->OutDiv) ||
+			(PendingPtr->DataWidth != ActivePtr->DataWidth) ||
+			(PendingPtr->IntDataWidth != ActivePtr->IntDataWidth)) {
+		return (FALSE);
+	}
+
+	return (TRUE);
+}
+
+/*****************************************************************************/
+/**
+* This function records the pending PLL configuration of a direction as the
+* one programmed into the GT, or forgets the programmed configuration.
+*
+* @param	InstancePtr is a pointer to the XVphy core instance.
+* @param	Dir is an indicator for TX or RX.
+* @param	Valid is TRUE after the pending configuration has been written
+*		over DRP, FALSE when the GT state is no longer known.
+*
+* @return	None.
+*
+* @note		Since the other direction may share the PLL (bonded mode), its
+*		record is dropped as well if it refers to the same PLL.
+*
+******************************************************************************/
+void XVphy_HdmiPllCfgSetActive(XVphy *InstancePtr, XVphy_DirectionType Dir,
+		u8 Valid)
+{
+	XVphy_DirectionType OtherDir;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	OtherDir = (Dir == XVPHY_DIR_TX) ? XVPHY_DIR_RX : XVPHY_DIR_TX;
+
+	if (Valid) {
+		InstancePtr->HdmiPllActive[Dir] = InstancePtr->HdmiPllPending[Dir];
+		if (InstancePtr->HdmiPllActive[OtherDir].ChId ==
+				InstancePtr->HdmiPllActive[Dir].ChId) {
+			InstancePtr->HdmiPllActive[OtherDir].LineRateHz = 0;
+		}
+	}
+	else {
+		InstancePtr->HdmiPllActive[Dir].LineRateHz = 0;
+	}
+}
+
 /*****************************************************************************/
 /**
 * This function calculates the CPLL parameters.
@@ -2177,7 +2380,7 @@ u32 XVphy_HdmiCpllParam(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 			SRValue = 1;
 		}
 
-		Status = XVphy_ClkCalcParams(InstancePtr, QuadId,
+		Status = XVphy_HdmiClkCalcParams(InstancePtr, QuadId,
 					ChannelId, Dir, RefClk);
 		if (Status == (XST_SUCCESS)) {
 			/* Only execute when the TX is using the QPLL. */
@@ -2285,6 +2488,9 @@ u32 XVphy_SetHdmiTxParam(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 		/* Copy reference clock. */
 		InstancePtr->HdmiTxRefClkHz = InstancePtr->HdmiRxRefClkHz;
 
+		/* The TX follows the RX PLL configuration. */
+		InstancePtr->HdmiPllPending[XVPHY_DIR_TX].LineRateHz = 0;
+
 		/* Copy the line rate. */
 		if (XVphy_IsRxUsingQpll(InstancePtr, QuadId,
 					XVPHY_CHANNEL_ID_CH1)) {
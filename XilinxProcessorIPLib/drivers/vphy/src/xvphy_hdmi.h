@@ -53,6 +53,8 @@
  * 1.6   gm   03/07/17 Added XVPHY_HDMI_GTXE2_DRU_LRATE_Q/CPLL definitions
  *                     Corrected FVCO range for MMCME4
  * 1.7   gm   13/09/17 Removed XVphy_DruSetGain API
+ *       ag   10/14/26 Added XVphy_HdmiPllCfgIsActive and
+ *                        XVphy_HdmiPllCfgSetActive
  * </pre>
  *
  * @addtogroup xvphy_v1_7
@@ -182,6 +184,9 @@ u64 XVphy_DruCalcCenterFreqHz(XVphy *InstancePtr, u8 QuadId,
 void XVphy_HdmiGtDruModeEnable(XVphy *InstancePtr, u8 Enable);
 void XVphy_PatgenSetRatio(XVphy *InstancePtr, u8 QuadId, u64 TxLineRate);
 void XVphy_HdmiIntrHandlerCallbackInit(XVphy *InstancePtr);
+u8 XVphy_HdmiPllCfgIsActive(XVphy *InstancePtr, XVphy_DirectionType Dir);
+void XVphy_HdmiPllCfgSetActive(XVphy *InstancePtr, XVphy_DirectionType Dir,
+		u8 Valid);
 
 #endif /* XVPHY_HDMI_H_ */
 #endif
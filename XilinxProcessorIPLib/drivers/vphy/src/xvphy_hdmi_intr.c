@@ -64,6 +64,9 @@
  *                     Improved TX initialization flow in bonded mode to
  *                       reset GT TX only when PLL and MMCM are locked
  * 1.7   gm   13/09/17 Added GTYE4 support
+ *       ag   10/14/26 Skipped the GT DRP reconfiguration in the TX and RX
+ *                       timer timeout handlers when the PLL configuration
+ *                       is unchanged
  * </pre>
  *
 *******************************************************************************/
@@ -859,6 +862,8 @@ void XVphy_HdmiTxTimerTimeoutHandler(XVphy *InstancePtr)
 {
 	XVphy_ChannelId ChId;
 	XVphy_PllType PllType;
+	u32 Status;
+	u8 FastSwitch;
 	u8 Id, Id0, Id1;
 
 #if (XPAR_VPHY_0_TRANSCEIVER == XVPHY_GTXE2)
@@ -912,9 +917,17 @@ void XVphy_HdmiTxTimerTimeoutHandler(XVphy *InstancePtr)
 		XVphy_WriteCfgRefClkSelReg(InstancePtr, 0);
 	}
 
-	XVphy_ClkReconfig(InstancePtr, 0, ChId);
-	XVphy_OutDivReconfig(InstancePtr, 0, XVPHY_CHANNEL_ID_CHA,
-			XVPHY_DIR_TX);
+	/* Only reprogram the GT over DRP when the PLL configuration changed. */
+	if (XVphy_HdmiPllCfgIsActive(InstancePtr, XVPHY_DIR_TX)) {
+		XVphy_LogWrite(InstancePtr, XVPHY_LOG_EVT_TX_FAST_SWITCH, 1);
+		FastSwitch = TRUE;
+	}
+	else {
+		FastSwitch = FALSE;
+		Status = XVphy_ClkReconfig(InstancePtr, 0, ChId);
+		Status |= XVphy_OutDivReconfig(InstancePtr, 0,
+				XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_TX);
+	}
 	if ((InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE3) ||
 	    (InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTHE4) ||
         (InstancePtr->Config.XcvrType == XVPHY_GT_TYPE_GTYE4)) {
@@ -923,7 +936,12 @@ void XVphy_HdmiTxTimerTimeoutHandler(XVphy *InstancePtr)
 			InstancePtr->Quads[0].Plls[0].TxOutDiv :
 			InstancePtr->Quads[0].Plls[0].TxOutDiv / 2);
 	}
-	XVphy_DirReconfig(InstancePtr, 0, XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_TX);
+	if (!FastSwitch) {
+		Status |= XVphy_DirReconfig(InstancePtr, 0,
+				XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_TX);
+		XVphy_HdmiPllCfgSetActive(InstancePtr, XVPHY_DIR_TX,
+				(Status == XST_SUCCESS));
+	}
 
 	/* Assert PLL reset. */
 	XVphy_ResetGtPll(InstancePtr, 0, XVPHY_CHANNEL_ID_CHA,
@@ -1048,15 +1066,24 @@ void XVphy_HdmiRxTimerTimeoutHandler(XVphy *InstancePtr)
 	/* Determine which channel(s) to operate on. */
 	ChId = XVphy_GetRcfgChId(InstancePtr, 0, XVPHY_DIR_RX, PllType);
 
-	XVphy_ClkReconfig(InstancePtr, 0, ChId);
-	XVphy_OutDivReconfig(InstancePtr, 0, XVPHY_CHANNEL_ID_CHA,
-			XVPHY_DIR_RX);
-	if (XVphy_IsBonded(InstancePtr, 0, XVPHY_CHANNEL_ID_CH1)) {
-		XVphy_OutDivReconfig(InstancePtr, 0, XVPHY_CHANNEL_ID_CHA,
-				XVPHY_DIR_TX);
+	/* Only reprogram the GT over DRP when the PLL configuration changed. */
+	if (XVphy_HdmiPllCfgIsActive(InstancePtr, XVPHY_DIR_RX)) {
+		XVphy_LogWrite(InstancePtr, XVPHY_LOG_EVT_RX_FAST_SWITCH, 1);
 	}
+	else {
+		Status = XVphy_ClkReconfig(InstancePtr, 0, ChId);
+		Status |= XVphy_OutDivReconfig(InstancePtr, 0,
+				XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_RX);
+		if (XVphy_IsBonded(InstancePtr, 0, XVPHY_CHANNEL_ID_CH1)) {
+			Status |= XVphy_OutDivReconfig(InstancePtr, 0,
+					XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_TX);
+		}
 
-	XVphy_DirReconfig(InstancePtr, 0, XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_RX);
+		Status |= XVphy_DirReconfig(InstancePtr, 0,
+				XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_RX);
+		XVphy_HdmiPllCfgSetActive(InstancePtr, XVPHY_DIR_RX,
+				(Status == XST_SUCCESS));
+	}
 
 	/* Assert RX PLL reset. */
 	XVphy_ResetGtPll(InstancePtr, 0, XVPHY_CHANNEL_ID_CHA, XVPHY_DIR_RX,
@@ -50,6 +50,9 @@
  * 1.6   gm   06/08/17 Added XVphy_MmcmLocked, XVphy_ErrorHandler and
  *                              XVphy_PllLayoutErrorHandler APIs
  * 1.7   gm   13/09/17 Added GTYE4 support
+ *       ag   10/14/26 Issued the DRP writes of XVphy_OutDivReconfig,
+ *                       XVphy_DirReconfig and XVphy_ClkReconfig as one DRP
+ *                       batch across all channels
  * </pre>
  *
 *******************************************************************************/
@@ -942,6 +945,7 @@ u32 XVphy_OutDivReconfig(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 	XVphy_LogWrite(InstancePtr, (Dir == XVPHY_DIR_TX) ?
 		XVPHY_LOG_EVT_GT_TX_RECONFIG : XVPHY_LOG_EVT_GT_RX_RECONFIG, 0);
 
+	XVphy_DrpBatchStart(InstancePtr);
 	XVphy_Ch2Ids(InstancePtr, ChId, &Id0, &Id1);
 	for (Id = Id0; Id <= Id1; Id++) {
 		Status = XVphy_OutDivChReconfig(InstancePtr, QuadId,
@@ -950,6 +954,7 @@ u32 XVphy_OutDivReconfig(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 			break;
 		}
 	}
+	Status |= XVphy_DrpBatchEnd(InstancePtr);
 
 	return Status;
 }
@@ -987,6 +992,7 @@ u32 XVphy_DirReconfig(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
                ChId = XVPHY_CHANNEL_ID_CHA;
     }
 
+	XVphy_DrpBatchStart(InstancePtr);
 	XVphy_Ch2Ids(InstancePtr, ChId, &Id0, &Id1);
 	for (Id = Id0; Id <= Id1; Id++) {
 		if (Dir == XVPHY_DIR_TX) {
@@ -1002,6 +1008,9 @@ u32 XVphy_DirReconfig(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId,
 			break;
 		}
 	}
+	if (XVphy_DrpBatchEnd(InstancePtr) != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
 
 	XVphy_LogWrite(InstancePtr, (Dir == XVPHY_DIR_TX) ?
 		XVPHY_LOG_EVT_GT_TX_RECONFIG : XVPHY_LOG_EVT_GT_RX_RECONFIG, 1);
@@ -1032,6 +1041,7 @@ u32 XVphy_ClkReconfig(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId)
 	u8 Id0;
 	u8 Id1;
 
+	XVphy_DrpBatchStart(InstancePtr);
 	XVphy_Ch2Ids(InstancePtr, ChId, &Id0, &Id1);
 	for (Id = Id0; Id <= Id1; Id++) {
 		if (XVPHY_ISCH(Id)) {
@@ -1046,16 +1056,20 @@ u32 XVphy_ClkReconfig(XVphy *InstancePtr, u8 QuadId, XVphy_ChannelId ChId)
 				XVphy_CfgErrIntr(InstancePtr, XVPHY_ERR_NO_QPLL, 1);
 				XVphy_ErrorHandler(InstancePtr);
 				Status = XST_FAILURE;
-				return Status;
+				break;
 			}
 			Status |= XVphy_ClkCmnReconfig(InstancePtr, QuadId,
 											(XVphy_ChannelId)Id);
 		}
 		if (Status != XST_SUCCESS) {
-			Status = XST_FAILURE;
-			return Status;
+			break;
 		}
 	}
+	Status |= XVphy_DrpBatchEnd(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		return Status;
+	}
 
 	if (XVPHY_ISCH(ChId)) {
 		XVphy_LogWrite(InstancePtr, XVPHY_LOG_EVT_CPLL_RECONFIG, 1);
@@ -56,6 +56,9 @@
  *                     Changed xil_printf new lines to \r\n
  *                     Added XVPHY_LOG_EVT_DRU_CLK_ERR log event
  * 1.7   gm   13/09/17 Added XVPHY_LOG_EVT_USRCLK_ERR event
+ *       ag   10/14/26 Added XVPHY_LOG_EVT_TX_FAST_SWITCH and
+ *                       XVPHY_LOG_EVT_RX_FAST_SWITCH events
+ *       ag   10/14/26 Mirror log events into the BSP binary trace
  * </pre>
  *
 *******************************************************************************/
@@ -63,6 +66,7 @@
 /******************************* Include Files ********************************/
 
 #include "xvphy.h"
+#include "xil_trace.h"
 #include "xvphy_i.h"
 
 /************************** Constant Definitions *****************************/
@@ -117,6 +121,10 @@ void XVphy_LogWrite(XVphy *InstancePtr, XVphy_LogEvent Evt, u8 Data)
 	Xil_AssertVoid(Evt <= (XVPHY_LOG_EVT_DUMMY));
 	Xil_AssertVoid(Data < 0xFF);
 
+	/* Mirror the event into the shared binary trace */
+	XIL_TRACE2(XIL_TRACE_ID(XIL_TRACE_MOD_VPHY, Evt),
+			InstancePtr->Config.DeviceId, Data);
+
 	/* Write data and event into log buffer */
 	InstancePtr->Log.DataBuffer[InstancePtr->Log.HeadIndex] =
 			(Data << 8) | Evt;
@@ -508,6 +516,14 @@ void XVphy_LogDisplay(XVphy *InstancePtr)
 						"more than 297 MHz"
 						ANSI_COLOR_RESET "\r\n");
 			break;
+		case (XVPHY_LOG_EVT_TX_FAST_SWITCH):
+			xil_printf("TX GT configuration unchanged, "
+					"skipped DRP reconfig\r\n");
+			break;
+		case (XVPHY_LOG_EVT_RX_FAST_SWITCH):
+			xil_printf("RX GT configuration unchanged, "
+					"skipped DRP reconfig\r\n");
+			break;
 		default:
 			xil_printf("Unknown event\r\n");
 			break;
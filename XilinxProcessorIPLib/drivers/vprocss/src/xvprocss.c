@@ -63,6 +63,9 @@
 * 2.40  vyc  10/04/17   Added support for conversion from 420/422/444/RGB to
 *                       420/422/444/RGB with CSC-only topology
 * 2.50  vyc  04/04/18   Fix for HScaler setup with 420 input
+*       ag   10/14/26   Added XVprocSs_SetScalerPhaseCache
+*       ag   10/14/26   Added XVprocSs_UpdateSubsystemConfig for incremental
+*                       reconfiguration of a running pipe
 *
 * </pre>
 *
@@ -170,6 +173,11 @@ static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr);
 static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr);
 static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr);
 static int SetupModeMax(XVprocSs *XVprocSsPtr);
+static void ConfigScalerOnly(XVprocSs *XVprocSsPtr);
+static int UpdateModeScalerOnly(XVprocSs *XVprocSsPtr);
+static int UpdateModeCscOnly(XVprocSs *XVprocSsPtr, u8 SizeChg, u8 FmtChg);
+static int UpdateModeMax(XVprocSs *XVprocSsPtr, u8 SizeChg);
+static void SaveAppliedConfig(XVprocSs *XVprocSsPtr);
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /*****************************************************************************/
@@ -611,6 +619,10 @@ static void SetPowerOnDefaultState(XVprocSs *XVprocSsPtr)
 
   XVprocSsPtr->CtxtData.PixelHStepSize = XVprocSs_PixelHStep[XVprocSsPtr->Config.PixPerClock>>1][PixPrecisionIndex];
 
+  /* No configuration applied yet */
+  XVprocSsPtr->CtxtData.CfgValid   = FALSE;
+  XVprocSsPtr->CtxtData.UpdateMask = XVPROCSS_UPDATE_NONE;
+
   if(XVprocSs_IsConfigModeMax(XVprocSsPtr))
   {
 	/* Set default PIP Background color */
@@ -732,6 +744,9 @@ void XVprocSs_Stop(XVprocSs *InstancePtr)
   if(InstancePtr->VcrsmplrOutPtr)
     XV_VCrsmplStop(InstancePtr->VcrsmplrOutPtr);
 
+  /* Pipe needs a full configuration to restart */
+  InstancePtr->CtxtData.CfgValid = FALSE;
+
   XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_STOP_VPSS, XVPROCSS_EDAT_SUCCESS);
 }
 
@@ -784,6 +799,7 @@ void XVprocSs_Reset(XVprocSs *InstancePtr)
 
   /* Reset start core flags */
   memset(InstancePtr->CtxtData.StartCore, 0, sizeof(InstancePtr->CtxtData.StartCore));
+  InstancePtr->CtxtData.CfgValid = FALSE;
 
   XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_RESET_VPSS, XVPROCSS_EDAT_SUCCESS);
 }
@@ -1341,6 +1357,52 @@ static int ValidateHCResampleOnlyConfig(XVprocSs *XVprocSsPtr)
   return(XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+* This function programs the scalers of the ScalerOnly topology to scale the
+* input to the output resolution
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+static void ConfigScalerOnly(XVprocSs *XVprocSsPtr)
+{
+  u32 vsc_WidthIn, vsc_HeightIn, vsc_HeightOut;
+  u32 hsc_HeightIn, hsc_WidthIn, hsc_WidthOut, hsc_ColorFormatIn;
+
+  /* UpScale mode V Scaler is before H Scaler */
+  vsc_WidthIn   = XVprocSsPtr->VidIn.Timing.HActive;
+  vsc_HeightIn  = XVprocSsPtr->VidIn.Timing.VActive;
+  vsc_HeightOut = XVprocSsPtr->VidOut.Timing.VActive;
+
+  hsc_WidthIn  = vsc_WidthIn;
+  hsc_HeightIn = vsc_HeightOut;
+  hsc_WidthOut = XVprocSsPtr->VidOut.Timing.HActive;
+  if (XVprocSsPtr->VidIn.ColorFormatId == XVIDC_CSF_YCRCB_420)
+  {
+      hsc_ColorFormatIn = XVIDC_CSF_YCRCB_422;
+  }
+  else
+  {
+      hsc_ColorFormatIn = XVprocSsPtr->VidIn.ColorFormatId;
+  }
+
+  XV_VScalerSetup(XVprocSsPtr->VscalerPtr,
+                  vsc_WidthIn,
+                  vsc_HeightIn,
+                  vsc_HeightOut,
+                  XVprocSsPtr->VidIn.ColorFormatId);
+
+  XV_HScalerSetup(XVprocSsPtr->HscalerPtr,
+                  hsc_HeightIn,
+                  hsc_WidthIn,
+                  hsc_WidthOut,
+                  hsc_ColorFormatIn,
+                  XVprocSsPtr->VidOut.ColorFormatId);
+}
+
 /*****************************************************************************/
 /**
 * This function configures the video subsystem pipeline for ScalerOnly
@@ -1356,13 +1418,8 @@ static int ValidateHCResampleOnlyConfig(XVprocSs *XVprocSsPtr)
 ******************************************************************************/
 static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
 {
-  u32 vsc_WidthIn, vsc_HeightIn, vsc_HeightOut;
-  u32 hsc_HeightIn, hsc_WidthIn, hsc_WidthOut, hsc_ColorFormatIn;
   int status = XST_SUCCESS;
 
-  vsc_WidthIn = vsc_HeightIn = vsc_HeightOut = 0;
-  hsc_HeightIn = hsc_WidthIn = hsc_WidthOut = 0;
-
   if(!XVprocSsPtr->VscalerPtr) {
     XVprocSs_LogWrite(XVprocSsPtr, XVPROCSS_EVT_CFG_VSCALER, XVPROCSS_EDAT_IPABSENT);
     return(XST_FAILURE);
@@ -1381,36 +1438,8 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
     /* Reset the IP Blocks inside the VPSS */
     XVprocSs_Reset(XVprocSsPtr);
 
-    /* UpScale mode V Scaler is before H Scaler */
-    vsc_WidthIn   = XVprocSsPtr->VidIn.Timing.HActive;
-    vsc_HeightIn  = XVprocSsPtr->VidIn.Timing.VActive;
-    vsc_HeightOut = XVprocSsPtr->VidOut.Timing.VActive;
-
-    hsc_WidthIn  = vsc_WidthIn;
-    hsc_HeightIn = vsc_HeightOut;
-    hsc_WidthOut = XVprocSsPtr->VidOut.Timing.HActive;
-    if (XVprocSsPtr->VidIn.ColorFormatId == XVIDC_CSF_YCRCB_420)
-    {
-        hsc_ColorFormatIn = XVIDC_CSF_YCRCB_422;
-    }
-    else
-    {
-        hsc_ColorFormatIn = XVprocSsPtr->VidIn.ColorFormatId;
-    }
-
     /* Configure scaler to scale input to output resolution */
-	XV_VScalerSetup(XVprocSsPtr->VscalerPtr,
-                    vsc_WidthIn,
-                    vsc_HeightIn,
-                    vsc_HeightOut,
-                    XVprocSsPtr->VidIn.ColorFormatId);
-
-    XV_HScalerSetup(XVprocSsPtr->HscalerPtr,
-                    hsc_HeightIn,
-                    hsc_WidthIn,
-                    hsc_WidthOut,
-                    hsc_ColorFormatIn,
-                    XVprocSsPtr->VidOut.ColorFormatId);
+    ConfigScalerOnly(XVprocSsPtr);
 
     /* Start Scaler sub-cores */
     XV_HScalerStart(XVprocSsPtr->HscalerPtr);
@@ -1875,9 +1904,293 @@ int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr)
       status = XST_FAILURE;
       break;
   }
+
+  if(status == XST_SUCCESS) {
+    InstancePtr->CtxtData.UpdateMask = XVPROCSS_UPDATE_FULL;
+    SaveAppliedConfig(InstancePtr);
+  }
+  return(status);
+}
+
+/*****************************************************************************/
+/**
+* This function applies a change of the input and/or output stream to a
+* running processing pipe. It compares the streams set with
+* XVprocSs_SetVidStreamIn() and XVprocSs_SetVidStreamOut() with the ones the
+* pipe was last configured for, and only reprograms the sub-cores affected by
+* the change, keeping the pipe running wherever the topology allows:
+*   - Scaler-only: resolution change
+*   - Csc-only: resolution and/or color format change; the picture
+*     settings (brightness, contrast...) are kept
+*   - Full fledged: resolution and/or color format change that keeps the
+*     routing, and, if the VDMA is present, the resolution. A routing change
+*     resets the AXIS sub-cores only and reprograms the router
+* Any other change, or a pipe that was not configured (or was stopped or
+* reset since), goes through the full configuration of
+* XVprocSs_SetSubsystemConfig().
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return XST_SUCCESS if successful else XST_FAILURE
+*
+* @note   Running sub-cores pick up new settings at their next frame boundary,
+*         so a transitional frame may be output. The changes applied are
+*         reported by XVprocSs_GetUpdateMask().
+*
+******************************************************************************/
+int XVprocSs_UpdateSubsystemConfig(XVprocSs *InstancePtr)
+{
+  XVprocSs_ContextData *CtxtPtr;
+  XVidC_VideoStream *InPtr;
+  XVidC_VideoStream *OutPtr;
+  u8 SizeChg, FmtChg;
+  int status;
+
+  /* Verify arguments */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  CtxtPtr = &InstancePtr->CtxtData;
+  InPtr   = &InstancePtr->VidIn;
+  OutPtr  = &InstancePtr->VidOut;
+
+  if((!CtxtPtr->CfgValid) ||
+     (InPtr->IsInterlaced != CtxtPtr->CfgVidIn.IsInterlaced) ||
+     (XVprocSs_IsZoomModeOn(InstancePtr)) ||
+     (XVprocSs_IsPipModeOn(InstancePtr))) {
+    return(XVprocSs_SetSubsystemConfig(InstancePtr));
+  }
+
+  SizeChg = ((InPtr->Timing.HActive  != CtxtPtr->CfgVidIn.Timing.HActive)  ||
+             (InPtr->Timing.VActive  != CtxtPtr->CfgVidIn.Timing.VActive)  ||
+             (OutPtr->Timing.HActive != CtxtPtr->CfgVidOut.Timing.HActive) ||
+             (OutPtr->Timing.VActive != CtxtPtr->CfgVidOut.Timing.VActive));
+  FmtChg  = ((InPtr->ColorFormatId  != CtxtPtr->CfgVidIn.ColorFormatId) ||
+             (OutPtr->ColorFormatId != CtxtPtr->CfgVidOut.ColorFormatId));
+
+  if(!SizeChg && !FmtChg) {
+    /* Nothing the pipe depends on has changed */
+    CtxtPtr->UpdateMask = XVPROCSS_UPDATE_NONE;
+    SaveAppliedConfig(InstancePtr);
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_UPDATE_VPSS, XVPROCSS_UPDATE_NONE);
+    return(XST_SUCCESS);
+  }
+
+  /* validate subsystem configuration */
+  if(ValidateSubsystemConfig(InstancePtr) != XST_SUCCESS) {
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_UPDATE_VPSS, XVPROCSS_EDAT_FAILURE);
+    return(XST_FAILURE);
+  }
+
+  switch(XVprocSs_GetSubsystemTopology(InstancePtr))
+  {
+    case XVPROCSS_TOPOLOGY_FULL_FLEDGED:
+        status = UpdateModeMax(InstancePtr, SizeChg);
+        break;
+
+    case XVPROCSS_TOPOLOGY_SCALER_ONLY:
+        if(FmtChg) {
+          return(XVprocSs_SetSubsystemConfig(InstancePtr));
+        }
+        status = UpdateModeScalerOnly(InstancePtr);
+        break;
+
+    case XVPROCSS_TOPOLOGY_CSC_ONLY:
+        status = UpdateModeCscOnly(InstancePtr, SizeChg, FmtChg);
+        break;
+
+    default:
+        /* Single-IP topologies are reset and set up by the application */
+        return(XVprocSs_SetSubsystemConfig(InstancePtr));
+  }
+
+  if(status == XST_SUCCESS) {
+    SaveAppliedConfig(InstancePtr);
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_UPDATE_VPSS, CtxtPtr->UpdateMask);
+  } else {
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_UPDATE_VPSS, XVPROCSS_EDAT_FAILURE);
+  }
+  return(status);
+}
+
+/*****************************************************************************/
+/**
+* This function records the streams the processing pipe is now configured for
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+static void SaveAppliedConfig(XVprocSs *XVprocSsPtr)
+{
+  XVprocSsPtr->CtxtData.CfgVidIn  = XVprocSsPtr->VidIn;
+  XVprocSsPtr->CtxtData.CfgVidOut = XVprocSsPtr->VidOut;
+  XVprocSsPtr->CtxtData.CfgValid  = TRUE;
+}
+
+/*****************************************************************************/
+/**
+* This function applies a resolution change to the running ScalerOnly
+* topology. The scalers are reprogrammed without reset and keep running.
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return XST_SUCCESS if successful else XST_FAILURE
+*
+******************************************************************************/
+static int UpdateModeScalerOnly(XVprocSs *XVprocSsPtr)
+{
+  int status;
+
+  if(!XVprocSsPtr->VscalerPtr || !XVprocSsPtr->HscalerPtr) {
+    return(SetupModeScalerOnly(XVprocSsPtr));
+  }
+
+  status = ValidateScalerOnlyConfig(XVprocSsPtr);
+  if(status == XST_SUCCESS) {
+    ConfigScalerOnly(XVprocSsPtr);
+    XVprocSsPtr->CtxtData.UpdateMask = XVPROCSS_UPDATE_SCALER;
+    XVprocSs_LogWrite(XVprocSsPtr, XVPROCSS_EVT_CFG_HSCALER, XVPROCSS_EDAT_SETUPOK);
+  } else {
+    XVprocSs_LogWrite(XVprocSsPtr, XVPROCSS_EVT_CFG_HSCALER, XVPROCSS_EDAT_IGNORE);
+  }
   return(status);
 }
 
+/*****************************************************************************/
+/**
+* This function applies a resolution and/or color format change to the
+* running CscOnly topology. Unlike SetupModeCscOnly() the picture settings
+* are not set back to their default.
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  SizeChg is TRUE if the resolution has changed
+* @param  FmtChg is TRUE if the input or output color format has changed
+*
+* @return XST_SUCCESS if successful else XST_FAILURE
+*
+******************************************************************************/
+static int UpdateModeCscOnly(XVprocSs *XVprocSsPtr, u8 SizeChg, u8 FmtChg)
+{
+  XV_Csc_l2 *CscPtr = XVprocSsPtr->CscPtr;
+  int status;
+
+  if(!CscPtr) {
+    return(SetupModeCscOnly(XVprocSsPtr));
+  }
+
+  status = ValidateCscOnlyConfig(XVprocSsPtr,
+                                 XV_CscIs422Enabled(CscPtr),
+                                 XV_CscIs420Enabled(CscPtr));
+  if(status != XST_SUCCESS) {
+    XVprocSs_LogWrite(XVprocSsPtr, XVPROCSS_EVT_CFG_CSC, XVPROCSS_EDAT_IGNORE);
+    return(status);
+  }
+
+  XVprocSsPtr->CtxtData.UpdateMask = XVPROCSS_UPDATE_NONE;
+
+  if(FmtChg) {
+    status = XV_CscSetColorspace(CscPtr,
+                                 XVprocSsPtr->VidIn.ColorFormatId,
+                                 XVprocSsPtr->VidOut.ColorFormatId,
+                                 CscPtr->StandardIn,
+                                 CscPtr->StandardOut,
+                                 CscPtr->OutputRange);
+    XVprocSsPtr->CtxtData.UpdateMask |= XVPROCSS_UPDATE_CSC;
+  }
+
+  if(SizeChg) {
+    XV_CscSetActiveSize(CscPtr,
+                        XVprocSsPtr->VidOut.Timing.HActive,
+                        XVprocSsPtr->VidOut.Timing.VActive);
+    XVprocSsPtr->CtxtData.UpdateMask |= XVPROCSS_UPDATE_SCALER;
+  }
+
+  XVprocSs_LogWrite(XVprocSsPtr, XVPROCSS_EVT_CFG_CSC,
+                    ((status == XST_SUCCESS) ? XVPROCSS_EDAT_SETUPOK
+                                             : XVPROCSS_EDAT_IGNORE));
+  return(status);
+}
+
+/*****************************************************************************/
+/**
+* This function applies a stream change to the running Full topology. The
+* routing table is rebuilt for the new streams and compared with the one in
+* use:
+*   - same routing: only the affected sub-cores are reprogrammed, the pipe
+*     keeps running
+*   - new routing: the AXIS sub-cores are held in reset while the router is
+*     reprogrammed and the sub-cores in the new path are set up. The AXI-MM
+*     network, VDMA and frame buffers are left untouched
+* A resolution change with VDMA in the design needs new VDMA windows and goes
+* through the full configuration.
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  SizeChg is TRUE if the resolution has changed
+*
+* @return XST_SUCCESS if successful else XST_FAILURE
+*
+******************************************************************************/
+static int UpdateModeMax(XVprocSs *XVprocSsPtr, u8 SizeChg)
+{
+  XVprocSs_ContextData *CtxtPtr = &XVprocSsPtr->CtxtData;
+  XVprocSs_ContextData Prev;
+  u32 UpdateMask = XVPROCSS_UPDATE_NONE;
+  u32 count;
+  int status;
+
+  if(SizeChg && XVprocSsPtr->VdmaPtr) {
+    status = SetupModeMax(XVprocSsPtr);
+    CtxtPtr->UpdateMask = XVPROCSS_UPDATE_FULL;
+    return(status);
+  }
+
+  Prev = *CtxtPtr;
+
+  /* Build Routing table for the new streams */
+  status = XVprocSs_BuildRoutingTable(XVprocSsPtr);
+  if(status != XST_SUCCESS) {
+    *CtxtPtr = Prev;
+    return(status);
+  }
+
+  if(SizeChg || (CtxtPtr->StrmCformat != Prev.StrmCformat)) {
+    UpdateMask |= XVPROCSS_UPDATE_SCALER;
+  }
+
+  if((CtxtPtr->CscIn  != Prev.CscIn)  || (CtxtPtr->CscOut != Prev.CscOut) ||
+     (CtxtPtr->HcrIn  != Prev.HcrIn)  || (CtxtPtr->HcrOut != Prev.HcrOut)) {
+    UpdateMask |= XVPROCSS_UPDATE_CSC;
+  }
+
+  if((CtxtPtr->RtrNumCores != Prev.RtrNumCores) ||
+     (memcmp(CtxtPtr->RtngTable, Prev.RtngTable, sizeof(CtxtPtr->RtngTable)))) {
+    UpdateMask |= XVPROCSS_UPDATE_ROUTE;
+
+    /* Hold video in and the AXIS sub-cores in reset, AXI-MM is left alone */
+    XVprocSs_ResetBlock(XVprocSsPtr->RstAxisPtr, GPIO_CH_RESET_SEL, XVPROCSS_RSTMASK_ALL_BLOCKS);
+    WaitUs(XVprocSsPtr, 100); /* hold reset line for 100us */
+    XVprocSs_EnableBlock(XVprocSsPtr->RstAxisPtr, GPIO_CH_RESET_SEL, XVPROCSS_RSTMASK_IP_AXIS);
+    WaitUs(XVprocSsPtr, 1000); /* wait 1ms for AXIS to stabilize */
+
+    /* Only the VDMA is still running */
+    for(count=0; count<XVPROCSS_SUBCORE_MAX; ++count) {
+      if(count != XVPROCSS_SUBCORE_VDMA) {
+        CtxtPtr->StartCore[count] = FALSE;
+      }
+    }
+
+    /* Set the Video Data Router registers */
+    XVprocSs_ProgRouterMux(XVprocSsPtr);
+  }
+
+  /* program the sub-cores affected by the change */
+  XVprocSs_UpdateRouterDataFlow(XVprocSsPtr, UpdateMask);
+
+  CtxtPtr->UpdateMask = (u8)UpdateMask;
+  return(XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 * This function returns picture brighntess setting
@@ -2442,6 +2755,35 @@ void XVprocSs_LoadScalerCoeff(XVprocSs *InstancePtr,
   }
 }
 
+/*****************************************************************************/
+/**
+* This function attaches a phase cache to the H Scaler core. Zoom, PIP and
+* resolution changes then reuse the phases computed for a scaling ratio
+* before instead of computing them again.
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+* @param  CachePtr is a pointer to the cache entries, or NULL to detach
+* @param  NumEntries is the number of entries
+*
+* @return None
+*
+* @note   Applicable only if H Scaler core is included in the subsystem
+*
+******************************************************************************/
+void XVprocSs_SetScalerPhaseCache(XVprocSs *InstancePtr,
+                                  XV_HscalerPhaseCache *CachePtr,
+                                  u16 NumEntries)
+{
+  /* Verify arguments */
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  if(InstancePtr->HscalerPtr) {
+    XV_HScalerSetPhaseCache(InstancePtr->HscalerPtr, CachePtr, NumEntries);
+  } else {
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CFG_HSCALER, XVPROCSS_EDAT_IPABSENT);
+  }
+}
+
 /*****************************************************************************/
 /**
 * This function enables user to load external filter coefficients for
@@ -128,6 +128,20 @@
 * SW is responsible to monitor the system for external impetus and call the
 * subsystem API's to communicate the change and trigger the reconfiguration of
 * internal data processing pipe (refer to API XVprocSs_ConfigureSubsystem())
+*
+* When the pipe is running, XVprocSs_UpdateSubsystemConfig() can be used
+* instead of XVprocSs_SetSubsystemConfig() to apply a stream change. It
+* compares the new input/output streams with the ones last applied and only
+* reprograms the sub-cores that are affected:
+*   - a resolution change that keeps the routing (and, with VDMA, the
+*     frame buffer layout) only updates the scalers and the active sizes
+*   - a color format change that keeps the routing only updates the CSC and
+*     the chroma resampler formats, keeping the picture settings
+*   - a routing change only resets the AXIS sub-cores and reprograms the
+*     router; the VDMA and its frame buffers are left running
+* All other changes fall back to the full reset and reconfiguration. The
+* changes applied are reported by XVprocSs_GetUpdateMask().
+*
 * AXI Stream configuration for input/output interface is derived from the
 * Xilinx video common driver and only the resolutions listed therein are
 * supported at this time
@@ -208,6 +222,9 @@
 *                       XVprocSs_SetFrameBufBaseaddr API
 * 2.30  rco  11/15/16   Make debug log optional (can be disabled via makefile)
 * 			 12/15/16   Added HasMADI configuration option
+* 2.50  ag   10/14/26   Added XVprocSs_SetScalerPhaseCache
+*       ag   10/14/26   Added XVprocSs_UpdateSubsystemConfig and the applied
+*                       stream configuration to the context data
 *
 * </pre>
 *
@@ -306,6 +323,19 @@ typedef enum
   XVPROCSS_COLOR_CH_NUM_SUPPORTED
 }XVprocSs_ColorChannel;
 
+/** @name Incremental update flags
+ *
+ * @{
+ * The following constants identify the changes applied to the processing
+ * pipe by XVprocSs_UpdateSubsystemConfig()
+ */
+#define XVPROCSS_UPDATE_NONE   (0x00) /**< Streams unchanged */
+#define XVPROCSS_UPDATE_SCALER (0x01) /**< Scaling ratio/active size update */
+#define XVPROCSS_UPDATE_CSC    (0x02) /**< Color format conversion update */
+#define XVPROCSS_UPDATE_ROUTE  (0x04) /**< AXIS switch routing update */
+#define XVPROCSS_UPDATE_FULL   (0x80) /**< Full reset and reconfiguration */
+/*@}*/
+
 /**
  * Video Processing Subsystem context scratch pad memory.
  * This contains internal flags, state variables, routing table
@@ -335,6 +365,10 @@ typedef struct
   XVidC_ColorFormat HcrIn;    /**< horiz. cresmplr core input color format */
   XVidC_ColorFormat HcrOut;   /**< horiz. cresmplr core output color format */
   XLboxColorId LboxBkgndColor; /**< Lbox background color */
+  XVidC_VideoStream CfgVidIn;  /**< Input stream the pipe is configured for */
+  XVidC_VideoStream CfgVidOut; /**< Output stream the pipe is configured for */
+  u8 CfgValid;                 /**< CfgVidIn/Out match the running pipe */
+  u8 UpdateMask;               /**< XVPROCSS_UPDATE_* flags of last update */
 }XVprocSs_ContextData;
 
 /**
@@ -582,6 +616,19 @@ typedef struct
 #define XVprocSs_ResetZoomModeFlag(XVprocSsPtr)  \
                                        ((XVprocSsPtr)->CtxtData.ZoomEn = FALSE)
 
+/*****************************************************************************/
+/**
+ * This macro returns the changes applied to the processing pipe by the last
+ * call to XVprocSs_UpdateSubsystemConfig()
+ *
+ * @param  XVprocSsPtr is pointer to the Video Processing subsystem instance
+ *
+ * @return Bit mask of XVPROCSS_UPDATE_* flags
+ *
+ *****************************************************************************/
+#define XVprocSs_GetUpdateMask(XVprocSsPtr) \
+                                        ((XVprocSsPtr)->CtxtData.UpdateMask)
+
 /*****************************************************************************/
 /**
  * This macro sets the specified stream's color format. It can be used to
@@ -621,6 +668,7 @@ int XVprocSs_CfgInitialize(XVprocSs *InstancePtr,
                            XVprocSs_Config *CfgPtr,
 						   UINTPTR EffectiveAddr);
 int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr);
+int XVprocSs_UpdateSubsystemConfig(XVprocSs *InstancePtr);
 XVprocSs_Config* XVprocSs_LookupConfig(u32 DeviceId);
 
 void XVprocSs_Start(XVprocSs *InstancePtr);
@@ -683,6 +731,9 @@ void XVprocSs_LoadScalerCoeff(XVprocSs *InstancePtr,
                               u16 num_phases,
                               u16 num_taps,
                               const short *Coeff);
+void XVprocSs_SetScalerPhaseCache(XVprocSs *InstancePtr,
+                                  XV_HscalerPhaseCache *CachePtr,
+                                  u16 NumEntries);
 
 void XVprocSs_LoadChromaResamplerCoeff(XVprocSs *InstancePtr,
 		                               u32 CoreId,
@@ -49,12 +49,15 @@
  *                     etc.) severity from Info to Error
  * 2.30  rco  11/15/16 Make debug log optional (can be disabled via makefile)*
  * 2.40  vyc  10/04/17 Add 420 support in CSC-only topology
+ *       ag   10/14/26 Mirror log events into the BSP binary trace
+ *       ag   10/14/26 Add incremental subsystem update event
  * </pre>
  *
 *******************************************************************************/
 
 /******************************* Include Files ********************************/
 #include "xvprocss.h"
+#include "xil_trace.h"
 
 /**************************** Function Prototypes *****************************/
 
@@ -103,6 +106,10 @@ void XVprocSs_LogWrite(XVprocSs *InstancePtr, XVprocSs_LogEvent Evt, u8 Data)
 	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(Evt < (XVPROCSS_EVT_LAST_ENUM));
 
+	/* Mirror the event into the shared binary trace */
+	XIL_TRACE2(XIL_TRACE_ID(XIL_TRACE_MOD_VPROCSS, Evt),
+			InstancePtr->Config.DeviceId, Data);
+
 	/* Write data and event into log buffer */
 	InstancePtr->Log.DataBuffer[InstancePtr->Log.HeadIndex] =
 			((u16)Data << 8) | Evt;
@@ -237,6 +244,14 @@ void XVprocSs_LogDisplay(XVprocSs *InstancePtr)
 		case (XVPROCSS_EVT_STOP_VPSS):
 			xil_printf("Info: Subsystem stopped\r\n");
 			break;
+		case (XVPROCSS_EVT_UPDATE_VPSS):
+			if (Data == XVPROCSS_EDAT_FAILURE) {
+				xil_printf("Error: Subsystem update failed\r\n");
+			}
+			else {
+				xil_printf("Info: Subsystem updated (0x%x)\r\n", Data);
+			}
+			break;
 		case (XVPROCSS_EVT_CHK_TOPO):
 			if (Data == XVPROCSS_EDAT_INITFAIL) {
 				xil_printf("Error: Topology Not Supported\r\n");
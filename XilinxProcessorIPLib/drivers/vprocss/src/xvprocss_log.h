@@ -48,6 +48,7 @@
 * 1.00  dmc  01/27/16 Initial Release
 *       dmc  03/03/16 Add events for VDMA configuration and operational errors
 * 2.30  rco  11/15/16 Make debug log optional (can be disabled via makefile)
+*       ag   10/14/26 Add event for incremental subsystem update
 *
 * </pre>
 *
@@ -102,6 +103,7 @@ typedef enum {
 	XVPROCSS_EVT_RESET_VPSS,   /**< Log event Reset the VPSS */
 	XVPROCSS_EVT_START_VPSS,   /**< Log event Start the VPSS */
 	XVPROCSS_EVT_STOP_VPSS,    /**< Log event Stop the VPSS */
+	XVPROCSS_EVT_UPDATE_VPSS,  /**< Log event Incremental VPSS update */
 	XVPROCSS_EVT_LAST_ENUM     /**< (dummy event: marks last enum) */
 } XVprocSs_LogEvent;
 
@@ -57,6 +57,10 @@
 * 2.2   rco  11/01/16   Add log events to capture failure during router data
 *                       flow setup
 * 2.4   vyc  10/04/17   Write to Result for XV_CscSetColorSpace
+*       ag   10/14/26   Added XVprocSs_UpdateRouterDataFlow to reprogram only
+*                       the sub-cores affected by a stream change
+*       ag   10/14/26   Program the router from a route table so only the
+*                       changed MI ports are rewritten
 * </pre>
 *
 ******************************************************************************/
@@ -77,6 +81,7 @@ static int validateWindowSize(const XVidC_VideoWindow *win,
 		                      const u32 VActive);
 
 static XVprocSs_ScaleMode GetScalingMode(XVprocSs *XVprocSsPtr);
+static void SetupDataFlow(XVprocSs *XVprocSsPtr, u32 UpdateMask);
 
 
 /*****************************************************************************/
@@ -427,7 +432,8 @@ int XVprocSs_BuildRoutingTable(XVprocSs *XVprocSsPtr)
 /**
 * This function traverses the computed routing table and sets up the AXIS
 * switch registers, to route the stream through processing cores, in the order
-* defined in the routing map
+* defined in the routing map. Only the MI ports whose source changes are
+* rewritten before the register update.
 *
 * @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
 *
@@ -439,24 +445,27 @@ void XVprocSs_ProgRouterMux(XVprocSs *XVprocSsPtr)
   u32 count, nextMi, prevSi;
   u8 *pTable = &XVprocSsPtr->CtxtData.RtngTable[0];
   u32 numProcElem = XVprocSsPtr->CtxtData.RtrNumCores;
+  u8 siTable[XAXIS_SCR_MAX_PORTS];
 
   XAxisScr_RegUpdateDisable(XVprocSsPtr->RouterPtr);
 
-  /* Disable all ports */
-  XAxisScr_MiPortDisableAll(XVprocSsPtr->RouterPtr);
+  /* All ports not in the path are disabled */
+  memset(siTable, XAXIS_SCR_PORT_NONE, sizeof(siTable));
 
   /* Connect Input Stream to the 1st core in path */
   nextMi = prevSi = pTable[0];
-  XAxisScr_MiPortEnable(XVprocSsPtr->RouterPtr, nextMi, XVPROCSS_AXIS_SWITCH_VIDIN_S0);
+  siTable[nextMi] = XVPROCSS_AXIS_SWITCH_VIDIN_S0;
 
   /* Traverse routing map and connect cores in the chain */
   for(count=1; count<numProcElem; ++count)
   {
     nextMi  = pTable[count];
-    XAxisScr_MiPortEnable(XVprocSsPtr->RouterPtr, nextMi, prevSi);
+    siTable[nextMi] = prevSi;
     prevSi = nextMi;
   }
 
+  XAxisScr_MiPortUpdate(XVprocSsPtr->RouterPtr, siTable);
+
   //Enable Router register update
   XAxisScr_RegUpdateEnable(XVprocSsPtr->RouterPtr);
 
@@ -476,6 +485,54 @@ void XVprocSs_ProgRouterMux(XVprocSs *XVprocSsPtr)
 *
 ******************************************************************************/
 void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
+{
+  SetupDataFlow(XVprocSsPtr, XVPROCSS_UPDATE_FULL);
+
+  /* Start all IP Blocks in the processing chain */
+  XVprocSs_Start(XVprocSsPtr);
+}
+
+/*****************************************************************************/
+/**
+* This function traverses the routing map built earlier and reprograms only
+* the sub-cores in the processing path that are affected by the requested
+* update. Sub-cores that are running pick up the new settings at their next
+* frame boundary.
+*   - XVPROCSS_UPDATE_SCALER: scalers, letterbox, chroma resamplers and the
+*     CSC active size
+*   - XVPROCSS_UPDATE_CSC: CSC color space and horizontal chroma resampler
+*     formats
+*   - XVPROCSS_UPDATE_ROUTE: all sub-cores in the path but the VDMA, which
+*     are then started. The AXIS sub-cores must have been held in reset and
+*     the router programmed by the caller
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  UpdateMask is a bit mask of XVPROCSS_UPDATE_* flags
+*
+* @return None
+*
+******************************************************************************/
+void XVprocSs_UpdateRouterDataFlow(XVprocSs *XVprocSsPtr, u32 UpdateMask)
+{
+  SetupDataFlow(XVprocSsPtr, UpdateMask);
+
+  if(UpdateMask & (XVPROCSS_UPDATE_ROUTE | XVPROCSS_UPDATE_FULL)) {
+    XVprocSs_Start(XVprocSsPtr);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function programs the sub-cores in the processing path that are
+* selected by the update mask, per their location in the chain.
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  UpdateMask is a bit mask of XVPROCSS_UPDATE_* flags
+*
+* @return None
+*
+******************************************************************************/
+static void SetupDataFlow(XVprocSs *XVprocSsPtr, u32 UpdateMask)
 {
   XVidC_VideoWindow lboxWin;
   u32 vsc_WidthIn, vsc_HeightIn, vsc_HeightOut;
@@ -487,6 +544,10 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
   XVprocSs_ContextData *CtxtPtr = &XVprocSsPtr->CtxtData;
   u8 *pTable = &XVprocSsPtr->CtxtData.RtngTable[0];
   u8 *StartCorePtr = &XVprocSsPtr->CtxtData.StartCore[0];
+  /* Sub-cores were reset: program everything in the path */
+  u32 All    = UpdateMask & (XVPROCSS_UPDATE_ROUTE | XVPROCSS_UPDATE_FULL);
+  u32 Size   = All | (UpdateMask & XVPROCSS_UPDATE_SCALER);
+  u32 Format = All | (UpdateMask & XVPROCSS_UPDATE_CSC);
 
   vsc_WidthIn = vsc_HeightIn = vsc_HeightOut = 0;
   hsc_HeightIn = hsc_WidthIn = hsc_WidthOut = 0;
@@ -501,7 +562,7 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
   }
 
   /* If Vdma is enabled, RD/WR Client needs to be programmed before Scaler */
-  if (XVprocSsPtr->VdmaPtr) {
+  if ((XVprocSsPtr->VdmaPtr) && (UpdateMask & XVPROCSS_UPDATE_FULL)) {
     switch (CtxtPtr->ScaleMode) {
       case XVPROCSS_SCALE_1_1:
       case XVPROCSS_SCALE_UP:
@@ -537,6 +598,10 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
               vsc_HeightOut = XVprocSsPtr->VidOut.Timing.VActive;
             }
 
+            if(!Size) {
+              break;
+            }
+
             Result = XV_VScalerSetup(XVprocSsPtr->VscalerPtr,
                                      vsc_WidthIn,
                                      vsc_HeightIn,
@@ -567,6 +632,10 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
               hsc_WidthOut = XVprocSsPtr->VidOut.Timing.HActive;
             }
 
+            if(!Size) {
+              break;
+            }
+
             Result = XV_HScalerSetup(XVprocSsPtr->HscalerPtr,
                                      hsc_HeightIn,
                                      hsc_WidthIn,
@@ -587,7 +656,7 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
           break;
 
       case XVPROCSS_SUBCORE_LBOX:
-          if(XVprocSsPtr->LboxPtr) {
+          if((XVprocSsPtr->LboxPtr) && (Size)) {
             if(XVprocSs_IsPipModeOn(XVprocSsPtr)) {
               /* get the active window for Lbox */
               lboxWin = CtxtPtr->WrWindow;
@@ -615,7 +684,7 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
           break;
 
       case XVPROCSS_SUBCORE_CR_H:
-          if(XVprocSsPtr->HcrsmplrPtr) {
+          if((XVprocSsPtr->HcrsmplrPtr) && (Size | Format)) {
             XV_HCrsmplSetActiveSize(XVprocSsPtr->HcrsmplrPtr,
                                     XVprocSsPtr->VidOut.Timing.HActive,
                                     XVprocSsPtr->VidOut.Timing.VActive);
@@ -628,7 +697,7 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
           break;
 
       case XVPROCSS_SUBCORE_CR_V_IN:
-          if(XVprocSsPtr->VcrsmplrInPtr) {
+          if((XVprocSsPtr->VcrsmplrInPtr) && (Size)) {
             XV_VCrsmplSetActiveSize(XVprocSsPtr->VcrsmplrInPtr,
 			                        CtxtPtr->VidInWidth,
 			                        CtxtPtr->VidInHeight);
@@ -641,7 +710,7 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
           break;
 
       case XVPROCSS_SUBCORE_CR_V_OUT:
-          if(XVprocSsPtr->VcrsmplrOutPtr) {
+          if((XVprocSsPtr->VcrsmplrOutPtr) && (Size)) {
             XV_VCrsmplSetActiveSize(XVprocSsPtr->VcrsmplrOutPtr,
                                     XVprocSsPtr->VidOut.Timing.HActive,
                                     XVprocSsPtr->VidOut.Timing.VActive);
@@ -654,7 +723,14 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
           break;
 
       case XVPROCSS_SUBCORE_CSC:
-        if(XVprocSsPtr->CscPtr) {
+        if((XVprocSsPtr->CscPtr) && (!Format)) {
+          // resolution change only: keep the picture settings
+          if(Size) {
+            XV_CscSetActiveSize(XVprocSsPtr->CscPtr,
+                                XVprocSsPtr->VidOut.Timing.HActive,
+                                XVprocSsPtr->VidOut.Timing.VActive);
+          }
+        } else if(XVprocSsPtr->CscPtr) {
 
           // to set up a new resolution, start with default picture settings
           XV_CscSetPowerOnDefaultState(XVprocSsPtr->CscPtr);
@@ -686,7 +762,7 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
         break;
 
       case XVPROCSS_SUBCORE_DEINT:
-          if(XVprocSsPtr->DeintPtr)
+          if((XVprocSsPtr->DeintPtr) && (All))
           {
             XV_DeintSetFieldBuffers(XVprocSsPtr->DeintPtr,
 			                        CtxtPtr->DeintBufAddr,
@@ -711,9 +787,5 @@ void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr)
   if(SetupFlag == XST_SUCCESS) {
     XVprocSs_LogWrite(XVprocSsPtr, XVPROCSS_EVT_CFG_MAX, XVPROCSS_EDAT_MAX_DFLOWOK);
   }
-
-  /* Start all IP Blocks in the processing chain */
-  XVprocSs_Start(XVprocSsPtr);
-
 }
 /** @} */
@@ -46,6 +46,7 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   07/21/15   Initial Release
+*       ag    10/14/26   Added XVprocSs_UpdateRouterDataFlow
 
 * </pre>
 *
@@ -64,6 +65,7 @@ extern "C" {
 int XVprocSs_BuildRoutingTable(XVprocSs *XVprocSsPtr);
 void XVprocSs_ProgRouterMux(XVprocSs *XVprocSsPtr);
 void XVprocSs_SetupRouterDataFlow(XVprocSs *XVprocSsPtr);
+void XVprocSs_UpdateRouterDataFlow(XVprocSs *XVprocSsPtr, u32 UpdateMask);
 
 #ifdef __cplusplus
 }
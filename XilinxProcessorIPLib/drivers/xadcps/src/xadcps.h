@@ -116,6 +116,17 @@
 * device in interrupt mode.
 *
 *
+* <b> Batched and Alarm Driven Sampling </b>
+*
+* Every XAdcPs_GetAdcData() call is a command FIFO round trip. For several
+* channels XAdcPs_GetAdcDataBatch() queues all the read commands at once and
+* collects the results in one pass. The alarm sampler built on it
+* (XAdcPs_AlarmSamplerInitialize()) reads a set of channels from
+* XAdcPs_AlarmSamplerIntrHandler() only when an enabled alarm asserts, so
+* software is not woken while the monitored values stay within the limits
+* set with XAdcPs_SetAlarmThreshold().
+*
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -179,6 +190,8 @@
 *       ms     04/05/17 Modified Comment lines in functions of xadcps
 *                       examples to recognize it as documentation block
 *                       for doxygen generation.
+*       ag     10/14/26 Added XAdcPs_GetAdcDataBatch and the alarm driven
+*                       sampler in xadcps_batch.c.
 *
 * </pre>
 *
@@ -315,6 +328,8 @@ extern "C" {
 #define XADCPS_PD_MODE_XADC		2  /**< Power Down ADC A and ADC B */
 /*@}*/
 
+#define XADCPS_BATCH_MAX_CHANNELS	32 /**< Max channels of a sampler */
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -338,6 +353,31 @@ typedef struct {
 
 } XAdcPs;
 
+/**
+ * Handler called by XAdcPs_AlarmSamplerIntrHandler() when alarms assert.
+ * AlarmMask holds the XADCPS_INTX_* bits of the alarms that asserted and
+ * DataPtr the channels read, in the order given to
+ * XAdcPs_AlarmSamplerInitialize().
+ */
+typedef void (*XAdcPs_AlarmHandler)(void *CallBackRef, u32 AlarmMask,
+					const u16 *DataPtr);
+
+/**
+ * Alarm driven sampler. The user allocates a variable of this type and
+ * passes it to the XAdcPs_AlarmSampler* functions and, as the callback
+ * reference, to XAdcPs_AlarmSamplerIntrHandler().
+ */
+typedef struct {
+	XAdcPs *InstancePtr;	/**< Instance being sampled */
+	u32 AlarmMask;		/**< Alarms that trigger a sample */
+	u32 Latched;		/**< Alarms masked until they deassert */
+	u32 NumChannels;	/**< Channels read on an alarm */
+	u8 Channel[XADCPS_BATCH_MAX_CHANNELS];	/**< Channels to read */
+	u16 Data[XADCPS_BATCH_MAX_CHANNELS];	/**< Last data read */
+	XAdcPs_AlarmHandler Handler;	/**< Alarm handler */
+	void *CallBackRef;		/**< Callback reference for Handler */
+} XAdcPs_AlarmSampler;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 /****************************************************************************/
@@ -567,6 +607,23 @@ void XAdcPs_SetPowerdownMode(XAdcPs *InstancePtr, u32 Mode);
 
 u32 XAdcPs_GetPowerdownMode(XAdcPs *InstancePtr);
 
+/**
+ * Functions in xadcps_batch.c
+ */
+void XAdcPs_GetAdcDataBatch(XAdcPs *InstancePtr, const u8 *ChannelPtr,
+				u16 *DataPtr, u32 NumChannels);
+
+int XAdcPs_AlarmSamplerInitialize(XAdcPs_AlarmSampler *SamplerPtr,
+					XAdcPs *InstancePtr,
+					const u8 *ChannelPtr, u32 NumChannels,
+					XAdcPs_AlarmHandler FuncPtr,
+					void *CallBackRef);
+void XAdcPs_AlarmSamplerStart(XAdcPs_AlarmSampler *SamplerPtr,
+				u32 AlarmMask);
+void XAdcPs_AlarmSamplerStop(XAdcPs_AlarmSampler *SamplerPtr);
+void XAdcPs_AlarmSamplerService(XAdcPs_AlarmSampler *SamplerPtr);
+void XAdcPs_AlarmSamplerIntrHandler(void *CallBackRef);
+
 /**
  * Functions in xadcps_selftest.c
  */
@@ -0,0 +1,404 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xadcps_batch.c
+* @addtogroup xadcps_v2_2
+* @{
+*
+* This file contains the batched channel read and the alarm driven sampler of
+* the XADC driver.
+*
+* The PS-XADC interface executes one command per word written to the command
+* FIFO and returns the data shifted out during that command in the data FIFO.
+* The result of a read is therefore returned with the next command. A batch
+* writes the read commands of up to XADCPS_BATCH_CHUNK channels followed by a
+* no-op, waits for the data FIFO to fill and drains it, which costs a single
+* FIFO round trip per chunk instead of two per channel.
+*
+* The alarm status bits of the XADC stay set for as long as the alarm is
+* active. The sampler therefore masks each alarm after it fires and only
+* re-enables it once XAdcPs_AlarmSamplerService(), or the next alarm
+* interrupt, sees that the alarm output has deasserted.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 2.2   ag     10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xadcps.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Depth of the command and data FIFOs, and the number of reads that fit in
+ * one pass together with the trailing no-op.
+ */
+#define XADCPS_FIFO_DEPTH	15U
+#define XADCPS_BATCH_CHUNK	(XADCPS_FIFO_DEPTH - 1U)
+
+/* Interrupt bits the alarm sampler can be started on */
+#define XADCPS_SAMPLER_ALARM_MASK	(XADCPS_INTX_OT_MASK | \
+					 XADCPS_INTX_ALM_ALL_MASK)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static void XAdcPs_AlarmSamplerRearm(XAdcPs_AlarmSampler *SamplerPtr);
+
+/************************** Variable Definitions *****************************/
+
+
+/****************************************************************************/
+/**
+*
+* This function reads the ADC data of several channels in batches through
+* the command FIFO.
+*
+* @param	InstancePtr is a pointer to the XAdcPs instance.
+* @param	ChannelPtr is the array of channels to read. Use XADCPS_CH_*
+*		defined in xadcps.h.
+* @param	DataPtr is the array receiving the 16-bit ADC data of each
+*		channel, in the order of ChannelPtr.
+* @param	NumChannels is the number of channels to read.
+*
+* @return	None.
+*
+* @note		The command and data FIFOs must be empty on entry, which is
+*		the case after any other function of this driver.
+*
+*****************************************************************************/
+void XAdcPs_GetAdcDataBatch(XAdcPs *InstancePtr, const u8 *ChannelPtr,
+				u16 *DataPtr, u32 NumChannels)
+{
+	u32 Done;
+	u32 Count;
+	u32 Index;
+	u32 RegOffset;
+	u32 Level;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(ChannelPtr != NULL);
+	Xil_AssertVoid(DataPtr != NULL);
+
+	for (Done = 0U; Done < NumChannels; Done += Count) {
+		Count = NumChannels - Done;
+		if (Count > XADCPS_BATCH_CHUNK) {
+			Count = XADCPS_BATCH_CHUNK;
+		}
+
+		/*
+		 * Queue the reads, then a no-op that shifts out the result
+		 * of the last read.
+		 */
+		for (Index = 0U; Index < Count; Index++) {
+			Xil_AssertVoid((ChannelPtr[Done + Index] <=
+					XADCPS_CH_VBRAM) ||
+				       ((ChannelPtr[Done + Index] >=
+					XADCPS_CH_VCCPINT) &&
+				       (ChannelPtr[Done + Index] <=
+					XADCPS_CH_AUX_MAX)));
+			RegOffset = XADCPS_TEMP_OFFSET +
+					(u32)ChannelPtr[Done + Index];
+			XAdcPs_WriteFifo(InstancePtr,
+				XAdcPs_FormatWriteData(RegOffset, 0x0, FALSE));
+		}
+		XAdcPs_WriteFifo(InstancePtr, XADCPS_JTAG_CMD_NOP_MASK);
+
+		/*
+		 * Wait for all the commands to complete.
+		 */
+		do {
+			Level = (XAdcPs_ReadReg(InstancePtr->Config.BaseAddress,
+					XADCPS_MSTS_OFFSET) &
+					XADCPS_MSTS_DFIFO_LVL_MASK) >>
+					XADCPS_MSTS_DFIFO_LVL_SHIFT;
+		} while (Level < (Count + 1U));
+
+		/*
+		 * The first word was shifted out during the first read and
+		 * holds no data of this batch.
+		 */
+		(void)XAdcPs_ReadFifo(InstancePtr);
+		for (Index = 0U; Index < Count; Index++) {
+			DataPtr[Done + Index] = (u16)XAdcPs_ReadFifo(InstancePtr);
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function initializes an alarm driven sampler. The sampler is left
+* stopped.
+*
+* @param	SamplerPtr is a pointer to the XAdcPs_AlarmSampler.
+* @param	InstancePtr is a pointer to the XAdcPs instance.
+* @param	ChannelPtr is the array of channels read when an alarm asserts.
+* @param	NumChannels is the number of channels, at most
+*		XADCPS_BATCH_MAX_CHANNELS.
+* @param	FuncPtr is the handler called with the channel data.
+* @param	CallBackRef is passed back to the handler.
+*
+* @return
+*		- XST_SUCCESS if the sampler was initialized.
+*		- XST_INVALID_PARAM if NumChannels is out of range.
+*
+* @note		The alarm thresholds and alarm enables are configured by the
+*		application with XAdcPs_SetAlarmThreshold() and
+*		XAdcPs_SetAlarmEnables().
+*
+*****************************************************************************/
+int XAdcPs_AlarmSamplerInitialize(XAdcPs_AlarmSampler *SamplerPtr,
+					XAdcPs *InstancePtr,
+					const u8 *ChannelPtr, u32 NumChannels,
+					XAdcPs_AlarmHandler FuncPtr,
+					void *CallBackRef)
+{
+	u32 Index;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ChannelPtr != NULL);
+	Xil_AssertNonvoid(FuncPtr != NULL);
+
+	if ((NumChannels == 0U) || (NumChannels > XADCPS_BATCH_MAX_CHANNELS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	SamplerPtr->InstancePtr = InstancePtr;
+	SamplerPtr->AlarmMask = 0U;
+	SamplerPtr->Latched = 0U;
+	SamplerPtr->NumChannels = NumChannels;
+	for (Index = 0U; Index < NumChannels; Index++) {
+		SamplerPtr->Channel[Index] = ChannelPtr[Index];
+		SamplerPtr->Data[Index] = 0U;
+	}
+	SamplerPtr->Handler = FuncPtr;
+	SamplerPtr->CallBackRef = CallBackRef;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function starts the sampler on a set of alarms. Stale status of the
+* alarms is cleared and their interrupts are unmasked.
+*
+* @param	SamplerPtr is a pointer to the XAdcPs_AlarmSampler.
+* @param	AlarmMask is the bit-mask of the alarms to sample on, formed by
+*		OR'ing XADCPS_INTX_ALM* and XADCPS_INTX_OT_MASK bits.
+*
+* @return	None.
+*
+* @note		XAdcPs_AlarmSamplerIntrHandler() must be connected to the
+*		XADC interrupt before the sampler is started.
+*
+*****************************************************************************/
+void XAdcPs_AlarmSamplerStart(XAdcPs_AlarmSampler *SamplerPtr,
+				u32 AlarmMask)
+{
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+	Xil_AssertVoid((AlarmMask & ~XADCPS_SAMPLER_ALARM_MASK) == 0U);
+
+	SamplerPtr->AlarmMask = AlarmMask;
+	SamplerPtr->Latched = 0U;
+
+	XAdcPs_IntrClear(SamplerPtr->InstancePtr, AlarmMask);
+	XAdcPs_IntrEnable(SamplerPtr->InstancePtr, AlarmMask);
+}
+
+/****************************************************************************/
+/**
+*
+* This function stops the sampler and masks its alarm interrupts.
+*
+* @param	SamplerPtr is a pointer to the XAdcPs_AlarmSampler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XAdcPs_AlarmSamplerStop(XAdcPs_AlarmSampler *SamplerPtr)
+{
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+
+	XAdcPs_IntrDisable(SamplerPtr->InstancePtr, SamplerPtr->AlarmMask);
+	XAdcPs_IntrClear(SamplerPtr->InstancePtr, SamplerPtr->AlarmMask);
+
+	SamplerPtr->AlarmMask = 0U;
+	SamplerPtr->Latched = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function re-enables the alarms that have fired and since deasserted,
+* so the sampler wakes again on their next crossing. It is meant to be
+* called periodically at a low rate, for example from a system tick.
+*
+* @param	SamplerPtr is a pointer to the XAdcPs_AlarmSampler.
+*
+* @return	None.
+*
+* @note		The caller must not be preempted by
+*		XAdcPs_AlarmSamplerIntrHandler() for the same sampler.
+*
+*****************************************************************************/
+void XAdcPs_AlarmSamplerService(XAdcPs_AlarmSampler *SamplerPtr)
+{
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+
+	if (SamplerPtr->Latched != 0U) {
+		XAdcPs_AlarmSamplerRearm(SamplerPtr);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the alarm sampler. It must be
+* connected to the XADC interrupt with the XAdcPs_AlarmSampler as the callback
+* reference.
+*
+* The alarms that asserted are masked, the sampler channels are read in one
+* batch and the handler is called with the alarms and the data.
+*
+* @param	CallBackRef is a pointer to the XAdcPs_AlarmSampler.
+*
+* @return	None.
+*
+* @note		Other XADC interrupts are left pending for the application.
+*
+*****************************************************************************/
+void XAdcPs_AlarmSamplerIntrHandler(void *CallBackRef)
+{
+	XAdcPs_AlarmSampler *SamplerPtr = (XAdcPs_AlarmSampler *)CallBackRef;
+	u32 Fired;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+
+	Fired = XAdcPs_IntrGetStatus(SamplerPtr->InstancePtr) &
+			SamplerPtr->AlarmMask & ~SamplerPtr->Latched;
+
+	/*
+	 * Re-arm those that have cleared before latching the new ones, so an
+	 * alarm that fired again is not unmasked right away.
+	 */
+	if (SamplerPtr->Latched != 0U) {
+		XAdcPs_AlarmSamplerRearm(SamplerPtr);
+	}
+
+	if (Fired == 0U) {
+		return;
+	}
+
+	XAdcPs_IntrDisable(SamplerPtr->InstancePtr, Fired);
+	XAdcPs_IntrClear(SamplerPtr->InstancePtr, Fired);
+	SamplerPtr->Latched |= Fired;
+
+	XAdcPs_GetAdcDataBatch(SamplerPtr->InstancePtr, SamplerPtr->Channel,
+				SamplerPtr->Data, SamplerPtr->NumChannels);
+
+	SamplerPtr->Handler(SamplerPtr->CallBackRef, Fired, SamplerPtr->Data);
+}
+
+/****************************************************************************/
+/**
+*
+* This function unmasks the latched alarms whose alarm output is no longer
+* active.
+*
+* @param	SamplerPtr is a pointer to the XAdcPs_AlarmSampler.
+*
+* @return	None.
+*
+* @note		The alarm bits of the Interrupt Status Register and of the
+*		Miscellaneous Status Register have the same positions.
+*
+*****************************************************************************/
+static void XAdcPs_AlarmSamplerRearm(XAdcPs_AlarmSampler *SamplerPtr)
+{
+	u32 Active;
+	u32 Cleared;
+
+	Active = XAdcPs_ReadReg(SamplerPtr->InstancePtr->Config.BaseAddress,
+				XADCPS_MSTS_OFFSET) &
+			(XADCPS_MSTS_OT_MASK | XADCPS_MSTS_ALM_MASK);
+	Cleared = SamplerPtr->Latched & ~Active;
+
+	if (Cleared != 0U) {
+		XAdcPs_IntrClear(SamplerPtr->InstancePtr, Cleared);
+		XAdcPs_IntrEnable(SamplerPtr->InstancePtr, Cleared);
+		SamplerPtr->Latched &= ~Cleared;
+	}
+}
+/** @} */
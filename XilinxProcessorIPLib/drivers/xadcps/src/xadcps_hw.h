@@ -137,6 +137,7 @@ extern "C" {
  */
 #define XADCPS_MSTS_CFIFO_LVL_MASK  0x000F0000 /**< Command FIFO Level mask */
 #define XADCPS_MSTS_DFIFO_LVL_MASK  0x0000F000 /**< Data FIFO Level Mask  */
+#define XADCPS_MSTS_DFIFO_LVL_SHIFT 12	      /**< Data FIFO Level Shift */
 #define XADCPS_MSTS_CFIFOF_MASK     0x00000800 /**< Command FIFO Full Mask  */
 #define XADCPS_MSTS_CFIFOE_MASK     0x00000400 /**< Command FIFO Empty Mask  */
 #define XADCPS_MSTS_DFIFOF_MASK     0x00000200 /**< Data FIFO Full Mask  */
@@ -411,6 +412,7 @@ extern "C" {
 #define XADCPS_JTAG_CMD_MASK		0x3C000000 /**< Mask for the Cmd */
 #define XADCPS_JTAG_CMD_WRITE_MASK	0x08000000 /**< Mask for CMD Write */
 #define XADCPS_JTAG_CMD_READ_MASK	0x04000000 /**< Mask for CMD Read */
+#define XADCPS_JTAG_CMD_NOP_MASK	0x00000000 /**< Mask for CMD No Op */
 #define XADCPS_JTAG_CMD_SHIFT		26	   /**< Shift for the Cmd */
 
 /*@}*/
@@ -76,6 +76,18 @@
 * functions by using XZDma_SetCallBack API. In this version Descriptor done
 * option is disabled.
 *
+* <b> Copy service </b>
+*
+* XZDma_CopyInitialize() groups up to XZDMA_COPY_MAX_CHANNELS initialized
+* channels of the same ZDMA (GDMA or ADMA) into a copy service. Copies are
+* split across the idle channels, fills use the write only mode and scatter
+* lists are spread over the channels in descriptor mode. Every operation is
+* tracked by a caller provided XZDma_CopyToken which is completed with
+* XZDma_CopyPoll() or XZDma_CopyWait(). XZDma_CopyRegisterMemCpy() routes
+* Xil_MemCpy() calls above a size threshold to the service. The service
+* polls the channel status, so its channels should not be used by anything
+* else nor have XZDma_IntrHandler connected.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -129,6 +141,10 @@
 * 1.5   adk     11/22/17 Added peripheral test app support for ZDMA driver.
 *		12/11/17 Fixed peripheral test app generation issues when dma
 *			 buffers are configured on OCM memory(CR#990806).
+* 1.5   ag      10/14/26 Added the asynchronous copy service in xzdma_copy.c,
+*			 which uses several ZDMA channels as a pool for copy,
+*			 fill and scatter list operations and can serve large
+*			 Xil_MemCpy() calls.
 * </pre>
 *
 ******************************************************************************/
@@ -149,6 +165,10 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+#define XZDMA_COPY_MAX_CHANNELS		(8U)	/**< Channels per ZDMA */
+#define XZDMA_COPY_SPLIT_SIZE		(0x10000U) /**< Default minimum bytes
+						     *  per channel */
+#define XZDMA_COPY_ALIGN		(64U)	/**< Split granularity */
 
 /**************************** Type Definitions *******************************/
 
@@ -365,6 +385,34 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/******************************************************************************/
+/**
+*
+* This typedef tracks one operation of the copy service. It is filled in when
+* the operation is started and must be kept until XZDma_CopyPoll() reports
+* completion.
+*/
+typedef struct {
+	u32 ChanMask;		/**< Channels still working on the operation */
+	u32 ErrorMask;		/**< Channels that completed with errors */
+	XZDma_Transfer *List;	/**< Destinations to invalidate on completion */
+	u32 Num;		/**< Number of entries in List */
+	XZDma_Transfer Local;	/**< List storage for copy and fill */
+} XZDma_CopyToken;
+
+/******************************************************************************/
+/**
+*
+* The copy service instance data structure.
+*/
+typedef struct {
+	XZDma *Chan[XZDMA_COPY_MAX_CHANNELS];	/**< Pooled channels */
+	u32 NumChannels;		/**< Number of pooled channels */
+	u32 BusyMask;			/**< Channels with an operation */
+	u32 SplitSize;			/**< Minimum bytes per channel when
+					  *  a copy is split */
+} XZDma_CopySvc;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -698,6 +746,17 @@ XZDmaState XZDma_ChannelState(XZDma *InstancePtr);
 
 s32 XZDma_SelfTest(XZDma *InstancePtr);
 
+s32 XZDma_CopyInitialize(XZDma_CopySvc *SvcPtr, XZDma **ChanPtr, u32 Num);
+s32 XZDma_CopyStart(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size);
+s32 XZDma_CopyFill(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			UINTPTR DstAddr, u32 Pattern, u32 Size);
+s32 XZDma_CopyScatter(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			XZDma_Transfer *List, u32 Num);
+s32 XZDma_CopyPoll(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr);
+s32 XZDma_CopyWait(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr);
+void XZDma_CopyRegisterMemCpy(XZDma_CopySvc *SvcPtr, u32 Threshold);
+
 void XZDma_IntrHandler(void *Instance);
 s32 XZDma_SetCallBack(XZDma *InstancePtr, XZDma_Handler HandlerType,
 	void *CallBackFunc, void *CallBackRef);
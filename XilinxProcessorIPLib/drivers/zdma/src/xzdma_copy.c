@@ -0,0 +1,643 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+/*****************************************************************************/
+/**
+*
+* @file xzdma_copy.c
+* @addtogroup zdma_v1_5
+* @{
+*
+* This file contains the copy service of the ZDMA driver. The service pools
+* the channels of a ZDMA core and runs memory copy, fill and scatter list
+* operations on them asynchronously. Please see xzdma.h for more details of
+* the driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.5   ag      10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+#include "xil_mem.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Errors that stop a channel, they complete the channel like done does */
+#define XZDMA_COPY_ERR_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+				 XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XZDma_CopyFreeMask(SvcPtr) \
+	((((u32)1U << (SvcPtr)->NumChannels) - 1U) & (~(SvcPtr)->BusyMask))
+
+#define XZDma_CopyIsCoherent(SvcPtr) \
+	((SvcPtr)->Chan[0]->Config.IsCacheCoherent != 0U)
+
+/************************** Function Prototypes ******************************/
+
+static u32 XZDma_CopyBitCount(u32 Mask);
+static s32 XZDma_CopyKick(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			u32 Index, u8 IsSgDma, XZDma_Mode Mode,
+			XZDma_Transfer *Data, u32 Num, u32 *Pattern);
+static s32 XZDma_CopyLinear(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size,
+			u32 *Pattern);
+static s32 XZDma_MemCpyHandler(void *Dst, const void *Src, u32 Cnt);
+
+/************************** Variable Definitions *****************************/
+
+static XZDma_CopySvc *MemCpySvcPtr = NULL;
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a copy service on a set of ZDMA channels.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	ChanPtr is an array of pointers to the channels to pool. Each
+*		channel must have been initialized with XZDma_CfgInitialize()
+*		and all of them must belong to the same ZDMA core. Channels
+*		used for scatter lists also need descriptor memory set up
+*		with XZDma_CreateBDList().
+* @param	Num is the number of channels in ChanPtr, 1 to
+*		XZDMA_COPY_MAX_CHANNELS.
+*
+* @return
+*		- XST_SUCCESS if the service was initialized.
+*
+* @note		The channels must not be used directly while they are part of
+*		the service.
+*
+******************************************************************************/
+s32 XZDma_CopyInitialize(XZDma_CopySvc *SvcPtr, XZDma **ChanPtr, u32 Num)
+{
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(ChanPtr != NULL);
+	Xil_AssertNonvoid((Num != 0x00U) && (Num <= XZDMA_COPY_MAX_CHANNELS));
+
+	for (Index = 0U; Index < Num; Index++) {
+		Xil_AssertNonvoid(ChanPtr[Index] != NULL);
+		Xil_AssertNonvoid(ChanPtr[Index]->IsReady ==
+					(u32)(XIL_COMPONENT_IS_READY));
+		SvcPtr->Chan[Index] = ChanPtr[Index];
+	}
+
+	SvcPtr->NumChannels = Num;
+	SvcPtr->BusyMask = 0x00U;
+	SvcPtr->SplitSize = XZDMA_COPY_SPLIT_SIZE;
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts an asynchronous memory copy. Copies of at least twice
+* SplitSize bytes are split across the idle channels of the service.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	TokenPtr is a pointer to the token tracking the copy.
+* @param	DstAddr is the destination address.
+* @param	SrcAddr is the source address.
+* @param	Size is the number of bytes to copy.
+*
+* @return
+*		- XST_SUCCESS if the copy has been started.
+*		- XST_DEVICE_BUSY if no channel is idle.
+*		- XST_FAILURE if the copy could not be started.
+*
+* @note		Source and destination are cleaned from the data cache before
+*		the transfer and the destination is invalidated again when
+*		XZDma_CopyPoll() reports completion, so neither buffer should
+*		be touched by the CPU until then.
+*
+******************************************************************************/
+s32 XZDma_CopyStart(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(TokenPtr != NULL);
+	Xil_AssertNonvoid(Size != 0x00U);
+
+	return XZDma_CopyLinear(SvcPtr, TokenPtr, DstAddr, SrcAddr, Size, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts an asynchronous fill of a memory region with a 32 bit
+* pattern using the write only mode of the channels. Large fills are split
+* across the idle channels like copies are.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	TokenPtr is a pointer to the token tracking the fill.
+* @param	DstAddr is the address of the region to fill.
+* @param	Pattern is the 32 bit pattern to write.
+* @param	Size is the number of bytes to fill. It should be a multiple
+*		of the write only data width, 16 bytes for GDMA and 8 bytes
+*		for ADMA.
+*
+* @return
+*		- XST_SUCCESS if the fill has been started.
+*		- XST_DEVICE_BUSY if no channel is idle.
+*		- XST_FAILURE if the fill could not be started.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_CopyFill(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			UINTPTR DstAddr, u32 Pattern, u32 Size)
+{
+	u32 Data[4];
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(TokenPtr != NULL);
+	Xil_AssertNonvoid(Size != 0x00U);
+
+	Data[0] = Pattern;
+	Data[1] = Pattern;
+	Data[2] = Pattern;
+	Data[3] = Pattern;
+
+	return XZDma_CopyLinear(SvcPtr, TokenPtr, DstAddr, 0U, Size, Data);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts an asynchronous scatter gather copy. The list is cut
+* into contiguous slices, one per idle channel, and each slice runs from the
+* descriptor memory of its channel.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	TokenPtr is a pointer to the token tracking the copy.
+* @param	List is an array of transfers. Only SrcAddr, DstAddr and Size
+*		are used. It must be kept until the copy has completed.
+* @param	Num is the number of transfers in List.
+*
+* @return
+*		- XST_SUCCESS if the copy has been started.
+*		- XST_DEVICE_BUSY if no channel is idle.
+*		- XST_FAILURE if a slice does not fit the descriptor memory of
+*		its channel or could not be started.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_CopyScatter(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			XZDma_Transfer *List, u32 Num)
+{
+	XZDma *InstancePtr;
+	u32 FreeMask;
+	u32 Parts;
+	u32 Base = 0x00U;
+	u32 Cnt;
+	u32 Index;
+	u8 Coherent;
+	s32 Status = XST_SUCCESS;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(TokenPtr != NULL);
+	Xil_AssertNonvoid(List != NULL);
+	Xil_AssertNonvoid(Num != 0x00U);
+
+	FreeMask = XZDma_CopyFreeMask(SvcPtr);
+	if (FreeMask == 0x00U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	Parts = XZDma_CopyBitCount(FreeMask);
+	if (Parts > Num) {
+		Parts = Num;
+	}
+
+	Coherent = (u8)XZDma_CopyIsCoherent(SvcPtr);
+	for (Index = 0U; Index < Num; Index++) {
+		List[Index].SrcCoherent = Coherent;
+		List[Index].DstCoherent = Coherent;
+		List[Index].Pause = FALSE;
+		if (Coherent == 0U) {
+			Xil_DCacheFlushRange(List[Index].SrcAddr,
+						List[Index].Size);
+			Xil_DCacheFlushRange(List[Index].DstAddr,
+						List[Index].Size);
+		}
+	}
+
+	TokenPtr->ChanMask = 0x00U;
+	TokenPtr->ErrorMask = 0x00U;
+	TokenPtr->List = List;
+	TokenPtr->Num = Num;
+
+	for (Index = 0U; (Parts != 0x00U) && (Status == XST_SUCCESS);
+							Index++) {
+		if ((FreeMask & ((u32)1U << Index)) == 0x00U) {
+			continue;
+		}
+
+		InstancePtr = SvcPtr->Chan[Index];
+		Cnt = (Num - Base) / Parts;
+
+		if (Cnt == 1U) {
+			Status = XZDma_CopyKick(SvcPtr, TokenPtr, Index, FALSE,
+					XZDMA_NORMAL_MODE, &List[Base], 1U,
+					NULL);
+		}
+		else if ((InstancePtr->Descriptor.SrcDscrPtr == NULL) ||
+			(Cnt > InstancePtr->Descriptor.DscrCount)) {
+			Status = XST_FAILURE;
+		}
+		else {
+			Status = XZDma_CopyKick(SvcPtr, TokenPtr, Index, TRUE,
+					XZDMA_NORMAL_MODE, &List[Base], Cnt,
+					NULL);
+		}
+
+		Base += Cnt;
+		Parts--;
+	}
+
+	if ((Status != XST_SUCCESS) && (TokenPtr->ChanMask != 0x00U)) {
+		(void)XZDma_CopyWait(SvcPtr, TokenPtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks whether an operation of the copy service has
+* completed. The channels that finished are returned to the pool and, once
+* all of them have, the destination buffers are invalidated from the data
+* cache.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	TokenPtr is a pointer to the token of the operation.
+*
+* @return
+*		- XST_SUCCESS if the operation has completed.
+*		- XST_DEVICE_BUSY if the operation is still running.
+*		- XST_FAILURE if the operation completed with errors.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_CopyPoll(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr)
+{
+	XZDma *InstancePtr;
+	u32 Pending;
+	u32 Status;
+	u32 Mask;
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(TokenPtr != NULL);
+
+	if (TokenPtr->ChanMask == 0x00U) {
+		goto Done;
+	}
+
+	Pending = TokenPtr->ChanMask;
+	for (Index = 0U; Pending != 0x00U; Index++, Pending >>= 1U) {
+		if ((Pending & 1U) == 0x00U) {
+			continue;
+		}
+
+		InstancePtr = SvcPtr->Chan[Index];
+		Status = XZDma_IntrGetStatus(InstancePtr);
+		if ((Status & (XZDMA_IXR_DMA_DONE_MASK |
+				XZDMA_COPY_ERR_MASK)) == 0x00U) {
+			continue;
+		}
+
+		Mask = (u32)1U << Index;
+		if ((Status & XZDMA_COPY_ERR_MASK) != 0x00U) {
+			TokenPtr->ErrorMask |= Mask;
+		}
+		XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+		InstancePtr->ChannelState = XZDMA_IDLE;
+		TokenPtr->ChanMask &= ~Mask;
+		SvcPtr->BusyMask &= ~Mask;
+	}
+
+	if (TokenPtr->ChanMask != 0x00U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (!XZDma_CopyIsCoherent(SvcPtr)) {
+		for (Index = 0U; Index < TokenPtr->Num; Index++) {
+			Xil_DCacheInvalidateRange(TokenPtr->List[Index].DstAddr,
+					TokenPtr->List[Index].Size);
+		}
+	}
+
+Done:
+	return (TokenPtr->ErrorMask != 0x00U) ? XST_FAILURE : XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for an operation of the copy service to complete.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	TokenPtr is a pointer to the token of the operation.
+*
+* @return
+*		- XST_SUCCESS if the operation has completed.
+*		- XST_FAILURE if the operation completed with errors.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_CopyWait(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr)
+{
+	s32 Status;
+
+	do {
+		Status = XZDma_CopyPoll(SvcPtr, TokenPtr);
+	} while (Status == XST_DEVICE_BUSY);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function routes Xil_MemCpy() calls of at least Threshold bytes to a
+* copy service. The call waits for the copy to complete and falls back to the
+* CPU copy whenever the service has no idle channel or the copy fails.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance, NULL to
+*		stop routing Xil_MemCpy() calls.
+* @param	Threshold is the minimum copy length in bytes to offload.
+*
+* @return	None.
+*
+* @note		Xil_MemCpy() must then not be called concurrently from
+*		interrupt context and thread context, as the service is not
+*		reentrant.
+*
+******************************************************************************/
+void XZDma_CopyRegisterMemCpy(XZDma_CopySvc *SvcPtr, u32 Threshold)
+{
+	if (SvcPtr == NULL) {
+		Xil_MemCpySetHandler(NULL, 0U);
+		MemCpySvcPtr = NULL;
+	}
+	else {
+		MemCpySvcPtr = SvcPtr;
+		Xil_MemCpySetHandler(XZDma_MemCpyHandler, Threshold);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function is the Xil_MemCpy() offload handler.
+*
+* @param	Dst is the destination buffer.
+* @param	Src is the source buffer.
+* @param	Cnt is the number of bytes to copy.
+*
+* @return	0 if the copy was done by ZDMA, non-zero to make Xil_MemCpy()
+*		copy with the CPU.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XZDma_MemCpyHandler(void *Dst, const void *Src, u32 Cnt)
+{
+	XZDma_CopyToken Token;
+	s32 Status;
+
+	Status = XZDma_CopyStart(MemCpySvcPtr, &Token, (UINTPTR)Dst,
+					(UINTPTR)Src, Cnt);
+	if (Status == XST_SUCCESS) {
+		Status = XZDma_CopyWait(MemCpySvcPtr, &Token);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function starts a copy or a fill on the idle channels.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	TokenPtr is a pointer to the token of the operation.
+* @param	DstAddr is the destination address.
+* @param	SrcAddr is the source address, unused for a fill.
+* @param	Size is the number of bytes to transfer.
+* @param	Pattern points to the write only data for a fill, NULL for
+*		a copy.
+*
+* @return
+*		- XST_SUCCESS if the operation has been started.
+*		- XST_DEVICE_BUSY if no channel is idle.
+*		- XST_FAILURE if the operation could not be started.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XZDma_CopyLinear(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size,
+			u32 *Pattern)
+{
+	XZDma_Transfer Data;
+	XZDma_Mode Mode;
+	u32 FreeMask;
+	u32 Parts;
+	u32 Chunk;
+	u32 Index;
+	s32 Status = XST_SUCCESS;
+
+	FreeMask = XZDma_CopyFreeMask(SvcPtr);
+	if (FreeMask == 0x00U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	Parts = Size / SvcPtr->SplitSize;
+	if (Parts == 0x00U) {
+		Parts = 1U;
+	}
+	if (Parts > XZDma_CopyBitCount(FreeMask)) {
+		Parts = XZDma_CopyBitCount(FreeMask);
+	}
+
+	Chunk = (Size / Parts) + ((Size % Parts) != 0x00U ? 1U : 0U);
+	Chunk = (Chunk + (XZDMA_COPY_ALIGN - 1U)) & ~(XZDMA_COPY_ALIGN - 1U);
+	if ((Chunk == 0x00U) || (Chunk > XZDMA_WORD2_SIZE_MASK)) {
+		return XST_FAILURE;
+	}
+
+	Data.SrcCoherent = (u8)XZDma_CopyIsCoherent(SvcPtr);
+	Data.DstCoherent = Data.SrcCoherent;
+	Data.Pause = FALSE;
+
+	if (Data.SrcCoherent == 0U) {
+		if (Pattern == NULL) {
+			Xil_DCacheFlushRange(SrcAddr, Size);
+		}
+		Xil_DCacheFlushRange(DstAddr, Size);
+	}
+
+	Mode = (Pattern == NULL) ? XZDMA_NORMAL_MODE : XZDMA_WRONLY_MODE;
+
+	TokenPtr->ChanMask = 0x00U;
+	TokenPtr->ErrorMask = 0x00U;
+	TokenPtr->Local.DstAddr = DstAddr;
+	TokenPtr->Local.Size = Size;
+	TokenPtr->List = &TokenPtr->Local;
+	TokenPtr->Num = 1U;
+
+	for (Index = 0U; (Size != 0x00U) && (Status == XST_SUCCESS); Index++) {
+		if ((FreeMask & ((u32)1U << Index)) == 0x00U) {
+			continue;
+		}
+
+		Data.SrcAddr = SrcAddr;
+		Data.DstAddr = DstAddr;
+		Data.Size = (Size < Chunk) ? Size : Chunk;
+
+		Status = XZDma_CopyKick(SvcPtr, TokenPtr, Index, FALSE, Mode,
+					&Data, 1U, Pattern);
+
+		if (Pattern == NULL) {
+			SrcAddr += Data.Size;
+		}
+		DstAddr += Data.Size;
+		Size -= Data.Size;
+	}
+
+	if ((Status != XST_SUCCESS) && (TokenPtr->ChanMask != 0x00U)) {
+		(void)XZDma_CopyWait(SvcPtr, TokenPtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function programs one channel of the service and starts it.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	TokenPtr is a pointer to the token of the operation.
+* @param	Index is the channel index in the service.
+* @param	IsSgDma selects scatter gather (TRUE) or simple (FALSE) mode.
+* @param	Mode is the ZDMA operation mode.
+* @param	Data is the array of transfers for the channel.
+* @param	Num is the number of transfers in Data.
+* @param	Pattern is the write only data, NULL if unused.
+*
+* @return
+*		- XST_SUCCESS if the channel has been started.
+*		- XST_FAILURE if the channel could not be started.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XZDma_CopyKick(XZDma_CopySvc *SvcPtr, XZDma_CopyToken *TokenPtr,
+			u32 Index, u8 IsSgDma, XZDma_Mode Mode,
+			XZDma_Transfer *Data, u32 Num, u32 *Pattern)
+{
+	XZDma *InstancePtr = SvcPtr->Chan[Index];
+	s32 Status;
+
+	Status = XZDma_SetMode(InstancePtr, IsSgDma, Mode);
+	if (Status != XST_SUCCESS) {
+		goto End;
+	}
+
+	if (Pattern != NULL) {
+		XZDma_WOData(InstancePtr, Pattern);
+	}
+
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+
+	Status = XZDma_Start(InstancePtr, Data, Num);
+	if (Status != XST_SUCCESS) {
+		goto End;
+	}
+
+	SvcPtr->BusyMask |= (u32)1U << Index;
+	TokenPtr->ChanMask |= (u32)1U << Index;
+
+End:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function counts the bits set in a channel mask.
+*
+* @param	Mask is the channel mask.
+*
+* @return	Number of bits set in Mask.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XZDma_CopyBitCount(u32 Mask)
+{
+	u32 Count = 0x00U;
+	u32 Value = Mask;
+
+	while (Value != 0x00U) {
+		Value &= (Value - 1U);
+		Count++;
+	}
+
+	return Count;
+}
+/** @} */
@@ -51,6 +51,15 @@
 # 6.6   mus  02/23/18 Export macro for the debug logic configuration in
 # 		      Cortex R5 BSP, macro value is based on the
 #		      mld parameter "lockstep_mode_debug".
+# 6.6   ag   10/14/26 Export the buffered console configuration based on the
+#                     mld parameters "console_buffer_size" and
+#                     "console_noblock".
+#       ag   10/14/26 Export XIL_TRACE_BUFSIZE based on the mld parameter
+#                     "trace_buffer_size".
+#       ag   10/14/26 Export XIL_ARENA_DMA_SIZE based on the mld parameter
+#                     "dma_arena_size".
+#       ag   10/14/26 Export XIL_IO_PROFILE_SIZE based on the mld parameter
+#                     "io_profile_size".
 #
 ##############################################################################
 
@@ -565,7 +574,46 @@ proc generate {os_handle} {
 	 } else {
 		puts $file_handle "#define LOCKSTEP_MODE_DEBUG 0U"
 	 }
+	 set tcm_isr [common::get_property CONFIG.tcm_isr_placement $os_handle]
+	 puts $file_handle " "
+	 puts $file_handle "/* Definitions for placement of driver interrupt paths in TCM */"
+	 if { $tcm_isr == "true" } {
+		puts $file_handle "#define XIL_TCM_ISR_PLACEMENT 1U"
+	 } else {
+		puts $file_handle "#define XIL_TCM_ISR_PLACEMENT 0U"
+	 }
      }
+	 set console_bufsize [common::get_property CONFIG.console_buffer_size $os_handle]
+	 set console_noblock [common::get_property CONFIG.console_noblock $os_handle]
+	 if { $console_bufsize != 0 && ($console_bufsize & ($console_bufsize - 1)) != 0 } {
+		error "ERROR: console_buffer_size $console_bufsize is not a power of two"
+	 }
+	 puts $file_handle " "
+	 puts $file_handle "/* Definitions for buffered console configuration */"
+	 puts $file_handle "#define XIL_CONSOLE_BUFSIZE ${console_bufsize}U"
+	 if { $console_noblock == "true" } {
+		puts $file_handle "#define XIL_CONSOLE_NOBLOCK 1U"
+	 } else {
+		puts $file_handle "#define XIL_CONSOLE_NOBLOCK 0U"
+	 }
+	 set trace_bufsize [common::get_property CONFIG.trace_buffer_size $os_handle]
+	 if { $trace_bufsize != 0 && ($trace_bufsize & ($trace_bufsize - 1)) != 0 } {
+		error "ERROR: trace_buffer_size $trace_bufsize is not a power of two"
+	 }
+	 puts $file_handle " "
+	 puts $file_handle "/* Definitions for binary trace configuration */"
+	 puts $file_handle "#define XIL_TRACE_BUFSIZE ${trace_bufsize}U"
+	 set io_profile_size [common::get_property CONFIG.io_profile_size $os_handle]
+	 if { $io_profile_size != 0 && ($io_profile_size & ($io_profile_size - 1)) != 0 } {
+		error "ERROR: io_profile_size $io_profile_size is not a power of two"
+	 }
+	 puts $file_handle " "
+	 puts $file_handle "/* Definitions for register access profile configuration */"
+	 puts $file_handle "#define XIL_IO_PROFILE_SIZE ${io_profile_size}U"
+	 set dma_arena_size [common::get_property CONFIG.dma_arena_size $os_handle]
+	 puts $file_handle " "
+	 puts $file_handle "/* Definitions for memory arena configuration */"
+	 puts $file_handle "#define XIL_ARENA_DMA_SIZE ${dma_arena_size}U"
 	 puts $file_handle " "
 	 puts $file_handle "/* Definitions for sleep timer configuration */"
 	 xsleep_timer_config $proctype $os_handle $file_handle
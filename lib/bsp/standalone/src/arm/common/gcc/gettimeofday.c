@@ -0,0 +1,79 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#include <sys/time.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xil_timeline.h"
+
+static Xil_TimeOfDayHook TimeOfDayHook = NULL;
+static void *TimeOfDayHookRef = NULL;
+
+#ifdef __cplusplus
+extern "C" {
+	__attribute__((weak)) s32 _gettimeofday(struct timeval *tv, void *tz);
+}
+#endif
+
+/*
+ * Xil_SetTimeOfDayHook -- set the time source of gettimeofday, e.g. the RTC
+ *          time service of the rtcpsu driver. NULL removes it.
+ */
+void Xil_SetTimeOfDayHook(Xil_TimeOfDayHook Hook, void *CallBackRef)
+{
+	/* Never call a hook with the reference of another one */
+	TimeOfDayHook = NULL;
+	TimeOfDayHookRef = CallBackRef;
+	TimeOfDayHook = Hook;
+}
+
+/*
+ * _gettimeofday -- time of day from the hook. Without one there is no
+ *          wall clock, so return an error.
+ */
+__attribute__((weak)) s32 _gettimeofday(struct timeval *tv, void *tz)
+{
+	Xil_TimeOfDayHook Hook = TimeOfDayHook;
+	u32 Sec;
+	u32 USec;
+
+	(void)tz;
+	if ((Hook == NULL) || (tv == NULL) ||
+		(Hook(TimeOfDayHookRef, &Sec, &USec) != (s32)XST_SUCCESS)) {
+		return -1;
+	}
+
+	tv->tv_sec = (time_t)Sec;
+	tv->tv_usec = (suseconds_t)USec;
+
+	return 0;
+}
@@ -44,6 +44,7 @@
 * ----- -------- -------- -----------------------------------------------
 * 5.00 	pkp		 05/21/14 First release
 * 6.0   mus      07/27/16 Consolidated file for a53,a9 and r5 processors
+* 6.6   ag       10/14/26 Added mtcptlbiva for TLB invalidation by address
 * </pre>
 *
 ******************************************************************************/
@@ -213,6 +214,7 @@ extern "C" {
 
 #define mtcpicall(reg)	__asm__ __volatile__("ic " #reg)
 #define mtcptlbi(reg)	__asm__ __volatile__("tlbi " #reg)
+#define mtcptlbiva(reg,val)	__asm__ __volatile__("tlbi " #reg ",%0"  : : "r" (val))
 #define mtcpat(reg,val)	__asm__ __volatile__("at " #reg ",%0"  : : "r" (val))
 /* CP15 operations */
 #define mfcp(reg)	({u64 rval = 0U;\
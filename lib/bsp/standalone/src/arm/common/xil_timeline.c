@@ -0,0 +1,666 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_timeline.c
+*
+* This file provides the timeline service: the software extension of the TTC
+* timestamp and the hierarchical timer wheel. See xil_timeline.h for a
+* description of the service.
+*
+* <pre>
+* MODIFICATION HISTORY :
+*
+* Ver   Who  Date	 Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.6	ag   10/14/26 First Release.
+*       ag   10/14/26 Added Xil_TimerWheelSleepHook.
+*
+* </pre>
+*****************************************************************************/
+
+/****************************  Include Files  ********************************/
+
+#include "xil_timeline.h"
+#include "xil_assert.h"
+#include "xil_exception.h"
+
+/****************************  Constant Definitions  *************************/
+
+#define XIL_TIMERWHEEL_SLOT_MASK	(XIL_TIMERWHEEL_SLOTS - 1U)
+#define XIL_TIMERWHEEL_OVERFLOW		((u8)XIL_TIMERWHEEL_LEVELS)
+					/* Level value of overflow timers */
+#define XIL_TIMERWHEEL_RANGE_BITS	(XIL_TIMERWHEEL_LEVELS * \
+					 XIL_TIMERWHEEL_SLOT_BITS)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* Shift of the slot index of a level in a tick */
+#define Xil_TimerWheelShift(Level)	((Level) * XIL_TIMERWHEEL_SLOT_BITS)
+
+/* Slot index of a tick in a level */
+#define Xil_TimerWheelIndex(Tick, Level) \
+	((u32)((Tick) >> Xil_TimerWheelShift(Level)) & XIL_TIMERWHEEL_SLOT_MASK)
+
+/* Occupied slots of a level after the slot Index */
+#define Xil_TimerWheelAfter(Bits, Index) \
+	((Bits) & ~(((u64)2U << (Index)) - 1U))
+
+/* Non zero if no timer is linked in the wheel */
+#define Xil_TimerWheelIsEmpty(Wheel) \
+	((((Wheel)->Occupied[0] | (Wheel)->Occupied[1] | \
+	   (Wheel)->Occupied[2] | (Wheel)->Occupied[3]) == 0U) && \
+	 ((Wheel)->Overflow == NULL) ? 1U : 0U)
+
+/* Wait for an interrupt */
+#if defined (__GNUC__)
+#define Xil_TimelineWaitForInterrupt() \
+	__asm__ __volatile__ ("dsb sy\n\twfi" : : : "memory")
+#else
+#define Xil_TimelineWaitForInterrupt()
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#if defined (SLEEP_TIMER_BASEADDR)
+u64 Xil_TimelineHigh;		/* Upper bits of the TTC timestamp */
+XCntrVal Xil_TimelineLast;	/* Last TTC counter value */
+#endif
+
+/************************** Function Prototypes ******************************/
+
+static void Xil_TimerWheelInsert(Xil_TimerWheel *Wheel, Xil_Timer *Timer);
+static void Xil_TimerWheelUnlink(Xil_TimerWheel *Wheel, Xil_Timer *Timer);
+static void Xil_TimerWheelCascade(Xil_TimerWheel *Wheel, u32 Level);
+static void Xil_TimerWheelAdvance(Xil_TimerWheel *Wheel, u64 Target);
+static void Xil_TimerWheelRearm(Xil_TimerWheel *Wheel);
+static u64 Xil_TimerWheelNextTick(Xil_TimerWheel *Wheel);
+static void Xil_TimerWheelWake(void *CallBackRef);
+
+/****************************************************************************/
+/**
+*
+* Initialize the timeline. It starts the sleep timer TTC if it is used for the
+* timestamp and takes the first reading.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		The global and generic timers are started by the BSP.
+*
+*****************************************************************************/
+void Xil_TimelineInit(void)
+{
+#if defined (SLEEP_TIMER_BASEADDR)
+	XTime_StartTTCTimer();
+	Xil_TimelineHigh = 0U;
+	Xil_TimelineLast = 0U;
+#endif
+	(void)Xil_TimelineNow();
+}
+
+/****************************************************************************/
+/**
+*
+* Initialize a timer wheel.
+*
+* @param	Wheel is a pointer to the timer wheel.
+* @param	TickShift is log2 of the number of timeline counts per tick of
+*		the wheel, which sets the resolution of the software timers.
+* @param	ArmHandler is the handler which programs the hardware timer
+*		for the next expiry, or NULL for a polled wheel.
+* @param	ArmRef is the reference passed to ArmHandler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void Xil_TimerWheelInit(Xil_TimerWheel *Wheel, u32 TickShift,
+			Xil_TimerArmHandler ArmHandler, void *ArmRef)
+{
+	u32 Level;
+	u32 Slot;
+
+	Xil_AssertVoid(Wheel != NULL);
+	Xil_AssertVoid(TickShift < 32U);
+
+	for (Level = 0U; Level < XIL_TIMERWHEEL_LEVELS; Level++) {
+		for (Slot = 0U; Slot < XIL_TIMERWHEEL_SLOTS; Slot++) {
+			Wheel->Slots[Level][Slot] = NULL;
+		}
+		Wheel->Occupied[Level] = 0U;
+	}
+	Wheel->Overflow = NULL;
+	Wheel->TickShift = TickShift;
+	Wheel->Tick = Xil_TimelineNow() >> TickShift;
+	Wheel->Armed = XIL_TIMELINE_NEVER;
+	Wheel->ArmHandler = ArmHandler;
+	Wheel->ArmRef = ArmRef;
+}
+
+/****************************************************************************/
+/**
+*
+* Initialize a software timer.
+*
+* @param	Timer is a pointer to the timer.
+* @param	Handler is the function called when the timer expires.
+* @param	CallBackRef is the reference passed to Handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void Xil_TimerInit(Xil_Timer *Timer, Xil_TimerHandler Handler,
+			void *CallBackRef)
+{
+	Xil_AssertVoid(Timer != NULL);
+	Xil_AssertVoid(Handler != NULL);
+
+	Timer->Next = NULL;
+	Timer->Prev = NULL;
+	Timer->Expires = 0U;
+	Timer->Period = 0U;
+	Timer->Handler = Handler;
+	Timer->CallBackRef = CallBackRef;
+	Timer->IsActive = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* Start a software timer. A running timer is restarted.
+*
+* @param	Wheel is a pointer to the timer wheel.
+* @param	Timer is a pointer to an initialized timer.
+* @param	Delay is the time to the first expiry, in timeline counts. It
+*		is rounded up to the wheel tick.
+* @param	Period is the period in timeline counts for a periodic timer,
+*		or 0 for a one-shot timer. It is rounded down to the wheel
+*		tick, with a minimum of one tick.
+*
+* @return	None.
+*
+* @note		The hardware timer is re-armed if this timer expires first.
+*
+*****************************************************************************/
+void Xil_TimerStart(Xil_TimerWheel *Wheel, Xil_Timer *Timer, u64 Delay,
+			u64 Period)
+{
+	u64 Now;
+	u64 Round;
+
+	Xil_AssertVoid(Wheel != NULL);
+	Xil_AssertVoid(Timer != NULL);
+	Xil_AssertVoid(Timer->Handler != NULL);
+
+	if (Timer->IsActive != 0U) {
+		Xil_TimerWheelUnlink(Wheel, Timer);
+	}
+
+	Now = Xil_TimelineNow();
+
+	/* An idle wheel may be far behind, move it to the current time */
+	if (Xil_TimerWheelIsEmpty(Wheel) != 0U) {
+		Wheel->Tick = Now >> Wheel->TickShift;
+	}
+
+	Round = ((u64)1U << Wheel->TickShift) - 1U;
+	Timer->Expires = (Now + Delay + Round) >> Wheel->TickShift;
+	if (Timer->Expires <= Wheel->Tick) {
+		Timer->Expires = Wheel->Tick + 1U;
+	}
+
+	Timer->Period = Period >> Wheel->TickShift;
+	if ((Period != 0U) && (Timer->Period == 0U)) {
+		Timer->Period = 1U;
+	}
+
+	Xil_TimerWheelInsert(Wheel, Timer);
+
+	if (Timer->Expires < Wheel->Armed) {
+		Xil_TimerWheelRearm(Wheel);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Stop a software timer. Stopping a timer which is not running has no effect.
+*
+* @param	Wheel is a pointer to the timer wheel.
+* @param	Timer is a pointer to the timer.
+*
+* @return	None.
+*
+* @note		The hardware timer is left armed; the next Xil_TimerWheelRun()
+*		re-arms it for the remaining timers.
+*
+*****************************************************************************/
+void Xil_TimerStop(Xil_TimerWheel *Wheel, Xil_Timer *Timer)
+{
+	Xil_AssertVoid(Wheel != NULL);
+	Xil_AssertVoid(Timer != NULL);
+
+	if (Timer->IsActive != 0U) {
+		Xil_TimerWheelUnlink(Wheel, Timer);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Advance the timer wheel to the current time, call the handlers of the
+* expired timers, restart the periodic ones and re-arm the hardware timer for
+* the next expiry. This is called from the interrupt handler of the hardware
+* timer, or periodically for a polled wheel.
+*
+* @param	Wheel is a pointer to the timer wheel.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void Xil_TimerWheelRun(Xil_TimerWheel *Wheel)
+{
+	Xil_AssertVoid(Wheel != NULL);
+
+	Xil_TimerWheelAdvance(Wheel, Xil_TimelineNow() >> Wheel->TickShift);
+	Xil_TimerWheelRearm(Wheel);
+}
+
+/****************************************************************************/
+/**
+*
+* Get the time the wheel must next be run at.
+*
+* @param	Wheel is a pointer to the timer wheel.
+*
+* @return	The timeline count of the next expiry or cascade of the wheel,
+*		or XIL_TIMELINE_NEVER if no timer is running.
+*
+* @note		Timers in the upper levels are reported at the start of their
+*		slot, when they are cascaded, so the result may be earlier
+*		than the first timer expiry.
+*
+*****************************************************************************/
+u64 Xil_TimerWheelNextExpiry(Xil_TimerWheel *Wheel)
+{
+	u64 Next;
+
+	Xil_AssertNonvoid(Wheel != NULL);
+
+	Next = Xil_TimerWheelNextTick(Wheel);
+	if (Next != XIL_TIMELINE_NEVER) {
+		Next <<= Wheel->TickShift;
+	}
+
+	return Next;
+}
+
+/****************************************************************************/
+/**
+*
+* Get the next tick at which the wheel has a timer to expire or a slot to
+* cascade. Every tick before it can be skipped.
+*
+* @param	Wheel is a pointer to the timer wheel.
+*
+* @return	The tick, or XIL_TIMELINE_NEVER if no timer is running.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u64 Xil_TimerWheelNextTick(Xil_TimerWheel *Wheel)
+{
+	u64 Next = XIL_TIMELINE_NEVER;
+	u64 Candidate;
+	u64 Rest;
+	u32 Level;
+	u32 Shift;
+
+	for (Level = 0U; Level < XIL_TIMERWHEEL_LEVELS; Level++) {
+		Rest = Xil_TimerWheelAfter(Wheel->Occupied[Level],
+				Xil_TimerWheelIndex(Wheel->Tick, Level));
+		if (Rest != 0U) {
+			Shift = Xil_TimerWheelShift(Level);
+			Candidate = ((Wheel->Tick >>
+					(Shift + XIL_TIMERWHEEL_SLOT_BITS)) <<
+					(Shift + XIL_TIMERWHEEL_SLOT_BITS)) |
+				((u64)__builtin_ctzll(Rest) << Shift);
+			if (Candidate < Next) {
+				Next = Candidate;
+			}
+		}
+	}
+
+	if (Wheel->Overflow != NULL) {
+		Candidate = ((Wheel->Tick >> XIL_TIMERWHEEL_RANGE_BITS) + 1U) <<
+				XIL_TIMERWHEEL_RANGE_BITS;
+		if (Candidate < Next) {
+			Next = Candidate;
+		}
+	}
+
+	return Next;
+}
+
+/****************************************************************************/
+/**
+*
+* Link a timer in the slot matching its expiry. The level is the lowest one
+* whose slot range holds both the current tick and the expiry.
+*
+* @param	Wheel is a pointer to the timer wheel.
+* @param	Timer is a pointer to the timer.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void Xil_TimerWheelInsert(Xil_TimerWheel *Wheel, Xil_Timer *Timer)
+{
+	Xil_Timer **HeadPtr;
+	u32 Level;
+	u32 Slot = 0U;
+
+	for (Level = 0U; Level < XIL_TIMERWHEEL_LEVELS; Level++) {
+		if ((Timer->Expires >> Xil_TimerWheelShift(Level + 1U)) ==
+			(Wheel->Tick >> Xil_TimerWheelShift(Level + 1U))) {
+			break;
+		}
+	}
+
+	if (Level < XIL_TIMERWHEEL_LEVELS) {
+		Slot = Xil_TimerWheelIndex(Timer->Expires, Level);
+		HeadPtr = &Wheel->Slots[Level][Slot];
+		Wheel->Occupied[Level] |= (u64)1U << Slot;
+	} else {
+		HeadPtr = &Wheel->Overflow;
+	}
+
+	Timer->Level = (u8)Level;
+	Timer->Slot = (u8)Slot;
+	Timer->Prev = NULL;
+	Timer->Next = *HeadPtr;
+	if (*HeadPtr != NULL) {
+		(*HeadPtr)->Prev = Timer;
+	}
+	*HeadPtr = Timer;
+	Timer->IsActive = 1U;
+}
+
+/****************************************************************************/
+/**
+*
+* Unlink a running timer from its slot.
+*
+* @param	Wheel is a pointer to the timer wheel.
+* @param	Timer is a pointer to the timer.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void Xil_TimerWheelUnlink(Xil_TimerWheel *Wheel, Xil_Timer *Timer)
+{
+	Xil_Timer **HeadPtr;
+
+	if (Timer->Level == XIL_TIMERWHEEL_OVERFLOW) {
+		HeadPtr = &Wheel->Overflow;
+	} else {
+		HeadPtr = &Wheel->Slots[Timer->Level][Timer->Slot];
+	}
+
+	if (Timer->Prev != NULL) {
+		Timer->Prev->Next = Timer->Next;
+	} else {
+		*HeadPtr = Timer->Next;
+	}
+	if (Timer->Next != NULL) {
+		Timer->Next->Prev = Timer->Prev;
+	}
+
+	if ((*HeadPtr == NULL) && (Timer->Level != XIL_TIMERWHEEL_OVERFLOW)) {
+		Wheel->Occupied[Timer->Level] &= ~((u64)1U << Timer->Slot);
+	}
+
+	Timer->Next = NULL;
+	Timer->Prev = NULL;
+	Timer->IsActive = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* Move the timers of the current slot of a level, or of the overflow list, to
+* the slots matching the new current tick.
+*
+* @param	Wheel is a pointer to the timer wheel.
+* @param	Level is the level to cascade, or XIL_TIMERWHEEL_LEVELS for
+*		the overflow list.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void Xil_TimerWheelCascade(Xil_TimerWheel *Wheel, u32 Level)
+{
+	Xil_Timer *Timer;
+	Xil_Timer *Next;
+
+	if (Level == XIL_TIMERWHEEL_LEVELS) {
+		Timer = Wheel->Overflow;
+		Wheel->Overflow = NULL;
+	} else {
+		Timer = Wheel->Slots[Level][Xil_TimerWheelIndex(Wheel->Tick,
+								Level)];
+		Wheel->Slots[Level][Xil_TimerWheelIndex(Wheel->Tick, Level)] =
+				NULL;
+		Wheel->Occupied[Level] &=
+			~((u64)1U << Xil_TimerWheelIndex(Wheel->Tick, Level));
+	}
+
+	while (Timer != NULL) {
+		Next = Timer->Next;
+		Xil_TimerWheelInsert(Wheel, Timer);
+		Timer = Next;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Advance the current tick of the wheel up to Target. The ticks without a
+* timer to expire or a slot to cascade are skipped, the upper levels are cascaded when the tick enters their
+* next slot and the timers of each level 0 slot reached are expired.
+*
+* @param	Wheel is a pointer to the timer wheel.
+* @param	Target is the tick to advance to.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void Xil_TimerWheelAdvance(Xil_TimerWheel *Wheel, u64 Target)
+{
+	Xil_Timer *Timer;
+	u64 Next;
+	u32 Level;
+	u32 Slot;
+
+	while (Wheel->Tick < Target) {
+		if (Xil_TimerWheelAfter(Wheel->Occupied[0],
+				Xil_TimerWheelIndex(Wheel->Tick, 0U)) == 0U) {
+			/* Nothing left in level 0, go to the next event */
+			Next = Xil_TimerWheelNextTick(Wheel);
+			if (Next > Target) {
+				Wheel->Tick = Target;
+				break;
+			}
+			Wheel->Tick = Next - 1U;
+		}
+
+		Wheel->Tick++;
+
+		/* Cascade from the top so timers can drop several levels */
+		if ((Wheel->Tick & (((u64)1U << XIL_TIMERWHEEL_RANGE_BITS) -
+				1U)) == 0U) {
+			Xil_TimerWheelCascade(Wheel, XIL_TIMERWHEEL_LEVELS);
+		}
+		for (Level = XIL_TIMERWHEEL_LEVELS - 1U; Level > 0U; Level--) {
+			if ((Wheel->Tick & (((u64)1U <<
+				Xil_TimerWheelShift(Level)) - 1U)) == 0U) {
+				Xil_TimerWheelCascade(Wheel, Level);
+			}
+		}
+
+		/*
+		 * Expire the timers one by one, as a handler may start or stop
+		 * any timer.
+		 */
+		Slot = Xil_TimerWheelIndex(Wheel->Tick, 0U);
+		while (Wheel->Slots[0][Slot] != NULL) {
+			Timer = Wheel->Slots[0][Slot];
+			Xil_TimerWheelUnlink(Wheel, Timer);
+			if (Timer->Period != 0U) {
+				Timer->Expires += Timer->Period;
+				if (Timer->Expires <= Wheel->Tick) {
+					Timer->Expires = Wheel->Tick + 1U;
+				}
+				Xil_TimerWheelInsert(Wheel, Timer);
+			}
+			Timer->Handler(Timer->CallBackRef);
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Program the hardware timer for the next expiry of the wheel.
+*
+* @param	Wheel is a pointer to the timer wheel.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void Xil_TimerWheelRearm(Xil_TimerWheel *Wheel)
+{
+	u64 Next;
+
+	Next = Xil_TimerWheelNextExpiry(Wheel);
+	if (Next != XIL_TIMELINE_NEVER) {
+		Wheel->Armed = Next >> Wheel->TickShift;
+	} else {
+		Wheel->Armed = XIL_TIMELINE_NEVER;
+	}
+
+	if (Wheel->ArmHandler != NULL) {
+		Wheel->ArmHandler(Wheel->ArmRef, Next);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Sleep hook for Xil_SetSleepHook(). It starts a one-shot timer for the delay
+* on the wheel given as CallBackRef, then waits for interrupts with WFI until
+* the timer has expired.
+*
+* @param	CallBackRef is a pointer to the timer wheel.
+* @param	useconds is the delay in microseconds.
+*
+* @return	0 when the delay was waited, or useconds if the wheel has no
+*		hardware timer, so that the BSP busy-waits.
+*
+* @note		Sleeping is only possible from a context which the interrupt
+*		of the hardware timer can preempt, so with interrupts enabled
+*		and outside interrupt handlers. Applications calling sleep()
+*		or usleep() from an interrupt handler should not set this hook.
+*
+*****************************************************************************/
+unsigned long Xil_TimerWheelSleepHook(void *CallBackRef,
+			unsigned long useconds)
+{
+	Xil_TimerWheel *Wheel = (Xil_TimerWheel *)CallBackRef;
+	Xil_Timer Timer;
+	volatile u32 Done = 0U;
+
+	Xil_AssertNonvoid(Wheel != NULL);
+
+	if (Wheel->ArmHandler == NULL) {
+		return useconds;
+	}
+
+	Xil_TimerInit(&Timer, Xil_TimerWheelWake, (void *)&Done);
+
+	/* The wheel is updated from the timer interrupt */
+	Xil_ExceptionDisable();
+	Xil_TimerStart(Wheel, &Timer, Xil_TimelineUsToCounts(useconds), 0U);
+	Xil_ExceptionEnable();
+
+	while (Done == 0U) {
+		Xil_TimelineWaitForInterrupt();
+	}
+
+	return 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* Expiry handler of the timer started by Xil_TimerWheelSleepHook().
+*
+* @param	CallBackRef is a pointer to the done flag of the sleep.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void Xil_TimerWheelWake(void *CallBackRef)
+{
+	*(volatile u32 *)CallBackRef = 1U;
+}
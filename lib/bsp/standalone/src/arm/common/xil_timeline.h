@@ -0,0 +1,258 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_timeline.h
+*
+* This header file contains the timeline service of the ARM Cortex A53, A9 and
+* R5 BSPs. It provides a 64-bit monotonic timestamp and a hierarchical timer
+* wheel for one-shot and periodic software timers.
+*
+* The timestamp counts at XIL_TIMELINE_COUNTS_PER_SECOND. It comes from the
+* sleep timer TTC when one is selected, extended in software to 64 bits, and
+* from the global timer (Cortex A9) or the generic timer (Cortex A53)
+* otherwise. When the TTC is used, Xil_TimelineNow() must be called at least
+* once per counter wrap, which the timer wheel does when a timer is running.
+*
+* The timer wheel counts in ticks of 2^TickShift timeline counts. It has four
+* levels of 64 slots, so timers up to 2^24 ticks away are kept in O(1) slots
+* and cascaded down as time passes, farther ones in an overflow list. The
+* wheel does not own a hardware timer: the arm handler given to
+* Xil_TimerWheelInit() must program a timer (e.g. a TTC match or interval
+* interrupt) to expire at the requested timeline count, and the interrupt
+* handler of that timer must call Xil_TimerWheelRun(). Timer callbacks run
+* from Xil_TimerWheelRun() and may start or stop timers.
+*
+* Xil_TimerWheelSleepHook() can be given to Xil_SetSleepHook() so that sleep()
+* and usleep() wait for a wheel timer with WFI instead of spinning.
+*
+* The timeline has no wall clock. Xil_SetTimeOfDayHook() sets the time source
+* used by gettimeofday() with GCC, e.g. the RTC time service of the rtcpsu
+* driver; without one gettimeofday() fails.
+*
+* The timer wheel is not thread safe. Xil_TimerStart() and Xil_TimerStop()
+* must be called from the timer interrupt context or with that interrupt
+* masked.
+*
+* <pre>
+* MODIFICATION HISTORY :
+*
+* Ver   Who  Date	 Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.6	ag   10/14/26 First Release.
+*       ag   10/14/26 Added Xil_TimerWheelSleepHook.
+*       ag   10/14/26 Added Xil_SetTimeOfDayHook.
+*
+* </pre>
+*****************************************************************************/
+
+#ifndef XIL_TIMELINE_H		/* prevent circular inclusions */
+#define XIL_TIMELINE_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/****************************  Include Files  ********************************/
+
+#include "xil_types.h"
+#include "xil_io.h"
+#include "xtime_l.h"
+#include "bspconfig.h"
+#if defined (SLEEP_TIMER_BASEADDR)
+#include "xil_sleeptimer.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define XIL_TIMELINE_COUNTS_PER_SECOND	((u64)COUNTS_PER_SECOND)
+					/**< Timestamp resolution */
+#define XIL_TIMELINE_NEVER		0xFFFFFFFFFFFFFFFFU
+					/**< No timer to expire */
+
+#define XIL_TIMERWHEEL_LEVELS		4U	/**< Levels of the wheel */
+#define XIL_TIMERWHEEL_SLOT_BITS	6U	/**< log2 of slots per level */
+#define XIL_TIMERWHEEL_SLOTS		64U	/**< Slots per level */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Callback of a software timer, called from Xil_TimerWheelRun() when the
+ * timer expires.
+ */
+typedef void (*Xil_TimerHandler) (void *CallBackRef);
+
+/**
+ * Arm handler of a timer wheel. It must program the hardware timer to
+ * interrupt at Deadline, a timeline count, or stop it if Deadline is
+ * XIL_TIMELINE_NEVER. A Deadline in the past must interrupt at once.
+ */
+typedef void (*Xil_TimerArmHandler) (void *CallBackRef, u64 Deadline);
+
+/**
+ * Time of day source of gettimeofday(). It stores the seconds and
+ * microseconds since 1970-01-01 and returns XST_SUCCESS, or XST_FAILURE if it
+ * has no valid time. It is called from every context calling gettimeofday(),
+ * so it must not block.
+ */
+typedef s32 (*Xil_TimeOfDayHook) (void *CallBackRef, u32 *Sec, u32 *USec);
+
+/**
+ * A software timer. The user allocates it and initializes it with
+ * Xil_TimerInit(); the wheel links it while it is running.
+ */
+typedef struct Xil_Timer_s {
+	struct Xil_Timer_s *Next;	/**< Next timer in the slot */
+	struct Xil_Timer_s *Prev;	/**< Previous timer in the slot */
+	u64 Expires;			/**< Expiry, in wheel ticks */
+	u64 Period;			/**< Period in ticks, 0 for one-shot */
+	Xil_TimerHandler Handler;	/**< Expiry callback */
+	void *CallBackRef;		/**< Callback reference */
+	u8 Level;			/**< Level of the wheel, or overflow */
+	u8 Slot;			/**< Slot within the level */
+	u8 IsActive;			/**< Timer is linked in the wheel */
+} Xil_Timer;
+
+/**
+ * A hierarchical timer wheel.
+ */
+typedef struct {
+	Xil_Timer *Slots[XIL_TIMERWHEEL_LEVELS][XIL_TIMERWHEEL_SLOTS];
+					/**< Timer lists */
+	u64 Occupied[XIL_TIMERWHEEL_LEVELS];	/**< Non empty slots */
+	Xil_Timer *Overflow;		/**< Timers beyond the top level */
+	u64 Tick;			/**< Current tick */
+	u64 Armed;			/**< Tick the hardware is armed for */
+	u32 TickShift;			/**< log2 of timeline counts per tick */
+	Xil_TimerArmHandler ArmHandler;	/**< Hardware timer arm handler */
+	void *ArmRef;			/**< Arm handler reference */
+} Xil_TimerWheel;
+
+/************************** Variable Definitions *****************************/
+
+#if defined (SLEEP_TIMER_BASEADDR)
+extern u64 Xil_TimelineHigh;
+extern XCntrVal Xil_TimelineLast;
+#endif
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/****************************************************************************/
+/**
+*
+* Convert a time in microseconds to timeline counts.
+*
+* @param	Us is the time in microseconds.
+*
+* @return	The number of timeline counts.
+*
+* @note		C-Style signature:
+*		u64 Xil_TimelineUsToCounts(u64 Us);
+*
+*****************************************************************************/
+#define Xil_TimelineUsToCounts(Us) \
+	(((u64)(Us) * XIL_TIMELINE_COUNTS_PER_SECOND) / 1000000U)
+
+/****************************************************************************/
+/**
+*
+* Convert timeline counts to a time in microseconds.
+*
+* @param	Counts is the number of timeline counts.
+*
+* @return	The time in microseconds.
+*
+* @note		C-Style signature:
+*		u64 Xil_TimelineCountsToUs(u64 Counts);
+*
+*****************************************************************************/
+#define Xil_TimelineCountsToUs(Counts) \
+	(((u64)(Counts) * 1000000U) / XIL_TIMELINE_COUNTS_PER_SECOND)
+
+/****************************************************************************/
+/**
+*
+* Read the 64-bit monotonic timestamp. This is cheap enough to be used for
+* instrumentation of drivers and applications.
+*
+* @param	None.
+*
+* @return	The current timeline count.
+*
+* @note		With the TTC sleep timer, this must be called at least once
+*		per counter wrap and not concurrently from two contexts.
+*
+*****************************************************************************/
+static INLINE u64 Xil_TimelineNow(void)
+{
+#if defined (SLEEP_TIMER_BASEADDR)
+	XCntrVal Count;
+
+	Count = XSleep_ReadCounterVal(SLEEP_TIMER_BASEADDR +
+				XSLEEP_TIMER_TTC_COUNT_VALUE_OFFSET);
+	if (Count < Xil_TimelineLast) {
+		Xil_TimelineHigh += (u64)1U << XSLEEP_TIMER_REG_SHIFT;
+	}
+	Xil_TimelineLast = Count;
+
+	return Xil_TimelineHigh | (u64)Count;
+#else
+	XTime Now;
+
+	XTime_GetTime(&Now);
+
+	return (u64)Now;
+#endif
+}
+
+/************************** Function Prototypes ******************************/
+
+void Xil_TimelineInit(void);
+void Xil_TimerWheelInit(Xil_TimerWheel *Wheel, u32 TickShift,
+			Xil_TimerArmHandler ArmHandler, void *ArmRef);
+void Xil_TimerInit(Xil_Timer *Timer, Xil_TimerHandler Handler,
+			void *CallBackRef);
+void Xil_TimerStart(Xil_TimerWheel *Wheel, Xil_Timer *Timer, u64 Delay,
+			u64 Period);
+void Xil_TimerStop(Xil_TimerWheel *Wheel, Xil_Timer *Timer);
+void Xil_TimerWheelRun(Xil_TimerWheel *Wheel);
+u64 Xil_TimerWheelNextExpiry(Xil_TimerWheel *Wheel);
+unsigned long Xil_TimerWheelSleepHook(void *CallBackRef,
+			unsigned long useconds);
+void Xil_SetTimeOfDayHook(Xil_TimeOfDayHook Hook, void *CallBackRef);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_TIMELINE_H */
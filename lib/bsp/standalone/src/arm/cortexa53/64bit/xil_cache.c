@@ -72,6 +72,12 @@
 *					  results into abort if accessed from EL1 non secure privilege
 *					  level. Updated Xil_ConfigureL1Prefetch function to access
 *					  CPUACTLR_EL1 only for EL3.
+* 6.6  ag   10/14/26  Range operations issue one DC op per line and a single
+*					  barrier at the end, without masking interrupts or
+*					  touching CSSELR_EL1. Ranges of at least
+*					  XIL_CACHE_SETWAY_THRESHOLD bytes use the set/way flush
+*					  of the whole cache. Added Xil_DCacheFlushRanges and
+*					  Xil_DCacheInvalidateRanges.
 *
 * </pre>
 *
@@ -89,8 +95,26 @@
 
 /************************** Function Prototypes ******************************/
 
+static void Xil_DCacheFlushRangeNoSync(INTPTR adr, INTPTR len);
+static void Xil_DCacheInvalidateRangeNoSync(INTPTR adr, INTPTR len);
+
 /************************** Variable Definitions *****************************/
 #define IRQ_FIQ_MASK 0xC0U	/* Mask IRQ and FIQ interrupts in cpsr */
+#define DCACHE_LINE_SIZE 64U	/* L1 and L2 data cache line size */
+
+/*
+ * Ranges of at least this many bytes are flushed with the set/way operations
+ * on the whole cache, which is cheaper than walking more lines than the L2
+ * cache holds. Define it to 0 to always use the by-address operations. Set/way
+ * operations are trapped by the hypervisor, so guests default to 0.
+ */
+#ifndef XIL_CACHE_SETWAY_THRESHOLD
+#if HYP_GUEST
+#define XIL_CACHE_SETWAY_THRESHOLD 0U
+#else
+#define XIL_CACHE_SETWAY_THRESHOLD 0x100000U
+#endif
+#endif
 
 /****************************************************************************/
 /**
@@ -418,49 +442,26 @@ void Xil_DCacheInvalidateLine(INTPTR adr)
 * 			a line belonging to another OS. This could lead to the other OS
 * 			crashing because of the loss of essential data. Hence, such
 * 			operations are promoted to clean and invalidate which avoids such
-*			corruption.
+*			corruption. For the same reason, ranges of
+*			XIL_CACHE_SETWAY_THRESHOLD bytes or more flush the whole Data
+*			cache instead.
 *
 ****************************************************************************/
 void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
 {
-	const INTPTR cacheline = 64U;
-	INTPTR end;
-	INTPTR tempadr = adr;
-	INTPTR tempend;
-	u32 currmask;
-	currmask = mfcpsr();
-	mtcpsr(currmask | IRQ_FIQ_MASK);
-	if (len != 0U) {
-		end = tempadr + len;
-		tempend = end;
-
-		if ((tempadr & (cacheline-1U)) != 0U) {
-			tempadr &= (~(cacheline - 1U));
-			Xil_DCacheFlushLine(tempadr);
-			tempadr += cacheline;
-		}
-		if ((tempend & (cacheline-1U)) != 0U) {
-			tempend &= (~(cacheline - 1U));
-			Xil_DCacheFlushLine(tempend);
-		}
+	if (len == 0) {
+		return;
+	}
 
-		while (tempadr < tempend) {
-			/* Select cache level 0 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x0);
-			/* Invalidate Data cache line */
-			mtcpdc(IVAC,(tempadr & (~0x3F)));
-			/* Wait for invalidate to complete */
-			dsb();
-			/* Select cache level 0 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x2);
-			/* Invalidate Data cache line */
-			mtcpdc(IVAC,(tempadr & (~0x3F)));
-			/* Wait for invalidate to complete */
-			dsb();
-			tempadr += cacheline;
-		}
+	if ((XIL_CACHE_SETWAY_THRESHOLD != 0U) &&
+	    ((UINTPTR)len >= XIL_CACHE_SETWAY_THRESHOLD)) {
+		Xil_DCacheFlush();
+		return;
 	}
-	mtcpsr(currmask);
+
+	Xil_DCacheInvalidateRangeNoSync(adr, len);
+	/* Wait for invalidate to complete */
+	dsb();
 }
 
 /****************************************************************************/
@@ -608,49 +609,168 @@ void Xil_DCacheFlushLine(INTPTR  adr)
 *
 * @return	None.
 *
-* @note		None.
+* @note		Ranges of XIL_CACHE_SETWAY_THRESHOLD bytes or more flush the
+*			whole Data cache instead.
 *
 ****************************************************************************/
 void Xil_DCacheFlushRange(INTPTR  adr, INTPTR len)
 {
-	const u32 cacheline = 64U;
-	INTPTR end;
+	if (len == 0) {
+		return;
+	}
+
+	if ((XIL_CACHE_SETWAY_THRESHOLD != 0U) &&
+	    ((UINTPTR)len >= XIL_CACHE_SETWAY_THRESHOLD)) {
+		Xil_DCacheFlush();
+		return;
+	}
+
+	Xil_DCacheFlushRangeNoSync(adr, len);
+	/* Wait for flush to complete */
+	dsb();
+}
+
+/****************************************************************************/
+/**
+* @brief	Flush the Data cache for a list of address ranges. This is the
+*			same as calling Xil_DCacheFlushRange for every range, but
+*			only one barrier is issued after the last range.
+*
+* @param	Ranges: array of address ranges to be flushed.
+* @param	Count: number of entries in Ranges.
+*
+* @return	None.
+*
+* @note		When the ranges add up to XIL_CACHE_SETWAY_THRESHOLD bytes or
+*			more, the whole Data cache is flushed instead.
+*
+****************************************************************************/
+void Xil_DCacheFlushRanges(const Xil_CacheRange *Ranges, u32 Count)
+{
+	UINTPTR total = 0U;
+	u32 i;
+
+	for (i = 0U; i < Count; i++) {
+		total += (UINTPTR)Ranges[i].Len;
+	}
+
+	if ((XIL_CACHE_SETWAY_THRESHOLD != 0U) &&
+	    (total >= XIL_CACHE_SETWAY_THRESHOLD)) {
+		Xil_DCacheFlush();
+		return;
+	}
+
+	for (i = 0U; i < Count; i++) {
+		Xil_DCacheFlushRangeNoSync(Ranges[i].Addr, Ranges[i].Len);
+	}
+	/* Wait for flush to complete */
+	dsb();
+}
+
+/****************************************************************************/
+/**
+* @brief	Invalidate the Data cache for a list of address ranges. This
+*			is the same as calling Xil_DCacheInvalidateRange for every
+*			range, but only one barrier is issued after the last range.
+*
+* @param	Ranges: array of address ranges to be invalidated.
+* @param	Count: number of entries in Ranges.
+*
+* @return	None.
+*
+* @note		When the ranges add up to XIL_CACHE_SETWAY_THRESHOLD bytes or
+*			more, the whole Data cache is flushed instead, which is
+*			what the invalidate operation is promoted to anyway.
+*
+****************************************************************************/
+void Xil_DCacheInvalidateRanges(const Xil_CacheRange *Ranges, u32 Count)
+{
+	UINTPTR total = 0U;
+	u32 i;
+
+	for (i = 0U; i < Count; i++) {
+		total += (UINTPTR)Ranges[i].Len;
+	}
+
+	if ((XIL_CACHE_SETWAY_THRESHOLD != 0U) &&
+	    (total >= XIL_CACHE_SETWAY_THRESHOLD)) {
+		Xil_DCacheFlush();
+		return;
+	}
+
+	for (i = 0U; i < Count; i++) {
+		Xil_DCacheInvalidateRangeNoSync(Ranges[i].Addr, Ranges[i].Len);
+	}
+	/* Wait for invalidate to complete */
+	dsb();
+}
+
+/****************************************************************************/
+/**
+* @brief	Clean and invalidate the Data cache lines of an address range
+*			to the point of coherency, without a closing barrier.
+*
+* @param	adr: 64bit start address of the range.
+* @param	len: Length of the range in bytes.
+*
+* @return	None.
+*
+* @note		Operations by address apply to all the cache levels, so no
+*			cache level is selected and the walk can be interrupted.
+*
+****************************************************************************/
+static void Xil_DCacheFlushRangeNoSync(INTPTR adr, INTPTR len)
+{
+	INTPTR tempadr = adr & (~((INTPTR)DCACHE_LINE_SIZE - 1));
+	INTPTR end = adr + len;
+
+	while (tempadr < end) {
+		mtcpdc(CIVAC, tempadr);
+		tempadr += DCACHE_LINE_SIZE;
+	}
+}
+
+/****************************************************************************/
+/**
+* @brief	Invalidate the Data cache lines of an address range to the
+*			point of coherency, without a closing barrier. Partial lines
+*			at either end are cleaned first so that data outside the
+*			range is not lost.
+*
+* @param	adr: 64bit start address of the range.
+* @param	len: Length of the range in bytes.
+*
+* @return	None.
+*
+* @note		See Xil_DCacheFlushRangeNoSync.
+*
+****************************************************************************/
+static void Xil_DCacheInvalidateRangeNoSync(INTPTR adr, INTPTR len)
+{
+	const INTPTR mask = (INTPTR)DCACHE_LINE_SIZE - 1;
 	INTPTR tempadr = adr;
-	INTPTR tempend;
-	u32 currmask;
-	currmask = mfcpsr();
-	mtcpsr(currmask | IRQ_FIQ_MASK);
-	if (len != 0x00000000U) {
-		end = tempadr + len;
-		tempend = end;
-		if ((tempadr & (0x3F)) != 0) {
-			tempadr &= ~(0x3F);
-			Xil_DCacheFlushLine(tempadr);
-			tempadr += cacheline;
-		}
-		if ((tempend & (0x3F)) != 0) {
-			tempend &= ~(0x3F);
-			Xil_DCacheFlushLine(tempend);
-		}
+	INTPTR tempend = adr + len;
 
-		while (tempadr < tempend) {
-			/* Select cache level 0 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x0);
-			/* Flush Data cache line */
-			mtcpdc(CIVAC,(tempadr & (~0x3F)));
-			/* Wait for flush to complete */
-			dsb();
-			/* Select cache level 1 and D cache in CSSR */
-			mtcp(CSSELR_EL1,0x2);
-			/* Flush Data cache line */
-			mtcpdc(CIVAC,(tempadr & (~0x3F)));
-			/* Wait for flush to complete */
-			dsb();
-			tempadr += cacheline;
+	if (len == 0) {
+		return;
+	}
+
+	if ((tempadr & mask) != 0) {
+		tempadr &= ~mask;
+		mtcpdc(CIVAC, tempadr);
+		tempadr += DCACHE_LINE_SIZE;
+	}
+	if ((tempend & mask) != 0) {
+		tempend &= ~mask;
+		if (tempend >= tempadr) {
+			mtcpdc(CIVAC, tempend);
 		}
 	}
 
-	mtcpsr(currmask);
+	while (tempadr < tempend) {
+		mtcpdc(IVAC, tempadr);
+		tempadr += DCACHE_LINE_SIZE;
+	}
 }
 
 /****************************************************************************/
@@ -49,6 +49,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 6.6   ag   10/14/26 Added Xil_DCacheFlushRanges and Xil_DCacheInvalidateRanges
 * </pre>
 *
 ******************************************************************************/
@@ -65,6 +66,16 @@ extern "C" {
 #define L1_DATA_PREFETCH_CONTROL_MASK  0xE000
 #define L1_DATA_PREFETCH_CONTROL_SHIFT  13
 
+/**************************** Type Definitions *******************************/
+
+/**
+ * Address range for the batched Data cache operations.
+ */
+typedef struct {
+	INTPTR Addr;	/**< Start address of the range */
+	INTPTR Len;	/**< Length of the range in bytes */
+} Xil_CacheRange;
+
 /************************** Function Prototypes ******************************/
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
@@ -74,6 +85,8 @@ void Xil_DCacheInvalidateLine(INTPTR adr);
 void Xil_DCacheFlush(void);
 void Xil_DCacheFlushRange(INTPTR adr, INTPTR len);
 void Xil_DCacheFlushLine(INTPTR adr);
+void Xil_DCacheFlushRanges(const Xil_CacheRange *Ranges, u32 Count);
+void Xil_DCacheInvalidateRanges(const Xil_CacheRange *Ranges, u32 Count);
 
 void Xil_ICacheEnable(void);
 void Xil_ICacheDisable(void);
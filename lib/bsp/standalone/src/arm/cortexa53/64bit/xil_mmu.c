@@ -45,6 +45,9 @@
 * ----- ---- -------- ---------------------------------------------------
 * 5.00 	pkp  05/29/14 First release
 * 6.02  pkp	 01/22/17 Added support for EL1 non-secure
+* 6.6   ag   10/14/26 Added Xil_SetTlbAttributesRange for run time mapping
+*                     with 4KB/2MB/1GB pages, contiguous hint and
+*                     invalidation of the changed TLB entries only.
 * </pre>
 *
 * @note
@@ -59,23 +62,61 @@
 #include "xpseudo_asm.h"
 #include "xil_types.h"
 #include "xil_mmu.h"
+#include "xstatus.h"
 #include "bspconfig.h"
 /***************** Macros (Inline Functions) Definitions *********************/
 
-/**************************** Type Definitions *******************************/
+/* Address shift of an entry at a translation table level (4KB granule) */
+#define XIL_MMU_SHIFT(Level)	(39U - (9U * (Level)))
 
 /************************** Constant Definitions *****************************/
 
 #define BLOCK_SIZE_2MB 0x200000U
 #define BLOCK_SIZE_1GB 0x40000000U
+#define PAGE_SIZE_4KB 0x1000U
 #define ADDRESS_LIMIT_4GB 0x100000000UL
+#define ADDRESS_LIMIT_1TB 0x10000000000UL
+
+#define XIL_MMU_DESC_VALID 0x1UL
+#define XIL_MMU_DESC_TABLE 0x3UL	/* table, or page at level 3 */
+#define XIL_MMU_ADDR_MASK 0x0000FFFFFFFFF000UL
+#define XIL_MMU_ATTR_MASK 0xFFF0000000000FFCUL
+#define XIL_MMU_ENTRIES 512U
+#define XIL_MMU_CONTIG_ENTRIES 16U
+
+/* Number of tables available for 4KB pages and split 1GB blocks */
+#ifndef XIL_MMU_TABLE_POOL_SIZE
+#define XIL_MMU_TABLE_POOL_SIZE 8U
+#endif
+
+/* Above this many entries the whole TLB is invalidated instead */
+#define XIL_MMU_TLBI_MAX 64U
+
+/* Above this size the whole D-cache is flushed instead of the range */
+#define XIL_MMU_FLUSH_RANGE_MAX 0x100000U
+
+/**************************** Type Definitions *******************************/
+
+/* Addresses whose TLB entries have to be invalidated */
+typedef struct {
+	UINTPTR Va[XIL_MMU_TLBI_MAX];
+	u32 Count;
+	u32 All;	/* too many addresses, invalidate the whole TLB */
+} Xil_MmuTlbList;
 
 /************************** Variable Definitions *****************************/
 
 extern INTPTR MMUTableL1;
 extern INTPTR MMUTableL2;
 
+static INTPTR Xil_MmuTablePool[XIL_MMU_TABLE_POOL_SIZE][XIL_MMU_ENTRIES]
+			__attribute__ ((aligned(PAGE_SIZE_4KB)));
+static u8 Xil_MmuTableUsed[XIL_MMU_TABLE_POOL_SIZE];
+
 /************************** Function Prototypes ******************************/
+
+static void Xil_MmuReleaseTable(INTPTR Desc, u32 Level);
+
 /*****************************************************************************/
 /**
 * brief		It sets the memory attributes for a section, in the translation
@@ -113,6 +154,8 @@ void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib)
 		block_size = BLOCK_SIZE_1GB;
 		section = Addr / block_size;
 		ptr = &MMUTableL1 + section;
+		/* return a table of Xil_SetTlbAttributesRange to the pool */
+		Xil_MmuReleaseTable(*ptr, 1U);
 	}
 	*ptr = (Addr & (~(block_size-1))) | attrib;
 
@@ -127,3 +170,321 @@ void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib)
     isb(); /* synchronize context on this processor */
 
 }
+
+/*****************************************************************************/
+/**
+* brief		Returns a level 2 or level 3 table taken from the pool by
+*			Xil_SetTlbAttributesRange back to the pool. Tables below it are
+*			returned as well. Other descriptors are ignored.
+*
+* @param	Desc: descriptor that is about to be overwritten.
+* @param	Level: translation table level of the descriptor.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Xil_MmuReleaseTable(INTPTR Desc, u32 Level)
+{
+	INTPTR *Table;
+	UINTPTR Offset;
+	u32 Index;
+
+	if ((Level == 3U) ||
+		((Desc & XIL_MMU_DESC_TABLE) != XIL_MMU_DESC_TABLE)) {
+		return;
+	}
+
+	Table = (INTPTR *)(Desc & XIL_MMU_ADDR_MASK);
+	Offset = (UINTPTR)Table - (UINTPTR)Xil_MmuTablePool;
+	if (Offset >= sizeof(Xil_MmuTablePool)) {
+		/* one of the static tables of translation_table.S */
+		return;
+	}
+
+	if (Level == 1U) {
+		for (Index = 0U; Index < XIL_MMU_ENTRIES; Index++) {
+			Xil_MmuReleaseTable(Table[Index], 2U);
+		}
+	}
+	Xil_MmuTableUsed[Offset / sizeof(Xil_MmuTablePool[0])] = 0U;
+}
+
+/*****************************************************************************/
+/**
+* brief		Adds the range of one translation table entry to the addresses
+*			whose TLB entries are invalidated, one address per Step.
+*
+* @param	Tlb: invalidation list.
+* @param	Addr: start of the range, aligned to Size.
+* @param	Size: size of the range.
+* @param	Step: granule of the TLB entries that may cache the range.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Xil_MmuTlbAdd(Xil_MmuTlbList *Tlb, UINTPTR Addr, u64 Size,
+								u64 Step)
+{
+	u64 Offset;
+
+	if ((Tlb->All != 0U) ||
+		((Size / Step) > (XIL_MMU_TLBI_MAX - Tlb->Count))) {
+		Tlb->All = 1U;
+		return;
+	}
+
+	for (Offset = 0U; Offset < Size; Offset += Step) {
+		Tlb->Va[Tlb->Count] = Addr + Offset;
+		Tlb->Count++;
+	}
+}
+
+/*****************************************************************************/
+/**
+* brief		Writes a translation table entry. A contiguous run the old entry
+*			is part of is broken up first, a pool table it pointed to is
+*			released and its range is added to the TLB invalidation range.
+*
+* @param	Entry: pointer to the translation table entry.
+* @param	Desc: new descriptor.
+* @param	Level: translation table level of the entry.
+* @param	Addr: address mapped by the entry, aligned to the entry size.
+* @param	Tlb: invalidation range.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Xil_MmuSetEntry(INTPTR *Entry, INTPTR Desc, u32 Level,
+					UINTPTR Addr, Xil_MmuTlbList *Tlb)
+{
+	INTPTR Old = *Entry;
+	INTPTR *Group;
+	u64 BlockSize = 1UL << XIL_MMU_SHIFT(Level);
+	u32 Index;
+
+	if ((Old & XIL_MMU_DESC_VALID) == 0U) {
+		*Entry = Desc;
+		return;
+	}
+
+	if ((Old & CONTIGUOUS_HINT) != 0U) {
+		Index = (u32)(((UINTPTR)Entry & (PAGE_SIZE_4KB - 1U)) /
+							sizeof(INTPTR));
+		Group = Entry - (Index % XIL_MMU_CONTIG_ENTRIES);
+		for (Index = 0U; Index < XIL_MMU_CONTIG_ENTRIES; Index++) {
+			Group[Index] &= ~CONTIGUOUS_HINT;
+		}
+		Xil_MmuTlbAdd(Tlb, Addr & ~((BlockSize *
+				XIL_MMU_CONTIG_ENTRIES) - 1U),
+				BlockSize * XIL_MMU_CONTIG_ENTRIES, BlockSize);
+	}
+
+	if ((Level != 3U) &&
+		((Old & XIL_MMU_DESC_TABLE) == XIL_MMU_DESC_TABLE)) {
+		/* the leaf entries below may be 4KB pages */
+		Xil_MmuReleaseTable(Old, Level);
+		Xil_MmuTlbAdd(Tlb, Addr, BlockSize, PAGE_SIZE_4KB);
+	} else {
+		Xil_MmuTlbAdd(Tlb, Addr, BlockSize, BlockSize);
+	}
+
+	*Entry = Desc;
+}
+
+/*****************************************************************************/
+/**
+* brief		Returns the translation table entry of an address at a level.
+*			Blocks above the level are split into a table from the pool
+*			that maps the block unchanged.
+*
+* @param	Addr: address to look up.
+* @param	Level: translation table level of the entry, 1 to 3.
+* @param	Tlb: invalidation range.
+*
+* @return	Pointer to the entry, NULL if the table pool is exhausted.
+*
+******************************************************************************/
+static INTPTR *Xil_MmuGetEntry(UINTPTR Addr, u32 Level, Xil_MmuTlbList *Tlb)
+{
+	INTPTR *Table = &MMUTableL1;
+	INTPTR *Entry;
+	INTPTR *NewTable;
+	INTPTR Attr;
+	INTPTR Type;
+	UINTPTR Base;
+	u64 SubSize;
+	u32 Cur;
+	u32 Index;
+	u32 Slot;
+
+	for (Cur = 1U; Cur <= 3U; Cur++) {
+		/* the level 1 table spans two pages, 1TB */
+		Index = (u32)(Addr >> XIL_MMU_SHIFT(Cur));
+		if (Cur != 1U) {
+			Index &= XIL_MMU_ENTRIES - 1U;
+		}
+		Entry = Table + Index;
+		if (Cur == Level) {
+			return Entry;
+		}
+
+		if ((*Entry & XIL_MMU_DESC_TABLE) != XIL_MMU_DESC_TABLE) {
+			NewTable = NULL;
+			for (Slot = 0U; Slot < XIL_MMU_TABLE_POOL_SIZE; Slot++) {
+				if (Xil_MmuTableUsed[Slot] == 0U) {
+					Xil_MmuTableUsed[Slot] = 1U;
+					NewTable = Xil_MmuTablePool[Slot];
+					break;
+				}
+			}
+			if (NewTable == NULL) {
+				return NULL;
+			}
+
+			/* map the block with the entries of the next level */
+			SubSize = 1UL << XIL_MMU_SHIFT(Cur + 1U);
+			Base = (UINTPTR)(*Entry & XIL_MMU_ADDR_MASK);
+			Attr = *Entry & XIL_MMU_ATTR_MASK & ~CONTIGUOUS_HINT;
+			Type = (Cur == 2U) ? XIL_MMU_DESC_TABLE :
+							XIL_MMU_DESC_VALID;
+			for (Slot = 0U; Slot < XIL_MMU_ENTRIES; Slot++) {
+				if ((*Entry & XIL_MMU_DESC_VALID) == 0U) {
+					NewTable[Slot] = 0;
+				} else {
+					NewTable[Slot] = (Base + (Slot * SubSize)) |
+								Attr | Type;
+				}
+			}
+			dsb(); /* table is visible before it is linked in */
+
+			Xil_MmuSetEntry(Entry, (INTPTR)NewTable | XIL_MMU_DESC_TABLE,
+				Cur, Addr & ~((1UL << XIL_MMU_SHIFT(Cur)) - 1U), Tlb);
+		}
+		Table = (INTPTR *)(*Entry & XIL_MMU_ADDR_MASK);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+* brief		It maps a range with the given memory attributes at run time.
+*			Each part of the range uses the largest page its alignment
+*			allows: 1GB blocks above 4GB, 2MB blocks and 4KB pages. Aligned
+*			runs of 16 entries get the contiguous hint so that they take a
+*			single TLB entry. Blocks are split into or merged from tables
+*			as needed and only the TLB entries of the changed range are
+*			invalidated.
+*
+* @param	Addr: 64-bit start address of the range, 4KB aligned.
+* @param	Size: size of the range in bytes, multiple of 4KB.
+* @param	attrib: Attribute for the range, for example NORM_WB_CACHE,
+*			NORM_WC for frame buffers or NORM_NONCACHE for DMA descriptor
+*			rings. xil_mmu.h contains commonly used memory attributes
+*			definitions which can be utilized for this function.
+*
+* @return	- XST_SUCCESS if the range is mapped.
+*			- XST_INVALID_PARAM if the range is not 4KB aligned or ends
+*			above 1TB.
+*			- XST_FAILURE if the table pool is exhausted. The part of the
+*			range before the failing page is mapped.
+*
+* @note		The translation tables are flat mapped, virtual and physical
+*			addresses are the same. The D-cache lines of the range are
+*			flushed so that no stale line survives a change of the
+*			cacheability. A block being split into pages keeps its
+*			mapping in the new table, so the code and stack may be in the
+*			range being remapped.
+*
+******************************************************************************/
+s32 Xil_SetTlbAttributesRange(UINTPTR Addr, u64 Size, u64 attrib)
+{
+	Xil_MmuTlbList Tlb;
+	INTPTR *Entry;
+	INTPTR Desc;
+	UINTPTR Start = Addr;
+	u64 BlockSize;
+	u32 Level;
+	u32 Count;
+	u32 Index;
+	s32 Status = XST_SUCCESS;
+
+	if ((Size == 0U) || (((Addr | Size) & (PAGE_SIZE_4KB - 1U)) != 0U) ||
+		(Addr >= ADDRESS_LIMIT_1TB) || (Size > (ADDRESS_LIMIT_1TB - Addr))) {
+		return XST_INVALID_PARAM;
+	}
+
+	Tlb.Count = 0U;
+	Tlb.All = 0U;
+
+	while (Size > 0U) {
+		/* below 4GB the static level 2 tables stay in place */
+		if ((Addr >= ADDRESS_LIMIT_4GB) && (Size >= BLOCK_SIZE_1GB) &&
+				((Addr & (BLOCK_SIZE_1GB - 1U)) == 0U)) {
+			Level = 1U;
+		} else if ((Size >= BLOCK_SIZE_2MB) &&
+				((Addr & (BLOCK_SIZE_2MB - 1U)) == 0U)) {
+			Level = 2U;
+		} else {
+			Level = 3U;
+		}
+		BlockSize = 1UL << XIL_MMU_SHIFT(Level);
+
+		Count = 1U;
+		Desc = (INTPTR)attrib;
+		if ((attrib & XIL_MMU_DESC_VALID) == 0U) {
+			Desc = 0;
+		} else if (((Addr & ((BlockSize * XIL_MMU_CONTIG_ENTRIES) - 1U))
+					== 0U) &&
+				(Size >= (BlockSize * XIL_MMU_CONTIG_ENTRIES))) {
+			Count = XIL_MMU_CONTIG_ENTRIES;
+			Desc |= CONTIGUOUS_HINT;
+		}
+		if ((Level == 3U) && (Desc != 0)) {
+			Desc |= XIL_MMU_DESC_TABLE;
+		}
+
+		Entry = Xil_MmuGetEntry(Addr, Level, &Tlb);
+		if (Entry == NULL) {
+			Status = XST_FAILURE;
+			break;
+		}
+
+		for (Index = 0U; Index < Count; Index++) {
+			Xil_MmuSetEntry(&Entry[Index], (Desc == 0) ? 0 :
+					((INTPTR)(Addr & XIL_MMU_ADDR_MASK) | Desc),
+					Level, Addr, &Tlb);
+			Addr += BlockSize;
+			Size -= BlockSize;
+		}
+	}
+
+	dsb(); /* entries are visible to the table walk */
+
+	if (Tlb.All != 0U) {
+		if (EL3 == 1)
+			mtcptlbi(ALLE3);
+		else if (EL1_NONSECURE == 1)
+			mtcptlbi(VMALLE1);
+	} else {
+		for (Index = 0U; Index < Tlb.Count; Index++) {
+			if (EL3 == 1)
+				mtcptlbiva(VAE3, Tlb.Va[Index] >> 12U);
+			else if (EL1_NONSECURE == 1)
+				mtcptlbiva(VAAE1, Tlb.Va[Index] >> 12U);
+		}
+	}
+
+	dsb(); /* ensure completion of the TLB invalidation */
+	isb(); /* synchronize context on this processor */
+
+	if (Addr > Start) {
+		if ((Addr - Start) > XIL_MMU_FLUSH_RANGE_MAX) {
+			Xil_DCacheFlush();
+		} else {
+			Xil_DCacheFlushRange((INTPTR)Start, (INTPTR)(Addr - Start));
+		}
+	}
+
+	return Status;
+}
@@ -38,6 +38,14 @@
 * MMU function equip users to modify default memory attributes of MMU table as
 * per the need.
 *
+* Xil_SetTlbAttributesRange() remaps a range at run time. It picks the largest
+* page (4KB, 2MB or 1GB) the alignment of the range allows, splits or merges
+* the translation table blocks as needed and sets the contiguous hint on
+* aligned runs of 16 entries. Only the TLB entries of the changed range are
+* invalidated. The tables for 4KB and split 1GB mappings come from a static
+* pool of XIL_MMU_TABLE_POOL_SIZE tables, which can be overridden at compile
+* time.
+*
 * @{
 *
 * <pre>
@@ -46,6 +54,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 6.6   ag   10/14/26 Added Xil_SetTlbAttributesRange, NORM_WC and
+*                     CONTIGUOUS_HINT
 * </pre>
 *
 * @note
@@ -83,6 +93,9 @@ extern "C" {
 /* Normal write back cacheable inner-shareable */
 #define NORM_WB_CACHE 0x705UL
 
+/* Normal Non-cacheable, writes are gathered (frame buffers) */
+#define NORM_WC NORM_NONCACHE
+
 /*
  * shareability attribute only applicable to
  * normal cacheable memory
@@ -97,11 +110,15 @@ extern "C" {
 /* Security type */
 #define NON_SECURE	(0x1 << 5)
 
+/* Contiguous hint, set by Xil_SetTlbAttributesRange on aligned runs */
+#define CONTIGUOUS_HINT (0x1UL << 52)
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Prototypes ******************************/
 
 void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib);
+s32 Xil_SetTlbAttributesRange(UINTPTR Addr, u64 Size, u64 attrib);
 
 #ifdef __cplusplus
 }
@@ -98,6 +98,9 @@
 * 6.6    asa 16/01/18 Changes made in Xil_L1DCacheInvalidate and Xil_L2CacheInvalidate
 *					  routines to ensure the stack data flushed only when the respective
 *					  caches are enabled. This fixes CR-992023.
+* 6.6    ag  10/14/26 Added L2 prefetch and auxiliary control settings that
+*                     survive Xil_L2CacheEnable, way lockdown and an
+*                     interruptible flush. Xil_L2CacheEnable applies them.
 *
 * </pre>
 *
@@ -121,6 +124,20 @@
 
 #define IRQ_FIQ_MASK 0xC0U	/* Mask IRQ and FIQ interrupts in cpsr */
 
+#define XIL_ACTLR_FLZ_MASK	0x00000008U	/* ACTLR write full line of zeros */
+#define XPS_SCU_CTRL_OFFSET	0x00000000U	/* SCU control register */
+#define XPS_SCU_CTRL_SPEC_LINEFILL_MASK	0x00000008U	/* SCU speculative linefills */
+
+#define XIL_CACHE_BG_CHUNK	64U	/* Lines flushed with interrupts masked */
+#define XIL_CACHE_BG_WAY_MIN	0x00080000U	/* Range from which a way operation
+						   is cheaper, the L2 size */
+
+#ifndef USE_AMP
+static u32 L2AuxSet = 0U;	/* AUX bits set by Xil_L2CacheSetAuxCtrl */
+static u32 L2AuxClear = 0U;	/* AUX bits cleared by Xil_L2CacheSetAuxCtrl */
+static u32 L2LockedWays = 0U;	/* Ways locked for all masters */
+#endif
+
 #ifdef __GNUC__
 	extern s32  _stack_end;
 	extern s32  __undef_stack;
@@ -1316,6 +1333,7 @@ void Xil_L2CacheEnable(void)
 				   XPS_L2CC_AUX_CNTRL_OFFSET);
 		L2CCReg &= XPS_L2CC_AUX_REG_ZERO_MASK;
 		L2CCReg |= XPS_L2CC_AUX_REG_DEFAULT_MASK;
+		L2CCReg = (L2CCReg | L2AuxSet) & ~L2AuxClear;
 		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_AUX_CNTRL_OFFSET,
 			  L2CCReg);
 		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_TAG_RAM_CNTRL_OFFSET,
@@ -1638,4 +1656,362 @@ void Xil_L2CacheStoreLine(u32 adr)
 	/* synchronize the processor */
 	dsb();
 }
+
+/****************************************************************************
+*
+* Read or write the Auxiliary Control Register of this CPU.
+*
+****************************************************************************/
+static u32 Xil_A9ReadActlr(void)
+{
+	u32 Actlr;
+
+#ifdef __GNUC__
+	Actlr = mfcp(XREG_CP15_AUX_CONTROL);
+#elif defined (__ICCARM__)
+	mfcp(XREG_CP15_AUX_CONTROL, Actlr);
+#else
+	{ volatile register u32 Reg __asm(XREG_CP15_AUX_CONTROL);
+	  Actlr = Reg; }
+#endif
+
+	return Actlr;
+}
+
+static void Xil_A9WriteActlr(u32 Actlr)
+{
+	mtcp(XREG_CP15_AUX_CONTROL, Actlr);
+	isb();
+}
+
+/****************************************************************************
+*
+* Write the data and instruction lockdown registers of all masters.
+*
+* @param	Ways: ways no master may allocate into.
+*
+****************************************************************************/
+static void Xil_L2WriteLockdown(u32 Ways)
+{
+	u32 Master;
+	u32 Offset;
+
+	for (Master = 0U; Master < XPS_L2CC_LCKDWN_MASTERS; Master++) {
+		Offset = Master * XPS_L2CC_LCKDWN_STRIDE;
+		Xil_Out32(XPS_L2CC_BASEADDR +
+			  XPS_L2CC_CACHE_DLCKDWN_0_WAY_OFFSET + Offset, Ways);
+		Xil_Out32(XPS_L2CC_BASEADDR +
+			  XPS_L2CC_CACHE_ILCKDWN_0_WAY_OFFSET + Offset, Ways);
+	}
+	Xil_L2CacheSync();
+	dsb();
+}
+
+/****************************************************************************/
+/**
+* @brief	Set the L2 prefetch control register: double linefill,
+*			instruction and data prefetch, prefetch drop and the
+*			prefetch offset. The setting takes effect at once, the cache
+*			does not have to be disabled.
+*
+* @param	Ctrl: XPS_L2CC_PREFETCH_*_MASK bits ORed with the prefetch
+*			offset.
+*
+* @return	None.
+*
+* @note		Instruction and data prefetch are the same bits as in the
+*			auxiliary control register. With prefetch offsets other
+*			than 0-7, 15, 23 and 31 the prefetches are not done.
+*
+****************************************************************************/
+void Xil_L2CacheSetPrefetch(u32 Ctrl)
+{
+	Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_PREFETCH_CTRL_OFFSET, Ctrl);
+	dsb();
+}
+
+/****************************************************************************/
+/**
+* @brief	Get the L2 prefetch control register.
+*
+* @param	None.
+*
+* @return	XPS_L2CC_PREFETCH_*_MASK bits ORed with the prefetch offset.
+*
+* @note		None.
+*
+****************************************************************************/
+u32 Xil_L2CacheGetPrefetch(void)
+{
+	return Xil_In32(XPS_L2CC_BASEADDR + XPS_L2CC_PREFETCH_CTRL_OFFSET);
+}
+
+/****************************************************************************/
+/**
+* @brief	Change L2 auxiliary control bits, e.g. early BRESP or full line
+*			of zeros. The bits are kept and applied again by every
+*			Xil_L2CacheEnable. The auxiliary control register can
+*			only be written with the L2 cache disabled, so an enabled
+*			cache is flushed, disabled and enabled again.
+*
+* @param	Set: XPS_L2CC_AUX_*_MASK bits to set.
+* @param	Clear: XPS_L2CC_AUX_*_MASK bits to clear.
+*
+* @return	None.
+*
+* @note		Only the bits of XPS_L2CC_AUX_TUNE_MASK are changed. Full
+*			line of zeros is also switched in the ACTLR of the calling
+*			CPU, the other CPU has to set its ACTLR itself.
+*
+****************************************************************************/
+void Xil_L2CacheSetAuxCtrl(u32 Set, u32 Clear)
+{
+	u32 LocalSet = Set & XPS_L2CC_AUX_TUNE_MASK;
+	u32 LocalClear = Clear & XPS_L2CC_AUX_TUNE_MASK & ~LocalSet;
+	u32 Aux;
+	u32 currmask;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+
+	L2AuxSet = (L2AuxSet | LocalSet) & ~LocalClear;
+	L2AuxClear = (L2AuxClear | LocalClear) & ~LocalSet;
+
+	/* The CPU stops full lines of zeros before the L2 cache does */
+	if ((LocalClear & XPS_L2CC_AUX_FLZE_MASK) != 0U) {
+		Xil_A9WriteActlr(Xil_A9ReadActlr() & ~XIL_ACTLR_FLZ_MASK);
+	}
+
+	if ((Xil_In32(XPS_L2CC_BASEADDR + XPS_L2CC_CNTRL_OFFSET) &
+	     XPS_L2CC_ENABLE_MASK) != 0U) {
+		Xil_L2CacheDisable();
+		Xil_L2CacheEnable();
+	} else {
+		Aux = Xil_In32(XPS_L2CC_BASEADDR + XPS_L2CC_AUX_CNTRL_OFFSET);
+		Aux = (Aux | LocalSet) & ~LocalClear;
+		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_AUX_CNTRL_OFFSET, Aux);
+	}
+
+	if ((LocalSet & XPS_L2CC_AUX_FLZE_MASK) != 0U) {
+		Xil_A9WriteActlr(Xil_A9ReadActlr() | XIL_ACTLR_FLZ_MASK);
+	}
+
+	dsb();
+	mtcpsr(currmask);
+}
+
+/****************************************************************************/
+/**
+* @brief	Lock L2 ways. No master allocates new lines into a locked way,
+*			so the lines in it stay cached until the way is unlocked.
+*
+* @param	Ways: bit mask of the ways to lock.
+*
+* @return	None.
+*
+* @note		Xil_L2CacheFlush and Xil_L2CacheInvalidate also remove the
+*			lines of locked ways.
+*
+****************************************************************************/
+void Xil_L2CacheLockWays(u32 Ways)
+{
+	u32 currmask;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+	L2LockedWays |= Ways & XPS_L2CC_WAY_MASK;
+	Xil_L2WriteLockdown(L2LockedWays);
+	mtcpsr(currmask);
+}
+
+/****************************************************************************/
+/**
+* @brief	Unlock L2 ways locked with Xil_L2CacheLockWays or
+*			Xil_L2CacheLockRange.
+*
+* @param	Ways: bit mask of the ways to unlock.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void Xil_L2CacheUnlockWays(u32 Ways)
+{
+	u32 currmask;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+	L2LockedWays &= ~(Ways & XPS_L2CC_WAY_MASK);
+	Xil_L2WriteLockdown(L2LockedWays);
+	mtcpsr(currmask);
+}
+
+/****************************************************************************/
+/**
+* @brief	Load an address range into an L2 way and lock the way, e.g.
+*			for a hot lookup table. The range is flushed, then read with
+*			all other ways locked so that its lines are allocated in
+*			Way, and Way is locked afterwards.
+*
+* @param	Way: way to load, 0 to XPS_L2CC_WAYS - 1.
+* @param	adr: 32bit start address of the range.
+* @param	len: Length of the range in bytes, at most XPS_L2CC_WAY_SIZE.
+*
+* @return	None.
+*
+* @note		While the range is loaded, other masters can only allocate
+*			into Way too; call it while the other CPU and the ACP masters
+*			are idle. The lines stay writable.
+*
+****************************************************************************/
+void Xil_L2CacheLockRange(u32 Way, u32 adr, u32 len)
+{
+	const u32 cacheline = 32U;
+	u32 LocalAddr = adr & ~(cacheline - 1U);
+	u32 Count;
+	u32 currmask;
+
+	if ((Way >= XPS_L2CC_WAYS) || (len == 0U) ||
+	    (len > XPS_L2CC_WAY_SIZE)) {
+		return;
+	}
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+
+	/* Nothing of the range may be cached in another way */
+	Xil_DCacheFlushRange((INTPTR)adr, len);
+
+	Xil_L2WriteLockdown(XPS_L2CC_WAY_MASK & ~((u32)1U << Way));
+
+	Count = ((adr + len) - LocalAddr + cacheline - 1U) / cacheline;
+	while (Count != 0U) {
+		(void)Xil_In32(LocalAddr);
+		LocalAddr += cacheline;
+		Count--;
+	}
+	dsb();
+
+	L2LockedWays |= (u32)1U << Way;
+	Xil_L2WriteLockdown(L2LockedWays);
+
+	mtcpsr(currmask);
+}
+
+/****************************************************************************/
+/**
+* @brief	Flush an address range from the L1 and L2 data caches like
+*			Xil_DCacheFlushRange, with interrupts masked only for
+*			XIL_CACHE_BG_CHUNK lines at a time. Large flushes then do
+*			not delay interrupts by the time of the whole range.
+*
+*			Without the PL310 erratum 727915 workaround, ranges of the
+*			L2 size or more are flushed with a background clean and
+*			invalidate by way, polled with interrupts enabled. Interrupt
+*			handlers must not do L2 maintenance while it runs.
+*
+* @param	adr: 32bit start address of the range to be flushed.
+* @param	len: Length of the range to be flushed in bytes.
+*
+* @return	None.
+*
+* @note		The Zynq PL310 needs the erratum 727915 workaround, so it
+*			always flushes by address.
+*
+****************************************************************************/
+void Xil_DCacheFlushRangeBg(INTPTR adr, u32 len)
+{
+	const u32 cacheline = 32U;
+	u32 LocalAddr = (u32)adr & ~(cacheline - 1U);
+	u32 Count;
+	u32 Chunk;
+	u32 OnlyL1 = 0U;
+	u32 currmask;
+	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
+				    XPS_L2CC_CACHE_INV_CLN_PA_OFFSET);
+
+	if (len == 0U) {
+		return;
+	}
+	Count = (((u32)adr + len) - LocalAddr + cacheline - 1U) / cacheline;
+
+#if !defined (CONFIG_PL310_ERRATA_727915)
+	if ((len >= XIL_CACHE_BG_WAY_MIN) && (L2LockedWays == 0U)) {
+		OnlyL1 = 1U;
+	}
+#endif
+
+	while (Count != 0U) {
+		Chunk = (Count < XIL_CACHE_BG_CHUNK) ? Count :
+							XIL_CACHE_BG_CHUNK;
+		Count -= Chunk;
+
+		currmask = mfcpsr();
+		mtcpsr(currmask | IRQ_FIQ_MASK);
+		while (Chunk != 0U) {
+#if defined (__GNUC__) || defined (__ICCARM__)
+			asm_cp15_clean_inval_dc_line_mva_poc(LocalAddr);
+#else
+			{ volatile register u32 Reg
+				__asm(XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC);
+			  Reg = LocalAddr; }
+#endif
+			if (OnlyL1 == 0U) {
+				*L2CCOffset = LocalAddr;
+				Xil_L2CacheSync();
+			}
+			LocalAddr += cacheline;
+			Chunk--;
+		}
+		dsb();
+		mtcpsr(currmask);
+	}
+
+	if (OnlyL1 != 0U) {
+		currmask = mfcpsr();
+		mtcpsr(currmask | IRQ_FIQ_MASK);
+		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_INV_CLN_WAY_OFFSET,
+			  XPS_L2CC_WAY_MASK);
+		mtcpsr(currmask);
+
+		while ((Xil_In32(XPS_L2CC_BASEADDR +
+				 XPS_L2CC_CACHE_INV_CLN_WAY_OFFSET) &
+			XPS_L2CC_WAY_MASK) != 0U) {
+			;
+		}
+
+		currmask = mfcpsr();
+		mtcpsr(currmask | IRQ_FIQ_MASK);
+		Xil_L2CacheSync();
+		dsb();
+		mtcpsr(currmask);
+	}
+}
+
+/****************************************************************************/
+/**
+* @brief	Enable or disable speculative linefills of the SCU to the L2
+*			cache.
+*
+* @param	Enable: 1 to enable, 0 to disable.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void Xil_ScuSetSpeculativeLinefill(u32 Enable)
+{
+	u32 Ctrl;
+
+	Ctrl = Xil_In32(XPS_SCU_PERIPH_BASE + XPS_SCU_CTRL_OFFSET);
+	if (Enable != 0U) {
+		Ctrl |= XPS_SCU_CTRL_SPEC_LINEFILL_MASK;
+	} else {
+		Ctrl &= ~XPS_SCU_CTRL_SPEC_LINEFILL_MASK;
+	}
+	Xil_Out32(XPS_SCU_PERIPH_BASE + XPS_SCU_CTRL_OFFSET, Ctrl);
+	dsb();
+}
 #endif
@@ -46,6 +46,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.00a ecm  01/24/10 First release
+* 6.6   ag   10/14/26 Added L2 prefetch, auxiliary control, way lockdown and
+*                     interruptible flush APIs.
 * </pre>
 *
 ******************************************************************************/
@@ -90,6 +92,15 @@ void Xil_L2CacheFlushLine(u32 adr);
 void Xil_L2CacheFlushRange(u32 adr, u32 len);
 void Xil_L2CacheStoreLine(u32 adr);
 
+void Xil_L2CacheSetPrefetch(u32 Ctrl);
+u32 Xil_L2CacheGetPrefetch(void);
+void Xil_L2CacheSetAuxCtrl(u32 Set, u32 Clear);
+void Xil_L2CacheLockWays(u32 Ways);
+void Xil_L2CacheUnlockWays(u32 Ways);
+void Xil_L2CacheLockRange(u32 Way, u32 adr, u32 len);
+void Xil_DCacheFlushRangeBg(INTPTR adr, u32 len);
+void Xil_ScuSetSpeculativeLinefill(u32 Enable);
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,7 @@
 * 1.00a sdm  02/01/10 Initial version
 * 3.10a srt 04/18/13 Implemented ARM Erratas. Please refer to file
 *		      'xil_errata.h' for errata description
+* 6.6   ag   10/14/26 Added prefetch control, lockdown and way definitions.
 * </pre>
 *
 * @note
@@ -114,6 +115,11 @@ extern "C" {
 #define XPS_L2CC_ADDR_FILTER_END_OFFSET		0x0C04U		/* Start of address filtering */
 
 #define XPS_L2CC_DEBUG_CTRL_OFFSET		0x0F40U		/* Debug Control Register */
+#define XPS_L2CC_PREFETCH_CTRL_OFFSET		0x0F60U		/* Prefetch Control Register */
+#define XPS_L2CC_POWER_CTRL_OFFSET		0x0F80U		/* Power Control Register */
+
+#define XPS_L2CC_LCKDWN_STRIDE			0x0008U		/* Offset between lockdown register pairs */
+#define XPS_L2CC_LCKDWN_MASTERS			8U		/* Number of lockdown register pairs */
 
 /* XPS_L2CC_CNTRL_OFFSET bit masks */
 #define XPS_L2CC_ENABLE_MASK		0x00000001U	/* enables the L2CC */
@@ -142,6 +148,26 @@ extern "C" {
                                                     /* Event monitor bus enable and Way Size (64 KB) */
 #define XPS_L2CC_AUX_REG_ZERO_MASK	0xFFF1FFFFU	/* */
 
+#define XPS_L2CC_AUX_TUNE_MASK		0x70000C01U	/* Bits Xil_L2CacheSetAuxCtrl may change: */
+                                                    /* early BRESP, prefetching, store buffer */
+                                                    /* device limitation, high priority SO/Dev */
+                                                    /* reads and full line of zero */
+
+/* XPS_L2CC_PREFETCH_CTRL_OFFSET bit masks */
+#define XPS_L2CC_PREFETCH_DLF_MASK	0x40000000U	/* Double linefill enable */
+#define XPS_L2CC_PREFETCH_IPF_MASK	0x20000000U	/* Instruction prefetch enable */
+#define XPS_L2CC_PREFETCH_DPF_MASK	0x10000000U	/* Data prefetch enable */
+#define XPS_L2CC_PREFETCH_DLF_WRAP_DIS_MASK 0x08000000U	/* Double linefill on WRAP read disable */
+#define XPS_L2CC_PREFETCH_DROP_MASK	0x01000000U	/* Prefetch drop enable */
+#define XPS_L2CC_PREFETCH_INCR_DLF_MASK	0x00800000U	/* Incr double linefill enable */
+#define XPS_L2CC_PREFETCH_NSID_MASK	0x00200000U	/* Not same ID on exclusive sequence enable */
+#define XPS_L2CC_PREFETCH_OFFSET_MASK	0x0000001FU	/* Prefetch offset */
+
+/* Ways of the L2 cache */
+#define XPS_L2CC_WAYS			8U		/* 8-way associative */
+#define XPS_L2CC_WAY_MASK		0x000000FFU	/* All ways */
+#define XPS_L2CC_WAY_SIZE		0x00010000U	/* 64 KB per way */
+
 #define XPS_L2CC_TAG_RAM_DEFAULT_MASK	0x00000111U	/* latency for TAG RAM */
 #define XPS_L2CC_DATA_RAM_DEFAULT_MASK	0x00000121U	/* latency for DATA RAM */
 
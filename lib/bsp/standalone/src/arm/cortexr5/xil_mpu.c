@@ -51,6 +51,11 @@
 * 					  Xil_InitializeExistingMPURegConfig.
 * 					  Added a new array of structure of type XMpuConfig to
 * 					  represent the MPU configuration table.
+* 6.6   ag   10/14/26 Added Xil_SetMPURegionRange, which covers a range with
+* 					  the fewest regions using subregions and places them
+* 					  above the regions they overlap. The size field is
+* 					  masked when the configuration table is updated, so
+* 					  regions with disabled subregions are recorded too.
 * </pre>
 *
 *
@@ -68,8 +73,21 @@
 
 /**************************** Type Definitions *******************************/
 
+/* One region of a range split by Xil_SetMPURegionRange */
+typedef struct {
+	u64 BaseAddress;
+	u32 Encoding;
+	u32 SubRegDisable;
+} XMpuRangeRegion;
+
 /************************** Constant Definitions *****************************/
 
+/* Regions of 256 bytes and more have 8 subregions that can be disabled */
+#define MPU_SUBREG_MIN_SIZE		0x100U
+#define MPU_SUBREG_COUNT		8U
+#define MPU_REG_SIZE_MASK		0x3EU
+#define MPU_REG_SRD_SHIFT		8U
+
 /************************** Variable Definitions *****************************/
 
 static const struct {
@@ -315,7 +333,7 @@ u32 Xil_UpdateMPUConfig(u32 reg_num, INTPTR address, u32 size, u32 attrib)
 	if (size & REGION_EN) {
 		Mpu_Config[reg_num].RegionStatus = MPU_REG_ENABLED;
 		Mpu_Config[reg_num].BaseAddress = address;
-		Tempsize &= (~REGION_EN);
+		Tempsize &= MPU_REG_SIZE_MASK;
 		Tempsize >>= 1;
 		/* Lookup the size.  */
 		for (Index = 0; Index <
@@ -541,7 +559,7 @@ void Xil_InitializeExistingMPURegConfig(void)
 			Mpu_Config[Index].RegionStatus = MPU_REG_ENABLED;
 			Mpu_Config[Index].BaseAddress = MPURegBA;
 			Mpu_Config[Index].Attribute = MPURegAttrib;
-			Tempsize = MPURegSize & (~REGION_EN);
+			Tempsize = MPURegSize & MPU_REG_SIZE_MASK;
 			Tempsize >>= 1;
 			for (Index1 = 0; Index1 <
 				(sizeof (region_size) / sizeof (region_size[0])); Index1++) {
@@ -577,3 +595,171 @@ u32 Xil_GetNextMPURegion(void)
 	}
 	return NextAvailableReg;
 }
+
+/*****************************************************************************/
+/**
+* @brief    Splits a range into the fewest MPU regions. Each region is the
+*           naturally aligned power of two that covers the most of the rest
+*           of the range, with the subregions outside the range disabled.
+*
+* @param	Addr: start of the range, 32 byte aligned.
+* @param	End: end of the range (exclusive), 32 byte aligned.
+* @param	Regions: array of MAX_POSSIBLE_MPU_REGS entries for the result.
+* @return	Number of regions, 0 if more than MAX_POSSIBLE_MPU_REGS are
+*           needed.
+*
+*
+******************************************************************************/
+static u32 Xil_SplitMPURange(u64 Addr, u64 End, XMpuRangeRegion *Regions)
+{
+	u64 Base;
+	u64 Top;
+	u64 SubSize;
+	u64 Cover;
+	u64 BestCover;
+	u64 BestTop = 0U;
+	u32 Best = 0U;
+	u32 Count = 0U;
+	u32 Index;
+	u32 Sub;
+
+	while (Addr < End) {
+		if (Count == MAX_POSSIBLE_MPU_REGS) {
+			return 0U;
+		}
+
+		BestCover = 0U;
+		for (Index = 0U; Index <
+				sizeof region_size / sizeof region_size[0]; Index++) {
+			SubSize = region_size[Index].size;
+			if (SubSize >= MPU_SUBREG_MIN_SIZE) {
+				SubSize /= MPU_SUBREG_COUNT;
+			}
+			Base = Addr & ~(region_size[Index].size - 1U);
+			Top = Base + region_size[Index].size;
+			if (Top > End) {
+				Top = End;
+			}
+			/* both ends of the range must be subregion boundaries */
+			if ((((Addr - Base) % SubSize) != 0U) ||
+					(((Top - Base) % SubSize) != 0U)) {
+				continue;
+			}
+			Cover = Top - Addr;
+			if (Cover > BestCover) {
+				BestCover = Cover;
+				BestTop = Top;
+				Best = Index;
+			}
+		}
+		if (BestCover == 0U) {
+			return 0U;
+		}
+
+		Base = Addr & ~(region_size[Best].size - 1U);
+		Regions[Count].BaseAddress = Base;
+		Regions[Count].Encoding = region_size[Best].encoding;
+		Regions[Count].SubRegDisable = 0U;
+		if (region_size[Best].size >= MPU_SUBREG_MIN_SIZE) {
+			SubSize = region_size[Best].size / MPU_SUBREG_COUNT;
+			for (Sub = 0U; Sub < MPU_SUBREG_COUNT; Sub++) {
+				if (((Base + (Sub * SubSize)) < Addr) ||
+					((Base + (Sub * SubSize)) >= BestTop)) {
+					Regions[Count].SubRegDisable |= (1U << Sub);
+				}
+			}
+		}
+		Count++;
+		Addr = BestTop;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Sets the memory attributes for an arbitrary range with as few
+*           MPU regions as possible. Unlike Xil_SetMPURegion, the range is
+*           not rounded up to one power of two region: it is split into
+*           naturally aligned regions whose subregions outside the range are
+*           disabled. The regions get numbers above every enabled region that
+*           overlaps the range, so that they take priority over the boot
+*           time regions (a higher region number wins in the R5 MPU).
+*
+* @param	addr: 32-bit start address of the range, 32 byte aligned.
+* @param	size: size of the range, multiple of 32 bytes.
+* @param	attrib: Attribute for the given memory region.
+* @return	XST_SUCCESS: If the range is covered.
+* 			XST_FAILURE: If the range is not 32 byte aligned or not
+* 			enough free regions are left above the overlapping regions.
+* 			No region is changed in that case.
+*
+*
+******************************************************************************/
+u32 Xil_SetMPURegionRange(INTPTR addr, u64 size, u32 attrib)
+{
+	XMpuRangeRegion Regions[MAX_POSSIBLE_MPU_REGS];
+	u32 RegNum[MAX_POSSIBLE_MPU_REGS];
+	u64 Start = (u64)(UINTPTR)addr;
+	u64 End = Start + size;
+	u32 Count;
+	u32 Index;
+	u32 Found = 0U;
+	u32 Lowest = 0U;
+	u32 Regionsize;
+
+	if ((size == 0U) || (((Start | size) & 0x1FU) != 0U) ||
+			(End > 0x100000000ULL)) {
+		xdbg_printf(DEBUG, "Invalid range\r\n");
+		return XST_FAILURE;
+	}
+
+	Count = Xil_SplitMPURange(Start, End, Regions);
+	if (Count == 0U) {
+		xdbg_printf(DEBUG, "Range needs too many regions\r\n");
+		return XST_FAILURE;
+	}
+
+	/* the new regions have to be above every region they overlap */
+	for (Index = 0U; Index < MAX_POSSIBLE_MPU_REGS; Index++) {
+		if ((Mpu_Config[Index].RegionStatus == MPU_REG_ENABLED) &&
+			((u64)(UINTPTR)Mpu_Config[Index].BaseAddress < End) &&
+			(((u64)(UINTPTR)Mpu_Config[Index].BaseAddress +
+					Mpu_Config[Index].Size) > Start)) {
+			Lowest = Index + 1U;
+		}
+	}
+	for (Index = Lowest; (Index < MAX_POSSIBLE_MPU_REGS) &&
+					(Found < Count); Index++) {
+		if (Mpu_Config[Index].RegionStatus != MPU_REG_ENABLED) {
+			RegNum[Found] = Index;
+			Found++;
+		}
+	}
+	if (Found < Count) {
+		xdbg_printf(DEBUG, "No regions available\r\n");
+		return XST_FAILURE;
+	}
+
+	Xil_DCacheFlush();
+	Xil_ICacheInvalidate();
+
+	for (Index = 0U; Index < Count; Index++) {
+		Regionsize = Regions[Index].Encoding << 1;
+		Regionsize |= Regions[Index].SubRegDisable << MPU_REG_SRD_SHIFT;
+		Regionsize |= REGION_EN;
+
+		mtcp(XREG_CP15_MPU_MEMORY_REG_NUMBER, RegNum[Index]);
+		isb();
+		dsb();
+		mtcp(XREG_CP15_MPU_REG_BASEADDR, (u32)Regions[Index].BaseAddress);
+		mtcp(XREG_CP15_MPU_REG_ACCESS_CTRL, attrib);
+		mtcp(XREG_CP15_MPU_REG_SIZE_EN, Regionsize);
+		dsb();
+		isb();
+		Xil_UpdateMPUConfig(RegNum[Index],
+				(INTPTR)Regions[Index].BaseAddress, Regionsize, attrib);
+	}
+
+	return XST_SUCCESS;
+}
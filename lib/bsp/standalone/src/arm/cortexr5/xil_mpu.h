@@ -54,6 +54,12 @@
 *| OCM                   | 0xFFFC0000 - 0xFFFFFFFF | Normal write-back Cacheable |
 *
 *
+* Xil_SetMPURegionRange sets the attributes of an arbitrary 32 byte aligned
+* range, for example a TCM or OCM buffer for DMA descriptors. It uses the
+* fewest regions by disabling the subregions outside the range and only
+* programs the MPU when enough free regions exist above the regions the range
+* overlaps, as a higher region number takes priority.
+*
 * @note
 * For a system where DDR is less than 2GB, region after DDR and before PL is
 * marked as undefined in translation table. Memory range 0xFE000000-0xFEFFFFFF is
@@ -75,6 +81,7 @@
 * 					  Xil_InitializeExistingMPURegConfig.
 * 					  Added a new array of structure of type XMpuConfig to
 * 					  represent the MPU configuration table.
+* 6.6   ag   10/14/26 Added Xil_SetMPURegionRange.
 * </pre>
 *
 
@@ -123,6 +130,7 @@ u32 Xil_GetNextMPURegion(void);
 u32 Xil_DisableMPURegionByRegNum (u32 reg_num);
 u16 Xil_GetMPUFreeRegMask (void);
 u32 Xil_SetMPURegionByRegNum (u32 reg_num, INTPTR addr, u64 size, u32 attrib);
+u32 Xil_SetMPURegionRange(INTPTR addr, u64 size, u32 attrib);
 
 #ifdef __cplusplus
 }
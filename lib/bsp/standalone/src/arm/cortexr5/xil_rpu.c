@@ -0,0 +1,318 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+* @file xil_rpu.c
+*
+* This file contains the split mode dual core APIs of the Cortex R5: core
+* dispatch and the shared memory message queues. See xil_rpu.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xil_rpu.h"
+#include "xil_io.h"
+#include "xil_mpu.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexr5.h"
+#include "xstatus.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**************************** Type Definitions *******************************/
+
+/************************** Constant Definitions *****************************/
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Prototypes ******************************/
+
+/*****************************************************************************/
+/**
+* @brief    Returns the ID of the calling R5 core.
+*
+* @param	None.
+* @return	XRPU_CORE_0 or XRPU_CORE_1.
+*
+******************************************************************************/
+u32 Xil_RpuGetCoreId(void)
+{
+	u32 Mpidr;
+
+#if defined (__GNUC__)
+	Mpidr = mfcp(XREG_CP15_MULTI_PROC_AFFINITY);
+#elif defined (__ICCARM__)
+	mfcp(XREG_CP15_MULTI_PROC_AFFINITY, Mpidr);
+#endif
+
+	return Mpidr & 0xFFU;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Returns whether the RPU runs in split mode.
+*
+* @param	None.
+* @return	1 in split mode, 0 in lockstep mode.
+*
+******************************************************************************/
+u32 Xil_RpuIsSplitMode(void)
+{
+	return ((Xil_In32(XRPU_GLBL_CNTL) & XRPU_GLBL_CNTL_SLSPLIT_MASK) != 0U) ?
+								1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Runs the entry function of the calling core. In split mode core
+*           0 runs Core0Entry and core 1 runs Core1Entry. In lockstep mode
+*           Core0Entry runs first and Core1Entry runs when it returns.
+*
+* @param	Core0Entry: entry function of core 0, may be NULL.
+* @param	Core1Entry: entry function of core 1, may be NULL.
+* @param	Data: argument passed to the entry function.
+* @return	None.
+*
+******************************************************************************/
+void Xil_RpuDispatch(XRpu_Entry Core0Entry, XRpu_Entry Core1Entry,
+							void *Data)
+{
+	if (Xil_RpuIsSplitMode() == 0U) {
+		if (Core0Entry != NULL) {
+			Core0Entry(Data);
+		}
+		if (Core1Entry != NULL) {
+			Core1Entry(Data);
+		}
+	} else if (Xil_RpuGetCoreId() == XRPU_CORE_0) {
+		if (Core0Entry != NULL) {
+			Core0Entry(Data);
+		}
+	} else {
+		if (Core1Entry != NULL) {
+			Core1Entry(Data);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief    Maps a memory range shared by both cores as normal non-cacheable
+*           shareable memory in the MPU of the calling core. Each core has to
+*           map the range before it uses a queue in it.
+*
+* @param	Addr: start of the range, 32 byte aligned.
+* @param	Size: size of the range, multiple of 32 bytes.
+* @return	XST_SUCCESS or XST_FAILURE, see Xil_SetMPURegionRange().
+*
+******************************************************************************/
+u32 Xil_RpuShareRegion(INTPTR Addr, u64 Size)
+{
+	return Xil_SetMPURegionRange(Addr, Size,
+				NORM_SHARED_NCACHE | PRIV_RW_USER_RW);
+}
+
+/*****************************************************************************/
+/**
+* @brief    Creates a queue in shared memory and attaches to it. Only one of
+*           the two cores creates a queue, the other one attaches to it.
+*
+* @param	Queue: local queue handle.
+* @param	Addr: address of the queue in shared memory, 32 byte aligned and
+*           XRPU_QUEUE_SIZE(Depth, MsgSize) bytes long.
+* @param	Depth: number of messages, a power of two.
+* @param	MsgSize: size of a message in bytes.
+* @return	XST_SUCCESS, or XST_INVALID_PARAM for a bad depth or address.
+*
+******************************************************************************/
+s32 Xil_RpuQueueCreate(XRpu_Queue *Queue, INTPTR Addr, u32 Depth,
+							u32 MsgSize)
+{
+	XRpu_QueueShm *Shm = (XRpu_QueueShm *)Addr;
+
+	if ((Queue == NULL) || ((Addr & 0x1F) != 0) || (MsgSize == 0U) ||
+		(Depth == 0U) || ((Depth & (Depth - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Shm->Magic = 0U;
+	Shm->Head = 0U;
+	Shm->Tail = 0U;
+	Shm->Depth = Depth;
+	Shm->MsgSize = MsgSize;
+	dmb();
+	/* the other core may attach once the magic is visible */
+	Shm->Magic = XRPU_QUEUE_MAGIC;
+	dsb();
+
+	return Xil_RpuQueueAttach(Queue, Addr);
+}
+
+/*****************************************************************************/
+/**
+* @brief    Attaches to a queue created by the other core.
+*
+* @param	Queue: local queue handle.
+* @param	Addr: address of the queue in shared memory.
+* @return	XST_SUCCESS, or XST_NOT_ENABLED when the queue is not created
+*           yet, in which case the call can be retried.
+*
+******************************************************************************/
+s32 Xil_RpuQueueAttach(XRpu_Queue *Queue, INTPTR Addr)
+{
+	XRpu_QueueShm *Shm = (XRpu_QueueShm *)Addr;
+
+	if (Queue == NULL) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (Shm->Magic != XRPU_QUEUE_MAGIC) {
+		return XST_NOT_ENABLED;
+	}
+	dmb();
+
+	Queue->Shm = Shm;
+	Queue->Data = (u8 *)Addr + sizeof(XRpu_QueueShm);
+	Queue->Depth = Shm->Depth;
+	Queue->MsgSize = Shm->MsgSize;
+	Queue->Notify = NULL;
+	Queue->NotifyRef = NULL;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Sets the callback the producer calls when it sends a message to an
+*           empty queue, for example to trigger an IPI to the consumer.
+*
+* @param	Queue: local queue handle of the producer.
+* @param	Notify: callback, NULL to poll only.
+* @param	CallBackRef: argument of the callback.
+* @return	None.
+*
+******************************************************************************/
+void Xil_RpuQueueSetNotify(XRpu_Queue *Queue, XRpu_Notify Notify,
+							void *CallBackRef)
+{
+	Queue->Notify = Notify;
+	Queue->NotifyRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Sends a message. Must only be called by the producer.
+*
+* @param	Queue: local queue handle.
+* @param	Msg: message of MsgSize bytes.
+* @return	XST_SUCCESS, or XST_FIFO_NO_ROOM when the queue is full.
+*
+******************************************************************************/
+s32 Xil_RpuQueueSend(XRpu_Queue *Queue, const void *Msg)
+{
+	u32 Head = Queue->Shm->Head;
+	u32 Tail = Queue->Shm->Tail;
+
+	if ((Head - Tail) >= Queue->Depth) {
+		return XST_FIFO_NO_ROOM;
+	}
+
+	(void)memcpy(Queue->Data + ((Head & (Queue->Depth - 1U)) *
+				Queue->MsgSize), Msg, Queue->MsgSize);
+
+	/* the message is visible before the head that publishes it */
+	dmb();
+	Queue->Shm->Head = Head + 1U;
+	dsb();
+
+	/* the consumer may only wait when the queue was empty */
+	if ((Head == Tail) && (Queue->Notify != NULL)) {
+		Queue->Notify(Queue->NotifyRef);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Receives a message. Must only be called by the consumer. A
+*           consumer that waits for the notification after XST_NO_DATA does
+*           not miss a message, as the producer notifies on every send to an
+*           empty queue.
+*
+* @param	Queue: local queue handle.
+* @param	Msg: buffer of MsgSize bytes for the message.
+* @return	XST_SUCCESS, or XST_NO_DATA when the queue is empty.
+*
+******************************************************************************/
+s32 Xil_RpuQueueReceive(XRpu_Queue *Queue, void *Msg)
+{
+	u32 Tail = Queue->Shm->Tail;
+
+	if (Queue->Shm->Head == Tail) {
+		return XST_NO_DATA;
+	}
+
+	/* the message is read after the head that published it */
+	dmb();
+	(void)memcpy(Msg, Queue->Data + ((Tail & (Queue->Depth - 1U)) *
+				Queue->MsgSize), Queue->MsgSize);
+
+	/* the message is read before the slot is handed back */
+	dmb();
+	Queue->Shm->Tail = Tail + 1U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief    Returns the number of messages in a queue.
+*
+* @param	Queue: local queue handle.
+* @return	Number of messages sent and not yet received.
+*
+******************************************************************************/
+u32 Xil_RpuQueueCount(const XRpu_Queue *Queue)
+{
+	return Queue->Shm->Head - Queue->Shm->Tail;
+}
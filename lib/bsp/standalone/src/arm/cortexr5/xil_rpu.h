@@ -0,0 +1,149 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+* @file xil_rpu.h
+*
+* @addtogroup r5_rpu_apis Cortex R5 Split Mode Dual Core APIs
+*
+* These functions help to split a workload across both R5 cores in split
+* mode.
+*
+* - Xil_RpuDispatch() runs the entry function of the calling core, so the
+*   same image can be loaded to both cores. The image has to be linked to the
+*   TCM, which is private to each core at the same local address, and the
+*   FSBL loads one copy per core when the boot image lists the ELF for both
+*   R5-0 and R5-1. In lockstep mode both entry functions run in turn on the
+*   single logical core.
+* - The queues are single producer / single consumer rings in shared memory
+*   such as OCM. The producer only writes the head and the consumer only
+*   writes the tail, so no lock or exclusive access is needed; data
+*   barriers order the message and the index update. The shared memory must
+*   be mapped non-cacheable on both cores, see Xil_RpuShareRegion(), as the
+*   L1 caches of the two cores are not coherent.
+* - A notify callback, typically a wrapper around XIpiPsu_TriggerIpi(), is
+*   called when a message is sent to an empty queue, so the consumer only
+*   gets an interrupt when it may be waiting.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_RPU_H
+#define XIL_RPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XRPU_CORE_0		0U
+#define XRPU_CORE_1		1U
+
+#define XRPU_GLBL_CNTL			0xFF9A0000U
+#define XRPU_GLBL_CNTL_SLSPLIT_MASK	0x00000008U
+
+#define XRPU_QUEUE_MAGIC	0x52505551U
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* Bytes of shared memory used by a queue */
+#define XRPU_QUEUE_SIZE(Depth, MsgSize)	\
+	(sizeof(XRpu_QueueShm) + ((u32)(Depth) * (u32)(MsgSize)))
+
+/**************************** Type Definitions *******************************/
+
+typedef void (*XRpu_Entry)(void *Data);
+typedef void (*XRpu_Notify)(void *CallBackRef);
+
+/*
+ * Queue header in shared memory, the messages follow it. Head and tail are
+ * free running counters on cache lines of their own.
+ */
+typedef struct {
+	volatile u32 Head;	/* written by the producer only */
+	u32 Reserved0[7];
+	volatile u32 Tail;	/* written by the consumer only */
+	u32 Reserved1[7];
+	volatile u32 Magic;	/* set once the queue is created */
+	u32 Depth;
+	u32 MsgSize;
+	u32 Reserved2[5];
+} XRpu_QueueShm;
+
+/* Local handle of a queue, one per core */
+typedef struct {
+	XRpu_QueueShm *Shm;
+	u8 *Data;
+	u32 Depth;
+	u32 MsgSize;
+	XRpu_Notify Notify;
+	void *NotifyRef;
+} XRpu_Queue;
+
+/************************** Function Prototypes ******************************/
+
+u32 Xil_RpuGetCoreId(void);
+u32 Xil_RpuIsSplitMode(void);
+void Xil_RpuDispatch(XRpu_Entry Core0Entry, XRpu_Entry Core1Entry,
+							void *Data);
+u32 Xil_RpuShareRegion(INTPTR Addr, u64 Size);
+
+s32 Xil_RpuQueueCreate(XRpu_Queue *Queue, INTPTR Addr, u32 Depth,
+							u32 MsgSize);
+s32 Xil_RpuQueueAttach(XRpu_Queue *Queue, INTPTR Addr);
+void Xil_RpuQueueSetNotify(XRpu_Queue *Queue, XRpu_Notify Notify,
+							void *CallBackRef);
+s32 Xil_RpuQueueSend(XRpu_Queue *Queue, const void *Msg);
+s32 Xil_RpuQueueReceive(XRpu_Queue *Queue, void *Msg);
+u32 Xil_RpuQueueCount(const XRpu_Queue *Queue);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* XIL_RPU_H */
+/**
+* @} End of "addtogroup r5_rpu_apis".
+*/
@@ -18,6 +18,7 @@
  * print -- do a raw print of a string
  */
 #include "xil_printf.h"
+#include "xil_console.h"
 
 void print(const char8 *ptr)
 {
@@ -25,10 +26,12 @@ void print(const char8 *ptr)
 	XPVXenConsole_Write(ptr);
 #else
 #ifdef STDOUT_BASEADDRESS
+  XIL_CONSOLE_BEGIN();
   while (*ptr != (char8)0) {
-    outbyte (*ptr);
+    XIL_CONSOLE_PUTC(*ptr);
 	ptr++;
   }
+  XIL_CONSOLE_END();
 #else
 (void)ptr;
 #endif
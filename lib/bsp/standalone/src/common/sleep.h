@@ -44,6 +44,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 6.6   srm  11/02/17 Added processor specific sleep rountines
 *								 function prototypes.
+* 6.6   ag   10/14/26 Added the sleep hook and Xil_poll_timeout_backoff.
 *
 * </pre>
 *
@@ -59,6 +60,32 @@
 extern "C" {
 #endif
 
+/************************** Constant Definitions *****************************/
+
+#define XIL_POLL_BACKOFF_MAX_US		1000U	/**< Longest single wait of
+						  *  Xil_poll_timeout_backoff */
+
+/**************************** Type Definitions *******************************/
+
+/*****************************************************************************/
+/**
+*
+* Sleep hook, called by sleep() and usleep() instead of busy-waiting. An RTOS
+* can yield the processor to other tasks and a baremetal application can put
+* it in a low power state until a timer wakes it up.
+*
+* @param            CallBackRef - reference given to Xil_SetSleepHook
+* @param            useconds - delay time in micro seconds
+*
+* @return           The part of the delay the hook did not wait, in micro
+*                   seconds, which is then busy-waited. Returning useconds
+*                   makes the call a plain busy-wait, e.g. when the hook
+*                   cannot block in the current context.
+*
+*****************************************************************************/
+typedef unsigned long (*Xil_SleepHook) (void *CallBackRef,
+					unsigned long useconds);
+
 /*****************************************************************************/
 /**
 *
@@ -101,6 +128,52 @@ extern "C" {
 	(timeout>0) ? 0 : -1;  \
  }  )
 
+/*****************************************************************************/
+/**
+*
+* This macro polls an address until a condition is met or till the timeout
+* occurs, like Xil_poll_timeout, but waits 1us after the first read and then
+* doubles the wait after each read, up to XIL_POLL_BACKOFF_MAX_US. Conditions
+* met quickly are seen quickly, and long waits read the register rarely and
+* let the sleep hook yield the processor.
+*
+* @param            IO_func - accessor function to read the register contents.
+*                   Depends on the register width.
+* @param            ADDR - Address to be polled
+* @param            VALUE - variable to read the value
+* @param            COND - Condition to checked (usually involves VALUE)
+* @param            TIMEOUT_US - timeout in micro seconds
+*
+* @return           0 - when the condition is met
+*                   -1 - when the condition is not met till the timeout period
+*
+* @note             none
+*
+*****************************************************************************/
+#define Xil_poll_timeout_backoff(IO_func, ADDR, VALUE, COND, TIMEOUT_US) \
+ ( {	  \
+	u64 remaining = (u64)(TIMEOUT_US);    \
+	u64 wait = 1U;    \
+	s32 result = -1;    \
+	for(;;) { \
+		VALUE = IO_func(ADDR); \
+		if(COND) { \
+			result = 0;  \
+			break; \
+		}    \
+		if(remaining == 0U) \
+			break;  \
+		if(wait > remaining) \
+			wait = remaining;  \
+		usleep((unsigned long)wait);  \
+		remaining -= wait; \
+		if(wait < XIL_POLL_BACKOFF_MAX_US) \
+			wait <<= 1;  \
+	}    \
+	result;  \
+ }  )
+
+void Xil_SetSleepHook(Xil_SleepHook Hook, void *CallBackRef);
 void usleep(unsigned long useconds);
 void sleep(unsigned int seconds);
 int usleep_R5(unsigned long useconds);
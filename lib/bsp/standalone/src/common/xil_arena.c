@@ -0,0 +1,550 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_arena.c
+*
+* This file contains the memory arenas and fixed size block pools. See
+* xil_arena.h for a description of the service.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xil_arena.h"
+#include "xil_assert.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+#if defined (__aarch64__) || defined (ARMA9) || defined (ARMA53_32)
+#include "xil_mmu.h"
+#elif defined (ARMR5)
+#include "xil_mpu.h"
+#include "xreg_cortexr5.h"
+#endif
+#if defined (__MICROBLAZE__)
+#include "mb_interface.h"
+#else
+#include "xpseudo_asm.h"
+#include "xil_exception.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Attributes used for non-cacheable arenas. The Cortex A53 32 bit BSP uses
+ * the same short descriptor format as the Cortex A9.
+ */
+#if defined (__aarch64__)
+#define XIL_ARENA_NONCACHE_ATTR	(NORM_NONCACHE | INNER_SHAREABLE)
+#elif defined (ARMA9) || defined (ARMA53_32)
+#define XIL_ARENA_NONCACHE_ATTR	0x11DE2U
+#elif defined (ARMR5)
+#define XIL_ARENA_NONCACHE_ATTR	(NORM_SHARED_NCACHE | PRIV_RW_USER_RW)
+#endif
+
+#define XIL_ARENA_MB_MSR_IE	0x2U
+
+/* Storage of the "dma" arena, rounded up to the mapping granularity */
+#define XIL_ARENA_DMA_STORAGE_SIZE \
+	((XIL_ARENA_DMA_SIZE + XIL_ARENA_MAP_ALIGN - 1U) & \
+	~(XIL_ARENA_MAP_ALIGN - 1U))
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XIL_ARENA_ALIGN_UP(Value, Align) \
+	(((Value) + (Align) - 1U) & ~((UINTPTR)(Align) - 1U))
+
+/************************** Function Prototypes ******************************/
+
+static u32 Xil_ArenaLock(void);
+static void Xil_ArenaUnlock(u32 Saved);
+static s32 Xil_ArenaMapNonCached(UINTPTR Base, UINTPTR Size);
+
+/************************** Variable Definitions *****************************/
+
+static Xil_Arena *Xil_ArenaList;
+
+#if XIL_ARENA_DMA_SIZE > 0U
+static XIL_ARENA_STORAGE(Xil_ArenaDmaStorage, XIL_ARENA_DMA_STORAGE_SIZE);
+static Xil_Arena Xil_ArenaDmaArena;
+#endif
+
+/*****************************************************************************/
+/**
+*
+* @brief    Masks the interrupts of the calling processor.
+*
+* @return   The previous interrupt mask, passed to Xil_ArenaUnlock().
+*
+******************************************************************************/
+static u32 Xil_ArenaLock(void)
+{
+	u32 Saved;
+
+#if defined (__MICROBLAZE__)
+	Saved = mfmsr();
+	mtmsr(Saved & ~XIL_ARENA_MB_MSR_IE);
+#else
+	Saved = mfcpsr();
+	mtcpsr(Saved | XIL_EXCEPTION_ALL);
+#endif
+	return Saved;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Restores the interrupt mask saved by Xil_ArenaLock().
+*
+* @param    Saved: value returned by Xil_ArenaLock().
+*
+******************************************************************************/
+static void Xil_ArenaUnlock(u32 Saved)
+{
+#if defined (__MICROBLAZE__)
+	mtmsr(Saved);
+#else
+	mtcpsr(Saved);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Remaps a range as normal non-cacheable memory.
+*
+* @param    Base: start of the range, aligned to XIL_ARENA_MAP_ALIGN.
+* @param    Size: size of the range, multiple of XIL_ARENA_MAP_ALIGN.
+*
+* @return   XST_SUCCESS if the range is non-cacheable, XST_FAILURE if the
+*           MMU tables or MPU regions are exhausted, XST_NO_FEATURE if the
+*           processor cannot change the cacheability.
+*
+******************************************************************************/
+static s32 Xil_ArenaMapNonCached(UINTPTR Base, UINTPTR Size)
+{
+#if defined (__aarch64__)
+	return Xil_SetTlbAttributesRange(Base, (u64)Size,
+			XIL_ARENA_NONCACHE_ATTR);
+#elif defined (ARMA9) || defined (ARMA53_32)
+	UINTPTR Addr;
+
+	Xil_DCacheFlushRange(Base, Size);
+	for (Addr = Base; Addr < (Base + Size); Addr += XIL_ARENA_MAP_ALIGN) {
+		Xil_SetTlbAttributes(Addr, XIL_ARENA_NONCACHE_ATTR);
+	}
+	return XST_SUCCESS;
+#elif defined (ARMR5)
+	Xil_DCacheFlushRange((INTPTR)Base, (u32)Size);
+	if (Xil_SetMPURegionRange((INTPTR)Base, (u64)Size,
+			XIL_ARENA_NONCACHE_ATTR) != (u32)XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	return XST_SUCCESS;
+#else
+	(void)Base;
+	(void)Size;
+	return XST_NO_FEATURE;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Sets up an arena on the given memory and registers it by name.
+*
+* @param    ArenaPtr: arena to set up.
+* @param    Name: name of the arena, see Xil_ArenaFind(). The string is not
+*           copied.
+* @param    Base: start of the memory of the arena.
+* @param    Size: size of the memory in bytes.
+* @param    Attrib: XIL_ARENA_CACHED, or XIL_ARENA_NONCACHED to remap the
+*           memory as non-cacheable. Base and Size must then be multiples
+*           of XIL_ARENA_MAP_ALIGN, see XIL_ARENA_STORAGE().
+*
+* @return   - XST_SUCCESS if the arena is set up.
+*           - XST_INVALID_PARAM if a non-cacheable arena is not aligned.
+*           - XST_NO_FEATURE if the processor cannot remap the memory.
+*           - XST_FAILURE if the MMU or MPU could not map the memory.
+*
+******************************************************************************/
+s32 Xil_ArenaInit(Xil_Arena *ArenaPtr, const char *Name, void *Base,
+			UINTPTR Size, u32 Attrib)
+{
+	UINTPTR Start = (UINTPTR)Base;
+	s32 Status;
+	u32 Saved;
+
+	Xil_AssertNonvoid(ArenaPtr != NULL);
+	Xil_AssertNonvoid(Name != NULL);
+	Xil_AssertNonvoid(Base != NULL);
+
+	if (Attrib == XIL_ARENA_NONCACHED) {
+		if (((Start | Size) & (XIL_ARENA_MAP_ALIGN - 1U)) != 0U) {
+			return XST_INVALID_PARAM;
+		}
+		Status = Xil_ArenaMapNonCached(Start, Size);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+	}
+
+	ArenaPtr->Name = Name;
+	ArenaPtr->Base = Start;
+	ArenaPtr->End = Start + Size;
+	ArenaPtr->Next = Start;
+	ArenaPtr->Attrib = Attrib;
+	ArenaPtr->AllocCount = 0U;
+	ArenaPtr->FailCount = 0U;
+	ArenaPtr->Pools = NULL;
+
+	Saved = Xil_ArenaLock();
+	ArenaPtr->NextArena = Xil_ArenaList;
+	Xil_ArenaList = ArenaPtr;
+	Xil_ArenaUnlock(Saved);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Allocates memory from an arena.
+*
+* @param    ArenaPtr: arena to allocate from.
+* @param    Size: number of bytes to allocate.
+* @param    Align: alignment of the memory, a power of two. For cacheable
+*           DMA buffers this should be at least the cache line size.
+*
+* @return   The memory, or NULL if the arena is exhausted.
+*
+******************************************************************************/
+void *Xil_ArenaAlloc(Xil_Arena *ArenaPtr, UINTPTR Size, UINTPTR Align)
+{
+	UINTPTR Addr;
+	void *Block = NULL;
+	u32 Saved;
+
+	Xil_AssertNonvoid(ArenaPtr != NULL);
+	Xil_AssertNonvoid((Align != 0U) && ((Align & (Align - 1U)) == 0U));
+
+	Saved = Xil_ArenaLock();
+	Addr = XIL_ARENA_ALIGN_UP(ArenaPtr->Next, Align);
+	if ((Addr >= ArenaPtr->Next) && (Addr <= ArenaPtr->End) &&
+		(Size <= (ArenaPtr->End - Addr))) {
+		ArenaPtr->Next = Addr + Size;
+		ArenaPtr->AllocCount++;
+		Block = (void *)Addr;
+	} else {
+		ArenaPtr->FailCount++;
+	}
+	Xil_ArenaUnlock(Saved);
+
+	return Block;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Returns all memory of an arena. The caller must make sure that
+*           no allocation, including the blocks of its pools, is in use.
+*           The pools of the arena are dropped.
+*
+* @param    ArenaPtr: arena to reset.
+*
+******************************************************************************/
+void Xil_ArenaReset(Xil_Arena *ArenaPtr)
+{
+	u32 Saved;
+
+	Xil_AssertVoid(ArenaPtr != NULL);
+
+	Saved = Xil_ArenaLock();
+	ArenaPtr->Next = ArenaPtr->Base;
+	ArenaPtr->Pools = NULL;
+	Xil_ArenaUnlock(Saved);
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Looks up an arena by name.
+*
+* @param    Name: name given to Xil_ArenaInit().
+*
+* @return   The arena, or NULL if no arena of that name is registered.
+*
+******************************************************************************/
+Xil_Arena *Xil_ArenaFind(const char *Name)
+{
+	Xil_Arena *ArenaPtr;
+
+	Xil_AssertNonvoid(Name != NULL);
+
+#if XIL_ARENA_DMA_SIZE > 0U
+	(void)Xil_ArenaDma();
+#endif
+	for (ArenaPtr = Xil_ArenaList; ArenaPtr != NULL;
+			ArenaPtr = ArenaPtr->NextArena) {
+		if (strcmp(ArenaPtr->Name, Name) == 0) {
+			break;
+		}
+	}
+	return ArenaPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Reads the usage of an arena.
+*
+* @param    ArenaPtr: arena to read.
+* @param    StatsPtr: returns the usage.
+*
+******************************************************************************/
+void Xil_ArenaGetStats(const Xil_Arena *ArenaPtr, Xil_ArenaStats *StatsPtr)
+{
+	Xil_AssertVoid(ArenaPtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	StatsPtr->Size = ArenaPtr->End - ArenaPtr->Base;
+	StatsPtr->Used = ArenaPtr->Next - ArenaPtr->Base;
+	StatsPtr->AllocCount = ArenaPtr->AllocCount;
+	StatsPtr->FailCount = ArenaPtr->FailCount;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Prints the usage of all arenas and their pools with
+*           xil_printf().
+*
+******************************************************************************/
+void Xil_ArenaPrintStats(void)
+{
+	Xil_Arena *ArenaPtr;
+	Xil_Pool *PoolPtr;
+
+#if XIL_ARENA_DMA_SIZE > 0U
+	(void)Xil_ArenaDma();
+#endif
+	for (ArenaPtr = Xil_ArenaList; ArenaPtr != NULL;
+			ArenaPtr = ArenaPtr->NextArena) {
+		xil_printf("arena %s: %d of %d bytes used, %d allocs, %d failed%s\r\n",
+			ArenaPtr->Name, (s32)(ArenaPtr->Next - ArenaPtr->Base),
+			(s32)(ArenaPtr->End - ArenaPtr->Base),
+			(s32)ArenaPtr->AllocCount, (s32)ArenaPtr->FailCount,
+			(ArenaPtr->Attrib == XIL_ARENA_NONCACHED) ?
+			", non-cacheable" : "");
+		for (PoolPtr = ArenaPtr->Pools; PoolPtr != NULL;
+				PoolPtr = PoolPtr->NextPool) {
+			xil_printf("  pool %s: %d x %d bytes, %d free, %d max used, %d failed\r\n",
+				PoolPtr->Name, (s32)PoolPtr->NumBlocks,
+				(s32)PoolPtr->BlockSize, (s32)PoolPtr->FreeCount,
+				(s32)(PoolPtr->NumBlocks - PoolPtr->MinFreeCount),
+				(s32)PoolPtr->FailCount);
+		}
+	}
+}
+
+#if XIL_ARENA_DMA_SIZE > 0U
+/*****************************************************************************/
+/**
+*
+* @brief    Returns the non-cacheable "dma" arena of the BSP, setting it up
+*           on the first call.
+*
+* @return   The arena, or NULL if its memory could not be remapped.
+*
+******************************************************************************/
+Xil_Arena *Xil_ArenaDma(void)
+{
+	static u32 DmaArenaState;
+
+	if (DmaArenaState == 0U) {
+		DmaArenaState = (Xil_ArenaInit(&Xil_ArenaDmaArena, "dma",
+				Xil_ArenaDmaStorage, XIL_ARENA_DMA_STORAGE_SIZE,
+				XIL_ARENA_NONCACHED) == XST_SUCCESS) ? 1U : 2U;
+	}
+	return (DmaArenaState == 1U) ? &Xil_ArenaDmaArena : NULL;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* @brief    Sets up a pool of fixed size blocks carved from an arena.
+*
+* @param    PoolPtr: pool to set up.
+* @param    Name: name of the pool, printed by Xil_ArenaPrintStats().
+* @param    ArenaPtr: arena providing the memory of the blocks.
+* @param    BlockSize: size of a block in bytes.
+* @param    Align: alignment of each block, a power of two.
+* @param    NumBlocks: number of blocks.
+*
+* @return   XST_SUCCESS if the pool is set up, XST_FAILURE if the arena has
+*           not enough memory left.
+*
+******************************************************************************/
+s32 Xil_PoolInit(Xil_Pool *PoolPtr, const char *Name, Xil_Arena *ArenaPtr,
+			UINTPTR BlockSize, UINTPTR Align, u32 NumBlocks)
+{
+	UINTPTR Stride;
+	u8 *Mem;
+	u32 Index;
+	u32 Saved;
+
+	Xil_AssertNonvoid(PoolPtr != NULL);
+	Xil_AssertNonvoid(ArenaPtr != NULL);
+	Xil_AssertNonvoid(NumBlocks != 0U);
+	Xil_AssertNonvoid(BlockSize >= sizeof(void *));
+
+	if (Align < sizeof(void *)) {
+		Align = sizeof(void *);
+	}
+	Stride = XIL_ARENA_ALIGN_UP(BlockSize, Align);
+	Mem = Xil_ArenaAlloc(ArenaPtr, Stride * NumBlocks, Align);
+	if (Mem == NULL) {
+		return XST_FAILURE;
+	}
+
+	PoolPtr->Name = Name;
+	PoolPtr->Arena = ArenaPtr;
+	PoolPtr->BlockSize = Stride;
+	PoolPtr->NumBlocks = NumBlocks;
+	PoolPtr->FreeCount = NumBlocks;
+	PoolPtr->MinFreeCount = NumBlocks;
+	PoolPtr->FailCount = 0U;
+
+	/* Link the blocks in address order */
+	PoolPtr->FreeList = Mem;
+	for (Index = 0U; Index < (NumBlocks - 1U); Index++) {
+		*(void **)(Mem + (Index * Stride)) = Mem + ((Index + 1U) * Stride);
+	}
+	*(void **)(Mem + (Index * Stride)) = NULL;
+
+	Saved = Xil_ArenaLock();
+	PoolPtr->NextPool = ArenaPtr->Pools;
+	ArenaPtr->Pools = PoolPtr;
+	Xil_ArenaUnlock(Saved);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Takes a block from a pool. May be called from interrupt
+*           handlers.
+*
+* @param    PoolPtr: pool to allocate from.
+*
+* @return   The block, or NULL if the pool is empty.
+*
+******************************************************************************/
+void *Xil_PoolAlloc(Xil_Pool *PoolPtr)
+{
+	void *Block;
+	u32 Saved;
+
+	Xil_AssertNonvoid(PoolPtr != NULL);
+
+	Saved = Xil_ArenaLock();
+	Block = PoolPtr->FreeList;
+	if (Block != NULL) {
+		PoolPtr->FreeList = *(void **)Block;
+		PoolPtr->FreeCount--;
+		if (PoolPtr->FreeCount < PoolPtr->MinFreeCount) {
+			PoolPtr->MinFreeCount = PoolPtr->FreeCount;
+		}
+	} else {
+		PoolPtr->FailCount++;
+	}
+	Xil_ArenaUnlock(Saved);
+
+	return Block;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Returns a block to its pool. May be called from interrupt
+*           handlers.
+*
+* @param    PoolPtr: pool the block was taken from.
+* @param    Block: block returned by Xil_PoolAlloc().
+*
+******************************************************************************/
+void Xil_PoolFree(Xil_Pool *PoolPtr, void *Block)
+{
+	u32 Saved;
+
+	Xil_AssertVoid(PoolPtr != NULL);
+	Xil_AssertVoid(Block != NULL);
+
+	Saved = Xil_ArenaLock();
+	*(void **)Block = PoolPtr->FreeList;
+	PoolPtr->FreeList = Block;
+	PoolPtr->FreeCount++;
+	Xil_ArenaUnlock(Saved);
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Reads the usage of a pool.
+*
+* @param    PoolPtr: pool to read.
+* @param    StatsPtr: returns the usage.
+*
+******************************************************************************/
+void Xil_PoolGetStats(const Xil_Pool *PoolPtr, Xil_PoolStats *StatsPtr)
+{
+	Xil_AssertVoid(PoolPtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	StatsPtr->BlockSize = PoolPtr->BlockSize;
+	StatsPtr->NumBlocks = PoolPtr->NumBlocks;
+	StatsPtr->FreeCount = PoolPtr->FreeCount;
+	StatsPtr->MinFreeCount = PoolPtr->MinFreeCount;
+	StatsPtr->FailCount = PoolPtr->FailCount;
+}
@@ -0,0 +1,205 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_arena.h
+*
+* @addtogroup common_arena Memory Arenas and Block Pools
+*
+* The xil_arena.h file contains a memory service for driver descriptor rings
+* and DMA buffers. Instead of each driver reserving its own oversized static
+* region, descriptor memory is taken from arenas that are sized for the
+* system and that carry the alignment and cacheability the DMA engines need.
+*
+* - An arena is a named region of memory handed out with Xil_ArenaAlloc().
+*   Allocations are never freed individually; Xil_ArenaReset() returns the
+*   whole arena. Arenas are registered by name and can be looked up with
+*   Xil_ArenaFind().
+* - An arena created with XIL_ARENA_NONCACHED is remapped as normal
+*   non-cacheable memory through the MMU (Xil_SetTlbAttributesRange on
+*   Cortex A53, Xil_SetTlbAttributes on Cortex A9) or the MPU
+*   (Xil_SetMPURegionRange on Cortex R5). Its base and size must be multiples
+*   of XIL_ARENA_MAP_ALIGN. MicroBlaze has no MMU in the standalone BSP and
+*   only supports cached arenas.
+* - A pool hands out fixed size blocks, for example buffer descriptors or
+*   packet buffers, carved from an arena. Xil_PoolAlloc() and Xil_PoolFree()
+*   take constant time and may be called from interrupt handlers.
+* - When the dma_arena_size parameter of the standalone BSP is not 0, the BSP
+*   provides a non-cacheable arena named "dma" of at least that size, see
+*   Xil_ArenaDma(). Drivers take their descriptor rings from this arena.
+* - Xil_ArenaGetStats(), Xil_PoolGetStats() and Xil_ArenaPrintStats() report
+*   the usage, including the high water mark of every pool, so that the
+*   arenas can be sized from a running system.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_ARENA_H		/* prevent circular inclusions */
+#define XIL_ARENA_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifndef XIL_ARENA_DMA_SIZE
+#define XIL_ARENA_DMA_SIZE 0U
+#endif
+
+/** @name Arena Attributes
+ * @{
+ */
+#define XIL_ARENA_CACHED	0x0U	/**< Normal cacheable memory */
+#define XIL_ARENA_NONCACHED	0x1U	/**< Remapped as non-cacheable */
+/* @} */
+
+/**
+ * Granularity at which the cacheability of memory can be changed, which is
+ * the alignment of the base and size of a non-cacheable arena.
+ */
+#if defined (__aarch64__)
+#define XIL_ARENA_MAP_ALIGN	0x1000U
+#elif defined (ARMA9) || defined (ARMA53_32)
+#define XIL_ARENA_MAP_ALIGN	0x100000U
+#elif defined (ARMR5)
+#define XIL_ARENA_MAP_ALIGN	0x20U
+#else
+#define XIL_ARENA_MAP_ALIGN	0x4U
+#endif
+
+/**************************** Type Definitions *******************************/
+
+typedef struct Xil_Pool Xil_Pool;
+
+/**
+ * A memory arena. All members are private to xil_arena.c.
+ */
+typedef struct Xil_Arena {
+	const char *Name;
+	UINTPTR Base;
+	UINTPTR End;
+	UINTPTR Next;
+	u32 Attrib;
+	u32 AllocCount;
+	u32 FailCount;
+	struct Xil_Arena *NextArena;
+	Xil_Pool *Pools;
+} Xil_Arena;
+
+/**
+ * A pool of fixed size blocks. All members are private to xil_arena.c.
+ */
+struct Xil_Pool {
+	const char *Name;
+	Xil_Arena *Arena;
+	void *FreeList;
+	UINTPTR BlockSize;
+	u32 NumBlocks;
+	u32 FreeCount;
+	u32 MinFreeCount;
+	u32 FailCount;
+	Xil_Pool *NextPool;
+};
+
+/**
+ * Usage of an arena, see Xil_ArenaGetStats().
+ */
+typedef struct {
+	UINTPTR Size;		/**< Size of the arena in bytes */
+	UINTPTR Used;		/**< Bytes handed out, including padding */
+	u32 AllocCount;		/**< Successful allocations */
+	u32 FailCount;		/**< Allocations that did not fit */
+} Xil_ArenaStats;
+
+/**
+ * Usage of a pool, see Xil_PoolGetStats().
+ */
+typedef struct {
+	UINTPTR BlockSize;	/**< Size of a block in bytes */
+	u32 NumBlocks;		/**< Number of blocks in the pool */
+	u32 FreeCount;		/**< Blocks currently free */
+	u32 MinFreeCount;	/**< Lowest number of free blocks seen */
+	u32 FailCount;		/**< Allocations from an empty pool */
+} Xil_PoolStats;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**
+ * Defines static storage for an arena of Size bytes that can be made
+ * non-cacheable. Size should be a multiple of XIL_ARENA_MAP_ALIGN.
+ */
+#define XIL_ARENA_STORAGE(Var, Size) \
+	u8 Var[(Size)] __attribute__ ((aligned (XIL_ARENA_MAP_ALIGN)))
+
+/************************** Function Prototypes ******************************/
+
+s32 Xil_ArenaInit(Xil_Arena *ArenaPtr, const char *Name, void *Base,
+			UINTPTR Size, u32 Attrib);
+void *Xil_ArenaAlloc(Xil_Arena *ArenaPtr, UINTPTR Size, UINTPTR Align);
+void Xil_ArenaReset(Xil_Arena *ArenaPtr);
+Xil_Arena *Xil_ArenaFind(const char *Name);
+void Xil_ArenaGetStats(const Xil_Arena *ArenaPtr, Xil_ArenaStats *StatsPtr);
+void Xil_ArenaPrintStats(void);
+#if XIL_ARENA_DMA_SIZE > 0U
+Xil_Arena *Xil_ArenaDma(void);
+#endif
+
+s32 Xil_PoolInit(Xil_Pool *PoolPtr, const char *Name, Xil_Arena *ArenaPtr,
+			UINTPTR BlockSize, UINTPTR Align, u32 NumBlocks);
+void *Xil_PoolAlloc(Xil_Pool *PoolPtr);
+void Xil_PoolFree(Xil_Pool *PoolPtr, void *Block);
+void Xil_PoolGetStats(const Xil_Pool *PoolPtr, Xil_PoolStats *StatsPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/**
+* @} End of "addtogroup common_arena".
+*/
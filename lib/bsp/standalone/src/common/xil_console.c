@@ -0,0 +1,327 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_console.c
+*
+* This file contains the buffered console backend used by xil_printf() and
+* print(). See xil_console.h for the drain modes and full buffer policies.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_console.h"
+
+#if XIL_CONSOLE_BUFSIZE > 0U
+
+#if (XIL_CONSOLE_BUFSIZE & (XIL_CONSOLE_BUFSIZE - 1U)) != 0U
+#error "XIL_CONSOLE_BUFSIZE must be a power of two"
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define XIL_CONSOLE_MASK	(XIL_CONSOLE_BUFSIZE - 1U)
+
+/************************** Function Prototypes ******************************/
+
+#if XIL_CONSOLE_NOBLOCK == 0U
+static u32 Xil_ConsoleMakeRoom(void);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * Head is advanced by the consumer, Tail publishes the bytes of completed
+ * (NOBLOCK) or written (blocking) characters to the consumer and WriteIdx is
+ * where the producer renders the current message. All three run freely and
+ * are reduced modulo the buffer size on access.
+ */
+static volatile char8 ConsoleBuf[XIL_CONSOLE_BUFSIZE];
+static volatile u32 ConsoleHead;
+static volatile u32 ConsoleTail;
+static u32 ConsoleWriteIdx;
+static volatile u32 ConsoleDepth;
+static volatile u32 ConsoleDrainBusy;
+static u32 ConsoleMsgDropped;
+static volatile u32 ConsoleDropCount;
+static Xil_ConsoleKickHandler ConsoleKick;
+static void *ConsoleKickRef;
+
+/****************************************************************************/
+/**
+*
+* @brief    Start a message. Called by xil_printf() and print() before the
+*           first character.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_ConsoleBegin(void)
+{
+	ConsoleDepth++;
+	if (ConsoleDepth == 1U) {
+		ConsoleWriteIdx = ConsoleTail;
+		ConsoleMsgDropped = 0U;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Queue one character of the current message.
+*
+* @param    c is the character.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_ConsolePutc(char8 c)
+{
+	if (ConsoleDepth > 1U) {
+		/* Nested message, the current one is not complete */
+#if XIL_CONSOLE_NOBLOCK == 0U
+		outbyte(c);
+#endif
+		return;
+	}
+
+#if XIL_CONSOLE_NOBLOCK != 0U
+	if (ConsoleMsgDropped != 0U) {
+		return;
+	}
+	if ((ConsoleWriteIdx - ConsoleHead) >= XIL_CONSOLE_BUFSIZE) {
+		ConsoleMsgDropped = 1U;
+		return;
+	}
+	ConsoleBuf[ConsoleWriteIdx & XIL_CONSOLE_MASK] = c;
+	ConsoleWriteIdx++;
+#else
+	while ((ConsoleWriteIdx - ConsoleHead) >= XIL_CONSOLE_BUFSIZE) {
+		if (Xil_ConsoleMakeRoom() == 0U) {
+			outbyte(c);
+			return;
+		}
+	}
+	ConsoleBuf[ConsoleWriteIdx & XIL_CONSOLE_MASK] = c;
+	ConsoleWriteIdx++;
+	ConsoleTail = ConsoleWriteIdx;
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Complete a message. Under the NOBLOCK policy the message is made
+*           visible to the consumer only here, so it is either queued whole
+*           or dropped. The kick handler, if any, is then called.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_ConsoleEnd(void)
+{
+	if (ConsoleDepth > 1U) {
+#if XIL_CONSOLE_NOBLOCK != 0U
+		ConsoleDropCount++;
+#endif
+		ConsoleDepth--;
+		return;
+	}
+
+#if XIL_CONSOLE_NOBLOCK != 0U
+	if (ConsoleMsgDropped != 0U) {
+		ConsoleDropCount++;
+	} else {
+		ConsoleTail = ConsoleWriteIdx;
+	}
+#endif
+	ConsoleDepth--;
+
+	if ((ConsoleKick != NULL) && (ConsoleTail != ConsoleHead)) {
+		ConsoleKick(ConsoleKickRef);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Register the handler that starts the interrupt driven drain.
+*
+* @param    Handler is called with CallBackRef whenever data was queued. It
+*           is expected to enable the TX FIFO empty interrupt of the UART.
+*           NULL selects the background drain with Xil_ConsoleDrain().
+* @param    CallBackRef is passed to the handler.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_ConsoleSetKickHandler(Xil_ConsoleKickHandler Handler,
+				void *CallBackRef)
+{
+	ConsoleKickRef = CallBackRef;
+	ConsoleKick = Handler;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Take queued bytes out of the buffer. Called from the TX FIFO empty
+*           interrupt handler of the UART in the interrupt driven mode.
+*
+* @param    BufPtr is where the bytes are copied to.
+* @param    MaxLen is the maximum number of bytes to take, typically the
+*           free space in the TX FIFO.
+*
+* @return   Number of bytes copied. 0 means the buffer is empty and the TX
+*           interrupt may be disabled.
+*
+****************************************************************************/
+u32 Xil_ConsoleRead(char8 *BufPtr, u32 MaxLen)
+{
+	u32 Head = ConsoleHead;
+	u32 Count = 0U;
+
+	while ((Count < MaxLen) && (Head != ConsoleTail)) {
+		BufPtr[Count] = ConsoleBuf[Head & XIL_CONSOLE_MASK];
+		Head++;
+		Count++;
+	}
+	ConsoleHead = Head;
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Write queued bytes with outbyte(). Called by a background task
+*           when no kick handler is registered.
+*
+* @param    MaxLen is the maximum number of bytes to write, which bounds the
+*           time spent in this call.
+*
+* @return   Number of bytes written.
+*
+****************************************************************************/
+u32 Xil_ConsoleDrain(u32 MaxLen)
+{
+	u32 Count = 0U;
+
+	if (ConsoleDrainBusy != 0U) {
+		return 0U;
+	}
+	ConsoleDrainBusy = 1U;
+
+	while ((Count < MaxLen) && (ConsoleHead != ConsoleTail)) {
+		outbyte(ConsoleBuf[ConsoleHead & XIL_CONSOLE_MASK]);
+		ConsoleHead++;
+		Count++;
+	}
+
+	ConsoleDrainBusy = 0U;
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Wait until every queued byte has been handed to the UART, e.g.
+*           before a reset.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_ConsoleFlush(void)
+{
+	if (ConsoleKick != NULL) {
+		while (ConsoleHead != ConsoleTail) {
+			ConsoleKick(ConsoleKickRef);
+		}
+	} else {
+		(void)Xil_ConsoleDrain(0xFFFFFFFFU);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Get the number of messages dropped under the NOBLOCK policy.
+*
+* @return   Number of dropped messages.
+*
+****************************************************************************/
+u32 Xil_ConsoleGetDropCount(void)
+{
+	return ConsoleDropCount;
+}
+
+#if XIL_CONSOLE_NOBLOCK == 0U
+/****************************************************************************/
+/**
+*
+* @brief    Free space in the buffer for the blocking policy.
+*
+* @return   1 if the caller may wait for space, 0 if another context is
+*           currently draining and the character must be written directly.
+*
+****************************************************************************/
+static u32 Xil_ConsoleMakeRoom(void)
+{
+	if (ConsoleKick != NULL) {
+		ConsoleKick(ConsoleKickRef);
+		return 1U;
+	}
+
+	if (ConsoleDrainBusy != 0U) {
+		return 0U;
+	}
+	ConsoleDrainBusy = 1U;
+	outbyte(ConsoleBuf[ConsoleHead & XIL_CONSOLE_MASK]);
+	ConsoleHead++;
+	ConsoleDrainBusy = 0U;
+
+	return 1U;
+}
+#endif
+
+#endif /* XIL_CONSOLE_BUFSIZE */
@@ -0,0 +1,152 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_console.h
+*
+* @addtogroup common_console Buffered Console
+*
+* The xil_console.h file contains the buffered console backend used by
+* xil_printf() and print(). It is enabled by setting XIL_CONSOLE_BUFSIZE to a
+* power of two, which is done by the console_buffer_size parameter of the
+* standalone BSP. With the default of 0 every character is written with
+* outbyte(), which blocks until the UART has FIFO space.
+*
+* When enabled, each message is rendered into a ring buffer and returns
+* without touching the UART unless the buffer is full. The buffer is drained
+* in one of two ways:
+*
+* - Interrupt driven: the application registers a kick handler with
+*   Xil_ConsoleSetKickHandler(). It is called after a message is queued and
+*   should enable the TX FIFO empty interrupt of the UART. The interrupt
+*   handler refills the TX FIFO from Xil_ConsoleRead() and disables the
+*   interrupt once it returns 0.
+* - Background: without a kick handler, a low priority task or the main loop
+*   calls Xil_ConsoleDrain(), which writes the queued bytes with outbyte().
+*
+* The full buffer policy is selected with XIL_CONSOLE_NOBLOCK (parameter
+* console_noblock):
+*
+* - Blocking (default): the producer waits for space. With a kick handler it
+*   spins until the interrupt frees space, so the blocking policy must not be
+*   used with interrupts masked. Without one it writes the oldest bytes with
+*   outbyte() itself.
+* - NOBLOCK: a message that does not fit is dropped as a whole and counted,
+*   see Xil_ConsoleGetDropCount(). Printing never waits for the UART, which
+*   makes this the policy for logging from interrupt handlers.
+*
+* A message printed from an interrupt handler while another message is being
+* rendered is written directly with outbyte() under the blocking policy and
+* dropped under the NOBLOCK policy. The backend is per processor; it is not
+* safe to share one between processors.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_CONSOLE_H		/* prevent circular inclusions */
+#define XIL_CONSOLE_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifndef XIL_CONSOLE_BUFSIZE
+#define XIL_CONSOLE_BUFSIZE 0U
+#endif
+
+#ifndef XIL_CONSOLE_NOBLOCK
+#define XIL_CONSOLE_NOBLOCK 0U
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Called when data has been queued, to start the interrupt driven drain.
+ */
+typedef void (*Xil_ConsoleKickHandler)(void *CallBackRef);
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*
+ * Used by xil_printf() and print() to bracket a message and to emit its
+ * characters.
+ */
+#if XIL_CONSOLE_BUFSIZE > 0U
+#define XIL_CONSOLE_BEGIN()	Xil_ConsoleBegin()
+#define XIL_CONSOLE_PUTC(c)	Xil_ConsolePutc(c)
+#define XIL_CONSOLE_END()	Xil_ConsoleEnd()
+#else
+#define XIL_CONSOLE_BEGIN()
+#define XIL_CONSOLE_PUTC(c)	outbyte(c)
+#define XIL_CONSOLE_END()
+#endif
+
+/************************** Function Prototypes ******************************/
+
+extern void outbyte(char8 c);
+
+#if XIL_CONSOLE_BUFSIZE > 0U
+void Xil_ConsoleBegin(void);
+void Xil_ConsolePutc(char8 c);
+void Xil_ConsoleEnd(void);
+void Xil_ConsoleSetKickHandler(Xil_ConsoleKickHandler Handler,
+				void *CallBackRef);
+u32 Xil_ConsoleRead(char8 *BufPtr, u32 MaxLen);
+u32 Xil_ConsoleDrain(u32 MaxLen);
+void Xil_ConsoleFlush(void);
+u32 Xil_ConsoleGetDropCount(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/**
+* @} End of "addtogroup common_console".
+*/
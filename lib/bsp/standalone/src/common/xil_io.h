@@ -49,7 +49,18 @@
 * 5.00 	pkp  	 05/29/14 First release
 * 6.00  mus      08/19/16 Remove checking of __LITTLE_ENDIAN__ flag for
 *                         ARM processors
+* 6.6   ag       10/14/26 Added the register access profile build, enabled
+*                         by XIL_IO_PROFILE_SIZE
 * </pre>
+*
+* When XIL_IO_PROFILE_SIZE, set by the io_profile_size parameter of the
+* standalone BSP, is not 0, the Xil_InNN/Xil_OutNN calls of every file including
+* this header go through xil_io_profile.c. It counts the accesses of every
+* register per call site, with their cost in timestamp units, in a table of
+* XIL_IO_PROFILE_SIZE entries. Xil_IoProfileReport() prints the most expensive
+* ones and Xil_IoProfileReportBases() the totals per device. The profile build
+* makes every access a function call and is meant for finding hot registers,
+* for example polling loops, not for production.
 ******************************************************************************/
 
 #ifndef XIL_IO_H           /* prevent circular inclusions */
@@ -335,6 +346,54 @@ static INLINE void Xil_Out32BE(UINTPTR Addr, u32 Value)
 	Xil_Out32(Addr, Value);
 }
 
+#ifndef XIL_IO_PROFILE_SIZE
+#define XIL_IO_PROFILE_SIZE 0U
+#endif
+
+#if XIL_IO_PROFILE_SIZE > 0U
+/**
+* Register access profile entry, one per register and call site.
+*/
+typedef struct {
+	UINTPTR Addr;		/**< Register address */
+	const char *File;	/**< Source file of the call site */
+	u32 Line;		/**< Source line of the call site */
+	u32 Reads;		/**< Number of reads */
+	u32 Writes;		/**< Number of writes */
+	u64 Cost;		/**< Total access time in timestamp units */
+} Xil_IoProfileEntry;
+
+typedef u64 (*Xil_IoProfileTimestampFn)(void);
+
+u8 Xil_IoProfileIn8(UINTPTR Addr, const char *File, u32 Line);
+u16 Xil_IoProfileIn16(UINTPTR Addr, const char *File, u32 Line);
+u32 Xil_IoProfileIn32(UINTPTR Addr, const char *File, u32 Line);
+u64 Xil_IoProfileIn64(UINTPTR Addr, const char *File, u32 Line);
+void Xil_IoProfileOut8(UINTPTR Addr, u8 Value, const char *File, u32 Line);
+void Xil_IoProfileOut16(UINTPTR Addr, u16 Value, const char *File, u32 Line);
+void Xil_IoProfileOut32(UINTPTR Addr, u32 Value, const char *File, u32 Line);
+void Xil_IoProfileOut64(UINTPTR Addr, u64 Value, const char *File, u32 Line);
+void Xil_IoProfileSetTimestamp(Xil_IoProfileTimestampFn TimestampFn);
+void Xil_IoProfileReset(void);
+void Xil_IoProfileReport(u32 Count);
+void Xil_IoProfileReportBases(UINTPTR BaseMask);
+
+#ifndef XIL_IO_PROFILE_NO_HOOK
+#define Xil_In8(Addr)	Xil_IoProfileIn8((Addr), __FILE__, __LINE__)
+#define Xil_In16(Addr)	Xil_IoProfileIn16((Addr), __FILE__, __LINE__)
+#define Xil_In32(Addr)	Xil_IoProfileIn32((Addr), __FILE__, __LINE__)
+#define Xil_In64(Addr)	Xil_IoProfileIn64((Addr), __FILE__, __LINE__)
+#define Xil_Out8(Addr, Value) \
+	Xil_IoProfileOut8((Addr), (Value), __FILE__, __LINE__)
+#define Xil_Out16(Addr, Value) \
+	Xil_IoProfileOut16((Addr), (Value), __FILE__, __LINE__)
+#define Xil_Out32(Addr, Value) \
+	Xil_IoProfileOut32((Addr), (Value), __FILE__, __LINE__)
+#define Xil_Out64(Addr, Value) \
+	Xil_IoProfileOut64((Addr), (Value), __FILE__, __LINE__)
+#endif
+#endif /* XIL_IO_PROFILE_SIZE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,403 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_io_profile.c
+*
+* This file contains the register access profile build of xil_io.h. It is
+* compiled in when XIL_IO_PROFILE_SIZE is not 0; see xil_io.h.
+*
+* - Accesses are keyed by register address and call site (file and line) in
+*   an open addressing table of XIL_IO_PROFILE_SIZE entries, which must be a
+*   power of two. Accesses that find the table full are counted, see
+*   Xil_IoProfileDropped.
+* - The cost of an access is the difference of two timestamps taken around
+*   it. On Cortex A9 and A53 XTime_GetTime() is used by default; elsewhere
+*   the cost is 0 until a function is registered with
+*   Xil_IoProfileSetTimestamp().
+* - Accesses made while an access is being recorded, i.e. by the timestamp
+*   function or by an interrupt handler preempting the recording, are done
+*   but not recorded.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+/* The accesses of this file are the real ones */
+#define XIL_IO_PROFILE_NO_HOOK
+#include "xil_io.h"
+
+#if XIL_IO_PROFILE_SIZE > 0U
+
+#if (XIL_IO_PROFILE_SIZE & (XIL_IO_PROFILE_SIZE - 1U)) != 0U
+#error "XIL_IO_PROFILE_SIZE must be a power of two"
+#endif
+
+#if defined (__aarch64__) || defined (ARMA9) || defined (ARMA53_32)
+#include "xtime_l.h"
+#define XIL_IO_PROFILE_HAS_XTIME
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define XIL_IO_PROFILE_MASK	(XIL_IO_PROFILE_SIZE - 1U)
+
+/************************** Function Prototypes ******************************/
+
+#ifdef XIL_IO_PROFILE_HAS_XTIME
+static u64 Xil_IoProfileXTime(void);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * The table is global so that it can be dumped and sorted offline.
+ */
+Xil_IoProfileEntry Xil_IoProfileTable[XIL_IO_PROFILE_SIZE];
+u32 Xil_IoProfileDropped;
+
+static u32 ProfileBusy;
+#ifdef XIL_IO_PROFILE_HAS_XTIME
+static Xil_IoProfileTimestampFn ProfileTimestamp = Xil_IoProfileXTime;
+#else
+static Xil_IoProfileTimestampFn ProfileTimestamp;
+#endif
+
+/****************************************************************************/
+/**
+*
+* @brief    Read the profile timestamp and mark a recording in progress.
+*
+* @return   The timestamp, or 0 if no timestamp function is registered.
+*
+****************************************************************************/
+static u64 Xil_IoProfileStart(void)
+{
+	u64 Now;
+
+	ProfileBusy = 1U;
+	Now = (ProfileTimestamp != NULL) ? ProfileTimestamp() : 0U;
+
+	return Now;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Account an access to the entry of its register and call site.
+*
+* @param    Addr is the register address.
+* @param    IsWrite is 1 for a write, 0 for a read.
+* @param    Start is the timestamp returned by Xil_IoProfileStart().
+* @param    File is the source file of the call site.
+* @param    Line is the source line of the call site.
+*
+* @return   None.
+*
+****************************************************************************/
+static void Xil_IoProfileRecord(UINTPTR Addr, u32 IsWrite, u64 Start,
+				const char *File, u32 Line)
+{
+	Xil_IoProfileEntry *EntryPtr;
+	u64 Cost;
+	u32 Index;
+	u32 Probe;
+
+	Cost = (ProfileTimestamp != NULL) ? (ProfileTimestamp() - Start) : 0U;
+
+	Index = ((u32)(Addr >> 2U) ^ (Line * 0x9E3779B1U)) & XIL_IO_PROFILE_MASK;
+	for (Probe = 0U; Probe < XIL_IO_PROFILE_SIZE; Probe++) {
+		EntryPtr = &Xil_IoProfileTable[Index];
+		if (EntryPtr->File == NULL) {
+			EntryPtr->Addr = Addr;
+			EntryPtr->File = File;
+			EntryPtr->Line = Line;
+			break;
+		}
+		if ((EntryPtr->Addr == Addr) && (EntryPtr->Line == Line) &&
+		    (EntryPtr->File == File)) {
+			break;
+		}
+		Index = (Index + 1U) & XIL_IO_PROFILE_MASK;
+	}
+
+	if (Probe == XIL_IO_PROFILE_SIZE) {
+		Xil_IoProfileDropped++;
+	} else {
+		if (IsWrite != 0U) {
+			EntryPtr->Writes++;
+		} else {
+			EntryPtr->Reads++;
+		}
+		EntryPtr->Cost += Cost;
+	}
+
+	ProfileBusy = 0U;
+}
+
+/*
+ * The accessors of all the widths only differ in the type of the access,
+ * they are generated from these two templates.
+ */
+#define XIL_IO_PROFILE_IN(Name, Type, Access) \
+Type Name(UINTPTR Addr, const char *File, u32 Line) \
+{ \
+	Type Value; \
+	u64 Start; \
+	if (ProfileBusy != 0U) { \
+		return Access(Addr); \
+	} \
+	Start = Xil_IoProfileStart(); \
+	Value = Access(Addr); \
+	Xil_IoProfileRecord(Addr, 0U, Start, File, Line); \
+	return Value; \
+}
+
+#define XIL_IO_PROFILE_OUT(Name, Type, Access) \
+void Name(UINTPTR Addr, Type Value, const char *File, u32 Line) \
+{ \
+	u64 Start; \
+	if (ProfileBusy != 0U) { \
+		Access(Addr, Value); \
+		return; \
+	} \
+	Start = Xil_IoProfileStart(); \
+	Access(Addr, Value); \
+	Xil_IoProfileRecord(Addr, 1U, Start, File, Line); \
+}
+
+XIL_IO_PROFILE_IN(Xil_IoProfileIn8, u8, Xil_In8)
+XIL_IO_PROFILE_IN(Xil_IoProfileIn16, u16, Xil_In16)
+XIL_IO_PROFILE_IN(Xil_IoProfileIn32, u32, Xil_In32)
+XIL_IO_PROFILE_IN(Xil_IoProfileIn64, u64, Xil_In64)
+XIL_IO_PROFILE_OUT(Xil_IoProfileOut8, u8, Xil_Out8)
+XIL_IO_PROFILE_OUT(Xil_IoProfileOut16, u16, Xil_Out16)
+XIL_IO_PROFILE_OUT(Xil_IoProfileOut32, u32, Xil_Out32)
+XIL_IO_PROFILE_OUT(Xil_IoProfileOut64, u64, Xil_Out64)
+
+/****************************************************************************/
+/**
+*
+* @brief    Register the function used to time the accesses.
+*
+* @param    TimestampFn is the timestamp function, NULL records a cost of 0.
+*
+* @return   None.
+*
+* @note     The function must be monotonic. Call Xil_IoProfileReset()
+*           afterwards, the costs of different functions do not add up.
+*
+****************************************************************************/
+void Xil_IoProfileSetTimestamp(Xil_IoProfileTimestampFn TimestampFn)
+{
+	ProfileTimestamp = TimestampFn;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Clear the profile table.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_IoProfileReset(void)
+{
+	u32 Index;
+
+	ProfileBusy = 1U;
+	for (Index = 0U; Index < XIL_IO_PROFILE_SIZE; Index++) {
+		Xil_IoProfileTable[Index].File = NULL;
+		Xil_IoProfileTable[Index].Reads = 0U;
+		Xil_IoProfileTable[Index].Writes = 0U;
+		Xil_IoProfileTable[Index].Cost = 0U;
+	}
+	Xil_IoProfileDropped = 0U;
+	ProfileBusy = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Print the register and call site entries with the highest cost,
+*           most expensive first.
+*
+* @param    Count is the number of entries to print.
+*
+* @return   None.
+*
+* @note     Costs are printed in timestamp units. The table is not modified,
+*           accesses keep being recorded while printing.
+*
+****************************************************************************/
+void Xil_IoProfileReport(u32 Count)
+{
+	const Xil_IoProfileEntry *EntryPtr;
+	u64 LastCost = 0U;
+	u32 LastIndex = 0U;
+	u32 Best;
+	u32 Index;
+	u32 Printed;
+
+	xil_printf("addr       reads      writes     cost       site\r\n");
+
+	/*
+	 * Selection by (Cost, Index) descending, so that entries of equal cost
+	 * are printed once each without sorting the live table.
+	 */
+	for (Printed = 0U; Printed < Count; Printed++) {
+		Best = XIL_IO_PROFILE_SIZE;
+		for (Index = 0U; Index < XIL_IO_PROFILE_SIZE; Index++) {
+			EntryPtr = &Xil_IoProfileTable[Index];
+			if (EntryPtr->File == NULL) {
+				continue;
+			}
+			if ((Printed != 0U) &&
+			    ((EntryPtr->Cost > LastCost) ||
+			     ((EntryPtr->Cost == LastCost) &&
+			      (Index >= LastIndex)))) {
+				continue;
+			}
+			if ((Best == XIL_IO_PROFILE_SIZE) ||
+			    (EntryPtr->Cost > Xil_IoProfileTable[Best].Cost) ||
+			    ((EntryPtr->Cost == Xil_IoProfileTable[Best].Cost) &&
+			     (Index > Best))) {
+				Best = Index;
+			}
+		}
+		if (Best == XIL_IO_PROFILE_SIZE) {
+			break;
+		}
+
+		EntryPtr = &Xil_IoProfileTable[Best];
+		xil_printf("0x%08x %-10u %-10u %-10u %s:%u\r\n",
+			(u32)EntryPtr->Addr, EntryPtr->Reads, EntryPtr->Writes,
+			(u32)EntryPtr->Cost, EntryPtr->File, EntryPtr->Line);
+		LastCost = EntryPtr->Cost;
+		LastIndex = Best;
+	}
+
+	if (Xil_IoProfileDropped != 0U) {
+		xil_printf("%u accesses not recorded, table full\r\n",
+				Xil_IoProfileDropped);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Print the accesses and cost per device, i.e. per driver instance.
+*
+* @param    BaseMask is the mask of the address bits within a device, for
+*           example 0xFFFFU for devices with a 64 KB register space.
+*
+* @return   None.
+*
+* @note     Devices are printed in the order they are found in the table.
+*
+****************************************************************************/
+void Xil_IoProfileReportBases(UINTPTR BaseMask)
+{
+	const Xil_IoProfileEntry *EntryPtr;
+	UINTPTR Base;
+	u32 Accesses;
+	u64 Cost;
+	u32 Index;
+	u32 Other;
+
+	xil_printf("base       accesses   cost\r\n");
+
+	for (Index = 0U; Index < XIL_IO_PROFILE_SIZE; Index++) {
+		EntryPtr = &Xil_IoProfileTable[Index];
+		if (EntryPtr->File == NULL) {
+			continue;
+		}
+		Base = EntryPtr->Addr & ~BaseMask;
+
+		/* Print each device at its first entry only */
+		for (Other = 0U; Other < Index; Other++) {
+			if ((Xil_IoProfileTable[Other].File != NULL) &&
+			    ((Xil_IoProfileTable[Other].Addr & ~BaseMask) ==
+					Base)) {
+				break;
+			}
+		}
+		if (Other < Index) {
+			continue;
+		}
+
+		Accesses = 0U;
+		Cost = 0U;
+		for (Other = Index; Other < XIL_IO_PROFILE_SIZE; Other++) {
+			if ((Xil_IoProfileTable[Other].File != NULL) &&
+			    ((Xil_IoProfileTable[Other].Addr & ~BaseMask) ==
+					Base)) {
+				Accesses += Xil_IoProfileTable[Other].Reads +
+					Xil_IoProfileTable[Other].Writes;
+				Cost += Xil_IoProfileTable[Other].Cost;
+			}
+		}
+
+		xil_printf("0x%08x %-10u %u\r\n", (u32)Base, Accesses,
+				(u32)Cost);
+	}
+}
+
+#ifdef XIL_IO_PROFILE_HAS_XTIME
+/****************************************************************************/
+/**
+*
+* @brief    Default timestamp function on processors with XTime_GetTime().
+*
+* @return   The current time in timer ticks.
+*
+****************************************************************************/
+static u64 Xil_IoProfileXTime(void)
+{
+	XTime Now;
+
+	XTime_GetTime(&Now);
+
+	return (u64)Now;
+}
+#endif
+
+#endif /* XIL_IO_PROFILE_SIZE */
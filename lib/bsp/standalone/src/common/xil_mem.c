@@ -42,6 +42,10 @@
 * Ver   Who      Date     Changes
 * ----- -------- -------- -----------------------------------------------
 * 6.1   nsk      11/07/16 First release.
+* 6.6   ag       10/14/26 Copies of Threshold bytes or more are handed to the
+*                         handler installed with Xil_MemCpySetHandler().
+*                         Added Xil_MemSet(). Both use the NEON loops of
+*                         xil_mem_neon.S on Cortex-A53 and Cortex-A9.
 *
 * </pre>
 *
@@ -50,8 +54,55 @@
 /***************************** Include Files ********************************/
 
 #include "xil_types.h"
+#include "xil_mem.h"
+#include "bspconfig.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * The NEON loops are built for the GCC Cortex-A53 and Cortex-A9 BSPs. They
+ * are left out of FreeRTOS builds, where tasks only get a floating point
+ * context after calling vPortTaskUsesFPU().
+ */
+#if defined (__GNUC__) && !defined (__ARMCC_VERSION) && \
+	!defined (FREERTOS_BSP) && (defined (__aarch64__) || \
+	(defined (__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'A')))
+#define XIL_MEM_NEON
+#endif
+
+/************************** Function Prototypes ******************************/
+
+#ifdef XIL_MEM_NEON
+extern void Xil_MemCpyNeon(void *dst, const void *src, u32 cnt);
+extern void Xil_MemSetNeon(void *dst, s32 c, u32 cnt);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+static Xil_MemCpyHandler MemCpyHandler = NULL;
+static u32 MemCpyThreshold = 0U;
 
 /***************** Inline Functions Definitions ********************/
+/*****************************************************************************/
+/**
+* @brief       This function installs a handler that Xil_MemCpy() hands copies
+*              of Threshold bytes or more to, typically a DMA engine. The
+*              handler is responsible for any cache maintenance of the
+*              buffers. When it returns a non-zero value the copy is done by
+*              the CPU instead.
+*
+* @param       Handler: copy offload handler, NULL to remove the handler
+*
+* @param       Threshold: minimum copy length in bytes to offload
+*
+*****************************************************************************/
+void Xil_MemCpySetHandler(Xil_MemCpyHandler Handler, u32 Threshold)
+{
+	MemCpyHandler = NULL;
+	MemCpyThreshold = Threshold;
+	MemCpyHandler = Handler;
+}
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
@@ -65,9 +116,20 @@
 *****************************************************************************/
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
+#ifndef XIL_MEM_NEON
 	char *d = (char*)(void *)dst;
 	const char *s = src;
+#endif
+	Xil_MemCpyHandler Handler = MemCpyHandler;
+
+	if ((Handler != NULL) && (cnt >= MemCpyThreshold) &&
+	    (Handler(dst, src, cnt) == 0)) {
+		return;
+	}
 
+#ifdef XIL_MEM_NEON
+	Xil_MemCpyNeon(dst, src, cnt);
+#else
 	while (cnt >= sizeof (int)) {
 		*(int*)d = *(int*)s;
 		d += sizeof (int);
@@ -80,4 +142,45 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		s += 1U;
 		cnt -= 1U;
 	}
+#endif
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a constant byte.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       c: byte value to fill with, only the low 8 bits are used
+*
+* @param       cnt: 32 bit length of bytes to be filled
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, s32 c, u32 cnt)
+{
+#ifdef XIL_MEM_NEON
+	Xil_MemSetNeon(dst, c, cnt);
+#else
+	char *d = (char*)(void *)dst;
+	u32 val = (u32)c & 0xFFU;
+
+	val |= val << 8;
+	val |= val << 16;
+
+	while ((cnt > 0U) && (((UINTPTR)d & (sizeof (int) - 1U)) != 0U)) {
+		*d = (char)val;
+		d += 1U;
+		cnt -= 1U;
+	}
+	while (cnt >= sizeof (int)) {
+		*(u32*)(void *)d = val;
+		d += sizeof (int);
+		cnt -= sizeof (int);
+	}
+	while ((cnt) > 0U){
+		*d = (char)val;
+		d += 1U;
+		cnt -= 1U;
+	}
+#endif
 }
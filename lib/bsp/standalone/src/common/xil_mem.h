@@ -46,14 +46,41 @@
 * Ver   Who      Date     Changes
 * ----- -------- -------- -----------------------------------------------
 * 6.1   nsk      11/07/16 First release.
+* 6.6   ag       10/14/26 Added Xil_MemCpySetHandler() to offload large copies.
+*                         Added Xil_MemSet().
 *
 * </pre>
 *
 *****************************************************************************/
 
+#ifndef XIL_MEM_H		/* prevent circular inclusions */
+#define XIL_MEM_H		/* by using protection macros */
+
+#include "xil_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Copy offload handler type. The handler returns 0 once the copy is complete
+ * or a non-zero value to make Xil_MemCpy() fall back to the CPU copy.
+ */
+typedef s32 (*Xil_MemCpyHandler)(void *dst, const void *src, u32 cnt);
+
 /************************** Function Prototypes *****************************/
 
 void Xil_MemCpy(void* dst, const void* src, u32 cnt);
+void Xil_MemCpySetHandler(Xil_MemCpyHandler Handler, u32 Threshold);
+void Xil_MemSet(void* dst, s32 c, u32 cnt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_MEM_H */
 /**
 * @} End of "addtogroup common_mem_operation_api".
 */
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "xil_printf.h"
 #include "xil_types.h"
 #include "xil_assert.h"
+#include "xil_console.h"
 #include <ctype.h>
 #include <string.h>
 #include <stdarg.h>
@@ -49,7 +50,7 @@ static void padding( const s32 l_flag, const struct params_s *par)
 		i=(par->len);
         for (; i<(par->num1); i++) {
 #ifdef STDOUT_BASEADDRESS
-            outbyte( par->pad_character);
+            XIL_CONSOLE_PUTC( par->pad_character);
 #endif
 		}
     }
@@ -74,7 +75,7 @@ static void outs(const charptr lp, struct params_s *par)
     while (((*LocalPtr) != (char8)0) && ((par->num2) != 0)) {
 		(par->num2)--;
 #ifdef STDOUT_BASEADDRESS
-        outbyte(*LocalPtr);
+        XIL_CONSOLE_PUTC(*LocalPtr);
 #endif
 		LocalPtr += 1;
 }
@@ -134,7 +135,7 @@ static void outnum( const s32 n, const s32 base, struct params_s *par)
     padding( !(par->left_flag), par);
     while (&outbuf[i] >= outbuf) {
 #ifdef STDOUT_BASEADDRESS
-	outbyte( outbuf[i] );
+	XIL_CONSOLE_PUTC( outbuf[i] );
 #endif
 		i--;
 }
@@ -189,7 +190,7 @@ static void outnum1( const s64 n, const s32 base, params_t *par)
     par->len = (s32)strlen(outbuf);
     padding( !(par->left_flag), par);
     while (&outbuf[i] >= outbuf) {
-	outbyte( outbuf[i] );
+	XIL_CONSOLE_PUTC( outbuf[i] );
 		i--;
 }
     padding( par->left_flag, par);
@@ -259,6 +260,7 @@ void xil_printf( const char8 *ctrl1, ...)
     char8 *ctrl = (char8 *)ctrl1;
 
     va_start( argp, ctrl1);
+    XIL_CONSOLE_BEGIN();
 
     while ((ctrl != NULL) && (*ctrl != (char8)0)) {
 
@@ -266,7 +268,7 @@ void xil_printf( const char8 *ctrl1, ...)
         /* format control is found.                    */
         if (*ctrl != '%') {
 #ifdef STDOUT_BASEADDRESS
-            outbyte(*ctrl);
+            XIL_CONSOLE_PUTC(*ctrl);
 #endif
 			ctrl += 1;
             continue;
@@ -318,7 +320,7 @@ void xil_printf( const char8 *ctrl1, ...)
         switch (tolower((s32)ch)) {
             case '%':
 #ifdef STDOUT_BASEADDRESS
-                outbyte( '%');
+                XIL_CONSOLE_PUTC( '%');
 #endif
                 Check = 1;
                 break;
@@ -387,7 +389,7 @@ void xil_printf( const char8 *ctrl1, ...)
 
             case 'c':
 #ifdef STDOUT_BASEADDRESS
-                outbyte( va_arg( argp, s32));
+                XIL_CONSOLE_PUTC( va_arg( argp, s32));
 #endif
                 Check = 1;
                 break;
@@ -396,28 +398,28 @@ void xil_printf( const char8 *ctrl1, ...)
                 switch (*ctrl) {
                     case 'a':
 #ifdef STDOUT_BASEADDRESS
-                        outbyte( ((char8)0x07));
+                        XIL_CONSOLE_PUTC( ((char8)0x07));
 #endif
                         break;
                     case 'h':
 #ifdef STDOUT_BASEADDRESS
-                        outbyte( ((char8)0x08));
+                        XIL_CONSOLE_PUTC( ((char8)0x08));
 #endif
                         break;
                     case 'r':
 #ifdef STDOUT_BASEADDRESS
-                        outbyte( ((char8)0x0D));
+                        XIL_CONSOLE_PUTC( ((char8)0x0D));
 #endif
                         break;
                     case 'n':
 #ifdef STDOUT_BASEADDRESS
-                        outbyte( ((char8)0x0D));
-                        outbyte( ((char8)0x0A));
+                        XIL_CONSOLE_PUTC( ((char8)0x0D));
+                        XIL_CONSOLE_PUTC( ((char8)0x0A));
 #endif
                         break;
                     default:
 #ifdef STDOUT_BASEADDRESS
-                        outbyte( *ctrl);
+                        XIL_CONSOLE_PUTC( *ctrl);
 #endif
                         break;
                 }
@@ -437,6 +439,7 @@ void xil_printf( const char8 *ctrl1, ...)
         }
         goto try_next;
     }
+    XIL_CONSOLE_END();
     va_end( argp);
 }
 #endif
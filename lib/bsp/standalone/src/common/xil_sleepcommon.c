@@ -42,6 +42,7 @@
 * Ver   Who      Date     Changes
 * ----- -------- -------- -----------------------------------------------
 * 6.6 	srm  	 11/02/17 First release
+* 6.6 	ag  	 10/14/26 Added Xil_SetSleepHook
 * </pre>
 ******************************************************************************/
 
@@ -52,6 +53,33 @@
 
 /****************************  Constant Definitions  *************************/
 
+#define XSLEEP_US_PER_SECOND	1000000UL
+
+/************************** Variable Definitions *****************************/
+
+static Xil_SleepHook SleepHook = NULL;
+static void *SleepHookRef = NULL;
+
+/************************** Function Prototypes ******************************/
+
+static void Xil_SleepBusyWait(unsigned long useconds);
+
+/*****************************************************************************/
+/**
+* This API sets the hook called by sleep and usleep instead of busy-waiting.
+* @param            Hook - sleep hook, or NULL to busy-wait
+* @param            CallBackRef - reference passed to the hook
+* @return           none
+* @note             The hook is called from every context calling sleep or
+*                   usleep, including drivers and interrupt handlers, so it
+*                   must return useconds when it cannot block.
+*****************************************************************************/
+void Xil_SetSleepHook(Xil_SleepHook Hook, void *CallBackRef)
+{
+	SleepHookRef = CallBackRef;
+	SleepHook = Hook;
+}
+
 
 /*****************************************************************************/
 /**
@@ -67,6 +95,16 @@
 *****************************************************************************/
  void sleep(unsigned int seconds)
  {
+	unsigned int count;
+
+	if (SleepHook != NULL) {
+		/* One second at a time so the delay fits in useconds */
+		for (count = 0U; count < seconds; count++) {
+			usleep(XSLEEP_US_PER_SECOND);
+		}
+		return;
+	}
+
 #if defined (ARMR5)
 	sleep_R5(seconds);
 #elif defined (__aarch64__) || defined (ARMA53_32)
@@ -92,6 +130,26 @@
 *
 *****************************************************************************/
  void usleep(unsigned long useconds)
+ {
+	unsigned long remaining = useconds;
+
+	if ((SleepHook != NULL) && (useconds != 0UL)) {
+		remaining = SleepHook(SleepHookRef, useconds);
+	}
+
+	if (remaining != 0UL) {
+		Xil_SleepBusyWait(remaining);
+	}
+ }
+
+/****************************************************************************/
+/**
+* This helper busy-waits with the processor specific routine
+* @param            useconds - delay time in useconds
+* @return           none
+* @note             none
+*****************************************************************************/
+static void Xil_SleepBusyWait(unsigned long useconds)
  {
 #if defined (ARMR5)
 	usleep_R5(useconds);
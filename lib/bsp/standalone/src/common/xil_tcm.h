@@ -0,0 +1,109 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_tcm.h
+*
+* @addtogroup common_tcm_placement Placement of Code and Data in R5 TCM
+*
+* The xil_tcm.h file contains the section attributes that place functions and
+* data in the tightly coupled memories of the Cortex R5.
+*
+* - XIL_TCM_CODE places a function in the .tcm_code section, which the linker
+*   script puts in ATCM.
+* - XIL_TCM_DATA places a variable in the .tcm_data section, which the linker
+*   script puts in BTCM. Zero initialized variables are placed there as well
+*   and are loaded with the image, so no startup code is needed for them.
+* - XIL_TCM_ISR is used by drivers on their hottest interrupt paths. It places
+*   the function in ATCM only when XIL_TCM_ISR_PLACEMENT is set to 1, which is
+*   done by the tcm_isr_placement parameter of the standalone BSP.
+*
+* Both sections are output sections of their own at their TCM address in the
+* linker script, so each becomes a separate partition that the FSBL loads
+* into the TCM of the destination R5. In split mode each of them must fit in
+* one 64KB bank. Without a .tcm_code or .tcm_data rule in the linker script the
+* sections are placed next to the regular code and data. On other processors
+* the macros are empty.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_TCM_H		/* prevent circular inclusions */
+#define XIL_TCM_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifndef XIL_TCM_ISR_PLACEMENT
+#define XIL_TCM_ISR_PLACEMENT 0U
+#endif
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#if defined (ARMR5) && defined (__GNUC__)
+#define XIL_TCM_CODE	__attribute__ ((section (".tcm_code")))
+#define XIL_TCM_DATA	__attribute__ ((section (".tcm_data")))
+#else
+#define XIL_TCM_CODE
+#define XIL_TCM_DATA
+#endif
+
+#if XIL_TCM_ISR_PLACEMENT == 1U
+#define XIL_TCM_ISR	XIL_TCM_CODE
+#else
+#define XIL_TCM_ISR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/**
+* @} End of "addtogroup common_tcm_placement".
+*/
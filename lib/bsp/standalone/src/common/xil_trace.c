@@ -0,0 +1,248 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_trace.c
+*
+* This file contains the binary trace ring. See xil_trace.h for a description
+* of the event format and the reader side.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_trace.h"
+
+#if XIL_TRACE_BUFSIZE > 0U
+
+#if (XIL_TRACE_BUFSIZE & (XIL_TRACE_BUFSIZE - 1U)) != 0U
+#error "XIL_TRACE_BUFSIZE must be a power of two"
+#endif
+
+#if defined (__aarch64__) || defined (ARMA9) || defined (ARMA53_32)
+#include "xtime_l.h"
+#define XIL_TRACE_HAS_XTIME
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define XIL_TRACE_MASK	(XIL_TRACE_BUFSIZE - 1U)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*
+ * The slot of an event is reserved with an atomic increment so that writers
+ * interrupting each other get different slots.
+ */
+#if defined (__GNUC__)
+#define XIL_TRACE_RESERVE() \
+	__atomic_fetch_add(&Xil_TraceWriteIdx, 1U, __ATOMIC_RELAXED)
+#define XIL_TRACE_PUBLISH(Ptr, Value) \
+	__atomic_store_n((Ptr), (Value), __ATOMIC_RELEASE)
+#define XIL_TRACE_LOAD(Ptr) \
+	__atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#else
+#define XIL_TRACE_RESERVE()		(Xil_TraceWriteIdx++)
+#define XIL_TRACE_PUBLISH(Ptr, Value)	(*(Ptr) = (Value))
+#define XIL_TRACE_LOAD(Ptr)		(*(Ptr))
+#endif
+
+/************************** Function Prototypes ******************************/
+
+#ifdef XIL_TRACE_HAS_XTIME
+static u64 Xil_TraceXTime(void);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * The ring and the write index are global so that they can be dumped and
+ * decoded offline.
+ */
+Xil_TraceEvent Xil_TraceBuffer[XIL_TRACE_BUFSIZE];
+volatile u32 Xil_TraceWriteIdx;
+
+static u32 TraceReadIdx;
+static u32 TraceLostCount;
+#ifdef XIL_TRACE_HAS_XTIME
+static Xil_TraceTimestampFn TraceTimestamp = Xil_TraceXTime;
+#else
+static Xil_TraceTimestampFn TraceTimestamp;
+#endif
+
+/****************************************************************************/
+/**
+*
+* @brief    Write a trace event. Normally called through the XIL_TRACEn()
+*           macros.
+*
+* @param    Id is the event ID, see XIL_TRACE_ID().
+* @param    NumArgs is the number of valid arguments, at most 4.
+* @param    Arg0 is the first argument.
+* @param    Arg1 is the second argument.
+* @param    Arg2 is the third argument.
+* @param    Arg3 is the fourth argument.
+*
+* @return   None.
+*
+* @note     Safe to call from interrupt handlers.
+*
+****************************************************************************/
+void Xil_TraceWrite(u16 Id, u32 NumArgs, u32 Arg0, u32 Arg1, u32 Arg2,
+			u32 Arg3)
+{
+	u32 Idx = XIL_TRACE_RESERVE();
+	Xil_TraceEvent *EventPtr = &Xil_TraceBuffer[Idx & XIL_TRACE_MASK];
+
+	XIL_TRACE_PUBLISH(&EventPtr->Seq, 0U);
+	EventPtr->Id = Id;
+	EventPtr->NumArgs = (u8)NumArgs;
+	EventPtr->Timestamp = (TraceTimestamp != NULL) ? TraceTimestamp() : 0U;
+	EventPtr->Args[0] = Arg0;
+	EventPtr->Args[1] = Arg1;
+	EventPtr->Args[2] = Arg2;
+	EventPtr->Args[3] = Arg3;
+	XIL_TRACE_PUBLISH(&EventPtr->Seq, Idx + 1U);
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Register the function that provides the event timestamps.
+*
+* @param    TimestampFn is the timestamp function, NULL stores 0.
+*
+* @return   None.
+*
+****************************************************************************/
+void Xil_TraceSetTimestamp(Xil_TraceTimestampFn TimestampFn)
+{
+	TraceTimestamp = TimestampFn;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Read the oldest trace event that was not read yet. Events that
+*           were overwritten before they could be read are skipped and
+*           counted as lost.
+*
+* @param    EventPtr is where the event is copied to.
+*
+* @return
+*           - XST_SUCCESS if an event was copied.
+*           - XST_NO_DATA if no complete event is pending.
+*
+* @note     There must be only one reader.
+*
+****************************************************************************/
+s32 Xil_TraceRead(Xil_TraceEvent *EventPtr)
+{
+	Xil_TraceEvent *SlotPtr;
+	u32 WriteIdx;
+	u32 Seq;
+
+	while (1) {
+		WriteIdx = XIL_TRACE_LOAD(&Xil_TraceWriteIdx);
+		if (WriteIdx == TraceReadIdx) {
+			return XST_NO_DATA;
+		}
+		if ((WriteIdx - TraceReadIdx) > XIL_TRACE_BUFSIZE) {
+			TraceLostCount += (WriteIdx - TraceReadIdx) -
+						XIL_TRACE_BUFSIZE;
+			TraceReadIdx = WriteIdx - XIL_TRACE_BUFSIZE;
+		}
+
+		SlotPtr = &Xil_TraceBuffer[TraceReadIdx & XIL_TRACE_MASK];
+		Seq = XIL_TRACE_LOAD(&SlotPtr->Seq);
+		if (Seq == (TraceReadIdx + 1U)) {
+			*EventPtr = *SlotPtr;
+			/* Keep the copy only if the slot was not reused meanwhile */
+			if (XIL_TRACE_LOAD(&SlotPtr->Seq) == Seq) {
+				TraceReadIdx++;
+				return XST_SUCCESS;
+			}
+		} else if ((Seq == 0U) &&
+			   ((WriteIdx - TraceReadIdx) < XIL_TRACE_BUFSIZE)) {
+			/* The event is still being written */
+			return XST_NO_DATA;
+		} else {
+			/* Overwritten by a newer event */
+		}
+		TraceLostCount++;
+		TraceReadIdx++;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Get the number of events that were overwritten before they were
+*           read with Xil_TraceRead().
+*
+* @return   Number of lost events.
+*
+****************************************************************************/
+u32 Xil_TraceGetLostCount(void)
+{
+	return TraceLostCount;
+}
+
+#ifdef XIL_TRACE_HAS_XTIME
+/****************************************************************************/
+/**
+*
+* @brief    Default timestamp function on processors with XTime_GetTime().
+*
+* @return   The current time in timer ticks.
+*
+****************************************************************************/
+static u64 Xil_TraceXTime(void)
+{
+	XTime Now;
+
+	XTime_GetTime(&Now);
+
+	return (u64)Now;
+}
+#endif
+
+#endif /* XIL_TRACE_BUFSIZE */
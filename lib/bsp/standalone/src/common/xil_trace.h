@@ -0,0 +1,174 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_trace.h
+*
+* @addtogroup common_trace Binary Trace
+*
+* The xil_trace.h file contains a low overhead binary trace facility for
+* drivers and subsystems. A trace event stores a 16 bit event ID, a 64 bit
+* timestamp and up to four 32 bit arguments in a ring of XIL_TRACE_BUFSIZE
+* events. No formatting is done when an event is written; the events are
+* decoded later, either by a background task with Xil_TraceRead() or offline
+* by dumping Xil_TraceBuffer and Xil_TraceWriteIdx with the debugger.
+*
+* - XIL_TRACE_BUFSIZE is set by the trace_buffer_size parameter of the
+*   standalone BSP and must be a power of two. With the default of 0 the
+*   XIL_TRACEn() macros compile to nothing and do not evaluate their
+*   arguments.
+* - Event IDs are built with XIL_TRACE_ID() from a module ID, see the
+*   XIL_TRACE_MOD_* definitions, and a module specific event number. Module
+*   IDs from XIL_TRACE_MOD_USER upwards are reserved for applications.
+* - The ring is per processor. Writers reserve a slot with an atomic
+*   increment, so events may be written from tasks and interrupt handlers
+*   without locking. When the ring is full the oldest events are
+*   overwritten; a reader that falls behind skips them and counts them, see
+*   Xil_TraceGetLostCount().
+* - Timestamps are read from the function registered with
+*   Xil_TraceSetTimestamp(). On Cortex A9 and A53 XTime_GetTime() is used by
+*   default; elsewhere the timestamp is 0 until a function is registered.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date    Changes
+* ----- ---- --------- -------------------------------------------------------
+* 6.6   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_TRACE_H		/* prevent circular inclusions */
+#define XIL_TRACE_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+
+#ifndef XIL_TRACE_BUFSIZE
+#define XIL_TRACE_BUFSIZE 0U
+#endif
+
+/** @name Trace Module IDs
+ * @{
+ */
+#define XIL_TRACE_MOD_BSP	0x01U	/**< Standalone BSP */
+#define XIL_TRACE_MOD_VPHY	0x10U	/**< Video PHY controller */
+#define XIL_TRACE_MOD_HDMIRXSS	0x11U	/**< HDMI RX subsystem */
+#define XIL_TRACE_MOD_HDMITXSS	0x12U	/**< HDMI TX subsystem */
+#define XIL_TRACE_MOD_SDIRXSS	0x13U	/**< SDI RX subsystem */
+#define XIL_TRACE_MOD_SDITXSS	0x14U	/**< SDI TX subsystem */
+#define XIL_TRACE_MOD_VPROCSS	0x15U	/**< Video processing subsystem */
+#define XIL_TRACE_MOD_USER	0x80U	/**< First application module */
+/* @} */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * A trace event as stored in the ring. Seq is 0 while the event is being
+ * written and the write index of the event plus one once it is complete.
+ */
+typedef struct {
+	u32 Seq;	/**< Sequence number, see above */
+	u16 Id;		/**< Event ID, see XIL_TRACE_ID() */
+	u8 NumArgs;	/**< Number of valid entries in Args */
+	u8 Reserved;
+	u64 Timestamp;	/**< Timestamp of the event */
+	u32 Args[4];	/**< Event arguments */
+} Xil_TraceEvent;
+
+/**
+ * Returns the timestamp stored with each trace event.
+ */
+typedef u64 (*Xil_TraceTimestampFn)(void);
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**
+ * Builds an event ID from a module ID and a module specific event number.
+ */
+#define XIL_TRACE_ID(Module, Event) \
+	((u16)((((u32)(Module) & 0xFFU) << 8) | ((u32)(Event) & 0xFFU)))
+
+#if XIL_TRACE_BUFSIZE > 0U
+#define XIL_TRACE0(Id) \
+	Xil_TraceWrite((Id), 0U, 0U, 0U, 0U, 0U)
+#define XIL_TRACE1(Id, A0) \
+	Xil_TraceWrite((Id), 1U, (u32)(A0), 0U, 0U, 0U)
+#define XIL_TRACE2(Id, A0, A1) \
+	Xil_TraceWrite((Id), 2U, (u32)(A0), (u32)(A1), 0U, 0U)
+#define XIL_TRACE3(Id, A0, A1, A2) \
+	Xil_TraceWrite((Id), 3U, (u32)(A0), (u32)(A1), (u32)(A2), 0U)
+#define XIL_TRACE4(Id, A0, A1, A2, A3) \
+	Xil_TraceWrite((Id), 4U, (u32)(A0), (u32)(A1), (u32)(A2), (u32)(A3))
+#else
+#define XIL_TRACE0(Id)
+#define XIL_TRACE1(Id, A0)
+#define XIL_TRACE2(Id, A0, A1)
+#define XIL_TRACE3(Id, A0, A1, A2)
+#define XIL_TRACE4(Id, A0, A1, A2, A3)
+#endif
+
+/************************** Function Prototypes ******************************/
+
+#if XIL_TRACE_BUFSIZE > 0U
+void Xil_TraceWrite(u16 Id, u32 NumArgs, u32 Arg0, u32 Arg1, u32 Arg2,
+			u32 Arg3);
+void Xil_TraceSetTimestamp(Xil_TraceTimestampFn TimestampFn);
+s32 Xil_TraceRead(Xil_TraceEvent *EventPtr);
+u32 Xil_TraceGetLostCount(void);
+
+/************************** Variable Definitions *****************************/
+
+extern Xil_TraceEvent Xil_TraceBuffer[XIL_TRACE_BUFSIZE];
+extern volatile u32 Xil_TraceWriteIdx;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/**
+* @} End of "addtogroup common_trace".
+*/
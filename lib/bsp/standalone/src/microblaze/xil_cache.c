@@ -46,6 +46,10 @@
 *					  cache/L2 cache. Existing APIs in this file are modified
 *					  to add support for L2 cache.
 *					  These changes are done for implementing PR #697214.
+* 6.6   ag   10/14/26 Added Xil_DCacheFlushRange, Xil_DCacheInvalidateRange
+*                     and Xil_DCacheDmaToDevice, which switch to whole cache
+*                     operations above XIL_DCACHE_FULL_OP_THRESHOLD. The L1
+*                     cache is now flushed before the L2 cache.
 * </pre>
 *
 * @note
@@ -90,3 +94,88 @@ void Xil_ICacheDisable(void)
 	Xil_ICacheInvalidate();
 	Xil_L1ICacheDisable();
 }
+
+/****************************************************************************/
+/**
+*
+* @brief    Flush the Data cache for the given address range. If the bytes
+*           specified by the address are cached by the Data cache and the
+*           cacheline is modified (dirty), the line is written to system
+*           memory before it is invalidated.
+*
+* @param    Addr: Start address of range to be flushed.
+* @param    Len: Length of range to be flushed in bytes.
+*
+* @return   None.
+*
+* @note     Ranges of at least XIL_DCACHE_FULL_OP_THRESHOLD bytes flush the
+*           whole L1 data cache. The L1 cache is flushed first so that the
+*           written back lines are then flushed out of the L2 cache.
+*
+****************************************************************************/
+void Xil_DCacheFlushRange(UINTPTR Addr, u32 Len)
+{
+	if (Len >= XIL_DCACHE_FULL_OP_THRESHOLD) {
+		Xil_L1DCacheFlush();
+	} else {
+		Xil_L1DCacheFlushRange(Addr, Len);
+	}
+	Xil_L2CacheFlushRange(Addr, Len);
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Invalidate the Data cache for the given address range. If the
+*           bytes specified by the address are cached by the Data cache, the
+*           cacheline containing that byte is invalidated. If the cacheline
+*           is modified (dirty), the modified contents are lost.
+*
+* @param    Addr: Start address of range to be invalidated.
+* @param    Len: Length of range to be invalidated in bytes.
+*
+* @return   None.
+*
+* @note     With a write-through L1 data cache, ranges of at least
+*           XIL_DCACHE_FULL_OP_THRESHOLD bytes invalidate the whole L1 data
+*           cache, which cannot lose data. A write-back cache is always
+*           invalidated by range.
+*
+****************************************************************************/
+void Xil_DCacheInvalidateRange(UINTPTR Addr, u32 Len)
+{
+	Xil_L2CacheInvalidateRange(Addr, Len);
+#if (XPAR_MICROBLAZE_DCACHE_USE_WRITEBACK == 1)
+	Xil_L1DCacheInvalidateRange(Addr, Len);
+#else
+	if (Len >= XIL_DCACHE_FULL_OP_THRESHOLD) {
+		Xil_L1DCacheInvalidate();
+	} else {
+		Xil_L1DCacheInvalidateRange(Addr, Len);
+	}
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Prepare a buffer written by the processor for a DMA read by a
+*           device.
+*
+* @param    Addr: Start address of the buffer.
+* @param    Len: Length of the buffer in bytes.
+*
+* @return   None.
+*
+* @note     A write-through L1 data cache holds no dirty lines, so only the
+*           L2 cache is flushed and the buffer stays cached for reuse.
+*
+****************************************************************************/
+void Xil_DCacheDmaToDevice(UINTPTR Addr, u32 Len)
+{
+#if (XPAR_MICROBLAZE_DCACHE_USE_WRITEBACK == 1)
+	Xil_DCacheFlushRange(Addr, Len);
+#else
+	Xil_L2CacheFlushRange(Addr, Len);
+#endif
+}
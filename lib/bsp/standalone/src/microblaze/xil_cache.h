@@ -57,6 +57,11 @@
 *					  L2 cache. Users can include this file in their application
 *					  to use the various cache related APIs. These changes are
 *					  done for implementing PR #697214.
+* 6.6   ag   10/14/26 Xil_DCacheFlushRange and Xil_DCacheInvalidateRange are
+*                     functions now and fall back to whole cache operations
+*                     above XIL_DCACHE_FULL_OP_THRESHOLD. Added
+*                     Xil_DCacheFlushInvalidateRange and the DMA helpers
+*                     Xil_DCacheDmaToDevice and Xil_DCacheDmaFromDevice.
 *
 * </pre>
 *
@@ -81,6 +86,19 @@
 extern "C" {
 #endif
 
+/**
+ * Range length, in bytes, from which the data cache range functions operate
+ * on the whole L1 data cache instead. Above the cache size, walking the
+ * range issues more cache instructions than walking every line of the cache.
+ */
+#ifndef XIL_DCACHE_FULL_OP_THRESHOLD
+#ifdef XPAR_MICROBLAZE_DCACHE_BYTE_SIZE
+#define XIL_DCACHE_FULL_OP_THRESHOLD	XPAR_MICROBLAZE_DCACHE_BYTE_SIZE
+#else
+#define XIL_DCACHE_FULL_OP_THRESHOLD	0xFFFFFFFFU
+#endif
+#endif
+
 /****************************************************************************/
 /**
 *
@@ -353,9 +371,7 @@ extern "C" {
 * @return	None.
 *
 ****************************************************************************/
-#define Xil_DCacheInvalidateRange(Addr, Len) \
-	Xil_L2CacheInvalidateRange((Addr), (Len)); \
-	Xil_L1DCacheInvalidateRange((Addr), (Len));
+void Xil_DCacheInvalidateRange(UINTPTR Addr, u32 Len);
 
 
 /****************************************************************************
@@ -384,9 +400,52 @@ extern "C" {
 * @return	None.
 *
 ****************************************************************************/
-#define Xil_DCacheFlushRange(Addr, Len) \
-	Xil_L2CacheFlushRange((Addr), (Len)); \
-	Xil_L1DCacheFlushRange((Addr), (Len));
+void Xil_DCacheFlushRange(UINTPTR Addr, u32 Len);
+
+/****************************************************************************
+*
+* @brief     Prepare a buffer that was written by the processor for a DMA
+*            read by a device. Same as Xil_DCacheFlushRange, except that
+*            with a write-through L1 data cache the L1 lines are left valid,
+*            since memory already holds their contents.
+*
+* @param	Addr: Start address of the buffer.
+* @param	Len: Length of the buffer in bytes.
+*
+* @return	None.
+*
+****************************************************************************/
+void Xil_DCacheDmaToDevice(UINTPTR Addr, u32 Len);
+
+/****************************************************************************
+*
+* @brief     Discard the cached contents of a buffer written by a device
+*            through DMA, before the processor reads it.
+*
+* @param	Addr: Start address of the buffer.
+* @param	Len: Length of the buffer in bytes.
+*
+* @return	None.
+*
+****************************************************************************/
+#define Xil_DCacheDmaFromDevice(Addr, Len) \
+	Xil_DCacheInvalidateRange((Addr), (Len))
+
+/****************************************************************************
+*
+* @brief     Flush and invalidate the Data cache for the given address range
+*            in a single pass. On MicroBlaze a flush also invalidates the
+*            cacheline, so this replaces a Xil_DCacheFlushRange followed by
+*            a Xil_DCacheInvalidateRange of the same range.
+*
+* @param	Addr: Start address of range.
+* @param	Len: Length of range in bytes.
+*
+* @return	None.
+*
+****************************************************************************/
+#define Xil_DCacheFlushInvalidateRange(Addr, Len) \
+	Xil_DCacheFlushRange((Addr), (Len))
 
 
 /****************************************************************************
@@ -0,0 +1,979 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+/* Multi-flow TCP/UDP bandwidth and latency tests */
+
+#include <stdio.h>
+#include <string.h>
+#include "perf_suite.h"
+#include "platform_config.h"
+#include "lwip/stats.h"
+
+#ifdef XPAR_XEMACPS_0_BASEADDR
+#include "xemacps_hw.h"
+/* MAC statistics are only read if lwIP uses the GEM */
+#define PERF_EMAC_IS_GEM (PLATFORM_EMAC_BASEADDR == XPAR_XEMACPS_0_BASEADDR)
+#endif
+
+/* used as indices into kLabel[] */
+enum {
+	KCONV_UNIT,
+	KCONV_KILO,
+	KCONV_MEGA,
+	KCONV_GIGA,
+};
+
+/* labels for formats [KMG] */
+static const char kLabel[] =
+{
+	' ',
+	'K',
+	'M',
+	'G'
+};
+
+/* used as type of print */
+enum measure_t {
+	BYTES,
+	SPEED
+};
+
+/* GEM statistics registers reported with the final results */
+#ifdef PERF_EMAC_IS_GEM
+static const struct {
+	const char *name;
+	u32_t offset;
+} emac_counters[] = {
+	{ "tx_frames", XEMACPS_TXCNT_OFFSET },
+	{ "tx_underrun", XEMACPS_TXURUNCNT_OFFSET },
+	{ "rx_frames", XEMACPS_RXCNT_OFFSET },
+	{ "rx_fcs_err", XEMACPS_RXFCSCNT_OFFSET },
+	{ "rx_resource_err", XEMACPS_RXRESERRCNT_OFFSET },
+	{ "rx_overrun", XEMACPS_RXORCNT_OFFSET },
+	{ "rx_ip_csum_err", XEMACPS_RXIPCCNT_OFFSET },
+	{ "rx_tcp_csum_err", XEMACPS_RXTCPCCNT_OFFSET },
+	{ "rx_udp_csum_err", XEMACPS_RXUDPCCNT_OFFSET },
+};
+/* GEM counters clear on read, totals are kept here */
+static u64_t emac_totals[sizeof(emac_counters) / sizeof(emac_counters[0])];
+#endif
+
+static const char *test_names[] = {
+	[PERF_TCP_TX] = "tcp_tx",
+	[PERF_TCP_RX] = "tcp_rx",
+	[PERF_UDP_TX] = "udp_tx",
+	[PERF_UDP_RX] = "udp_rx",
+	[PERF_TCP_RTT] = "tcp_rtt",
+	[PERF_UDP_RTT] = "udp_rtt",
+};
+
+static struct perf_flow flows[PERF_NUM_FLOWS];
+static struct perf_cpu cpu;
+static struct udp_pcb *udp_rx_pcb;
+static ip_addr_t server_addr;
+static char send_buf[PERF_MSG_SIZE];
+static u64_t start_ms;
+static u64_t report_ms;
+static u8_t running;
+
+static XTime perf_cycles(void)
+{
+	XTime now;
+
+	XTime_GetTime(&now);
+	return now;
+}
+
+/* xil_printf can not print u64_t values on 32-bit platforms */
+static char *u64_str(char *buf, u64_t val)
+{
+	char tmp[21];
+	int i = 0, j = 0;
+
+	do {
+		tmp[i++] = '0' + (val % 10);
+		val /= 10;
+	} while (val);
+
+	while (i)
+		buf[j++] = tmp[--i];
+	buf[j] = '\0';
+
+	return buf;
+}
+
+static void stats_buffer(char* outString,
+		double data, enum measure_t type)
+{
+	int conv = KCONV_UNIT;
+	const char *format;
+	double unit = 1024.0;
+
+	if (type == SPEED)
+		unit = 1000.0;
+
+	while (data >= unit && conv < KCONV_GIGA) {
+		data /= unit;
+		conv++;
+	}
+
+	/* Fit data in 4 places */
+	if (data < 9.995) { /* 9.995 rounded to 10.0 */
+		format = "%4.2f %c"; /* #.## */
+	} else if (data < 99.95) { /* 99.95 rounded to 100 */
+		format = "%4.1f %c"; /* ##.# */
+	} else {
+		format = "%4.0f %c"; /* #### */
+	}
+	sprintf(outString, format, data, kLabel[conv]);
+}
+
+void print_app_header(void)
+{
+	xil_printf("Test %s, %d flows, %d byte messages\r\n",
+			test_names[PERF_TEST], PERF_NUM_FLOWS, PERF_MSG_SIZE);
+
+	switch (PERF_TEST) {
+	case PERF_TCP_TX:
+		xil_printf("On Host: Run $iperf -s -i %d -w 2M\r\n",
+				PERF_REPORT_INTERVAL);
+		break;
+	case PERF_TCP_RX:
+		xil_printf("On Host: Run $iperf -c <Board IP address> -P %d "
+				"-i %d -t 60 -w 2M\r\n", PERF_NUM_FLOWS,
+				PERF_REPORT_INTERVAL);
+		break;
+	case PERF_UDP_TX:
+		xil_printf("On Host: Run $iperf -u -s -i %d\r\n",
+				PERF_REPORT_INTERVAL);
+		break;
+	case PERF_UDP_RX:
+		xil_printf("On Host: Run $iperf -u -c <Board IP address> -P %d "
+				"-i %d -t 60 -b 200M -l %d\r\n", PERF_NUM_FLOWS,
+				PERF_REPORT_INTERVAL, PERF_MSG_SIZE);
+		break;
+	default:
+		xil_printf("On Host: Run an %s echo server on port %d\r\n",
+				(PERF_TEST == PERF_TCP_RTT) ? "TCP" : "UDP",
+				PERF_SERVER_PORT);
+		break;
+	}
+}
+
+/** Account one pass of the main loop, passes without work are idle time */
+void perf_cpu_account(u32_t busy)
+{
+	XTime now = perf_cycles();
+	XTime delta = now - cpu.last;
+
+	cpu.last = now;
+	if (!running)
+		return;
+
+	cpu.total += delta;
+	if (!busy)
+		cpu.idle += delta;
+}
+
+static u32_t perf_cpu_load(void)
+{
+	u32_t load = 0;
+
+	if (cpu.total)
+		load = (u32_t)(((cpu.total - cpu.idle) * 100) / cpu.total);
+
+	return load;
+}
+
+static void perf_start(void)
+{
+	if (running)
+		return;
+
+	start_ms = get_time_ms();
+	report_ms = start_ms;
+	cpu.last = perf_cycles();
+	cpu.idle = 0;
+	cpu.total = 0;
+	running = 1;
+
+	xil_printf("[ ID] Interval\t\tTransfer   Bandwidth\n\r");
+}
+
+/** Print one bandwidth line, human readable and optionally as CSV */
+static void perf_print_bw(const char *record, int id, u64_t from_ms,
+		u64_t to_ms, u64_t bytes)
+{
+	double duration = (to_ms - from_ms) / 1000.0;
+	double bandwidth = 0;
+	char data[16], perf[16], time[64], tag[8];
+
+	if (duration)
+		bandwidth = (bytes / duration) * 8.0;
+
+	stats_buffer(data, bytes, BYTES);
+	stats_buffer(perf, bandwidth, SPEED);
+	sprintf(time, "%4.1f-%4.1f sec", (from_ms - start_ms) / 1000.0,
+			(to_ms - start_ms) / 1000.0);
+	if (id < 0)
+		sprintf(tag, "SUM");
+	else
+		sprintf(tag, "%3d", id);
+	xil_printf("[%s] %s  %sBytes  %sbits/sec\n\r", tag, time, data, perf);
+
+#if PERF_OUTPUT_CSV
+	{
+		char b[21], f[21], t[21], bps[21];
+
+		xil_printf("perf,%s,test=%s,flow=%s,start_ms=%s,end_ms=%s,"
+				"bytes=%s,bps=%s\r\n", record,
+				test_names[PERF_TEST],
+				(id < 0) ? "sum" : tag,
+				u64_str(f, from_ms - start_ms),
+				u64_str(t, to_ms - start_ms), u64_str(b, bytes),
+				u64_str(bps, (u64_t)bandwidth));
+	}
+#endif
+}
+
+static void perf_interval_report(u64_t now)
+{
+	u64_t sum = 0;
+	int i;
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		if (!flows[i].active && !flows[i].interval_bytes)
+			continue;
+		sum += flows[i].interval_bytes;
+		if (PERF_NUM_FLOWS > 1)
+			perf_print_bw("interval", flows[i].id, report_ms, now,
+					flows[i].interval_bytes);
+		flows[i].interval_bytes = 0;
+	}
+	perf_print_bw("interval", -1, report_ms, now, sum);
+
+	xil_printf("[CPU] load %d%%\r\n", perf_cpu_load());
+#if PERF_OUTPUT_CSV
+	xil_printf("perf,cpu,load_pct=%d\r\n", perf_cpu_load());
+#endif
+	cpu.idle = 0;
+	cpu.total = 0;
+	report_ms = now;
+}
+
+static void perf_print_rtt(const struct perf_flow *flow)
+{
+	u32_t avg = 0;
+	int i;
+
+	if (flow->rtt_count)
+		avg = (u32_t)(flow->rtt_sum / flow->rtt_count);
+
+	xil_printf("[%3d] RTT us min %d avg %d max %d, %d samples, %d lost\r\n",
+			flow->id, flow->rtt_count ? flow->rtt_min : 0, avg,
+			flow->rtt_max, flow->rtt_count, flow->lost);
+#if PERF_OUTPUT_CSV
+	xil_printf("perf,rtt,flow=%d,min_us=%d,avg_us=%d,max_us=%d,samples=%d,"
+			"lost=%d\r\n", flow->id,
+			flow->rtt_count ? flow->rtt_min : 0, avg, flow->rtt_max,
+			flow->rtt_count, flow->lost);
+#endif
+	for (i = 0; i < PERF_RTT_BUCKETS; i++) {
+		if (!flow->rtt_hist[i])
+			continue;
+		/* bucket i holds RTTs in [2^i, 2^(i+1)) us, bucket 0 also 0 */
+		xil_printf("      %8d us: %d\r\n", (i == 0) ? 0 : (1 << i),
+				flow->rtt_hist[i]);
+#if PERF_OUTPUT_CSV
+		xil_printf("perf,rtt_hist,flow=%d,from_us=%d,count=%d\r\n",
+				flow->id, (i == 0) ? 0 : (1 << i),
+				flow->rtt_hist[i]);
+#endif
+	}
+}
+
+static void perf_print_counter(const char *layer, const char *name,
+		u64_t value)
+{
+	char v[21];
+
+	u64_str(v, value);
+	xil_printf("  %s %s: %s\r\n", layer, name, v);
+#if PERF_OUTPUT_CSV
+	xil_printf("perf,counter,layer=%s,name=%s,value=%s\r\n",
+			layer, name, v);
+#endif
+}
+
+#if LWIP_STATS
+static void perf_print_proto(const char *layer,
+		const struct stats_proto *proto)
+{
+	perf_print_counter(layer, "xmit", proto->xmit);
+	perf_print_counter(layer, "recv", proto->recv);
+	perf_print_counter(layer, "drop", proto->drop);
+	perf_print_counter(layer, "chkerr", proto->chkerr);
+	perf_print_counter(layer, "memerr", proto->memerr);
+	perf_print_counter(layer, "err", proto->err);
+}
+#endif
+
+/** Accumulate GEM statistics registers, they clear on read */
+static void perf_emac_sample(void)
+{
+#ifdef PERF_EMAC_IS_GEM
+	u32_t i;
+
+	if (!PERF_EMAC_IS_GEM)
+		return;
+
+	for (i = 0; i < sizeof(emac_counters) / sizeof(emac_counters[0]); i++)
+		emac_totals[i] += Xil_In32(PLATFORM_EMAC_BASEADDR +
+				emac_counters[i].offset);
+#endif
+}
+
+static void perf_print_counters(void)
+{
+	xil_printf("Counters:\r\n");
+#if LWIP_STATS
+	perf_print_proto("link", &lwip_stats.link);
+	perf_print_proto("ip", &lwip_stats.ip);
+	perf_print_proto("tcp", &lwip_stats.tcp);
+	perf_print_proto("udp", &lwip_stats.udp);
+#else
+	xil_printf("  lwIP statistics disabled, set lwip_stats in the BSP\r\n");
+#endif
+
+#ifdef PERF_EMAC_IS_GEM
+	if (PERF_EMAC_IS_GEM) {
+		u32_t i;
+
+		perf_emac_sample();
+		for (i = 0; i < sizeof(emac_counters) / sizeof(emac_counters[0]);
+				i++)
+			perf_print_counter("mac", emac_counters[i].name,
+					emac_totals[i]);
+	}
+#endif
+}
+
+static void perf_flow_report(const struct perf_flow *flow, u64_t now)
+{
+	perf_print_bw("flow", flow->id, start_ms, now, flow->total_bytes);
+	if ((PERF_TEST == PERF_UDP_RX) || (PERF_TEST == PERF_UDP_TX)) {
+		xil_printf("[%3d] %d datagrams, %d lost\r\n", flow->id,
+				flow->datagrams, flow->lost);
+#if PERF_OUTPUT_CSV
+		xil_printf("perf,datagrams,flow=%d,sent_or_rcvd=%d,lost=%d\r\n",
+				flow->id, flow->datagrams, flow->lost);
+#endif
+	}
+	if ((PERF_TEST == PERF_TCP_RTT) || (PERF_TEST == PERF_UDP_RTT))
+		perf_print_rtt(flow);
+}
+
+static void perf_final_report(void)
+{
+	u64_t now = get_time_ms();
+	u64_t sum = 0;
+	int i;
+
+	if (!running)
+		return;
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		if (!flows[i].id)
+			continue;
+		perf_flow_report(&flows[i], now);
+		sum += flows[i].total_bytes;
+	}
+	perf_print_bw("total", -1, start_ms, now, sum);
+	perf_print_counters();
+	running = 0;
+	xil_printf("Perf test done\n\r");
+}
+
+static void perf_flow_reset(struct perf_flow *flow, u8_t id)
+{
+	memset(flow, 0, sizeof(*flow));
+	flow->id = id;
+	flow->rtt_min = 0xFFFFFFFF;
+}
+
+/** Record the RTT of the message currently in flight on a flow */
+static void perf_rtt_record(struct perf_flow *flow)
+{
+	XTime delta = perf_cycles() - flow->rtt_start;
+	u32_t us = (u32_t)(((u64_t)delta * 1000000) / COUNTS_PER_SECOND);
+	int bucket = 0;
+
+	while ((bucket < (PERF_RTT_BUCKETS - 1)) && (us >> (bucket + 1)))
+		bucket++;
+
+	flow->rtt_hist[bucket]++;
+	flow->rtt_count++;
+	flow->rtt_sum += us;
+	if (us < flow->rtt_min)
+		flow->rtt_min = us;
+	if (us > flow->rtt_max)
+		flow->rtt_max = us;
+}
+
+/*
+ * TCP
+ */
+
+static void perf_tcp_close(struct perf_flow *flow)
+{
+	struct tcp_pcb *pcb = flow->tpcb;
+
+	flow->tpcb = NULL;
+	flow->active = 0;
+	if (pcb != NULL) {
+		tcp_arg(pcb, NULL);
+		tcp_sent(pcb, NULL);
+		tcp_recv(pcb, NULL);
+		tcp_err(pcb, NULL);
+		if (tcp_close(pcb) != ERR_OK) {
+			/* Free memory with abort */
+			tcp_abort(pcb);
+		}
+	}
+}
+
+static void perf_tcp_err(void *arg, err_t err)
+{
+	struct perf_flow *flow = arg;
+
+	LWIP_UNUSED_ARG(err);
+	/* pcb is already freed by lwIP */
+	flow->tpcb = NULL;
+	flow->active = 0;
+	xil_printf("[%3d] TCP connection aborted\n\r", flow->id);
+}
+
+/** Write one RTT message, Nagle is off so it is sent right away */
+static err_t perf_tcp_rtt_send(struct perf_flow *flow)
+{
+	err_t err;
+
+	flow->rtt_rcvd = 0;
+	flow->rtt_start_ms = get_time_ms();
+	flow->rtt_start = perf_cycles();
+	err = tcp_write(flow->tpcb, send_buf, PERF_MSG_SIZE,
+			TCP_WRITE_FLAG_COPY);
+	if (err == ERR_OK)
+		err = tcp_output(flow->tpcb);
+
+	return err;
+}
+
+/** Fill the send buffer of a TCP flow, returns number of messages queued */
+static u32_t perf_tcp_send(struct perf_flow *flow)
+{
+	u8_t apiflags = TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE;
+	u32_t count = 0;
+
+	if (!flow->active || (flow->tpcb == NULL))
+		return 0;
+
+#ifdef __MICROBLAZE__
+	/* Zero-copy pbufs is used to get maximum performance for Microblaze */
+	apiflags = 0;
+#endif
+
+	while (tcp_sndbuf(flow->tpcb) > PERF_MSG_SIZE) {
+		if (tcp_write(flow->tpcb, send_buf, PERF_MSG_SIZE,
+					apiflags) != ERR_OK)
+			break;
+		flow->total_bytes += PERF_MSG_SIZE;
+		flow->interval_bytes += PERF_MSG_SIZE;
+		count++;
+	}
+
+	if (count)
+		tcp_output(flow->tpcb);
+
+	return count;
+}
+
+static err_t perf_tcp_sent(void *arg, struct tcp_pcb *tpcb, u16_t len)
+{
+	LWIP_UNUSED_ARG(tpcb);
+	LWIP_UNUSED_ARG(len);
+
+	if (PERF_TEST == PERF_TCP_TX)
+		(void)perf_tcp_send(arg);
+
+	return ERR_OK;
+}
+
+static err_t perf_tcp_recv(void *arg, struct tcp_pcb *tpcb,
+		struct pbuf *p, err_t err)
+{
+	struct perf_flow *flow = arg;
+
+	if (p == NULL) {
+		perf_tcp_close(flow);
+		return ERR_OK;
+	}
+
+	flow->total_bytes += p->tot_len;
+	flow->interval_bytes += p->tot_len;
+	tcp_recved(tpcb, p->tot_len);
+
+	if (PERF_TEST == PERF_TCP_RTT) {
+		flow->rtt_rcvd += p->tot_len;
+		if (flow->rtt_rcvd >= PERF_MSG_SIZE) {
+			perf_rtt_record(flow);
+			if (running)
+				(void)perf_tcp_rtt_send(flow);
+		}
+	}
+
+	pbuf_free(p);
+	return ERR_OK;
+}
+
+static void perf_tcp_flow_setup(struct perf_flow *flow, struct tcp_pcb *pcb)
+{
+	flow->tpcb = pcb;
+	flow->active = 1;
+
+	tcp_arg(pcb, flow);
+	tcp_sent(pcb, perf_tcp_sent);
+	tcp_recv(pcb, perf_tcp_recv);
+	tcp_err(pcb, perf_tcp_err);
+
+	xil_printf("[%3d] local %s port %d connected with ", flow->id,
+			ipaddr_ntoa(&pcb->local_ip), pcb->local_port);
+	xil_printf("%s port %d\r\n", ipaddr_ntoa(&pcb->remote_ip),
+			pcb->remote_port);
+}
+
+static err_t perf_tcp_connected(void *arg, struct tcp_pcb *tpcb, err_t err)
+{
+	struct perf_flow *flow = arg;
+
+	if (err != ERR_OK) {
+		flow->tpcb = NULL;
+		xil_printf("[%3d] Connection error\n\r", flow->id);
+		return err;
+	}
+
+	perf_tcp_flow_setup(flow, tpcb);
+	perf_start();
+
+	if (PERF_TEST == PERF_TCP_RTT) {
+		tcp_nagle_disable(tpcb);
+		return perf_tcp_rtt_send(flow);
+	}
+
+	(void)perf_tcp_send(flow);
+	return ERR_OK;
+}
+
+static err_t perf_tcp_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
+{
+	int i;
+
+	LWIP_UNUSED_ARG(arg);
+	if ((err != ERR_OK) || (newpcb == NULL))
+		return ERR_VAL;
+
+	/* Flow slots are not reused, the results of every flow are kept */
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		if (!flows[i].id) {
+			perf_flow_reset(&flows[i], i + 1);
+			perf_start();
+			perf_tcp_flow_setup(&flows[i], newpcb);
+			return ERR_OK;
+		}
+	}
+
+	xil_printf("TCP server: no free flow, rejecting connection\r\n");
+	tcp_abort(newpcb);
+	return ERR_ABRT;
+}
+
+static void perf_tcp_start(void)
+{
+	struct tcp_pcb *pcb, *lpcb;
+	err_t err;
+	int i;
+
+	if (PERF_TEST == PERF_TCP_RX) {
+		pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+		if (!pcb) {
+			xil_printf("TCP server: Error creating PCB. "
+					"Out of Memory\r\n");
+			return;
+		}
+
+		err = tcp_bind(pcb, IP_ADDR_ANY, PERF_SERVER_PORT);
+		if (err != ERR_OK) {
+			xil_printf("TCP server: Unable to bind to port %d: "
+					"err = %d\r\n", PERF_SERVER_PORT, err);
+			tcp_close(pcb);
+			return;
+		}
+
+		lpcb = tcp_listen_with_backlog(pcb, PERF_NUM_FLOWS);
+		if (!lpcb) {
+			xil_printf("TCP server: Out of memory while "
+					"tcp_listen\r\n");
+			tcp_close(pcb);
+			return;
+		}
+
+		tcp_arg(lpcb, NULL);
+		tcp_accept(lpcb, perf_tcp_accept);
+		return;
+	}
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		perf_flow_reset(&flows[i], i + 1);
+		pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+		if (!pcb) {
+			xil_printf("Error in PCB creation. out of memory\r\n");
+			return;
+		}
+
+		flows[i].tpcb = pcb;
+		tcp_arg(pcb, &flows[i]);
+		tcp_err(pcb, perf_tcp_err);
+		err = tcp_connect(pcb, &server_addr, PERF_SERVER_PORT,
+				perf_tcp_connected);
+		if (err != ERR_OK) {
+			xil_printf("Error on tcp_connect: %d\r\n", err);
+			perf_tcp_close(&flows[i]);
+			return;
+		}
+	}
+}
+
+/*
+ * UDP
+ */
+
+/** Send one datagram carrying an iperf style datagram id */
+static err_t perf_udp_send(struct perf_flow *flow, s32_t id)
+{
+	struct pbuf *packet;
+	err_t err;
+
+	packet = pbuf_alloc(PBUF_TRANSPORT, PERF_MSG_SIZE, PBUF_POOL);
+	if (!packet)
+		return ERR_MEM;
+
+	pbuf_take(packet, send_buf, PERF_MSG_SIZE);
+	((u32_t *)packet->payload)[0] = htonl(id);
+
+	err = udp_send(flow->upcb, packet);
+	pbuf_free(packet);
+
+	return err;
+}
+
+static void perf_udp_rtt_send(struct perf_flow *flow)
+{
+	flow->rtt_start_ms = get_time_ms();
+	flow->rtt_start = perf_cycles();
+	if (perf_udp_send(flow, flow->seq) != ERR_OK)
+		/* retried on the RTT timeout */
+		flow->rtt_start_ms = 0;
+}
+
+static void perf_udp_recv(void *arg, struct udp_pcb *upcb, struct pbuf *p,
+		const ip_addr_t *addr, u16_t port)
+{
+	struct perf_flow *flow = arg;
+	s32_t id;
+	int i;
+
+	LWIP_UNUSED_ARG(upcb);
+	LWIP_UNUSED_ARG(addr);
+
+	if (p->tot_len < sizeof(id)) {
+		pbuf_free(p);
+		return;
+	}
+	pbuf_copy_partial(p, &id, sizeof(id), 0);
+	id = ntohl(id);
+
+	if (PERF_TEST == PERF_UDP_RTT) {
+		/* Late echoes of timed out messages are ignored */
+		if ((u32_t)id == flow->seq) {
+			perf_rtt_record(flow);
+			flow->total_bytes += p->tot_len;
+			flow->interval_bytes += p->tot_len;
+			flow->seq++;
+			if (running)
+				perf_udp_rtt_send(flow);
+		}
+		pbuf_free(p);
+		return;
+	}
+
+	/* UDP receive test, iperf clients are told apart by source port */
+	flow = NULL;
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		if (flows[i].id && (flows[i].remote_port == port)) {
+			flow = &flows[i];
+			break;
+		}
+		if (!flows[i].id) {
+			perf_flow_reset(&flows[i], i + 1);
+			flows[i].remote_port = port;
+			flows[i].active = 1;
+			flow = &flows[i];
+			perf_start();
+			xil_printf("[%3d] UDP flow from %s port %d\r\n",
+					flow->id, ipaddr_ntoa(addr), port);
+			break;
+		}
+	}
+
+	if ((flow != NULL) && flow->active) {
+		if (id < 0) {
+			/* iperf marks the last datagram with a negative id */
+			flow->active = 0;
+		} else {
+			if ((u32_t)id > flow->seq)
+				flow->lost += (u32_t)id - flow->seq;
+			if ((u32_t)id >= flow->seq)
+				flow->seq = (u32_t)id + 1;
+			flow->datagrams++;
+			flow->total_bytes += p->tot_len;
+			flow->interval_bytes += p->tot_len;
+		}
+	}
+
+	pbuf_free(p);
+}
+
+static void perf_udp_start(void)
+{
+	err_t err;
+	int i;
+
+	if (PERF_TEST == PERF_UDP_RX) {
+		udp_rx_pcb = udp_new();
+		if (!udp_rx_pcb) {
+			xil_printf("Error in PCB creation. out of memory\r\n");
+			return;
+		}
+
+		err = udp_bind(udp_rx_pcb, IP_ADDR_ANY, PERF_SERVER_PORT);
+		if (err != ERR_OK) {
+			xil_printf("UDP server: Unable to bind to port %d: "
+					"err = %d\r\n", PERF_SERVER_PORT, err);
+			udp_remove(udp_rx_pcb);
+			udp_rx_pcb = NULL;
+			return;
+		}
+
+		udp_recv(udp_rx_pcb, perf_udp_recv, NULL);
+		return;
+	}
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		perf_flow_reset(&flows[i], i + 1);
+		flows[i].upcb = udp_new();
+		if (!flows[i].upcb) {
+			xil_printf("Error in PCB creation. out of memory\r\n");
+			return;
+		}
+
+		err = udp_connect(flows[i].upcb, &server_addr,
+				PERF_SERVER_PORT);
+		if (err != ERR_OK) {
+			xil_printf("Error on udp_connect: %d\r\n", err);
+			udp_remove(flows[i].upcb);
+			flows[i].upcb = NULL;
+			return;
+		}
+
+		udp_recv(flows[i].upcb, perf_udp_recv, &flows[i]);
+		flows[i].active = 1;
+	}
+
+	perf_start();
+
+	if (PERF_TEST == PERF_UDP_RTT) {
+		for (i = 0; i < PERF_NUM_FLOWS; i++)
+			perf_udp_rtt_send(&flows[i]);
+	}
+}
+
+/** Send a burst of datagrams on every UDP transmit flow */
+static u32_t perf_udp_tx(void)
+{
+	u32_t count = 0;
+	int i, j;
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		if (!flows[i].active)
+			continue;
+
+		for (j = 0; j < PERF_UDP_BURST; j++) {
+			if (perf_udp_send(&flows[i], flows[i].seq) != ERR_OK)
+				break;
+			flows[i].seq++;
+			flows[i].datagrams++;
+			flows[i].total_bytes += PERF_MSG_SIZE;
+			flows[i].interval_bytes += PERF_MSG_SIZE;
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/** Count messages without echo as lost and send the next one */
+static void perf_rtt_timeouts(u64_t now)
+{
+	int i;
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		if (!flows[i].active ||
+			((now - flows[i].rtt_start_ms) < PERF_RTT_TIMEOUT_MS))
+			continue;
+
+		if (flows[i].rtt_start_ms)
+			flows[i].lost++;
+
+		if (PERF_TEST == PERF_UDP_RTT) {
+			flows[i].seq++;
+			perf_udp_rtt_send(&flows[i]);
+		} else {
+			/* a TCP message is not lost, only late */
+			flows[i].rtt_start_ms = now;
+		}
+	}
+}
+
+static void perf_stop(void)
+{
+	int i;
+
+	perf_final_report();
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++) {
+		if (flows[i].tpcb != NULL)
+			perf_tcp_close(&flows[i]);
+
+		if (flows[i].upcb != NULL) {
+			if (PERF_TEST == PERF_UDP_TX)
+				/* tell the iperf server the test is over */
+				(void)perf_udp_send(&flows[i], -flows[i].seq);
+			udp_remove(flows[i].upcb);
+			flows[i].upcb = NULL;
+		}
+		flows[i].active = 0;
+	}
+}
+
+/** Poll the test from the main loop, returns non zero if work was done */
+int transfer_data(void)
+{
+	u64_t now;
+	u32_t count = 0;
+	int i, active = 0;
+
+	if (!running)
+		return 0;
+
+	if (PERF_TEST == PERF_TCP_TX) {
+		for (i = 0; i < PERF_NUM_FLOWS; i++)
+			count += perf_tcp_send(&flows[i]);
+	} else if (PERF_TEST == PERF_UDP_TX) {
+		count = perf_udp_tx();
+	}
+
+	now = get_time_ms();
+	if ((PERF_TEST == PERF_TCP_RTT) || (PERF_TEST == PERF_UDP_RTT))
+		perf_rtt_timeouts(now);
+
+	if ((now - report_ms) >= (PERF_REPORT_INTERVAL * 1000)) {
+		perf_emac_sample();
+		perf_interval_report(now);
+	}
+
+	for (i = 0; i < PERF_NUM_FLOWS; i++)
+		active += flows[i].active;
+
+	switch (PERF_TEST) {
+	case PERF_TCP_RX:
+	case PERF_UDP_RX:
+		/* receive tests end when every host flow has finished */
+		if (!active && flows[0].id)
+			perf_stop();
+		break;
+	default:
+		if ((now - start_ms) >= (PERF_TEST_DURATION * 1000))
+			perf_stop();
+		break;
+	}
+
+	return count != 0;
+}
+
+void start_application(void)
+{
+	u32_t i;
+
+	/* initialize data buffer being sent with same as used in iperf */
+	for (i = 0; i < PERF_MSG_SIZE; i++)
+		send_buf[i] = (i % 10) + '0';
+
+	if ((PERF_TEST != PERF_TCP_RX) && (PERF_TEST != PERF_UDP_RX)) {
+		if (!ipaddr_aton(PERF_SERVER_IP_ADDRESS, &server_addr)) {
+			xil_printf("Invalid Server IP address: %s\r\n",
+					PERF_SERVER_IP_ADDRESS);
+			return;
+		}
+	}
+
+	/* discard MAC counts from before the test */
+	perf_emac_sample();
+#ifdef PERF_EMAC_IS_GEM
+	memset(emac_totals, 0, sizeof(emac_totals));
+#endif
+
+	if ((PERF_TEST == PERF_TCP_TX) || (PERF_TEST == PERF_TCP_RX) ||
+			(PERF_TEST == PERF_TCP_RTT))
+		perf_tcp_start();
+	else
+		perf_udp_start();
+}
@@ -0,0 +1,136 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+
+#ifndef __PERF_SUITE_H_
+#define __PERF_SUITE_H_
+
+#include "lwipopts.h"
+#include "lwip/ip_addr.h"
+#include "lwip/err.h"
+#include "lwip/tcp.h"
+#include "lwip/udp.h"
+#include "lwip/inet.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include "platform.h"
+
+/* Tests, selected with PERF_TEST */
+enum perf_test {
+	/* TCP bandwidth, board sends to iperf server on host */
+	PERF_TCP_TX,
+	/* TCP bandwidth, board receives from iperf client on host */
+	PERF_TCP_RX,
+	/* UDP bandwidth, board sends to iperf server on host */
+	PERF_UDP_TX,
+	/* UDP bandwidth, board receives from iperf client on host */
+	PERF_UDP_RX,
+	/* TCP latency, board measures RTT towards an echo server */
+	PERF_TCP_RTT,
+	/* UDP latency, board measures RTT towards an echo server */
+	PERF_UDP_RTT
+};
+
+/* Test to run */
+#define PERF_TEST PERF_TCP_TX
+
+/* Number of parallel flows (connections or UDP sockets) */
+#define PERF_NUM_FLOWS 4
+
+/* Size in bytes of each message written to or echoed by a flow */
+#define PERF_MSG_SIZE 1440
+
+/* Host running iperf or the echo server, and the port it uses.
+ * For receive tests the board listens on PERF_SERVER_PORT.
+ */
+#define PERF_SERVER_IP_ADDRESS "192.168.1.100"
+#define PERF_SERVER_PORT 5001
+
+/* time in seconds the transmit and latency tests run for */
+#define PERF_TEST_DURATION 60
+
+/* seconds between periodic reports */
+#define PERF_REPORT_INTERVAL 5
+
+/* Latency test: log2 microsecond buckets of the RTT histogram, the last
+ * bucket takes every RTT above its lower bound
+ */
+#define PERF_RTT_BUCKETS 16
+
+/* Latency test: a message without echo within this time counts as lost */
+#define PERF_RTT_TIMEOUT_MS 1000
+
+/* UDP transmit test: datagrams sent per flow on each poll */
+#define PERF_UDP_BURST 4
+
+/* Print machine-readable lines ("perf,<record>,key=value,...") in
+ * addition to the human readable reports
+ */
+#define PERF_OUTPUT_CSV 1
+
+struct perf_flow {
+	u8_t id;
+	u8_t active;
+	struct tcp_pcb *tpcb;
+	struct udp_pcb *upcb;
+	/* remote port, identifies UDP receive flows */
+	u16_t remote_port;
+	u64_t total_bytes;
+	u64_t interval_bytes;
+	u32_t datagrams;
+	/* UDP: next datagram id to send or expected to be received */
+	u32_t seq;
+	u32_t lost;
+	/* latency test state */
+	XTime rtt_start;
+	u64_t rtt_start_ms;
+	u32_t rtt_rcvd;
+	u32_t rtt_count;
+	u32_t rtt_min;
+	u32_t rtt_max;
+	u64_t rtt_sum;
+	u32_t rtt_hist[PERF_RTT_BUCKETS];
+};
+
+struct perf_cpu {
+	/* cycles of main loop passes that found no work */
+	u64_t idle;
+	/* cycles of all main loop passes */
+	u64_t total;
+	XTime last;
+};
+
+void print_app_header(void);
+void start_application(void);
+int transfer_data(void);
+void perf_cpu_account(u32_t busy);
+
+#endif /* __PERF_SUITE_H_ */
@@ -51,6 +51,13 @@ void print_app_header(void)
 			inet_ntoa(server_netif.ip_addr),
 			INTERIM_REPORT_INTERVAL);
 #endif /* LWIP_IPV6 */
+#if LWIP_WND_SCALE
+	xil_printf("TCP window scaling: wnd %d bytes, snd_buf %d bytes, "
+			"scale %d\r\n", TCP_WND, TCP_SND_BUF, TCP_RCV_SCALE);
+#else
+	xil_printf("TCP window: wnd %d bytes, snd_buf %d bytes\r\n",
+			TCP_WND, TCP_SND_BUF);
+#endif /* LWIP_WND_SCALE */
 }
 
 static void print_tcp_conn_stats(void)
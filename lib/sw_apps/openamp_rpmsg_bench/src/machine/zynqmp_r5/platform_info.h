@@ -0,0 +1,21 @@
+#ifndef PLATFORM_INFO_H_
+#define PLATFORM_INFO_H_
+
+#include "openamp/hil.h"
+
+/* Interrupt vectors */
+#define IPI_IRQ_VECT_ID         XPAR_XIPIPSU_0_INT_ID
+
+#define RPMSG_CHAN_NAME         "rpmsg-openamp-demo-channel"
+
+/* IPI notifications sent to and received from the master */
+struct platform_ipi_stats {
+	unsigned long sent;
+	unsigned long received;
+};
+
+extern struct platform_ipi_stats platform_ipi_stats;
+
+struct hil_proc *platform_create_proc(int proc_index);
+
+#endif /* PLATFORM_INFO_H_ */
@@ -0,0 +1,504 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of Xilinx nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**************************************************************************************
+* This application is the bare-metal remote side of an RPMsg latency and bandwidth
+* benchmark. The master drives the tests with the messages of rpmsg_bench.h; the
+* remote times them with the system timestamp counter shared with the A53 and
+* reports the results back to the master and on its own console.
+*
+* For every test the remote collects a latency histogram, the bandwidth, the IPIs
+* it sent and received and the time spent in cache maintenance of the payloads.
+* Running the same test with BENCH_NOTIFY_IPI and BENCH_NOTIFY_POLL, and with the
+* remote built with and without -DBENCH_EVENT_IDX, compares the virtqueue notify
+* modes.
+*
+* The RPMsg channel is set up as in the echo test demo, and the shut-down message
+* of the demos stops the application.
+*
+**************************************************************************************/
+
+#include <string.h>
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "metal/cache.h"
+#include "openamp/open_amp.h"
+#include "rsc_table.h"
+#include "platform_info.h"
+#include "rpmsg_bench.h"
+
+#define LPRINTF(format, ...) xil_printf(format, ##__VA_ARGS__)
+#define LPERROR(format, ...) LPRINTF("ERROR: " format, ##__VA_ARGS__)
+
+/* System timestamp counter, also read by the A53 as CNTPCT */
+#define SCNTRS_BASE_ADDR	0xFF260000U
+#define SCNTRS_CNT_LO_OFFSET	0x08U
+#define SCNTRS_CNT_HI_OFFSET	0x0CU
+#define SCNTRS_FREQ_OFFSET	0x20U
+
+/* External functions */
+extern int init_system(void);
+extern void cleanup_system(void);
+
+/* Local variables */
+static struct remote_proc *proc = NULL;
+static struct rsc_table_info rsc_info;
+static int evt_chnl_deleted = 0;
+static int evt_virtio_rst = 0;
+static struct rpmsg_channel *app_chnl;
+
+/* Current test */
+static struct bench_start cfg;
+static struct bench_result res;
+static int running;		/* START received, test in progress */
+static int finished;		/* test over, result to be sent */
+static uint32_t tx_seq;		/* DATA messages sent by the remote */
+static uint32_t rx_seq;		/* DATA messages received */
+static int rtt_waiting;		/* RTT: echo of the last DATA outstanding */
+static uint64_t first_ts;	/* timestamp of the first DATA message */
+static unsigned long ipi_sent_base;
+static unsigned long ipi_received_base;
+
+/*-----------------------------------------------------------------------------*
+ *  Measurement helpers
+ *-----------------------------------------------------------------------------*/
+static uint64_t bench_now(void)
+{
+	uint32_t hi, lo;
+
+	do {
+		hi = Xil_In32(SCNTRS_BASE_ADDR + SCNTRS_CNT_HI_OFFSET);
+		lo = Xil_In32(SCNTRS_BASE_ADDR + SCNTRS_CNT_LO_OFFSET);
+	} while (hi != Xil_In32(SCNTRS_BASE_ADDR + SCNTRS_CNT_HI_OFFSET));
+
+	return ((uint64_t)hi << 32) | lo;
+}
+
+static uint64_t bench_to_ns(uint64_t counts)
+{
+	return res.freq ? (counts * 1000000000ULL) / res.freq : 0;
+}
+
+static void bench_record(uint64_t lat)
+{
+	uint64_t us = bench_to_ns(lat) / 1000U;
+	unsigned int bucket = 0;
+
+	if (lat < res.lat_min)
+		res.lat_min = lat;
+	if (lat > res.lat_max)
+		res.lat_max = lat;
+	res.lat_sum += lat;
+
+	while (us && bucket < BENCH_HIST_BUCKETS - 1) {
+		bucket++;
+		us >>= 1;
+	}
+	res.hist[bucket]++;
+}
+
+static void bench_cache(void *data, unsigned int len, int flush)
+{
+	uint64_t start;
+
+	if (!(cfg.flags & BENCH_FLAG_CACHE_OPS))
+		return;
+
+	start = bench_now();
+	if (flush)
+		metal_cache_flush(data, len);
+	else
+		metal_cache_invalidate(data, len);
+	res.cache_time += bench_now() - start;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  Test control
+ *-----------------------------------------------------------------------------*/
+static int bench_send_data(void)
+{
+	struct bench_hdr *hdr;
+	uint32_t size;
+
+	hdr = rpmsg_get_tx_payload_buffer(app_chnl, &size, 1);
+	if (!hdr)
+		return -1;
+
+	hdr->magic = BENCH_MAGIC;
+	hdr->cmd = BENCH_CMD_DATA;
+	hdr->seq = tx_seq++;
+	hdr->reserved = 0;
+	hdr->timestamp = bench_now();
+	bench_cache(hdr, cfg.size, 1);
+
+	return rpmsg_send_nocopy(app_chnl, hdr, cfg.size);
+}
+
+static void bench_start(const struct bench_start *start)
+{
+	uint32_t max_size = (uint32_t)rpmsg_get_buffer_size(app_chnl);
+
+	memcpy(&cfg, start, sizeof(cfg));
+	if (cfg.size < sizeof(struct bench_hdr))
+		cfg.size = sizeof(struct bench_hdr);
+	if (cfg.size > max_size)
+		cfg.size = max_size;
+
+	memset(&res, 0, sizeof(res));
+	res.hdr.magic = BENCH_MAGIC;
+	res.hdr.cmd = BENCH_CMD_RESULT;
+	res.test = cfg.test;
+	res.size = cfg.size;
+	res.count = cfg.count;
+	res.notify = cfg.notify;
+	res.flags = cfg.flags;
+	res.event_idx =
+		(proc->rdev->rvq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX) ? 1 : 0;
+	res.freq = Xil_In32(SCNTRS_BASE_ADDR + SCNTRS_FREQ_OFFSET);
+	res.lat_min = ~0ULL;
+
+	tx_seq = 0;
+	rx_seq = 0;
+	rtt_waiting = 0;
+	first_ts = 0;
+	ipi_sent_base = platform_ipi_stats.sent;
+	ipi_received_base = platform_ipi_stats.received;
+
+	running = 1;
+	finished = (cfg.count == 0);
+}
+
+static void bench_report(void)
+{
+	uint64_t avg = res.messages ? res.lat_sum / res.messages : 0;
+	uint64_t kbps = res.elapsed ?
+		(res.bytes * res.freq) / (res.elapsed * 1024U) : 0;
+	unsigned int i;
+
+	if (!res.messages)
+		res.lat_min = 0;
+
+	LPRINTF("test %u size %u count %u notify %u event_idx %u\r\n",
+		(unsigned int)res.test, (unsigned int)res.size,
+		(unsigned int)res.count, (unsigned int)res.notify,
+		(unsigned int)res.event_idx);
+	LPRINTF("  messages %u errors %u latency ns min %u avg %u max %u\r\n",
+		(unsigned int)res.messages, (unsigned int)res.errors,
+		(unsigned int)bench_to_ns(res.lat_min),
+		(unsigned int)bench_to_ns(avg),
+		(unsigned int)bench_to_ns(res.lat_max));
+	LPRINTF("  %u KB/s, IPIs sent %u received %u, cache ns %u\r\n",
+		(unsigned int)kbps, (unsigned int)res.ipi_sent,
+		(unsigned int)res.ipi_received,
+		(unsigned int)bench_to_ns(res.cache_time));
+	LPRINTF("  histogram (<1us, <2us, <4us, ...):");
+	for (i = 0; i < BENCH_HIST_BUCKETS; i++)
+		LPRINTF(" %u", (unsigned int)res.hist[i]);
+	LPRINTF("\r\n");
+}
+
+static void bench_finish(void)
+{
+	running = 0;
+	finished = 0;
+
+	if (cfg.notify == BENCH_NOTIFY_POLL)
+		virtqueue_enable_cb(proc->rdev->rvq);
+
+	res.ipi_sent = (uint32_t)(platform_ipi_stats.sent - ipi_sent_base);
+	res.ipi_received =
+		(uint32_t)(platform_ipi_stats.received - ipi_received_base);
+	bench_report();
+
+	if (rpmsg_send(app_chnl, &res, sizeof(res)) < 0) {
+		LPERROR("rpmsg_send failed\r\n");
+	}
+}
+
+static void bench_data(struct rpmsg_channel *rp_chnl, struct bench_hdr *hdr,
+		       int len, uint64_t now)
+{
+	bench_cache(hdr, len, 0);
+
+	if (hdr->seq != rx_seq)
+		res.errors++;
+	rx_seq = hdr->seq + 1;
+
+	switch (cfg.test) {
+	case BENCH_TEST_ECHO:
+		if (!res.messages)
+			first_ts = now;
+		if (rpmsg_send(rp_chnl, hdr, len) < 0)
+			res.errors++;
+		break;
+	case BENCH_TEST_ONEWAY:
+		if (!res.messages)
+			first_ts = hdr->timestamp;
+		if (now < hdr->timestamp)
+			res.errors++;
+		else
+			bench_record(now - hdr->timestamp);
+		break;
+	case BENCH_TEST_RTT:
+		if (!rtt_waiting) {
+			res.errors++;
+			return;
+		}
+		bench_record(now - hdr->timestamp);
+		rtt_waiting = 0;
+		/* Both directions are counted */
+		res.bytes += len;
+		break;
+	default:
+		res.errors++;
+		return;
+	}
+
+	res.messages++;
+	res.bytes += len;
+	if (res.messages == cfg.count) {
+		res.elapsed = now - first_ts;
+		finished = 1;
+	}
+}
+
+static void virtio_rst_cb(struct hil_proc *hproc, int id)
+{
+	/* hil_proc only supports single virtio device */
+	(void)id;
+
+	if (!proc || proc->proc != hproc || !proc->rdev)
+		return;
+
+	LPRINTF("Resetting RPMsg\n");
+	evt_virtio_rst = 1;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  RPMSG callbacks setup by remoteproc_resource_init()
+ *-----------------------------------------------------------------------------*/
+static void rpmsg_read_cb(struct rpmsg_channel *rp_chnl, void *data, int len,
+			  void *priv, unsigned long src)
+{
+	struct bench_hdr *hdr = data;
+	uint64_t now = bench_now();
+
+	(void)priv;
+	(void)src;
+
+	/* On reception of a shutdown we signal the application to terminate */
+	if (len >= (int)sizeof(uint32_t) &&
+	    (*(unsigned int *)data) == BENCH_SHUTDOWN_MSG) {
+		evt_chnl_deleted = 1;
+		return;
+	}
+
+	if (len < (int)sizeof(*hdr) || hdr->magic != BENCH_MAGIC) {
+		if (running)
+			res.errors++;
+		return;
+	}
+
+	switch (hdr->cmd) {
+	case BENCH_CMD_START:
+		app_chnl = rp_chnl;
+		if (len >= (int)sizeof(struct bench_start))
+			bench_start(data);
+		break;
+	case BENCH_CMD_DATA:
+		if (running && !finished)
+			bench_data(rp_chnl, hdr, len, now);
+		break;
+	case BENCH_CMD_DONE:
+		if (running && cfg.test == BENCH_TEST_TX_BW) {
+			res.elapsed = now - first_ts;
+			res.messages = tx_seq;
+			res.bytes = (uint64_t)tx_seq * cfg.size;
+			finished = 1;
+		}
+		break;
+	default:
+		if (running)
+			res.errors++;
+		break;
+	}
+}
+
+static void rpmsg_channel_created(struct rpmsg_channel *rp_chnl)
+{
+	app_chnl = rp_chnl;
+}
+
+static void rpmsg_channel_deleted(struct rpmsg_channel *rp_chnl)
+{
+	(void)rp_chnl;
+
+	app_chnl = NULL;
+	evt_chnl_deleted = 1;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  Application
+ *-----------------------------------------------------------------------------*/
+static void bench_run(void)
+{
+	/* RTT: one DATA message in flight at a time */
+	if (cfg.test == BENCH_TEST_RTT && !rtt_waiting && tx_seq < cfg.count) {
+		if (!tx_seq)
+			first_ts = bench_now();
+		rtt_waiting = 1;
+		if (bench_send_data() < 0) {
+			res.errors++;
+			finished = 1;
+		}
+	}
+
+	/* TX_BW: send everything, the master answers with DONE */
+	if (cfg.test == BENCH_TEST_TX_BW && tx_seq < cfg.count) {
+		first_ts = bench_now();
+		while (tx_seq < cfg.count) {
+			if (bench_send_data() < 0) {
+				res.errors++;
+				finished = 1;
+				break;
+			}
+		}
+	}
+}
+
+int app(struct hil_proc *hproc)
+{
+	int status = 0;
+
+	/* Initialize RPMSG framework */
+	LPRINTF("Try to init remoteproc resource\n");
+	status = remoteproc_resource_init(&rsc_info, hproc,
+				     rpmsg_channel_created,
+				     rpmsg_channel_deleted, rpmsg_read_cb,
+				     &proc, 0);
+
+	if (RPROC_SUCCESS != status) {
+		LPERROR("Failed  to initialize remoteproc resource.\n");
+		return -1;
+	}
+	LPRINTF("Init remoteproc resource succeeded\n");
+
+	hil_set_vdev_rst_cb(hproc, 0, virtio_rst_cb);
+
+	LPRINTF("Waiting for benchmark commands...\n");
+	while(1) {
+		if (running && !finished)
+			bench_run();
+		if (finished)
+			bench_finish();
+
+		if (running && cfg.notify == BENCH_NOTIFY_POLL) {
+			/* Drain the vrings without waiting for a kick and keep
+			 * the master from kicking */
+			if (hil_poll(proc->proc, 1) != 0)
+				hil_notified(proc->proc, (uint32_t)(-1));
+			virtqueue_disable_cb(proc->rdev->rvq);
+		} else {
+			hil_poll(proc->proc, 0);
+		}
+
+		/* we got a shutdown request, exit */
+		if (evt_chnl_deleted) {
+			break;
+		}
+
+		if (evt_virtio_rst) {
+			/* vring rst callback, reset rpmsg */
+			LPRINTF("De-initializing RPMsg\n");
+			running = 0;
+			finished = 0;
+			rpmsg_deinit(proc->rdev);
+			proc->rdev = NULL;
+
+			LPRINTF("Reinitializing RPMsg\n");
+			status = rpmsg_init(hproc, &proc->rdev,
+					    rpmsg_channel_created,
+					    rpmsg_channel_deleted,
+					    rpmsg_read_cb,
+					    1);
+			if (status != RPROC_SUCCESS) {
+				LPERROR("Reinit RPMsg failed\n");
+				break;
+			}
+			LPRINTF("Reinit RPMsg succeeded\n");
+			evt_chnl_deleted=0;
+			evt_virtio_rst = 0;
+		}
+	}
+
+	/* disable interrupts and free resources */
+	LPRINTF("De-initializating remoteproc resource\n");
+	remoteproc_resource_deinit(proc);
+
+	return 0;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  Application entry point
+ *-----------------------------------------------------------------------------*/
+int main(void)
+{
+	unsigned long proc_id = 0;
+	unsigned long rsc_id = 0;
+	struct hil_proc *hproc;
+	int status = -1;
+
+	LPRINTF("Starting application...\n");
+
+	/* Initialize HW system components */
+	init_system();
+
+	hproc = platform_create_proc(proc_id);
+	if (!hproc) {
+		LPERROR("Failed to create proc platform data.\n");
+	} else {
+		rsc_info.rsc_tab = get_resource_table(
+			(int)rsc_id, &rsc_info.size);
+		if (!rsc_info.rsc_tab) {
+			LPERROR("Failed to get resource table data.\n");
+		} else {
+			status = app(hproc);
+		}
+	}
+
+	LPRINTF("Stopping application...\n");
+	cleanup_system();
+
+	/* Suspend processor execution */
+	while (1) {
+		__asm__("wfi\n\t");
+	}
+
+	return status;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of Xilinx nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ * FILE NAME
+ *
+ *       rpmsg_bench.h
+ *
+ * DESCRIPTION
+ *
+ *       Messages exchanged by the RPMsg benchmark master and remote. The
+ *       master (Linux user space through the rpmsg char device, or a bare
+ *       metal A53 application) includes this file too. All fields are
+ *       little endian; timestamps are counts of the ZynqMP system timestamp
+ *       counter, which is CNTPCT on the A53 and IOU_SCNTRS on the R5, so
+ *       timestamps taken on either side can be compared.
+ *
+ *       A test is run as follows:
+ *       1. The master sends BENCH_CMD_START with the test parameters.
+ *       2. The data messages are exchanged as described for each test.
+ *       3. The remote sends BENCH_CMD_RESULT and waits for the next test.
+ *       The first word 0xEF56A55A shuts the remote down, as in the echo
+ *       and matrix multiply demos.
+ *
+ **************************************************************************/
+
+#ifndef RPMSG_BENCH_H_
+#define RPMSG_BENCH_H_
+
+#include <stdint.h>
+
+#define BENCH_MAGIC		0x48434E42U	/* "BNCH" */
+#define BENCH_SHUTDOWN_MSG	0xEF56A55AU
+
+/* Commands, struct bench_hdr.cmd */
+#define BENCH_CMD_START		1U	/* master to remote, bench_start */
+#define BENCH_CMD_DATA		2U	/* either way, hdr and padding */
+#define BENCH_CMD_DONE		3U	/* master to remote, end of TX_BW */
+#define BENCH_CMD_RESULT	4U	/* remote to master, bench_result */
+
+/* Tests, struct bench_start.test */
+#define BENCH_TEST_ECHO		0U	/* remote echoes DATA back; the
+					 * master measures round trips */
+#define BENCH_TEST_RTT		1U	/* remote sends DATA and master
+					 * echoes it; remote measures round
+					 * trips */
+#define BENCH_TEST_ONEWAY	2U	/* master sends DATA stamped with
+					 * its send time; remote measures
+					 * one-way latency and bandwidth */
+#define BENCH_TEST_TX_BW	3U	/* remote sends count DATA without
+					 * waiting; master sends DONE after
+					 * the last one */
+
+/* Remote receive notification modes, struct bench_start.notify */
+#define BENCH_NOTIFY_IPI	0U	/* master kicks an IPI per batch */
+#define BENCH_NOTIFY_POLL	1U	/* kicks suppressed, remote polls
+					 * the vring */
+
+/* Flags, struct bench_start.flags */
+#define BENCH_FLAG_CACHE_OPS	0x1U	/* invalidate received and flush
+					 * sent payloads, and time it */
+
+/* Latency histogram: bucket 0 counts latencies below 1 us, bucket n
+ * latencies in [2^(n-1), 2^n) us, the last one everything above */
+#define BENCH_HIST_BUCKETS	16U
+
+struct bench_hdr {
+	uint32_t magic;
+	uint32_t cmd;
+	uint32_t seq;
+	uint32_t reserved;
+	uint64_t timestamp;
+};
+
+struct bench_start {
+	struct bench_hdr hdr;
+	uint32_t test;
+	uint32_t size;		/* DATA message size, header included */
+	uint32_t count;		/* number of DATA messages */
+	uint32_t notify;
+	uint32_t flags;
+	uint32_t reserved;
+};
+
+struct bench_result {
+	struct bench_hdr hdr;
+	uint32_t test;
+	uint32_t size;
+	uint32_t count;
+	uint32_t notify;
+	uint32_t flags;
+	uint32_t event_idx;	/* event index notification negotiated */
+	uint32_t messages;	/* DATA messages completed */
+	uint32_t errors;	/* malformed or out of order messages */
+	uint64_t freq;		/* timestamp counts per second */
+	uint64_t lat_min;	/* latencies in timestamp counts */
+	uint64_t lat_max;
+	uint64_t lat_sum;
+	uint64_t elapsed;	/* first to last DATA message */
+	uint64_t bytes;		/* DATA bytes moved in elapsed */
+	uint64_t cache_time;	/* time spent in cache maintenance */
+	uint32_t ipi_sent;
+	uint32_t ipi_received;
+	uint32_t hist[BENCH_HIST_BUCKETS];
+};
+
+#endif /* RPMSG_BENCH_H_ */
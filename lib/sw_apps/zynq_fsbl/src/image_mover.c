@@ -73,6 +73,9 @@
 * 						fallback image offset handling using MD5
 * 						Fix for PR#782309 Fallback support for AES
 * 						encryption with E-Fuse - Enhancement
+*       ag  10/14/26    PS partitions from linear boot devices that need no
+*                       validation are loaded without waiting for the PCAP
+*                       DMA, so the copy overlaps the next partition setup
 *
 * </pre>
 *
@@ -104,6 +107,13 @@
 #define MAXIMUM_IMAGE_WORD_LEN 0x40000000
 #define MD5_CHECKSUM_SIZE   16
 
+#ifdef RSA_SUPPORT
+/* Copy chunk size used to hash a signed partition while it is copied */
+#ifndef FSBL_HASH_CHUNK_SIZE
+#define FSBL_HASH_CHUNK_SIZE	0x40000
+#endif
+#endif
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -112,6 +122,9 @@
 u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset);
 u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum);
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum);
+#ifdef RSA_SUPPORT
+static u32 MoveImageAndHash(u32 SourceAddr, u32 DestAddr, u32 Length);
+#endif
 
 /************************** Variable Definitions *****************************/
 /*
@@ -560,6 +573,16 @@ u32 LoadBootImage(void)
 		PartitionNum++;
 	}
 
+	/*
+	 * Last PS partition load may still be in flight
+	 */
+	Status = PcapWaitTransferDone();
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL,"PARTITION_MOVE_FAIL\r\n");
+		OutputStatus(PARTITION_MOVE_FAIL);
+		FsblFallback();
+	}
+
 	return ExecAddress;
 }
 
@@ -1101,6 +1124,17 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 			LoadAddr = DDR_TEMP_START_ADDR;
 		}
 
+#ifdef RSA_SUPPORT
+		/*
+		 * Signed partition is hashed chunk by chunk while it is copied
+		 * so that authentication does not need a second pass
+		 */
+		if (SignedPartitionFlag) {
+			Status = MoveImageAndHash(SourceAddr,
+						LoadAddr,
+						(ImageWordLen << WORD_LENGTH_SHIFT));
+		} else
+#endif
 		Status = MoveImage(SourceAddr,
 						LoadAddr,
 						(ImageWordLen << WORD_LENGTH_SHIFT));
@@ -1129,13 +1163,24 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 		}
 
 		/*
-		 * Data transfer using PCAP
+		 * Data transfer using PCAP. A PS partition that is not validated
+		 * afterwards is not needed until handoff, so do not wait for it;
+		 * the next PCAP access or the end of the partition walk does.
 		 */
-		Status = PcapDataTransfer((u32*)SourceAddr,
+		if (PSPartitionFlag &&
+				!(SignedPartitionFlag || PartitionChecksumFlag)) {
+			Status = PcapDataTransferStart((u32*)SourceAddr,
+						(u32*)LoadAddr,
+						ImageWordLen,
+						DataWordLen,
+						SecureTransferFlag);
+		} else {
+			Status = PcapDataTransfer((u32*)SourceAddr,
 						(u32*)LoadAddr,
 						ImageWordLen,
 						DataWordLen,
 						SecureTransferFlag);
+		}
 		if(Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL, "PCAP Data Transfer Failed\r\n");
 			return XST_FAILURE;
@@ -1333,3 +1378,59 @@ u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum)
     return XST_SUCCESS;
 }
 
+#ifdef RSA_SUPPORT
+/******************************************************************************/
+/**
+*
+* This function copies a signed partition from the boot device in chunks
+* and adds each chunk to the partition hash right after it is copied.
+* Data cache is enabled only around the hash update, the copy itself runs
+* with the same cache state as MoveImage otherwise does.
+*
+* @param	SourceAddr is the partition offset on the boot device
+* @param	DestAddr is the destination address in DDR
+* @param	Length is the partition length in bytes
+*
+* @return
+*		- XST_SUCCESS if the copy is successful
+*		- XST_FAILURE if the copy failed
+*
+* @note		None
+*
+*******************************************************************************/
+static u32 MoveImageAndHash(u32 SourceAddr, u32 DestAddr, u32 Length)
+{
+	u32 Status;
+	u32 ChunkSize;
+
+	PartitionHashStart(Length);
+
+	while (Length > 0) {
+		ChunkSize = (Length > FSBL_HASH_CHUNK_SIZE) ?
+				FSBL_HASH_CHUNK_SIZE : Length;
+
+		Status = MoveImage(SourceAddr, DestAddr, ChunkSize);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Xil_DCacheEnable();
+		PartitionHashUpdate((u8 *)DestAddr, ChunkSize);
+		Xil_DCacheFlush();
+		Xil_DCacheDisable();
+
+#ifdef XPAR_XWDTPS_0_BASEADDR
+		/*
+		 * Prevent WDT reset
+		 */
+		XWdtPs_RestartWdt(&Watchdog);
+#endif
+
+		SourceAddr += ChunkSize;
+		DestAddr += ChunkSize;
+		Length -= ChunkSize;
+	}
+
+	return XST_SUCCESS;
+}
+#endif
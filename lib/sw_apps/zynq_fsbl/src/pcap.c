@@ -85,6 +85,9 @@
 * 											In pcap.c, check pl power
 * 											through MCTRL register for
 * 											3.0 and later versions of silicon.
+*       ag  10/14/26    Split PcapDataTransfer into PcapDataTransferStart
+*                       and PcapWaitTransferDone so a DDR load can run
+*                       while the next partition is prepared
 * </pre>
 *
 * @note
@@ -126,6 +129,9 @@ extern int XDcfgPollDone(u32 MaskValue, u32 MaxCount);
 /* Devcfg driver instance */
 static XDcfg DcfgInstance;
 XDcfg *DcfgInstPtr;
+
+/* Set while a PCAP DMA started by PcapDataTransferStart is outstanding */
+static u32 PcapTransferPending = 0;
 extern u32 Silicon_Version;
 #ifdef XPAR_XWDTPS_0_BASEADDR
 extern XWdtPs Watchdog;	/* Instance of WatchDog Timer	*/
@@ -154,7 +160,61 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 				u32 SourceLength, u32 DestinationLength, u32 SecureTransfer)
 {
 	u32 Status;
-	u32 IntrStsReg;
+
+#ifdef FSBL_PERF
+	XTime tXferCur = 0;
+	FsblGetGlobalTime(&tXferCur);
+#endif
+
+	Status = PcapDataTransferStart(SourceDataPtr, DestinationDataPtr,
+					SourceLength, DestinationLength, SecureTransfer);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = PcapWaitTransferDone();
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * For Performance measurement
+	 */
+#ifdef FSBL_PERF
+	XTime tXferEnd = 0;
+	fsbl_printf(DEBUG_GENERAL,"Time taken is ");
+	FsblMeasurePerfTime(tXferCur,tXferEnd);
+#endif
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function starts a data transfer using PCAP and returns without
+* waiting for the DMA to complete
+*
+* @param 	SourceDataPtr is a pointer to where the data is read from
+* @param 	DestinationDataPtr is a pointer to where the data is written to
+* @param 	SourceLength is the length of the data to be moved in words
+* @param 	DestinationLength is the length of the data to be moved in words
+* @param 	SecureTransfer indicated the encryption key location, 0 for
+* 			non-encrypted
+*
+* @return
+*		- XST_SUCCESS if the transfer was started
+*		- XST_FAILURE if the transfer could not be started
+*
+* @note		PcapWaitTransferDone must be called before the destination
+*			data is used. Any PCAP function called in between waits for
+*			the outstanding transfer first.
+*
+****************************************************************************/
+u32 PcapDataTransferStart(u32 *SourceDataPtr, u32 *DestinationDataPtr,
+				u32 SourceLength, u32 DestinationLength, u32 SecureTransfer)
+{
+	u32 Status;
 	u32 PcapTransferType = XDCFG_CONCURRENT_NONSEC_READ_WRITE;
 
 	/*
@@ -164,10 +224,13 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 		PcapTransferType = XDCFG_CONCURRENT_SECURE_READ_WRITE;
 	}
 
-#ifdef FSBL_PERF
-	XTime tXferCur = 0;
-	FsblGetGlobalTime(&tXferCur);
-#endif
+	/*
+	 * Complete any transfer still in flight
+	 */
+	Status = PcapWaitTransferDone();
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
 
 	/*
 	 * Clear the PCAP status registers
@@ -208,6 +271,36 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	 */
 	PcapDumpRegisters();
 
+	PcapTransferPending = 1;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for a transfer started by PcapDataTransferStart
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if no transfer is outstanding or it completed
+*		- XST_FAILURE if the transfer failed
+*
+* @note		 None
+*
+****************************************************************************/
+u32 PcapWaitTransferDone(void)
+{
+	u32 Status;
+	u32 IntrStsReg;
+
+	if (!PcapTransferPending) {
+		return XST_SUCCESS;
+	}
+
+	PcapTransferPending = 0;
+
 	/*
 	 * Poll for the DMA done
 	 */
@@ -218,7 +311,7 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	}
 
 	fsbl_printf(DEBUG_INFO,"DMA Done ! \n\r");
-		
+
 	/*
 	 * Check for errors
 	 */
@@ -228,15 +321,6 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 		return XST_FAILURE;
 	}
 
-	/*
-	 * For Performance measurement
-	 */
-#ifdef FSBL_PERF
-	XTime tXferEnd = 0;
-	fsbl_printf(DEBUG_GENERAL,"Time taken is ");
-	FsblMeasurePerfTime(tXferCur,tXferEnd);
-#endif
-
 	return XST_SUCCESS;
 }
 
@@ -279,6 +363,14 @@ u32 PcapLoadPartition(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	FsblGetGlobalTime(&tXferCur);
 #endif
 
+	/*
+	 * Complete any transfer still in flight
+	 */
+	Status = PcapWaitTransferDone();
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
 	/*
 	 * Clear the PCAP status registers
 	 */
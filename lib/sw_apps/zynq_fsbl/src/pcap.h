@@ -48,6 +48,7 @@
 * 						Fabric Initialization sequence is modified to check
 * 						the PL power before sequence starts and checking INIT_B
 * 						reset status twice in case of failure.
+*       ag  10/14/26 Added PcapDataTransferStart and PcapWaitTransferDone
 * </pre>
 *
 * @note
@@ -98,6 +99,9 @@ u32 PcapLoadPartition(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
 		 	u32 DestinationLength, u32 Flags);
 u32 PcapDataTransfer(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
  			u32 DestinationLength, u32 Flags);
+u32 PcapDataTransferStart(u32 *SourceData, u32 *DestinationData,
+			u32 SourceLength, u32 DestinationLength, u32 Flags);
+u32 PcapWaitTransferDone(void);
 /************************** Variable Definitions *****************************/
 #ifdef __cplusplus
 }
@@ -54,6 +54,9 @@
 *					 					 fallback unless FSBL* and FSBL are
 *					 					 identical in length
 *					 Fix for CR#791245 - Use of xilrsa in FSBL
+*       ag  10/14/26 Partition hash can be computed while the partition is
+*                    copied, AuthenticatePartition reuses it instead of
+*                    hashing the partition a second time
 * </pre>
 *
 * @note
@@ -91,6 +94,14 @@ static u8 *PpkModularEx;
 static u32	PpkExp;
 static u32 PpkAlreadySet=0;
 
+/*
+ * Partition hash computed while the partition is copied
+ */
+static sha2_context PartitionHashCtx;
+static u32 PartitionHashLength;
+static u32 PartitionHashRemaining;
+static u8 PartitionHashActive=0;
+
 extern u32 FsblLength;
 
 void FsblPrintArray (u8 *Buf, u32 Len, char *Str)
@@ -181,6 +192,70 @@ void SetPpk(void )
 }
 
 
+/*****************************************************************************/
+/**
+*
+* This function starts the partition hash calculation which is then fed
+* with PartitionHashUpdate as partition data is copied. The hash covers
+* the partition up to, but not including, the partition signature.
+*
+* @param	Size is the total partition size in bytes including the
+*		authentication certificate
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+void PartitionHashStart(u32 Size)
+{
+	PartitionHashActive = 0;
+
+	if (Size < RSA_SIGNATURE_SIZE) {
+		return;
+	}
+
+	PartitionHashLength = Size - RSA_PARTITION_SIGNATURE_SIZE;
+	PartitionHashRemaining = PartitionHashLength;
+	sha2_starts(&PartitionHashCtx);
+	PartitionHashActive = 1;
+
+	return;
+}
+
+
+/*****************************************************************************/
+/**
+*
+* This function adds the next copied chunk of the partition to the
+* partition hash. Chunks must be passed in order; data past the hashed
+* length (the partition signature) is ignored.
+*
+* @param	Buffer is the pointer to the copied chunk
+* @param	Length is the chunk length in bytes
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+void PartitionHashUpdate(u8 *Buffer, u32 Length)
+{
+	if ((PartitionHashActive == 0) || (PartitionHashRemaining == 0)) {
+		return;
+	}
+
+	if (Length > PartitionHashRemaining) {
+		Length = PartitionHashRemaining;
+	}
+
+	sha2_update(&PartitionHashCtx, Buffer, Length);
+	PartitionHashRemaining -= Length;
+
+	return;
+}
+
+
 /*****************************************************************************/
 /**
 *
@@ -285,11 +360,18 @@ u32 AuthenticatePartition(u8 *Buffer, u32 Size)
 
 	/*
 	 * Partition Authentication
-	 * Calculate Hash Signature
+	 * Use the hash calculated during the copy if it covers this
+	 * partition, otherwise calculate Hash Signature
 	 */
-	sha_256((u8 *)Buffer,
-			(Size - RSA_PARTITION_SIGNATURE_SIZE),
-			HashSignature);
+	if ((PartitionHashActive == 1) && (PartitionHashRemaining == 0) &&
+			(PartitionHashLength == (Size - RSA_PARTITION_SIGNATURE_SIZE))) {
+		sha2_finish(&PartitionHashCtx, HashSignature);
+	} else {
+		sha_256((u8 *)Buffer,
+				(Size - RSA_PARTITION_SIGNATURE_SIZE),
+				HashSignature);
+	}
+	PartitionHashActive = 0;
 	FsblPrintArray(HashSignature, 32,
 						"Partition Hash Calculated");
 
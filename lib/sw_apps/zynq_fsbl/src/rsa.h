@@ -42,6 +42,8 @@
 * Ver	Who	Date		Changes
 * ----- ---- -------- -------------------------------------------------------
 * 4.00a sg	02/28/13 Initial release
+*       ag  10/14/26 Added PartitionHashStart/PartitionHashUpdate to hash
+*                    the partition while it is being copied
 *
 * </pre>
 *
@@ -71,6 +73,8 @@ extern "C" {
 
 void SetPpk(void );
 u32 AuthenticatePartition(u8 *Buffer, u32 Size);
+void PartitionHashStart(u32 Size);
+void PartitionHashUpdate(u8 *Buffer, u32 Length);
 u32 RecreatePaddingAndCheck(u8 *signature, u8 *hash);
 
 #ifdef __cplusplus
@@ -56,6 +56,9 @@
 *                     takes care of PPK revocation checks as well and
 *                     Modified XFsbl_ReadPpkHashSpkID to XFsbl_ReadPpkHash
 *                     as SPK ID reading and verification moved to XFsbl_SpkVer.
+*       ag   10/14/26 Added XFsbl_CopyAndHash() to calculate the partition
+*                     hash while the partition is copied, which is then used
+*                     by XFsbl_PartitionSignVer().
 *
 * </pre>
 *
@@ -77,6 +80,11 @@ void XFsbl_ReadPpkHash(u32 *PpkHash, u8 PpkSelect);
 
 static XSecure_Rsa SecureRsa;
 
+/* Partition hash calculated by XFsbl_CopyAndHash() */
+static u8 CopyHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4))) = {0};
+static u32 CopyHashPartition = 0U;
+static u32 IsCopyHashValid = FALSE;
+
 #if defined(XFSBL_BS)
 extern u8 ReadBuffer[READ_BUFFER_SIZE];
 #endif
@@ -267,55 +275,65 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 		HashLen = XFSBL_HASH_TYPE_SHA3;
 	}
 
-	/**
-	 * total partition length to be hashed except the AC
-	 */
-	HashDataLen = PartitionLen - XFSBL_AUTH_CERT_MIN_SIZE;
+	if ((IsCopyHashValid == TRUE) && (CopyHashPartition == PartitionNum) &&
+			(HashLen == XFSBL_HASH_TYPE_SHA3)) {
+		/* Partition hash was already calculated while copying */
+		XFsbl_Printf(DEBUG_INFO, "XFsbl_PartitionVer: Using hash "
+					"calculated during copy\r\n");
+		(void)XFsbl_MemCpy(PartitionHash, CopyHash, HashLen);
+		IsCopyHashValid = FALSE;
+	}
+	else {
+		/**
+		 * total partition length to be hashed except the AC
+		 */
+		HashDataLen = PartitionLen - XFSBL_AUTH_CERT_MIN_SIZE;
 
-	/* Start the SHA engine */
-	(void)XFsbl_ShaStart(ShaCtx, HashLen);
+		/* Start the SHA engine */
+		(void)XFsbl_ShaStart(ShaCtx, HashLen);
 
-	/* Calculate Partition Hash */
+		/* Calculate Partition Hash */
 #ifndef XFSBL_PS_DDR
-	XFsblPs_PartitionHeader * PartitionHeader;
-	u32 DestinationDevice = 0U;
-	PartitionHeader =
-		&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
-	DestinationDevice = XFsbl_GetDestinationDevice(PartitionHeader);
+		XFsblPs_PartitionHeader * PartitionHeader;
+		u32 DestinationDevice = 0U;
+		PartitionHeader =
+			&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+		DestinationDevice = XFsbl_GetDestinationDevice(PartitionHeader);
 
-	if (DestinationDevice == XIH_PH_ATTRB_DEST_DEVICE_PL)
-	{
-#ifdef XFSBL_BS
-		if(XFSBL_SUCCESS != XFsbl_ShaUpdate_DdrLess(FsblInstancePtr,
-		 ShaCtx, PartitionOffset, HashDataLen, HashLen, PartitionHash))
+		if (DestinationDevice == XIH_PH_ATTRB_DEST_DEVICE_PL)
 		{
-			XFsbl_Printf(DEBUG_GENERAL,
-			"XFsbl_PartitionVer: XFSBL_ERROR_PART_RSA_DECRYPT\r\n");
-			Status = XFSBL_ERROR_PART_RSA_DECRYPT;
-			goto END;
-		}
+#ifdef XFSBL_BS
+			if(XFSBL_SUCCESS != XFsbl_ShaUpdate_DdrLess(FsblInstancePtr,
+			 ShaCtx, PartitionOffset, HashDataLen, HashLen, PartitionHash))
+			{
+				XFsbl_Printf(DEBUG_GENERAL,
+				"XFsbl_PartitionVer: XFSBL_ERROR_PART_RSA_DECRYPT\r\n");
+				Status = XFSBL_ERROR_PART_RSA_DECRYPT;
+				goto END;
+			}
 
 #endif
-	}
-	else
-	{
-		XFsbl_Printf(DEBUG_INFO, "XFsbl_PartitionVer: SHA calc. "
-					"for non bs DDR less partition \r\n");
-		/* SHA calculation for non-bitstream, DDR less partitions */
-		XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)PartitionOffset,
-							HashDataLen, HashLen);
-	}
+		}
+		else
+		{
+			XFsbl_Printf(DEBUG_INFO, "XFsbl_PartitionVer: SHA calc. "
+						"for non bs DDR less partition \r\n");
+			/* SHA calculation for non-bitstream, DDR less partitions */
+			XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)PartitionOffset,
+								HashDataLen, HashLen);
+		}
 #else
-	/* SHA calculation in DDRful systems */
-	XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)PartitionOffset, HashDataLen, HashLen);
+		/* SHA calculation in DDRful systems */
+		XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)PartitionOffset, HashDataLen, HashLen);
 
 #endif
 
-	/* Calculate hash for (AC - signature size) */
-	XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)AcOffset,
-			(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE), HashLen);
+		/* Calculate hash for (AC - signature size) */
+		XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)AcOffset,
+				(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE), HashLen);
 
-	XFsbl_ShaFinish(ShaCtx, (u8 *)PartitionHash, HashLen);
+		XFsbl_ShaFinish(ShaCtx, (u8 *)PartitionHash, HashLen);
+	}
 
 	/* Set SPK pointer */
 	AcPtr += (XFSBL_RSA_AC_ALIGN + XFSBL_PPK_SIZE);
@@ -376,6 +394,86 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function copies a signed partition from the boot device to its load
+ * address and calculates the SHA3 partition hash during the copy. The
+ * partition is read in XFSBL_HASH_CHUNK_SIZE chunks, each chunk is hashed
+ * from the load address through CSU DMA while the next chunk is read from
+ * the boot device. The hash is completed with the authentication
+ * certificate (without the partition signature) and kept for
+ * XFsbl_PartitionSignVer(), so the partition is not read back for hashing.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	SrcAddress is the boot device offset of the partition
+ * @param	LoadAddress is the address the partition is copied to
+ * @param	Length is the partition length without the authentication
+ *		certificate
+ * @param	AcPtr is pointer to the authentication certificate
+ * @param	PartitionNum is the partition number in the image
+ *
+ * @return	XFSBL_SUCCESS on success, boot device copy errors on failure
+ *
+ * @note	The boot device copy must not use the CSU DMA source channel.
+ *
+ ******************************************************************************/
+u32 XFsbl_CopyAndHash(const XFsblPs * FsblInstancePtr, u32 SrcAddress,
+		PTRSIZE LoadAddress, u32 Length, const u8 *AcPtr,
+		u32 PartitionNum)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 Offset = 0U;
+	u32 ChunkLen;
+	u32 IsHashBusy = FALSE;
+
+	IsCopyHashValid = FALSE;
+
+	/* Partitions are hashed with NIST SHA3 padding */
+	(void)XFsbl_ShaStart(NULL, XFSBL_HASH_TYPE_SHA3);
+
+	while (Offset < Length) {
+		ChunkLen = Length - Offset;
+		if (ChunkLen > XFSBL_HASH_CHUNK_SIZE) {
+			ChunkLen = XFSBL_HASH_CHUNK_SIZE;
+		}
+
+		/* Read this chunk while the previous one is being hashed */
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+				SrcAddress + Offset, LoadAddress + Offset,
+				ChunkLen);
+		if (XFSBL_SUCCESS != Status) {
+			break;
+		}
+
+		if (IsHashBusy == TRUE) {
+			XFsbl_Sha3UpdateWait();
+		}
+		XFsbl_Sha3UpdateStart((u8 *)(LoadAddress + Offset), ChunkLen);
+		IsHashBusy = TRUE;
+
+		Offset += ChunkLen;
+	}
+
+	if (IsHashBusy == TRUE) {
+		XFsbl_Sha3UpdateWait();
+	}
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
+	/* Calculate hash for (AC - signature size) */
+	XFsbl_ShaUpdate(NULL, (u8 *)AcPtr,
+			(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE),
+			XFSBL_HASH_TYPE_SHA3);
+	XFsbl_ShaFinish(NULL, CopyHash, XFSBL_HASH_TYPE_SHA3);
+
+	CopyHashPartition = PartitionNum;
+	IsCopyHashValid = TRUE;
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  *
@@ -50,6 +50,8 @@
 * 3.0   vns  01/23/18 Added prototype for XFsbl_Sha3PadSelect()
 *       vns  03/07/18 Added PPK/SPK offsets w.r.t to AC, modified
 *                     prototype of XFsbl_CompareHashs()
+*       ag   10/14/26 Added XFsbl_CopyAndHash() and SHA3 non blocking
+*                     update prototypes
 *
 * </pre>
 *
@@ -109,6 +111,11 @@ extern "C" {
 #define XFSBL_AUTH_CERT_PPK_OFFSET 		0x40U
 #define XFSBL_AUTH_CERT_SPK_OFFSET		0x480U
 #define XFSBL_AUTH_CERT_SPK_SIG_OFFSET  	0x8C0U
+
+/**
+* Size of the chunks read from the boot device by XFsbl_CopyAndHash()
+*/
+#define XFSBL_HASH_CHUNK_SIZE			(0x10000U)
 /**
 * CSU RSA Register Map
 */
@@ -122,6 +129,11 @@ void XFsbl_ShaDigest(const u8 *In, const u32 Size, u8 *Out, u32 HashLen);
 void XFsbl_ShaStart(void * Ctx, u32 HashLen);
 void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen);
 void XFsbl_ShaFinish(void * Ctx, u8 * Hash, u32 HashLen);
+void XFsbl_Sha3UpdateStart(const u8 * Data, u32 Size);
+void XFsbl_Sha3UpdateWait(void);
+u32 XFsbl_CopyAndHash(const XFsblPs * FsblInstancePtr, u32 SrcAddress,
+		PTRSIZE LoadAddress, u32 Length, const u8 *AcPtr,
+		u32 PartitionNum);
 u32 XFsbl_CompareHashs(u8 *Hash1, u8 *Hash2, u32 HashLen);
 u32 XFsbl_Sha3PadSelect(u8 PadType);
 u32 XFsbl_BhAuthentication(const XFsblPs * FsblInstancePtr, u8 *Data,
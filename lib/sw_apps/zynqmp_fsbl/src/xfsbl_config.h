@@ -48,6 +48,15 @@
 *                     Added FSBL_PL_CLEAR_EXCLUDE_VAL, FSBL_USB_EXCLUDE_VAL,
 *                     FSBL_PROT_BYPASS_EXCLUDE_VAL configurations
 * 3.0   vns  03/07/18 Added FSBL_FORCE_ENC_EXCLUDE_VAL configuration
+*       ag   10/14/26 Added FSBL_ZDMA_LOAD_EXCLUDE_VAL configuration and
+*                     XFSBL_ZDMA_STAGING_ADDRESS
+*       ag   10/14/26 Added FSBL_PROFILE_EXCLUDE_VAL configuration and
+*                     XFSBL_PROFILE_LOG_ADDRESS
+*       ag   10/14/26 Added FSBL_RESTART_CACHE_EXCLUDE_VAL configuration and
+*                     the restart cache region
+*       ag   10/14/26 Added FSBL_BS_CHECKSUM_EXCLUDE_VAL configuration
+*       ag   10/14/26 Added FSBL_USB_STREAM_EXCLUDE_VAL configuration
+*       ag   10/14/26 Added FSBL_LZ4_EXCLUDE_VAL configuration
 *</pre>
 *
 * @note
@@ -69,6 +78,27 @@ extern "C" {
 /* This is the address in DDR where boot.bin will be copied in USB boot mode */
 #define XFSBL_DDR_TEMP_BUFFER_ADDRESS			(0x4000000U)
 
+/**
+ * This is the address in DDR where TCM/OCM partitions are copied temporarily
+ * when ZDMA loading is enabled. It should not overlap with any partition.
+ */
+#define XFSBL_ZDMA_STAGING_ADDRESS			(0x8000000U)
+
+/**
+ * This is the address the boot profile log is copied to at handoff when
+ * profiling is enabled, 0 keeps the log only in FSBL memory. This region
+ * should be reserved for the applications reading it.
+ */
+#define XFSBL_PROFILE_LOG_ADDRESS			(0x0U)
+
+/**
+ * This is the DDR region where copies of the APU partitions are kept for
+ * APU only restart when the restart cache is enabled. It should be
+ * reserved and not be used by any application.
+ */
+#define XFSBL_RESTART_CACHE_ADDRESS			(0x70000000U)
+#define XFSBL_RESTART_CACHE_SIZE			(0x8000000U)
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -135,6 +165,23 @@ extern "C" {
  *     	 contains bitstream
  *     - FSBL_FORCE_ENC_EXCLUDE_VAL Forcing encryption for every partition
  *       when ENC only bit is blown will be excluded.
+ *     - FSBL_ZDMA_LOAD_EXCLUDE_VAL Moving TCM/OCM partitions from a DDR
+ *       staging buffer with ADMA, while the next partition is read from
+ *       the boot device, will be excluded.
+ *     - FSBL_PROFILE_EXCLUDE_VAL Boot time profile log will be excluded
+ *     - FSBL_RESTART_CACHE_EXCLUDE_VAL Loading APU partitions from the
+ *       digest verified copies in DDR on APU only restart will be excluded
+ *     - FSBL_BS_CHECKSUM_EXCLUDE_VAL Checking the CSU DMA checksum of non
+ *       secure bitstreams against the boot header will be excluded
+ *     - FSBL_USB_STREAM_EXCLUDE_VAL Loading partitions while the DFU
+ *       download is in progress, with the blocks of a partition received
+ *       directly at its load address, will be excluded. Boot images which
+ *       read partition data back from the boot device more than once
+ *       can not be streamed and should leave this excluded.
+ *     - FSBL_LZ4_EXCLUDE_VAL Decompressing LZ4 frame partitions while they
+ *       are read from the boot device will be excluded. Only partitions
+ *       without authentication, encryption and checksum, not for the PL,
+ *       are checked for an LZ4 frame header. Frames need the content size.
  */
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
 #define FSBL_QSPI_EXCLUDE_VAL			(0U)
@@ -151,6 +198,12 @@ extern "C" {
 #define FSBL_PROT_BYPASS_EXCLUDE_VAL	(1U)
 #define FSBL_PARTITION_LOAD_EXCLUDE_VAL (0U)
 #define FSBL_FORCE_ENC_EXCLUDE_VAL		(0U)
+#define FSBL_ZDMA_LOAD_EXCLUDE_VAL		(1U)
+#define FSBL_PROFILE_EXCLUDE_VAL		(1U)
+#define FSBL_RESTART_CACHE_EXCLUDE_VAL	(1U)
+#define FSBL_BS_CHECKSUM_EXCLUDE_VAL	(1U)
+#define FSBL_USB_STREAM_EXCLUDE_VAL		(1U)
+#define FSBL_LZ4_EXCLUDE_VAL			(1U)
 
 #if FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE
@@ -211,6 +264,30 @@ extern "C" {
 #if FSBL_FORCE_ENC_EXCLUDE_VAL
 #define FSBL_FORCE_ENC_EXCLUDE
 #endif
+
+#if FSBL_ZDMA_LOAD_EXCLUDE_VAL
+#define FSBL_ZDMA_LOAD_EXCLUDE
+#endif
+
+#if FSBL_PROFILE_EXCLUDE_VAL
+#define FSBL_PROFILE_EXCLUDE
+#endif
+
+#if FSBL_RESTART_CACHE_EXCLUDE_VAL
+#define FSBL_RESTART_CACHE_EXCLUDE
+#endif
+
+#if FSBL_BS_CHECKSUM_EXCLUDE_VAL
+#define FSBL_BS_CHECKSUM_EXCLUDE
+#endif
+
+#if FSBL_USB_STREAM_EXCLUDE_VAL
+#define FSBL_USB_STREAM_EXCLUDE
+#endif
+
+#if FSBL_LZ4_EXCLUDE_VAL
+#define FSBL_LZ4_EXCLUDE
+#endif
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -43,6 +43,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.0   bvikram  02/01/17 First release
+*       ag       10/14/26 Received DFU blocks at load addresses when USB
+*                         streaming is enabled
 *
 * </pre>
 *
@@ -196,7 +198,7 @@ static XFsblPs_Usb30Config __attribute__ ((aligned(16))) Config3 = {
 		DFUFUNC_DESCR, /* bDescriptorType DFU functional descriptor type */
 		0x3U, /* bmAttributes Device is only download/upload capable */
 		8192U, /* wDetatchTimeOut 8192 ms */
-		DFU_MAX_TRANSFER, /*wTransferSize DFU block size 1024*/
+		DFU_MAX_TRANSFER, /*wTransferSize DFU block size 4096*/
 		0x0110U /*bcdDfuVersion 1.1 */
 	}
 };
@@ -257,7 +259,7 @@ static XFsblPs_UsbConfig __attribute__ ((aligned(16))) Config2 = {
 		DFUFUNC_DESCR, /* bDescriptorType DFU functional descriptor type */
 		0x3U, /* bmAttributes Device is only download capable bitCanDnload */
 		8192U, /*wDetatchTimeOut 8192 ms*/
-		DFU_MAX_TRANSFER, /*wTransferSize DFU block size 1024*/
+		DFU_MAX_TRANSFER, /*wTransferSize DFU block size 4096*/
 		0x0110U /*bcdDfuVersion 1.1 */
 	}
 };
@@ -708,6 +710,7 @@ void XFsbl_DfuClassReq(SetupPacket *SetupData)
 {
 	Xil_AssertVoid(SetupData != NULL);
 	u32 RxBytesLeft;
+	u8 *RxBuffer;
 	s32 Result;
 
 	static u8 DfuReply[DFU_STATUS_SIZE]={0,};
@@ -729,8 +732,19 @@ void XFsbl_DfuClassReq(SetupPacket *SetupData)
 			RxBytesLeft = (u32)(SetupData->wLength);
 
 			if(RxBytesLeft > 0U) {
+#ifdef XFSBL_USB_STREAM
+				RxBuffer = XFsbl_UsbRxBuffer(DfuObj.TotalBytesDnloaded,
+								RxBytesLeft);
+				if (RxBuffer == NULL) {
+					DfuObj.CurrState = STATE_DFU_ERROR;
+					XUsbPsu_EpSetStall(&UsbInstance, 0U, XUSBPSU_EP_DIR_IN);
+					break;
+				}
+#else
+				RxBuffer = &DfuVirtFlash[DfuObj.TotalBytesDnloaded];
+#endif
 				do {
-					Result = XUsbPsu_EpBufferRecv(&UsbInstance, 0U, &DfuVirtFlash[DfuObj.TotalBytesDnloaded],
+					Result = XUsbPsu_EpBufferRecv(&UsbInstance, 0U, RxBuffer,
 								RxBytesLeft);
 				}while(Result != XST_SUCCESS);
 
@@ -748,6 +762,9 @@ void XFsbl_DfuClassReq(SetupPacket *SetupData)
 
 		case DFU_GETSTATUS:
 		{
+			/* Data stage of the previous DNLOAD is complete by now */
+			DfuObj.TotalBytesRcvd = DfuObj.TotalBytesDnloaded;
+
 			if(DfuObj.CurrState == STATE_DFU_IDLE )
 			{
 				DfuObj.CurrState = STATE_DFU_DOWNLOAD_SYNC;
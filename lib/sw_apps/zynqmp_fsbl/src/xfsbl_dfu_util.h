@@ -43,6 +43,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.0   bvikram  02/01/17 First release
+*       ag       10/14/26 Raised DFU_MAX_TRANSFER to 4096 and added
+*                         TotalBytesRcvd for USB streaming
 *
 * </pre>
 *
@@ -212,12 +214,18 @@ struct XFsblPs_DfuIf {
 	u32 CurrentInf; /* current interface */
 	u8 GotDnloadRqst;
 	u32 TotalBytesDnloaded;
+	u32 TotalBytesRcvd; /* bytes whose data stage has completed */
 	u8 DfuWaitForInterrupt;
 	u8 RuntimeToDfu;
 };
 
 
-#define DFU_MAX_TRANSFER			1024U
+/*
+ * DFU block size reported in wTransferSize. Every block costs a DNLOAD and
+ * a GETSTATUS control transfer, 4096 is the largest control transfer the
+ * Linux usbfs based hosts (dfu-util) issue.
+ */
+#define DFU_MAX_TRANSFER			4096U
 /* DFU status */
 #define DFU_STATUS_OK               0x00U
 /* DFU commands */
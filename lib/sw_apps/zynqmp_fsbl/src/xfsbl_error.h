@@ -48,6 +48,10 @@
 * 3.0   vns  09/08/17 Added error code for PPK revoke failure
 * 4.0   vns  03/07/18 Added error codes for boot header authentication
 *                     failure and for encryption compulsory
+*       ag   10/14/26 Added error code for ZDMA partition move failure
+*       ag   10/14/26 Added error code for bitstream checksum mismatch
+*       ag   10/14/26 Added error code for USB stream read back
+*       ag   10/14/26 Added error code for malformed LZ4 partitions
 *
 * </pre>
 *
@@ -204,6 +208,10 @@ extern "C" {
 #define XFSBL_ERROR_BH_SIGNATURE				(0x69U)
 #define XFSBL_ERROR_BH_AUTH_IS_NOTALLOWED			(0x70U)
 #define XFSBL_ERROR_ENC_IS_MANDATORY				(0x71U)
+#define XFSBL_ERROR_ZDMA_LOAD					(0x72U)
+#define XFSBL_ERROR_BS_CHECKSUM					(0x73U)
+#define XFSBL_ERROR_USB_STREAM					(0x74U)
+#define XFSBL_ERROR_LZ4						(0x75U)
 #define XFSBL_FAILURE					(0x3FFFFFFFU)
 
 /**************************** Type Definitions *******************************/
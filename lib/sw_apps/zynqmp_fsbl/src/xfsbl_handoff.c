@@ -50,6 +50,8 @@
  *                     it is by passed.
  *       bv   03/17/17 Modified such that XFsbl_PmInit is done only duing
  *                     system reset
+ *       ag   10/14/26 Wait for the ADMA partition moves before handoff
+ *       ag   10/14/26 Dump the boot profile log before the final handoff
  * </pre>
  *
  * @note
@@ -743,6 +745,20 @@ u32 XFsbl_Handoff (const XFsblPs * FsblInstancePtr, u32 PartitionNum, u32 EarlyH
 	PartitionHeader =
 			&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
 
+#ifdef XFSBL_ZDMA_LOAD
+	/* Make sure the partitions moved by ADMA are in place */
+	Status = XFsbl_ZDmaLoadWait();
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+#endif
+
+#ifdef XFSBL_PROFILE
+	if (EarlyHandoff != TRUE) {
+		XFsbl_ProfileDump();
+	}
+#endif
+
 	if (FsblInstancePtr->ResetReason == XFSBL_PS_ONLY_RESET)
 		{
 		/**Remove PS-PL isolation to allow u-boot and linux to access PL*/
@@ -49,6 +49,13 @@
 * 4.0   vns  02/02/18 Added warning message to notify SHA2 support
 *                     deprecation in future releases.
 *       vns  03/07/18 Added ENC_ONLY mask
+*       ag   10/14/26 Added ADMA channel 1 registers and XFSBL_ZDMA_LOAD
+*       ag   10/14/26 Added IOU_SCNTRS registers and XFSBL_PROFILE
+*       ag   10/14/26 Added XFSBL_RESTART_CACHE
+*       ag   10/14/26 Added XFSBL_BS_CHECKSUM
+*       ag   10/14/26 Added XFSBL_USB_STREAM
+*       ag   10/14/26 Added ADMA channel register stride for ECC init
+*       ag   10/14/26 Added XFSBL_LZ4
 *
 * </pre>
 *
@@ -646,6 +653,63 @@ extern "C" {
 #define ADMA_CH0_ZDMA_CH_ISR    ( ( ADMA_CH0_BASEADDR ) + 0X00000100U )
 #define ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK    0X00000400U
 
+/* Register offset between the ADMA channels, all used for ECC init */
+#define ADMA_CH_OFFSET    0X00010000U
+#define ADMA_NUM_CHANNELS    8U
+#define ADMA_CH_REG(Ch, Ch0Reg)    ( ( Ch0Reg ) + ( ( u32 )( Ch ) * ( ADMA_CH_OFFSET ) ) )
+
+/* Register: IOU_SCNTRS Base Address */
+#define IOU_SCNTRS_BASEADDR      0XFF260000U
+
+/* Register: IOU_SCNTRS_CURRENT_COUNTER_LOWER_REGISTER */
+#define IOU_SCNTRS_CNT_LOWER    ( ( IOU_SCNTRS_BASEADDR ) + 0X00000008U )
+
+/* Register: IOU_SCNTRS_CURRENT_COUNTER_UPPER_REGISTER */
+#define IOU_SCNTRS_CNT_UPPER    ( ( IOU_SCNTRS_BASEADDR ) + 0X0000000CU )
+
+/* Register: IOU_SCNTRS_BASE_FREQUENCY_ID_REGISTER */
+#define IOU_SCNTRS_BASE_FREQ    ( ( IOU_SCNTRS_BASEADDR ) + 0X00000020U )
+
+/* Register: ADMA_CH1 Base Address */
+#define ADMA_CH1_BASEADDR      0XFFA90000U
+
+/* Register: ADMA_CH1_ZDMA_CH_ISR */
+#define ADMA_CH1_ZDMA_CH_ISR    ( ( ADMA_CH1_BASEADDR ) + 0X00000100U )
+
+/* Register: ADMA_CH1_ZDMA_CH_CTRL0 */
+#define ADMA_CH1_ZDMA_CH_CTRL0    ( ( ADMA_CH1_BASEADDR ) + 0X00000110U )
+#define ADMA_CH1_ZDMA_CH_CTRL0_MODE_NORMAL (u32)0X00000000U
+
+/* Register: ADMA_CH1_ZDMA_CH_STATUS */
+#define ADMA_CH1_ZDMA_CH_STATUS    ( ( ADMA_CH1_BASEADDR ) + 0X0000011CU )
+
+/* Register: ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD0 */
+#define ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD0    ( ( ADMA_CH1_BASEADDR ) + 0X00000128U )
+
+/* Register: ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD1 */
+#define ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD1    ( ( ADMA_CH1_BASEADDR ) + 0X0000012CU )
+
+/* Register: ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD2 */
+#define ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD2    ( ( ADMA_CH1_BASEADDR ) + 0X00000130U )
+
+/* Register: ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD3 */
+#define ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD3    ( ( ADMA_CH1_BASEADDR ) + 0X00000134U )
+
+/* Register: ADMA_CH1_ZDMA_CH_DST_DSCR_WORD0 */
+#define ADMA_CH1_ZDMA_CH_DST_DSCR_WORD0    ( ( ADMA_CH1_BASEADDR ) + 0X00000138U )
+
+/* Register: ADMA_CH1_ZDMA_CH_DST_DSCR_WORD1 */
+#define ADMA_CH1_ZDMA_CH_DST_DSCR_WORD1    ( ( ADMA_CH1_BASEADDR ) + 0X0000013CU )
+
+/* Register: ADMA_CH1_ZDMA_CH_DST_DSCR_WORD2 */
+#define ADMA_CH1_ZDMA_CH_DST_DSCR_WORD2    ( ( ADMA_CH1_BASEADDR ) + 0X00000140U )
+
+/* Register: ADMA_CH1_ZDMA_CH_DST_DSCR_WORD3 */
+#define ADMA_CH1_ZDMA_CH_DST_DSCR_WORD3    ( ( ADMA_CH1_BASEADDR ) + 0X00000144U )
+
+/* Register: ADMA_CH1_ZDMA_CH_CTRL2 */
+#define ADMA_CH1_ZDMA_CH_CTRL2    ( ( ADMA_CH1_BASEADDR ) + 0X00000200U )
+
 /* AMS_PS_SYSMON Base Address */
 #define AMS_PS_SYSMON_BASEADDR      0XFFA50800U
 #define XFSBL_PS_SYSMON_CONFIGREG1    0XFFA50904U
@@ -908,6 +972,49 @@ extern "C" {
 #define XFSBL_PROT_BYPASS
 #endif
 
+/**
+ * Definition for moving TCM/OCM partitions with ADMA to be included
+ */
+#if (!defined(FSBL_ZDMA_LOAD_EXCLUDE) && defined(XFSBL_PS_DDR))
+#define XFSBL_ZDMA_LOAD
+#endif
+
+/**
+ * Definition for boot time profile log to be included
+ */
+#if !defined(FSBL_PROFILE_EXCLUDE)
+#define XFSBL_PROFILE
+#endif
+
+/**
+ * Definition for APU only restart image cache to be included
+ */
+#if (!defined(FSBL_RESTART_CACHE_EXCLUDE) && defined(XFSBL_SECURE) && \
+		defined(XFSBL_PS_DDR) && !defined(ARMR5))
+#define XFSBL_RESTART_CACHE
+#endif
+
+/**
+ * Definition for bitstream CSU DMA checksum check to be included
+ */
+#if (!defined(FSBL_BS_CHECKSUM_EXCLUDE) && defined(XFSBL_BS))
+#define XFSBL_BS_CHECKSUM
+#endif
+
+/**
+ * Definition for loading partitions during the USB DFU download
+ */
+#if (!defined(FSBL_USB_STREAM_EXCLUDE) && defined(XFSBL_USB))
+#define XFSBL_USB_STREAM
+#endif
+
+/**
+ * Definition for LZ4 compressed partitions to be included
+ */
+#if !defined(FSBL_LZ4_EXCLUDE)
+#define XFSBL_LZ4
+#endif
+
 #ifdef ARMR5
 #define XFSBL_PS_DDR_INIT_START_ADDRESS	XFSBL_PS_DDR_START_ADDRESS_R5
 #else
@@ -57,6 +57,7 @@
 *                     IV from boot header should be added with thes 8 bits.
 *       vns  03/07/18 Added BHDR attribute mask for PUF and macros for
 *                     boot header size.
+*       ag   10/14/26 Added XIH_BH_BS_CHECKSUM_OFFSET
 *
 * </pre>
 *
@@ -95,6 +96,11 @@ extern "C" {
 #define XIH_BH_IMAGE_ATTRB_SHA2_MASK	(0x3000U)
 #define XIH_BH_IV_OFFSET       		(0xA0U)
 #define XIH_BH_IV_LENGTH   			(0x10U)
+/**
+ * First user defined word of the boot header, holds the 32 bit sum of the
+ * non secure bitstream words when the bitstream checksum check is enabled
+ */
+#define XIH_BH_BS_CHECKSUM_OFFSET	(0x70U)
 
 #define XIH_BH_MIN_SIZE	(0x000008B8U)
 #define XIH_BH_MAX_SIZE	(XIH_BH_MIN_SIZE + \
@@ -61,6 +61,8 @@
 * 4.0   vns  03/07/18 Added boot header authentication, attributes reading
 *                     from boot header local buffer, copying IV to global
 *                     variable for using during decryption of partition.
+*       ag   10/14/26 Read the bitstream checksum from boot header.
+*       ag   10/14/26 ECC initialization runs on all ADMA channels in parallel.
 * </pre>
 *
 * @note
@@ -100,6 +102,7 @@ static u32 XFsbl_SecondaryBootDeviceInit(XFsblPs * FsblInstancePtr);
 static u32 XFsbl_DdrEccInit(void);
 static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes);
 static u32 XFsbl_TcmInit(XFsblPs * FsblInstancePtr);
+static void XFsbl_PowerUpRequest(const XFsblPs * FsblInstancePtr);
 static void XFsbl_EnableProgToPL(void);
 static void XFsbl_ClearPendingInterrupts(void);
 
@@ -349,6 +352,12 @@ u32 XFsbl_BootDeviceInitAndValidate(XFsblPs * FsblInstancePtr)
 		goto END;
 	}
 
+	/**
+	 * Request power up of the islands needed by the partitions, they
+	 * ramp while the rest of the boot device init and loading goes on
+	 */
+	XFsbl_PowerUpRequest(FsblInstancePtr);
+
 	/**
 	 * Update the secondary boot device
 	 */
@@ -370,6 +379,117 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function issues power up requests, without waiting for completion,
+ * for all the islands required by the partitions in the image header.
+ * Completion is polled where the islands are used during partition
+ * loading and handoff.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XFsbl_PowerUpRequest(const XFsblPs * FsblInstancePtr)
+{
+	const XFsblPs_PartitionHeader * PartitionHeader;
+	u32 PwrIslandMask = 0U;
+	u32 DestinationCpu;
+	u32 PartitionNum;
+	u32 TcmLength;
+
+	/**
+	 * On APU only restart the RPU and PL are left as they are
+	 */
+	if (FsblInstancePtr->ResetReason == XFSBL_APU_ONLY_RESET) {
+		goto END;
+	}
+
+	for (PartitionNum = 0U; PartitionNum <
+		FsblInstancePtr->ImageHeader.ImageHeaderTable.NoOfPartitions;
+		PartitionNum++) {
+		PartitionHeader =
+		    &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+		DestinationCpu = XFsbl_GetDestinationCpu(PartitionHeader);
+
+		if (DestinationCpu == FsblInstancePtr->ProcessorID) {
+			/* Running CPU and its memories are already up */
+			continue;
+		}
+
+		TcmLength = (DestinationCpu == XIH_PH_ATTRB_DEST_CPU_R5_L) ?
+			(XFSBL_R5_TCM_BANK_LENGTH * 4U) :
+			(XFSBL_R5_TCM_BANK_LENGTH * 2U);
+
+		switch (DestinationCpu) {
+		case XIH_PH_ATTRB_DEST_CPU_A53_1:
+			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_ACPU1_MASK |
+				PMU_GLOBAL_PWR_STATE_FP_MASK |
+				PMU_GLOBAL_PWR_STATE_L2_BANK0_MASK;
+			break;
+		case XIH_PH_ATTRB_DEST_CPU_A53_2:
+			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_ACPU2_MASK |
+				PMU_GLOBAL_PWR_STATE_FP_MASK |
+				PMU_GLOBAL_PWR_STATE_L2_BANK0_MASK;
+			break;
+		case XIH_PH_ATTRB_DEST_CPU_A53_3:
+			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_ACPU3_MASK |
+				PMU_GLOBAL_PWR_STATE_FP_MASK |
+				PMU_GLOBAL_PWR_STATE_L2_BANK0_MASK;
+			break;
+		case XIH_PH_ATTRB_DEST_CPU_R5_0:
+			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_R5_0_MASK;
+			if (PartitionHeader->DestinationLoadAddress < TcmLength) {
+				PwrIslandMask |= PMU_GLOBAL_PWR_STATE_TCM0A_MASK |
+					PMU_GLOBAL_PWR_STATE_TCM0B_MASK;
+			}
+			break;
+		case XIH_PH_ATTRB_DEST_CPU_R5_1:
+			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_R5_1_MASK;
+			if (PartitionHeader->DestinationLoadAddress < TcmLength) {
+				PwrIslandMask |= PMU_GLOBAL_PWR_STATE_TCM1A_MASK |
+					PMU_GLOBAL_PWR_STATE_TCM1B_MASK;
+			}
+			break;
+		case XIH_PH_ATTRB_DEST_CPU_R5_L:
+			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_R5_0_MASK;
+			if (PartitionHeader->DestinationLoadAddress < TcmLength) {
+				PwrIslandMask |= PMU_GLOBAL_PWR_STATE_TCM0A_MASK |
+					PMU_GLOBAL_PWR_STATE_TCM0B_MASK |
+					PMU_GLOBAL_PWR_STATE_TCM1A_MASK |
+					PMU_GLOBAL_PWR_STATE_TCM1B_MASK;
+			}
+			break;
+		default:
+			/* nothing to do */
+			break;
+		}
+
+		/**
+		 * For 1.0 and 2.0 Silicon PL is powered before MIO config,
+		 * on PS only reset the bitstream is skipped
+		 */
+		if ((XFsbl_GetDestinationDevice(PartitionHeader) ==
+				XIH_PH_ATTRB_DEST_DEVICE_PL) &&
+		    (XGetPSVersion_Info() > (u32)XPS_VERSION_2) &&
+		    (FsblInstancePtr->ResetReason != XFSBL_PS_ONLY_RESET)) {
+			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_PL_MASK;
+		}
+	}
+
+	/* Islands which are already on need no request */
+	PwrIslandMask &= ~(XFsbl_In32(PMU_GLOBAL_PWR_STATE));
+	if (PwrIslandMask != 0U) {
+		XFsbl_Printf(DEBUG_INFO, "Power up request 0x%0lx\n\r",
+				PwrIslandMask);
+		(void)XFsbl_PowerUpIslandRequest(PwrIslandMask);
+	}
+
+END:
+	return;
+}
+
 /*****************************************************************************/
 /**
  * This function enables the propagation of the PROG signal to PL after
@@ -686,6 +806,11 @@ static u32 XFsbl_SystemInit(XFsblPs * FsblInstancePtr)
 	XTime_GetTime(&(FsblInstancePtr->PerfTime.tFsblStart));
 #endif
 
+#ifdef XFSBL_PROFILE
+	/* Timestamp counter is running from psu init */
+	XFsbl_ProfileInit();
+#endif
+
 #if defined (XPAR_PSU_DDR_0_S_AXI_BASEADDR) && !defined (ARMR5)
 	/* For A53, mark DDR region as "Memory" as DDR initialization is done */
 
@@ -1092,6 +1217,14 @@ static u32 XFsbl_ValidateHeader(XFsblPs * FsblInstancePtr)
 					XIH_BH_IMAGE_ATTRB_OFFSET);
 	FsblInstancePtr->BootHdrAttributes = BootHdrAttrb;
 
+#ifdef XFSBL_BS_CHECKSUM
+	/**
+	 * Read the non secure bitstream checksum, 0 if not provided
+	 */
+	FsblInstancePtr->BsChecksum = Xil_In32((UINTPTR)ReadBuffer +
+					XIH_BH_BS_CHECKSUM_OFFSET);
+#endif
+
 	/**
 	 * Read the Image Header Table offset from
 	 * Boot Header
@@ -1469,7 +1602,46 @@ END:
 
 /*****************************************************************************/
 /**
- * This function does ECC Initialization of memory
+ * This function starts a write only transfer of the ECC init value on one
+ * ADMA channel
+ *
+ * @param	Ch is the ADMA channel
+ * @param	DestAddr is start address of the transfer
+ * @param	Length is length of the transfer in bytes
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_EccInitStartDma(u32 Ch, u64 DestAddr, u32 Length)
+{
+	u32 RegVal;
+
+	/* Clear a stale DMA done status */
+	XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_ISR),
+			ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
+
+	/* Write Destination Address */
+	XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0),
+			(u32)(DestAddr & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
+	XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1),
+			(u32)((DestAddr >> 32U) &
+					ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
+
+	/* Size to be Transferred. Recommended to set both src and dest sizes */
+	XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2), Length);
+	XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2), Length);
+
+	/* DMA Enable */
+	RegVal = XFsbl_In32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL2));
+	RegVal |= ADMA_CH0_ZDMA_CH_CTRL2_EN_MASK;
+	XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL2), RegVal);
+}
+
+/*****************************************************************************/
+/**
+ * This function does ECC Initialization of memory. The range is split
+ * into up to ADMA_NUM_CHANNELS parts which are filled in parallel by the
+ * ADMA channels in write only mode.
  *
  * @param	DestAddr is start address from where to calculate ECC
  * @param	LengthBytes is length in bytes from start address to calculate ECC
@@ -1482,100 +1654,115 @@ END:
 static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes)
 {
 	u32 RegVal;
-	u32 Status;
+	u32 Status = XFSBL_SUCCESS;
 	u32 Length;
+	u32 Ch;
+	u32 BusyMask = 0U;
+	u64 ChunkLen;
 	u64 StartAddr = DestAddr;
 	u64 NumBytes = LengthBytes;
 
 	Xil_DCacheDisable();
 
-	while (NumBytes > 0U) {
-		if (NumBytes > ZDMA_TRANSFER_MAX_LEN) {
-			Length = ZDMA_TRANSFER_MAX_LEN;
-		} else {
-			Length = (u32)NumBytes;
-		}
+	/*
+	 * Each channel gets an equal share of the range, a multiple of 64 bytes
+	 * so that every transfer stays 64 bit aligned, and at most
+	 * ZDMA_TRANSFER_MAX_LEN. Channels that finish early take the next part.
+	 */
+	ChunkLen = (LengthBytes + (u64)ADMA_NUM_CHANNELS - 1U) /
+			(u64)ADMA_NUM_CHANNELS;
+	ChunkLen = (ChunkLen + 63U) & ~(u64)63U;
+	if (ChunkLen > ZDMA_TRANSFER_MAX_LEN) {
+		ChunkLen = ZDMA_TRANSFER_MAX_LEN;
+	}
 
+	for (Ch = 0U; Ch < ADMA_NUM_CHANNELS; Ch++) {
 		/* Wait until the DMA is in idle state */
 		do {
-			RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_STATUS);
+			RegVal = XFsbl_In32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_STATUS));
 			RegVal &= ADMA_CH0_ZDMA_CH_STATUS_STATE_MASK;
 		} while ((RegVal != ADMA_CH0_ZDMA_CH_STATUS_STATE_DONE) &&
 				(RegVal != ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR));
 
 		/* Enable Simple (Write Only) Mode */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_CTRL0);
+		RegVal = XFsbl_In32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL0));
 		RegVal &= (ADMA_CH0_ZDMA_CH_CTRL0_POINT_TYPE_MASK |
 				ADMA_CH0_ZDMA_CH_CTRL0_MODE_MASK);
 		RegVal |= (ADMA_CH0_ZDMA_CH_CTRL0_POINT_TYPE_NORMAL |
 				ADMA_CH0_ZDMA_CH_CTRL0_MODE_WR_ONLY);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0, RegVal);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL0), RegVal);
 
 		/* Fill in the data to be written */
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0, XFSBL_ECC_INIT_VAL_WORD);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1, XFSBL_ECC_INIT_VAL_WORD);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2, XFSBL_ECC_INIT_VAL_WORD);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3, XFSBL_ECC_INIT_VAL_WORD);
-
-		/* Write Destination Address */
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0,
-				(u32)(StartAddr & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1,
-				(u32)((StartAddr >> 32U) &
-						ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
-
-		/* Size to be Transferred. Recommended to set both src and dest sizes */
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2, Length);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2, Length);
-
-		/* DMA Enable */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_CTRL2);
-		RegVal |= ADMA_CH0_ZDMA_CH_CTRL2_EN_MASK;
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL2, RegVal);
-
-		/* Check the status of the transfer by polling on DMA Done */
-		do {
-			RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_ISR);
-			RegVal &= ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK;
-		} while (RegVal != ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
-
-		/* Clear DMA status */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_ISR);
-		RegVal |= ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK;
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_ISR, ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
-
-		/* Read the channel status for errors */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_STATUS);
-		if (RegVal == ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR) {
-			Status = XFSBL_FAILURE;
-			Xil_DCacheEnable();
-			goto END;
-		}
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0),
+				XFSBL_ECC_INIT_VAL_WORD);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1),
+				XFSBL_ECC_INIT_VAL_WORD);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2),
+				XFSBL_ECC_INIT_VAL_WORD);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3),
+				XFSBL_ECC_INIT_VAL_WORD);
+	}
 
-		NumBytes -= Length;
-		StartAddr += Length;
+	while ((NumBytes > 0U) || (BusyMask != 0U)) {
+		for (Ch = 0U; Ch < ADMA_NUM_CHANNELS; Ch++) {
+			if ((BusyMask & ((u32)1U << Ch)) != 0U) {
+				/* Check the status of the transfer on DMA Done */
+				RegVal = XFsbl_In32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_ISR));
+				if ((RegVal & ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK) == 0U) {
+					continue;
+				}
+
+				/* Clear DMA status */
+				XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_ISR),
+						ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
+				BusyMask &= ~((u32)1U << Ch);
+
+				/* Read the channel status for errors */
+				RegVal = XFsbl_In32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_STATUS));
+				if (RegVal == ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR) {
+					/* Let the other channels finish, start no more */
+					Status = XFSBL_FAILURE;
+					NumBytes = 0U;
+				}
+			}
+
+			if (NumBytes > 0U) {
+				if (NumBytes > ChunkLen) {
+					Length = (u32)ChunkLen;
+				} else {
+					Length = (u32)NumBytes;
+				}
+				XFsbl_EccInitStartDma(Ch, StartAddr, Length);
+				BusyMask |= ((u32)1U << Ch);
+				NumBytes -= Length;
+				StartAddr += Length;
+			}
+		}
 	}
 
 	Xil_DCacheEnable();
 
 	/* Restore reset values for the DMA registers used */
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0, 0x00000080U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0_TOTAL_BYTE_COUNT,0x00000000U);
-
-	XFsbl_Printf(DEBUG_INFO,
+	for (Ch = 0U; Ch < ADMA_NUM_CHANNELS; Ch++) {
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL0), 0x00000080U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2), 0x00000000U);
+		XFsbl_Out32(ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL0_TOTAL_BYTE_COUNT),
+				0x00000000U);
+	}
+
+	if (Status == XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_INFO,
 			"Address 0x%0lx, Length %0lx, ECC initialized \r\n",
 			DestAddr, LengthBytes);
+	}
 
-	Status = XFSBL_SUCCESS;
-END:
 	return Status;
 }
 
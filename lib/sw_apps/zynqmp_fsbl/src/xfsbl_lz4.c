@@ -0,0 +1,508 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_lz4.c
+ *
+ * Contains the loading of LZ4 compressed partitions. A partition which
+ * starts with an LZ4 frame header is read from the boot device in chunks
+ * of XFSBL_LZ4_READ_SIZE and decompressed to its load address, so only the
+ * compressed length is read from the boot device. The decoder keeps its
+ * state across chunks, blocks and sequences may span chunk boundaries.
+ *
+ * Block and content checksums of the frame are skipped, the decoder checks
+ * that literals and matches stay within the load region.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.00  ag   10/14/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_cache.h"
+#include "xfsbl_main.h"
+#include "xfsbl_lz4.h"
+
+#ifdef XFSBL_LZ4
+/************************** Constant Definitions *****************************/
+#define XFSBL_LZ4_FLG_VERSION_MASK	(0xC0U)
+#define XFSBL_LZ4_FLG_VERSION		(0x40U)
+#define XFSBL_LZ4_FLG_BLK_CHECKSUM	(0x10U)
+#define XFSBL_LZ4_FLG_CONTENT_SIZE	(0x08U)
+#define XFSBL_LZ4_FLG_CONTENT_CHECKSUM	(0x04U)
+#define XFSBL_LZ4_FLG_RESERVED		(0x02U)
+#define XFSBL_LZ4_FLG_DICT_ID		(0x01U)
+#define XFSBL_LZ4_BD_BLK_MAX_MASK	(0x70U)
+#define XFSBL_LZ4_BD_BLK_MAX_SHIFT	(4U)
+#define XFSBL_LZ4_BD_RESERVED		(0x8FU)
+
+#define XFSBL_LZ4_BLK_UNCOMPRESSED	(0x80000000U)
+#define XFSBL_LZ4_CHECKSUM_LEN		(4U)
+#define XFSBL_LZ4_MIN_MATCH		(4U)
+#define XFSBL_LZ4_LEN_EXTENDED		(15U)
+#define XFSBL_LZ4_LEN_CONTINUE		(255U)
+
+/**
+ * Decoder states
+ */
+#define XFSBL_LZ4_ST_BLK_SIZE		(0U) /**< Block size */
+#define XFSBL_LZ4_ST_TOKEN		(1U) /**< Sequence token */
+#define XFSBL_LZ4_ST_LIT_LEN		(2U) /**< Literal length bytes */
+#define XFSBL_LZ4_ST_LITERALS		(3U) /**< Literals */
+#define XFSBL_LZ4_ST_OFFSET		(4U) /**< Match offset */
+#define XFSBL_LZ4_ST_MATCH_LEN		(5U) /**< Match length bytes */
+#define XFSBL_LZ4_ST_RAW		(6U) /**< Uncompressed block data */
+#define XFSBL_LZ4_ST_SKIP		(7U) /**< Checksum */
+#define XFSBL_LZ4_ST_DONE		(8U) /**< End mark seen */
+
+/**************************** Type Definitions *******************************/
+/**
+ * Decoder state kept across the chunks read from the boot device
+ */
+typedef struct {
+	u32 Flags; /**< FLG byte of the frame */
+	u32 BlockMax; /**< Maximum block size of the frame */
+	u8 *Dest; /**< Load address */
+	u32 DestLength; /**< Decompressed length */
+	u32 DestPos; /**< Bytes written to the load address */
+	u32 State; /**< One of XFSBL_LZ4_ST_* */
+	u32 NextState; /**< State after XFSBL_LZ4_ST_SKIP */
+	u32 BlockLeft; /**< Bytes left in the compressed block */
+	u32 Count; /**< Bytes left or collected in the current state */
+	u32 Value; /**< Block size or match offset being collected */
+	u32 Token; /**< Token of the current sequence */
+	u32 MatchLen; /**< Length of the current match */
+} XFsblPs_Lz4Stream;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XFSBL_LZ4_MIN(A, B)		(((A) < (B)) ? (A) : (B))
+
+/************************** Function Prototypes ******************************/
+static void XFsbl_Lz4BlockEnd(XFsblPs_Lz4Stream * Lz4);
+static void XFsbl_Lz4LiteralsEnd(XFsblPs_Lz4Stream * Lz4);
+static u32 XFsbl_Lz4Match(XFsblPs_Lz4Stream * Lz4);
+static u32 XFsbl_Lz4Decode(XFsblPs_Lz4Stream * Lz4, const u8 * Buf, u32 Len);
+
+/************************** Variable Definitions *****************************/
+static u8 Lz4Buffer[XFSBL_LZ4_READ_SIZE] __attribute__ ((aligned (64)));
+static XFsblPs_Lz4Stream Lz4Stream;
+
+/*****************************************************************************/
+/**
+ * This function moves the decoder to the next block, skipping the block
+ * checksum if the frame has one
+ *
+ * @param	Lz4 is pointer to the decoder state
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_Lz4BlockEnd(XFsblPs_Lz4Stream * Lz4)
+{
+	Lz4->Count = 0U;
+	Lz4->Value = 0U;
+	if ((Lz4->Flags & XFSBL_LZ4_FLG_BLK_CHECKSUM) != 0U) {
+		Lz4->State = XFSBL_LZ4_ST_SKIP;
+		Lz4->NextState = XFSBL_LZ4_ST_BLK_SIZE;
+		Lz4->Count = XFSBL_LZ4_CHECKSUM_LEN;
+	} else {
+		Lz4->State = XFSBL_LZ4_ST_BLK_SIZE;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function moves the decoder past the literals of a sequence. The
+ * last sequence of a block only has literals.
+ *
+ * @param	Lz4 is pointer to the decoder state
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_Lz4LiteralsEnd(XFsblPs_Lz4Stream * Lz4)
+{
+	if (Lz4->BlockLeft == 0U) {
+		XFsbl_Lz4BlockEnd(Lz4);
+	} else {
+		Lz4->State = XFSBL_LZ4_ST_OFFSET;
+		Lz4->Count = 0U;
+		Lz4->Value = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function copies the match of the current sequence from the already
+ * decompressed data
+ *
+ * @param	Lz4 is pointer to the decoder state
+ *
+ * @return	XFSBL_SUCCESS, or XFSBL_ERROR_LZ4 if the match does not fit
+ *
+ *****************************************************************************/
+static u32 XFsbl_Lz4Match(XFsblPs_Lz4Stream * Lz4)
+{
+	u32 Status = XFSBL_SUCCESS;
+	const u8 *Src;
+	u8 *Dst;
+	u32 Len = Lz4->MatchLen;
+
+	if (Len > (Lz4->DestLength - Lz4->DestPos)) {
+		Status = XFSBL_ERROR_LZ4;
+		goto END;
+	}
+
+	/* Matches may overlap the bytes they produce */
+	Dst = &Lz4->Dest[Lz4->DestPos];
+	Src = Dst - Lz4->Value;
+	while (Len != 0U) {
+		*Dst = *Src;
+		Dst++;
+		Src++;
+		Len--;
+	}
+	Lz4->DestPos += Lz4->MatchLen;
+
+	if (Lz4->BlockLeft == 0U) {
+		XFsbl_Lz4BlockEnd(Lz4);
+	} else {
+		Lz4->State = XFSBL_LZ4_ST_TOKEN;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function decodes one chunk of the frame after the frame header
+ *
+ * @param	Lz4 is pointer to the decoder state
+ * @param	Buf is pointer to the chunk
+ * @param	Len is the length of the chunk in bytes
+ *
+ * @return	XFSBL_SUCCESS, or XFSBL_ERROR_LZ4 on malformed data
+ *
+ *****************************************************************************/
+static u32 XFsbl_Lz4Decode(XFsblPs_Lz4Stream * Lz4, const u8 * Buf, u32 Len)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 Pos = 0U;
+	u32 Num;
+	u32 Byte;
+
+	while ((Pos < Len) && (Lz4->State != XFSBL_LZ4_ST_DONE) &&
+			(Status == XFSBL_SUCCESS)) {
+		/* Sequences must not run past their block */
+		if ((Lz4->State >= XFSBL_LZ4_ST_TOKEN) &&
+				(Lz4->State <= XFSBL_LZ4_ST_MATCH_LEN) &&
+				(Lz4->BlockLeft == 0U)) {
+			Status = XFSBL_ERROR_LZ4;
+			break;
+		}
+
+		switch (Lz4->State) {
+		case XFSBL_LZ4_ST_BLK_SIZE:
+			Lz4->Value |= (u32)Buf[Pos] << (Lz4->Count * 8U);
+			Pos++;
+			Lz4->Count++;
+			if (Lz4->Count == 4U) {
+				Num = Lz4->Value & ~XFSBL_LZ4_BLK_UNCOMPRESSED;
+				Lz4->Count = 0U;
+				if (Lz4->Value == 0U) {
+					/* End mark */
+					if ((Lz4->Flags &
+						XFSBL_LZ4_FLG_CONTENT_CHECKSUM) != 0U) {
+						Lz4->State = XFSBL_LZ4_ST_SKIP;
+						Lz4->NextState = XFSBL_LZ4_ST_DONE;
+						Lz4->Count = XFSBL_LZ4_CHECKSUM_LEN;
+					} else {
+						Lz4->State = XFSBL_LZ4_ST_DONE;
+					}
+				} else if ((Num == 0U) || (Num > Lz4->BlockMax)) {
+					Status = XFSBL_ERROR_LZ4;
+				} else if ((Lz4->Value &
+					XFSBL_LZ4_BLK_UNCOMPRESSED) != 0U) {
+					Lz4->State = XFSBL_LZ4_ST_RAW;
+					Lz4->Count = Num;
+				} else {
+					Lz4->State = XFSBL_LZ4_ST_TOKEN;
+					Lz4->BlockLeft = Num;
+				}
+				Lz4->Value = 0U;
+			}
+			break;
+
+		case XFSBL_LZ4_ST_TOKEN:
+			Lz4->Token = Buf[Pos];
+			Pos++;
+			Lz4->BlockLeft--;
+			Lz4->Count = Lz4->Token >> 4U;
+			if (Lz4->Count == XFSBL_LZ4_LEN_EXTENDED) {
+				Lz4->State = XFSBL_LZ4_ST_LIT_LEN;
+			} else if (Lz4->Count == 0U) {
+				XFsbl_Lz4LiteralsEnd(Lz4);
+			} else {
+				Lz4->State = XFSBL_LZ4_ST_LITERALS;
+			}
+			break;
+
+		case XFSBL_LZ4_ST_LIT_LEN:
+			Byte = Buf[Pos];
+			Pos++;
+			Lz4->BlockLeft--;
+			Lz4->Count += Byte;
+			if (Byte != XFSBL_LZ4_LEN_CONTINUE) {
+				Lz4->State = XFSBL_LZ4_ST_LITERALS;
+			}
+			break;
+
+		case XFSBL_LZ4_ST_LITERALS:
+			Num = XFSBL_LZ4_MIN(Lz4->Count, Len - Pos);
+			Num = XFSBL_LZ4_MIN(Num, Lz4->BlockLeft);
+			if (Num > (Lz4->DestLength - Lz4->DestPos)) {
+				Status = XFSBL_ERROR_LZ4;
+				break;
+			}
+			(void)XFsbl_MemCpy(&Lz4->Dest[Lz4->DestPos], &Buf[Pos], Num);
+			Pos += Num;
+			Lz4->BlockLeft -= Num;
+			Lz4->DestPos += Num;
+			Lz4->Count -= Num;
+			if (Lz4->Count == 0U) {
+				XFsbl_Lz4LiteralsEnd(Lz4);
+			}
+			break;
+
+		case XFSBL_LZ4_ST_OFFSET:
+			Lz4->Value |= (u32)Buf[Pos] << (Lz4->Count * 8U);
+			Pos++;
+			Lz4->BlockLeft--;
+			Lz4->Count++;
+			if (Lz4->Count == 2U) {
+				if ((Lz4->Value == 0U) || (Lz4->Value > Lz4->DestPos)) {
+					Status = XFSBL_ERROR_LZ4;
+					break;
+				}
+				Lz4->MatchLen = (Lz4->Token & XFSBL_LZ4_LEN_EXTENDED) +
+						XFSBL_LZ4_MIN_MATCH;
+				if ((Lz4->Token & XFSBL_LZ4_LEN_EXTENDED) ==
+						XFSBL_LZ4_LEN_EXTENDED) {
+					Lz4->State = XFSBL_LZ4_ST_MATCH_LEN;
+				} else {
+					Status = XFsbl_Lz4Match(Lz4);
+				}
+			}
+			break;
+
+		case XFSBL_LZ4_ST_MATCH_LEN:
+			Byte = Buf[Pos];
+			Pos++;
+			Lz4->BlockLeft--;
+			Lz4->MatchLen += Byte;
+			if (Byte != XFSBL_LZ4_LEN_CONTINUE) {
+				Status = XFsbl_Lz4Match(Lz4);
+			}
+			break;
+
+		case XFSBL_LZ4_ST_RAW:
+			Num = XFSBL_LZ4_MIN(Lz4->Count, Len - Pos);
+			if (Num > (Lz4->DestLength - Lz4->DestPos)) {
+				Status = XFSBL_ERROR_LZ4;
+				break;
+			}
+			(void)XFsbl_MemCpy(&Lz4->Dest[Lz4->DestPos], &Buf[Pos], Num);
+			Pos += Num;
+			Lz4->DestPos += Num;
+			Lz4->Count -= Num;
+			if (Lz4->Count == 0U) {
+				XFsbl_Lz4BlockEnd(Lz4);
+			}
+			break;
+
+		case XFSBL_LZ4_ST_SKIP:
+			Num = XFSBL_LZ4_MIN(Lz4->Count, Len - Pos);
+			Pos += Num;
+			Lz4->Count -= Num;
+			if (Lz4->Count == 0U) {
+				Lz4->State = Lz4->NextState;
+			}
+			break;
+
+		default:
+			Status = XFSBL_ERROR_LZ4;
+			break;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function reads the start of a partition and checks for an LZ4
+ * frame header. Frames have to carry the content size, which is the
+ * length of the partition after decompression.
+ *
+ * @param	DeviceOps is pointer to the boot device operations
+ * @param	SrcAddress is the boot device offset of the partition
+ * @param	Length is the length of the partition on the boot device
+ * @param	DestLengthPtr is updated with the decompressed length, or 0 if
+ *		the partition is not compressed
+ *
+ * @return	XFSBL_SUCCESS, or the error of the boot device read
+ *
+ *****************************************************************************/
+u32 XFsbl_Lz4GetLength(const XFsblPs_DeviceOps * DeviceOps, u32 SrcAddress,
+		u32 Length, u32 * DestLengthPtr)
+{
+	u32 Status = XFSBL_SUCCESS;
+	const u8 *Hdr = Lz4Buffer;
+	u32 Magic;
+	u32 Flags;
+	u32 BlockId;
+
+	*DestLengthPtr = 0U;
+
+	if (Length <= XFSBL_LZ4_FRAME_HDR_LEN) {
+		goto END;
+	}
+
+	Status = DeviceOps->DeviceCopy(SrcAddress, (PTRSIZE)Lz4Buffer,
+			XFSBL_LZ4_FRAME_HDR_LEN);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
+	Magic = (u32)Hdr[0] | ((u32)Hdr[1] << 8U) | ((u32)Hdr[2] << 16U) |
+			((u32)Hdr[3] << 24U);
+	Flags = Hdr[4];
+	BlockId = ((u32)Hdr[5] & XFSBL_LZ4_BD_BLK_MAX_MASK) >>
+			XFSBL_LZ4_BD_BLK_MAX_SHIFT;
+
+	if ((Magic != XFSBL_LZ4_MAGIC) ||
+		((Flags & XFSBL_LZ4_FLG_VERSION_MASK) != XFSBL_LZ4_FLG_VERSION) ||
+		((Flags & (XFSBL_LZ4_FLG_RESERVED | XFSBL_LZ4_FLG_DICT_ID)) != 0U) ||
+		((Flags & XFSBL_LZ4_FLG_CONTENT_SIZE) == 0U) ||
+		(((u32)Hdr[5] & XFSBL_LZ4_BD_RESERVED) != 0U) ||
+		(BlockId < 4U)) {
+		goto END;
+	}
+
+	/* Content size is little endian, the upper word has to be zero */
+	if ((Hdr[10] | Hdr[11] | Hdr[12] | Hdr[13]) != 0U) {
+		XFsbl_Printf(DEBUG_GENERAL, "LZ4 content size is too large\r\n");
+		goto END;
+	}
+
+	Lz4Stream.Flags = Flags;
+	Lz4Stream.BlockMax = (u32)1U << (8U + (2U * BlockId));
+	*DestLengthPtr = (u32)Hdr[6] | ((u32)Hdr[7] << 8U) |
+			((u32)Hdr[8] << 16U) | ((u32)Hdr[9] << 24U);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function decompresses an LZ4 partition to its load address while it
+ * is read from the boot device. XFsbl_Lz4GetLength() has to be called for
+ * the partition before.
+ *
+ * @param	DeviceOps is pointer to the boot device operations
+ * @param	SrcAddress is the boot device offset of the partition
+ * @param	Length is the length of the partition on the boot device
+ * @param	DestAddress is the load address
+ * @param	DestLength is the decompressed length
+ *
+ * @return	XFSBL_SUCCESS, XFSBL_ERROR_LZ4 on malformed data, or the error
+ *		of the boot device read
+ *
+ *****************************************************************************/
+u32 XFsbl_Lz4Copy(const XFsblPs_DeviceOps * DeviceOps, u32 SrcAddress,
+		u32 Length, PTRSIZE DestAddress, u32 DestLength)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 Offset = XFSBL_LZ4_FRAME_HDR_LEN;
+	u32 Num;
+
+	Lz4Stream.Dest = (u8 *)DestAddress;
+	Lz4Stream.DestLength = DestLength;
+	Lz4Stream.DestPos = 0U;
+	Lz4Stream.State = XFSBL_LZ4_ST_BLK_SIZE;
+	Lz4Stream.Count = 0U;
+	Lz4Stream.Value = 0U;
+	Lz4Stream.BlockLeft = 0U;
+
+	/* Padding after the end mark is not read */
+	while ((Offset < Length) && (Lz4Stream.State != XFSBL_LZ4_ST_DONE)) {
+		Num = XFSBL_LZ4_MIN(Length - Offset, XFSBL_LZ4_READ_SIZE);
+		Status = DeviceOps->DeviceCopy(SrcAddress + Offset,
+				(PTRSIZE)Lz4Buffer, Num);
+		if (XFSBL_SUCCESS != Status) {
+			goto END;
+		}
+
+		Status = XFsbl_Lz4Decode(&Lz4Stream, Lz4Buffer, Num);
+		if (XFSBL_SUCCESS != Status) {
+			break;
+		}
+		Offset += Num;
+	}
+
+	if ((Status != XFSBL_SUCCESS) ||
+		(Lz4Stream.State != XFSBL_LZ4_ST_DONE) ||
+		(Lz4Stream.DestPos != DestLength)) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_LZ4 at 0x%0x, %u of %u "
+				"bytes decompressed\r\n", SrcAddress + Offset,
+				Lz4Stream.DestPos, DestLength);
+		Status = XFSBL_ERROR_LZ4;
+		goto END;
+	}
+
+	Xil_DCacheFlushRange((INTPTR)DestAddress, DestLength);
+
+END:
+	return Status;
+}
+#endif /* XFSBL_LZ4 */
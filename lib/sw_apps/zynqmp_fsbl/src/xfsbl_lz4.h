@@ -0,0 +1,87 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xfsbl_lz4.h
+*
+* Contains declarations for loading LZ4 compressed partitions
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/14/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XFSBL_LZ4_H
+#define XFSBL_LZ4_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+#include "xfsbl_misc_drivers.h"
+
+#ifdef XFSBL_LZ4
+/**************************** Macros Definitions *****************************/
+#define XFSBL_LZ4_MAGIC			(0x184D2204U)
+
+/**
+ * Frame header supported by the FSBL: magic, FLG, BD, 8 byte content size
+ * and header checksum. Dictionary ids are not supported.
+ */
+#define XFSBL_LZ4_FRAME_HDR_LEN		(15U)
+
+/* Compressed data is read from the boot device in chunks of this size */
+#define XFSBL_LZ4_READ_SIZE		(8192U)
+
+/************************** Function Prototypes ******************************/
+u32 XFsbl_Lz4GetLength(const XFsblPs_DeviceOps * DeviceOps, u32 SrcAddress,
+		u32 Length, u32 * DestLengthPtr);
+u32 XFsbl_Lz4Copy(const XFsblPs_DeviceOps * DeviceOps, u32 SrcAddress,
+		u32 Length, PTRSIZE DestAddress, u32 DestLength);
+#endif /* XFSBL_LZ4 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_LZ4_H */
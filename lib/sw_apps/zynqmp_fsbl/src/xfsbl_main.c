@@ -46,6 +46,8 @@
 * 1.00  ba   02/22/16 Added performance measurement feature.
 * 2.0   bv   12/02/16 Made compliance to MISRAC 2012 guidelines
 *                     Added warm restart support
+*       ag   10/14/26 Releasing the boot device after loading all the
+*                     partitions with USB streaming
 *
 * </pre>
 *
@@ -90,6 +92,9 @@ int main(void )
 #ifdef XFSBL_PERF
 	XTime tCur = 0;
 #endif
+#ifdef XFSBL_PROFILE
+	u32 ProfileIdx;
+#endif
 #ifdef ENABLE_POS
 	u32 WarmBoot;
 
@@ -129,6 +134,9 @@ int main(void )
 					 * Include the code for FSBL time measurements
 					 * Initialize the global timer and get the value
 					 */
+#ifdef XFSBL_PROFILE
+					XFsbl_ProfileEnd(XFSBL_PROFILE_STAGE1_ENTRY, 0U);
+#endif
 
 					FsblStage = XFSBL_STAGE2;
 				}
@@ -141,6 +149,9 @@ int main(void )
 				/* Get Start time for Boot Device init. */
 				XTime_GetTime(&tCur);
 #endif
+#ifdef XFSBL_PROFILE
+				ProfileIdx = XFsbl_ProfileStart(XFSBL_PROFILE_STAGE2, 0U);
+#endif
 
 				XFsbl_Printf(DEBUG_INFO,
 						"================= In Stage 2 ============ \n\r");
@@ -180,6 +191,9 @@ int main(void )
 #ifdef XFSBL_PERF
 				XFsbl_MeasurePerfTime(tCur);
 				XFsbl_Printf(DEBUG_PRINT_ALWAYS, " : Boot Dev. Init. Time\n\r");
+#endif
+#ifdef XFSBL_PROFILE
+				XFsbl_ProfileEnd(ProfileIdx, 0U);
 #endif
 			} break;
 
@@ -196,8 +210,17 @@ int main(void )
 				 *  partition header
 				 *  partition parameters
 				 */
+#ifdef XFSBL_PROFILE
+				ProfileIdx = XFsbl_ProfileStart(XFSBL_PROFILE_STAGE3,
+						PartitionNum);
+#endif
 				FsblStatus = XFsbl_PartitionLoad(&FsblInstance,
 								  PartitionNum);
+#ifdef XFSBL_PROFILE
+				XFsbl_ProfileEnd(ProfileIdx, FsblInstance.ImageHeader.
+					PartitionHeader[PartitionNum].TotalDataWordLength *
+					XIH_PARTITION_WORD_LENGTH);
+#endif
 				if (XFSBL_SUCCESS != FsblStatus)
 				{
 					/**
@@ -236,6 +259,22 @@ int main(void )
 						 */
 						XFsbl_Printf(DEBUG_INFO,"All Partitions Loaded \n\r");
 
+#ifdef XFSBL_USB_STREAM
+						/**
+						 * Finish the DFU download which is still
+						 * in progress in USB boot mode
+						 */
+						if (XFSBL_SUCCESS !=
+							FsblInstance.DeviceOps.DeviceRelease()) {
+							XFsbl_Printf(DEBUG_GENERAL,
+								"Boot device release failed\n\r");
+							FsblStatus = XFSBL_ERROR_USB_STREAM +
+								XFSBL_ERROR_STAGE_3;
+							FsblStage = XFSBL_STAGE_ERR;
+							break;
+						}
+#endif
+
 #ifdef XFSBL_PERF
 						XFsbl_MeasurePerfTime(FsblInstance.PerfTime.tFsblStart);
 						XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": Total Time \n\r");
@@ -260,6 +299,9 @@ int main(void )
 				 * xip
 				 * ps7 post config
 				 */
+#ifdef XFSBL_PROFILE
+				(void)XFsbl_ProfileStart(XFSBL_PROFILE_STAGE4, 0U);
+#endif
 				FsblStatus = XFsbl_Handoff(&FsblInstance, PartitionNum, EarlyHandoff);
 
 				if (XFSBL_STATUS_CONTINUE_PARTITION_LOAD == FsblStatus) {
@@ -45,6 +45,10 @@
 * 1.00  kc   10/21/13 Initial release
 * 2.0   vb   03/24/17 Added macros for LOVEC/HIVEC and USB boot mode,
 *                     Made compliance to MISRAC 2012 guidelines
+*       ag   10/14/26 Added XFsbl_ZDmaLoadWait()
+*       ag   10/14/26 Included xfsbl_profile.h
+*       ag   10/14/26 Added BsChecksum to XFsblPs
+*       ag   10/14/26 Added IsLz4Loaded to XFsblPs
 *
 * </pre>
 *
@@ -65,6 +69,7 @@ extern "C" {
 #include "xfsbl_hw.h"
 #include "xplatform_info.h"
 #include "xtime_l.h"
+#include "xfsbl_profile.h"
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
@@ -96,6 +101,9 @@ typedef struct {
 	u32 ProcessorID; /**< One of R5-0, R5-LS, A53-0 */
 	u32 A53ExecState; /**< One of A53 64-bit, A53 32-bit */
 	u32 BootHdrAttributes; /**< Boot Header attributes */
+#ifdef XFSBL_BS_CHECKSUM
+	u32 BsChecksum; /**< Bitstream checksum from Boot Header */
+#endif
 	u32 ImageOffsetAddress; /**< Flash offset address */
 	XFsblPs_ImageHeader ImageHeader; /** Image header */
 	u32 ErrorCode; /**< Error code during FSBL failure */
@@ -110,6 +118,9 @@ typedef struct {
 #if defined XFSBL_PERF
 	XFsblPs_Perf PerfTime;
 #endif
+#ifdef XFSBL_LZ4
+	u32 IsLz4Loaded; /**< Last partition copy was decompressed */
+#endif
 } XFsblPs;
 
 
@@ -202,6 +213,9 @@ u32 XFsbl_TcmEccInit(XFsblPs * FsblInstancePtr, u32 CpuId);
  */
 u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum);
 u32 XFsbl_PowerUpMemory(u32 MemoryType);
+#ifdef XFSBL_ZDMA_LOAD
+u32 XFsbl_ZDmaLoadWait(void);
+#endif
 /**
  * Functions defined in xfsbl_handoff.c
  */
@@ -506,22 +506,21 @@ void XFsbl_RegisterHandlers(void)
 /*****************************************************************************/
 /**
 *
-* This function checks the power state of one or more power islands and
-* powers them up if required.
+* This function issues power up requests for one or more power islands
+* without waiting for them to complete. Islands which are already powered
+* up or have a request pending are skipped.
 *
 * @param	Mask of Island(s) that need to be powered up
 *
-* @return	XFSBL_SUCCESS for successful power up or
-* 		    XFSBL_FAILURE otherwise.
+* @return	Mask of Island(s) the completion has to be polled for
 *
-* @note		None.
+* @note		Completion is polled by XFsbl_PowerUpIsland, so multiple
+*		power ups can ramp in parallel with other initialization.
 *
 ****************************************************************************/
-u32 XFsbl_PowerUpIsland(u32 PwrIslandMask)
+u32 XFsbl_PowerUpIslandRequest(u32 PwrIslandMask)
 {
-
-	u32 RegVal;
-	u32 Status = XFSBL_SUCCESS;
+	u32 ReqMask = 0U;
 
 	/* Skip power-up request for QEMU */
 	if (XGet_Zynq_UltraMp_Platform_info() != (u32)XPLAT_ZYNQ_ULTRA_MPQEMU)
@@ -533,11 +532,46 @@ u32 XFsbl_PowerUpIsland(u32 PwrIslandMask)
 			PwrIslandMask |= PMU_GLOBAL_PWR_STATE_R5_0_MASK;
 		}
 
-		/* Power up request enable */
-		XFsbl_Out32(PMU_GLOBAL_REQ_PWRUP_INT_EN, PwrIslandMask);
+		ReqMask = PwrIslandMask &
+			~(XFsbl_In32(PMU_GLOBAL_REQ_PWRUP_STATUS));
+
+		if (ReqMask != 0U) {
+			/* Power up request enable */
+			XFsbl_Out32(PMU_GLOBAL_REQ_PWRUP_INT_EN, ReqMask);
 
-		/* Trigger power up request */
-		XFsbl_Out32(PMU_GLOBAL_REQ_PWRUP_TRIG, PwrIslandMask);
+			/* Trigger power up request */
+			XFsbl_Out32(PMU_GLOBAL_REQ_PWRUP_TRIG, ReqMask);
+		}
+	}
+
+	return PwrIslandMask;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the power state of one or more power islands and
+* powers them up if required.
+*
+* @param	Mask of Island(s) that need to be powered up
+*
+* @return	XFSBL_SUCCESS for successful power up or
+* 		    XFSBL_FAILURE otherwise.
+*
+* @note		Requests issued earlier by XFsbl_PowerUpIslandRequest are
+*		not triggered again, only their completion is polled.
+*
+****************************************************************************/
+u32 XFsbl_PowerUpIsland(u32 PwrIslandMask)
+{
+
+	u32 RegVal;
+	u32 Status = XFSBL_SUCCESS;
+
+	/* Skip power-up request for QEMU */
+	if (XGet_Zynq_UltraMp_Platform_info() != (u32)XPLAT_ZYNQ_ULTRA_MPQEMU)
+	{
+		PwrIslandMask = XFsbl_PowerUpIslandRequest(PwrIslandMask);
 
 		/* Poll for Power up complete */
 		do {
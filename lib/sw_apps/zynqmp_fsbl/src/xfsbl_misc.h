@@ -81,6 +81,7 @@ char * XFsbl_Strcat(char* Str1Ptr, const char* Str2Ptr);
 void XFsbl_MakeSdFileName(char *XFsbl_SdEmmcFileName,
 		u32 MultibootReg, u32 DrvNum);
 u32 XFsbl_GetDrvNumSD(u32 DeviceFlags);
+u32 XFsbl_PowerUpIslandRequest(u32 PwrIslandMask);
 u32 XFsbl_PowerUpIsland(u32 PwrIslandMask);
 u32 XFsbl_IsolationRestore(u32 IsolationMask);
 void XFsbl_SetTlbAttributes(INTPTR Addr, UINTPTR attrib);
@@ -61,6 +61,20 @@
 *                     we are using IV from authenticated header(copied to
 *                     internal memory), using same way for non authenticated
 *                     case as well.
+*       ag   10/14/26 Signed non bitstream partitions using SHA3 are hashed
+*                     while they are copied, see XFsbl_CopyAndHash().
+*       ag   10/14/26 Added ZDMA loading of TCM/OCM partitions, which are
+*                     read to DDR and moved by ADMA while the next
+*                     partition is read from the boot device.
+*       ag   10/14/26 Added boot profile entries for partition copy,
+*                     authentication, decryption and bitstream programming.
+*       ag   10/14/26 APU partitions are loaded from the restart cache on
+*                     APU only restart, handoff details update is moved to
+*                     XFsbl_SetHandoffValues().
+*       ag   10/14/26 The CSU DMA checksum of non secure bitstreams is
+*                     checked against the boot header after PCAP load.
+*       ag   10/14/26 LZ4 compressed partitions are decompressed while they
+*                     are read from the boot device.
 *
 * </pre>
 *
@@ -78,6 +92,8 @@
 #include "xfsbl_bs.h"
 #include "psu_init.h"
 #include "xfsbl_plpartition_valid.h"
+#include "xfsbl_restart.h"
+#include "xfsbl_lz4.h"
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
@@ -102,6 +118,8 @@ static u32 XFsbl_ConfigureMemory(XFsblPs * FsblInstancePtr, u32 RunningCpu,
 static u32 XFsbl_GetLoadAddress(u32 DestinationCpu, PTRSIZE * LoadAddressPtr,
 		u32 Length);
 static void XFsbl_CheckPmuFw(const XFsblPs * FsblInstancePtr, u32 PartitionNum);
+static void XFsbl_SetHandoffValues(XFsblPs * FsblInstancePtr,
+		u32 PartitionNum);
 
 #ifdef XFSBL_SECURE
 static u32 XFsbl_CalcualteCheckSum(XFsblPs* FsblInstancePtr,
@@ -114,6 +132,13 @@ static u32 XFsbl_CalcualteSHA(const XFsblPs* FsblInstancePtr,
 static void XFsbl_SetR5ExcepVectorHiVec(void);
 static void XFsbl_SetR5ExcepVectorLoVec(void);
 #endif
+
+#ifdef XFSBL_ZDMA_LOAD
+static u32 XFsbl_IsZDmaLoadable(XFsblPs_PartitionHeader * PartitionHeader,
+		u32 DestinationCpu, PTRSIZE LoadAddress);
+static void XFsbl_ZDmaLoadStart(PTRSIZE DestAddress, PTRSIZE SrcAddress,
+		u32 Length);
+#endif
 /************************** Variable Definitions *****************************/
 #ifdef ARMR5
 	u8 R5LovecBuffer[32] = {0U};
@@ -135,6 +160,12 @@ u8 HashsOfChunks[HASH_BUFFER_SIZE] __attribute__((section (".bitstream_buffer"))
 #if defined(XFSBL_BS)
 extern u8 ReadBuffer[READ_BUFFER_SIZE];
 #endif
+
+#ifdef XFSBL_ZDMA_LOAD
+/* Destination of the ADMA partition move in progress */
+static PTRSIZE ZDmaLoadAddress = 0U;
+static u32 ZDmaLoadLength = 0U;
+#endif
 /*****************************************************************************/
 /**
  * This function loads the partition
@@ -184,6 +215,17 @@ u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		 */
 	}
 
+#ifdef XFSBL_RESTART_CACHE
+	/**
+	 * On APU only restart, use the verified copy kept from the last boot
+	 */
+	if ((FsblInstancePtr->ResetReason == XFSBL_APU_ONLY_RESET) &&
+		(XFsbl_RestartLoad(FsblInstancePtr, PartitionNum) == TRUE)) {
+		XFsbl_SetHandoffValues(FsblInstancePtr, PartitionNum);
+		goto END;
+	}
+#endif
+
 	/**
 	 * Partition Copy
 	 */
@@ -202,6 +244,12 @@ u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		goto END;
 	}
 
+#ifdef XFSBL_RESTART_CACHE
+	if (FsblInstancePtr->ResetReason != XFSBL_APU_ONLY_RESET) {
+		XFsbl_RestartSave(FsblInstancePtr, PartitionNum);
+	}
+#endif
+
 #ifdef ARMR5
 	if(IsR5IvtBackup == TRUE) {
 		XFsbl_Printf(DEBUG_DETAILED,"XFsbl_PartitionLoad:After Partition Validation\n\r"
@@ -823,6 +871,19 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	u32 Length;
 	u32 RunningCpu;
 	u32 RegVal;
+#ifdef XFSBL_SECURE
+	u32 IsHashOnCopy = FALSE;
+#endif
+#ifdef XFSBL_ZDMA_LOAD
+	u32 IsZDmaLoad = FALSE;
+#endif
+#ifdef XFSBL_PROFILE
+	u32 ProfileIdx;
+#endif
+#ifdef XFSBL_LZ4
+	u32 Lz4Length = 0U;
+	u32 Lz4SrcLength = 0U;
+#endif
 
 #ifdef ARMR5
 	u32 Index;
@@ -833,6 +894,9 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	 */
 	PartitionHeader =
 		&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+#ifdef XFSBL_LZ4
+	FsblInstancePtr->IsLz4Loaded = FALSE;
+#endif
 
 	RunningCpu = FsblInstancePtr->ProcessorID;
 
@@ -912,6 +976,16 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		{
 			goto END;
 		}
+
+		/**
+		 * SHA3 is calculated on the CSU, so the partition can be
+		 * hashed while it is being copied
+		 */
+		if ((FsblInstancePtr->BootHdrAttributes &
+				XIH_BH_IMAGE_ATTRB_SHA2_MASK) !=
+				XIH_BH_IMAGE_ATTRB_SHA2_MASK) {
+			IsHashOnCopy = TRUE;
+		}
 	}
 #endif
 
@@ -953,6 +1027,34 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 #endif
 	}
 
+#ifdef XFSBL_LZ4
+	/**
+	 * Partitions which are not validated may be LZ4 compressed, the
+	 * decompressed length is used for the load region from here on
+	 */
+	if ((DestinationDevice != XIH_PH_ATTRB_DEST_DEVICE_PL) &&
+		(XFsbl_IsRsaSignaturePresent(PartitionHeader) !=
+				XIH_PH_ATTRB_RSA_SIGNATURE) &&
+		(XFsbl_IsEncrypted(PartitionHeader) !=
+				XIH_PH_ATTRB_ENCRYPTION) &&
+		(XFsbl_GetChecksumType(PartitionHeader) ==
+				XIH_PH_ATTRB_NOCHECKSUM)) {
+		Status = XFsbl_Lz4GetLength(&FsblInstancePtr->DeviceOps,
+				SrcAddress, Length, &Lz4Length);
+		if (XFSBL_SUCCESS != Status)
+		{
+			goto END;
+		}
+
+		if (Lz4Length != 0U) {
+			XFsbl_Printf(DEBUG_INFO, "P%u LZ4 compressed, %u to %u "
+					"bytes\r\n", PartitionNum, Length, Lz4Length);
+			Lz4SrcLength = Length;
+			Length = Lz4Length;
+		}
+	}
+#endif
+
 	/**
 	 * When destination device is R5-0/R5-1/R5-L and load address is in TCM
 	 * copy to high address of TCM address map
@@ -964,6 +1066,23 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		goto END;
 	}
 
+#ifdef XFSBL_ZDMA_LOAD
+	/**
+	 * Wait for the previous ADMA move before touching TCM/OCM or
+	 * reusing the staging buffer
+	 */
+	if ((LoadAddress >= XFSBL_R50_HIGH_ATCM_START_ADDRESS) &&
+			(LoadAddress <= XFSBL_OCM_END_ADDRESS)) {
+		Status = XFsbl_ZDmaLoadWait();
+		if (XFSBL_SUCCESS != Status)
+		{
+			goto END;
+		}
+		IsZDmaLoad = XFsbl_IsZDmaLoadable(PartitionHeader,
+				DestinationCpu, LoadAddress);
+	}
+#endif
+
 	/**
 	 * Configure the memory
 	 */
@@ -1068,18 +1187,55 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 #ifdef XFSBL_PERF
 	XTime tCur = 0;
 	XTime_GetTime(&tCur);
+#endif
+#ifdef XFSBL_PROFILE
+	ProfileIdx = XFsbl_ProfileStart(XFSBL_PROFILE_COPY, PartitionNum);
 #endif
 	/**
 	 * Copy the partition to PS_DDR/PL_DDR/TCM
 	 */
-	Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+#ifdef XFSBL_LZ4
+	if (Lz4Length != 0U) {
+		Status = XFsbl_Lz4Copy(&FsblInstancePtr->DeviceOps, SrcAddress,
+				Lz4SrcLength, LoadAddress, Length);
+		if (XFSBL_SUCCESS == Status) {
+			FsblInstancePtr->IsLz4Loaded = TRUE;
+		}
+	} else
+#endif
+#ifdef XFSBL_SECURE
+	if ((IsHashOnCopy == TRUE) && (Length != 0U)) {
+		Status = XFsbl_CopyAndHash(FsblInstancePtr, SrcAddress,
+				LoadAddress, Length, AuthBuffer, PartitionNum);
+	} else
+#endif
+#ifdef XFSBL_ZDMA_LOAD
+	if ((IsZDmaLoad == TRUE) && (Length != 0U)) {
+		/**
+		 * Read the partition to DDR and let ADMA move it, the next
+		 * partition is read from the boot device meanwhile
+		 */
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+					XFSBL_ZDMA_STAGING_ADDRESS, Length);
+		if (XFSBL_SUCCESS == Status) {
+			XFsbl_ZDmaLoadStart(LoadAddress,
+					XFSBL_ZDMA_STAGING_ADDRESS, Length);
+		}
+	} else
+#endif
+	{
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
 					LoadAddress, Length);
+	}
 
 #ifdef XFSBL_PERF
 	XFsbl_MeasurePerfTime(tCur);
 	XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%u Copy time, Size: %0u \r\n",
 				PartitionNum, Length);
 #endif
+#ifdef XFSBL_PROFILE
+	XFsbl_ProfileEnd(ProfileIdx, Length);
+#endif
 
 
 END:
@@ -1107,8 +1263,6 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 	u32 IsChecksumEnabled;
 	u32 DestinationDevice;
 	u32 DestinationCpu;
-	u32 ExecState;
-	u32 CpuNo;
 	XFsblPs_PartitionHeader * PartitionHeader;
 
 #if defined(XFSBL_SECURE)
@@ -1135,6 +1289,9 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 #ifdef XFSBL_PERF
 	XTime tCur = 0;
 #endif
+#ifdef XFSBL_PROFILE
+	u32 ProfileIdx = XFSBL_PROFILE_NO_ENTRY;
+#endif
 
 	/**
 	 * Update the variables
@@ -1209,6 +1366,9 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			"PS Only Reset. Skipping PL configuration\r\n");
 			goto END;
 		}
+#ifdef XFSBL_PROFILE
+		ProfileIdx = XFsbl_ProfileStart(XFSBL_PROFILE_BS, PartitionNum);
+#endif
 	}
 #endif
 
@@ -1331,6 +1491,10 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 #endif
 
 		if (DestinationDevice != XIH_PH_ATTRB_DEST_DEVICE_PL) {
+#ifdef XFSBL_PROFILE
+			ProfileIdx = XFsbl_ProfileStart(XFSBL_PROFILE_AUTH,
+						PartitionNum);
+#endif
 			/**
 			 * Authentication for non bitstream partition in DDR
 			 * less system
@@ -1341,6 +1505,9 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			if (Status != XFSBL_SUCCESS) {
 				goto END;
 			}
+#ifdef XFSBL_PROFILE
+			XFsbl_ProfileEnd(ProfileIdx, Length);
+#endif
 		}
 		else {
 #ifdef XFSBL_BS
@@ -1440,6 +1607,10 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 #ifdef XFSBL_PERF
 			/* Start time for non bitstream partition decryption */
 			XTime_GetTime(&tCur);
+#endif
+#ifdef XFSBL_PROFILE
+			ProfileIdx = XFsbl_ProfileStart(XFSBL_PROFILE_DEC,
+						PartitionNum);
 #endif
 			SStatus = XSecure_AesDecrypt(&SecureAes,
 					(u8 *) LoadAddress, (u8 *) LoadAddress,
@@ -1459,6 +1630,9 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			XFsbl_MeasurePerfTime(tCur);
 			XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%d Dec. Time \r\n",
 							PartitionNum);
+#endif
+#ifdef XFSBL_PROFILE
+			XFsbl_ProfileEnd(ProfileIdx, Length);
 #endif
 		}
 #else
@@ -1543,6 +1717,11 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			XTime_GetTime(&tCur);
 #endif
 
+#ifdef XFSBL_BS_CHECKSUM
+			/* CSU DMA sums the words while writing them to PCAP */
+			XCsuDma_ClearCheckSum(&CsuDma);
+#endif
+
 #ifdef XFSBL_PS_DDR
 			/* Use CSU DMA to load Bit stream to PL */
 			BitstreamWordSize =
@@ -1562,6 +1741,19 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 
 #endif
 
+#ifdef XFSBL_BS_CHECKSUM
+			if ((FsblInstancePtr->BsChecksum != 0U) &&
+				(XCsuDma_GetCheckSum(&CsuDma) !=
+					FsblInstancePtr->BsChecksum)) {
+				Status = XFSBL_ERROR_BS_CHECKSUM;
+				XFsbl_Printf(DEBUG_GENERAL,
+					"XFSBL_ERROR_BS_CHECKSUM\r\n");
+				/* Reset PL */
+				XFsbl_Out32(CSU_PCAP_PROG, 0x0);
+				goto END;
+			}
+#endif
+
 #ifdef XFSBL_PERF
 			XFsbl_MeasurePerfTime(tCur);
 			XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%d "
@@ -1577,6 +1769,11 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 		if (Status != XFSBL_SUCCESS) {
 			goto END;
 		}
+#ifdef XFSBL_PROFILE
+		XFsbl_ProfileEnd(ProfileIdx,
+			PartitionHeader->TotalDataWordLength *
+				XIH_PARTITION_WORD_LENGTH);
+#endif
 
 		/**
 		 * PL is powered-up before its configuration, but will be in isolation.
@@ -1604,6 +1801,44 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 	/**
 	 * Update the handoff details
 	 */
+	XFsbl_SetHandoffValues(FsblInstancePtr, PartitionNum);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function updates the handoff details of a loaded partition
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ *
+ * @param	PartitionNum is the partition number in the image
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_SetHandoffValues(XFsblPs * FsblInstancePtr,
+		u32 PartitionNum)
+{
+	u32 DestinationDevice;
+	u32 DestinationCpu;
+	u32 ExecState;
+	u32 CpuNo;
+	const XFsblPs_PartitionHeader * PartitionHeader =
+		&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+
+	DestinationDevice = XFsbl_GetDestinationDevice(PartitionHeader);
+
+	/**
+	 * if destination cpu is not present, it means it is for same cpu
+	 */
+	DestinationCpu = XFsbl_GetDestinationCpu(PartitionHeader);
+	if (DestinationCpu == XIH_PH_ATTRB_DEST_CPU_NONE)
+	{
+		DestinationCpu = FsblInstancePtr->ProcessorID;
+	}
+
 	if ((DestinationDevice != XIH_PH_ATTRB_DEST_DEVICE_PL) &&
 			(DestinationCpu != XIH_PH_ATTRB_DEST_CPU_PMU))
 	{
@@ -1620,9 +1855,6 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			FsblInstancePtr->HandoffCpuNo += 1U;
 		}
 	}
-
-END:
-	return Status;
 }
 
 /*****************************************************************************/
@@ -1911,3 +2143,157 @@ static void XFsbl_SetR5ExcepVectorLoVec(void)
 }
 
 #endif
+
+#ifdef XFSBL_ZDMA_LOAD
+/*****************************************************************************/
+/**
+ * This function checks if a TCM/OCM partition can be moved by ADMA from the
+ * DDR staging buffer. Only partitions that are not accessed by the FSBL
+ * after the copy are moved, i.e. without checksum, authentication and
+ * encryption.
+ *
+ * @param	PartitionHeader is pointer to the partition header
+ * @param	DestinationCpu is the destination cpu of the partition
+ * @param	LoadAddress is the address the partition is loaded to
+ *
+ * @return	TRUE if the partition can be moved by ADMA, FALSE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_IsZDmaLoadable(XFsblPs_PartitionHeader * PartitionHeader,
+		u32 DestinationCpu, PTRSIZE LoadAddress)
+{
+	u32 IsLoadable = FALSE;
+
+	if ((DestinationCpu != XIH_PH_ATTRB_DEST_CPU_PMU) &&
+		(XFsbl_GetDestinationDevice(PartitionHeader) !=
+				XIH_PH_ATTRB_DEST_DEVICE_PL) &&
+		(XFsbl_IsEncrypted(PartitionHeader) !=
+				XIH_PH_ATTRB_ENCRYPTION) &&
+		(XFsbl_IsRsaSignaturePresent(PartitionHeader) !=
+				XIH_PH_ATTRB_RSA_SIGNATURE) &&
+		(XFsbl_GetChecksumType(PartitionHeader) ==
+				XIH_PH_ATTRB_NOCHECKSUM)) {
+		IsLoadable = TRUE;
+	}
+
+#ifdef ARMR5
+	/**
+	 * FSBL vectors at the start of R5-0 TCM are restored after the copy
+	 */
+	if ((LoadAddress >= XFSBL_R50_HIGH_ATCM_START_ADDRESS) &&
+		(LoadAddress <
+			(XFSBL_R50_HIGH_ATCM_START_ADDRESS + XFSBL_IVT_LENGTH))) {
+		IsLoadable = FALSE;
+	}
+#else
+	(void)LoadAddress;
+#endif
+
+	return IsLoadable;
+}
+
+/*****************************************************************************/
+/**
+ * This function starts an ADMA channel 1 simple mode transfer and returns
+ * without waiting for it to complete. XFsbl_ZDmaLoadWait() has to be called
+ * before the destination is used.
+ *
+ * @param	DestAddress is the destination address
+ * @param	SrcAddress is the source address
+ * @param	Length is the number of bytes to be moved
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_ZDmaLoadStart(PTRSIZE DestAddress, PTRSIZE SrcAddress,
+		u32 Length)
+{
+	u32 RegVal;
+
+	/* Clear the previous status */
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_ISR, XFsbl_In32(ADMA_CH1_ZDMA_CH_ISR));
+
+	/* Enable Simple (Normal) Mode */
+	RegVal = XFsbl_In32(ADMA_CH1_ZDMA_CH_CTRL0);
+	RegVal &= ~(ADMA_CH0_ZDMA_CH_CTRL0_POINT_TYPE_MASK |
+			ADMA_CH0_ZDMA_CH_CTRL0_MODE_MASK);
+	RegVal |= (ADMA_CH0_ZDMA_CH_CTRL0_POINT_TYPE_NORMAL |
+			ADMA_CH1_ZDMA_CH_CTRL0_MODE_NORMAL);
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_CTRL0, RegVal);
+
+	/* Write Source and Destination Address */
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD0,
+			(u32)((u64)SrcAddress & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD1,
+			(u32)(((u64)SrcAddress >> 32U) &
+				ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_DST_DSCR_WORD0,
+			(u32)((u64)DestAddress & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_DST_DSCR_WORD1,
+			(u32)(((u64)DestAddress >> 32U) &
+				ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
+
+	/* Size to be Transferred. Recommended to set both src and dest sizes */
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD2, Length);
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_DST_DSCR_WORD2, Length);
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_SRC_DSCR_WORD3, 0U);
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_DST_DSCR_WORD3, 0U);
+
+	ZDmaLoadAddress = DestAddress;
+	ZDmaLoadLength = Length;
+
+	/* DMA Enable */
+	RegVal = XFsbl_In32(ADMA_CH1_ZDMA_CH_CTRL2);
+	RegVal |= ADMA_CH0_ZDMA_CH_CTRL2_EN_MASK;
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_CTRL2, RegVal);
+}
+
+/*****************************************************************************/
+/**
+ * This function waits for the ADMA partition move started by
+ * XFsbl_PartitionCopy() to complete.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_SUCCESS when no move is pending or on success,
+ *		XFSBL_ERROR_ZDMA_LOAD on DMA error
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaLoadWait(void)
+{
+	u32 RegVal;
+	u32 Status = XFSBL_SUCCESS;
+
+	if (ZDmaLoadLength == 0U) {
+		goto END;
+	}
+
+	/* Check the status of the transfer by polling on DMA Done */
+	do {
+		RegVal = XFsbl_In32(ADMA_CH1_ZDMA_CH_ISR);
+		RegVal &= ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK;
+	} while ((RegVal != ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK) &&
+		((XFsbl_In32(ADMA_CH1_ZDMA_CH_STATUS) &
+			ADMA_CH0_ZDMA_CH_STATUS_STATE_MASK) !=
+				ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR));
+
+	/* Clear DMA status */
+	XFsbl_Out32(ADMA_CH1_ZDMA_CH_ISR, ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
+
+	/* Read the channel status for errors */
+	RegVal = XFsbl_In32(ADMA_CH1_ZDMA_CH_STATUS) &
+			ADMA_CH0_ZDMA_CH_STATUS_STATE_MASK;
+	if (RegVal == ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ZDMA_LOAD\r\n");
+		Status = XFSBL_ERROR_ZDMA_LOAD;
+	}
+	else {
+		Xil_DCacheInvalidateRange(ZDmaLoadAddress, ZDmaLoadLength);
+	}
+
+	ZDmaLoadLength = 0U;
+
+END:
+	return Status;
+}
+#endif
@@ -0,0 +1,215 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_profile.c
+ *
+ * Contains the boot time profiling log of the FSBL. Stage, partition copy,
+ * authentication, decryption and bitstream programming durations are
+ * recorded with the IOU system timestamp counter, printed before handoff
+ * and optionally copied to XFSBL_PROFILE_LOG_ADDRESS for later use by the
+ * applications.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.00  ag   10/14/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_cache.h"
+#include "xfsbl_main.h"
+#include "xfsbl_profile.h"
+
+#ifdef XFSBL_PROFILE
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u64 XFsbl_ProfileCounter(void);
+
+/************************** Variable Definitions *****************************/
+static XFsblPs_ProfileLog ProfileLog = {0U};
+
+static const char *ProfileName[] = {
+	"", "Stage 1", "Stage 2", "Load", "Stage 4", "Copy", "Auth.",
+	"Dec.", "Bitstream"
+};
+
+/*****************************************************************************/
+/**
+ * This function reads the 64 bit IOU system timestamp counter
+ *
+ * @param	None
+ *
+ * @return	Current counter value
+ *
+ *****************************************************************************/
+static u64 XFsbl_ProfileCounter(void)
+{
+	u32 Upper;
+	u32 Lower;
+
+	/* Read upper again if lower wrapped in between */
+	do {
+		Upper = XFsbl_In32(IOU_SCNTRS_CNT_UPPER);
+		Lower = XFsbl_In32(IOU_SCNTRS_CNT_LOWER);
+	} while (Upper != XFsbl_In32(IOU_SCNTRS_CNT_UPPER));
+
+	return ((u64)Upper << 32U) | (u64)Lower;
+}
+
+/*****************************************************************************/
+/**
+ * This function initializes the profile log and starts the stage 1 entry.
+ * It has to be called after psu init as the timestamp counter is enabled
+ * there.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_ProfileInit(void)
+{
+	ProfileLog.Magic = XFSBL_PROFILE_MAGIC;
+	ProfileLog.Version = XFSBL_PROFILE_VERSION;
+	ProfileLog.NumEntries = 0U;
+	ProfileLog.CounterFreq = XFsbl_In32(IOU_SCNTRS_BASE_FREQ);
+
+	(void)XFsbl_ProfileStart(XFSBL_PROFILE_STAGE1, 0U);
+}
+
+/*****************************************************************************/
+/**
+ * This function starts a new profile entry
+ *
+ * @param	Id is one of the XFSBL_PROFILE_* ids
+ * @param	PartitionNum is the partition number the entry belongs to
+ *
+ * @return	Index of the entry to be passed to XFsbl_ProfileEnd(),
+ *		XFSBL_PROFILE_NO_ENTRY if the log is full
+ *
+ *****************************************************************************/
+u32 XFsbl_ProfileStart(u32 Id, u32 PartitionNum)
+{
+	u32 Index = XFSBL_PROFILE_NO_ENTRY;
+	XFsblPs_ProfileEntry *EntryPtr;
+
+	if (ProfileLog.NumEntries < XFSBL_PROFILE_MAX_ENTRIES) {
+		Index = ProfileLog.NumEntries;
+		EntryPtr = &ProfileLog.Entry[Index];
+		EntryPtr->Id = Id;
+		EntryPtr->PartitionNum = PartitionNum;
+		EntryPtr->Bytes = 0U;
+		EntryPtr->End = 0U;
+		EntryPtr->Start = XFsbl_ProfileCounter();
+		ProfileLog.NumEntries++;
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+ * This function ends a profile entry
+ *
+ * @param	Index is the entry returned by XFsbl_ProfileStart()
+ * @param	Bytes is the number of bytes processed during the entry
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_ProfileEnd(u32 Index, u32 Bytes)
+{
+	if (Index < ProfileLog.NumEntries) {
+		ProfileLog.Entry[Index].End = XFsbl_ProfileCounter();
+		ProfileLog.Entry[Index].Bytes = Bytes;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function ends the entries still open, prints the log and copies it
+ * to XFSBL_PROFILE_LOG_ADDRESS when configured
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_ProfileDump(void)
+{
+	u32 Index;
+	u64 Now = XFsbl_ProfileCounter();
+	u64 TimeUs;
+	const XFsblPs_ProfileEntry *EntryPtr;
+
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, "Boot profile, counter freq %u Hz\r\n",
+			ProfileLog.CounterFreq);
+
+	for (Index = 0U; Index < ProfileLog.NumEntries; Index++) {
+		EntryPtr = &ProfileLog.Entry[Index];
+		if (EntryPtr->End == 0U) {
+			ProfileLog.Entry[Index].End = Now;
+		}
+
+		TimeUs = 0U;
+		if (ProfileLog.CounterFreq != 0U) {
+			TimeUs = ((EntryPtr->End - EntryPtr->Start) * 1000000U) /
+					ProfileLog.CounterFreq;
+		}
+
+		XFsbl_Printf(DEBUG_PRINT_ALWAYS, "P%u %s: %u us, %u bytes\r\n",
+			EntryPtr->PartitionNum, ProfileName[EntryPtr->Id],
+			(u32)TimeUs, EntryPtr->Bytes);
+	}
+
+#if (XFSBL_PROFILE_LOG_ADDRESS != 0U)
+	(void)XFsbl_MemCpy((void *)(PTRSIZE)XFSBL_PROFILE_LOG_ADDRESS,
+			&ProfileLog, sizeof(ProfileLog));
+	Xil_DCacheFlushRange((INTPTR)XFSBL_PROFILE_LOG_ADDRESS,
+			sizeof(ProfileLog));
+#endif
+}
+#endif /* XFSBL_PROFILE */
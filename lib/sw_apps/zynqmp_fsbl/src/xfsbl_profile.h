@@ -0,0 +1,120 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xfsbl_profile.h
+*
+* Contains declarations for the FSBL boot time profiling log
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/14/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XFSBL_PROFILE_H
+#define XFSBL_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+
+#ifdef XFSBL_PROFILE
+/**************************** Macros Definitions *****************************/
+#define XFSBL_PROFILE_MAGIC		(0x46505246U) /* "FPRF" */
+#define XFSBL_PROFILE_VERSION		(1U)
+#define XFSBL_PROFILE_MAX_ENTRIES	(48U)
+#define XFSBL_PROFILE_NO_ENTRY		(0xFFFFFFFFU)
+
+/**
+ * Profile entry ids
+ */
+#define XFSBL_PROFILE_STAGE1		(1U) /**< Initialization after psu init */
+#define XFSBL_PROFILE_STAGE2		(2U) /**< Boot device init and header */
+#define XFSBL_PROFILE_STAGE3		(3U) /**< Complete load of a partition */
+#define XFSBL_PROFILE_STAGE4		(4U) /**< Handoff */
+#define XFSBL_PROFILE_COPY		(5U) /**< Partition copy */
+#define XFSBL_PROFILE_AUTH		(6U) /**< Partition authentication */
+#define XFSBL_PROFILE_DEC		(7U) /**< Partition decryption */
+#define XFSBL_PROFILE_BS		(8U) /**< Bitstream programming */
+
+/* Stage 1 is always the first entry, started by XFsbl_ProfileInit() */
+#define XFSBL_PROFILE_STAGE1_ENTRY	(0U)
+
+/**************************** Type Definitions *******************************/
+/**
+ * One timed FSBL phase. Start and End are IOU timestamp counter values.
+ */
+typedef struct {
+	u32 Id; /**< One of XFSBL_PROFILE_* ids */
+	u32 PartitionNum; /**< Partition number, 0 for stages 1, 2 and 4 */
+	u64 Start; /**< Counter value at the start */
+	u64 End; /**< Counter value at the end */
+	u32 Bytes; /**< Bytes processed in this phase */
+	u32 Reserved;
+} XFsblPs_ProfileEntry;
+
+/**
+ * Profile log, copied to XFSBL_PROFILE_LOG_ADDRESS at handoff when it is
+ * non zero
+ */
+typedef struct {
+	u32 Magic; /**< XFSBL_PROFILE_MAGIC */
+	u32 Version; /**< XFSBL_PROFILE_VERSION */
+	u32 NumEntries; /**< Number of valid entries */
+	u32 CounterFreq; /**< Timestamp counter frequency in Hz */
+	XFsblPs_ProfileEntry Entry[XFSBL_PROFILE_MAX_ENTRIES];
+} XFsblPs_ProfileLog;
+
+/************************** Function Prototypes ******************************/
+void XFsbl_ProfileInit(void);
+u32 XFsbl_ProfileStart(u32 Id, u32 PartitionNum);
+void XFsbl_ProfileEnd(u32 Index, u32 Bytes);
+void XFsbl_ProfileDump(void);
+#endif /* XFSBL_PROFILE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_PROFILE_H */
@@ -47,6 +47,7 @@
 *                     32Bit boot mode support
 * 3.0   bv   12/02/16 Made compliance to MISRAC 2012 guidelines
 *       ds   01/03/17 Add support for Micron QSPI 2G part
+*       ag   10/14/26 Use XQspiPsu_StreamRead for 32 bit QSPI copies
 *
 * </pre>
 *
@@ -980,12 +981,29 @@ u32 XFsbl_Qspi32Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 	u32 QspiAddr;
 	u32 RemainingBytes;
 	u32 TransferBytes;
-	u32 DiscardByteCnt;
 	u32 UStatus;
+	XQspiPsu_ReadCmd StreamCmd;
 
 	XFsbl_Printf(DEBUG_INFO,"QSPI Reading Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
 			SrcAddress, DestAddress, Length);
 
+	/**
+	 * Fast, dual and quad output reads all use DUMMY_CLOCKS dummy cycles,
+	 * clocked at the width of the data phase
+	 */
+	StreamCmd.Opcode = (u8)ReadCommand;
+	StreamCmd.AddrBytes = 4U;
+	StreamCmd.AddrBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	StreamCmd.DummyCycles = (u8)DUMMY_CLOCKS;
+	StreamCmd.MaxChunk = 0U;
+	if (ReadCommand == QUAD_READ_CMD_32BIT) {
+		StreamCmd.BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+	} else if (ReadCommand == DUAL_READ_CMD_32BIT) {
+		StreamCmd.BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+	} else {
+		StreamCmd.BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	}
+
 	/**
 	 * Check the read length with Qspi flash size
 	 */
@@ -1011,6 +1029,17 @@ u32 XFsbl_Qspi32Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 			TransferBytes = RemainingBytes;
 		}
 
+		/**
+		 * A single read command cannot cross from the lower to the
+		 * upper flash in stacked mode
+		 */
+		if ((QspiPsuInstance.Config.ConnectionMode ==
+				XQSPIPSU_CONNECTION_MODE_STACKED) &&
+				(SrcAddress < (QspiFlashSize / 2U)) &&
+				((SrcAddress + TransferBytes) > (QspiFlashSize / 2U))) {
+			TransferBytes = (QspiFlashSize / 2U) - SrcAddress;
+		}
+
 		/**
 		 * Translate address based on type of connection
 		 * If stacked assert the slave select based on address
@@ -1023,82 +1052,12 @@ u32 XFsbl_Qspi32Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 						QspiAddr, DestAddress, TransferBytes);
 
 		/**
-		 * Setup the read command with the specified address and data for the
-		 * Flash
-		 */
-
-		WriteBuffer[COMMAND_OFFSET]   = (u8)ReadCommand;
-		WriteBuffer[ADDRESS_1_OFFSET] = (u8)((QspiAddr & 0xFF000000U) >> 24);
-		WriteBuffer[ADDRESS_2_OFFSET] = (u8)((QspiAddr & 0xFF0000U) >> 16);
-		WriteBuffer[ADDRESS_3_OFFSET] = (u8)((QspiAddr & 0xFF00U) >> 8);
-		WriteBuffer[ADDRESS_4_OFFSET] = (u8)(QspiAddr & 0xFFU);
-		DiscardByteCnt = 5;
-
-		FlashMsg[0].TxBfrPtr = WriteBuffer;
-		FlashMsg[0].RxBfrPtr = NULL;
-		FlashMsg[0].ByteCount = DiscardByteCnt;
-		FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
-
-		/*
-		 * It is recommended to have a separate entry for dummy
-		 */
-		if ((ReadCommand == FAST_READ_CMD_32BIT) ||
-				(ReadCommand == DUAL_READ_CMD_32BIT) ||
-				(ReadCommand == QUAD_READ_CMD_32BIT)) {
-
-			/* Update Dummy cycles as per flash specs for QUAD IO */
-
-			/*
-			 * It is recommended that Bus width value during dummy
-			 * phase should be same as data phase
-			 */
-			if (ReadCommand == FAST_READ_CMD_32BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-			}
-
-			if (ReadCommand == DUAL_READ_CMD_32BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
-			}
-
-			if (ReadCommand == QUAD_READ_CMD_32BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			}
-
-			FlashMsg[1].TxBfrPtr = NULL;
-			FlashMsg[1].RxBfrPtr = NULL;
-			FlashMsg[1].ByteCount = DUMMY_CLOCKS;
-			FlashMsg[1].Flags = 0U;
-		}
-
-		if (ReadCommand == FAST_READ_CMD_32BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		}
-
-		if (ReadCommand == DUAL_READ_CMD_32BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
-		}
-
-		if (ReadCommand == QUAD_READ_CMD_32BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-		}
-
-		FlashMsg[2].TxBfrPtr = NULL;
-		FlashMsg[2].RxBfrPtr = (u8 *)DestAddress;
-		FlashMsg[2].ByteCount = TransferBytes;
-		FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
-
-		if(QspiPsuInstance.Config.ConnectionMode ==
-				XQSPIPSU_CONNECTION_MODE_PARALLEL){
-			FlashMsg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
-		}
-
-		/**
-		 * Send the read command to the Flash to read the specified number
-		 * of bytes from the Flash, send the read command and address and
-		 * receive the specified number of bytes of data in the data buffer
+		 * Read the chunk with one pipelined DMA read. The 4 byte address
+		 * is sent as is, so no bank selection is needed in any connection
+		 * mode
 		 */
-		Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, &FlashMsg[0], 3);
+		Status = XQspiPsu_StreamRead(&QspiPsuInstance, &StreamCmd,
+				QspiAddr, (u8 *)DestAddress, TransferBytes);
 		if (Status != XFSBL_SUCCESS) {
 			UStatus = XFSBL_ERROR_QSPI_READ;
 			XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_QSPI_READ\r\n");
@@ -0,0 +1,287 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_restart.c
+ *
+ * Contains the APU only restart image cache. On system and PS only reset
+ * the validated APU partitions are copied to a reserved DDR region and the
+ * SHA3 digest of every copy is kept in the FSBL data section. On APU only
+ * restart the copies are verified against these digests and loaded from
+ * the cache, without reading and validating them from the boot device.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.00  ag   10/14/26 Initial release
+ *       ag   10/14/26 LZ4 compressed partitions are not cached
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_cache.h"
+#include "xfsbl_restart.h"
+
+#ifdef XFSBL_RESTART_CACHE
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 XFsbl_IsRestartPartition(const XFsblPs_PartitionHeader *
+		PartitionHeader);
+static void XFsbl_RestartDigest(const u8 * Data, u32 Length, u8 * Digest);
+static void XFsbl_RestartTableSave(void);
+
+/************************** Variable Definitions *****************************/
+extern u8 __data_start;
+extern u8 __dup_data_start;
+
+/* Forced to .data so that it is saved and restored with the data section */
+static XFsblPs_RestartTable RestartTable __attribute__ ((section (".data")))
+	= {0U};
+
+/*****************************************************************************/
+/**
+ * This function checks if the partition is reloaded on APU only restart
+ *
+ * @param	PartitionHeader is pointer to the partition header
+ *
+ * @return	TRUE for APU partitions, FALSE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_IsRestartPartition(const XFsblPs_PartitionHeader *
+		PartitionHeader)
+{
+	u32 DestinationCpu = XFsbl_GetDestinationCpu(PartitionHeader);
+	u32 IsRestart = FALSE;
+
+	if ((DestinationCpu >= XIH_PH_ATTRB_DEST_CPU_A53_0) &&
+		(DestinationCpu <= XIH_PH_ATTRB_DEST_CPU_A53_3) &&
+		(XFsbl_GetDestinationDevice(PartitionHeader) !=
+				XIH_PH_ATTRB_DEST_DEVICE_PL) &&
+		(PartitionHeader->UnEncryptedDataWordLength != 0U)) {
+		IsRestart = TRUE;
+	}
+
+	return IsRestart;
+}
+
+/*****************************************************************************/
+/**
+ * This function calculates the SHA3 digest of a cached partition
+ *
+ * @param	Data is pointer to the data
+ * @param	Length is the length of the data in bytes
+ * @param	Digest is the buffer the digest is written to
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_RestartDigest(const u8 * Data, u32 Length, u8 * Digest)
+{
+	(void)XFsbl_ShaStart(NULL, XFSBL_HASH_TYPE_SHA3);
+	XFsbl_ShaUpdate(NULL, (u8 *)Data, Length, XFSBL_HASH_TYPE_SHA3);
+	XFsbl_ShaFinish(NULL, Digest, XFSBL_HASH_TYPE_SHA3);
+}
+
+/*****************************************************************************/
+/**
+ * This function updates the restart table in the duplicate data section,
+ * which is restored on APU only restart
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_RestartTableSave(void)
+{
+	u8 *DupPtr = &__dup_data_start +
+			((u8 *)&RestartTable - &__data_start);
+
+	(void)XFsbl_MemCpy(DupPtr, &RestartTable, sizeof(RestartTable));
+}
+
+/*****************************************************************************/
+/**
+ * This function keeps a copy of a validated APU partition in the restart
+ * cache region. Partitions that do not fit are not cached and are loaded
+ * from the boot device on APU only restart.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionNum is the partition number in the image
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_RestartSave(const XFsblPs * FsblInstancePtr, u32 PartitionNum)
+{
+	const XFsblPs_PartitionHeader * PartitionHeader =
+		&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+	XFsblPs_RestartEntry *EntryPtr;
+	u64 CacheAddress = XFSBL_RESTART_CACHE_ADDRESS;
+	u32 Length;
+
+	if (XFsbl_IsRestartPartition(PartitionHeader) != TRUE) {
+		goto END;
+	}
+
+#ifdef XFSBL_LZ4
+	/* The loaded length is not described by the partition header */
+	if (FsblInstancePtr->IsLz4Loaded == TRUE) {
+		goto END;
+	}
+#endif
+
+	/* A new image starts a new table */
+	if (RestartTable.ImageOffsetAddress !=
+			FsblInstancePtr->ImageOffsetAddress) {
+		RestartTable.NumEntries = 0U;
+		RestartTable.ImageOffsetAddress =
+				FsblInstancePtr->ImageOffsetAddress;
+	}
+
+	if (RestartTable.NumEntries >= XFSBL_RESTART_MAX_ENTRIES) {
+		goto END;
+	}
+
+	if (RestartTable.NumEntries != 0U) {
+		EntryPtr = &RestartTable.Entry[RestartTable.NumEntries - 1U];
+		CacheAddress = (EntryPtr->CacheAddress + EntryPtr->Length +
+				(XFSBL_RESTART_ALIGN - 1U)) &
+				~((u64)XFSBL_RESTART_ALIGN - 1U);
+	}
+
+	Length = PartitionHeader->UnEncryptedDataWordLength *
+			XIH_PARTITION_WORD_LENGTH;
+	if ((CacheAddress + Length) > ((u64)XFSBL_RESTART_CACHE_ADDRESS +
+			XFSBL_RESTART_CACHE_SIZE)) {
+		XFsbl_Printf(DEBUG_INFO, "P%u does not fit in the restart "
+				"cache\r\n", PartitionNum);
+		goto END;
+	}
+
+	EntryPtr = &RestartTable.Entry[RestartTable.NumEntries];
+	EntryPtr->PartitionNum = PartitionNum;
+	EntryPtr->Length = Length;
+	EntryPtr->LoadAddress = PartitionHeader->DestinationLoadAddress;
+	EntryPtr->CacheAddress = CacheAddress;
+
+	(void)XFsbl_MemCpy((u8 *)(PTRSIZE)CacheAddress,
+			(u8 *)(PTRSIZE)EntryPtr->LoadAddress, Length);
+	Xil_DCacheFlushRange((INTPTR)CacheAddress, Length);
+
+	XFsbl_RestartDigest((u8 *)(PTRSIZE)CacheAddress, Length,
+			EntryPtr->Digest);
+
+	RestartTable.NumEntries++;
+	XFsbl_RestartTableSave();
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * This function loads an APU partition from the restart cache on APU only
+ * restart. The cached copy is verified against the digest calculated when
+ * it was saved.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionNum is the partition number in the image
+ *
+ * @return	TRUE if the partition is loaded from the cache, FALSE if it
+ *		has to be loaded from the boot device
+ *
+ *****************************************************************************/
+u32 XFsbl_RestartLoad(const XFsblPs * FsblInstancePtr, u32 PartitionNum)
+{
+	const XFsblPs_PartitionHeader * PartitionHeader =
+		&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+	const XFsblPs_RestartEntry *EntryPtr = NULL;
+	u8 Digest[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4))) = {0U};
+	u32 IsLoaded = FALSE;
+	u32 Index;
+
+	if (RestartTable.ImageOffsetAddress !=
+			FsblInstancePtr->ImageOffsetAddress) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < RestartTable.NumEntries; Index++) {
+		if (RestartTable.Entry[Index].PartitionNum == PartitionNum) {
+			EntryPtr = &RestartTable.Entry[Index];
+			break;
+		}
+	}
+
+	/* The partition header has to describe the cached copy */
+	if ((EntryPtr == NULL) ||
+		(EntryPtr->LoadAddress !=
+			PartitionHeader->DestinationLoadAddress) ||
+		(EntryPtr->Length != (PartitionHeader->UnEncryptedDataWordLength *
+			XIH_PARTITION_WORD_LENGTH))) {
+		goto END;
+	}
+
+	XFsbl_RestartDigest((u8 *)(PTRSIZE)EntryPtr->CacheAddress,
+			EntryPtr->Length, Digest);
+	if (XFsbl_CompareHashs(Digest, (u8 *)EntryPtr->Digest,
+			XFSBL_HASH_TYPE_SHA3) != XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "P%u restart cache digest "
+				"mismatch, loading from boot device\r\n",
+				PartitionNum);
+		goto END;
+	}
+
+	(void)XFsbl_MemCpy((u8 *)(PTRSIZE)EntryPtr->LoadAddress,
+			(u8 *)(PTRSIZE)EntryPtr->CacheAddress, EntryPtr->Length);
+	Xil_DCacheFlushRange((INTPTR)EntryPtr->LoadAddress, EntryPtr->Length);
+
+	XFsbl_Printf(DEBUG_INFO, "P%u loaded from restart cache\r\n",
+			PartitionNum);
+	IsLoaded = TRUE;
+
+END:
+	return IsLoaded;
+}
+#endif /* XFSBL_RESTART_CACHE */
@@ -0,0 +1,100 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xfsbl_restart.h
+*
+* Contains declarations for the APU only restart image cache
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/14/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XFSBL_RESTART_H
+#define XFSBL_RESTART_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+#include "xfsbl_main.h"
+#include "xfsbl_authentication.h"
+
+#ifdef XFSBL_RESTART_CACHE
+/**************************** Macros Definitions *****************************/
+#define XFSBL_RESTART_MAX_ENTRIES	(8U)
+#define XFSBL_RESTART_ALIGN		(64U)
+
+/**************************** Type Definitions *******************************/
+/**
+ * Cached copy of one partition loaded for the APU
+ */
+typedef struct {
+	u32 PartitionNum; /**< Partition number in the image */
+	u32 Length; /**< Length of the loaded partition in bytes */
+	u64 LoadAddress; /**< Address the partition is loaded to */
+	u64 CacheAddress; /**< Address of the copy in the cache region */
+	u8 Digest[XFSBL_HASH_TYPE_SHA3]; /**< SHA3 digest of the copy */
+} XFsblPs_RestartEntry;
+
+/**
+ * Restart cache table, kept in the FSBL data section so it is restored
+ * by XFsbl_RestoreData() on APU only restart
+ */
+typedef struct {
+	u32 NumEntries; /**< Number of valid entries */
+	u32 ImageOffsetAddress; /**< Image the entries were cached from */
+	XFsblPs_RestartEntry Entry[XFSBL_RESTART_MAX_ENTRIES];
+} XFsblPs_RestartTable;
+
+/************************** Function Prototypes ******************************/
+void XFsbl_RestartSave(const XFsblPs * FsblInstancePtr, u32 PartitionNum);
+u32 XFsbl_RestartLoad(const XFsblPs * FsblInstancePtr, u32 PartitionNum);
+#endif /* XFSBL_RESTART_CACHE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_RESTART_H */
@@ -47,6 +47,8 @@
  * 2.0   bv   12/02/16  Made compliance to MISRAC 2012 guidelines
  * 3.0   vns  01/23/18  Added XFsbl_Sha3PadSelect() API to change SHA3 padding
  *                      to KECCAK SHA3 padding.
+ *       ag   10/14/26  Added XFsbl_Sha3UpdateStart() and
+ *                      XFsbl_Sha3UpdateWait().
  *
  * </pre>
  *
@@ -155,6 +157,37 @@ void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
 	}
 }
 
+/*****************************************************************************
+ *
+ * This function starts hashing a data block on the SHA3 engine without
+ * waiting for the CSU DMA transfer to complete.
+ *
+ * @param	Data is the data block to be hashed
+ * @param	Size is the size of the data block in bytes
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XFsbl_Sha3UpdateStart(const u8 * Data, u32 Size)
+{
+	XSecure_Sha3UpdateStart(&SecureSha3, Data, Size);
+}
+
+/*****************************************************************************
+ *
+ * This function waits for the data block started by XFsbl_Sha3UpdateStart()
+ * to be hashed.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XFsbl_Sha3UpdateWait(void)
+{
+	XSecure_Sha3UpdateWait(&SecureSha3);
+}
+
 /*****************************************************************************
  *
  * @param	None
@@ -43,6 +43,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.0   bvikram  02/01/17 First release
+*       ag       10/14/26 Added USB streaming, partitions are loaded while
+*                         the DFU download is in progress
 *
 * </pre>
 *
@@ -67,10 +69,31 @@
 #define XFSBL_REQ_REPLY_LEN		1024U	/**< Max size of reply buffer. */
 #define XFSBL_DOWNLOAD_COMPLETE		2U
 
+#ifdef XFSBL_USB_STREAM
+#define XFSBL_USB_STREAM_RANGES		32U	/**< Max directly received copies */
+#define XFSBL_USB_STREAM_ALIGN		64U	/**< Cache line size */
+#endif
+
+/**************************** Type Definitions *******************************/
+#ifdef XFSBL_USB_STREAM
+/*
+ * Image offsets of the DFU blocks which were received at a load address.
+ * These are not present in the DDR staging buffer.
+ */
+typedef struct {
+	u32 Start;
+	u32 End;
+} XFsblPs_UsbStreamRange;
+#endif
 
 /************************** Function Prototypes ******************************/
 static void XFsbl_StdDevReq(SetupPacket *SetupData);
 static void XFsbl_Ch9Handler(struct Usb_DevData *InstancePtr, SetupPacket *SetupData);
+static void XFsbl_UsbDmaCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
+#ifdef XFSBL_USB_STREAM
+static u32 XFsbl_UsbStreamWait(u32 Offset);
+static u32 XFsbl_UsbStreamCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
+#endif
 
 /************************** Variable Definitions *****************************/
 struct XUsbPsu UsbInstance;
@@ -79,6 +102,16 @@ u32 DownloadDone = 0U;
 extern struct XFsblPs_DfuIf DfuObj;
 extern XCsuDma CsuDma;
 
+#ifdef XFSBL_USB_STREAM
+/* Copy which is waiting for its data, DFU blocks inside it go to DestAddress */
+static u8 StreamActive = FALSE;
+static u32 StreamSrc;
+static u32 StreamEnd;
+static PTRSIZE StreamDest;
+static u32 StreamNumRanges;
+static XFsblPs_UsbStreamRange StreamRange[XFSBL_USB_STREAM_RANGES];
+#endif
+
 /*****************************************************************************
 * This function initializes the USB interface.
 *
@@ -140,6 +173,17 @@ u32 XFsbl_UsbInit(u32 DeviceFlags)
 		goto END;
 	}
 
+#ifdef XFSBL_USB_STREAM
+	/*
+	 * The download is serviced from XFsbl_UsbCopy while the partitions
+	 * are loaded and finished in XFsbl_UsbRelease
+	 */
+	StreamActive = FALSE;
+	StreamNumRanges = 0U;
+	Status = XFSBL_SUCCESS;
+	goto END;
+#endif
+
 	while((DownloadDone < XFSBL_DOWNLOAD_COMPLETE) && (DfuObj.CurrStatus != STATE_DFU_ERROR)) {
 		XUsbPsu_IntrHandler(&UsbInstance);
 	}
@@ -167,7 +211,8 @@ END:
 *		- XFSBL_SUCCESS if successful,
 *		- XFSBL_FAILURE if unsuccessful.
 *
-* @note		None.
+* @note		With USB streaming the data is waited for, blocks which are
+*		not yet downloaded are received directly at the destination.
 *
 *
 *****************************************************************************/
@@ -180,6 +225,29 @@ u32 XFsbl_UsbCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 		goto END;
 	}
 
+#ifdef XFSBL_USB_STREAM
+	Status = XFsbl_UsbStreamCopy(SrcAddress, DestAddress, Length);
+#else
+	XFsbl_UsbDmaCopy(SrcAddress, DestAddress, Length);
+	Status = XFSBL_SUCCESS;
+#endif
+END:
+	return Status;
+}
+
+/*****************************************************************************
+* This function moves data from the DFU temporary address in DDR to the
+* destination with CSU DMA.
+*
+* @param	Source Address
+* @param	Destination Address
+* @param	Number of Bytes to be copied
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XFsbl_UsbDmaCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
+{
 	/* Setup the  SSS for DMA */
 	u32 RegVal = XFsbl_In32(CSU_CSU_SSS_CFG) & XFSBL_CSU_SSS_DMA_MASK;
 	u32	RegVal1 = RegVal | XFSBL_CSU_SSS_SRC_DEST_DMA;
@@ -197,26 +265,201 @@ u32 XFsbl_UsbCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 	/* To acknowledge the transfer has completed */
 	XCsuDma_IntrClear(&CsuDma, XCSUDMA_SRC_CHANNEL, XCSUDMA_IXR_DONE_MASK);
 	XCsuDma_IntrClear(&CsuDma, XCSUDMA_DST_CHANNEL, XCSUDMA_IXR_DONE_MASK);
+}
+
+#ifdef XFSBL_USB_STREAM
+/*****************************************************************************
+* This function services the USB controller until the image is downloaded
+* up to the given offset.
+*
+* @param	Offset from the start of the boot image
+*
+* @return
+*		- XFSBL_SUCCESS if the data is present,
+*		- XFSBL_FAILURE if the download ended or failed before it.
+*
+*****************************************************************************/
+static u32 XFsbl_UsbStreamWait(u32 Offset)
+{
+	u32 Status;
+
+	while ((DfuObj.TotalBytesRcvd < Offset) &&
+			(DownloadDone < XFSBL_DOWNLOAD_COMPLETE) &&
+			(DfuObj.CurrState != STATE_DFU_ERROR)) {
+		XUsbPsu_IntrHandler(&UsbInstance);
+	}
+
+	if (DfuObj.TotalBytesRcvd >= Offset) {
+		Status = XFSBL_SUCCESS;
+	} else {
+		XFsbl_Printf(DEBUG_GENERAL,
+			"XFSBL_ERROR_USB_STREAM: download ended at 0x%0lx\n\r",
+			DfuObj.TotalBytesRcvd);
+		Status = XFSBL_FAILURE;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************
+* This function copies from the boot image while it is being downloaded.
+* If none of the data is downloaded yet, the DFU blocks which fall within the
+* copy are received at the destination and only the partial blocks at
+* either end are moved from the DDR staging buffer.
+*
+* @param	Source Address
+* @param	Destination Address
+* @param	Number of Bytes to be copied
+*
+* @return
+*		- XFSBL_SUCCESS if successful,
+*		- XFSBL_ERROR_USB_STREAM if the data was received at a load
+*		address earlier,
+*		- XFSBL_FAILURE if the download failed.
+*
+*****************************************************************************/
+static u32 XFsbl_UsbStreamCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
+{
+	u32 Status;
+	u32 Index;
+	u32 End = SrcAddress + Length;
+	XFsblPs_UsbStreamRange *RangePtr;
+
+	/* Blocks received at a load address can not be read back */
+	for (Index = 0U; Index < StreamNumRanges; Index++) {
+		if ((SrcAddress < StreamRange[Index].End) &&
+				(End > StreamRange[Index].Start)) {
+			XFsbl_Printf(DEBUG_GENERAL,
+				"XFSBL_ERROR_USB_STREAM: 0x%0lx was streamed\n\r",
+				SrcAddress);
+			Status = XFSBL_ERROR_USB_STREAM;
+			goto END;
+		}
+	}
+
+	/*
+	 * USB DMA writes only DDR here and the destination of each block
+	 * should be cache line aligned
+	 */
+	if ((SrcAddress >= DfuObj.TotalBytesRcvd) &&
+			(StreamNumRanges < XFSBL_USB_STREAM_RANGES) &&
+			(((DestAddress - SrcAddress) % XFSBL_USB_STREAM_ALIGN) == 0U) &&
+			(DestAddress >= XFSBL_PS_DDR_INIT_START_ADDRESS) &&
+			((DestAddress + Length) <= (XFSBL_PS_DDR_END_ADDRESS + 1U))) {
+		StreamRange[StreamNumRanges].Start = 0U;
+		StreamRange[StreamNumRanges].End = 0U;
+		StreamSrc = SrcAddress;
+		StreamEnd = End;
+		StreamDest = DestAddress;
+		StreamActive = TRUE;
+	}
+
+	Status = XFsbl_UsbStreamWait(End);
+
+	if (StreamActive == FALSE) {
+		if (Status == XFSBL_SUCCESS) {
+			XFsbl_UsbDmaCopy(SrcAddress, DestAddress, Length);
+		}
+		goto END;
+	}
+
+	StreamActive = FALSE;
+	RangePtr = &StreamRange[StreamNumRanges];
+	if (RangePtr->End != RangePtr->Start) {
+		StreamNumRanges++;
+	}
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	if (RangePtr->End == RangePtr->Start) {
+		XFsbl_UsbDmaCopy(SrcAddress, DestAddress, Length);
+	} else {
+		if (RangePtr->Start > SrcAddress) {
+			XFsbl_UsbDmaCopy(SrcAddress, DestAddress,
+					RangePtr->Start - SrcAddress);
+		}
+		if (End > RangePtr->End) {
+			XFsbl_UsbDmaCopy(RangePtr->End,
+				DestAddress + (RangePtr->End - SrcAddress),
+				End - RangePtr->End);
+		}
+	}
 
-	Status = XFSBL_SUCCESS;
 END:
 	return Status;
 }
 
+/*****************************************************************************
+* This function returns the buffer a DFU block is received in. Blocks which
+* fall entirely within the copy waiting for data go to its destination,
+* others to the DDR staging buffer at their image offset.
+*
+* @param	Offset of the block from the start of the boot image
+* @param	Length of the block
+*
+* @return	Pointer to the buffer, NULL if the block does not fit the
+*		staging buffer.
+*
+*****************************************************************************/
+u8 *XFsbl_UsbRxBuffer(u32 Offset, u32 Length)
+{
+	u8 *BufferPtr;
+	XFsblPs_UsbStreamRange *RangePtr;
+
+	if ((StreamActive == TRUE) && (Offset >= StreamSrc) &&
+			((Offset + Length) <= StreamEnd)) {
+		RangePtr = &StreamRange[StreamNumRanges];
+		if (RangePtr->End == RangePtr->Start) {
+			RangePtr->Start = Offset;
+		}
+		RangePtr->End = Offset + Length;
+		BufferPtr = (u8 *)(StreamDest + (Offset - StreamSrc));
+	} else if (XFsbl_CheckTempDfuMemory(Offset + Length) == XFSBL_SUCCESS) {
+		BufferPtr = &DfuVirtFlash[Offset];
+	} else {
+		BufferPtr = NULL;
+	}
+
+	return BufferPtr;
+}
+#endif
+
 /*****************************************************************************
 * This function is only for compatibility with other device ops structures.
+* With USB streaming it waits for the rest of the DFU download and stops the
+* controller.
 *
 * @param	None
 *
 * @return
-*		- XFSBL_SUCCESS
+*		- XFSBL_SUCCESS if successful,
+*		- XFSBL_FAILURE if the download failed.
 *
 * @note		None.
 *
 *****************************************************************************/
 u32 XFsbl_UsbRelease(void)
 {
+#ifdef XFSBL_USB_STREAM
+	u32 Status;
+
+	while ((DownloadDone < XFSBL_DOWNLOAD_COMPLETE) &&
+			(DfuObj.CurrState != STATE_DFU_ERROR)) {
+		XUsbPsu_IntrHandler(&UsbInstance);
+	}
+
+	if (DownloadDone == XFSBL_DOWNLOAD_COMPLETE) {
+		Status = XFSBL_SUCCESS;
+	} else {
+		Status = XFSBL_FAILURE;
+	}
+	(void)XUsbPsu_Stop(&UsbInstance);
+
+	return Status;
+#else
 	return XFSBL_SUCCESS;
+#endif
 }
 
 /*********************************************************************************
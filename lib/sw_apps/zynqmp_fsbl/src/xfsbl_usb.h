@@ -43,6 +43,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.0   bvikram  02/01/17 First release
+*       ag       10/14/26 Added XFsbl_UsbRxBuffer for USB streaming
 *
 * </pre>
 *
@@ -123,6 +124,9 @@ u32 XFsbl_UsbInit(u32 DeviceFlags);
 u32 XFsbl_UsbCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
 u32 XFsbl_UsbRelease(void);
 u32 XFsbl_CheckTempDfuMemory(u32 Offset);
+#ifdef XFSBL_USB_STREAM
+u8 *XFsbl_UsbRxBuffer(u32 Offset, u32 Length);
+#endif
 
 #endif/*XFSBL_USB*/
 #ifdef __cplusplus
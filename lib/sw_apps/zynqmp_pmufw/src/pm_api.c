@@ -160,6 +160,14 @@ static const PmApiEntry pmApiTable[] = {
 			.apiId = PM_SECURE_IMAGE,
 			.argTypes = { ARG_UINT32, ARG_UINT32,  ARG_UINT32, ARG_UINT32,
 						  ARG_UNDEF }
+	}, {
+		.apiId = PM_SET_REQUIREMENTS,
+		.argTypes = { ARG_REQUIREMENT, ARG_REQUIREMENT, ARG_REQUIREMENT,
+			      ARG_REQUIREMENT, ARG_ACK }
+	}, {
+		.apiId = PM_PLL_CHANGE_RATE,
+		.argTypes = { ARG_NODE, ARG_UINT32, ARG_UINT32, ARG_UINT32,
+			      ARG_UNDEF }
 	},
 };
 
@@ -231,6 +239,20 @@ static PmPayloadStatus PmCheckArgument(const u8 argType,
 			status = PM_PAYLOAD_ERR_SHUTDOWN_TYPE;
 		}
 		break;
+	case ARG_REQUIREMENT:
+		/* Unused tuples are 0, used ones must carry a valid node */
+		if (0U == arg) {
+			break;
+		}
+		if ((PM_REQ_BATCH_NODE(arg) < NODE_MIN) ||
+		    (PM_REQ_BATCH_NODE(arg) > NODE_MAX)) {
+			status = PM_PAYLOAD_ERR_NODE;
+		} else if (PM_REQ_BATCH_QOS(arg) > MAX_QOS) {
+			status = PM_PAYLOAD_ERR_QOS;
+		} else {
+			/* Tuple is ok */
+		}
+		break;
 	case ARG_CAPABILITIES:
 	case ARG_OP_CH_TYPE:
 	case ARG_STATE:
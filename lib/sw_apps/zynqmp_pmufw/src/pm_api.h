@@ -72,6 +72,7 @@
 #define ARG_ENABLE             15U
 #define ARG_SHUTDOWN_TYPE      16U
 #define ARG_SHUTDOWN_SUBTYPE   17U
+#define ARG_REQUIREMENT        18U
 
 /*********************************************************************
  * Enum definitions
@@ -42,6 +42,16 @@
 #define PM_CLOCK_ACTIVE_MASK_GEM BIT(25)
 #define PM_CLOCK_ACTIVE_MASK_USB BIT(25)
 
+/* Divisor bitfield, common to the clock control registers */
+#define PM_CLOCK_DIV0_MASK	CRF_APB_ACPU_CTRL_DIVISOR0_MASK
+#define PM_CLOCK_DIV0_SHIFT	CRF_APB_ACPU_CTRL_DIVISOR0_SHIFT
+#define PM_CLOCK_DIV0_MAX	(PM_CLOCK_DIV0_MASK >> PM_CLOCK_DIV0_SHIFT)
+
+/* Scale of relative PLL rates, divisible by all cross-domain divisors used */
+#define PM_CLOCK_RATE_SCALE	60U
+
+#define PM_CLOCK_IN_FPD(addr)	(CRF_APB_BASEADDR == ((addr) & 0xFFFF0000U))
+
 static s32 PmClockIsActiveDllSD(PmClockHandle* const ch);
 static s32 PmClockIsActiveGem(PmClockHandle* const ch);
 static s32 PmClockIsActiveUsb(PmClockHandle* const ch);
@@ -1044,7 +1054,6 @@ static PmClock* pmDdrClocks [] = {
 };
 #endif
 
-#ifdef DEBUG_CLK
 /**
  * PmClockGetUseCount() - Get the use count for the clock
  * @clk		Clock whose use count shall be counted
@@ -1066,6 +1075,7 @@ static u32 PmClockGetUseCount(const PmClock* const clk)
 	return useCnt;
 }
 
+#ifdef DEBUG_CLK
 static const char* PmStrClk(const PmClock* const clk)
 {
 	if (clk == &pmClockAcpu) {
@@ -1505,6 +1515,227 @@ done:
 	return;
 }
 
+/**
+ * PmClockGetInputRate() - Get the rate of a PLL at the input of a clock
+ * @clk		Clock whose input is considered
+ * @pll		PLL at the input of the clock
+ *
+ * @return	Rate relative to the reference clock in units of
+ *		PM_CLOCK_RATE_SCALE, or 0 if the PLL does not run
+ *
+ * @note	Clocks in the other domain than the PLL are driven through the
+ *		PLL's cross-domain divisor.
+ */
+static u32 PmClockGetInputRate(const PmClock* const clk, const PmPll* const pll)
+{
+	u32 rate = PmPllGetMult(pll) * PM_CLOCK_RATE_SCALE;
+	u32 div;
+
+	if (PM_CLOCK_IN_FPD(clk->ctrlAddr) != PM_CLOCK_IN_FPD(pll->addr)) {
+		div = (XPfw_Read32(pll->toCtrlAddr) & PM_CLOCK_DIV0_MASK) >>
+			PM_CLOCK_DIV0_SHIFT;
+		rate = (0U == div) ? 0U : (rate / div);
+	}
+
+	return rate;
+}
+
+/**
+ * PmClockGetAltParent() - Find a running PLL to temporarily drive a clock
+ * @clk		Clock to be moved away from its PLL
+ * @pll		PLL that currently drives the clock
+ * @ctrl	Pointer to store the control register value for the alternate
+ *		PLL with the divisor scaled so the clock does not speed up
+ *
+ * @return	Pointer to the alternate PLL or NULL if none can be used
+ */
+static PmPll* PmClockGetAltParent(const PmClock* const clk,
+				  const PmPll* const pll, u32* const ctrl)
+{
+	const u32 val = XPfw_Read32(clk->ctrlAddr);
+	const u32 rate = PmClockGetInputRate(clk, pll);
+	PmPll* alt = NULL;
+	u32 div = (val & PM_CLOCK_DIV0_MASK) >> PM_CLOCK_DIV0_SHIFT;
+	u32 i;
+
+	if (0U == div) {
+		div = 1U;
+	}
+
+	for (i = 0U; (i < clk->mux->size) && (0U != rate); i++) {
+		PmPll* const input = clk->mux->inputs[i].pll;
+		u32 inRate, newDiv;
+
+		if (pll == input) {
+			continue;
+		}
+		inRate = PmClockGetInputRate(clk, input);
+		if (0U == inRate) {
+			continue;
+		}
+
+		/* Round the divisor up, the clock must not run faster than now */
+		newDiv = ((div * inRate) + rate - 1U) / rate;
+		if (newDiv > PM_CLOCK_DIV0_MAX) {
+			continue;
+		}
+
+		*ctrl = (val & ~(PM_CLOCK_MUX_SELECT_MASK | PM_CLOCK_DIV0_MASK)) |
+			(newDiv << PM_CLOCK_DIV0_SHIFT) |
+			clk->mux->inputs[i].select;
+		alt = input;
+		break;
+	}
+
+	return alt;
+}
+
+/**
+ * PmClockSwitch() - Write a new input select and divisor of a clock
+ * @clk		Clock to update
+ * @ctrl	New value of the clock control register
+ *
+ * @note	A raised divisor is written before switching the input and a
+ *		lowered one after, so the clock never runs faster than before
+ *		or after the switch.
+ */
+static void PmClockSwitch(const PmClock* const clk, const u32 ctrl)
+{
+	const u32 val = XPfw_Read32(clk->ctrlAddr);
+
+	if ((ctrl & PM_CLOCK_DIV0_MASK) > (val & PM_CLOCK_DIV0_MASK)) {
+		XPfw_Write32(clk->ctrlAddr, (val & ~PM_CLOCK_DIV0_MASK) |
+			     (ctrl & PM_CLOCK_DIV0_MASK));
+	} else {
+		XPfw_Write32(clk->ctrlAddr, (ctrl & ~PM_CLOCK_DIV0_MASK) |
+			     (val & PM_CLOCK_DIV0_MASK));
+	}
+	XPfw_Write32(clk->ctrlAddr, ctrl);
+}
+
+/**
+ * PmClockMove() - Switch a clock to another PLL and move its users' PLL use
+ * @clk		Clock to switch
+ * @from	PLL driving the clock before the switch
+ * @to		PLL driving the clock after the switch
+ * @ctrl	Value of the clock control register selecting the 'to' PLL
+ *
+ * @note	The use count of the 'from' PLL is decremented without
+ *		suspending it, the caller decides what happens to that PLL.
+ */
+static void PmClockMove(PmClock* const clk, PmPll* const from,
+			PmPll* const to, const u32 ctrl)
+{
+	u32 cnt = PmClockGetUseCount(clk);
+
+	PmClockSwitch(clk, ctrl);
+	if (NULL == clk->users) {
+		goto done;
+	}
+
+	clk->pll = to;
+	from->useCount = (from->useCount > cnt) ? (from->useCount - cnt) : 0U;
+	while (cnt > 0U) {
+		(void)PmPllRequest(to);
+		cnt--;
+	}
+
+done:
+	return;
+}
+
+/**
+ * PmClockChangePllRate() - Change the rate of a PLL with its clocks running
+ * @pll		PLL whose rate is changed
+ * @ctrl	New FBDIV and DIV2 bitfields of the PLL control register
+ * @cfg		New value of the PLL configuration register
+ * @frac	New value of the PLL fractional control register
+ *
+ * @return	XST_SUCCESS if the PLL is relocked and its clocks are switched
+ *		back to it, XST_NO_FEATURE if a clock driven by the PLL cannot
+ *		be moved to another PLL (no change is done in that case), or
+ *		XST_FAILURE if the PLL failed to lock. In the last case the
+ *		clocks keep running from the alternate PLLs.
+ *
+ * @note	Every clock driven by the PLL is first switched through its
+ *		multiplexer to another locked PLL, with its divisor scaled so
+ *		its rate does not increase. The PLL is then relocked and the
+ *		clocks get their original configuration back. The DDR clock
+ *		cannot be switched without putting DDR into self-refresh, so
+ *		the DPLL is changed this way only if it doesn't drive DDR.
+ */
+int PmClockChangePllRate(PmPll* const pll, const u32 ctrl, const u32 cfg,
+			 const u32 frac)
+{
+	static PmPll* altPll[ARRAY_SIZE(pmClocks)];
+	static u32 altCtrl[ARRAY_SIZE(pmClocks)];
+	const bool fpdOn = 0U != (XPfw_Read32(PMU_GLOBAL_PWR_STATE) &
+				  PMU_GLOBAL_PWR_STATE_FP_MASK);
+	int status = XST_SUCCESS;
+	u32 i, val;
+
+	/* Find an alternate parent for every clock driven by the PLL */
+	for (i = 0U; i < ARRAY_SIZE(pmClocks); i++) {
+		PmClock* const clk = pmClocks[i];
+
+		altPll[i] = NULL;
+		if ((false == fpdOn) && (true == PM_CLOCK_IN_FPD(clk->ctrlAddr))) {
+			continue;
+		}
+		val = XPfw_Read32(clk->ctrlAddr) & PM_CLOCK_MUX_SELECT_MASK;
+		if (pll != PmClockGetParent(clk, val)) {
+			continue;
+		}
+		if (&pmClockDdr == clk) {
+			status = XST_NO_FEATURE;
+			goto done;
+		}
+		altPll[i] = PmClockGetAltParent(clk, pll, &altCtrl[i]);
+		if (NULL == altPll[i]) {
+			status = XST_NO_FEATURE;
+			goto done;
+		}
+	}
+
+	/* Move clocks away, remember their configuration for the way back */
+	for (i = 0U; i < ARRAY_SIZE(pmClocks); i++) {
+		if (NULL == altPll[i]) {
+			continue;
+		}
+		val = XPfw_Read32(pmClocks[i]->ctrlAddr);
+		PmClockMove(pmClocks[i], pll, altPll[i], altCtrl[i]);
+		altCtrl[i] = val;
+	}
+
+	status = PmPllReprogram(pll, ctrl, cfg, frac);
+	if (XST_SUCCESS != status) {
+		goto done;
+	}
+
+	/* Switch the clocks back and release the alternate PLLs */
+	for (i = 0U; i < ARRAY_SIZE(pmClocks); i++) {
+		PmClock* const clk = pmClocks[i];
+		u32 cnt = PmClockGetUseCount(clk);
+
+		if (NULL == altPll[i]) {
+			continue;
+		}
+		PmClockSwitch(clk, altCtrl[i]);
+		if (NULL == clk->users) {
+			continue;
+		}
+		clk->pll = pll;
+		pll->useCount += cnt;
+		while (cnt > 0U) {
+			PmPllRelease(altPll[i]);
+			cnt--;
+		}
+	}
+
+done:
+	return status;
+}
+
 #ifdef ENABLE_POS
 /**
  * PmClockRestoreDdr() - Restore state of clocks related to DDR node
@@ -105,6 +105,8 @@ int PmClockRequest(PmNode* const node);
 
 void PmClockRelease(PmNode* const node);
 void PmClockSnoop(const u32 addr, const u32 mask, const u32 val);
+int PmClockChangePllRate(PmPll* const pll, const u32 ctrl, const u32 cfg,
+			 const u32 frac);
 void PmClockConstructList(void);
 void PmClockRestore(PmNode* const node);
 void PmClockSave(PmNode* const node);
@@ -146,6 +146,10 @@ static void PmSelfSuspend(const PmMaster *const master,
 	/* Remember latency requirement */
 	proc->latencyReq = latency;
 
+	/* Fast idle keeps power parent and clocks of the APU core requested */
+	proc->fastIdle = (NODE_APU == master->nid) &&
+			 (PM_APU_STATE_CPU_FAST_IDLE == state);
+
 	status = proc->saveResumeAddr(proc, address);
 	if (XST_SUCCESS != status) {
 		goto done;
@@ -546,6 +550,153 @@ done:
 	PmProcessAckRequest(ack, master, node, status, oppoint);
 }
 
+/**
+ * PmPllChangeRate() - Change the rate of a PLL while its clocks keep running
+ * @master  Master who initiated the request
+ * @nodeId  PLL node
+ * @ctrl    New FBDIV and DIV2 bitfields of the PLL control register
+ * @cfg     New value of the PLL configuration register
+ * @frac    New value of the PLL fractional control register
+ *
+ * @note    The master needs write access to the PLL control register, as it
+ *          would need to change the PLL through PM_MMIO_WRITE. Clocks driven
+ *          by the PLL run from other PLLs while it relocks.
+ */
+static void PmPllChangeRate(const PmMaster *const master, const u32 nodeId,
+			    const u32 ctrl, const u32 cfg, const u32 frac)
+{
+	int status;
+	PmNode* const node = PmGetNodeById(nodeId);
+	PmPll* pll;
+
+	PmDbg(DEBUG_DETAILED,"(%s, %s, 0x%lx)\r\n", PmStrNode(master->nid),
+			PmStrNode(nodeId), ctrl);
+
+	if ((NULL == node) || (NODE_CLASS_PLL != node->class->id)) {
+		status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	pll = (PmPll*)node->derived;
+	if (false == PmGetMmioAccessWrite(master, pll->addr)) {
+		status = XST_PM_NO_ACCESS;
+		goto done;
+	}
+
+	status = PmClockChangePllRate(pll, ctrl, cfg, frac);
+
+done:
+	IPI_RESPONSE1(master->ipiMask, status);
+}
+
+/**
+ * PmSetRequirements() - Request or set requirements for several slaves at once
+ * @master  Master who initiated the request
+ * @args    PM_REQ_BATCH_MAX packed (node, capabilities, qos) tuples, an
+ *          argument of 0 is an unused tuple
+ * @ack     Acknowledge request
+ *
+ * @note    Slaves which are not requested by the master yet are requested,
+ *          requirements of the others are set as in PmSetRequirement. All
+ *          tuples are checked before any of them is applied. Tuples which do
+ *          not drop any capability are applied first, so power islands and
+ *          clocks shared by slaves in the batch are turned on once and are not
+ *          cycled off and on again in between. If applying a tuple fails, the
+ *          remaining tuples are not applied. One acknowledge with the status
+ *          of the whole batch is sent.
+ */
+static void PmSetRequirements(const PmMaster *master,
+			      const u32 *args,
+			      const u32 ack)
+{
+	int status = XST_SUCCESS;
+	u32 caps[PM_REQ_BATCH_MAX];
+	PmRequirement* reqs[PM_REQ_BATCH_MAX] = { NULL };
+	bool suspending = PmMasterIsSuspending(master);
+	u32 pass, i, j;
+
+	for (i = 0U; i < PM_REQ_BATCH_MAX; i++) {
+		PmSlave* slave;
+
+		if (0U == args[i]) {
+			continue;
+		}
+
+		PmDbg(DEBUG_DETAILED,"(%s, %lu, %lu, %s)\r\n",
+		      PmStrNode(PM_REQ_BATCH_NODE(args[i])),
+		      PM_REQ_BATCH_CAPS(args[i]), PM_REQ_BATCH_QOS(args[i]),
+		      PmStrAck(ack));
+
+		slave = PmNodeGetSlave(PM_REQ_BATCH_NODE(args[i]));
+		if (NULL == slave) {
+			status = XST_INVALID_PARAM;
+			goto done;
+		}
+
+		reqs[i] = PmRequirementGet(master, slave);
+		if (NULL == reqs[i]) {
+			status = XST_PM_NO_ACCESS;
+			goto done;
+		}
+
+		/* Each slave can be listed only once in a batch */
+		for (j = 0U; j < i; j++) {
+			if (reqs[j] == reqs[i]) {
+				status = XST_INVALID_PARAM;
+				goto done;
+			}
+		}
+
+		caps[i] = PM_REQ_BATCH_CAPS(args[i]);
+		if (MASTER_REQUESTED_SLAVE(reqs[i])) {
+			/* If slave is set as wake source add PM_CAP_WAKEUP */
+			if (0U != (PM_MASTER_WAKEUP_REQ_MASK & reqs[i]->info)) {
+				caps[i] |= PM_CAP_WAKEUP;
+			}
+		} else {
+			status = PmSlaveVerifyRequest(slave);
+			if (XST_SUCCESS != status) {
+				goto done;
+			}
+		}
+
+		status = PmCheckCapabilities(slave, caps[i]);
+		if (XST_SUCCESS != status) {
+			goto done;
+		}
+	}
+
+	/* 1st pass keeps or adds capabilities, 2nd pass drops capabilities */
+	for (pass = 0U; pass < 2U; pass++) {
+		for (i = 0U; i < PM_REQ_BATCH_MAX; i++) {
+			bool drops;
+
+			if (NULL == reqs[i]) {
+				continue;
+			}
+
+			drops = (reqs[i]->currReq & ~caps[i]) != 0U;
+			if ((0U == pass) == drops) {
+				continue;
+			}
+
+			if (!MASTER_REQUESTED_SLAVE(reqs[i])) {
+				status = PmRequirementRequest(reqs[i], caps[i]);
+			} else if (true == suspending) {
+				status = PmRequirementSchedule(reqs[i], caps[i]);
+			} else {
+				status = PmRequirementUpdate(reqs[i], caps[i]);
+			}
+			if (XST_SUCCESS != status) {
+				goto done;
+			}
+		}
+	}
+
+done:
+	PmProcessAckRequest(ack, master, NODE_UNKNOWN, status, 0U);
+}
+
 /**
  * PmGetApiVersion() - Provides API version number to the caller
  * @master  Master who initiated the request
@@ -1143,7 +1294,7 @@ done:
  * @master  Initiator of the request
  * @node    Node in question
  * @type    Type of the operating characteristics
- *          power, temperature and latency
+ *          power, temperature, wake-up latency and suspend latency
  */
 static void PmGetOpCharacteristics(const PmMaster *const master, const u32 node,
 				   const u32 type)
@@ -1176,6 +1327,14 @@ static void PmGetOpCharacteristics(const PmMaster *const master, const u32 node,
 		}
 		status = nodePtr->class->getWakeUpLatency(nodePtr, &result);
 		break;
+	case PM_OPCHAR_TYPE_SUSPEND_LATENCY:
+		if (false == NODE_IS_SLAVE(nodePtr)) {
+			status = XST_NO_FEATURE;
+			goto done;
+		}
+		status = PmSlaveGetSuspendLatency((PmSlave*)nodePtr->derived,
+						  &result);
+		break;
 	default:
 		PmDbg(DEBUG_DETAILED,"(%s) ERROR: Invalid type: %lu\r\n",
 				PmStrNode(node), type);
@@ -1323,6 +1482,12 @@ static void PmProcessApiCall(PmMaster *const master, const u32 *pload)
 	case PM_SET_MAX_LATENCY:
 		PmSetMaxLatency(master, pload[1], pload[2]);
 		break;
+	case PM_SET_REQUIREMENTS:
+		PmSetRequirements(master, &pload[1], pload[5]);
+		break;
+	case PM_PLL_CHANGE_RATE:
+		PmPllChangeRate(master, pload[1], pload[2], pload[3], pload[4]);
+		break;
 	case PM_GET_API_VERSION:
 		PmGetApiVersion(master);
 		break;
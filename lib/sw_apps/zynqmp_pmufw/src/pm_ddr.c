@@ -163,6 +163,9 @@
 #define DDRPHY_ZQDR1(n)		(DDRPHY_BASE + 0x690U + (0x20U * (n)))
 #define DDRPHY_DXGCR(n, m)	(DDRPHY_BASE + 0X700U + (0x100U * (n)) + (4U * (m)))
 #define DDRPHY_DXGSR0(n)	(DDRPHY_BASE + 0X7e0U + (0x100U * (n)))
+#define DDRPHY_DXBDLR(n, m)	(DDRPHY_BASE + 0X740U + (0x100U * (n)) + (4U * (m)))
+#define DDRPHY_DXLCDLR(n, m)	(DDRPHY_BASE + 0X780U + (0x100U * (n)) + (4U * (m)))
+#define DDRPHY_DXGTR0(n)	(DDRPHY_BASE + 0X7c0U + (0x100U * (n)))
 #define DDRPHY_DX8SLNOSC(n)	(DDRPHY_BASE + 0x1400U + (0x40U * (n)))
 #define DDRPHY_DX8SLPLLCR(n, m)	(DDRPHY_BASE + 0X1404U + (0x40U * (n)) + (4U * (m)))
 #define DDRPHY_DX8SLDQSCTL(n)	(DDRPHY_BASE + 0x141cU + (0x40U * (n)))
@@ -190,6 +193,7 @@
 #define DDRPHY_PIR_ZCALBYP		BIT(30U)
 
 #define DDRPHY_PGCR0_PHYFRST	BIT(26U)
+#define DDRPHY_PGCR6_INHVT	BIT(0U)
 
 #define DDRPHY_DXGSR0_DPLOCK	BIT(16U)
 
@@ -297,6 +301,14 @@
 #define DDRQOS_DDR_CLK_CTRL_CLKACT	BIT(0U)
 
 #define PM_DDR_POLL_PERIOD		3200U	/* ~100us @220MHz */
+#define PM_DDR_SR_POLL_PERIOD		(10U * PM_DDR_POLL_PERIOD)
+
+/* PIT3 runs freely and measures self-refresh entry and exit latencies */
+#define PM_DDR_PIT_PRELOAD		PMU_IOMODULE_PIT3_PRELOAD
+#define PM_DDR_PIT_COUNTER		PMU_IOMODULE_PIT3_COUNTER
+#define PM_DDR_PIT_CONTROL		PMU_IOMODULE_PIT3_CONTROL
+#define PM_DDR_PIT_EN_RELOAD		3U
+#define PM_DDR_PIT_TICKS_PER_US		(XPFW_CFG_PMU_CLK_FREQ / 1000000U)
 
 #define REPORT_IF_ERROR(status) \
 		if (XST_SUCCESS != status) { \
@@ -341,13 +353,18 @@ static const u32 pmDdrStates[PM_DDR_STATE_MAX] = {
 			    PM_CAP_CLOCK,
 };
 
+/* Indices of self-refresh transitions, latencies are updated as measured */
+#define PM_DDR_TRAN_SR_ENTER	0U
+#define PM_DDR_TRAN_SR_EXIT	1U
+
 /* DDR transition table (from which to which state DDR can transit) */
-static const PmStateTran pmDdrTransitions[] = {
-	{
+static PmStateTran pmDdrTransitions[] = {
+	[PM_DDR_TRAN_SR_ENTER] = {
 		.fromState = PM_DDR_STATE_ON,
 		.toState = PM_DDR_STATE_SR,
 		.latency = PM_DEFAULT_LATENCY,
-	}, {
+	},
+	[PM_DDR_TRAN_SR_EXIT] = {
 		.fromState = PM_DDR_STATE_SR,
 		.toState = PM_DDR_STATE_ON,
 		.latency = PM_DEFAULT_LATENCY,
@@ -632,6 +649,43 @@ static PmRegisterContext ctx_ddrphy_zqdata[] __attribute__((__section__(".srdata
 	{ },
 };
 
+#ifdef ENABLE_DDR_SR_FAST_EXIT
+/* Per-lane delay line settings found by data training */
+#define DDRPHY_TRAIN_CTX(n)				\
+	{ .addr = DDRPHY_DXBDLR((n), 0U), },		\
+	{ .addr = DDRPHY_DXBDLR((n), 1U), },		\
+	{ .addr = DDRPHY_DXBDLR((n), 2U), },		\
+	{ .addr = DDRPHY_DXBDLR((n), 4U), },		\
+	{ .addr = DDRPHY_DXBDLR((n), 5U), },		\
+	{ .addr = DDRPHY_DXBDLR((n), 6U), },		\
+	{ .addr = DDRPHY_DXBDLR((n), 8U), },		\
+	{ .addr = DDRPHY_DXLCDLR((n), 0U), },		\
+	{ .addr = DDRPHY_DXLCDLR((n), 1U), },		\
+	{ .addr = DDRPHY_DXLCDLR((n), 2U), },		\
+	{ .addr = DDRPHY_DXLCDLR((n), 3U), },		\
+	{ .addr = DDRPHY_DXLCDLR((n), 4U), },		\
+	{ .addr = DDRPHY_DXLCDLR((n), 5U), },		\
+	{ .addr = DDRPHY_DXGTR0(n), }
+
+static PmRegisterContext ctx_ddrphy_train[] __attribute__((__section__(".srdata"))) = {
+	DDRPHY_TRAIN_CTX(0U),
+	DDRPHY_TRAIN_CTX(1U),
+	DDRPHY_TRAIN_CTX(2U),
+	DDRPHY_TRAIN_CTX(3U),
+	DDRPHY_TRAIN_CTX(4U),
+	DDRPHY_TRAIN_CTX(5U),
+	DDRPHY_TRAIN_CTX(6U),
+	DDRPHY_TRAIN_CTX(7U),
+	DDRPHY_TRAIN_CTX(8U),
+	{ },
+};
+
+/* DDR clock setup for which the stored training results are valid */
+static u32 ddr_train_dpll __attribute__((__section__(".srdata")));
+static u32 ddr_train_clk __attribute__((__section__(".srdata")));
+static bool ddr_train_valid __attribute__((__section__(".srdata")));
+#endif
+
 static void ddr_disable_wr_drift(void)
 {
 	u32 r;
@@ -882,15 +936,43 @@ static bool ddrc_opmode_is_sr(void)
 	return ddrc_opmode_is(DDRC_STAT_OPMODE_SR);
 }
 
+/**
+ * ddrc_poll_stat() - Poll for a field of DDRC status register to get a value
+ * @mask	Mask of the field in question
+ * @val		Value to be reached (already shifted into the field position)
+ * @timeout	Maximum number of polls
+ *
+ * @return	XST_SUCCESS if the value is reached, XST_FAILURE on timeout
+ */
+static int ddrc_poll_stat(const u32 mask, const u32 val, u32 timeout)
+{
+	int status = XST_FAILURE;
+
+	while (timeout > 0U) {
+		if (val == (Xil_In32(DDRC_STAT) & mask)) {
+			status = XST_SUCCESS;
+			break;
+		}
+		timeout--;
+	}
+
+	return status;
+}
+
 static int ddrc_enable_sr(void)
 {
 	u32 r;
 	size_t i;
+	int status;
 
 	/* disable AXI ports */
 	for (i = 0U; i < 6U; i++) {
-		while (Xil_In32(DDRC_PSTAT) & DDRC_PSTAT_PORT_BUSY(i))
-			;
+		status = XPfw_UtilPollForZero(DDRC_PSTAT,
+					      DDRC_PSTAT_PORT_BUSY(i),
+					      PM_DDR_SR_POLL_PERIOD);
+		if (XST_SUCCESS != status) {
+			goto done;
+		}
 		r = Xil_In32(DDRC_PCTRL(i));
 		r &= ~DDRC_PCTRL_PORT_EN;
 		Xil_Out32(DDRC_PCTRL(i), r);
@@ -901,13 +983,39 @@ static int ddrc_enable_sr(void)
 	r |= DDRC_PWRCTL_SR_SW;
 	Xil_Out32(DDRC_PWRCTL, r);
 
-	while (true != ddrc_opmode_is_sr())
-		;
+	status = ddrc_poll_stat(DDRC_STAT_OPMODE_MASK,
+				DDRC_STAT_OPMODE_SR << DDRC_STAT_OPMODE_SHIFT,
+				PM_DDR_SR_POLL_PERIOD);
+	if (XST_SUCCESS != status) {
+		goto done;
+	}
 
-	while ((Xil_In32(DDRC_STAT) & (3U << 4U)) != (2U << 4U))
-		;
+	/* wait for self-refresh entered by software */
+	status = ddrc_poll_stat(3U << 4U, 2U << 4U, PM_DDR_SR_POLL_PERIOD);
 
-	return XST_SUCCESS;
+done:
+	if (XST_SUCCESS != status) {
+		PmDbg(DEBUG_DETAILED, "ERROR: Self-refresh entry timeout\r\n");
+	}
+	return status;
+}
+
+static u32 ddr_timer_start(void)
+{
+	if (PM_DDR_PIT_EN_RELOAD != Xil_In32(PM_DDR_PIT_CONTROL)) {
+		Xil_Out32(PM_DDR_PIT_PRELOAD, ~0U);
+		Xil_Out32(PM_DDR_PIT_CONTROL, PM_DDR_PIT_EN_RELOAD);
+	}
+
+	return Xil_In32(PM_DDR_PIT_COUNTER);
+}
+
+static u32 ddr_timer_elapsed_us(const u32 start)
+{
+	/* PIT counts down, unsigned subtraction covers the reload */
+	u32 ticks = start - Xil_In32(PM_DDR_PIT_COUNTER);
+
+	return (ticks + PM_DDR_PIT_TICKS_PER_US - 1U) / PM_DDR_PIT_TICKS_PER_US;
 }
 
 static void ddr_clock_enable(void)
@@ -967,6 +1075,46 @@ static void restore_state(PmRegisterContext *context)
 	}
 }
 
+static void ddr_store_training(void)
+{
+#ifdef ENABLE_DDR_SR_FAST_EXIT
+	store_state(ctx_ddrphy_train);
+	ddr_train_dpll = Xil_In32(CRF_APB_DPLL_CTRL);
+	ddr_train_clk = Xil_In32(CRF_APB_DDR_CTRL);
+	ddr_train_valid = true;
+#endif
+}
+
+/**
+ * ddr_restore_training() - Restore stored data training results
+ *
+ * @return	True if the results are restored and retraining can be skipped,
+ *		false if the DRAM has to be retrained
+ *
+ * @note	Results are only reused if the DDR clock is configured exactly
+ *		as it was when they were stored.
+ */
+static bool ddr_restore_training(void)
+{
+	bool restored = false;
+
+#ifdef ENABLE_DDR_SR_FAST_EXIT
+	if ((true == ddr_train_valid) &&
+	    (ddr_train_dpll == Xil_In32(CRF_APB_DPLL_CTRL)) &&
+	    (ddr_train_clk == Xil_In32(CRF_APB_DDR_CTRL))) {
+		/* keep VT compensation off while delay lines are written */
+		XPfw_UtilRMW(DDRPHY_PGCR(6U), DDRPHY_PGCR6_INHVT,
+			     DDRPHY_PGCR6_INHVT);
+		restore_state(ctx_ddrphy_train);
+		XPfw_UtilRMW(DDRPHY_PGCR(6U), DDRPHY_PGCR6_INHVT, 0U);
+		restored = true;
+	}
+	ddr_train_valid = false;
+#endif
+
+	return restored;
+}
+
 static void restore_ddrphy_zqdata(PmRegisterContext *context)
 {
 	while (context->addr) {
@@ -1290,18 +1438,17 @@ static void DDR_reinit(bool ddrss_is_reset)
 	}
 
 	Xil_Out32(DDRC_PWRCTL, 0U);
-	do {
-		readVal = Xil_In32(DDRC_STAT);
-		readVal &= 3U << 4U;
-	} while (readVal);
+	status = ddrc_poll_stat(3U << 4U, 0U, PM_DDR_SR_POLL_PERIOD);
+	REPORT_IF_ERROR(status);
 
-	do {
-		readVal = Xil_In32(DDRC_STAT);
-		readVal &= DDRC_STAT_OPMODE_MASK;
-		readVal >>= DDRC_STAT_OPMODE_SHIFT;
-	} while (readVal != DDRC_STAT_OPMODE_NORMAL);
+	status = ddrc_poll_stat(DDRC_STAT_OPMODE_MASK,
+				DDRC_STAT_OPMODE_NORMAL << DDRC_STAT_OPMODE_SHIFT,
+				PM_DDR_SR_POLL_PERIOD);
+	REPORT_IF_ERROR(status);
 
-	if (true == ddrss_is_reset) {
+	if ((true == ddrss_is_reset) && (true == ddr_restore_training())) {
+		/* training results are restored, no need to retrain */
+	} else if (true == ddrss_is_reset) {
 		readVal = Xil_In32(DDRC_MSTR) & DDRC_MSTR_DDR_TYPE;
 		if (readVal == DDRC_MSTR_LPDDR3 ) {
 			Xil_Out32(DDRPHY_PIR, DDRPHY_PIR_CTLDINIT |
@@ -1469,8 +1616,10 @@ static void DDR_reinit(bool ddrss_is_reset)
 
 		/* enable AXI ports */
 		for (i = 0U; i < 6U; i++) {
-			while (Xil_In32(DDRC_PSTAT) & DDRC_PSTAT_PORT_BUSY(i))
-				;
+			status = XPfw_UtilPollForZero(DDRC_PSTAT,
+						      DDRC_PSTAT_PORT_BUSY(i),
+						      PM_DDR_POLL_PERIOD);
+			REPORT_IF_ERROR(status);
 			readVal = Xil_In32(DDRC_PCTRL(i));
 			readVal |= DDRC_PCTRL_PORT_EN;
 			Xil_Out32(DDRC_PCTRL(i), readVal);
@@ -1631,6 +1780,7 @@ static void restore_training_data()
 
 static int pm_ddr_sr_enter(void)
 {
+	u32 start = ddr_timer_start();
 	int ret;
 
 	store_training_data();
@@ -1646,18 +1796,24 @@ static int pm_ddr_sr_enter(void)
 	store_state(ctx_ddrc);
 	store_state(ctx_ddrphy);
 	store_state(ctx_ddrphy_zqdata);
+	ddr_store_training();
 
 	ret = ddrc_enable_sr();
 	if (XST_SUCCESS != ret) {
 		goto err;
 	}
 
+	pmDdrTransitions[PM_DDR_TRAN_SR_ENTER].latency =
+		ddr_timer_elapsed_us(start);
+
 err:
 	return ret;
 }
 
 static int pm_ddr_sr_exit(bool ddrss_is_reset)
 {
+	u32 start = ddr_timer_start();
+
 	if (true == ddrss_is_reset) {
 		u32 readVal;
 
@@ -1678,6 +1834,9 @@ static int pm_ddr_sr_exit(bool ddrss_is_reset)
 
 	restore_training_data();
 
+	pmDdrTransitions[PM_DDR_TRAN_SR_EXIT].latency =
+		ddr_timer_elapsed_us(start);
+
 	return XST_SUCCESS;
 }
 
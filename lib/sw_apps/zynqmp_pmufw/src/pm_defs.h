@@ -133,8 +133,20 @@
 
 #define PM_SECURE_IMAGE			45U
 
+#define PM_SET_REQUIREMENTS		46U
+#define PM_PLL_CHANGE_RATE		47U
+
 #define PM_API_MIN	PM_GET_API_VERSION
-#define PM_API_MAX	PM_SECURE_IMAGE
+#define PM_API_MAX	PM_PLL_CHANGE_RATE
+
+/*
+ * PM_SET_REQUIREMENTS carries up to PM_REQ_BATCH_MAX (node, capabilities, qos)
+ * tuples, each packed into one argument. An argument of 0 is an unused tuple.
+ */
+#define PM_REQ_BATCH_MAX		4U
+#define PM_REQ_BATCH_NODE(arg)		((arg) & 0xFFU)
+#define PM_REQ_BATCH_CAPS(arg)		(((arg) >> 8U) & 0xFFU)
+#define PM_REQ_BATCH_QOS(arg)		(((arg) >> 16U) & 0xFFU)
 
 /* PM API callback ids */
 #define PM_INIT_SUSPEND_CB      30U
@@ -242,12 +254,14 @@
 
 /* State arguments of the self suspend (master specific) */
 #define PM_APU_STATE_CPU_IDLE           0x0U
+#define PM_APU_STATE_CPU_FAST_IDLE      0x1U
 #define PM_APU_STATE_SUSPEND_TO_RAM     0xFU
 
 /* Operating characteristics type */
 #define PM_OPCHAR_TYPE_POWER    1U
 #define PM_OPCHAR_TYPE_TEMP     2U
 #define PM_OPCHAR_TYPE_LATENCY  3U
+#define PM_OPCHAR_TYPE_SUSPEND_LATENCY  4U
 
 /* PM events */
 #define EVENT_NONE              0U
@@ -123,6 +123,7 @@ static int PmApuEvaluateState(const u32 state)
 
 	switch (state) {
 	case PM_APU_STATE_CPU_IDLE:
+	case PM_APU_STATE_CPU_FAST_IDLE:
 		status = XST_SUCCESS;
 		break;
 	case PM_APU_STATE_SUSPEND_TO_RAM:
@@ -50,6 +50,10 @@
 /* Masks of bitfields in PLL's control register */
 #define PM_PLL_CTRL_RESET_MASK	0x1U
 #define PM_PLL_CTRL_BYPASS_MASK	0x8U
+#define PM_PLL_CTRL_FBDIV_MASK	CRF_APB_APLL_CTRL_FBDIV_MASK
+#define PM_PLL_CTRL_FBDIV_SHIFT	CRF_APB_APLL_CTRL_FBDIV_SHIFT
+#define PM_PLL_CTRL_DIV2_MASK	CRF_APB_APLL_CTRL_DIV2_MASK
+#define PM_PLL_CTRL_RATE_MASK	(PM_PLL_CTRL_FBDIV_MASK | PM_PLL_CTRL_DIV2_MASK)
 
 /* Configurable: timeout period when waiting for PLL to lock */
 #define PM_PLL_LOCK_TIMEOUT	0x10000U
@@ -452,6 +456,97 @@ int PmPllRequest(PmPll* const pll)
 	return status;
 }
 
+/**
+ * PmPllGetMult() - Get the output multiplier of a PLL
+ * @pll		PLL whose multiplier is read
+ *
+ * @return	Twice the multiplier of the PLL reference clock (FBDIV, doubled
+ *		unless the output is divided by 2), or 0 if the PLL output is
+ *		not driven by a locked VCO
+ *
+ * @note	All PLLs are assumed to use the same reference clock.
+ */
+u32 PmPllGetMult(const PmPll* const pll)
+{
+	u32 ctrl;
+	u32 mult = 0U;
+
+	if (PM_PLL_STATE_LOCKED != pll->node.currState) {
+		goto done;
+	}
+
+	ctrl = XPfw_Read32(pll->addr + PM_PLL_CTRL_OFFSET);
+	if (0U != (ctrl & (PM_PLL_CTRL_RESET_MASK | PM_PLL_CTRL_BYPASS_MASK))) {
+		goto done;
+	}
+
+	mult = (ctrl & PM_PLL_CTRL_FBDIV_MASK) >> PM_PLL_CTRL_FBDIV_SHIFT;
+	if (0U == (ctrl & PM_PLL_CTRL_DIV2_MASK)) {
+		mult *= 2U;
+	}
+
+done:
+	return mult;
+}
+
+/**
+ * PmPllReprogram() - Relock a PLL with new frequency parameters
+ * @pll		PLL to reprogram
+ * @ctrl	New FBDIV and DIV2 bitfields of the control register, other
+ *		bits are ignored
+ * @cfg		New value of the configuration register
+ * @frac	New value of the fractional control register
+ *
+ * @return	XST_SUCCESS if the PLL locked with the new parameters, otherwise
+ *		XST_FAILURE and the PLL is left in reset
+ *
+ * @note	Clocks driven by the PLL run from the reference clock while the
+ *		PLL is bypassed, so the caller should move them away first.
+ *		If the PLL is suspended only its saved context is updated.
+ */
+int PmPllReprogram(PmPll* const pll, const u32 ctrl, const u32 cfg,
+		   const u32 frac)
+{
+	int status = XST_SUCCESS;
+	u32 val;
+
+	if (true == pll->context.saved) {
+		pll->context.ctrl &= ~PM_PLL_CTRL_RATE_MASK;
+		pll->context.ctrl |= ctrl & PM_PLL_CTRL_RATE_MASK;
+		pll->context.cfg = cfg;
+		pll->context.frac = frac;
+		goto done;
+	}
+
+	/* Change the parameters with bypass and reset asserted */
+	PmPllBypassAndReset(pll);
+	PmNodeUpdateCurrState(&pll->node, PM_PLL_STATE_RESET);
+	val = XPfw_Read32(pll->addr + PM_PLL_CTRL_OFFSET);
+	val &= ~PM_PLL_CTRL_RATE_MASK;
+	val |= ctrl & PM_PLL_CTRL_RATE_MASK;
+	XPfw_Write32(pll->addr + PM_PLL_CTRL_OFFSET, val);
+	XPfw_Write32(pll->addr + PM_PLL_CFG_OFFSET, cfg);
+	XPfw_Write32(pll->addr + PM_PLL_FRAC_OFFSET, frac);
+
+	/* Release reset and poll for the lock */
+	XPfw_RMW32(pll->addr + PM_PLL_CTRL_OFFSET, PM_PLL_CTRL_RESET_MASK,
+		   ~PM_PLL_CTRL_RESET_MASK);
+	status = XPfw_UtilPollForMask(pll->statusAddr, pll->lockMask,
+				      PM_PLL_LOCK_TIMEOUT);
+	if (XST_SUCCESS != status) {
+		XPfw_RMW32(pll->addr + PM_PLL_CTRL_OFFSET,
+			   PM_PLL_CTRL_RESET_MASK, PM_PLL_CTRL_RESET_MASK);
+		goto done;
+	}
+
+	XPfw_RMW32(pll->addr + PM_PLL_CTRL_OFFSET, PM_PLL_CTRL_BYPASS_MASK,
+		   ~PM_PLL_CTRL_BYPASS_MASK);
+	PmNodeUpdateCurrState(&pll->node, PM_PLL_STATE_LOCKED);
+
+done:
+	return status;
+}
+
 /**
  * PmPllRequest() - Release the PLL (if PLL becomes unused, it will be reset)
  * @pll		The released PLL
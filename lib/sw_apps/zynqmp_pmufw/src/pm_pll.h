@@ -114,5 +114,8 @@ extern PmNodeClass pmNodeClassPll_g;
  ********************************************************************/
 int PmPllRequest(PmPll* const pll);
 void PmPllRelease(PmPll* const pll);
+u32 PmPllGetMult(const PmPll* const pll);
+int PmPllReprogram(PmPll* const pll, const u32 ctrl, const u32 cfg,
+		   const u32 frac);
 
 #endif
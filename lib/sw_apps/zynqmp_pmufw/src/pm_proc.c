@@ -371,6 +371,12 @@ static int PmProcWake(PmProc* const proc)
 {
 	int status;
 
+	if (true == proc->fastIdle) {
+		/* Power parent and clocks were kept requested while idle */
+		proc->fastIdle = false;
+		goto wake;
+	}
+
 	if (NULL != proc->node.parent) {
 		status = PmPowerRequestParent(&proc->node);
 		if (XST_SUCCESS != status) {
@@ -381,6 +387,7 @@ static int PmProcWake(PmProc* const proc)
 		PmClockRequest(&proc->node);
 	}
 
+wake:
 	proc->restoreResumeAddr(proc);
 	status = proc->wake();
 
@@ -418,6 +425,36 @@ done:
 	return status;
 }
 
+/**
+ * PmProcReleaseFastIdle() - Release power parents and clocks kept by the
+ *                           processors of a master which are in fast idle
+ * @master  Master whose last awake processor is going to sleep
+ *
+ * @note    Once the whole master suspends, its processors must not keep the
+ *          power islands and clocks on. A processor woken up afterwards takes
+ *          the regular wake path and requests them again.
+ */
+static void PmProcReleaseFastIdle(const PmMaster* const master)
+{
+	u32 i;
+
+	for (i = 0U; i < master->procsCnt; i++) {
+		PmProc* const proc = master->procs[i];
+
+		if ((false == proc->fastIdle) ||
+		    (PM_PROC_STATE_SLEEP != proc->node.currState)) {
+			continue;
+		}
+		if (NULL != proc->node.parent) {
+			PmPowerReleaseParent(&proc->node);
+		}
+		if (NULL != proc->node.clocks) {
+			PmClockRelease(&proc->node);
+		}
+		proc->fastIdle = false;
+	}
+}
+
 /**
  * PmProcTrActiveToSuspend() - FSM transition from active to suspend state
  * @proc    Pointer to processor whose FSM is changing state
@@ -472,6 +509,8 @@ static int PmProcTrToForcedOff(PmProc* const proc)
 
 	proc->node.latencyMarg = MAX_LATENCY;
 	proc->resumeAddress = 0ULL;
+	/* In fast idle the parent and clocks are still held, release them */
+	proc->fastIdle = false;
 	status = PmProcSleep(proc);
 	PmNodeUpdateCurrState(&proc->node, PM_PROC_STATE_FORCEDOFF);
 	PmProcDisableEvents(proc);
@@ -512,6 +551,7 @@ static int PmProcTrSuspendToActive(PmProc* const proc)
 			PmStrNode(proc->node.nodeId));
 
 	DISABLE_WFI(proc->wfiEnableMask);
+	proc->fastIdle = false;
 
 	/* Notify master to cancel scheduled requests */
 	status = PmMasterFsm(proc->master, PM_MASTER_EVENT_ABORT_SUSPEND);
@@ -528,6 +568,10 @@ static int PmProcTrSuspendToActive(PmProc* const proc)
  *
  * @note    Processor had previously called self suspend and now PMU has
  *          received processor's wfi interrupt.
+ *          In fast idle only the core is power gated, its power parent,
+ *          clocks and the master are left as they are. Fast idle applies only
+ *          while other processors of the master are awake, otherwise the
+ *          regular suspend is performed.
  */
 static int PmProcTrSuspendToSleep(PmProc* const proc)
 {
@@ -538,6 +582,20 @@ static int PmProcTrSuspendToSleep(PmProc* const proc)
 			PmStrNode(proc->node.nodeId));
 	proc->node.latencyMarg = proc->latencyReq - worstCaseLatency;
 
+	if ((true == proc->fastIdle) &&
+	    (PM_MASTER_STATE_ACTIVE == proc->master->state)) {
+		status = proc->sleep();
+		if (XST_SUCCESS == status) {
+			PmNodeUpdateCurrState(&proc->node, PM_PROC_STATE_SLEEP);
+		}
+		goto done;
+	}
+
+	proc->fastIdle = false;
+	if (PM_MASTER_STATE_SUSPENDING == proc->master->state) {
+		PmProcReleaseFastIdle(proc->master);
+	}
+
 	status = PmProcSleep(proc);
 	if (XST_SUCCESS == status) {
 		PmNodeUpdateCurrState(&proc->node, PM_PROC_STATE_SLEEP);
@@ -550,6 +608,8 @@ static int PmProcTrSuspendToSleep(PmProc* const proc)
 			proc->master->wakeProc = proc;
 		}
 	}
+
+done:
 	DISABLE_WFI(proc->wfiEnableMask);
 	ENABLE_WAKE(proc->wakeEnableMask);
 
@@ -116,6 +116,8 @@ typedef struct PmProc PmProc;
  * @latencyReq      Latenct requirement as passed in by self_suspend argument
  * @pwrDnLatency    Latency (in us) for transition to OFF state
  * @pwrUpLatency    Latency (in us) for transition to ON state
+ * @fastIdle        Processor suspends to fast idle, it is power gated but
+ *                  its power parent and clocks remain requested
  */
 typedef struct PmProc {
 	PmNode node;
@@ -136,6 +138,7 @@ typedef struct PmProc {
 	u32 latencyReq;
 	const u32 pwrDnLatency;
 	const u32 pwrUpLatency;
+	bool fastIdle;
 } PmProc;
 
 /*********************************************************************
@@ -604,6 +604,39 @@ done:
 	return status;
 }
 
+/**
+ * PmSlaveGetSuspendLatency() - Get latency of putting the slave into the
+ *				lowest power state that keeps its context
+ * @slave	Slave node
+ * @lat		Pointer to the location where the latency value should be stored
+ *
+ * @return	XST_SUCCESS if latency value is stored in *lat, XST_NO_FEATURE
+ *		if the slave has no such transition from its highest state
+ */
+int PmSlaveGetSuspendLatency(const PmSlave* const slave, u32* const lat)
+{
+	PmStateId highestState = slave->slvFsm->statesCnt - 1;
+	PmStateId lowestState = highestState;
+	int status = XST_NO_FEATURE;
+	u32 i;
+
+	for (i = 0U; i < slave->slvFsm->transCnt; i++) {
+		const PmStateTran* const tran = &slave->slvFsm->trans[i];
+
+		if ((highestState != tran->fromState) ||
+		    (tran->toState >= lowestState) ||
+		    (0U == (PM_CAP_CONTEXT &
+			    slave->slvFsm->states[tran->toState]))) {
+			continue;
+		}
+		lowestState = tran->toState;
+		*lat = tran->latency;
+		status = XST_SUCCESS;
+	}
+
+	return status;
+}
+
 /**
  * PmSlaveClearConfig() - Clear configuration of the slave node
  * @slaveNode	Slave node to clear
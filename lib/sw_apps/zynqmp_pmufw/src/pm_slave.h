@@ -90,7 +90,7 @@ typedef struct PmWakeEvent {
  * @toState     To which state the transition is taken
  */
 typedef struct {
-	const u32 latency;
+	u32 latency;
 	PmStateId fromState;
 	PmStateId toState;
 } PmStateTran;
@@ -163,6 +163,7 @@ u32 PmSlaveGetUsageStatus(const PmSlave* const slave,
 			  const PmMaster* const master);
 u32 PmSlaveGetRequirements(const PmSlave* const slave,
 			   const PmMaster* const master);
+int PmSlaveGetSuspendLatency(const PmSlave* const slave, u32* const lat);
 void PmResetSlaveStates(void);
 
 #endif
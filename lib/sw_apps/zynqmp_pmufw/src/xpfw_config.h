@@ -82,6 +82,10 @@
  * 	- ENABLE_SAFETY : Enables CRC calculation for IPI messages
  * 	- ENABLE_FPGA_LOAD : Enables FPGA bit stream loading feature
  * 	- ENABLE_SECURE : Enables security features
+ * 	- ENABLE_DVFS : Enables load hint and sysmon based CPU clock scaling,
+ * 	                requires ENABLE_SCHEDULER
+ * 	- ENABLE_DDR_SR_FAST_EXIT : Enables reuse of DDR PHY training results
+ * 	                            on DDR self-refresh exit
  * 	- XPU_INTR_DEBUG_PRINT_ENABLE : Enables debug for XMPU/XPPU functionality
  *
  * 	- DEBUG_CLK : Enables dumping clock and PLL state functions
@@ -113,6 +117,8 @@
 #define	ENABLE_SAFETY_VAL				(0U)
 #define	ENABLE_FPGA_LOAD_VAL			(1U)
 #define	ENABLE_SECURE_VAL				(1U)
+#define	ENABLE_DVFS_VAL					(0U)
+#define	ENABLE_DDR_SR_FAST_EXIT_VAL		(0U)
 #define	XPU_INTR_DEBUG_PRINT_ENABLE_VAL	(0U)
 
 #define	DEBUG_CLK_VAL					(0U)
@@ -167,6 +173,12 @@
 #if ENABLE_SAFETY_VAL
 #define ENABLE_SAFETY
 #endif
+#if ENABLE_DVFS_VAL
+#define ENABLE_DVFS
+#endif
+#if ENABLE_DDR_SR_FAST_EXIT_VAL
+#define ENABLE_DDR_SR_FAST_EXIT
+#endif
 
 #if XPU_INTR_DEBUG_PRINT_ENABLE_VAL
 #define XPU_INTR_DEBUG_PRINT_ENABLE
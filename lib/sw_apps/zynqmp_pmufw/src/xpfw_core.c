@@ -62,6 +62,10 @@ XStatus XPfw_CoreInit(u32 Options)
 
 	CorePtr->ModCount = (u8)0U;
 
+	for (Index = 0U; Index < ARRAYSIZE(CorePtr->IpiIdTable); Index++) {
+		CorePtr->IpiIdTable[Index] = (u8)XPFW_IPI_ID_UNUSED;
+	}
+
 	for (Index = 0U; Index < ARRAYSIZE(CorePtr->ModList); Index++) {
 		Status = XPfw_ModuleInit(&CorePtr->ModList[Index], (u8) 0U);
 		/* If there was an error, then just get out of here */
@@ -153,7 +157,9 @@ XStatus XPfw_CoreDispatchIpi(u32 IpiNum, u32 SrcMask)
 	u32 Idx;
 	u32 MaskIndex;
 	u32 CallCount = 0U;
-	u32 Payload[XPFW_IPI_MAX_MSG_LEN];
+	u32 IpiId;
+	u8 Entry;
+	const u32 *Payload = NULL;
 
 	if ((CorePtr == NULL) || (IpiNum > 3U)) {
 		Status = XST_FAILURE;
@@ -164,18 +170,46 @@ XStatus XPfw_CoreDispatchIpi(u32 IpiNum, u32 SrcMask)
 	for (MaskIndex = 0U; MaskIndex < XPFW_IPI_MASK_COUNT; MaskIndex++) {
 		/* Check if the Mask is set */
 		if ((SrcMask & IpiMaskList[MaskIndex]) != 0U) {
-			/* If set, read the message into buffer */
-			Status = XPfw_IpiReadMessage(IpiMaskList[MaskIndex],
-						&Payload[0], XPFW_IPI_MAX_MSG_LEN);
+			/* If set, get the message in place from the IPI buffer */
+			Status = XPfw_IpiGetMessagePtr(MaskIndex, &Payload);
+			if (Payload == NULL) {
+				continue;
+			}
+
+			/* Look up the module by IPI ID (MSB 16 bits of Word-0) */
+			IpiId = Payload[0] >> 16;
+			if (IpiId < XPFW_IPI_ID_TABLE_SIZE) {
+				Entry = CorePtr->IpiIdTable[IpiId];
+			} else {
+				Entry = (u8)XPFW_IPI_ID_SHARED;
+			}
+
+			if (Entry == (u8)XPFW_IPI_ID_UNUSED) {
+				continue;
+			}
+
+			if (Entry != (u8)XPFW_IPI_ID_SHARED) {
+				Idx = (u32)Entry - 1U;
+				if ((CorePtr->ModList[Idx].IpiId == IpiId) &&
+					(CorePtr->ModList[Idx].IpiHandler != NULL)) {
+					/* Call the module's IPI handler */
+					CorePtr->ModList[Idx].IpiHandler(&CorePtr->ModList[Idx],
+							IpiNum, IpiMaskList[MaskIndex],
+							Payload, XPFW_IPI_MAX_MSG_LEN);
+					CallCount++;
+					continue;
+				}
+			}
+
 			/* Dispatch based on IPI ID (MSB 16 bits of Word-0) of the module */
 			for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
 				/* If API ID matches and IpiHandler is set */
-				if ( (CorePtr->ModList[Idx].IpiId == (Payload[0] >> 16)) &&
+				if ( (CorePtr->ModList[Idx].IpiId == IpiId) &&
 					(CorePtr->ModList[Idx].IpiHandler != NULL)) {
 					/* Call the module's IPI handler */
 					CorePtr->ModList[Idx].IpiHandler(&CorePtr->ModList[Idx],
 							IpiNum, IpiMaskList[MaskIndex],
-							&Payload[0], XPFW_IPI_MAX_MSG_LEN);
+							Payload, XPFW_IPI_MAX_MSG_LEN);
 					CallCount++;
 				}
 			}
@@ -227,6 +261,21 @@ XStatus XPfw_CoreScheduleTask(const XPfw_Module_t *ModPtr, u32 Interval,
 	return Status;
 }
 
+XStatus XPfw_CoreScheduleOneShotTask(const XPfw_Module_t *ModPtr, u32 Delay,
+		VoidFunction_t CallbackRef)
+{
+	XStatus Status;
+
+	if ((ModPtr != NULL) && (CorePtr != NULL)) {
+		Status = XPfw_SchedulerAddOneShotTask(&CorePtr->Scheduler,
+				ModPtr->ModId, Delay, CallbackRef);
+	} else {
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
 s32 XPfw_CoreRemoveTask(const XPfw_Module_t *ModPtr, u32 Interval,
 		VoidFunction_t CallbackRef)
 {
@@ -396,10 +445,21 @@ XStatus XPfw_CoreSetEventHandler(const XPfw_Module_t *ModPtr, XPfwModEventHandle
 XStatus XPfw_CoreSetIpiHandler(const XPfw_Module_t *ModPtr, XPfwModIpiHandler_t IpiHandlerFn, u16 IpiId)
 {
 	XStatus Status;
+	u8 Entry;
 	if ((ModPtr != NULL) && (CorePtr != NULL)) {
 		if (ModPtr->ModId < CorePtr->ModCount) {
 			CorePtr->ModList[ModPtr->ModId].IpiHandler = IpiHandlerFn;
 			CorePtr->ModList[ModPtr->ModId].IpiId = IpiId;
+			if (IpiId < XPFW_IPI_ID_TABLE_SIZE) {
+				Entry = CorePtr->IpiIdTable[IpiId];
+				if ((Entry == (u8)XPFW_IPI_ID_UNUSED) ||
+				    (Entry == (ModPtr->ModId + 1U))) {
+					CorePtr->IpiIdTable[IpiId] = ModPtr->ModId + 1U;
+				} else {
+					/* More modules share the ID, scan for them */
+					CorePtr->IpiIdTable[IpiId] = (u8)XPFW_IPI_ID_SHARED;
+				}
+			}
 			Status = XST_SUCCESS;
 		} else {
 			Status = XST_FAILURE;
@@ -39,12 +39,21 @@
 
 #define XPFW_MAX_MOD_COUNT 32U
 
+/*
+ * IPI IDs below XPFW_IPI_ID_TABLE_SIZE are dispatched through a lookup table,
+ * others by scanning the module list. A table entry holds the module index
+ * incremented by one, or one of the values below.
+ */
+#define XPFW_IPI_ID_TABLE_SIZE	16U
+#define XPFW_IPI_ID_UNUSED	0U
+#define XPFW_IPI_ID_SHARED	0xFFU
 
 
 typedef struct {
 	XPfw_Module_t ModList[XPFW_MAX_MOD_COUNT];
 	XPfw_Scheduler_t Scheduler;
 	u8 ModCount;
+	u8 IpiIdTable[XPFW_IPI_ID_TABLE_SIZE]; /**< IPI ID to module lookup */
 	u32 IsReady;
 	u8 Mode;	/**< Mode - Safety Diagnostics Mode / Normal Mode */
 } XPfw_Core_t;
@@ -54,6 +63,7 @@ XStatus XPfw_CoreConfigure(void);
 XStatus XPfw_CoreDispatchEvent( u32 EventId);
 const XPfw_Module_t *XPfw_CoreCreateMod(void);
 XStatus XPfw_CoreScheduleTask(const XPfw_Module_t *ModPtr, u32 Interval, VoidFunction_t CallbackRef);
+XStatus XPfw_CoreScheduleOneShotTask(const XPfw_Module_t *ModPtr, u32 Delay, VoidFunction_t CallbackRef);
 s32 XPfw_CoreRemoveTask(const XPfw_Module_t *ModPtr, u32 Interval, VoidFunction_t CallbackRef);
 XStatus XPfw_CoreStopScheduler(void);
 XStatus XPfw_CoreLoop(void);
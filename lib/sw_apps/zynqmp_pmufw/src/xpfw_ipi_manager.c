@@ -48,6 +48,9 @@ static XIpiPsu *Ipi0InstPtr = &Ipi0Inst;
 static XIpiPsu *Ipi1InstPtr = &Ipi1Inst;
 u32 IpiMaskList[XPFW_IPI_MASK_COUNT] = {0U};
 
+/* IPI-0 message buffers of the sources in IpiMaskList, NULL if none */
+static const u32 *IpiMsgBufList[XPFW_IPI_MASK_COUNT];
+
 #ifdef ENABLE_SAFETY
 #define XPFW_IPI_W0_TO_W6_SIZE 7U
 #endif
@@ -77,6 +80,23 @@ s32 XPfw_IpiManagerInit(void)
 		IpiMaskList[i] = Ipi0CfgPtr->TargetList[i].Mask;
 	}
 
+	/*
+	 * Resolve the message buffer of each source once, so that messages
+	 * can be read in place without looking up the buffer index every time
+	 */
+	for (i = 0U; i < XPFW_IPI_MASK_COUNT; i++) {
+		if ((Ipi0CfgPtr->TargetList[i].BufferIndex > XIPIPSU_MAX_BUFF_INDEX) ||
+		    (Ipi0CfgPtr->BufferIndex > XIPIPSU_MAX_BUFF_INDEX)) {
+			IpiMsgBufList[i] = NULL;
+		} else {
+			IpiMsgBufList[i] = (const u32 *)(XIPIPSU_MSG_RAM_BASE +
+				(Ipi0CfgPtr->TargetList[i].BufferIndex *
+				 XIPIPSU_BUFFER_OFFSET_GROUP) +
+				(Ipi0CfgPtr->BufferIndex *
+				 XIPIPSU_BUFFER_OFFSET_TARGET));
+		}
+	}
+
 	/* Initialize the Instance pointer of IPI-0 channel */
 	Status = XIpiPsu_CfgInitialize(Ipi0InstPtr, Ipi0CfgPtr,
 			Ipi0CfgPtr->BaseAddress);
@@ -203,6 +223,35 @@ Done:
 	return Status;
 }
 
+s32 XPfw_IpiGetMessagePtr(u32 MaskIndex, const u32 **MsgPtr)
+{
+	s32 Status = XST_FAILURE;
+
+	if ((MsgPtr == NULL) || (MaskIndex >= XPFW_IPI_MASK_COUNT) ||
+	    (IpiMsgBufList[MaskIndex] == NULL)) {
+		Status = XST_FAILURE;
+		goto Done;
+	}
+
+	*MsgPtr = IpiMsgBufList[MaskIndex];
+	Status = XST_SUCCESS;
+
+#ifdef ENABLE_SAFETY
+	/*
+	 * Note : The last word in IPI Msg is reserved for CRC.
+	 * Compute the CRC over the buffer and compare.
+	 * This is only for safety applications.
+	 */
+	if ((*MsgPtr)[7] != XPfw_CalculateCRC((u32)*MsgPtr,
+				XPFW_IPI_W0_TO_W6_SIZE)) {
+		Status = XST_FAILURE;
+	}
+#endif
+
+Done:
+	return Status;
+}
+
 s32 XPfw_IpiReadResponse(const XPfw_Module_t *ModPtr, u32 SrcCpuMask, u32 *MsgPtr, u32 MsgLen)
  {
 	s32 Status = XST_FAILURE;
@@ -101,6 +101,17 @@ s32 XPfw_IpiWriteResponse(const XPfw_Module_t *ModPtr, u32 DestCpuMask, u32 *Msg
  */
 s32 XPfw_IpiReadMessage(u32 SrcCpuMask, u32 *MsgPtr, u32 MsgLen);
 
+/**
+ * Get a pointer to the message buffer of an IPI-0 source (Used only by Core)
+ * The message is read in place, the pointer is valid only until the IPI is
+ * acknowledged, after which the source may write its next message
+ * @param MaskIndex is the index of the Source CPU in IpiMaskList
+ * @param MsgPtr is used to return the pointer to the message buffer
+ * @return XST_SUCCESS if the source has a message buffer
+ *         XST_FAILURE in case of an error
+ */
+s32 XPfw_IpiGetMessagePtr(u32 MaskIndex, const u32 **MsgPtr);
+
 /**
  * Read Response buffer contents
  * @param ModPtr is the pointer to module that is requesting the message
@@ -0,0 +1,349 @@
+/******************************************************************************
+* Copyright (C) 2018 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+******************************************************************************/
+
+#include "xpfw_default.h"
+#include "xpfw_config.h"
+#include "xpfw_core.h"
+#include "xpfw_module.h"
+#include "xpfw_ipi_manager.h"
+#include "crf_apb.h"
+
+#include "xpfw_mod_dvfs.h"
+
+#ifdef ENABLE_DVFS
+
+#ifndef ENABLE_SCHEDULER
+	#error "ENABLE_DVFS requires ENABLE_SCHEDULER to be defined"
+#endif
+
+/* Check if PMU has access to the PS sysmon (psu_ams) */
+#ifdef XPAR_XSYSMONPSU_0_DEVICE_ID
+	#include "xsysmonpsu.h"
+#else /* XPAR_XSYSMONPSU_0_DEVICE_ID */
+	#error "ENABLE_DVFS is defined but psu_ams is not defined in the design"
+#endif
+
+/*
+ * Governor period in milliseconds.
+ */
+#define DVFS_PERIOD_MS			100U
+
+/*
+ * Load hint (in percent) above which a domain steps to a faster level and
+ * below which it steps to a slower one. Hints in between keep the level.
+ */
+#define DVFS_LOAD_UP			80U
+#define DVFS_LOAD_DOWN			30U
+#define DVFS_LOAD_MAX			100U
+
+/*
+ * Temperature (in degrees Celsius) above which the fastest allowed level is
+ * lowered, and the hysteresis below it before the limit is raised again.
+ */
+#define DVFS_TEMP_HOT			95U
+#define DVFS_TEMP_HYST			5U
+
+/*
+ * Lowest VCC_PSINTFP (in mV) at which the fast levels are allowed.
+ */
+#define DVFS_VCCINTFP_MIN_MV	808U
+
+/*
+ * Sysmon raw codes for the limits above, inverse of the
+ * XSysMonPsu_RawToTemperature_OnChip and XSysMonPsu_RawToVoltage
+ * conversions so that no floating point is needed at runtime.
+ */
+#define DVFS_TEMP_TO_RAW(Temp)	((u32)((((u64)(Temp) * 1000U) + 280231U) * \
+					128675U / 1000000U))
+#define DVFS_MV_TO_RAW(MilliV)	((u32)(((u64)(MilliV) * 65536U) / 3000U))
+
+/*
+ * CPU clock dividers are scaled by these factors, level 0 runs the domain
+ * at the rate configured at boot. CPU_R5_CTRL has the same DIVISOR0 field
+ * layout as ACPU_CTRL.
+ */
+#define DVFS_LEVEL_CNT			4U
+#define DVFS_DIV_MASK			CRF_APB_ACPU_CTRL_DIVISOR0_MASK
+#define DVFS_DIV_SHIFT			CRF_APB_ACPU_CTRL_DIVISOR0_SHIFT
+#define DVFS_DIV_MAX			(DVFS_DIV_MASK >> DVFS_DIV_SHIFT)
+
+static const u8 DvfsDivScale[DVFS_LEVEL_CNT] = {1U, 2U, 3U, 4U};
+
+typedef struct {
+	u32 CtrlReg; /**< Clock control register with the CPU divisor */
+	u32 IpiMask; /**< IPI masks of the masters sending load hints */
+	u32 PwrMask; /**< PWR_STATE mask of the domain, 0 if always on */
+	u32 BaseDiv; /**< Divisor configured at boot, used for level 0 */
+	u8 Level; /**< Current level */
+	u8 Load; /**< Last load hint in percent */
+} XPfw_DvfsDomain_t;
+
+static XPfw_DvfsDomain_t DvfsDomains[] = {
+	{
+		.CtrlReg = CRF_APB_ACPU_CTRL,
+		.IpiMask = IPI_PMU_0_IER_APU_MASK,
+		.PwrMask = PMU_GLOBAL_PWR_STATE_FP_MASK,
+		.BaseDiv = 0U,
+		.Level = 0U,
+		.Load = DVFS_LOAD_MAX,
+	}, {
+		.CtrlReg = CRL_APB_CPU_R5_CTRL,
+		.IpiMask = IPI_PMU_0_IER_RPU_0_MASK | IPI_PMU_0_IER_RPU_1_MASK,
+		.PwrMask = 0U,
+		.BaseDiv = 0U,
+		.Level = 0U,
+		.Load = DVFS_LOAD_MAX,
+	},
+};
+
+#define DVFS_DOMAIN_CNT	(sizeof(DvfsDomains) / sizeof(DvfsDomains[0]))
+
+/* Instance of SysMon Driver */
+static XSysMonPsu SysMonInst;
+
+/* Fastest level allowed by the thermal and supply limits */
+static u8 DvfsMinLevel;
+static u32 DvfsTempRaw;
+static u32 DvfsVccRaw;
+
+const XPfw_Module_t *DvfsModPtr;
+
+/**
+ * DvfsGetDomain() - Find the domain of the master which sent an IPI
+ * @SrcMask   IPI mask of the sender
+ *
+ * @return    Pointer to the domain or NULL if the sender is not a CPU master
+ */
+static XPfw_DvfsDomain_t* DvfsGetDomain(u32 SrcMask)
+{
+	XPfw_DvfsDomain_t* Domain = NULL;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < DVFS_DOMAIN_CNT; Idx++) {
+		if (0U != (DvfsDomains[Idx].IpiMask & SrcMask)) {
+			Domain = &DvfsDomains[Idx];
+			break;
+		}
+	}
+
+	return Domain;
+}
+
+/**
+ * DvfsSetLevel() - Program the CPU clock divisor of a domain for a level
+ * @Domain    Domain to update
+ * @Level     Level to switch to
+ *
+ * @note      The boot divisor is latched while the domain is at level 0, so
+ *            the governor does not depend on when psu_init runs.
+ */
+static void DvfsSetLevel(XPfw_DvfsDomain_t* Domain, u8 Level)
+{
+	u32 Div;
+
+	if (0U == Domain->Level) {
+		Div = (XPfw_Read32(Domain->CtrlReg) & DVFS_DIV_MASK) >>
+			DVFS_DIV_SHIFT;
+		Domain->BaseDiv = (0U == Div) ? 1U : Div;
+	}
+
+	Div = Domain->BaseDiv * DvfsDivScale[Level];
+	if (Div > DVFS_DIV_MAX) {
+		Div = DVFS_DIV_MAX;
+	}
+	XPfw_RMW32(Domain->CtrlReg, DVFS_DIV_MASK, Div << DVFS_DIV_SHIFT);
+	Domain->Level = Level;
+}
+
+/**
+ * DvfsUpdateLimits() - Update the fastest allowed level from sysmon readings
+ */
+static void DvfsUpdateLimits(void)
+{
+	DvfsTempRaw = XSysMonPsu_GetAdcData(&SysMonInst, XSM_CH_TEMP,
+					    XSYSMON_PS);
+	DvfsVccRaw = XSysMonPsu_GetAdcData(&SysMonInst, XSM_CH_SUPPLY2,
+					   XSYSMON_PS);
+
+	if (DvfsVccRaw < DVFS_MV_TO_RAW(DVFS_VCCINTFP_MIN_MV)) {
+		/* Supply droop, only the slowest level is safe */
+		DvfsMinLevel = (u8)(DVFS_LEVEL_CNT - 1U);
+	} else if (DvfsTempRaw >= DVFS_TEMP_TO_RAW(DVFS_TEMP_HOT)) {
+		if (DvfsMinLevel < (DVFS_LEVEL_CNT - 1U)) {
+			DvfsMinLevel++;
+		}
+	} else if (DvfsTempRaw <= DVFS_TEMP_TO_RAW(DVFS_TEMP_HOT - DVFS_TEMP_HYST)) {
+		if (DvfsMinLevel > 0U) {
+			DvfsMinLevel--;
+		}
+	} else {
+		/* Within hysteresis, keep the limit */
+	}
+}
+
+/**
+ * DvfsGovernorTask() - Periodic governor step
+ *
+ * @note      Each domain moves by at most one level per period and the clock
+ *            control register is written only when the level changes.
+ */
+static void DvfsGovernorTask(void)
+{
+	XPfw_DvfsDomain_t* Domain;
+	u32 Idx;
+	u8 Level;
+
+	DvfsUpdateLimits();
+
+	for (Idx = 0U; Idx < DVFS_DOMAIN_CNT; Idx++) {
+		Domain = &DvfsDomains[Idx];
+
+		if ((0U != Domain->PwrMask) &&
+		    (0U == (XPfw_Read32(PMU_GLOBAL_PWR_STATE) & Domain->PwrMask))) {
+			/* Powered down, the divisor is set again on power up */
+			Domain->Level = 0U;
+			Domain->Load = DVFS_LOAD_MAX;
+			continue;
+		}
+
+		Level = Domain->Level;
+		if ((Domain->Load >= DVFS_LOAD_UP) && (Level > 0U)) {
+			Level--;
+		} else if ((Domain->Load <= DVFS_LOAD_DOWN) &&
+			   (Level < (DVFS_LEVEL_CNT - 1U))) {
+			Level++;
+		} else {
+			/* Load within hysteresis band, keep the level */
+		}
+		if (Level < DvfsMinLevel) {
+			Level = DvfsMinLevel;
+		}
+
+		if (Level != Domain->Level) {
+			DvfsSetLevel(Domain, Level);
+		}
+	}
+}
+
+static void DvfsIpiHandler(const XPfw_Module_t *ModPtr, u32 IpiNum, u32 SrcMask, const u32* Payload, u8 Len)
+{
+	XPfw_DvfsDomain_t* Domain = DvfsGetDomain(SrcMask);
+	u32 Resp[DVFS_STATE_LEN] = {XST_FAILURE};
+	u32 RespLen = 1U;
+
+	if (IpiNum > 0) {
+		XPfw_Printf(DEBUG_ERROR,"DVFS: DVFS handles only IPI on PMU-0\r\n");
+		goto Done;
+	}
+
+	if (NULL == Domain) {
+		Resp[0] = XST_INVALID_PARAM;
+		goto Respond;
+	}
+
+	switch (Payload[DVFS_MOD_API_ID_OFFSET] & DVFS_API_ID_MASK) {
+	case DVFS_SET_LOAD_HINT:
+		if (Payload[DVFS_LOAD_OFFSET] > DVFS_LOAD_MAX) {
+			Resp[0] = XST_INVALID_PARAM;
+		} else {
+			Domain->Load = (u8)Payload[DVFS_LOAD_OFFSET];
+			Resp[0] = XST_SUCCESS;
+		}
+		break;
+
+	case DVFS_GET_STATE:
+		Resp[0] = XST_SUCCESS;
+		Resp[1] = Domain->Level;
+		Resp[2] = DvfsMinLevel;
+		Resp[3] = DvfsTempRaw;
+		Resp[4] = DvfsVccRaw;
+		RespLen = DVFS_STATE_LEN;
+		break;
+
+	default:
+		XPfw_Printf(DEBUG_ERROR,"DVFS: Unsupported API ID received\r\n");
+		break;
+	}
+
+Respond:
+	(void)XPfw_IpiWriteResponse(ModPtr, SrcMask, Resp, RespLen);
+Done:
+	return;
+}
+
+static void DvfsCfgInit(const XPfw_Module_t *ModPtr, const u32 *CfgData,
+		u32 Len)
+{
+	s32 Status;
+	XSysMonPsu_Config *SysMonConfigPtr;
+
+	SysMonConfigPtr = XSysMonPsu_LookupConfig(XPAR_XSYSMONPSU_0_DEVICE_ID);
+	if (NULL == SysMonConfigPtr) {
+		XPfw_Printf(DEBUG_ERROR,"DVFS (MOD-%d): SysMon LookupConfig failed.\r\n",
+				ModPtr->ModId);
+		goto Done;
+	}
+
+	Status = XSysMonPsu_CfgInitialize(&SysMonInst, SysMonConfigPtr,
+			SysMonConfigPtr->BaseAddress);
+	if (XST_SUCCESS != Status) {
+		XPfw_Printf(DEBUG_ERROR,"DVFS (MOD-%d): SysMon initialization failed.\r\n",
+				ModPtr->ModId);
+		goto Done;
+	}
+
+	Status = XPfw_CoreScheduleTask(ModPtr, DVFS_PERIOD_MS, DvfsGovernorTask);
+	if (XST_FAILURE == Status) {
+		XPfw_Printf(DEBUG_ERROR,"DVFS (MOD-%d): Scheduling governor failed.\r\n",
+				ModPtr->ModId);
+		goto Done;
+	}
+
+	XPfw_Printf(DEBUG_DETAILED,"DVFS (MOD-%d): Initialized.\r\n", ModPtr->ModId);
+Done:
+	return;
+}
+
+/*
+ * Create a Mod and assign the Handlers. We will call this function
+ * from XPfw_UserStartup()
+ */
+void ModDvfsInit(void)
+{
+	DvfsModPtr = XPfw_CoreCreateMod();
+
+	(void) XPfw_CoreSetCfgHandler(DvfsModPtr, DvfsCfgInit);
+	(void) XPfw_CoreSetIpiHandler(DvfsModPtr, DvfsIpiHandler,
+			(u16)DVFS_IPI_HANDLER_ID);
+}
+
+#else /* ENABLE_DVFS */
+void ModDvfsInit(void) { }
+#endif /* ENABLE_DVFS */
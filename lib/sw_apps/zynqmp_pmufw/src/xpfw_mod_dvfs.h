@@ -0,0 +1,49 @@
+/******************************************************************************
+* Copyright (C) 2018 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+******************************************************************************/
+
+#ifndef XPFW_MOD_DVFS_H_
+#define XPFW_MOD_DVFS_H_
+
+#define DVFS_IPI_HANDLER_ID		0xDU
+#define DVFS_API_ID_MASK		0xFFFFU
+
+#define DVFS_MOD_API_ID_OFFSET	0x0U
+#define DVFS_LOAD_OFFSET		0x1U
+
+/* DVFS API IDs */
+#define DVFS_SET_LOAD_HINT		0x01U
+#define DVFS_GET_STATE			0x02U
+
+/* Words in the DVFS_GET_STATE response */
+#define DVFS_STATE_LEN			0x5U
+
+void ModDvfsInit(void);
+
+#endif /* XPFW_MOD_DVFS_H_ */
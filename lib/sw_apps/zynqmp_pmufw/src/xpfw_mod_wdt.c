@@ -55,25 +55,86 @@ static XWdtPs *WdtInstPtr = &WdtInst;
 
 #define PSU_INIT_STATUS	1U
 /*
- * WDT expire time in milliseconds.
+ * WDT expire time in milliseconds. The prescaler is picked at init as the
+ * smallest one that can count this long, so any value up to the hardware
+ * limit (about 170 s with a 100 MHz WDT clock) can be used.
  */
+#ifndef XPFW_WDT_EXPIRE_TIME
 #define XPFW_WDT_EXPIRE_TIME 90U
+#endif
 
 /*
- * WDT restart time in milliseconds.
+ * WDT restart time in milliseconds. The WDT is kicked by a scheduler task
+ * only; with no other task due, the PMU sleeps for this whole interval.
  */
-#define XPFW_WDT_RESTART_TIME 50U
+#define XPFW_WDT_RESTART_TIME (XPFW_WDT_EXPIRE_TIME / 2U)
 #define XPFW_WDT_CRV_SHIFT 12U
-#define XPFW_WDT_PRESCALER 8U
+#define XPFW_WDT_COUNTER_MAX 0xFFFFFFU
 
-#define XPFW_WDT_CLK_PER_MSEC ((XPAR_PSU_CSU_WDT_WDT_CLK_FREQ_HZ) / (XPFW_WDT_PRESCALER * 1000))
-#define XPFW_WDT_COUNTER_VAL ((XPFW_WDT_EXPIRE_TIME) * (XPFW_WDT_CLK_PER_MSEC))
+/*
+ * Liveness monitors. Every registered monitor has to report alive once per
+ * restart interval, otherwise the WDT is not kicked.
+ */
+#define XPFW_WDT_MAX_MONITORS 32U
 
 const XPfw_Module_t *WdtModPtr;
 
+/* Registered monitors and the ones that reported alive since last kick */
+static u32 WdtMonitorMask;
+static u32 WdtAliveMask;
+
+/****************************************************************************/
+/**
+ * @brief  This function registers a liveness monitor with the WDT module.
+ *
+ * @param  None.
+ *
+ * @return Mask of the monitor to pass to XPfw_WdtSetAlive, or 0U if all the
+ *         monitors are taken.
+ *
+ * @note   Once a monitor is registered, the WDT is kicked only while the
+ *         owner keeps calling XPfw_WdtSetAlive at least once per
+ *         XPFW_WDT_RESTART_TIME. A hung owner therefore resets the PMU.
+ *
+ ****************************************************************************/
+u32 XPfw_WdtAddMonitor(void)
+{
+	u32 Index;
+	u32 Mask = 0U;
+
+	for (Index = 0U; Index < XPFW_WDT_MAX_MONITORS; Index++) {
+		if ((WdtMonitorMask & ((u32)1U << Index)) == 0U) {
+			Mask = (u32)1U << Index;
+			WdtMonitorMask |= Mask;
+			/* Do not fail the kick in progress for the new monitor */
+			WdtAliveMask |= Mask;
+			break;
+		}
+	}
+
+	return Mask;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function reports that a liveness monitor is alive.
+ *
+ * @param  Mask is the value returned by XPfw_WdtAddMonitor.
+ *
+ * @return None.
+ *
+ * @note   This only sets a bit and can be called from interrupt handlers.
+ *
+ ****************************************************************************/
+void XPfw_WdtSetAlive(u32 Mask)
+{
+	WdtAliveMask |= Mask;
+}
+
 /****************************************************************************/
 /**
- * @brief  This scheduler task restarts CSU PMU WDT.
+ * @brief  This scheduler task restarts CSU PMU WDT if all the registered
+ *         liveness monitors reported alive since the last restart.
  *
  * @param  None.
  *
@@ -84,11 +145,52 @@ const XPfw_Module_t *WdtModPtr;
  ****************************************************************************/
 static void XPfw_WdtRestart(void)
 {
-	if (WdtInstPtr != NULL) {
+	if ((WdtInstPtr != NULL) &&
+	    ((WdtAliveMask & WdtMonitorMask) == WdtMonitorMask)) {
+		WdtAliveMask = 0U;
 		XWdtPs_RestartWdt(WdtInstPtr);
+	} else {
+		XPfw_Printf(DEBUG_ERROR,"WDT (MOD-%d): Monitors 0x%x not alive\r\n",
+				WdtModPtr->ModId, WdtMonitorMask & ~WdtAliveMask);
 	}
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function picks the smallest WDT prescaler that can count
+ *         XPFW_WDT_EXPIRE_TIME and returns the matching counter value.
+ *
+ * @param  PrescalePtr is updated with the XWDTPS_CCR_PSCALE_* value.
+ *
+ * @return Counter value for XPFW_WDT_EXPIRE_TIME, saturated to the counter
+ *         maximum if the time cannot be reached.
+ *
+ * @note   None.
+ *
+ ****************************************************************************/
+static u32 XPfw_WdtCounterValue(u32 *PrescalePtr)
+{
+	u32 Prescale;
+	u32 ClkPerMsec = 1U;
+
+	for (Prescale = XWDTPS_CCR_PSCALE_0008;
+			Prescale <= XWDTPS_CCR_PSCALE_4096; Prescale++) {
+		/* Prescaler divides by 8, 64, 512 or 4096 */
+		ClkPerMsec = (XPAR_PSU_CSU_WDT_WDT_CLK_FREQ_HZ) /
+				(((u32)8U << (3U * Prescale)) * 1000U);
+		if (ClkPerMsec == 0U) {
+			ClkPerMsec = 1U;
+		}
+		if (XPFW_WDT_EXPIRE_TIME <= (XPFW_WDT_COUNTER_MAX / ClkPerMsec)) {
+			*PrescalePtr = Prescale;
+			return XPFW_WDT_EXPIRE_TIME * ClkPerMsec;
+		}
+	}
+
+	*PrescalePtr = XWDTPS_CCR_PSCALE_4096;
+	return XPFW_WDT_COUNTER_MAX;
+}
+
 /****************************************************************************/
 /**
  * @brief  This function initializes the CSU PMU Watchdog timer.
@@ -105,6 +207,7 @@ static void InitCsuPmuWdt(void)
 	s32 Status;
 	XWdtPs_Config *WdtConfigPtr;
 	u32 CounterValue;
+	u32 Prescale;
 
 	XPfw_Printf(DEBUG_DETAILED, "In InitCsuPmuWdt\r\n");
 
@@ -128,14 +231,11 @@ static void InitCsuPmuWdt(void)
 		goto Done;
 	}
 
-	/* Setting the divider value */
-	XWdtPs_SetControlValue(WdtInstPtr, XWDTPS_CLK_PRESCALE,
-			XWDTPS_CCR_PSCALE_0008);
+	/* Watchdog counter reset value for XPFW_WDT_EXPIRE_TIME */
+	CounterValue = XPfw_WdtCounterValue(&Prescale) >> XPFW_WDT_CRV_SHIFT;
 
-	/* Watchdog counter reset value for Expire time of 100Sec,
-	 * i.e., XPFW_WDT_EXPIRE_TIME
-	 */
-	CounterValue = XPFW_WDT_COUNTER_VAL >> XPFW_WDT_CRV_SHIFT;
+	/* Setting the divider value */
+	XWdtPs_SetControlValue(WdtInstPtr, XWDTPS_CLK_PRESCALE, Prescale);
 
 	/* Set the Watchdog counter reset value */
 	XWdtPs_SetControlValue(WdtInstPtr, XWDTPS_COUNTER_RESET,
@@ -220,4 +320,6 @@ void ModWdtInit(void)
 }
 #else /* ENABLE_WDT */
 void ModWdtInit(void) { }
+u32 XPfw_WdtAddMonitor(void) { return 0U; }
+void XPfw_WdtSetAlive(u32 Mask) { (void)Mask; }
 #endif /* ENABLE_WDT */
@@ -32,5 +32,7 @@
 #define XPFW_MOD_WDT_H_
 
 void ModWdtInit(void);
+u32 XPfw_WdtAddMonitor(void);
+void XPfw_WdtSetAlive(u32 Mask);
 
 #endif /* XPFW_MOD_WDT_H_ */
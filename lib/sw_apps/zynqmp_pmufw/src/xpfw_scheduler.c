@@ -45,39 +45,154 @@
 #define PIT_COUNTER_OFFSET	4U
 #define PIT_CONTROL_OFFSET	8U
 
-static u32 is_task_active(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
-{
-	u32 ReturnVal;
-
-	/* Periodic */
-	if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)
-		&& (0U == (SchedPtr->Tick
-				% SchedPtr->TaskList[TaskListIndex].Interval))) {
-		ReturnVal = TRUE;
-	} else if ((0U == SchedPtr->TaskList[TaskListIndex].Interval)
-			&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)) {
-		/* Non-Periodic */
-		ReturnVal = TRUE;
-	} else {
-		ReturnVal = FALSE;
+/* PIT control: enable counting and reload from preload on expiry */
+#define PIT_CONTROL_EN_RELOAD	3U
+
+/* Expiry of the scheduler PIT which is not yet handled */
+#define PIT_IRQ_PENDING_MASK	PMU_IOMODULE_IRQ_PENDING_PIT1_MASK
+
+/* Longest PIT period which fits into the 32 bit counter */
+#define MAX_PERIOD_TICKS	(0xFFFFFFFFU / COUNT_PER_TICK)
+
+/* Interrupt enable bit of the MicroBlaze MSR */
+#define MSR_IE_MASK		0x2U
+
+/* Check if tick A comes before tick B, wrap of the tick counter is allowed */
+#define TICK_BEFORE(A, B)	((s32)((A) - (B)) < 0)
+
+/*
+ * The queue and the PIT are updated both from the PIT interrupt and from
+ * tasks or other handlers, keep interrupts off while doing so
+ */
+static u32 XPfw_SchedulerLock(void)
+{
+	u32 Msr = mfmsr();
+
+	microblaze_disable_interrupts();
+	return Msr;
+}
+
+static void XPfw_SchedulerUnlock(u32 Msr)
+{
+	if (0U != (Msr & MSR_IE_MASK)) {
+		microblaze_enable_interrupts();
+	}
+}
+
+/* Insert the task behind all queued tasks which are due at the same tick */
+static void XPfw_SchedulerEnqueue(XPfw_Scheduler_t *SchedPtr,
+		struct XPfw_Task_t *TaskPtr)
+{
+	struct XPfw_Task_t **Link = &SchedPtr->Queue;
+
+	while ((NULL != *Link) && !TICK_BEFORE(TaskPtr->Due, (*Link)->Due)) {
+		Link = &(*Link)->Next;
+	}
+	TaskPtr->Next = *Link;
+	*Link = TaskPtr;
+}
+
+static void XPfw_SchedulerDequeue(XPfw_Scheduler_t *SchedPtr,
+		const struct XPfw_Task_t *TaskPtr)
+{
+	struct XPfw_Task_t **Link = &SchedPtr->Queue;
+
+	while (NULL != *Link) {
+		if (TaskPtr == *Link) {
+			*Link = TaskPtr->Next;
+			break;
+		}
+		Link = &(*Link)->Next;
 	}
+}
+
+/* PIT counts consumed since the start of the current period */
+static u32 XPfw_SchedulerSpentCount(const XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Remaining = XPfw_Read32(SchedPtr->PitBaseAddr + PIT_COUNTER_OFFSET);
 
-	return ReturnVal;
+	/*
+	 * Preload always holds the full period, the first count of a period
+	 * can be shorter to make up for the time spent before it was armed
+	 */
+	return (SchedPtr->PeriodTicks * COUNT_PER_TICK) - Remaining;
 }
 
-static u32 is_task_non_periodic(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
+/*
+ * Arm the PIT to expire when the head of the queue is due. SpentCount is the
+ * number of PIT counts which already elapsed since SchedPtr->Tick. If the PIT
+ * already runs with the required period it is left untouched, so a periodic
+ * task keeps its phase without PIT reprogramming.
+ */
+static void XPfw_SchedulerArm(XPfw_Scheduler_t *SchedPtr, u32 SpentCount)
 {
-	u32 ReturnVal;
+	u32 Ticks;
+	u32 Count;
 
-	if ((0U == SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)) {
-		ReturnVal = TRUE;
+	if ((NULL == SchedPtr->Queue) || (TRUE != SchedPtr->Enabled)) {
+		/* Nothing to wait for, don't wake up PMU */
+		XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
+		SchedPtr->PeriodTicks = 0U;
+		goto done;
+	}
+
+	Ticks = SchedPtr->Queue->Due - SchedPtr->Tick;
+	if (0U == Ticks) {
+		Ticks = 1U;
+	} else if (Ticks > MAX_PERIOD_TICKS) {
+		/* Wake up on the way, nothing is due at that point */
+		Ticks = MAX_PERIOD_TICKS;
 	} else {
-		ReturnVal = FALSE;
+		/* Head is reachable within one period */
+	}
+
+	if ((Ticks == SchedPtr->PeriodTicks) && (SpentCount < COUNT_PER_TICK)) {
+		/* PIT has reloaded with the right period at the last expiry */
+		goto done;
 	}
 
-	return ReturnVal;
+	Count = Ticks * COUNT_PER_TICK;
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
+			(SpentCount < Count) ? (Count - SpentCount) : 1U);
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET,
+			PIT_CONTROL_EN_RELOAD);
+	/* Counter is loaded, further periods start from the full count */
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET, Count);
+	SchedPtr->PeriodTicks = Ticks;
+
+done:
+	return;
+}
+
+/* Queue the task to become due Ticks ticks from now, rearm PIT if needed */
+static void XPfw_SchedulerQueueTask(XPfw_Scheduler_t *SchedPtr,
+		struct XPfw_Task_t *TaskPtr, u32 Ticks)
+{
+	u32 SpentCount = 0U;
+	u32 PeriodEnd = SchedPtr->Tick + SchedPtr->PeriodTicks;
+	u32 Now = SchedPtr->Tick;
+
+	if (0U != SchedPtr->PeriodTicks) {
+		if (0U != (XPfw_Read32(PMU_IOMODULE_IRQ_PENDING) &
+				PIT_IRQ_PENDING_MASK)) {
+			/* Period is over, tick handler will rearm PIT */
+			Now = PeriodEnd;
+		} else {
+			SpentCount = XPfw_SchedulerSpentCount(SchedPtr);
+			Now += SpentCount / COUNT_PER_TICK;
+		}
+	}
+
+	TaskPtr->Due = Now + Ticks;
+	XPfw_SchedulerEnqueue(SchedPtr, TaskPtr);
+
+	if ((0U == SchedPtr->PeriodTicks) ||
+			((Now != PeriodEnd) && TICK_BEFORE(TaskPtr->Due, PeriodEnd))) {
+		/* New head is due before the current period ends */
+		SchedPtr->PeriodTicks = 0U;
+		XPfw_SchedulerArm(SchedPtr, SpentCount);
+	}
 }
 
 XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
@@ -95,11 +210,15 @@ XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 		SchedPtr->TaskList[Idx].Interval = 0U;
 		SchedPtr->TaskList[Idx].Callback = NULL;
 		SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
+		SchedPtr->TaskList[Idx].Flags = 0U;
+		SchedPtr->TaskList[Idx].Next = NULL;
 	}
 
 	SchedPtr->Enabled = FALSE;
 	SchedPtr->PitBaseAddr = PitBaseAddr;
 	SchedPtr->Tick = 0U;
+	SchedPtr->Queue = NULL;
+	SchedPtr->PeriodTicks = 0U;
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
 
 	/* Successfully completed init */
@@ -112,17 +231,18 @@ done:
 XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr)
 {
 	XStatus Status;
+	u32 Msr;
 
 	if (SchedPtr == NULL) {
 		Status = XST_FAILURE;
 		goto done;
 	}
 
+	Msr = XPfw_SchedulerLock();
 	SchedPtr->Enabled = TRUE;
-
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
-			COUNT_PER_TICK);
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 3U);
+	SchedPtr->PeriodTicks = 0U;
+	XPfw_SchedulerArm(SchedPtr, 0U);
+	XPfw_SchedulerUnlock(Msr);
 	Status = XST_SUCCESS;
 
 done:
@@ -131,26 +251,52 @@ done:
 
 XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 {
+	u32 Msr = XPfw_SchedulerLock();
+
 	SchedPtr->Enabled =FALSE;
+	SchedPtr->PeriodTicks = 0U;
 
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET, 0U );
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U );
+	XPfw_SchedulerUnlock(Msr);
 
 	return XST_SUCCESS;
 }
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 {
-	u32 Idx;
+	struct XPfw_Task_t *TaskPtr;
+	u32 SpentCount;
+	u32 Msr;
 
-	SchedPtr->Tick++;
-	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
-		/* Check if it this task can be triggered */
-		if (TRUE == is_task_active(SchedPtr, Idx)) {
-			/* Mark the Task as TRIGGERED */
-			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_TRIGGERED;
+	Msr = XPfw_SchedulerLock();
+	if (0U == SchedPtr->PeriodTicks) {
+		/* PIT was stopped or rearmed after it expired */
+		goto done;
+	}
+
+	/* PIT reloaded on expiry and is already counting the next period */
+	SpentCount = XPfw_SchedulerSpentCount(SchedPtr);
+	SchedPtr->Tick += SchedPtr->PeriodTicks;
+
+	/* Trigger all the tasks which are due, they are at the queue head */
+	while ((NULL != SchedPtr->Queue) &&
+			!TICK_BEFORE(SchedPtr->Tick, SchedPtr->Queue->Due)) {
+		TaskPtr = SchedPtr->Queue;
+		SchedPtr->Queue = TaskPtr->Next;
+		/* Mark the Task as TRIGGERED */
+		TaskPtr->Status = XPFW_TASK_STATUS_TRIGGERED;
+		if (0U == (TaskPtr->Flags & XPFW_TASK_FLAG_ONESHOT)) {
+			/* Periodic task is due again one interval later */
+			TaskPtr->Due += TaskPtr->Interval;
+			XPfw_SchedulerEnqueue(SchedPtr, TaskPtr);
 		}
 	}
+
+	XPfw_SchedulerArm(SchedPtr, SpentCount);
+
+done:
+	XPfw_SchedulerUnlock(Msr);
 }
 
 XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
@@ -158,20 +304,23 @@ XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 	u32 Idx;
 	XStatus Status;
 	u32 CallCount = 0U;
+	XPfw_Callback_t Callback;
 
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
 		/* Check if the task is triggered and has a valid Callback */
+		Callback = SchedPtr->TaskList[Idx].Callback;
 		if ((XPFW_TASK_STATUS_TRIGGERED == SchedPtr->TaskList[Idx].Status) &&
-			(NULL != SchedPtr->TaskList[Idx].Callback)) {
-			/* Execute the Task */
-			SchedPtr->TaskList[Idx].Callback();
-			/* Disable the executed Task */
+			(NULL != Callback)) {
+			/* Disable the Task, so a new trigger is not lost */
 			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
-			CallCount++;
-	                /* Remove the Non-Periodic Task */
-		        if (TRUE == is_task_non_periodic(SchedPtr, Idx)) {
-			        SchedPtr->TaskList[Idx].Callback = NULL;
+			/* Remove the One-Shot Task, it is not queued anymore */
+			if (0U != (SchedPtr->TaskList[Idx].Flags &
+					XPFW_TASK_FLAG_ONESHOT)) {
+				SchedPtr->TaskList[Idx].Callback = NULL;
 			}
+			/* Execute the Task */
+			Callback();
+			CallCount++;
 		}
 	}
 
@@ -185,10 +334,21 @@ XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 	return Status;
 }
 
-XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn)
+static XStatus XPfw_SchedulerAdd(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,
+		u32 MilliSeconds, XPfw_Callback_t CallbackFn, u32 Flags)
 {
 	u32 Idx;
+	u32 Msr;
+	u32 Interval;
 	XStatus Status;
+	struct XPfw_Task_t *TaskPtr;
+
+	if ((NULL == SchedPtr) || (NULL == CallbackFn)) {
+		Status = XST_FAILURE;
+		goto done;
+	}
+
+	Msr = XPfw_SchedulerLock();
 
 	/* Get the Next Free Task Index */
 	for (Idx=0U;Idx < XPFW_SCHED_MAX_TASK;Idx++) {
@@ -199,24 +359,47 @@ XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliS
 
 	/* Check if we have reached Max Task limit */
 	if (XPFW_SCHED_MAX_TASK == Idx) {
+		XPfw_SchedulerUnlock(Msr);
 		Status = XST_FAILURE;
 		goto done;
 	}
 
 	/* Add Interval as a factor of TICK_MILLISECONDS */
-	SchedPtr->TaskList[Idx].Interval = MilliSeconds/TICK_MILLISECONDS;
-	SchedPtr->TaskList[Idx].OwnerId = OwnerId;
-	SchedPtr->TaskList[Idx].Callback = CallbackFn;
+	Interval = MilliSeconds/TICK_MILLISECONDS;
+	TaskPtr = &SchedPtr->TaskList[Idx];
+	TaskPtr->Interval = Interval;
+	TaskPtr->OwnerId = OwnerId;
+	TaskPtr->Callback = CallbackFn;
+	TaskPtr->Status = XPFW_TASK_STATUS_DISABLED;
+	/* Task with zero interval runs once, on the next tick */
+	TaskPtr->Flags = (0U == Interval) ? XPFW_TASK_FLAG_ONESHOT : Flags;
+	XPfw_SchedulerQueueTask(SchedPtr, TaskPtr,
+			(0U == Interval) ? 1U : Interval);
+
+	XPfw_SchedulerUnlock(Msr);
 	Status = XST_SUCCESS;
 
 done:
 	return Status;
 }
 
+XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn)
+{
+	return XPfw_SchedulerAdd(SchedPtr, OwnerId, MilliSeconds,
+			CallbackFn, 0U);
+}
+
+XStatus XPfw_SchedulerAddOneShotTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t CallbackFn)
+{
+	return XPfw_SchedulerAdd(SchedPtr, OwnerId, MilliSeconds,
+			CallbackFn, XPFW_TASK_FLAG_ONESHOT);
+}
+
 XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t CallbackFn)
 {
 	u32 Idx;
 	u32 TaskCount = 0;
+	u32 Msr = XPfw_SchedulerLock();
 
 	/*Find the Task Index */
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
@@ -224,12 +407,16 @@ XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 Mi
 		    (SchedPtr->TaskList[Idx].OwnerId == OwnerId) &&
 		    ((SchedPtr->TaskList[Idx].Interval == (MilliSeconds/TICK_MILLISECONDS)) ||
 				(0U == MilliSeconds))) {
+			/* PIT is left armed, the tick handler rearms it */
+			XPfw_SchedulerDequeue(SchedPtr, &SchedPtr->TaskList[Idx]);
 			SchedPtr->TaskList[Idx].Interval = 0U;
 			SchedPtr->TaskList[Idx].OwnerId = 0U;
 			SchedPtr->TaskList[Idx].Callback = NULL;
+			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
 			TaskCount++;
 		}
 	}
+	XPfw_SchedulerUnlock(Msr);
 
 	XPfw_Printf(DEBUG_DETAILED,"%s: Removed %lu tasks\r\n",
 			__func__, TaskCount);
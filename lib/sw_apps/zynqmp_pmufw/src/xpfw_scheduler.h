@@ -33,12 +33,21 @@
 
 #include "xpfw_default.h"
 
+/*
+ * Size of the task pool. Only due tasks are visited on a PIT interrupt, so
+ * the pool can be enlarged from the build without adding per tick overhead.
+ */
+#ifndef XPFW_SCHED_MAX_TASK
 #define XPFW_SCHED_MAX_TASK	10U
+#endif
 
 /* Values for TaskPtr->Status */
 #define XPFW_TASK_STATUS_TRIGGERED	0x5AFEC0C0U
 #define XPFW_TASK_STATUS_DISABLED	0x00000000U
 
+/* Values for TaskPtr->Flags */
+#define XPFW_TASK_FLAG_ONESHOT		0x1U
+
 typedef void (*XPfw_Callback_t) (void);
 
 struct XPfw_Task_t{
@@ -46,14 +55,26 @@ struct XPfw_Task_t{
 	u32 OwnerId;
 	u32 Status;
 	XPfw_Callback_t Callback;
+	u32 Flags;
+	/* Tick at which the task is due, valid while the task is queued */
+	u32 Due;
+	/* Next task in the queue of pending tasks, sorted by Due */
+	struct XPfw_Task_t *Next;
 };
 
 typedef struct {
 	struct XPfw_Task_t TaskList[XPFW_SCHED_MAX_TASK];
 	u32 TaskCount;
 	u32 PitBaseAddr;
+	/* Tick at which the current PIT period started */
 	u32 Tick;
 	u32 Enabled;
+	/* Pending tasks, the head is the next one to become due */
+	struct XPfw_Task_t *Queue;
+	/* Length of the current PIT period in ticks, 0 if PIT is stopped */
+	u32 PeriodTicks;
+	/* Value last written to the PIT preload register */
+	u32 Preload;
 } XPfw_Scheduler_t ;
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr);
@@ -62,6 +83,7 @@ XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn);
+XStatus XPfw_SchedulerAddOneShotTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t CallbackFn);
 XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t CallbackFn);
 
 #endif /* XPFW_SCHEDULER_H_ */
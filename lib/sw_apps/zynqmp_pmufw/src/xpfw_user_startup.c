@@ -37,6 +37,7 @@
 #include "xpfw_user_startup.h"
 
 #include "xpfw_mod_dap.h"
+#include "xpfw_mod_dvfs.h"
 #include "xpfw_mod_legacy.h"
 #include "xpfw_mod_em.h"
 #include "xpfw_mod_pm.h"
@@ -82,4 +83,5 @@ void XPfw_UserStartUp(void)
 	ModDapInit();
 	ModLegacyInit();
 	ModWdtInit();
+	ModDvfsInit();
 }
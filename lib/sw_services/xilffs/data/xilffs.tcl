@@ -36,6 +36,11 @@
 # ----- ----  -------  -----------------------------------------------
 # 1.00a hk/sg 10/17/13 First release
 # 2.0   hk    12/13/13 Modified to use new TCL API's
+# 3.8   ag    10/14/26 Generate FILE_SYSTEM_CACHE_SECTORS
+#                      Generate FILE_SYSTEM_AUTO_LINKMAP
+#                      Generate FILE_SYSTEM_SECTOR_SIZE
+#                      Generate FILE_SYSTEM_FS_REENTRANT
+#                      Generate FILE_SYSTEM_AU_ALIGN
 #
 ##############################################################################
 
@@ -118,6 +123,11 @@ proc xgen_opts_file {libhandle} {
 	set use_strfunc [common::get_property CONFIG.use_strfunc $libhandle]
 	set set_fs_rpath [common::get_property CONFIG.set_fs_rpath $libhandle]
 	set word_access [common::get_property CONFIG.word_access $libhandle]
+	set num_cache_sectors [common::get_property CONFIG.num_cache_sectors $libhandle]
+	set auto_linkmap [common::get_property CONFIG.auto_linkmap $libhandle]
+	set sector_size [common::get_property CONFIG.sector_size $libhandle]
+	set enable_reentrant [common::get_property CONFIG.enable_reentrant $libhandle]
+	set au_align [common::get_property CONFIG.au_align $libhandle]
 
 	# do processor specific checks
 	set proc  [hsi::get_sw_processor];
@@ -191,6 +201,33 @@ proc xgen_opts_file {libhandle} {
 		}
 		puts $file_handle "\#define FILE_SYSTEM_SET_FS_RPATH $set_fs_rpath"
 
+		if {$sector_size != 512} {
+			if {$fs_interface != 1 || ($sector_size != 1024 && \
+					$sector_size != 2048 && $sector_size != 4096)} {
+				puts "WARNING : Invalid sector size for the selected \
+						interface, setting back to 512\n"
+			} else {
+				puts $file_handle "\#define FILE_SYSTEM_SECTOR_SIZE $sector_size"
+			}
+		}
+		if {$auto_linkmap == true} {
+			puts $file_handle "\#define FILE_SYSTEM_AUTO_LINKMAP"
+		}
+		if {$fs_interface == 1 && $num_cache_sectors > 0} {
+			puts $file_handle "\#define FILE_SYSTEM_CACHE_SECTORS $num_cache_sectors"
+		}
+		if {$fs_interface == 1 && $au_align == true} {
+			puts $file_handle "\#define FILE_SYSTEM_AU_ALIGN"
+		}
+		if {$enable_reentrant == true} {
+			set os_name [common::get_property NAME [hsi::get_os]]
+			if {[string match "freertos*" $os_name]} {
+				puts $file_handle "\#define FILE_SYSTEM_FS_REENTRANT"
+			} else {
+				puts "WARNING : Reentrancy needs FreeRTOS, disabling it\n"
+			}
+		}
+
 		# MB does not allow word access from RAM
 		if {$proc_type != "microblaze" && $word_access == true} {
 			puts $file_handle "\#define FILE_SYSTEM_WORD_ACCESS"
@@ -39,8 +39,8 @@
 *		Process to use file system with SD
 *		Select xilffs in SDK when creating a BSP
 *		In SDK, set "fs_interface" to 1 to select SD interface.
-*		This glue layer can currently be used only with one
-*		SD controller enabled.
+*		SD0 and SD1 are drives 0 and 1 when both controllers are
+*		enabled.
 *		In order to use eMMC, in SDK set "Enable MMC" to 1. If not,
 *		SD support is enabled by default.
 *
@@ -48,12 +48,43 @@
 *		This glue layer initializes the host controller and SD card
 *		in disk_initialize. If SD card supports it, 4-bit mode and
 *		high speed mode will be enabled.
-*		The default block size is 512 bytes.
+*		The default block size is 512 bytes. Set "sector_size" in SDK
+*		to 1024, 2048 or 4096 to present larger logical sectors to FatFs;
+*		the card must then be formatted with that sector size, e.g. by
+*		f_mkfs() without a partition table.
 *		disk_read and disk_write functions are used to read and
 *		write files using ADMA2 in polled mode.
 *		The file system can be used to read from and write to an
 *		SD card that is already formatted as FATFS.
 *
+*		Sector cache:
+*		In SDK, set "num_cache_sectors" to a non-zero value to place
+*		a write-back LRU cache of that many sectors between FatFs and
+*		the SD driver. Single sector FAT and directory accesses are
+*		then served from memory, a miss that continues a sequential
+*		run fetches up to DISK_CACHE_BURST sectors with one command,
+*		and dirty sectors are written back on CTRL_SYNC (f_sync,
+*		f_close) or eviction, coalescing adjacent sectors into one
+*		multi-block write. Data written since the last f_sync is
+*		therefore not guaranteed to be on the card. Each SD
+*		controller has its own cache of that many sectors.
+*
+*		Reentrancy:
+*		In SDK, set "enable_reentrant" to true in a FreeRTOS BSP to
+*		build FatFs with _FS_REENTRANT. Each SD drive then has its own
+*		controller state, cache and lock, so tasks using volumes on
+*		different controllers do not wait for each other. Once the
+*		scheduler runs, transfers are interrupt driven through the
+*		asynchronous API of the SD driver and the calling task blocks
+*		until the transfer completes instead of polling.
+*
+*		Allocation unit alignment:
+*		In SDK, set "au_align" to true to report the allocation unit
+*		of SD cards as erase block size (GET_BLOCK_SIZE), which makes
+*		f_mkfs() align the data area to it and FatFs start files on
+*		free allocation units. Multi-block writes then pre-erase with
+*		ACMD23 and carry a CMD23 block count.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -81,6 +112,18 @@
 * 3.4   sk   06/09/16 Added support for mkfs.
 * 3.8   mj   07/31/17 Added support for RAM based FATfs.
 *       mn   12/04/17 Resolve errors in XilFFS for ARMCC compiler
+*       ag   10/14/26 Added optional LRU sector cache with read-ahead and
+*                     coalesced write-back for the SD interface.
+*                     Split SD transfers larger than one descriptor table.
+*                     Added logical sector sizes up to 4096 bytes for SD.
+*                     Moved the SD state into a per drive structure and
+*                     added per drive locking and interrupt driven
+*                     transfers for reentrant FreeRTOS builds.
+*                     Report the SD allocation unit as erase block size
+*                     and enable the SD write performance mode with
+*                     au_align.
+*                     get_fattime takes the time from gettimeofday when
+*                     a time source is set, e.g. the rtcpsu time service.
 *
 * </pre>
 *
@@ -107,6 +150,78 @@
 #define EXT_CSD_HIGH_SPEED_BYTE		185
 #define EXT_CSD_DEVICE_TYPE_HIGH_SPEED	0x3
 #define SD_CD_DELAY		10000U
+/* Largest transfer one ADMA2 descriptor table of the SD driver can describe */
+#define SD_MAX_BLKCNT		((32U * XSDPS_DESC_MAX_LENGTH) / XSDPS_BLK_SIZE_512_MASK)
+
+/*
+ * Logical sector size presented to FatFs. Larger sectors are mapped onto
+ * consecutive 512 byte card blocks.
+ */
+#ifdef FILE_SYSTEM_SECTOR_SIZE
+#define SD_SECTOR_SIZE		((u32)FILE_SYSTEM_SECTOR_SIZE)
+#else
+#define SD_SECTOR_SIZE		512U
+#endif
+#define SD_SECTOR_RATIO		(SD_SECTOR_SIZE / 512U)
+
+#ifdef FILE_SYSTEM_INTERFACE_SD
+#ifdef XPAR_XSDPS_1_DEVICE_ID
+#define SD_NUM_DRIVES		2U
+#else
+#define SD_NUM_DRIVES		1U
+#endif
+#endif
+
+#if defined(FILE_SYSTEM_INTERFACE_SD) && (_FS_REENTRANT != 0)
+#define DISK_SD_LOCK
+#ifdef XPAR_XSDIOPS_0_INTR
+#define DISK_SD_ASYNC
+#endif
+#endif
+
+#ifdef DISK_SD_ASYNC
+/* Base address of the second controller, to pick its interrupt line */
+#ifdef XPS_SDIO1_BASEADDR
+#define SD_SDIO1_BASEADDR	XPS_SDIO1_BASEADDR
+#else
+#define SD_SDIO1_BASEADDR	0xFF170000U
+#endif
+#endif
+
+#if defined(FILE_SYSTEM_INTERFACE_SD) && defined(FILE_SYSTEM_CACHE_SECTORS)
+#if (FILE_SYSTEM_CACHE_SECTORS > 0)
+#define DISK_CACHE_ENABLE
+#define DISK_CACHE_SECTORS	((u32)FILE_SYSTEM_CACHE_SECTORS)
+#define DISK_CACHE_SECTOR_SIZE	512U
+/*
+ * Largest single transfer issued by the cache for read-ahead and write-back.
+ * Requests of this many sectors or more bypass the cache.
+ */
+#if (FILE_SYSTEM_CACHE_SECTORS < 8)
+#define DISK_CACHE_BURST	((u32)FILE_SYSTEM_CACHE_SECTORS)
+#else
+#define DISK_CACHE_BURST	8U
+#endif
+#define DISK_CACHE_NONE		0xFFFFFFFFU
+#endif
+#endif
+
+#ifdef DISK_CACHE_ENABLE
+#include <string.h>
+#endif
+
+#ifdef DISK_SD_LOCK
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#endif
+
+/* gettimeofday of the ARM BSPs, see Xil_SetTimeOfDayHook */
+#if defined (__GNUC__) && (defined (__arm__) || defined (__aarch64__))
+#define DISK_WALL_CLOCK
+#include <sys/time.h>
+#include <time.h>
+#endif
 
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 #include "xparameters.h"
@@ -129,21 +244,584 @@ static char *dataramfs = NULL;
  */
 static DSTATUS Stat[2] = {STA_NOINIT, STA_NOINIT};	/* Disk status */
 
-#ifdef FILE_SYSTEM_INTERFACE_SD
-static XSdPs SdInstance[2];
-static u32 BaseAddress;
-static u32 CardDetect;
-static u32 WriteProtect;
-static u32 SlotType[2];
-static u8 HostCntrlrVer[2];
+#ifdef DISK_CACHE_ENABLE
+/*
+ * Cache slot book keeping. Age is a per drive use stamp, the slot with the
+ * smallest stamp is the least recently used one.
+ */
+typedef struct {
+	DWORD Sector;
+	u32 Age;
+	u8 Valid;
+	u8 Dirty;
+} DiskCacheTag;
 #endif
 
+#ifdef FILE_SYSTEM_INTERFACE_SD
+/*
+ * State of one SD drive. Nothing in here is shared with the other drive, so
+ * volumes on different controllers can be used concurrently.
+ */
+typedef struct {
+	XSdPs Instance;
+	u32 BaseAddress;
+	u32 CardDetect;
+	u32 WriteProtect;
+	u32 SlotType;
+	u32 AuBlocks;		/* Allocation unit in card blocks, 0 if unknown */
+	u8 HostCntrlrVer;
+#ifdef DISK_CACHE_ENABLE
 #ifdef __ICCARM__
 #pragma data_alignment = 32
-static u8 ExtCsd[512];
+	u8 CacheData[DISK_CACHE_SECTORS][DISK_CACHE_SECTOR_SIZE];
+#pragma data_alignment = 32
+	u8 CacheBurst[DISK_CACHE_BURST][DISK_CACHE_SECTOR_SIZE];
 #pragma data_alignment = 4
 #else
-static u8 ExtCsd[512] __attribute__ ((aligned(32)));
+	u8 CacheData[DISK_CACHE_SECTORS][DISK_CACHE_SECTOR_SIZE]
+					__attribute__ ((aligned(32)));
+	u8 CacheBurst[DISK_CACHE_BURST][DISK_CACHE_SECTOR_SIZE]
+					__attribute__ ((aligned(32)));
+#endif
+	DiskCacheTag CacheTag[DISK_CACHE_SECTORS];
+	u32 CacheClock;
+	DWORD CacheNextSector;	/* Sector following the last miss */
+#endif
+#ifdef DISK_SD_LOCK
+	SemaphoreHandle_t Lock;	/* Serializes the volumes of this drive */
+#endif
+#ifdef DISK_SD_ASYNC
+	XSdPs_Async Async;
+	XSdPs_Request Request;
+	SemaphoreHandle_t Done;	/* Given by the completion handler */
+	u8 AsyncReady;
+#endif
+} DiskSd;
+
+static DiskSd SdDrive[SD_NUM_DRIVES];
+#endif
+
+#ifdef DISK_SD_LOCK
+/*
+ * The card initialization of the SD driver uses a static buffer, so drives
+ * are initialized one at a time.
+ */
+static SemaphoreHandle_t SdInitLock;
+
+#define DISK_LOCK(LockPtr)	(void)xSemaphoreTake(disk_lock_get(LockPtr), \
+						portMAX_DELAY)
+#define DISK_UNLOCK(LockPtr)	(void)xSemaphoreGive(*(LockPtr))
+#else
+#define DISK_LOCK(LockPtr)
+#define DISK_UNLOCK(LockPtr)
+#endif
+
+#ifdef DISK_SD_LOCK
+/*****************************************************************************/
+/**
+*
+* Returns a mutex, creating it on first use. The scheduler is suspended
+* while checking so two tasks cannot both create it.
+*
+* @param	LockPtr - Pointer to the mutex handle
+*
+* @return	The mutex handle
+*
+******************************************************************************/
+static SemaphoreHandle_t disk_lock_get(SemaphoreHandle_t *LockPtr)
+{
+	if (*LockPtr == NULL) {
+		vTaskSuspendAll();
+		if (*LockPtr == NULL) {
+			*LockPtr = xSemaphoreCreateMutex();
+		}
+		(void)xTaskResumeAll();
+	}
+	configASSERT(*LockPtr != NULL);
+
+	return *LockPtr;
+}
+#endif
+
+#ifdef DISK_SD_ASYNC
+/*****************************************************************************/
+/**
+*
+* Completion handler of the asynchronous SD transfers, called from the SD
+* interrupt. Wakes up the task waiting in sd_transfer.
+*
+* @param	CallBackRef - Drive the request belongs to
+* @param	ReqPtr - Completed request
+* @param	Status - XST_SUCCESS or XST_FAILURE
+*
+* @return	None
+*
+******************************************************************************/
+static void sd_async_done(void *CallBackRef, XSdPs_Request *ReqPtr, s32 Status)
+{
+	DiskSd *Sd = (DiskSd *)CallBackRef;
+	BaseType_t Woken = pdFALSE;
+
+	(void)ReqPtr;
+	(void)Status;
+
+	(void)xSemaphoreGiveFromISR(Sd->Done, &Woken);
+	portYIELD_FROM_ISR(Woken);
+}
+
+/*****************************************************************************/
+/**
+*
+* Switches a drive to interrupt driven transfers. This is done on the first
+* transfer made while the scheduler runs, as waiting for the completion
+* needs a running scheduler.
+*
+* @param	Sd - Drive
+*
+* @return	XST_SUCCESS, or XST_FAILURE if the drive stays polled.
+*
+******************************************************************************/
+static s32 sd_async_setup(DiskSd *Sd)
+{
+	u8 IntrId;
+
+	if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+		return XST_FAILURE;
+	}
+
+	if (Sd->Done == NULL) {
+		Sd->Done = xSemaphoreCreateBinary();
+		if (Sd->Done == NULL) {
+			return XST_FAILURE;
+		}
+	}
+
+	if (XSdPs_AsyncInitialize(&Sd->Async, &Sd->Instance) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+#ifdef XPAR_XSDIOPS_1_INTR
+	if (Sd->Instance.Config.BaseAddress == SD_SDIO1_BASEADDR) {
+		IntrId = (u8)XPAR_XSDIOPS_1_INTR;
+	} else
+#endif
+	{
+		IntrId = (u8)XPAR_XSDIOPS_0_INTR;
+	}
+	if (xPortInstallInterruptHandler(IntrId,
+			(XInterruptHandler)XSdPs_AsyncIntrHandler,
+			&Sd->Async) != pdPASS) {
+		return XST_FAILURE;
+	}
+	vPortEnableInterrupt(IntrId);
+
+	Sd->Request.Handler = sd_async_done;
+	Sd->Request.CallBackRef = Sd;
+	Sd->AsyncReady = 1U;
+
+	return XST_SUCCESS;
+}
+#endif
+
+#ifdef FILE_SYSTEM_INTERFACE_SD
+/*****************************************************************************/
+/**
+*
+* Issues multi-block reads or writes to the SD card, converting the
+* LBA to a byte address for standard capacity cards. Transfers longer than
+* SD_MAX_BLKCNT are split, as FatFs may now ask for a whole run of
+* contiguous clusters at once. Transfers are polled unless the drive has
+* been switched to interrupt driven transfers, in which case the calling
+* task sleeps until each chunk completes.
+*
+* @param	Sd - Drive
+* @param	sector - Start sector number
+* @param	count - Sector count
+* @param	*buff - Data buffer
+* @param	IsWrite - 1 to write, 0 to read
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT sd_transfer(DiskSd *Sd, DWORD sector, u32 count, BYTE *buff,
+				u8 IsWrite)
+{
+	s32 Status = XST_SUCCESS;
+	DWORD LocSector = sector;
+	u32 Remain = count;
+	u32 Chunk;
+	BYTE *LocBuff = buff;
+
+	while ((Remain != 0U) && (Status == XST_SUCCESS)) {
+		Chunk = (Remain > SD_MAX_BLKCNT) ? SD_MAX_BLKCNT : Remain;
+
+		/* Convert LBA to byte address if needed */
+		if ((Sd->Instance.HCS) == 0U) {
+			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+		}
+
+#ifdef DISK_SD_ASYNC
+		if ((Sd->AsyncReady != 0U) ||
+				(sd_async_setup(Sd) == XST_SUCCESS)) {
+			Sd->Request.Arg = (u32)LocSector;
+			Sd->Request.BlkCnt = Chunk;
+			Sd->Request.Buff = LocBuff;
+			Sd->Request.IsWrite = IsWrite;
+			Status = XSdPs_AsyncSubmit(&Sd->Async, &Sd->Request);
+			if (Status == XST_SUCCESS) {
+				(void)xSemaphoreTake(Sd->Done, portMAX_DELAY);
+				Status = Sd->Request.Status;
+			}
+		} else
+#endif
+		if (IsWrite != 0U) {
+			Status = XSdPs_WritePolled(&Sd->Instance,
+					(u32)LocSector, Chunk, LocBuff);
+		} else {
+			Status = XSdPs_ReadPolled(&Sd->Instance,
+					(u32)LocSector, Chunk, LocBuff);
+		}
+
+		Remain -= Chunk;
+		LocBuff += Chunk * XSDPS_BLK_SIZE_512_MASK;
+		LocSector = sector + (count - Remain);
+	}
+
+	return (Status == XST_SUCCESS) ? RES_OK : RES_ERROR;
+}
+#endif
+
+#ifdef DISK_CACHE_ENABLE
+/*****************************************************************************/
+/**
+*
+* Looks up a sector in the cache.
+*
+* @param	Sd - Drive
+* @param	sector - Sector number
+*
+* @return	Slot index, or DISK_CACHE_NONE on a miss.
+*
+******************************************************************************/
+static u32 cache_find(DiskSd *Sd, DWORD sector)
+{
+	u32 Slot;
+
+	for (Slot = 0U; Slot < DISK_CACHE_SECTORS; Slot++) {
+		if ((Sd->CacheTag[Slot].Valid != 0U) &&
+				(Sd->CacheTag[Slot].Sector == sector)) {
+			return Slot;
+		}
+	}
+
+	return DISK_CACHE_NONE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes back every dirty sector of a drive. The lowest dirty sector is
+* picked first and extended with the dirty sectors that directly follow it,
+* so each run of adjacent sectors goes out as one multi-block write.
+*
+* @param	Sd - Drive
+*
+* @return	RES_OK or RES_ERROR. Sectors that failed to write stay dirty.
+*
+******************************************************************************/
+static DRESULT cache_flush(DiskSd *Sd)
+{
+	u32 Run[DISK_CACHE_BURST];
+	u32 Slot;
+	u32 Count;
+	u32 Index;
+	DWORD First;
+
+	for (;;) {
+		Run[0] = DISK_CACHE_NONE;
+		for (Slot = 0U; Slot < DISK_CACHE_SECTORS; Slot++) {
+			if ((Sd->CacheTag[Slot].Valid != 0U) &&
+					(Sd->CacheTag[Slot].Dirty != 0U) &&
+					((Run[0] == DISK_CACHE_NONE) ||
+					(Sd->CacheTag[Slot].Sector <
+					Sd->CacheTag[Run[0]].Sector))) {
+				Run[0] = Slot;
+			}
+		}
+		if (Run[0] == DISK_CACHE_NONE) {
+			break;
+		}
+
+		First = Sd->CacheTag[Run[0]].Sector;
+		for (Count = 1U; Count < DISK_CACHE_BURST; Count++) {
+			Slot = cache_find(Sd, First + Count);
+			if ((Slot == DISK_CACHE_NONE) ||
+					(Sd->CacheTag[Slot].Dirty == 0U)) {
+				break;
+			}
+			Run[Count] = Slot;
+		}
+
+		if (Count == 1U) {
+			if (sd_transfer(Sd, First, 1U, Sd->CacheData[Run[0]],
+					1U) != RES_OK) {
+				return RES_ERROR;
+			}
+		} else {
+			for (Index = 0U; Index < Count; Index++) {
+				(void)memcpy(Sd->CacheBurst[Index],
+						Sd->CacheData[Run[Index]],
+						DISK_CACHE_SECTOR_SIZE);
+			}
+			if (sd_transfer(Sd, First, Count, Sd->CacheBurst[0],
+					1U) != RES_OK) {
+				return RES_ERROR;
+			}
+		}
+
+		for (Index = 0U; Index < Count; Index++) {
+			Sd->CacheTag[Run[Index]].Dirty = 0U;
+		}
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Allocates a cache slot for a sector, evicting the least recently used
+* slot. Evicting a dirty slot writes back all dirty sectors of the drive so
+* the write-back stays coalesced.
+*
+* @param	Sd - Drive
+* @param	sector - Sector number the slot is claimed for
+*
+* @return	Slot index, or DISK_CACHE_NONE if the write-back failed.
+*
+******************************************************************************/
+static u32 cache_alloc(DiskSd *Sd, DWORD sector)
+{
+	u32 Slot;
+	u32 Victim = 0U;
+
+	for (Slot = 0U; Slot < DISK_CACHE_SECTORS; Slot++) {
+		if (Sd->CacheTag[Slot].Valid == 0U) {
+			Victim = Slot;
+			break;
+		}
+		if (Sd->CacheTag[Slot].Age < Sd->CacheTag[Victim].Age) {
+			Victim = Slot;
+		}
+	}
+
+	if ((Sd->CacheTag[Victim].Valid != 0U) &&
+			(Sd->CacheTag[Victim].Dirty != 0U)) {
+		if (cache_flush(Sd) != RES_OK) {
+			return DISK_CACHE_NONE;
+		}
+	}
+
+	Sd->CacheTag[Victim].Valid = 1U;
+	Sd->CacheTag[Victim].Dirty = 0U;
+	Sd->CacheTag[Victim].Sector = sector;
+	Sd->CacheTag[Victim].Age = ++Sd->CacheClock;
+
+	return Victim;
+}
+
+/*****************************************************************************/
+/**
+*
+* Drops every cached sector of a drive without writing it back.
+*
+* @param	Sd - Drive
+*
+* @return	None
+*
+******************************************************************************/
+static void cache_invalidate(DiskSd *Sd)
+{
+	u32 Slot;
+
+	for (Slot = 0U; Slot < DISK_CACHE_SECTORS; Slot++) {
+		Sd->CacheTag[Slot].Valid = 0U;
+		Sd->CacheTag[Slot].Dirty = 0U;
+	}
+	Sd->CacheNextSector = DISK_CACHE_NONE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads sectors through the cache. Misses are fetched in runs; a miss that
+* continues the previous one is treated as a sequential stream and the run
+* is extended to DISK_CACHE_BURST sectors. A run never reaches past a sector
+* that is already cached, so dirty data is not overwritten.
+*
+* @param	Sd - Drive
+* @param	*buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_read(DiskSd *Sd, BYTE *buff, DWORD sector, u32 count)
+{
+	u32 Slot;
+	u32 Slots[DISK_CACHE_BURST];
+	u32 Run;
+	u32 Limit;
+	u32 Index;
+	u32 Done = 0U;
+	DWORD Sector;
+
+	while (Done < count) {
+		Sector = sector + Done;
+		Slot = cache_find(Sd, Sector);
+		if (Slot != DISK_CACHE_NONE) {
+			(void)memcpy(&buff[Done * DISK_CACHE_SECTOR_SIZE],
+					Sd->CacheData[Slot], DISK_CACHE_SECTOR_SIZE);
+			Sd->CacheTag[Slot].Age = ++Sd->CacheClock;
+			Done++;
+			continue;
+		}
+
+		if (Sector == Sd->CacheNextSector) {
+			Limit = DISK_CACHE_BURST;
+		} else {
+			Limit = count - Done;
+			if (Limit > DISK_CACHE_BURST) {
+				Limit = DISK_CACHE_BURST;
+			}
+		}
+		/* Do not read ahead past the end of the card */
+		if (((DWORD)Sd->Instance.SectorCount > Sector) &&
+				((Sector + Limit) >
+				(DWORD)Sd->Instance.SectorCount)) {
+			Limit = (u32)((DWORD)Sd->Instance.SectorCount - Sector);
+		}
+		for (Run = 1U; Run < Limit; Run++) {
+			if (cache_find(Sd, Sector + Run) != DISK_CACHE_NONE) {
+				break;
+			}
+		}
+
+		/*
+		 * Claim the slots before reading, an eviction may write back
+		 * through the burst buffer.
+		 */
+		for (Index = 0U; Index < Run; Index++) {
+			Slots[Index] = cache_alloc(Sd, Sector + Index);
+			if (Slots[Index] == DISK_CACHE_NONE) {
+				break;
+			}
+		}
+		if ((Index < Run) || (sd_transfer(Sd, Sector, Run,
+				Sd->CacheBurst[0], 0U) != RES_OK)) {
+			while (Index > 0U) {
+				Index--;
+				Sd->CacheTag[Slots[Index]].Valid = 0U;
+			}
+			return RES_ERROR;
+		}
+		Sd->CacheNextSector = Sector + Run;
+
+		for (Index = 0U; Index < Run; Index++) {
+			(void)memcpy(Sd->CacheData[Slots[Index]], Sd->CacheBurst[Index],
+					DISK_CACHE_SECTOR_SIZE);
+			if ((Done + Index) < count) {
+				(void)memcpy(&buff[(Done + Index) *
+						DISK_CACHE_SECTOR_SIZE], Sd->CacheBurst[Index],
+						DISK_CACHE_SECTOR_SIZE);
+			}
+		}
+		Done += (Run < (count - Done)) ? Run : (count - Done);
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes sectors into the cache and marks them dirty. They reach the card on
+* CTRL_SYNC or when they are evicted.
+*
+* @param	Sd - Drive
+* @param	*buff - Pointer to the data to be written
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_write(DiskSd *Sd, const BYTE *buff, DWORD sector,
+				u32 count)
+{
+	u32 Slot;
+	u32 Index;
+
+	for (Index = 0U; Index < count; Index++) {
+		Slot = cache_find(Sd, sector + Index);
+		if (Slot == DISK_CACHE_NONE) {
+			Slot = cache_alloc(Sd, sector + Index);
+			if (Slot == DISK_CACHE_NONE) {
+				return RES_ERROR;
+			}
+		} else {
+			Sd->CacheTag[Slot].Age = ++Sd->CacheClock;
+		}
+		(void)memcpy(Sd->CacheData[Slot], &buff[Index * DISK_CACHE_SECTOR_SIZE],
+				DISK_CACHE_SECTOR_SIZE);
+		Sd->CacheTag[Slot].Dirty = 1U;
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Keeps the cache coherent with a transfer that bypassed it. After a direct
+* read, dirty cached sectors replace the stale card data in the buffer.
+* After a direct write, cached copies are refreshed and marked clean.
+*
+* @param	Sd - Drive
+* @param	*buff - Transfer buffer
+* @param	sector - Start sector number
+* @param	count - Sector count
+* @param	IsWrite - 1 after a write, 0 after a read
+*
+* @return	None
+*
+******************************************************************************/
+static void cache_bypass(DiskSd *Sd, BYTE *buff, DWORD sector, u32 count,
+				u8 IsWrite)
+{
+	u32 Slot;
+	DWORD Offset;
+
+	for (Slot = 0U; Slot < DISK_CACHE_SECTORS; Slot++) {
+		if ((Sd->CacheTag[Slot].Valid == 0U) ||
+				(Sd->CacheTag[Slot].Sector < sector) ||
+				(Sd->CacheTag[Slot].Sector >= (sector + count))) {
+			continue;
+		}
+		Offset = (Sd->CacheTag[Slot].Sector - sector) * DISK_CACHE_SECTOR_SIZE;
+		if (IsWrite != 0U) {
+			(void)memcpy(Sd->CacheData[Slot], &buff[Offset],
+					DISK_CACHE_SECTOR_SIZE);
+			Sd->CacheTag[Slot].Dirty = 0U;
+		} else if (Sd->CacheTag[Slot].Dirty != 0U) {
+			(void)memcpy(&buff[Offset], Sd->CacheData[Slot],
+					DISK_CACHE_SECTOR_SIZE);
+		} else {
+			/* Clean copy matches the card */
+		}
+	}
+}
 #endif
 
 /*-----------------------------------------------------------------------*/
@@ -172,37 +850,45 @@ DSTATUS disk_status (
 		BYTE pdrv	/* Drive number (0) */
 )
 {
-	DSTATUS s = Stat[pdrv];
+	DSTATUS s;
 	u32 StatusReg;
 	u32 DelayCount = 0;
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
-		if (SdInstance[pdrv].Config.BaseAddress == (u32)0) {
+		DiskSd *Sd;
+
+		if (pdrv >= SD_NUM_DRIVES) {
+			return STA_NOINIT;
+		}
+		Sd = &SdDrive[pdrv];
+		DISK_LOCK(&Sd->Lock);
+		s = Stat[pdrv];
+		if (Sd->Instance.Config.BaseAddress == (u32)0) {
 #ifdef XPAR_XSDPS_1_DEVICE_ID
 				if(pdrv == 1) {
-						BaseAddress = XPAR_XSDPS_1_BASEADDR;
-						CardDetect = XPAR_XSDPS_1_HAS_CD;
-						WriteProtect = XPAR_XSDPS_1_HAS_WP;
+						Sd->BaseAddress = XPAR_XSDPS_1_BASEADDR;
+						Sd->CardDetect = XPAR_XSDPS_1_HAS_CD;
+						Sd->WriteProtect = XPAR_XSDPS_1_HAS_WP;
 				} else {
 #endif
-						BaseAddress = XPAR_XSDPS_0_BASEADDR;
-						CardDetect = XPAR_XSDPS_0_HAS_CD;
-						WriteProtect = XPAR_XSDPS_0_HAS_WP;
+						Sd->BaseAddress = XPAR_XSDPS_0_BASEADDR;
+						Sd->CardDetect = XPAR_XSDPS_0_HAS_CD;
+						Sd->WriteProtect = XPAR_XSDPS_0_HAS_WP;
 #ifdef XPAR_XSDPS_1_DEVICE_ID
 				}
 #endif
-				HostCntrlrVer[pdrv] = (u8)(XSdPs_ReadReg16(BaseAddress,
+				Sd->HostCntrlrVer = (u8)(XSdPs_ReadReg16(Sd->BaseAddress,
 						XSDPS_HOST_CTRL_VER_OFFSET) & XSDPS_HC_SPEC_VER_MASK);
-				if (HostCntrlrVer[pdrv] == XSDPS_HC_SPEC_V3) {
-					SlotType[pdrv] = XSdPs_ReadReg(BaseAddress,
+				if (Sd->HostCntrlrVer == XSDPS_HC_SPEC_V3) {
+					Sd->SlotType = XSdPs_ReadReg(Sd->BaseAddress,
 							XSDPS_CAPS_OFFSET) & XSDPS_CAPS_SLOT_TYPE_MASK;
 				} else {
-					SlotType[pdrv] = 0;
+					Sd->SlotType = 0;
 				}
 		}
-		StatusReg = XSdPs_GetPresentStatusReg((u32)BaseAddress);
-		if (SlotType[pdrv] != XSDPS_CAPS_EMB_SLOT) {
-			if (CardDetect) {
+		StatusReg = XSdPs_GetPresentStatusReg((u32)Sd->BaseAddress);
+		if (Sd->SlotType != XSDPS_CAPS_EMB_SLOT) {
+			if (Sd->CardDetect) {
 				while ((StatusReg & XSDPS_PSR_CARD_INSRT_MASK) == 0U) {
 					if (DelayCount == 500U) {
 						s = STA_NODISK | STA_NOINIT;
@@ -211,12 +897,12 @@ DSTATUS disk_status (
 						/* Wait for 10 msec */
 						usleep(SD_CD_DELAY);
 						DelayCount++;
-						StatusReg = XSdPs_GetPresentStatusReg((u32)BaseAddress);
+						StatusReg = XSdPs_GetPresentStatusReg((u32)Sd->BaseAddress);
 					}
 				}
 			}
 			s &= ~STA_NODISK;
-			if (WriteProtect) {
+			if (Sd->WriteProtect) {
 					if ((StatusReg & XSDPS_PSR_WPS_PL_MASK) == 0U){
 						s |= STA_PROTECT;
 						goto Label;
@@ -230,6 +916,9 @@ DSTATUS disk_status (
 
 Label:
 		Stat[pdrv] = s;
+		DISK_UNLOCK(&Sd->Lock);
+#else
+		s = Stat[pdrv];
 #endif
 
 		return s;
@@ -265,6 +954,7 @@ DSTATUS disk_initialize (
 	s32 Status;
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	XSdPs_Config *SdConfig;
+	DiskSd *Sd;
 #endif
 
 	s = disk_status(pdrv);
@@ -278,7 +968,16 @@ DSTATUS disk_initialize (
 	}
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	if (CardDetect) {
+	Sd = &SdDrive[pdrv];
+	DISK_LOCK(&Sd->Lock);
+	/* Another volume of this drive may have initialized it meanwhile */
+	if ((Stat[pdrv] & STA_NOINIT) == 0U) {
+		s = Stat[pdrv];
+		DISK_UNLOCK(&Sd->Lock);
+		return s;
+	}
+
+	if (Sd->CardDetect) {
 			/*
 			 * Card detection check
 			 * If the HC detects the No Card State, power will be cleared
@@ -286,7 +985,7 @@ DSTATUS disk_initialize (
 			while(!((XSDPS_PSR_CARD_DPL_MASK |
 					XSDPS_PSR_CARD_STABLE_MASK |
 					XSDPS_PSR_CARD_INSRT_MASK) ==
-					( XSdPs_GetPresentStatusReg((u32)BaseAddress) &
+					( XSdPs_GetPresentStatusReg((u32)Sd->BaseAddress) &
 					(XSDPS_PSR_CARD_DPL_MASK |
 					XSDPS_PSR_CARD_STABLE_MASK |
 					XSDPS_PSR_CARD_INSRT_MASK))));
@@ -298,22 +997,44 @@ DSTATUS disk_initialize (
 	SdConfig = XSdPs_LookupConfig((u16)pdrv);
 	if (NULL == SdConfig) {
 		s |= STA_NOINIT;
+		DISK_UNLOCK(&Sd->Lock);
 		return s;
 	}
 
-	Status = XSdPs_CfgInitialize(&SdInstance[pdrv], SdConfig,
+#ifdef DISK_SD_ASYNC
+	/* The controller is reset, polled until set up again */
+	Sd->AsyncReady = 0U;
+#endif
+	Status = XSdPs_CfgInitialize(&Sd->Instance, SdConfig,
 					SdConfig->BaseAddress);
 	if (Status != XST_SUCCESS) {
 		s |= STA_NOINIT;
+		DISK_UNLOCK(&Sd->Lock);
 		return s;
 	}
 
-	Status = XSdPs_CardInitialize(&SdInstance[pdrv]);
+	DISK_LOCK(&SdInitLock);
+	Status = XSdPs_CardInitialize(&Sd->Instance);
+	DISK_UNLOCK(&SdInitLock);
 	if (Status != XST_SUCCESS) {
 		s |= STA_NOINIT;
+		DISK_UNLOCK(&Sd->Lock);
 		return s;
 	}
 
+#if _FS_AU_ALIGN
+	if (XSdPs_Get_AuSize(&Sd->Instance, &Sd->AuBlocks) != XST_SUCCESS) {
+		Sd->AuBlocks = 0U;
+	}
+	(void)XSdPs_SetWriteMode(&Sd->Instance,
+			XSDPS_WRITE_PRE_ERASE | XSDPS_WRITE_CMD23);
+#endif
+
+#ifdef DISK_CACHE_ENABLE
+	/* The card may have been swapped, nothing cached is valid anymore */
+	cache_invalidate(Sd);
+#endif
+
 
 	/*
 	 * Disk is initialized.
@@ -322,6 +1043,7 @@ DSTATUS disk_initialize (
 	s &= (~STA_NOINIT);
 
 	Stat[pdrv] = s;
+	DISK_UNLOCK(&Sd->Lock);
 #endif
 
 #ifdef FILE_SYSTEM_INTERFACE_RAM
@@ -368,8 +1090,10 @@ DRESULT disk_read (
 {
 	DSTATUS s;
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	s32 Status;
-	DWORD LocSector = sector;
+	DWORD LocSector;
+	u32 LocCount;
+	DiskSd *Sd;
+	DRESULT Res;
 #endif
 
 	s = disk_status(pdrv);
@@ -382,13 +1106,26 @@ DRESULT disk_read (
 	}
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	/* Convert LBA to byte address if needed */
-	if ((SdInstance[pdrv].HCS) == 0U) {
-		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+	/* Logical sectors to 512 byte card blocks */
+	LocSector = sector * SD_SECTOR_RATIO;
+	LocCount = (u32)count * SD_SECTOR_RATIO;
+	Sd = &SdDrive[pdrv];
+	DISK_LOCK(&Sd->Lock);
+#ifdef DISK_CACHE_ENABLE
+	if (LocCount < DISK_CACHE_BURST) {
+		Res = cache_read(Sd, buff, LocSector, LocCount);
+		DISK_UNLOCK(&Sd->Lock);
+		return Res;
 	}
-
-	Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-	if (Status != XST_SUCCESS) {
+#endif
+	Res = sd_transfer(Sd, LocSector, LocCount, buff, 0U);
+#ifdef DISK_CACHE_ENABLE
+	if (Res == RES_OK) {
+		cache_bypass(Sd, buff, LocSector, LocCount, 0U);
+	}
+#endif
+	DISK_UNLOCK(&Sd->Lock);
+	if (Res != RES_OK) {
 		return RES_ERROR;
 	}
 #endif
@@ -414,23 +1151,42 @@ DRESULT disk_ioctl (
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	void *LocBuff = buff;
+	DiskSd *Sd;
 	if ((disk_status(pdrv) & STA_NOINIT) != 0U) {	/* Check if card is in the socket */
 		return RES_NOTRDY;
 	}
+	Sd = &SdDrive[pdrv];
 
 	res = RES_ERROR;
 	switch (cmd) {
 		case (BYTE)CTRL_SYNC :	/* Make sure that no pending write process */
+#ifdef DISK_CACHE_ENABLE
+			DISK_LOCK(&Sd->Lock);
+			res = cache_flush(Sd);
+			DISK_UNLOCK(&Sd->Lock);
+#else
 			res = RES_OK;
+#endif
 			break;
 
 		case (BYTE)GET_SECTOR_COUNT : /* Get number of sectors on the disk (DWORD) */
-			(*((DWORD *)(void *)LocBuff)) = (DWORD)SdInstance[pdrv].SectorCount;
+			(*((DWORD *)(void *)LocBuff)) = (DWORD)Sd->Instance.SectorCount /
+					SD_SECTOR_RATIO;
+			res = RES_OK;
+			break;
+
+		case (BYTE)GET_SECTOR_SIZE : /* Get logical sector size (WORD) */
+			(*((WORD *)(void *)LocBuff)) = (WORD)SD_SECTOR_SIZE;
 			res = RES_OK;
 			break;
 
 		case (BYTE)GET_BLOCK_SIZE :	/* Get erase block size in unit of sector (DWORD) */
-			(*((DWORD *)((void *)LocBuff))) = ((DWORD)128);
+			if (Sd->AuBlocks >= SD_SECTOR_RATIO) {
+				(*((DWORD *)((void *)LocBuff))) = (DWORD)Sd->AuBlocks /
+						SD_SECTOR_RATIO;
+			} else {
+				(*((DWORD *)((void *)LocBuff))) = ((DWORD)128 / SD_SECTOR_RATIO);
+			}
 			res = RES_OK;
 			break;
 
@@ -471,12 +1227,31 @@ DRESULT disk_ioctl (
 *
 * @return	DWORD
 *
-* @note		None
+* @note		The time comes from gettimeofday when the BSP has a time
+*		source, Jan. 1, 2010 is returned otherwise.
 *
 ****************************************************************************/
 
 DWORD get_fattime (void)
 {
+#ifdef DISK_WALL_CLOCK
+	struct timeval Now;
+	struct tm Tm;
+	time_t Sec;
+
+	if (gettimeofday(&Now, NULL) == 0) {
+		Sec = Now.tv_sec;
+		if ((gmtime_r(&Sec, &Tm) != NULL) && (Tm.tm_year >= 80)) {
+			return	((DWORD)(Tm.tm_year - 80) << 25)
+				| ((DWORD)(Tm.tm_mon + 1) << 21)
+				| ((DWORD)Tm.tm_mday << 16)
+				| ((DWORD)Tm.tm_hour << 11)
+				| ((DWORD)Tm.tm_min << 5)
+				| ((DWORD)Tm.tm_sec >> 1);
+		}
+	}
+#endif
+
 	return	((DWORD)(2010U - 1980U) << 25U)	/* Fixed to Jan. 1, 2010 */
 		| ((DWORD)1 << 21)
 		| ((DWORD)1 << 16)
@@ -513,8 +1288,10 @@ DRESULT disk_write (
 {
 	DSTATUS s;
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	s32 Status;
-	DWORD LocSector = sector;
+	DWORD LocSector;
+	u32 LocCount;
+	DiskSd *Sd;
+	DRESULT Res;
 #endif
 
 	s = disk_status(pdrv);
@@ -526,16 +1303,28 @@ DRESULT disk_write (
 	}
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	/* Convert LBA to byte address if needed */
-	if ((SdInstance[pdrv].HCS) == 0U) {
-		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+	/* Logical sectors to 512 byte card blocks */
+	LocSector = sector * SD_SECTOR_RATIO;
+	LocCount = (u32)count * SD_SECTOR_RATIO;
+	Sd = &SdDrive[pdrv];
+	DISK_LOCK(&Sd->Lock);
+#ifdef DISK_CACHE_ENABLE
+	if (LocCount < DISK_CACHE_BURST) {
+		Res = cache_write(Sd, buff, LocSector, LocCount);
+		DISK_UNLOCK(&Sd->Lock);
+		return Res;
 	}
-
-	Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-	if (Status != XST_SUCCESS) {
+#endif
+	Res = sd_transfer(Sd, LocSector, LocCount, (BYTE *)buff, 1U);
+#ifdef DISK_CACHE_ENABLE
+	if (Res == RES_OK) {
+		cache_bypass(Sd, (BYTE *)buff, LocSector, LocCount, 1U);
+	}
+#endif
+	DISK_UNLOCK(&Sd->Lock);
+	if (Res != RES_OK) {
 		return RES_ERROR;
 	}
-
 #endif
 
 #ifdef FILE_SYSTEM_INTERFACE_RAM
@@ -1068,6 +1068,9 @@ FRESULT remove_chain (
 				fs->free_clust++;
 				fs->fsi_flag |= 1U;
 			}
+#if _FS_AU_ALIGN
+			fs->au_full = 0U;
+#endif
 #if _USE_ERASE
 			if (ecl + 1 == nxt) {	/* Is next cluster contiguous? */
 				ecl = nxt;
@@ -1160,6 +1163,87 @@ DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk err
 
 	return ncl;		/* Return new cluster number or error code */
 }
+
+
+
+
+#if _FS_AU_ALIGN
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Find a completely free erase block                     */
+/*-----------------------------------------------------------------------*/
+static
+DWORD find_free_au (	/* 0:None, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:First cluster# */
+	FATFS* fs,			/* File system object */
+	DWORD scl			/* Suggested start point */
+)
+{
+	DWORD nau, au, n, i, cl, cs;
+
+
+	if ((fs->au_full != 0U) || (fs->n_fatent <= fs->au_first)) {
+		return 0;
+	}
+	nau = (fs->n_fatent - fs->au_first) / fs->au_clust;	/* Whole erase blocks */
+	if (nau == 0U) {
+		return 0;
+	}
+
+	/* Start with the erase block following the suggested start point */
+	au = ((scl >= fs->au_first) && (scl < fs->n_fatent)) ?
+		(((scl - fs->au_first) / fs->au_clust) + 1U) : 0U;
+	for (n = 0U; n < nau; n++) {
+		if (au >= nau) {
+			au = 0U;
+		}
+		cl = fs->au_first + (au * fs->au_clust);
+		for (i = 0U; i < fs->au_clust; i++) {
+			cs = get_fat(fs, cl + i);
+			if ((cs == 0xFFFFFFFFU) || (cs == 1U)) {
+				return cs;
+			}
+			if (cs != 0U) {
+				break;
+			}
+		}
+		if (i == fs->au_clust) {
+			return cl;			/* Found a free erase block */
+		}
+		au++;
+	}
+
+	fs->au_full = 1U;			/* Do not scan again until clusters are freed */
+	return 0;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Create a new chain starting an erase block if possible */
+/*-----------------------------------------------------------------------*/
+static
+DWORD create_chain_au (	/* As create_chain() */
+	FATFS* fs			/* File system object */
+)
+{
+	DWORD cl;
+
+
+	if (fs->au_clust > 1U) {
+		cl = find_free_au(fs, fs->last_clust);
+		if ((cl == 0xFFFFFFFFU) || (cl == 1U)) {
+			return cl;
+		}
+		if (cl != 0U) {
+			fs->last_clust = cl - 1U;	/* Make create_chain() start there */
+		}
+	}
+
+	return create_chain(fs, 0U);
+}
+#else
+#define create_chain_au(fs)	create_chain((fs), 0U)
+#endif
 #endif /* !_FS_READONLY */
 
 
@@ -1193,11 +1277,113 @@ DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 	}
 	return cl + *tbl;	/* Return the cluster number */
 }
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Build the cluster link map table of a file             */
+/*-----------------------------------------------------------------------*/
+
+static
+FRESULT create_clmt (
+	FIL* fp			/* Pointer to the file object with cltbl set */
+)
+{
+	DWORD cl, pcl, ncl, tcl, tlen, ulen, *tbl;
+	FRESULT res = FR_OK;
+
+
+	tbl = fp->cltbl;
+	tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
+	cl = fp->sclust;			/* Top of the chain */
+	if (cl) {
+		do {
+			/* Get a fragment */
+			tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
+			do {
+				pcl = cl; ncl++;
+				cl = get_fat(fp->fs, cl);
+				if (cl <= 1) {
+					return FR_INT_ERR;
+				}
+				if (cl == 0xFFFFFFFF) {
+					return FR_DISK_ERR;
+				}
+			} while (cl == pcl + 1);
+			if (ulen <= tlen) {		/* Store the length and top of the fragment */
+				*tbl++ = ncl; *tbl++ = tcl;
+			}
+		} while (cl < fp->fs->n_fatent);	/* Repeat until end of chain */
+	}
+	*fp->cltbl = ulen;	/* Number of items used */
+	if (ulen <= tlen) {
+		*tbl = 0;		/* Terminate table */
+	}
+	else {
+		res = FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
+	}
+
+	return res;
+}
 #endif	/* _USE_FASTSEEK */
 
 
 
 
+/*-----------------------------------------------------------------------*/
+/* File access - Count sectors contiguous on the disk from fptr          */
+/*-----------------------------------------------------------------------*/
+/* fptr is on a sector boundary in fp->clust. The chain is followed (or
+/  stretched on write) while the next cluster is adjacent to the current one,
+/  so a run of contiguous clusters can go out as one disk request. */
+
+static
+UINT contig_sect (	/* Number of sectors to transfer (1..cc) */
+	FIL* fp,		/* Pointer to the file object */
+	UINT csect,		/* Sector offset of fptr in the current cluster */
+	UINT cc,		/* Number of sectors wanted */
+	BYTE stretch	/* 1: Stretch the chain if needed */
+)
+{
+	DWORD clst, nclst, ofs;
+	UINT n;
+
+
+	clst = fp->clust;
+	n = (UINT)fp->fs->csize - csect;
+	ofs = fp->fptr + ((DWORD)n * SS(fp->fs));	/* Offset of the next cluster */
+	while (n < cc) {
+#if _USE_FASTSEEK
+		if (fp->cltbl) {
+			nclst = clmt_clust(fp, ofs);	/* Get cluster# from the CLMT */
+		}
+		else
+#endif
+#if !_FS_READONLY
+		if (stretch != (BYTE)0U) {
+			nclst = create_chain(fp->fs, clst);	/* Follow or stretch cluster chain on the FAT */
+		}
+		else
+#endif
+		{
+			nclst = get_fat(fp->fs, clst);	/* Follow cluster chain on the FAT */
+		}
+		if (nclst != (clst + 1U)) {
+			break;	/* Fragmented or error, the caller follows the chain from here */
+		}
+		clst = nclst;
+		n += (UINT)fp->fs->csize;
+		ofs += (DWORD)fp->fs->csize * SS(fp->fs);
+	}
+	(void)stretch;
+
+	return (n < cc) ? n : cc;
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Set directory index                              */
 /*-----------------------------------------------------------------------*/
@@ -2443,6 +2629,9 @@ FRESULT find_volume (	/* FR_OK(0): successful, !=0: any error occurred */
 	DWORD bsect, fasize, tsect, sysect, nclst, szbfat;
 	WORD nrsv;
 	FATFS *fs;
+#if _FS_AU_ALIGN && !_FS_READONLY
+	DWORD ausize;
+#endif
 
 
 	/* Get logical drive number from the path name */
@@ -2597,6 +2786,19 @@ FRESULT find_volume (	/* FR_OK(0): successful, !=0: any error occurred */
 	/* Initialize cluster allocation information */
 	fs->last_clust = 0xFFFFFFFFU;
 	fs->free_clust = 0xFFFFFFFFU;
+#if _FS_AU_ALIGN
+	/* Erase block alignment of the data area, if clusters fit into it */
+	fs->au_clust = 0U;
+	fs->au_first = 2U;
+	fs->au_full = 0U;
+	if ((disk_ioctl(fs->drv, GET_BLOCK_SIZE, &ausize) == RES_OK) &&
+		(ausize > (DWORD)fs->csize) && ((ausize % fs->csize) == 0U) &&
+		(((fs->database % ausize) % fs->csize) == 0U)) {
+		fs->au_clust = ausize / fs->csize;
+		fs->au_first = 2U + (((ausize - (fs->database % ausize)) % ausize) /
+			fs->csize);
+	}
+#endif
 
 	/* Get fsinfo if available */
 	fs->fsi_flag = 0x80U;
@@ -2864,6 +3066,24 @@ FRESULT f_open (
 #endif
 			fp->fs = dj.fs;	 					/* Validate file object */
 			fp->id = fp->fs->id;
+#if _FS_AUTO_LINKMAP
+#if !_FS_READONLY
+			if (((mode & FA_WRITE) == (BYTE)0U) && (fp->sclust != 0U)) {
+#else
+			if (fp->sclust != 0U) {
+#endif
+				fp->linkmap[0] = _FS_LINKMAP_SIZE;
+				fp->cltbl = fp->linkmap;		/* Fast seek mode */
+				res = create_clmt(fp);
+				if (res == FR_NOT_ENOUGH_CORE) {
+					fp->cltbl = 0;				/* Too fragmented, stay in normal mode */
+					res = FR_OK;
+				}
+				if (res != FR_OK) {
+					fp->fs = 0;					/* Invalidate file object */
+				}
+			}
+#endif
 		}
 	}
 
@@ -2937,12 +3157,11 @@ FRESULT f_read (
 			sect += csect;
 			cc = btr / SS(fp->fs);				/* When remaining bytes >= sector size, */
 			if (cc != 0U) {							/* Read maximum contiguous sectors directly */
-				if ((csect + cc) > fp->fs->csize) {	/* Clip at cluster boundary */
-					cc = (UINT)(fp->fs->csize - csect);
-				}
-				if (disk_read(fp->fs->drv, rbuff, sect, (BYTE)cc) != RES_OK) {
+				cc = contig_sect(fp, (UINT)csect, cc, 0U);	/* Clip at the end of the contiguous run */
+				if (disk_read(fp->fs->drv, rbuff, sect, cc) != RES_OK) {
 					ABORT(fp->fs, FR_DISK_ERR);
 				}
+				fp->clust += (DWORD)(((UINT)csect + cc - 1U) / (UINT)fp->fs->csize);	/* Cluster of the last sector read */
 #if !_FS_READONLY && _FS_MINIMIZE <= 2			/* Replace one of the read sectors with cached data if it contains a dirty sector */
 #if _FS_TINY
 				if ((fp->fs->wflag != 0U) && (((fp->fs->winsect - sect) < cc) != 0U)) {
@@ -3039,7 +3258,7 @@ FRESULT f_write (
 				if (fp->fptr == 0U) {		/* On the top of the file? */
 					clst = fp->sclust;		/* Follow from the origin */
 					if (clst == 0U)	{		/* When no cluster is allocated, */
-						clst = create_chain(fp->fs, 0U);	/* Create a new cluster chain */
+						clst = create_chain_au(fp->fs);	/* Create a new cluster chain */
 					}
 				} else {					/* Middle or end of the file */
 #if _USE_FASTSEEK
@@ -3082,12 +3301,11 @@ FRESULT f_write (
 			sect += csect;
 			cc = LocBtw / SS(fp->fs);			/* When remaining bytes >= sector size, */
 			if (cc != 0U) {						/* Write maximum contiguous sectors directly */
-				if ((csect + cc) > fp->fs->csize) {	/* Clip at cluster boundary */
-					cc = (UINT)(fp->fs->csize - csect);
-				}
-				if (disk_write(fp->fs->drv, wbuff, sect, (BYTE)cc) != RES_OK) {
+				cc = contig_sect(fp, (UINT)csect, cc, 1U);	/* Clip at the end of the contiguous run */
+				if (disk_write(fp->fs->drv, wbuff, sect, cc) != RES_OK) {
 					ABORT(fp->fs, FR_DISK_ERR);
 				}
+				fp->clust += (DWORD)(((UINT)csect + cc - 1U) / (UINT)fp->fs->csize);	/* Cluster of the last sector written */
 #if _FS_MINIMIZE <= 2
 #if _FS_TINY
 				if ((fp->fs->winsect - sect) < cc) {	/* Refill sector cache if it gets invalidated by the direct write */
@@ -3416,37 +3634,12 @@ FRESULT f_lseek (
 
 #if _USE_FASTSEEK
 	if (fp->cltbl) {	/* Fast seek */
-		DWORD cl, pcl, ncl, tcl, dsc, tlen, ulen, *tbl;
+		DWORD dsc;
 
 		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
-			tbl = fp->cltbl;
-			tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
-			cl = fp->sclust;			/* Top of the chain */
-			if (cl) {
-				do {
-					/* Get a fragment */
-					tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
-					do {
-						pcl = cl; ncl++;
-						cl = get_fat(fp->fs, cl);
-						if (cl <= 1) {
-							ABORT(fp->fs, FR_INT_ERR);
-						}
-						if (cl == 0xFFFFFFFF) {
-							ABORT(fp->fs, FR_DISK_ERR);
-						}
-					} while (cl == pcl + 1);
-					if (ulen <= tlen) {		/* Store the length and top of the fragment */
-						*tbl++ = ncl; *tbl++ = tcl;
-					}
-				} while (cl < fp->fs->n_fatent);	/* Repeat until end of chain */
-			}
-			*fp->cltbl = ulen;	/* Number of items used */
-			if (ulen <= tlen) {
-				*tbl = 0;		/* Terminate table */
-			}
-			else {
-				res = FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
+			res = create_clmt(fp);
+			if ((res != FR_OK) && (res != FR_NOT_ENOUGH_CORE)) {
+				ABORT(fp->fs, res);
 			}
 
 		} else {						/* Fast seek */
@@ -3507,7 +3700,7 @@ FRESULT f_lseek (
 				clst = fp->sclust;						/* start from the first cluster */
 #if !_FS_READONLY
 				if (clst == 0U) {						/* If no cluster chain, create a new chain */
-					clst = create_chain(fp->fs, 0U);
+					clst = create_chain_au(fp->fs);
 					if (clst == 1U) {
 						ABORT(fp->fs, FR_INT_ERR);
 					}
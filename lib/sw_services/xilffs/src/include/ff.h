@@ -93,6 +93,11 @@ typedef struct {
 #if !_FS_READONLY
 	DWORD	last_clust;		/* Last allocated cluster */
 	DWORD	free_clust;		/* Number of free clusters */
+#if _FS_AU_ALIGN
+	DWORD	au_clust;		/* Clusters per erase block (0:No alignment) */
+	DWORD	au_first;		/* First cluster starting an erase block */
+	BYTE	au_full;		/* No free erase block since the last scan */
+#endif
 #endif
 #if _FS_RPATH
 	DWORD	cdir;			/* Current directory start cluster (0:root) */
@@ -134,6 +139,9 @@ typedef struct {
 #if _USE_FASTSEEK
 	DWORD*	cltbl;			/* Pointer to the cluster link map table (Nulled on file open) */
 #endif
+#if _FS_AUTO_LINKMAP
+	DWORD	linkmap[_FS_LINKMAP_SIZE];	/* Cluster link map built by f_open() */
+#endif
 #if _FS_LOCK
 	UINT	lockid;			/* File lock ID origin from 1 (index of file semaphore table Files[]) */
 #endif
@@ -57,8 +57,29 @@ extern "C" {
 /* To enable f_mkfs() function, set _USE_MKFS to 1 and set _FS_READONLY to 0 */
 
 
+#ifdef FILE_SYSTEM_AUTO_LINKMAP
+#define	_USE_FASTSEEK	1
+#define	_FS_AUTO_LINKMAP	1
+#define	_FS_LINKMAP_SIZE	32	/* Items in the per file link map (up to 15 fragments) */
+#else
 #define	_USE_FASTSEEK	0	/* 0:Disable or 1:Enable */
-/* To enable fast seek feature, set _USE_FASTSEEK to 1. */
+#define	_FS_AUTO_LINKMAP	0
+#endif
+
+#ifdef FILE_SYSTEM_AU_ALIGN
+#define	_FS_AU_ALIGN	1
+#else
+#define	_FS_AU_ALIGN	0	/* 0:Disable or 1:Enable */
+#endif
+/* When _FS_AU_ALIGN is 1, the first cluster of a file is taken from a
+/  completely free erase block (disk_ioctl() GET_BLOCK_SIZE, the allocation
+/  unit of SD cards) when the volume has one, so sequentially written files
+/  fill whole erase blocks. Other allocations are not affected. */
+/* To enable fast seek feature, set _USE_FASTSEEK to 1.
+/  When _FS_AUTO_LINKMAP is 1, f_open() builds the cluster link map of files
+/  opened without FA_WRITE into the file object, so f_read() and f_lseek() work
+/  in fast seek mode without a user supplied table. Files with more fragments
+/  than the map can hold fall back to normal mode. */
 
 
 #define _USE_LABEL		0	/* 0:Disable or 1:Enable */
@@ -200,8 +221,13 @@ extern "C" {
 */
 
 
+#ifdef FILE_SYSTEM_SECTOR_SIZE
+#define	_MIN_SS		FILE_SYSTEM_SECTOR_SIZE
+#define	_MAX_SS		FILE_SYSTEM_SECTOR_SIZE
+#else
 #define	_MIN_SS		512U
 #define	_MAX_SS		512U
+#endif
 /* These options configure the range of sector size to be supported. (512, 1024, 2048 or
 /  4096) Always set both 512 for most systems, all memory card and harddisk. But a larger
 /  value may be required for on-board flash memory and some type of optical media.
@@ -237,9 +263,17 @@ extern "C" {
 /  with file lock control. This feature uses bss _FS_LOCK * 12 bytes. */
 
 
+#ifdef FILE_SYSTEM_FS_REENTRANT
+#include "FreeRTOS.h"
+#include "semphr.h"
+#define _FS_REENTRANT	1
+#define _FS_TIMEOUT		1000
+#define	_SYNC_t			SemaphoreHandle_t
+#else
 #define _FS_REENTRANT	0		/* 0:Disable or 1:Enable */
 #define _FS_TIMEOUT		1000	/* Timeout period in unit of time tick */
 #define	_SYNC_t			HANDLE	/* O/S dependent sync object type. e.g. HANDLE, OS_EVENT*, ID, SemaphoreHandle_t and etc.. */
+#endif
 /* The _FS_REENTRANT option switches the re-entrancy (thread safe) of the FatFs module.
 /
 /   0: Disable re-entrancy. _FS_TIMEOUT and _SYNC_t have no effect.
@@ -0,0 +1,134 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file syscall.c
+*		OS dependent synchronization functions of FatFs for
+*		_FS_REENTRANT builds on FreeRTOS. Each volume gets a mutex
+*		that FatFs takes for the duration of every file system call
+*		on that volume, so calls on different volumes run in
+*		parallel.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.8   ag   10/14/26 First release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+#include "ff.h"
+
+#if _FS_REENTRANT
+
+/*****************************************************************************/
+/**
+*
+* Creates the sync object of a volume. Called from f_mount().
+*
+* @param	vol - Logical drive number
+* @param	sobj - Pointer to return the created sync object
+*
+* @return	1 on success, 0 if the mutex could not be created
+*
+******************************************************************************/
+int ff_cre_syncobj (
+	BYTE vol,
+	_SYNC_t* sobj
+)
+{
+	(void)vol;
+
+	*sobj = xSemaphoreCreateMutex();
+
+	return (*sobj != NULL) ? 1 : 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Deletes the sync object of a volume. Called from f_mount().
+*
+* @param	sobj - Sync object
+*
+* @return	1
+*
+******************************************************************************/
+int ff_del_syncobj (
+	_SYNC_t sobj
+)
+{
+	vSemaphoreDelete(sobj);
+
+	return 1;
+}
+
+/*****************************************************************************/
+/**
+*
+* Takes the sync object of a volume, waiting up to _FS_TIMEOUT ticks.
+*
+* @param	sobj - Sync object
+*
+* @return	1 if the volume was granted, 0 on timeout
+*
+******************************************************************************/
+int ff_req_grant (
+	_SYNC_t sobj
+)
+{
+	return (xSemaphoreTake(sobj, (TickType_t)_FS_TIMEOUT) == pdTRUE) ? 1 : 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Releases the sync object of a volume.
+*
+* @param	sobj - Sync object
+*
+* @return	None
+*
+******************************************************************************/
+void ff_rel_grant (
+	_SYNC_t sobj
+)
+{
+	(void)xSemaphoreGive(sobj);
+}
+
+#endif
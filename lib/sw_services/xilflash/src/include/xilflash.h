@@ -96,6 +96,14 @@
 * the control is returned back to user only after the write operation is
 * completed successfully or an error is reported.
 *
+* <b>Erase and Write Operation</b>
+*
+* XFlash_EraseWrite() erases the blocks covering a range and programs the range
+* in one call. On Intel multi-bank parts that allow programming in one bank
+* while another bank erases, the blocks of the next bank are erased while the
+* current bank is being programmed. Other parts erase the range and then
+* program it, as XFlash_Erase() followed by XFlash_Write() would.
+*
 * <b>Read Operation</b>
 *
 * The read call can be used to read a minimum of zero bytes and maximum of
@@ -218,6 +226,10 @@
 *                     _example.c to canonical name (CR 808007)
 * 4.3   ms   01/17/17 Fixed compilation warnings.
 * 4.4   ms   08/03/17 Added doxygen tags.
+* 4.4   ag   10/14/26 Added XFlash_EraseWrite() and the EraseWrite VTable
+*		      entry. Buffered programming of AMD parts uses the full
+*		      CFI write buffer size, and page mode parts are read with
+*		      wider accesses.
 *
 * </pre>
 *
@@ -500,6 +512,9 @@ typedef struct XFlashTag {
 		int (*DeviceControl) (struct XFlashTag * InstancePtr,
 					u32 Command, DeviceCtrlParam
 					*Parameters);
+
+		int (*EraseWrite) (struct XFlashTag * InstancePtr, u32 Offset,
+				u32 Bytes, void *SrcPtr);
 	} VTable;
 	XFlashCommandSet Command;	/* Flash Specific Commands */
 } XFlash;
@@ -641,6 +656,8 @@ int XFlash_DeviceControl(XFlash * InstancePtr, u32 Command,
 int XFlash_Read(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *DestPtr);
 int XFlash_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *SrcPtr);
 int XFlash_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlash_EraseWrite(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+		      void *SrcPtr);
 int XFlash_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlash_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlash_IsReady(XFlash * InstancePtr);
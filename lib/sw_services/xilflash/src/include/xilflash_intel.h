@@ -62,6 +62,7 @@
 *		      fixes the CR 662317.
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
+* 4.4   ag   10/14/26 Added XFlashIntel_EraseWrite().
 *
 * </pre>
 *
@@ -267,6 +268,9 @@ int XFlashIntel_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes,
 
 int XFlashIntel_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 
+int XFlashIntel_EraseWrite(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+			   void *SrcPtr);
+
 int XFlashIntel_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashIntel_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashIntel_GetStatus(XFlash * InstancePtr, u32 Offset);
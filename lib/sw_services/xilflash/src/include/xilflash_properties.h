@@ -57,6 +57,8 @@
 *		      fixes the CR 662317.
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
+* 4.4   ag   10/14/26 Added BankOpsWhileErase to XFlashProgCap and the
+*		      XFlashReadCap structure.
 * </pre>
 *
 ***************************************************************************/
@@ -112,8 +114,21 @@ typedef struct {
 	u32 WriteBufferAlignmentMask;	/**< Alignment of the write buffer */
 	u32 EraseQueueSize;		/**< Number of erase blocks that can be
 					  *  queued up at once */
+	u32 BankOpsWhileErase;		/**< Number of program operations
+					  *  other banks accept while a bank
+					  *  is erasing. Zero if the part can
+					  *  not overlap them */
 } XFlashProgCap;
 
+/**
+ * Read parameters
+ */
+typedef struct {
+	u32 PageSize;			/**< Number of bytes read in one page
+					  *  mode burst. Zero if page mode is
+					  *  not supported */
+} XFlashReadCap;
+
 /**
  * Consolidated parameters
  */
@@ -122,6 +137,7 @@ typedef struct {
 	XFlashTiming TimeTypical;	/**< Typical timing data */
 	XFlashTiming TimeMax;		/**< Worst case timing data */
 	XFlashProgCap ProgCap;		/**< Programming capabilities */
+	XFlashReadCap ReadCap;		/**< Read capabilities */
 } XFlashProperties;
 
 /**
@@ -65,6 +65,7 @@
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
 * 4.4   ms   08/03/17 Added tags and modified comment lines style for doxygen.
+* 4.4   ag   10/14/26 Added XFlash_EraseWrite().
 * </pre>
 *
 *
@@ -319,6 +320,72 @@ int XFlash_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 	return (InstancePtr->VTable.Erase(InstancePtr, Offset, Bytes));
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* This function erases the blocks covering the specified address range and
+* then programs the range with data specified in the user buffer.
+*
+* When the device family supports it, the erase of blocks in one bank runs
+* while blocks already erased in another bank are being programmed. Otherwise
+* the range is erased with XFlash_Erase() and programmed with XFlash_Write().
+*
+* The device is polled until an error or the operation completes successfully.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+* @param	Offset		Offset into the device(s) address space from
+*				which to begin erasure and programming. Must
+*				be aligned to the width of the flash's data
+*				bus.
+* @param	Bytes		Number of bytes to program.
+* @param	SrcPtr		Source address containing data to be
+*				programmed. Must be aligned to the width of
+*				the flash's data bus.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XFLASH_ADDRESS_ERROR if the destination address range is
+*		  not completely within the addressable areas of the device(s).
+*		- XFLASH_ERROR if an erase or write error occurred. When this
+*		  error is returned, it is possible that the target address
+*		  range was only partially erased or programmed.
+*
+* @note		Due to flash memory design, the range actually erased may be
+*		larger than what was specified by the Offset & Bytes parameters.
+*		This will occur if the parameters do not align to block
+*		boundaries.
+*
+******************************************************************************/
+int XFlash_EraseWrite(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+		      void *SrcPtr)
+{
+	int Status;
+
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if(InstancePtr->IsReady != XIL_COMPONENT_IS_READY) {
+		return XST_FAILURE;
+	}
+
+	if (InstancePtr->VTable.EraseWrite != NULL) {
+		return (InstancePtr->VTable.EraseWrite(InstancePtr, Offset,
+							Bytes, SrcPtr));
+	}
+
+	if (Bytes == 0) {
+		return (XST_SUCCESS);
+	}
+
+	Status = InstancePtr->VTable.Erase(InstancePtr, Offset, Bytes);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	return (InstancePtr->VTable.Write(InstancePtr, Offset, Bytes, SrcPtr));
+}
+
 /*****************************************************************************/
 /**
 * @brief
@@ -661,6 +728,7 @@ static int SetVTable(XFlash * InstancePtr)
 			InstancePtr->VTable.Reset = XFlashIntel_Reset;
 			InstancePtr->VTable.DeviceControl =
 						XFlashIntel_DeviceControl;
+			InstancePtr->VTable.EraseWrite = XFlashIntel_EraseWrite;
 			break;
 #endif /* XPAR_XFL_DEVICE_FAMILY_INTEL */
 
@@ -677,6 +745,7 @@ static int SetVTable(XFlash * InstancePtr)
 			InstancePtr->VTable.Reset = XFlashAmd_Reset;
 			InstancePtr->VTable.DeviceControl =
 						XFlashAmd_DeviceControl;
+			InstancePtr->VTable.EraseWrite = NULL;
 			break;
 #endif /* XPAR_XFL_DEVICE_FAMILY_AMD */
 
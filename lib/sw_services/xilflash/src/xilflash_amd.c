@@ -80,6 +80,11 @@
 *		      of erase regions is not more than 1.
 * 4.1	nsk  06/06/12 Updated Spansion WriteBuffer programming.
 *		      (CR 781697).
+* 4.4   ag   10/14/26 16 bit parts advertising a write buffer are programmed
+*		      with buffered writes whatever the manufacturer. Buffers
+*		      no longer cross a write buffer boundary, and an odd
+*		      trailing byte is now programmed.
+*		      Reads use 32 bit accesses on parts with page mode.
 * </pre>
 *
 ******************************************************************************/
@@ -195,7 +200,7 @@ int WriteSingleBuffer(XFlash * InstancePtr, void *DestPtr,
 			 void *SrcPtr, u32 Bytes);
 static int WriteBufferAmd(XFlash * InstancePtr, void *DestPtr,
                          void *SrcPtr, u32 Bytes);
-static int WriteBufferSpansion(XFlash * InstancePtr, void *DestPtr,
+static int WriteBufferPages(XFlash * InstancePtr, void *DestPtr,
                          void *SrcPtr, u32 Bytes);
 void AmdDevice_is_Ready(XFlash * InstancePtr);
 
@@ -464,6 +469,8 @@ int XFlashAmd_Read(XFlash *InstancePtr, u32 Offset, u32 Bytes, void *DestPtr)
 	u8 *Src8BitPtr;
 	u16 *Dest16BitPtr;
 	u16 *Src16BitPtr;
+	u32 *Dest32BitPtr;
+	u32 *Src32BitPtr;
 	u32  PartMode;
 	u32 Index;
 	u32 Startoffset;
@@ -543,6 +550,23 @@ int XFlashAmd_Read(XFlash *InstancePtr, u32 Offset, u32 Bytes, void *DestPtr)
 		Src16BitPtr = (u16*) (((volatile u16*) InstancePtr->Geometry.
 				       BaseAddress) + Startoffset);
 		Dest16BitPtr = (u16*) DestPtr;
+
+		/*
+		 * Parts with page mode return the following words of a page
+		 * without the initial access time, so read two words per
+		 * access to keep the bus on sequential addresses.
+		 */
+		if ((InstancePtr->Properties.ReadCap.PageSize != 0) &&
+		    ((((u32)Src16BitPtr | (u32)Dest16BitPtr) & 3) == 0)) {
+			Src32BitPtr = (u32*) Src16BitPtr;
+			Dest32BitPtr = (u32*) Dest16BitPtr;
+			for (Index = 0; Index < (Bytes/4); Index++) {
+				Dest32BitPtr[Index] = Src32BitPtr[Index];
+			}
+			Src16BitPtr += (Bytes/4) * 2;
+			Dest16BitPtr += (Bytes/4) * 2;
+			Bytes &= 3;
+		}
 		for (Index = 0; Index < (Bytes/2); Index++) {
 			Dest16BitPtr[Index] = Src16BitPtr[Index];
 		}
@@ -1630,8 +1654,8 @@ static int WriteBuffer16(XFlash * InstancePtr, void *DestPtr,
 		return (XFLASH_ALIGNMENT_ERROR);
 	}
 
-	if (InstancePtr->Properties.PartID.ManufacturerID == 0x01)
-		Status = WriteBufferSpansion(InstancePtr,DestPtr,SrcPtr,Bytes);
+	if (InstancePtr->Properties.ProgCap.WriteBufferSize != 0)
+		Status = WriteBufferPages(InstancePtr,DestPtr,SrcPtr,Bytes);
 	else
 		Status = WriteBufferAmd(InstancePtr,DestPtr,SrcPtr,Bytes);
 
@@ -1642,9 +1666,13 @@ static int WriteBuffer16(XFlash * InstancePtr, void *DestPtr,
 /*****************************************************************************/
 /**
 *
-* This function is used to program Spansion devices. It does not erase
-* the flash first and will fail if the block(s) are not erased first. The
-* device(s) are programmed in parallel.
+* This function is used to program devices with a write buffer. It does not
+* erase the flash first and will fail if the block(s) are not erased first.
+* The device(s) are programmed in parallel.
+*
+* The data is split into chunks that do not cross a write buffer boundary, so
+* that every chunk is programmed with a single buffered write of up to the
+* full write buffer size reported by CFI.
 *
 * @param	InstancePtr is the instance to work on.
 * @param	DestPtr is the physical destination address in flash memory
@@ -1660,38 +1688,35 @@ static int WriteBuffer16(XFlash * InstancePtr, void *DestPtr,
 * @note		None.
 *
 ******************************************************************************/
-static int WriteBufferSpansion(XFlash * InstancePtr, void *DestPtr,
+static int WriteBufferPages(XFlash * InstancePtr, void *DestPtr,
                          void *SrcPtr, u32 Bytes)
 {
-       u32 DestinationPtr = (u32)DestPtr;
-       u32 BaseAddress= InstancePtr->Geometry.BaseAddress;
-       u16* Tempsrcptr = (u16 *)SrcPtr;
-       u32 Index = 0;
-       int Status = XST_SUCCESS;
-       XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
-       u32 BufferSize = InstancePtr->Properties.ProgCap.WriteBufferSize;
-
-	while (Bytes != 0)
-	{
-		/* Bytes to write should not exceed the buffer size. */
-		if (Bytes > BufferSize)
-		{
-			Status = WriteSingleBuffer(InstancePtr, DestPtr,
-						Tempsrcptr, BufferSize);
-			Bytes = Bytes - BufferSize;
-			DestPtr = DestPtr + BufferSize;
-			Tempsrcptr = Tempsrcptr + BufferSize/2;
-		}
-		else
-		{
-			Status = WriteSingleBuffer(InstancePtr, DestPtr,
-						Tempsrcptr, Bytes);
-			Bytes = 0;
+	u32 DestinationPtr = (u32)DestPtr;
+	u16 *Tempsrcptr = (u16 *)SrcPtr;
+	int Status = XST_SUCCESS;
+	u32 BufferSize = InstancePtr->Properties.ProgCap.WriteBufferSize;
+	u32 Chunk;
+
+	while (Bytes != 0) {
+		/*
+		 * Bytes to write should not exceed the buffer size, nor
+		 * cross a write buffer boundary.
+		 */
+		Chunk = BufferSize - (DestinationPtr &
+			InstancePtr->Properties.ProgCap.WriteBufferAlignmentMask);
+		if (Chunk > Bytes) {
+			Chunk = Bytes;
 		}
-		if (Status != XST_SUCCESS)
-		{
+
+		Status = WriteSingleBuffer(InstancePtr, (void *)DestinationPtr,
+					Tempsrcptr, Chunk);
+		if (Status != XST_SUCCESS) {
 			return Status;
 		}
+
+		Bytes -= Chunk;
+		DestinationPtr += Chunk;
+		Tempsrcptr += Chunk / 2;
 	}
 	return Status;
 }
@@ -1783,7 +1808,10 @@ static int WriteBufferAmd(XFlash * InstancePtr, void *DestPtr,
 *		- XFLASH_ERROR if a write error occurred. This error is
 *		  usually device specific.
 *
-* @note		None.
+* @note		The range must not cross a write buffer boundary. An odd
+*		trailing byte is programmed with 0xFF in the other half of the
+*		last word. The status register commands are only sent to
+*		Spansion parts.
 *
 ******************************************************************************/
 int WriteSingleBuffer(XFlash * InstancePtr, void *DestPtr,
@@ -1796,7 +1824,7 @@ int WriteSingleBuffer(XFlash * InstancePtr, void *DestPtr,
 	int Status = XST_SUCCESS;
 	XFlashVendorData_Amd *DevDataPtr;
 	u32 SectorAddress;
-	u32 WordCount = Bytes/2;
+	u32 WordCount = (Bytes + 1)/2;
 	u16 StartRegion;
 	u16 EndRegion;
 	u16 StartBlock;
@@ -1816,12 +1844,14 @@ int WriteSingleBuffer(XFlash * InstancePtr, void *DestPtr,
 	BaseAddress = InstancePtr->Geometry.BaseAddress;
 	DestinationPtr = DestinationPtr/2;
 
-	/* Wait until device is ready. */
-	AmdDevice_is_Ready(InstancePtr);
+	if (InstancePtr->Properties.PartID.ManufacturerID == 0x01) {
+		/* Wait until device is ready. */
+		AmdDevice_is_Ready(InstancePtr);
 
-	/* Send Status Register Clear Command. */
-	DevDataPtr->SendCmd(BaseAddress,XFL_AMD_CMD1_ADDR,
-				XFL_AMD_CMD_STATUS_REG_CLEAR);
+		/* Send Status Register Clear Command. */
+		DevDataPtr->SendCmd(BaseAddress,XFL_AMD_CMD1_ADDR,
+					XFL_AMD_CMD_STATUS_REG_CLEAR);
+	}
 	/* Send two Unlock cycles Commands. */
 	DevDataPtr->SendCmdSeq(BaseAddress,
 				XFL_AMD_CMD1_ADDR, XFL_AMD_CMD2_ADDR,
@@ -1835,7 +1865,7 @@ int WriteSingleBuffer(XFlash * InstancePtr, void *DestPtr,
 	Index = 0;
 
 	/* Write Data to Buffer. */
-	while (WordCount != 0) {
+	while (WordCount > 1) {
 		DevDataPtr->WriteFlash(BaseAddress,
 				(u32)DestinationPtr, SourcePtr[Index]);
 		DestinationPtr++;
@@ -1843,6 +1873,22 @@ int WriteSingleBuffer(XFlash * InstancePtr, void *DestPtr,
 		WordCount -= 1;
 	}
 
+	/* Last word, padded when only one byte of it is left. */
+	if ((Bytes & 1) != 0) {
+#ifdef XPAR_AXI_EMC
+		DevDataPtr->WriteFlash(BaseAddress, (u32)DestinationPtr,
+				0xFF00 | SourcePtr[Index]);
+#else
+		DevDataPtr->WriteFlash(BaseAddress, (u32)DestinationPtr,
+				0x00FF | SourcePtr[Index]);
+#endif
+	}
+	else {
+		DevDataPtr->WriteFlash(BaseAddress,
+				(u32)DestinationPtr, SourcePtr[Index]);
+	}
+	DestinationPtr++;
+
 	/* Send Write buffer program confirm command. */
 	DevDataPtr->WriteFlash(BaseAddress,(SectorAddress/2),
 				XFL_AMD_CMD_PROGRAM_BUFFER);
@@ -84,6 +84,9 @@
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
 * 3.04a srt  02/18/13 Fixed CR 700553.
+* 4.4   ag   10/14/26 Read the page mode type of AMD parts and the number of
+*		      program operations Intel multi-bank parts allow in other
+*		      banks while a bank is erasing.
 * </pre>
 *
 *
@@ -535,12 +538,20 @@ int XFlashCFI_ReadCommon(XFlash *InstancePtr, u8 BusWidth)
 		 *	  It defaults to 0 here.
 		 *	- EraseQueueSize must be defined by the device. It
 		 *	  defaults to 1 here.
+		 *	- BankOpsWhileErase is defined below for multi-bank
+		 *	  parts. It defaults to 0 here.
+		 *
+		 *	Properties.ReadCap
+		 *	- PageSize is defined below for AMD parts. It defaults
+		 *	  to 0 here.
 		 *
 		 * Geometry
 		 *	Completely defined.
 		 *
 		 */
 		InstancePtr->Properties.ProgCap.EraseQueueSize = 1;
+		InstancePtr->Properties.ProgCap.BankOpsWhileErase = 0;
+		InstancePtr->Properties.ReadCap.PageSize = 0;
 
 		/*
 		 * Some of AMD flash have different geometry based on
@@ -555,6 +566,18 @@ int XFlashCFI_ReadCommon(XFlash *InstancePtr, u8 BusWidth)
 					     (ExtendedQueryTblOffset + 0x0F));
 			InstancePtr->Geometry.BootMode =
 				XFlashCFI_Read8((u8*)DataPtr, Interleave, Mode);
+
+			/*
+			 * Extended Query Table Offset + 0x0C: Page mode type.
+			 * 0 = not supported, N = page of (4 << (N - 1)) words.
+			 */
+			XFL_CFI_POSITION_PTR(DataPtr, BaseAddress, Interleave,
+					     (ExtendedQueryTblOffset + 0x0C));
+			Data8 = XFlashCFI_Read8((u8*)DataPtr, Interleave, Mode);
+			if ((Data8 != 0) && (Data8 <= 4)) {
+				InstancePtr->Properties.ReadCap.PageSize =
+					(8 << (Data8 - 1)) * SizeMultiplier;
+			}
 		}
 
 		/*
@@ -585,10 +608,25 @@ int XFlashCFI_ReadCommon(XFlash *InstancePtr, u8 BusWidth)
 				NumBanks = XFlashCFI_Read16((u8*)DataPtr,
 						Interleave, Mode);
 				/*
-				 * Ignore the information about multiple
-				 * operation in bank and region as it is not
-				 * supported by the library
+				 * Extended Query Table Offset + 0x28: Bits 0-3
+				 * are the number of program operations allowed
+				 * in other banks while a bank of this region
+				 * is erasing. Only the first region is used.
 				 */
+				if (Index == 0) {
+					XFL_CFI_POSITION_PTR(DataPtr,
+						BaseAddress, Interleave,
+						(ExtendedQueryTblOffset +
+						0x28));
+					InstancePtr->Properties.ProgCap.
+						BankOpsWhileErase =
+						XFlashCFI_Read8((u8*)DataPtr,
+						Interleave, Mode) & 0x0F;
+					XFL_CFI_POSITION_PTR(DataPtr,
+						BaseAddress, Interleave,
+						(ExtendedQueryTblOffset +
+						0x24));
+				}
 				XFL_CFI_ADVANCE_PTR16(DataPtr, Interleave);
 				XFL_CFI_ADVANCE_PTR16(DataPtr, Interleave);
 				XFL_CFI_ADVANCE_PTR8(DataPtr, Interleave);
@@ -686,6 +724,22 @@ int XFlashCFI_ReadCommon(XFlash *InstancePtr, u8 BusWidth)
 				NumBanks = XFlashCFI_Read8((u8*)DataPtr,
 						Interleave, Mode);
 
+				/*
+				 * Extended Query Table Offset + 0x29: Bits 0-3
+				 * are the number of program operations allowed
+				 * in other banks while a bank is erasing.
+				 */
+				XFL_CFI_POSITION_PTR(DataPtr, BaseAddress,
+					Interleave, (ExtendedQueryTblOffset +
+					0x29));
+				InstancePtr->Properties.ProgCap.
+					BankOpsWhileErase =
+					XFlashCFI_Read8((u8*)DataPtr,
+					Interleave, Mode) & 0x0F;
+				XFL_CFI_POSITION_PTR(DataPtr, BaseAddress,
+					Interleave, (ExtendedQueryTblOffset +
+					0x25));
+
 				XFL_CFI_ADVANCE_PTR16(DataPtr, Interleave);
 				XFL_CFI_ADVANCE_PTR16(DataPtr, Interleave);
 				XFL_CFI_ADVANCE_PTR8(DataPtr, Interleave);
@@ -97,6 +97,9 @@
 *		      Description: Non-word aligned data write to flash fails
 *		      with AXI interface.
 * 4.1	nsk  08/06/15 Fixed CR 835008.
+* 4.4   ag   10/14/26 Added XFlashIntel_EraseWrite() which erases the next
+*		      bank while the current one is programmed on parts that
+*		      allow it.
 * </pre>
 *
 ******************************************************************************/
@@ -575,6 +578,203 @@ int XFlashIntel_Erase(XFlash *InstancePtr, u32 Offset, u32 Bytes)
 	return (XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+*
+* Erases the blocks covering the specified address range and programs the
+* range with data stored in the user buffer.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset into the device(s) address space from which
+*		to begin erasure and programming. Must be aligned to the width
+*		of the flash's data bus.
+* @param	Bytes is the number of bytes to program.
+* @param	SrcPtr is the source address containing data to be programmed.
+*		Must be aligned to the width of the flash's data bus.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XFLASH_ADDRESS_ERROR if the destination address range is
+*		  not completely within the addressable areas of the device(s).
+*		- XFLASH_ERROR if an erase or write error occurred. Use
+*		  XFlash_DeviceControl() to retrieve specific error conditions.
+*
+* @note		Each bank of the multi-bank parts is described by its own
+*		erase region. When the part accepts program operations in
+*		other banks while a bank is erasing (ProgCap.BankOpsWhileErase)
+*		and the range spans several banks, blocks are erased in address
+*		order and:
+*		- a block in the bank being programmed is erased before any
+*		  programming, as the bank can not do both at once;
+*		- a block in a later bank is erased in the background while
+*		  the blocks already erased are programmed, one block at a
+*		  time, checking the erase status in between.
+*		<br><br>
+*		In every other case the range is erased and then programmed.
+*
+******************************************************************************/
+int XFlashIntel_EraseWrite(XFlash *InstancePtr, u32 Offset, u32 Bytes,
+			   void *SrcPtr)
+{
+	u16 EraseRegion, EraseBlock;
+	u16 ProgRegion, ProgBlock;
+	u16 BusyRegion = 0;
+	u16 EndRegion, EndBlock;
+	u16 BlocksLeft;
+	u32 BlockOffset;
+	u32 Dummy;
+	u32 ErasedEnd;
+	u32 EraseAddress = 0;
+	u32 ProgOffset;
+	u32 ProgEnd;
+	u32 Chunk;
+	int EraseBusy = 0;
+	u8 *SrcBytePtr = (u8 *)SrcPtr;
+	XFlashGeometry *GeomPtr;
+	XFlashVendorData_Intel *DevDataPtr;
+	int Status;
+
+	/*
+	 * Verify inputs are valid.
+	 */
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if(SrcPtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if (Bytes == 0) {
+		return (XST_SUCCESS);
+	}
+
+	GeomPtr = &InstancePtr->Geometry;
+	DevDataPtr = GET_PARTDATA(InstancePtr);
+
+	Status = XFlashGeometry_ToBlock(GeomPtr, Offset, &EraseRegion,
+					&EraseBlock, &BlockOffset);
+	if (Status != XST_SUCCESS) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+
+	Status = XFlashGeometry_ToBlock(GeomPtr, Offset + Bytes - 1,
+					&EndRegion, &EndBlock, &Dummy);
+	if (Status != XST_SUCCESS) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+
+	/*
+	 * Without concurrent bank operations there is nothing to overlap.
+	 */
+	if ((InstancePtr->Properties.ProgCap.BankOpsWhileErase == 0) ||
+	    (EraseRegion == EndRegion)) {
+		Status = XFlashIntel_Erase(InstancePtr, Offset, Bytes);
+		if (Status != XST_SUCCESS) {
+			return (Status);
+		}
+		return (XFlashIntel_Write(InstancePtr, Offset, Bytes, SrcPtr));
+	}
+
+	BlocksLeft = XFL_GEOMETRY_BLOCK_DIFF(GeomPtr, EraseRegion, EraseBlock,
+					     EndRegion, EndBlock);
+
+	/*
+	 * Everything below ErasedEnd has been erased and is ready to be
+	 * programmed.
+	 */
+	ErasedEnd = Offset - BlockOffset;
+	ProgOffset = Offset;
+	ProgEnd = Offset + Bytes;
+
+	while (ProgOffset < ProgEnd) {
+		(void) XFlashGeometry_ToBlock(GeomPtr, ProgOffset, &ProgRegion,
+					      &ProgBlock, &BlockOffset);
+
+		/*
+		 * Check the background erase. Wait for it when its bank is
+		 * the one to be programmed, or when nothing else is erased.
+		 */
+		if (EraseBusy) {
+			if ((BusyRegion == ProgRegion) ||
+			    (ErasedEnd <= ProgOffset)) {
+				Status = DevDataPtr->PollSR(InstancePtr,
+							    EraseAddress);
+			}
+			else {
+				Status = DevDataPtr->GetStatus(InstancePtr,
+							       EraseAddress);
+			}
+
+			if (Status == XFLASH_READY) {
+				EraseBusy = 0;
+				ErasedEnd = EraseAddress +
+					GeomPtr->EraseRegion[BusyRegion].Size;
+			}
+			else if (Status != XFLASH_BUSY) {
+				(void) XFlashIntel_ResetBank(InstancePtr,
+							     Offset, Bytes);
+				return (Status);
+			}
+		}
+
+		/*
+		 * Start the next erase. It runs in the background only when
+		 * it is in another bank than the one being programmed.
+		 */
+		if ((!EraseBusy) && (BlocksLeft > 0)) {
+			(void) XFlashGeometry_ToAbsolute(GeomPtr, EraseRegion,
+							 EraseBlock, 0,
+							 &EraseAddress);
+			BusyRegion = EraseRegion;
+			(void) EnqueueEraseBlocks(InstancePtr, &EraseRegion,
+						  &EraseBlock, 1);
+			BlocksLeft--;
+			EraseBusy = 1;
+
+			if ((BusyRegion == ProgRegion) ||
+			    (ErasedEnd <= ProgOffset)) {
+				continue;
+			}
+		}
+
+		if (ErasedEnd <= ProgOffset) {
+			continue;
+		}
+
+		/*
+		 * Program up to the end of the current block, or of what
+		 * has been erased.
+		 */
+		Chunk = GeomPtr->EraseRegion[ProgRegion].Size - BlockOffset;
+		if (Chunk > (ErasedEnd - ProgOffset)) {
+			Chunk = ErasedEnd - ProgOffset;
+		}
+		if (Chunk > (ProgEnd - ProgOffset)) {
+			Chunk = ProgEnd - ProgOffset;
+		}
+
+		Status = DevDataPtr->WriteBuffer(InstancePtr,
+				(void *)(GeomPtr->BaseAddress + ProgOffset),
+				SrcBytePtr, Chunk);
+		if (Status != XST_SUCCESS) {
+			(void) XFlashIntel_ResetBank(InstancePtr, Offset,
+						     Bytes);
+			return (Status);
+		}
+
+		ProgOffset += Chunk;
+		SrcBytePtr += Chunk;
+	}
+
+	/*
+	 * Reset the bank(s) so that it returns to the read mode.
+	 */
+	(void) XFlashIntel_ResetBank(InstancePtr, Offset, Bytes);
+
+	return (XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -53,6 +53,11 @@
  * 4.0  Nava  02/03/18 Added the legacy bit file loading feature support from U-boot.
  *                     and improve the error handling support by returning the
  *                     proper ERROR value upon error conditions.
+ * 4.0  ag    10/14/26 Added XFpga_PL_BitStream_StreamLoad() to stream the
+ *                     Bit-stream into the PL through a user read callback.
+ * 4.0  ag    10/14/26 Added XFPGA_CHECKSUM_EN flag to check the CSU DMA
+ *                     checksum of non secure Bit-streams, computed during the
+ *                     PCAP transfer, against the boot header.
  *
  * </pre>
  *
@@ -62,6 +67,7 @@
 /***************************** Include Files *********************************/
 #include "xil_io.h"
 #include "xil_types.h"
+#include "xil_cache.h"
 #include "xcsudma.h"
 #include "sleep.h"
 #include "xil_printf.h"
@@ -104,6 +110,8 @@
 #define PL_CHUNK_SIZE_BYTES		(1024 * 56)
 #define NUM_OF_PL_CHUNKS(Size)	(Size / PL_CHUNK_SIZE_BYTES)
 #endif
+#define XFPGA_PH_SIZE			(0x40U) /* Bytes */
+#define XFPGA_STREAM_MIN_CHUNK_SIZE	(0x1000U) /* Bytes */
 
 /**
  * Name Configuration Type1 packet headers masks
@@ -124,6 +132,7 @@
 #define XFPGA_ENCRYPTION_USERKEY_EN	(0x00000008U)
 #define XFPGA_ENCRYPTION_DEVKEY_EN 	(0x00000010U)
 #define XFPGA_ONLY_BIN_EN		(0x00000020U)
+#define XFPGA_CHECKSUM_EN		(0x00000040U)
 
 #define XFPGA_AES_TAG_SIZE	(XSECURE_SECURE_HDR_SIZE + \
 		XSECURE_SECURE_GCM_TAG_SIZE) /* AES block decryption tag size */
@@ -191,7 +200,11 @@ static u32 Xfpga_RegAddr(u8 Register, u8 OpCode, u8 Size);
 static u32 XFpga_GetBitstreamInfo(UINTPTR WrAddr,
 				u32 *BitstreamAddress, u32 *BitstreamSize);
 static u32 XFpga_ValidateCryptoFlags(UINTPTR WrAddr, u32 flags);
+static u32 XFpga_PlConfigInit(u32 flags);
+static u32 XFpga_PlConfigDone(void);
 #ifdef XFPGA_SECURE_MODE
+static u32 XFpga_GetSecureHdrInfo(UINTPTR WrAddr,
+				XSecure_ImageInfo *ImageHdrInfo);
 static u32 XFpga_SecureLoadToPl(UINTPTR WrAddr,	UINTPTR KeyAddr,
 				XSecure_ImageInfo *ImageInfo, u32 flags );
 static u32 XFpga_WriteEncryptToPcap(UINTPTR WrAddr, UINTPTR KeyAddr,
@@ -258,6 +271,13 @@ XSecure_Rsa Secure_Rsa;
  *			 1 - Enable.
  *			 0 - Disable.
  *
+ *		BIT(6) - Checksum check of non secure Bit-streams.
+ *			 1 - Enable.
+ *			 0 - Disable.
+ *			 The 32 bit sum of the Bit-stream words, calculated by
+ *			 CSU DMA during the PCAP transfer, is compared with
+ *			 the first user defined word of the boot header.
+ *
  * NOTE -
  *	The current implementation will not support partial  Bit-stream loading.
  *
@@ -271,10 +291,6 @@ u32 XFpga_PL_BitSream_Load (UINTPTR WrAddr, UINTPTR AddrPtr, u32 flags)
 	u32 BitstreamSize;
 	u32 RegVal;
 #ifdef XFPGA_SECURE_MODE
-	u32 EncOnly;
-	u8 IsEncrypted = 0;
-	u8 NoAuth = 0;
-	u8 *IvPtr = (u8 *)(UINTPTR)Iv;
 	XSecure_ImageInfo ImageHdrInfo = {0};
 #endif
 
@@ -282,6 +298,13 @@ u32 XFpga_PL_BitSream_Load (UINTPTR WrAddr, UINTPTR AddrPtr, u32 flags)
 	if ((u8 *)(UINTPTR)WrAddr == NULL)
 		return XST_FAILURE;
 
+	/* Checksum is taken from the boot header of non secure Images */
+	if ((flags & XFPGA_CHECKSUM_EN) &&
+		(flags & (XFPGA_SECURE_FLAGS | XFPGA_ONLY_BIN_EN))) {
+		Status = XFPGA_ERROR_CRYPTO_FLAGS;
+		goto END;
+	}
+
 #ifndef XFPGA_SECURE_MODE
 	if (!(flags & XFPGA_ONLY_BIN_EN))
 #endif
@@ -299,95 +322,18 @@ u32 XFpga_PL_BitSream_Load (UINTPTR WrAddr, UINTPTR AddrPtr, u32 flags)
 		goto END;
 
 #ifdef XFPGA_SECURE_MODE
-	Status = XSecure_AuthenticationHeaders((u8 *)WrAddr, &ImageHdrInfo);
-	if (Status != XST_SUCCESS) {
-	/* Error other than XSECURE_AUTH_NOT_ENABLED error will be an error */
-		if (Status != XSECURE_AUTH_NOT_ENABLED) {
-			Status = XFPGA_ERROR_HDR_AUTH;
-			goto END;
-		} else {
-		/* Here Buffer still contains Boot header */
-			NoAuth = 1;
-		}
-	}
-
-	if (NoAuth != 0x00 ) {
-		XSecure_PartitionHeader *Ph =
-				(XSecure_PartitionHeader *)(UINTPTR)
-				(WrAddr + Xil_In32((UINTPTR)Buffer +
-						XSECURE_PH_TABLE_OFFSET));
-		ImageHdrInfo.PartitionHdr = Ph;
-		if ((ImageHdrInfo.PartitionHdr->PartitionAttributes &
-				XSECURE_PH_ATTR_AUTH_ENABLE) != 0x00U) {
-			Status = XFPGA_ERROR_CRYPTO_FLAGS;
-			goto END;
-		}
-	}
-
-	if (ImageHdrInfo.PartitionHdr->PartitionAttributes &
-				XSECURE_PH_ATTR_ENC_ENABLE)
-		IsEncrypted = 1;
-
-	EncOnly = XSecure_IsEncOnlyEnabled();
-	if (EncOnly != 0x00) {
-
-		if (!IsEncrypted) {
-			Status = XFPGA_ENC_ISCOMPULSORY;
-			goto END;
-		}
-	}
-
-	if ((IsEncrypted) && (NoAuth)) {
-		ImageHdrInfo.KeySrc = Xil_In32((UINTPTR)Buffer +
-					XSECURE_KEY_SOURCE_OFFSET);
-		XSecure_MemCopy(ImageHdrInfo.Iv,
-				(Buffer + XSECURE_IV_OFFSET), XSECURE_IV_SIZE);
-		/* Add partition header IV to boot header IV */
-		*(IvPtr + XSECURE_IV_LEN) = (*(IvPtr + XSECURE_IV_LEN)) +
-			(ImageHdrInfo.PartitionHdr->Iv & XSECURE_PH_IV_MASK);
-	}
-
-	/*
-	 * When authentication exists and requesting
-	 * for device key other than eFUSE and KUP key
-	 * when ENC_ONLY bit is blown
-	 */
-	if (EncOnly != 0x00) {
-		if ((ImageHdrInfo.KeySrc == XSECURE_KEY_SRC_BBRAM) ||
-			(ImageHdrInfo.KeySrc == XSECURE_KEY_SRC_GREY_BH) ||
-			(ImageHdrInfo.KeySrc == XSECURE_KEY_SRC_BLACK_BH)) {
-			Status = XSECURE_DEC_WRONG_KEY_SOURCE;
-			goto END;
-		}
-	}
-
+	Status = XFpga_GetSecureHdrInfo(WrAddr, &ImageHdrInfo);
+	if (Status != XFPGA_SUCCESS)
+		goto END;
 #endif
 
 	/* Enable the PCAP clk */
 	RegVal = Xil_In32(PCAP_CLK_CTRL);
 	Xil_Out32(PCAP_CLK_CTRL, RegVal | PCAP_CLK_EN_MASK );
 
-	/* Power-Up PL */
-	Status = XFpga_PowerUpPl();
-	if (Status != XFPGA_SUCCESS) {
-		xil_printf("XFPGA_ERROR_PL_POWER_UP\r\n");
-		Status = XFPGA_ERROR_PL_POWER_UP;
-		goto END;
-	}
-
-	/* PS PL Isolation Restore */
-	Status = XFpga_IsolationRestore();
-	if (Status != XFPGA_SUCCESS) {
-		xil_printf("XFPGA_ERROR_PL_ISOLATION\r\n");
-		Status = XFPGA_ERROR_PL_ISOLATION;
-		goto END;
-	}
-
-	Status = XFpga_PcapInit(flags);
-	if(Status != XFPGA_SUCCESS) {
-		Status = XPFGA_ERROR_PCAP_INIT;
+	Status = XFpga_PlConfigInit(flags);
+	if (Status != XFPGA_SUCCESS)
 		goto END;
-	}
 
 	if (flags & XFPGA_SECURE_FLAGS)
 #ifdef XFPGA_SECURE_MODE
@@ -421,6 +367,9 @@ u32 XFpga_PL_BitSream_Load (UINTPTR WrAddr, UINTPTR AddrPtr, u32 flags)
 			BitstreamSize	= *((UINTPTR *)(AddrPtr));
 		}
 
+		if (flags & XFPGA_CHECKSUM_EN)
+			XCsuDma_ClearCheckSum(&CsuDma);
+
 		Status = XFpga_WriteToPcap(BitstreamSize/WORD_LEN,
 						BitstreamAddress);
 	}
@@ -431,6 +380,297 @@ u32 XFpga_PL_BitSream_Load (UINTPTR WrAddr, UINTPTR AddrPtr, u32 flags)
 		goto END;
 	}
 
+	if ((flags & XFPGA_CHECKSUM_EN) && (XCsuDma_GetCheckSum(&CsuDma) !=
+		*((u32 *)(WrAddr + BITSTREAM_CHECKSUM_OFFSET)))) {
+		xil_printf("FPGA Bit-stream checksum mismatch\n");
+		Status = XFPGA_ERROR_BITSTREAM_CHECKSUM;
+		/* Clear the PL house */
+		Xil_Out32(CSU_PCAP_PROG, 0x0U);
+		usleep(PL_RESET_PERIOD_IN_US);
+		Xil_Out32(CSU_PCAP_PROG, CSU_PCAP_PROG_PCFG_PROG_B_MASK);
+		goto END;
+	}
+
+	Status = XFpga_PlConfigDone();
+END:
+	/* Disable the PCAP clk */
+	RegVal = Xil_In32(PCAP_CLK_CTRL);
+	Xil_Out32(PCAP_CLK_CTRL, RegVal & ~(PCAP_CLK_EN_MASK) );
+#ifdef XFPGA_SECURE_MODE
+	if ((u8 *)AddrPtr != NULL)
+		memset((u8 *)AddrPtr, 0, KEY_LEN);
+#endif
+	return Status;
+}
+
+/*****************************************************************************/
+/** This function streams the Bit-stream into the PL through the user read
+ * callback, so that the image need not be resident in memory.
+ *
+ * The given buffer is split into two chunks. While CSU DMA writes one chunk
+ * into the PCAP, the next chunk is read into the other one to overlap the
+ * device I/O with the PL configuration. Encrypted Bit-streams are decrypted
+ * chunk by chunk by the AES engine on the way to the PCAP.
+ *
+ *@param ReadFunc Callback used to read the image from the boot device
+ *		(or) network.
+ *
+ *@param CallBackRef Argument passed to the read callback.
+ *
+ *@param BufAddr Chunk buffer address used to stage the image.
+ *
+ *@param BufSize Chunk buffer size in bytes, the image headers should be
+ *		within the first half of it.
+ *
+ *@param AddrPtr Aes key address which is used for Decryption (or) pointer
+ *		to the Bit-stream size when XFPGA_ONLY_BIN_EN is set.
+ *
+ *@param flags Same as XFpga_PL_BitSream_Load().
+ *
+ * NOTE -
+ *	Authenticated Bit-streams are not supported, as each partition has to
+ *	be authenticated before any part of it is written into the PL.
+ *
+ *@return error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+u32 XFpga_PL_BitStream_StreamLoad (XFpga_ReadFunc ReadFunc, void *CallBackRef,
+				UINTPTR BufAddr, u32 BufSize,
+				UINTPTR AddrPtr, u32 flags)
+{
+	u32 Status = XFPGA_SUCCESS;
+	u32 ChunkSize = (BufSize / 2U) & ~(WORD_LEN - 1U);
+	UINTPTR ChunkAddr[2];
+	u32 BitstreamAddress;
+	u32 BitstreamSize;
+	u32 PartHeaderOffset;
+	u32 Checksum = 0U;
+	u32 Offset;
+	u32 Len;
+	u32 NextLen;
+	u32 ReadStatus;
+	u32 RegVal;
+	u8 Idx = 0U;
+	u8 IsEncrypted = 0U;
+#ifdef XFPGA_SECURE_MODE
+	XSecure_ImageInfo ImageHdrInfo = {0};
+#endif
+
+	if ((ReadFunc == NULL) || (BufAddr == 0U) ||
+			(ChunkSize < XFPGA_STREAM_MIN_CHUNK_SIZE))
+		return XST_FAILURE;
+
+	ChunkAddr[0] = BufAddr;
+	ChunkAddr[1] = BufAddr + ChunkSize;
+
+	/* Authentication needs the complete partition before loading it */
+	if (flags & (XFPGA_AUTHENTICATION_DDR_EN | XFPGA_AUTHENTICATION_OCM_EN)) {
+		xil_printf("Authentication is not supported for streaming\r\n");
+		Status = XFPGA_ERROR_CRYPTO_FLAGS;
+		goto END;
+	}
+
+	/* Checksum is taken from the boot header of non secure Images */
+	if ((flags & XFPGA_CHECKSUM_EN) &&
+		(flags & (XFPGA_SECURE_FLAGS | XFPGA_ONLY_BIN_EN))) {
+		Status = XFPGA_ERROR_CRYPTO_FLAGS;
+		goto END;
+	}
+
+	if (flags & XFPGA_ONLY_BIN_EN) {
+		Offset = 0U;
+		BitstreamSize = *((UINTPTR *)(AddrPtr));
+	} else {
+		Status = ReadFunc(CallBackRef, 0U, ChunkAddr[0], ChunkSize);
+		if (Status != XFPGA_SUCCESS) {
+			Status = XFPGA_ERROR_STREAM_READ;
+			goto END;
+		}
+
+		PartHeaderOffset = *((u32 *)(ChunkAddr[0] +
+					PARTATION_HEADER_OFFSET));
+		if (PartHeaderOffset > (ChunkSize - XFPGA_PH_SIZE)) {
+			xil_printf("Image headers are not within the chunk\r\n");
+			Status = XFPGA_FAILURE;
+			goto END;
+		}
+
+		/* validate the User Flags for the Image Crypto operation */
+		Status = XFpga_ValidateCryptoFlags(ChunkAddr[0], flags);
+		if (Status != XFPGA_SUCCESS) {
+			xil_printf("Crypto flags not matched with Image crypto operation\r\n");
+			Status = XFPGA_ERROR_CRYPTO_FLAGS;
+			goto END;
+		}
+
+		XFpga_GetBitstreamInfo(ChunkAddr[0],
+				&BitstreamAddress, &BitstreamSize);
+		Offset = BitstreamAddress - (u32)ChunkAddr[0];
+		Checksum = *((u32 *)(ChunkAddr[0] +
+					BITSTREAM_CHECKSUM_OFFSET));
+	}
+
+	/* Initialize CSU DMA driver */
+	Status = XFpga_CsuDmaInit();
+	if (Status != XFPGA_SUCCESS)
+		goto END;
+
+	if (flags & XFPGA_SECURE_FLAGS)
+#ifdef XFPGA_SECURE_MODE
+	{
+		Status = XFpga_GetSecureHdrInfo(ChunkAddr[0], &ImageHdrInfo);
+		if (Status != XFPGA_SUCCESS)
+			goto END;
+		IsEncrypted = 1U;
+	}
+#else
+	{
+		xil_printf("Fail to load: Enable secure mode and try...\r\n");
+		Status = XFPGA_ERROR_BITSTREAM_LOAD_FAIL;
+		goto END;
+	}
+#endif
+
+	/* Enable the PCAP clk */
+	RegVal = Xil_In32(PCAP_CLK_CTRL);
+	Xil_Out32(PCAP_CLK_CTRL, RegVal | PCAP_CLK_EN_MASK );
+
+	Status = XFpga_PlConfigInit(flags);
+	if (Status != XFPGA_SUCCESS)
+		goto END;
+
+#ifdef XFPGA_SECURE_MODE
+	if (IsEncrypted)
+		XFpga_AesInit(AddrPtr, ImageHdrInfo.Iv, flags);
+	else
+#endif
+	/* Setup the SSS, setup the PCAP to receive from DMA source */
+	Xil_Out32(CSU_CSU_SSS_CFG, XFPGA_CSU_SSS_SRC_SRC_DMA);
+
+	if (flags & XFPGA_CHECKSUM_EN)
+		XCsuDma_ClearCheckSum(&CsuDma);
+
+	Len = (BitstreamSize < ChunkSize) ? BitstreamSize : ChunkSize;
+	ReadStatus = ReadFunc(CallBackRef, Offset, ChunkAddr[Idx], Len);
+
+	while ((Len != 0U) && (ReadStatus == XFPGA_SUCCESS)) {
+		Xil_DCacheFlushRange(ChunkAddr[Idx], Len);
+
+#ifdef XFPGA_SECURE_MODE
+		if (IsEncrypted) {
+			Status = XFpga_DecrptPlChunks(&PlAesInfo,
+						ChunkAddr[Idx], Len);
+			if (Status != XFPGA_SUCCESS)
+				break;
+		} else
+#endif
+		XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL,
+				ChunkAddr[Idx], Len/WORD_LEN, 0);
+
+		/* Read the next chunk while the current one is in flight */
+		Offset += Len;
+		BitstreamSize -= Len;
+		NextLen = (BitstreamSize < ChunkSize) ? BitstreamSize : ChunkSize;
+		if (NextLen != 0U)
+			ReadStatus = ReadFunc(CallBackRef, Offset,
+					ChunkAddr[Idx ^ 1U], NextLen);
+
+		if (!IsEncrypted) {
+			XCsuDma_WaitForDone(&CsuDma, XCSUDMA_SRC_CHANNEL);
+			XCsuDma_IntrClear(&CsuDma, XCSUDMA_SRC_CHANNEL,
+						XCSUDMA_IXR_DONE_MASK);
+		}
+
+		Idx ^= 1U;
+		Len = NextLen;
+	}
+
+	if (ReadStatus != XFPGA_SUCCESS)
+		Status = XFPGA_ERROR_STREAM_READ;
+	else if ((Status == XFPGA_SUCCESS) && (!IsEncrypted))
+		Status = XFpga_PcapWaitForDone();
+
+	if ((Status == XFPGA_SUCCESS) && (flags & XFPGA_CHECKSUM_EN) &&
+		(XCsuDma_GetCheckSum(&CsuDma) != Checksum)) {
+		xil_printf("FPGA Bit-stream checksum mismatch\n");
+		Status = XFPGA_ERROR_BITSTREAM_CHECKSUM;
+	}
+
+	if (Status != XFPGA_SUCCESS) {
+		xil_printf("FPGA fail to write Bit-stream into PL\n");
+		if ((Status != XFPGA_ERROR_STREAM_READ) &&
+			(Status != XFPGA_ERROR_BITSTREAM_CHECKSUM))
+			Status = XFPGA_ERROR_BITSTREAM_LOAD_FAIL;
+		/* Clear the PL house */
+		Xil_Out32(CSU_PCAP_PROG, 0x0U);
+		usleep(PL_RESET_PERIOD_IN_US);
+		Xil_Out32(CSU_PCAP_PROG, CSU_PCAP_PROG_PCFG_PROG_B_MASK);
+		goto END;
+	}
+
+	Status = XFpga_PlConfigDone();
+END:
+	/* Disable the PCAP clk */
+	RegVal = Xil_In32(PCAP_CLK_CTRL);
+	Xil_Out32(PCAP_CLK_CTRL, RegVal & ~(PCAP_CLK_EN_MASK) );
+#ifdef XFPGA_SECURE_MODE
+	if ((flags & XFPGA_SECURE_FLAGS) && ((u8 *)AddrPtr != NULL))
+		memset((u8 *)AddrPtr, 0, KEY_LEN);
+#endif
+	return Status;
+}
+
+/*****************************************************************************/
+/** This function powers up the PL, restores the PS-PL isolation and
+ * initializes the PCAP interface before the Bit-stream is written.
+ *
+ * @param flags It provides the information about Crypto operation needs
+ *        to be performed on the given Image (or) Data.
+ *
+ * @return	error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+static u32 XFpga_PlConfigInit(u32 flags) {
+	u32 Status;
+
+	/* Power-Up PL */
+	Status = XFpga_PowerUpPl();
+	if (Status != XFPGA_SUCCESS) {
+		xil_printf("XFPGA_ERROR_PL_POWER_UP\r\n");
+		Status = XFPGA_ERROR_PL_POWER_UP;
+		goto END;
+	}
+
+	/* PS PL Isolation Restore */
+	Status = XFpga_IsolationRestore();
+	if (Status != XFPGA_SUCCESS) {
+		xil_printf("XFPGA_ERROR_PL_ISOLATION\r\n");
+		Status = XFPGA_ERROR_PL_ISOLATION;
+		goto END;
+	}
+
+	Status = XFpga_PcapInit(flags);
+	if(Status != XFPGA_SUCCESS) {
+		Status = XPFGA_ERROR_PCAP_INIT;
+		goto END;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/** This function waits for the PL configuration to be done and then
+ * releases the PS-PL resets.
+ *
+ * @param	None
+ *
+ * @return	error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+static u32 XFpga_PlConfigDone(void) {
+	u32 Status;
+
 	Status = XFpga_PLWaitForDone();
 	if(Status != XFPGA_SUCCESS) {
 		xil_printf("FPGA fail to get the done status\n");
@@ -448,13 +688,6 @@ u32 XFpga_PL_BitSream_Load (UINTPTR WrAddr, UINTPTR AddrPtr, u32 flags)
 	/* PS-PL reset */
 	XFpga_PsPlGpioReset(FPGA_NUM_FABRIC_RESETS);
 END:
-	/* Disable the PCAP clk */
-	RegVal = Xil_In32(PCAP_CLK_CTRL);
-	Xil_Out32(PCAP_CLK_CTRL, RegVal & ~(PCAP_CLK_EN_MASK) );
-#ifdef XFPGA_SECURE_MODE
-	if ((u8 *)AddrPtr != NULL)
-		memset((u8 *)AddrPtr, 0, KEY_LEN);
-#endif
 	return Status;
 }
 
@@ -644,6 +877,92 @@ static u32 XFpga_ValidateCryptoFlags(UINTPTR WrAddr, u32 flags) {
 }
 #ifdef XFPGA_SECURE_MODE
 
+/*****************************************************************************/
+/** This function authenticates the image headers and gets the key source
+ * and IV of the Bit-stream partition, honoring the ENC_ONLY eFUSE.
+ *
+ * @param WrAddr Linear memory secure image base address
+ * @param ImageHdrInfo Pointer to the image info to be updated.
+ *
+ * @return error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+static u32 XFpga_GetSecureHdrInfo(UINTPTR WrAddr,
+				XSecure_ImageInfo *ImageHdrInfo) {
+	u32 Status;
+	u32 EncOnly;
+	u8 IsEncrypted = 0;
+	u8 NoAuth = 0;
+	u8 *IvPtr = (u8 *)(UINTPTR)Iv;
+
+	Status = XSecure_AuthenticationHeaders((u8 *)WrAddr, ImageHdrInfo);
+	if (Status != XST_SUCCESS) {
+	/* Error other than XSECURE_AUTH_NOT_ENABLED error will be an error */
+		if (Status != XSECURE_AUTH_NOT_ENABLED) {
+			Status = XFPGA_ERROR_HDR_AUTH;
+			goto END;
+		} else {
+		/* Here Buffer still contains Boot header */
+			NoAuth = 1;
+		}
+	}
+
+	if (NoAuth != 0x00 ) {
+		XSecure_PartitionHeader *Ph =
+				(XSecure_PartitionHeader *)(UINTPTR)
+				(WrAddr + Xil_In32((UINTPTR)Buffer +
+						XSECURE_PH_TABLE_OFFSET));
+		ImageHdrInfo->PartitionHdr = Ph;
+		if ((ImageHdrInfo->PartitionHdr->PartitionAttributes &
+				XSECURE_PH_ATTR_AUTH_ENABLE) != 0x00U) {
+			Status = XFPGA_ERROR_CRYPTO_FLAGS;
+			goto END;
+		}
+	}
+
+	if (ImageHdrInfo->PartitionHdr->PartitionAttributes &
+				XSECURE_PH_ATTR_ENC_ENABLE)
+		IsEncrypted = 1;
+
+	EncOnly = XSecure_IsEncOnlyEnabled();
+	if (EncOnly != 0x00) {
+
+		if (!IsEncrypted) {
+			Status = XFPGA_ENC_ISCOMPULSORY;
+			goto END;
+		}
+	}
+
+	if ((IsEncrypted) && (NoAuth)) {
+		ImageHdrInfo->KeySrc = Xil_In32((UINTPTR)Buffer +
+					XSECURE_KEY_SOURCE_OFFSET);
+		XSecure_MemCopy(ImageHdrInfo->Iv,
+				(Buffer + XSECURE_IV_OFFSET), XSECURE_IV_SIZE);
+		/* Add partition header IV to boot header IV */
+		*(IvPtr + XSECURE_IV_LEN) = (*(IvPtr + XSECURE_IV_LEN)) +
+			(ImageHdrInfo->PartitionHdr->Iv & XSECURE_PH_IV_MASK);
+	}
+
+	/*
+	 * When authentication exists and requesting
+	 * for device key other than eFUSE and KUP key
+	 * when ENC_ONLY bit is blown
+	 */
+	if (EncOnly != 0x00) {
+		if ((ImageHdrInfo->KeySrc == XSECURE_KEY_SRC_BBRAM) ||
+			(ImageHdrInfo->KeySrc == XSECURE_KEY_SRC_GREY_BH) ||
+			(ImageHdrInfo->KeySrc == XSECURE_KEY_SRC_BLACK_BH)) {
+			Status = XSECURE_DEC_WRONG_KEY_SOURCE;
+			goto END;
+		}
+	}
+
+
+	Status = XFPGA_SUCCESS;
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /** This function is used to loaded the secure Bit-stream into the PL.
  *
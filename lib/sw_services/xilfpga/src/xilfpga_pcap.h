@@ -46,6 +46,7 @@
 *		Encrypted Bit-stream loading.
 *		Authenticated Bit-stream loading.
 *		Authenticated and Encrypted Bit-stream loading.
+*		Streaming Bit-stream loading through a user read callback.
 *	To be supported features:
 * 		Partial Bit-stream loading.
 *
@@ -85,6 +86,11 @@
 *
 *   - u32 XFpga_PL_BitSream_Load ();
 *
+* A Bit-stream which is not resident in memory can be streamed from the boot
+* device (or) network into the PL through a user read callback:
+*
+*   - u32 XFpga_PL_BitStream_StreamLoad ();
+*
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -103,6 +109,10 @@
 * 4.0   Nava  02/03/18 Added the legacy bit file loading feature support from U-boot.
 *                      and improve the error handling support by returning the
 *                      proper ERROR value upon error conditions.
+* 4.0   ag    10/14/26 Added XFpga_PL_BitStream_StreamLoad() to stream the
+*                      Bit-stream into the PL through a user read callback.
+* 4.0   ag    10/14/26 Added CSU DMA checksum check of non secure Bit-streams
+*                      against the boot header.
 *
 * </pre>
 *
@@ -134,6 +144,7 @@
 #define PARTATION_ATTRIBUTES_OFFSET	(0x24U)
 #define BITSTREAM_PARTATION_OFFSET	(0x20U)
 #define BITSTREAM_IV_OFFSET		(0xA0U)
+#define BITSTREAM_CHECKSUM_OFFSET	(0x70U) /* First user defined word */
 
 /**
  * CSU Base Address
@@ -205,12 +216,25 @@
 #define XFPGA_ENC_ISCOMPULSORY			(0x9U)
 #define XFPGA_PARTITION_AUTH_FAILURE		(0xAU)
 #define XFPGA_STRING_INVALID_ERROR		(0xBU)
+#define XFPGA_ERROR_STREAM_READ			(0xCU)
+#define XFPGA_ERROR_BITSTREAM_CHECKSUM		(0xDU)
 
 /**************************** Type Definitions *******************************/
+/**
+ * Read callback used by XFpga_PL_BitStream_StreamLoad() to fetch Size bytes
+ * of the image, starting at byte Offset, into the buffer at DestAddr.
+ * It shall return XFPGA_SUCCESS on success.
+ */
+typedef u32 (*XFpga_ReadFunc)(void *CallBackRef, u32 Offset,
+				UINTPTR DestAddr, u32 Size);
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
 u32 XFpga_PL_BitSream_Load (UINTPTR WrAddr, UINTPTR KeyAddr, u32 flags);
+u32 XFpga_PL_BitStream_StreamLoad (XFpga_ReadFunc ReadFunc, void *CallBackRef,
+				UINTPTR BufAddr, u32 BufSize,
+				UINTPTR AddrPtr, u32 flags);
 u32 XFpga_PcapStatus(void);
 u32 Xfpga_GetConfigReg(u32 ConfigReg, u32 *RegData);
 /************************** Variable Definitions *****************************/
@@ -513,6 +513,13 @@
 *      ms   08/03/17 Added doxygen tags.
 * 5.10 tjs  11/30/17 Added S25FL-L series flash parts support. CR# 987566
 * 5.10 tjs	03/11/17 Added MT25Q512 3V and 1.8V flash part support. CR# 995477
+* 5.10 ag   10/14/26 Added SFDP based configuration and bulk transfers for
+*                    the QSPIPSU interface in xilisf_sfdp.c.
+*                    New API:
+*                        XIsf_SfdpProbe()
+*                        XIsf_SfdpRead()
+*                        XIsf_SfdpWrite()
+*                        XIsf_SfdpErase()
 *
 * </pre>
 *
@@ -959,6 +966,32 @@ typedef struct {
 				  *  buffer */
 } XIsf_BufferReadParam;
 
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+#define XISF_SFDP_NUM_ERASE	4	/**< Erase types in the SFDP table */
+
+/**
+ * The following structure definition specifies one erase type of the
+ * Serial Flash, as found in its SFDP table.
+ */
+typedef struct {
+	u32 Size;		/**< Bytes erased in one flash, 0 if unused */
+	u8 Cmd;			/**< Erase command */
+} XIsf_SfdpEraseType;
+
+/**
+ * The following structure definition specifies the Serial Flash
+ * configuration found by XIsf_SfdpProbe(), used by XIsf_SfdpRead(),
+ * XIsf_SfdpWrite() and XIsf_SfdpErase().
+ */
+typedef struct {
+	u32 FlashSize;		/**< Size of one flash device in bytes */
+	XQspiPsu_ReadCmd ReadCmd;	/**< Fastest usable read command */
+	XQspiPsu_ProgramCmd ProgramCmd;	/**< Page program command */
+	XIsf_SfdpEraseType Erase[XISF_SFDP_NUM_ERASE]; /**< Erase types,
+						     *  largest first */
+} XIsf_SfdpInfo;
+#endif
+
 
 /************************** Variable Definitions *****************************/
 
@@ -1051,6 +1084,19 @@ int XIsf_MicronFlashEnter4BAddMode(XIsf *InstancePtr);
  */
 int XIsf_MicronFlashExit4BAddMode(XIsf *InstancePtr);
 #endif
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+/*
+ * Functions for SFDP based configuration and bulk read/write/erase.
+ */
+int XIsf_SfdpProbe(XIsf *InstancePtr, u8 BusWidth, XIsf_SfdpInfo *InfoPtr);
+int XIsf_SfdpRead(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, u8 *ReadPtr, u32 ByteCount);
+int XIsf_SfdpWrite(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, const u8 *WritePtr, u32 ByteCount);
+int XIsf_SfdpErase(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, u32 ByteCount);
+#endif
+
 /*
  * Function related to Sector protection.
  */
@@ -62,6 +62,8 @@
 * 5.8  nsk  03/02/17 Update WriteBuffer index to 10 in FastReadData, CR#968476
 * 5.9  nsk  97/11/17 Add Micron 4Byte addressing support in Xisf_Read, CR#980169
 *      ms   08/03/17 Added tags and modified comment lines style for doxygen.
+* 5.10 ag   10/14/26 Send the address of dual/quad I/O fast reads on the
+*                    wide bus for the QSPIPSU interface.
 *
 * </pre>
 *
@@ -77,6 +79,23 @@
 #define SIXTEENMB	0x1000000	/**< Sixteen MB */
 #define BANKMASK 	0xF000000	/**< Bank mask */
 
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+/*
+ * Clocks after the address of the dual/quad I/O fast reads. Spansion and
+ * Winbond parts take a mode byte, sent as 0 so continuous read mode is never
+ * entered, followed by dummy clocks. Micron parts only take dummy clocks.
+ */
+#if (XPAR_XISF_FLASH_FAMILY == STM)
+#define XISF_IO_READ_MODE_BYTES		0U
+#define XISF_DUAL_IO_DUMMY_CYCLES	8U
+#define XISF_QUAD_IO_DUMMY_CYCLES	10U
+#else
+#define XISF_IO_READ_MODE_BYTES		1U
+#define XISF_DUAL_IO_DUMMY_CYCLES	0U
+#define XISF_QUAD_IO_DUMMY_CYCLES	4U
+#endif
+#endif
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -665,7 +684,7 @@ static int FastReadData(XIsf *InstancePtr, u8 Command, u32 Address,
 	u8 DiscardByteCnt;
 	int DieNo;
 	u8 * NULLPtr = NULL;
-	XQspiPsu_Msg FlashMsg[3];
+	XQspiPsu_Msg FlashMsg[4];
 #endif
 
 	if (LocalByteCnt <= 0 ) {
@@ -805,8 +824,43 @@ static int FastReadData(XIsf *InstancePtr, u8 Command, u32 Address,
 
 	FlashMsgCnt = 1;
 	BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	if ((Command == XISF_CMD_DUAL_IO_FAST_READ) ||
+			(Command == XISF_CMD_QUAD_IO_FAST_READ)) {
+		/*
+		 * Opcode in SPI mode, then address and mode byte on the
+		 * data phase width
+		 */
+		if (Command == XISF_CMD_DUAL_IO_FAST_READ) {
+			BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+		} else {
+			BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+		}
+		WriteBuffer[DiscardByteCnt] = 0U;
+
+		FlashMsg[0].ByteCount = 1;
+
+		FlashMsg[1].TxBfrPtr = &WriteBuffer[BYTE2];
+		FlashMsg[1].RxBfrPtr = NULL;
+		FlashMsg[1].ByteCount = (u32)DiscardByteCnt - 1U +
+					XISF_IO_READ_MODE_BYTES;
+		FlashMsg[1].BusWidth = BusWidth;
+		FlashMsg[1].Flags = XQSPIPSU_MSG_FLAG_TX;
+		FlashMsgCnt++;
+
+		FlashMsg[2].BusWidth = BusWidth;
+		FlashMsg[2].TxBfrPtr = NULL;
+		FlashMsg[2].RxBfrPtr = NULL;
+		FlashMsg[2].Flags = 0;
+		if (Command == XISF_CMD_DUAL_IO_FAST_READ) {
+			FlashMsg[2].ByteCount = XISF_DUAL_IO_DUMMY_CYCLES;
+		} else {
+			FlashMsg[2].ByteCount = XISF_QUAD_IO_DUMMY_CYCLES;
+		}
+		if (FlashMsg[2].ByteCount != 0U) {
+			FlashMsgCnt++;
+		}
 	/* It is recommended to have a separate entry for dummy */
-	if ((Command == XISF_CMD_FAST_READ) ||
+	} else if ((Command == XISF_CMD_FAST_READ) ||
 			(Command == XISF_CMD_DUAL_OP_FAST_READ) ||
 			(Command == XISF_CMD_QUAD_OP_FAST_READ) ||
 			(Command == XISF_CMD_FAST_READ_4BYTE) ||
@@ -0,0 +1,855 @@
+/******************************************************************************
+*
+* Copyright (C) 2018 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xilisf_sfdp.c
+*
+* This file contains the functions that configure the library from the
+* Serial Flash Discoverable Parameters (SFDP, JESD216) of the flash instead of
+* the per vendor device tables, and the bulk read, program and erase
+* functions that use this configuration.
+*
+* XIsf_SfdpProbe() reads the JEDEC basic flash parameter table and picks the
+* fastest read mode the board is wired for, the page size, the supported
+* erase sizes and the address mode. With 3 or 4 byte addressing and more
+* than 16 MB the 4 byte opcodes are used, so no bank or mode switching is
+* needed.
+*
+* XIsf_SfdpWrite() programs a range through XQspiPsu_StreamProgram(), which
+* stages the next page in the TX FIFO while the controller polls the status
+* of the current one. XIsf_SfdpErase() erases a range with the largest erase
+* type that fits at each step, e.g. 64 KB or 256 KB sectors with 4 KB
+* sectors only at unaligned ends. XIsf_SfdpRead() reads a range through
+* XQspiPsu_StreamRead().
+*
+* These functions are available for the QSPIPSU interface. XIsf_SfdpRead()
+* and XIsf_SfdpWrite() drive the controller directly and always run in polled
+* mode.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------  -------- -----------------------------------------------
+* 5.10  ag       10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "include/xilisf.h"
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+
+/************************** Constant Definitions *****************************/
+
+#define XISF_SFDP_READ_CMD		0x5AU	/**< Read SFDP command */
+#define XISF_SFDP_DUMMY_CYCLES		8U	/**< Dummy clocks of Read SFDP */
+#define XISF_SFDP_SIGNATURE		0x50444653U /**< "SFDP" */
+#define XISF_SFDP_HEADER_BYTES		16U	/**< SFDP header and the basic
+						  *  parameter header */
+#define XISF_SFDP_BFPT_MIN_DWORDS	9U	/**< Basic table of JESD216 */
+#define XISF_SFDP_BFPT_MAX_DWORDS	16U	/**< Dwords used from the basic
+						  *  table */
+
+/*
+ * Basic flash parameter table, first dword
+ */
+#define XISF_SFDP_4K_ERASE_MASK		0x00000003U
+#define XISF_SFDP_4K_ERASE_SUPPORTED	0x00000001U
+#define XISF_SFDP_ADDR_BYTES_MASK	0x00060000U
+#define XISF_SFDP_ADDR_3_OR_4		0x00020000U
+#define XISF_SFDP_ADDR_4_ONLY		0x00040000U
+#define XISF_SFDP_READ_1_1_2		0x00010000U
+#define XISF_SFDP_READ_1_2_2		0x00100000U
+#define XISF_SFDP_READ_1_4_4		0x00200000U
+#define XISF_SFDP_READ_1_1_4		0x00400000U
+
+#define XISF_SFDP_FAST_READ_DUMMY	8U	/**< Dummy clocks of 0x0B */
+#define XISF_SFDP_PAGE_SIZE_DEFAULT	256U	/**< Before JESD216A */
+#define XISF_SFDP_3BYTE_LIMIT		0x1000000U /**< 16 MB */
+
+#define XISF_SFDP_FSR_READY		0x80U	/**< Flag status ready bit */
+#define XISF_SFDP_SR_WIP		0x01U	/**< Write in progress bit */
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * One of the fast read modes of the basic flash parameter table, listed in
+ * the order they are preferred.
+ */
+typedef struct {
+	u32 SupportMask;	/* Support bit in the first dword */
+	u8 Dword;		/* Dword with the opcode and clocks */
+	u8 Shift;		/* Position of the 16 bit field */
+	u8 AddrBusWidth;	/* Address phase width */
+	u8 BusWidth;		/* Data phase width */
+} XIsf_SfdpReadMode;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+extern int XIsf_Transfer(XIsf *InstancePtr, u8 *WritePtr, u8* ReadPtr,
+			 u32 ByteCount);
+extern u32 GetRealAddr(XIsf_Iface *QspiPtr, u32 Address);
+
+static int SfdpReadTable(XIsf *InstancePtr, u32 Address, u8 *ReadPtr,
+			u32 ByteCount);
+static int SfdpReadReg(XIsf *InstancePtr, u8 Command, u8 *ReadPtr);
+static u32 SfdpQuadEnabled(XIsf *InstancePtr, const u32 *Bfpt, u32 Length);
+static u8 SfdpOpcode4B(u8 Opcode);
+static u32 SfdpSpan(const XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, u32 ByteCount, u32 PerDie);
+static int SfdpWaitReady(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr);
+
+/************************** Variable Definitions *****************************/
+
+static const XIsf_SfdpReadMode SfdpReadModes[] = {
+	{XISF_SFDP_READ_1_4_4, 2U, 0U, XQSPIPSU_SELECT_MODE_QUADSPI,
+		XQSPIPSU_SELECT_MODE_QUADSPI},
+	{XISF_SFDP_READ_1_1_4, 2U, 16U, XQSPIPSU_SELECT_MODE_SPI,
+		XQSPIPSU_SELECT_MODE_QUADSPI},
+	{XISF_SFDP_READ_1_2_2, 3U, 16U, XQSPIPSU_SELECT_MODE_DUALSPI,
+		XQSPIPSU_SELECT_MODE_DUALSPI},
+	{XISF_SFDP_READ_1_1_2, 3U, 0U, XQSPIPSU_SELECT_MODE_SPI,
+		XQSPIPSU_SELECT_MODE_DUALSPI},
+};
+
+/************************** Function Definitions ******************************/
+
+/*****************************************************************************/
+/**
+* @brief
+* This API reads the SFDP basic flash parameter table of the flash and fills
+* InfoPtr with the configuration used by XIsf_SfdpRead(), XIsf_SfdpWrite()
+* and XIsf_SfdpErase().
+*
+* The read mode is the first of 1-4-4, 1-1-4, 1-2-2, 1-1-2 and 1-1-1 fast
+* read that the flash supports and that fits BusWidth. Quad modes are only
+* picked when the table says how the quad enable bit is set and the bit is
+* already set (or not needed), since setting it is vendor specific.
+*
+* @param	InstancePtr	Pointer to the XIsf instance, which must have
+*				been initialized with XIsf_Initialize().
+* @param	BusWidth	Widest data bus the board is wired for,
+*				XQSPIPSU_SELECT_MODE_SPI/DUALSPI/QUADSPI.
+* @param	InfoPtr		Pointer to the configuration to fill.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the flash has no usable SFDP table or the
+*		  transfer fails.
+*
+* @note		The tables are read from the lower flash. Both flashes of a
+*		stacked or parallel pair must be the same part.
+*
+******************************************************************************/
+int XIsf_SfdpProbe(XIsf *InstancePtr, u8 BusWidth, XIsf_SfdpInfo *InfoPtr)
+{
+	u32 Header[XISF_SFDP_HEADER_BYTES / 4U];
+	u32 Bfpt[XISF_SFDP_BFPT_MAX_DWORDS];
+	const XIsf_SfdpReadMode *Mode;
+	XIsf_SfdpEraseType Erase;
+	u32 QuadEnabled;
+	u32 Use4BOpcodes = FALSE;
+	u32 Length;
+	u32 Field;
+	u32 Index;
+	u32 Slot;
+	u8 Opcode;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == TRUE);
+	Xil_AssertNonvoid(InfoPtr != NULL);
+
+	XQspiPsu_SelectFlash(InstancePtr->SpiInstPtr,
+		XQSPIPSU_SELECT_FLASH_CS_LOWER, XQSPIPSU_SELECT_FLASH_BUS_LOWER);
+
+	Status = SfdpReadTable(InstancePtr, 0U, (u8 *)Header,
+				XISF_SFDP_HEADER_BYTES);
+	if (Status != (int)XST_SUCCESS) {
+		return (int)XST_FAILURE;
+	}
+
+	/*
+	 * The first parameter header always describes the basic flash
+	 * parameter table: ID LSB, revision, length in dwords, pointer.
+	 */
+	Length = Header[2] >> 24;
+	if ((Header[0] != XISF_SFDP_SIGNATURE) ||
+			((Header[2] & 0xFFU) != 0U) ||
+			(Length < XISF_SFDP_BFPT_MIN_DWORDS)) {
+		return (int)XST_FAILURE;
+	}
+	if (Length > XISF_SFDP_BFPT_MAX_DWORDS) {
+		Length = XISF_SFDP_BFPT_MAX_DWORDS;
+	}
+	for (Index = 0U; Index < XISF_SFDP_BFPT_MAX_DWORDS; Index++) {
+		Bfpt[Index] = 0U;
+	}
+	Status = SfdpReadTable(InstancePtr, Header[3] & 0xFFFFFFU,
+				(u8 *)Bfpt, Length * 4U);
+	if (Status != (int)XST_SUCCESS) {
+		return (int)XST_FAILURE;
+	}
+
+	/* Density, in bits */
+	if ((Bfpt[1] & 0x80000000U) == 0U) {
+		InfoPtr->FlashSize = (Bfpt[1] >> 3) + 1U;
+	} else {
+		Field = Bfpt[1] & 0x7FFFFFFFU;
+		if ((Field < 3U) || (Field > 34U)) {
+			return (int)XST_FAILURE;
+		}
+		InfoPtr->FlashSize = (u32)1U << (Field - 3U);
+	}
+
+	/* Address mode */
+	InfoPtr->ReadCmd.AddrBytes = 3U;
+	if ((Bfpt[0] & XISF_SFDP_ADDR_BYTES_MASK) == XISF_SFDP_ADDR_4_ONLY) {
+		InfoPtr->ReadCmd.AddrBytes = 4U;
+	} else if (((Bfpt[0] & XISF_SFDP_ADDR_BYTES_MASK) ==
+			XISF_SFDP_ADDR_3_OR_4) &&
+			(InfoPtr->FlashSize > XISF_SFDP_3BYTE_LIMIT)) {
+		InfoPtr->ReadCmd.AddrBytes = 4U;
+		Use4BOpcodes = TRUE;
+	}
+
+	/* Fastest read, 1-1-1 fast read unless a wider mode fits */
+	QuadEnabled = SfdpQuadEnabled(InstancePtr, Bfpt, Length);
+	InfoPtr->ReadCmd.Opcode = (Use4BOpcodes == TRUE) ?
+		XISF_CMD_FAST_READ_4BYTE : XISF_CMD_FAST_READ;
+	InfoPtr->ReadCmd.AddrBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	InfoPtr->ReadCmd.DummyCycles = XISF_SFDP_FAST_READ_DUMMY;
+	InfoPtr->ReadCmd.BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	InfoPtr->ReadCmd.MaxChunk = 0U;
+	for (Index = 0U; Index < (sizeof(SfdpReadModes) /
+			sizeof(SfdpReadModes[0])); Index++) {
+		Mode = &SfdpReadModes[Index];
+		if (((Bfpt[0] & Mode->SupportMask) == 0U) ||
+				(Mode->BusWidth > BusWidth) ||
+				((Mode->BusWidth == XQSPIPSU_SELECT_MODE_QUADSPI) &&
+				(QuadEnabled == FALSE))) {
+			continue;
+		}
+		Field = (Bfpt[Mode->Dword] >> Mode->Shift) & 0xFFFFU;
+		Opcode = (u8)(Field >> 8);
+		if (Use4BOpcodes == TRUE) {
+			Opcode = SfdpOpcode4B(Opcode);
+		}
+		if (Opcode == 0U) {
+			continue;
+		}
+		InfoPtr->ReadCmd.Opcode = Opcode;
+		InfoPtr->ReadCmd.AddrBusWidth = Mode->AddrBusWidth;
+		/* Mode clocks are sent as dummy clocks */
+		InfoPtr->ReadCmd.DummyCycles = (u8)((Field & 0x1FU) +
+						((Field >> 5) & 0x7U));
+		InfoPtr->ReadCmd.BusWidth = Mode->BusWidth;
+		break;
+	}
+
+	/* Page program, polled with the flag status on multi die Micron */
+	InfoPtr->ProgramCmd.Opcode = (Use4BOpcodes == TRUE) ?
+		XISF_CMD_PAGEPROG_WRITE_4BYTE : XISF_CMD_PAGEPROG_WRITE;
+	InfoPtr->ProgramCmd.AddrBytes = InfoPtr->ReadCmd.AddrBytes;
+	InfoPtr->ProgramCmd.BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	if ((InstancePtr->NumDie > (u8)1) &&
+		(InstancePtr->ManufacturerID ==
+			(u32)XISF_MANUFACTURER_ID_MICRON)) {
+		InfoPtr->ProgramCmd.StatusCmd = READ_FLAG_STATUS_CMD;
+		InfoPtr->ProgramCmd.StatusMask = XISF_SFDP_FSR_READY;
+		InfoPtr->ProgramCmd.StatusValue = XISF_SFDP_FSR_READY;
+	} else {
+		InfoPtr->ProgramCmd.StatusCmd = READ_STATUS_CMD;
+		InfoPtr->ProgramCmd.StatusMask = XISF_SFDP_SR_WIP;
+		InfoPtr->ProgramCmd.StatusValue = 0U;
+	}
+	InfoPtr->ProgramCmd.PageSize = XISF_SFDP_PAGE_SIZE_DEFAULT;
+	if (Length >= 11U) {
+		InfoPtr->ProgramCmd.PageSize = (u32)1U << ((Bfpt[10] >> 4) & 0xFU);
+	}
+	InfoPtr->ProgramCmd.PollTimeout = 0U;
+
+	/* Erase types, largest first */
+	for (Index = 0U; Index < XISF_SFDP_NUM_ERASE; Index++) {
+		InfoPtr->Erase[Index].Size = 0U;
+		InfoPtr->Erase[Index].Cmd = 0U;
+	}
+	for (Index = 0U; Index < XISF_SFDP_NUM_ERASE; Index++) {
+		Field = (Bfpt[7U + (Index / 2U)] >> ((Index % 2U) * 16U)) &
+				0xFFFFU;
+		Opcode = (u8)(Field >> 8);
+		if (Use4BOpcodes == TRUE) {
+			Opcode = SfdpOpcode4B(Opcode);
+		}
+		if (((Field & 0xFFU) == 0U) || ((Field & 0xFFU) > 31U) ||
+				(Opcode == 0U)) {
+			continue;
+		}
+		Erase.Size = (u32)1U << (Field & 0xFFU);
+		Erase.Cmd = Opcode;
+		Slot = Index;
+		while ((Slot > 0U) && (InfoPtr->Erase[Slot - 1U].Size <
+				Erase.Size)) {
+			InfoPtr->Erase[Slot] = InfoPtr->Erase[Slot - 1U];
+			Slot--;
+		}
+		InfoPtr->Erase[Slot] = Erase;
+	}
+	if ((InfoPtr->Erase[0].Size == 0U) &&
+		((Bfpt[0] & XISF_SFDP_4K_ERASE_MASK) ==
+			XISF_SFDP_4K_ERASE_SUPPORTED)) {
+		Opcode = (u8)(Bfpt[0] >> 8);
+		if (Use4BOpcodes == TRUE) {
+			Opcode = SfdpOpcode4B(Opcode);
+		}
+		InfoPtr->Erase[0].Size = 4096U;
+		InfoPtr->Erase[0].Cmd = Opcode;
+	}
+	if ((InfoPtr->Erase[0].Size == 0U) || (InfoPtr->Erase[0].Cmd == 0U)) {
+		return (int)XST_FAILURE;
+	}
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This API reads a range of the flash with the read mode found by
+* XIsf_SfdpProbe(), in DMA mode with the next command queued while the
+* current one is transferring.
+*
+* @param	InstancePtr	Pointer to the XIsf instance.
+* @param	InfoPtr		Configuration filled by XIsf_SfdpProbe().
+* @param	Address		Start address in the Serial Flash.
+* @param	ReadPtr		Buffer where the data is stored.
+* @param	ByteCount	Number of bytes to read.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		The range is split at stacked flash and die boundaries. In
+*		dual parallel mode Address and ByteCount must be even.
+*
+******************************************************************************/
+int XIsf_SfdpRead(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, u8 *ReadPtr, u32 ByteCount)
+{
+	XIsf_Iface *QspiPtr;
+	u32 ReadMode;
+	u32 RealAddr;
+	u32 Count;
+	int Status = (int)XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == TRUE);
+	Xil_AssertNonvoid(InfoPtr != NULL);
+	Xil_AssertNonvoid(ReadPtr != NULL);
+
+	QspiPtr = InstancePtr->SpiInstPtr;
+	if ((QspiPtr->Config.ConnectionMode ==
+			XISF_QSPIPS_CONNECTION_MODE_PARALLEL) &&
+			((Address & 0x1U) != 0U)) {
+		return (int)XST_FAILURE;
+	}
+
+	ReadMode = QspiPtr->ReadMode;
+	if (ReadMode != XQSPIPSU_READMODE_DMA) {
+		(void)XQspiPsu_SetReadMode(QspiPtr, XQSPIPSU_READMODE_DMA);
+	}
+
+	while ((ByteCount != 0U) && (Status == (int)XST_SUCCESS)) {
+		Count = SfdpSpan(InstancePtr, InfoPtr, Address, ByteCount, TRUE);
+		RealAddr = GetRealAddr(QspiPtr, Address);
+		Status = (int)XQspiPsu_StreamRead(QspiPtr, &InfoPtr->ReadCmd,
+					RealAddr, ReadPtr, Count);
+		Address += Count;
+		ReadPtr += Count;
+		ByteCount -= Count;
+	}
+
+	if (ReadMode != XQSPIPSU_READMODE_DMA) {
+		(void)XQspiPsu_SetReadMode(QspiPtr, ReadMode);
+	}
+
+	return (Status == (int)XST_SUCCESS) ? (int)XST_SUCCESS :
+			(int)XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This API programs a range of the flash. Pages are queued back to back with
+* the ready poll done by the controller, so the next page is already in the
+* TX FIFO when the current one completes.
+*
+* @param	InstancePtr	Pointer to the XIsf instance.
+* @param	InfoPtr		Configuration filled by XIsf_SfdpProbe().
+* @param	Address		Start address in the Serial Flash.
+* @param	WritePtr	Data to program.
+* @param	ByteCount	Number of bytes to program.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		The range must be erased. Write enable is sent for each page
+*		by this API. In dual parallel mode Address and ByteCount must
+*		be even.
+*
+******************************************************************************/
+int XIsf_SfdpWrite(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, const u8 *WritePtr, u32 ByteCount)
+{
+	XIsf_Iface *QspiPtr;
+	u32 RealAddr;
+	u32 Count;
+	int Status = (int)XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == TRUE);
+	Xil_AssertNonvoid(InfoPtr != NULL);
+	Xil_AssertNonvoid(WritePtr != NULL);
+
+	QspiPtr = InstancePtr->SpiInstPtr;
+	if ((QspiPtr->Config.ConnectionMode ==
+			XISF_QSPIPS_CONNECTION_MODE_PARALLEL) &&
+			((Address & 0x1U) != 0U)) {
+		return (int)XST_FAILURE;
+	}
+
+	while ((ByteCount != 0U) && (Status == (int)XST_SUCCESS)) {
+		Count = SfdpSpan(InstancePtr, InfoPtr, Address, ByteCount,
+				FALSE);
+		RealAddr = GetRealAddr(QspiPtr, Address);
+		Status = (int)XQspiPsu_StreamProgram(QspiPtr,
+					&InfoPtr->ProgramCmd, RealAddr,
+					WritePtr, Count);
+		Address += Count;
+		WritePtr += Count;
+		ByteCount -= Count;
+	}
+
+	return (Status == (int)XST_SUCCESS) ? (int)XST_SUCCESS :
+			(int)XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This API erases a range of the flash using, at each step, the largest
+* erase type that is aligned at the current address and fits in the rest of
+* the range.
+*
+* @param	InstancePtr	Pointer to the XIsf instance.
+* @param	InfoPtr		Configuration filled by XIsf_SfdpProbe().
+* @param	Address		Start address in the Serial Flash.
+* @param	ByteCount	Number of bytes to erase.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		Address and ByteCount must be multiples of the smallest erase
+*		size (twice that in dual parallel mode). Write enable is sent
+*		for each erase by this API.
+*
+******************************************************************************/
+int XIsf_SfdpErase(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, u32 ByteCount)
+{
+	XIsf_Iface *QspiPtr;
+	XQspiPsu_Msg FlashMsg[2];
+	u8 WriteEnableCmd = WRITE_ENABLE_CMD;
+	u8 EraseCmd[5];
+	u32 AddrStep = 1U;
+	u32 Smallest = 0U;
+	u32 RealAddr;
+	u32 Size = 0U;
+	u32 Index;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == TRUE);
+	Xil_AssertNonvoid(InfoPtr != NULL);
+
+	QspiPtr = InstancePtr->SpiInstPtr;
+	if (QspiPtr->Config.ConnectionMode ==
+			XISF_QSPIPS_CONNECTION_MODE_PARALLEL) {
+		AddrStep = 2U;
+	}
+	for (Index = 0U; Index < XISF_SFDP_NUM_ERASE; Index++) {
+		if (InfoPtr->Erase[Index].Size != 0U) {
+			Smallest = InfoPtr->Erase[Index].Size * AddrStep;
+		}
+	}
+	if ((Smallest == 0U) || ((Address % Smallest) != 0U) ||
+			((ByteCount % Smallest) != 0U)) {
+		return (int)XST_FAILURE;
+	}
+
+	while (ByteCount != 0U) {
+		RealAddr = GetRealAddr(QspiPtr, Address);
+
+		for (Index = 0U; Index < XISF_SFDP_NUM_ERASE; Index++) {
+			Size = InfoPtr->Erase[Index].Size;
+			if ((Size != 0U) && ((RealAddr & (Size - 1U)) == 0U) &&
+					((Size * AddrStep) <= ByteCount)) {
+				break;
+			}
+		}
+		if (Index == XISF_SFDP_NUM_ERASE) {
+			return (int)XST_FAILURE;
+		}
+
+		FlashMsg[0].TxBfrPtr = &WriteEnableCmd;
+		FlashMsg[0].RxBfrPtr = NULL;
+		FlashMsg[0].ByteCount = 1;
+		FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+		InstancePtr->SpiInstPtr->Msg = FlashMsg;
+		Status = XIsf_Transfer(InstancePtr, NULL, NULL, 1);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+
+		EraseCmd[BYTE1] = InfoPtr->Erase[Index].Cmd;
+		if (InfoPtr->ReadCmd.AddrBytes == 4U) {
+			EraseCmd[BYTE2] = (u8)(RealAddr >> XISF_ADDR_SHIFT24);
+			EraseCmd[BYTE3] = (u8)(RealAddr >> XISF_ADDR_SHIFT16);
+			EraseCmd[BYTE4] = (u8)(RealAddr >> XISF_ADDR_SHIFT8);
+			EraseCmd[BYTE5] = (u8)RealAddr;
+		} else {
+			EraseCmd[BYTE2] = (u8)(RealAddr >> XISF_ADDR_SHIFT16);
+			EraseCmd[BYTE3] = (u8)(RealAddr >> XISF_ADDR_SHIFT8);
+			EraseCmd[BYTE4] = (u8)RealAddr;
+		}
+		FlashMsg[0].TxBfrPtr = EraseCmd;
+		FlashMsg[0].ByteCount = 1U + (u32)InfoPtr->ReadCmd.AddrBytes;
+		InstancePtr->SpiInstPtr->Msg = FlashMsg;
+		Status = XIsf_Transfer(InstancePtr, NULL, NULL, 1);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+
+		Status = SfdpWaitReady(InstancePtr, InfoPtr);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+
+		Address += Size * AddrStep;
+		ByteCount -= Size * AddrStep;
+	}
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads part of the SFDP tables with the Read SFDP command.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	Address is the SFDP address.
+* @param	ReadPtr is the word aligned destination buffer.
+* @param	ByteCount is the number of bytes to read.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SfdpReadTable(XIsf *InstancePtr, u32 Address, u8 *ReadPtr,
+			u32 ByteCount)
+{
+	XQspiPsu_Msg FlashMsg[3];
+	u8 Command[4];
+
+	Command[BYTE1] = XISF_SFDP_READ_CMD;
+	Command[BYTE2] = (u8)(Address >> XISF_ADDR_SHIFT16);
+	Command[BYTE3] = (u8)(Address >> XISF_ADDR_SHIFT8);
+	Command[BYTE4] = (u8)Address;
+
+	FlashMsg[0].TxBfrPtr = Command;
+	FlashMsg[0].RxBfrPtr = NULL;
+	FlashMsg[0].ByteCount = 4;
+	FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	FlashMsg[1].TxBfrPtr = NULL;
+	FlashMsg[1].RxBfrPtr = NULL;
+	FlashMsg[1].ByteCount = XISF_SFDP_DUMMY_CYCLES;
+	FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[1].Flags = 0;
+
+	FlashMsg[2].TxBfrPtr = NULL;
+	FlashMsg[2].RxBfrPtr = ReadPtr;
+	FlashMsg[2].ByteCount = ByteCount;
+	FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
+
+	InstancePtr->SpiInstPtr->Msg = FlashMsg;
+
+	return XIsf_Transfer(InstancePtr, NULL, NULL, 3);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads two bytes of a status/configuration register of the
+* selected flash.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	Command is the register read opcode.
+* @param	ReadPtr is a buffer of 2 bytes.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SfdpReadReg(XIsf *InstancePtr, u8 Command, u8 *ReadPtr)
+{
+	XQspiPsu_Msg FlashMsg[2];
+
+	FlashMsg[0].TxBfrPtr = &Command;
+	FlashMsg[0].RxBfrPtr = NULL;
+	FlashMsg[0].ByteCount = 1;
+	FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	FlashMsg[1].TxBfrPtr = NULL;
+	FlashMsg[1].RxBfrPtr = ReadPtr;
+	FlashMsg[1].ByteCount = 2;
+	FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[1].Flags = XQSPIPSU_MSG_FLAG_RX;
+
+	InstancePtr->SpiInstPtr->Msg = FlashMsg;
+
+	return XIsf_Transfer(InstancePtr, NULL, NULL, 2);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks whether quad reads can be used as the flash is set
+* up now, from the quad enable requirements of the basic parameter table.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	Bfpt is the basic flash parameter table.
+* @param	Length is the number of valid dwords in Bfpt.
+*
+* @return	TRUE if quad reads work without changing the flash, else
+*		FALSE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 SfdpQuadEnabled(XIsf *InstancePtr, const u32 *Bfpt, u32 Length)
+{
+	u8 Reg[2] = {0};
+	u32 Enabled = FALSE;
+
+	/* Quad enable requirements came with JESD216A */
+	if (Length < 15U) {
+		return FALSE;
+	}
+
+	switch ((Bfpt[14] >> 20) & 0x7U) {
+		case 0U:
+			/* No quad enable bit */
+			Enabled = TRUE;
+			break;
+		case 2U:
+			/* Bit 6 of status register 1 */
+			if (SfdpReadReg(InstancePtr, READ_STATUS_CMD, Reg) ==
+					(int)XST_SUCCESS) {
+				Enabled = ((Reg[0] & 0x40U) != 0U) ? TRUE : FALSE;
+			}
+			break;
+		case 1U:
+		case 4U:
+		case 5U:
+			/* Bit 1 of status register 2 (configuration register) */
+			if (SfdpReadReg(InstancePtr, XISF_CMD_STATUSREG2_READ,
+					Reg) == (int)XST_SUCCESS) {
+				Enabled = ((Reg[0] & 0x02U) != 0U) ? TRUE : FALSE;
+			}
+			break;
+		default:
+			break;
+	}
+
+	return Enabled;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the 4 byte address variant of a 3 byte address
+* read, program or erase opcode.
+*
+* @param	Opcode is the 3 byte address opcode.
+*
+* @return	The 4 byte address opcode, 0 if there is none.
+*
+* @note		None.
+*
+******************************************************************************/
+static u8 SfdpOpcode4B(u8 Opcode)
+{
+	u8 Opcode4B;
+
+	switch (Opcode) {
+		case XISF_CMD_FAST_READ:
+			Opcode4B = XISF_CMD_FAST_READ_4BYTE;
+			break;
+		case XISF_CMD_DUAL_OP_FAST_READ:
+			Opcode4B = XISF_CMD_DUAL_OP_FAST_READ_4B;
+			break;
+		case XISF_CMD_DUAL_IO_FAST_READ:
+			Opcode4B = XISF_CMD_DUAL_IO_FAST_READ_4B;
+			break;
+		case XISF_CMD_QUAD_OP_FAST_READ:
+			Opcode4B = XISF_CMD_QUAD_OP_FAST_READ_4B;
+			break;
+		case XISF_CMD_QUAD_IO_FAST_READ:
+			Opcode4B = XISF_CMD_QUAD_IO_FAST_READ_4B;
+			break;
+		case 0x20U:
+			/* 4 KB erase */
+			Opcode4B = 0x21U;
+			break;
+		case 0xD8U:
+			/* 64 KB (256 KB on some parts) erase */
+			Opcode4B = 0xDCU;
+			break;
+		default:
+			Opcode4B = 0U;
+			break;
+	}
+
+	return Opcode4B;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns how many bytes from Address can go in one command,
+* up to the end of the flash device or, for reads, of the die.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	InfoPtr is the configuration filled by XIsf_SfdpProbe().
+* @param	Address is the start address in the Serial Flash.
+* @param	ByteCount is the number of bytes left.
+* @param	PerDie is TRUE to stop at die boundaries.
+*
+* @return	Number of bytes for the command.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 SfdpSpan(const XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr,
+			u32 Address, u32 ByteCount, u32 PerDie)
+{
+	u32 Region = InfoPtr->FlashSize;
+	u32 Span;
+
+	if ((PerDie == TRUE) && (InstancePtr->NumDie > (u8)1)) {
+		Region /= InstancePtr->NumDie;
+	}
+	if (InstancePtr->SpiInstPtr->Config.ConnectionMode ==
+			XISF_QSPIPS_CONNECTION_MODE_PARALLEL) {
+		Region *= 2U;
+	}
+
+	Span = Region - (Address % Region);
+
+	return (Span < ByteCount) ? Span : ByteCount;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits until the flash(es) report ready after an erase.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	InfoPtr is the configuration filled by XIsf_SfdpProbe().
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		In dual parallel mode the two bytes read come from the two
+*		flashes, otherwise both are the status of the one flash.
+*
+******************************************************************************/
+static int SfdpWaitReady(XIsf *InstancePtr, const XIsf_SfdpInfo *InfoPtr)
+{
+	XQspiPsu_Msg FlashMsg[2];
+	u8 Command = InfoPtr->ProgramCmd.StatusCmd;
+	u8 Mask = InfoPtr->ProgramCmd.StatusMask;
+	u8 Value = InfoPtr->ProgramCmd.StatusValue;
+	u8 FlashStatus[2] = {0};
+	int Status;
+
+	do {
+		FlashMsg[0].TxBfrPtr = &Command;
+		FlashMsg[0].RxBfrPtr = NULL;
+		FlashMsg[0].ByteCount = 1;
+		FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+		FlashMsg[1].TxBfrPtr = NULL;
+		FlashMsg[1].RxBfrPtr = FlashStatus;
+		FlashMsg[1].ByteCount = 2;
+		FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		FlashMsg[1].Flags = XQSPIPSU_MSG_FLAG_RX;
+
+		if (InstancePtr->SpiInstPtr->Config.ConnectionMode ==
+				XISF_QSPIPS_CONNECTION_MODE_PARALLEL) {
+			FlashMsg[1].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+		}
+		InstancePtr->SpiInstPtr->Msg = FlashMsg;
+
+		Status = XIsf_Transfer(InstancePtr, NULL, NULL, 2);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+	} while (((FlashStatus[0] & Mask) != Value) ||
+			((FlashStatus[1] & Mask) != Value));
+
+	return (int)XST_SUCCESS;
+}
+
+#endif /* XPAR_XISF_INTERFACE_QSPIPSU */
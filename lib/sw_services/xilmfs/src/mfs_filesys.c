@@ -49,6 +49,178 @@ struct mfs_open_file_struct mfs_open_files[MFS_MAX_OPEN_FILES];
 int mfs_num_open_files; /* the number of mfs_open_files */
 int mfs_current_dir; /* index of current directory block */
 
+#if MFS_NAME_INDEX_SIZE > 0
+#if (MFS_NAME_INDEX_SIZE & (MFS_NAME_INDEX_SIZE - 1)) != 0
+#error "MFS_NAME_INDEX_SIZE must be a power of 2"
+#endif
+/* name index slot states */
+#define MFS_INDEX_FREE 0
+#define MFS_INDEX_USED 1
+#define MFS_INDEX_DELETED 2
+/**
+ * a name index slot refers to the directory entry at index 'index' of the
+ * dir block 'block' belonging to the directory whose first block is
+ * 'dir_block'; the name itself is only kept in the file system
+ */
+struct mfs_name_index_ent {
+  unsigned int dir_block;
+  unsigned int block;
+  unsigned short index;
+  unsigned short state;
+};
+static struct mfs_name_index_ent mfs_name_index[MFS_NAME_INDEX_SIZE];
+
+/**
+ * hash a directory and a file name to a slot of the name index
+ * @param dir_block is the index of the first block of the directory
+ * @param name is the file name without any '/'
+ * @return the slot
+ */
+static unsigned int name_index_hash(unsigned int dir_block, const char *name) {
+  unsigned int hash = 2166136261U ^ dir_block;
+  while (*name != '\0') {
+    hash ^= (unsigned char)*name;
+    hash *= 16777619U;
+    name++;
+  }
+  return hash & (MFS_NAME_INDEX_SIZE - 1);
+}
+
+/**
+ * look up a file name in a directory using the name index
+ * the slot is only trusted if the file system entry it refers to still
+ * carries the name and is not deleted
+ * @param dir_block is the index of the first block of the directory
+ * @param name is the file name without any '/'
+ * @param block is set to the dir block containing the entry
+ * @param index is set to the index of the entry within block
+ * @return 1 if found, 0 otherwise
+ */
+static int name_index_lookup(int dir_block, const char *name, int *block, int *index) {
+  unsigned int slot = name_index_hash(dir_block, name);
+  unsigned int n;
+  struct mfs_name_index_ent *ent;
+  struct mfs_dir_ent_block *dir_ent;
+
+  for (n = 0; n < MFS_NAME_INDEX_SIZE; n++) {
+    ent = &mfs_name_index[slot];
+    if (ent->state == MFS_INDEX_FREE)
+      return 0;
+    if (ent->state == MFS_INDEX_USED && ent->dir_block == (unsigned int)dir_block &&
+        ent->block < (unsigned int)mfs_max_file_blocks &&
+        mfs_file_system[ent->block].block_type == MFS_BLOCK_TYPE_DIR) {
+      dir_ent = &mfs_file_system[ent->block].u.dir_data.dir_ent[ent->index];
+      if (dir_ent->deleted != 'y' && !strcmp(dir_ent->name, name)) {
+        *block = ent->block;
+        *index = ent->index;
+        return 1;
+      }
+    }
+    slot = (slot + 1) & (MFS_NAME_INDEX_SIZE - 1);
+  }
+  return 0;
+}
+
+/**
+ * add the directory entry at block/index to the name index
+ * nothing is added if the index is full
+ * @param dir_block is the index of the first block of the directory
+ * @param block is the dir block containing the entry
+ * @param index is the index of the entry within block
+ */
+static void name_index_insert(int dir_block, int block, int index) {
+  unsigned int slot = name_index_hash(dir_block, mfs_file_system[block].u.dir_data.dir_ent[index].name);
+  unsigned int n;
+  struct mfs_name_index_ent *ent;
+  struct mfs_name_index_ent *free_ent = NULL;
+
+  for (n = 0; n < MFS_NAME_INDEX_SIZE; n++) {
+    ent = &mfs_name_index[slot];
+    if (ent->state == MFS_INDEX_USED) {
+      if (ent->block == (unsigned int)block && ent->index == (unsigned short)index) {
+        ent->dir_block = dir_block; /* already present */
+        return;
+      }
+    }
+    else {
+      if (free_ent == NULL)
+        free_ent = ent;
+      if (ent->state == MFS_INDEX_FREE)
+        break;
+    }
+    slot = (slot + 1) & (MFS_NAME_INDEX_SIZE - 1);
+  }
+  if (free_ent != NULL) {
+    free_ent->dir_block = dir_block;
+    free_ent->block = block;
+    free_ent->index = index;
+    free_ent->state = MFS_INDEX_USED;
+  }
+}
+
+/**
+ * remove the directory entry at block/index from the name index
+ * must be called while the entry still carries its name
+ * @param dir_block is the index of the first block of the directory
+ * @param block is the dir block containing the entry
+ * @param index is the index of the entry within block
+ */
+static void name_index_remove(int dir_block, int block, int index) {
+  unsigned int slot = name_index_hash(dir_block, mfs_file_system[block].u.dir_data.dir_ent[index].name);
+  unsigned int n;
+  struct mfs_name_index_ent *ent;
+
+  for (n = 0; n < MFS_NAME_INDEX_SIZE; n++) {
+    ent = &mfs_name_index[slot];
+    if (ent->state == MFS_INDEX_FREE)
+      return;
+    if (ent->state == MFS_INDEX_USED && ent->block == (unsigned int)block &&
+        ent->index == (unsigned short)index) {
+      ent->state = MFS_INDEX_DELETED;
+      return;
+    }
+    slot = (slot + 1) & (MFS_NAME_INDEX_SIZE - 1);
+  }
+}
+
+/**
+ * rebuild the name index from all the directories in the file system
+ * the first block of a directory is recognized by its "." entry
+ */
+static void name_index_build(void) {
+  int dir_block;
+  int block;
+  int index;
+  int numentriesleft;
+
+  memset(mfs_name_index, 0, sizeof(mfs_name_index));
+  for (dir_block = 0; dir_block < mfs_max_file_blocks; dir_block++) {
+    if (mfs_file_system[dir_block].block_type != MFS_BLOCK_TYPE_DIR ||
+        mfs_file_system[dir_block].u.dir_data.dir_ent[1].index != (unsigned int)dir_block ||
+        strcmp(mfs_file_system[dir_block].u.dir_data.dir_ent[1].name, "."))
+      continue; /* not the first block of a directory */
+    numentriesleft = mfs_file_system[dir_block].u.dir_data.num_entries - 2;
+    block = dir_block;
+    index = 2; /* skip .. and . */
+    while (numentriesleft > 0) {
+      if (index == MFS_MAX_LOCAL_ENT) { /* move to the next dir block */
+        index = 0;
+        block = mfs_file_system[block].next_block;
+      }
+      if (mfs_file_system[block].u.dir_data.dir_ent[index].deleted != 'y')
+        name_index_insert(dir_block, block, index);
+      index++;
+      numentriesleft--;
+    }
+  }
+}
+#else
+#define name_index_lookup(dir_block, name, block, index) 0
+#define name_index_insert(dir_block, block, index) ((void)(dir_block))
+#define name_index_remove(dir_block, block, index) ((void)(dir_block))
+#define name_index_build()
+#endif
+
 /**
  * initialize the file system;
  * this function must be called before any file system operations
@@ -104,6 +276,9 @@ else { // (init_type == MFSINIT_ROM_IMAGE)
 	 mfs_free_block_list = 0;
 }
 
+  /* cache the directory entries of the initial file system by name */
+  name_index_build();
+
   /* initialize current dir to the top level */
   mfs_current_dir = 0;
 
@@ -159,6 +334,8 @@ void mfs_init_genimage(int numbytes, char *address, int init_type) {
 static int get_dir_ent_base(const char *filename,  int *dir_block, int *dir_index, int *reuse_block, int *reuse_index) {
   /* *dir_index = 0; *dir_block = valid dir corresponding to filename prefixes processed so far, on entry to this proc */
   int numentriesleft = mfs_file_system[*dir_block].u.dir_data.num_entries;
+  int first_dir_block = *dir_block;
+  int found = 0;
   char tmpfilename[MFS_MAX_FILENAME_LENGTH];
   int index = 0;
   int basename = 0;
@@ -174,7 +351,10 @@ static int get_dir_ent_base(const char *filename,  int *dir_block, int *dir_inde
 	  basename = 1;
 	  looking_for_reuse = 1;
   }
-  while (numentriesleft > 0) {
+  if (name_index_lookup(first_dir_block, tmpfilename, dir_block, dir_index)) {
+    found = 1;
+  }
+  while (found == 0 && numentriesleft > 0) {
     if (*dir_index == MFS_MAX_LOCAL_ENT) { /* move to the next dir block */
       *dir_index = 0;
       *dir_block = mfs_file_system[*dir_block].next_block;
@@ -184,15 +364,10 @@ static int get_dir_ent_base(const char *filename,  int *dir_block, int *dir_inde
                 tmpfilename)) { /* found the entry */
       /* *dir_index = index; */
       /* *dir_block = dir; */
-      if (basename == 1) /* this is the base file name, ignore final '/' if present */
-        return 1;
-      else { /* tmpname is the current prefix, filename is the rest of the path */
-        *dir_block = mfs_file_system[*dir_block].u.dir_data.dir_ent[*dir_index].index;
-        *dir_index = 0;
-        filename++;
-        return(get_dir_ent_base(filename, dir_block, dir_index, reuse_block, reuse_index));
-      }
-
+      if (*dir_index > 1 || *dir_block != first_dir_block) /* do not cache . and .. */
+        name_index_insert(first_dir_block, *dir_block, *dir_index);
+      found = 1;
+      break;
     }
 	else if ((looking_for_reuse == 1) && (mfs_file_system[*dir_block].u.dir_data.dir_ent[*dir_index].deleted == 'y') && (basename == 1)) {
 		/* found a possible reuse block */
@@ -203,6 +378,16 @@ static int get_dir_ent_base(const char *filename,  int *dir_block, int *dir_inde
     *dir_index += 1;
     numentriesleft--;
   }
+  if (found == 1) {
+    if (basename == 1) /* this is the base file name, ignore final '/' if present */
+      return 1;
+    else { /* tmpname is the current prefix, filename is the rest of the path */
+      *dir_block = mfs_file_system[*dir_block].u.dir_data.dir_ent[*dir_index].index;
+      *dir_index = 0;
+      filename++;
+      return(get_dir_ent_base(filename, dir_block, dir_index, reuse_block, reuse_index));
+    }
+  }
   if (basename == 1) { /* could not find the base name but path prefix is correct */
     return 0;
   }
@@ -339,6 +524,36 @@ static int get_next_free_block(int *new_entry_index) {
   return 0; /* failed to get free block */
 }
 
+/**
+ * allocate a specific block if it is free, by unlinking it from the free list
+ * used to place the blocks of a file next to each other
+ * @param block is the index of the wanted block
+ * @return 1 on success, 0 if the block is not free
+ */
+static int get_free_block_at(int block) {
+  int prev_block;
+  int next_block;
+  if (block <= 0 || block >= mfs_max_file_blocks || mfs_free_block_list == 0 ||
+      mfs_file_system[block].block_type != MFS_BLOCK_TYPE_EMPTY) {
+    return 0;
+  }
+  prev_block = mfs_file_system[block].prev_block;
+  next_block = mfs_file_system[block].next_block;
+  if (mfs_free_block_list == block) {
+    mfs_free_block_list = next_block;
+  }
+  else {
+    mfs_file_system[prev_block].next_block = next_block;
+  }
+  if (next_block != 0) {
+    mfs_file_system[next_block].prev_block = prev_block;
+  }
+  /* remove block from free list */
+  mfs_file_system[block].prev_block = 0;
+  mfs_file_system[block].next_block = 0;
+  return 1;
+}
+
 /**
  * create a new directory block, and initialize it with info about . and ..
  * if this dir wants to know its name, it needs to ask its parent
@@ -513,6 +728,7 @@ static int create_file(const char *filename, int file_type) {
     mfs_file_system[new_dir_block].u.dir_data.dir_ent[new_dir_index].index = new_entry_index;
     set_filename(mfs_file_system[new_dir_block].u.dir_data.dir_ent[new_dir_index].name, get_basename(filename));
     mfs_file_system[new_dir_block].u.dir_data.dir_ent[new_dir_index].deleted = 'n';
+    name_index_insert(first_dir_block, new_dir_block, new_dir_index);
     return new_entry_index;
   }
 }
@@ -597,9 +813,10 @@ int mfs_delete_file (char *filename) {
   entry_index = mfs_file_system[dir_block].u.dir_data.dir_ent[dir_index].index;
   if (delete_data_in_file(entry_index)) {
     /* now delete the file entry from the directory */
+    first_dir_block = get_first_dir_block(dir_block);
+    name_index_remove(first_dir_block, dir_block, dir_index);
     mfs_file_system[dir_block].u.dir_data.dir_ent[dir_index].deleted = 'y';
     mfs_file_system[dir_block].u.dir_data.num_deleted += 1;
-    first_dir_block = get_first_dir_block(dir_block);
     if (dir_block != first_dir_block)
       mfs_file_system[first_dir_block].u.dir_data.num_deleted += 1;
   }
@@ -643,7 +860,10 @@ int mfs_rename_file(char *from_file, char *to_file) {
   int reuse_index = -1;
   if (get_dir_ent(from_file, &from_dir_block, &from_dir_index, &reuse_block, &reuse_index) &&
       !get_dir_ent(to_file, &to_dir_block, &to_dir_index, &reuse_block, &reuse_index)) {
+    int first_dir_block = get_first_dir_block(from_dir_block);
+    name_index_remove(first_dir_block, from_dir_block, from_dir_index);
     set_filename(mfs_file_system[from_dir_block].u.dir_data.dir_ent[from_dir_index].name, get_basename(to_file));
+    name_index_insert(first_dir_block, from_dir_block, from_dir_index);
     return 1;
   }
   return 0;
@@ -877,6 +1097,7 @@ int mfs_file_open(const char *filename, int mode) {
 */
 int mfs_file_read(int fd, char *buf, int buflen) {
   int num_read = 0;
+  int chunk;
   char *from_ptr = (char *) &(mfs_file_system[mfs_open_files[fd].current_block].u.block_data[mfs_open_files[fd].offset]);
   int num_left ;
   num_left =  mfs_file_system[mfs_open_files[fd].current_block].block_size ;
@@ -898,13 +1119,15 @@ int mfs_file_read(int fd, char *buf, int buflen) {
       mfs_open_files[fd].offset = 0;
     }
 
-    *buf = *from_ptr;
-    buf++;
-    from_ptr++;
-    mfs_open_files[fd].offset += 1;
-    num_read++;
-    num_left--;
-    buflen--;
+    /* copy as much of this block as is wanted */
+    chunk = (buflen < num_left) ? buflen : num_left;
+    memcpy(buf, from_ptr, chunk);
+    buf += chunk;
+    from_ptr += chunk;
+    mfs_open_files[fd].offset += chunk;
+    num_read += chunk;
+    num_left -= chunk;
+    buflen -= chunk;
   }
   return num_read;
 }
@@ -922,12 +1145,14 @@ int mfs_file_read(int fd, char *buf, int buflen) {
 int mfs_file_write (int fd, const char *buf, int buflen) {
   char *to_ptr = (char *) &(mfs_file_system[mfs_open_files[fd].current_block].u.block_data[mfs_open_files[fd].offset]);
   int num_left = MFS_BLOCK_DATA_SIZE - mfs_open_files[fd].offset;
+  int chunk;
 
   while (buflen > 0) {
     if (num_left == 0) { /* create next_block */
-      int new_block;
+      /* prefer the block right after this one, so the file stays contiguous */
+      int new_block = mfs_open_files[fd].current_block + 1;
       /* create a new file block linked from this one */
-      if (get_next_free_block(&new_block)) { /* found a free block */
+      if (get_free_block_at(new_block) || get_next_free_block(&new_block)) { /* found a free block */
 	mfs_file_system[new_block].prev_block = mfs_open_files[fd].current_block;
 	mfs_file_system[new_block].next_block = 0;
 	mfs_file_system[new_block].block_type = MFS_BLOCK_TYPE_FILE;
@@ -944,15 +1169,17 @@ int mfs_file_write (int fd, const char *buf, int buflen) {
       num_left = MFS_BLOCK_DATA_SIZE;
     }
 
-    *to_ptr = *buf;
-    buf++;
-    to_ptr++;
-    mfs_open_files[fd].offset += 1;
-    num_left--;
-    mfs_file_system[mfs_open_files[fd].current_block].block_size +=1;
+    /* fill as much of this block as possible */
+    chunk = (buflen < num_left) ? buflen : num_left;
+    memcpy(to_ptr, buf, chunk);
+    buf += chunk;
+    to_ptr += chunk;
+    mfs_open_files[fd].offset += chunk;
+    num_left -= chunk;
+    mfs_file_system[mfs_open_files[fd].current_block].block_size += chunk;
     if (mfs_open_files[fd].current_block != mfs_open_files[fd].first_block)
-      mfs_file_system[mfs_open_files[fd].first_block].block_size += 1;
-    buflen--;
+      mfs_file_system[mfs_open_files[fd].first_block].block_size += chunk;
+    buflen -= chunk;
 
   }
   return 1;
@@ -51,6 +51,16 @@ extern "C" {
 
 #define MFS_MAX_FILENAME_LENGTH 23
 
+/* MFS_NAME_INDEX_SIZE is the number of slots (a power of 2) of the RAM hash
+ * table that caches directory entries by parent directory and name.
+ * It is filled from the whole file system by mfs_init_fs and kept up to
+ * date by create, delete and rename. Lookups that miss in it fall back to
+ * scanning the directory, so a full table only costs speed.
+ * Define it as 0 to remove the index. */
+#ifndef MFS_NAME_INDEX_SIZE
+#define MFS_NAME_INDEX_SIZE 256
+#endif
+
 /**
  * dir entry contains file name and index of first file block
  * mfs_dir_entry_blocks are contained in a mfs_dir_block
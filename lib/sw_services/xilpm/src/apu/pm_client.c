@@ -190,6 +190,65 @@ void XPm_ClientSuspendFinalize(void)
 	pm_dbg("WFI exit...\n");
 }
 
+/**
+ * pm_l1_dcache_flush() - Clean and invalidate the L1 data cache of the
+ *			  calling core by set/way
+ */
+static void pm_l1_dcache_flush(void)
+{
+	u32 csid, line, ways, sets, way, set;
+
+	/* Select L1 data cache */
+#ifdef __aarch64__
+	mtcp(CSSELR_EL1, 0U);
+	isb();
+	csid = mfcp(CCSIDR_EL1);
+#else
+	mtcp(XREG_CP15_CACHE_SIZE_SEL, 0U);
+	isb();
+	csid = mfcp(XREG_CP15_CACHE_SIZE_ID);
+#endif
+	line = (csid & 0x7U) + 4U;
+	ways = ((csid & 0x1FFFU) >> 3U) + 1U;
+	sets = ((csid >> 13U) & 0x7FFFU) + 1U;
+
+	/* A53 L1 data cache is 4-way, way index is in bits [31:30] */
+	for (way = 0U; way < ways; way++) {
+		for (set = 0U; set < sets; set++) {
+#ifdef __aarch64__
+			mtcpdc(CISW, (way << 30U) | (set << line));
+#else
+			mtcp(XREG_CP15_CLEAN_INVAL_DC_LINE_SW,
+			     (way << 30U) | (set << line));
+#endif
+		}
+	}
+	dsb();
+}
+
+/**
+ * XPm_ClientFastIdleFinalize() - Finalize fast idle by executing wfi
+ *
+ * The APU power island stays on in fast idle, so only the L1 data cache
+ * of this core, which is lost with the core, needs to be flushed.
+ */
+void XPm_ClientFastIdleFinalize(void)
+{
+	u32 ctrlReg;
+
+#ifdef __aarch64__
+	ctrlReg = mfcp(SCTLR_EL3);
+	if (XREG_CONTROL_DCACHE_BIT & ctrlReg)
+		pm_l1_dcache_flush();
+#else
+	ctrlReg = mfcp(XREG_CP15_SYS_CONTROL);
+	if (XREG_CP15_CONTROL_C_BIT & ctrlReg)
+		pm_l1_dcache_flush();
+#endif
+
+	__asm__("wfi");
+}
+
 /**
  *  XPm_ClientSetPrimaryMaster() - Set primary master based on master ID
  */
@@ -306,6 +306,56 @@ XStatus XPm_SelfSuspend(const enum XPmNodeId nid,
 	return pm_ipi_buff_read32(master, NULL, NULL, NULL);
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function is called by an APU processor to enter fast idle.
+ * Only the processor core is power gated, the APU power island, L2 cache
+ * and clocks remain on, so the wake-up does not involve any slave or
+ * requirement handling in the PMU.
+ *
+ * @param  nid     Node ID of the APU processor to be idled
+ * @param  address Address from which to resume when woken up
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE or an error code
+ * or a reason code
+ *
+ * @note   This function does not return if the processor is power gated.
+ * If this processor is the last awake core of the APU the PMU performs
+ * the regular suspend instead.
+ *
+ ****************************************************************************/
+XStatus XPm_CpuIdleFast(const enum XPmNodeId nid, const u64 address)
+{
+	XStatus ret;
+	u32 payload[PAYLOAD_ARG_CNT];
+
+	struct XPm_Master *master = pm_get_master_by_node(nid);
+	if ((NULL == master) || (NODE_APU != subsystem_node)) {
+		return XST_INVALID_PARAM;
+	}
+
+	XPm_ClientSuspend(master);
+
+	PACK_PAYLOAD5(payload, PM_SELF_SUSPEND, nid, MAX_LATENCY,
+		      PM_APU_STATE_CPU_FAST_IDLE, (u32)address,
+		      (u32)(address >> 32));
+	ret = pm_ipi_send(master, payload);
+	if (XST_SUCCESS != ret) {
+		goto abort;
+	}
+	ret = pm_ipi_buff_read32(master, NULL, NULL, NULL);
+	if (XST_SUCCESS != ret) {
+		goto abort;
+	}
+
+	XPm_ClientFastIdleFinalize();
+	return XST_SUCCESS;
+
+abort:
+	XPm_ClientAbortSuspend();
+	return ret;
+}
+
 /****************************************************************************/
 /**
  * @brief  This function is called to configure the power management
@@ -660,6 +710,309 @@ XStatus XPm_SetRequirement(const enum XPmNodeId nid,
 		return ret;
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function is used by a PU to request or set requirements of up
+ * to PM_REQ_BATCH_MAX PM slaves with a single PM call. Slaves which are not
+ * requested by the PU yet are requested, requirements of the others are set
+ * as by XPm_SetRequirement.
+ *
+ * @param  reqs  Array of requirements, each slave may be listed only once
+ * @param  count Number of elements in the array (1 - PM_REQ_BATCH_MAX)
+ * @param  ack   Requested acknowledge type
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE or an error code
+ * or a reason code. One status is returned for the whole batch.
+ *
+ * @note   The power management controller checks all requirements before
+ * applying any of them, so a batch rejected because of an invalid entry has
+ * no effect. If the acknowledge callback is requested, it reports
+ * NODE_UNKNOWN as the node.
+ *
+ ****************************************************************************/
+XStatus XPm_SetRequirements(const XPm_NodeRequirement *const reqs,
+			    const u32 count,
+			    const enum XPmRequestAck ack)
+{
+	XStatus ret;
+	u32 tuples[PM_REQ_BATCH_MAX] = { 0U };
+	u32 payload[PAYLOAD_ARG_CNT];
+	u32 i;
+
+	if ((NULL == reqs) || (0U == count) || (count > PM_REQ_BATCH_MAX)) {
+		pm_dbg("ERROR invalid requirements passed to %s\n", __func__);
+		return XST_INVALID_PARAM;
+	}
+
+	for (i = 0U; i < count; i++) {
+		tuples[i] = PM_REQ_BATCH_PACK(reqs[i].node,
+					      reqs[i].capabilities,
+					      reqs[i].qos);
+	}
+
+	PACK_PAYLOAD5(payload, PM_SET_REQUIREMENTS, tuples[0], tuples[1],
+		      tuples[2], tuples[3], ack);
+	ret = pm_ipi_send(primary_master, payload);
+
+	if ((XST_SUCCESS == ret) && (REQUEST_ACK_BLOCKING == ack))
+		return pm_ipi_buff_read32(primary_master, NULL, NULL, NULL);
+	else
+		return ret;
+}
+
+/**
+ * pm_async_req - Node request waiting in the asynchronous request queue
+ * @payload	API id and call arguments, sent with REQUEST_ACK_NON_BLOCKING
+ * @callback	Completion callback invoked with the status from the PMU
+ * @arg		Caller specific argument passed back to the callback
+ * @seq		Sequence number returned to the caller at submission
+ */
+struct pm_async_req {
+	u32 payload[PAYLOAD_ARG_CNT];
+	XPm_AsyncCallback callback;
+	void *arg;
+	u32 seq;
+};
+
+/**
+ * pm_async - Queue of asynchronous node requests
+ * @req		Circular buffer of requests, the oldest one is at 'head'
+ * @head	Index of the oldest request (the one in flight if any)
+ * @count	Number of queued requests, including the one in flight
+ * @next_seq	Sequence number assigned to the next submitted request
+ * @in_flight	True if the request at 'head' has been sent to the PMU
+ */
+static struct {
+	struct pm_async_req req[XPM_ASYNC_QUEUE_LEN];
+	u32 head;
+	u32 count;
+	u32 next_seq;
+	bool in_flight;
+} pm_async;
+
+/****************************************************************************/
+/**
+ * @brief  Sends the oldest queued asynchronous request to the PMU if no
+ * other asynchronous request is currently in flight. A request which can't
+ * be sent is completed with the error status and the next one is tried.
+ *
+ * @return None
+ *
+ * @note   The IPI channel holds a single message, so the PMU processes the
+ * queued requests one after another. Sending the next request is triggered
+ * from the acknowledge callback of the previous one.
+ *
+ ****************************************************************************/
+static void pm_async_kick(void)
+{
+	struct pm_async_req done;
+	XStatus status;
+
+	while (1) {
+		pm_disable_int();
+		if ((0U == pm_async.count) || (true == pm_async.in_flight)) {
+			pm_enable_int();
+			break;
+		}
+		pm_async.in_flight = true;
+		pm_enable_int();
+
+		status = pm_ipi_send(primary_master,
+				     pm_async.req[pm_async.head].payload);
+		if (XST_SUCCESS == status) {
+			break;
+		}
+
+		pm_disable_int();
+		done = pm_async.req[pm_async.head];
+		pm_async.head = (pm_async.head + 1U) % XPM_ASYNC_QUEUE_LEN;
+		pm_async.count--;
+		pm_async.in_flight = false;
+		pm_enable_int();
+
+		done.callback(done.seq, status, 0U, done.arg);
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief  Completes the asynchronous request in flight if the acknowledge
+ * received from the PMU belongs to it, and sends the next queued request.
+ *
+ * @param  node    Node ID reported in the acknowledge
+ * @param  status  Status of the operation reported by the PMU
+ * @param  oppoint Operating point of the node reported by the PMU
+ *
+ * @return true if the acknowledge was consumed by an asynchronous request,
+ * false otherwise
+ *
+ * @note   Called from XPm_AcknowledgeCb, i.e. from the IPI interrupt context.
+ *
+ ****************************************************************************/
+static bool pm_async_complete(const enum XPmNodeId node,
+			      const XStatus status,
+			      const u32 oppoint)
+{
+	struct pm_async_req done;
+
+	pm_disable_int();
+	if ((true != pm_async.in_flight) ||
+	    ((node != pm_async.req[pm_async.head].payload[1]) &&
+	     (NODE_UNKNOWN != node))) {
+		pm_enable_int();
+		return false;
+	}
+	done = pm_async.req[pm_async.head];
+	pm_async.head = (pm_async.head + 1U) % XPM_ASYNC_QUEUE_LEN;
+	pm_async.count--;
+	pm_async.in_flight = false;
+	pm_enable_int();
+
+	done.callback(done.seq, status, oppoint, done.arg);
+	pm_async_kick();
+
+	return true;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Adds a node request to the asynchronous request queue and sends it
+ * to the PMU if the channel is not occupied by another asynchronous request.
+ *
+ * @param  api_id       PM_REQUEST_NODE or PM_SET_REQUIREMENT
+ * @param  node         Node ID of the PM slave
+ * @param  capabilities Slave-specific capabilities required
+ * @param  qos          Quality of Service (0-100) required
+ * @param  callback     Completion callback
+ * @param  arg          Argument passed back to the callback
+ * @param  seq          Used to return the sequence number of the request
+ * (optional)
+ *
+ * @return XST_SUCCESS if the request is queued, XST_INVALID_PARAM if the
+ * callback is NULL or XST_DEVICE_BUSY if the queue is full
+ *
+ * @note   None
+ *
+ ****************************************************************************/
+static XStatus pm_async_submit(const enum XPmApiId api_id,
+			       const enum XPmNodeId node,
+			       const u32 capabilities,
+			       const u32 qos,
+			       const XPm_AsyncCallback callback,
+			       void *const arg,
+			       u32 *const seq)
+{
+	struct pm_async_req *req;
+
+	if (NULL == callback) {
+		pm_dbg("ERROR passing NULL callback to %s\n", __func__);
+		return XST_INVALID_PARAM;
+	}
+
+	pm_disable_int();
+	if (XPM_ASYNC_QUEUE_LEN == pm_async.count) {
+		pm_enable_int();
+		return XST_DEVICE_BUSY;
+	}
+	req = &pm_async.req[(pm_async.head + pm_async.count) %
+			    XPM_ASYNC_QUEUE_LEN];
+	PACK_PAYLOAD4(req->payload, api_id, node, capabilities, qos,
+		      REQUEST_ACK_NON_BLOCKING);
+	req->callback = callback;
+	req->arg = arg;
+	req->seq = pm_async.next_seq++;
+	if (NULL != seq) {
+		*seq = req->seq;
+	}
+	pm_async.count++;
+	pm_enable_int();
+
+	pm_async_kick();
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Asynchronous version of XPm_RequestNode. The request is queued
+ * and the function returns without waiting for the PMU to process it. Once
+ * the PMU has handled the request, the completion callback is invoked with
+ * the sequence number of the request and the status of the operation.
+ *
+ * @param  node         Node ID of the PM slave requested
+ * @param  capabilities Slave-specific capabilities required
+ * @param  qos          Quality of Service (0-100) required
+ * @param  callback     Completion callback
+ * @param  arg          Argument passed back to the callback
+ * @param  seq          Used to return the sequence number of the request
+ * (optional)
+ *
+ * @return XST_SUCCESS if the request is queued, XST_INVALID_PARAM if the
+ * callback is NULL or XST_DEVICE_BUSY if the queue is full
+ *
+ * @note   The callback is normally invoked from the IPI interrupt context,
+ * through XPm_AcknowledgeCb, so the PU has to forward PM_ACKNOWLEDGE
+ * callbacks from the PMU as it does for REQUEST_ACK_NON_BLOCKING requests.
+ * The next queued request is sent from the same context, therefore no other
+ * PM API call may be issued while XPm_AsyncPending() is non-zero.
+ *
+ ****************************************************************************/
+XStatus XPm_RequestNodeAsync(const enum XPmNodeId node,
+			     const u32 capabilities,
+			     const u32 qos,
+			     const XPm_AsyncCallback callback,
+			     void *const arg,
+			     u32 *const seq)
+{
+	return pm_async_submit(PM_REQUEST_NODE, node, capabilities, qos,
+			       callback, arg, seq);
+}
+
+/****************************************************************************/
+/**
+ * @brief  Asynchronous version of XPm_SetRequirement. See
+ * XPm_RequestNodeAsync for the completion semantics.
+ *
+ * @param  nid          Node ID of the PM slave.
+ * @param  capabilities Slave-specific capabilities required.
+ * @param  qos          Quality of Service (0-100) required.
+ * @param  callback     Completion callback
+ * @param  arg          Argument passed back to the callback
+ * @param  seq          Used to return the sequence number of the request
+ * (optional)
+ *
+ * @return XST_SUCCESS if the request is queued, XST_INVALID_PARAM if the
+ * callback is NULL or XST_DEVICE_BUSY if the queue is full
+ *
+ * @note   None
+ *
+ ****************************************************************************/
+XStatus XPm_SetRequirementAsync(const enum XPmNodeId nid,
+				const u32 capabilities,
+				const u32 qos,
+				const XPm_AsyncCallback callback,
+				void *const arg,
+				u32 *const seq)
+{
+	return pm_async_submit(PM_SET_REQUIREMENT, nid, capabilities, qos,
+			       callback, arg, seq);
+}
+
+/****************************************************************************/
+/**
+ * @brief  Returns the number of asynchronous requests which have not been
+ * completed yet, including the one currently processed by the PMU.
+ *
+ * @return Number of pending asynchronous requests
+ *
+ * @note   None
+ *
+ ****************************************************************************/
+u32 XPm_AsyncPending(void)
+{
+	return pm_async.count;
+}
+
 /****************************************************************************/
 /**
  * @brief  This function is used by a PU to release the usage of a PM slave.
@@ -767,6 +1120,8 @@ void XPm_InitSuspendCb(const enum XPmSuspendReason reason,
  * @brief  This function is called by the power management controller in
  * response to any request where an acknowledge callback was requested,
  * i.e. where the 'ack' argument passed by the PU was REQUEST_ACK_CB_STANDARD.
+ * Acknowledges of requests submitted through XPm_RequestNodeAsync or
+ * XPm_SetRequirementAsync complete the request and are not stored in pm_ack.
  *
  * @param  node    ID of the component or sub-system in question.
  * @param  status  Status of the operation:
@@ -783,6 +1138,12 @@ void XPm_AcknowledgeCb(const enum XPmNodeId node,
 		       const XStatus status,
 		       const u32 oppoint)
 {
+	if (true == pm_async_complete(node, status, oppoint)) {
+		pm_dbg("%s (%d, %d, %d) async\n", __func__, node, status,
+		       oppoint);
+		return;
+	}
+
 	if (true == pm_ack.received) {
 		pm_dbg("WARNING: dropping unhandled acknowledge!\n");
 		pm_dbg("Dropped %s (%d, %d, %d)\n", __func__, pm_ack.node,
@@ -1177,3 +1538,42 @@ XStatus XPm_MmioRead(const u32 address, u32 *const value)
 	/* Return result from IPI return buffer */
 	return pm_ipi_buff_read32(primary_master, value, NULL, NULL);
 }
+
+/****************************************************************************/
+/**
+ * @brief  Call this function to change the frequency of a PLL without
+ * stopping the clocks it drives. The power management controller moves
+ * these clocks to other running PLLs, relocks the PLL with the new
+ * parameters and moves the clocks back.
+ *
+ * @param  node  PLL node (NODE_APLL, NODE_VPLL, NODE_DPLL, NODE_RPLL or
+ * NODE_IOPLL)
+ * @param  ctrl  FBDIV and DIV2 bitfields of the PLL control register, other
+ * bits are ignored
+ * @param  cfg   Value of the PLL configuration register
+ * @param  frac  Value of the PLL fractional control register
+ *
+ * @return XST_SUCCESS if successful, XST_NO_FEATURE if a clock driven by the
+ * PLL cannot be moved to another PLL, else XST_FAILURE or an error code
+ *
+ * @note   The caller needs write access to the PLL control register, as for
+ * XPm_MmioWrite. While the PLL relocks its clocks run at a rate that does
+ * not exceed their rate before the call.
+ *
+ ****************************************************************************/
+XStatus XPm_PllChangeRate(const enum XPmNodeId node, const u32 ctrl,
+			  const u32 cfg, const u32 frac)
+{
+	XStatus status;
+	u32 payload[PAYLOAD_ARG_CNT];
+
+	/* Send request to the PMU */
+	PACK_PAYLOAD4(payload, PM_PLL_CHANGE_RATE, node, ctrl, cfg, frac);
+	status = pm_ipi_send(primary_master, payload);
+
+	if (XST_SUCCESS != status)
+		return status;
+
+	/* Return result from IPI return buffer */
+	return pm_ipi_buff_read32(primary_master, NULL, NULL, NULL);
+}
@@ -70,6 +70,7 @@ XStatus XPm_SelfSuspend(const enum XPmNodeId node,
 			const u32 latency,
 			const u8 state,
 			const u64 address);
+XStatus XPm_CpuIdleFast(const enum XPmNodeId nid, const u64 address);
 
 XStatus XPm_ForcePowerDown(const enum XPmNodeId node,
 			   const enum XPmRequestAck ack);
@@ -162,6 +163,30 @@ typedef struct XPm_NodeStatus {
 	u32 usage;			/**< Usage information (which master is currently using the slave) */
 } XPm_NodeStatus;
 
+/**
+ * XPm_AsyncCallback - completion callback of an asynchronous node request
+ * @seq     Sequence number returned when the request was submitted
+ * @status  Status of the operation
+ * @oppoint Operating point of the node reported by the PMU
+ * @arg     Argument passed when the request was submitted
+ */
+typedef void (*XPm_AsyncCallback)(const u32 seq, const XStatus status,
+				  const u32 oppoint, void *const arg);
+
+/* Maximum number of asynchronous requests which can be queued */
+#ifndef XPM_ASYNC_QUEUE_LEN
+#define XPM_ASYNC_QUEUE_LEN	8U
+#endif
+
+/**
+ * XPm_NodeRequirement - requirement of a PM slave set by XPm_SetRequirements
+ */
+typedef struct XPm_NodeRequirement {
+	enum XPmNodeId node;	/**< Node ID of the PM slave */
+	u32 capabilities;	/**< Slave-specific capabilities required */
+	u32 qos;		/**< Quality of Service (0-100) required */
+} XPm_NodeRequirement;
+
 /********************************************************************/
 /**
  * Global data declarations
@@ -194,6 +219,24 @@ XStatus XPm_SetRequirement(const enum XPmNodeId node,
 			   const enum XPmRequestAck ack);
 XStatus XPm_SetMaxLatency(const enum XPmNodeId node,
 			  const u32 latency);
+XStatus XPm_SetRequirements(const XPm_NodeRequirement *const reqs,
+			    const u32 count,
+			    const enum XPmRequestAck ack);
+
+/* Asynchronous API functions for managing PM Slaves */
+XStatus XPm_RequestNodeAsync(const enum XPmNodeId node,
+			     const u32 capabilities,
+			     const u32 qos,
+			     const XPm_AsyncCallback callback,
+			     void *const arg,
+			     u32 *const seq);
+XStatus XPm_SetRequirementAsync(const enum XPmNodeId node,
+				const u32 capabilities,
+				const u32 qos,
+				const XPm_AsyncCallback callback,
+				void *const arg,
+				u32 *const seq);
+u32 XPm_AsyncPending(void);
 
 /* Miscellaneous API functions */
 XStatus XPm_GetApiVersion(u32 *version);
@@ -217,5 +260,8 @@ XStatus XPm_ResetGetStatus(const enum XPmReset reset, u32 *status);
 XStatus XPm_MmioWrite(const u32 address, const u32 mask, const u32 value);
 
 XStatus XPm_MmioRead(const u32 address, u32 *const value);
+
+XStatus XPm_PllChangeRate(const enum XPmNodeId node, const u32 ctrl,
+			  const u32 cfg, const u32 frac);
 /** @} */
 #endif /* _PM_API_SYS_H_ */
@@ -61,6 +61,17 @@
 #define PM_CAP_WAKEUP	0x4U
 /*@}*/
 
+/** @name PM_SET_REQUIREMENTS tuple packing
+ *
+ * Each (node, capabilities, qos) tuple is packed into one payload argument.
+ * @{
+ */
+#define PM_REQ_BATCH_MAX	4U
+#define PM_REQ_BATCH_PACK(node, caps, qos)				\
+	(((u32)(node) & 0xFFU) | (((u32)(caps) & 0xFFU) << 8U) |	\
+	 (((u32)(qos) & 0xFFU) << 16U))
+/*@}*/
+
 /** @name Node default states macros
  *
  * @{
@@ -87,6 +98,14 @@
 #define MAX_QOS		100U
 /*@}*/
 
+/** @name APU processor states
+ *
+ * @{
+ */
+#define PM_APU_STATE_CPU_IDLE		0x0U
+#define PM_APU_STATE_CPU_FAST_IDLE	0x1U
+/*@}*/
+
 /** @name System shutdown/Restart macros
  *
  * @{
@@ -157,6 +176,10 @@ enum XPmApiId {
 	PM_CLOCK_GETPARENT,
 	/* Secure image */
 	PM_SECURE_IMAGE,
+	/* Batched requirements of several PM slaves */
+	PM_SET_REQUIREMENTS,
+	/* PLL frequency change with its clocks kept running */
+	PM_PLL_CHANGE_RATE,
 	PM_API_MAX
 };
 
@@ -298,6 +321,7 @@ enum XPmOpCharType {
 	PM_OPCHAR_TYPE_POWER = 1,
 	PM_OPCHAR_TYPE_TEMP,
 	PM_OPCHAR_TYPE_LATENCY,
+	PM_OPCHAR_TYPE_SUSPEND_LATENCY,
 };
 
  /* Power management specific return error statuses */
@@ -206,6 +206,15 @@ char* XPm_GetMasterName(void)
 	};
 }
 
+/**
+ * XPm_ClientFastIdleFinalize() - Fast idle is APU only, RPU performs the
+ *				  regular suspend finalization
+ */
+void XPm_ClientFastIdleFinalize(void)
+{
+	XPm_ClientSuspendFinalize();
+}
+
 /**
  * XPm_ClientSetPrimaryMaster() -Set primary master
  *
@@ -38,6 +38,7 @@
 # 1.2   vns 08/23/16 Added support for SHA2 by adding .a files
 # 2.0   vns 11/28/16  Added support for PMU
 # 2.0   srm 02/16/18 Updated to pick up latest freertos port 10.0
+# 3.0   ag  10/14/26 Generate xsecure_config.h with the sha3_sw_mode option
 ##############################################################################
 
 #---------------------------------------------
@@ -93,8 +94,31 @@ proc secure_drc {libhandle} {
 
 }
 
+proc xsecure_open_include_file {file_name} {
+    set filename [file join "../../include/" $file_name]
+    if {[file exists $filename]} {
+        set config_inc [open $filename a]
+    } else {
+        set config_inc [open $filename a]
+        ::hsi::utils::write_c_header $config_inc "MFS Parameters"
+   }
+    return $config_inc
+}
+
 proc generate {libhandle} {
 
+    set conffile  [xsecure_open_include_file "xsecure_config.h"]
+
+    puts $conffile "#ifndef _XSECURE_CONFIG_H"
+    puts $conffile "#define _XSECURE_CONFIG_H"
+    set value  [common::get_property CONFIG.sha3_sw_mode $libhandle]
+
+    if {$value == true} {
+	puts $conffile "#define XSECURE_SHA3_SW"
+    }
+
+    puts $conffile "#endif"
+    close $conffile
 }
 
 #-------
@@ -60,6 +60,8 @@
 *       vns 02/19/18 Modified XSecure_AesKeyZero() to clear KUP and AES key
 *                    Added XSecure_AesKeyZero() call in XSecure_AesDecrypt()
 *                    API to clear keys.
+*       ag  10/14/26 Added XSecure_AesSubmit() and XSecure_AesIntrHandler()
+*                    for interrupt driven encryption and decryption.
 *
 * </pre>
 *
@@ -71,8 +73,20 @@
 
 #include "xsecure_aes.h"
 
+/************************** Constant Definitions *****************************/
+
+/* Stages of an interrupt driven request */
+#define XSECURE_AES_REQ_IDLE	(0x0U) /**< No request in progress */
+#define XSECURE_AES_REQ_IV	(0x1U) /**< IV is being pushed */
+#define XSECURE_AES_REQ_DATA	(0x2U) /**< Data is being pushed */
+#define XSECURE_AES_REQ_TAG	(0x3U) /**< GCM tag is being pushed */
+#define XSECURE_AES_REQ_DST	(0x4U) /**< Waiting for the output */
+
 /************************** Function Prototypes ******************************/
 
+static void XSecure_AesReqStart(XSecure_Aes *InstancePtr);
+static void XSecure_AesReqDone(XSecure_Aes *InstancePtr);
+
 /************************** Function Definitions *****************************/
 
 /*****************************************************************************/
@@ -112,6 +126,10 @@ s32 XSecure_AesInitialize(XSecure_Aes *InstancePtr, XCsuDma *CsuDmaPtr,
 	InstancePtr->Iv = Iv;
 	InstancePtr->Key = Key;
 	InstancePtr->IsChunkingEnabled = XSECURE_CSU_AES_CHUNKING_DISABLED;
+	InstancePtr->ReqHead = NULL;
+	InstancePtr->ReqTail = NULL;
+	InstancePtr->ReqState = XSECURE_AES_REQ_IDLE;
+	InstancePtr->ReqDstDone = FALSE;
 
 	return XST_SUCCESS;
 }
@@ -1371,3 +1389,305 @@ ENDF:
 
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function queues an encryption or decryption request. The request is
+ * started right away when no other request is in progress, otherwise it is
+ * started from XSecure_AesIntrHandler() when the earlier requests complete.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ * @param	Request		Pointer to the request, which must remain valid
+ *		until its callback is invoked.
+ *
+ * @return	XST_SUCCESS if the request is queued, XST_INVALID_PARAM if
+ *		the request is invalid.
+ *
+ * @note	XSecure_AesIntrHandler() has to be called from the CSU DMA
+ *		interrupt handler. The CSU DMA done interrupts of both channels
+ *		are enabled while requests are queued. The CPU is not blocked
+ *		by the data movement, only the key load is waited for when a
+ *		request is started.
+ *		Decryption to PCAP and key rolled boot images are not
+ *		supported, use XSecure_AesDecrypt() for them.
+ *
+ ******************************************************************************/
+s32 XSecure_AesSubmit(XSecure_Aes *InstancePtr, XSecure_AesRequest *Request)
+{
+	s32 Status = XST_SUCCESS;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Request != NULL);
+
+	if ((Request->Src == NULL) || (Request->Dst == NULL) ||
+		(Request->Size == 0U) ||
+		(Request->Dst == (u8 *)XSECURE_DESTINATION_PCAP_ADDR)) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	if ((Request->Operation != XSECURE_AES_REQ_ENCRYPT) &&
+		((Request->Operation != XSECURE_AES_REQ_DECRYPT) ||
+		(Request->GcmTagAddr == NULL))) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	Request->Next = NULL;
+
+	/* The queue is also updated from the interrupt handler */
+	XCsuDma_DisableIntr(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+				XCSUDMA_IXR_DONE_MASK);
+	XCsuDma_DisableIntr(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+				XCSUDMA_IXR_DONE_MASK);
+
+	if (InstancePtr->ReqTail != NULL) {
+		InstancePtr->ReqTail->Next = Request;
+		InstancePtr->ReqTail = Request;
+	}
+	else {
+		InstancePtr->ReqHead = Request;
+		InstancePtr->ReqTail = Request;
+		XSecure_AesReqStart(InstancePtr);
+	}
+
+	XCsuDma_EnableIntr(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+				XCSUDMA_IXR_DONE_MASK);
+	XCsuDma_EnableIntr(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+				XCSUDMA_IXR_DONE_MASK);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function services the request in progress on CSU DMA done. It pushes
+ * the next part of the request to the AES engine and completes the request
+ * once its output has been written, after which the next queued request is
+ * started and the callback of the completed request is invoked.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ *
+ * @return	None
+ *
+ * @note	It can also be called in a polling loop.
+ *
+ ******************************************************************************/
+void XSecure_AesIntrHandler(XSecure_Aes *InstancePtr)
+{
+	XSecure_AesRequest *Req;
+	u32 SrcDone;
+
+	/* Assert validates the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	Req = InstancePtr->ReqHead;
+	if (Req == NULL) {
+		return;
+	}
+
+	SrcDone = XCsuDma_IntrGetStatus(InstancePtr->CsuDmaPtr,
+			XCSUDMA_SRC_CHANNEL) & XCSUDMA_IXR_DONE_MASK;
+	if (SrcDone != 0U) {
+		/* Acknowledge the transfer has completed */
+		XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+						XCSUDMA_IXR_DONE_MASK);
+	}
+
+	if ((XCsuDma_IntrGetStatus(InstancePtr->CsuDmaPtr,
+		XCSUDMA_DST_CHANNEL) & XCSUDMA_IXR_DONE_MASK) != 0U) {
+		XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+						XCSUDMA_IXR_DONE_MASK);
+		InstancePtr->ReqDstDone = TRUE;
+	}
+
+	if (SrcDone != 0U) {
+		if (InstancePtr->ReqState == XSECURE_AES_REQ_IV) {
+			XCsuDma_Transfer(InstancePtr->CsuDmaPtr,
+				XCSUDMA_SRC_CHANNEL, (UINTPTR)Req->Src,
+				Req->Size/4U, TRUE);
+			InstancePtr->ReqState = XSECURE_AES_REQ_DATA;
+		}
+		else if ((InstancePtr->ReqState == XSECURE_AES_REQ_DATA) &&
+			(Req->Operation == XSECURE_AES_REQ_DECRYPT)) {
+			XCsuDma_Transfer(InstancePtr->CsuDmaPtr,
+				XCSUDMA_SRC_CHANNEL, (UINTPTR)Req->GcmTagAddr,
+				XSECURE_SECURE_GCM_TAG_SIZE/4U, TRUE);
+			InstancePtr->ReqState = XSECURE_AES_REQ_TAG;
+		}
+		else {
+			InstancePtr->ReqState = XSECURE_AES_REQ_DST;
+		}
+	}
+
+	if ((InstancePtr->ReqState == XSECURE_AES_REQ_DST) &&
+		(InstancePtr->ReqDstDone == TRUE)) {
+		XSecure_AesReqDone(InstancePtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function checks whether all the submitted requests have completed.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ *
+ * @return	TRUE if no request is queued, FALSE otherwise.
+ *
+ ******************************************************************************/
+u32 XSecure_AesQueueIsEmpty(XSecure_Aes *InstancePtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return (InstancePtr->ReqHead == NULL) ? (u32)TRUE : (u32)FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function sets up the AES engine for the request at the head of the
+ * queue and starts pushing its IV without waiting for the transfer.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_AesReqStart(XSecure_Aes *InstancePtr)
+{
+	XSecure_AesRequest *Req = InstancePtr->ReqHead;
+	XCsuDma_Configure ConfigurValues = {0};
+	u32 DstSize = Req->Size;
+	u32 *Iv = InstancePtr->Iv;
+	u32 Count;
+	u32 Value;
+	u32 Addr;
+
+	/* Configure the SSS for AES. */
+	XSecure_SssSetup(XSecure_SssInputDstDma(XSECURE_CSU_SSS_SRC_AES) |
+			XSecure_SssInputAes(XSECURE_CSU_SSS_SRC_SRC_DMA));
+
+	/* Clear AES contents by reseting it. */
+	XSecure_AesReset(InstancePtr);
+
+	/* Clear AES_KEY_CLEAR bits to avoid clearing of key */
+	XSecure_WriteReg(InstancePtr->BaseAddress,
+			XSECURE_CSU_AES_KEY_CLR_OFFSET, (u32)0x0U);
+
+	if (InstancePtr->KeySel != XSECURE_CSU_AES_KEY_SRC_DEV) {
+		for (Count = 0U; Count < 8U; Count++) {
+			/* Helion AES block expects the key in big-endian. */
+			Value = Xil_Htonl(InstancePtr->Key[Count]);
+			Addr = InstancePtr->BaseAddress +
+					XSECURE_CSU_AES_KUP_0_OFFSET
+					+ (Count * 4);
+			XSecure_Out32(Addr, Value);
+		}
+	}
+	XSecure_AesKeySelNLoad(InstancePtr);
+
+	if (Req->Operation == XSECURE_AES_REQ_ENCRYPT) {
+		XSecure_WriteReg(InstancePtr->BaseAddress,
+			XSECURE_CSU_AES_CFG_OFFSET, XSECURE_CSU_AES_CFG_ENC);
+		DstSize += XSECURE_SECURE_GCM_TAG_SIZE;
+	}
+	else {
+		XSecure_WriteReg(InstancePtr->BaseAddress,
+			XSECURE_CSU_AES_CFG_OFFSET, XSECURE_CSU_AES_CFG_DEC);
+	}
+
+	/* Enable CSU DMA Src and Dst channels for byte swapping.*/
+	XCsuDma_GetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					&ConfigurValues);
+	ConfigurValues.EndianType = 1U;
+	XCsuDma_SetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					&ConfigurValues);
+
+	XCsuDma_GetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+					&ConfigurValues);
+	ConfigurValues.EndianType = 1U;
+	XCsuDma_SetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+					&ConfigurValues);
+
+	InstancePtr->ReqDstDone = FALSE;
+	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+				(UINTPTR)Req->Dst, DstSize/4U, 0);
+
+	/* Start the message. */
+	XSecure_WriteReg(InstancePtr->BaseAddress,
+			XSECURE_CSU_AES_START_MSG_OFFSET,
+			XSECURE_CSU_AES_START_MSG);
+
+	/* Push IV into the AES engine. */
+	if (Req->Iv != NULL) {
+		Iv = Req->Iv;
+	}
+	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+		(UINTPTR)Iv, XSECURE_SECURE_GCM_TAG_SIZE/4U, 0);
+
+	InstancePtr->ReqState = XSECURE_AES_REQ_IV;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function completes the request at the head of the queue, starts the
+ * next queued request and invokes the callback of the completed request.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_AesReqDone(XSecure_Aes *InstancePtr)
+{
+	XSecure_AesRequest *Req = InstancePtr->ReqHead;
+	XCsuDma_Configure ConfigurValues = {0};
+	s32 Status = XST_SUCCESS;
+
+	/* Disable CSU DMA Src and Dst channels for byte swapping. */
+	XCsuDma_GetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					&ConfigurValues);
+	ConfigurValues.EndianType = 0U;
+	XCsuDma_SetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					&ConfigurValues);
+
+	XCsuDma_GetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+					&ConfigurValues);
+	ConfigurValues.EndianType = 0U;
+	XCsuDma_SetConfig(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+					&ConfigurValues);
+
+	XSecure_AesWaitForDone(InstancePtr);
+
+	if ((Req->Operation == XSECURE_AES_REQ_DECRYPT) &&
+		((XSecure_ReadReg(InstancePtr->BaseAddress,
+		XSECURE_CSU_AES_STS_OFFSET) &
+		XSECURE_CSU_AES_STS_GCM_TAG_OK) == 0U)) {
+		Status = XSECURE_CSU_AES_GCM_TAG_MISMATCH;
+	}
+
+	InstancePtr->ReqHead = Req->Next;
+	InstancePtr->ReqState = XSECURE_AES_REQ_IDLE;
+	if (InstancePtr->ReqHead != NULL) {
+		/* Keep the engine busy while the callback runs */
+		XSecure_AesReqStart(InstancePtr);
+	}
+	else {
+		InstancePtr->ReqTail = NULL;
+		XCsuDma_DisableIntr(InstancePtr->CsuDmaPtr,
+			XCSUDMA_SRC_CHANNEL, XCSUDMA_IXR_DONE_MASK);
+		XCsuDma_DisableIntr(InstancePtr->CsuDmaPtr,
+			XCSUDMA_DST_CHANNEL, XCSUDMA_IXR_DONE_MASK);
+	}
+
+	if (Req->Handler != NULL) {
+		Req->Handler(Req->CallBackRef, Status);
+	}
+}
@@ -84,6 +84,8 @@
 * 3.0   vns  02/19/18 Added error code for key clear
 *                     XSECURE_CSU_AES_KEY_CLEAR_ERROR and timeout macro
 *                     XSECURE_AES_TIMEOUT_MAX
+*       ag   10/14/26 Added request queue for interrupt driven encryption
+*                     and decryption.
 *
 * </pre>
 * @endcond
@@ -172,8 +174,33 @@
 
 #define XSECURE_AES_TIMEOUT_MAX		(0x1FFFFU)
 
+#define XSECURE_AES_REQ_ENCRYPT		(0x0U) /**< Encryption request */
+#define XSECURE_AES_REQ_DECRYPT		(0x1U) /**< Decryption request */
+
 /************************** Type Definitions ********************************/
 
+/**
+ * Callback invoked from XSecure_AesIntrHandler() when a request completes.
+ * Status is XST_SUCCESS or XSECURE_CSU_AES_GCM_TAG_MISMATCH.
+ */
+typedef void (*XSecure_AesDoneHandler)(void *CallBackRef, s32 Status);
+
+/**
+ * AES request submitted with XSecure_AesSubmit(). The request is owned by
+ * the driver from submission until its callback is invoked.
+ */
+typedef struct XSecure_AesRequest {
+	u32 Operation; /**< XSECURE_AES_REQ_ENCRYPT/XSECURE_AES_REQ_DECRYPT */
+	const u8 *Src; /**< Input data */
+	u8 *Dst; /**< Output data, for encryption followed by the GCM tag */
+	u32 Size; /**< Size of the input data in bytes */
+	u8 *GcmTagAddr; /**< GCM tag to be verified for decryption */
+	u32 *Iv; /**< IV of the request, NULL to use the instance IV */
+	XSecure_AesDoneHandler Handler; /**< Completion callback */
+	void *CallBackRef; /**< Callback reference */
+	struct XSecure_AesRequest *Next; /**< Used by the driver */
+} XSecure_AesRequest;
+
 /**
  * The AES-GCM driver instance data structure. A pointer to an instance data
  * structure is passed around by functions to refer to a specific driver
@@ -199,6 +226,10 @@ typedef struct {
 		 */
 	u32 SizeofData; /**< Size of Data to be encrypted or decrypted */
 	u8  *Destination; /**< Destination for decrypted/encrypted data */
+	XSecure_AesRequest *ReqHead; /**< Request in progress */
+	XSecure_AesRequest *ReqTail; /**< Last queued request */
+	u32 ReqState; /**< Stage of the request in progress */
+	u8 ReqDstDone; /**< Dst DMA of the request in progress is done */
 } XSecure_Aes;
 
 /** @}
@@ -229,6 +260,11 @@ void XSecure_AesEncryptUpdate(XSecure_Aes *InstancePtr, const u8 *Data,
 void XSecure_AesEncryptData(XSecure_Aes *InstancePtr, u8 *Dst, const u8 *Src,
 				u32 Len);
 
+/* Interrupt driven requests */
+s32 XSecure_AesSubmit(XSecure_Aes *InstancePtr, XSecure_AesRequest *Request);
+void XSecure_AesIntrHandler(XSecure_Aes *InstancePtr);
+u32 XSecure_AesQueueIsEmpty(XSecure_Aes *InstancePtr);
+
 /* Reset */
 void XSecure_AesReset(XSecure_Aes  *InstancePtr);
 
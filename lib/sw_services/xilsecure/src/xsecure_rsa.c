@@ -50,6 +50,8 @@
 *       vns  17/08/17 Added APIs XSecure_RsaPublicEncrypt and
 *                     XSecure_RsaPrivateDecrypt.As per functionality
 *                     XSecure_RsaPublicEncrypt is same as XSecure_RsaDecrypt.
+* 3.0   ag   10/14/26 Added XSecure_RsaKeyLoad and XSecure_RsaSignVerifyBatch
+*                     to verify many signatures without reloading the key.
 *
 * </pre>
 *
@@ -84,6 +86,8 @@ static const u8 XSecure_Silicon2_TPadSha3[] = {0x30U, 0x41U, 0x30U, 0x0DU,
 /************************** Function Prototypes ******************************/
 static s32 XSecure_RsaOperation(XSecure_Rsa *InstancePtr, u8 *Input,
 					u8 *Result);
+static s32 XSecure_RsaWaitForDone(XSecure_Rsa *InstancePtr);
+static void XSecure_RsaPutMinv(XSecure_Rsa *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -125,6 +129,7 @@ s32 XSecure_RsaInitialize(XSecure_Rsa *InstancePtr, u8 *Mod, u8 *ModExt,
 	InstancePtr->ModExt = ModExt;
 	InstancePtr->ModExpo = ModExpo;
 	InstancePtr->SizeInWords = XSECURE_RSA_4096_SIZE_WORDS;
+	InstancePtr->KeyLoaded = FALSE;
 
 	return XST_SUCCESS;
 }
@@ -282,7 +287,24 @@ static void XSecure_RsaMod32Inverse(XSecure_Rsa *InstancePtr)
 		Inv = (Inv * (2U - ( ModVal * Inv ) ) );
 	}
 
-	Inv = -Inv;
+	InstancePtr->Minv = -Inv;
+
+	XSecure_RsaPutMinv(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function puts the MINV value of the instance into RSA core registers.
+ *
+ * @param	InstancePtr Pointer to XSeure_Rsa instance
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_RsaPutMinv(XSecure_Rsa *InstancePtr)
+{
+	u32 Inv = InstancePtr->Minv;
 
 	/* Put the value in MINV registers */
 	XSecure_WriteReg(InstancePtr->BaseAddress, XSECURE_CSU_RSA_MINV0_OFFSET,
@@ -312,6 +334,9 @@ static void XSecure_RsaPutData(XSecure_Rsa *InstancePtr)
 	/* Assert validates the input arguments */
 	Xil_AssertVoid(InstancePtr != NULL);
 
+	/* RSA RAM no longer holds the key loaded by XSecure_RsaKeyLoad() */
+	InstancePtr->KeyLoaded = FALSE;
+
 	/* Initialize Modular exponentiation */
 	XSecure_RsaWriteMem(InstancePtr, (u32 *)InstancePtr->ModExpo,
 					XSECURE_CSU_RSA_RAM_EXPO);
@@ -679,3 +704,171 @@ END:
 	return ErrorCode;
 
 }
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the RSA operation started on the instance.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Rsa instance.
+ *
+ * @return	XST_SUCCESS if the operation completed, XST_FAILURE if RSA
+ *		core reported an error.
+ *
+ ******************************************************************************/
+static s32 XSecure_RsaWaitForDone(XSecure_Rsa *InstancePtr)
+{
+	volatile u32 Status = 0x0U;
+	s32 ErrorCode = XST_SUCCESS;
+
+	do
+	{
+		Status = XSecure_ReadReg(InstancePtr->BaseAddress,
+					XSECURE_CSU_RSA_STATUS_OFFSET);
+
+		if(XSECURE_CSU_RSA_STATUS_ERROR ==
+				((u32)Status & XSECURE_CSU_RSA_STATUS_ERROR))
+		{
+			ErrorCode = XST_FAILURE;
+			goto END;
+		}
+	}while(XSECURE_CSU_RSA_STATUS_DONE !=
+				((u32)Status & XSECURE_CSU_RSA_STATUS_DONE));
+
+END:
+	return ErrorCode;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function loads the RSA 4096 public key provided at
+ * XSecure_RsaInitialize() into RSA RAM and calculates its MINV, so that
+ * XSecure_RsaSignVerifyBatch() can verify signatures without reloading the
+ * modulus and exponent for every signature.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Rsa instance.
+ *
+ * @return	XST_SUCCESS if the key is loaded.
+ *
+ * @note	The key remains loaded until any other RSA operation is
+ *		performed on the RSA core, through this or any other instance.
+ *		Other operations on this instance mark the key as unloaded and
+ *		XSecure_RsaSignVerifyBatch() loads it again, while operations
+ *		through other instances require this API to be called again.
+ *
+ ******************************************************************************/
+s32 XSecure_RsaKeyLoad(XSecure_Rsa *InstancePtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	InstancePtr->EncDec = XSECURE_RSA_SIGN_ENC;
+	InstancePtr->SizeInWords = XSECURE_RSA_4096_SIZE_WORDS;
+
+	/* Initialize Modular exponentiation */
+	XSecure_RsaWriteMem(InstancePtr, (u32 *)InstancePtr->ModExpo,
+					XSECURE_CSU_RSA_RAM_EXPO);
+
+	/* Initialize Modular. */
+	XSecure_RsaWriteMem(InstancePtr, (u32 *)InstancePtr->Mod,
+					XSECURE_CSU_RSA_RAM_MOD);
+
+	/* Calculate MINV once for all the signatures */
+	XSecure_RsaMod32Inverse(InstancePtr);
+
+	InstancePtr->KeyLoaded = TRUE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function verifies a list of RSA 4096 signatures against the public key
+ * of the instance back to back. The modulus, exponent and MINV are loaded only
+ * once, each signature only writes its digest and the modulus extension,
+ * which the previous result overwrites, before the operation is started.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Rsa instance.
+ * @param	List		Pointer to the array of signatures to be verified.
+ *		The Status of each entry is updated with its result.
+ * @param	Count		Number of entries in the list.
+ * @param	Result		Pointer to a buffer of XSECURE_RSA_4096_KEY_SIZE
+ *		bytes used to hold the decrypted signature.
+ *
+ * @return	XST_SUCCESS if all the signatures matched, XST_FAILURE
+ *		otherwise.
+ *
+ * @note	The key is loaded by calling XSecure_RsaKeyLoad() when it is
+ *		not already loaded for this instance. All entries are
+ *		processed even after a failure.
+ *
+ ******************************************************************************/
+u32 XSecure_RsaSignVerifyBatch(XSecure_Rsa *InstancePtr,
+		XSecure_RsaSignEntry *List, u32 Count, u8 *Result)
+{
+	u32 Status = XST_SUCCESS;
+	u32 RsaControl = XSECURE_CSU_RSA_CONTROL_4096 +
+				XSECURE_CSU_RSA_CONTROL_EXP;
+	u32 Index;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(List != NULL);
+	Xil_AssertNonvoid(Result != NULL);
+
+	if (InstancePtr->KeyLoaded != TRUE) {
+		(void)XSecure_RsaKeyLoad(InstancePtr);
+	}
+	else {
+		/* Other instances may have changed the registers */
+		XSecure_RsaPutMinv(InstancePtr);
+	}
+
+	if (InstancePtr->ModExt != NULL) {
+		RsaControl = XSECURE_CSU_RSA_CONTROL_MASK;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		List[Index].Status = XST_FAILURE;
+
+		if ((List[Index].Signature == NULL) ||
+			(List[Index].Hash == NULL)) {
+			Status = XST_FAILURE;
+			continue;
+		}
+
+		if (InstancePtr->ModExt != NULL) {
+			/* Initialize Modular extension (R*R Mod M) */
+			XSecure_RsaWriteMem(InstancePtr,
+				(u32 *)InstancePtr->ModExt,
+				XSECURE_CSU_RSA_RAM_RES_Y);
+		}
+
+		/* Initialize Digest */
+		XSecure_RsaWriteMem(InstancePtr,
+				(u32 *)List[Index].Signature,
+				XSECURE_CSU_RSA_RAM_DIGEST);
+
+		/* Start the RSA operation. */
+		XSecure_WriteReg(InstancePtr->BaseAddress,
+				XSECURE_CSU_RSA_CONTROL_OFFSET, RsaControl);
+
+		if (XSecure_RsaWaitForDone(InstancePtr) != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			continue;
+		}
+
+		/* Copy the result */
+		XSecure_RsaGetData(InstancePtr, (u32 *)Result);
+
+		List[Index].Status = XSecure_RsaSignVerification(Result,
+				List[Index].Hash, List[Index].HashLen);
+		if (List[Index].Status != (u32)XST_SUCCESS) {
+			Status = XST_FAILURE;
+		}
+	}
+
+	return Status;
+}
@@ -72,6 +72,8 @@
 *       vns  17/08/17 Added APIs XSecure_RsaPublicEncrypt and
 *                     XSecure_RsaPrivateDecrypt.As per functionality
 *                     XSecure_RsaPublicEncrypt is same as XSecure_RsaDecrypt.
+* 3.0   ag   10/14/26 Added XSecure_RsaKeyLoad and XSecure_RsaSignVerifyBatch
+*                     APIs and the loaded key state to XSecure_Rsa.
 *
 * </pre>
 *
@@ -163,7 +165,19 @@ typedef struct {
 	u8* ModExpo; /**< Exponent */
 	u8 EncDec; /**< 0 for signature verification and 1 for generation */
 	u32 SizeInWords;/** RSA key size in words */
+	u32 Minv; /**< Cached MINV of the loaded modulus */
+	u8 KeyLoaded; /**< TRUE when the public key is present in RSA RAM */
 } XSecure_Rsa;
+
+/**
+ * One entry of a batch of signatures verified with the same public key.
+ */
+typedef struct {
+	u8 *Signature; /**< Signature of XSECURE_RSA_4096_KEY_SIZE bytes */
+	u8 *Hash; /**< Hash of the data to be authenticated */
+	u32 HashLen; /**< Hash length, SHA3 or SHA2 hash size */
+	u32 Status; /**< Result, XST_SUCCESS if the signature matched */
+} XSecure_RsaSignEntry;
 /**
 @}
 @endcond */
@@ -186,6 +200,12 @@ s32 XSecure_RsaPublicEncrypt(XSecure_Rsa *InstancePtr, u8 *Input, u32 Size,
 s32 XSecure_RsaPrivateDecrypt(XSecure_Rsa *InstancePtr, u8 *Input, u32 Size,
 								u8 *Result);
 
+/* Loads the public key once for repeated signature verification */
+s32 XSecure_RsaKeyLoad(XSecure_Rsa *InstancePtr);
+
+u32 XSecure_RsaSignVerifyBatch(XSecure_Rsa *InstancePtr,
+		XSecure_RsaSignEntry *List, u32 Count, u8 *Result);
+
 #ifdef __cplusplus
 extern "C" }
 #endif
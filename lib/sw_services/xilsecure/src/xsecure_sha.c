@@ -46,6 +46,13 @@
 * 2.2   vns  07/06/17 Added doxygen tags
 * 3.0   vns  01/23/18 Added NIST SHA3 support.
 *                     Added SSS configuration before every CSU DMA transfer
+*       ag   10/14/26 Added XSecure_Sha3UpdateStart() and
+*                     XSecure_Sha3UpdateWait() to hash data without blocking.
+*       ag   10/14/26 Added XSecure_Sha3UpdateSg() and
+*                     XSecure_Sha3UpdateSgStart() to hash a scatter gather
+*                     list of data blocks.
+*       ag   10/14/26 Excluded the CSU implementation from XSECURE_SHA3_SW
+*                     builds, which use xsecure_sha3_sw.c instead.
 *
 * </pre>
 *
@@ -63,6 +70,10 @@
 
 /************************** Function Prototypes ******************************/
 
+#ifndef XSECURE_SHA3_SW
+static s32 XSecure_Sha3SgValidate(const XSecure_Sha3SgEntry *List, u32 Count);
+#endif
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Definitions *****************************/
@@ -90,12 +101,19 @@ s32 XSecure_Sha3Initialize(XSecure_Sha3 *InstancePtr, XCsuDma* CsuDmaPtr)
 {
 	/* Assert validates the input arguments */
 	Xil_AssertNonvoid(InstancePtr != NULL);
+#ifndef XSECURE_SHA3_SW
 	Xil_AssertNonvoid(CsuDmaPtr != NULL);
+#endif
 
 	InstancePtr->BaseAddress = XSECURE_CSU_SHA3_BASE;
 	InstancePtr->Sha3Len = 0U;
 	InstancePtr->CsuDmaPtr = CsuDmaPtr;
 	InstancePtr->Sha3PadType = XSECURE_CSU_NIST_SHA3;
+	InstancePtr->SgList = NULL;
+	InstancePtr->SgCount = 0U;
+	InstancePtr->SgIndex = 0U;
+	InstancePtr->SgHandler = NULL;
+	InstancePtr->SgRef = NULL;
 	return XST_SUCCESS;
 }
 
@@ -131,6 +149,7 @@ s32 XSecure_Sha3Initialize(XSecure_Sha3 *InstancePtr, XCsuDma* CsuDmaPtr)
 	return XST_SUCCESS;
 }
 
+#ifndef XSECURE_SHA3_SW
 /*****************************************************************************/
 /**
  * @brief
@@ -222,6 +241,31 @@ void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr)
  ******************************************************************************/
 void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size)
+{
+	XSecure_Sha3UpdateStart(InstancePtr, Data, Size);
+
+	XSecure_Sha3UpdateWait(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts the CSU DMA transfer of a new input data block to the
+ * SHA-3 engine and returns without waiting for it to complete.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data for hashing.
+ * @param	Size 		Size of the input data in bytes.
+ *
+ * @return	None
+ *
+ * @note	XSecure_Sha3UpdateWait() has to be called before the next
+ *		update or XSecure_Sha3Finish(). The data must not be modified
+ *		until then.
+ *
+ ******************************************************************************/
+void XSecure_Sha3UpdateStart(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size)
 {
 	/* Asserts validate the input arguments */
 	Xil_AssertVoid(InstancePtr != NULL);
@@ -234,6 +278,24 @@ void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 
 	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
 					(UINTPTR)Data, (u32)Size/4, 0);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the data block transfer started by
+ * XSecure_Sha3UpdateStart() to complete.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	None
+ *
+ *
+ ******************************************************************************/
+void XSecure_Sha3UpdateWait(XSecure_Sha3 *InstancePtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
 
 	/* Checking the CSU DMA done bit should be enough. */
 	XCsuDma_WaitForDone(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL);
@@ -244,6 +306,210 @@ void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 }
 
 
+/*****************************************************************************/
+/**
+ * @brief
+ * This function validates a scatter gather list of data blocks.
+ *
+ * @param	List 		Pointer to the scatter gather list.
+ * @param	Count 		Number of entries in the list.
+ *
+ * @return	XST_SUCCESS if the list is valid, XST_INVALID_PARAM otherwise.
+ *
+ * @note	CSU DMA transfers words, so all the blocks except the last one
+ *		must be a multiple of 4 bytes for the blocks to be hashed as
+ *		one message without copying them.
+ *
+ ******************************************************************************/
+static s32 XSecure_Sha3SgValidate(const XSecure_Sha3SgEntry *List, u32 Count)
+{
+	u32 Index;
+
+	if ((List == NULL) || (Count == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		if ((List[Index].Data == NULL) || (List[Index].Size == 0U)) {
+			return XST_INVALID_PARAM;
+		}
+		if ((Index != (Count - 1U)) &&
+			((List[Index].Size % 4U) != 0U)) {
+			return XST_INVALID_PARAM;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates the hash with a scatter gather list of data blocks.
+ * The blocks are transferred to the SHA-3 engine directly from their
+ * locations, one CSU DMA transfer per block.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	List 		Pointer to the scatter gather list.
+ * @param	Count 		Number of entries in the list.
+ *
+ * @return	XST_SUCCESS if the blocks are hashed, XST_INVALID_PARAM if
+ *		the list is invalid.
+ *
+ * @note	All the blocks except the last one must be a multiple of 4
+ *		bytes.
+ *
+ ******************************************************************************/
+s32 XSecure_Sha3UpdateSg(XSecure_Sha3 *InstancePtr,
+		const XSecure_Sha3SgEntry *List, u32 Count)
+{
+	u32 Index;
+	s32 Status;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Status = XSecure_Sha3SgValidate(List, Count);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		XSecure_Sha3UpdateStart(InstancePtr, List[Index].Data,
+						List[Index].Size);
+		XSecure_Sha3UpdateWait(InstancePtr);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts updating the hash with a scatter gather list of data
+ * blocks and returns after the first block transfer is started. The next
+ * blocks are started from XSecure_Sha3SgIntrHandler() on CSU DMA done.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	List 		Pointer to the scatter gather list.
+ * @param	Count 		Number of entries in the list.
+ * @param	Handler 	Callback invoked when all the blocks have been
+ *		transferred, can be NULL.
+ * @param	CallBackRef 	Reference passed to the callback.
+ *
+ * @return	XST_SUCCESS if the transfer is started, XST_INVALID_PARAM if
+ *		the list is invalid or XST_DEVICE_BUSY if a list is already in
+ *		progress.
+ *
+ * @note	XSecure_Sha3SgIntrHandler() has to be called from the CSU DMA
+ *		interrupt handler, or polled, until XSecure_Sha3SgIsDone()
+ *		returns TRUE. The list and the blocks must not be modified
+ *		until then. The CSU DMA source channel done interrupt is
+ *		enabled while the list is in progress.
+ *
+ ******************************************************************************/
+s32 XSecure_Sha3UpdateSgStart(XSecure_Sha3 *InstancePtr,
+		const XSecure_Sha3SgEntry *List, u32 Count,
+		XSecure_Sha3SgHandler Handler, void *CallBackRef)
+{
+	s32 Status;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (InstancePtr->SgList != NULL) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Status = XSecure_Sha3SgValidate(List, Count);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	InstancePtr->SgList = List;
+	InstancePtr->SgCount = Count;
+	InstancePtr->SgIndex = 0U;
+	InstancePtr->SgHandler = Handler;
+	InstancePtr->SgRef = CallBackRef;
+
+	XCsuDma_EnableIntr(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+						XCSUDMA_IXR_DONE_MASK);
+
+	XSecure_Sha3UpdateStart(InstancePtr, List[0].Data, List[0].Size);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function services the scatter gather list in progress. It
+ * acknowledges the CSU DMA done of the current block and starts the transfer
+ * of the next block, or invokes the callback after the last block.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	None
+ *
+ * @note	It does nothing if no list is in progress or the current
+ *		block transfer is not done.
+ *
+ ******************************************************************************/
+void XSecure_Sha3SgIntrHandler(XSecure_Sha3 *InstancePtr)
+{
+	const XSecure_Sha3SgEntry *Entry;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	if ((InstancePtr->SgList == NULL) ||
+		((XCsuDma_IntrGetStatus(InstancePtr->CsuDmaPtr,
+		XCSUDMA_SRC_CHANNEL) & XCSUDMA_IXR_DONE_MASK) == 0U)) {
+		return;
+	}
+
+	/* Acknowledge the transfer has completed */
+	XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+						XCSUDMA_IXR_DONE_MASK);
+
+	InstancePtr->SgIndex++;
+	if (InstancePtr->SgIndex < InstancePtr->SgCount) {
+		Entry = &InstancePtr->SgList[InstancePtr->SgIndex];
+		XSecure_Sha3UpdateStart(InstancePtr, Entry->Data, Entry->Size);
+	}
+	else {
+		XCsuDma_DisableIntr(InstancePtr->CsuDmaPtr,
+				XCSUDMA_SRC_CHANNEL, XCSUDMA_IXR_DONE_MASK);
+		InstancePtr->SgList = NULL;
+
+		if (InstancePtr->SgHandler != NULL) {
+			InstancePtr->SgHandler(InstancePtr->SgRef);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function checks whether the scatter gather list started with
+ * XSecure_Sha3UpdateSgStart() has been transferred.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	TRUE if no list is in progress, FALSE otherwise.
+ *
+ ******************************************************************************/
+u32 XSecure_Sha3SgIsDone(XSecure_Sha3 *InstancePtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return (InstancePtr->SgList == NULL) ? (u32)TRUE : (u32)FALSE;
+}
+
 /*****************************************************************************/
 /**
  * @brief
@@ -394,3 +660,4 @@ void XSecure_Sha3_ReadHash(XSecure_Sha3 *InstancePtr, u8 *Hash)
 		HashPtr[11U - Index] = Val;
 	}
 }
+#endif /* XSECURE_SHA3_SW */
@@ -53,6 +53,10 @@
 * A pointer to CsuDma instance has to be passed in initialization as CSU
 * DMA will be used for data transfers to SHA module.
 *
+* When the library is built with sha3_sw_mode enabled (XSECURE_SHA3_SW),
+* the same APIs are implemented in software by xsecure_sha3_sw.c and the
+* CSU SHA-3 engine is not used. The CsuDma instance may be NULL in this mode.
+*
 *
 * @note
 *
@@ -65,6 +69,9 @@
 * 2.0   vns  01/28/17 Added API to read SHA3 hash.
 * 2.2   vns  07/06/17 Added doxygen tags
 * 3.0   vns  01/23/18 Added NIST SHA3 support.
+*       ag   10/14/26 Added non blocking SHA3 update APIs.
+*       ag   10/14/26 Added scatter gather SHA3 update APIs.
+*       ag   10/14/26 Added software SHA3 state for XSECURE_SHA3_SW builds.
 *
 * </pre>
 *
@@ -83,6 +90,7 @@ extern "C" {
 #include "xsecure_hw.h"
 #include "xcsudma.h"
 #include "xil_assert.h"
+#include "xsecure_config.h"
 
 /************************** Constant Definitions ****************************/
 /** @cond xsecure_internal
@@ -110,6 +118,20 @@ typedef enum {
 	XSECURE_CSU_KECCAK_SHA3 /**< Keccak sha3 */
 }XSecure_Sha3PadType;
 
+/**
+ * Entry of a scatter gather list of data blocks to be hashed
+ */
+typedef struct {
+	const u8 *Data; /**< Pointer to the data block */
+	u32 Size; /**< Size of the data block in bytes */
+} XSecure_Sha3SgEntry;
+
+/**
+ * Callback invoked when all the blocks of a scatter gather list have been
+ * transferred to the SHA-3 engine
+ */
+typedef void (*XSecure_Sha3SgHandler)(void *CallBackRef);
+
 /**
  * The SHA-3 driver instance data structure. A pointer to an instance data
  * structure is passed around by functions to refer to a specific driver
@@ -120,6 +142,16 @@ typedef struct {
 	XCsuDma *CsuDmaPtr; /**< Pointer to CSU DMA Instance */
 	u32 Sha3Len; /**< SHA3 Input Length */
 	XSecure_Sha3PadType Sha3PadType; /** Selection for Sha3 */
+	const XSecure_Sha3SgEntry *SgList; /**< Scatter gather list in
+					     *  progress */
+	u32 SgCount; /**< Number of entries in the list */
+	u32 SgIndex; /**< Entry being transferred */
+	XSecure_Sha3SgHandler SgHandler; /**< Scatter gather done callback */
+	void *SgRef; /**< Callback reference for SgHandler */
+#ifdef XSECURE_SHA3_SW
+	u64 State[25]; /**< Keccak state of the software SHA-3 */
+	u8 Block[XSECURE_SHA3_BLOCK_LEN]; /**< Partial input block */
+#endif
 } XSecure_Sha3;
 /**
 @}
@@ -133,6 +165,16 @@ void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr);
 /* Data Transfer */
 void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size);
+void XSecure_Sha3UpdateStart(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size);
+void XSecure_Sha3UpdateWait(XSecure_Sha3 *InstancePtr);
+s32 XSecure_Sha3UpdateSg(XSecure_Sha3 *InstancePtr,
+		const XSecure_Sha3SgEntry *List, u32 Count);
+s32 XSecure_Sha3UpdateSgStart(XSecure_Sha3 *InstancePtr,
+		const XSecure_Sha3SgEntry *List, u32 Count,
+		XSecure_Sha3SgHandler Handler, void *CallBackRef);
+void XSecure_Sha3SgIntrHandler(XSecure_Sha3 *InstancePtr);
+u32 XSecure_Sha3SgIsDone(XSecure_Sha3 *InstancePtr);
 void XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, u8 *Hash);
 
 /* Complete SHA digest calculation */
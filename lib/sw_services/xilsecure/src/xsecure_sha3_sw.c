@@ -0,0 +1,518 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsecure_sha3_sw.c
+*
+* This file contains the software implementation of the SHA-3 interface
+* functions, used in place of the CSU SHA-3 engine when the library is built
+* with XSECURE_SHA3_SW defined. Refer to the header file xsecure_sha.h for
+* more detailed information.
+*
+* As each instance keeps its own Keccak state, hashes can be calculated on
+* several processors at the same time without sharing the CSU SHA-3 engine.
+* On A53 in 64 bit mode NEON is used to absorb the input blocks.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/14/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsecure_sha.h"
+
+#ifdef XSECURE_SHA3_SW
+#if defined (__aarch64__) && defined (__ARM_NEON)
+#include <arm_neon.h>
+#define XSECURE_SHA3_NEON
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define XSECURE_SHA3_ROUNDS		(24U) /**< Keccak-f[1600] rounds */
+#define XSECURE_SHA3_HASH_LEN		(48U) /**< SHA3-384 hash length */
+#define XSECURE_SHA3_BLOCK_LANES	(XSECURE_SHA3_BLOCK_LEN / 8U)
+
+/* Iota step round constants */
+static const u64 XSecure_KeccakRc[XSECURE_SHA3_ROUNDS] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+	0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+	0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL };
+
+/* Rho step rotation of each lane, in the order the pi step visits them */
+static const u8 XSecure_KeccakRho[24] = {
+	1U, 3U, 6U, 10U, 15U, 21U, 28U, 36U, 45U, 55U, 2U, 14U,
+	27U, 41U, 56U, 8U, 25U, 43U, 62U, 18U, 39U, 61U, 20U, 44U };
+
+/* Pi step lane order */
+static const u8 XSecure_KeccakPi[24] = {
+	10U, 7U, 11U, 17U, 18U, 3U, 5U, 16U, 8U, 21U, 24U, 4U,
+	15U, 23U, 19U, 13U, 12U, 2U, 20U, 14U, 22U, 9U, 6U, 1U };
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XSecure_KeccakRotl(Lane, Count) \
+	(((Lane) << (Count)) | ((Lane) >> (64U - (Count))))
+
+/************************** Function Prototypes ******************************/
+
+static void XSecure_KeccakF(u64 *State);
+static void XSecure_Sha3Absorb(XSecure_Sha3 *InstancePtr, const u8 *Data);
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function applies the Keccak-f[1600] permutation on the state.
+ *
+ * @param	State	Pointer to the 25 lanes of the Keccak state.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_KeccakF(u64 *State)
+{
+	u64 Bc[5];
+	u64 Tmp;
+	u32 Round;
+	u32 Index;
+	u32 Col;
+
+	for (Round = 0U; Round < XSECURE_SHA3_ROUNDS; Round++) {
+		/* Theta */
+		for (Col = 0U; Col < 5U; Col++) {
+			Bc[Col] = State[Col] ^ State[Col + 5U] ^
+				State[Col + 10U] ^ State[Col + 15U] ^
+				State[Col + 20U];
+		}
+		for (Col = 0U; Col < 5U; Col++) {
+			Tmp = Bc[(Col + 4U) % 5U] ^
+				XSecure_KeccakRotl(Bc[(Col + 1U) % 5U], 1U);
+			for (Index = 0U; Index < 25U; Index += 5U) {
+				State[Index + Col] ^= Tmp;
+			}
+		}
+
+		/* Rho and pi */
+		Tmp = State[1];
+		for (Index = 0U; Index < 24U; Index++) {
+			Col = XSecure_KeccakPi[Index];
+			Bc[0] = State[Col];
+			State[Col] = XSecure_KeccakRotl(Tmp,
+					(u32)XSecure_KeccakRho[Index]);
+			Tmp = Bc[0];
+		}
+
+		/* Chi */
+		for (Index = 0U; Index < 25U; Index += 5U) {
+			for (Col = 0U; Col < 5U; Col++) {
+				Bc[Col] = State[Index + Col];
+			}
+			for (Col = 0U; Col < 5U; Col++) {
+				State[Index + Col] ^= (~Bc[(Col + 1U) % 5U]) &
+						Bc[(Col + 2U) % 5U];
+			}
+		}
+
+		/* Iota */
+		State[0] ^= XSecure_KeccakRc[Round];
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function absorbs one block of XSECURE_SHA3_BLOCK_LEN bytes into the
+ * state and permutes it.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the block, which need not be aligned.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_Sha3Absorb(XSecure_Sha3 *InstancePtr, const u8 *Data)
+{
+	u64 *State = InstancePtr->State;
+	u32 Lane = 0U;
+
+#ifdef XSECURE_SHA3_NEON
+	/* Lanes are little endian, as is the A53 */
+	for (; (Lane + 1U) < XSECURE_SHA3_BLOCK_LANES; Lane += 2U) {
+		vst1q_u64(&State[Lane], veorq_u64(vld1q_u64(&State[Lane]),
+			vreinterpretq_u64_u8(vld1q_u8(&Data[Lane * 8U]))));
+	}
+#endif
+
+	for (; Lane < XSECURE_SHA3_BLOCK_LANES; Lane++) {
+		u64 Val = 0U;
+		u32 Byte;
+
+		for (Byte = 8U; Byte > 0U; Byte--) {
+			Val = (Val << 8U) | (u64)Data[(Lane * 8U) + Byte - 1U];
+		}
+		State[Lane] ^= Val;
+	}
+
+	XSecure_KeccakF(State);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts a new SHA-3 calculation by clearing the state.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->Sha3Len = 0U;
+	(void)memset(InstancePtr->State, 0, sizeof(InstancePtr->State));
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates hash for new input data block.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data for hashing.
+ * @param	Size 		Size of the input data in bytes.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size)
+{
+	u32 Partial;
+	u32 Len;
+	u32 Offset = 0U;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Size != (u32)0x00U);
+
+	Partial = InstancePtr->Sha3Len % XSECURE_SHA3_BLOCK_LEN;
+	InstancePtr->Sha3Len += Size;
+
+	/* Complete the block left by the previous update */
+	if (Partial != 0U) {
+		Len = XSECURE_SHA3_BLOCK_LEN - Partial;
+		if (Len > Size) {
+			Len = Size;
+		}
+		(void)memcpy(&InstancePtr->Block[Partial], Data, Len);
+		Offset = Len;
+		if ((Partial + Len) == XSECURE_SHA3_BLOCK_LEN) {
+			XSecure_Sha3Absorb(InstancePtr, InstancePtr->Block);
+		}
+	}
+
+	/* Full blocks are absorbed in place */
+	while ((Size - Offset) >= XSECURE_SHA3_BLOCK_LEN) {
+		XSecure_Sha3Absorb(InstancePtr, &Data[Offset]);
+		Offset += XSECURE_SHA3_BLOCK_LEN;
+	}
+
+	if (Offset < Size) {
+		(void)memcpy(InstancePtr->Block, &Data[Offset], Size - Offset);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates hash for new input data block. The software
+ * implementation completes the update before returning.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data for hashing.
+ * @param	Size 		Size of the input data in bytes.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3UpdateStart(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size)
+{
+	XSecure_Sha3Update(InstancePtr, Data, Size);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function returns right away as XSecure_Sha3UpdateStart() has already
+ * completed the update.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3UpdateWait(XSecure_Sha3 *InstancePtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates hash with a scatter gather list of data blocks, as
+ * if they were one contiguous message.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	List 		Pointer to the scatter gather list.
+ * @param	Count 		Number of entries in the list.
+ *
+ * @return	XST_SUCCESS if the list is hashed, XST_INVALID_PARAM if the
+ *		list is invalid.
+ *
+ * @note	Unlike the CSU implementation, blocks need not be a multiple
+ *		of 4 bytes.
+ *
+ ******************************************************************************/
+s32 XSecure_Sha3UpdateSg(XSecure_Sha3 *InstancePtr,
+		const XSecure_Sha3SgEntry *List, u32 Count)
+{
+	s32 Status = XST_SUCCESS;
+	u32 Index;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if ((List == NULL) || (Count == 0U)) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		if ((List[Index].Data == NULL) || (List[Index].Size == 0U)) {
+			Status = XST_INVALID_PARAM;
+			goto END;
+		}
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		XSecure_Sha3Update(InstancePtr, List[Index].Data,
+					List[Index].Size);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function hashes a scatter gather list of data blocks and invokes
+ * the callback. The software implementation hashes the list before
+ * returning, so the callback is invoked from this function.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	List 		Pointer to the scatter gather list.
+ * @param	Count 		Number of entries in the list.
+ * @param	Handler 	Callback invoked once the list is hashed,
+ *		can be NULL.
+ * @param	CallBackRef 	Argument passed to the callback.
+ *
+ * @return	XST_SUCCESS if the list is hashed, XST_INVALID_PARAM if the
+ *		list is invalid.
+ *
+ ******************************************************************************/
+s32 XSecure_Sha3UpdateSgStart(XSecure_Sha3 *InstancePtr,
+		const XSecure_Sha3SgEntry *List, u32 Count,
+		XSecure_Sha3SgHandler Handler, void *CallBackRef)
+{
+	s32 Status;
+
+	Status = XSecure_Sha3UpdateSg(InstancePtr, List, Count);
+	if ((Status == XST_SUCCESS) && (Handler != NULL)) {
+		Handler(CallBackRef);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function does nothing, the software implementation has no transfer
+ * to be serviced.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3SgIntrHandler(XSecure_Sha3 *InstancePtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function checks whether the scatter gather list has been hashed,
+ * which is always the case in the software implementation.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	TRUE
+ *
+ ******************************************************************************/
+u32 XSecure_Sha3SgIsDone(XSecure_Sha3 *InstancePtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return (u32)TRUE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function pads the last block and writes the resulting hash.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Sha3 instance.
+ * @param	Hash		Pointer to location where resulting hash will
+ *		be written
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, u8 *Hash)
+{
+	u32 Partial;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Hash != NULL);
+
+	Partial = InstancePtr->Sha3Len % XSECURE_SHA3_BLOCK_LEN;
+
+	(void)memset(&InstancePtr->Block[Partial], 0,
+			XSECURE_SHA3_BLOCK_LEN - Partial);
+	if (InstancePtr->Sha3PadType == XSECURE_CSU_NIST_SHA3) {
+		InstancePtr->Block[Partial] = 0x6U;
+	}
+	else {
+		InstancePtr->Block[Partial] = 0x1U;
+	}
+	InstancePtr->Block[XSECURE_SHA3_BLOCK_LEN - 1U] |= 0x80U;
+
+	XSecure_Sha3Absorb(InstancePtr, InstancePtr->Block);
+
+	XSecure_Sha3_ReadHash(InstancePtr, Hash);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function calculates the SHA-3 digest on the given input data.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Sha3 instance.
+ * @param	In		Pointer to the input data for hashing
+ * @param	Size		Size of the input data
+ * @param	Out		Pointer to location where resulting hash will
+ *		be written.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3Digest(XSecure_Sha3 *InstancePtr, const u8 *In, const u32 Size,
+								u8 *Out)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Size != (u32)0x00U);
+	Xil_AssertVoid(Out != NULL);
+
+	XSecure_Sha3Start(InstancePtr);
+	XSecure_Sha3Update(InstancePtr, In, Size);
+	XSecure_Sha3Finish(InstancePtr, Out);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * Reads the SHA3 hash from the state. It can be called intermediately of
+ * updates also, like the digest registers of the CSU SHA-3 engine.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Sha3 instance.
+ * @param	Hash		Pointer to a buffer in which read hash will be
+ *		stored.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_Sha3_ReadHash(XSecure_Sha3 *InstancePtr, u8 *Hash)
+{
+	u32 Index;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Hash != NULL);
+
+	for (Index = 0U; Index < XSECURE_SHA3_HASH_LEN; Index++) {
+		Hash[Index] = (u8)(InstancePtr->State[Index / 8U] >>
+					(8U * (Index % 8U)));
+	}
+}
+#endif /* XSECURE_SHA3_SW */
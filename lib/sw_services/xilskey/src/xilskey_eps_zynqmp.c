@@ -64,6 +64,11 @@
 *                      XilSKey_ZynqMp_EfusePs_Write(), so on successful
 *                      efuse programming, programmed fuses can directly read
 *                      from cache of the efuse.
+*       ag    10/14/26 eFUSE rows are now programmed as a plan: requested
+*                      bits are collected into a per row mask, bits already
+*                      blown are skipped and verification is done once per
+*                      row for each margin read, added
+*                      XilSKey_ZynqMp_EfusePs_WriteAndVerifyRow().
 *
 * </pre>
 *
@@ -123,6 +128,9 @@ u32 XilSKey_ZynqMp_EfusePs_ReadRow(u8 Row, XskEfusePs_Type EfuseType,
 							u32 *RowData);
 u32 XilSKey_ZynqMp_EfusePs_WriteAndVerifyBit(u8 Row, u8 Column,
 						XskEfusePs_Type EfuseType);
+u32 XilSKey_ZynqMp_EfusePs_WriteAndVerifyRow(u8 Row, u32 Mask,
+						XskEfusePs_Type EfuseType);
+static inline void XilSKey_ZynqMp_EfusePs_SetMarginRead(u8 MarginRead);
 u32 XilSKey_ZynqMp_EfusePs_CheckForZeros(u8 RowStart, u8 RowEnd,
 						XskEfusePs_Type EfuseType);
 static inline u32 XilSKey_ZynqMp_EfusePs_Enable_Rsa(u8 *RsaBits_read);
@@ -799,7 +807,10 @@ static inline u32 XilSKey_ZynqMp_EfusePsWrite_Checks(
 *		XST_SUCCESS - On success
 *		XST_FAILURE - on Failure
 *
-* @note		None.
+* @note		The bits requested for each row are first collected into a
+*		32 bit mask and rows with nothing to program are skipped, the
+*		mask is then handed to XilSKey_ZynqMp_EfusePs_WriteAndVerifyRow()
+*		which only blows the bits not yet programmed.
 *
 ******************************************************************************/
 static inline u32 XilSKey_ZynqMp_EfusePs_WriteAndVerify_RowRange(u8 *Data,
@@ -808,21 +819,27 @@ static inline u32 XilSKey_ZynqMp_EfusePs_WriteAndVerify_RowRange(u8 *Data,
 	u8 Row;
 	u8 Column;
 	u32 Status;
-	u32 Bit;
+	u32 Mask;
+	u8 *RowBits;
 
 	for (Row = RowStart; Row <= RowEnd; Row++) {
-		for (Column = 0; Column < 32; Column++) {
-			Bit = (Row - RowStart) * XSK_ZYNQMP_EFUSEPS_MAX_BITS_IN_ROW;
-			Bit += Column;
-			if (Data[Bit]) {
-				Status =
-				XilSKey_ZynqMp_EfusePs_WriteAndVerifyBit(Row,
-							Column, EfuseType);
-				if (Status != XST_SUCCESS) {
-					return Status;
-				}
+		RowBits = &Data[(Row - RowStart) *
+				XSK_ZYNQMP_EFUSEPS_MAX_BITS_IN_ROW];
+		Mask = 0U;
+		for (Column = 0; Column < XSK_ZYNQMP_EFUSEPS_MAX_BITS_IN_ROW;
+							Column++) {
+			if (RowBits[Column]) {
+				Mask |= (u32)1U << Column;
 			}
 		}
+		if (Mask == 0U) {
+			continue;
+		}
+		Status = XilSKey_ZynqMp_EfusePs_WriteAndVerifyRow(Row, Mask,
+							EfuseType);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
 	}
 
 	return XST_SUCCESS;
@@ -937,7 +954,6 @@ u32 XilSKey_ZynqMp_EfusePs_WriteAndVerifyBit(u8 Row, u8 Column,
 	u32 RowData;
 	u32 Status;
 	u8 MarginRead = 0;
-	u32 ReadReg;
 
 	/* Programming bit */
 	Status = XilSKey_ZynqMp_EfusePs_WriteBit(Row, Column, EfuseType);
@@ -964,14 +980,7 @@ u32 XilSKey_ZynqMp_EfusePs_WriteAndVerifyBit(u8 Row, u8 Column,
 			MarginRead <= XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_2_RD;
 				MarginRead++) {
 
-		ReadReg = XilSKey_ReadReg(XSK_ZYNQMP_EFUSEPS_BASEADDR,
-				XSK_ZYNQMP_EFUSEPS_CFG_OFFSET) &
-				(~XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_RD_MASK);
-		ReadReg = ReadReg |
-				(MarginRead << XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_RD_SHIFT);
-
-		XilSKey_WriteReg(XSK_ZYNQMP_EFUSEPS_BASEADDR, \
-				XSK_ZYNQMP_EFUSEPS_CFG_OFFSET, ReadReg);
+		XilSKey_ZynqMp_EfusePs_SetMarginRead(MarginRead);
 
 		Status = XilSKey_ZynqMp_EfusePs_ReadRow(Row, EfuseType, &RowData);
 
@@ -988,6 +997,125 @@ u32 XilSKey_ZynqMp_EfusePs_WriteAndVerifyBit(u8 Row, u8 Column,
 
 }
 
+/*****************************************************************************/
+/* This function programs and verifys the bits of Mask in a row of efuse array
+*
+* @param	Row specifies the row number.
+* @param	Mask specifies the bits of the row to be programmed.
+* @param	EfuseType specifies the efuse type.
+*
+* @return
+*		XST_SUCCESS - On success
+*		ErrorCode - on Failure
+*
+* @note		The row is read back with margin 2 read before programming
+*		and only the bits of Mask which are not yet set are blown,
+*		verification is then done once for the whole row with each
+*		margin read. AES key rows can't be read back, so all bits of
+*		Mask are programmed and the key is to be checked with CRC.
+*
+******************************************************************************/
+u32 XilSKey_ZynqMp_EfusePs_WriteAndVerifyRow(u8 Row, u32 Mask,
+						XskEfusePs_Type EfuseType)
+{
+	u32 RowData;
+	u32 Status;
+	u32 ToBePrgrmd = Mask;
+	u8 Column;
+	u8 MarginRead;
+	u8 AesRow = FALSE;
+
+	if ((Row >= XSK_ZYNQMP_EFUSEPS_AES_KEY_START_ROW) &&
+			(Row <= XSK_ZYNQMP_EFUSEPS_AES_KEY_END_ROW)) {
+		AesRow = TRUE;
+	}
+
+	if (AesRow == FALSE) {
+		/*
+		 * Strictest read, a weakly programmed bit reads as zero
+		 * and is programmed again
+		 */
+		XilSKey_ZynqMp_EfusePs_SetMarginRead(
+				XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_2_RD);
+		Status = XilSKey_ZynqMp_EfusePs_ReadRow(Row, EfuseType,
+							&RowData);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+		ToBePrgrmd &= ~RowData;
+	}
+
+	for (Column = 0; ToBePrgrmd != 0U; Column++) {
+		if ((ToBePrgrmd & ((u32)1U << Column)) == 0U) {
+			continue;
+		}
+		ToBePrgrmd &= ~((u32)1U << Column);
+
+		Status = XilSKey_ZynqMp_EfusePs_WriteBit(Row, Column,
+							EfuseType);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+
+		XilSKey_WriteReg(XSK_ZYNQMP_EFUSEPS_BASEADDR,
+				XSK_ZYNQMP_EFUSEPS_ISR_OFFSET,
+				XilSKey_ReadReg(XSK_ZYNQMP_EFUSEPS_BASEADDR,
+					XSK_ZYNQMP_EFUSEPS_ISR_OFFSET));
+	}
+
+	if (AesRow == TRUE) {
+		return XST_SUCCESS;
+	}
+
+	/* verifying the programmed row */
+	for (MarginRead = XSK_ZYNQMP_EFUSEPS_CFG_NORMAL_RD;
+			MarginRead <= XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_2_RD;
+				MarginRead++) {
+
+		XilSKey_ZynqMp_EfusePs_SetMarginRead(MarginRead);
+
+		Status = XilSKey_ZynqMp_EfusePs_ReadRow(Row, EfuseType,
+							&RowData);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+
+		if ((RowData & Mask) != Mask) {
+			return XSK_EFUSEPS_ERROR_VERIFICATION;
+		}
+	}
+
+	return XST_SUCCESS;
+
+}
+
+/*****************************************************************************/
+/*
+* This function selects the read mode used for reading efuse array.
+*
+* @param	MarginRead is the margin read mode to be configured, one of
+*		XSK_ZYNQMP_EFUSEPS_CFG_NORMAL_RD, XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_1_RD
+*		or XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_2_RD.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static inline void XilSKey_ZynqMp_EfusePs_SetMarginRead(u8 MarginRead)
+{
+	u32 ReadReg;
+
+	ReadReg = XilSKey_ReadReg(XSK_ZYNQMP_EFUSEPS_BASEADDR,
+			XSK_ZYNQMP_EFUSEPS_CFG_OFFSET) &
+			(~XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_RD_MASK);
+	ReadReg = ReadReg |
+			((u32)MarginRead << XSK_ZYNQMP_EFUSEPS_CFG_MARGIN_RD_SHIFT);
+
+	XilSKey_WriteReg(XSK_ZYNQMP_EFUSEPS_BASEADDR,
+			XSK_ZYNQMP_EFUSEPS_CFG_OFFSET, ReadReg);
+}
+
 /*****************************************************************************/
 /*
 * This function returns particular row data directly from efuse array.
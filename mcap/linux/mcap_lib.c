@@ -71,18 +71,21 @@ static char *MCapFindTypeofFile(const char *s1, const char *s2)
 	return NULL;
 }
 
-static u32 MCapProcessRBT(FILE *fptr, u32 *buf)
+static u32 MCapProcessRBT(const char *raw, u32 sz, u32 *buf)
 {
-	char *raw = NULL;
+	const char *end = raw + sz;
+	const char *eol;
 	int i, read;
-	size_t linelen;
 	u32 count = 0, len = 0, result = 0;
 
-	while ((read = getline(&raw, &linelen, fptr)) != -1) {
-		if (raw[0] != '1' && raw[1] != '0')
+	for (; raw < end; raw += read) {
+		eol = memchr(raw, '\n', end - raw);
+		read = eol ? (eol - raw) + 1 : end - raw;
+
+		if (raw[0] != '1' && (read < 2 || raw[1] != '0'))
 			continue;
 
-		for (i = 0; i < read - 1; i++) {
+		for (i = 0; i < read; i++) {
 			if (raw[i] == '1' || raw[i] == '0') {
 				result = (result << 1) | (raw[i] - 0x30);
 				count++;
@@ -99,64 +102,28 @@ static u32 MCapProcessRBT(FILE *fptr, u32 *buf)
 	return len;
 }
 
-static u32 MCapProcessBIT(FILE *fptr, u32 *buf, int sz)
+static u32 MCapProcessBIT(const u8 *buf, u32 sz, u32 *offset)
 {
-	int err;
-	u8 value, len = 0;
+	u32 i;
 
 	/*
 	 * .bit files are not guaranteed to be aligned with
 	 * the bitstream sync word on a 32-bit boundary. So,
 	 * we need to check every byte here.
 	 */
-	while ((err = fread(&value, 1, 1, fptr)) == 1) {
-		len++; if (value == MCAP_SYNC_BYTE0)
-		  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-		    len++; if (value == MCAP_SYNC_BYTE1)
-		      if ((err = fread(&value, 1, 1, fptr)) == 1) {
-			len++; if (value == MCAP_SYNC_BYTE2)
-			  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-				len++; if (value == MCAP_SYNC_BYTE3)
-					break;
-			  }
-		      }
+	for (i = 0; i + 4 <= sz; i++) {
+		if (buf[i] == MCAP_SYNC_BYTE0 &&
+		    buf[i + 1] == MCAP_SYNC_BYTE1 &&
+		    buf[i + 2] == MCAP_SYNC_BYTE2 &&
+		    buf[i + 3] == MCAP_SYNC_BYTE3) {
+			*offset = i;
+			return (sz - i)/4;
 		}
 	}
 
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
-		return 0;
-	}
-
-	if (err != 1 && feof(fptr)) {
-		pr_err("Failed to find SYNC Word in BIT file\n");
-		return 0;
-	}
-
-	*buf++ = __bswap_32(MCAP_SYNC_DWORD);
+	pr_err("Failed to find SYNC Word in BIT file\n");
 
-	while ((err = fread(buf, sz - len, 1, fptr)) == 1)
-		;
-
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
-		return 0;
-	}
-
-	return (sz - len)/4 + 1;
-}
-
-static u32 MCapProcessBIN(FILE *fptr, u32 *buf, int sz)
-{
-	int err;
-
-	err = fread(buf, sz, 1, fptr);
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIN file\n");
-		return 0;
-	}
-
-	return sz/4;
+	return 0;
 }
 
 static int MCapDoBusWalk(struct mcap_dev *mdev)
@@ -226,11 +193,50 @@ static int Checkforcompletion(struct mcap_dev *mdev)
 	return 0;
 }
 
-static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
+/*
+ * Streams the bitstream words to the MCAP Data register. The words are
+ * written with pwrite() on the sysfs config space file when it could be
+ * opened, which avoids the libpci access method for every word. The
+ * status is only checked every MCAP_STATUS_CHECK_WORDS words.
+ */
+static int MCapWriteData(struct mcap_dev *mdev, const u8 *data,
+			 int len, u8 bswap)
+{
+	off_t pos = mdev->reg_base + MCAP_DATA;
+	u32 value;
+	int count;
+
+	for (count = 0; count < len; count++) {
+		/* The data of .bit files need not be word aligned */
+		memcpy(&value, data + (count * 4), sizeof(value));
+		if (bswap)
+			value = __bswap_32(value);
+
+		if (mdev->cfg_fd >= 0) {
+			value = htole32(value);
+			if (pwrite(mdev->cfg_fd, &value, sizeof(value), pos) !=
+			    sizeof(value)) {
+				pr_err("Failed to write MCAP Data register\n");
+				return -EMCAPWRITE;
+			}
+		} else {
+			MCapRegWrite(mdev, MCAP_DATA, value);
+		}
+
+		if (((count + 1) % MCAP_STATUS_CHECK_WORDS) == 0 &&
+		    (MCapRegRead(mdev, MCAP_STATUS) &
+		     (MCAP_STS_ERR_MASK | MCAP_STS_FIFO_OVERFLOW_MASK)))
+			return -EMCAPWRITE;
+	}
+
+	return 0;
+}
+
+static int MCapWritePartialBitStream(struct mcap_dev *mdev, const u8 *data,
 					int len, u8 bswap)
 {
 	u32 set, restore;
-	int err, count = 0, i;
+	int err, i;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -260,19 +266,15 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	MCapRegWrite(mdev, MCAP_CONTROL, set);
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
-	}
+	err = MCapWriteData(mdev, data, len, bswap);
 
-	for (i = 0 ; i < EMCAP_EOS_LOOP_COUNT; i++) {
-		MCapRegWrite(mdev, MCAP_DATA, EMCAP_NOOP_VAL);
+	if (!err) {
+		for (i = 0 ; i < EMCAP_EOS_LOOP_COUNT; i++) {
+			MCapRegWrite(mdev, MCAP_DATA, EMCAP_NOOP_VAL);
+		}
 	}
 
-	if (IsErrSet(mdev) || IsFifoOverflow(mdev)) {
+	if (err || IsErrSet(mdev) || IsFifoOverflow(mdev)) {
 		pr_err("Failed to Write Bitstream\n");
 		MCapRegWrite(mdev, MCAP_CONTROL, restore);
 		MCapFullReset(mdev);
@@ -289,11 +291,11 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	return 0;
 }
 
-static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
+static int MCapWriteBitStream(struct mcap_dev *mdev, const u8 *data,
 			      int len, u8 bswap)
 {
 	u32 set, restore;
-	int err, count = 0;
+	int err;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -325,12 +327,13 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 	}
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
+	err = MCapWriteData(mdev, data, len, bswap);
+
+	if (err) {
+		pr_err("Failed to Write Bitstream\n");
+		MCapRegWrite(mdev, MCAP_CONTROL, restore);
+		MCapFullReset(mdev);
+		return -EMCAPWRITE;
 	}
 
 	/* Check for Completion */
@@ -353,9 +356,25 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 	return 0;
 }
 
+static void MCapOpenConfigFile(struct mcap_dev *mdev)
+{
+	char path[64];
+
+	snprintf(path, sizeof(path),
+		 "/sys/bus/pci/devices/%04x:%02x:%02x.%d/config",
+		 mdev->pdev->domain, mdev->pdev->bus, mdev->pdev->dev,
+		 mdev->pdev->func);
+
+	mdev->cfg_fd = open(path, O_RDWR);
+	if (mdev->cfg_fd < 0)
+		pr_dbg("Unable to open %s, using libpci for downloads\n", path);
+}
+
 void MCapLibFree(struct mcap_dev *mdev)
 {
 	if (mdev) {
+		if (mdev->cfg_fd >= 0)
+			close(mdev->cfg_fd);
 		pci_cleanup(mdev->pacc);
 		free(mdev);
 	}
@@ -375,6 +394,7 @@ struct mcap_dev *MCapLibInit(int device_id)
 	mdev->pacc = pci_alloc();
 
 	mdev->is_multiplebit = 0;
+	mdev->cfg_fd = -1;
 
 	/* Initialize the PCI library */
 	pci_init(mdev->pacc);
@@ -407,6 +427,8 @@ struct mcap_dev *MCapLibInit(int device_id)
 		goto free_resources;
 	}
 
+	MCapOpenConfigFile(mdev);
+
 	return mdev;
 
 free_resources:
@@ -597,41 +619,56 @@ void MCapDumpRegs(struct mcap_dev *mdev)
 
 int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
 {
-	FILE *fptr;
-	u32 *data;
-	u32 binsz, wrdatasz;
-	int err = 0;
+	struct stat st;
+	u8 *map;
+	u32 *rbtdata = NULL;
+	const u8 *data = NULL;
+	u32 binsz, wrdatasz = 0, offset = 0;
+	int fd, err = 0;
 	u8 bswap = 0;
 
-	/* Get the size */
-	fptr = fopen(file_path, "rb");
-	if (fptr == NULL)
+	/* Map the file, it is only read once from start to end */
+	fd = open(file_path, O_RDONLY);
+	if (fd < 0)
 		return -EMCAPCFG;
-	fseek(fptr, 0L, SEEK_END);
-	binsz = ftell(fptr);
-	fseek(fptr, 0L, SEEK_SET);
 
-	/* Allocate the buffer */
-	data = malloc(binsz);
-	if (data == NULL)
+	if (fstat(fd, &st) || st.st_size == 0) {
+		close(fd);
 		return -EMCAPCFG;
+	}
+	binsz = st.st_size;
+
+	map = mmap(NULL, binsz, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED) {
+		close(fd);
+		return -EMCAPCFG;
+	}
+	madvise(map, binsz, MADV_SEQUENTIAL);
 
 	/* Process files and Read the data */
 	if (MCapFindTypeofFile(file_path, MCAP_RBT_FILE)) {
 
 		/* Read the RBT file */
-		wrdatasz = MCapProcessRBT(fptr, data);
+		rbtdata = malloc(binsz);
+		if (rbtdata == NULL) {
+			err = -EMCAPCFG;
+			goto free_resources;
+		}
+		wrdatasz = MCapProcessRBT((const char *)map, binsz, rbtdata);
+		data = (const u8 *)rbtdata;
 
 	} else if (MCapFindTypeofFile(file_path, MCAP_BIT_FILE)) {
 
 		/* Read the BIT file */
-		wrdatasz = MCapProcessBIT(fptr, data, binsz);
+		wrdatasz = MCapProcessBIT(map, binsz, &offset);
+		data = map + offset;
 		bswap = 1;
 
 	} else if (MCapFindTypeofFile(file_path, MCAP_BIN_FILE)) {
 
 		/* Read the BIN file */
-		wrdatasz = MCapProcessBIN(fptr, data, binsz);
+		wrdatasz = binsz/4;
+		data = map;
 		bswap = 1;
 
 	} else {
@@ -645,20 +682,25 @@ int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
 	/* Program FPGA */
 	if (bitfile_type == EMCAP_PARTIALCONFIG_FILE) {
 		err = MCapWritePartialBitStream(mdev, data, wrdatasz, bswap);
-		if (err)
-			return -EMCAPCFG;
+		if (err) {
+			err = -EMCAPCFG;
+			goto free_resources;
+		}
 		pr_info("FPGA Partial Configuration Done!!\n");
 	} else if (bitfile_type == EMCAP_CONFIG_FILE) {
 		err = MCapWriteBitStream(mdev, data, wrdatasz, bswap);
-		if (err)
-			return -EMCAPCFG;
+		if (err) {
+			err = -EMCAPCFG;
+			goto free_resources;
+		}
 		pr_info("FPGA Configuration Done!!\n");
 	}
 
 free_resources:
-	if (data)
-		free(data);
-	fclose(fptr);
+	if (rbtdata)
+		free(rbtdata);
+	munmap(map, binsz);
+	close(fd);
 
 	return err;
 }
@@ -41,6 +41,11 @@
 #include <string.h>
 #include <ctype.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <endian.h>
 
 #include "pci.h"
 #include "lspci.h"
@@ -78,6 +83,9 @@
 /* Maximum FIFO Depth */
 #define MCAP_FIFO_DEPTH		16
 
+/* Number of words written between the status checks of a download */
+#define MCAP_STATUS_CHECK_WORDS	4096
+
 /* PCIe Extended Capability Id */
 #define MCAP_EXT_CAP_ID		0xB
 
@@ -116,6 +124,7 @@ struct mcap_dev {
 	struct pci_access *pacc;
 	unsigned int reg_base;
 	u32 is_multiplebit;
+	int cfg_fd;	/* sysfs config space file, -1 if not available */
 };
 
 #define MCapRegWrite(mdev, offset, value) \